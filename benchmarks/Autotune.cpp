@@ -0,0 +1,59 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "./Benchmark.hpp"
+using namespace El;
+
+// Tunes the algorithmic blocksizes for each of the given grid shapes and
+// writes a blocksize profile, which is loaded by Initialize when the
+// environment variable EL_BLOCKSIZE_PROFILE names it
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const string gridHeights =
+          Input("--gridHeights","comma-separated grid heights (0: default)",
+                string("0"));
+        const Int n = Input("--n","size of the tuning problems",2000);
+        const string candidates =
+          Input("--candidates","comma-separated candidate blocksizes",
+                string("32,64,96,128,192,256"));
+        const Int numTrials = Input("--numTrials","number of trials",2);
+        const bool progress = Input("--progress","print progress?",true);
+        const string output =
+          Input("--output","blocksize profile",string("blocksizes.txt"));
+        ProcessInput();
+        PrintInputReport();
+
+        AutotuneCtrl ctrl;
+        ctrl.size = n;
+        ctrl.candidates = bench::ParseList( candidates );
+        ctrl.numTrials = numTrials;
+        ctrl.progress = progress;
+
+        // The entries of any profile loaded by Initialize are preserved
+        // unless they are retuned here
+        for( const int gridHeight : bench::GridHeights( gridHeights, comm ) )
+        {
+            const Grid g( comm, gridHeight );
+            AutotuneBlocksizes<float>( g, ctrl );
+            AutotuneBlocksizes<double>( g, ctrl );
+            AutotuneBlocksizes<Complex<float>>( g, ctrl );
+            AutotuneBlocksizes<Complex<double>>( g, ctrl );
+        }
+        WriteBlocksizeProfile( output );
+        OutputFromRoot(comm,"Wrote blocksize profile to ",output);
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
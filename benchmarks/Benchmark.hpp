@@ -0,0 +1,222 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_BENCHMARK_HPP
+#define EL_BENCHMARK_HPP
+
+#include <El.hpp>
+#include <fstream>
+
+// Shared infrastructure of the benchmark drivers. Each driver sweeps over a
+// list of process grid heights (and, optionally, weak rather than strong
+// scaling of the problem size) and appends one JSON record per benchmark to
+// a JSON array of the form
+//
+//   [{"benchmark":"Cholesky","datatype":"double","processes":4,
+//     "grid":[2,2],"parameters":{"n":4000,"nb":96},
+//     "phases":[{"name":"Factor","seconds":0.5,"gflops":42.6,
+//                "bytes":1.2e8,"messages":3072}, ...],
+//     "seconds":0.6,"gflops":40.1,"bytes":1.3e8}, ...]
+//
+// The time of each phase is the maximum over the processes, the bytes and
+// messages are summed over the processes (as recorded by the profiling
+// layer), and, unless a model of the number of flops of a phase is given, the
+// flops are those counted by the local BLAS wrappers.
+
+namespace bench {
+
+using namespace El;
+
+// Parses a comma-separated list of integers
+inline vector<Int> ParseList( const string& list )
+{
+    vector<Int> values;
+    std::istringstream is( list );
+    string item;
+    while( std::getline( is, item, ',' ) )
+        if( !item.empty() )
+            values.push_back( std::stoll(item) );
+    return values;
+}
+
+// The grid heights to sweep over, where zero selects Grid::DefaultHeight and
+// heights which do not evenly divide the number of processes are skipped
+inline vector<int> GridHeights( const string& list, mpi::Comm comm )
+{
+    const int commSize = mpi::Size( comm );
+    vector<int> heights;
+    for( const Int height : ParseList(list) )
+    {
+        const int gridHeight =
+          ( height == 0 ? Grid::DefaultHeight(commSize) : int(height) );
+        if( gridHeight > 0 && commSize % gridHeight == 0 )
+            heights.push_back( gridHeight );
+        else
+            OutputFromRoot
+            (comm,"Skipping grid height ",height," since it does not divide ",
+             commSize);
+    }
+    return heights;
+}
+
+// The problem size for 'numProcs' processes, where 'n' is the size for a
+// single process. For weak scaling, the memory per process of a problem whose
+// storage grows as n^'dimension' is held fixed.
+inline Int ScaledSize( Int n, int numProcs, bool weak, double dimension=2 )
+{
+    if( !weak )
+        return n;
+    return Int( n*Pow(double(numProcs),1./dimension) );
+}
+
+inline void PrintJSONString( std::ostream& os, const string& str )
+{
+    os << '"';
+    for( const char c : str )
+    {
+        if( c == '"' || c == '\\' )
+            os << '\\';
+        os << c;
+    }
+    os << '"';
+}
+
+class Report
+{
+public:
+    // The root process writes the records to 'filename'
+    Report( mpi::Comm comm, const string& filename )
+    : comm_(comm), numRecords_(0), open_(false)
+    {
+        if( mpi::Rank(comm_) == 0 )
+        {
+            file_.open( filename.c_str() );
+            if( !file_.is_open() )
+                RuntimeError("Could not open ",filename);
+            file_ << "[";
+        }
+        EnableProfiling();
+    }
+
+    ~Report()
+    {
+        DisableProfiling();
+        if( mpi::Rank(comm_) == 0 )
+            file_ << "\n]\n";
+    }
+
+    template<typename T>
+    void Begin( const string& benchmark, const Grid& grid )
+    {
+        EL_DEBUG_CSE
+        if( open_ )
+            LogicError("The previous benchmark was not ended");
+        open_ = true;
+        record_.str( "" );
+        parameters_.str( "" );
+        phases_.str( "" );
+        numParameters_ = numPhases_ = 0;
+        seconds_ = flops_ = bytes_ = 0;
+        record_ << "{\"benchmark\":";
+        PrintJSONString( record_, benchmark );
+        record_ << ",\"datatype\":";
+        PrintJSONString( record_, TypeName<T>() );
+        record_ << ",\"processes\":" << grid.Size()
+                << ",\"grid\":[" << grid.Height() << "," << grid.Width()
+                << "]";
+        OutputFromRoot
+        (comm_,benchmark," with ",TypeName<T>()," on a ",grid.Height()," x ",
+         grid.Width()," grid");
+    }
+
+    template<typename S>
+    void Parameter( const string& key, const S& value )
+    {
+        parameters_ << ( numParameters_++ == 0 ? "" : "," );
+        PrintJSONString( parameters_, key );
+        parameters_ << ":" << value;
+    }
+    void Parameter( const string& key, const string& value )
+    {
+        parameters_ << ( numParameters_++ == 0 ? "" : "," );
+        PrintJSONString( parameters_, key );
+        parameters_ << ":";
+        PrintJSONString( parameters_, value );
+    }
+    void Parameter( const string& key, const char* value )
+    { Parameter( key, string(value) ); }
+
+    // Times (and records the communication of) the given function. A
+    // negative number of flops selects the count of the local BLAS wrappers.
+    template<typename Function>
+    void Phase( const string& name, double flops, Function function )
+    {
+        EL_DEBUG_CSE
+        mpi::Barrier( comm_ );
+        const ProfileTotals before = GetProfileTotals();
+        Timer timer;
+        timer.Start();
+        function();
+        mpi::Barrier( comm_ );
+        const double localSeconds = timer.Stop();
+        const ProfileTotals after = GetProfileTotals();
+
+        const double seconds =
+          mpi::AllReduce( localSeconds, mpi::MAX, comm_ );
+        double counts[3] =
+          { after.flops-before.flops,
+            after.commBytes-before.commBytes,
+            double(after.numCommCalls-before.numCommCalls) };
+        mpi::AllReduce( counts, 3, mpi::SUM, comm_ );
+        if( flops < 0 )
+            flops = counts[0];
+        const double gflops = ( seconds > 0 ? flops/(1.e9*seconds) : 0. );
+
+        phases_ << ( numPhases_++ == 0 ? "" : "," ) << "{\"name\":";
+        PrintJSONString( phases_, name );
+        phases_ << ",\"seconds\":" << seconds << ",\"gflops\":" << gflops
+                << ",\"bytes\":" << counts[1] << ",\"messages\":" << counts[2]
+                << "}";
+        seconds_ += seconds;
+        flops_ += flops;
+        bytes_ += counts[1];
+        OutputFromRoot
+        (comm_,"  ",name,": ",seconds," [s], ",gflops," [GFlop/s], ",
+         counts[1]," [bytes]");
+    }
+
+    void End()
+    {
+        EL_DEBUG_CSE
+        if( !open_ )
+            LogicError("No benchmark was begun");
+        open_ = false;
+        if( mpi::Rank(comm_) != 0 )
+            return;
+        const double gflops =
+          ( seconds_ > 0 ? flops_/(1.e9*seconds_) : 0. );
+        file_ << ( numRecords_++ == 0 ? "\n" : ",\n" ) << record_.str()
+              << ",\"parameters\":{" << parameters_.str() << "}"
+              << ",\"phases\":[" << phases_.str() << "]"
+              << ",\"seconds\":" << seconds_ << ",\"gflops\":" << gflops
+              << ",\"bytes\":" << bytes_ << "}";
+        file_.flush();
+    }
+
+private:
+    mpi::Comm comm_;
+    std::ofstream file_;
+    Int numRecords_, numParameters_, numPhases_;
+    bool open_;
+    std::ostringstream record_, parameters_, phases_;
+    double seconds_, flops_, bytes_;
+};
+
+} // namespace bench
+
+#endif // ifndef EL_BENCHMARK_HPP
@@ -0,0 +1,105 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "./Benchmark.hpp"
+using namespace El;
+
+template<typename F>
+void BenchmarkFactorizations
+( bench::Report& report, const Grid& g, Int n, Int numRHS, Int nb )
+{
+    const double scale = ( IsComplex<F>::value ? 4. : 1. );
+    const double solveFlops = scale*2.*n*n*numRHS;
+
+    {
+        DistMatrix<F> A(g), B(g);
+        HermitianUniformSpectrum( A, n, 1, 10 );
+        Uniform( B, n, numRHS );
+        report.Begin<F>( "Cholesky", g );
+        report.Parameter( "n", n );
+        report.Parameter( "numRHS", numRHS );
+        report.Parameter( "nb", nb );
+        report.Phase( "Factor", scale*n*n*n/3.,
+          [&]() { Cholesky( LOWER, A ); } );
+        report.Phase( "Solve", solveFlops,
+          [&]() { cholesky::SolveAfter( LOWER, NORMAL, A, B ); } );
+        report.End();
+    }
+
+    {
+        DistMatrix<F> A(g), B(g);
+        DistPermutation P(g);
+        Uniform( A, n, n );
+        Uniform( B, n, numRHS );
+        report.Begin<F>( "LU", g );
+        report.Parameter( "n", n );
+        report.Parameter( "numRHS", numRHS );
+        report.Parameter( "nb", nb );
+        report.Phase( "Factor", scale*2.*n*n*n/3.,
+          [&]() { LU( A, P ); } );
+        report.Phase( "Solve", solveFlops,
+          [&]() { lu::SolveAfter( NORMAL, A, P, B ); } );
+        report.End();
+    }
+
+    {
+        DistMatrix<F> A(g), householderScalars(g), B(g), X(g);
+        DistMatrix<Base<F>> signature(g);
+        Uniform( A, n, n );
+        Uniform( B, n, numRHS );
+        report.Begin<F>( "QR", g );
+        report.Parameter( "n", n );
+        report.Parameter( "numRHS", numRHS );
+        report.Parameter( "nb", nb );
+        report.Phase( "Factor", scale*4.*n*n*n/3.,
+          [&]() { QR( A, householderScalars, signature ); } );
+        report.Phase( "Solve", scale*3.*n*n*numRHS,
+          [&]()
+          { qr::SolveAfter
+            ( NORMAL, A, householderScalars, signature, B, X ); } );
+        report.End();
+    }
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const string gridHeights =
+          Input("--gridHeights","comma-separated grid heights (0: default)",
+                string("0"));
+        const bool weak = Input("--weak","weak (instead of strong) scaling?",
+                                false);
+        const Int n = Input("--n","size of matrices (per process if weak)",
+                            4000);
+        const Int numRHS = Input("--numRHS","number of right-hand sides",100);
+        const Int nb = Input("--nb","algorithmic blocksize",96);
+        const string output =
+          Input("--output","JSON output file",string("Factor.json"));
+        ProcessInput();
+        PrintInputReport();
+
+        SetBlocksize( nb );
+        bench::Report report( comm, output );
+        const Int nScaled = bench::ScaledSize( n, mpi::Size(comm), weak );
+        for( const int gridHeight : bench::GridHeights( gridHeights, comm ) )
+        {
+            const Grid g( comm, gridHeight );
+            BenchmarkFactorizations<double>( report, g, nScaled, numRHS, nb );
+            BenchmarkFactorizations<Complex<double>>
+            ( report, g, nScaled, numRHS, nb );
+        }
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -0,0 +1,133 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "./Benchmark.hpp"
+using namespace El;
+
+// Generates a random m x n sparse matrix with (roughly) 'numNonzeros' entries
+// per row, with the (i,i) entry kept away from zero so that A has full row
+// rank
+template<typename Real>
+void RandomSparse( DistSparseMatrix<Real>& A, Int m, Int n, Int numNonzeros )
+{
+    EL_DEBUG_CSE
+    Zeros( A, m, n );
+    const Int localHeight = A.LocalHeight();
+    A.Reserve( localHeight*numNonzeros );
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+    {
+        const Int i = A.GlobalRow(iLoc);
+        A.QueueLocalUpdate( iLoc, i, Real(2)+SampleUniform<Real>() );
+        for( Int k=1; k<numNonzeros; ++k )
+            A.QueueLocalUpdate
+            ( iLoc, SampleUniform<Int>(0,n), SampleUniform<Real>() );
+    }
+    A.ProcessLocalQueues();
+}
+
+// Generates a random feasible, bounded direct-form LP,
+//
+//   min c^T x s.t. A x = b, x >= 0,
+//
+// by choosing b = A x0 for a strictly positive x0 and a strictly positive c
+template<typename Real>
+void RandomDirectLP
+( const Grid& g, Int m, Int n, Int numNonzeros,
+  DistSparseMatrix<Real>& A, DistMultiVec<Real>& b, DistMultiVec<Real>& c )
+{
+    EL_DEBUG_CSE
+    A.SetGrid( g );
+    b.SetGrid( g );
+    c.SetGrid( g );
+    RandomSparse( A, m, n, numNonzeros );
+    DistMultiVec<Real> x0(g);
+    Zeros( x0, n, 1 );
+    MakeUniform( x0, Real(1), Real(1)/Real(2) );
+    Zeros( b, m, 1 );
+    Multiply( NORMAL, Real(1), A, x0, Real(0), b );
+    Zeros( c, n, 1 );
+    MakeUniform( c, Real(1), Real(1)/Real(2) );
+}
+
+template<typename Real>
+void BenchmarkLP
+( bench::Report& report, const Grid& g, Int m, Int n, Int numNonzeros )
+{
+    DirectLPProblem<DistSparseMatrix<Real>,DistMultiVec<Real>> problem;
+    DirectLPSolution<DistMultiVec<Real>> solution;
+    RandomDirectLP( g, m, n, numNonzeros, problem.A, problem.b, problem.c );
+    solution.x.SetGrid( g );
+    solution.y.SetGrid( g );
+    solution.z.SetGrid( g );
+
+    report.Begin<Real>( "LP", g );
+    report.Parameter( "m", m );
+    report.Parameter( "n", n );
+    report.Parameter( "numNonzeros", numNonzeros );
+    report.Phase( "Mehrotra", -1,
+      [&]() { LP( problem, solution, lp::direct::Ctrl<Real>(true) ); } );
+    report.End();
+}
+
+template<typename Real>
+void BenchmarkQP
+( bench::Report& report, const Grid& g, Int m, Int n, Int numNonzeros )
+{
+    DistSparseMatrix<Real> Q(g), A(g);
+    DistMultiVec<Real> b(g), c(g), x(g), y(g), z(g);
+    Identity( Q, n, n );
+    RandomDirectLP( g, m, n, numNonzeros, A, b, c );
+
+    report.Begin<Real>( "QP", g );
+    report.Parameter( "m", m );
+    report.Parameter( "n", n );
+    report.Parameter( "numNonzeros", numNonzeros );
+    report.Phase( "Mehrotra", -1, [&]() { QP( Q, A, b, c, x, y, z ); } );
+    report.End();
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const string gridHeights =
+          Input("--gridHeights","comma-separated grid heights (0: default)",
+                string("0"));
+        const bool weak = Input("--weak","weak (instead of strong) scaling?",
+                                false);
+        const Int m = Input("--m","number of constraints (per process if weak)",
+                            10000);
+        const Int n = Input("--n","number of variables (per process if weak)",
+                            20000);
+        const Int numNonzeros =
+          Input("--numNonzeros","number of nonzeros per row",5);
+        const string output =
+          Input("--output","JSON output file",string("IPM.json"));
+        ProcessInput();
+        PrintInputReport();
+
+        bench::Report report( comm, output );
+        // The storage of the sparse problems grows linearly with m and n
+        const int commSize = mpi::Size( comm );
+        const Int mScaled = bench::ScaledSize( m, commSize, weak, 1 );
+        const Int nScaled = bench::ScaledSize( n, commSize, weak, 1 );
+        for( const int gridHeight : bench::GridHeights( gridHeights, comm ) )
+        {
+            const Grid g( comm, gridHeight );
+            BenchmarkLP<double>( report, g, mScaled, nScaled, numNonzeros );
+            BenchmarkQP<double>( report, g, mScaled, nScaled, numNonzeros );
+        }
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
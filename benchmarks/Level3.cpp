@@ -0,0 +1,112 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "./Benchmark.hpp"
+using namespace El;
+
+template<typename T>
+void BenchmarkGemm
+( bench::Report& report, const Grid& g, Int m, Int n, Int k, Int nb )
+{
+    const double flops = ( IsComplex<T>::value ? 8. : 2. )*m*n*k;
+    const vector<pair<GemmAlgorithm,string>> algs =
+      { {GEMM_DEFAULT,"DEFAULT"}, {GEMM_SUMMA_A,"SUMMA_A"},
+        {GEMM_SUMMA_B,"SUMMA_B"}, {GEMM_SUMMA_C,"SUMMA_C"},
+        {GEMM_SUMMA_DOT,"SUMMA_DOT"}, {GEMM_CANNON,"CANNON"},
+        {GEMM_25D,"25D"} };
+    DistMatrix<T> A(g), B(g), C(g);
+    Uniform( A, m, k );
+    Uniform( B, k, n );
+    for( const auto& alg : algs )
+    {
+        // Cannon's algorithm requires a square process grid
+        if( alg.first == GEMM_CANNON && g.Height() != g.Width() )
+            continue;
+        Zeros( C, m, n );
+        report.Begin<T>( "Gemm", g );
+        report.Parameter( "algorithm", alg.second );
+        report.Parameter( "m", m );
+        report.Parameter( "n", n );
+        report.Parameter( "k", k );
+        report.Parameter( "nb", nb );
+        report.Phase( "Gemm", flops,
+          [&]()
+          { Gemm( NORMAL, NORMAL, T(1), A, B, T(0), C, alg.first ); } );
+        report.End();
+    }
+}
+
+template<typename T>
+void BenchmarkTrsm
+( bench::Report& report, const Grid& g, Int m, Int n, Int nb )
+{
+    const vector<pair<LeftOrRight,UpperOrLower>> cases =
+      { {LEFT,LOWER}, {LEFT,UPPER}, {RIGHT,LOWER}, {RIGHT,UPPER} };
+    for( const auto& trsmCase : cases )
+    {
+        const LeftOrRight side = trsmCase.first;
+        const UpperOrLower uplo = trsmCase.second;
+        const Int order = ( side==LEFT ? m : n );
+        const double flops =
+          ( IsComplex<T>::value ? 4. : 1. )*double(order)*m*n;
+
+        // Make the triangle well-conditioned
+        DistMatrix<T> A(g), B(g);
+        Uniform( A, order, order );
+        ShiftDiagonal( A, T(order) );
+        Uniform( B, m, n );
+        report.Begin<T>( "Trsm", g );
+        report.Parameter( "side", side==LEFT ? "LEFT" : "RIGHT" );
+        report.Parameter( "uplo", uplo==LOWER ? "LOWER" : "UPPER" );
+        report.Parameter( "m", m );
+        report.Parameter( "n", n );
+        report.Parameter( "nb", nb );
+        report.Phase( "Trsm", flops,
+          [&]() { Trsm( side, uplo, NORMAL, NON_UNIT, T(1), A, B ); } );
+        report.End();
+    }
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const string gridHeights =
+          Input("--gridHeights","comma-separated grid heights (0: default)",
+                string("0"));
+        const bool weak = Input("--weak","weak (instead of strong) scaling?",
+                                false);
+        const Int n = Input("--n","size of matrices (per process if weak)",
+                            4000);
+        const Int nb = Input("--nb","algorithmic blocksize",96);
+        const string output =
+          Input("--output","JSON output file",string("Level3.json"));
+        ProcessInput();
+        PrintInputReport();
+
+        SetBlocksize( nb );
+        bench::Report report( comm, output );
+        const Int nScaled = bench::ScaledSize( n, mpi::Size(comm), weak );
+        for( const int gridHeight : bench::GridHeights( gridHeights, comm ) )
+        {
+            const Grid g( comm, gridHeight );
+            BenchmarkGemm<double>( report, g, nScaled, nScaled, nScaled, nb );
+            BenchmarkGemm<Complex<double>>
+            ( report, g, nScaled, nScaled, nScaled, nb );
+            BenchmarkTrsm<double>( report, g, nScaled, nScaled, nb );
+            BenchmarkTrsm<Complex<double>>( report, g, nScaled, nScaled, nb );
+        }
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
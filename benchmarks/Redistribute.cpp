@@ -0,0 +1,102 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "./Benchmark.hpp"
+using namespace El;
+
+template<typename T,Dist U,Dist V>
+void SetBlocksize( DistMatrix<T,U,V>& B, Int blocksize ) { }
+
+template<typename T,Dist U,Dist V>
+void SetBlocksize( DistMatrix<T,U,V,BLOCK>& B, Int blocksize )
+{
+    B.AlignCols( blocksize, 0, 0 );
+    B.AlignRows( blocksize, 0, 0 );
+}
+
+template<typename T,Dist U,Dist V,DistWrap W=ELEMENT>
+void BenchmarkCopy
+( bench::Report& report, const string& name, const DistMatrix<T>& A,
+  Int blocksize )
+{
+    const Grid& g = A.Grid();
+    DistMatrix<T,U,V,W> B(g);
+    SetBlocksize( B, blocksize );
+    report.Begin<T>( "Copy", g );
+    report.Parameter( "redistribution", name );
+    report.Parameter( "m", A.Height() );
+    report.Parameter( "n", A.Width() );
+    report.Parameter( "bytes", double(A.Height())*A.Width()*sizeof(T) );
+    report.Phase( "Copy", 0, [&]() { Copy( A, B ); } );
+    report.Phase( "CopyBack", 0,
+      [&]() { DistMatrix<T> C(g); Copy( B, C ); } );
+    report.End();
+}
+
+template<typename T>
+void BenchmarkRedistributions
+( bench::Report& report, const Grid& g, Int n, Int blocksize )
+{
+    DistMatrix<T> A(g);
+    Uniform( A, n, n );
+    BenchmarkCopy<T,MR,MC>( report, "[MC,MR] -> [MR,MC]", A, blocksize );
+    BenchmarkCopy<T,MC,STAR>( report, "[MC,MR] -> [MC,*]", A, blocksize );
+    BenchmarkCopy<T,STAR,MR>( report, "[MC,MR] -> [*,MR]", A, blocksize );
+    BenchmarkCopy<T,VC,STAR>( report, "[MC,MR] -> [VC,*]", A, blocksize );
+    BenchmarkCopy<T,STAR,VR>( report, "[MC,MR] -> [*,VR]", A, blocksize );
+    BenchmarkCopy<T,STAR,STAR>( report, "[MC,MR] -> [*,*]", A, blocksize );
+    BenchmarkCopy<T,CIRC,CIRC>( report, "[MC,MR] -> [o,o]", A, blocksize );
+    BenchmarkCopy<T,MC,MR,BLOCK>
+    ( report, "[MC,MR] -> [MC,MR,BLOCK]", A, blocksize );
+
+    // Realign the columns and rows of A
+    report.Begin<T>( "Copy", g );
+    report.Parameter( "redistribution", "[MC,MR] -> realigned [MC,MR]" );
+    report.Parameter( "m", n );
+    report.Parameter( "n", n );
+    report.Parameter( "bytes", double(n)*n*sizeof(T) );
+    DistMatrix<T> B(g);
+    B.Align( Mod(A.ColAlign()+1,g.Height()), Mod(A.RowAlign()+1,g.Width()) );
+    report.Phase( "Copy", 0, [&]() { Copy( A, B ); } );
+    report.End();
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const string gridHeights =
+          Input("--gridHeights","comma-separated grid heights (0: default)",
+                string("0"));
+        const bool weak = Input("--weak","weak (instead of strong) scaling?",
+                                false);
+        const Int n = Input("--n","size of matrix (per process if weak)",4000);
+        const Int nb = Input("--nb","distribution blocksize",32);
+        const string output =
+          Input("--output","JSON output file",string("Redistribute.json"));
+        ProcessInput();
+        PrintInputReport();
+
+        bench::Report report( comm, output );
+        const Int nScaled = bench::ScaledSize( n, mpi::Size(comm), weak );
+        for( const int gridHeight : bench::GridHeights( gridHeights, comm ) )
+        {
+            const Grid g( comm, gridHeight );
+            BenchmarkRedistributions<double>( report, g, nScaled, nb );
+            BenchmarkRedistributions<Complex<double>>
+            ( report, g, nScaled, nb );
+        }
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
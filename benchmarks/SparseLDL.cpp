@@ -0,0 +1,80 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "./Benchmark.hpp"
+using namespace El;
+
+template<typename F>
+void BenchmarkSparseLDL
+( bench::Report& report, const Grid& g, Int n, Int numRHS, Int nbSolve )
+{
+    const Int N = n*n*n;
+    DistSparseMatrix<F> A(g);
+    Laplacian( A, n, n, n );
+    A *= -F(1);
+    DistMultiVec<F> B( N, numRHS, g );
+    MakeUniform( B );
+
+    report.Begin<F>( "SparseLDL", g );
+    report.Parameter( "n1", n );
+    report.Parameter( "n2", n );
+    report.Parameter( "n3", n );
+    report.Parameter( "numRHS", numRHS );
+    report.Parameter( "nbSolve", nbSolve );
+    const bool hermitian = true;
+    DistSparseLDLFactorization<F> sparseLDLFact;
+    report.Phase( "Analysis", 0,
+      [&]() { sparseLDLFact.Initialize( A, hermitian ); } );
+    // The flops of the factorization and solve are those of the dense
+    // kernels applied to the fronts
+    report.Phase( "Factor", -1,
+      [&]() { sparseLDLFact.Factor( LDL_2D ); } );
+    SetBlocksize( nbSolve );
+    report.Phase( "Solve", -1, [&]() { sparseLDLFact.Solve( B ); } );
+    report.End();
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const string gridHeights =
+          Input("--gridHeights","comma-separated grid heights (0: default)",
+                string("0"));
+        const bool weak = Input("--weak","weak (instead of strong) scaling?",
+                                false);
+        const Int n = Input("--n","size of each dimension of the 3D grid",40);
+        const Int numRHS = Input("--numRHS","number of right-hand sides",1);
+        const Int nbFact = Input("--nbFact","factorization blocksize",96);
+        const Int nbSolve = Input("--nbSolve","solve blocksize",96);
+        const string output =
+          Input("--output","JSON output file",string("SparseLDL.json"));
+        ProcessInput();
+        PrintInputReport();
+
+        bench::Report report( comm, output );
+        // The number of unknowns grows as n^3
+        const Int nScaled = bench::ScaledSize( n, mpi::Size(comm), weak, 3 );
+        for( const int gridHeight : bench::GridHeights( gridHeights, comm ) )
+        {
+            const Grid g( comm, gridHeight );
+            SetBlocksize( nbFact );
+            BenchmarkSparseLDL<double>( report, g, nScaled, numRHS, nbSolve );
+            SetBlocksize( nbFact );
+            BenchmarkSparseLDL<Complex<double>>
+            ( report, g, nScaled, numRHS, nbSolve );
+        }
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
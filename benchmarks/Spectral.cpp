@@ -0,0 +1,95 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "./Benchmark.hpp"
+using namespace El;
+
+template<typename F>
+void BenchmarkHermitianEig
+( bench::Report& report, const Grid& g, Int n, Int nb )
+{
+    typedef Base<F> Real;
+    DistMatrix<F> A(g), Q(g);
+    DistMatrix<F,STAR,STAR> householderScalars(g), dSub(g);
+    DistMatrix<Real,STAR,STAR> d(g), w(g);
+    HermitianUniformSpectrum( A, n, -10, 10 );
+
+    // The phases of HermitianEig: reduction to tridiagonal form, the
+    // tridiagonal eigensolver, and the backtransformation of the eigenvectors
+    report.Begin<F>( "HermitianEig", g );
+    report.Parameter( "n", n );
+    report.Parameter( "nb", nb );
+    report.Phase( "Tridiag", -1,
+      [&]() { HermitianTridiag( LOWER, A, householderScalars ); } );
+    report.Phase( "TridiagEig", -1,
+      [&]()
+      {
+          GetRealPartOfDiagonal( A, d );
+          GetDiagonal( A, dSub, -1 );
+          HermitianTridiagEig( d, dSub, w, Q );
+      } );
+    report.Phase( "Backtransform", -1,
+      [&]()
+      { herm_tridiag::ApplyQ
+        ( LEFT, LOWER, NORMAL, A, householderScalars, Q ); } );
+    report.End();
+}
+
+template<typename F>
+void BenchmarkSVD( bench::Report& report, const Grid& g, Int n, Int nb )
+{
+    typedef Base<F> Real;
+    DistMatrix<F> A(g), U(g), V(g);
+    DistMatrix<Real,STAR,STAR> s(g);
+    Uniform( A, n, n );
+
+    report.Begin<F>( "SVD", g );
+    report.Parameter( "n", n );
+    report.Parameter( "nb", nb );
+    report.Phase( "Values", -1, [&]() { SVD( A, s ); } );
+    report.Phase( "Vectors", -1, [&]() { SVD( A, U, s, V ); } );
+    report.End();
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const string gridHeights =
+          Input("--gridHeights","comma-separated grid heights (0: default)",
+                string("0"));
+        const bool weak = Input("--weak","weak (instead of strong) scaling?",
+                                false);
+        const Int n = Input("--n","size of matrices (per process if weak)",
+                            2000);
+        const Int nb = Input("--nb","algorithmic blocksize",96);
+        const string output =
+          Input("--output","JSON output file",string("Spectral.json"));
+        ProcessInput();
+        PrintInputReport();
+
+        SetBlocksize( nb );
+        bench::Report report( comm, output );
+        const Int nScaled = bench::ScaledSize( n, mpi::Size(comm), weak );
+        for( const int gridHeight : bench::GridHeights( gridHeights, comm ) )
+        {
+            const Grid g( comm, gridHeight );
+            BenchmarkHermitianEig<double>( report, g, nScaled, nb );
+            BenchmarkHermitianEig<Complex<double>>( report, g, nScaled, nb );
+            BenchmarkSVD<double>( report, g, nScaled, nb );
+            BenchmarkSVD<Complex<double>>( report, g, nScaled, nb );
+        }
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -0,0 +1,19 @@
+#
+#  Copyright 2009-2016, Jack Poulson
+#  All rights reserved.
+#
+#  This file is part of Elemental and is under the BSD 2-Clause License,
+#  which can be found in the LICENSE file in the root directory, or at
+#  http://opensource.org/licenses/BSD-2-Clause
+#
+set(EL_HAVE_CUDA FALSE)
+if(EL_USE_CUDA)
+  # Search for the CUDA runtime and cuBLAS
+  find_package(CUDA)
+  if(CUDA_FOUND AND CUDA_CUBLAS_LIBRARIES)
+    set(EL_HAVE_CUDA TRUE)
+    message(STATUS "Found CUDA ${CUDA_VERSION}")
+  else()
+    message(STATUS "Did NOT find CUDA and cuBLAS")
+  endif()
+endif()
@@ -0,0 +1,38 @@
+#
+#  Copyright 2009-2016, Jack Poulson
+#  All rights reserved.
+#
+#  This file is part of Elemental and is under the BSD 2-Clause License,
+#  which can be found in the LICENSE file in the root directory, or at
+#  http://opensource.org/licenses/BSD-2-Clause
+#
+include(CheckCXXSourceCompiles)
+
+# Hardware performance counters are read through PAPI if it was requested and
+# found and otherwise through the Linux perf_event interface (if available)
+set(EL_HAVE_PAPI FALSE)
+if(EL_USE_PAPI)
+  find_path(PAPI_INCLUDE_DIR papi.h
+    HINTS ${PAPI_DIR} ENV PAPI_DIR PATH_SUFFIXES include)
+  find_library(PAPI_LIBRARY papi
+    HINTS ${PAPI_DIR} ENV PAPI_DIR PATH_SUFFIXES lib lib64)
+  if(PAPI_INCLUDE_DIR AND PAPI_LIBRARY)
+    set(EL_HAVE_PAPI TRUE)
+    message(STATUS "Found PAPI: ${PAPI_LIBRARY}")
+  else()
+    message(STATUS "Did NOT find PAPI")
+  endif()
+endif()
+
+set(PERF_EVENT_CODE
+    "#include <linux/perf_event.h>
+     #include <sys/syscall.h>
+     #include <unistd.h>
+     int main()
+     {
+         perf_event_attr attr;
+         attr.type = PERF_TYPE_HARDWARE;
+         attr.config = PERF_COUNT_HW_CPU_CYCLES;
+         return syscall( __NR_perf_event_open, &attr, 0, -1, -1, 0 ) < -1;
+     }")
+check_cxx_source_compiles("${PERF_EVENT_CODE}" EL_HAVE_PERF_EVENT)
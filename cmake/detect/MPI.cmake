@@ -230,6 +230,23 @@ set(MPIX_IALLGATHER_CODE
      }")
 El_check_c_source_compiles("${MPIX_IALLGATHER_CODE}" 
   EL_HAVE_MPIX_NONBLOCKING_COLLECTIVES)
+set(MPI_ALLTOALLV_INIT_CODE
+    "#include \"mpi.h\"
+     int main( int argc, char* argv[] )
+     {
+       MPI_Init( &argc, &argv );
+       double *a, *b;
+       int *counts, *displs;
+       MPI_Request request;
+       MPI_Alltoallv_init
+       ( a, counts, displs, MPI_DOUBLE,
+         b, counts, displs, MPI_DOUBLE, MPI_COMM_WORLD, MPI_INFO_NULL,
+         &request );
+       MPI_Finalize();
+       return 0;
+     }")
+El_check_c_source_compiles("${MPI_ALLTOALLV_INIT_CODE}"
+  EL_HAVE_MPI4_PERSISTENT_COLLECTIVES)
 set(MPI_INIT_THREAD_CODE
     "#include \"mpi.h\"
      int main( int argc, char* argv[] )
@@ -0,0 +1,158 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+// A microbenchmark of the local packing and unpacking kernels used by the
+// redistributions (see include/El/blas_like/level1/Copy/util.hpp). Each
+// pattern packs a local matrix into 'stride' portions, unpacks the portions
+// into a second matrix, and checks that the result matches the original.
+
+template<typename T,typename PackFunc,typename UnpackFunc>
+void TimePattern
+( const std::string& pattern,
+  const El::Matrix<T>& A, El::Int numPortions, El::Int portionSize,
+  PackFunc pack, UnpackFunc unpack, El::Int numReps )
+{
+    El::Matrix<T> B;
+    El::Zeros( B, A.Height(), A.Width() );
+    std::vector<T> buffer( numPortions*portionSize );
+
+    El::Timer packTimer, unpackTimer;
+    for( El::Int rep=0; rep<numReps; ++rep )
+    {
+        packTimer.Start();
+        pack( A.LockedBuffer(), A.LDim(), buffer.data() );
+        packTimer.Stop();
+
+        unpackTimer.Start();
+        unpack( buffer.data(), B.Buffer(), B.LDim() );
+        unpackTimer.Stop();
+    }
+
+    B -= A;
+    const double error = double(El::FrobeniusNorm(B));
+    const double numBytes = double(A.Height())*A.Width()*sizeof(T);
+    const double packTime = packTimer.Total()/numReps;
+    const double unpackTime = unpackTimer.Total()/numReps;
+    El::Output
+    ("  ",pattern,": pack ",packTime," [s] (",numBytes/(1.e9*packTime),
+     " [GB/s]), unpack ",unpackTime," [s] (",numBytes/(1.e9*unpackTime),
+     " [GB/s]), ||B - A||_F = ",error);
+    if( error != 0. )
+        El::RuntimeError("The ",pattern," round trip was not exact");
+}
+
+template<typename T>
+void TestPacking
+( El::Int height, El::Int width, El::Int stride, El::Int numReps )
+{
+    using namespace El::copy::util;
+    El::Output
+    ("Testing with T=",El::TypeName<T>(),", ",height," x ",width,
+     " and stride ",stride);
+    El::Matrix<T> A;
+    El::Uniform( A, height, width );
+    const El::Int align = stride/2;
+    const El::Int maxLocalHeight = El::MaxLength( height, stride );
+    const El::Int maxLocalWidth = El::MaxLength( width, stride );
+
+    TimePattern
+    ( "ColStrided", A, stride, maxLocalHeight*width,
+      [&]( const T* ABuf, El::Int ALDim, T* buf )
+      { ColStridedPack
+        ( height, width, align, stride, ABuf, ALDim,
+          buf, maxLocalHeight*width ); },
+      [&]( const T* buf, T* BBuf, El::Int BLDim )
+      { ColStridedUnpack
+        ( height, width, align, stride, buf, maxLocalHeight*width,
+          BBuf, BLDim ); },
+      numReps );
+
+    TimePattern
+    ( "RowStrided", A, stride, height*maxLocalWidth,
+      [&]( const T* ABuf, El::Int ALDim, T* buf )
+      { RowStridedPack
+        ( height, width, align, stride, ABuf, ALDim,
+          buf, height*maxLocalWidth ); },
+      [&]( const T* buf, T* BBuf, El::Int BLDim )
+      { RowStridedUnpack
+        ( height, width, align, stride, buf, height*maxLocalWidth,
+          BBuf, BLDim ); },
+      numReps );
+
+    // View the local matrix as the [U,*] data of a process whose partial
+    // column distribution has a single team member
+    TimePattern
+    ( "PartialColStrided", A, stride, maxLocalHeight*width,
+      [&]( const T* ABuf, El::Int ALDim, T* buf )
+      { PartialColStridedPack
+        ( height, width, align, stride, stride, 1, 0, 0, ABuf, ALDim,
+          buf, maxLocalHeight*width ); },
+      [&]( const T* buf, T* BBuf, El::Int BLDim )
+      { PartialColStridedUnpack
+        ( height, width, align, stride, stride, 1, 0, 0,
+          buf, maxLocalHeight*width, BBuf, BLDim ); },
+      numReps );
+
+    TimePattern
+    ( "PartialRowStrided", A, stride, height*maxLocalWidth,
+      [&]( const T* ABuf, El::Int ALDim, T* buf )
+      { PartialRowStridedPack
+        ( height, width, align, stride, stride, 1, 0, 0, ABuf, ALDim,
+          buf, height*maxLocalWidth ); },
+      [&]( const T* buf, T* BBuf, El::Int BLDim )
+      { PartialRowStridedUnpack
+        ( height, width, align, stride, stride, 1, 0, 0,
+          buf, height*maxLocalWidth, BBuf, BLDim ); },
+      numReps );
+
+    TimePattern
+    ( "Strided", A, stride*stride, maxLocalHeight*maxLocalWidth,
+      [&]( const T* ABuf, El::Int ALDim, T* buf )
+      { StridedPack
+        ( height, width, align, stride, align, stride, ABuf, ALDim,
+          buf, maxLocalHeight*maxLocalWidth ); },
+      [&]( const T* buf, T* BBuf, El::Int BLDim )
+      { StridedUnpack
+        ( height, width, align, stride, align, stride,
+          buf, maxLocalHeight*maxLocalWidth, BBuf, BLDim ); },
+      numReps );
+}
+
+int
+main( int argc, char* argv[] )
+{
+    El::Environment env( argc, argv );
+
+    try
+    {
+        const El::Int height = El::Input("--height","local height",1000);
+        const El::Int width = El::Input("--width","local width",1000);
+        const El::Int maxStride =
+          El::Input("--maxStride","maximum number of portions",8);
+        const El::Int numReps =
+          El::Input("--numReps","number of repetitions",10);
+        El::ProcessInput();
+        El::PrintInputReport();
+
+        if( El::mpi::Rank() == 0 )
+        {
+            for( El::Int stride=1; stride<=maxStride; stride*=2 )
+            {
+                TestPacking<float>( height, width, stride, numReps );
+                TestPacking<double>( height, width, stride, numReps );
+                TestPacking<El::Complex<double>>
+                ( height, width, stride, numReps );
+            }
+        }
+    }
+    catch( std::exception& e ) { El::ReportException(e); }
+
+    return 0;
+}
@@ -7,6 +7,7 @@
 #  http://opensource.org/licenses/BSD-2-Clause
 #
 import El, time
+import numpy as np
 
 n0 = 50
 n1 = 50
@@ -22,34 +23,24 @@ def RemoteStackedFD2D(N0,N1):
   height = 2*N0*N1
   width = N0*N1
   A.Resize(height,width)
-  customLocalHeight = (height/worldSize) + 1
-  A.Reserve(6*customLocalHeight,6*customLocalHeight)
-  for s in xrange(worldRank,height,worldSize):
-    if s < N0*N1:
-      x0 = s % N0
-      x1 = s / N0
-      A.QueueUpdate( s, s, 1 )
-      if x0 > 0:
-        A.QueueUpdate( s, s-1, -1 )
-      if x0+1 < N0:
-        A.QueueUpdate( s, s+1, 2 )
-      if x1 > 0:
-        A.QueueUpdate( s, s-N0, -3 )
-      if x1+1 < N1:
-        A.QueueUpdate( s, s+N0, 4 )
-    else:
-      sRel = s-N0*N1
-      x0 = sRel % N0
-      x1 = sRel / N0
-      A.QueueUpdate( s, sRel, -2 )
-      if x0 > 0:
-        A.QueueUpdate( s, sRel-1, -1 )
-      if x0+1 < N0:
-        A.QueueUpdate( s, sRel+1, -2 )
-      if x1 > 0:
-        A.QueueUpdate( s, sRel-N0, -3 )
-      if x1+1 < N1:
-        A.QueueUpdate( s, sRel+N0, 3 )
+  # Form the triplets of our rows with NumPy and queue them in a single call
+  rows, cols, values = [], [], []
+  def QueueStencil(s,sRel,coefs):
+    x0 = sRel % N0
+    x1 = sRel // N0
+    stencil = ((x0 >= 0,0),(x0 > 0,-1),(x0+1 < N0,1),(x1 > 0,-N0),
+               (x1+1 < N1,N0))
+    for (mask,offset), coef in zip(stencil,coefs):
+      rows.append(s[mask])
+      cols.append(sRel[mask]+offset)
+      values.append(np.full(np.count_nonzero(mask),coef,dtype=float))
+  s = np.arange(worldRank,height,worldSize)
+  sTop = s[s < N0*N1]
+  sBot = s[s >= N0*N1]
+  QueueStencil(sTop,sTop,(1,-1,2,-3,4))
+  QueueStencil(sBot,sBot-N0*N1,(-2,-1,-2,-3,3))
+  A.QueueUpdates(
+    np.concatenate(rows),np.concatenate(cols),np.concatenate(values))
 
   A.ProcessQueues()
   return A
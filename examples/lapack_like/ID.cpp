@@ -26,6 +26,10 @@ int main( int argc, char* argv[] )
         const bool print = El::Input("--print","print matrices?",false);
         const bool smallestFirst =
           El::Input("--smallestFirst","smallest norm first?",false);
+        const bool tournament =
+          El::Input("--tournament","tournament column pivoting?",false);
+        const bool sketched =
+          El::Input("--sketched","pivot on a randomized sketch?",false);
         El::ProcessInput();
         El::PrintInputReport();
 
@@ -51,10 +55,15 @@ int main( int argc, char* argv[] )
             ctrl.tol = tol;
         }
         ctrl.smallestFirst = smallestFirst;
+        if( tournament )
+            ctrl.colPivoting = El::QR_COLPIV_TOURNAMENT;
         El::Timer timer;
         if( El::mpi::Rank(comm) == 0 )
             timer.Start();
-        El::ID( A, Omega, Z, ctrl );
+        if( sketched )
+            El::SketchedID( A, Omega, Z, ctrl );
+        else
+            El::ID( A, Omega, Z, ctrl );
         if( El::mpi::Rank(comm) == 0 )
             timer.Stop();
         const El::Int rank = Z.Height();
@@ -83,6 +83,8 @@ main( int argc, char* argv[] )
           ("--forceComplexPs",
            "switch to complex arithmetic for PS iter's",true);
         const bool arnoldi = El::Input("--arnoldi","use Arnoldi?",true);
+        const El::Int numShiftTeams =
+          El::Input("--numShiftTeams","number of shift-parallel teams",1);
         const El::Int basisSize =
           El::Input("--basisSize","num Arnoldi vectors",10);
         const El::Int maxIts =
@@ -277,6 +279,7 @@ main( int argc, char* argv[] )
         psCtrl.arnoldi = arnoldi;
         psCtrl.basisSize = basisSize;
         psCtrl.progress = progress;
+        psCtrl.numShiftTeams = numShiftTeams;
         psCtrl.schurCtrl.hessSchurCtrl.scalapack = false;
         psCtrl.schurCtrl.hessSchurCtrl.fullTriangle = true;
         psCtrl.schurCtrl.hessSchurCtrl.alg =
@@ -24,6 +24,9 @@ main( int argc, char* argv[] )
         const El::SignScaling scaling =
           static_cast<El::SignScaling>
           (El::Input("--scaling","scaling strategy",0));
+        const El::SignAlgorithm algorithm =
+          static_cast<El::SignAlgorithm>
+          (El::Input("--algorithm","0: Newton, 1: Newton-Schulz, 2: QDWH",0));
         const El::Int maxIts = El::Input("--maxIts","max number of iter's",100);
         const double tol = El::Input("--tol","convergence tolerance",1e-6);
         const bool progress =
@@ -46,6 +49,7 @@ main( int argc, char* argv[] )
         signCtrl.tol = tol;
         signCtrl.progress = progress;
         signCtrl.scaling = scaling;
+        signCtrl.algorithm = algorithm;
 
         El::Timer timer;
         // Compute sgn(A)
@@ -21,6 +21,7 @@ main( int argc, char* argv[] )
         const El::Int n = El::Input("--n","matrix width",50);
         const El::Int k = El::Input("--k","rank of approximation",3);
         const El::Int maxIter = El::Input("--maxIter","max. iterations",20);
+        const bool hals = El::Input("--hals","use HALS updates?",false);
         const bool display = El::Input("--display","display matrices?",false);
         const bool print = El::Input("--print","print matrices",false);
         El::ProcessInput();
@@ -46,6 +47,8 @@ main( int argc, char* argv[] )
         ctrl.nnlsCtrl.socpCtrl.mehrotraCtrl.print = false;
         ctrl.nnlsCtrl.socpCtrl.mehrotraCtrl.time = false;
         ctrl.maxIter = maxIter;
+        if( hals )
+            ctrl.approach = El::NMF_HALS;
 
         El::Timer timer;
         El::DistMatrix<Real> Y;
@@ -68,6 +68,8 @@ main( int argc, char* argv[] )
           El::Input("--usePivQR","use pivoted QR approx?",false);
         const El::Int numPivSteps =
           El::Input("--numPivSteps","number of steps of QR",75);
+        const bool useRandomizedSVT =
+          El::Input("--useRandomizedSVT","use randomized partial SVTs?",false);
         const bool useALM = El::Input("--useALM","use ALM algorithm?",true);
         const bool display = El::Input("--display","display matrices",false);
         const bool print = El::Input("--print","print matrices",true);
@@ -136,6 +138,7 @@ main( int argc, char* argv[] )
         El::RPCACtrl<double> ctrl;
         ctrl.useALM = useALM;
         ctrl.usePivQR = usePivQR;
+        ctrl.useRandomizedSVT = useRandomizedSVT;
         ctrl.progress = print;
         ctrl.numPivSteps = numPivSteps;
         ctrl.maxIts = maxIts;
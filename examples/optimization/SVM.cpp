@@ -21,6 +21,8 @@ main( int argc, char* argv[] )
         const El::Int m = El::Input("--numExamples","number of examples",200);
         const El::Int n = El::Input("--numFeatures","number of features",100);
         const double gamma = El::Input("--gamma","hinge-loss penalty",1.0);
+        const bool useDCD =
+          El::Input("--useDCD","use dual coordinate descent?",false);
         const bool display = El::Input("--display","display matrices?",false);
         const bool print = El::Input("--print","print matrices",false);
         El::ProcessInput();
@@ -69,6 +71,8 @@ main( int argc, char* argv[] )
 
         El::SVMCtrl<Real> ctrl;
         // TODO(poulson): Add support for configuring the IPM
+        if( useDCD )
+            ctrl.approach = El::SVM_DUAL_COORDINATE_DESCENT;
 
         El::Timer timer;
         El::DistMatrix<Real> wHatSVM;
@@ -0,0 +1,108 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+// Solve a sequence of closely-related direct-form Linear Programs,
+//
+//   arginf_x { c_k^T x | A x = b_k, x >= 0 },
+//
+// where (b_k,c_k) are small perturbations of (b_{k-1},c_{k-1}), both from
+// scratch and by warm-starting from the solution of the previous problem
+// (while reusing the equilibration of 'A').
+
+template<typename Real>
+void WarmStartLP
+( El::Int m, El::Int n, El::Int numProblems, Real perturbation, bool print )
+{
+    El::Output("Testing with ",El::TypeName<Real>());
+
+    // Generate a primal and dual feasible problem.
+    El::Matrix<Real> xFeas, yFeas, zFeas;
+    El::Uniform( xFeas, n, 1, Real(1), Real(1) ); // Sample over B_1(1)
+    El::Uniform( yFeas, m, 1 );
+    El::Uniform( zFeas, n, 1, Real(1), Real(1) ); // Sample over B_1(1)
+
+    El::DirectLPProblem<El::Matrix<Real>,El::Matrix<Real>> problem;
+    El::Uniform( problem.A, m, n );
+    El::Gemv( El::NORMAL, Real(1), problem.A, xFeas, problem.b );
+    problem.c = zFeas;
+    El::Gemv( El::TRANSPOSE, Real(-1), problem.A, yFeas, Real(1), problem.c );
+
+    El::lp::direct::Ctrl<Real> coldCtrl(false);
+    coldCtrl.mehrotraCtrl.print = print;
+    auto warmCtrl = coldCtrl;
+    warmCtrl.mehrotraCtrl.primalInit = true;
+    warmCtrl.mehrotraCtrl.dualInit = true;
+    warmCtrl.mehrotraCtrl.warmStart = true;
+    warmCtrl.mehrotraCtrl.reuseEquil = true;
+
+    El::DirectLPSolution<El::Matrix<Real>> coldSolution, warmSolution;
+    El::DirectLPScaling<El::Matrix<Real>> scaling;
+    El::LP( problem, warmSolution, scaling, coldCtrl );
+
+    El::Timer coldTimer, warmTimer;
+    El::Matrix<Real> db, dc;
+    for( El::Int k=0; k<numProblems; ++k )
+    {
+        El::Uniform( db, m, 1, Real(0), perturbation );
+        El::Uniform( dc, n, 1, Real(0), perturbation );
+        problem.b += db;
+        problem.c += dc;
+
+        if( print )
+            El::Output("Cold start of problem ",k);
+        coldTimer.Start();
+        El::LP( problem, coldSolution, coldCtrl );
+        coldTimer.Stop();
+
+        if( print )
+            El::Output("Warm start of problem ",k);
+        warmTimer.Start();
+        El::LP( problem, warmSolution, scaling, warmCtrl );
+        warmTimer.Stop();
+
+        const Real coldObj = El::Dot( problem.c, coldSolution.x );
+        const Real warmObj = El::Dot( problem.c, warmSolution.x );
+        El::Output
+        ("problem ",k,": cold objective=",coldObj,
+         ", warm objective=",warmObj);
+    }
+    El::Output("Cold starts took ",coldTimer.Total()," seconds");
+    El::Output("Warm starts took ",warmTimer.Total()," seconds");
+    El::Output("");
+}
+
+int main( int argc, char* argv[] )
+{
+    El::Environment env( argc, argv );
+
+    try
+    {
+        const El::Int m = El::Input("--m","height of A",100);
+        const El::Int n = El::Input("--n","width of A",200);
+        const El::Int numProblems =
+          El::Input("--numProblems","number of perturbed problems",10);
+        const double perturbation =
+          El::Input("--perturbation","radius of the perturbations",1e-3);
+        const bool print =
+          El::Input("--print","print the IPM progress (and its iterations)?",
+            false);
+        El::ProcessInput();
+
+        WarmStartLP<float>( m, n, numProblems, float(perturbation), print );
+        WarmStartLP<double>( m, n, numProblems, perturbation, print );
+#ifdef EL_HAVE_QD
+        WarmStartLP<El::DoubleDouble>
+        ( m, n, numProblems, El::DoubleDouble(perturbation), print );
+#endif
+    }
+    catch( std::exception& e ) { El::ReportException(e); }
+
+    return 0;
+}
@@ -12,22 +12,6 @@
 #include "El.hpp"
 using namespace El;
 
-// Initialize auxiliary communicators for depth dimension
-void InitDepthComms( int meshSize, mpi::Comm& depthComm, mpi::Comm& meshComm )
-{
-    const int rank = mpi::Rank( mpi::COMM_WORLD );
-
-    // Build this process's meshComm (2d grid)
-    const int depthRank = rank / meshSize;
-    const int depthColor = rank % meshSize;
-    mpi::Split( mpi::COMM_WORLD, depthColor, depthRank, depthComm );
-
-    // Build this process's depthComm (depth communicator)
-    const int meshRank = rank % meshSize;
-    const int meshColor = rank / meshSize;
-    mpi::Split( mpi::COMM_WORLD, meshColor, meshRank, meshComm );
-}
-
 // Have the top layer initialize the distributed matrix, A
 void InitA( DistMatrix<double>& A, bool print )
 {
@@ -368,10 +352,13 @@ int main( int argc, char* argv[] )
             }
         )
 
-        mpi::Comm depthComm, meshComm;
-        InitDepthComms( r*c, depthComm, meshComm );
-        const int depthRank = mpi::Rank( depthComm );
-        const Grid meshGrid( meshComm, r, c );
+        if( r*c*depth != mpi::Size(comm) )
+            LogicError("The grid dimensions and depth must multiply to p");
+        const Grid grid( comm );
+        const Grid3D grid3D( grid, depth );
+        mpi::Comm depthComm = grid3D.DepthComm();
+        const int depthRank = grid3D.Layer();
+        const Grid meshGrid( grid3D.MyLayerGrid().OwningComm(), r );
 
         DistMatrix<double> A( m, k, meshGrid ),
                            B( k, n, meshGrid ),
@@ -96,6 +96,23 @@ EL_EXPORT ElError ElAxpyDistMultiVec_c
 EL_EXPORT ElError ElAxpyDistMultiVec_z
 ( complex_double alpha, ElConstDistMultiVec_z X, ElDistMultiVec_z Y );
 
+/* Y[k] := alpha X[k] + Y[k] for 0 <= k < batchSize within a single call */
+EL_EXPORT ElError ElAxpyBatched_i
+( ElInt alpha, const ElConstMatrix_i* X, const ElMatrix_i* Y,
+  ElInt batchSize );
+EL_EXPORT ElError ElAxpyBatched_s
+( float alpha, const ElConstMatrix_s* X, const ElMatrix_s* Y,
+  ElInt batchSize );
+EL_EXPORT ElError ElAxpyBatched_d
+( double alpha, const ElConstMatrix_d* X, const ElMatrix_d* Y,
+  ElInt batchSize );
+EL_EXPORT ElError ElAxpyBatched_c
+( complex_float alpha, const ElConstMatrix_c* X, const ElMatrix_c* Y,
+  ElInt batchSize );
+EL_EXPORT ElError ElAxpyBatched_z
+( complex_double alpha, const ElConstMatrix_z* X, const ElMatrix_z* Y,
+  ElInt batchSize );
+
 /* Trapezoidal Axpy
    ================ */
 /* tri(Y) := tri(alpha A X + Y) */
@@ -698,6 +715,23 @@ EL_EXPORT ElError ElDotDistMultiVec_c
 EL_EXPORT ElError ElDotDistMultiVec_z
 ( ElConstDistMultiVec_z A, ElConstDistMultiVec_z B, complex_double* prod );
 
+/* prods[k] := <A[k],B[k]> for 0 <= k < batchSize within a single call */
+EL_EXPORT ElError ElDotBatched_i
+( const ElConstMatrix_i* A, const ElConstMatrix_i* B, ElInt* prods,
+  ElInt batchSize );
+EL_EXPORT ElError ElDotBatched_s
+( const ElConstMatrix_s* A, const ElConstMatrix_s* B, float* prods,
+  ElInt batchSize );
+EL_EXPORT ElError ElDotBatched_d
+( const ElConstMatrix_d* A, const ElConstMatrix_d* B, double* prods,
+  ElInt batchSize );
+EL_EXPORT ElError ElDotBatched_c
+( const ElConstMatrix_c* A, const ElConstMatrix_c* B, complex_float* prods,
+  ElInt batchSize );
+EL_EXPORT ElError ElDotBatched_z
+( const ElConstMatrix_z* A, const ElConstMatrix_z* B, complex_double* prods,
+  ElInt batchSize );
+
 /* Dotu
    ==== */
 EL_EXPORT ElError ElDotu_c
@@ -39,7 +39,7 @@ void Axpy( S alphaS, const Matrix<T>& X, Matrix<T>& Y )
           if( XLength != YLength )
               LogicError("Nonconformal Axpy");
         )
-        EL_PARALLEL_FOR
+        EL_PARALLEL_FOR_IF(ParallelizeLoop(XLength))
         for( Int i=0; i<XLength; ++i )
             YBuf[i*YStride] += alpha*XBuf[i*XStride];
     }
@@ -49,13 +49,13 @@ void Axpy( S alphaS, const Matrix<T>& X, Matrix<T>& Y )
         // memory. Otherwise iterate over double loop.
         if( ldX == mX && ldY == mX )
         {
-            EL_PARALLEL_FOR
+            EL_PARALLEL_FOR_IF(ParallelizeLoop(mX*nX))
             for( Int i=0; i<mX*nX; ++i )
                 YBuf[i] += alpha*XBuf[i];
         }
         else
         {
-            EL_PARALLEL_FOR
+            EL_PARALLEL_FOR_IF(ParallelizeLoop(mX*nX))
             for( Int j=0; j<nX; ++j )
             {
                 EL_SIMD
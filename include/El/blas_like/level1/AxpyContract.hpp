@@ -185,7 +185,9 @@ void ColScatter
           buffer.data(),    recvSize );
 
         // Communicate
-        mpi::ReduceScatter( buffer.data(), recvSize, B.ColComm() );
+        copy::util::ReduceScatter
+        ( buffer.data(), buffer.data(), recvSize,
+          B.Grid(), B.ColDist(), B.ColComm() );
 
         // Update with our received data
         axpy::util::InterleaveMatrixUpdate
@@ -218,7 +220,9 @@ void ColScatter
           secondBuf,        recvSize_RS );
 
         // Reduce-scatter over each col
-        mpi::ReduceScatter( secondBuf, firstBuf, recvSize_RS, B.ColComm() );
+        copy::util::ReduceScatter
+        ( secondBuf, firstBuf, recvSize_RS,
+          B.Grid(), B.ColDist(), B.ColComm() );
 
         // Trade reduced data with the appropriate col
         const Int sendCol = Mod( B.RowRank()+rowDiff, B.RowStride() );
@@ -294,7 +298,9 @@ void RowScatter
               buffer.data(), portionSize );
 
             // Communicate
-            mpi::ReduceScatter( buffer.data(), portionSize, B.RowComm() );
+            copy::util::ReduceScatter
+            ( buffer.data(), buffer.data(), portionSize,
+              B.Grid(), B.RowDist(), B.RowComm() );
 
             // Update with our received data
             axpy::util::InterleaveMatrixUpdate
@@ -366,7 +372,9 @@ void RowScatter
               secondBuf,        recvSize_RS );
 
             // Reduce-scatter over each process row
-            mpi::ReduceScatter( secondBuf, firstBuf, recvSize_RS, B.RowComm() );
+            copy::util::ReduceScatter
+            ( secondBuf, firstBuf, recvSize_RS,
+              B.Grid(), B.RowDist(), B.RowComm() );
 
             // Trade reduced data with the appropriate process row
             mpi::SendRecv
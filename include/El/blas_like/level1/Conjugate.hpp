@@ -19,6 +19,24 @@ template<typename Real>
 void Conjugate( Matrix<Complex<Real>>& A )
 {
     EL_DEBUG_CSE
+    if( IsBlasScalar<Real>::value )
+    {
+        // std::complex guarantees the interleaved (real,imag) layout, so
+        // conjugation only negates every other entry of each column
+        Real* ABuf = reinterpret_cast<Real*>(A.Buffer());
+        const Int height = A.Height();
+        const Int width = A.Width();
+        const Int ALDim = A.LDim();
+        EL_PARALLEL_FOR_IF(ParallelizeLoop(height*width))
+        for( Int j=0; j<width; ++j )
+        {
+            Real* aCol = &ABuf[2*j*ALDim];
+            EL_SIMD
+            for( Int i=0; i<height; ++i )
+                aCol[2*i+1] = -aCol[2*i+1];
+        }
+        return;
+    }
     auto conj = [](const Complex<Real> &alpha) { return Conj(alpha); };
     EntrywiseMap( A, MakeFunction(conj) );
 }
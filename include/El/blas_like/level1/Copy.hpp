@@ -10,6 +10,7 @@
 #define EL_BLAS_COPY_HPP
 
 #include <El/blas_like/level1/Copy/internal_decl.hpp>
+#include <El/blas_like/level1/Copy/Plan.hpp>
 #include <El/blas_like/level1/Copy/GeneralPurpose.hpp>
 #include <El/blas_like/level1/Copy/util.hpp>
 
@@ -255,6 +256,21 @@ void CopyFromNonRoot
     B.MakeSizeConsistent( includingViewers );
 }
 
+template<typename T>
+void Regrid( DistMatrix<T>& A, const Grid& grid )
+{
+    EL_DEBUG_CSE
+    if( A.Grid() == grid )
+        return;
+    if( A.Viewing() )
+        LogicError("Cannot regrid a view");
+    // The translation exchanges a single message between each pair of
+    // processes, after which the new local matrix is swapped into A
+    DistMatrix<T> B( grid );
+    B = A;
+    A = std::move(B);
+}
+
 template<typename T>
 void Copy( const SparseMatrix<T>& A, SparseMatrix<T>& B )
 {
@@ -291,6 +307,85 @@ void Copy( const SparseMatrix<S>& A, Matrix<T>& B )
         BBuf[ARowBuf[e]+AColBuf[e]*BLDim] = Caster<S,T>::Cast(AValBuf[e]);
 }
 
+template<typename T>
+void Copy( const SparseMatrix<T>& A, BlockSparseMatrix<T>& B, Int blockSize )
+{
+    EL_DEBUG_CSE
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int* rowOffsets = A.LockedOffsetBuffer();
+    const Int* colInds = A.LockedTargetBuffer();
+    const T* values = A.LockedValueBuffer();
+    B.Resize( m, n, blockSize );
+    const Int numBlockRows = B.NumBlockRows();
+
+    // Form the sorted block columns of each block row
+    vector<Int> blockCols, rowBlockCols;
+    Int* blockRowOffsets = B.OffsetBuffer();
+    for( Int I=0; I<numBlockRows; ++I )
+    {
+        rowBlockCols.resize( 0 );
+        const Int iEnd = Min( (I+1)*blockSize, m );
+        for( Int e=rowOffsets[I*blockSize]; e<rowOffsets[iEnd]; ++e )
+            rowBlockCols.push_back( colInds[e]/blockSize );
+        std::sort( rowBlockCols.begin(), rowBlockCols.end() );
+        const auto uniqueEnd =
+          std::unique( rowBlockCols.begin(), rowBlockCols.end() );
+        blockCols.insert( blockCols.end(), rowBlockCols.begin(), uniqueEnd );
+        blockRowOffsets[I+1] = blockCols.size();
+    }
+    const Int numBlocks = blockCols.size();
+    B.ForceNumBlocks( numBlocks );
+    std::copy( blockCols.begin(), blockCols.end(), B.TargetBuffer() );
+
+    // Fill the (zero-padded) blocks
+    const Int blockArea = blockSize*blockSize;
+    T* BVals = B.ValueBuffer();
+    std::fill( BVals, BVals+numBlocks*blockArea, T(0) );
+    for( Int i=0; i<m; ++i )
+    {
+        const Int I = i / blockSize;
+        for( Int e=rowOffsets[i]; e<rowOffsets[i+1]; ++e )
+        {
+            const Int j = colInds[e];
+            const Int index = B.BlockOffset( I, j/blockSize );
+            BVals[index*blockArea+(i%blockSize)+(j%blockSize)*blockSize] =
+              values[e];
+        }
+    }
+}
+
+template<typename T>
+void Copy( const BlockSparseMatrix<T>& A, SparseMatrix<T>& B )
+{
+    EL_DEBUG_CSE
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int blockSize = A.BlockSize();
+    const Int numBlockRows = A.NumBlockRows();
+    B.Resize( m, n );
+    Zero( B );
+    B.Reserve( A.NumBlocks()*blockSize*blockSize );
+    for( Int I=0; I<numBlockRows; ++I )
+    {
+        for( Int index=A.BlockRowOffset(I); index<A.BlockRowOffset(I+1);
+             ++index )
+        {
+            const Int J = A.BlockCol( index );
+            const T* block = A.LockedBlock( index );
+            const Int height = Min( blockSize, m-I*blockSize );
+            const Int width = Min( blockSize, n-J*blockSize );
+            // The explicit zeros within the blocks are dropped
+            for( Int c=0; c<width; ++c )
+                for( Int r=0; r<height; ++r )
+                    if( block[r+c*blockSize] != T(0) )
+                        B.QueueUpdate
+                        ( I*blockSize+r, J*blockSize+c, block[r+c*blockSize] );
+        }
+    }
+    B.ProcessQueues();
+}
+
 template<typename T>
 void Copy( const DistSparseMatrix<T>& A, DistSparseMatrix<T>& B )
 {
@@ -400,10 +495,28 @@ void Copy( const DistMultiVec<S>& A, DistMultiVec<T>& B )
     EntrywiseMap( A, B, MakeFunction(Caster<S,T>::Cast) );
 }
 
+// When the rows of B are distributed like those of a DistMultiVec, the local
+// data is copied directly. Otherwise, over a column-major grid, A is viewed
+// as a [VC,STAR,BLOCK] matrix so that the general-purpose redistribution
+// (and its cached plans) can be used instead of queueing each entry.
 template<typename T>
 void Copy( const DistMultiVec<T>& A, AbstractDistMatrix<T>& B )
 {
     EL_DEBUG_CSE
+    B.Resize( A.Height(), A.Width() );
+    if( B.Grid() == A.Grid() && SharesDistMultiVecRows( B ) )
+    {
+        Copy( A.LockedMatrix(), B.Matrix() );
+        return;
+    }
+    if( A.Grid().Order() == COLUMN_MAJOR )
+    {
+        DistMatrix<T,VC,STAR,BLOCK> AView( A.Grid() );
+        LockedView( AView, A );
+        Copy( AView, B );
+        return;
+    }
+
     const Int m = A.Height();
     const Int n = A.Width();
     const Int mLoc = A.LocalHeight();
@@ -430,6 +543,19 @@ void Copy( const AbstractDistMatrix<T>& A, DistMultiVec<T>& B )
     const Int nLoc = A.LocalWidth();
     B.SetGrid( A.Grid() );
     B.Resize( m, n );
+    if( SharesDistMultiVecRows( A ) )
+    {
+        Copy( A.LockedMatrix(), B.Matrix() );
+        return;
+    }
+    if( A.Grid().Order() == COLUMN_MAJOR )
+    {
+        DistMatrix<T,VC,STAR,BLOCK> BView( B.Grid() );
+        View( BView, B );
+        copy::GeneralPurpose( A, BView );
+        return;
+    }
+
     Zero( B );
     B.Reserve( mLoc*nLoc );
     auto& ALoc = A.LockedMatrix();
@@ -456,7 +582,6 @@ void CopyFromRoot( const DistMultiVec<T>& XDist, Matrix<T>& X )
         return;
 
     const Grid& grid = XDist.Grid();
-    Output("grid.Size()=",grid.Size());
     const int commSize = grid.Size();
     const int commRank = grid.Rank();
 
@@ -559,9 +684,15 @@ void CopyFromNonRoot( const DistMultiVec<T>& XDist, int root )
     bool includingViewers ); \
   EL_EXTERN template void CopyFromNonRoot \
   ( DistMatrix<T,CIRC,CIRC,BLOCK>& B, bool includingViewers ); \
+  EL_EXTERN template void Regrid \
+  ( DistMatrix<T>& A, const Grid& grid ); \
   EL_EXTERN template void Copy \
   ( const SparseMatrix<T>& A, SparseMatrix<T>& B ); \
   EL_EXTERN template void Copy \
+  ( const SparseMatrix<T>& A, BlockSparseMatrix<T>& B, Int blockSize ); \
+  EL_EXTERN template void Copy \
+  ( const BlockSparseMatrix<T>& A, SparseMatrix<T>& B ); \
+  EL_EXTERN template void Copy \
   ( const DistSparseMatrix<T>& A, DistSparseMatrix<T>& B ); \
   EL_EXTERN template void CopyFromRoot \
   ( const DistSparseMatrix<T>& ADist, SparseMatrix<T>& A ); \
@@ -51,8 +51,8 @@ void AllGather
               sendBuf,          1, A.LocalHeight() );
 
             // Communicate
-            mpi::AllGather
-            ( sendBuf, portionSize, recvBuf, portionSize, A.DistComm() );
+            mpi::SelectedAllGather
+            ( sendBuf, recvBuf, portionSize, A.DistComm() );
 
             // Unpack
             util::StridedUnpack
@@ -17,6 +17,7 @@ template<typename T>
 void ColAllGather( const ElementalMatrix<T>& A, ElementalMatrix<T>& B )
 {
     EL_DEBUG_CSE
+    EL_PROFILE_REGION("copy::ColAllGather");
     EL_DEBUG_ONLY(
       if( B.ColDist() != Collect(A.ColDist()) ||
           B.RowDist() != A.RowDist() )
@@ -57,10 +58,9 @@ void ColAllGather( const ElementalMatrix<T>& A, ElementalMatrix<T>& B )
                 const Int localWidth = A.LocalWidth();
                 const Int portionSize = mpi::Pad( maxLocalHeight*localWidth );
 
-                vector<T> buffer;
-                FastResize( buffer, (colStride+1)*portionSize );
-                T* sendBuf = &buffer[0];
-                T* recvBuf = &buffer[portionSize];
+                Memory<T> buffer( (colStride+1)*portionSize );
+                T* sendBuf = buffer.Buffer();
+                T* recvBuf = buffer.Buffer()+portionSize;
 
                 // Pack
                 util::InterleaveMatrix
@@ -69,8 +69,9 @@ void ColAllGather( const ElementalMatrix<T>& A, ElementalMatrix<T>& B )
                   sendBuf,          1, A.LocalHeight() );
 
                 // Communicate
-                mpi::AllGather
-                ( sendBuf, portionSize, recvBuf, portionSize, A.ColComm() );
+                util::AllGather
+                ( sendBuf, recvBuf, portionSize,
+                  A.Grid(), A.ColDist(), A.ColComm() );
 
                 // Unpack
                 util::ColStridedUnpack
@@ -91,15 +92,15 @@ void ColAllGather( const ElementalMatrix<T>& A, ElementalMatrix<T>& B )
             if( height == 1 )
             {
                 const Int localWidthB = B.LocalWidth();
-                vector<T> buffer;
+                Memory<T> buffer;
                 T* bcastBuf;
 
                 if( A.ColRank() == A.ColAlign() )
                 {
                     const Int localWidth = A.LocalWidth();
-                    FastResize( buffer, localWidth+localWidthB );
-                    T* sendBuf = &buffer[0];
-                    bcastBuf   = &buffer[localWidth];
+                    buffer.Require( localWidth+localWidthB );
+                    T* sendBuf = buffer.Buffer();
+                    bcastBuf   = buffer.Buffer()+localWidth;
 
                     // Pack
                     StridedMemCopy
@@ -112,8 +113,8 @@ void ColAllGather( const ElementalMatrix<T>& A, ElementalMatrix<T>& B )
                 }
                 else
                 {
-                    FastResize( buffer, localWidthB );
-                    bcastBuf = buffer.data();
+                    buffer.Require( localWidthB );
+                    bcastBuf = buffer.Buffer();
                 }
 
                 // Communicate
@@ -132,10 +133,9 @@ void ColAllGather( const ElementalMatrix<T>& A, ElementalMatrix<T>& B )
                 const Int portionSize =
                     mpi::Pad( maxLocalHeight*maxLocalWidth );
 
-                vector<T> buffer;
-                FastResize( buffer, (colStride+1)*portionSize );
-                T* firstBuf  = &buffer[0];
-                T* secondBuf = &buffer[portionSize];
+                Memory<T> buffer( (colStride+1)*portionSize );
+                T* firstBuf  = buffer.Buffer();
+                T* secondBuf = buffer.Buffer()+portionSize;
 
                 // Pack
                 util::InterleaveMatrix
@@ -149,9 +149,9 @@ void ColAllGather( const ElementalMatrix<T>& A, ElementalMatrix<T>& B )
                   firstBuf,  portionSize, recvRowRank, A.RowComm() );
 
                 // AllGather the aligned data
-                mpi::AllGather
-                ( firstBuf,  portionSize,
-                  secondBuf, portionSize, A.ColComm() );
+                util::AllGather
+                ( firstBuf, secondBuf, portionSize,
+                  A.Grid(), A.ColDist(), A.ColComm() );
 
                 // Unpack the contents of each member of the column team
                 util::ColStridedUnpack
@@ -173,6 +173,7 @@ void ColAllGather
 ( const BlockMatrix<T>& A, BlockMatrix<T>& B )
 {
     EL_DEBUG_CSE
+    EL_PROFILE_REGION("copy::ColAllGather");
     AssertSameGrids( A, B );
 
     EL_DEBUG_ONLY(
@@ -225,10 +226,9 @@ void ColAllGather
                   MaxBlockedLength(height,blockHeight,colCut,colStride);
 
                 const Int portionSize = mpi::Pad( localWidth*maxLocalHeight );
-                vector<T> buffer;
-                FastResize( buffer, (colStride+1)*portionSize );
-                T* sendBuf = &buffer[0];
-                T* recvBuf = &buffer[portionSize];
+                Memory<T> buffer( (colStride+1)*portionSize );
+                T* sendBuf = buffer.Buffer();
+                T* recvBuf = buffer.Buffer()+portionSize;
 
                 // Pack
                 util::InterleaveMatrix
@@ -237,8 +237,9 @@ void ColAllGather
                   sendBuf,          1, A.LocalHeight() );
 
                 // Communicate
-                mpi::AllGather
-                ( sendBuf, portionSize, recvBuf, portionSize, A.ColComm() );
+                util::AllGather
+                ( sendBuf, recvBuf, portionSize,
+                  A.Grid(), A.ColDist(), A.ColComm() );
 
                 // Unpack
                 util::BlockedColStridedUnpack
@@ -277,10 +278,9 @@ void ColAllGather
                   MaxBlockedLength(height,blockHeight,colCut,colStride);
 
                 const Int portionSize = mpi::Pad(maxLocalHeight*maxLocalWidth);
-                vector<T> buffer;
-                FastResize( buffer, (colStride+1)*portionSize );
-                T* firstBuf = &buffer[0];
-                T* secondBuf = &buffer[portionSize];
+                Memory<T> buffer( (colStride+1)*portionSize );
+                T* firstBuf = buffer.Buffer();
+                T* secondBuf = buffer.Buffer()+portionSize;
 
                 // Pack
                 util::InterleaveMatrix
@@ -294,9 +294,9 @@ void ColAllGather
                   firstBuf,  portionSize, recvRowRank, A.RowComm() );
 
                 // Perform the column AllGather
-                mpi::AllGather
-                ( firstBuf,  portionSize,
-                  secondBuf, portionSize, A.ColComm() );
+                util::AllGather
+                ( firstBuf, secondBuf, portionSize,
+                  A.Grid(), A.ColDist(), A.ColComm() );
 
                 // Unpack
                 util::BlockedColStridedUnpack
@@ -51,10 +51,9 @@ void ColAllToAllDemote
         }
         else
         {
-            vector<T> buffer;
-            FastResize( buffer, 2*colStrideUnion*portionSize );
-            T* firstBuf  = &buffer[0];
-            T* secondBuf = &buffer[colStrideUnion*portionSize];
+            Memory<T> buffer( 2*colStrideUnion*portionSize );
+            T* firstBuf  = buffer.Buffer();
+            T* secondBuf = buffer.Buffer()+colStrideUnion*portionSize;
 
             // Pack
             util::PartialColStridedPack
@@ -66,9 +65,8 @@ void ColAllToAllDemote
               firstBuf,         portionSize );
 
             // Simultaneously Scatter in columns and Gather in rows
-            mpi::AllToAll
-            ( firstBuf,  portionSize,
-              secondBuf, portionSize, B.PartialUnionColComm() );
+            util::AllToAll
+            ( firstBuf, secondBuf, portionSize, B.PartialUnionColComm() );
 
             // Unpack
             util::RowStridedUnpack
@@ -87,10 +85,9 @@ void ColAllToAllDemote
         const Int sendColRankPart = Mod( colRankPart+colDiff, colStridePart );
         const Int recvColRankPart = Mod( colRankPart-colDiff, colStridePart );
 
-        vector<T> buffer;
-        FastResize( buffer, 2*colStrideUnion*portionSize );
-        T* firstBuf  = &buffer[0];
-        T* secondBuf = &buffer[colStrideUnion*portionSize];
+        Memory<T> buffer( 2*colStrideUnion*portionSize );
+        T* firstBuf  = buffer.Buffer();
+        T* secondBuf = buffer.Buffer()+colStrideUnion*portionSize;
 
         // Pack
         util::PartialColStridedPack
@@ -102,9 +99,8 @@ void ColAllToAllDemote
           secondBuf,        portionSize );
 
         // Simultaneously Scatter in columns and Gather in rows
-        mpi::AllToAll
-        ( secondBuf, portionSize,
-          firstBuf,  portionSize, B.PartialUnionColComm() );
+        util::AllToAll
+        ( secondBuf, firstBuf, portionSize, B.PartialUnionColComm() );
 
         // Realign the result
         mpi::SendRecv
@@ -45,10 +45,9 @@ void ColAllToAllPromote
         }
         else
         {
-            vector<T> buffer;
-            FastResize( buffer, 2*colStrideUnion*portionSize );
-            T* firstBuf  = &buffer[0];
-            T* secondBuf = &buffer[colStrideUnion*portionSize];
+            Memory<T> buffer( 2*colStrideUnion*portionSize );
+            T* firstBuf  = buffer.Buffer();
+            T* secondBuf = buffer.Buffer()+colStrideUnion*portionSize;
 
             // Pack
             util::RowStridedPack
@@ -58,9 +57,8 @@ void ColAllToAllPromote
               firstBuf,         portionSize );
 
             // Simultaneously Gather in columns and Scatter in rows
-            mpi::AllToAll
-            ( firstBuf,  portionSize,
-              secondBuf, portionSize, A.PartialUnionColComm() );
+            util::AllToAll
+            ( firstBuf, secondBuf, portionSize, A.PartialUnionColComm() );
 
             // Unpack
             util::PartialColStridedUnpack
@@ -81,10 +79,9 @@ void ColAllToAllPromote
         const Int sendColRankPart = Mod( colRankPart+colDiff, colStridePart );
         const Int recvColRankPart = Mod( colRankPart-colDiff, colStridePart );
 
-        vector<T> buffer;
-        FastResize( buffer, 2*colStrideUnion*portionSize );
-        T* firstBuf  = &buffer[0];
-        T* secondBuf = &buffer[colStrideUnion*portionSize];
+        Memory<T> buffer( 2*colStrideUnion*portionSize );
+        T* firstBuf  = buffer.Buffer();
+        T* secondBuf = buffer.Buffer()+colStrideUnion*portionSize;
 
         // Pack
         util::RowStridedPack
@@ -100,9 +97,8 @@ void ColAllToAllPromote
           A.PartialColComm() );
 
         // Simultaneously Scatter in columns and Gather in rows
-        mpi::AllToAll
-        ( firstBuf,  portionSize,
-          secondBuf, portionSize, A.PartialUnionColComm() );
+        util::AllToAll
+        ( firstBuf, secondBuf, portionSize, A.PartialUnionColComm() );
 
         // Unpack
         util::PartialColStridedUnpack
@@ -55,10 +55,9 @@ void ColFilter( const ElementalMatrix<T>& A, ElementalMatrix<T>& B )
         const Int localWidthA = A.LocalWidth();
         const Int sendSize = localHeight*localWidthA;
         const Int recvSize = localHeight*localWidth;
-        vector<T> buffer;
-        FastResize( buffer, sendSize+recvSize );
-        T* sendBuf = &buffer[0];
-        T* recvBuf = &buffer[sendSize];
+        Memory<T> buffer( sendSize+recvSize );
+        T* sendBuf = buffer.Buffer();
+        T* recvBuf = buffer.Buffer()+sendSize;
 
         // Pack
         util::InterleaveMatrix
@@ -139,10 +138,9 @@ void ColFilter
         const Int localWidthA = A.LocalWidth();
         const Int sendSize = localHeight*localWidthA;
         const Int recvSize = localHeight*localWidth;
-        vector<T> buffer;
-        FastResize( buffer, sendSize+recvSize );
-        T* sendBuf = &buffer[0];
-        T* recvBuf = &buffer[sendSize];
+        Memory<T> buffer( sendSize+recvSize );
+        T* sendBuf = buffer.Buffer();
+        T* recvBuf = buffer.Buffer()+sendSize;
 
         // Pack
         util::BlockedColFilter
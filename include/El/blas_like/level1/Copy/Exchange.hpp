@@ -34,75 +34,12 @@ void Exchange
         return;
     }
 
-    const Int localHeightA = A.LocalHeight();
-    const Int localHeightB = B.LocalHeight();
-    const Int localWidthA = A.LocalWidth();
-    const Int localWidthB = B.LocalWidth();
-    const Int sendSize = localHeightA*localWidthA;
-    const Int recvSize = localHeightB*localWidthB;
-
-    const bool contigA = ( A.LocalHeight() == A.LDim() );
-    const bool contigB = ( B.LocalHeight() == B.LDim() );
-
-    if( contigA && contigB )
-    {
-        mpi::SendRecv
-        ( A.LockedBuffer(), sendSize, sendRank,
-          B.Buffer(),       recvSize, recvRank, comm );
-    }
-    else if( contigB )
-    {
-        // Pack A's data
-        vector<T> buf;
-        FastResize( buf, sendSize );
-        copy::util::InterleaveMatrix
-        ( localHeightA, localWidthA,
-          A.LockedBuffer(), 1, A.LDim(),
-          buf.data(),       1, localHeightA );
-
-        // Exchange with the partner
-        mpi::SendRecv
-        ( buf.data(), sendSize, sendRank,
-          B.Buffer(), recvSize, recvRank, comm );
-    }
-    else if( contigA )
-    {
-        // Exchange with the partner
-        vector<T> buf;
-        FastResize( buf, recvSize );
-        mpi::SendRecv
-        ( A.LockedBuffer(), sendSize, sendRank,
-          buf.data(),       recvSize, recvRank, comm );
-
-        // Unpack
-        copy::util::InterleaveMatrix
-        ( localHeightB, localWidthB,
-          buf.data(), 1, localHeightB,
-          B.Buffer(), 1, B.LDim() );
-    }
-    else
-    {
-        // Pack A's data
-        vector<T> sendBuf;
-        FastResize( sendBuf, sendSize );
-        copy::util::InterleaveMatrix
-        ( localHeightA, localWidthA,
-          A.LockedBuffer(), 1, A.LDim(),
-          sendBuf.data(),   1, localHeightA );
-
-        // Exchange with the partner
-        vector<T> recvBuf;
-        FastResize( recvBuf, recvSize );
-        mpi::SendRecv
-        ( sendBuf.data(), sendSize, sendRank,
-          recvBuf.data(), recvSize, recvRank, comm );
-
-        // Unpack
-        copy::util::InterleaveMatrix
-        ( localHeightB, localWidthB,
-          recvBuf.data(), 1, localHeightB,
-          B.Buffer(),     1, B.LDim() );
-    }
+    // Non-contiguous local matrices are either packed or described with
+    // (cached) MPI vector datatypes, depending upon mpi::GetStridedPolicy()
+    mpi::StridedSendRecv
+    ( A.LockedBuffer(), A.LocalHeight(), A.LocalWidth(), A.LDim(), sendRank,
+      B.Buffer(),       B.LocalHeight(), B.LocalWidth(), B.LDim(), recvRank,
+      comm, "copy::Exchange" );
 }
 
 template<typename T,Dist U,Dist V>
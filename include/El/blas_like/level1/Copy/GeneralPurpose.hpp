@@ -170,12 +170,29 @@ void Helper
     }
 }
 
+template<typename S,typename T>
+void PlannedHelper
+( const AbstractDistMatrix<S>& A,
+        AbstractDistMatrix<T>& B )
+{
+    EL_DEBUG_CSE
+    B.Resize( A.Height(), A.Width() );
+    auto matches =
+      [&]( const RedistPlan& plan ) { return plan.Matches( A, B ); };
+    RedistPlan* plan =
+      FindRedistPlan( A.Grid().Id(), B.Grid().Id(), matches );
+    if( plan == nullptr )
+        plan = &AddRedistPlan( RedistPlan( A, B ) );
+    plan->Execute( A, B );
+}
+
 template<typename S,typename T,typename>
 void GeneralPurpose
 ( const AbstractDistMatrix<S>& A,
         AbstractDistMatrix<T>& B )
 {
     EL_DEBUG_CSE
+    EL_PROFILE_REGION("copy::GeneralPurpose");
 
     if( A.Grid().Size() == 1 && B.Grid().Size() == 1 )
     {
@@ -184,7 +201,10 @@ void GeneralPurpose
         return;
     }
 
-    Helper( A, B );
+    if( RedistPlanCacheSize() > 0 )
+        PlannedHelper( A, B );
+    else
+        Helper( A, B );
 }
 
 template<typename T,typename>
@@ -232,7 +252,10 @@ void GeneralPurpose
     }
 #endif
 
-    Helper( A, B );
+    if( RedistPlanCacheSize() > 0 )
+        PlannedHelper( A, B );
+    else
+        Helper( A, B );
 }
 
 } // namespace copy
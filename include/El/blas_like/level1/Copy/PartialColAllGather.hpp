@@ -65,10 +65,9 @@ void PartialColAllGather
         }
         else
         {
-            vector<T> buffer;
-            FastResize( buffer, (colStrideUnion+1)*portionSize );
-            T* firstBuf = &buffer[0];
-            T* secondBuf = &buffer[portionSize];
+            Memory<T> buffer( (colStrideUnion+1)*portionSize );
+            T* firstBuf = buffer.Buffer();
+            T* secondBuf = buffer.Buffer()+portionSize;
 
             // Pack
             util::InterleaveMatrix
@@ -77,9 +76,8 @@ void PartialColAllGather
               firstBuf,         1, A.LocalHeight() );
 
             // Communicate
-            mpi::AllGather
-            ( firstBuf, portionSize, secondBuf, portionSize,
-              A.PartialUnionColComm() );
+            mpi::SelectedAllGather
+            ( firstBuf, secondBuf, portionSize, A.PartialUnionColComm() );
 
             // Unpack
             util::PartialColStridedUnpack
@@ -97,10 +95,9 @@ void PartialColAllGather
         if( A.Grid().Rank() == 0 )
             cerr << "Unaligned PartialColAllGather" << endl;
 #endif
-        vector<T> buffer;
-        FastResize( buffer, (colStrideUnion+1)*portionSize );
-        T* firstBuf = &buffer[0];
-        T* secondBuf = &buffer[portionSize];
+        Memory<T> buffer( (colStrideUnion+1)*portionSize );
+        T* firstBuf = buffer.Buffer();
+        T* secondBuf = buffer.Buffer()+portionSize;
 
         // Perform a SendRecv to match the row alignments
         util::InterleaveMatrix
@@ -114,9 +111,8 @@ void PartialColAllGather
           firstBuf,  portionSize, recvColRank, A.ColComm() );
 
         // Use the SendRecv as an input to the partial union AllGather
-        mpi::AllGather
-        ( firstBuf,  portionSize,
-          secondBuf, portionSize, A.PartialUnionColComm() );
+        mpi::SelectedAllGather
+        ( firstBuf, secondBuf, portionSize, A.PartialUnionColComm() );
 
         // Unpack
         util::PartialColStridedUnpack
@@ -129,6 +125,71 @@ void PartialColAllGather
     }
 }
 
+// Only the aligned, element-wise redistribution is nonblocking; otherwise,
+// the redistribution is performed by Begin and Finish returns immediately
+template<typename T,Dist U,Dist V>
+void BeginPartialColAllGather
+( const DistMatrix<T,        U,   V>& A,
+        DistMatrix<T,Partial<U>(),V>& B,
+  AllGatherRequest<T>& request )
+{
+    EL_DEBUG_CSE
+    AssertSameGrids( A, B );
+    if( request.pending )
+        LogicError("The previous PartialColAllGather was not finished");
+
+    const Int height = A.Height();
+    const Int width = A.Width();
+    B.AlignColsAndResize
+    ( Mod(A.ColAlign(),B.ColStride()), height, width, false, false );
+    if( !A.Participating() )
+        return;
+
+    const Int colStrideUnion = A.PartialUnionColStride();
+    const Int colStridePart = A.PartialColStride();
+    const Int colDiff = B.ColAlign() - Mod(A.ColAlign(),colStridePart);
+    if( colDiff != 0 || colStrideUnion == 1 )
+    {
+        PartialColAllGather( A, B );
+        return;
+    }
+
+    const Int maxLocalHeight = MaxLength(height,A.ColStride());
+    request.portionSize = mpi::Pad( maxLocalHeight*width );
+    request.buffer.Require( (colStrideUnion+1)*request.portionSize );
+    T* firstBuf = request.buffer.Buffer();
+    T* secondBuf = request.buffer.Buffer()+request.portionSize;
+
+    util::InterleaveMatrix
+    ( A.LocalHeight(), width,
+      A.LockedBuffer(), 1, A.LDim(),
+      firstBuf,         1, A.LocalHeight() );
+    mpi::IAllGather
+    ( firstBuf, request.portionSize, secondBuf, request.portionSize,
+      A.PartialUnionColComm(), request.request );
+    request.pending = true;
+}
+
+template<typename T,Dist U,Dist V>
+void FinishPartialColAllGather
+( const DistMatrix<T,        U,   V>& A,
+        DistMatrix<T,Partial<U>(),V>& B,
+  AllGatherRequest<T>& request )
+{
+    EL_DEBUG_CSE
+    if( !request.pending )
+        return;
+    mpi::Wait( request.request );
+    util::PartialColStridedUnpack
+    ( A.Height(), A.Width(),
+      A.ColAlign(), A.ColStride(),
+      A.PartialUnionColStride(), A.PartialColStride(), A.PartialColRank(),
+      B.ColShift(),
+      request.buffer.Buffer()+request.portionSize, request.portionSize,
+      B.Buffer(), B.LDim() );
+    request.pending = false;
+}
+
 template<typename T,Dist U,Dist V>
 void PartialColAllGather
 ( const DistMatrix<T,        U,   V,BLOCK>& A,
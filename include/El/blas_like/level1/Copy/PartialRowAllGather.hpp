@@ -53,10 +53,9 @@ void PartialRowAllGather
         }
         else
         {
-            vector<T> buffer;
-            FastResize( buffer, (rowStrideUnion+1)*portionSize );
-            T* firstBuf = &buffer[0];
-            T* secondBuf = &buffer[portionSize];
+            Memory<T> buffer( (rowStrideUnion+1)*portionSize );
+            T* firstBuf = buffer.Buffer();
+            T* secondBuf = buffer.Buffer()+portionSize;
 
             // Pack
             util::InterleaveMatrix
@@ -65,9 +64,8 @@ void PartialRowAllGather
               firstBuf,         1, height );
 
             // Communicate
-            mpi::AllGather
-            ( firstBuf, portionSize, secondBuf, portionSize,
-              A.PartialUnionRowComm() );
+            mpi::SelectedAllGather
+            ( firstBuf, secondBuf, portionSize, A.PartialUnionRowComm() );
 
             // Unpack
             util::PartialRowStridedUnpack
@@ -85,10 +83,9 @@ void PartialRowAllGather
         if( A.Grid().Rank() == 0 )
             cerr << "Unaligned PartialRowAllGather" << endl;
 #endif
-        vector<T> buffer;
-        FastResize( buffer, (rowStrideUnion+1)*portionSize );
-        T* firstBuf = &buffer[0];
-        T* secondBuf = &buffer[portionSize];
+        Memory<T> buffer( (rowStrideUnion+1)*portionSize );
+        T* firstBuf = buffer.Buffer();
+        T* secondBuf = buffer.Buffer()+portionSize;
 
         // Perform a SendRecv to match the row alignments
         util::InterleaveMatrix
@@ -102,9 +99,8 @@ void PartialRowAllGather
           firstBuf,  portionSize, recvRowRank, A.RowComm() );
 
         // Use the SendRecv as an input to the partial union AllGather
-        mpi::AllGather
-        ( firstBuf,  portionSize,
-          secondBuf, portionSize, A.PartialUnionRowComm() );
+        mpi::SelectedAllGather
+        ( firstBuf, secondBuf, portionSize, A.PartialUnionRowComm() );
 
         // Unpack
         util::PartialRowStridedUnpack
@@ -117,6 +113,74 @@ void PartialRowAllGather
     }
 }
 
+// Only the aligned redistribution is nonblocking; otherwise, the
+// redistribution is performed by Begin and Finish returns immediately
+template<typename T>
+void BeginPartialRowAllGather
+( const ElementalMatrix<T>& A, ElementalMatrix<T>& B,
+  AllGatherRequest<T>& request )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( B.ColDist() != A.ColDist() ||
+          B.RowDist() != Partial(A.RowDist()) )
+          LogicError("Incompatible distributions");
+    )
+    AssertSameGrids( A, B );
+    if( request.pending )
+        LogicError("The previous PartialRowAllGather was not finished");
+
+    const Int height = A.Height();
+    const Int width = A.Width();
+    B.AlignRowsAndResize
+    ( Mod(A.RowAlign(),B.RowStride()), height, width, false, false );
+    if( !A.Participating() )
+        return;
+
+    const Int rowStrideUnion = A.PartialUnionRowStride();
+    const Int rowStridePart = A.PartialRowStride();
+    const Int rowDiff = B.RowAlign() - Mod(A.RowAlign(),rowStridePart);
+    if( rowDiff != 0 || rowStrideUnion == 1 )
+    {
+        PartialRowAllGather( A, B );
+        return;
+    }
+
+    const Int maxLocalWidth = MaxLength(width,A.RowStride());
+    request.portionSize = mpi::Pad( height*maxLocalWidth );
+    request.buffer.Require( (rowStrideUnion+1)*request.portionSize );
+    T* firstBuf = request.buffer.Buffer();
+    T* secondBuf = request.buffer.Buffer()+request.portionSize;
+
+    util::InterleaveMatrix
+    ( height, A.LocalWidth(),
+      A.LockedBuffer(), 1, A.LDim(),
+      firstBuf,         1, height );
+    mpi::IAllGather
+    ( firstBuf, request.portionSize, secondBuf, request.portionSize,
+      A.PartialUnionRowComm(), request.request );
+    request.pending = true;
+}
+
+template<typename T>
+void FinishPartialRowAllGather
+( const ElementalMatrix<T>& A, ElementalMatrix<T>& B,
+  AllGatherRequest<T>& request )
+{
+    EL_DEBUG_CSE
+    if( !request.pending )
+        return;
+    mpi::Wait( request.request );
+    util::PartialRowStridedUnpack
+    ( A.Height(), A.Width(),
+      A.RowAlign(), A.RowStride(),
+      A.PartialUnionRowStride(), A.PartialRowStride(), A.PartialRowRank(),
+      B.RowShift(),
+      request.buffer.Buffer()+request.portionSize, request.portionSize,
+      B.Buffer(), B.LDim() );
+    request.pending = false;
+}
+
 template<typename T>
 void PartialRowAllGather
 ( const BlockMatrix<T>& A,
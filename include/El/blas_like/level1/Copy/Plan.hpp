@@ -0,0 +1,345 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_BLAS_COPY_PLAN_HPP
+#define EL_BLAS_COPY_PLAN_HPP
+
+namespace El {
+namespace copy {
+
+// A RedistPlan precomputes the communication pattern of the general-purpose
+// redistribution between two fixed (grid,distribution,alignment,shape)
+// configurations so that each subsequent execution only packs, exchanges,
+// and unpacks the entries themselves. Unlike the unplanned redistribution,
+// the row and column indices are only transmitted when the plan is built.
+//
+// The construction is collective over the same communicator as the
+// redistribution itself.
+class RedistPlan
+{
+public:
+    RedistPlan() { }
+
+    template<typename S,typename T>
+    RedistPlan
+    ( const AbstractDistMatrix<S>& A, const AbstractDistMatrix<T>& B );
+
+    // Whether or not this plan can be used to redistribute from A into a
+    // matrix with the configuration of B
+    template<typename S,typename T>
+    bool Matches
+    ( const AbstractDistMatrix<S>& A,
+      const AbstractDistMatrix<T>& B ) const;
+
+    // B is resized to match A before the entries are redistributed
+    template<typename S,typename T>
+    void Execute
+    ( const AbstractDistMatrix<S>& A,
+            AbstractDistMatrix<T>& B ) const;
+
+    const Grid& GridA() const { return *distA_.grid; }
+    const Grid& GridB() const { return *distB_.grid; }
+    size_t GridIdA() const { return gridIdA_; }
+    size_t GridIdB() const { return gridIdB_; }
+
+private:
+    DistData distA_, distB_;
+    size_t gridIdA_, gridIdB_;
+    Int height_, width_;
+    bool includeViewers_;
+
+    // For each entry of A's local matrix (in column-major order), the
+    // nonnegative position within the send buffer or, if the entry is kept
+    // locally, the value -(k+1), where k indexes localRows_ and localCols_
+    vector<Int> packTargets_;
+    vector<Int> localRows_, localCols_;
+
+    vector<int> sendCounts_, sendOffs_, recvCounts_, recvOffs_;
+
+    // The local indices of B for each received entry
+    vector<Int> recvRows_, recvCols_;
+
+    // The exchange of entries whose type has a fixed-size MPI datatype is
+    // bound to persistent requests, which are rebuilt if the type changes
+    mutable std::shared_ptr<mpi::PersistentExchange> exchange_;
+
+    mpi::Comm Comm() const;
+};
+
+inline mpi::Comm RedistPlan::Comm() const
+{
+    const Grid& g = GridB();
+    return includeViewers_ ? g.ViewingComm() : g.VCComm();
+}
+
+template<typename S,typename T>
+RedistPlan::RedistPlan
+( const AbstractDistMatrix<S>& A, const AbstractDistMatrix<T>& B )
+: distA_(A), distB_(B),
+  gridIdA_(A.Grid().Id()), gridIdB_(B.Grid().Id()),
+  height_(A.Height()), width_(A.Width())
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( B.Height() != height_ || B.Width() != width_ )
+          LogicError("B should have been resized before planning");
+    )
+    const Grid& g = B.Grid();
+    const bool BPartic = B.Participating();
+    const int BRoot = B.Root();
+    includeViewers_ = (A.Grid() != B.Grid());
+    if( !includeViewers_ && !g.InGrid() )
+        return;
+    mpi::Comm comm = Comm();
+    const int commSize = mpi::Size( comm );
+
+    // We will first push to redundant rank 0 of B
+    const int redundantRootB = 0;
+
+    const int distBSize = mpi::Size( B.DistComm() );
+    vector<int> distBToComm(distBSize);
+    for( int distBRank=0; distBRank<distBSize; ++distBRank )
+    {
+        const int vcOwner =
+          g.CoordsToVC
+          (B.ColDist(),B.RowDist(),distBRank,BRoot,redundantRootB);
+        distBToComm[distBRank] =
+          ( includeViewers_ ? g.VCToViewing(vcOwner) : vcOwner );
+    }
+
+    // Determine the owner and local position of each of our entries
+    // =============================================================
+    const Int localHeight = A.LocalHeight();
+    const Int localWidth = A.LocalWidth();
+    vector<int> owners;
+    vector<Int> remoteRows, remoteCols;
+    sendCounts_.resize( commSize, 0 );
+    if( A.RedundantRank() == 0 )
+    {
+        const bool noRedundant = B.RedundantSize() == 1;
+        const int colStride = B.ColStride();
+        const int rowRank = B.RowRank();
+        const int colRank = B.ColRank();
+
+        vector<Int> localRowsB(localHeight);
+        vector<int> ownerRows(localHeight);
+        for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+        {
+            const Int i = A.GlobalRow(iLoc);
+            const int ownerRow = B.RowOwner(i);
+            ownerRows[iLoc] = ownerRow;
+            localRowsB[iLoc] = B.LocalRow(i,ownerRow);
+        }
+
+        packTargets_.resize( localHeight*localWidth );
+        Int k = 0;
+        for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+        {
+            const Int j = A.GlobalCol(jLoc);
+            const int ownerCol = B.ColOwner(j);
+            const Int localCol = B.LocalCol(j,ownerCol);
+            const bool isLocalCol = ( BPartic && ownerCol == rowRank );
+            for( Int iLoc=0; iLoc<localHeight; ++iLoc, ++k )
+            {
+                const int ownerRow = ownerRows[iLoc];
+                const Int localRow = localRowsB[iLoc];
+                const bool isLocalRow = ( BPartic && ownerRow == colRank );
+                if( noRedundant && isLocalRow && isLocalCol )
+                {
+                    packTargets_[k] = -Int(localRows_.size())-1;
+                    localRows_.push_back( localRow );
+                    localCols_.push_back( localCol );
+                }
+                else
+                {
+                    const int owner =
+                      distBToComm[ownerRow+colStride*ownerCol];
+                    // Temporarily store the owner in the pack target
+                    packTargets_[k] = owners.size();
+                    owners.push_back( owner );
+                    remoteRows.push_back( localRow );
+                    remoteCols.push_back( localCol );
+                    ++sendCounts_[owner];
+                }
+            }
+        }
+    }
+    const Int totalSend = owners.size();
+
+    // Convert the temporary pack targets into send-buffer positions
+    // =============================================================
+    Scan( sendCounts_, sendOffs_ );
+    vector<Int> sendIndices(2*totalSend);
+    {
+        vector<Int> positions(totalSend);
+        auto offs = sendOffs_;
+        for( Int s=0; s<totalSend; ++s )
+        {
+            const Int pos = offs[owners[s]]++;
+            positions[s] = pos;
+            sendIndices[2*pos  ] = remoteRows[s];
+            sendIndices[2*pos+1] = remoteCols[s];
+        }
+        for( auto& target : packTargets_ )
+            if( target >= 0 )
+                target = positions[target];
+    }
+    SwapClear( owners );
+    SwapClear( remoteRows );
+    SwapClear( remoteCols );
+
+    // Exchange the counts and the local indices (only once)
+    // =====================================================
+    recvCounts_.resize( commSize );
+    mpi::AllToAll( sendCounts_.data(), 1, recvCounts_.data(), 1, comm );
+    const Int totalRecv = Scan( recvCounts_, recvOffs_ );
+
+    vector<int> sendIndCounts(commSize), sendIndOffs(commSize),
+                recvIndCounts(commSize), recvIndOffs(commSize);
+    for( int q=0; q<commSize; ++q )
+    {
+        sendIndCounts[q] = 2*sendCounts_[q];
+        sendIndOffs[q] = 2*sendOffs_[q];
+        recvIndCounts[q] = 2*recvCounts_[q];
+        recvIndOffs[q] = 2*recvOffs_[q];
+    }
+    vector<Int> recvIndices;
+    FastResize( recvIndices, 2*totalRecv );
+    mpi::AllToAll
+    ( sendIndices.data(), sendIndCounts.data(), sendIndOffs.data(),
+      recvIndices.data(), recvIndCounts.data(), recvIndOffs.data(), comm );
+
+    if( BPartic && B.RedundantRank() == redundantRootB )
+    {
+        recvRows_.resize( totalRecv );
+        recvCols_.resize( totalRecv );
+        for( Int k=0; k<totalRecv; ++k )
+        {
+            recvRows_[k] = recvIndices[2*k];
+            recvCols_[k] = recvIndices[2*k+1];
+        }
+    }
+}
+
+template<typename S,typename T>
+bool RedistPlan::Matches
+( const AbstractDistMatrix<S>& A, const AbstractDistMatrix<T>& B ) const
+{
+    return A.Height() == height_ && A.Width() == width_ &&
+           A.Grid().Id() == gridIdA_ && B.Grid().Id() == gridIdB_ &&
+           DistData(A) == distA_ && DistData(B) == distB_;
+}
+
+template<typename S,typename T>
+void RedistPlan::Execute
+( const AbstractDistMatrix<S>& A,
+        AbstractDistMatrix<T>& B ) const
+{
+    EL_DEBUG_CSE
+    B.Resize( height_, width_ );
+    if( !Matches( A, B ) )
+        LogicError("Redistribution plan does not match the matrices");
+    Zero( B );
+    if( !includeViewers_ && !B.Grid().InGrid() )
+        return;
+
+    const int redundantRootB = 0;
+    const Int localHeight = A.LocalHeight();
+    const Int localWidth = A.LocalWidth();
+    auto& ALoc = A.LockedMatrix();
+    auto& BLoc = B.Matrix();
+
+    // Pack the data
+    // =============
+    const Int totalSend = ( sendCounts_.empty() ? 0 :
+                            sendOffs_.back()+sendCounts_.back() );
+    const Int totalRecv = ( recvCounts_.empty() ? 0 :
+                            recvOffs_.back()+recvCounts_.back() );
+    mpi::PersistentExchange* persistent = nullptr;
+    if( IsPacked<Base<S>>::value )
+    {
+        if( !exchange_ ||
+            !exchange_->Matches<S>( sendCounts_, recvCounts_, Comm() ) )
+        {
+            exchange_ = std::make_shared<mpi::PersistentExchange>();
+            exchange_->Setup<S>
+            ( sendCounts_, sendOffs_, recvCounts_, recvOffs_, Comm(), true );
+        }
+        persistent = exchange_.get();
+    }
+    vector<S> sendBuf, recvBuf;
+    if( !persistent )
+    {
+        FastResize( sendBuf, totalSend );
+        FastResize( recvBuf, totalRecv );
+    }
+    S* sendData = ( persistent ? persistent->SendBuffer<S>() : sendBuf.data() );
+    const S* recvData =
+      ( persistent ? persistent->RecvBuffer<S>() : recvBuf.data() );
+    if( !packTargets_.empty() )
+    {
+        Int k = 0;
+        for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+        {
+            for( Int iLoc=0; iLoc<localHeight; ++iLoc, ++k )
+            {
+                const Int target = packTargets_[k];
+                const S& alpha = ALoc(iLoc,jLoc);
+                if( target >= 0 )
+                {
+                    sendData[target] = alpha;
+                }
+                else
+                {
+                    const Int l = -target-1;
+                    BLoc(localRows_[l],localCols_[l]) =
+                      Caster<S,T>::Cast(alpha);
+                }
+            }
+        }
+    }
+
+    // Exchange and unpack the data
+    // ============================
+    if( persistent )
+    {
+        persistent->Start();
+        persistent->Wait();
+    }
+    else
+    {
+        mpi::AllToAll
+        ( sendBuf.data(), sendCounts_.data(), sendOffs_.data(),
+          recvBuf.data(), recvCounts_.data(), recvOffs_.data(), Comm() );
+    }
+    if( B.Participating() )
+    {
+        if( B.RedundantRank() == redundantRootB )
+        {
+            for( Int k=0; k<totalRecv; ++k )
+                BLoc(recvRows_[k],recvCols_[k]) =
+                  Caster<S,T>::Cast(recvData[k]);
+        }
+        El::Broadcast( B, B.RedundantComm(), redundantRootB );
+    }
+}
+
+// A least-recently-used cache of redistribution plans which is consulted by
+// the general-purpose redistribution when SetRedistPlanCacheSize has been
+// called with a positive capacity. The plans are bucketed by the pair of
+// grids so that every process in the redistribution's communicator observes
+// the same sequence of hits and misses.
+RedistPlan* FindRedistPlan
+( size_t gridIdA, size_t gridIdB,
+  const function<bool(const RedistPlan&)>& matches );
+RedistPlan& AddRedistPlan( RedistPlan&& plan );
+
+} // namespace copy
+} // namespace El
+
+#endif // ifndef EL_BLAS_COPY_PLAN_HPP
@@ -17,6 +17,7 @@ template<typename T>
 void RowAllGather( const ElementalMatrix<T>& A, ElementalMatrix<T>& B )
 {
     EL_DEBUG_CSE
+    EL_PROFILE_REGION("copy::RowAllGather");
     EL_DEBUG_ONLY(
       if( A.ColDist() != B.ColDist() ||
           Collect(A.RowDist()) != B.RowDist() )
@@ -50,10 +51,9 @@ void RowAllGather( const ElementalMatrix<T>& A, ElementalMatrix<T>& B )
                 const Int maxLocalWidth = MaxLength(width,rowStride);
 
                 const Int portionSize = mpi::Pad( localHeight*maxLocalWidth );
-                vector<T> buffer;
-                FastResize( buffer, (rowStride+1)*portionSize );
-                T* sendBuf = &buffer[0];
-                T* recvBuf = &buffer[portionSize];
+                Memory<T> buffer( (rowStride+1)*portionSize );
+                T* sendBuf = buffer.Buffer();
+                T* recvBuf = buffer.Buffer()+portionSize;
 
                 // Pack
                 util::InterleaveMatrix
@@ -62,8 +62,9 @@ void RowAllGather( const ElementalMatrix<T>& A, ElementalMatrix<T>& B )
                   sendBuf,          1, localHeight );
 
                 // Communicate
-                mpi::AllGather
-                ( sendBuf, portionSize, recvBuf, portionSize, A.RowComm() );
+                util::AllGather
+                ( sendBuf, recvBuf, portionSize,
+                  A.Grid(), A.RowDist(), A.RowComm() );
 
                 // Unpack
                 util::RowStridedUnpack
@@ -103,10 +104,9 @@ void RowAllGather( const ElementalMatrix<T>& A, ElementalMatrix<T>& B )
                 const Int maxLocalWidth = MaxLength(width,rowStride);
 
                 const Int portionSize = mpi::Pad(maxLocalHeight*maxLocalWidth);
-                vector<T> buffer;
-                FastResize( buffer, (rowStride+1)*portionSize );
-                T* firstBuf = &buffer[0];
-                T* secondBuf = &buffer[portionSize];
+                Memory<T> buffer( (rowStride+1)*portionSize );
+                T* firstBuf = buffer.Buffer();
+                T* secondBuf = buffer.Buffer()+portionSize;
 
                 // Pack
                 util::InterleaveMatrix
@@ -120,9 +120,9 @@ void RowAllGather( const ElementalMatrix<T>& A, ElementalMatrix<T>& B )
                   firstBuf,  portionSize, recvColRank, A.ColComm() );
 
                 // Perform the row AllGather
-                mpi::AllGather
-                ( firstBuf,  portionSize,
-                  secondBuf, portionSize, A.RowComm() );
+                util::AllGather
+                ( firstBuf, secondBuf, portionSize,
+                  A.Grid(), A.RowDist(), A.RowComm() );
 
                 // Unpack
                 util::RowStridedUnpack
@@ -143,6 +143,7 @@ template<typename T>
 void RowAllGather( const BlockMatrix<T>& A, BlockMatrix<T>& B )
 {
     EL_DEBUG_CSE
+    EL_PROFILE_REGION("copy::RowAllGather");
     AssertSameGrids( A, B );
 
     EL_DEBUG_ONLY(
@@ -194,10 +195,9 @@ void RowAllGather( const BlockMatrix<T>& A, BlockMatrix<T>& B )
                   MaxBlockedLength(width,blockWidth,rowCut,rowStride);
 
                 const Int portionSize = mpi::Pad( localHeight*maxLocalWidth );
-                vector<T> buffer;
-                FastResize( buffer, (rowStride+1)*portionSize );
-                T* sendBuf = &buffer[0];
-                T* recvBuf = &buffer[portionSize];
+                Memory<T> buffer( (rowStride+1)*portionSize );
+                T* sendBuf = buffer.Buffer();
+                T* recvBuf = buffer.Buffer()+portionSize;
 
                 // Pack
                 util::InterleaveMatrix
@@ -206,8 +206,9 @@ void RowAllGather( const BlockMatrix<T>& A, BlockMatrix<T>& B )
                   sendBuf,          1, localHeight );
 
                 // Communicate
-                mpi::AllGather
-                ( sendBuf, portionSize, recvBuf, portionSize, A.RowComm() );
+                util::AllGather
+                ( sendBuf, recvBuf, portionSize,
+                  A.Grid(), A.RowDist(), A.RowComm() );
 
                 // Unpack
                 util::BlockedRowStridedUnpack
@@ -246,10 +247,9 @@ void RowAllGather( const BlockMatrix<T>& A, BlockMatrix<T>& B )
                   MaxBlockedLength(width,blockWidth,rowCut,rowStride);
 
                 const Int portionSize = mpi::Pad(maxLocalHeight*maxLocalWidth);
-                vector<T> buffer;
-                FastResize( buffer, (rowStride+1)*portionSize );
-                T* firstBuf = &buffer[0];
-                T* secondBuf = &buffer[portionSize];
+                Memory<T> buffer( (rowStride+1)*portionSize );
+                T* firstBuf = buffer.Buffer();
+                T* secondBuf = buffer.Buffer()+portionSize;
 
                 // Pack
                 util::InterleaveMatrix
@@ -263,9 +263,9 @@ void RowAllGather( const BlockMatrix<T>& A, BlockMatrix<T>& B )
                   firstBuf,  portionSize, recvColRank, A.ColComm() );
 
                 // Perform the row AllGather
-                mpi::AllGather
-                ( firstBuf,  portionSize,
-                  secondBuf, portionSize, A.RowComm() );
+                util::AllGather
+                ( firstBuf, secondBuf, portionSize,
+                  A.Grid(), A.RowDist(), A.RowComm() );
 
                 // Unpack
                 util::BlockedRowStridedUnpack
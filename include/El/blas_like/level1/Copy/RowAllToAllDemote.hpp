@@ -46,10 +46,9 @@ void RowAllToAllDemote
         }
         else
         {
-            vector<T> buffer;
-            FastResize( buffer, 2*rowStrideUnion*portionSize );
-            T* firstBuf  = &buffer[0];
-            T* secondBuf = &buffer[rowStrideUnion*portionSize];
+            Memory<T> buffer( 2*rowStrideUnion*portionSize );
+            T* firstBuf  = buffer.Buffer();
+            T* secondBuf = buffer.Buffer()+rowStrideUnion*portionSize;
 
             // Pack
             util::PartialRowStridedPack
@@ -61,9 +60,8 @@ void RowAllToAllDemote
               firstBuf,         portionSize );
 
             // Simultaneously Scatter in rows and Gather in columns
-            mpi::AllToAll
-            ( firstBuf,  portionSize,
-              secondBuf, portionSize, B.PartialUnionRowComm() );
+            util::AllToAll
+            ( firstBuf, secondBuf, portionSize, B.PartialUnionRowComm() );
 
             // Unpack
             util::ColStridedUnpack
@@ -82,10 +80,9 @@ void RowAllToAllDemote
         const Int sendRowRankPart = Mod( rowRankPart+rowDiff, rowStridePart );
         const Int recvRowRankPart = Mod( rowRankPart-rowDiff, rowStridePart );
 
-        vector<T> buffer;
-        FastResize( buffer, 2*rowStrideUnion*portionSize );
-        T* firstBuf  = &buffer[0];
-        T* secondBuf = &buffer[rowStrideUnion*portionSize];
+        Memory<T> buffer( 2*rowStrideUnion*portionSize );
+        T* firstBuf  = buffer.Buffer();
+        T* secondBuf = buffer.Buffer()+rowStrideUnion*portionSize;
 
         // Pack
         util::PartialRowStridedPack
@@ -97,9 +94,8 @@ void RowAllToAllDemote
           secondBuf,        portionSize );
 
         // Simultaneously Scatter in rows and Gather in columns
-        mpi::AllToAll
-        ( secondBuf, portionSize,
-          firstBuf,  portionSize, B.PartialUnionRowComm() );
+        util::AllToAll
+        ( secondBuf, firstBuf, portionSize, B.PartialUnionRowComm() );
 
         // Realign the result
         mpi::SendRecv
@@ -47,10 +47,9 @@ void RowAllToAllPromote
         }
         else
         {
-            vector<T> buffer;
-            FastResize( buffer, 2*rowStrideUnion*portionSize );
-            T* firstBuf  = &buffer[0];
-            T* secondBuf = &buffer[rowStrideUnion*portionSize];
+            Memory<T> buffer( 2*rowStrideUnion*portionSize );
+            T* firstBuf  = buffer.Buffer();
+            T* secondBuf = buffer.Buffer()+rowStrideUnion*portionSize;
 
             // Pack
             util::ColStridedPack
@@ -60,9 +59,8 @@ void RowAllToAllPromote
               firstBuf,         portionSize );
 
             // Simultaneously Gather in rows and Scatter in columns
-            mpi::AllToAll
-            ( firstBuf,  portionSize,
-              secondBuf, portionSize, A.PartialUnionRowComm() );
+            util::AllToAll
+            ( firstBuf, secondBuf, portionSize, A.PartialUnionRowComm() );
 
             // Unpack
             util::PartialRowStridedUnpack
@@ -83,10 +81,9 @@ void RowAllToAllPromote
         const Int sendRowRankPart = Mod( rowRankPart+rowDiff, rowStridePart );
         const Int recvRowRankPart = Mod( rowRankPart-rowDiff, rowStridePart );
 
-        vector<T> buffer;
-        FastResize( buffer, 2*rowStrideUnion*portionSize );
-        T* firstBuf  = &buffer[0];
-        T* secondBuf = &buffer[rowStrideUnion*portionSize];
+        Memory<T> buffer( 2*rowStrideUnion*portionSize );
+        T* firstBuf  = buffer.Buffer();
+        T* secondBuf = buffer.Buffer()+rowStrideUnion*portionSize;
 
         // Pack
         util::ColStridedPack
@@ -102,9 +99,8 @@ void RowAllToAllPromote
           A.PartialRowComm() );
 
         // Simultaneously Scatter in rows and Gather in columns
-        mpi::AllToAll
-        ( firstBuf,  portionSize,
-          secondBuf, portionSize, A.PartialUnionRowComm() );
+        util::AllToAll
+        ( firstBuf, secondBuf, portionSize, A.PartialUnionRowComm() );
 
         // Unpack
         util::PartialRowStridedUnpack
@@ -60,9 +60,9 @@ void Translate
         const Int maxHeight = MaxLength( height, colStride );
         const Int maxWidth  = MaxLength( width,  rowStride );
         const Int pkgSize = mpi::Pad( maxHeight*maxWidth );
-        vector<T> buffer;
+        Memory<T> buffer;
         if( crossRank == root || crossRank == B.Root() )
-            FastResize( buffer, pkgSize );
+            buffer.Require( pkgSize );
 
         const Int colAlignB = B.ColAlign();
         const Int rowAlignB = B.RowAlign();
@@ -77,7 +77,7 @@ void Translate
             util::InterleaveMatrix
             ( A.LocalHeight(), A.LocalWidth(),
               A.LockedBuffer(), 1, A.LDim(),
-              buffer.data(),    1, A.LocalHeight() );
+              buffer.Buffer(),    1, A.LocalHeight() );
 
             if( !aligned )
             {
@@ -94,22 +94,22 @@ void Translate
                 const Int fromRank = fromRow + fromCol*colStride;
 
                 mpi::SendRecv
-                ( buffer.data(), pkgSize, toRank, fromRank, A.DistComm() );
+                ( buffer.Buffer(), pkgSize, toRank, fromRank, A.DistComm() );
             }
         }
         if( root != B.Root() )
         {
             // Send to the correct new root over the cross communicator
             if( crossRank == root )
-                mpi::Send( buffer.data(), recvSize, B.Root(), B.CrossComm() );
+                mpi::Send( buffer.Buffer(), recvSize, B.Root(), B.CrossComm() );
             else if( crossRank == B.Root() )
-                mpi::Recv( buffer.data(), recvSize, root, B.CrossComm() );
+                mpi::Recv( buffer.Buffer(), recvSize, root, B.CrossComm() );
         }
         // Unpack
         if( crossRank == B.Root() )
             util::InterleaveMatrix
             ( localHeightB, localWidthB,
-              buffer.data(), 1, localHeightB,
+              buffer.Buffer(), 1, localHeightB,
               B.Buffer(),    1, B.LDim() );
     }
 }
@@ -146,11 +146,90 @@ void Translate
     if( A.Grid().Size() == 1 || (aligned && root == B.Root()) )
     {
         Copy( A.LockedMatrix(), B.Matrix() );
+        return;
     }
-    else
+    const bool sameBlocks =
+        blockHeight == B.BlockHeight() && blockWidth == B.BlockWidth() &&
+        colCut      == B.ColCut()      && rowCut     == B.RowCut();
+    if( !sameBlocks )
     {
         GeneralPurpose( A, B );
+        return;
+    }
+    const Grid& g = A.Grid();
+    if( !g.InGrid() )
+        return;
+
+    // Since the blocks are identical, the alignments only determine which
+    // process owns each local matrix, and so, as in the elemental case, the
+    // local data need only be shifted over the DistComm (and moved between
+    // roots over the CrossComm)
+#ifdef EL_UNALIGNED_WARNINGS
+    if( g.Rank() == 0 )
+        cerr << "Unaligned [U,V,BLOCK] <- [U,V,BLOCK]" << endl;
+#endif
+    const Int colRank = A.ColRank();
+    const Int rowRank = A.RowRank();
+    const Int crossRank = A.CrossRank();
+    const Int colStride = A.ColStride();
+    const Int rowStride = A.RowStride();
+    const Int maxHeight =
+      MaxBlockedLength( height, blockHeight, colCut, colStride );
+    const Int maxWidth =
+      MaxBlockedLength( width, blockWidth, rowCut, rowStride );
+    const Int pkgSize = mpi::Pad( maxHeight*maxWidth );
+    Memory<T> buffer;
+    if( crossRank == root || crossRank == B.Root() )
+        buffer.Require( pkgSize );
+
+    const Int colAlignB = B.ColAlign();
+    const Int rowAlignB = B.RowAlign();
+    const Int localHeightB =
+      BlockedLength
+      ( height, Shift(colRank,colAlignB,colStride), blockHeight, colCut,
+        colStride );
+    const Int localWidthB =
+      BlockedLength
+      ( width, Shift(rowRank,rowAlignB,rowStride), blockWidth, rowCut,
+        rowStride );
+    const Int recvSize = mpi::Pad( localHeightB*localWidthB );
+
+    if( crossRank == root )
+    {
+        util::InterleaveMatrix
+        ( A.LocalHeight(), A.LocalWidth(),
+          A.LockedBuffer(), 1, A.LDim(),
+          buffer.Buffer(),  1, A.LocalHeight() );
+
+        if( !aligned )
+        {
+            const Int colDiff = colAlignB-colAlign;
+            const Int rowDiff = rowAlignB-rowAlign;
+
+            const Int toRow = Mod(colRank+colDiff,colStride);
+            const Int toCol = Mod(rowRank+rowDiff,rowStride);
+            const Int toRank = toRow + toCol*colStride;
+
+            const Int fromRow = Mod(colRank-colDiff,colStride);
+            const Int fromCol = Mod(rowRank-rowDiff,rowStride);
+            const Int fromRank = fromRow + fromCol*colStride;
+
+            mpi::SendRecv
+            ( buffer.Buffer(), pkgSize, toRank, fromRank, A.DistComm() );
+        }
+    }
+    if( root != B.Root() )
+    {
+        if( crossRank == root )
+            mpi::Send( buffer.Buffer(), recvSize, B.Root(), B.CrossComm() );
+        else if( crossRank == B.Root() )
+            mpi::Recv( buffer.Buffer(), recvSize, root, B.CrossComm() );
     }
+    if( crossRank == B.Root() )
+        util::InterleaveMatrix
+        ( localHeightB, localWidthB,
+          buffer.Buffer(), 1, localHeightB,
+          B.Buffer(),      1, B.LDim() );
 }
 
 } // namespace copy
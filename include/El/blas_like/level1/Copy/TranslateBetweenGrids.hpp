@@ -21,203 +21,311 @@ void TranslateBetweenGrids
     GeneralPurpose( A, B );
 }
 
-// TODO(poulson): Compare against copy::GeneralPurpose
-template<typename T>
-void TranslateBetweenGrids
-( const DistMatrix<T,MC,MR>& A,
-        DistMatrix<T,MC,MR>& B )
+// A GridTranslationPlan precomputes the exchange of an [MC,MR] matrix between
+// two different grids whose owning processes both lie within the viewing
+// communicator of the second grid. Since the entries which a process of A's
+// grid owns and which are destined for a single process of B's grid form a
+// strided submatrix of both local matrices, each such pair of processes
+// exchanges exactly one message, and only the members of the union of the two
+// grids take part in the exchange.
+//
+// The construction does not communicate, and each execution posts all of its
+// receives before packing and sending each message so that the packing,
+// transfers, and unpacking are overlapped. Messages which form contiguous runs
+// of either local matrix are sent from (or received into) it directly.
+class GridTranslationPlan
 {
-    EL_DEBUG_CSE
-    const Int m = A.Height();
-    const Int n = A.Width();
-    const Int mLocA = A.LocalHeight();
-    const Int nLocA = A.LocalWidth();
-    B.Resize( m, n );
-    mpi::Comm viewingCommB = B.Grid().ViewingComm();
-    mpi::Group owningGroupA = A.Grid().OwningGroup();
-
-    // Just need to ensure that each viewing comm contains the other team's
-    // owning comm. Congruence is too strong.
-
-    // Compute the number of process rows and columns that each process
-    // needs to send to.
-    const Int colStride = B.ColStride();
-    const Int rowStride = B.RowStride();
-    const Int colShiftB = B.ColShift();
-    const Int rowShiftB = B.RowShift();
-    const Int colRank = B.ColRank();
-    const Int rowRank = B.RowRank();
-    const Int colRankA = A.ColRank();
-    const Int rowRankA = A.RowRank();
-    const Int colStrideA = A.ColStride();
-    const Int rowStrideA = A.RowStride();
-    const Int colGCD = GCD( colStride, colStrideA );
-    const Int rowGCD = GCD( rowStride, rowStrideA );
-    const Int colLCM = colStride*colStrideA / colGCD;
-    const Int rowLCM = rowStride*rowStrideA / rowGCD;
-    const Int numColSends = colStride / colGCD;
-    const Int numRowSends = rowStride / rowGCD;
-
-    const Int colAlignA = A.ColAlign();
-    const Int rowAlignA = A.RowAlign();
-    const Int colAlignB = B.ColAlign();
-    const Int rowAlignB = B.RowAlign();
+public:
+    GridTranslationPlan() { }
 
-    const bool inBGrid = B.Participating();
-    const bool inAGrid = A.Participating();
-    if( !inBGrid && !inAGrid )
-        return;
+    template<typename S,typename T>
+    GridTranslationPlan
+    ( const DistMatrix<S,MC,MR>& A, const DistMatrix<T,MC,MR>& B );
 
-    const Int maxSendSize =
-      (m/(colStrideA*numColSends)+1) * (n/(rowStrideA*numRowSends)+1);
+    template<typename S,typename T>
+    bool Matches
+    ( const DistMatrix<S,MC,MR>& A, const DistMatrix<T,MC,MR>& B ) const;
 
-    // Translate the ranks from A's VC communicator to B's viewing so that
-    // we can match send/recv communicators. Since A's VC communicator is not
-    // necessarily defined on every process, we instead work with A's owning
-    // group and account for row-major ordering if necessary.
-    const int sizeA = A.Grid().Size();
-    vector<int> rankMap(sizeA), ranks(sizeA);
-    if( A.Grid().Order() == COLUMN_MAJOR )
+    // B is resized to match A before the entries are translated
+    template<typename T>
+    void Execute
+    ( const DistMatrix<T,MC,MR>& A, DistMatrix<T,MC,MR>& B ) const;
+
+private:
+    struct Block
     {
-        for( int j=0; j<sizeA; ++j )
-            ranks[j] = j;
-    }
-    else
+        int rank;
+        Int row, col, height, width;
+    };
+    struct LocalBlock
+    {
+        Int rowA, colA, rowB, colB, height, width;
+    };
+
+    size_t gridIdA_, gridIdB_;
+    Int height_, width_;
+    int colAlignA_, rowAlignA_, colAlignB_, rowAlignB_;
+
+    // The strides between the local rows (columns) of a message within the
+    // local matrices of A and B
+    Int colStepA_, rowStepA_, colStepB_, rowStepB_;
+
+    // Sends are indexed by A's local coordinates, receives by B's, and the
+    // blocks kept by a process belonging to both grids by both
+    vector<Block> sends_, recvs_;
+    vector<LocalBlock> localBlocks_;
+};
+
+namespace translate {
+
+// A (possibly empty) set of indices owned by process 'ownerA' of the first
+// distribution and by 'ownerB' of the second with the given local offsets
+// (the strides follow from the GCD of the two strides)
+struct Piece
+{
+    int ownerA, ownerB;
+    Int localA, localB, length;
+};
+
+inline vector<Piece> Pieces
+( Int n, int alignA, int strideA, int alignB, int strideB )
+{
+    const int gcd = GCD( strideA, strideB );
+    const int numSends = strideB / gcd;
+    const Int lcm = Int(strideA/gcd)*strideB;
+    vector<Piece> pieces;
+    for( int ownerA=0; ownerA<strideA; ++ownerA )
     {
-        // The (i,j) = i + j*colStrideA rank in the column-major ordering is
-        // equal to the j + i*rowStrideA rank in a row-major ordering.
-        // Since we desire rankMap[i+j*colStrideA] to correspond to process
-        // (i,j) in A's grid's rank in this viewing group, ranks[i+j*colStrideA]
-        // should correspond to process (i,j) in A's owning group. Since the
-        // owning group is ordered row-major in this case, its rank is
-        // j+i*rowStrideA. Note that setting
-        // ranks[j+i*rowStrideA] = i+j*colStrideA is *NOT* valid.
-        for( int i=0; i<colStrideA; ++i )
-            for( int j=0; j<rowStrideA; ++j )
-                ranks[i+j*colStrideA] = j+i*rowStrideA;
+        const Int shiftA = Shift( ownerA, alignA, strideA );
+        for( int t=0; t<numSends; ++t )
+        {
+            const Int first = shiftA + t*strideA;
+            const Int length = Length( n, first, lcm );
+            if( length == 0 )
+                continue;
+            const int ownerB = Mod( first+alignB, strideB );
+            const Int shiftB = Shift( ownerB, alignB, strideB );
+            pieces.push_back
+            ( Piece{ownerA,ownerB,Int(t),(first-shiftB)/strideB,length} );
+        }
     }
-    mpi::Translate
-    ( owningGroupA, sizeA, ranks.data(), viewingCommB, rankMap.data() );
+    return pieces;
+}
 
-    // Have each member of A's grid individually send to all numRow x numCol
-    // processes in order, while the members of this grid receive from all
-    // necessary processes at each step.
-    Int requiredMemory = 0;
-    if( inAGrid )
-        requiredMemory += maxSendSize;
-    if( inBGrid )
-        requiredMemory += maxSendSize;
-    vector<T> auxBuf;
-    FastResize( auxBuf, requiredMemory );
-    Int offset = 0;
-    T* sendBuf = &auxBuf[offset];
-    if( inAGrid )
-        offset += maxSendSize;
-    T* recvBuf = &auxBuf[offset];
+} // namespace translate
+
+template<typename S,typename T>
+GridTranslationPlan::GridTranslationPlan
+( const DistMatrix<S,MC,MR>& A, const DistMatrix<T,MC,MR>& B )
+: gridIdA_(A.Grid().Id()), gridIdB_(B.Grid().Id()),
+  height_(A.Height()), width_(A.Width()),
+  colAlignA_(A.ColAlign()), rowAlignA_(A.RowAlign()),
+  colAlignB_(B.ColAlign()), rowAlignB_(B.RowAlign())
+{
+    EL_DEBUG_CSE
+    const Grid& gA = A.Grid();
+    const Grid& gB = B.Grid();
+    const int colStrideA = A.ColStride();
+    const int rowStrideA = A.RowStride();
+    const int colStrideB = B.ColStride();
+    const int rowStrideB = B.RowStride();
+    const int colGCD = GCD( colStrideA, colStrideB );
+    const int rowGCD = GCD( rowStrideA, rowStrideB );
+    colStepA_ = colStrideB / colGCD;
+    rowStepA_ = rowStrideB / rowGCD;
+    colStepB_ = colStrideA / colGCD;
+    rowStepB_ = rowStrideA / rowGCD;
+
+    const bool inAGrid = A.Participating();
+    const bool inBGrid = B.Participating();
+    if( !inAGrid && !inBGrid )
+        return;
+    mpi::Comm viewingCommB = gB.ViewingComm();
+    const int viewingRank = mpi::Rank( viewingCommB );
+
+    // Translate the process (i,j) of A's grid, i.e., the (i + j*colStrideA)
+    // member of its column-major ordering, into B's viewing communicator.
+    // Since A's owning group is ordered row-major when A's grid is, its
+    // rank is j + i*rowStrideA in that case.
+    const int sizeA = gA.Size();
+    vector<int> ranks(sizeA), rankMap(sizeA);
+    for( int i=0; i<colStrideA; ++i )
+        for( int j=0; j<rowStrideA; ++j )
+            ranks[i+j*colStrideA] =
+              ( gA.Order() == COLUMN_MAJOR ? i+j*colStrideA : j+i*rowStrideA );
+    mpi::Translate
+    ( gA.OwningGroup(), sizeA, ranks.data(), viewingCommB, rankMap.data() );
 
-    Int recvRow = 0; // avoid compiler warnings...
+    const auto rowPieces =
+      translate::Pieces
+      ( height_, colAlignA_, colStrideA, colAlignB_, colStrideB );
+    const auto colPieces =
+      translate::Pieces
+      ( width_, rowAlignA_, rowStrideA, rowAlignB_, rowStrideB );
     if( inAGrid )
-        recvRow = Mod(Mod(colRankA-colAlignA,colStrideA)+colAlignB,colStride);
-    for( Int colSend=0; colSend<numColSends; ++colSend )
     {
-        Int recvCol = 0; // avoid compiler warnings...
-        if( inAGrid )
-            recvCol=Mod(Mod(rowRankA-rowAlignA,rowStrideA)+rowAlignB,rowStride);
-        for( Int rowSend=0; rowSend<numRowSends; ++rowSend )
+        const int colRankA = A.ColRank();
+        const int rowRankA = A.RowRank();
+        for( const auto& colPiece : colPieces )
         {
-            mpi::Request<T> sendRequest;
-            // Fire off this round of non-blocking sends
-            if( inAGrid )
-            {
-                // Pack the data
-                Int sendHeight = Length(mLocA,colSend,numColSends);
-                Int sendWidth = Length(nLocA,rowSend,numRowSends);
-                copy::util::InterleaveMatrix
-                ( sendHeight, sendWidth,
-                  A.LockedBuffer(colSend,rowSend),
-                  numColSends, numRowSends*A.LDim(),
-                  sendBuf, 1, sendHeight );
-                // Send data
-                const Int recvVCRank = recvRow + recvCol*colStride;
-                const Int recvViewingRank = B.Grid().VCToViewing( recvVCRank );
-                mpi::ISend
-                ( sendBuf, sendHeight*sendWidth, recvViewingRank,
-                  viewingCommB, sendRequest );
-            }
-            // Perform this round of recv's
-            if( inBGrid )
+            if( colPiece.ownerA != rowRankA )
+                continue;
+            for( const auto& rowPiece : rowPieces )
             {
-                const Int sendColOffset = colAlignA;
-                const Int recvColOffset =
-                  Mod(colSend*colStrideA+colAlignB,colStride);
-                const Int sendRowOffset = rowAlignA;
-                const Int recvRowOffset =
-                  Mod(rowSend*rowStrideA+rowAlignB,rowStride);
-
-                const Int colShift = Mod( colRank-recvColOffset, colStride );
-                const Int rowShift = Mod( rowRank-recvRowOffset, rowStride );
-
-                const Int firstSendRow = Mod(colShift+sendColOffset,colStrideA);
-                const Int firstSendCol = Mod(rowShift+sendRowOffset,rowStrideA);
-
-                const Int numColRecvs = Length(colStrideA,colShift,colStride);
-                const Int numRowRecvs = Length(rowStrideA,rowShift,rowStride);
-
-                // Recv data
-                // For now, simply receive sequentially. Until we switch to
-                // nonblocking recv's, we won't be using much of the
-                // recvBuf
-                Int sendRow = firstSendRow;
-                for( Int colRecv=0; colRecv<numColRecvs; ++colRecv )
-                {
-                    const Int sendColShift =
-                      Shift( sendRow, colAlignA, colStrideA ) +
-                      colSend*colStrideA;
-                    const Int sendHeight = Length( m, sendColShift, colLCM );
-                    const Int localColOffset =
-                      (sendColShift-colShiftB) / colStride;
-
-                    Int sendCol = firstSendCol;
-                    for( Int rowRecv=0; rowRecv<numRowRecvs; ++rowRecv )
-                    {
-                        const Int sendRowShift =
-                          Shift( sendCol, rowAlignA, rowStrideA ) +
-                          rowSend*rowStrideA;
-                        const Int sendWidth = Length( n, sendRowShift, rowLCM );
-                        const Int localRowOffset =
-                          (sendRowShift-rowShiftB) / rowStride;
-
-                        const Int sendVCRank = sendRow+sendCol*colStrideA;
-                        mpi::Recv
-                        ( recvBuf, sendHeight*sendWidth, rankMap[sendVCRank],
-                          viewingCommB );
-
-                        // Unpack the data
-                        copy::util::InterleaveMatrix
-                        ( sendHeight, sendWidth,
-                          recvBuf, 1, sendHeight,
-                          B.Buffer(localColOffset,localRowOffset),
-                          colLCM/colStride, (rowLCM/rowStride)*B.LDim() );
-
-                        // Set up the next send col
-                        sendCol = Mod(sendCol+rowStride,rowStrideA);
-                    }
-                    // Set up the next send row
-                    sendRow = Mod(sendRow+colStride,colStrideA);
-                }
+                if( rowPiece.ownerA != colRankA )
+                    continue;
+                const int rankB =
+                  gB.VCToViewing( rowPiece.ownerB+colPiece.ownerB*colStrideB );
+                if( rankB == viewingRank )
+                    localBlocks_.push_back
+                    ( LocalBlock{rowPiece.localA,colPiece.localA,
+                                 rowPiece.localB,colPiece.localB,
+                                 rowPiece.length,colPiece.length} );
+                else
+                    sends_.push_back
+                    ( Block{rankB,rowPiece.localA,colPiece.localA,
+                            rowPiece.length,colPiece.length} );
             }
-            // Ensure that this round of non-blocking sends completes
-            if( inAGrid )
+        }
+    }
+    if( inBGrid )
+    {
+        const int colRankB = B.ColRank();
+        const int rowRankB = B.RowRank();
+        for( const auto& colPiece : colPieces )
+        {
+            if( colPiece.ownerB != rowRankB )
+                continue;
+            for( const auto& rowPiece : rowPieces )
             {
-                mpi::Wait( sendRequest );
-                recvCol = Mod(recvCol+rowStrideA,rowStride);
+                if( rowPiece.ownerB != colRankB )
+                    continue;
+                const int rankA =
+                  rankMap[rowPiece.ownerA+colPiece.ownerA*colStrideA];
+                if( rankA != viewingRank )
+                    recvs_.push_back
+                    ( Block{rankA,rowPiece.localB,colPiece.localB,
+                            rowPiece.length,colPiece.length} );
             }
         }
-        if( inAGrid )
-            recvRow = Mod(recvRow+colStrideA,colStride);
     }
 }
 
+template<typename S,typename T>
+bool GridTranslationPlan::Matches
+( const DistMatrix<S,MC,MR>& A, const DistMatrix<T,MC,MR>& B ) const
+{
+    return A.Grid().Id() == gridIdA_ && B.Grid().Id() == gridIdB_ &&
+           A.Height() == height_ && A.Width() == width_ &&
+           A.ColAlign() == colAlignA_ && A.RowAlign() == rowAlignA_ &&
+           B.ColAlign() == colAlignB_ && B.RowAlign() == rowAlignB_;
+}
+
+template<typename T>
+void GridTranslationPlan::Execute
+( const DistMatrix<T,MC,MR>& A, DistMatrix<T,MC,MR>& B ) const
+{
+    EL_DEBUG_CSE
+    B.Resize( height_, width_ );
+    if( !Matches( A, B ) )
+        LogicError("Grid translation plan does not match the matrices");
+    if( !A.Participating() && !B.Participating() )
+        return;
+    mpi::Comm viewingCommB = B.Grid().ViewingComm();
+    const Int ALDim = A.LDim();
+    const Int BLDim = B.LDim();
+    auto contiguous = []( const Block& block, Int colStep, Int rowStride )
+      { return colStep == 1 &&
+               (block.width == 1 || rowStride == block.height); };
+
+    // Post all of the receives, directly into B when possible
+    // =======================================================
+    const Int numRecvs = recvs_.size();
+    vector<Int> recvOffs(numRecvs+1,0);
+    for( Int k=0; k<numRecvs; ++k )
+    {
+        const Block& block = recvs_[k];
+        const bool direct = contiguous( block, colStepB_, rowStepB_*BLDim );
+        recvOffs[k+1] = recvOffs[k] + ( direct ? 0 : block.height*block.width );
+    }
+    vector<T> recvBuf;
+    FastResize( recvBuf, recvOffs[numRecvs] );
+    vector<mpi::Request<T>> recvRequests(numRecvs);
+    for( Int k=0; k<numRecvs; ++k )
+    {
+        const Block& block = recvs_[k];
+        const bool direct = recvOffs[k+1] == recvOffs[k];
+        T* buf =
+          ( direct ? B.Buffer(block.row,block.col) : &recvBuf[recvOffs[k]] );
+        mpi::IRecv
+        ( buf, block.height*block.width, block.rank, viewingCommB,
+          recvRequests[k] );
+    }
+
+    // Pack and send each message in turn
+    // ==================================
+    const Int numSends = sends_.size();
+    vector<Int> sendOffs(numSends+1,0);
+    for( Int k=0; k<numSends; ++k )
+    {
+        const Block& block = sends_[k];
+        const bool direct = contiguous( block, colStepA_, rowStepA_*ALDim );
+        sendOffs[k+1] = sendOffs[k] + ( direct ? 0 : block.height*block.width );
+    }
+    vector<T> sendBuf;
+    FastResize( sendBuf, sendOffs[numSends] );
+    vector<mpi::Request<T>> sendRequests(numSends);
+    for( Int k=0; k<numSends; ++k )
+    {
+        const Block& block = sends_[k];
+        const T* buf = A.LockedBuffer(block.row,block.col);
+        if( sendOffs[k+1] != sendOffs[k] )
+        {
+            T* packBuf = &sendBuf[sendOffs[k]];
+            util::InterleaveMatrix
+            ( block.height, block.width,
+              buf,     colStepA_, rowStepA_*ALDim,
+              packBuf, 1,         block.height );
+            buf = packBuf;
+        }
+        mpi::ISend
+        ( buf, block.height*block.width, block.rank, viewingCommB,
+          sendRequests[k] );
+    }
+
+    // Copy the entries which this process keeps while the messages are in
+    // flight
+    for( const auto& block : localBlocks_ )
+        util::InterleaveMatrix
+        ( block.height, block.width,
+          A.LockedBuffer(block.rowA,block.colA), colStepA_, rowStepA_*ALDim,
+          B.Buffer(block.rowB,block.colB),       colStepB_, rowStepB_*BLDim );
+
+    // Unpack the received messages
+    // ============================
+    for( Int k=0; k<numRecvs; ++k )
+    {
+        const Block& block = recvs_[k];
+        mpi::Wait( recvRequests[k] );
+        if( recvOffs[k+1] != recvOffs[k] )
+            util::InterleaveMatrix
+            ( block.height, block.width,
+              &recvBuf[recvOffs[k]],           1,         block.height,
+              B.Buffer(block.row,block.col), colStepB_, rowStepB_*BLDim );
+    }
+    mpi::WaitAll( numSends, sendRequests.data() );
+}
+
+template<typename T>
+void TranslateBetweenGrids
+( const DistMatrix<T,MC,MR>& A,
+        DistMatrix<T,MC,MR>& B )
+{
+    EL_DEBUG_CSE
+    B.Resize( A.Height(), A.Width() );
+    GridTranslationPlan( A, B ).Execute( A, B );
+}
+
 template<typename T>
 void TranslateBetweenGrids
 ( const DistMatrix<T,STAR,STAR>& A,
@@ -290,13 +398,12 @@ void TranslateBetweenGrids
         requiredMemory += height*width;
     if( B.Participating() )
         requiredMemory += height*width;
-    vector<T> buffer;
-    FastResize( buffer, requiredMemory );
+    Memory<T> buffer( requiredMemory );
     Int offset = 0;
-    T* sendBuf = &buffer[offset];
+    T* sendBuf = buffer.Buffer()+offset;
     if( rankA == 0 )
         offset += height*width;
-    T* bcastBuffer = &buffer[offset];
+    T* bcastBuffer = buffer.Buffer()+offset;
 
     // Send from the root of A to the root of B's matrix's grid
     mpi::Request<T> sendRequest;
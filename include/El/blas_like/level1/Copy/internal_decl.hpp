@@ -138,11 +138,41 @@ void PartialColAllGather
 ( const DistMatrix<T,        U,   V,BLOCK>& A,
         DistMatrix<T,Partial<U>(),V,BLOCK>& B );
 
+// The state of a nonblocking partial AllGather: the communication is started
+// by Begin and completed by Finish, between which neither A nor B should be
+// modified
+template<typename T>
+struct AllGatherRequest
+{
+    Memory<T> buffer;
+    Int portionSize=0;
+    bool pending=false;
+    mpi::Request<T> request;
+};
+template<typename T,Dist U,Dist V>
+void BeginPartialColAllGather
+( const DistMatrix<T,        U,   V>& A,
+        DistMatrix<T,Partial<U>(),V>& B,
+  AllGatherRequest<T>& request );
+template<typename T,Dist U,Dist V>
+void FinishPartialColAllGather
+( const DistMatrix<T,        U,   V>& A,
+        DistMatrix<T,Partial<U>(),V>& B,
+  AllGatherRequest<T>& request );
+
 // (U,V) |-> (U,Partial(V))
 template<typename T>
 void PartialRowAllGather
 ( const ElementalMatrix<T>& A, ElementalMatrix<T>& B );
 template<typename T>
+void BeginPartialRowAllGather
+( const ElementalMatrix<T>& A, ElementalMatrix<T>& B,
+  AllGatherRequest<T>& request );
+template<typename T>
+void FinishPartialRowAllGather
+( const ElementalMatrix<T>& A, ElementalMatrix<T>& B,
+  AllGatherRequest<T>& request );
+template<typename T>
 void PartialRowAllGather
 ( const BlockMatrix<T>& A, BlockMatrix<T>& B );
 
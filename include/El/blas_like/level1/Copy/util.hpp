@@ -13,15 +13,63 @@ namespace El {
 namespace copy {
 namespace util {
 
+// Collectives over the communicator of the distribution 'dist' of a grid
+// which select their algorithm by message size and communicator layout
+// (including the two-level algorithms when the grid is node-aware)
+template<typename T>
+void AllGather
+( const T* sbuf, T* rbuf, Int count,
+  const Grid& g, Dist dist, mpi::Comm comm )
+{ mpi::SelectedAllGather( sbuf, rbuf, count, comm, g.Hierarchy(dist) ); }
+
+// 'sbuf' and 'rbuf' may coincide
+template<typename T>
+void ReduceScatter
+( T* sbuf, T* rbuf, Int count,
+  const Grid& g, Dist dist, mpi::Comm comm )
+{ mpi::SelectedReduceScatter( sbuf, rbuf, count, comm, g.Hierarchy(dist) ); }
+
+template<typename T>
+void AllToAll( const T* sbuf, T* rbuf, Int count, mpi::Comm comm )
+{ mpi::SelectedAllToAll( sbuf, rbuf, count, comm ); }
+
+// Copy the height x width matrix whose (i,j) entry is
+// A[i*colStrideA+j*rowStrideA] into the analogous locations of B. The
+// unit-stride cases are specialized so that the inner loops may be
+// vectorized, and the columns are distributed over the threads when the copy
+// is large enough to amortize the fork.
 template<typename T>
 void InterleaveMatrix
 ( Int height, Int width,
   const T* A, Int colStrideA, Int rowStrideA,
         T* B, Int colStrideB, Int rowStrideB )
 {
+    if( height <= 0 || width <= 0 )
+        return;
     if( colStrideA == 1 && colStrideB == 1 )
     {
-        lapack::Copy( 'F', height, width, A, rowStrideA, B, rowStrideB );
+        if( rowStrideA == height && rowStrideB == height )
+        {
+            // Both matrices are contiguous, so copy them in large chunks
+            const Int numEntries = height*width;
+            const Int numChunks =
+              ( ParallelizeLoop(numEntries) ? width : Int(1) );
+            const Int chunkSize = (numEntries+numChunks-1)/numChunks;
+            EL_PARALLEL_FOR_IF(numChunks > 1)
+            for( Int chunk=0; chunk<numChunks; ++chunk )
+            {
+                const Int offset = chunk*chunkSize;
+                const Int size = Min( chunkSize, numEntries-offset );
+                if( size > 0 )
+                    MemCopy( &B[offset], &A[offset], size );
+            }
+        }
+        else
+        {
+            EL_PARALLEL_FOR_IF(ParallelizeLoop(height*width))
+            for( Int j=0; j<width; ++j )
+                MemCopy( &B[j*rowStrideB], &A[j*rowStrideA], height );
+        }
     }
     else
     {
@@ -31,10 +79,40 @@ void InterleaveMatrix
           A, rowStrideA, colStrideA,
           B, rowStrideB, colStrideB );
 #else
-        for( Int j=0; j<width; ++j )
-            StridedMemCopy
-            ( &B[j*rowStrideB], colStrideB,
-              &A[j*rowStrideA], colStrideA, height );
+        if( colStrideB == 1 )
+        {
+            // Gather each column of A into a contiguous column of B
+            EL_PARALLEL_FOR_IF(ParallelizeLoop(height*width))
+            for( Int j=0; j<width; ++j )
+            {
+                const T* ACol = &A[j*rowStrideA];
+                      T* BCol = &B[j*rowStrideB];
+                EL_SIMD
+                for( Int i=0; i<height; ++i )
+                    BCol[i] = ACol[i*colStrideA];
+            }
+        }
+        else if( colStrideA == 1 )
+        {
+            // Scatter each contiguous column of A into a column of B
+            EL_PARALLEL_FOR_IF(ParallelizeLoop(height*width))
+            for( Int j=0; j<width; ++j )
+            {
+                const T* ACol = &A[j*rowStrideA];
+                      T* BCol = &B[j*rowStrideB];
+                EL_SIMD
+                for( Int i=0; i<height; ++i )
+                    BCol[i*colStrideB] = ACol[i];
+            }
+        }
+        else
+        {
+            EL_PARALLEL_FOR_IF(ParallelizeLoop(height*width))
+            for( Int j=0; j<width; ++j )
+                StridedMemCopy
+                ( &B[j*rowStrideB], colStrideB,
+                  &A[j*rowStrideA], colStrideA, height );
+        }
 #endif
     }
 }
@@ -121,10 +199,10 @@ void BlockedColStridedUnpack
                 firstBlockHeight :
                 Min(blockHeight,height-rowIndex) );
 
-            lapack::Copy
-            ( 'F', thisBlockHeight, width,
-              &APortion[packedRowIndex], localHeight,
-              &B[rowIndex],              BLDim );
+            InterleaveMatrix
+            ( thisBlockHeight, width,
+              &APortion[packedRowIndex], 1, localHeight,
+              &B[rowIndex],              1, BLDim );
 
             blockRow += colStride;
             rowIndex += thisBlockHeight + (colStride-1)*blockHeight;
@@ -230,10 +308,10 @@ void RowStridedPack
     {
         const Int rowShift = Shift_( k, rowAlign, rowStride );
         const Int localWidth = Length_( width, rowShift, rowStride );
-        lapack::Copy
-        ( 'F', height, localWidth,
-          &A[rowShift*ALDim],        rowStride*ALDim,
-          &BPortions[k*portionSize], height );
+        InterleaveMatrix
+        ( height, localWidth,
+          &A[rowShift*ALDim],        1, rowStride*ALDim,
+          &BPortions[k*portionSize], 1, height );
     }
 }
 
@@ -248,10 +326,10 @@ void RowStridedUnpack
     {
         const Int rowShift = Shift_( k, rowAlign, rowStride );
         const Int localWidth = Length_( width, rowShift, rowStride );
-        lapack::Copy
-        ( 'F', height, localWidth,
-          &APortions[k*portionSize], height,
-          &B[rowShift*BLDim],        rowStride*BLDim );
+        InterleaveMatrix
+        ( height, localWidth,
+          &APortions[k*portionSize], 1, height,
+          &B[rowShift*BLDim],        1, rowStride*BLDim );
     }
 }
 
@@ -281,10 +359,10 @@ void BlockedRowStridedUnpack
                 firstBlockWidth :
                 Min(blockWidth,width-colIndex) );
 
-            lapack::Copy
-            ( 'F', height, thisBlockWidth,
-              &APortion[packedColIndex*height], height,
-              &B[colIndex*BLDim],               BLDim );
+            InterleaveMatrix
+            ( height, thisBlockWidth,
+              &APortion[packedColIndex*height], 1, height,
+              &B[colIndex*BLDim],               1, BLDim );
 
             blockCol += rowStride;
             colIndex += thisBlockWidth + (rowStride-1)*blockWidth;
@@ -317,10 +395,10 @@ void BlockedRowFilter
             firstBlockWidth :
             Min(blockWidth,width-colIndex) );
 
-        lapack::Copy
-        ( 'F', height, thisBlockWidth,
-          &A[colIndex      *ALDim], ALDim,
-          &B[packedColIndex*BLDim], BLDim );
+        InterleaveMatrix
+        ( height, thisBlockWidth,
+          &A[colIndex      *ALDim], 1, ALDim,
+          &B[packedColIndex*BLDim], 1, BLDim );
 
         blockCol += rowStride;
         colIndex += thisBlockWidth + (rowStride-1)*blockWidth;
@@ -352,10 +430,10 @@ void BlockedColFilter
             firstBlockHeight :
             Min(blockHeight,height-rowIndex) );
 
-        lapack::Copy
-        ( 'F', thisBlockHeight, width,
-          &A[rowIndex],       ALDim,
-          &B[packedRowIndex], BLDim );
+        InterleaveMatrix
+        ( thisBlockHeight, width,
+          &A[rowIndex],       1, ALDim,
+          &B[packedRowIndex], 1, BLDim );
 
         blockRow += colStride;
         rowIndex += thisBlockHeight + (colStride-1)*blockHeight;
@@ -378,10 +456,10 @@ void PartialRowStridedPack
             Shift_( rowRankPart+k*rowStridePart, rowAlign, rowStride );
         const Int rowOffset = (rowShift-rowShiftA) / rowStridePart;
         const Int localWidth = Length_( width, rowShift, rowStride );
-        lapack::Copy
-        ( 'F', height, localWidth,
-          &A[rowOffset*ALDim],       rowStrideUnion*ALDim,
-          &BPortions[k*portionSize], height );
+        InterleaveMatrix
+        ( height, localWidth,
+          &A[rowOffset*ALDim],       1, rowStrideUnion*ALDim,
+          &BPortions[k*portionSize], 1, height );
     }
 }
 template<typename T>
@@ -399,10 +477,10 @@ void PartialRowStridedUnpack
             Shift_( rowRankPart+k*rowStridePart, rowAlign, rowStride );
         const Int rowOffset = (rowShift-rowShiftB) / rowStridePart;
         const Int localWidth = Length_( width, rowShift, rowStride );
-        lapack::Copy
-        ( 'F', height, localWidth,
-          &APortions[k*portionSize], height,
-          &B[rowOffset*BLDim],       rowStrideUnion*BLDim );
+        InterleaveMatrix
+        ( height, localWidth,
+          &APortions[k*portionSize], 1, height,
+          &B[rowOffset*BLDim],       1, rowStrideUnion*BLDim );
     }
 }
 
@@ -0,0 +1,177 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_BLAS_COPYASYNC_HPP
+#define EL_BLAS_COPYASYNC_HPP
+
+namespace El {
+
+template<typename T>
+CopyRequest<T>::~CopyRequest()
+{
+    if( active_ )
+    {
+        try { Wait(); }
+        catch( std::exception& e ) { ReportException(e); }
+    }
+}
+
+template<typename T>
+bool CopyRequest<T>::Test()
+{
+    EL_DEBUG_CSE
+    if( !active_ )
+        return true;
+    if( !mpi::Test( request_ ) )
+        return false;
+    Finish();
+    return true;
+}
+
+template<typename T>
+void CopyRequest<T>::Wait()
+{
+    EL_DEBUG_CSE
+    if( !active_ )
+        return;
+    mpi::Wait( request_ );
+    Finish();
+}
+
+template<typename T>
+void CopyRequest<T>::Finish()
+{
+    EL_DEBUG_CSE
+    unpack_();
+    unpack_ = nullptr;
+    active_ = false;
+}
+
+namespace copy {
+
+// (U,V) |-> (U,Collect(V)), where only the aligned case with a nontrivial
+// row team is performed asynchronously
+template<typename T>
+void RowAllGatherAsync
+( const ElementalMatrix<T>& A, ElementalMatrix<T>& B, CopyRequest<T>& req )
+{
+    EL_DEBUG_CSE
+    const Int height = A.Height();
+    const Int width = A.Width();
+    B.AlignColsAndResize( A.ColAlign(), height, width, false, false );
+    if( !A.Participating() || B.ColAlign() != A.ColAlign() ||
+        A.RowStride() == 1 || width == 1 )
+    {
+        RowAllGather( A, B );
+        return;
+    }
+
+    const Int rowStride = A.RowStride();
+    const Int rowAlign = A.RowAlign();
+    const Int localHeight = A.LocalHeight();
+    const Int maxLocalWidth = MaxLength(width,rowStride);
+    const Int portionSize = mpi::Pad( localHeight*maxLocalWidth );
+    req.buffer_.Require( (rowStride+1)*portionSize );
+    T* sendBuf = req.buffer_.Buffer();
+    T* recvBuf = req.buffer_.Buffer()+portionSize;
+
+    // Pack
+    util::InterleaveMatrix
+    ( localHeight, A.LocalWidth(),
+      A.LockedBuffer(), 1, A.LDim(),
+      sendBuf,          1, localHeight );
+
+    // Start communicating
+    mpi::IAllGather
+    ( sendBuf, portionSize, recvBuf, portionSize, A.RowComm(),
+      req.request_ );
+
+    // Defer the unpack until the request completes
+    T* BBuf = B.Buffer();
+    const Int BLDim = B.LDim();
+    req.unpack_ =
+      [=]()
+      { util::RowStridedUnpack
+        ( localHeight, width, rowAlign, rowStride,
+          recvBuf, portionSize, BBuf, BLDim ); };
+    req.active_ = true;
+}
+
+// (U,V) |-> (Collect(U),V), where only the aligned case with a nontrivial
+// column team is performed asynchronously
+template<typename T>
+void ColAllGatherAsync
+( const ElementalMatrix<T>& A, ElementalMatrix<T>& B, CopyRequest<T>& req )
+{
+    EL_DEBUG_CSE
+    const Int height = A.Height();
+    const Int width = A.Width();
+    B.AlignRowsAndResize( A.RowAlign(), height, width, false, false );
+    if( !A.Participating() || B.RowAlign() != A.RowAlign() ||
+        A.ColStride() == 1 || height == 1 )
+    {
+        ColAllGather( A, B );
+        return;
+    }
+
+    const Int colStride = A.ColStride();
+    const Int colAlign = A.ColAlign();
+    const Int localWidth = A.LocalWidth();
+    const Int maxLocalHeight = MaxLength(height,colStride);
+    const Int portionSize = mpi::Pad( maxLocalHeight*localWidth );
+    req.buffer_.Require( (colStride+1)*portionSize );
+    T* sendBuf = req.buffer_.Buffer();
+    T* recvBuf = req.buffer_.Buffer()+portionSize;
+
+    // Pack
+    util::InterleaveMatrix
+    ( A.LocalHeight(), localWidth,
+      A.LockedBuffer(), 1, A.LDim(),
+      sendBuf,          1, A.LocalHeight() );
+
+    // Start communicating
+    mpi::IAllGather
+    ( sendBuf, portionSize, recvBuf, portionSize, A.ColComm(),
+      req.request_ );
+
+    // Defer the unpack until the request completes
+    T* BBuf = B.Buffer();
+    const Int BLDim = B.LDim();
+    req.unpack_ =
+      [=]()
+      { util::ColStridedUnpack
+        ( height, localWidth, colAlign, colStride,
+          recvBuf, portionSize, BBuf, BLDim ); };
+    req.active_ = true;
+}
+
+} // namespace copy
+
+template<typename T>
+void CopyAsync
+( const ElementalMatrix<T>& A, ElementalMatrix<T>& B, CopyRequest<T>& req )
+{
+    EL_DEBUG_CSE
+    if( req.Active() )
+        LogicError("Cannot reuse a CopyRequest which is still active");
+
+    const Dist UA = A.ColDist(), VA = A.RowDist();
+    const Dist UB = B.ColDist(), VB = B.RowDist();
+    const bool sameGrid = A.Grid() == B.Grid();
+    const bool noCross = A.CrossComm() == mpi::COMM_SELF;
+    if( sameGrid && noCross && UA == UB && VA != VB && Collect(VA) == VB )
+        copy::RowAllGatherAsync( A, B, req );
+    else if( sameGrid && noCross && VA == VB && UA != UB && Collect(UA) == UB )
+        copy::ColAllGatherAsync( A, B, req );
+    else
+        Copy( A, B );
+}
+
+} // namespace El
+
+#endif // ifndef EL_BLAS_COPYASYNC_HPP
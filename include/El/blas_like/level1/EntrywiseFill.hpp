@@ -11,24 +11,43 @@
 
 namespace El {
 
-template<typename T>
-void EntrywiseFill( Matrix<T>& A, function<T(void)> func )
+// The fills accept arbitrary callables so that they may be inlined; the
+// std::function overloads are explicitly instantiated for the C interface.
+// NOTE: Since the generators are typically stateful (e.g., random samplers),
+//       the entries are filled sequentially in column-major order.
+
+template<typename T,typename Function>
+void EntrywiseFill( Matrix<T>& A, Function func )
 {
     EL_DEBUG_CSE
     const Int m = A.Height();
     const Int n = A.Width();
+    T* ABuf = A.Buffer();
+    const Int ALDim = A.LDim();
     for( Int j=0; j<n; ++j )
         for( Int i=0; i<m; ++i )
-            A(i,j) = func();
+            ABuf[i+j*ALDim] = func();
 }
 
+template<typename T,typename Function>
+void EntrywiseFill( AbstractDistMatrix<T>& A, Function func )
+{ EntrywiseFill( A.Matrix(), func ); }
+
+template<typename T,typename Function>
+void EntrywiseFill( DistMultiVec<T>& A, Function func )
+{ EntrywiseFill( A.Matrix(), func ); }
+
+template<typename T>
+void EntrywiseFill( Matrix<T>& A, function<T(void)> func )
+{ EntrywiseFill<T,function<T(void)>>( A, func ); }
+
 template<typename T>
 void EntrywiseFill( AbstractDistMatrix<T>& A, function<T(void)> func )
-{ EntrywiseFill( A.Matrix(), func ); }
+{ EntrywiseFill<T,function<T(void)>>( A, func ); }
 
 template<typename T>
 void EntrywiseFill( DistMultiVec<T>& A, function<T(void)> func )
-{ EntrywiseFill( A.Matrix(), func ); }
+{ EntrywiseFill<T,function<T(void)>>( A, func ); }
 
 #ifdef EL_INSTANTIATE_BLAS_LEVEL1
 # define EL_EXTERN
@@ -11,8 +11,12 @@
 
 namespace El {
 
-template<typename T>
-void EntrywiseMap( Matrix<T>& A, function<T(const T&)> func )
+// The maps accept arbitrary callables so that they may be inlined into the
+// (threaded and vectorizable) traversals; the std::function overloads, which
+// are explicitly instantiated for the C interface, forward to them.
+
+template<typename T,typename Function>
+void EntrywiseMap( Matrix<T>& A, Function func )
 {
     EL_DEBUG_CSE
     const Int m = A.Height();
@@ -24,7 +28,7 @@ void EntrywiseMap( Matrix<T>& A, function<T(const T&)> func )
     // iterate over double loop.
     if( ALDim == m )
     {
-        EL_PARALLEL_FOR
+        EL_PARALLEL_FOR_IF(ParallelizeLoop(m*n))
         for( Int i=0; i<m*n; ++i )
         {
             ABuf[i] = func(ABuf[i]);
@@ -32,7 +36,7 @@ void EntrywiseMap( Matrix<T>& A, function<T(const T&)> func )
     }
     else
     {
-        EL_PARALLEL_FOR
+        EL_PARALLEL_FOR_IF(ParallelizeLoop(m*n))
         for( Int j=0; j<n; ++j )
         {
             EL_SIMD
@@ -44,39 +48,39 @@ void EntrywiseMap( Matrix<T>& A, function<T(const T&)> func )
     }
 }
 
-template<typename T>
-void EntrywiseMap( SparseMatrix<T>& A, function<T(const T&)> func )
+template<typename T,typename Function>
+void EntrywiseMap( SparseMatrix<T>& A, Function func )
 {
     EL_DEBUG_CSE
     T* vBuf = A.ValueBuffer();
     const Int numEntries = A.NumEntries();
-    EL_PARALLEL_FOR
+    EL_PARALLEL_FOR_IF(ParallelizeLoop(numEntries))
     for( Int k=0; k<numEntries; ++k )
         vBuf[k] = func(vBuf[k]);
 }
 
-template<typename T>
-void EntrywiseMap( AbstractDistMatrix<T>& A, function<T(const T&)> func )
+template<typename T,typename Function>
+void EntrywiseMap( AbstractDistMatrix<T>& A, Function func )
 { EntrywiseMap( A.Matrix(), func ); }
 
-template<typename T>
-void EntrywiseMap( DistSparseMatrix<T>& A, function<T(const T&)> func )
+template<typename T,typename Function>
+void EntrywiseMap( DistSparseMatrix<T>& A, Function func )
 {
     EL_DEBUG_CSE
     T* vBuf = A.ValueBuffer();
     const Int numLocalEntries = A.NumLocalEntries();
-    EL_PARALLEL_FOR
+    EL_PARALLEL_FOR_IF(ParallelizeLoop(numLocalEntries))
     for( Int k=0; k<numLocalEntries; ++k )
         vBuf[k] = func(vBuf[k]);
 }
 
-template<typename T>
-void EntrywiseMap( DistMultiVec<T>& A, function<T(const T&)> func )
+template<typename T,typename Function>
+void EntrywiseMap( DistMultiVec<T>& A, Function func )
 { EntrywiseMap( A.Matrix(), func ); }
 
-template<typename S,typename T>
+template<typename S,typename T,typename Function>
 void EntrywiseMap
-( const Matrix<S>& A, Matrix<T>& B, function<T(const S&)> func )
+( const Matrix<S>& A, Matrix<T>& B, Function func )
 {
     EL_DEBUG_CSE
     const Int m = A.Height();
@@ -86,7 +90,7 @@ void EntrywiseMap
     T* BBuf = B.Buffer();
     const Int ALDim = A.LDim();
     const Int BLDim = B.LDim();
-    EL_PARALLEL_FOR
+    EL_PARALLEL_FOR_IF(ParallelizeLoop(m*n))
     for( Int j=0; j<n; ++j )
     {
         EL_SIMD
@@ -97,11 +101,11 @@ void EntrywiseMap
     }
 }
 
-template<typename S,typename T>
+template<typename S,typename T,typename Function>
 void EntrywiseMap
 ( const SparseMatrix<S>& A,
         SparseMatrix<T>& B,
-        function<T(const S&)> func )
+        Function func )
 {
     EL_DEBUG_CSE
     const Int numEntries = A.NumEntries();
@@ -109,16 +113,16 @@ void EntrywiseMap
     B.Graph() = A.LockedGraph();
     const S* AValBuf = A.LockedValueBuffer();
     T* BValBuf = B.ValueBuffer();
-    EL_PARALLEL_FOR
+    EL_PARALLEL_FOR_IF(ParallelizeLoop(numEntries))
     for( Int k=0; k<numEntries; ++k )
         BValBuf[k] = func(AValBuf[k]);
 }
 
-template<typename S,typename T>
+template<typename S,typename T,typename Function>
 void EntrywiseMap
 ( const AbstractDistMatrix<S>& A,
         AbstractDistMatrix<T>& B,
-        function<T(const S&)> func )
+        Function func )
 {
     if( A.DistData().colDist == B.DistData().colDist &&
         A.DistData().rowDist == B.DistData().rowDist &&
@@ -145,11 +149,11 @@ void EntrywiseMap
     }
 }
 
-template<typename S,typename T>
+template<typename S,typename T,typename Function>
 void EntrywiseMap
 ( const DistSparseMatrix<S>& A,
         DistSparseMatrix<T>& B,
-        function<T(const S&)> func )
+        Function func )
 {
     EL_DEBUG_CSE
     const Int numLocalEntries = A.NumLocalEntries();
@@ -158,16 +162,16 @@ void EntrywiseMap
 
     const S* AValBuf = A.LockedValueBuffer();
     T* BValBuf = B.ValueBuffer();
-    EL_PARALLEL_FOR
+    EL_PARALLEL_FOR_IF(ParallelizeLoop(numLocalEntries))
     for( Int k=0; k<numLocalEntries; ++k )
         BValBuf[k] = func(AValBuf[k]);
 }
 
-template<typename S,typename T>
+template<typename S,typename T,typename Function>
 void EntrywiseMap
 ( const DistMultiVec<S>& A,
         DistMultiVec<T>& B,
-        function<T(const S&)> func )
+        Function func )
 {
     EL_DEBUG_CSE
     B.SetGrid( A.Grid() );
@@ -175,6 +179,59 @@ void EntrywiseMap
     EntrywiseMap( A.LockedMatrix(), B.Matrix(), func );
 }
 
+template<typename T>
+void EntrywiseMap( Matrix<T>& A, function<T(const T&)> func )
+{ EntrywiseMap<T,function<T(const T&)>>( A, func ); }
+
+template<typename T>
+void EntrywiseMap( SparseMatrix<T>& A, function<T(const T&)> func )
+{ EntrywiseMap<T,function<T(const T&)>>( A, func ); }
+
+template<typename T>
+void EntrywiseMap( AbstractDistMatrix<T>& A, function<T(const T&)> func )
+{ EntrywiseMap<T,function<T(const T&)>>( A, func ); }
+
+template<typename T>
+void EntrywiseMap( DistSparseMatrix<T>& A, function<T(const T&)> func )
+{ EntrywiseMap<T,function<T(const T&)>>( A, func ); }
+
+template<typename T>
+void EntrywiseMap( DistMultiVec<T>& A, function<T(const T&)> func )
+{ EntrywiseMap<T,function<T(const T&)>>( A, func ); }
+
+template<typename S,typename T>
+void EntrywiseMap
+( const Matrix<S>& A, Matrix<T>& B, function<T(const S&)> func )
+{ EntrywiseMap<S,T,function<T(const S&)>>( A, B, func ); }
+
+template<typename S,typename T>
+void EntrywiseMap
+( const SparseMatrix<S>& A,
+        SparseMatrix<T>& B,
+        function<T(const S&)> func )
+{ EntrywiseMap<S,T,function<T(const S&)>>( A, B, func ); }
+
+template<typename S,typename T>
+void EntrywiseMap
+( const AbstractDistMatrix<S>& A,
+        AbstractDistMatrix<T>& B,
+        function<T(const S&)> func )
+{ EntrywiseMap<S,T,function<T(const S&)>>( A, B, func ); }
+
+template<typename S,typename T>
+void EntrywiseMap
+( const DistSparseMatrix<S>& A,
+        DistSparseMatrix<T>& B,
+        function<T(const S&)> func )
+{ EntrywiseMap<S,T,function<T(const S&)>>( A, B, func ); }
+
+template<typename S,typename T>
+void EntrywiseMap
+( const DistMultiVec<S>& A,
+        DistMultiVec<T>& B,
+        function<T(const S&)> func )
+{ EntrywiseMap<S,T,function<T(const S&)>>( A, B, func ); }
+
 #ifdef EL_INSTANTIATE_BLAS_LEVEL1
 # define EL_EXTERN
 #else
@@ -31,6 +31,21 @@ void FillDiagonal( AbstractDistMatrix<T>& A, T alpha, Int offset )
     EL_DEBUG_CSE
     const Int height = A.Height();
     const Int localWidth = A.LocalWidth();
+    if( A.Wrap() == ELEMENT )
+    {
+        const StridedIndexMap rowMap( A.ColShift(), A.ColStride() );
+        const StridedIndexMap colMap( A.RowShift(), A.RowStride() );
+        T* buffer = A.Buffer();
+        const Int ldim = A.LDim();
+        EL_PARALLEL_FOR
+        for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+        {
+            const Int i = colMap.Global(jLoc)-offset;
+            if( i >= 0 && i < height && rowMap.IsLocal(i) )
+                buffer[rowMap.Local(i)+jLoc*ldim] = alpha;
+        }
+        return;
+    }
     EL_PARALLEL_FOR
     for( Int jLoc=0; jLoc<localWidth; ++jLoc )
     {
@@ -0,0 +1,125 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_BLAS_FIXEDSIZE_HPP
+#define EL_BLAS_FIXEDSIZE_HPP
+
+namespace El {
+
+// Kernels for FixedMatrix operands, which are intended to be inlined into
+// the inner loops of their callers and therefore avoid the call stack
+
+template<typename T,Int N>
+inline void
+MakeSymmetric( UpperOrLower uplo, FixedMatrix<T,N,N>& A, bool conjugate )
+{
+    if( conjugate )
+        for( Int j=0; j<N; ++j )
+            A(j,j) = RealPart(A(j,j));
+    for( Int j=0; j<N; ++j )
+    {
+        for( Int i=j+1; i<N; ++i )
+        {
+            // Copy the (i,j) entry of the stored triangle into entry (j,i)
+            // for the lower case, and vice versa
+            const T& source = ( uplo == LOWER ? A(i,j) : A(j,i) );
+            T& target = ( uplo == LOWER ? A(j,i) : A(i,j) );
+            target = ( conjugate ? Conj(source) : source );
+        }
+    }
+}
+
+template<typename Field>
+inline void
+Symmetric2x2Inv
+( UpperOrLower uplo, FixedMatrix<Field,2,2>& D, bool conjugate )
+{
+    typedef Base<Field> Real;
+    if( uplo != LOWER )
+        LogicError("This option not yet supported");
+    if( conjugate )
+    {
+        const Real delta11 = RealPart(D(0,0));
+        const Field delta21 = D(1,0);
+        const Real delta22 = RealPart(D(1,1));
+        const Real delta21Abs = SafeAbs( delta21 );
+        const Real phi21To11 = delta22 / delta21Abs;
+        const Real phi21To22 = delta11 / delta21Abs;
+        const Field phi21 = delta21 / delta21Abs;
+        const Real xi = (Real(1)/(phi21To11*phi21To22-Real(1)))/delta21Abs;
+
+        D(0,0) = xi*phi21To11;
+        D(1,0) = -xi*phi21;
+        D(0,1) = Conj(D(1,0));
+        D(1,1) = xi*phi21To22;
+    }
+    else
+    {
+        const Field delta11 = D(0,0);
+        const Field delta21 = D(1,0);
+        const Field delta22 = D(1,1);
+        const Field chi21To11 = -delta22 / delta21;
+        const Field chi21To22 = -delta11 / delta21;
+        const Field chi21 =
+          (Field(1)/(Field(1)-chi21To11*chi21To22))/delta21;
+
+        D(0,0) = chi21*chi21To11;
+        D(1,0) = chi21;
+        D(0,1) = chi21;
+        D(1,1) = chi21*chi21To22;
+    }
+}
+
+template<typename T>
+inline void
+Transform2x2Rows
+( const FixedMatrix<T,2,2>& G,
+        Matrix<T>& A, Int i1, Int i2 )
+{
+    const T gamma11 = G(0,0);
+    const T gamma12 = G(0,1);
+    const T gamma21 = G(1,0);
+    const T gamma22 = G(1,1);
+    const Int n = A.Width();
+    const Int ALDim = A.LDim();
+    T* a1 = A.Buffer(i1,0);
+    T* a2 = A.Buffer(i2,0);
+    for( Int j=0; j<n; ++j )
+    {
+        const T alpha1 = a1[j*ALDim];
+        const T alpha2 = a2[j*ALDim];
+        a1[j*ALDim] = gamma11*alpha1 + gamma12*alpha2;
+        a2[j*ALDim] = gamma21*alpha1 + gamma22*alpha2;
+    }
+}
+
+template<typename T>
+inline void
+Transform2x2Cols
+( const FixedMatrix<T,2,2>& G,
+        Matrix<T>& A, Int j1, Int j2 )
+{
+    const T gamma11 = G(0,0);
+    const T gamma12 = G(0,1);
+    const T gamma21 = G(1,0);
+    const T gamma22 = G(1,1);
+    const Int m = A.Height();
+    T* a1 = A.Buffer(0,j1);
+    T* a2 = A.Buffer(0,j2);
+    for( Int i=0; i<m; ++i )
+    {
+        const T alpha1 = a1[i];
+        const T alpha2 = a2[i];
+        a1[i] = gamma11*alpha1 + gamma21*alpha2;
+        a2[i] = gamma12*alpha1 + gamma22*alpha2;
+    }
+}
+
+} // namespace El
+
+#endif // ifndef EL_BLAS_FIXEDSIZE_HPP
@@ -13,6 +13,27 @@
 
 namespace El {
 
+namespace hadamard {
+
+template<typename T>
+inline T Product( const T& alpha, const T& beta )
+{ return alpha*beta; }
+
+// Expand the complex product into real arithmetic so that the loops below
+// vectorize rather than calling into the (Annex G) complex multiply
+template<typename Real>
+inline Complex<Real>
+Product( const Complex<Real>& alpha, const Complex<Real>& beta )
+{
+    const Real alphaReal = RealPart(alpha), alphaImag = ImagPart(alpha);
+    const Real betaReal = RealPart(beta), betaImag = ImagPart(beta);
+    return Complex<Real>
+      ( alphaReal*betaReal - alphaImag*betaImag,
+        alphaReal*betaImag + alphaImag*betaReal );
+}
+
+} // namespace hadamard
+
 template<typename T>
 void Hadamard( const Matrix<T>& A, const Matrix<T>& B, Matrix<T>& C )
 {
@@ -37,32 +58,33 @@ void Hadamard( const Matrix<T>& A, const Matrix<T>& B, Matrix<T>& C )
         // Check if output matrix is equal to either input matrix
         if( CBuf == BBuf )
         {
-            EL_PARALLEL_FOR
+            EL_PARALLEL_FOR_IF(ParallelizeLoop(height*width))
             for( Int i=0; i<height*width; ++i )
-                CBuf[i] *= ABuf[i];
+                CBuf[i] = hadamard::Product( CBuf[i], ABuf[i] );
         }
         else if( CBuf == ABuf )
         {
-            EL_PARALLEL_FOR
+            EL_PARALLEL_FOR_IF(ParallelizeLoop(height*width))
             for( Int i=0; i<height*width; ++i )
-                CBuf[i] *= BBuf[i];
+                CBuf[i] = hadamard::Product( CBuf[i], BBuf[i] );
         }
         else
         {
-            EL_PARALLEL_FOR
+            EL_PARALLEL_FOR_IF(ParallelizeLoop(height*width))
             for( Int i=0; i<height*width; ++i )
-                CBuf[i] = ABuf[i] * BBuf[i];
+                CBuf[i] = hadamard::Product( ABuf[i], BBuf[i] );
         }
     }
     else
     {
-        EL_PARALLEL_FOR
+        EL_PARALLEL_FOR_IF(ParallelizeLoop(height*width))
         for( Int j=0; j<width; ++j )
         {
             EL_SIMD
             for( Int i=0; i<height; ++i )
             {
-                CBuf[i+j*CLDim] = ABuf[i+j*ALDim] * BBuf[i+j*BLDim];
+                CBuf[i+j*CLDim] =
+                  hadamard::Product( ABuf[i+j*ALDim], BBuf[i+j*BLDim] );
             }
         }
     }
@@ -11,8 +11,12 @@
 
 namespace El {
 
-template<typename T>
-void IndexDependentFill( Matrix<T>& A, function<T(Int,Int)> func )
+// The fills accept arbitrary callables so that they may be inlined into the
+// (threaded and vectorizable) traversals; the std::function overloads, which
+// are explicitly instantiated for the C interface, forward to them.
+
+template<typename T,typename Function>
+void IndexDependentFill( Matrix<T>& A, Function func )
 {
     EL_DEBUG_CSE
     const Int m = A.Height();
@@ -24,7 +28,7 @@ void IndexDependentFill( Matrix<T>& A, function<T(Int,Int)> func )
     // use column-wise parallelization.
     if( n == 1 )
     {
-        EL_PARALLEL_FOR
+        EL_PARALLEL_FOR_IF(ParallelizeLoop(m))
         for( Int i=0; i<m; ++i )
         {
             ABuf[i] = func(i,0);
@@ -32,22 +36,22 @@ void IndexDependentFill( Matrix<T>& A, function<T(Int,Int)> func )
     }
     else
     {
-        EL_PARALLEL_FOR
+        EL_PARALLEL_FOR_IF(ParallelizeLoop(m*n))
         for( Int j=0; j<n; ++j )
         {
+            T* ACol = &ABuf[j*ALDim];
             EL_SIMD
             for( Int i=0; i<m; ++i )
             {
-                ABuf[i+j*ALDim] = func(i,j);
+                ACol[i] = func(i,j);
             }
         }
     }
 
 }
 
-template<typename T>
-void IndexDependentFill
-( AbstractDistMatrix<T>& A, function<T(Int,Int)> func )
+template<typename T,typename Function>
+void IndexDependentFill( AbstractDistMatrix<T>& A, Function func )
 {
     EL_DEBUG_CSE
     const Int mLoc = A.LocalHeight();
@@ -55,35 +59,50 @@ void IndexDependentFill
     T* ALocBuf = A.Buffer();
     const Int ALocLDim = A.LDim();
 
+    // Precompute the global row indices so that the inner loops are free of
+    // distribution logic
+    vector<Int> globalRows( mLoc );
+    for( Int iLoc=0; iLoc<mLoc; ++iLoc )
+        globalRows[iLoc] = A.GlobalRow(iLoc);
+    const Int* globalRowBuf = globalRows.data();
+
     // Use entry-wise parallelization for column vectors. Otherwise
     // use column-wise parallelization.
     if( nLoc == 1 )
     {
-        EL_PARALLEL_FOR
+        const Int j = A.GlobalCol(0);
+        EL_PARALLEL_FOR_IF(ParallelizeLoop(mLoc))
         for( Int iLoc=0; iLoc<mLoc; ++iLoc )
         {
-            const Int i = A.GlobalRow(iLoc);
-            const Int j = A.GlobalCol(0);
-            ALocBuf[iLoc] = func(i,j);
+            ALocBuf[iLoc] = func(globalRowBuf[iLoc],j);
         }
     }
     else
     {
-        EL_PARALLEL_FOR
+        EL_PARALLEL_FOR_IF(ParallelizeLoop(mLoc*nLoc))
         for( Int jLoc=0; jLoc<nLoc; ++jLoc )
         {
+            const Int j = A.GlobalCol(jLoc);
+            T* ALocCol = &ALocBuf[jLoc*ALocLDim];
             EL_SIMD
             for( Int iLoc=0; iLoc<mLoc; ++iLoc )
             {
-                const Int i = A.GlobalRow(iLoc);
-                const Int j = A.GlobalCol(jLoc);
-                ALocBuf[iLoc+jLoc*ALocLDim] = func(i,j);
+                ALocCol[iLoc] = func(globalRowBuf[iLoc],j);
             }
         }
     }
 
 }
 
+template<typename T>
+void IndexDependentFill( Matrix<T>& A, function<T(Int,Int)> func )
+{ IndexDependentFill<T,function<T(Int,Int)>>( A, func ); }
+
+template<typename T>
+void IndexDependentFill
+( AbstractDistMatrix<T>& A, function<T(Int,Int)> func )
+{ IndexDependentFill<T,function<T(Int,Int)>>( A, func ); }
+
 #ifdef EL_INSTANTIATE_BLAS_LEVEL1
 # define EL_EXTERN
 #else
@@ -11,172 +11,163 @@
 
 namespace El {
 
-template<typename T>
-void IndexDependentMap( Matrix<T>& A, function<T(Int,Int,const T&)> func )
-{
-    EL_DEBUG_CSE
-    const Int m = A.Height();
-    const Int n = A.Width();
-    T* ABuf = A.Buffer();
-    const Int ALDim = A.LDim();
-
-    // Use entry-wise parallelization for column vectors. Otherwise
-    // use column-wise parallelization.
-    if( n == 1 )
-    {
-        EL_PARALLEL_FOR
-        for( Int i=0; i<m; ++i )
-        {
-            ABuf[i] = func(i,0,ABuf[i]);
-        }
-    }
-    else
-    {
-        EL_PARALLEL_FOR
-        for( Int j=0; j<n; ++j )
-        {
-            EL_SIMD
-            for( Int i=0; i<m; ++i )
-            {
-                ABuf[i+j*ALDim] = func(i,j,ABuf[i+j*ALDim]);
-            }
-        }
-    }
+// The maps accept arbitrary callables so that they may be inlined into the
+// (threaded and vectorizable) traversals; the std::function overloads, which
+// are explicitly instantiated for the C interface, forward to them.
 
-}
+namespace index_dependent_map {
 
-template<typename T>
-void IndexDependentMap
-( AbstractDistMatrix<T>& A, function<T(Int,Int,const T&)> func )
+// Overwrite the local entries of B with func(i,j,A(i,j)), where the local
+// row and column indices are mapped to global ones through 'globalRow' and
+// 'globalCol'
+template<typename S,typename T,typename Function,
+         typename GlobalRow,typename GlobalCol>
+void LocalMap
+( Int mLoc, Int nLoc,
+  const S* ABuf, Int ALDim,
+        T* BBuf, Int BLDim,
+  GlobalRow globalRow, GlobalCol globalCol,
+  Function& func )
 {
-    EL_DEBUG_CSE
-    const Int mLoc = A.LocalHeight();
-    const Int nLoc = A.LocalWidth();
-    T* ALocBuf = A.Buffer();
-    const Int ALocLDim = A.LDim();
-
     // Use entry-wise parallelization for column vectors. Otherwise
     // use column-wise parallelization.
     if( nLoc == 1 )
     {
-        EL_PARALLEL_FOR
+        const Int j = globalCol(0);
+        EL_PARALLEL_FOR_IF(ParallelizeLoop(mLoc))
         for( Int iLoc=0; iLoc<mLoc; ++iLoc )
         {
-            const Int i = A.GlobalRow(iLoc);
-            const Int j = A.GlobalCol(0);
-            ALocBuf[iLoc] = func(i,j,ALocBuf[iLoc]);
+            BBuf[iLoc] = func(globalRow(iLoc),j,ABuf[iLoc]);
         }
     }
     else
     {
-        EL_PARALLEL_FOR
+        EL_PARALLEL_FOR_IF(ParallelizeLoop(mLoc*nLoc))
         for( Int jLoc=0; jLoc<nLoc; ++jLoc )
         {
+            const Int j = globalCol(jLoc);
+            const S* ACol = &ABuf[jLoc*ALDim];
+                  T* BCol = &BBuf[jLoc*BLDim];
             EL_SIMD
             for( Int iLoc=0; iLoc<mLoc; ++iLoc )
             {
-                const Int i = A.GlobalRow(iLoc);
-                const Int j = A.GlobalCol(jLoc);
-                ALocBuf[iLoc+jLoc*ALocLDim] = func(i,j,ALocBuf[iLoc+jLoc*ALocLDim]);
+                BCol[iLoc] = func(globalRow(iLoc),j,ACol[iLoc]);
             }
         }
     }
+}
 
+template<typename T>
+vector<Int> GlobalRows( const AbstractDistMatrix<T>& A )
+{
+    const Int mLoc = A.LocalHeight();
+    vector<Int> globalRows( mLoc );
+    for( Int iLoc=0; iLoc<mLoc; ++iLoc )
+        globalRows[iLoc] = A.GlobalRow(iLoc);
+    return globalRows;
 }
 
-template<typename S,typename T>
-void IndexDependentMap
-( const Matrix<S>& A, Matrix<T>& B, function<T(Int,Int,const S&)> func )
+} // namespace index_dependent_map
+
+template<typename T,typename Function>
+void IndexDependentMap( Matrix<T>& A, Function func )
 {
     EL_DEBUG_CSE
     const Int m = A.Height();
     const Int n = A.Width();
-    B.Resize( m, n );
-    const T* ABuf = A.LockedBuffer();
-    T* BBuf = B.Buffer();
-    const Int ALDim = A.LDim();
-    const Int BLDim = B.LDim();
+    auto identity = []( Int i ) { return i; };
+    index_dependent_map::LocalMap
+    ( m, n, A.LockedBuffer(), A.LDim(), A.Buffer(), A.LDim(),
+      identity, identity, func );
+}
 
-    // Use entry-wise parallelization for column vectors. Otherwise
-    // use column-wise parallelization.
-    if( n == 1 )
+template<typename T,typename Function>
+void IndexDependentMap( AbstractDistMatrix<T>& A, Function func )
+{
+    EL_DEBUG_CSE
+    if( A.Wrap() == ELEMENT )
     {
-        EL_PARALLEL_FOR
-        for( Int i=0; i<m; ++i )
+        const StridedIndexMap colMap( A.RowShift(), A.RowStride() );
+        auto globalCol = [&]( Int jLoc ) { return colMap.Global(jLoc); };
+        if( A.ColDist() == STAR )
         {
-            BBuf[i] = func(i,0,ABuf[i]);
+            const IdentityIndexMap rowMap;
+            index_dependent_map::LocalMap
+            ( A.LocalHeight(), A.LocalWidth(),
+              A.LockedBuffer(), A.LDim(), A.Buffer(), A.LDim(),
+              [&]( Int iLoc ) { return rowMap.Global(iLoc); },
+              globalCol, func );
         }
-    }
-    else
-    {
-        EL_PARALLEL_FOR
-        for( Int j=0; j<n; ++j )
+        else
         {
-            EL_SIMD
-            for( Int i=0; i<m; ++i )
-            {
-                BBuf[i+j*BLDim] = func(i,j,ABuf[i+j*ALDim]);
-            }
+            const StridedIndexMap rowMap( A.ColShift(), A.ColStride() );
+            index_dependent_map::LocalMap
+            ( A.LocalHeight(), A.LocalWidth(),
+              A.LockedBuffer(), A.LDim(), A.Buffer(), A.LDim(),
+              [&]( Int iLoc ) { return rowMap.Global(iLoc); },
+              globalCol, func );
         }
+        return;
     }
+    const auto globalRows = index_dependent_map::GlobalRows( A );
+    index_dependent_map::LocalMap
+    ( A.LocalHeight(), A.LocalWidth(),
+      A.LockedBuffer(), A.LDim(), A.Buffer(), A.LDim(),
+      [&]( Int iLoc ) { return globalRows[iLoc]; },
+      [&]( Int jLoc ) { return A.GlobalCol(jLoc); }, func );
+}
 
+template<typename S,typename T,typename Function>
+void IndexDependentMap( const Matrix<S>& A, Matrix<T>& B, Function func )
+{
+    EL_DEBUG_CSE
+    const Int m = A.Height();
+    const Int n = A.Width();
+    B.Resize( m, n );
+    auto identity = []( Int i ) { return i; };
+    index_dependent_map::LocalMap
+    ( m, n, A.LockedBuffer(), A.LDim(), B.Buffer(), B.LDim(),
+      identity, identity, func );
 }
 
-template<typename S,typename T,Dist U,Dist V,DistWrap wrap>
+template<typename S,typename T,Dist U,Dist V,DistWrap wrap,typename Function>
 void IndexDependentMap
 ( const DistMatrix<S,U,V,wrap>& A,
         DistMatrix<T,U,V,wrap>& B,
-  function<T(Int,Int,const S&)> func )
+        Function func )
 {
     EL_DEBUG_CSE
-    const Int mLoc = A.LocalHeight();
-    const Int nLoc = A.LocalWidth();
     B.AlignWith( A.DistData() );
     B.Resize( A.Height(), A.Width() );
-    const T* ALocBuf = A.LockedBuffer();
-    T* BLocBuf = B.Buffer();
-    const Int ALocLDim = A.LDim();
-    const Int BLocLDim = B.LDim();
-
-    // Use entry-wise parallelization for column vectors. Otherwise
-    // use column-wise parallelization.
-    if( nLoc == 1 )
-    {
-        EL_PARALLEL_FOR
-        for( Int iLoc=0; iLoc<mLoc; ++iLoc )
-        {
-            const Int i = A.GlobalRow(iLoc);
-            const Int j = A.GlobalCol(0);
-            BLocBuf[iLoc] = func(i,j,ALocBuf[iLoc]);
-        }
-    }
-    else
+    if( wrap == ELEMENT )
     {
-        EL_PARALLEL_FOR
-        for( Int jLoc=0; jLoc<nLoc; ++jLoc )
-        {
-            EL_SIMD
-            for( Int iLoc=0; iLoc<mLoc; ++iLoc )
-            {
-                const Int i = A.GlobalRow(iLoc);
-                const Int j = A.GlobalCol(jLoc);
-                BLocBuf[iLoc+jLoc*BLocLDim] = func(i,j,ALocBuf[iLoc+jLoc*ALocLDim]);
-            }
-        }
+        const ElementalIndexMap<U> rowMap( A.ColShift(), A.ColStride() );
+        const ElementalIndexMap<V> colMap( A.RowShift(), A.RowStride() );
+        index_dependent_map::LocalMap
+        ( A.LocalHeight(), A.LocalWidth(),
+          A.LockedBuffer(), A.LDim(), B.Buffer(), B.LDim(),
+          [&]( Int iLoc ) { return rowMap.Global(iLoc); },
+          [&]( Int jLoc ) { return colMap.Global(jLoc); }, func );
+        return;
     }
-
+    const auto globalRows = index_dependent_map::GlobalRows( A );
+    index_dependent_map::LocalMap
+    ( A.LocalHeight(), A.LocalWidth(),
+      A.LockedBuffer(), A.LDim(), B.Buffer(), B.LDim(),
+      [&]( Int iLoc ) { return globalRows[iLoc]; },
+      [&]( Int jLoc ) { return A.GlobalCol(jLoc); }, func );
 }
 
-template<typename S,typename T,Dist U,Dist V>
+template<typename S,typename T,Dist U,Dist V,typename Function>
 void IndexDependentMap
 ( const AbstractDistMatrix<S>& A,
         DistMatrix<T,U,V>& B,
-  function<T(Int,Int,const S&)> func )
+        Function func )
 {
     EL_DEBUG_CSE
     if( A.Wrap() == ELEMENT && A.DistData() == B.DistData() )
     {
-        auto& ACast = static_cast<const DistMatrix<T,U,V>&>(A);
+        auto& ACast = static_cast<const DistMatrix<S,U,V>&>(A);
         IndexDependentMap( ACast, B, func );
     }
     else
@@ -195,16 +186,16 @@ void IndexDependentMap
     }
 }
 
-template<typename S,typename T,Dist U,Dist V>
+template<typename S,typename T,Dist U,Dist V,typename Function>
 void IndexDependentMap
 ( const AbstractDistMatrix<S>& A,
         DistMatrix<T,U,V,BLOCK>& B,
-  function<T(Int,Int,const S&)> func )
+        Function func )
 {
     EL_DEBUG_CSE
     if( A.Wrap() == BLOCK && A.DistData() == B.DistData() )
     {
-        auto& ACast = static_cast<const DistMatrix<T,U,V,BLOCK>&>(A);
+        auto& ACast = static_cast<const DistMatrix<S,U,V,BLOCK>&>(A);
         IndexDependentMap( ACast, B, func );
     }
     else
@@ -227,6 +218,44 @@ void IndexDependentMap
     }
 }
 
+template<typename T>
+void IndexDependentMap( Matrix<T>& A, function<T(Int,Int,const T&)> func )
+{ IndexDependentMap<T,function<T(Int,Int,const T&)>>( A, func ); }
+
+template<typename T>
+void IndexDependentMap
+( AbstractDistMatrix<T>& A, function<T(Int,Int,const T&)> func )
+{ IndexDependentMap<T,function<T(Int,Int,const T&)>>( A, func ); }
+
+template<typename S,typename T>
+void IndexDependentMap
+( const Matrix<S>& A, Matrix<T>& B, function<T(Int,Int,const S&)> func )
+{ IndexDependentMap<S,T,function<T(Int,Int,const S&)>>( A, B, func ); }
+
+template<typename S,typename T,Dist U,Dist V,DistWrap wrap>
+void IndexDependentMap
+( const DistMatrix<S,U,V,wrap>& A,
+        DistMatrix<T,U,V,wrap>& B,
+        function<T(Int,Int,const S&)> func )
+{
+    IndexDependentMap<S,T,U,V,wrap,function<T(Int,Int,const S&)>>
+    ( A, B, func );
+}
+
+template<typename S,typename T,Dist U,Dist V>
+void IndexDependentMap
+( const AbstractDistMatrix<S>& A,
+        DistMatrix<T,U,V>& B,
+        function<T(Int,Int,const S&)> func )
+{ IndexDependentMap<S,T,U,V,function<T(Int,Int,const S&)>>( A, B, func ); }
+
+template<typename S,typename T,Dist U,Dist V>
+void IndexDependentMap
+( const AbstractDistMatrix<S>& A,
+        DistMatrix<T,U,V,BLOCK>& B,
+        function<T(Int,Int,const S&)> func )
+{ IndexDependentMap<S,T,U,V,function<T(Int,Int,const S&)>>( A, B, func ); }
+
 #ifdef EL_INSTANTIATE_BLAS_LEVEL1
 # define EL_EXTERN
 #else
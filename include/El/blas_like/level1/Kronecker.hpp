@@ -11,6 +11,9 @@
 
 namespace El {
 
+// Explicitly form C := A (x) B (see KroneckerOperator for an implicit
+// representation which only requires the factors)
+
 template<typename T>
 void Kronecker
 ( const Matrix<T>& A,
@@ -0,0 +1,463 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_BLAS_LAZY_HPP
+#define EL_BLAS_LAZY_HPP
+
+namespace El {
+
+// Lazily-evaluated entrywise expressions
+// ======================================
+// Chains of level-1 updates, e.g.,
+//
+//   z := alpha x + beta (y .* w) - s,
+//
+// would otherwise require a sweep over memory per Axpy, Hadamard, Scale,
+// or Shift. Wrapping the operands with 'Lazy' instead builds an expression
+// which is evaluated in a single (threaded and vectorizable) pass over the
+// local entries by 'Assign':
+//
+//   Assign( z, alpha*Lazy(x) + beta*Hadamard(Lazy(y),Lazy(w)) - Lazy(s) );
+//
+// The operands may be (local) Matrix, ElementalMatrix, or DistMultiVec
+// instances but must all share the same distribution and alignment. Several
+// inner products or squared norms of such expressions can similarly be
+// combined into a single AllReduce via 'lazy::Reductions'.
+
+namespace lazy {
+
+// The (global and local) distribution of the entries of an expression
+struct Layout
+{
+    Int height=0, width=0;
+    Int localHeight=0, localWidth=0;
+    Int colShift=0, rowShift=0;
+    Int colStride=1, rowStride=1;
+
+    bool participating=true;
+    int root=0;
+    mpi::Comm distComm=mpi::COMM_SELF;
+    mpi::Comm crossComm=mpi::COMM_SELF;
+    const El::Grid* grid=nullptr;
+};
+
+inline bool Conforms( const Layout& a, const Layout& b )
+{
+    return a.height == b.height && a.width == b.width &&
+      a.localHeight == b.localHeight && a.localWidth == b.localWidth &&
+      a.colShift == b.colShift && a.rowShift == b.rowShift &&
+      a.colStride == b.colStride && a.rowStride == b.rowStride;
+}
+
+inline const Layout& CombineLayouts( const Layout& a, const Layout& b )
+{
+    if( !Conforms( a, b ) )
+        LogicError
+        ("Lazy operands of sizes ",a.height,"x",a.width," and ",
+         b.height,"x",b.width," do not share a distribution");
+    return a;
+}
+
+template<typename Derived>
+struct Expression
+{
+    const Derived& Cast() const { return static_cast<const Derived&>(*this); }
+};
+
+// A reference to the (local) entries of a matrix
+template<typename T>
+class Ref : public Expression<Ref<T>>
+{
+public:
+    typedef T value_type;
+
+    Ref( const Matrix<T>& A )
+    : buffer_(A.LockedBuffer()), ldim_(A.LDim())
+    {
+        layout_.height = layout_.localHeight = A.Height();
+        layout_.width = layout_.localWidth = A.Width();
+    }
+
+    Ref( const ElementalMatrix<T>& A )
+    : buffer_(A.LockedBuffer()), ldim_(A.LDim())
+    {
+        layout_.height = A.Height();
+        layout_.width = A.Width();
+        layout_.localHeight = A.LocalHeight();
+        layout_.localWidth = A.LocalWidth();
+        layout_.colShift = A.ColShift();
+        layout_.rowShift = A.RowShift();
+        layout_.colStride = A.ColStride();
+        layout_.rowStride = A.RowStride();
+        layout_.participating = A.Participating();
+        layout_.root = A.Root();
+        layout_.distComm = A.DistComm();
+        layout_.crossComm = A.CrossComm();
+        layout_.grid = &A.Grid();
+    }
+
+    Ref( const DistMultiVec<T>& A )
+    : buffer_(A.LockedMatrix().LockedBuffer()), ldim_(A.LockedMatrix().LDim())
+    {
+        layout_.height = A.Height();
+        layout_.width = A.Width();
+        layout_.localHeight = A.LocalHeight();
+        layout_.localWidth = A.Width();
+        layout_.colShift = A.FirstLocalRow();
+        layout_.distComm = A.Grid().Comm();
+        layout_.grid = &A.Grid();
+    }
+
+    const lazy::Layout& Layout() const { return layout_; }
+
+    T operator()( Int iLoc, Int jLoc ) const
+    { return buffer_[iLoc+jLoc*ldim_]; }
+
+private:
+    const T* buffer_;
+    Int ldim_;
+    lazy::Layout layout_;
+};
+
+// The entrywise application of a function to an expression
+template<typename E,typename Function>
+class Map : public Expression<Map<E,Function>>
+{
+public:
+    typedef typename E::value_type value_type;
+
+    Map( const E& expr, Function func ) : expr_(expr), func_(func) { }
+
+    const lazy::Layout& Layout() const { return expr_.Layout(); }
+
+    value_type operator()( Int iLoc, Int jLoc ) const
+    { return func_( expr_(iLoc,jLoc) ); }
+
+private:
+    E expr_;
+    Function func_;
+};
+
+// The entrywise combination of two expressions
+template<typename L,typename R,typename Function>
+class Combine : public Expression<Combine<L,R,Function>>
+{
+public:
+    typedef typename L::value_type value_type;
+
+    Combine( const L& left, const R& right, Function func )
+    : left_(left), right_(right), func_(func),
+      layout_(CombineLayouts(left.Layout(),right.Layout()))
+    { }
+
+    const lazy::Layout& Layout() const { return layout_; }
+
+    value_type operator()( Int iLoc, Int jLoc ) const
+    { return func_( left_(iLoc,jLoc), right_(iLoc,jLoc) ); }
+
+private:
+    L left_;
+    R right_;
+    Function func_;
+    lazy::Layout layout_;
+};
+
+template<typename T>
+struct ScaleOp
+{
+    T alpha;
+    T operator()( const T& x ) const { return alpha*x; }
+};
+
+template<typename T>
+struct ShiftOp
+{
+    T alpha;
+    T operator()( const T& x ) const { return x+alpha; }
+};
+
+template<typename T>
+struct NegateOp
+{
+    T operator()( const T& x ) const { return -x; }
+};
+
+template<typename T>
+struct PlusOp
+{
+    T operator()( const T& x, const T& y ) const { return x+y; }
+};
+
+template<typename T>
+struct MinusOp
+{
+    T operator()( const T& x, const T& y ) const { return x-y; }
+};
+
+template<typename T>
+struct TimesOp
+{
+    T operator()( const T& x, const T& y ) const { return x*y; }
+};
+
+template<typename T>
+struct DivideOp
+{
+    T operator()( const T& x, const T& y ) const { return x/y; }
+};
+
+template<typename L,typename R>
+Combine<L,R,PlusOp<typename L::value_type>>
+operator+( const Expression<L>& left, const Expression<R>& right )
+{
+    return Combine<L,R,PlusOp<typename L::value_type>>
+      ( left.Cast(), right.Cast(), PlusOp<typename L::value_type>() );
+}
+
+template<typename L,typename R>
+Combine<L,R,MinusOp<typename L::value_type>>
+operator-( const Expression<L>& left, const Expression<R>& right )
+{
+    return Combine<L,R,MinusOp<typename L::value_type>>
+      ( left.Cast(), right.Cast(), MinusOp<typename L::value_type>() );
+}
+
+// The entrywise (Hadamard) product
+template<typename L,typename R>
+Combine<L,R,TimesOp<typename L::value_type>>
+Hadamard( const Expression<L>& left, const Expression<R>& right )
+{
+    return Combine<L,R,TimesOp<typename L::value_type>>
+      ( left.Cast(), right.Cast(), TimesOp<typename L::value_type>() );
+}
+
+// The entrywise quotient
+template<typename L,typename R>
+Combine<L,R,DivideOp<typename L::value_type>>
+Divide( const Expression<L>& left, const Expression<R>& right )
+{
+    return Combine<L,R,DivideOp<typename L::value_type>>
+      ( left.Cast(), right.Cast(), DivideOp<typename L::value_type>() );
+}
+
+template<typename E>
+Map<E,ScaleOp<typename E::value_type>>
+operator*( const typename E::value_type& alpha, const Expression<E>& expr )
+{
+    return Map<E,ScaleOp<typename E::value_type>>
+      ( expr.Cast(), ScaleOp<typename E::value_type>{alpha} );
+}
+
+template<typename E>
+Map<E,ScaleOp<typename E::value_type>>
+operator*( const Expression<E>& expr, const typename E::value_type& alpha )
+{ return alpha*expr; }
+
+template<typename E>
+Map<E,ShiftOp<typename E::value_type>>
+operator+( const Expression<E>& expr, const typename E::value_type& alpha )
+{
+    return Map<E,ShiftOp<typename E::value_type>>
+      ( expr.Cast(), ShiftOp<typename E::value_type>{alpha} );
+}
+
+template<typename E>
+Map<E,ShiftOp<typename E::value_type>>
+operator-( const Expression<E>& expr, const typename E::value_type& alpha )
+{ return expr + (-alpha); }
+
+template<typename E>
+Map<E,NegateOp<typename E::value_type>>
+operator-( const Expression<E>& expr )
+{
+    return Map<E,NegateOp<typename E::value_type>>
+      ( expr.Cast(), NegateOp<typename E::value_type>() );
+}
+
+// Apply an arbitrary (inlinable) function to each entry of an expression
+template<typename E,typename Function>
+Map<E,Function> EntrywiseMap( const Expression<E>& expr, Function func )
+{ return Map<E,Function>( expr.Cast(), func ); }
+
+// Overwrite the local entries of a buffer with those of an expression
+template<typename T,typename E>
+void AssignLocal( T* buffer, Int ldim, const E& expr )
+{
+    EL_DEBUG_CSE
+    const Int localHeight = expr.Layout().localHeight;
+    const Int localWidth = expr.Layout().localWidth;
+    EL_PARALLEL_FOR_IF(ParallelizeLoop(localHeight*localWidth))
+    for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+    {
+        T* col = &buffer[jLoc*ldim];
+        EL_SIMD
+        for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+            col[iLoc] = expr(iLoc,jLoc);
+    }
+}
+
+// Queue several inner products, squared Frobenius norms, and/or sums of
+// expressions over the same distribution so that they may be computed with
+// a single AllReduce of a ReductionBatch (and, for ElementalMatrix operands,
+// a single broadcast to the non-participating processes)
+template<typename T>
+class Reductions
+{
+public:
+    // Queue the inner product sum_{i,j} conj(A(i,j)) B(i,j) and return its
+    // index
+    template<typename EA,typename EB>
+    Int AddDot( const Expression<EA>& A, const Expression<EB>& B )
+    {
+        EL_DEBUG_CSE
+        const auto& ACast = A.Cast();
+        const auto& BCast = B.Cast();
+        SetLayout( CombineLayouts( ACast.Layout(), BCast.Layout() ) );
+        T localValue(0);
+        if( layout_.participating )
+        {
+            const Int localHeight = layout_.localHeight;
+            const Int localWidth = layout_.localWidth;
+            for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+                for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+                    localValue +=
+                      Conj(ACast(iLoc,jLoc))*BCast(iLoc,jLoc);
+        }
+        return batch_.AddSum( localValue );
+    }
+
+    // Queue the squared Frobenius norm and return its index
+    template<typename E>
+    Int AddSquaredNorm( const Expression<E>& A )
+    { return AddDot( A, A ); }
+
+    // Queue the sum of the entries and return its index
+    template<typename E>
+    Int AddSum( const Expression<E>& A )
+    {
+        EL_DEBUG_CSE
+        const auto& ACast = A.Cast();
+        SetLayout( ACast.Layout() );
+        T localValue(0);
+        if( layout_.participating )
+        {
+            const Int localHeight = layout_.localHeight;
+            const Int localWidth = layout_.localWidth;
+            for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+                for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+                    localValue += ACast(iLoc,jLoc);
+        }
+        return batch_.AddSum( localValue );
+    }
+
+    // Combine the local contributions of every queued reduction
+    void Reduce()
+    {
+        EL_DEBUG_CSE
+        const Int numValues = batch_.NumReductions();
+        if( numValues == 0 )
+            return;
+        values_.resize( numValues );
+        if( layout_.participating )
+        {
+            batch_.Reduce();
+            for( Int k=0; k<numValues; ++k )
+                values_[k] = batch_.Get( k );
+        }
+        if( mpi::Size(layout_.crossComm) > 1 )
+            mpi::Broadcast
+            ( values_.data(), numValues, layout_.root, layout_.crossComm );
+        reduced_ = true;
+    }
+
+    T Get( Int index ) const
+    {
+        EL_DEBUG_CSE
+        if( !reduced_ )
+            LogicError("Reduce must be called before retrieving values");
+        return values_[index];
+    }
+
+    Base<T> Norm( Int index ) const { return Sqrt(RealPart(Get(index))); }
+
+private:
+    ReductionBatch<T> batch_;
+    vector<T> values_;
+    lazy::Layout layout_;
+    bool haveLayout_=false;
+    bool reduced_=false;
+
+    void SetLayout( const lazy::Layout& layout )
+    {
+        if( haveLayout_ )
+            CombineLayouts( layout_, layout );
+        else
+        {
+            layout_ = layout;
+            haveLayout_ = true;
+            if( layout_.participating )
+                batch_ = ReductionBatch<T>( layout_.distComm );
+        }
+        reduced_ = false;
+    }
+};
+
+} // namespace lazy
+
+template<typename T>
+lazy::Ref<T> Lazy( const Matrix<T>& A ) { return lazy::Ref<T>( A ); }
+template<typename T>
+lazy::Ref<T> Lazy( const ElementalMatrix<T>& A ) { return lazy::Ref<T>( A ); }
+template<typename T>
+lazy::Ref<T> Lazy( const DistMultiVec<T>& A ) { return lazy::Ref<T>( A ); }
+
+// Evaluate an expression in a single pass over the local entries. The
+// target is resized if it is empty, but it must otherwise share the
+// distribution of the operands. It may also be one of the operands.
+template<typename T,typename E>
+void Assign( Matrix<T>& Z, const lazy::Expression<E>& expr )
+{
+    EL_DEBUG_CSE
+    const auto& exprCast = expr.Cast();
+    const auto& layout = exprCast.Layout();
+    Z.Resize( layout.localHeight, layout.localWidth );
+    lazy::AssignLocal( Z.Buffer(), Z.LDim(), exprCast );
+}
+
+template<typename T,typename E>
+void Assign( ElementalMatrix<T>& Z, const lazy::Expression<E>& expr )
+{
+    EL_DEBUG_CSE
+    const auto& exprCast = expr.Cast();
+    const auto& layout = exprCast.Layout();
+    if( Z.Height() == 0 && Z.Width() == 0 && !Z.Viewing() )
+        Z.Resize( layout.height, layout.width );
+    lazy::CombineLayouts( lazy::Ref<T>(Z).Layout(), layout );
+    lazy::AssignLocal( Z.Buffer(), Z.LDim(), exprCast );
+}
+
+template<typename T,typename E>
+void Assign( DistMultiVec<T>& Z, const lazy::Expression<E>& expr )
+{
+    EL_DEBUG_CSE
+    const auto& exprCast = expr.Cast();
+    const auto& layout = exprCast.Layout();
+    if( Z.Height() != layout.height || Z.Width() != layout.width )
+    {
+        if( layout.grid != nullptr )
+            Z.SetGrid( *layout.grid );
+        Z.Resize( layout.height, layout.width );
+    }
+    lazy::CombineLayouts( lazy::Ref<T>(Z).Layout(), layout );
+    auto& ZLoc = Z.Matrix();
+    lazy::AssignLocal( ZLoc.Buffer(), ZLoc.LDim(), exprCast );
+}
+
+} // namespace El
+
+#endif // ifndef EL_BLAS_LAZY_HPP
@@ -23,6 +23,20 @@ void MakeReal( Matrix<Complex<Real>>& A )
     const Int height = A.Height();
     const Int width = A.Width();
     const Int ldim = A.LDim();
+    if( IsBlasScalar<Real>::value )
+    {
+        // Zero the imaginary halves of the interleaved std::complex layout
+        Real* ABuf = reinterpret_cast<Real*>(ABuffer);
+        EL_PARALLEL_FOR_IF(ParallelizeLoop(height*width))
+        for( Int j=0; j<width; ++j )
+        {
+            Real* aCol = &ABuf[2*j*ldim];
+            EL_SIMD
+            for( Int i=0; i<height; ++i )
+                aCol[2*i+1] = 0;
+        }
+        return;
+    }
     for( Int j=0; j<width; ++j )
         for( Int i=0; i<height; ++i )
             ABuffer[i+j*ldim] = RealPart(ABuffer[i+j*ldim]);
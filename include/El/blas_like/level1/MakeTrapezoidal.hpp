@@ -42,11 +42,70 @@ void MakeTrapezoidal( UpperOrLower uplo, Matrix<T>& A, Int offset )
     }
 }
 
+namespace make_trapezoidal {
+
+// Zero the local entries outside of the trapezoid given maps from local to
+// global column indices and from global rows to local row offsets
+template<typename T,class ColMap,class RowMap>
+void LocalZero
+( UpperOrLower uplo, Int height, Int localHeight, Int localWidth,
+  T* buffer, Int ldim, Int offset,
+  const ColMap& colMap, const RowMap& rowMap )
+{
+    if( uplo == LOWER )
+    {
+        EL_PARALLEL_FOR
+        for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+        {
+            const Int j = colMap.Global(jLoc);
+            const Int lastZeroRow = j-offset-1;
+            if( lastZeroRow >= 0 )
+            {
+                const Int boundary = Min( lastZeroRow+1, height );
+                const Int numZeroRows = rowMap.LocalOffset(boundary);
+                MemZero( &buffer[jLoc*ldim], numZeroRows );
+            }
+        }
+    }
+    else
+    {
+        EL_PARALLEL_FOR
+        for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+        {
+            const Int j = colMap.Global(jLoc);
+            const Int firstZeroRow = Max(j-offset+1,0);
+            const Int numNonzeroRows = rowMap.LocalOffset(firstZeroRow);
+            if( numNonzeroRows < localHeight )
+            {
+                T* col = &buffer[numNonzeroRows+jLoc*ldim];
+                MemZero( col, localHeight-numNonzeroRows );
+            }
+        }
+    }
+}
+
+} // namespace make_trapezoidal
+
 template<typename T>
 void
 MakeTrapezoidal( UpperOrLower uplo, AbstractDistMatrix<T>& A, Int offset )
 {
     EL_DEBUG_CSE
+    if( A.Wrap() == ELEMENT )
+    {
+        const StridedIndexMap colMap( A.RowShift(), A.RowStride() );
+        if( A.ColDist() == STAR )
+            make_trapezoidal::LocalZero
+            ( uplo, A.Height(), A.LocalHeight(), A.LocalWidth(),
+              A.Buffer(), A.LDim(), offset, colMap, IdentityIndexMap() );
+        else
+            make_trapezoidal::LocalZero
+            ( uplo, A.Height(), A.LocalHeight(), A.LocalWidth(),
+              A.Buffer(), A.LDim(), offset, colMap,
+              StridedIndexMap(A.ColShift(),A.ColStride()) );
+        return;
+    }
+
     const Int height = A.Height();
     const Int localHeight = A.LocalHeight();
     const Int localWidth = A.LocalWidth();
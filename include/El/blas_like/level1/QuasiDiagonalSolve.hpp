@@ -25,8 +25,10 @@ QuasiDiagonalSolve
     EL_DEBUG_CSE
     const Int m = X.Height();
     const Int n = X.Width();
+    Field* XBuf = X.Buffer();
+    const Int XLDim = X.LDim();
 
-    Matrix<Field> D( 2, 2 );
+    FixedMatrix<Field,2,2> D;
     if( side == LEFT && uplo == LOWER )
     {
         if( m == 0 )
@@ -50,10 +52,11 @@ QuasiDiagonalSolve
             else
                 nb = 1;
 
-            auto XRow = X( IR(i,i+nb), IR(0,n) );
             if( nb == 1 )
             {
-                Scale( Field(1)/d(i), XRow );
+                const Field deltaInv = Field(1)/d(i);
+                for( Int j=0; j<n; ++j )
+                    XBuf[i+j*XLDim] *= deltaInv;
             }
             else
             {
@@ -61,8 +64,6 @@ QuasiDiagonalSolve
                 D(1,1) = d(i+1);
                 D(1,0) = dSub(i);
                 Symmetric2x2Inv( LOWER, D, conjugated );
-                MakeSymmetric( LOWER, D, conjugated );
-
                 Transform2x2Rows( D, X, i, i+1 );
             }
 
@@ -93,10 +94,11 @@ QuasiDiagonalSolve
             else
                 nb = 1;
 
-            auto XCol = X( IR(0,m), IR(j,j+nb) );
             if( nb == 1 )
             {
-                Scale( Field(1)/d(j), XCol );
+                const Field deltaInv = Field(1)/d(j);
+                for( Int i=0; i<m; ++i )
+                    XBuf[i+j*XLDim] *= deltaInv;
             }
             else
             {
@@ -104,8 +106,6 @@ QuasiDiagonalSolve
                 D(1,1) = d(j+1);
                 D(1,0) = dSub(j);
                 Symmetric2x2Inv( LOWER, D, conjugated );
-                MakeSymmetric( LOWER, D, conjugated );
-
                 Transform2x2Cols( D, X, j, j+1 );
             }
 
@@ -165,7 +165,7 @@ LeftQuasiDiagonalSolve
         return;
     }
 
-    Matrix<Field> D11( 2, 2 );
+    FixedMatrix<Field,2,2> D11;
     for( Int iLoc=0; iLoc<mLocal; ++iLoc )
     {
         const Int i = X.GlobalRow(iLoc);
@@ -177,28 +177,26 @@ LeftQuasiDiagonalSolve
         if( i<m-1 && dSub.GetLocal(iLoc,0) != Field(0) )
         {
             // Handle 2x2 starting at i
-            D11.Set( 0, 0, d.GetLocal(iLoc,0) );
-            D11.Set( 1, 1, dNext.GetLocal(iLocNext,0) );
-            D11.Set( 1, 0, dSub.GetLocal(iLoc,0) );
+            D11(0,0) = d.GetLocal(iLoc,0);
+            D11(1,1) = dNext.GetLocal(iLocNext,0);
+            D11(1,0) = dSub.GetLocal(iLoc,0);
             Symmetric2x2Inv( LOWER, D11, conjugated );
-            MakeSymmetric( LOWER, D11, conjugated );
 
             auto x1NextLoc = XNext.LockedMatrix()( IR(iLocNext), ALL );
-            Scale( D11.Get(0,0), x1Loc );
-            Axpy( D11.Get(0,1), x1NextLoc, x1Loc );
+            Scale( D11(0,0), x1Loc );
+            Axpy( D11(0,1), x1NextLoc, x1Loc );
         }
         else if( i>0 && dSubPrev.GetLocal(iLocPrev,0) != Field(0) )
         {
             // Handle 2x2 starting at i-1
-            D11.Set( 0, 0, dPrev.GetLocal(iLocPrev,0) );
-            D11.Set( 1, 1, d.GetLocal(iLoc,0) );
-            D11.Set( 1, 0, dSubPrev.GetLocal(iLocPrev,0) );
+            D11(0,0) = dPrev.GetLocal(iLocPrev,0);
+            D11(1,1) = d.GetLocal(iLoc,0);
+            D11(1,0) = dSubPrev.GetLocal(iLocPrev,0);
             Symmetric2x2Inv( LOWER, D11, conjugated );
-            MakeSymmetric( LOWER, D11, conjugated );
 
             auto x1PrevLoc = XPrev.LockedMatrix()( IR(iLocPrev), ALL );
-            Scale( D11.Get(1,1), x1Loc );
-            Axpy( D11.Get(1,0), x1PrevLoc, x1Loc );
+            Scale( D11(1,1), x1Loc );
+            Axpy( D11(1,0), x1PrevLoc, x1Loc );
         }
         else
         {
@@ -257,7 +255,7 @@ RightQuasiDiagonalSolve
         return;
     }
 
-    Matrix<Field> D11( 2, 2 );
+    FixedMatrix<Field,2,2> D11;
     for( Int jLoc=0; jLoc<nLocal; ++jLoc )
     {
         const Int j = X.GlobalCol(jLoc);
@@ -269,28 +267,26 @@ RightQuasiDiagonalSolve
         if( j<n-1 && dSub.GetLocal(jLoc,0) != Field(0) )
         {
             // Handle 2x2 starting at j
-            D11.Set( 0, 0, d.GetLocal(jLoc,0) );
-            D11.Set( 1, 1, dNext.GetLocal(jLocNext,0) );
-            D11.Set( 1, 0, dSub.GetLocal(jLoc,0) );
+            D11(0,0) = d.GetLocal(jLoc,0);
+            D11(1,1) = dNext.GetLocal(jLocNext,0);
+            D11(1,0) = dSub.GetLocal(jLoc,0);
             Symmetric2x2Inv( LOWER, D11, conjugated );
-            MakeSymmetric( LOWER, D11, conjugated );
 
             auto x1NextLoc = XNext.LockedMatrix()( ALL, IR(jLocNext) );
-            Scale( D11.Get(0,0), x1Loc );
-            Axpy( D11.Get(1,0), x1NextLoc, x1Loc );
+            Scale( D11(0,0), x1Loc );
+            Axpy( D11(1,0), x1NextLoc, x1Loc );
         }
         else if( j>0 && dSubPrev.GetLocal(jLocPrev,0) != Field(0) )
         {
             // Handle 2x2 starting at j-1
-            D11.Set( 0, 0, dPrev.GetLocal(jLocPrev,0) );
-            D11.Set( 1, 1, d.GetLocal(jLoc,0) );
-            D11.Set( 1, 0, dSubPrev.GetLocal(jLocPrev,0) );
+            D11(0,0) = dPrev.GetLocal(jLocPrev,0);
+            D11(1,1) = d.GetLocal(jLoc,0);
+            D11(1,0) = dSubPrev.GetLocal(jLocPrev,0);
             Symmetric2x2Inv( LOWER, D11, conjugated );
-            MakeSymmetric( LOWER, D11, conjugated );
 
             auto x1PrevLoc = XPrev.LockedMatrix()( ALL, IR(jLocPrev) );
-            Scale( D11.Get(1,1), x1Loc );
-            Axpy( D11.Get(0,1), x1PrevLoc, x1Loc );
+            Scale( D11(1,1), x1Loc );
+            Axpy( D11(0,1), x1PrevLoc, x1Loc );
         }
         else
         {
@@ -48,6 +48,40 @@ Matrix<T> Reshape( Int mNew, Int nNew, const Matrix<T>& A )
     return B;
 }
 
+// Reinterpret the column-major buffer of A, whose columns must be stored
+// contiguously (i.e., its leading dimension must equal its height), as that
+// of an mNew x nNew matrix without copying
+template<typename T>
+void ReshapedView( Int mNew, Int nNew, Matrix<T>& A, Matrix<T>& B )
+{
+    EL_DEBUG_CSE
+    const Int m = A.Height();
+    const Int n = A.Width();
+    if( m*n != mNew*nNew )
+        LogicError
+        ("Reshape from ",m," x ",n," to ",mNew," x ",nNew,
+         " did not preserve the total number of entries");
+    if( A.LDim() != m && n > 1 )
+        LogicError("Reshaped views require contiguous columns");
+    B.Attach( mNew, nNew, A.Buffer(), Max(mNew,Int(1)) );
+}
+
+template<typename T>
+void LockedReshapedView
+( Int mNew, Int nNew, const Matrix<T>& A, Matrix<T>& B )
+{
+    EL_DEBUG_CSE
+    const Int m = A.Height();
+    const Int n = A.Width();
+    if( m*n != mNew*nNew )
+        LogicError
+        ("Reshape from ",m," x ",n," to ",mNew," x ",nNew,
+         " did not preserve the total number of entries");
+    if( A.LDim() != m && n > 1 )
+        LogicError("Reshaped views require contiguous columns");
+    B.LockedAttach( mNew, nNew, A.LockedBuffer(), Max(mNew,Int(1)) );
+}
+
 // TODO(poulson): Merge with implementation of GetSubmatrix via a function
 // which maps the coordinates in A to the coordinates in B
 template<typename T>
@@ -189,6 +223,10 @@ DistSparseMatrix<T> Reshape( Int mNew, Int nNew, const DistSparseMatrix<T>& A )
           Matrix<T>& B ); \
   EL_EXTERN template Matrix<T> Reshape \
   ( Int mNew, Int nNew, const Matrix<T>& A ); \
+  EL_EXTERN template void ReshapedView \
+  ( Int mNew, Int nNew, Matrix<T>& A, Matrix<T>& B ); \
+  EL_EXTERN template void LockedReshapedView \
+  ( Int mNew, Int nNew, const Matrix<T>& A, Matrix<T>& B ); \
   EL_EXTERN template void Reshape \
   (       Int mNew, \
           Int nNew, \
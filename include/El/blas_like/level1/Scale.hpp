@@ -32,13 +32,13 @@ void Scale( S alphaS, Matrix<T>& A )
     {
         if( ALDim == height )
         {
-            EL_PARALLEL_FOR
+            EL_PARALLEL_FOR_IF(ParallelizeLoop(height*width))
             for( Int i=0; i<height*width; ++i )
                 ABuf[i] *= alpha;
         }
         else
         {
-            EL_PARALLEL_FOR
+            EL_PARALLEL_FOR_IF(ParallelizeLoop(height*width))
             for( Int j=0; j<width; ++j )
             {
                 EL_SIMD
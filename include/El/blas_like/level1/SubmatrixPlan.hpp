@@ -0,0 +1,515 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_BLAS_SUBMATRIXPLAN_HPP
+#define EL_BLAS_SUBMATRIXPLAN_HPP
+
+namespace El {
+
+// A SubmatrixPlan precomputes the owners and the pack and unpack maps of
+// one or more (possibly non-contiguous) submatrices, A(I_b,J_b), of a fixed
+// configuration of A, so that each subsequent extraction into, or update
+// from, matrices with fixed configurations of the submatrices only requires
+// a single AllToAll of the entries themselves. All of the submatrices of a
+// plan are exchanged at once.
+//
+// Each process holding a copy of an entry of A knows its position, but only
+// redundant rank 0 of A sends (or receives) it; similarly, the entries of
+// each submatrix are pushed to redundant rank 0 of its owners and then
+// broadcast over the redundant communicator. The submatrices must share the
+// grid of A as well as a common distribution (though not necessarily their
+// alignments), and the construction is collective over the VC communicator.
+class SubmatrixPlan
+{
+public:
+    SubmatrixPlan() { }
+
+    template<typename T>
+    SubmatrixPlan
+    ( const AbstractDistMatrix<T>& A,
+      const vector<Int>& I,
+      const vector<Int>& J,
+      const AbstractDistMatrix<T>& ASub );
+
+    template<typename T>
+    SubmatrixPlan
+    ( const AbstractDistMatrix<T>& A,
+      const vector<vector<Int>>& Is,
+      const vector<vector<Int>>& Js,
+      const vector<const AbstractDistMatrix<T>*>& ASubs );
+
+    Int NumSubmatrices() const { return subDists_.size(); }
+
+    // Whether or not this plan can be used for A and the given submatrices
+    template<typename T>
+    bool Matches
+    ( const AbstractDistMatrix<T>& A,
+      const vector<const AbstractDistMatrix<T>*>& ASubs ) const;
+
+    // ASub_b := A(I_b,J_b) (each ASub_b is resized to |I_b| x |J_b|)
+    template<typename T>
+    void Get
+    ( const AbstractDistMatrix<T>& A,
+            AbstractDistMatrix<T>& ASub ) const;
+    template<typename T>
+    void Get
+    ( const AbstractDistMatrix<T>& A,
+      const vector<AbstractDistMatrix<T>*>& ASubs ) const;
+
+    // A(I_b,J_b) += alpha ASub_b (duplicate indices accumulate)
+    template<typename T>
+    void Update
+    (       AbstractDistMatrix<T>& A, T alpha,
+      const AbstractDistMatrix<T>& ASub ) const;
+    template<typename T>
+    void Update
+    (       AbstractDistMatrix<T>& A, T alpha,
+      const vector<const AbstractDistMatrix<T>*>& ASubs ) const;
+
+    // A(I_b,J_b) := ASub_b (the result is unspecified for duplicate indices)
+    template<typename T>
+    void Set
+    (       AbstractDistMatrix<T>& A,
+      const AbstractDistMatrix<T>& ASub ) const;
+    template<typename T>
+    void Set
+    (       AbstractDistMatrix<T>& A,
+      const vector<const AbstractDistMatrix<T>*>& ASubs ) const;
+
+private:
+    DistData dist_;
+    size_t gridId_=0;
+    Int height_=0, width_=0;
+
+    vector<DistData> subDists_;
+    vector<Int> subHeights_, subWidths_;
+
+    // The local indices of A of each of its entries within the submatrices,
+    // ordered by the rank of the owner within the submatrix (the counts are
+    // only nonzero for redundant rank 0 of A)
+    vector<Int> rows_, cols_;
+    vector<int> counts_, offs_;
+
+    // The submatrix and local indices of each entry of the submatrices which
+    // is stored by this process, in the order in which they are received
+    // (the counts are only nonzero for redundant rank 0 of the submatrices)
+    vector<Int> subInds_, subRows_, subCols_;
+    vector<int> subCounts_, subOffs_;
+
+    template<typename T>
+    void Initialize
+    ( const AbstractDistMatrix<T>& A,
+      const vector<vector<Int>>& Is,
+      const vector<vector<Int>>& Js,
+      const vector<const AbstractDistMatrix<T>*>& ASubs );
+
+    // Send the entries of A and return the entries of the submatrices
+    // stored by this process
+    template<typename T>
+    void Pull( const AbstractDistMatrix<T>& A, vector<T>& subValues ) const;
+
+    // Send the entries of the submatrices and return the entries of A
+    // stored by this process
+    template<typename T>
+    void Push
+    ( const vector<const AbstractDistMatrix<T>*>& ASubs,
+      vector<T>& values ) const;
+};
+
+template<typename T>
+SubmatrixPlan::SubmatrixPlan
+( const AbstractDistMatrix<T>& A,
+  const vector<Int>& I,
+  const vector<Int>& J,
+  const AbstractDistMatrix<T>& ASub )
+{
+    EL_DEBUG_CSE
+    Initialize
+    ( A, vector<vector<Int>>(1,I), vector<vector<Int>>(1,J),
+      vector<const AbstractDistMatrix<T>*>(1,&ASub) );
+}
+
+template<typename T>
+SubmatrixPlan::SubmatrixPlan
+( const AbstractDistMatrix<T>& A,
+  const vector<vector<Int>>& Is,
+  const vector<vector<Int>>& Js,
+  const vector<const AbstractDistMatrix<T>*>& ASubs )
+{
+    EL_DEBUG_CSE
+    Initialize( A, Is, Js, ASubs );
+}
+
+template<typename T>
+void SubmatrixPlan::Initialize
+( const AbstractDistMatrix<T>& A,
+  const vector<vector<Int>>& Is,
+  const vector<vector<Int>>& Js,
+  const vector<const AbstractDistMatrix<T>*>& ASubs )
+{
+    EL_DEBUG_CSE
+    const Int numSubs = ASubs.size();
+    if( Int(Is.size()) != numSubs || Int(Js.size()) != numSubs )
+        LogicError("Expected ",numSubs," row and column index sets");
+    const Grid& g = A.Grid();
+    dist_ = DistData(A);
+    gridId_ = g.Id();
+    height_ = A.Height();
+    width_ = A.Width();
+    subDists_.resize( numSubs );
+    subHeights_.resize( numSubs );
+    subWidths_.resize( numSubs );
+    for( Int b=0; b<numSubs; ++b )
+    {
+        if( ASubs[b]->Grid() != g )
+            LogicError("Submatrices must share the grid of A");
+        if( ASubs[b]->ColDist() != ASubs[0]->ColDist() ||
+            ASubs[b]->RowDist() != ASubs[0]->RowDist() ||
+            ASubs[b]->Root() != ASubs[0]->Root() )
+            LogicError("Submatrices must share a common distribution");
+        subDists_[b] = DistData(*ASubs[b]);
+        subHeights_[b] = Is[b].size();
+        subWidths_[b] = Js[b].size();
+        EL_DEBUG_ONLY(
+          for( const Int& i : Is[b] )
+              if( i < 0 || i >= height_ )
+                  LogicError("Row index ",i," was out of bounds");
+          for( const Int& j : Js[b] )
+              if( j < 0 || j >= width_ )
+                  LogicError("Column index ",j," was out of bounds");
+        )
+    }
+    if( !g.InGrid() )
+        return;
+    mpi::Comm comm = g.VCComm();
+    const int commSize = mpi::Size( comm );
+    const bool sending = ( A.Participating() && A.RedundantRank() == 0 );
+
+    // Determine the owners of our entries of each submatrix
+    // =====================================================
+    // Every redundant copy of A computes the same list so that updates can be
+    // applied to each copy without recommunicating the indices
+    vector<int> owners;
+    vector<Int> localRows, localCols, subInds, subRows, subCols;
+    if( A.Participating() )
+    {
+        for( Int b=0; b<numSubs; ++b )
+        {
+            const auto& ASub = *ASubs[b];
+            const auto& I = Is[b];
+            const auto& J = Js[b];
+            const int subColStride = ASub.ColStride();
+            const Int mSub = I.size();
+            const Int nSub = J.size();
+            for( Int jSub=0; jSub<nSub; ++jSub )
+            {
+                const Int j = J[jSub];
+                if( !A.IsLocalCol(j) )
+                    continue;
+                const Int jLoc = A.LocalCol(j);
+                const int ownerCol = ASub.ColOwner(jSub);
+                const Int subLocalCol = ASub.LocalCol(jSub,ownerCol);
+                for( Int iSub=0; iSub<mSub; ++iSub )
+                {
+                    const Int i = I[iSub];
+                    if( !A.IsLocalRow(i) )
+                        continue;
+                    const int ownerRow = ASub.RowOwner(iSub);
+                    owners.push_back
+                    ( g.CoordsToVC
+                      (ASub.ColDist(),ASub.RowDist(),
+                       ownerRow+subColStride*ownerCol,ASub.Root()) );
+                    localRows.push_back( A.LocalRow(i) );
+                    localCols.push_back( jLoc );
+                    subInds.push_back( b );
+                    subRows.push_back( ASub.LocalRow(iSub,ownerRow) );
+                    subCols.push_back( subLocalCol );
+                }
+            }
+        }
+    }
+    const Int numLocalEntries = owners.size();
+
+    // Order the entries by owner
+    // ==========================
+    vector<int> ownerCounts( commSize, 0 );
+    for( const int& owner : owners )
+        ++ownerCounts[owner];
+    vector<int> ownerOffs;
+    Scan( ownerCounts, ownerOffs );
+    rows_.resize( numLocalEntries );
+    cols_.resize( numLocalEntries );
+    vector<Int> sendIndices;
+    if( sending )
+        sendIndices.resize( 3*numLocalEntries );
+    auto offs = ownerOffs;
+    for( Int k=0; k<numLocalEntries; ++k )
+    {
+        const Int pos = offs[owners[k]]++;
+        rows_[pos] = localRows[k];
+        cols_[pos] = localCols[k];
+        if( sending )
+        {
+            sendIndices[3*pos  ] = subInds[k];
+            sendIndices[3*pos+1] = subRows[k];
+            sendIndices[3*pos+2] = subCols[k];
+        }
+    }
+    SwapClear( owners );
+    SwapClear( localRows );
+    SwapClear( localCols );
+    SwapClear( subInds );
+    SwapClear( subRows );
+    SwapClear( subCols );
+    counts_.assign( commSize, 0 );
+    if( sending )
+        counts_ = ownerCounts;
+    Scan( counts_, offs_ );
+
+    // Exchange the counts and the indices (only once)
+    // ===============================================
+    subCounts_.resize( commSize );
+    mpi::AllToAll( counts_.data(), 1, subCounts_.data(), 1, comm );
+    const Int totalRecv = Scan( subCounts_, subOffs_ );
+    vector<int> sendIndCounts(commSize), sendIndOffs(commSize),
+                recvIndCounts(commSize), recvIndOffs(commSize);
+    for( int q=0; q<commSize; ++q )
+    {
+        sendIndCounts[q] = 3*counts_[q];
+        sendIndOffs[q] = 3*offs_[q];
+        recvIndCounts[q] = 3*subCounts_[q];
+        recvIndOffs[q] = 3*subOffs_[q];
+    }
+    vector<Int> recvIndices;
+    FastResize( recvIndices, 3*totalRecv );
+    mpi::AllToAll
+    ( sendIndices.data(), sendIndCounts.data(), sendIndOffs.data(),
+      recvIndices.data(), recvIndCounts.data(), recvIndOffs.data(), comm );
+    SwapClear( sendIndices );
+
+    // Share the received indices with the redundant copies of each submatrix
+    // (which share the same redundant communicator)
+    Int numSubEntries = totalRecv;
+    if( numSubs > 0 && ASubs[0]->Participating() )
+    {
+        mpi::Comm redundantComm = ASubs[0]->RedundantComm();
+        if( mpi::Size(redundantComm) > 1 )
+        {
+            mpi::Broadcast( numSubEntries, 0, redundantComm );
+            recvIndices.resize( 3*numSubEntries );
+            mpi::Broadcast
+            ( recvIndices.data(), 3*numSubEntries, 0, redundantComm );
+        }
+    }
+    subInds_.resize( numSubEntries );
+    subRows_.resize( numSubEntries );
+    subCols_.resize( numSubEntries );
+    for( Int k=0; k<numSubEntries; ++k )
+    {
+        subInds_[k] = recvIndices[3*k];
+        subRows_[k] = recvIndices[3*k+1];
+        subCols_[k] = recvIndices[3*k+2];
+    }
+}
+
+template<typename T>
+bool SubmatrixPlan::Matches
+( const AbstractDistMatrix<T>& A,
+  const vector<const AbstractDistMatrix<T>*>& ASubs ) const
+{
+    const Int numSubs = subDists_.size();
+    if( A.Height() != height_ || A.Width() != width_ ||
+        A.Grid().Id() != gridId_ || !(DistData(A) == dist_) ||
+        Int(ASubs.size()) != numSubs )
+        return false;
+    for( Int b=0; b<numSubs; ++b )
+        if( !(DistData(*ASubs[b]) == subDists_[b]) )
+            return false;
+    return true;
+}
+
+template<typename T>
+void SubmatrixPlan::Pull
+( const AbstractDistMatrix<T>& A, vector<T>& subValues ) const
+{
+    EL_DEBUG_CSE
+    if( !A.Grid().InGrid() )
+        return;
+    mpi::Comm comm = A.Grid().VCComm();
+    const Int totalSend =
+      ( counts_.empty() ? 0 : offs_.back()+counts_.back() );
+    const Int totalRecv =
+      ( subCounts_.empty() ? 0 : subOffs_.back()+subCounts_.back() );
+
+    vector<T> sendBuf;
+    FastResize( sendBuf, totalSend );
+    auto& ALoc = A.LockedMatrix();
+    for( Int k=0; k<totalSend; ++k )
+        sendBuf[k] = ALoc(rows_[k],cols_[k]);
+    FastResize( subValues, totalRecv );
+    mpi::AllToAll
+    ( sendBuf.data(), counts_.data(), offs_.data(),
+      subValues.data(), subCounts_.data(), subOffs_.data(), comm );
+}
+
+template<typename T>
+void SubmatrixPlan::Push
+( const vector<const AbstractDistMatrix<T>*>& ASubs,
+  vector<T>& values ) const
+{
+    EL_DEBUG_CSE
+    const Grid& g = ASubs[0]->Grid();
+    if( !g.InGrid() )
+        return;
+    const Int totalSend =
+      ( subCounts_.empty() ? 0 : subOffs_.back()+subCounts_.back() );
+    const Int totalRecv =
+      ( counts_.empty() ? 0 : offs_.back()+counts_.back() );
+
+    vector<T> sendBuf;
+    FastResize( sendBuf, totalSend );
+    for( Int k=0; k<totalSend; ++k )
+        sendBuf[k] =
+          ASubs[subInds_[k]]->LockedMatrix()(subRows_[k],subCols_[k]);
+    FastResize( values, totalRecv );
+    mpi::AllToAll
+    ( sendBuf.data(), subCounts_.data(), subOffs_.data(),
+      values.data(), counts_.data(), offs_.data(), g.VCComm() );
+}
+
+template<typename T>
+void SubmatrixPlan::Get
+( const AbstractDistMatrix<T>& A,
+        AbstractDistMatrix<T>& ASub ) const
+{
+    EL_DEBUG_CSE
+    Get( A, vector<AbstractDistMatrix<T>*>(1,&ASub) );
+}
+
+template<typename T>
+void SubmatrixPlan::Get
+( const AbstractDistMatrix<T>& A,
+  const vector<AbstractDistMatrix<T>*>& ASubs ) const
+{
+    EL_DEBUG_CSE
+    const Int numSubs = ASubs.size();
+    vector<const AbstractDistMatrix<T>*>
+      ASubsConst( ASubs.begin(), ASubs.end() );
+    if( !Matches( A, ASubsConst ) )
+        LogicError("Submatrix plan does not match the matrices");
+    for( Int b=0; b<numSubs; ++b )
+        ASubs[b]->Resize( subHeights_[b], subWidths_[b] );
+    if( numSubs == 0 )
+        return;
+
+    vector<T> subValues;
+    Pull( A, subValues );
+    if( !ASubs[0]->Participating() )
+        return;
+    mpi::Comm redundantComm = ASubs[0]->RedundantComm();
+    const Int numSubEntries = subInds_.size();
+    if( mpi::Size(redundantComm) > 1 )
+    {
+        FastResize( subValues, numSubEntries );
+        mpi::Broadcast( subValues.data(), numSubEntries, 0, redundantComm );
+    }
+    for( Int k=0; k<numSubEntries; ++k )
+        ASubs[subInds_[k]]->Matrix()(subRows_[k],subCols_[k]) = subValues[k];
+}
+
+template<typename T>
+void SubmatrixPlan::Update
+(       AbstractDistMatrix<T>& A, T alpha,
+  const AbstractDistMatrix<T>& ASub ) const
+{
+    EL_DEBUG_CSE
+    Update( A, alpha, vector<const AbstractDistMatrix<T>*>(1,&ASub) );
+}
+
+template<typename T>
+void SubmatrixPlan::Update
+(       AbstractDistMatrix<T>& A, T alpha,
+  const vector<const AbstractDistMatrix<T>*>& ASubs ) const
+{
+    EL_DEBUG_CSE
+    if( !Matches( A, ASubs ) )
+        LogicError("Submatrix plan does not match the matrices");
+    const Int numSubs = ASubs.size();
+    for( Int b=0; b<numSubs; ++b )
+        if( ASubs[b]->Height() != subHeights_[b] ||
+            ASubs[b]->Width() != subWidths_[b] )
+            LogicError
+            ("Submatrix ",b," was ",ASubs[b]->Height()," x ",
+             ASubs[b]->Width()," instead of ",subHeights_[b]," x ",
+             subWidths_[b]);
+    if( numSubs == 0 )
+        return;
+
+    vector<T> values;
+    Push( ASubs, values );
+    if( !A.Participating() )
+        return;
+    mpi::Comm redundantComm = A.RedundantComm();
+    const Int numLocalEntries = rows_.size();
+    if( mpi::Size(redundantComm) > 1 )
+    {
+        FastResize( values, numLocalEntries );
+        mpi::Broadcast( values.data(), numLocalEntries, 0, redundantComm );
+    }
+    auto& ALoc = A.Matrix();
+    for( Int k=0; k<numLocalEntries; ++k )
+        ALoc(rows_[k],cols_[k]) += alpha*values[k];
+}
+
+template<typename T>
+void SubmatrixPlan::Set
+(       AbstractDistMatrix<T>& A,
+  const AbstractDistMatrix<T>& ASub ) const
+{
+    EL_DEBUG_CSE
+    Set( A, vector<const AbstractDistMatrix<T>*>(1,&ASub) );
+}
+
+template<typename T>
+void SubmatrixPlan::Set
+(       AbstractDistMatrix<T>& A,
+  const vector<const AbstractDistMatrix<T>*>& ASubs ) const
+{
+    EL_DEBUG_CSE
+    if( !Matches( A, ASubs ) )
+        LogicError("Submatrix plan does not match the matrices");
+    const Int numSubs = ASubs.size();
+    for( Int b=0; b<numSubs; ++b )
+        if( ASubs[b]->Height() != subHeights_[b] ||
+            ASubs[b]->Width() != subWidths_[b] )
+            LogicError
+            ("Submatrix ",b," was ",ASubs[b]->Height()," x ",
+             ASubs[b]->Width()," instead of ",subHeights_[b]," x ",
+             subWidths_[b]);
+    if( numSubs == 0 )
+        return;
+
+    vector<T> values;
+    Push( ASubs, values );
+    if( !A.Participating() )
+        return;
+    mpi::Comm redundantComm = A.RedundantComm();
+    const Int numLocalEntries = rows_.size();
+    if( mpi::Size(redundantComm) > 1 )
+    {
+        FastResize( values, numLocalEntries );
+        mpi::Broadcast( values.data(), numLocalEntries, 0, redundantComm );
+    }
+    auto& ALoc = A.Matrix();
+    for( Int k=0; k<numLocalEntries; ++k )
+        ALoc(rows_[k],cols_[k]) = values[k];
+}
+
+} // namespace El
+
+#endif // ifndef EL_BLAS_SUBMATRIXPLAN_HPP
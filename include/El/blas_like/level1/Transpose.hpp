@@ -67,6 +67,132 @@ void PartialColAllGather
 ( const BlockMatrix<T>& A,
         BlockMatrix<T>& B, bool conjugate );
 
+// Local transpose kernels
+// =======================
+// Every local transpose (and adjoint) is performed via a cache-oblivious
+// recursion which halves the larger dimension until the remaining problem
+// fits within a tile of a few cache lines, which is then transposed with
+// contiguous (vectorizable) writes. The matrix is first split into blocks
+// which comfortably fit within the L2 cache so that the blocks may be
+// transposed by independent threads.
+
+// The dimension of the (square) tiles, which span a 64 byte cache line
+template<typename T>
+inline Int TileSize() EL_NO_EXCEPT
+{ return Max( Int(64/sizeof(T)), Int(1) ); }
+
+// The dimension of the (square) blocks distributed over the threads
+template<typename T>
+inline Int BlockSize() EL_NO_EXCEPT
+{ return 16*TileSize<T>(); }
+
+// Apply update(A(i,j),B(j,i)) for an m x n tile of A
+template<typename T,typename Update>
+void TileKernel
+( Int m, Int n, const T* A, Int ldA, T* B, Int ldB, const Update& update )
+{
+    for( Int i=0; i<m; ++i )
+    {
+        T* BRow = &B[i*ldB];
+        EL_SIMD
+        for( Int j=0; j<n; ++j )
+            update( A[i+j*ldA], BRow[j] );
+    }
+}
+
+template<typename T,typename Update>
+void RecursiveKernel
+( Int m, Int n, const T* A, Int ldA, T* B, Int ldB, const Update& update )
+{
+    const Int tileSize = TileSize<T>();
+    if( m <= tileSize && n <= tileSize )
+    {
+        TileKernel( m, n, A, ldA, B, ldB, update );
+    }
+    else if( m >= n )
+    {
+        // Split the rows of A at a multiple of the tile size
+        const Int mTop = ((m/2+tileSize-1)/tileSize)*tileSize;
+        RecursiveKernel( mTop, n, A, ldA, B, ldB, update );
+        RecursiveKernel
+        ( m-mTop, n, &A[mTop], ldA, &B[mTop*ldB], ldB, update );
+    }
+    else
+    {
+        // Split the columns of A at a multiple of the tile size
+        const Int nLeft = ((n/2+tileSize-1)/tileSize)*tileSize;
+        RecursiveKernel( m, nLeft, A, ldA, B, ldB, update );
+        RecursiveKernel
+        ( m, n-nLeft, &A[nLeft*ldA], ldA, &B[nLeft], ldB, update );
+    }
+}
+
+// Apply update(A(i,j),B(j,i)) for each entry of the m x n matrix A, where
+// A and B must not overlap
+template<typename T,typename Update>
+void Kernel
+( Int m, Int n, const T* A, Int ldA, T* B, Int ldB, const Update& update )
+{
+    const Int blockSize = BlockSize<T>();
+    const Int mBlocks = (m+blockSize-1)/blockSize;
+    const Int nBlocks = (n+blockSize-1)/blockSize;
+    EL_PARALLEL_FOR_IF(ParallelizeLoop(m*n))
+    for( Int block=0; block<mBlocks*nBlocks; ++block )
+    {
+        const Int i = (block % mBlocks)*blockSize;
+        const Int j = (block / mBlocks)*blockSize;
+        RecursiveKernel
+        ( Min(blockSize,m-i), Min(blockSize,n-j),
+          &A[i+j*ldA], ldA, &B[j+i*ldB], ldB, update );
+    }
+}
+
+// Overwrite the n x n matrix A with its (conjugate-)transpose by swapping
+// each pair of mirrored tiles
+template<typename T>
+void InPlaceKernel( Int n, T* A, Int ldA, bool conjugate )
+{
+    const Int tileSize = TileSize<T>();
+    const Int numTiles = (n+tileSize-1)/tileSize;
+    const Int numPairs = (numTiles*(numTiles+1))/2;
+    EL_PARALLEL_FOR_IF(ParallelizeLoop(n*n))
+    for( Int pair=0; pair<numPairs; ++pair )
+    {
+        // Map the pair index to the tile (I,J) with I <= J
+        Int J = Int((std::sqrt(8*double(pair)+1)-1)/2);
+        while( (J*(J+1))/2 > pair )
+            --J;
+        while( ((J+1)*(J+2))/2 <= pair )
+            ++J;
+        const Int I = pair - (J*(J+1))/2;
+
+        const Int iBeg = I*tileSize;
+        const Int jBeg = J*tileSize;
+        const Int iEnd = Min(iBeg+tileSize,n);
+        const Int jEnd = Min(jBeg+tileSize,n);
+        for( Int j=jBeg; j<jEnd; ++j )
+        {
+            const Int iStop = ( I == J ? j : iEnd );
+            for( Int i=iBeg; i<iStop; ++i )
+            {
+                const T alpha = A[i+j*ldA];
+                if( conjugate )
+                {
+                    A[i+j*ldA] = Conj(A[j+i*ldA]);
+                    A[j+i*ldA] = Conj(alpha);
+                }
+                else
+                {
+                    A[i+j*ldA] = A[j+i*ldA];
+                    A[j+i*ldA] = alpha;
+                }
+            }
+            if( conjugate && I == J )
+                A[j+j*ldA] = Conj(A[j+j*ldA]);
+        }
+    }
+}
+
 } // namespace transpose
 
 template<typename T>
@@ -75,6 +201,11 @@ void Transpose( const Matrix<T>& A, Matrix<T>& B, bool conjugate )
     EL_DEBUG_CSE
     const Int m = A.Height();
     const Int n = A.Width();
+    if( &A == &B )
+    {
+        Transpose( B, conjugate );
+        return;
+    }
     B.Resize( n, m );
 #ifdef EL_HAVE_MKL
     Orientation orient = ( conjugate ? ADJOINT : TRANSPOSE );
@@ -83,51 +214,38 @@ void Transpose( const Matrix<T>& A, Matrix<T>& B, bool conjugate )
 #else
     // OpenBLAS's {i,o}matcopy routines where disabled for the reasons detailed
     // in src/core/imports/openblas.cpp
-    
-    // Blocked matrix transpose
-    // Note: block size should be a multiple of cache line size and
-    // should be small enough to fit in L1 cache. On recent Intel
-    // CPUs, cache line size is 64 B and L1 cache is 32 KB per core.
-    const Int bsize = Max( 64 / sizeof(T), 1 );
     const T* ABuf = A.LockedBuffer();
           T* BBuf = B.Buffer();
     const Int ldA = A.LDim();
     const Int ldB = B.LDim();
     if( conjugate )
+        transpose::Kernel
+        ( m, n, ABuf, ldA, BBuf, ldB,
+          []( const T& alpha, T& beta ) { beta = Conj(alpha); } );
+    else
+        transpose::Kernel
+        ( m, n, ABuf, ldA, BBuf, ldB,
+          []( const T& alpha, T& beta ) { beta = alpha; } );
+#endif
+}
+
+template<typename T>
+void Transpose( Matrix<T>& A, bool conjugate )
+{
+    EL_DEBUG_CSE
+    const Int m = A.Height();
+    const Int n = A.Width();
+    if( m == n )
     {
-        EL_PARALLEL_FOR_COLLAPSE2
-        for( Int j=0; j<n; j+=bsize )
-        {
-            for( Int i=0; i<m; i+=bsize )
-            {
-                const Int mb = Min( bsize, m - i );
-                const Int nb = Min( bsize, n - j );
-                const T* ABlockBuf = &ABuf[i+j*ldA];
-                      T* BBlockBuf = &BBuf[j+i*ldB];
-                for( Int jb=0; jb<nb; ++jb )
-                    for( Int ib=0; ib<mb; ++ib )
-                        BBlockBuf[jb+ib*ldB] = Conj(ABlockBuf[ib+jb*ldA]);
-            }
-        }
+        transpose::InPlaceKernel( n, A.Buffer(), A.LDim(), conjugate );
     }
     else
     {
-        EL_PARALLEL_FOR_COLLAPSE2
-        for( Int j=0; j<n; j+=bsize )
-        {
-            for( Int i=0; i<m; i+=bsize )
-            {
-                const Int mb = Min( bsize, m - i );
-                const Int nb = Min( bsize, n - j );
-                const T* ABlockBuf = &ABuf[i+j*ldA];
-                      T* BBlockBuf = &BBuf[j+i*ldB];
-                for( Int jb=0; jb<nb; ++jb )
-                    for( Int ib=0; ib<mb; ++ib )
-                        BBlockBuf[jb+ib*ldB] = ABlockBuf[ib+jb*ldA];
-            }
-        }
+        if( A.Viewing() )
+            LogicError("Cannot transpose a nonsquare view in place");
+        Matrix<T> ACopy( A );
+        Transpose( ACopy, A, conjugate );
     }
-#endif
 }
 
 template<typename T>
@@ -325,6 +443,13 @@ void Adjoint( const Matrix<T>& A, Matrix<T>& B )
     Transpose( A, B, true );
 }
 
+template<typename T>
+void Adjoint( Matrix<T>& A )
+{
+    EL_DEBUG_CSE
+    Transpose( A, true );
+}
+
 template<typename T>
 void Adjoint( const ElementalMatrix<T>& A, ElementalMatrix<T>& B )
 {
@@ -372,6 +497,8 @@ void Adjoint( const DistSparseMatrix<T>& A, DistSparseMatrix<T>& B )
   EL_EXTERN template void Transpose \
   ( const Matrix<T>& A, Matrix<T>& B, bool conjugate ); \
   EL_EXTERN template void Transpose \
+  ( Matrix<T>& A, bool conjugate ); \
+  EL_EXTERN template void Transpose \
   ( const ElementalMatrix<T>& A, ElementalMatrix<T>& B, bool conjugate ); \
   EL_EXTERN template void Transpose \
   ( const BlockMatrix<T>& A, BlockMatrix<T>& B, bool conjugate ); \
@@ -385,6 +512,8 @@ void Adjoint( const DistSparseMatrix<T>& A, DistSparseMatrix<T>& B )
   EL_EXTERN template void Adjoint \
   ( const Matrix<T>& A, Matrix<T>& B ); \
   EL_EXTERN template void Adjoint \
+  ( Matrix<T>& A ); \
+  EL_EXTERN template void Adjoint \
   ( const ElementalMatrix<T>& A, ElementalMatrix<T>& B ); \
   EL_EXTERN template void Adjoint \
   ( const BlockMatrix<T>& A, BlockMatrix<T>& B ); \
@@ -53,26 +53,14 @@ void TransposeAxpy
           if( mX != nY || nX != mY )
               LogicError("Nonconformal TransposeAxpy");
         )
-        if( nX <= mX )
-        {
-            if( conjugate )
-                for( Int j=0; j<nX; ++j )
-                    for( Int i=0; i<mX; ++i )
-                        YBuf[j+i*ldY] += alpha*Conj(XBuf[i+j*ldX]);
-            else
-                for( Int j=0; j<nX; ++j )
-                    blas::Axpy( mX, alpha, &XBuf[j*ldX], 1, &YBuf[j], ldY );
-        }
+        if( conjugate )
+            transpose::Kernel
+            ( mX, nX, XBuf, ldX, YBuf, ldY,
+              [&]( const T& chi, T& psi ) { psi += alpha*Conj(chi); } );
         else
-        {
-            if( conjugate )
-                for( Int i=0; i<mX; ++i )
-                    for( Int j=0; j<nX; ++j )
-                        YBuf[j+i*ldY] += alpha*Conj(XBuf[i+j*ldX]);
-            else
-                for( Int i=0; i<mX; ++i )
-                    blas::Axpy( nX, alpha, &XBuf[i], ldX, &YBuf[i*ldY], 1 );
-        }
+            transpose::Kernel
+            ( mX, nX, XBuf, ldX, YBuf, ldY,
+              [&]( const T& chi, T& psi ) { psi += alpha*chi; } );
     }
 }
 
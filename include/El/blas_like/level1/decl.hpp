@@ -23,6 +23,9 @@ namespace El {
 // =======
 template<typename Ring>
 void Adjoint( const Matrix<Ring>& A, Matrix<Ring>& B );
+// Overwrite A with its adjoint
+template<typename Ring>
+void Adjoint( Matrix<Ring>& A );
 template<typename Ring>
 void Adjoint( const ElementalMatrix<Ring>& A, ElementalMatrix<Ring>& B );
 template<typename Ring>
@@ -81,6 +84,89 @@ void AllReduce( Matrix<T>& A, mpi::Comm comm, mpi::Op op=mpi::SUM );
 template<typename T>
 void AllReduce( AbstractDistMatrix<T>& A, mpi::Comm comm, mpi::Op op=mpi::SUM );
 
+// Batched reductions
+// ==================
+// Accumulate the local contributions to several (possibly different kinds
+// of) reductions, e.g., the inner products, residual norms, and maximum
+// entries computed during each iteration of an interior point method, and
+// complete them with (optionally nonblocking) AllReduce's over 'comm',
+// rather than paying the latency of one collective per result. The sums,
+// the maxima and minima, and the two-norms are each combined by a single
+// collective, so that there are at most three, which are overlapped.
+//
+// The routines for distributed matrices only count the contributions of a
+// single copy of any redundantly-stored data, and so 'comm' should contain
+// every process in the Grid(s) of the matrices (e.g., Grid::Comm()).
+//
+// NOTE: The two-norms are combined with the user-defined commutative
+//       reduction over Base<Field>, which should therefore not be modified by
+//       other routines between 'Start' and 'Finish'.
+template<typename Field>
+class ReductionBatch
+{
+public:
+    typedef Base<Field> Real;
+
+    ReductionBatch( mpi::Comm comm=mpi::COMM_SELF );
+
+    // Queue a reduction of local contributions and return its index
+    Int AddSum( const Field& localValue );
+    Int AddMax( const Real& localValue );
+    Int AddMin( const Real& localValue );
+    // The local two-norm is given by localScale*sqrt(localScaledSquare),
+    // as produced by UpdateScaledSquare
+    Int AddTwoNorm( const Real& localScale, const Real& localScaledSquare );
+
+    // Queue a reduction of (the local portion of) a matrix
+    Int AddDot( const Matrix<Field>& A, const Matrix<Field>& B );
+    Int AddDot
+    ( const AbstractDistMatrix<Field>& A, const AbstractDistMatrix<Field>& B );
+    Int AddDot( const DistMultiVec<Field>& A, const DistMultiVec<Field>& B );
+
+    Int AddFrobeniusNorm( const Matrix<Field>& A );
+    Int AddFrobeniusNorm( const AbstractDistMatrix<Field>& A );
+    Int AddFrobeniusNorm( const DistMultiVec<Field>& A );
+
+    Int AddMaxAbs( const Matrix<Field>& A );
+    Int AddMaxAbs( const AbstractDistMatrix<Field>& A );
+    Int AddMaxAbs( const DistMultiVec<Field>& A );
+
+    // Complete every queued reduction
+    void Reduce();
+
+    // Begin (and then complete) every queued reduction without blocking
+    void Start();
+    void Finish();
+
+    Field Get( Int index ) const;
+    Int NumReductions() const EL_NO_EXCEPT;
+
+    // Remove every queued reduction (and result)
+    void Clear();
+
+private:
+    enum Kind
+    {
+      SUM_REDUCTION,
+      MAX_REDUCTION,
+      MIN_REDUCTION,
+      TWO_NORM_REDUCTION
+    };
+
+    mpi::Comm comm_;
+    // The kind of each reduction and the offset of its value within the
+    // buffer of its kind (complex sums occupy two entries)
+    vector<Kind> kinds_;
+    vector<Int> offsets_;
+    // The minima are negated so that they may be combined with the maxima
+    vector<Real> sums_, maxes_, norms_;
+    vector<Real> sumResults_, maxResults_, normResults_;
+    mpi::Request<Real> sumRequest_, maxRequest_, normRequest_;
+    bool started_=false, finished_=false;
+
+    Int Queue( Kind kind, const Field& localValue );
+};
+
 // Axpy
 // ====
 template<typename Ring1,typename Ring2>
@@ -158,6 +244,32 @@ void LocalAxpyTrapezoid
   const AbstractDistMatrix<Ring>& X,
         AbstractDistMatrix<Ring>& Y, Int offset=0 );
 
+// BalanceRows
+// ===========
+// Since the rows of distributed graphs, sparse matrices, and multivectors are
+// always distributed in contiguous blocks of (nearly) equal size, their
+// nonzeros are balanced by a permutation of the rows. 'rowMap' is set to a
+// map from each original row to its new index which nearly equalizes the
+// number of local nonzeros while moving as few rows as possible.
+//
+// The map should be applied (with PermuteDistMapRows) to the rows of the
+// matrix and of any conformal multivectors (e.g., the right-hand sides), and
+// PermuteDistMapCols should be applied to the columns of a symmetric matrix.
+// The original ordering can be recovered with the inverse map (see InvertMap).
+void BalanceRows( const DistGraph& graph, DistMap& rowMap );
+template<typename T>
+void BalanceRows( const DistSparseMatrix<T>& A, DistMap& rowMap );
+
+// Move row i of A (or X) to row rowMap(i)
+template<typename T>
+void PermuteDistMapRows( const DistMap& rowMap, DistSparseMatrix<T>& A );
+template<typename T>
+void PermuteDistMapRows( const DistMap& rowMap, DistMultiVec<T>& X );
+
+// Move column j of A to column colMap(j)
+template<typename T>
+void PermuteDistMapCols( const DistMap& colMap, DistSparseMatrix<T>& A );
+
 // Broadcast
 // =========
 template<typename T>
@@ -484,8 +596,23 @@ void Contract( const BlockMatrix<T>& A, BlockMatrix<T>& B );
 // Copy
 // ====
 
+// The general-purpose redistribution (used when no specialized routine exists
+// for the pair of distributions) can retain up to 'numPlans' precomputed
+// communication plans for each pair of grids so that repeated redistributions
+// between the same configurations avoid recomputing their index maps. The
+// default capacity of zero disables the cache.
+void SetRedistPlanCacheSize( Int numPlans );
+Int RedistPlanCacheSize();
+void ClearRedistPlanCache();
+
 template<typename T>
 void Copy( const Matrix<T>& A, Matrix<T>& B );
+#ifdef EL_HAVE_MPC
+// When the entries of both matrices share the same precision and their limbs
+// lie within the contiguous arenas of their buffers, the limbs are copied in
+// bulk rather than entry by entry
+void Copy( const Matrix<BigFloat>& A, Matrix<BigFloat>& B );
+#endif
 template<typename S,typename T,
          typename=EnableIf<And< CanCast<S,T>, Not<IsSame<S,T>> >>>
 void Copy( const Matrix<S>& A, Matrix<T>& B );
@@ -520,6 +647,33 @@ template<typename T>
 void CopyFromNonRoot( DistMatrix<T,CIRC,CIRC,BLOCK>& B,
   bool includingViewers=false );
 
+// Moves A onto a grid over the same processes, typically one of a different
+// shape from ReshapedGrid (see RecommendGridHeight), using a single exchange
+// between the processes
+template<typename T>
+void Regrid( DistMatrix<T>& A, const Grid& grid );
+
+// Streams the columns of A through process 'root' of the VC communicator of
+// its grid in blocks of at most 'blockWidth' columns: the root passes each
+// gathered block, along with the index of its first column, to 'writer'
+// while the next block is in transit. Unlike a copy into [CIRC,CIRC], the
+// root thus never holds more than two blocks (e.g., when writing to disk).
+template<typename T>
+void GatherColumnBlocks
+( const ElementalMatrix<T>& A,
+  const function<void(Int,const Matrix<T>&)>& writer,
+  Int blockWidth, int root=0 );
+
+// The reverse of GatherColumnBlocks: the root fills each block of (at most)
+// 'blockWidth' columns of B, which must already have its final size, by
+// calling 'reader' with the index of the first column and a block of the
+// appropriate size while the previous block is being scattered.
+template<typename T>
+void ScatterColumnBlocks
+( const function<void(Int,Matrix<T>&)>& reader,
+  ElementalMatrix<T>& B,
+  Int blockWidth, int root=0 );
+
 void Copy( const Graph& A, Graph& B );
 void Copy( const Graph& A, DistGraph& B );
 void Copy( const DistGraph& A, Graph& B );
@@ -539,6 +693,12 @@ template<typename S,typename T,
          typename=EnableIf<CanCast<S,T>>>
 void Copy( const SparseMatrix<S>& A, Matrix<T>& B );
 
+// Convert to and from block compressed sparse row format
+template<typename T>
+void Copy( const SparseMatrix<T>& A, BlockSparseMatrix<T>& B, Int blockSize );
+template<typename T>
+void Copy( const BlockSparseMatrix<T>& A, SparseMatrix<T>& B );
+
 template<typename T>
 void Copy( const DistSparseMatrix<T>& A, DistSparseMatrix<T>& B );
 
@@ -571,9 +731,72 @@ void CopyFromRoot( const DistMultiVec<T>& XDist, Matrix<T>& X );
 template<typename T>
 void CopyFromNonRoot( const DistMultiVec<T>& XDist, int root=0 );
 
+// Nonblocking redistribution
+// --------------------------
+// CopyAsync begins the redistribution of A into B and returns a request which
+// must be completed (via Test or Wait) before B is read or resized and before
+// A is modified. Only the AllGather-style redistributions of the form
+// [U,V] -> [U,Collect(V)] and [U,V] -> [Collect(U),V] are currently
+// overlapped; all other redistributions complete before CopyAsync returns.
+
+template<typename T> class CopyRequest;
+
+namespace copy {
+template<typename T>
+void RowAllGatherAsync
+( const ElementalMatrix<T>& A, ElementalMatrix<T>& B, CopyRequest<T>& req );
+template<typename T>
+void ColAllGatherAsync
+( const ElementalMatrix<T>& A, ElementalMatrix<T>& B, CopyRequest<T>& req );
+} // namespace copy
+
+template<typename T>
+class CopyRequest
+{
+public:
+    CopyRequest() { }
+    ~CopyRequest();
+
+    bool Active() const { return active_; }
+
+    // Returns true (after unpacking) if the redistribution has completed
+    bool Test();
+    void Wait();
+
+private:
+    bool active_=false;
+    mpi::Request<T> request_;
+    Memory<T> buffer_;
+    function<void()> unpack_;
+
+    void Finish();
+
+    template<typename U>
+    friend void copy::RowAllGatherAsync
+    ( const ElementalMatrix<U>& A, ElementalMatrix<U>& B,
+      CopyRequest<U>& req );
+    template<typename U>
+    friend void copy::ColAllGatherAsync
+    ( const ElementalMatrix<U>& A, ElementalMatrix<U>& B,
+      CopyRequest<U>& req );
+};
+
+template<typename T>
+void CopyAsync
+( const ElementalMatrix<T>& A, ElementalMatrix<T>& B, CopyRequest<T>& req );
+
 namespace copy {
 namespace util {
 
+template<typename T>
+void AllGather
+( const T* sbuf, T* rbuf, Int count,
+  const Grid& g, Dist dist, mpi::Comm comm );
+template<typename T>
+void ReduceScatter
+( T* sbuf, T* rbuf, Int count,
+  const Grid& g, Dist dist, mpi::Comm comm );
+
 template<typename T>
 void InterleaveMatrix
 ( Int height, Int width,
@@ -824,6 +1047,14 @@ void EntrywiseFill( AbstractDistMatrix<T>& A, function<T(void)> func );
 template<typename T>
 void EntrywiseFill( DistMultiVec<T>& A, function<T(void)> func );
 
+// Versions which accept (and can inline) arbitrary callables
+template<typename T,typename Function>
+void EntrywiseFill( Matrix<T>& A, Function func );
+template<typename T,typename Function>
+void EntrywiseFill( AbstractDistMatrix<T>& A, Function func );
+template<typename T,typename Function>
+void EntrywiseFill( DistMultiVec<T>& A, Function func );
+
 // EntrywiseMap
 // ============
 template<typename T>
@@ -856,6 +1087,33 @@ void EntrywiseMap
 ( const DistMultiVec<S>& A, DistMultiVec<T>& B,
   function<T(const S&)> func );
 
+// Versions which accept (and can inline) arbitrary callables
+template<typename T,typename Function>
+void EntrywiseMap( Matrix<T>& A, Function func );
+template<typename T,typename Function>
+void EntrywiseMap( SparseMatrix<T>& A, Function func );
+template<typename T,typename Function>
+void EntrywiseMap( AbstractDistMatrix<T>& A, Function func );
+template<typename T,typename Function>
+void EntrywiseMap( DistSparseMatrix<T>& A, Function func );
+template<typename T,typename Function>
+void EntrywiseMap( DistMultiVec<T>& A, Function func );
+
+template<typename S,typename T,typename Function>
+void EntrywiseMap( const Matrix<S>& A, Matrix<T>& B, Function func );
+template<typename S,typename T,typename Function>
+void EntrywiseMap
+( const SparseMatrix<S>& A, SparseMatrix<T>& B, Function func );
+template<typename S,typename T,typename Function>
+void EntrywiseMap
+( const AbstractDistMatrix<S>& A, AbstractDistMatrix<T>& B, Function func );
+template<typename S,typename T,typename Function>
+void EntrywiseMap
+( const DistSparseMatrix<S>& A, DistSparseMatrix<T>& B, Function func );
+template<typename S,typename T,typename Function>
+void EntrywiseMap
+( const DistMultiVec<S>& A, DistMultiVec<T>& B, Function func );
+
 // Fill
 // ====
 template<typename T>
@@ -1018,6 +1276,7 @@ void GetSubgraph
 
 // GetSubmatrix
 // ============
+// (see SubmatrixPlan for repeated extractions of the same index sets)
 
 // Return a view
 // ----------
@@ -1192,6 +1451,12 @@ template<typename T>
 void IndexDependentFill
 ( AbstractDistMatrix<T>& A, function<T(Int,Int)> func );
 
+// Versions which accept (and can inline) arbitrary callables
+template<typename T,typename Function>
+void IndexDependentFill( Matrix<T>& A, Function func );
+template<typename T,typename Function>
+void IndexDependentFill( AbstractDistMatrix<T>& A, Function func );
+
 // IndexDependentMap
 // =================
 template<typename T>
@@ -1221,6 +1486,29 @@ void IndexDependentMap
         DistMatrix<T,U,V,BLOCK>& B,
         function<T(Int,Int,const S&)> func );
 
+// Versions which accept (and can inline) arbitrary callables
+template<typename T,typename Function>
+void IndexDependentMap( Matrix<T>& A, Function func );
+template<typename T,typename Function>
+void IndexDependentMap( AbstractDistMatrix<T>& A, Function func );
+template<typename S,typename T,typename Function>
+void IndexDependentMap( const Matrix<S>& A, Matrix<T>& B, Function func );
+template<typename S,typename T,Dist U,Dist V,DistWrap wrap,typename Function>
+void IndexDependentMap
+( const DistMatrix<S,U,V,wrap>& A,
+        DistMatrix<T,U,V,wrap>& B,
+        Function func );
+template<typename S,typename T,Dist U,Dist V,typename Function>
+void IndexDependentMap
+( const AbstractDistMatrix<S>& A,
+        DistMatrix<T,U,V>& B,
+        Function func );
+template<typename S,typename T,Dist U,Dist V,typename Function>
+void IndexDependentMap
+( const AbstractDistMatrix<S>& A,
+        DistMatrix<T,U,V,BLOCK>& B,
+        Function func );
+
 // Kronecker product
 // =================
 template<typename T>
@@ -1291,6 +1579,9 @@ void MakeSymmetric( UpperOrLower uplo, Matrix<T>& A, bool conjugate=false );
 template<typename T>
 void MakeSymmetric
 ( UpperOrLower uplo, ElementalMatrix<T>& A, bool conjugate=false );
+template<typename T,Int N>
+void MakeSymmetric
+( UpperOrLower uplo, FixedMatrix<T,N,N>& A, bool conjugate=false );
 
 template<typename T>
 void MakeSymmetric
@@ -1605,6 +1896,33 @@ void RealPart
 ( const AbstractDistMatrix<T>& A, AbstractDistMatrix<Base<T>>& AReal );
 /* TODO(poulson): Sparse versions */
 
+// ReverseCuthillMcKee
+// ===================
+// Compute the Reverse Cuthill-McKee ordering of the symmetrized sparsity
+// pattern of a square graph (or sparse matrix), so that P.Image(i) (or
+// map(i)) is the new index of vertex i. The resulting reduction of the
+// bandwidth improves the locality of the accesses of sparse matrix-vector
+// products.
+//
+// In the distributed case, the graph is gathered to and ordered by the root.
+void ReverseCuthillMcKee( const Graph& graph, Permutation& P );
+void ReverseCuthillMcKee( const DistGraph& graph, DistMap& map );
+template<typename T>
+void ReverseCuthillMcKee( const SparseMatrix<T>& A, Permutation& P );
+template<typename T>
+void ReverseCuthillMcKee( const DistSparseMatrix<T>& A, DistMap& map );
+
+// Overwrite A with P A P^T, i.e., move entry (i,j) to (P(i),P(j)).
+// Conformal vectors should be permuted with P.PermuteRows (or, in the
+// distributed case, with PermuteDistMapRows).
+//
+// Any DistMap (e.g., one from nested dissection) can be applied by the
+// distributed version.
+template<typename T>
+void PermuteSymmetrically( const Permutation& P, SparseMatrix<T>& A );
+template<typename T>
+void PermuteSymmetrically( const DistMap& map, DistSparseMatrix<T>& A );
+
 // Reshape
 // =======
 template<typename T>
@@ -1612,6 +1930,12 @@ void Reshape( Int m, Int n, const Matrix<T>& A, Matrix<T>& B );
 template<typename T>
 Matrix<T> Reshape( Int m, Int n, const Matrix<T>& A );
 
+// Views of matrices with contiguous columns as m x n matrices (no copies)
+template<typename T>
+void ReshapedView( Int m, Int n, Matrix<T>& A, Matrix<T>& B );
+template<typename T>
+void LockedReshapedView( Int m, Int n, const Matrix<T>& A, Matrix<T>& B );
+
 template<typename T>
 void Reshape
 ( Int m, Int n, const AbstractDistMatrix<T>& A, AbstractDistMatrix<T>& B );
@@ -1693,6 +2017,16 @@ void Transform2x2Cols
 ( const AbstractDistMatrix<T>& G,
         AbstractDistMatrix<T>& A, Int j1, Int j2 );
 
+// Fully unrolled versions for a fixed-size G
+template<typename T>
+void Transform2x2Rows
+( const FixedMatrix<T,2,2>& G,
+        Matrix<T>& A, Int i1, Int i2 );
+template<typename T>
+void Transform2x2Cols
+( const FixedMatrix<T,2,2>& G,
+        Matrix<T>& A, Int j1, Int j2 );
+
 // TODO(poulson): SymmetricTransform2x2?
 
 // Rotate (via Givens)
@@ -1925,6 +2259,10 @@ void HermitianSwap
 template<typename Field>
 void Symmetric2x2Inv
 ( UpperOrLower uplo, Matrix<Field>& D, bool conjugate=false );
+// Unlike the above, both triangles of the (symmetric) inverse are formed
+template<typename Field>
+void Symmetric2x2Inv
+( UpperOrLower uplo, FixedMatrix<Field,2,2>& D, bool conjugate=false );
 
 // Shift
 // =====
@@ -1955,6 +2293,10 @@ void Transpose
 ( const Matrix<T>& A,
         Matrix<T>& B,
   bool conjugate=false );
+// Overwrite A with its (conjugate-)transpose, which is performed without a
+// temporary copy when A is square
+template<typename T>
+void Transpose( Matrix<T>& A, bool conjugate=false );
 template<typename T>
 void Transpose
 ( const ElementalMatrix<T>& A,
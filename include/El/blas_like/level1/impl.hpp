@@ -20,6 +20,7 @@
 #include <El/blas_like/level1/ConjugateSubmatrix.hpp>
 #include <El/blas_like/level1/Contract.hpp>
 #include <El/blas_like/level1/Copy.hpp>
+#include <El/blas_like/level1/CopyAsync.hpp>
 #include <El/blas_like/level1/DiagonalScale.hpp>
 #include <El/blas_like/level1/DiagonalScaleTrapezoid.hpp>
 #include <El/blas_like/level1/DiagonalSolve.hpp>
@@ -28,6 +29,7 @@
 #include <El/blas_like/level1/EntrywiseMap.hpp>
 #include <El/blas_like/level1/Fill.hpp>
 #include <El/blas_like/level1/FillDiagonal.hpp>
+#include <El/blas_like/level1/FixedSize.hpp>
 #include <El/blas_like/level1/Full.hpp>
 #include <El/blas_like/level1/GetDiagonal.hpp>
 #include <El/blas_like/level1/GetMappedDiagonal.hpp>
@@ -38,6 +40,7 @@
 #include <El/blas_like/level1/IndexDependentFill.hpp>
 #include <El/blas_like/level1/IndexDependentMap.hpp>
 #include <El/blas_like/level1/Kronecker.hpp>
+#include <El/blas_like/level1/Lazy.hpp>
 #include <El/blas_like/level1/MakeReal.hpp>
 #include <El/blas_like/level1/MakeDiagonalReal.hpp>
 #include <El/blas_like/level1/MakeSubmatrixReal.hpp>
@@ -60,6 +63,7 @@
 #include <El/blas_like/level1/SetSubmatrix.hpp>
 #include <El/blas_like/level1/Shift.hpp>
 #include <El/blas_like/level1/ShiftDiagonal.hpp>
+#include <El/blas_like/level1/SubmatrixPlan.hpp>
 #include <El/blas_like/level1/Transpose.hpp>
 #include <El/blas_like/level1/TransposeAxpy.hpp>
 #include <El/blas_like/level1/TransposeAxpyContract.hpp>
@@ -19,6 +19,9 @@ struct SymvCtrl
 {
     Int bsize=LocalSymvBlocksize<T>();
     bool avoidTrmvBasedLocalSymv=true;
+    // Use a single pass over each stored entry of the local triangle (see
+    // symv::FusedLocal) rather than blocked Gemv/Trmv calls
+    bool fusedLocalKernel=false;
 };
 
 // Gemv
@@ -65,6 +68,22 @@ void LocalGemv
   T alpha, const AbstractDistMatrix<T>& A, const AbstractDistMatrix<T>& x,
   T beta,        AbstractDistMatrix<T>& y );
 
+// Band matrices (with any number of columns in X and Y); the rows of the
+// distributed variant only communicate with the neighboring processes when
+// each owns at least as many rows as the bandwidths
+template<typename T>
+void Gemv
+( Orientation orientation,
+  T alpha, const BandMatrix<T>& A,
+           const Matrix<T>& X,
+  T beta,        Matrix<T>& Y );
+template<typename T>
+void Gemv
+( Orientation orientation,
+  T alpha, const DistBandMatrix<T>& A,
+           const DistMultiVec<T>& X,
+  T beta,        DistMultiVec<T>& Y );
+
 // Ger
 // ===
 template<typename T>
@@ -278,6 +297,28 @@ void ApplyGivensSequence
   const Matrix<Base<F>>& sList,
   Matrix<F>& A );
 
+// A VARIABLE_GIVENS_SEQUENCE of real rotations which, when applied from the
+// right, rotates the columns (offset+k,offset+k+1) of a matrix by
+// (cList(k),sList(k)), in increasing (decreasing) order of k if 'direction'
+// is FORWARD (BACKWARD)
+template<typename Real>
+struct GivensSequence
+{
+    Int offset=0;
+    ForwardOrBackward direction=FORWARD;
+    Matrix<Real> cList, sList;
+};
+
+// Applies sequences[0], sequences[1], ... from the right to A. Rather than
+// sweeping over all of A for each rotation, A is traversed in blocks of rows
+// which remain cache-resident while every rotation of every sequence is
+// applied to them, and the row blocks are distributed over threads. Rotation
+// sequences from several QR sweeps should therefore be batched before being
+// applied to accumulated eigenvectors or singular vectors.
+template<typename F>
+void ApplyGivensSequences
+( const vector<GivensSequence<Base<F>>>& sequences, Matrix<F>& A );
+
 } // namespace El
 
 #endif // ifndef EL_BLAS2_HPP
@@ -17,6 +17,7 @@ ElSymvCtrl CReflect( const SymvCtrl<T>& ctrl )
     ElSymvCtrl ctrlC;
     ctrlC.bsize = ctrl.bsize;
     ctrlC.avoidTrmvBasedLocalSymv = ctrl.avoidTrmvBasedLocalSymv;
+    ctrlC.fusedLocalKernel = ctrl.fusedLocalKernel;
     return ctrlC;
 }
 
@@ -26,6 +27,7 @@ SymvCtrl<T> CReflect( const ElSymvCtrl& ctrlC )
     SymvCtrl<T> ctrl;
     ctrl.bsize = ctrlC.bsize;
     ctrl.avoidTrmvBasedLocalSymv = ctrlC.avoidTrmvBasedLocalSymv;
+    ctrl.fusedLocalKernel = ctrlC.fusedLocalKernel;
     return ctrl;
 }
 
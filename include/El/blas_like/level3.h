@@ -91,6 +91,31 @@ EL_EXPORT ElError ElGemmXDist_z
   complex_double alpha, ElConstDistMatrix_z A, ElConstDistMatrix_z B,
   complex_double beta,  ElDistMatrix_z C, ElGemmAlgorithm alg );
 
+/* Batched version
+   ^^^^^^^^^^^^^^^
+   C[k] := alpha op(A[k]) op(B[k]) + beta C[k] for 0 <= k < batchSize within
+   a single call (in order to amortize the overhead of the C interface) */
+EL_EXPORT ElError ElGemmBatched_i
+( ElOrientation orientationOfA, ElOrientation orientationOfB,
+  ElInt alpha, const ElConstMatrix_i* A, const ElConstMatrix_i* B,
+  ElInt beta,  const ElMatrix_i* C, ElInt batchSize );
+EL_EXPORT ElError ElGemmBatched_s
+( ElOrientation orientationOfA, ElOrientation orientationOfB,
+  float alpha, const ElConstMatrix_s* A, const ElConstMatrix_s* B,
+  float beta,  const ElMatrix_s* C, ElInt batchSize );
+EL_EXPORT ElError ElGemmBatched_d
+( ElOrientation orientationOfA, ElOrientation orientationOfB,
+  double alpha, const ElConstMatrix_d* A, const ElConstMatrix_d* B,
+  double beta,  const ElMatrix_d* C, ElInt batchSize );
+EL_EXPORT ElError ElGemmBatched_c
+( ElOrientation orientationOfA, ElOrientation orientationOfB,
+  complex_float alpha, const ElConstMatrix_c* A, const ElConstMatrix_c* B,
+  complex_float beta,  const ElMatrix_c* C, ElInt batchSize );
+EL_EXPORT ElError ElGemmBatched_z
+( ElOrientation orientationOfA, ElOrientation orientationOfB,
+  complex_double alpha, const ElConstMatrix_z* A, const ElConstMatrix_z* B,
+  complex_double beta,  const ElMatrix_z* C, ElInt batchSize );
+
 /* Hemm
    ==== */
 EL_EXPORT ElError ElHemm_c
@@ -706,6 +731,30 @@ EL_EXPORT ElError ElTrsmDist_z
   ElOrientation orientation, ElUnitOrNonUnit diag,
   complex_double alpha, ElConstDistMatrix_z A, ElDistMatrix_z B );
 
+/* Batched version
+   ^^^^^^^^^^^^^^^
+   Solves with A[k] against B[k] for 0 <= k < batchSize within a single call */
+EL_EXPORT ElError ElTrsmBatched_s
+( ElLeftOrRight side, ElUpperOrLower uplo,
+  ElOrientation orientation, ElUnitOrNonUnit diag,
+  float alpha, const ElConstMatrix_s* A, const ElMatrix_s* B,
+  ElInt batchSize );
+EL_EXPORT ElError ElTrsmBatched_d
+( ElLeftOrRight side, ElUpperOrLower uplo,
+  ElOrientation orientation, ElUnitOrNonUnit diag,
+  double alpha, const ElConstMatrix_d* A, const ElMatrix_d* B,
+  ElInt batchSize );
+EL_EXPORT ElError ElTrsmBatched_c
+( ElLeftOrRight side, ElUpperOrLower uplo,
+  ElOrientation orientation, ElUnitOrNonUnit diag,
+  complex_float alpha, const ElConstMatrix_c* A, const ElMatrix_c* B,
+  ElInt batchSize );
+EL_EXPORT ElError ElTrsmBatched_z
+( ElLeftOrRight side, ElUpperOrLower uplo,
+  ElOrientation orientation, ElUnitOrNonUnit diag,
+  complex_double alpha, const ElConstMatrix_z* A, const ElMatrix_z* B,
+  ElInt batchSize );
+
 /* Trstrm
    ====== */
 EL_EXPORT ElError ElTrstrm_s
@@ -26,11 +26,86 @@ enum GemmAlgorithm {
   GEMM_SUMMA_B,
   GEMM_SUMMA_C,
   GEMM_SUMMA_DOT,
-  GEMM_CANNON
+  GEMM_CANNON,
+  GEMM_25D
 };
 }
 using namespace GemmAlgorithmNS;
 
+// GEMM_25D splits the process grid into 'numLayers' layers which each perform
+// 1/numLayers of the summation before their (replicated) results are summed.
+// A value of zero for the number of layers selects the largest divisor c of
+// the grid size, with c^3 <= p, whose workspace fits within the per-process
+// memory budget (in bytes), which is capped by AvailableMemory() (see
+// SetMemoryBudget). SUMMA is used whenever a single layer results.
+void SetGemm25DNumLayers( Int numLayers );
+Int Gemm25DNumLayers();
+void SetGemm25DMemoryBudget( double numBytes );
+double Gemm25DMemoryBudget();
+// Frees the cached layered grids (this is called by Finalize)
+void ClearGemm25DGrids();
+
+// An alpha-beta-gamma model of the distributed Gemm algorithms which is used
+// by GEMM_DEFAULT to choose between the SUMMA variants. The latency is in
+// seconds per message, the inverse bandwidth in seconds per byte, and the
+// flop time in seconds per real floating-point operation. The local update
+// is modeled as running at half of its peak rate when the blocksize is
+// 'halfRateBlocksize'. If 'selectBlocksize' is true, GEMM_DEFAULT also
+// selects the algorithmic blocksize rather than using Blocksize().
+struct GemmCostModel
+{
+    double latency=2.e-6;
+    double inverseBandwidth=1.e-9;
+    double flopTime=1.e-10;
+    double halfRateBlocksize=16;
+    bool selectBlocksize=false;
+};
+void SetGemmCostModel( const GemmCostModel& model );
+GemmCostModel GetGemmCostModel();
+// Collectively measures the model parameters using a ping-pong between the
+// first two processes and a local Gemm. The measurements are maximized over
+// the grid so that every process makes the same algorithmic decisions.
+void CalibrateGemmCostModel( const Grid& g=Grid::Default() );
+
+// The predicted time (in seconds) of a distributed Gemm producing an m x n
+// matrix with a summation dimension of k. A blocksize of zero corresponds to
+// Blocksize().
+template<typename T>
+double PredictGemmCost
+( Int m, Int n, Int k, const Grid& g, GemmAlgorithm alg, Int blocksize=0 );
+
+struct GemmChoice
+{
+    GemmAlgorithm alg;
+    Int blocksize;
+    double cost;
+};
+// The SUMMA variant (and, optionally, blocksize) with the lowest predicted
+// cost
+template<typename T>
+GemmChoice SelectGemmAlgorithm( Int m, Int n, Int k, const Grid& g );
+
+// The operations whose process grid shape can be chosen by the cost model
+namespace GridShapeOperationNS {
+enum GridShapeOperation {
+  GRID_SHAPE_GEMM, // an m x n product with a summation dimension of k
+  GRID_SHAPE_TRSM, // a left solve with an m x m triangle and m x n RHS
+  GRID_SHAPE_QR    // a Householder QR factorization of an m x n matrix
+};
+}
+using namespace GridShapeOperationNS;
+
+// The grid height (a divisor of 'numProcs') which minimizes the predicted
+// cost of the operation under the Gemm cost model, with ties going to
+// Grid::DefaultHeight. The argument 'k' is only used by GRID_SHAPE_GEMM.
+// For example, a tall-skinny QR favors tall grids, since its reflectors are
+// only summed within process columns. An existing matrix can then be moved
+// onto a grid of the recommended shape over the same processes with
+// ReshapedGrid and Regrid.
+template<typename T>
+int RecommendGridHeight
+( GridShapeOperation op, Int m, Int n, Int k, int numProcs );
+
 template<typename T>
 void Gemm
 ( Orientation orientA, Orientation orientB,
@@ -53,6 +128,38 @@ void Gemm
   T alpha, const AbstractDistMatrix<T>& A, const AbstractDistMatrix<T>& B,
                  AbstractDistMatrix<T>& C, GemmAlgorithm alg=GEMM_DEFAULT );
 
+// Block-cyclic (ScaLAPACK-compatible) operands are multiplied in place by
+// PBLAS when it is available and supports the datatype
+template<typename T>
+void Gemm
+( Orientation orientA, Orientation orientB,
+  T alpha, const DistMatrix<T,MC,MR,BLOCK>& A,
+           const DistMatrix<T,MC,MR,BLOCK>& B,
+  T beta,        DistMatrix<T,MC,MR,BLOCK>& C );
+
+template<typename T>
+void Gemm
+( Orientation orientA, Orientation orientB,
+  T alpha, const DistMatrix<T,MC,MR,BLOCK>& A,
+           const DistMatrix<T,MC,MR,BLOCK>& B,
+                 DistMatrix<T,MC,MR,BLOCK>& C );
+
+// Tall-skinny products of DistMultiVec's, which only require local Gemm's
+// (and, for the first, a summation of the small replicated result):
+//   C := alpha A^{T/H} B + beta C, where orientB must be NORMAL, and
+//   C := alpha A op(B) + beta C, where orientA must be NORMAL and B is
+//   replicated over the grid of A and C.
+template<typename T>
+void Gemm
+( Orientation orientA, Orientation orientB,
+  T alpha, const DistMultiVec<T>& A, const DistMultiVec<T>& B,
+  T beta,        Matrix<T>& C );
+template<typename T>
+void Gemm
+( Orientation orientA, Orientation orientB,
+  T alpha, const DistMultiVec<T>& A, const Matrix<T>& B,
+  T beta,        DistMultiVec<T>& C );
+
 template<typename T>
 void LocalGemm
 ( Orientation orientA, Orientation orientB,
@@ -81,6 +188,20 @@ void Hemm
 
 // Herk
 // ====
+// SYRK_TRIANGLE divides the entries of the updated triangle evenly over the
+// processes (see src/blas_like/level3/Syrk/Triangle.hpp) and SYRK_25D splits
+// the summation dimension over the layers used by GEMM_25D (falling back to
+// the default algorithm when only one layer results). Both algorithms also
+// fall back to the default when the grid has viewing processes.
+namespace SyrkAlgorithmNS {
+enum SyrkAlgorithm {
+  SYRK_DEFAULT,
+  SYRK_TRIANGLE,
+  SYRK_25D
+};
+}
+using namespace SyrkAlgorithmNS;
+
 template<typename T>
 void Herk
 ( UpperOrLower uplo, Orientation orientation,
@@ -94,11 +215,13 @@ template<typename T>
 void Herk
 ( UpperOrLower uplo, Orientation orientation,
   Base<T> alpha, const AbstractDistMatrix<T>& A,
-  Base<T> beta,        AbstractDistMatrix<T>& C );
+  Base<T> beta,        AbstractDistMatrix<T>& C,
+  SyrkAlgorithm alg=SYRK_DEFAULT );
 template<typename T>
 void Herk
 ( UpperOrLower uplo, Orientation orientation,
-  Base<T> alpha, const AbstractDistMatrix<T>& A, AbstractDistMatrix<T>& C );
+  Base<T> alpha, const AbstractDistMatrix<T>& A, AbstractDistMatrix<T>& C,
+  SyrkAlgorithm alg=SYRK_DEFAULT );
 
 template<typename T>
 void Herk
@@ -122,6 +245,31 @@ void Herk
   Base<T> alpha, const DistSparseMatrix<T>& A,
                        DistSparseMatrix<T>& C );
 
+// Streaming Herk and Gemm
+// =======================
+// Variants of Herk and Gemm for tall operands which are stored (in
+// column-major order) within BINARY_FLAT files rather than in memory. The
+// operands are streamed through memory in row panels of height 'panelHeight'
+// (which defaults to the width of the result), with the collective read of
+// the next panel overlapping the update using the current panel, and the
+// result is accumulated into a resident distributed matrix.
+
+// C := alpha A^H A + beta C, where A is a height x width matrix
+template<typename T>
+void StreamingHerk
+( UpperOrLower uplo,
+  Base<T> alpha, const string& filenameA, Int height, Int width,
+  Base<T> beta,        AbstractDistMatrix<T>& C, Int panelHeight=0 );
+
+// C := alpha op(A) B + beta C, where A is height x widthA, B is
+// height x widthB, and op(A) is either A^T or A^H
+template<typename T>
+void StreamingGemm
+( Orientation orientA,
+  T alpha, const string& filenameA, const string& filenameB,
+  Int height, Int widthA, Int widthB,
+  T beta,        AbstractDistMatrix<T>& C, Int panelHeight=0 );
+
 // Her2k
 // =====
 template<typename T>
@@ -159,6 +307,13 @@ void Multiply
   T alpha, const SparseMatrix<T>& A, const Matrix<T>& X,
   T beta,                                  Matrix<T>& Y );
 
+// The block sparse kernels are specialized for block sizes of up to 8
+template<typename T>
+void Multiply
+( Orientation orientation,
+  T alpha, const BlockSparseMatrix<T>& A, const Matrix<T>& X,
+  T beta,                                       Matrix<T>& Y );
+
 template<typename T>
 void Multiply
 ( Orientation orientation,
@@ -173,6 +328,9 @@ void Multiply
   const DistMultiVec<T>& X,
   T beta,
         DistMultiVec<T>& Y );
+// X and Y are multiplied in their [MC,MR] distributions, with the rows of A
+// redistributed over the process rows, which avoids redistributing wide X
+// and Y into a one-dimensional distribution
 template<typename T>
 void Multiply
 ( Orientation orientation,
@@ -182,6 +340,35 @@ void Multiply
   T beta,
         AbstractDistMatrix<T>& Y );
 
+// SparseMultiply
+// ==============
+// C := alpha op(A) B for sparse A and B via Gustavson's row-wise algorithm.
+// If 'onlyLower' is true, only the lower triangle of C is formed.
+template<typename T>
+void SparseMultiply
+( Orientation orientA,
+  T alpha, const SparseMatrix<T>& A, const SparseMatrix<T>& B,
+                 SparseMatrix<T>& C, bool onlyLower=false );
+template<typename T>
+void SparseMultiply
+( Orientation orientA,
+  T alpha, const DistSparseMatrix<T>& A, const DistSparseMatrix<T>& B,
+                 DistSparseMatrix<T>& C, bool onlyLower=false );
+
+// ADAT
+// ====
+// C := A diag(d) op(A), with op(A) = A^T, or A^H if 'conjugate' is true.
+// This is the product which forms the normal equations of interior point
+// methods.
+template<typename T>
+void ADAT
+( const SparseMatrix<T>& A, const Matrix<T>& d,
+        SparseMatrix<T>& C, bool conjugate=false, bool onlyLower=false );
+template<typename T>
+void ADAT
+( const DistSparseMatrix<T>& A, const DistMultiVec<T>& d,
+        DistSparseMatrix<T>& C, bool conjugate=false, bool onlyLower=false );
+
 // MultiShiftQuasiTrsm
 // ===================
 template<typename F>
@@ -337,12 +524,13 @@ template<typename T>
 void Syrk
 ( UpperOrLower uplo, Orientation orientation,
   T alpha, const AbstractDistMatrix<T>& A,
-  T beta,        AbstractDistMatrix<T>& C, bool conjugate=false );
+  T beta,        AbstractDistMatrix<T>& C, bool conjugate=false,
+  SyrkAlgorithm alg=SYRK_DEFAULT );
 template<typename T>
 void Syrk
 ( UpperOrLower uplo, Orientation orientation,
   T alpha, const AbstractDistMatrix<T>& A, AbstractDistMatrix<T>& C,
-  bool conjugate=false );
+  bool conjugate=false, SyrkAlgorithm alg=SYRK_DEFAULT );
 
 template<typename T>
 void Syrk
@@ -447,7 +635,8 @@ enum TrsmAlgorithm {
   TRSM_DEFAULT,
   TRSM_LARGE,
   TRSM_MEDIUM,
-  TRSM_SMALL
+  TRSM_SMALL,
+  TRSM_REPLICATED
 };
 }
 using namespace TrsmAlgorithmNS;
@@ -466,6 +655,16 @@ void Trsm
   const AbstractDistMatrix<F>& A,
         AbstractDistMatrix<F>& B,
   bool checkIfSingular=false, TrsmAlgorithm alg=TRSM_DEFAULT );
+// Block-cyclic (ScaLAPACK-compatible) operands are solved against in place
+// by PBLAS when it is available and supports the datatype
+template<typename F>
+void Trsm
+( LeftOrRight side, UpperOrLower uplo,
+  Orientation orientation, UnitOrNonUnit diag,
+  F alpha,
+  const DistMatrix<F,MC,MR,BLOCK>& A,
+        DistMatrix<F,MC,MR,BLOCK>& B,
+  bool checkIfSingular=false );
 
 template<typename F>
 void LocalTrsm
@@ -651,4 +850,6 @@ void NormalFromEVD
 
 } // namespace El
 
+#include <El/blas_like/level3/CompositeMatrix.hpp>
+
 #endif // ifndef EL_BLAS3_HPP
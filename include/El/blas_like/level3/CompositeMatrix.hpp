@@ -0,0 +1,156 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_BLAS_LEVEL3_COMPOSITEMATRIX_HPP
+#define EL_BLAS_LEVEL3_COMPOSITEMATRIX_HPP
+
+namespace El {
+
+// Composite (block) matrices
+// ==========================
+// A matrix partitioned into a grid of blocks, each of which is either zero,
+// a scaled (and possibly (conjugate-)transposed) reference to an existing
+// dense or sparse matrix, or a scaled identity (which, for rectangular
+// blocks, is nonzero only on the main diagonal), e.g., the KKT-like operator
+//
+//   | alpha I,    A^T |
+//   |       A, -beta I |
+//
+// of the interior point methods can be applied without concatenating A,
+// its transpose, and the identities into a new matrix with HCat/VCat. The
+// referenced matrices must remain valid (and unchanged in size) for as long
+// as the composite matrix is used.
+enum CompositeBlockType
+{
+  COMPOSITE_ZERO,
+  COMPOSITE_DENSE,
+  COMPOSITE_SPARSE,
+  COMPOSITE_IDENTITY
+};
+
+template<typename T,class DenseType,class SparseType>
+struct CompositeBlock
+{
+    CompositeBlockType type=COMPOSITE_ZERO;
+    const DenseType* dense=nullptr;
+    const SparseType* sparse=nullptr;
+    // The block is alpha op(A), where A is the referenced matrix
+    Orientation orientation=NORMAL;
+    T alpha=T(1);
+};
+
+template<typename T>
+class CompositeMatrix
+{
+public:
+    typedef CompositeBlock<T,Matrix<T>,SparseMatrix<T>> Block;
+
+    // The heights of the block rows and the widths of the block columns
+    CompositeMatrix
+    ( const vector<Int>& blockHeights, const vector<Int>& blockWidths );
+
+    void SetBlock
+    ( Int i, Int j, const Matrix<T>& A,
+      Orientation orientation=NORMAL, T alpha=T(1) );
+    void SetBlock
+    ( Int i, Int j, const SparseMatrix<T>& A,
+      Orientation orientation=NORMAL, T alpha=T(1) );
+    void SetIdentityBlock( Int i, Int j, T alpha=T(1) );
+    void ZeroBlock( Int i, Int j );
+
+    Int Height() const EL_NO_EXCEPT { return rowOffs_.back(); }
+    Int Width() const EL_NO_EXCEPT { return colOffs_.back(); }
+    Int NumBlockRows() const EL_NO_EXCEPT { return rowOffs_.size()-1; }
+    Int NumBlockCols() const EL_NO_EXCEPT { return colOffs_.size()-1; }
+    Int RowOffset( Int i ) const { return rowOffs_[i]; }
+    Int ColOffset( Int j ) const { return colOffs_[j]; }
+    const Block& GetBlock( Int i, Int j ) const;
+
+private:
+    vector<Int> rowOffs_, colOffs_;
+    // The blocks are stored in row-major order
+    vector<Block> blocks_;
+
+    Block& BlockRef( Int i, Int j );
+};
+
+// The referenced dense blocks may be any ElementalMatrix, while the operands
+// of Multiply are [MC,MR] matrices over a grid with the same communicator
+template<typename T>
+class DistCompositeMatrix
+{
+public:
+    typedef CompositeBlock<T,ElementalMatrix<T>,DistSparseMatrix<T>> Block;
+
+    DistCompositeMatrix
+    ( const Grid& grid,
+      const vector<Int>& blockHeights, const vector<Int>& blockWidths );
+
+    void SetBlock
+    ( Int i, Int j, const ElementalMatrix<T>& A,
+      Orientation orientation=NORMAL, T alpha=T(1) );
+    void SetBlock
+    ( Int i, Int j, const DistSparseMatrix<T>& A,
+      Orientation orientation=NORMAL, T alpha=T(1) );
+    void SetIdentityBlock( Int i, Int j, T alpha=T(1) );
+    void ZeroBlock( Int i, Int j );
+
+    const El::Grid& Grid() const EL_NO_EXCEPT { return *grid_; }
+    Int Height() const EL_NO_EXCEPT { return rowOffs_.back(); }
+    Int Width() const EL_NO_EXCEPT { return colOffs_.back(); }
+    Int NumBlockRows() const EL_NO_EXCEPT { return rowOffs_.size()-1; }
+    Int NumBlockCols() const EL_NO_EXCEPT { return colOffs_.size()-1; }
+    Int RowOffset( Int i ) const { return rowOffs_[i]; }
+    Int ColOffset( Int j ) const { return colOffs_[j]; }
+    const Block& GetBlock( Int i, Int j ) const;
+
+private:
+    const El::Grid* grid_;
+    vector<Int> rowOffs_, colOffs_;
+    vector<Block> blocks_;
+
+    Block& BlockRef( Int i, Int j );
+};
+
+// Y := alpha op(A) X + beta Y, block by block
+template<typename T>
+void Multiply
+( Orientation orientation,
+  T alpha, const CompositeMatrix<T>& A, const Matrix<T>& X,
+  T beta,                                     Matrix<T>& Y );
+template<typename T>
+void Multiply
+( Orientation orientation,
+  T alpha, const DistCompositeMatrix<T>& A, const DistMatrix<T>& X,
+  T beta,                                         DistMatrix<T>& Y );
+
+template<typename T>
+void Gemv
+( Orientation orientation,
+  T alpha, const CompositeMatrix<T>& A, const Matrix<T>& x,
+  T beta,                                     Matrix<T>& y );
+template<typename T>
+void Gemv
+( Orientation orientation,
+  T alpha, const DistCompositeMatrix<T>& A, const DistMatrix<T>& x,
+  T beta,                                         DistMatrix<T>& y );
+
+// Materialize the composite matrix (only when an explicit matrix is
+// required, e.g., for a direct factorization)
+template<typename T>
+void Copy( const CompositeMatrix<T>& A, Matrix<T>& B );
+template<typename T>
+void Copy( const CompositeMatrix<T>& A, SparseMatrix<T>& B );
+template<typename T>
+void Copy( const DistCompositeMatrix<T>& A, DistMatrix<T>& B );
+template<typename T>
+void Copy( const DistCompositeMatrix<T>& A, DistSparseMatrix<T>& B );
+
+} // namespace El
+
+#endif // ifndef EL_BLAS_LEVEL3_COMPOSITEMATRIX_HPP
@@ -10,11 +10,60 @@
 #define EL_CONTROL_HPP
 
 #include <El/lapack_like/funcs.hpp>
+#include <El/lapack_like/euclidean_min.hpp>
 
 namespace El {
 
+// The Sylvester and Lyapunov solvers either embed the equation within a
+// matrix of twice the size and apply the matrix sign function or make use of
+// the Bartels-Stewart approach of reducing the coefficient matrices to
+// (complex) Schur form and recursively solving the resulting triangular
+// Sylvester equation in blocks, which only requires matrix-matrix
+// multiplications outside of small sequential subproblems.
+namespace SylvesterAlgorithmNS {
+enum SylvesterAlgorithm {
+  SYLVESTER_SIGN,
+  SYLVESTER_SCHUR
+};
+}
+using namespace SylvesterAlgorithmNS;
+
+template<typename Real>
+struct SylvesterCtrl
+{
+    SylvesterAlgorithm alg=SYLVESTER_SCHUR;
+    SignCtrl<Real> signCtrl;
+    SchurCtrl<Real> schurCtrl;
+
+    // The triangular subproblems are solved sequentially once both of
+    // their dimensions are at most this size (zero selects Blocksize())
+    Int blocksize=0;
+};
+
+namespace sylvester {
+
+// Overwrite C with the solution, Y, of T Y + Y op(U) = C, where T and U are
+// upper-triangular and op(U) is either U or U^H
+template<typename Field>
+void Triangular
+( const Matrix<Field>& T,
+  const Matrix<Field>& U,
+  Orientation orientU,
+        Matrix<Field>& C,
+  Int blocksize=0 );
+template<typename Field>
+void Triangular
+( const AbstractDistMatrix<Field>& T,
+  const AbstractDistMatrix<Field>& U,
+  Orientation orientU,
+        AbstractDistMatrix<Field>& C,
+  Int blocksize=0 );
+
+} // namespace sylvester
+
 // Lyapunov
 // ========
+// Solve A X + X A^H = C
 template<typename F>
 void Lyapunov
 ( const Matrix<F>& A,
@@ -28,6 +77,63 @@ void Lyapunov
         ElementalMatrix<F>& X,
   SignCtrl<Base<F>> ctrl=SignCtrl<Base<F>>() );
 
+template<typename F>
+void Lyapunov
+( const Matrix<F>& A,
+  const Matrix<F>& C,
+        Matrix<F>& X,
+  const SylvesterCtrl<Base<F>>& ctrl );
+template<typename F>
+void Lyapunov
+( const ElementalMatrix<F>& A,
+  const ElementalMatrix<F>& C,
+        ElementalMatrix<F>& X,
+  const SylvesterCtrl<Base<F>>& ctrl );
+
+// Low-rank Lyapunov
+// -----------------
+// Compute a low-rank factor Z such that X = Z Z^H approximately solves
+//
+//   A X + X A^H + B B^H = 0
+//
+// for a large sparse matrix A, whose eigenvalues lie in the open left
+// half-plane, and a B with few columns using the low-rank alternating
+// direction implicit (ADI) iteration of Li and White, which appends
+// width(B) columns to Z per (cyclically reused) shift.
+template<typename Real>
+struct LowRankLyapunovCtrl
+{
+    // The (negative) ADI shifts. If empty, 'numShifts' logarithmically-spaced
+    // shifts between the negations of the Lanczos estimates of the extremal
+    // singular values of A are used, which is appropriate when A is close to
+    // normal with real eigenvalues.
+    vector<Real> shifts;
+    Int numShifts=10;
+    Int basisSize=20;
+
+    Int maxIts=200;
+
+    // The iteration stops once the Frobenius norm of the newest block is at
+    // most tol times that of Z (zero selects the square-root of epsilon)
+    Real tol=Real(0);
+
+    LeastSquaresCtrl<Real> solveCtrl;
+    bool progress=false;
+};
+
+template<typename F>
+void LowRankLyapunov
+( const SparseMatrix<F>& A,
+  const Matrix<F>& B,
+        Matrix<F>& Z,
+  const LowRankLyapunovCtrl<Base<F>>& ctrl=LowRankLyapunovCtrl<Base<F>>() );
+template<typename F>
+void LowRankLyapunov
+( const DistSparseMatrix<F>& A,
+  const DistMultiVec<F>& B,
+        DistMultiVec<F>& Z,
+  const LowRankLyapunovCtrl<Base<F>>& ctrl=LowRankLyapunovCtrl<Base<F>>() );
+
 // Riccati
 // =======
 template<typename F>
@@ -82,6 +188,22 @@ void Sylvester
         ElementalMatrix<F>& X, 
   SignCtrl<Base<F>> ctrl=SignCtrl<Base<F>>() );
 
+// Solve A X + X B = C
+template<typename F>
+void Sylvester
+( const Matrix<F>& A,
+  const Matrix<F>& B,
+  const Matrix<F>& C,
+        Matrix<F>& X,
+  const SylvesterCtrl<Base<F>>& ctrl );
+template<typename F>
+void Sylvester
+( const ElementalMatrix<F>& A,
+  const ElementalMatrix<F>& B,
+  const ElementalMatrix<F>& C,
+        ElementalMatrix<F>& X,
+  const SylvesterCtrl<Base<F>>& ctrl );
+
 } // namespace El
 
 #endif // ifndef EL_CONTROL_HPP
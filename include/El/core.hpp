@@ -14,15 +14,18 @@
 #include <mpi.h>
 
 #include <array>
+#include <atomic>
 #include <cmath>
 #include <complex>
 #include <cstddef>
+#include <cstdint>
 #include <cstdlib>
 #include <cstring>
 #include <ctime>
 #include <fstream>
 #include <functional>
 #include <iostream>
+#include <limits>
 #include <memory>
 #include <sstream>
 #include <stdexcept>
@@ -41,6 +44,12 @@
 # define EL_RELEASE_ONLY(cmd)
 #endif
 
+// The call stack is always maintained in debug builds and optionally in
+// release builds (for the sake of crash diagnostics)
+#if !defined(EL_RELEASE) || defined(EL_RELEASE_CALL_STACK)
+# define EL_HAVE_CALL_STACK
+#endif
+
 #ifdef EL_HAVE_NO_EXCEPT
 # define EL_NO_EXCEPT noexcept
 #else
@@ -254,13 +263,16 @@ template<typename T> struct IsStdField<Complex<T>>
 #include <El/core/imports/mpi_choice.hpp>
 #include <El/core/environment/decl.hpp>
 
+#include <El/core/HardwareCounters.hpp>
 #include <El/core/Timer.hpp>
+#include <El/core/Profile.hpp>
 #include <El/core/indexing/decl.hpp>
 #include <El/core/imports/blas.hpp>
 #include <El/core/imports/lapack.hpp>
 #include <El/core/imports/flame.hpp>
 #include <El/core/imports/mkl.hpp>
 #include <El/core/imports/openblas.hpp>
+#include <El/core/imports/cuda.hpp>
 #include <El/core/imports/pmrrr.hpp>
 #include <El/core/imports/scalapack.hpp>
 
@@ -280,20 +292,27 @@ template<typename T=double> class BlockMatrix;
 template<typename T=double,Dist U=MC,Dist V=MR,DistWrap wrap=ELEMENT>
 class DistMatrix;
 
+class Permutation;
+
 } // namespace El
 
 #include <El/core/Matrix/decl.hpp>
+#include <El/core/FixedMatrix.hpp>
 #include <El/core/Graph/decl.hpp>
 #include <El/core/DistMap/decl.hpp>
 #include <El/core/DistGraph/decl.hpp>
 #include <El/core/SparseMatrix/decl.hpp>
+#include <El/core/BlockSparseMatrix/decl.hpp>
+#include <El/core/BandMatrix/decl.hpp>
 #include <El/core/DistSparseMatrix/decl.hpp>
 #include <El/core/DistMultiVec/decl.hpp>
+#include <El/core/DistBandMatrix/decl.hpp>
 #include <El/core/View/decl.hpp>
 #include <El/blas_like/level1/decl.hpp>
 
 #include <El/core/Matrix/impl.hpp>
 #include <El/core/Grid.hpp>
+#include <El/core/Grid3D.hpp>
 #include <El/core/DistMatrix.hpp>
 #include <El/core/Proxy.hpp>
 
@@ -312,12 +331,17 @@ class DistMatrix;
 // TODO: Sequential map
 //#include <El/core/Map.hpp>
 #include <El/core/SparseMatrix/impl.hpp>
+#include <El/core/BlockSparseMatrix/impl.hpp>
+#include <El/core/BandMatrix/impl.hpp>
 
 #include <El/core/DistMap.hpp>
 #include <El/core/DistMultiVec/impl.hpp>
+#include <El/core/DistBandMatrix/impl.hpp>
 #include <El/core/DistSparseMatrix/impl.hpp>
 
 #include <El/core/Permutation.hpp>
 #include <El/core/DistPermutation.hpp>
+#include <El/core/RmaInterface.hpp>
+#include <El/core/TaskGraph.hpp>
 
 #endif // ifndef EL_CORE_HPP
@@ -0,0 +1,15 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_CORE_BANDMATRIX_HPP
+#define EL_CORE_BANDMATRIX_HPP
+
+#include <El/core/BandMatrix/decl.hpp>
+#include <El/core/BandMatrix/impl.hpp>
+
+#endif // ifndef EL_CORE_BANDMATRIX_HPP
@@ -0,0 +1,59 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_CORE_BANDMATRIX_DECL_HPP
+#define EL_CORE_BANDMATRIX_DECL_HPP
+
+namespace El {
+
+// A matrix whose nonzeros lie within 'lower' diagonals below, and 'upper'
+// diagonals above, the main diagonal, stored in the LAPACK band format: the
+// (lower+upper+1) x width matrix whose (upper+i-j,j) entry is A(i,j).
+template<typename Ring>
+class BandMatrix
+{
+public:
+    // Constructors and destructors
+    // ============================
+    BandMatrix();
+    BandMatrix( Int height, Int width, Int lower, Int upper );
+    ~BandMatrix();
+
+    // Assignment and reconfiguration
+    // ==============================
+    void Empty( bool freeMemory=true );
+    // Resize and zero the band
+    void Resize( Int height, Int width, Int lower, Int upper );
+
+    // Queries
+    // =======
+    Int Height() const EL_NO_EXCEPT;
+    Int Width() const EL_NO_EXCEPT;
+    Int LowerBandwidth() const EL_NO_EXCEPT;
+    Int UpperBandwidth() const EL_NO_EXCEPT;
+    bool InBand( Int i, Int j ) const EL_NO_EXCEPT;
+
+    // The band storage
+    El::Matrix<Ring>& Matrix() EL_NO_EXCEPT;
+    const El::Matrix<Ring>& LockedMatrix() const EL_NO_EXCEPT;
+
+    // Entrywise manipulation
+    // ======================
+    // Entries outside of the band are zero and may not be modified
+    Ring Get( Int i, Int j ) const EL_NO_RELEASE_EXCEPT;
+    void Set( Int i, Int j, Ring value ) EL_NO_RELEASE_EXCEPT;
+    void Update( Int i, Int j, Ring value ) EL_NO_RELEASE_EXCEPT;
+
+private:
+    Int height_=0, width_=0, lower_=0, upper_=0;
+    El::Matrix<Ring> band_;
+};
+
+} // namespace El
+
+#endif // ifndef EL_CORE_BANDMATRIX_DECL_HPP
@@ -0,0 +1,124 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_CORE_BANDMATRIX_IMPL_HPP
+#define EL_CORE_BANDMATRIX_IMPL_HPP
+
+namespace El {
+
+// Constructors and destructors
+// ============================
+
+template<typename Ring>
+BandMatrix<Ring>::BandMatrix()
+{ band_.Resize( 1, 0 ); }
+
+template<typename Ring>
+BandMatrix<Ring>::BandMatrix( Int height, Int width, Int lower, Int upper )
+{ Resize( height, width, lower, upper ); }
+
+template<typename Ring>
+BandMatrix<Ring>::~BandMatrix() { }
+
+// Assignment and reconfiguration
+// ==============================
+
+template<typename Ring>
+void BandMatrix<Ring>::Empty( bool freeMemory )
+{
+    EL_DEBUG_CSE
+    height_ = 0;
+    width_ = 0;
+    lower_ = 0;
+    upper_ = 0;
+    band_.Empty( freeMemory );
+    band_.Resize( 1, 0 );
+}
+
+template<typename Ring>
+void BandMatrix<Ring>::Resize( Int height, Int width, Int lower, Int upper )
+{
+    EL_DEBUG_CSE
+    if( height < 0 || width < 0 || lower < 0 || upper < 0 )
+        LogicError
+        ("Invalid band matrix dimensions: ",height," x ",width,
+         " with bandwidths ",lower," and ",upper);
+    height_ = height;
+    width_ = width;
+    lower_ = lower;
+    upper_ = upper;
+    band_.Resize( lower+upper+1, width );
+    Zero( band_ );
+}
+
+// Queries
+// =======
+
+template<typename Ring>
+Int BandMatrix<Ring>::Height() const EL_NO_EXCEPT { return height_; }
+template<typename Ring>
+Int BandMatrix<Ring>::Width() const EL_NO_EXCEPT { return width_; }
+template<typename Ring>
+Int BandMatrix<Ring>::LowerBandwidth() const EL_NO_EXCEPT { return lower_; }
+template<typename Ring>
+Int BandMatrix<Ring>::UpperBandwidth() const EL_NO_EXCEPT { return upper_; }
+
+template<typename Ring>
+bool BandMatrix<Ring>::InBand( Int i, Int j ) const EL_NO_EXCEPT
+{ return i >= 0 && i < height_ && j >= 0 && j < width_ &&
+         i-j <= lower_ && j-i <= upper_; }
+
+template<typename Ring>
+El::Matrix<Ring>& BandMatrix<Ring>::Matrix() EL_NO_EXCEPT
+{ return band_; }
+template<typename Ring>
+const El::Matrix<Ring>& BandMatrix<Ring>::LockedMatrix() const EL_NO_EXCEPT
+{ return band_; }
+
+// Entrywise manipulation
+// ======================
+
+template<typename Ring>
+Ring BandMatrix<Ring>::Get( Int i, Int j ) const EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( i < 0 || i >= height_ || j < 0 || j >= width_ )
+          LogicError
+          ("(",i,",",j,") is out of bounds of ",height_," x ",width_);
+    )
+    if( !InBand(i,j) )
+        return Ring(0);
+    return band_(upper_+i-j,j);
+}
+
+template<typename Ring>
+void BandMatrix<Ring>::Set( Int i, Int j, Ring value ) EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( !InBand(i,j) )
+          LogicError("(",i,",",j,") is outside of the band");
+    )
+    band_(upper_+i-j,j) = value;
+}
+
+template<typename Ring>
+void BandMatrix<Ring>::Update( Int i, Int j, Ring value ) EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( !InBand(i,j) )
+          LogicError("(",i,",",j,") is outside of the band");
+    )
+    band_(upper_+i-j,j) += value;
+}
+
+} // namespace El
+
+#endif // ifndef EL_CORE_BANDMATRIX_IMPL_HPP
@@ -0,0 +1,74 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_CORE_BLOCKSPARSEMATRIX_DECL_HPP
+#define EL_CORE_BLOCKSPARSEMATRIX_DECL_HPP
+
+namespace El {
+
+// A sparse matrix stored in block compressed sparse row (BSR) format, where
+// each nonzero block is a dense, column-major blockSize x blockSize matrix
+// and only a single column index is stored per block. When the block size
+// does not divide the dimensions, the last block row and block column are
+// padded with zeros.
+template<typename Ring>
+class BlockSparseMatrix
+{
+public:
+    // Constructors and destructors
+    // ============================
+    BlockSparseMatrix();
+    BlockSparseMatrix( Int height, Int width, Int blockSize );
+    BlockSparseMatrix( const BlockSparseMatrix<Ring>& A );
+    ~BlockSparseMatrix();
+
+    // Assignment and reconfiguration
+    // ==============================
+    void Empty( bool clearMemory=true );
+    void Resize( Int height, Int width, Int blockSize );
+
+    const BlockSparseMatrix<Ring>&
+    operator=( const BlockSparseMatrix<Ring>& A );
+
+    // For manually modifying data
+    // ---------------------------
+    // NOTE: The block row offsets must be set after forcing the number of
+    //       blocks, and the block columns of each block row must be sorted
+    void ForceNumBlocks( Int numBlocks );
+    Int* OffsetBuffer() EL_NO_EXCEPT;
+    Int* TargetBuffer() EL_NO_EXCEPT;
+    Ring* ValueBuffer() EL_NO_EXCEPT;
+    const Int* LockedOffsetBuffer() const EL_NO_EXCEPT;
+    const Int* LockedTargetBuffer() const EL_NO_EXCEPT;
+    const Ring* LockedValueBuffer() const EL_NO_EXCEPT;
+
+    // Queries
+    // =======
+    Int Height() const EL_NO_EXCEPT;
+    Int Width() const EL_NO_EXCEPT;
+    Int BlockSize() const EL_NO_EXCEPT;
+    Int NumBlockRows() const EL_NO_EXCEPT;
+    Int NumBlockCols() const EL_NO_EXCEPT;
+    Int NumBlocks() const EL_NO_EXCEPT;
+
+    Int BlockRowOffset( Int blockRow ) const EL_NO_RELEASE_EXCEPT;
+    Int BlockCol( Int index ) const EL_NO_RELEASE_EXCEPT;
+    // The index of the given block, or -1 if it is not stored
+    Int BlockOffset( Int blockRow, Int blockCol ) const EL_NO_RELEASE_EXCEPT;
+    const Ring* LockedBlock( Int index ) const EL_NO_RELEASE_EXCEPT;
+    Ring Get( Int row, Int col ) const EL_NO_RELEASE_EXCEPT;
+
+private:
+    Int height_=0, width_=0, blockSize_=1;
+    vector<Int> blockRowOffsets_, blockCols_;
+    vector<Ring> vals_;
+};
+
+} // namespace El
+
+#endif // ifndef EL_CORE_BLOCKSPARSEMATRIX_DECL_HPP
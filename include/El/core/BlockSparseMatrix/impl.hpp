@@ -0,0 +1,231 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_CORE_BLOCKSPARSEMATRIX_IMPL_HPP
+#define EL_CORE_BLOCKSPARSEMATRIX_IMPL_HPP
+
+namespace El {
+
+// Constructors and destructors
+// ============================
+
+template<typename Ring>
+BlockSparseMatrix<Ring>::BlockSparseMatrix()
+: blockRowOffsets_(1,0)
+{ }
+
+template<typename Ring>
+BlockSparseMatrix<Ring>::BlockSparseMatrix
+( Int height, Int width, Int blockSize )
+{ Resize( height, width, blockSize ); }
+
+template<typename Ring>
+BlockSparseMatrix<Ring>::BlockSparseMatrix( const BlockSparseMatrix<Ring>& A )
+{
+    EL_DEBUG_CSE
+    if( &A != this )
+        *this = A;
+    else
+        LogicError("Tried to construct block sparse matrix with itself");
+}
+
+template<typename Ring>
+BlockSparseMatrix<Ring>::~BlockSparseMatrix() { }
+
+// Assignment and reconfiguration
+// ==============================
+
+template<typename Ring>
+void BlockSparseMatrix<Ring>::Empty( bool clearMemory )
+{
+    EL_DEBUG_CSE
+    height_ = 0;
+    width_ = 0;
+    blockSize_ = 1;
+    if( clearMemory )
+    {
+        SwapClear( blockRowOffsets_ );
+        SwapClear( blockCols_ );
+        SwapClear( vals_ );
+    }
+    else
+    {
+        blockCols_.resize( 0 );
+        vals_.resize( 0 );
+    }
+    blockRowOffsets_.assign( 1, 0 );
+}
+
+template<typename Ring>
+void BlockSparseMatrix<Ring>::Resize( Int height, Int width, Int blockSize )
+{
+    EL_DEBUG_CSE
+    if( blockSize < 1 )
+        LogicError("Block size must be positive, but was ",blockSize);
+    height_ = height;
+    width_ = width;
+    blockSize_ = blockSize;
+    blockRowOffsets_.assign( NumBlockRows()+1, 0 );
+    blockCols_.resize( 0 );
+    vals_.resize( 0 );
+}
+
+template<typename Ring>
+const BlockSparseMatrix<Ring>&
+BlockSparseMatrix<Ring>::operator=( const BlockSparseMatrix<Ring>& A )
+{
+    EL_DEBUG_CSE
+    height_ = A.height_;
+    width_ = A.width_;
+    blockSize_ = A.blockSize_;
+    blockRowOffsets_ = A.blockRowOffsets_;
+    blockCols_ = A.blockCols_;
+    vals_ = A.vals_;
+    return *this;
+}
+
+template<typename Ring>
+void BlockSparseMatrix<Ring>::ForceNumBlocks( Int numBlocks )
+{
+    EL_DEBUG_CSE
+    blockCols_.resize( numBlocks );
+    vals_.resize( numBlocks*blockSize_*blockSize_ );
+}
+
+template<typename Ring>
+Int* BlockSparseMatrix<Ring>::OffsetBuffer() EL_NO_EXCEPT
+{ return blockRowOffsets_.data(); }
+
+template<typename Ring>
+Int* BlockSparseMatrix<Ring>::TargetBuffer() EL_NO_EXCEPT
+{ return blockCols_.data(); }
+
+template<typename Ring>
+Ring* BlockSparseMatrix<Ring>::ValueBuffer() EL_NO_EXCEPT
+{ return vals_.data(); }
+
+template<typename Ring>
+const Int* BlockSparseMatrix<Ring>::LockedOffsetBuffer() const EL_NO_EXCEPT
+{ return blockRowOffsets_.data(); }
+
+template<typename Ring>
+const Int* BlockSparseMatrix<Ring>::LockedTargetBuffer() const EL_NO_EXCEPT
+{ return blockCols_.data(); }
+
+template<typename Ring>
+const Ring* BlockSparseMatrix<Ring>::LockedValueBuffer() const EL_NO_EXCEPT
+{ return vals_.data(); }
+
+// Queries
+// =======
+
+template<typename Ring>
+Int BlockSparseMatrix<Ring>::Height() const EL_NO_EXCEPT
+{ return height_; }
+
+template<typename Ring>
+Int BlockSparseMatrix<Ring>::Width() const EL_NO_EXCEPT
+{ return width_; }
+
+template<typename Ring>
+Int BlockSparseMatrix<Ring>::BlockSize() const EL_NO_EXCEPT
+{ return blockSize_; }
+
+template<typename Ring>
+Int BlockSparseMatrix<Ring>::NumBlockRows() const EL_NO_EXCEPT
+{ return (height_+blockSize_-1) / blockSize_; }
+
+template<typename Ring>
+Int BlockSparseMatrix<Ring>::NumBlockCols() const EL_NO_EXCEPT
+{ return (width_+blockSize_-1) / blockSize_; }
+
+template<typename Ring>
+Int BlockSparseMatrix<Ring>::NumBlocks() const EL_NO_EXCEPT
+{ return blockCols_.size(); }
+
+template<typename Ring>
+Int BlockSparseMatrix<Ring>::BlockRowOffset( Int blockRow ) const
+EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( blockRow < 0 || blockRow > NumBlockRows() )
+          LogicError("Block row ",blockRow," is out of bounds");
+    )
+    return blockRowOffsets_[blockRow];
+}
+
+template<typename Ring>
+Int BlockSparseMatrix<Ring>::BlockCol( Int index ) const EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( index < 0 || index >= NumBlocks() )
+          LogicError("Block index ",index," is out of bounds");
+    )
+    return blockCols_[index];
+}
+
+template<typename Ring>
+Int BlockSparseMatrix<Ring>::BlockOffset( Int blockRow, Int blockCol ) const
+EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    const auto beg = blockCols_.begin() + BlockRowOffset(blockRow);
+    const auto end = blockCols_.begin() + BlockRowOffset(blockRow+1);
+    const auto it = std::lower_bound( beg, end, blockCol );
+    if( it == end || *it != blockCol )
+        return -1;
+    return it - blockCols_.begin();
+}
+
+template<typename Ring>
+const Ring* BlockSparseMatrix<Ring>::LockedBlock( Int index ) const
+EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( index < 0 || index >= NumBlocks() )
+          LogicError("Block index ",index," is out of bounds");
+    )
+    return &vals_[index*blockSize_*blockSize_];
+}
+
+template<typename Ring>
+Ring BlockSparseMatrix<Ring>::Get( Int row, Int col ) const
+EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    if( row == END ) row = height_ - 1;
+    if( col == END ) col = width_ - 1;
+    const Int index = BlockOffset( row/blockSize_, col/blockSize_ );
+    if( index == -1 )
+        return Ring(0);
+    const Ring* block = LockedBlock( index );
+    return block[(row%blockSize_)+(col%blockSize_)*blockSize_];
+}
+
+#ifdef EL_INSTANTIATE_CORE
+# define EL_EXTERN
+#else
+# define EL_EXTERN extern
+#endif
+
+#define PROTO(Ring) EL_EXTERN template class BlockSparseMatrix<Ring>;
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGINT
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+#undef EL_EXTERN
+
+} // namespace El
+
+#endif // ifndef EL_CORE_BLOCKSPARSEMATRIX_IMPL_HPP
@@ -0,0 +1,73 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_CORE_DISTBANDMATRIX_DECL_HPP
+#define EL_CORE_DISTBANDMATRIX_DECL_HPP
+
+namespace El {
+
+// A square band matrix whose rows are distributed in the same contiguous
+// blocks as a DistMultiVec of the same height. Each process stores its
+// localHeight rows as the localHeight x (lower+upper+1) matrix whose
+// (iLoc,lower+j-i) entry is A(i,j), where i is the global index of local
+// row iLoc, so that the (at most lower+upper) couplings to the neighboring
+// processes are stored locally.
+template<typename Ring>
+class DistBandMatrix
+{
+public:
+    // Constructors and destructors
+    // ============================
+    DistBandMatrix( const El::Grid& grid=El::Grid::Default() );
+    DistBandMatrix
+    ( Int height, Int lower, Int upper,
+      const El::Grid& grid=El::Grid::Default() );
+    ~DistBandMatrix();
+
+    // Assignment and reconfiguration
+    // ==============================
+    void Empty( bool freeMemory=true );
+    // Resize and zero the band
+    void Resize( Int height, Int lower, Int upper );
+    void SetGrid( const El::Grid& grid );
+
+    // Queries
+    // =======
+    Int Height() const EL_NO_EXCEPT;
+    Int Width() const EL_NO_EXCEPT;
+    Int LowerBandwidth() const EL_NO_EXCEPT;
+    Int UpperBandwidth() const EL_NO_EXCEPT;
+    const El::Grid& Grid() const EL_NO_EXCEPT;
+
+    Int Blocksize() const EL_NO_EXCEPT;
+    Int FirstLocalRow() const EL_NO_EXCEPT;
+    Int LocalHeight() const EL_NO_EXCEPT;
+    int RowOwner( Int i ) const EL_NO_EXCEPT;
+    Int GlobalRow( Int iLoc ) const EL_NO_RELEASE_EXCEPT;
+    bool InBand( Int i, Int j ) const EL_NO_EXCEPT;
+
+    // The local band storage
+    El::Matrix<Ring>& Matrix() EL_NO_EXCEPT;
+    const El::Matrix<Ring>& LockedMatrix() const EL_NO_EXCEPT;
+
+    // Entrywise manipulation of the local rows
+    // ========================================
+    // Entries outside of the band are zero and may not be modified
+    Ring GetLocal( Int iLoc, Int j ) const EL_NO_RELEASE_EXCEPT;
+    void SetLocal( Int iLoc, Int j, Ring value ) EL_NO_RELEASE_EXCEPT;
+    void UpdateLocal( Int iLoc, Int j, Ring value ) EL_NO_RELEASE_EXCEPT;
+
+private:
+    Int height_=0, lower_=0, upper_=0, blocksize_=1;
+    const El::Grid* grid_;
+    El::Matrix<Ring> band_;
+};
+
+} // namespace El
+
+#endif // ifndef EL_CORE_DISTBANDMATRIX_DECL_HPP
@@ -0,0 +1,180 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_CORE_DISTBANDMATRIX_IMPL_HPP
+#define EL_CORE_DISTBANDMATRIX_IMPL_HPP
+
+namespace El {
+
+// Constructors and destructors
+// ============================
+
+template<typename Ring>
+DistBandMatrix<Ring>::DistBandMatrix( const El::Grid& grid )
+: grid_(&grid)
+{ band_.Resize( 0, 1 ); }
+
+template<typename Ring>
+DistBandMatrix<Ring>::DistBandMatrix
+( Int height, Int lower, Int upper, const El::Grid& grid )
+: grid_(&grid)
+{ Resize( height, lower, upper ); }
+
+template<typename Ring>
+DistBandMatrix<Ring>::~DistBandMatrix() { }
+
+// Assignment and reconfiguration
+// ==============================
+
+template<typename Ring>
+void DistBandMatrix<Ring>::Empty( bool freeMemory )
+{
+    EL_DEBUG_CSE
+    height_ = 0;
+    lower_ = 0;
+    upper_ = 0;
+    blocksize_ = 1;
+    band_.Empty( freeMemory );
+    band_.Resize( 0, 1 );
+}
+
+template<typename Ring>
+void DistBandMatrix<Ring>::Resize( Int height, Int lower, Int upper )
+{
+    EL_DEBUG_CSE
+    if( height < 0 || lower < 0 || upper < 0 )
+        LogicError
+        ("Invalid band matrix dimensions: ",height," x ",height,
+         " with bandwidths ",lower," and ",upper);
+    height_ = height;
+    lower_ = lower;
+    upper_ = upper;
+
+    // Match the distribution of DistMultiVec
+    const int gridRank = grid_->Rank();
+    const int gridSize = grid_->Size();
+    blocksize_ = height_ / gridSize;
+    if( blocksize_*gridSize < height_ || height_ == 0 )
+        ++blocksize_;
+    const Int localHeight = Min(blocksize_,Max(0,height_-blocksize_*gridRank));
+    band_.Resize( localHeight, lower+upper+1 );
+    Zero( band_ );
+}
+
+template<typename Ring>
+void DistBandMatrix<Ring>::SetGrid( const El::Grid& grid )
+{
+    EL_DEBUG_CSE
+    if( grid_ == &grid )
+        return;
+    grid_ = &grid;
+    Resize( 0, 0, 0 );
+}
+
+// Queries
+// =======
+
+template<typename Ring>
+Int DistBandMatrix<Ring>::Height() const EL_NO_EXCEPT { return height_; }
+template<typename Ring>
+Int DistBandMatrix<Ring>::Width() const EL_NO_EXCEPT { return height_; }
+template<typename Ring>
+Int DistBandMatrix<Ring>::LowerBandwidth() const EL_NO_EXCEPT
+{ return lower_; }
+template<typename Ring>
+Int DistBandMatrix<Ring>::UpperBandwidth() const EL_NO_EXCEPT
+{ return upper_; }
+template<typename Ring>
+const El::Grid& DistBandMatrix<Ring>::Grid() const EL_NO_EXCEPT
+{ return *grid_; }
+
+template<typename Ring>
+Int DistBandMatrix<Ring>::Blocksize() const EL_NO_EXCEPT
+{ return blocksize_; }
+template<typename Ring>
+Int DistBandMatrix<Ring>::FirstLocalRow() const EL_NO_EXCEPT
+{ return blocksize_*grid_->Rank(); }
+template<typename Ring>
+Int DistBandMatrix<Ring>::LocalHeight() const EL_NO_EXCEPT
+{ return band_.Height(); }
+
+template<typename Ring>
+int DistBandMatrix<Ring>::RowOwner( Int i ) const EL_NO_EXCEPT
+{
+    if( i == END ) i = height_ - 1;
+    return i / blocksize_;
+}
+
+template<typename Ring>
+Int DistBandMatrix<Ring>::GlobalRow( Int iLoc ) const EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    if( iLoc == END ) iLoc = LocalHeight() - 1;
+    EL_DEBUG_ONLY(
+      if( iLoc < 0 || iLoc >= LocalHeight() )
+          LogicError("Invalid local row index");
+    )
+    return iLoc + FirstLocalRow();
+}
+
+template<typename Ring>
+bool DistBandMatrix<Ring>::InBand( Int i, Int j ) const EL_NO_EXCEPT
+{ return i >= 0 && i < height_ && j >= 0 && j < height_ &&
+         i-j <= lower_ && j-i <= upper_; }
+
+template<typename Ring>
+El::Matrix<Ring>& DistBandMatrix<Ring>::Matrix() EL_NO_EXCEPT
+{ return band_; }
+template<typename Ring>
+const El::Matrix<Ring>& DistBandMatrix<Ring>::LockedMatrix() const
+EL_NO_EXCEPT
+{ return band_; }
+
+// Entrywise manipulation of the local rows
+// ========================================
+
+template<typename Ring>
+Ring DistBandMatrix<Ring>::GetLocal( Int iLoc, Int j ) const
+EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    const Int i = GlobalRow( iLoc );
+    if( !InBand(i,j) )
+        return Ring(0);
+    return band_(iLoc,lower_+j-i);
+}
+
+template<typename Ring>
+void DistBandMatrix<Ring>::SetLocal( Int iLoc, Int j, Ring value )
+EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    const Int i = GlobalRow( iLoc );
+    EL_DEBUG_ONLY(
+      if( !InBand(i,j) )
+          LogicError("(",i,",",j,") is outside of the band");
+    )
+    band_(iLoc,lower_+j-i) = value;
+}
+
+template<typename Ring>
+void DistBandMatrix<Ring>::UpdateLocal( Int iLoc, Int j, Ring value )
+EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    const Int i = GlobalRow( iLoc );
+    EL_DEBUG_ONLY(
+      if( !InBand(i,j) )
+          LogicError("(",i,",",j,") is outside of the band");
+    )
+    band_(iLoc,lower_+j-i) += value;
+}
+
+} // namespace El
+
+#endif // ifndef EL_CORE_DISTBANDMATRIX_IMPL_HPP
@@ -23,6 +23,15 @@
 
 namespace El {
 
+// Mix an integer into a 64-bit FNV-1a style hash
+const unsigned long long HASH_SEED = 14695981039346656037ULL;
+inline void HashCombine( unsigned long long& hash, Int value ) EL_NO_EXCEPT
+{
+    hash ^= static_cast<unsigned long long>(value);
+    hash *= 1099511628211ULL;
+    hash ^= hash >> 32;
+}
+
 struct DistGraphMultMeta
 {
     bool ready;
@@ -32,7 +41,41 @@ struct DistGraphMultMeta
                 recvSizes, recvOffs;
     vector<Int> sendInds, colOffs;
 
-    DistGraphMultMeta() : ready(false), numRecvInds(0) { }
+    // The local rows whose columns are all owned locally, which can be
+    // multiplied while the remaining (boundary) entries are exchanged
+    vector<Int> interiorRows, boundaryRows;
+
+    // Whether every process communicates with at most half of the others,
+    // in which case the exchange is performed with point-to-point messages
+    bool sparseExchange;
+
+    // Modifying the graph only marks the metadata as stale so that, if the
+    // graph is reassembled with the same sparsity pattern (as is typical of
+    // the KKT systems of interior point methods), the metadata can be
+    // reused after comparing the hashes of the structure
+    bool stale;
+    unsigned long long structureHash;
+
+    // The persistent exchanges of the normal and adjoint multiplications,
+    // which are rebuilt whenever the entry type or width changes
+    mutable std::shared_ptr<mpi::PersistentExchange> normalExchange,
+                                                     adjointExchange;
+
+    DistGraphMultMeta()
+    : ready(false), numRecvInds(0), sparseExchange(false), stale(false),
+      structureHash(0) { }
+    DistGraphMultMeta( const DistGraphMultMeta& meta ) = default;
+    DistGraphMultMeta( DistGraphMultMeta&& meta ) = default;
+    DistGraphMultMeta& operator=( DistGraphMultMeta&& meta ) = default;
+
+    void Invalidate()
+    {
+        if( ready )
+        {
+            ready = false;
+            stale = true;
+        }
+    }
 
     void Clear()
     {
@@ -44,6 +87,49 @@ struct DistGraphMultMeta
         SwapClear( recvOffs );
         SwapClear( sendInds );
         SwapClear( colOffs );
+        SwapClear( interiorRows );
+        SwapClear( boundaryRows );
+        sparseExchange = false;
+        stale = false;
+        structureHash = 0;
+        ResetExchanges();
+    }
+
+    void ResetExchanges()
+    {
+        normalExchange.reset();
+        adjointExchange.reset();
+    }
+
+    // Returns the persistent exchange for multiplying with 'width' columns,
+    // where the (unscaled) send and receive roles reverse for the adjoint.
+    // Since the rebuilds only depend upon the type, the width, and the
+    // metadata, they occur simultaneously over the communicator.
+    template<typename T>
+    mpi::PersistentExchange& Exchange
+    ( Orientation orientation, Int width, mpi::Comm comm ) const
+    {
+        const bool normal = ( orientation == NORMAL );
+        auto& exchange = ( normal ? normalExchange : adjointExchange );
+        vector<int> sCounts( normal ? sendSizes : recvSizes ),
+                    sOffs( normal ? sendOffs : recvOffs ),
+                    rCounts( normal ? recvSizes : sendSizes ),
+                    rOffs( normal ? recvOffs : sendOffs );
+        const int commSize = sCounts.size();
+        for( int q=0; q<commSize; ++q )
+        {
+            sCounts[q] *= width;
+            sOffs[q] *= width;
+            rCounts[q] *= width;
+            rOffs[q] *= width;
+        }
+        if( !exchange || !exchange->Matches<T>( sCounts, rCounts, comm ) )
+        {
+            exchange = std::make_shared<mpi::PersistentExchange>();
+            exchange->Setup<T>
+            ( sCounts, sOffs, rCounts, rOffs, comm, !sparseExchange );
+        }
+        return *exchange;
     }
 
     const DistGraphMultMeta& operator=( const DistGraphMultMeta& meta )
@@ -56,6 +142,13 @@ struct DistGraphMultMeta
         recvOffs = meta.recvOffs;
         sendInds = meta.sendInds;
         colOffs = meta.colOffs;
+        interiorRows = meta.interiorRows;
+        boundaryRows = meta.boundaryRows;
+        sparseExchange = meta.sparseExchange;
+        stale = meta.stale;
+        structureHash = meta.structureHash;
+        normalExchange = meta.normalExchange;
+        adjointExchange = meta.adjointExchange;
         return *this;
     }
 };
@@ -82,8 +175,9 @@ public:
     ( Int numSources, Int numTargets,
       const El::Grid& grid=El::Grid::Default() );
     DistGraph( const Graph& graph );
-    // TODO: Move constructor
     DistGraph( const DistGraph& graph );
+    // Move the edges and metadata of the given graph, which is left empty
+    DistGraph( DistGraph&& graph );
     ~DistGraph();
 
     // Assignment and reconfiguration
@@ -93,7 +187,10 @@ public:
     // -------------
     const DistGraph& operator=( const Graph& graph );
     const DistGraph& operator=( const DistGraph& graph );
-    // TODO: Move assignment
+
+    // Move assignment
+    // ---------------
+    DistGraph& operator=( DistGraph&& graph );
 
     // Make a copy of a subgraph
     // -------------------------
@@ -141,14 +238,19 @@ public:
     // For manually modifying/accessing buffers
     void ForceNumLocalEdges( Int numLocalEdges );
     void ForceConsistency( bool consistent=true ) EL_NO_EXCEPT;
-    Int* SourceBuffer() EL_NO_EXCEPT;
+    Int* SourceBuffer();
     Int* TargetBuffer() EL_NO_EXCEPT;
     Int* OffsetBuffer() EL_NO_EXCEPT;
-    const Int* LockedSourceBuffer() const EL_NO_EXCEPT;
+    const Int* LockedSourceBuffer() const;
     const Int* LockedTargetBuffer() const EL_NO_EXCEPT;
     const Int* LockedOffsetBuffer() const EL_NO_EXCEPT;
     void ComputeSourceOffsets();
 
+    // Free the (redundant) local sources of a locally consistent graph;
+    // they are recomputed from the local source offsets on demand
+    void CompressSources();
+    bool CompressedSources() const EL_NO_EXCEPT;
+
     // Queries
     // =======
 
@@ -183,8 +285,12 @@ public:
     // total number of edges divided by the number of processes
     double Imbalance() const EL_NO_RELEASE_EXCEPT;
 
+    // A hash of the dimensions and the local edges, which can be compared
+    // to detect whether the local structure changed
+    unsigned long long StructureHash() const EL_NO_EXCEPT;
+
     mutable DistGraphMultMeta multMeta;
-    DistGraphMultMeta InitializeMultMeta() const;
+    const DistGraphMultMeta& InitializeMultMeta() const;
 
     void AssertConsistent() const;
     void AssertLocallyConsistent() const;
@@ -199,7 +305,8 @@ private:
     Int numLocalSources_;
 
     bool frozenSparsity_ = false;
-    vector<Int> sources_, targets_;
+    mutable vector<Int> sources_;
+    vector<Int> targets_;
     set<pair<Int,Int>> markedForRemoval_;
 
     vector<Int> remoteSources_, remoteTargets_;
@@ -211,6 +318,10 @@ private:
     bool locallyConsistent_ = true;
     vector<Int> localSourceOffsets_;
 
+    // Whether sources_ has been freed in favor of localSourceOffsets_
+    mutable bool compressedSources_ = false;
+    void ExpandSources() const;
+
     friend class Graph;
     friend void Copy( const Graph& A, DistGraph& B );
     friend void Copy( const DistGraph& A, Graph& B );
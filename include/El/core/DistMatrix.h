@@ -1243,6 +1243,25 @@ EL_EXPORT ElError ElDistMatrixQueueUpdate_c
 EL_EXPORT ElError ElDistMatrixQueueUpdate_z
 ( ElDistMatrix_z A, ElInt i, ElInt j, complex_double value );
 
+/* void AbstractDistMatrix<T>::QueueUpdates
+   ( Int numEntries, const Int* rows, const Int* cols, const T* values )
+   --------------------------------------------------------------------- */
+EL_EXPORT ElError ElDistMatrixQueueUpdates_i
+( ElDistMatrix_i A, ElInt numEntries,
+  const ElInt* rows, const ElInt* cols, const ElInt* values );
+EL_EXPORT ElError ElDistMatrixQueueUpdates_s
+( ElDistMatrix_s A, ElInt numEntries,
+  const ElInt* rows, const ElInt* cols, const float* values );
+EL_EXPORT ElError ElDistMatrixQueueUpdates_d
+( ElDistMatrix_d A, ElInt numEntries,
+  const ElInt* rows, const ElInt* cols, const double* values );
+EL_EXPORT ElError ElDistMatrixQueueUpdates_c
+( ElDistMatrix_c A, ElInt numEntries,
+  const ElInt* rows, const ElInt* cols, const complex_float* values );
+EL_EXPORT ElError ElDistMatrixQueueUpdates_z
+( ElDistMatrix_z A, ElInt numEntries,
+  const ElInt* rows, const ElInt* cols, const complex_double* values );
+
 /* void AbstractDistMatrix<T>::ProcessQueues()
    ------------------------------------------- */
 EL_EXPORT ElError ElDistMatrixProcessQueues_i( ElDistMatrix_i A );
@@ -228,11 +228,22 @@ public:
     void Reserve( Int numRemoteEntries );
     void QueueUpdate( const Entry<Ring>& entry ) EL_NO_RELEASE_EXCEPT;
     void QueueUpdate( Int i, Int j, Ring value ) EL_NO_RELEASE_EXCEPT;
+    // Queue the updates A(rows[e],cols[e]) += values[e] for 0 <= e < numEntries
+    void QueueUpdates
+    ( Int numEntries, const Int* rows, const Int* cols, const Ring* values );
+    // Queue the updates A(rows[s],cols[t]) += ASub(s,t), e.g., for the
+    // assembly of dense element matrices
+    void QueueSubmatrixUpdate
+    ( const vector<Int>& rows,
+      const vector<Int>& cols,
+      const El::Matrix<Ring>& ASub );
+    // Duplicate updates of the same entry are summed before being sent
     void ProcessQueues( bool includeViewers=true );
 
     // Batch extraction of remote entries
     // ----------------------------------
     void ReservePulls( Int numPulls ) const;
+    // Repeated pulls of the same entry are only requested once
     void QueuePull( Int i, Int j ) const EL_NO_RELEASE_EXCEPT;
     void ProcessPullQueue
     ( Ring* pullBuf, bool includeViewers=true ) const;
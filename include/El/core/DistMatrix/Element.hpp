@@ -153,6 +153,55 @@ private:
     template<typename S> friend class BlockMatrix;
 };
 
+// Inlinable maps between the local and global indices of one dimension of an
+// elementally distributed matrix
+// ==========================================================================
+// Entry-wise traversals should prefer these to the virtual (and out-of-line)
+// GlobalRow, GlobalCol, and LocalRowOffset member functions. Since STAR
+// dimensions are not distributed, their map is the identity.
+
+class StridedIndexMap
+{
+public:
+    StridedIndexMap( Int shift, Int stride ) EL_NO_EXCEPT
+    : shift_(shift), stride_(stride) { }
+
+    // The global index of local index iLoc
+    Int Global( Int iLoc ) const EL_NO_EXCEPT
+    { return shift_ + iLoc*stride_; }
+
+    // The number of local indices whose global indices are less than i
+    Int LocalOffset( Int i ) const EL_NO_EXCEPT
+    { return Length_( i, shift_, stride_ ); }
+
+    // Whether global index i is assigned to this process
+    bool IsLocal( Int i ) const EL_NO_EXCEPT
+    { return i >= shift_ && (i-shift_) % stride_ == 0; }
+
+    // The local index of the locally assigned global index i
+    Int Local( Int i ) const EL_NO_EXCEPT
+    { return (i-shift_) / stride_; }
+
+private:
+    Int shift_, stride_;
+};
+
+class IdentityIndexMap
+{
+public:
+    IdentityIndexMap( Int shift=0, Int stride=1 ) EL_NO_EXCEPT { }
+
+    Int Global( Int iLoc ) const EL_NO_EXCEPT { return iLoc; }
+    Int LocalOffset( Int i ) const EL_NO_EXCEPT { return i; }
+    bool IsLocal( Int i ) const EL_NO_EXCEPT { return true; }
+    Int Local( Int i ) const EL_NO_EXCEPT { return i; }
+};
+
+template<Dist U>
+using ElementalIndexMap =
+  typename std::conditional
+  <U==STAR,IdentityIndexMap,StridedIndexMap>::type;
+
 template<typename Ring>
 void AssertConforming1x2
 ( const ElementalMatrix<Ring>& AL, const ElementalMatrix<Ring>& AR );
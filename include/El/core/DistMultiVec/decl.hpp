@@ -34,6 +34,8 @@ public:
     DistMultiVec
     ( Int height, Int width, const El::Grid& grid=El::Grid::Default() );
     DistMultiVec( const DistMultiVec<Ring>& A );
+    // Move the local data of the given multivector, which is left empty
+    DistMultiVec( DistMultiVec<Ring>&& A );
     ~DistMultiVec();
 
     // Assignment  and reconfiguration
@@ -48,6 +50,17 @@ public:
     // -----------------------
     void SetGrid( const El::Grid& grid );
 
+    // Views
+    // -----
+    // Treat the given buffer, with the given leading dimension, as the local
+    // rows of a height x width multivector over the given grid, without
+    // making a copy
+    void Attach
+    ( Int height, Int width, const El::Grid& grid, Ring* buffer, Int ldim );
+    void LockedAttach
+    ( Int height, Int width, const El::Grid& grid,
+      const Ring* buffer, Int ldim );
+
     // Operator overloading
     // ====================
 
@@ -66,6 +79,7 @@ public:
     // ----------
     const DistMultiVec<Ring>& operator=( const DistMultiVec<Ring>& X );
     const DistMultiVec<Ring>& operator=( const AbstractDistMatrix<Ring>& X );
+    DistMultiVec<Ring>& operator=( DistMultiVec<Ring>&& X );
 
     // Rescaling
     // ---------
@@ -137,6 +151,8 @@ private:
     // --------------
     vector<Entry<Ring>> remoteUpdates_;
 
+    // Returns the local height implied by the height and grid
+    Int InitializeBlocksize();
     void InitializeLocalData();
 };
 
@@ -52,6 +52,14 @@ DistMultiVec<Ring>::DistMultiVec( const DistMultiVec<Ring>& A )
     )
 }
 
+template<typename Ring>
+DistMultiVec<Ring>::DistMultiVec( DistMultiVec<Ring>&& A )
+: grid_(A.grid_)
+{
+    EL_DEBUG_CSE
+    *this = std::move(A);
+}
+
 template<typename Ring>
 DistMultiVec<Ring>::~DistMultiVec() { }
 
@@ -74,7 +82,7 @@ void DistMultiVec<Ring>::Empty( bool freeMemory )
 }
 
 template<typename Ring>
-void DistMultiVec<Ring>::InitializeLocalData()
+Int DistMultiVec<Ring>::InitializeBlocksize()
 {
     EL_DEBUG_CSE
     const int gridRank = grid_->Rank();
@@ -83,6 +91,14 @@ void DistMultiVec<Ring>::InitializeLocalData()
     if( blocksize_*gridSize < height_ || height_ == 0 )
         ++blocksize_;
     const Int localHeight = Min(blocksize_,Max(0,height_-blocksize_*gridRank));
+    return localHeight;
+}
+
+template<typename Ring>
+void DistMultiVec<Ring>::InitializeLocalData()
+{
+    EL_DEBUG_CSE
+    const Int localHeight = InitializeBlocksize();
     multiVec_.Resize( localHeight, width_ );
 }
 
@@ -112,6 +128,34 @@ void DistMultiVec<Ring>::SetGrid( const El::Grid& grid )
     Resize( 0, 0 );
 }
 
+// Views
+// -----
+template<typename Ring>
+void DistMultiVec<Ring>::Attach
+( Int height, Int width, const El::Grid& grid, Ring* buffer, Int ldim )
+{
+    EL_DEBUG_CSE
+    grid_ = &grid;
+    height_ = height;
+    width_ = width;
+    const Int localHeight = InitializeBlocksize();
+    multiVec_.Attach( localHeight, width_, buffer, ldim );
+    SwapClear( remoteUpdates_ );
+}
+
+template<typename Ring>
+void DistMultiVec<Ring>::LockedAttach
+( Int height, Int width, const El::Grid& grid, const Ring* buffer, Int ldim )
+{
+    EL_DEBUG_CSE
+    grid_ = &grid;
+    height_ = height;
+    width_ = width;
+    const Int localHeight = InitializeBlocksize();
+    multiVec_.LockedAttach( localHeight, width_, buffer, ldim );
+    SwapClear( remoteUpdates_ );
+}
+
 // Operator overloading
 // ====================
 
@@ -135,6 +179,22 @@ DistMultiVec<Ring>::operator=( const AbstractDistMatrix<Ring>& A )
     return *this;
 }
 
+template<typename Ring>
+DistMultiVec<Ring>& DistMultiVec<Ring>::operator=( DistMultiVec<Ring>&& A )
+{
+    EL_DEBUG_CSE
+    if( &A == this )
+        return *this;
+    height_ = A.height_;
+    width_ = A.width_;
+    grid_ = A.grid_;
+    blocksize_ = A.blocksize_;
+    multiVec_ = std::move(A.multiVec_);
+    remoteUpdates_ = std::move(A.remoteUpdates_);
+    A.Empty();
+    return *this;
+}
+
 // Make a copy of a submatrix
 // --------------------------
 template<typename Ring>
@@ -142,6 +142,27 @@ public:
     ( AbstractDistMatrix<T>& A,
       Int offset=0 ) const;
 
+    // Permute the rows (columns) of several matrices, which must share a
+    // grid and column (row) communicator, at once. A swap sequence is
+    // compiled into the single set of rows (columns) that it moves, which
+    // are then exchanged as contiguous local runs within one all-to-all.
+    template<typename T>
+    void PermuteCols
+    ( const vector<AbstractDistMatrix<T>*>& matrices,
+      Int offset=0 ) const;
+    template<typename T>
+    void InversePermuteCols
+    ( const vector<AbstractDistMatrix<T>*>& matrices,
+      Int offset=0 ) const;
+    template<typename T>
+    void PermuteRows
+    ( const vector<AbstractDistMatrix<T>*>& matrices,
+      Int offset=0 ) const;
+    template<typename T>
+    void InversePermuteRows
+    ( const vector<AbstractDistMatrix<T>*>& matrices,
+      Int offset=0 ) const;
+
     template<typename T>
     void PermuteSymmetrically
     ( UpperOrLower uplo,
@@ -189,6 +210,10 @@ private:
     typedef std::pair<Int,mpi::Comm> keyType_;
     mutable std::map<keyType_,PermutationMeta> rowMeta_, colMeta_;
     mutable bool staleMeta_=false;
+
+    // The (destination,source) pairs of the indices moved by the swap
+    // sequence (or its inverse) when shifted by 'offset'
+    vector<pair<Int,Int>> SwapMoves( Int offset, bool inverse ) const;
 };
 
 } // namespace El
@@ -187,6 +187,31 @@ EL_EXPORT ElError ElDistSparseMatrixQueueLocalUpdate_c
 EL_EXPORT ElError ElDistSparseMatrixQueueLocalUpdate_z
 ( ElDistSparseMatrix_z A, ElInt localRow, ElInt col, complex_double value );
 
+/* void DistSparseMatrix<T>::QueueUpdates
+   ( Int numEntries, const Int* rows, const Int* cols, const T* values,
+     bool passive )
+   ------------------------------------------------------------------- */
+EL_EXPORT ElError ElDistSparseMatrixQueueUpdates_i
+( ElDistSparseMatrix_i A, ElInt numEntries,
+  const ElInt* rows, const ElInt* cols, const ElInt* values,
+  bool passive );
+EL_EXPORT ElError ElDistSparseMatrixQueueUpdates_s
+( ElDistSparseMatrix_s A, ElInt numEntries,
+  const ElInt* rows, const ElInt* cols, const float* values,
+  bool passive );
+EL_EXPORT ElError ElDistSparseMatrixQueueUpdates_d
+( ElDistSparseMatrix_d A, ElInt numEntries,
+  const ElInt* rows, const ElInt* cols, const double* values,
+  bool passive );
+EL_EXPORT ElError ElDistSparseMatrixQueueUpdates_c
+( ElDistSparseMatrix_c A, ElInt numEntries,
+  const ElInt* rows, const ElInt* cols, const complex_float* values,
+  bool passive );
+EL_EXPORT ElError ElDistSparseMatrixQueueUpdates_z
+( ElDistSparseMatrix_z A, ElInt numEntries,
+  const ElInt* rows, const ElInt* cols, const complex_double* values,
+  bool passive );
+
 /* void DistSparseMatrix<T>::QueueZero( Int row, Int col, bool passive )
    --------------------------------------------------------------------- */
 EL_EXPORT ElError ElDistSparseMatrixQueueZero_i
@@ -234,6 +259,45 @@ ElDistSparseMatrixProcessLocalQueues_c( ElDistSparseMatrix_c A );
 EL_EXPORT ElError
 ElDistSparseMatrixProcessLocalQueues_z( ElDistSparseMatrix_z A );
 
+/* void DistSparseMatrix<T>::AssembleCOO
+   ( Int numEntries, const Int* rows, const Int* cols, const T* values )
+   --------------------------------------------------------------------- */
+EL_EXPORT ElError ElDistSparseMatrixAssembleCOO_i
+( ElDistSparseMatrix_i A, ElInt numEntries,
+  const ElInt* rows, const ElInt* cols, const ElInt* values );
+EL_EXPORT ElError ElDistSparseMatrixAssembleCOO_s
+( ElDistSparseMatrix_s A, ElInt numEntries,
+  const ElInt* rows, const ElInt* cols, const float* values );
+EL_EXPORT ElError ElDistSparseMatrixAssembleCOO_d
+( ElDistSparseMatrix_d A, ElInt numEntries,
+  const ElInt* rows, const ElInt* cols, const double* values );
+EL_EXPORT ElError ElDistSparseMatrixAssembleCOO_c
+( ElDistSparseMatrix_c A, ElInt numEntries,
+  const ElInt* rows, const ElInt* cols, const complex_float* values );
+EL_EXPORT ElError ElDistSparseMatrixAssembleCOO_z
+( ElDistSparseMatrix_z A, ElInt numEntries,
+  const ElInt* rows, const ElInt* cols, const complex_double* values );
+
+/* void DistSparseMatrix<T>::AssembleCSR
+   ( Int firstRow, Int numRows,
+     const Int* rowOffsets, const Int* cols, const T* values )
+   ---------------------------------------------------------- */
+EL_EXPORT ElError ElDistSparseMatrixAssembleCSR_i
+( ElDistSparseMatrix_i A, ElInt firstRow, ElInt numRows,
+  const ElInt* rowOffsets, const ElInt* cols, const ElInt* values );
+EL_EXPORT ElError ElDistSparseMatrixAssembleCSR_s
+( ElDistSparseMatrix_s A, ElInt firstRow, ElInt numRows,
+  const ElInt* rowOffsets, const ElInt* cols, const float* values );
+EL_EXPORT ElError ElDistSparseMatrixAssembleCSR_d
+( ElDistSparseMatrix_d A, ElInt firstRow, ElInt numRows,
+  const ElInt* rowOffsets, const ElInt* cols, const double* values );
+EL_EXPORT ElError ElDistSparseMatrixAssembleCSR_c
+( ElDistSparseMatrix_c A, ElInt firstRow, ElInt numRows,
+  const ElInt* rowOffsets, const ElInt* cols, const complex_float* values );
+EL_EXPORT ElError ElDistSparseMatrixAssembleCSR_z
+( ElDistSparseMatrix_z A, ElInt firstRow, ElInt numRows,
+  const ElInt* rowOffsets, const ElInt* cols, const complex_double* values );
+
 /* Queries
    ======= */
 
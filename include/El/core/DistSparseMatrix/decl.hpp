@@ -36,7 +36,8 @@ public:
     DistSparseMatrix
     ( Int height, Int width, const El::Grid& grid=El::Grid::Default() );
     DistSparseMatrix( const DistSparseMatrix<Ring>& A );
-    // TODO(poulson): Move constructor
+    // Move the graph and values of the given matrix, which is left empty
+    DistSparseMatrix( DistSparseMatrix<Ring>&& A );
     ~DistSparseMatrix();
 
     // Assignment and reconfiguration
@@ -77,6 +78,11 @@ public:
     EL_NO_RELEASE_EXCEPT;
     void QueueZero( Int row, Int col, bool passive=false )
     EL_NO_RELEASE_EXCEPT;
+    // Queue the updates A(rows[e],cols[e]) += values[e] for 0 <= e < numEntries
+    // after reserving space for them
+    void QueueUpdates
+    ( Int numEntries, const Int* rows, const Int* cols, const Ring* values,
+      bool passive=false );
 
     void QueueLocalUpdate( const Entry<Ring>& localEntry )
     EL_NO_RELEASE_EXCEPT;
@@ -88,13 +94,34 @@ public:
     void ProcessQueues();
     void ProcessLocalQueues();
 
+    // Bulk assembly of pre-sized chunks
+    // ^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^
+    // Overwrite the matrix with the sum of the given (possibly remote and
+    // duplicated) triplets. If every process passes the same rows and columns
+    // as in the previous call, the communication and merge pattern of that
+    // call is reused so that only the values are exchanged.
+    void AssembleCOO
+    ( Int numEntries, const Int* rows, const Int* cols, const Ring* values );
+    // The same, but for the CSR representation of the rows
+    // [firstRow,firstRow+numRows)
+    void AssembleCSR
+    ( Int firstRow, Int numRows,
+      const Int* rowOffsets, const Int* cols, const Ring* values );
+
     // Operator overloading
     // ====================
 
     // Make a copy
     // -----------
+    // If this matrix already has the same local sparsity pattern as A (e.g.,
+    // it is a regularized copy of A from a previous interior point
+    // iteration), only the values are copied and the graph, along with its
+    // multiplication metadata, is kept in place.
     const DistSparseMatrix<Ring>& operator=( const DistSparseMatrix<Ring>& A );
-    // TODO(poulson): Move assignment
+
+    // Move assignment
+    // ---------------
+    DistSparseMatrix<Ring>& operator=( DistSparseMatrix<Ring>&& A );
 
     // Make a copy of a submatrix
     // --------------------------
@@ -168,7 +195,7 @@ public:
     // total number of nonzeros divided by the number of processes
     double Imbalance() const EL_NO_RELEASE_EXCEPT;
 
-    DistGraphMultMeta InitializeMultMeta() const;
+    const DistGraphMultMeta& InitializeMultMeta() const;
 
     void MappedSources
     ( const DistMap& reordering, vector<Int>& mappedSources ) const;
@@ -184,7 +211,20 @@ private:
     vector<Ring> vals_;
     vector<Ring> remoteVals_;
 
+    // The pattern of the last bulk assembly, where 'sendPerm' maps each input
+    // triplet to its position in the send buffer and 'recvDests' maps each
+    // received triplet to the local entry it is summed into
+    struct AssemblyPlan
+    {
+        bool valid=false;
+        unsigned long long inputHash=0, structureHash=0;
+        vector<int> sendCounts, sendOffs, recvCounts, recvOffs;
+        vector<Int> sendPerm, recvDests;
+    };
+    AssemblyPlan assemblyPlan_;
+
     void InitializeLocalData();
+    bool SameLocalPattern( const DistSparseMatrix<Ring>& A ) const;
 
     static bool CompareEntries( const Entry<Ring>& a, const Entry<Ring>& b );
 
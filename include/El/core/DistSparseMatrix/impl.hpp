@@ -53,6 +53,14 @@ DistSparseMatrix<Ring>::DistSparseMatrix( const DistSparseMatrix<Ring>& A )
     )
 }
 
+template<typename Ring>
+DistSparseMatrix<Ring>::DistSparseMatrix( DistSparseMatrix<Ring>&& A )
+: distGraph_(A.Grid())
+{
+    EL_DEBUG_CSE
+    *this = std::move(A);
+}
+
 template<typename Ring>
 DistSparseMatrix<Ring>::~DistSparseMatrix()
 { }
@@ -68,10 +76,12 @@ void DistSparseMatrix<Ring>::Empty( bool freeMemory )
     EL_DEBUG_CSE
     distGraph_.Empty( freeMemory );
     if( freeMemory )
+    {
         SwapClear( vals_ );
+        assemblyPlan_ = AssemblyPlan();
+    }
     else
         vals_.resize( 0 );
-    distGraph_.multMeta.Clear();
 
     SwapClear( remoteVals_ );
 }
@@ -96,6 +106,7 @@ void DistSparseMatrix<Ring>::SetGrid( const El::Grid& grid )
     distGraph_.SetGrid( grid );
     vals_.resize( 0 );
     SwapClear( remoteVals_ );
+    assemblyPlan_ = AssemblyPlan();
 }
 
 // Assembly
@@ -189,6 +200,24 @@ void DistSparseMatrix<Ring>::QueueUpdate
 EL_NO_RELEASE_EXCEPT
 { QueueUpdate( entry.i, entry.j, entry.value, passive ); }
 
+template<typename Ring>
+void DistSparseMatrix<Ring>::QueueUpdates
+( Int numEntries, const Int* rows, const Int* cols, const Ring* values,
+  bool passive )
+{
+    EL_DEBUG_CSE
+    const Int firstLocalRow = FirstLocalRow();
+    const Int localHeight = LocalHeight();
+    Int numLocal = 0;
+    for( Int e=0; e<numEntries; ++e )
+        if( rows[e] >= firstLocalRow && rows[e] < firstLocalRow+localHeight )
+            ++numLocal;
+    const Int numRemote = ( passive ? 0 : numEntries-numLocal );
+    Reserve( FrozenSparsity() ? 0 : numLocal, numRemote );
+    for( Int e=0; e<numEntries; ++e )
+        QueueUpdate( rows[e], cols[e], values[e], passive );
+}
+
 template<typename Ring>
 void DistSparseMatrix<Ring>::QueueLocalUpdate
 ( Int localRow, Int col, const Ring& value ) EL_NO_RELEASE_EXCEPT
@@ -203,7 +232,7 @@ void DistSparseMatrix<Ring>::QueueLocalUpdate
     {
         distGraph_.QueueLocalConnection( localRow, col );
         vals_.push_back( value );
-        distGraph_.multMeta.ready = false;
+        distGraph_.multMeta.Invalidate();
     }
 }
 
@@ -238,7 +267,7 @@ EL_NO_RELEASE_EXCEPT
     else
     {
         distGraph_.QueueLocalDisconnection( localRow, col );
-        distGraph_.multMeta.ready = false;
+        distGraph_.multMeta.Invalidate();
     }
 }
 
@@ -247,10 +276,14 @@ void DistSparseMatrix<Ring>::ProcessQueues()
 {
     EL_DEBUG_CSE
     EL_DEBUG_ONLY(
-      if( distGraph_.sources_.size() != distGraph_.targets_.size() ||
+      if( (!distGraph_.compressedSources_ &&
+           distGraph_.sources_.size() != distGraph_.targets_.size()) ||
           distGraph_.targets_.size() != vals_.size() )
           LogicError("Inconsistent sparse matrix buffer sizes");
     )
+    // Every process must agree that the multiplication metadata is stale
+    if( !FrozenSparsity() )
+        distGraph_.multMeta.Invalidate();
 
     // Send the remote updates
     // =======================
@@ -332,6 +365,7 @@ void DistSparseMatrix<Ring>::ProcessLocalQueues()
     EL_DEBUG_CSE
     if( distGraph_.locallyConsistent_ )
         return;
+    distGraph_.ExpandSources();
 
     Int numRemoved = 0;
     const Int numLocalEntries = vals_.size();
@@ -393,6 +427,188 @@ void DistSparseMatrix<Ring>::ProcessLocalQueues()
     distGraph_.locallyConsistent_ = true;
 }
 
+template<typename Ring>
+void DistSparseMatrix<Ring>::AssembleCOO
+( Int numEntries, const Int* rows, const Int* cols, const Ring* values )
+{
+    EL_DEBUG_CSE
+    mpi::Comm comm = distGraph_.grid_->Comm();
+    const int commSize = distGraph_.grid_->Size();
+    const Int height = Height();
+    const Int width = Width();
+    auto& plan = assemblyPlan_;
+    EL_DEBUG_ONLY(
+      for( Int e=0; e<numEntries; ++e )
+          if( rows[e] < 0 || rows[e] >= height ||
+              cols[e] < 0 || cols[e] >= width )
+              LogicError
+              ("Entry (",rows[e],",",cols[e],") is out of bounds of ",
+               height," x ",width," matrix");
+    )
+    SwapClear( distGraph_.remoteSources_ );
+    SwapClear( distGraph_.remoteTargets_ );
+    SwapClear( distGraph_.remoteRemovals_ );
+    SwapClear( distGraph_.markedForRemoval_ );
+    SwapClear( remoteVals_ );
+
+    unsigned long long inputHash = HASH_SEED;
+    HashCombine( inputHash, height );
+    HashCombine( inputHash, width );
+    HashCombine( inputHash, numEntries );
+    for( Int e=0; e<numEntries; ++e )
+    {
+        HashCombine( inputHash, rows[e] );
+        HashCombine( inputHash, cols[e] );
+    }
+    const int reusable =
+      ( plan.valid &&
+        plan.inputHash == inputHash &&
+        plan.structureHash == distGraph_.StructureHash() ? 1 : 0 );
+    if( mpi::AllReduce( reusable, mpi::MIN, comm ) )
+    {
+        // Only exchange the values and scatter them into the same pattern
+        vector<Ring> sendVals( numEntries );
+        for( Int e=0; e<numEntries; ++e )
+            sendVals[plan.sendPerm[e]] = values[e];
+        const Int totalRecv = plan.recvDests.size();
+        vector<Ring> recvVals( totalRecv );
+        mpi::AllToAll
+        ( sendVals.data(), plan.sendCounts.data(), plan.sendOffs.data(),
+          recvVals.data(), plan.recvCounts.data(), plan.recvOffs.data(),
+          comm );
+        std::fill( vals_.begin(), vals_.end(), Ring(0) );
+        for( Int t=0; t<totalRecv; ++t )
+            vals_[plan.recvDests[t]] += recvVals[t];
+        return;
+    }
+    plan.valid = false;
+
+    // Bucket the triplets by owner with a counting sort and exchange them
+    // ===================================================================
+    plan.sendCounts.assign( commSize, 0 );
+    for( Int e=0; e<numEntries; ++e )
+        ++plan.sendCounts[RowOwner(rows[e])];
+    const int totalSend = Scan( plan.sendCounts, plan.sendOffs );
+    plan.sendPerm.resize( numEntries );
+    vector<Int> sendRows(totalSend), sendCols(totalSend);
+    vector<Ring> sendVals(totalSend);
+    {
+        auto offs = plan.sendOffs;
+        for( Int e=0; e<numEntries; ++e )
+        {
+            const Int k = offs[RowOwner(rows[e])]++;
+            plan.sendPerm[e] = k;
+            sendRows[k] = rows[e];
+            sendCols[k] = cols[e];
+            sendVals[k] = values[e];
+        }
+    }
+    plan.recvCounts.resize( commSize );
+    mpi::AllToAll( plan.sendCounts.data(), 1, plan.recvCounts.data(), 1, comm );
+    const int totalRecv = Scan( plan.recvCounts, plan.recvOffs );
+    vector<Int> recvRows(totalRecv), recvCols(totalRecv);
+    vector<Ring> recvVals(totalRecv);
+    mpi::AllToAll
+    ( sendRows.data(), plan.sendCounts.data(), plan.sendOffs.data(),
+      recvRows.data(), plan.recvCounts.data(), plan.recvOffs.data(), comm );
+    mpi::AllToAll
+    ( sendCols.data(), plan.sendCounts.data(), plan.sendOffs.data(),
+      recvCols.data(), plan.recvCounts.data(), plan.recvOffs.data(), comm );
+    mpi::AllToAll
+    ( sendVals.data(), plan.sendCounts.data(), plan.sendOffs.data(),
+      recvVals.data(), plan.recvCounts.data(), plan.recvOffs.data(), comm );
+    SwapClear( sendRows );
+    SwapClear( sendCols );
+    SwapClear( sendVals );
+
+    // Bucket the received triplets by local row with a counting sort
+    // ==============================================================
+    const Int localHeight = LocalHeight();
+    const Int firstLocalRow = FirstLocalRow();
+    vector<Int> rowOffs( localHeight+1, 0 );
+    for( Int t=0; t<totalRecv; ++t )
+        ++rowOffs[recvRows[t]-firstLocalRow+1];
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+        rowOffs[iLoc+1] += rowOffs[iLoc];
+    vector<pair<Int,Int>> bucket( totalRecv );
+    {
+        auto offs = rowOffs;
+        for( Int t=0; t<totalRecv; ++t )
+            bucket[offs[recvRows[t]-firstLocalRow]++] =
+              pair<Int,Int>(recvCols[t],t);
+    }
+    SwapClear( recvRows );
+    SwapClear( recvCols );
+
+    // Sort each row by column and count its unique columns
+    // ====================================================
+    vector<Int> newRowOffs( localHeight+1, 0 );
+    EL_PARALLEL_FOR_IF(ParallelizeLoop(totalRecv))
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+    {
+        const auto beg = bucket.begin()+rowOffs[iLoc];
+        const auto end = bucket.begin()+rowOffs[iLoc+1];
+        std::sort( beg, end );
+        Int numUnique = 0;
+        for( auto it=beg; it!=end; ++it )
+            if( it == beg || it->first != (it-1)->first )
+                ++numUnique;
+        newRowOffs[iLoc+1] = numUnique;
+    }
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+        newRowOffs[iLoc+1] += newRowOffs[iLoc];
+
+    // Merge the duplicates in a single pass
+    // =====================================
+    const Int numLocalEntries = newRowOffs[localHeight];
+    distGraph_.sources_.resize( numLocalEntries );
+    distGraph_.targets_.resize( numLocalEntries );
+    vals_.assign( numLocalEntries, Ring(0) );
+    plan.recvDests.resize( totalRecv );
+    EL_PARALLEL_FOR_IF(ParallelizeLoop(totalRecv))
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+    {
+        const Int i = firstLocalRow + iLoc;
+        Int dest = newRowOffs[iLoc]-1;
+        for( Int k=rowOffs[iLoc]; k<rowOffs[iLoc+1]; ++k )
+        {
+            const Int j = bucket[k].first;
+            const Int t = bucket[k].second;
+            if( k == rowOffs[iLoc] || j != bucket[k-1].first )
+            {
+                ++dest;
+                distGraph_.sources_[dest] = i;
+                distGraph_.targets_[dest] = j;
+            }
+            vals_[dest] += recvVals[t];
+            plan.recvDests[t] = dest;
+        }
+    }
+    distGraph_.localSourceOffsets_ = newRowOffs;
+    distGraph_.locallyConsistent_ = true;
+    distGraph_.compressedSources_ = false;
+    distGraph_.multMeta.Invalidate();
+
+    plan.inputHash = inputHash;
+    plan.structureHash = distGraph_.StructureHash();
+    plan.valid = true;
+}
+
+template<typename Ring>
+void DistSparseMatrix<Ring>::AssembleCSR
+( Int firstRow, Int numRows,
+  const Int* rowOffsets, const Int* cols, const Ring* values )
+{
+    EL_DEBUG_CSE
+    const Int numEntries = rowOffsets[numRows] - rowOffsets[0];
+    vector<Int> rows( numEntries );
+    for( Int i=0; i<numRows; ++i )
+        for( Int e=rowOffsets[i]; e<rowOffsets[i+1]; ++e )
+            rows[e-rowOffsets[0]] = firstRow + i;
+    AssembleCOO
+    ( numEntries, rows.data(), &cols[rowOffsets[0]], &values[rowOffsets[0]] );
+}
+
 // Operator overloading
 // ====================
 
@@ -403,12 +619,63 @@ const DistSparseMatrix<Ring>&
 DistSparseMatrix<Ring>::operator=( const DistSparseMatrix<Ring>& A )
 {
     EL_DEBUG_CSE
+    if( &A == this )
+        return *this;
+    if( SameLocalPattern( A ) )
+    {
+        vals_ = A.vals_;
+        // The pattern is only compared locally, so the metadata of A must be
+        // adopted regardless so that every process agrees upon the exchange
+        // sizes (as those whose patterns differ copy the metadata of A)
+        distGraph_.multMeta = A.distGraph_.multMeta;
+        return *this;
+    }
     distGraph_ = A.distGraph_;
     vals_ = A.vals_;
     remoteVals_ = A.remoteVals_;
     return *this;
 }
 
+template<typename Ring>
+bool DistSparseMatrix<Ring>::SameLocalPattern
+( const DistSparseMatrix<Ring>& A ) const
+{
+    EL_DEBUG_CSE
+    const El::DistGraph& graph = distGraph_;
+    const El::DistGraph& graphA = A.distGraph_;
+    if( graph.grid_ != graphA.grid_ ||
+        graph.numSources_ != graphA.numSources_ ||
+        graph.numTargets_ != graphA.numTargets_ ||
+        graph.frozenSparsity_ != graphA.frozenSparsity_ ||
+        !graph.locallyConsistent_ || !graphA.locallyConsistent_ )
+        return false;
+    if( !graph.remoteSources_.empty() || !graphA.remoteSources_.empty() ||
+        !graph.remoteRemovals_.empty() || !graphA.remoteRemovals_.empty() ||
+        !graph.markedForRemoval_.empty() || !graphA.markedForRemoval_.empty() )
+        return false;
+    // Consistent graphs are determined by their offsets and targets, which
+    // avoids requiring either graph to carry its (possibly freed) sources
+    return graph.localSourceOffsets_ == graphA.localSourceOffsets_ &&
+           graph.targets_ == graphA.targets_;
+}
+
+// Move assignment
+// ---------------
+template<typename Ring>
+DistSparseMatrix<Ring>&
+DistSparseMatrix<Ring>::operator=( DistSparseMatrix<Ring>&& A )
+{
+    EL_DEBUG_CSE
+    if( &A == this )
+        return *this;
+    distGraph_ = std::move(A.distGraph_);
+    vals_ = std::move(A.vals_);
+    remoteVals_ = std::move(A.remoteVals_);
+    assemblyPlan_ = std::move(A.assemblyPlan_);
+    A.Empty();
+    return *this;
+}
+
 // Make a copy of a submatrix
 // --------------------------
 template<typename Ring>
@@ -727,7 +994,7 @@ void DistSparseMatrix<Ring>::AssertLocallyConsistent() const
         LogicError("Distributed sparse matrix must be consistent");
 }
 template<typename Ring>
-DistGraphMultMeta DistSparseMatrix<Ring>::InitializeMultMeta() const
+const DistGraphMultMeta& DistSparseMatrix<Ring>::InitializeMultMeta() const
 {
     EL_DEBUG_CSE
     return distGraph_.InitializeMultMeta();
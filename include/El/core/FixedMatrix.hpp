@@ -0,0 +1,50 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_CORE_FIXEDMATRIX_HPP
+#define EL_CORE_FIXEDMATRIX_HPP
+
+namespace El {
+
+// A column-major M x N matrix whose dimensions are known at compile time and
+// whose entries are stored inline (on the stack, for local variables). It is
+// meant for the 2x2 and 3x3 building blocks of inner loops (e.g., the pivots
+// of quasi-diagonal solves), where the heap allocation, the runtime sizes,
+// and the bounds checks of a Matrix<T> dominate the cost of the arithmetic.
+// Since the loops over its entries have constant trip counts, the compiler
+// fully unrolls them. No bounds checks are performed, even in debug mode.
+template<typename T,Int M,Int N>
+class FixedMatrix
+{
+public:
+    static_assert( M > 0 && N > 0, "FixedMatrix dimensions must be positive" );
+
+    static constexpr Int Height() { return M; }
+    static constexpr Int Width() { return N; }
+    static constexpr Int LDim() { return M; }
+
+    T* Buffer() EL_NO_EXCEPT { return data_; }
+    const T* LockedBuffer() const EL_NO_EXCEPT { return data_; }
+
+    T& operator()( Int i, Int j ) EL_NO_EXCEPT { return data_[i+j*M]; }
+    const T& operator()( Int i, Int j ) const EL_NO_EXCEPT
+    { return data_[i+j*M]; }
+
+    void Fill( const T& alpha )
+    {
+        for( Int k=0; k<M*N; ++k )
+            data_[k] = alpha;
+    }
+
+private:
+    T data_[M*N];
+};
+
+} // namespace El
+
+#endif // ifndef EL_CORE_FIXEDMATRIX_HPP
@@ -90,14 +90,21 @@ public:
     // For manually modifying/accessing the buffers
     void ForceNumEdges( Int numEdges );
     void ForceConsistency( bool consistent=true ) EL_NO_EXCEPT;
-    Int* SourceBuffer() EL_NO_EXCEPT;
+    Int* SourceBuffer();
     Int* TargetBuffer() EL_NO_EXCEPT;
     Int* OffsetBuffer() EL_NO_EXCEPT;
-    const Int* LockedSourceBuffer() const EL_NO_EXCEPT;
+    const Int* LockedSourceBuffer() const;
     const Int* LockedTargetBuffer() const EL_NO_EXCEPT;
     const Int* LockedOffsetBuffer() const EL_NO_EXCEPT;
     void ComputeSourceOffsets();
 
+    // Since the sources of a consistent graph are redundant with its source
+    // offsets, they can be freed; they are transparently recomputed by the
+    // first routine which requires them (e.g., SourceBuffer or
+    // QueueConnection), while Source(edge) falls back to a binary search
+    void CompressSources();
+    bool CompressedSources() const EL_NO_EXCEPT;
+
     // Queries
     // =======
     Int NumSources() const EL_NO_EXCEPT;
@@ -119,13 +126,18 @@ public:
 private:
     Int numSources_, numTargets_;
     bool frozenSparsity_ = false;
-    vector<Int> sources_, targets_;
+    mutable vector<Int> sources_;
+    vector<Int> targets_;
     set<pair<Int,Int>> markedForRemoval_;
 
     // Helpers for local indexing
     bool consistent_=true;
     vector<Int> sourceOffsets_;
 
+    // Whether sources_ has been freed in favor of sourceOffsets_
+    mutable bool compressedSources_=false;
+    void ExpandSources() const;
+
     friend class DistGraph;
     template<typename F> friend class SparseMatrix;
 
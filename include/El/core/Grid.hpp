@@ -18,6 +18,11 @@ public:
     explicit Grid
     ( mpi::Comm comm=mpi::COMM_WORLD, GridOrder order=COLUMN_MAJOR );
     explicit Grid( mpi::Comm comm, int height, GridOrder order=COLUMN_MAJOR );
+    // A NODE_AWARE_GRID reorders the processes so that those sharing a node
+    // are contiguous and, when possible, chooses the grid height so that
+    // each node holds entire process columns (or rows if ROW_MAJOR)
+    explicit Grid
+    ( mpi::Comm comm, GridTopology topology, GridOrder order=COLUMN_MAJOR );
     ~Grid();
 
     // Simple interface (simpler version of distributed-based interface)
@@ -28,6 +33,9 @@ public:
     int Size() const EL_NO_EXCEPT;         // VCSize() and VRSize()
     int Rank() const EL_NO_RELEASE_EXCEPT; // same as OwningRank()
     GridOrder Order() const EL_NO_EXCEPT;  // either COLUMN_MAJOR or ROW_MAJOR
+    // A process-local identifier which, unlike the address of the grid, is
+    // never reused after the grid is destroyed
+    size_t Id() const EL_NO_EXCEPT;
     mpi::Comm ColComm() const EL_NO_EXCEPT; // MCComm()
     mpi::Comm RowComm() const EL_NO_EXCEPT; // MRComm()
     // VCComm (VRComm) if COLUMN_MAJOR (ROW_MAJOR)
@@ -84,6 +92,16 @@ public:
     EL_NO_RELEASE_EXCEPT;
     int VCToViewing( int VCRank ) const EL_NO_EXCEPT;
 
+    // Node-aware interface
+    bool NodeAware() const EL_NO_EXCEPT;
+    // The viewing processes which share our node (mpi::COMM_NULL unless the
+    // grid is node-aware)
+    mpi::Comm NodeComm() const EL_NO_EXCEPT;
+    // The two-level structure of the MC, MR, VC, or VR communicator, or
+    // nullptr if the grid is not node-aware or the two-level algorithms would
+    // not apply to the communicator
+    mpi::NodeHierarchy* Hierarchy( Dist dist ) const EL_NO_EXCEPT;
+
 #ifdef EL_HAVE_SCALAPACK
     // TODO(poulson): More distribution contexts and handles
     int BlacsVCHandle() const;
@@ -92,6 +110,12 @@ public:
 #endif
 
     static int DefaultHeight( int gridSize ) EL_NO_EXCEPT;
+    // The most square grid height such that each node of 'nodeSize'
+    // processes holds entire columns (rows) of the grid, or nodes hold entire
+    // columns (rows), which falls back to DefaultHeight if 'nodeSize' is not
+    // positive
+    static int NodeAwareHeight
+    ( int gridSize, int nodeSize, GridOrder order=COLUMN_MAJOR ) EL_NO_EXCEPT;
 
     // To be used internally by Elemental
     static void InitializeDefault();
@@ -106,9 +130,12 @@ private:
     int height_, size_, gcd_;
     bool inGrid_;
     GridOrder order_;
+    size_t id_;
+    bool nodeAware_;
 
     static Grid* defaultGrid;
     static Grid* trivialGrid;
+    static size_t nextId;
 
     vector<int> diagsAndRanks_;
     vector<int> vcToViewing_;
@@ -121,7 +148,11 @@ private:
               cartComm_,
               mcComm_, mrComm_,
               mdComm_, mdPerpComm_,
-              vcComm_, vrComm_;
+              vcComm_, vrComm_,
+              nodeComm_;
+
+    unique_ptr<mpi::NodeHierarchy> mcHierarchy_, mrHierarchy_,
+                                   vcHierarchy_, vrHierarchy_;
 
     int viewingRank_,
         owningRank_,
@@ -135,6 +166,7 @@ private:
 #endif
 
     void SetUpGrid();
+    void SetUpNodeHierarchies();
 
     // Disable copying this class due to MPI_Comm/MPI_Group ownership issues
     // and potential performance loss from duplicating MPI communicators, e.g.,
@@ -146,6 +178,11 @@ private:
 bool operator==( const Grid& A, const Grid& B ) EL_NO_EXCEPT;
 bool operator!=( const Grid& A, const Grid& B ) EL_NO_EXCEPT;
 
+// A grid of the given height over the same viewing and owning processes (in
+// the same VC order) as 'grid', onto which matrices can be moved with Regrid.
+// The construction is collective over the viewing communicator.
+unique_ptr<Grid> ReshapedGrid( const Grid& grid, int height );
+
 inline void AssertSameGrids( const Grid& /*g1*/ ) { }
 
 inline void AssertSameGrids( const Grid& g1, const Grid& g2 )
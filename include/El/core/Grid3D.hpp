@@ -0,0 +1,57 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_GRID3D_HPP
+#define EL_GRID3D_HPP
+
+namespace El {
+
+// A 'numLayers' x (p/numLayers) arrangement of the p processes of a grid for
+// replication-based (2.5D and 3D) algorithms: each layer is a mesh grid owned
+// by a contiguous block of VC ranks of the base grid (and viewed by all of
+// it), and the depth communicator connects the processes with the same rank
+// within their respective layers. Since every layer has the same shape, a
+// DistMatrix with the same dimensions and alignments has the same local
+// layout on each layer, so that layer contributions can be combined directly
+// over the depth communicator.
+class Grid3D
+{
+public:
+    Grid3D( const El::Grid& grid, int numLayers );
+    ~Grid3D();
+
+    const El::Grid& BaseGrid() const EL_NO_EXCEPT { return grid_; }
+    int NumLayers() const EL_NO_EXCEPT { return numLayers_; }
+    int LayerSize() const EL_NO_EXCEPT { return layerSize_; }
+
+    // The layer of this process (and its rank within the depth communicator)
+    int Layer() const EL_NO_RELEASE_EXCEPT;
+    // The rank of this process within its layer
+    int MeshRank() const EL_NO_RELEASE_EXCEPT;
+
+    const El::Grid& LayerGrid( int layer ) const EL_NO_RELEASE_EXCEPT;
+    const El::Grid& MyLayerGrid() const EL_NO_RELEASE_EXCEPT
+    { return LayerGrid( Layer() ); }
+
+    // mpi::COMM_NULL for processes outside of the base grid
+    mpi::Comm DepthComm() const EL_NO_EXCEPT { return depthComm_; }
+
+private:
+    const El::Grid& grid_;
+    int numLayers_, layerSize_;
+    vector<unique_ptr<El::Grid>> layers_;
+    mpi::Comm depthComm_;
+
+    // Disable copying this class due to MPI_Comm ownership
+    const Grid3D& operator=( Grid3D& );
+    Grid3D( const Grid3D& );
+};
+
+} // namespace El
+
+#endif // ifndef EL_GRID3D_HPP
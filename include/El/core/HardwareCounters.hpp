@@ -0,0 +1,73 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_HARDWARECOUNTERS_HPP
+#define EL_HARDWARECOUNTERS_HPP
+
+namespace El {
+
+// Opt-in sampling of the hardware performance counters of the master thread,
+// which are read through PAPI if Elemental was configured with EL_USE_PAPI
+// and otherwise through the Linux perf_event interface. The counters which
+// could not be opened (e.g., due to a restrictive perf_event_paranoid setting
+// or a virtualized processor) are unavailable and always read as zero.
+//
+// While counting, each Timer accumulates the counts of its timed intervals and
+// the profiling regions (see Profile.hpp) are attributed the counts incurred
+// while they were the innermost region.
+enum HardwareCounter
+{
+  HW_CYCLES=0,
+  HW_INSTRUCTIONS,
+  // Accesses to and misses of the last-level cache
+  HW_CACHE_REFERENCES,
+  HW_CACHE_MISSES,
+  // Floating-point operations (only available through PAPI)
+  HW_FLOPS,
+  NUM_HARDWARE_COUNTERS
+};
+const char* HardwareCounterName( HardwareCounter counter );
+
+struct HardwareCounts
+{
+    array<long long,NUM_HARDWARE_COUNTERS> values;
+
+    HardwareCounts() { values.fill( 0 ); }
+
+    long long& operator[]( HardwareCounter counter )
+    { return values[counter]; }
+    long long operator[]( HardwareCounter counter ) const
+    { return values[counter]; }
+
+    HardwareCounts& operator+=( const HardwareCounts& counts );
+    HardwareCounts& operator-=( const HardwareCounts& counts );
+
+    // An estimate of the traffic from main memory, assuming that each miss of
+    // the last-level cache loads a single (64-byte) cache line
+    double MemoryBytes() const;
+};
+HardwareCounts operator-( HardwareCounts a, const HardwareCounts& b );
+
+// Whether Elemental was built with support for either backend
+bool HaveHardwareCounters();
+
+// The counters should be enabled and disabled outside of OpenMP parallel
+// regions. Disabling them closes the counters.
+void EnableHardwareCounters();
+void DisableHardwareCounters();
+bool HardwareCounting();
+// Whether the counter could be opened by the last EnableHardwareCounters
+bool HardwareCounterAvailable( HardwareCounter counter );
+
+// The counts accumulated while counting was enabled (over every enabled
+// period), so that the difference of two readings is never negative
+HardwareCounts ReadHardwareCounters();
+
+} // namespace El
+
+#endif // ifndef EL_HARDWARECOUNTERS_HPP
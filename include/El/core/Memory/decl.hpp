@@ -11,6 +11,119 @@
 
 namespace El {
 
+// Runtime control of the allocator underlying Memory<G>
+// =====================================================
+struct MemoryCtrl
+{
+    // The byte alignment of every buffer (it must be a power of two and is
+    // rounded up to at least alignof(std::max_align_t))
+    size_t alignment=64;
+
+    // Whether or not to recycle freed buffers through a size-class pool
+    bool pool=false;
+
+    // The maximum number of bytes which may be held within the pool
+    size_t maxPoolBytes=size_t(1) << 30;
+
+    // Whether or not every OpenMP thread should first-touch its portion of
+    // each freshly-allocated buffer (so that, with a first-touch NUMA policy,
+    // the pages are bound to the nodes of the threads which will use them)
+    bool firstTouch=false;
+
+    // Whether or not to request (transparent) huge pages for buffers of at
+    // least 'hugePageBytes' bytes (only supported on Linux)
+    bool hugePages=false;
+    size_t hugePageBytes=size_t(1) << 21;
+};
+
+struct MemoryStats
+{
+    // Bytes (and buffers) freshly requested from the operating system
+    size_t allocatedBytes=0;
+    size_t numAllocations=0;
+
+    // Bytes (and buffers) served from the pool rather than the system
+    size_t recycledBytes=0;
+    size_t numRecycles=0;
+
+    // Bytes (and buffers) returned to the operating system
+    size_t freedBytes=0;
+    size_t numFrees=0;
+
+    // The number of bytes currently held within the pool
+    size_t pooledBytes=0;
+
+    // The number of bytes of the buffers which are currently in use and the
+    // maximum of this quantity since the statistics were last reset (the
+    // peak workspace of a routine is therefore the difference between the
+    // peak after calling it and the live bytes when the statistics were
+    // reset)
+    size_t liveBytes=0;
+    size_t peakBytes=0;
+};
+
+void SetMemoryCtrl( const MemoryCtrl& ctrl );
+MemoryCtrl GetMemoryCtrl();
+
+MemoryStats GetMemoryStats();
+void ResetMemoryStats();
+
+// Return all of the buffers held within the pool to the operating system
+void PurgeMemoryPool();
+
+// Opt-in tracking of the memory high-water mark of each profiling region
+// (see Profile.hpp) entered by the master thread of this process. Since the
+// live bytes are those of the entire process, the workspace of a region
+// includes that of its nested regions and of any other threads. Tracking
+// should be enabled and disabled outside of every region. When tracking is
+// enabled, a failed allocation reports the active regions to std::cerr
+// before std::bad_alloc is thrown, and Finalize collectively writes the
+// peaks of each region over the processes to "<ProfilePrefix()>-memory.txt".
+struct MemoryRegionStats
+{
+    size_t numEntries=0;
+    // The maximum, over the entries of the region, of the increase of the
+    // live bytes beyond their number upon entry
+    size_t peakBytes=0;
+    // The maximum number of live bytes of the process within the region
+    size_t peakLiveBytes=0;
+    // The increase of the live bytes since the innermost active entry of the
+    // region (zero if the region is not active)
+    size_t currentBytes=0;
+};
+void EnableMemoryTracking();
+void DisableMemoryTracking();
+bool TrackingMemory();
+void ResetMemoryRegions();
+// The statistics of every region tracked since the last reset, including
+// the portions of the active regions which have elapsed
+vector<pair<string,MemoryRegionStats>> GetMemoryRegionStats();
+void PrintMemoryRegions( ostream& os );
+
+// An optional per-process limit on the number of live bytes, which the
+// algorithms with memory/communication trade-offs (e.g., GEMM_25D and the
+// out-of-core fronts of sparse LDL) consult when sizing their workspaces. It
+// is not enforced by the allocator and is unlimited by default.
+void SetMemoryBudget( double numBytes );
+double MemoryBudget();
+// The number of bytes remaining within the budget (zero if it was exceeded)
+double AvailableMemory();
+
+namespace memory {
+
+// Return an uninitialized buffer of at least 'numBytes' bytes which satisfies
+// the alignment requested through SetMemoryCtrl
+void* Allocate( size_t numBytes );
+
+// Release a buffer returned by Allocate (the pointer is allowed to be null)
+void Deallocate( void* ptr );
+
+// Called by PushProfileRegion and PopProfileRegion while tracking memory
+void PushRegion( const char* name );
+void PopRegion();
+
+} // namespace memory
+
 template<typename G>
 class Memory
 {
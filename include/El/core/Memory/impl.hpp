@@ -14,16 +14,60 @@ namespace {
 template<typename G>
 static G* New( size_t size )
 {
-    return new G[size];
+    G* ptr = static_cast<G*>( memory::Allocate( size*sizeof(G) ) );
+    size_t numConstructed = 0;
+    try
+    {
+        // This loop is a no-op for trivially-constructible types
+        for( ; numConstructed<size; ++numConstructed )
+            new (&ptr[numConstructed]) G;
+    }
+    catch( ... )
+    {
+        for( size_t i=0; i<numConstructed; ++i )
+            ptr[i].~G();
+        memory::Deallocate( ptr );
+        throw;
+    }
+    return ptr;
 }
 
 template<typename G>
-static void Delete( G*& ptr )
+static void Delete( G*& ptr, size_t size )
 {
-    delete[] ptr;
+    if( ptr != nullptr )
+    {
+        for( size_t i=0; i<size; ++i )
+            ptr[i].~G();
+        memory::Deallocate( ptr );
+    }
     ptr = nullptr;
 }
 
+#ifdef EL_HAVE_MPC
+// Rather than separately allocating the limbs of each entry, place the limbs
+// of all of the (default-precision) entries within a single arena following
+// the array of BigFloat objects so that each buffer requires only one
+// allocation and the limbs are contiguous. The generic Delete suffices since
+// BigFloat does not free external limbs.
+template<>
+BigFloat* New<BigFloat>( size_t size )
+{
+    const mpfr_prec_t prec = mpfr::Precision();
+    const size_t numLimbs = mpfr::NumLimbs();
+    const size_t limbAlign = alignof(mp_limb_t);
+    const size_t objectBytes =
+      ((size*sizeof(BigFloat)+limbAlign-1)/limbAlign)*limbAlign;
+    byte* block = static_cast<byte*>
+      ( memory::Allocate( objectBytes+size*numLimbs*sizeof(mp_limb_t) ) );
+    BigFloat* ptr = reinterpret_cast<BigFloat*>( block );
+    mp_limb_t* limbs = reinterpret_cast<mp_limb_t*>( block+objectBytes );
+    for( size_t i=0; i<size; ++i )
+        new (&ptr[i]) BigFloat( &limbs[i*numLimbs], prec );
+    return ptr;
+}
+#endif // ifdef EL_HAVE_MPC
+
 } // anonymous namespace
 
 template<typename G>
@@ -56,7 +100,7 @@ void Memory<G>::ShallowSwap( Memory<G>& mem )
 template<typename G>
 Memory<G>::~Memory() 
 { 
-    Delete( rawBuffer_ );
+    Delete( rawBuffer_, size_ );
 }
 
 template<typename G>
@@ -70,13 +114,14 @@ G* Memory<G>::Require( size_t size )
 {
     if( size > size_ )
     {
-        Delete( rawBuffer_ );
+        Delete( rawBuffer_, size_ );
+        buffer_ = nullptr;
+        size_ = 0;
 
 #ifndef EL_RELEASE
         try {
 #endif
 
-            // TODO: Optionally overallocate to force alignment of buffer_
             rawBuffer_ = New<G>( size );
             buffer_ = rawBuffer_;
 
@@ -110,7 +155,7 @@ void Memory<G>::Release()
 template<typename G>
 void Memory<G>::Empty()
 {
-    Delete( rawBuffer_ );
+    Delete( rawBuffer_, size_ );
     buffer_ = nullptr;
     size_ = 0;
 }
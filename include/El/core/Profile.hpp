@@ -0,0 +1,129 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_PROFILE_HPP
+#define EL_PROFILE_HPP
+
+namespace El {
+
+// Opt-in accounting of the number of calls, bytes, and time spent in each MPI
+// routine (per communicator), of the flops performed by the local BLAS
+// wrappers, and of the redistributions performed by the DistMatrix proxies,
+// attributed to the innermost active profiling region. Unlike the
+// call stack, regions are also tracked in release builds, but only the master
+// thread is accounted for.
+void EnableProfiling();
+void DisableProfiling();
+bool Profiling();
+void ResetProfile();
+
+// When profiling is enabled, Finalize writes the report of each process to
+// "<prefix>-<rank>.txt" (the default prefix is "ElProfile"). If hardware
+// counting (see HardwareCounters.hpp) is also enabled on every process,
+// Finalize collectively writes the minimum, average, and maximum counts of
+// each region over the processes to "<prefix>-counters.txt".
+void SetProfilePrefix( const string& prefix );
+const string& ProfilePrefix();
+void PrintProfile( ostream& os );
+
+// The statistics of this process accumulated over every region since the
+// last call to ResetProfile
+struct ProfileTotals
+{
+    double flops=0;
+    long long numCommCalls=0;
+    double commBytes=0, commSeconds=0;
+    long long numProxyCopies=0;
+    double proxyBytes=0;
+    HardwareCounts counters;
+};
+ProfileTotals GetProfileTotals();
+
+// The names are not copied and must therefore remain valid (e.g., string
+// literals or __func__)
+void PushProfileRegion( const char* name );
+void PopProfileRegion();
+const char* ProfileRegionName();
+
+// Opt-in recording of the beginning and end of every profiling region on each
+// thread into a ring buffer which retains the most recent 'capacity' regions.
+// Tracing should be enabled outside of OpenMP parallel regions. When tracing
+// was enabled, Finalize writes the timeline of each process in the Chrome
+// trace event format (viewable via chrome://tracing or Perfetto) to
+// "<prefix>-<rank>.json" (the default prefix is "ElTrace").
+void EnableProfileTracing( Int capacity=65536 );
+void DisableProfileTracing();
+bool ProfileTracing();
+void SetTracePrefix( const string& prefix );
+const string& TracePrefix();
+void PrintTrace( ostream& os );
+
+// Regions are also entered while tracking memory (see Memory/decl.hpp)
+bool TrackingMemory();
+
+class ProfileRegion
+{
+public:
+    explicit ProfileRegion( const char* name )
+    : active_(Profiling() || ProfileTracing() || TrackingMemory())
+    { if( active_ ) PushProfileRegion( name ); }
+    ~ProfileRegion() { if( active_ ) PopProfileRegion(); }
+private:
+    bool active_;
+};
+
+#define EL_PROFILE_REGION(name) El::ProfileRegion elProfileRegion(name)
+
+namespace profile {
+
+void RecordCommunication
+( const char* routine, mpi::Comm comm, double bytes, double seconds );
+void RecordFlops( double flops );
+// Records a redistribution into or out of a DistMatrix proxy (see Proxy.hpp)
+// of a matrix with the given number of bytes
+void RecordProxyCopy( double bytes );
+// To be used internally by Elemental
+void WriteReport();
+void WriteTrace();
+void WriteCounterSummary();
+void WriteMemorySummary();
+
+// Records the enclosed MPI routine unless it was called from within another
+// recorded routine (e.g., a single-value AllReduce which calls the
+// buffered version)
+class CommScope
+{
+public:
+    CommScope( const char* routine, mpi::Comm comm, double bytes );
+    ~CommScope();
+private:
+    bool counted_, recording_;
+    const char* routine_;
+    mpi::Comm comm_;
+    double bytes_, startTime_;
+};
+
+// The flop counts are given for real arithmetic and are quadrupled for
+// complex types
+template<typename T>
+void AddFlops( const T* /*typeTag*/, double realFlops )
+{
+    if( Profiling() )
+        RecordFlops( ( IsComplex<T>::value ? 4*realFlops : realFlops ) );
+}
+
+} // namespace profile
+
+// The byte count is only evaluated when profiling is enabled
+#define EL_MPI_PROFILE(routine,comm,bytes) \
+  El::profile::CommScope \
+  elCommScope(routine,comm,(El::Profiling()?double(bytes):0.))
+
+} // namespace El
+
+#endif // ifndef EL_PROFILE_HPP
@@ -142,6 +142,21 @@ public:
           Matrix<T>& Get()             { return orig_; }
 };
 
+namespace proxy {
+
+// Redistributes into (or out of) a DistMatrix proxy, recording the copy for
+// the active profiling region
+template<typename S,class BType>
+void Copy( const AbstractDistMatrix<S>& A, BType& B )
+{
+    if( Profiling() )
+        profile::RecordProxyCopy( double(A.Height())*A.Width()*sizeof(S) );
+    EL_PROFILE_REGION("proxy::Copy");
+    El::Copy( A, B );
+}
+
+} // namespace proxy
+
 struct ProxyCtrl 
 {
     bool colConstrain, rowConstrain, rootConstrain;
@@ -195,7 +210,7 @@ public:
             prox_->AlignCols( ctrl.colAlign );    
         if( ctrl.rowConstrain )
             prox_->AlignRows( ctrl.rowAlign );
-        Copy( A, *prox_ );
+        proxy::Copy( A, *prox_ );
     }
 
     DistMatrixReadProxy
@@ -209,7 +224,7 @@ public:
             prox_->AlignCols( ctrl.colAlign );    
         if( ctrl.rowConstrain )
             prox_->AlignRows( ctrl.rowAlign );
-        Copy( A, *prox_ );
+        proxy::Copy( A, *prox_ );
     }
 
     ~DistMatrixReadProxy() { delete prox_; }
@@ -261,7 +276,7 @@ public:
             prox_->AlignCols( ctrl.colAlign );    
         if( ctrl.rowConstrain )
             prox_->AlignRows( ctrl.rowAlign );
-        Copy( A, *prox_ );
+        proxy::Copy( A, *prox_ );
     }
 
     DistMatrixReadProxy
@@ -298,7 +313,7 @@ public:
             prox_->AlignCols( ctrl.colAlign );    
         if( ctrl.rowConstrain )
             prox_->AlignRows( ctrl.rowAlign );
-        Copy( A, *prox_ );
+        proxy::Copy( A, *prox_ );
     }
 
     ~DistMatrixReadProxy() 
@@ -338,7 +353,7 @@ public:
             prox_->AlignCols( ctrl.blockHeight, ctrl.colAlign, ctrl.colCut );
         if( ctrl.rowConstrain )
             prox_->AlignRows( ctrl.blockWidth, ctrl.rowAlign, ctrl.rowCut );
-        Copy( A, *prox_ );
+        proxy::Copy( A, *prox_ );
     }
 
     DistMatrixReadProxy
@@ -352,7 +367,7 @@ public:
             prox_->AlignCols( ctrl.blockHeight, ctrl.colAlign, ctrl.colCut );
         if( ctrl.rowConstrain )
             prox_->AlignRows( ctrl.blockWidth, ctrl.rowAlign, ctrl.rowCut );
-        Copy( A, *prox_ );
+        proxy::Copy( A, *prox_ );
     }
 
     ~DistMatrixReadProxy() { delete prox_; }
@@ -410,7 +425,7 @@ public:
             prox_->AlignCols( ctrl.blockHeight, ctrl.colAlign, ctrl.colCut );
         if( ctrl.rowConstrain )
             prox_->AlignRows( ctrl.blockWidth, ctrl.rowAlign, ctrl.rowCut );
-        Copy( A, *prox_ );
+        proxy::Copy( A, *prox_ );
     }
 
     DistMatrixReadProxy
@@ -455,7 +470,7 @@ public:
             prox_->AlignCols( ctrl.blockHeight, ctrl.colAlign, ctrl.colCut );
         if( ctrl.rowConstrain )
             prox_->AlignRows( ctrl.blockWidth, ctrl.rowAlign, ctrl.rowCut );
-        Copy( A, *prox_ );
+        proxy::Copy( A, *prox_ );
     }
 
     ~DistMatrixReadProxy() 
@@ -507,7 +522,7 @@ public:
     ~DistMatrixWriteProxy() 
     { 
         if( !uncaught_exception() ) 
-            Copy( *prox_, orig_ );
+            proxy::Copy( *prox_, orig_ );
         delete prox_;
     }
 
@@ -569,7 +584,7 @@ public:
         if( madeCopy_ )
         {
             if( !uncaught_exception() )
-                Copy( *prox_, orig_ );
+                proxy::Copy( *prox_, orig_ );
             delete prox_;
         }
     }
@@ -607,7 +622,7 @@ public:
     ~DistMatrixWriteProxy() 
     { 
         if( !uncaught_exception() ) 
-            Copy( *prox_, orig_ );
+            proxy::Copy( *prox_, orig_ );
         delete prox_;
     }
 
@@ -677,7 +692,7 @@ public:
         if( madeCopy_ )
         {
             if( !uncaught_exception() )
-                Copy( *prox_, orig_ );
+                proxy::Copy( *prox_, orig_ );
             delete prox_;
         }
     }
@@ -713,13 +728,13 @@ public:
             prox_->AlignCols( ctrl.colAlign );    
         if( ctrl.rowConstrain )
             prox_->AlignRows( ctrl.rowAlign );
-        Copy( A, *prox_ );
+        proxy::Copy( A, *prox_ );
     }
 
     ~DistMatrixReadWriteProxy() 
     { 
         if( !uncaught_exception() )
-            Copy( *prox_, orig_ );
+            proxy::Copy( *prox_, orig_ );
         delete prox_;
     }
 
@@ -773,7 +788,7 @@ public:
             prox_->AlignCols( ctrl.colAlign );    
         if( ctrl.rowConstrain )
             prox_->AlignRows( ctrl.rowAlign );
-        Copy( A, *prox_ );
+        proxy::Copy( A, *prox_ );
     }
 
     ~DistMatrixReadWriteProxy() 
@@ -781,7 +796,7 @@ public:
         if( madeCopy_ )
         {
             if( !uncaught_exception() )
-                Copy( *prox_, orig_ );
+                proxy::Copy( *prox_, orig_ );
             delete prox_;
         }
     }
@@ -813,13 +828,13 @@ public:
             prox_->AlignCols( ctrl.blockHeight, ctrl.colAlign, ctrl.colCut );
         if( ctrl.rowConstrain )
             prox_->AlignRows( ctrl.blockWidth, ctrl.rowAlign, ctrl.rowCut );
-        Copy( A, *prox_ );
+        proxy::Copy( A, *prox_ );
     }
 
     ~DistMatrixReadWriteProxy() 
     { 
         if( !uncaught_exception() )
-            Copy( *prox_, orig_ );
+            proxy::Copy( *prox_, orig_ );
         delete prox_;
     }
 
@@ -881,7 +896,7 @@ public:
             prox_->AlignCols( ctrl.blockHeight, ctrl.colAlign, ctrl.colCut );
         if( ctrl.rowConstrain )
             prox_->AlignRows( ctrl.blockWidth, ctrl.rowAlign, ctrl.rowCut );
-        Copy( A, *prox_ );
+        proxy::Copy( A, *prox_ );
     }
 
     ~DistMatrixReadWriteProxy() 
@@ -889,7 +904,7 @@ public:
         if( madeCopy_ )
         {
             if( !uncaught_exception() )
-                Copy( *prox_, orig_ );
+                proxy::Copy( *prox_, orig_ );
             delete prox_;
         }
     }
@@ -0,0 +1,79 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_CORE_RMAINTERFACE_HPP
+#define EL_CORE_RMAINTERFACE_HPP
+
+namespace El {
+
+// One-sided (RMA) access to the global entries of an ElementalMatrix.
+//
+// Unlike QueuePull/ProcessPullQueue and QueueUpdate/ProcessQueues, the
+// sub-block transfers do not require the participation of the processes
+// which own the entries, which suits irregular and asynchronous access
+// patterns. The local buffers are exposed through an MPI-3 window over the
+// grid's VC communicator which remains in a passive-target epoch (opened by
+// Attach and closed by Detach, both of which are collective).
+//
+// Get returns once the entries have arrived, whereas Put and Accumulate are
+// only guaranteed to have completed at their targets after Flush. Since an
+// owner's direct access to its local matrix is not ordered with remote
+// updates, Synchronize should be called collectively between phases of
+// remote updates and local accesses. Updates are applied to every redundant
+// copy of an entry, and the local matrix must not be reallocated while it is
+// attached.
+template<typename T>
+class RmaInterface
+{
+public:
+    RmaInterface() { }
+    RmaInterface( ElementalMatrix<T>& A );
+    RmaInterface( const ElementalMatrix<T>& A );
+    ~RmaInterface();
+
+    void Attach( ElementalMatrix<T>& A );
+    // Attaching an immutable matrix only allows for Get
+    void Attach( const ElementalMatrix<T>& A );
+    void Detach();
+    bool Attached() const EL_NO_EXCEPT { return A_ != nullptr; }
+
+    // X := A(i:i+X.Height()-1,j:j+X.Width()-1)
+    void Get( Matrix<T>& X, Int i, Int j );
+    // A(i:i+X.Height()-1,j:j+X.Width()-1) := X
+    void Put( const Matrix<T>& X, Int i, Int j );
+    // A(i:i+X.Height()-1,j:j+X.Width()-1) += alpha X, entrywise atomically
+    void Accumulate( T alpha, const Matrix<T>& X, Int i, Int j );
+
+    // Completes the outstanding Put and Accumulate operations of this process
+    void Flush();
+    // Collectively completes all outstanding operations and makes them
+    // visible to the owners' local accesses
+    void Synchronize();
+
+private:
+    const ElementalMatrix<T>* A_=nullptr;
+    bool mutable_=false;
+    mpi::Window window_;
+
+    // The local leading dimension of each process in the VC communicator
+    vector<int> ldims_;
+
+    // The origin buffers of the outstanding Put and Accumulate operations
+    vector<vector<T>> pending_;
+
+    void AttachBuffer( const ElementalMatrix<T>& A );
+
+    // X is only modified by RMA_GET
+    enum TransferType { RMA_GET, RMA_PUT, RMA_ACCUMULATE };
+    void Transfer
+    ( TransferType type, T alpha, Matrix<T>& X, Int i, Int j );
+};
+
+} // namespace El
+
+#endif // ifndef EL_CORE_RMAINTERFACE_HPP
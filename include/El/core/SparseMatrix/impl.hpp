@@ -417,13 +417,14 @@ template<typename Ring>
 void SparseMatrix<Ring>::ProcessQueues()
 {
     EL_DEBUG_CSE
+    if( graph_.consistent_ )
+        return;
+    graph_.ExpandSources();
     EL_DEBUG_ONLY(
       if( graph_.sources_.size() != graph_.targets_.size() ||
           graph_.targets_.size() != vals_.size() )
           LogicError("Inconsistent sparse matrix buffer sizes");
     )
-    if( graph_.consistent_ )
-        return;
 
     Int numRemoved = 0;
     const Int numEntries = vals_.size();
@@ -0,0 +1,201 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_CORE_TASKGRAPH_HPP
+#define EL_CORE_TASKGRAPH_HPP
+
+namespace El {
+
+struct TaskGraphCtrl
+{
+    // The minimum number of processes assigned to a task: tasks which are
+    // too small to keep their share of a grid busy are better run on fewer
+    // processes than the cost would suggest
+    int minProcesses=1;
+    // Whether to print the subgrid assignment of each task as it runs
+    bool progress=false;
+    // Whether to return the matrices to their original grids upon completion
+    bool returnHome=true;
+};
+
+// A directed acyclic graph of (collective) Elemental operations which is
+// executed on dynamically chosen subgrids of a base grid so that independent
+// stages of a pipeline can run concurrently.
+//
+// Each task reads and writes a set of registered [MC,MR] matrices, and the
+// dependencies are inferred from the order in which the tasks are added:
+// a task depends upon the last writer of each of its operands as well as
+// (for the operands it writes) upon every reader since that write. The graph
+// is executed in waves: every ready task of a wave is assigned a disjoint,
+// contiguous set of VC ranks of the base grid in proportion to its cost, its
+// operands are moved onto its subgrid with TranslateBetweenGrids (which only
+// involves the processes of the two grids), and each process then runs the
+// task of its subgrid. Two tasks which share an operand never run in the same
+// wave.
+//
+// Every process of the base grid's viewing communicator must add the same
+// tasks in the same order and call Execute, which determines the schedule
+// without any communication. Within a task, the operands should be
+// accessed through Matrix<T>(handle) rather than through the registered
+// matrices, which are only updated when the graph is executed with
+// 'returnHome' set. Tasks added after a call to Execute are run by the next
+// call, and their dependencies upon previously executed tasks are satisfied.
+class TaskGraph
+{
+public:
+    typedef Int Handle;
+    typedef std::function<void(const El::Grid&)> Task;
+
+    TaskGraph( const El::Grid& grid );
+    ~TaskGraph();
+
+    const El::Grid& BaseGrid() const EL_NO_EXCEPT { return grid_; }
+
+    // The matrix must be distributed over a grid with the same viewing
+    // communicator as the base grid and must remain valid until the graph
+    // has been executed
+    template<typename T>
+    Handle AddMatrix( DistMatrix<T>& A );
+
+    // 'maxProcesses' of zero places no limit on the size of the subgrid
+    Int AddTask
+    ( const string& name,
+      const vector<Handle>& inputs,
+      const vector<Handle>& outputs,
+      Task task,
+      double cost=1,
+      int maxProcesses=0 );
+
+    Int NumTasks() const EL_NO_EXCEPT { return tasks_.size(); }
+    const vector<Int>& Dependencies( Int task ) const;
+
+    void Execute( const TaskGraphCtrl& ctrl=TaskGraphCtrl() );
+
+    // The copy of an operand which resides on the grid of the running task
+    template<typename T>
+    DistMatrix<T>& Matrix( Handle handle );
+
+private:
+    class Operand
+    {
+    public:
+        virtual ~Operand() { }
+        virtual const El::Grid& CurrentGrid() const = 0;
+        virtual void MoveTo( const El::Grid& grid ) = 0;
+        virtual void ReturnHome() = 0;
+    };
+
+    template<typename T>
+    class MatrixOperand : public Operand
+    {
+    public:
+        MatrixOperand( DistMatrix<T>& A ) : home_(A), current_(&A) { }
+
+        const El::Grid& CurrentGrid() const override
+        { return current_->Grid(); }
+
+        void MoveTo( const El::Grid& grid ) override
+        {
+            if( current_->Grid() == grid )
+                return;
+            // Assignment between grids uses TranslateBetweenGrids
+            unique_ptr<DistMatrix<T>> next( new DistMatrix<T>(grid) );
+            *next = *current_;
+            copy_ = std::move(next);
+            current_ = copy_.get();
+        }
+
+        void ReturnHome() override
+        {
+            if( current_ == &home_ )
+                return;
+            home_ = *current_;
+            copy_.reset();
+            current_ = &home_;
+        }
+
+        DistMatrix<T>& Current() { return *current_; }
+
+    private:
+        DistMatrix<T>& home_;
+        DistMatrix<T>* current_;
+        unique_ptr<DistMatrix<T>> copy_;
+    };
+
+    struct TaskNode
+    {
+        string name;
+        vector<Handle> inputs, outputs;
+        Task task;
+        double cost;
+        int maxProcesses;
+        vector<Int> dependencies;
+    };
+
+    const El::Grid& grid_;
+    vector<unique_ptr<Operand>> operands_;
+    vector<TaskNode> tasks_;
+    // Each call to Execute runs every task which has not yet run, and so the
+    // tasks before this index have already executed
+    Int numExecuted_=0;
+
+    // The last task to write each operand and the tasks which have read it
+    // since then
+    vector<Int> lastWriter_;
+    vector<vector<Int>> readers_;
+
+    // The subgrids are cached by their first VC rank and size
+    struct Subgrid
+    {
+        int first, size;
+        unique_ptr<El::Grid> grid;
+    };
+    vector<Subgrid> subgrids_;
+    const El::Grid* running_=nullptr;
+
+    const El::Grid& GetSubgrid( int first, int size );
+    Handle AddOperand( Operand* operand );
+
+    // Disable copying this class due to the references to the operands
+    const TaskGraph& operator=( TaskGraph& );
+    TaskGraph( const TaskGraph& );
+};
+
+template<typename T>
+TaskGraph::Handle TaskGraph::AddMatrix( DistMatrix<T>& A )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( !mpi::Congruent( A.Grid().ViewingComm(), grid_.ViewingComm() ) )
+          LogicError
+          ("The matrix's grid must share the base grid's viewing "
+           "communicator");
+    )
+    return AddOperand( new MatrixOperand<T>(A) );
+}
+
+template<typename T>
+DistMatrix<T>& TaskGraph::Matrix( Handle handle )
+{
+    EL_DEBUG_CSE
+    if( handle < 0 || handle >= Handle(operands_.size()) )
+        LogicError("Invalid matrix handle ",handle);
+    auto operand = dynamic_cast<MatrixOperand<T>*>( operands_[handle].get() );
+    if( operand == nullptr )
+        LogicError("Matrix handle ",handle," refers to a different type");
+    EL_DEBUG_ONLY(
+      if( running_ != nullptr && operand->CurrentGrid() != *running_ )
+          LogicError
+          ("Matrix handle ",handle," is not an operand of the running task");
+    )
+    return operand->Current();
+}
+
+} // namespace El
+
+#endif // ifndef EL_CORE_TASKGRAPH_HPP
@@ -34,12 +34,19 @@ public:
     double Partial() const; // time since last start
     double Total() const; // total elapsed time
 
+    // The hardware counts of the intervals which were started while counting
+    // was enabled (see HardwareCounters.hpp)
+    const HardwareCounts& Counts() const;
+
     void Reset( const string& name="[blank]" );
 private:
     bool running_ = false;
     string name_ = "[blank]";
     double totalTime_=0, lastPartialTime_=0;
     Clock::time_point lastTime_;
+
+    bool counting_ = false;
+    HardwareCounts lastCounts_, counts_;
 };
 
 } // namespace El
@@ -80,6 +80,27 @@ void LockedView
 (       AbstractDistMatrix<T>& A,
   const AbstractDistMatrix<T>& B );
 
+// DistMultiVec
+// ------------
+// Over a column-major grid, the local rows of a DistMultiVec are exactly
+// those of a [VC,STAR,BLOCK] matrix with a block height of X.Blocksize(),
+// and so the local data can be shared rather than redistributed
+template<typename T>
+void View( DistMatrix<T,VC,STAR,BLOCK>& A, DistMultiVec<T>& X );
+template<typename T>
+void LockedView( DistMatrix<T,VC,STAR,BLOCK>& A, const DistMultiVec<T>& X );
+
+// Whether or not each process owns the same rows of A, in the same order, as
+// it would of a DistMultiVec of the same height over the same grid
+template<typename T>
+bool SharesDistMultiVecRows( const AbstractDistMatrix<T>& A );
+
+// A must satisfy SharesDistMultiVecRows
+template<typename T>
+void View( DistMultiVec<T>& X, AbstractDistMatrix<T>& A );
+template<typename T>
+void LockedView( DistMultiVec<T>& X, const AbstractDistMatrix<T>& A );
+
 // View a contiguous submatrix
 // ===========================
 
@@ -265,6 +265,92 @@ void LockedView
     }
 }
 
+// DistMultiVec
+// ------------
+
+template<typename T>
+void View( DistMatrix<T,VC,STAR,BLOCK>& A, DistMultiVec<T>& X )
+{
+    EL_DEBUG_CSE
+    const El::Grid& g = X.Grid();
+    if( g.Order() != COLUMN_MAJOR && g.Size() != 1 )
+        LogicError("DistMultiVec's can only be viewed over column-major grids");
+    auto& XLoc = X.Matrix();
+    if( XLoc.Locked() )
+        A.LockedAttach
+        ( X.Height(), X.Width(), g, X.Blocksize(), DefaultBlockWidth(),
+          0, 0, 0, 0, XLoc.LockedBuffer(), XLoc.LDim() );
+    else
+        A.Attach
+        ( X.Height(), X.Width(), g, X.Blocksize(), DefaultBlockWidth(),
+          0, 0, 0, 0, XLoc.Buffer(), XLoc.LDim() );
+}
+
+template<typename T>
+void LockedView( DistMatrix<T,VC,STAR,BLOCK>& A, const DistMultiVec<T>& X )
+{
+    EL_DEBUG_CSE
+    const El::Grid& g = X.Grid();
+    if( g.Order() != COLUMN_MAJOR && g.Size() != 1 )
+        LogicError("DistMultiVec's can only be viewed over column-major grids");
+    auto& XLoc = X.LockedMatrix();
+    A.LockedAttach
+    ( X.Height(), X.Width(), g, X.Blocksize(), DefaultBlockWidth(),
+      0, 0, 0, 0, XLoc.LockedBuffer(), XLoc.LDim() );
+}
+
+template<typename T>
+bool SharesDistMultiVecRows( const AbstractDistMatrix<T>& A )
+{
+    EL_DEBUG_CSE
+    const El::Grid& g = A.Grid();
+    const int commSize = g.Size();
+    if( commSize == 1 )
+        return true;
+    const Dist vectorDist = ( g.Order() == COLUMN_MAJOR ? VC : VR );
+    if( A.ColDist() != vectorDist || A.RowDist() != STAR ||
+        A.ColAlign() != 0 )
+        return false;
+
+    // Mirror the block size of a DistMultiVec
+    const Int height = A.Height();
+    Int blocksize = height / commSize;
+    if( blocksize*commSize < height || height == 0 )
+        ++blocksize;
+
+    if( A.Wrap() == ELEMENT )
+        return blocksize == 1;
+    else
+        return A.BlockHeight() == blocksize && A.ColCut() == 0;
+}
+
+template<typename T>
+void View( DistMultiVec<T>& X, AbstractDistMatrix<T>& A )
+{
+    EL_DEBUG_CSE
+    if( !SharesDistMultiVecRows( A ) )
+        LogicError
+        ("[",A.ColDist(),",",A.RowDist(),"] matrix did not share the rows "
+         "of a DistMultiVec");
+    if( A.Locked() )
+        X.LockedAttach
+        ( A.Height(), A.Width(), A.Grid(), A.LockedBuffer(), A.LDim() );
+    else
+        X.Attach( A.Height(), A.Width(), A.Grid(), A.Buffer(), A.LDim() );
+}
+
+template<typename T>
+void LockedView( DistMultiVec<T>& X, const AbstractDistMatrix<T>& A )
+{
+    EL_DEBUG_CSE
+    if( !SharesDistMultiVecRows( A ) )
+        LogicError
+        ("[",A.ColDist(),",",A.RowDist(),"] matrix did not share the rows "
+         "of a DistMultiVec");
+    X.LockedAttach
+    ( A.Height(), A.Width(), A.Grid(), A.LockedBuffer(), A.LDim() );
+}
+
 // View a contiguous submatrix
 // ===========================
 
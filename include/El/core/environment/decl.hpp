@@ -51,6 +51,14 @@ void Initialize( int& argc, char**& argv );
 void Finalize();
 bool Initialized();
 
+// The wall-clock time (in seconds) of each phase of the most recent
+// initialization of Elemental on this process. If the environment variable
+// EL_STARTUP_TIMINGS is set (to something other than "0"), the timings are
+// collectively printed at the end of Initialize.
+const vector<pair<string,double>>& StartupTimings();
+// Prints the maximum time of each phase over COMM_WORLD from its root
+void PrintStartupTimings( ostream& os=cout );
+
 // For initializing/finalizing Elemental using RAII
 class Environment
 {
@@ -93,6 +101,63 @@ void PushBlocksizeStack( Int blocksize );
 void PopBlocksizeStack();
 void EmptyBlocksizeStack();
 
+// Pushes a blocksize for the lifetime of the object, so that the stack is
+// restored even if an exception is thrown
+class ScopedBlocksize
+{
+public:
+    explicit ScopedBlocksize( Int blocksize )
+    { PushBlocksizeStack( blocksize ); }
+    ~ScopedBlocksize() { PopBlocksizeStack(); }
+
+    ScopedBlocksize( const ScopedBlocksize& ) = delete;
+    ScopedBlocksize& operator=( const ScopedBlocksize& ) = delete;
+};
+
+// For per-routine algorithmic blocksizes, e.g., as found by the autotuner
+// (see AutotuneBlocksizes) and persisted in a blocksize profile. The lookup
+// Blocksize<T>(family,grid) returns, in order of precedence,
+//
+//  1) Blocksize() if it was explicitly set (or pushed) by the user,
+//  2) the tuned blocksize of the family and datatype for the shape of the
+//     grid (a sequential call uses a 1 x 1 grid),
+//  3) the tuned blocksize of the family and datatype for any grid shape,
+//  4) Blocksize().
+//
+// A profile is a text file with one tuned blocksize per line of the form
+//
+//   <family> <grid height> <grid width> <blocksize> <datatype>
+//
+// (e.g., "Cholesky 2 4 192 Complex<double>"), where a grid height and width
+// of zero match any grid and lines beginning with '#' are ignored. The profile
+// named by the environment variable EL_BLOCKSIZE_PROFILE is loaded within
+// Initialize.
+class Grid;
+string BlocksizeFamilyName( BlocksizeFamily family );
+BlocksizeFamily BlocksizeFamilyFromName( const string& name );
+
+template<typename T>
+Int Blocksize( BlocksizeFamily family );
+template<typename T>
+Int Blocksize( BlocksizeFamily family, const Grid& grid );
+template<typename T>
+void SetBlocksize
+( BlocksizeFamily family, Int blocksize, int gridHeight=0, int gridWidth=0 );
+void ClearTunedBlocksizes();
+
+void LoadBlocksizeProfile( const string& filename );
+void WriteBlocksizeProfile( const string& filename );
+
+// For controlling the threading of Elemental's local kernels in hybrid
+// builds. Loops over fewer than ParallelGrainSize() entries are executed by
+// the calling thread alone so that small kernels avoid the fork/join cost of
+// waking the (persistent) OpenMP team.
+void SetNumThreads( int numThreads );
+int NumThreads();
+void SetParallelGrainSize( Int numEntries );
+Int ParallelGrainSize();
+bool ParallelizeLoop( Int numEntries );
+
 template<typename T,
          typename=EnableIf<IsScalar<T>>>
 const T& Max( const T& m, const T& n ) EL_NO_EXCEPT;
@@ -238,30 +303,50 @@ public:
     : std::runtime_error( msg ) { }
 };
 
-EL_DEBUG_ONLY(
-    void EnableTracing();
-    void DisableTracing();
-
-    void PushCallStack( string s );
-    void PopCallStack();
-    void DumpCallStack( ostream& os=cerr );
-
-    class CallStackEntry
+#ifdef EL_HAVE_CALL_STACK
+// Each thread maintains its own call stack of function names, which are not
+// copied and must therefore remain valid (e.g., string literals or
+// EL_FUNCTION). Since the names are stored within a fixed-size array, the
+// call stack never allocates, and only the first kMaxCallStackDepth levels
+// of a deeper stack are reported.
+const int kMaxCallStackDepth = 512;
+
+void EnableTracing();
+void DisableTracing();
+
+// Returns the depth of the stack before the push
+int PushCallStack( const char* name ) EL_NO_EXCEPT;
+void PopCallStack();
+// Restores the stack to the given depth
+void PopCallStack( int depth ) EL_NO_EXCEPT;
+// Prints and then clears the call stack of the calling thread
+void DumpCallStack( ostream& os=cerr );
+// Installs handlers for SIGSEGV, SIGBUS, SIGFPE, SIGILL, and SIGABRT which
+// print the call stack of the offending thread to stderr (without
+// allocating) before re-raising the signal. This is also done by Initialize
+// if the environment variable EL_CRASH_CALL_STACK is set.
+void DumpCallStackOnSignals();
+
+class CallStackEntry
+{
+public:
+    CallStackEntry( const char* name )
+    : depth_( uncaught_exception() ? -1 : PushCallStack(name) )
+    { }
+    ~CallStackEntry()
     {
-    public:
-        CallStackEntry( string s )
-        {
-            if( !uncaught_exception() )
-                PushCallStack(s);
-        }
-        ~CallStackEntry()
-        {
-            if( !uncaught_exception() )
-                PopCallStack();
-        }
-    };
-    typedef CallStackEntry CSE;
-)
+        // The stack of a propagating exception is preserved so that it may
+        // be reported by ReportException (which clears it). Restoring the
+        // depth rather than popping a level also discards the levels left
+        // behind by any exception which was caught in the meantime.
+        if( depth_ >= 0 && !uncaught_exception() )
+            PopCallStack( depth_ );
+    }
+private:
+    int depth_;
+};
+typedef CallStackEntry CSE;
+#endif // ifdef EL_HAVE_CALL_STACK
 
 void OpenLog( const char* filename );
 
@@ -399,7 +484,11 @@ Int Find( const vector<Int>& sortedInds, Int index );
  El::LogicError(EL_FUNCTION," in ",__FILE__,"@",__LINE__,": ",__VA_ARGS__);
 #define EL_RUNTIME_ERROR(...) \
  El::RuntimeError(EL_FUNCTION," in ",__FILE__,"@",__LINE__,": ",__VA_ARGS__);
-#define EL_DEBUG_CSE EL_DEBUG_ONLY(El::CSE cse(EL_FUNCTION))
+#ifdef EL_HAVE_CALL_STACK
+# define EL_DEBUG_CSE El::CSE cse(EL_FUNCTION);
+#else
+# define EL_DEBUG_CSE
+#endif
 
 } // namespace El
 
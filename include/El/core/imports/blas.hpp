@@ -114,6 +114,12 @@ double Dot
 ( BlasInt n,
   const double* x, BlasInt incx,
   const double* y, BlasInt incy );
+#ifdef EL_HAVE_QD
+DoubleDouble Dot
+( BlasInt n,
+  const DoubleDouble* x, BlasInt incx,
+  const DoubleDouble* y, BlasInt incy );
+#endif
 
 template<typename T>
 T Dotc
@@ -239,6 +245,15 @@ void Gemv
   const double* x, BlasInt incx,
   const double& beta,
         double* y, BlasInt incy );
+#ifdef EL_HAVE_QD
+void Gemv
+( char trans, BlasInt m, BlasInt n,
+  const DoubleDouble& alpha,
+  const DoubleDouble* A, BlasInt ALDim,
+  const DoubleDouble* x, BlasInt incx,
+  const DoubleDouble& beta,
+        DoubleDouble* y, BlasInt incy );
+#endif
 void Gemv
 ( char trans, BlasInt m, BlasInt n,
   const scomplex& alpha,
@@ -589,6 +604,16 @@ void Gemm
   const double* B, BlasInt BLDim,
   const double& beta,
         double* C, BlasInt CLDim );
+#ifdef EL_HAVE_QD
+// Cache-blocked kernels built from vectorized error-free transformations
+void Gemm
+( char transA, char transB, BlasInt m, BlasInt n, BlasInt k,
+  const DoubleDouble& alpha,
+  const DoubleDouble* A, BlasInt ALDim,
+  const DoubleDouble* B, BlasInt BLDim,
+  const DoubleDouble& beta,
+        DoubleDouble* C, BlasInt CLDim );
+#endif
 void Gemm
 ( char transA, char transB, BlasInt m, BlasInt n, BlasInt k,
   const scomplex& alpha,
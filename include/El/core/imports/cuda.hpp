@@ -0,0 +1,136 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_IMPORTS_CUDA_HPP
+#define EL_IMPORTS_CUDA_HPP
+
+#ifdef EL_HAVE_CUDA
+namespace El {
+
+// Runtime control of the offloading of local BLAS calls to a GPU
+// ==============================================================
+struct GPUCtrl
+{
+    // Whether or not local Gemm, Trsm, and Herk/Syrk calls may be offloaded
+    bool offload=true;
+
+    // The minimum number of flops of an offloaded call (smaller calls cannot
+    // amortize the transfers between the host and the device)
+    double minFlops=1.e9;
+
+    // The device of this process (if negative, the rank within
+    // mpi::COMM_WORLD modulo the number of visible devices is used)
+    int device=-1;
+
+    // Whether the sequential, non-pivoted fronts of sparse LDL factorizations
+    // with at least 'minFrontSize' rows are factored entirely on the device
+    // (with the front kept resident between the panel updates)
+    bool offloadFronts=true;
+    Int minFrontSize=2048;
+};
+
+void SetGPUCtrl( const GPUCtrl& ctrl );
+GPUCtrl GetGPUCtrl();
+
+void FinalizeCUDA();
+
+namespace cuda {
+
+// Return an uninitialized buffer of at least 'numBytes' bytes of device memory
+void* Allocate( size_t numBytes );
+
+// Release a buffer returned by Allocate (the pointer is allowed to be null)
+void Deallocate( void* ptr );
+
+// A device analogue of Memory<G>, which only reallocates when growing
+template<typename G>
+class DeviceMemory
+{
+    size_t size_;
+    G* buffer_;
+public:
+    DeviceMemory();
+    ~DeviceMemory();
+
+    G* Buffer() const EL_NO_EXCEPT;
+    size_t Size() const EL_NO_EXCEPT;
+
+    G* Require( size_t size );
+    void Empty();
+};
+
+// Whether or not a call requiring the given number of flops should be
+// offloaded to the device
+bool Offload( double flops );
+
+// The following mirror the corresponding BLAS routines and act upon host
+// memory, which is staged through (persistent) device workspaces
+
+template<typename T>
+void Gemm
+( char transA, char transB,
+  BlasInt m, BlasInt n, BlasInt k,
+  const T& alpha,
+  const T* A, BlasInt ALDim,
+  const T* B, BlasInt BLDim,
+  const T& beta,
+        T* C, BlasInt CLDim );
+
+template<typename F>
+void Trsm
+( char side, char uplo, char trans, char unit,
+  BlasInt m, BlasInt n,
+  const F& alpha,
+  const F* A, BlasInt ALDim,
+        F* B, BlasInt BLDim );
+
+template<typename T>
+void Herk
+( char uplo, char trans,
+  BlasInt n, BlasInt k,
+  const Base<T>& alpha,
+  const T* A, BlasInt ALDim,
+  const Base<T>& beta,
+        T* C, BlasInt CLDim );
+
+template<typename T>
+void Syrk
+( char uplo, char trans,
+  BlasInt n, BlasInt k,
+  const T& alpha,
+  const T* A, BlasInt ALDim,
+  const T& beta,
+        T* C, BlasInt CLDim );
+
+// Whether or not a dense front with the given dimensions should be factored
+// on the device
+bool OffloadFront( Int height, Int width );
+
+// Factors the m x n front panel AL = [ATL; ABL] (without pivoting) on the
+// device, overwriting it with the unit-lower factor [L11; L21] (with a zero
+// strictly-upper triangle), returning the n pivots in 'diag', and forming the
+// Schur complement ABR := ABR - L21 D L21^{T/H}. The diagonal blocks are
+// factored on the host, whereas the Trsm, diagonal scaling, Gemm, and
+// symmetric rank-k updates stay on the device.
+//
+// ABR (the update which is extend-added into the parent) is copied back
+// before returning, but the factor is returned asynchronously: AL must not
+// be accessed (or reallocated) until FinishFronts has been called.
+template<typename F>
+void FrontLDL
+( bool conjugate, BlasInt m, BlasInt n,
+  F* AL, BlasInt ALDim, F* ABR, BlasInt ABRLDim, F* diag );
+
+// Waits for the factors of all fronts factored by FrontLDL to be copied back
+void FinishFronts();
+
+} // namespace cuda
+} // namespace El
+#endif // ifdef EL_HAVE_CUDA
+
+#endif // ifndef EL_IMPORTS_CUDA_HPP
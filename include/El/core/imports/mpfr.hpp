@@ -321,6 +321,9 @@ class BigFloat {
 private:
     mpfr_t mpfrFloat_;
     size_t numLimbs_;
+    // False if the limbs live within external storage (e.g., the arena of a
+    // Memory<BigFloat>) which must not be freed or reallocated by MPFR
+    bool ownsLimbs_=true;
 
     void SetNumLimbs( mpfr_prec_t prec );
     void Init( mpfr_prec_t prec=mpfr::Precision() );
@@ -333,6 +336,9 @@ public:
     mpfr_prec_t Precision() const;
     void        SetPrecision( mpfr_prec_t );
     size_t      NumLimbs() const;
+    bool        OwnsLimbs() const;
+    mp_limb_t*       Limbs();
+    const mp_limb_t* LockedLimbs() const;
 
     // NOTE: The default constructor does not take an mpfr_prec_t as input
     //       due to the ambiguity is would cause with respect to the
@@ -360,6 +366,9 @@ public:
     BigFloat
     ( const std::string& str, int base, mpfr_prec_t prec=mpfr::Precision() );
     BigFloat( BigFloat&& a );
+    // Construct a zero whose NumLimbs(prec) limbs are stored within the
+    // externally-owned buffer 'limbs' (which must outlive the BigFloat)
+    BigFloat( mp_limb_t* limbs, mpfr_prec_t prec );
     ~BigFloat();
 
     void Zero();
@@ -100,6 +100,7 @@ struct Request
 // Standard constants
 const int ANY_SOURCE = MPI_ANY_SOURCE;
 const int ANY_TAG = MPI_ANY_TAG;
+const int PROC_NULL = MPI_PROC_NULL;
 #ifdef EL_HAVE_MPI_QUERY_THREAD
 const int THREAD_SINGLE = MPI_THREAD_SINGLE;
 const int THREAD_FUNNELED = MPI_THREAD_FUNNELED;
@@ -180,32 +181,88 @@ struct MPIBaseHelper<Entry<T>> { typedef T value; };
 template<typename T>
 using MPIBase = typename MPIBaseHelper<T>::value;
 
+// The custom datatypes and operations are created one family at a time (a
+// real type, its complex counterpart, and their ValueInt and Entry structs)
+// upon the first request for any member of the family rather than within
+// El::Initialize, which keeps the startup of short-lived jobs cheap.
+template<typename T>
+using MPIFamily = Base<MPIBase<T>>;
+
+template<typename Real> struct HasCustomFamily
+{ static const bool value=false; };
+template<> struct HasCustomFamily<Int>
+{ static const bool value=true; };
+template<> struct HasCustomFamily<float>
+{ static const bool value=true; };
+template<> struct HasCustomFamily<double>
+{ static const bool value=true; };
+#ifdef EL_HAVE_QD
+template<> struct HasCustomFamily<DoubleDouble>
+{ static const bool value=true; };
+template<> struct HasCustomFamily<QuadDouble>
+{ static const bool value=true; };
+#endif
+#ifdef EL_HAVE_QUAD
+template<> struct HasCustomFamily<Quad>
+{ static const bool value=true; };
+#endif
+#ifdef EL_HAVE_MPC
+template<> struct HasCustomFamily<BigInt>
+{ static const bool value=true; };
+template<> struct HasCustomFamily<BigFloat>
+{ static const bool value=true; };
+#endif
+
+template<typename Real>
+struct FamilyRegistry
+{
+    // Only set once every member of the family has been created
+    static std::atomic<bool> registered;
+};
+
+// Creates the datatypes and operations of the family; it is safe to call
+// concurrently and returns immediately if the family was already registered
+template<typename Real>
+void RegisterFamily() EL_NO_RELEASE_EXCEPT;
+
+template<typename T,typename=EnableIf<HasCustomFamily<MPIFamily<T>>>>
+inline void EnsureRegistered() EL_NO_RELEASE_EXCEPT
+{
+    typedef MPIFamily<T> Real;
+    if( !FamilyRegistry<Real>::registered.load(std::memory_order_acquire) )
+        RegisterFamily<Real>();
+}
+
+template<typename T,typename=DisableIf<HasCustomFamily<MPIFamily<T>>>,
+         typename=void>
+inline void EnsureRegistered() EL_NO_EXCEPT { }
+
 template<typename T>
 Datatype& TypeMap() EL_NO_EXCEPT
-{ return Types<T>::type; }
+{ EnsureRegistered<T>(); return Types<T>::type; }
 
 template<typename T>
-Op& UserOp() { return Types<T>::userOp; }
+Op& UserOp() { EnsureRegistered<T>(); return Types<T>::userOp; }
 template<typename T>
-Op& UserCommOp() { return Types<T>::userCommOp; }
+Op& UserCommOp() { EnsureRegistered<T>(); return Types<T>::userCommOp; }
 template<typename T>
-Op& SumOp() { return Types<T>::sumOp; }
+Op& SumOp() { EnsureRegistered<T>(); return Types<T>::sumOp; }
 template<typename T>
-Op& ProdOp() { return Types<T>::prodOp; }
+Op& ProdOp() { EnsureRegistered<T>(); return Types<T>::prodOp; }
 // The following are currently only defined for real datatypes but could
 // potentially use lexicographic ordering for complex numbers
 template<typename T>
-Op& MaxOp() { return Types<T>::maxOp; }
+Op& MaxOp() { EnsureRegistered<T>(); return Types<T>::maxOp; }
 template<typename T>
-Op& MinOp() { return Types<T>::minOp; }
+Op& MinOp() { EnsureRegistered<T>(); return Types<T>::minOp; }
 template<typename T>
-Op& MaxLocOp() { return Types<ValueInt<T>>::maxOp; }
+Op& MaxLocOp() { EnsureRegistered<T>(); return Types<ValueInt<T>>::maxOp; }
 template<typename T>
-Op& MinLocOp() { return Types<ValueInt<T>>::minOp; }
+Op& MinLocOp() { EnsureRegistered<T>(); return Types<ValueInt<T>>::minOp; }
 template<typename T>
-Op& MaxLocPairOp() { return Types<Entry<T>>::maxOp; }
+Op& MaxLocPairOp() { EnsureRegistered<T>(); return Types<Entry<T>>::maxOp; }
 template<typename T>
-Op& MinLocPairOp() { return Types<Entry<T>>::minOp; }
+Op& MinLocPairOp() { EnsureRegistered<T>(); return Types<Entry<T>>::minOp; }
 
 // Added constant(s)
 const int MIN_COLL_MSG = 1; // minimum message size for collectives
@@ -235,10 +292,15 @@ void Create
 ( Comm parentComm, Group subsetGroup, Comm& subsetComm ) EL_NO_RELEASE_EXCEPT;
 void Dup( Comm original, Comm& duplicate ) EL_NO_RELEASE_EXCEPT;
 void Split( Comm comm, int color, int key, Comm& newComm ) EL_NO_RELEASE_EXCEPT;
+// Split into the processes which can share memory (each process forms its own
+// communicator when MPI-3 is not available)
+void SplitShared( Comm comm, int key, Comm& nodeComm ) EL_NO_RELEASE_EXCEPT;
 void Free( Comm& comm ) EL_NO_RELEASE_EXCEPT;
 bool Congruent( Comm comm1, Comm comm2 ) EL_NO_RELEASE_EXCEPT;
 void ErrorHandlerSet
 ( Comm comm, ErrorHandler errorHandler ) EL_NO_RELEASE_EXCEPT;
+// Label a communicator (e.g., for the profiling reports)
+void SetName( Comm comm, const char* name ) EL_NO_RELEASE_EXCEPT;
 
 // Cartesian communicator routines
 void CartCreate
@@ -593,6 +655,152 @@ template<typename T>
 void SendRecv( T* buf, int count, int to, int from, Comm comm )
 EL_NO_RELEASE_EXCEPT;
 
+// Strided SendRecv
+// ----------------
+// Non-contiguous column-major blocks may either be packed into (and unpacked
+// from) contiguous buffers or described with cached MPI vector datatypes so
+// that MPI moves the entries directly between the matrix buffers. Since some
+// MPI implementations handle derived datatypes more slowly than an explicit
+// pack, the adaptive policy times both approaches over the first few calls
+// of each redistribution (identified by the 'site' name) and keeps the
+// faster one. The decision is local, as both approaches have the same type
+// signature. Types which are not (complex) packed scalars are always packed.
+namespace StridedPolicyNS {
+enum StridedPolicy
+{
+    STRIDED_PACK,
+    STRIDED_DATATYPE,
+    STRIDED_ADAPTIVE
+};
+}
+using namespace StridedPolicyNS;
+
+void SetStridedPolicy( StridedPolicy policy ) EL_NO_EXCEPT;
+StridedPolicy GetStridedPolicy() EL_NO_EXCEPT;
+
+// Sends the sHeight x sWidth matrix with leading dimension sLDim and
+// receives the rHeight x rWidth matrix with leading dimension rLDim
+template<typename T>
+void StridedSendRecv
+( const T* sbuf, int sHeight, int sWidth, int sLDim, int to,
+        T* rbuf, int rHeight, int rWidth, int rLDim, int from,
+  Comm comm, const char* site="" ) EL_NO_RELEASE_EXCEPT;
+
+// Frees the cached vector datatypes (called by DestroyCustom)
+void DestroyStridedTypes() EL_NO_RELEASE_EXCEPT;
+
+// Persistent exchanges
+// --------------------
+// A fixed (sparse) all-to-all pattern, such as that of a redistribution plan
+// or of the halo exchange of repeated sparse matrix-vector products, may be
+// bound to persistent requests so that the setup of each message is only
+// paid once per pattern rather than once per message. The point-to-point
+// variant uses MPI_Send_init and MPI_Recv_init for each nonzero count, while
+// the collective variant uses the MPI-4 MPI_Alltoallv_init when it is
+// available (and otherwise falls back to the point-to-point variant).
+//
+// The exchange owns its send and receive buffers, which must not be modified
+// (or read) between Start and Wait. The entries must have a fixed-size MPI
+// datatype (e.g., a packed scalar or its complex counterpart), and the
+// collective variant must be chosen consistently over the communicator.
+bool HavePersistentCollectives() EL_NO_EXCEPT;
+
+class PersistentExchange
+{
+public:
+    PersistentExchange() { }
+    ~PersistentExchange();
+    PersistentExchange( const PersistentExchange& ) = delete;
+    const PersistentExchange& operator=( const PersistentExchange& ) = delete;
+
+    // The collective variant requires this call to be collective over 'comm'
+    template<typename T>
+    void Setup
+    ( const vector<int>& sendCounts, const vector<int>& sendOffs,
+      const vector<int>& recvCounts, const vector<int>& recvOffs,
+      Comm comm, bool collective=false )
+    { Setup( sendCounts, sendOffs, recvCounts, recvOffs,
+             TypeMap<T>(), sizeof(T), comm, collective ); }
+
+    template<typename T>
+    bool Matches
+    ( const vector<int>& sendCounts, const vector<int>& recvCounts,
+      Comm comm ) const EL_NO_EXCEPT
+    { return active_ && type_ == TypeMap<T>() && comm_ == comm &&
+             sendCounts_ == sendCounts && recvCounts_ == recvCounts; }
+
+    template<typename T>
+    T* SendBuffer() EL_NO_EXCEPT
+    { return reinterpret_cast<T*>(sendBuf_.data()); }
+    template<typename T>
+    T* RecvBuffer() EL_NO_EXCEPT
+    { return reinterpret_cast<T*>(recvBuf_.data()); }
+
+    void Start() EL_NO_RELEASE_EXCEPT;
+    void Wait() EL_NO_RELEASE_EXCEPT;
+    void Free() EL_NO_RELEASE_EXCEPT;
+
+private:
+    bool active_=false, collective_=false;
+    Comm comm_;
+    Datatype type_;
+    size_t typeSize_=0;
+    vector<int> sendCounts_, sendOffs_, recvCounts_, recvOffs_;
+    vector<byte> sendBuf_, recvBuf_;
+    vector<MPI_Request> requests_;
+
+    void Setup
+    ( const vector<int>& sendCounts, const vector<int>& sendOffs,
+      const vector<int>& recvCounts, const vector<int>& recvOffs,
+      Datatype type, size_t typeSize, Comm comm, bool collective );
+};
+
+// One-sided communication
+// =======================
+// Thin wrappers over MPI-3 windows. The strided transfers move the
+// height x width block with leading dimension 'targetLDim' whose first entry
+// lies 'targetOffset' entries into the target's window to or from a
+// contiguous column-major origin buffer. Only (complex) packed scalars can be
+// transferred, and accumulation additionally requires a native MPI sum.
+struct Window
+{
+    MPI_Win win=MPI_WIN_NULL;
+};
+
+// Collective over 'comm'
+template<typename T>
+void Create( T* base, Int count, Comm comm, Window& window )
+EL_NO_RELEASE_EXCEPT;
+void Free( Window& window ) EL_NO_RELEASE_EXCEPT;
+
+// Epochs
+void Fence( Window& window ) EL_NO_RELEASE_EXCEPT;
+void LockAll( Window& window ) EL_NO_RELEASE_EXCEPT;
+void UnlockAll( Window& window ) EL_NO_RELEASE_EXCEPT;
+void Flush( int rank, Window& window ) EL_NO_RELEASE_EXCEPT;
+void FlushAll( Window& window ) EL_NO_RELEASE_EXCEPT;
+void FlushLocal( int rank, Window& window ) EL_NO_RELEASE_EXCEPT;
+void FlushLocalAll( Window& window ) EL_NO_RELEASE_EXCEPT;
+// Makes the local copy of the window consistent with remote updates
+void Sync( Window& window ) EL_NO_RELEASE_EXCEPT;
+
+template<typename T>
+void StridedGet
+( T* buf, int height, int width,
+  int target, Int targetOffset, int targetLDim, Window& window )
+EL_NO_RELEASE_EXCEPT;
+template<typename T>
+void StridedPut
+( const T* buf, int height, int width,
+  int target, Int targetOffset, int targetLDim, Window& window )
+EL_NO_RELEASE_EXCEPT;
+// Atomically adds the origin buffer to the target block (entrywise)
+template<typename T>
+void StridedAccumulate
+( const T* buf, int height, int width,
+  int target, Int targetOffset, int targetLDim, Window& window )
+EL_NO_RELEASE_EXCEPT;
+
 // Collective communication
 // ========================
 
@@ -728,6 +936,32 @@ void AllGather
 ( const T* sbuf, int sc,
         T* rbuf, int rc, Comm comm ) EL_NO_RELEASE_EXCEPT;
 
+// Nonblocking AllGather
+// ---------------------
+// NOTE: When nonblocking collectives are not available, or the datatype must
+//       be serialized, the gather is performed immediately and the request
+//       is left null so that a subsequent Wait returns immediately
+template<typename Real,
+         typename=EnableIf<IsPacked<Real>>>
+void IAllGather
+( const Real* sbuf, int sc,
+        Real* rbuf, int rc, Comm comm, Request<Real>& request )
+EL_NO_RELEASE_EXCEPT;
+template<typename Real,
+         typename=EnableIf<IsPacked<Real>>>
+void IAllGather
+( const Complex<Real>* sbuf, int sc,
+        Complex<Real>* rbuf, int rc, Comm comm,
+  Request<Complex<Real>>& request )
+EL_NO_RELEASE_EXCEPT;
+template<typename T,
+         typename=DisableIf<IsPacked<T>>,
+         typename=void>
+void IAllGather
+( const T* sbuf, int sc,
+        T* rbuf, int rc, Comm comm, Request<T>& request )
+EL_NO_RELEASE_EXCEPT;
+
 // AllGather with variable recv sizes
 // ----------------------------------
 template<typename Real,
@@ -1022,6 +1256,30 @@ EL_NO_RELEASE_EXCEPT
 template<typename T>
 void AllReduce( T* buf, int count, Comm comm ) EL_NO_RELEASE_EXCEPT;
 
+// Nonblocking AllReduce
+// ---------------------
+// NOTE: When nonblocking collectives are not available, or the datatype must
+//       be serialized, the reduction is performed immediately and the request
+//       is left null so that a subsequent Wait returns immediately
+template<typename Real,
+         typename=EnableIf<IsPacked<Real>>>
+void IAllReduce
+( const Real* sbuf, Real* rbuf, int count, Op op, Comm comm,
+  Request<Real>& request )
+EL_NO_RELEASE_EXCEPT;
+template<typename Real,
+         typename=EnableIf<IsPacked<Real>>>
+void IAllReduce
+( const Complex<Real>* sbuf, Complex<Real>* rbuf, int count, Op op, Comm comm,
+  Request<Complex<Real>>& request )
+EL_NO_RELEASE_EXCEPT;
+template<typename T,
+         typename=DisableIf<IsPacked<T>>,
+         typename=void>
+void IAllReduce
+( const T* sbuf, T* rbuf, int count, Op op, Comm comm, Request<T>& request )
+EL_NO_RELEASE_EXCEPT;
+
 // ReduceScatter
 // -------------
 template<typename Real,
@@ -1227,10 +1485,299 @@ void SparseAllToAll
   const vector<int>& recvOffs,
         Comm comm ) EL_NO_RELEASE_EXCEPT;
 
+// Two-level collectives
+// =====================
+// The processes of a communicator are grouped by the shared-memory node which
+// they run on. When each node holds the same number of processes, and the
+// processes of each node are contiguous within the communicator, gathers and
+// reduce-scatters can first combine the contributions within each node and
+// then exchange a single message per node between the first process of each
+// node (the "leaders"). The inter-node traffic is thus reduced by a factor of
+// the number of processes per node.
+class NodeHierarchy
+{
+public:
+    // Collective over 'comm', which must outlive the hierarchy
+    explicit NodeHierarchy( Comm comm );
+    ~NodeHierarchy();
+
+    // Whether the nodes are contiguous and equally-sized and there are at
+    // least two nodes with at least two processes each
+    bool Active() const EL_NO_EXCEPT { return active_; }
+
+    Comm ParentComm() const EL_NO_EXCEPT { return comm_; }
+    // The processes of the parent communicator on our node
+    Comm NodeComm() const EL_NO_EXCEPT { return nodeComm_; }
+    // The first process of each node (mpi::COMM_NULL on the other processes)
+    Comm LeaderComm() const EL_NO_EXCEPT { return leaderComm_; }
+    int NodeSize() const EL_NO_EXCEPT { return nodeSize_; }
+    int NumNodes() const EL_NO_EXCEPT { return numNodes_; }
+
+    // Gather 'numBytes' bytes from each process into 'rbuf' in rank order.
+    // The processes of each node write into a shared-memory window owned by
+    // their leader when MPI-3 is available.
+    void AllGather( const byte* sbuf, byte* rbuf, int numBytes );
+
+private:
+    Comm comm_, nodeComm_, leaderComm_;
+    int commRank_, nodeSize_, numNodes_;
+    bool active_;
+
+#if MPI_VERSION >= 3
+    bool haveWindow_=false;
+    MPI_Win window_;
+    size_t windowBytes_=0;
+    byte* shared_=nullptr;
+
+    byte* SharedBuffer( size_t numBytes );
+    void FreeWindow();
+    void NodeSync();
+#endif
+
+    NodeHierarchy( const NodeHierarchy& );
+    const NodeHierarchy& operator=( const NodeHierarchy& );
+};
+
+template<typename T>
+void AllGather
+( const T* sbuf, int sc, T* rbuf, int rc, NodeHierarchy& hier )
+EL_NO_RELEASE_EXCEPT
+{
+    if( IsPacked<T>::value && hier.Active() &&
+        sizeof(T)*size_t(sc) <= size_t(std::numeric_limits<int>::max()) )
+        hier.AllGather
+        ( reinterpret_cast<const byte*>(sbuf), reinterpret_cast<byte*>(rbuf),
+          int(sizeof(T)*sc) );
+    else
+        AllGather( sbuf, sc, rbuf, rc, hier.ParentComm() );
+}
+
+// The contributions are first summed onto each leader, then reduce-scattered
+// between the leaders in node-sized portions, and finally scattered within
+// each node. 'sbuf' and 'rbuf' may coincide.
+template<typename T>
+void ReduceScatter
+( T* sbuf, T* rbuf, int rc, NodeHierarchy& hier, Op op=SUM )
+EL_NO_RELEASE_EXCEPT
+{
+    if( !hier.Active() )
+    {
+        if( sbuf == rbuf )
+            ReduceScatter( sbuf, rc, op, hier.ParentComm() );
+        else
+            ReduceScatter( sbuf, rbuf, rc, op, hier.ParentComm() );
+        return;
+    }
+    const int nodeSize = hier.NodeSize();
+    const int totalSize = rc*nodeSize*hier.NumNodes();
+    const bool leader = ( hier.LeaderComm() != COMM_NULL );
+    vector<T> nodeSum, portion;
+    if( leader )
+    {
+        nodeSum.resize( totalSize );
+        portion.resize( rc*nodeSize );
+    }
+    Reduce( sbuf, nodeSum.data(), totalSize, op, 0, hier.NodeComm() );
+    if( leader )
+        ReduceScatter
+        ( nodeSum.data(), portion.data(), rc*nodeSize, op, hier.LeaderComm() );
+    Scatter( portion.data(), rc, rbuf, rc, 0, hier.NodeComm() );
+}
+
+// Collective algorithm selection
+// ==============================
+// The regular AllGather, AllToAll, and ReduceScatter calls of the
+// redistributions select between the MPI implementation's algorithm and
+// a few classical alternatives based upon the number of bytes per process
+// (per pair of processes for AllToAll) and the layout of the communicator:
+//
+//  * Pairwise: p-1 exchanges with the process 'k' ranks away (with
+//    XOR-partners for powers of two), which is bandwidth-optimal for large
+//    AllToAll messages,
+//  * Bruck: ceil(log2(p)) exchanges for an arbitrary number of processes,
+//    which minimizes the latency of small AllGather and AllToAll messages,
+//  * Recursive doubling (recursive halving for ReduceScatter): log2(p)
+//    exchanges with XOR-partners, which requires a power of two,
+//  * Hierarchical: the node-leader algorithms of NodeHierarchy, which require
+//    an active hierarchy.
+//
+// An algorithm which is not applicable to a communicator falls back to the
+// native algorithm. The default thresholds may be replaced by those measured
+// by TuneCollectives, which Initialize runs over mpi::COMM_WORLD when the
+// environment variable EL_TUNE_COLLECTIVES is set to a nonzero value.
+namespace CollectiveAlgorithmNS {
+enum CollectiveAlgorithm
+{
+    COLLECTIVE_NATIVE,
+    COLLECTIVE_PAIRWISE,
+    COLLECTIVE_BRUCK,
+    COLLECTIVE_RECURSIVE_DOUBLING,
+    COLLECTIVE_HIERARCHICAL
+};
+}
+using namespace CollectiveAlgorithmNS;
+
+// The first choice whose 'maxBytes' is at least the message size is used
+struct CollectiveChoice
+{
+    size_t maxBytes;
+    CollectiveAlgorithm alg;
+};
+
+struct CollectiveCtrl
+{
+    // If false, the native algorithms are always used
+    bool adaptive=true;
+
+    vector<CollectiveChoice> allGather=
+      { {1024,COLLECTIVE_BRUCK}, {SIZE_MAX,COLLECTIVE_HIERARCHICAL} };
+    vector<CollectiveChoice> allToAll=
+      { {256,COLLECTIVE_BRUCK}, {32768,COLLECTIVE_NATIVE},
+        {SIZE_MAX,COLLECTIVE_PAIRWISE} };
+    vector<CollectiveChoice> reduceScatter=
+      { {SIZE_MAX,COLLECTIVE_HIERARCHICAL} };
+};
+
+void SetCollectiveCtrl( const CollectiveCtrl& ctrl );
+const CollectiveCtrl& GetCollectiveCtrl() EL_NO_EXCEPT;
+std::string CollectiveAlgorithmName( CollectiveAlgorithm alg );
+
+// These return an algorithm which is applicable to the communicator
+CollectiveAlgorithm SelectAllGather
+( size_t numBytes, Comm comm, const NodeHierarchy* hier=nullptr );
+CollectiveAlgorithm SelectAllToAll( size_t numBytes, Comm comm );
+CollectiveAlgorithm SelectReduceScatter
+( size_t numBytes, Comm comm, const NodeHierarchy* hier=nullptr );
+
+// Byte-wise implementations with 'numBytes' bytes per process (or per pair of
+// processes for AllToAll)
+void BruckAllGather
+( const byte* sbuf, byte* rbuf, int numBytes, Comm comm );
+void RecursiveDoublingAllGather
+( const byte* sbuf, byte* rbuf, int numBytes, Comm comm );
+void PairwiseAllToAll
+( const byte* sbuf, byte* rbuf, int numBytes, Comm comm );
+void BruckAllToAll
+( const byte* sbuf, byte* rbuf, int numBytes, Comm comm );
+
+// Measures the fastest algorithm of each collective over a range of message
+// sizes on 'comm' and installs the resulting thresholds. Collective over
+// 'comm'.
+void TuneCollectives( Comm comm );
+
+template<typename T>
+void SelectedAllGather
+( const T* sbuf, T* rbuf, int count, Comm comm,
+  NodeHierarchy* hier=nullptr ) EL_NO_RELEASE_EXCEPT
+{
+    const size_t numBytes = sizeof(T)*size_t(count);
+    const CollectiveAlgorithm alg =
+      ( IsPacked<T>::value ? SelectAllGather( numBytes, comm, hier )
+                           : COLLECTIVE_NATIVE );
+    const byte* sbufBytes = reinterpret_cast<const byte*>(sbuf);
+    byte* rbufBytes = reinterpret_cast<byte*>(rbuf);
+    switch( alg )
+    {
+    case COLLECTIVE_BRUCK:
+        BruckAllGather( sbufBytes, rbufBytes, int(numBytes), comm );
+        break;
+    case COLLECTIVE_RECURSIVE_DOUBLING:
+        RecursiveDoublingAllGather( sbufBytes, rbufBytes, int(numBytes), comm );
+        break;
+    case COLLECTIVE_HIERARCHICAL:
+        AllGather( sbuf, count, rbuf, count, *hier );
+        break;
+    default:
+        AllGather( sbuf, count, rbuf, count, comm );
+    }
+}
+
+template<typename T>
+void SelectedAllToAll
+( const T* sbuf, T* rbuf, int count, Comm comm ) EL_NO_RELEASE_EXCEPT
+{
+    const size_t numBytes = sizeof(T)*size_t(count);
+    const CollectiveAlgorithm alg =
+      ( IsPacked<T>::value ? SelectAllToAll( numBytes, comm )
+                           : COLLECTIVE_NATIVE );
+    const byte* sbufBytes = reinterpret_cast<const byte*>(sbuf);
+    byte* rbufBytes = reinterpret_cast<byte*>(rbuf);
+    switch( alg )
+    {
+    case COLLECTIVE_PAIRWISE:
+        PairwiseAllToAll( sbufBytes, rbufBytes, int(numBytes), comm );
+        break;
+    case COLLECTIVE_BRUCK:
+        BruckAllToAll( sbufBytes, rbufBytes, int(numBytes), comm );
+        break;
+    default:
+        AllToAll( sbuf, count, rbuf, count, comm );
+    }
+}
+
+// Sums the (p*count)-entry contributions and scatters 'count' entries to each
+// process via recursive halving, which requires a power of two number of
+// processes. 'sbuf' and 'rbuf' may coincide.
+template<typename T>
+void RecursiveHalvingReduceScatter
+( const T* sbuf, T* rbuf, int count, Comm comm ) EL_NO_RELEASE_EXCEPT
+{
+    const int commRank = Rank( comm );
+    const int commSize = Size( comm );
+    vector<T> work( sbuf, sbuf+size_t(count)*commSize ), recvBuf;
+    int lo = 0;
+    for( int mask=commSize/2; mask>=1; mask/=2 )
+    {
+        const int partner = commRank ^ mask;
+        // Keep the half of [lo,lo+2*mask) containing our block
+        const int keepLo = ( commRank & mask ? lo+mask : lo );
+        const int sendLo = ( commRank & mask ? lo : lo+mask );
+        const int halfSize = mask*count;
+        recvBuf.resize( halfSize );
+        SendRecv
+        ( &work[size_t(sendLo)*count], halfSize, partner,
+          recvBuf.data(), halfSize, partner, comm );
+        T* keep = &work[size_t(keepLo)*count];
+        for( int i=0; i<halfSize; ++i )
+            keep[i] += recvBuf[i];
+        lo = keepLo;
+    }
+    std::copy( &work[size_t(commRank)*count],
+               &work[size_t(commRank)*count]+count, rbuf );
+}
+
+// Summation only. 'sbuf' and 'rbuf' may coincide.
+template<typename T>
+void SelectedReduceScatter
+( T* sbuf, T* rbuf, int count, Comm comm,
+  NodeHierarchy* hier=nullptr ) EL_NO_RELEASE_EXCEPT
+{
+    const size_t numBytes = sizeof(T)*size_t(count);
+    const CollectiveAlgorithm alg =
+      ( IsPacked<T>::value ? SelectReduceScatter( numBytes, comm, hier )
+                           : COLLECTIVE_NATIVE );
+    switch( alg )
+    {
+    case COLLECTIVE_RECURSIVE_DOUBLING:
+        RecursiveHalvingReduceScatter( sbuf, rbuf, count, comm );
+        break;
+    case COLLECTIVE_HIERARCHICAL:
+        ReduceScatter( sbuf, rbuf, count, *hier );
+        break;
+    default:
+        if( sbuf == rbuf )
+            ReduceScatter( sbuf, count, comm );
+        else
+            ReduceScatter( sbuf, rbuf, count, comm );
+    }
+}
+
 void VerifySendsAndRecvs
 ( const vector<int>& sendCounts,
   const vector<int>& recvCounts, Comm comm );
 
+// Eagerly registers every family of custom datatypes and operations (each
+// family is otherwise registered upon its first use)
 void CreateCustom() EL_NO_RELEASE_EXCEPT;
 void DestroyCustom() EL_NO_RELEASE_EXCEPT;
 
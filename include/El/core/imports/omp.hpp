@@ -12,6 +12,9 @@
 #ifdef EL_HYBRID
 # include <omp.h>
 # define EL_PARALLEL_FOR _Pragma("omp parallel for")
+# define EL_PRAGMA(x) _Pragma(#x)
+// Only fork when the condition (typically ParallelizeLoop) is satisfied
+# define EL_PARALLEL_FOR_IF(cond) EL_PRAGMA(omp parallel for if(cond))
 # ifdef EL_HAVE_OMP_COLLAPSE
 #  define EL_PARALLEL_FOR_COLLAPSE2 _Pragma("omp parallel for collapse(2)")
 # else
@@ -24,6 +27,7 @@
 # endif
 #else
 # define EL_PARALLEL_FOR 
+# define EL_PARALLEL_FOR_IF(cond)
 # define EL_PARALLEL_FOR_COLLAPSE2
 # define EL_SIMD
 #endif
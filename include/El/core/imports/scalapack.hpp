@@ -50,6 +50,13 @@ void Cholesky( char uplo, int n, double* A, const int* descA );
 void Cholesky( char uplo, int n, scomplex* A, const int* descA );
 void Cholesky( char uplo, int n, dcomplex* A, const int* descA );
 
+// LU
+// --
+void LU( int m, int n, float* A, const int* descA, int* ipiv );
+void LU( int m, int n, double* A, const int* descA, int* ipiv );
+void LU( int m, int n, scomplex* A, const int* descA, int* ipiv );
+void LU( int m, int n, dcomplex* A, const int* descA, int* ipiv );
+
 // QR
 // --
 void QR( int m, int n, float* A, const int* descA, float* tau );
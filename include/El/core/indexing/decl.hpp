@@ -100,6 +100,51 @@ template<> bool IsPerfectSquare( const BigInt& alpha );
 Unsigned FlooredLog2( Unsigned n );
 bool PowerOfTwo( Unsigned n );
 
+// Native modular arithmetic for moduli below 2^64
+// ===============================================
+// Odd moduli are handled with Montgomery multiplication when 128-bit
+// products are available. The BigInt routines below, and the number theory
+// routines built upon them, fall back to these whenever the modulus fits.
+unsigned long long MulMod
+( unsigned long long a,
+  unsigned long long b,
+  unsigned long long mod );
+unsigned long long PowMod
+( unsigned long long base,
+  unsigned long long exp,
+  unsigned long long mod );
+
+namespace montgomery {
+
+// The modular arithmetic of an odd modulus n < 2^64 in the Montgomery
+// representation a R (mod n), with R = 2^64
+struct Modulus64
+{
+    unsigned long long n;
+    // n^{-1} (mod R)
+    unsigned long long nInv;
+    // R^2 (mod n)
+    unsigned long long RSquared;
+
+    explicit Modulus64( unsigned long long modulus );
+
+    unsigned long long ToMontgomery( unsigned long long a ) const;
+    unsigned long long FromMontgomery( unsigned long long a ) const;
+    // The Montgomery representation of one, R (mod n)
+    unsigned long long One() const;
+
+    unsigned long long Multiply
+    ( unsigned long long a, unsigned long long b ) const;
+    unsigned long long Add
+    ( unsigned long long a, unsigned long long b ) const;
+    unsigned long long Subtract
+    ( unsigned long long a, unsigned long long b ) const;
+    unsigned long long Pow
+    ( unsigned long long a, unsigned long long exp ) const;
+};
+
+} // namespace montgomery
+
 #ifdef EL_HAVE_MPC
 BigInt PowMod
 ( const BigInt& base,
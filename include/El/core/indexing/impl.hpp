@@ -368,13 +368,157 @@ inline bool IsPerfectSquare( const BigInt& alpha )
 }
 #endif
 
+namespace montgomery {
+
+#ifdef __SIZEOF_INT128__
+typedef unsigned __int128 UInt128;
+
+inline Modulus64::Modulus64( unsigned long long modulus )
+: n(modulus)
+{
+    EL_DEBUG_ONLY(
+      if( n % 2 == 0 )
+          LogicError("Montgomery moduli must be odd");
+    )
+    // Newton's iteration doubles the number of correct bits of n^{-1}, and
+    // n itself is correct to three bits since n^2 = 1 (mod 8)
+    nInv = n;
+    for( Int iter=0; iter<5; ++iter )
+        nInv *= 2 - n*nInv;
+    const unsigned long long R = (0-n) % n;
+    RSquared = static_cast<unsigned long long>( (UInt128(R)*R) % n );
+}
+
+inline unsigned long long
+Modulus64::Multiply( unsigned long long a, unsigned long long b ) const
+{
+    // Since m n = t (mod R), the low words cancel in t - m n, and the
+    // difference of the high words lies in (-n,n)
+    const UInt128 t = UInt128(a)*b;
+    const unsigned long long m =
+      static_cast<unsigned long long>(t)*nInv;
+    const unsigned long long tHigh = static_cast<unsigned long long>(t >> 64);
+    const unsigned long long mnHigh =
+      static_cast<unsigned long long>((UInt128(m)*n) >> 64);
+    return tHigh >= mnHigh ? tHigh-mnHigh : tHigh+(n-mnHigh);
+}
+
+inline unsigned long long
+Modulus64::ToMontgomery( unsigned long long a ) const
+{ return Multiply( a % n, RSquared ); }
+
+inline unsigned long long
+Modulus64::FromMontgomery( unsigned long long a ) const
+{ return Multiply( a, 1 ); }
+
+inline unsigned long long Modulus64::One() const
+{ return (0-n) % n; }
+
+inline unsigned long long
+Modulus64::Add( unsigned long long a, unsigned long long b ) const
+{ return a >= n-b ? a-(n-b) : a+b; }
+
+inline unsigned long long
+Modulus64::Subtract( unsigned long long a, unsigned long long b ) const
+{ return a >= b ? a-b : a+(n-b); }
+
+inline unsigned long long
+Modulus64::Pow( unsigned long long a, unsigned long long exp ) const
+{
+    unsigned long long result = One();
+    while( exp != 0 )
+    {
+        if( exp & 1 )
+            result = Multiply( result, a );
+        a = Multiply( a, a );
+        exp >>= 1;
+    }
+    return result;
+}
+#endif // ifdef __SIZEOF_INT128__
+
+} // namespace montgomery
+
+inline unsigned long long MulMod
+( unsigned long long a,
+  unsigned long long b,
+  unsigned long long mod )
+{
+#ifdef __SIZEOF_INT128__
+    return static_cast<unsigned long long>
+      ( (montgomery::UInt128(a)*b) % mod );
+#else
+    // Double-and-add so that no intermediate exceeds 2 mod
+    a %= mod;
+    b %= mod;
+    unsigned long long result = 0;
+    while( b != 0 )
+    {
+        if( b & 1 )
+            result = ( result >= mod-a ? result-(mod-a) : result+a );
+        a = ( a >= mod-a ? a-(mod-a) : a+a );
+        b >>= 1;
+    }
+    return result;
+#endif
+}
+
+inline unsigned long long PowMod
+( unsigned long long base,
+  unsigned long long exp,
+  unsigned long long mod )
+{
+    if( mod == 1 )
+        return 0;
+#ifdef __SIZEOF_INT128__
+    if( mod % 2 == 1 )
+    {
+        montgomery::Modulus64 modulus( mod );
+        return modulus.FromMontgomery
+          ( modulus.Pow( modulus.ToMontgomery(base), exp ) );
+    }
+#endif
+    unsigned long long result = 1;
+    base %= mod;
+    while( exp != 0 )
+    {
+        if( exp & 1 )
+            result = MulMod( result, base, mod );
+        base = MulMod( base, base, mod );
+        exp >>= 1;
+    }
+    return result;
+}
+
 #ifdef EL_HAVE_MPC
+namespace montgomery {
+
+// Whether a (nonnegative) BigInt fits within an unsigned long long
+inline bool FitsNatively( const BigInt& a )
+{
+    return mpz_sgn(a.LockedPointer()) >= 0 &&
+      mpz_sizeinbase(a.LockedPointer(),2) <= 8*sizeof(unsigned long long);
+}
+
+} // namespace montgomery
+
 inline void PowMod
 ( const BigInt& base,
   const BigInt& exp,
   const BigInt& mod,
         BigInt& result )
 {
+    if( montgomery::FitsNatively(mod) && montgomery::FitsNatively(exp) &&
+        mpz_sgn(mod.LockedPointer()) > 0 )
+    {
+        const unsigned long long modNative =
+          static_cast<unsigned long long>(mod);
+        result =
+          PowMod
+          ( base % modNative, static_cast<unsigned long long>(exp),
+            modNative );
+        return;
+    }
     mpz_powm
     ( result.Pointer(),
       base.LockedPointer(),
@@ -398,6 +542,13 @@ inline void PowMod
   const BigInt& mod,
         BigInt& result )
 {
+    if( montgomery::FitsNatively(mod) && mpz_sgn(mod.LockedPointer()) > 0 )
+    {
+        const unsigned long long modNative =
+          static_cast<unsigned long long>(mod);
+        result = PowMod( base % modNative, exp, modNative );
+        return;
+    }
     mpz_powm_ui
     ( result.Pointer(),
       base.LockedPointer(),
@@ -421,7 +572,13 @@ inline void PowMod
   const BigInt& mod,
         BigInt& result )
 {
-    if( exp <= static_cast<unsigned long long>(ULONG_MAX) )
+    if( montgomery::FitsNatively(mod) && mpz_sgn(mod.LockedPointer()) > 0 )
+    {
+        const unsigned long long modNative =
+          static_cast<unsigned long long>(mod);
+        result = PowMod( base % modNative, exp, modNative );
+    }
+    else if( exp <= static_cast<unsigned long long>(ULONG_MAX) )
     {
         mpz_powm_ui
         ( result.Pointer(),
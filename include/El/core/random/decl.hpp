@@ -99,6 +99,47 @@ F SampleBall( const F& center=F(0), const Base<F>& radius=Base<F>(1) );
 template<typename Real,typename=EnableIf<IsReal<Real>>> 
 Real SampleBall( const Real& center=Real(0), const Real& radius=Real(1) );
 
+// Counter-based random number generation
+// ======================================
+// The Philox-4x32-10 generator of Salmon et al. maps a 128-bit counter and a
+// 64-bit key to 128 random bits using only integer multiplications, so that
+// each entry of a random matrix can be independently generated from its
+// global indices. When enabled (the default), the independent random fills of
+// float, double, and their complex counterparts are therefore trivially
+// parallelized over both processes and threads and are bitwise independent
+// of the process grid.
+namespace philox {
+
+struct Block { std::uint32_t word[4]; };
+
+Block Generate( std::uint64_t counterLow, std::uint64_t counterHigh,
+                std::uint64_t key );
+
+// A sample from the open interval (0,1) using 53 random bits
+double UnitUniform( std::uint32_t high, std::uint32_t low );
+
+// Sample from the distributions of SampleBall and SampleNormal using the 128
+// random bits associated with entry (i,j)
+template<typename T>
+T Ball
+( std::uint64_t key, Int i, Int j, const T& center, const Base<T>& radius );
+template<typename T>
+T Normal
+( std::uint64_t key, Int i, Int j, const T& mean, const Base<T>& stddev );
+// A sample from the uniform distribution over [0,1)
+double Uniform( std::uint64_t key, Int i, Int j );
+
+} // namespace philox
+
+void SetCounterBasedRandom( bool counterBased );
+bool CounterBasedRandom();
+
+// Returns the key for the next counter-based fill. The shared sequence of keys
+// only depends upon the seed (which is the same on every process) and the
+// number of previous fills, whereas the local sequence also depends upon the
+// rank within mpi::COMM_WORLD (much like the Mersenne twister's seed).
+std::uint64_t NextRandomKey( bool local=false );
+
 // To be used internally by Elemental
 void InitializeRandom( bool deterministic=true );
 void FinalizeRandom();
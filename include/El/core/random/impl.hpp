@@ -223,6 +223,102 @@ template<typename Real,typename>
 Real SampleBall( const Real& center, const Real& radius )
 { return SampleUniform(center-radius,center+radius); }
 
+namespace philox {
+
+inline Block Generate
+( std::uint64_t counterLow, std::uint64_t counterHigh, std::uint64_t key )
+{
+    const std::uint32_t multiplier0 = 0xD2511F53, multiplier1 = 0xCD9E8D57;
+    const std::uint32_t weyl0 = 0x9E3779B9, weyl1 = 0xBB67AE85;
+
+    std::uint32_t c0 = std::uint32_t(counterLow);
+    std::uint32_t c1 = std::uint32_t(counterLow >> 32);
+    std::uint32_t c2 = std::uint32_t(counterHigh);
+    std::uint32_t c3 = std::uint32_t(counterHigh >> 32);
+    std::uint32_t k0 = std::uint32_t(key);
+    std::uint32_t k1 = std::uint32_t(key >> 32);
+    for( int round=0; round<10; ++round )
+    {
+        const std::uint64_t product0 = std::uint64_t(multiplier0)*c0;
+        const std::uint64_t product1 = std::uint64_t(multiplier1)*c2;
+        const std::uint32_t hi0 = std::uint32_t(product0 >> 32);
+        const std::uint32_t hi1 = std::uint32_t(product1 >> 32);
+        c0 = hi1 ^ c1 ^ k0;
+        c1 = std::uint32_t(product1);
+        c2 = hi0 ^ c3 ^ k1;
+        c3 = std::uint32_t(product0);
+        k0 += weyl0;
+        k1 += weyl1;
+    }
+    return Block{{c0,c1,c2,c3}};
+}
+
+inline double UnitUniform( std::uint32_t high, std::uint32_t low )
+{
+    const std::uint64_t bits =
+      ((std::uint64_t(high) << 32) | std::uint64_t(low)) >> 11;
+    return (double(bits)+0.5)*(1./9007199254740992.);
+}
+
+inline double Uniform( std::uint64_t key, Int i, Int j )
+{
+    const Block block = Generate( std::uint64_t(i), std::uint64_t(j), key );
+    const std::uint64_t bits =
+      ((std::uint64_t(block.word[0]) << 32) | std::uint64_t(block.word[1]))>>11;
+    return double(bits)*(1./9007199254740992.);
+}
+
+template<typename T>
+T Ball
+( std::uint64_t key, Int i, Int j, const T& center, const Base<T>& radius )
+{
+    typedef Base<T> Real;
+    const Block block = Generate( std::uint64_t(i), std::uint64_t(j), key );
+    const double u = UnitUniform( block.word[0], block.word[1] );
+    if( IsComplex<T>::value )
+    {
+        const double v = UnitUniform( block.word[2], block.word[3] );
+        const double angle = 2*Pi<double>()*v;
+        const Real r = radius*Real(u);
+        T sample = center;
+        SetRealPart( sample, RealPart(center) + r*Real(std::cos(angle)) );
+        SetImagPart( sample, ImagPart(center) + r*Real(std::sin(angle)) );
+        return sample;
+    }
+    else
+    {
+        T sample = center;
+        SetRealPart( sample, RealPart(center) + radius*Real(2*u-1) );
+        return sample;
+    }
+}
+
+// The Box-Muller transform yields two independent normal samples
+template<typename T>
+T Normal
+( std::uint64_t key, Int i, Int j, const T& mean, const Base<T>& stddev )
+{
+    typedef Base<T> Real;
+    Real stddevAdj = stddev;
+    if( IsComplex<T>::value )
+        stddevAdj /= Sqrt(Real(2));
+
+    const Block block = Generate( std::uint64_t(i), std::uint64_t(j), key );
+    const double u = UnitUniform( block.word[0], block.word[1] );
+    const double v = UnitUniform( block.word[2], block.word[3] );
+    const double r = std::sqrt(-2*std::log(u));
+    const double angle = 2*Pi<double>()*v;
+
+    T sample = mean;
+    SetRealPart( sample, RealPart(mean) + stddevAdj*Real(r*std::cos(angle)) );
+    if( IsComplex<T>::value )
+        SetImagPart
+        ( sample, ImagPart(mean) + stddevAdj*Real(r*std::sin(angle)) );
+    return sample;
+}
+
+} // namespace philox
+
 } // namespace El
 
 #endif // ifndef EL_RANDOM_IMPL_HPP
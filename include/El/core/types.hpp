@@ -411,6 +411,17 @@ enum GridOrder
 }
 using namespace GridOrderNS;
 
+// Whether a process grid is built directly from the rank order of its
+// communicator or after grouping the processes by shared-memory node
+namespace GridTopologyNS {
+enum GridTopology
+{
+    RANK_ORDERED_GRID,
+    NODE_AWARE_GRID
+};
+}
+using namespace GridTopologyNS;
+
 namespace LeftOrRightNS {
 enum LeftOrRight
 {
@@ -489,6 +500,25 @@ enum VerticalOrHorizontal
 }
 using namespace VerticalOrHorizontalNS;
 
+// The routine families with separately tunable algorithmic blocksizes
+namespace BlocksizeFamilyNS {
+enum BlocksizeFamily
+{
+    BLOCKSIZE_GEMM,
+    BLOCKSIZE_TRSM,
+    BLOCKSIZE_HERK, // Herk and Syrk
+    BLOCKSIZE_CHOLESKY,
+    BLOCKSIZE_LU,
+    BLOCKSIZE_QR,
+    BLOCKSIZE_HERMITIAN_TRIDIAG,
+    BLOCKSIZE_LOCAL_SYMV,
+    BLOCKSIZE_LOCAL_TRRK,
+    BLOCKSIZE_LOCAL_TRR2K,
+    BlocksizeFamily_MAX // For detecting number of entries in enum
+};
+}
+using namespace BlocksizeFamilyNS;
+
 // TODO: Distributed file formats?
 namespace FileFormatNS {
 enum FileFormat
@@ -498,6 +528,7 @@ enum FileFormat
     ASCII_MATLAB,
     BINARY,
     BINARY_FLAT,
+    BINARY_SPARSE,
     BMP,
     JPG,
     JPEG,
@@ -30,6 +30,29 @@ enum ColorMap
 }
 using namespace ColorMapNS;
 
+namespace DownsampleModeNS {
+enum DownsampleMode
+{
+    DOWNSAMPLE_NONZEROS,  // the number of entries above the tolerance
+    DOWNSAMPLE_REAL_PART, // the average real part
+    DOWNSAMPLE_IMAG_PART  // the average imaginary part
+};
+}
+using namespace DownsampleModeNS;
+
+// Checkpointing
+// =============
+// Each process dumps its local buffer, along with the distribution metadata
+// needed to interpret it, into a single file "basename.ckpt" via MPI-IO.
+// Restart reloads the local buffers without any communication when the
+// distribution and grid shape match those of the checkpoint and otherwise
+// performs a single streaming redistribution into the (current)
+// distribution of A.
+template<typename T>
+void Checkpoint( const AbstractDistMatrix<T>& A, string basename );
+template<typename T>
+void Restart( AbstractDistMatrix<T>& A, string basename );
+
 // Color maps
 // ==========
 void SetColorMap( ColorMap colorMap );
@@ -37,6 +60,38 @@ ColorMap GetColorMap();
 void SetNumDiscreteColors( Int numColors );
 Int NumDiscreteColors();
 
+// Downsampling
+// ============
+// Bins the entries of A into a tile of at most maxHeight x maxWidth pixels,
+// where entry (i,j) falls into pixel (floor(i tileHeight/m),
+// floor(j tileWidth/n)), so that rendering costs are independent of the size
+// of A. Each process bins its local entries and the tiles are summed onto
+// the root (rank zero) of the grid, which is the only process whose tile is
+// valid in the distributed cases.
+template<typename T>
+void Downsample
+( const Matrix<T>& A, Matrix<double>& tile, Int maxHeight, Int maxWidth,
+  DownsampleMode mode=DOWNSAMPLE_REAL_PART, Base<T> tol=0 );
+template<typename T>
+void Downsample
+( const AbstractDistMatrix<T>& A, Matrix<double>& tile,
+  Int maxHeight, Int maxWidth,
+  DownsampleMode mode=DOWNSAMPLE_REAL_PART, Base<T> tol=0 );
+template<typename T>
+void Downsample
+( const SparseMatrix<T>& A, Matrix<double>& tile, Int maxHeight, Int maxWidth,
+  DownsampleMode mode=DOWNSAMPLE_REAL_PART, Base<T> tol=0 );
+template<typename T>
+void Downsample
+( const DistSparseMatrix<T>& A, Matrix<double>& tile,
+  Int maxHeight, Int maxWidth,
+  DownsampleMode mode=DOWNSAMPLE_REAL_PART, Base<T> tol=0 );
+
+// The maximum number of pixels in each dimension of the images rendered by
+// Display, Spy, and Write
+void SetMaxImageSize( Int maxSize );
+Int MaxImageSize();
+
 // Display
 // =======
 void ProcessEvents( int numMsecs );
@@ -57,12 +112,8 @@ void Display( const DistMultiVec<T>& X, string title="DistMultiVec" );
 void Display( const Graph& graph, string title="Graph" );
 void Display( const DistGraph& graph, string title="DistGraph" );
 
-template<typename Real>
-void Display
-( const SparseMatrix<Real>& A, string title="SparseMatrix" );
-template<typename Real>
-void Display
-( const SparseMatrix<Complex<Real>>& A, string title="SparseMatrix" );
+template<typename T>
+void Display( const SparseMatrix<T>& A, string title="SparseMatrix" );
 template<typename T>
 void Display( const DistSparseMatrix<T>& A, string title="DistSparseMatrix" );
 
@@ -134,6 +185,13 @@ void Spy( const Matrix<T>& A, string title="Matrix", Base<T> tol=0 );
 template<typename T>
 void Spy
 ( const AbstractDistMatrix<T>& A, string title="DistMatrix", Base<T> tol=0 );
+template<typename T>
+void Spy
+( const SparseMatrix<T>& A, string title="SparseMatrix", Base<T> tol=0 );
+template<typename T>
+void Spy
+( const DistSparseMatrix<T>& A, string title="DistSparseMatrix",
+  Base<T> tol=0 );
 
 // Write
 // =====
@@ -145,6 +203,14 @@ template<typename T>
 void Write
 ( const AbstractDistMatrix<T>& A, string basename="DistMatrix",
   FileFormat format=BINARY, string title="" );
+template<typename T>
+void Write
+( const SparseMatrix<T>& A, string basename="SparseMatrix",
+  FileFormat format=BINARY_SPARSE );
+template<typename T>
+void Write
+( const DistSparseMatrix<T>& A, string basename="DistSparseMatrix",
+  FileFormat format=BINARY_SPARSE );
 
 } // namespace El
 
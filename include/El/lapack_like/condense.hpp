@@ -60,6 +60,24 @@ void ExplicitCondensed( Matrix<Field>& A );
 template<typename Field>
 void ExplicitCondensed( AbstractDistMatrix<Field>& A );
 
+// Return the real diagonal and superdiagonal of an upper bidiagonal matrix
+// with the same singular values as A, which is overwritten, by first
+// reducing A to a band with BLAS-3 updates and then chasing the bulges out of
+// the band. A bandwidth of zero selects the algorithmic blocksize. The
+// distributed variant redundantly returns the bidiagonal on every process.
+template<typename Field>
+void TwoStageCondensed
+( Matrix<Field>& A,
+  Matrix<Base<Field>>& mainDiag,
+  Matrix<Base<Field>>& superDiag,
+  Int bandwidth=0 );
+template<typename Field>
+void TwoStageCondensed
+( AbstractDistMatrix<Field>& A,
+  Matrix<Base<Field>>& mainDiag,
+  Matrix<Base<Field>>& superDiag,
+  Int bandwidth=0 );
+
 template<typename Field>
 void ApplyQ
 ( LeftOrRight side, Orientation orientation,
@@ -107,6 +125,14 @@ struct HermitianTridiagCtrl
     HermitianTridiagApproach approach=HERMITIAN_TRIDIAG_SQUARE;
     GridOrder order=ROW_MAJOR;
     SymvCtrl<Field> symvCtrl;
+
+    // Reduce to banded form with BLAS-3 updates before chasing the bulges
+    // down to tridiagonal form. This is only honored by HermitianEig and
+    // herm_tridiag::ExplicitCondensed, as the resulting transformation cannot
+    // be stored in the packed format of HermitianTridiag. A bandwidth of zero
+    // selects the algorithmic blocksize.
+    bool twoStage=false;
+    Int bandwidth=0;
 };
 
 template<typename Field>
@@ -122,7 +148,9 @@ void HermitianTridiag
 namespace herm_tridiag {
 
 template<typename Field>
-void ExplicitCondensed( UpperOrLower uplo, Matrix<Field>& A );
+void ExplicitCondensed
+( UpperOrLower uplo, Matrix<Field>& A,
+  const HermitianTridiagCtrl<Field>& ctrl=HermitianTridiagCtrl<Field>() );
 template<typename Field>
 void ExplicitCondensed
 ( UpperOrLower uplo, AbstractDistMatrix<Field>& A,
@@ -141,6 +169,50 @@ void ApplyQ
   const AbstractDistMatrix<Field>& householderScalars,
         AbstractDistMatrix<Field>& B );
 
+// Two-stage reduction
+// -------------------
+// The Householder reflectors of the reduction to banded form are stored
+// below the band of A (regardless of 'uplo'), while those from chasing the
+// bulges out of the band are stored here. In the distributed case, each
+// process only keeps the chase reflectors from its range of sweeps.
+template<typename Field>
+struct TwoStageReflectors
+{
+    Int bandwidth=0;
+    Matrix<Field> householderScalars;
+
+    Int sweepBeg=0, sweepEnd=0;
+    vector<Field> chaseScalars;
+    vector<Field> chaseVectors;
+};
+
+// On exit, the diagonal and (sub/super)diagonal of A hold the real
+// tridiagonal matrix, and the rest of the band is zeroed
+template<typename Field>
+void TwoStage
+( UpperOrLower uplo,
+  Matrix<Field>& A,
+  TwoStageReflectors<Field>& reflectors,
+  Int bandwidth=0 );
+template<typename Field>
+void TwoStage
+( UpperOrLower uplo,
+  AbstractDistMatrix<Field>& A,
+  TwoStageReflectors<Field>& reflectors,
+  Int bandwidth=0 );
+
+// B := Q B, where A = Q T Q^H
+template<typename Field>
+void ApplyTwoStageQ
+( const Matrix<Field>& A,
+  const TwoStageReflectors<Field>& reflectors,
+        Matrix<Field>& B );
+template<typename Field>
+void ApplyTwoStageQ
+( const AbstractDistMatrix<Field>& A,
+  const TwoStageReflectors<Field>& reflectors,
+        AbstractDistMatrix<Field>& B );
+
 } // namespace herm_tridiag
 
 // Hessenberg
@@ -186,6 +258,52 @@ void FormQ
   const AbstractDistMatrix<Field>& householderScalars,
         AbstractDistMatrix<Field>& Q );
 
+// Two-stage reduction
+// -------------------
+// A is first reduced to upper-Hessenberg form with 'bandwidth' subdiagonals
+// (the algorithmic blocksize if zero) with BLAS-3 updates, and the bulges are
+// then chased out of the band. The reflectors are stored as for
+// herm_tridiag::TwoStage, appending those of the first stage below the band
+// of A, so that, unlike the packed reflectors of Hessenberg, they can only be
+// applied from the left.
+template<typename Field>
+using TwoStageReflectors = herm_tridiag::TwoStageReflectors<Field>;
+
+// On exit, the upper-Hessenberg part of A holds the reduced matrix
+template<typename Field>
+void TwoStage
+( Matrix<Field>& A,
+  TwoStageReflectors<Field>& reflectors,
+  Int bandwidth=0 );
+template<typename Field>
+void TwoStage
+( AbstractDistMatrix<Field>& A,
+  TwoStageReflectors<Field>& reflectors,
+  Int bandwidth=0 );
+
+// B := Q B, where A = Q H Q^H
+template<typename Field>
+void ApplyTwoStageQ
+( const Matrix<Field>& A,
+  const TwoStageReflectors<Field>& reflectors,
+        Matrix<Field>& B );
+template<typename Field>
+void ApplyTwoStageQ
+( const AbstractDistMatrix<Field>& A,
+  const TwoStageReflectors<Field>& reflectors,
+        AbstractDistMatrix<Field>& B );
+
+template<typename Field>
+void FormTwoStageQ
+( const Matrix<Field>& A,
+  const TwoStageReflectors<Field>& reflectors,
+        Matrix<Field>& Q );
+template<typename Field>
+void FormTwoStageQ
+( const AbstractDistMatrix<Field>& A,
+  const TwoStageReflectors<Field>& reflectors,
+        AbstractDistMatrix<Field>& Q );
+
 } // namespace hessenberg
 
 } // namespace El
@@ -10,6 +10,7 @@
 #define EL_EUCLIDEANMIN_HPP
 
 #include <El/lapack_like/factor.hpp>
+#include <El/lapack_like/funcs.hpp>
 
 namespace El {
 
@@ -36,6 +37,32 @@ void LeastSquares
   const AbstractDistMatrix<Field>& B,
         AbstractDistMatrix<Field>& X );
 
+// Minimum-norm least squares
+// --------------------------
+// Unlike the above dense routines, which assume that op(A) has full rank,
+// return the minimum-norm solution X = pinv(op(A)) B of
+//
+//    min_X || op(A) X - B ||_F
+//
+// using the numerical rank of the decomposition chosen by 'ctrl' (which is
+// returned).
+template<typename Field>
+Int MinimumNormLeastSquares
+( Orientation orientation,
+  const Matrix<Field>& A,
+  const Matrix<Field>& B,
+        Matrix<Field>& X,
+  const PseudoinverseCtrl<Base<Field>>& ctrl=
+        PseudoinverseCtrl<Base<Field>>() );
+template<typename Field>
+Int MinimumNormLeastSquares
+( Orientation orientation,
+  const AbstractDistMatrix<Field>& A,
+  const AbstractDistMatrix<Field>& B,
+        AbstractDistMatrix<Field>& X,
+  const PseudoinverseCtrl<Base<Field>>& ctrl=
+        PseudoinverseCtrl<Base<Field>>() );
+
 template<typename Real>
 struct SQSDCtrl
 {
@@ -105,6 +132,107 @@ void LeastSquares
         DistMultiVec<Field>& X,
   const LeastSquaresCtrl<Base<Field>>& ctrl=LeastSquaresCtrl<Base<Field>>() );
 
+// Reusable sparse least squares solvers
+// -------------------------------------
+// Each call to the above sparse LeastSquares routines equilibrates op(A),
+// forms the regularized augmented system
+//
+//   J = [alpha I, op(A); op(A)^H, 0]  or  [alpha I, op(A)^H; op(A), 0],
+//
+// and then analyzes and factors it from scratch. The following objects
+// instead retain the equilibration, the reordering and frontal tree, and the
+// factorization of J so that any number of batches of right-hand sides can be
+// solved against them. Changing 'alpha' only modifies the values of the
+// leading diagonal of J, and so only a numerical refactorization (with the
+// original analysis) is performed.
+template<typename Field>
+class SparseLeastSquaresSolver
+{
+public:
+    SparseLeastSquaresSolver() { }
+    SparseLeastSquaresSolver
+    ( Orientation orientation,
+      const SparseMatrix<Field>& A,
+      const LeastSquaresCtrl<Base<Field>>& ctrl=
+            LeastSquaresCtrl<Base<Field>>() );
+
+    void Initialize
+    ( Orientation orientation,
+      const SparseMatrix<Field>& A,
+      const LeastSquaresCtrl<Base<Field>>& ctrl=
+            LeastSquaresCtrl<Base<Field>>() );
+
+    // Refactor J with a new value of 'alpha'
+    void SetAlpha( const Base<Field>& alpha );
+    Base<Field> Alpha() const EL_NO_EXCEPT { return ctrl_.alpha; }
+
+    bool Initialized() const EL_NO_EXCEPT { return initialized_; }
+    Int Height() const EL_NO_EXCEPT { return m_; }
+    Int Width() const EL_NO_EXCEPT { return n_; }
+
+    // Solve the least squares (or minimum length) problem with each column
+    // of B as a right-hand side
+    void Solve( const Matrix<Field>& B, Matrix<Field>& X ) const;
+
+private:
+    bool initialized_=false;
+    LeastSquaresCtrl<Base<Field>> ctrl_;
+    Int m_=0, n_=0;
+
+    // op(A) was equilibrated into inv(dR) op(A) inv(dC), and J was then
+    // divided by 'sqsdScale_' (if 'ctrl_.sqsdCtrl.scaleTwoNorm' was true)
+    Base<Field> sqsdScale_=1;
+    Matrix<Base<Field>> dR_, dC_;
+
+    // J_ contains the permanent regularization, whereas only the factored
+    // matrix contains the temporary regularization, 'regTmp_'
+    SparseMatrix<Field> J_;
+    Matrix<Base<Field>> regTmp_;
+    SparseLDLFactorization<Field> sparseLDLFact_;
+};
+
+template<typename Field>
+class DistSparseLeastSquaresSolver
+{
+public:
+    DistSparseLeastSquaresSolver() { }
+    DistSparseLeastSquaresSolver
+    ( Orientation orientation,
+      const DistSparseMatrix<Field>& A,
+      const LeastSquaresCtrl<Base<Field>>& ctrl=
+            LeastSquaresCtrl<Base<Field>>() );
+
+    void Initialize
+    ( Orientation orientation,
+      const DistSparseMatrix<Field>& A,
+      const LeastSquaresCtrl<Base<Field>>& ctrl=
+            LeastSquaresCtrl<Base<Field>>() );
+
+    // Refactor J with a new value of 'alpha'
+    void SetAlpha( const Base<Field>& alpha );
+    Base<Field> Alpha() const EL_NO_EXCEPT { return ctrl_.alpha; }
+
+    bool Initialized() const EL_NO_EXCEPT { return initialized_; }
+    Int Height() const EL_NO_EXCEPT { return m_; }
+    Int Width() const EL_NO_EXCEPT { return n_; }
+
+    // Solve the least squares (or minimum length) problem with each column
+    // of B as a right-hand side
+    void Solve( const DistMultiVec<Field>& B, DistMultiVec<Field>& X ) const;
+
+private:
+    bool initialized_=false;
+    LeastSquaresCtrl<Base<Field>> ctrl_;
+    Int m_=0, n_=0;
+
+    Base<Field> sqsdScale_=1;
+    DistMultiVec<Base<Field>> dR_, dC_;
+
+    DistSparseMatrix<Field> J_;
+    DistMultiVec<Base<Field>> regTmp_;
+    DistSparseLDLFactorization<Field> sparseLDLFact_;
+};
+
 // Dense versions which overwrite their input
 // ------------------------------------------
 namespace ls {
@@ -172,6 +300,84 @@ void Ridge
         DistMultiVec<Field>& X,
   const LeastSquaresCtrl<Base<Field>>& ctrl=LeastSquaresCtrl<Base<Field>>() );
 
+// Ridge regression for a sequence of parameters
+// ---------------------------------------------
+// Solve
+//
+//    min_X || op(A) X - B ||_F^2 + gamma_k^2 || X ||_F^2
+//
+// for each entry gamma_k of the column vector 'gammas' and return the
+// solutions side-by-side, i.e., X(:,k*numRHS:(k+1)*numRHS) corresponds to
+// gamma_k. Both tall and wide op(A) are supported.
+//
+// The dense versions compute a single (thin) SVD, op(A) = U Sigma V^H, and
+// then form every solution from the shared projection U^H B, since
+//
+//    X(gamma) = V (Sigma^2 + gamma^2 I)^{-1} Sigma U^H B.
+//
+// The sparse versions instead run a Golub-Kahan-Lanczos bidiagonalization
+// of op(A) started from each column b of B,
+//
+//    op(A) V_j = U_{j+1} T_j,  U_{j+1} e_0 = b / || b ||_2,
+//
+// with T_j lower bidiagonal. Since the Krylov subspace span(V_j) of
+// op(A)^H op(A) + gamma^2 I does not depend upon the shift gamma^2, a
+// single bidiagonalization serves all of the parameters: each solution is
+// V_j y(gamma), where y(gamma) minimizes
+//
+//    || T_j y - || b ||_2 e_0 ||_2^2 + gamma^2 || y ||_2^2,
+//
+// which is solved for all gamma with one SVD of the small matrix T_j.
+
+template<typename Real>
+struct RidgeLanczosCtrl
+{
+    // The maximum number of bidiagonalization steps per right-hand side
+    Int basisSize=100;
+
+    // The bidiagonalization is terminated early once a new Lanczos vector
+    // has a norm of at most 'breakdownTol' times the largest entry of T_j,
+    // as the Krylov subspace is then numerically invariant
+    Real breakdownTol=Pow(limits::Epsilon<Real>(),Real(0.75));
+
+    // Whether the Lanczos vectors should be fully reorthogonalized
+    bool reorthogonalize=true;
+
+    bool progress=false;
+};
+
+template<typename Field>
+void Ridge
+( Orientation orientation,
+  const Matrix<Field>& A,
+  const Matrix<Field>& B,
+  const Matrix<Base<Field>>& gammas,
+        Matrix<Field>& X );
+template<typename Field>
+void Ridge
+( Orientation orientation,
+  const AbstractDistMatrix<Field>& A,
+  const AbstractDistMatrix<Field>& B,
+  const AbstractDistMatrix<Base<Field>>& gammas,
+        AbstractDistMatrix<Field>& X );
+
+template<typename Field>
+void Ridge
+( Orientation orientation,
+  const SparseMatrix<Field>& A,
+  const Matrix<Field>& B,
+  const Matrix<Base<Field>>& gammas,
+        Matrix<Field>& X,
+  const RidgeLanczosCtrl<Base<Field>>& ctrl=RidgeLanczosCtrl<Base<Field>>() );
+template<typename Field>
+void Ridge
+( Orientation orientation,
+  const DistSparseMatrix<Field>& A,
+  const DistMultiVec<Field>& B,
+  const Matrix<Base<Field>>& gammas,
+        DistMultiVec<Field>& X,
+  const RidgeLanczosCtrl<Base<Field>>& ctrl=RidgeLanczosCtrl<Base<Field>>() );
+
 // Tikhonov regularization
 // =======================
 
@@ -165,7 +165,8 @@ typedef enum
   EL_BUNCH_KAUFMAN_D,
   EL_BUNCH_KAUFMAN_BOUNDED,
   EL_BUNCH_PARLETT,
-  LDL_WITHOUT_PIVOTING
+  LDL_WITHOUT_PIVOTING,
+  EL_AASEN
   /* TODO(poulson): Diagonal pivoting? */
 } ElLDLPivotType;
 
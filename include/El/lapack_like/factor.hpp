@@ -9,6 +9,7 @@
 #ifndef EL_FACTOR_HPP
 #define EL_FACTOR_HPP
 
+#include <El/lapack_like/reflect.hpp>
 #include <El/lapack_like/perm.hpp>
 #include <El/lapack_like/util.hpp>
 #include <El/lapack_like/factor/ldl/sparse/symbolic.hpp>
@@ -18,13 +19,29 @@ namespace El {
 
 // Cholesky
 // ========
+struct CholeskyCtrl
+{
+    bool scalapack=false;
+    // The number of panels factored ahead of the trailing update, so that
+    // their redistributions overlap with it (currently, positive depths are
+    // all treated as a depth of one)
+    Int lookahead=0;
+};
+
 template<typename Field>
 void Cholesky( UpperOrLower uplo, Matrix<Field>& A );
 template<typename Field>
 void Cholesky
 ( UpperOrLower uplo, AbstractDistMatrix<Field>& A, bool scalapack=false );
 template<typename Field>
+void Cholesky
+( UpperOrLower uplo, AbstractDistMatrix<Field>& A, const CholeskyCtrl& ctrl );
+template<typename Field>
 void Cholesky( UpperOrLower uplo, DistMatrix<Field,STAR,STAR>& A );
+// Factors block-cyclic (ScaLAPACK-compatible) matrices in place with
+// ScaLAPACK when it is available and supports the datatype
+template<typename Field>
+void Cholesky( UpperOrLower uplo, DistMatrix<Field,MC,MR,BLOCK>& A );
 
 template<typename Field>
 void ReverseCholesky( UpperOrLower uplo, Matrix<Field>& A );
@@ -57,6 +74,11 @@ void HPSDCholesky( UpperOrLower uplo, Matrix<Field>& A );
 template<typename Field>
 void HPSDCholesky( UpperOrLower uplo, AbstractDistMatrix<Field>& A );
 
+// Overwrite the given triangle of the band of an HPD band matrix with its
+// Cholesky factor
+template<typename Field>
+void Cholesky( UpperOrLower uplo, BandMatrix<Field>& A );
+
 namespace cholesky {
 
 template<typename Field>
@@ -87,6 +109,14 @@ void SolveAfter
   const DistPermutation& P,
         AbstractDistMatrix<Field>& B );
 
+
+template<typename Field>
+void SolveAfter
+( UpperOrLower uplo,
+  Orientation orientation,
+  const BandMatrix<Field>& A,
+        Matrix<Field>& B );
+
 } // namespace cholesky
 
 // LDL
@@ -99,7 +129,9 @@ enum LDLPivotType
     BUNCH_KAUFMAN_D,
     BUNCH_KAUFMAN_BOUNDED,
     BUNCH_PARLETT,
-    LDL_WITHOUT_PIVOTING
+    LDL_WITHOUT_PIVOTING,
+    // Aasen's method, which instead produces a tridiagonal T
+    AASEN
     /* TODO(poulson): Diagonal pivoting? */
 };
 }
@@ -114,6 +146,8 @@ Real LDLPivotConstant( LDLPivotType pivType )
     case BUNCH_KAUFMAN_A:
     case BUNCH_PARLETT:   return (1+Sqrt(Real(17)))/8;
     case BUNCH_KAUFMAN_D: return Real(0.525);
+    // Aasen's method uses partial pivoting and has no growth constant
+    case AASEN:           return Real(0);
     default:
         LogicError("No default constant exists for this pivot type");
         return 0;
@@ -174,6 +208,13 @@ InertiaType Inertia
 ( const AbstractDistMatrix<Base<Field>>& d,
   const AbstractDistMatrix<Field>& dSub );
 
+// Compute the inertia triplet of a Hermitian matrix from the diagonal (and any
+// 2x2 pivots) of a sparse LDL^H factorization
+template<typename Field>
+InertiaType Inertia( const SparseLDLFactorization<Field>& factorization );
+template<typename Field>
+InertiaType Inertia( const DistSparseLDLFactorization<Field>& factorization );
+
 // Multiply vectors using an implicit representation of an LDL factorization
 // -------------------------------------------------------------------------
 template<typename Field>
@@ -342,6 +383,51 @@ Int SolveAfter
         DistMultiVec<Field>& B,
   const RegSolveCtrl<Base<Field>>& ctrl );
 
+// Mixed-precision solves with a factorization stored (and computed) in the
+// demoted precision, e.g., single-precision for double-precision problems
+// or double-precision for DoubleDouble problems, which halves the memory
+// and bandwidth requirements of the fronts. The factorization should be
+// formed from a demoted copy of the regularized matrix, e.g.,
+//
+//   DistSparseMatrix<Demote<Field>> ADemoted(A.Grid());
+//   Copy( A, ADemoted );
+//   sparseLDLFact.Initialize( ADemoted, hermitian );
+//   sparseLDLFact.Factor();
+//
+// while the residuals of the iterative refinement and of the outer GMRES
+// iteration are formed against the working-precision matrix.
+template<typename Field>
+Int DemotedSolveAfter
+( const SparseMatrix<Field>& A,
+  const Matrix<Base<Field>>& reg,
+  const SparseLDLFactorization<Demote<Field>>& sparseLDLFact,
+        Matrix<Field>& B,
+  const RegSolveCtrl<Base<Field>>& ctrl );
+template<typename Field>
+Int DemotedSolveAfter
+( const DistSparseMatrix<Field>& A,
+  const DistMultiVec<Base<Field>>& reg,
+  const DistSparseLDLFactorization<Demote<Field>>& sparseLDLFact,
+        DistMultiVec<Field>& B,
+  const RegSolveCtrl<Base<Field>>& ctrl );
+
+template<typename Field>
+Int DemotedSolveAfter
+( const SparseMatrix<Field>& A,
+  const Matrix<Base<Field>>& reg,
+  const Matrix<Base<Field>>& d,
+  const SparseLDLFactorization<Demote<Field>>& sparseLDLFact,
+        Matrix<Field>& B,
+  const RegSolveCtrl<Base<Field>>& ctrl );
+template<typename Field>
+Int DemotedSolveAfter
+( const DistSparseMatrix<Field>& A,
+  const DistMultiVec<Base<Field>>& reg,
+  const DistMultiVec<Base<Field>>& d,
+  const DistSparseLDLFactorization<Demote<Field>>& sparseLDLFact,
+        DistMultiVec<Field>& B,
+  const RegSolveCtrl<Base<Field>>& ctrl );
+
 } // namespace reg_ldl
 
 // LU
@@ -361,6 +447,23 @@ enum LUPivotType
 }
 using namespace LUPivotTypeNS;
 
+// The pivot selection within each panel of a distributed partially-pivoted LU
+namespace LUPanelPivotingNS {
+enum LUPanelPivoting
+{
+    // An AllReduce (and possibly a row broadcast) per column of the panel
+    LU_PANEL_PARTIAL,
+    // A tournament of local LU factorizations up a reduction tree (CALU)
+    LU_PANEL_TOURNAMENT
+};
+}
+using namespace LUPanelPivotingNS;
+
+struct LUCtrl
+{
+    LUPanelPivoting panelPivoting=LU_PANEL_PARTIAL;
+};
+
 // LU without pivoting
 // -------------------
 template<typename Field>
@@ -376,6 +479,13 @@ template<typename Field>
 void LU( Matrix<Field>& A, Permutation& P );
 template<typename Field>
 void LU( AbstractDistMatrix<Field>& A, DistPermutation& P );
+template<typename Field>
+void LU
+( AbstractDistMatrix<Field>& A, DistPermutation& P, const LUCtrl& ctrl );
+// Factors block-cyclic (ScaLAPACK-compatible) matrices in place with
+// ScaLAPACK when it is available and supports the datatype
+template<typename Field>
+void LU( DistMatrix<Field,MC,MR,BLOCK>& A, DistPermutation& P );
 
 // LU with full pivoting
 // ---------------------
@@ -391,6 +501,16 @@ void LU
   DistPermutation& P,
   DistPermutation& Q );
 
+// Banded LU with partial pivoting
+// --------------------------------
+// The upper bandwidth of A is increased by its lower bandwidth in order to
+// hold the fill-in of U, and, as in LAPACK's xGBTRF, pivots(j) is the
+// (zero-based) row interchanged with row j immediately before the j'th
+// column of L is formed. Since the later interchanges are not applied to
+// the earlier columns of L, the pivots are not a permutation of P A = L U.
+template<typename Field>
+void LU( BandMatrix<Field>& A, Matrix<Int>& pivots );
+
 // Low-rank modification of a partially-pivoted LU factorization
 // -------------------------------------------------------------
 // NOTE: This routine currently performs a sequence of rank-one updates
@@ -460,6 +580,16 @@ void SolveAfter
   const DistPermutation& Q,
         AbstractDistMatrix<Field>& B );
 
+
+// Solve linear systems using a banded LU factorization
+// ----------------------------------------------------
+template<typename Field>
+void SolveAfter
+( Orientation orientation,
+  const BandMatrix<Field>& A,
+  const Matrix<Int>& pivots,
+        Matrix<Field>& B );
+
 } // namespace lu
 
 // LQ
@@ -542,11 +672,29 @@ void Explicit( AbstractDistMatrix<Field>& L, AbstractDistMatrix<Field>& A );
 // QR factorization
 // ================
 
+// The pivot selection of a column-pivoted QR factorization
+namespace QRColPivotingNS {
+enum QRColPivoting
+{
+    // A global column-norm reduction (and norm downdates) per pivot
+    QR_COLPIV_BUSINGER_GOLUB,
+    // A tournament of Gram-based rank-revealing selections up a reduction
+    // tree which chooses a panel of pivots at once (QRTP)
+    QR_COLPIV_TOURNAMENT
+};
+}
+using namespace QRColPivotingNS;
+
 template<typename Real>
 struct QRCtrl
 {
     bool colPiv=false;
 
+    // Only used by the variants which accept a permutation. Tournament
+    // pivoting does not support 'smallestFirst' and, since it does not
+    // downdate column norms, ignores 'alwaysRecomputeNorms'.
+    QRColPivoting colPivoting=QR_COLPIV_BUSINGER_GOLUB;
+
     bool boundRank=false;
     Int maxRank=0;
 
@@ -562,6 +710,44 @@ struct QRCtrl
     // instead, as it is often the case that one may desire a custom pivoting
     // rule.
     bool smallestFirst=false;
+
+    // Factor the panels of an unpivoted distributed QR with TSQR (CAQR) so
+    // that each panel requires O(log p) rather than O(nb log p) messages.
+    // The panels fall back to the standard Householder factorization when
+    // TSQR is not applicable (TSQR requires a power-of-two number of
+    // processes which each own at least as many rows as the panel width).
+    bool communicationAvoiding=false;
+};
+
+// The number of passes of Cholesky-based QR. A single pass loses
+// orthogonality in proportion to cond(A)^2, a second pass over the computed Q
+// (CholeskyQR2) restores O(eps) orthogonality for cond(A) up to roughly
+// eps^{-1/2}, and preceding CholeskyQR2 with a factorization of the Gram
+// matrix shifted by O(eps) ||A||_F^2 (shifted CholeskyQR3) extends this to
+// cond(A) up to roughly eps^{-1}. Each pass requires one Herk, a single
+// reduction of the n x n Gram matrix, and one Trsm.
+namespace CholeskyQRVariantNS {
+enum CholeskyQRVariant
+{
+    CHOLESKY_QR1,
+    CHOLESKY_QR2,
+    CHOLESKY_QR3_SHIFTED,
+    // CholeskyQR2 if the first Cholesky factor of the Gram matrix exists and
+    // has an estimated condition number of at most 'maxCondition', and
+    // otherwise shifted CholeskyQR3 (reusing the original Gram matrix)
+    CHOLESKY_QR_AUTO
+};
+}
+using namespace CholeskyQRVariantNS;
+
+template<typename Real>
+struct CholeskyQRCtrl
+{
+    CholeskyQRVariant variant=CHOLESKY_QR_AUTO;
+    // The one-norm estimate of the condition number of the Cholesky factor
+    // is at least its two-norm condition number, which is that of A
+    Real maxCondition=Pow(limits::Epsilon<Real>(),Real(-0.5));
+    bool progress=false;
 };
 
 // Return an implicit representation of Q and R such that A = Q R
@@ -576,6 +762,13 @@ void QR
 ( AbstractDistMatrix<Field>& A,
   AbstractDistMatrix<Field>& householderScalars,
   AbstractDistMatrix<Base<Field>>& signature );
+// Only the 'communicationAvoiding' member of the control structure is used
+template<typename Field>
+void QR
+( AbstractDistMatrix<Field>& A,
+  AbstractDistMatrix<Field>& householderScalars,
+  AbstractDistMatrix<Base<Field>>& signature,
+  const QRCtrl<Base<Field>>& ctrl );
 
 // Return an implicit representation of (Q,R,Omega) such that A Omega^T ~= Q R
 // ---------------------------------------------------------------------------
@@ -606,6 +799,18 @@ void ApplyQ
   const Matrix<Field>& householderScalars,
   const Matrix<Base<Field>>& signature,
         Matrix<Field>& B );
+// The compact-WY factors of the Householder vectors below the diagonal of A
+// may be precomputed with FormCompactWY( 0, A, wy ) so that repeated
+// applications do not recompute them
+template<typename Field>
+void ApplyQ
+( LeftOrRight side,
+  Orientation orientation,
+  const Matrix<Field>& A,
+  const Matrix<Field>& householderScalars,
+  const Matrix<Base<Field>>& signature,
+  const CompactWY<Field>& wy,
+        Matrix<Field>& B );
 template<typename Field>
 void ApplyQ
 ( LeftOrRight side,
@@ -627,6 +832,15 @@ void SolveAfter
         Matrix<Field>& X );
 template<typename Field>
 void SolveAfter
+( Orientation orientation,
+  const Matrix<Field>& A,
+  const Matrix<Field>& householderScalars,
+  const Matrix<Base<Field>>& signature,
+  const CompactWY<Field>& wy,
+  const Matrix<Field>& B,
+        Matrix<Field>& X );
+template<typename Field>
+void SolveAfter
 ( Orientation orientation,
   const AbstractDistMatrix<Field>& A,
   const AbstractDistMatrix<Field>& householderScalars,
@@ -642,6 +856,16 @@ void Cholesky( Matrix<Field>& A, Matrix<Field>& R );
 template<typename Field>
 void Cholesky( AbstractDistMatrix<Field>& A, AbstractDistMatrix<Field>& R );
 
+// Multi-pass (CholeskyQR2 and shifted CholeskyQR3) variants
+template<typename Field>
+void Cholesky
+( Matrix<Field>& A, Matrix<Field>& R,
+  const CholeskyQRCtrl<Base<Field>>& ctrl );
+template<typename Field>
+void Cholesky
+( AbstractDistMatrix<Field>& A, AbstractDistMatrix<Field>& R,
+  const CholeskyQRCtrl<Base<Field>>& ctrl );
+
 // Return R (with non-negative diagonal) such that A = Q R or A Omega^T = Q R
 // --------------------------------------------------------------------------
 template<typename Field>
@@ -947,6 +1171,157 @@ void Skeleton
         AbstractDistMatrix<Field>& Z,
   const QRCtrl<Base<Field>>& ctrl=QRCtrl<Base<Field>>() );
 
+// Randomized range finder
+// =======================
+// Returns an orthonormal Q whose columns approximately span the dominant
+// rank-dimensional column space of A by sketching A with a Gaussian matrix of
+// rank+oversample columns and applying numPowerIts subspace iterations with
+// A A^H (see Halko, Martinsson, and Tropp, "Finding structure with
+// randomness"). Q^H A is then a small matrix suitable for, e.g., an SVD or an
+// ID/Skeleton approximation of the projected problem.
+struct RangeFinderCtrl
+{
+    Int oversample=10;
+    Int numPowerIts=2;
+};
+
+template<typename Field>
+void RandomizedRangeFinder
+( const Matrix<Field>& A,
+        Int rank,
+        Matrix<Field>& Q,
+  const RangeFinderCtrl& ctrl=RangeFinderCtrl() );
+template<typename Field>
+void RandomizedRangeFinder
+( const AbstractDistMatrix<Field>& A,
+        Int rank,
+        AbstractDistMatrix<Field>& Q,
+  const RangeFinderCtrl& ctrl=RangeFinderCtrl() );
+
+// Sketched ID and Skeleton
+// ========================
+// Variants of ID and Skeleton which choose their pivots with column-pivoted
+// QR factorizations of the small sketches Q^H A and (A V)^H, where Q is
+// returned by RandomizedRangeFinder for rank ctrl.maxRank and V is an
+// orthonormal basis for the row space of Q^H A. The sketches are replicated
+// on every process, so, unlike the global column-norm reduction required by
+// each pivot of BusingerGolub, the pivoting requires no communication and
+// only the blocked products with A remain. 'ctrl.boundRank' must be set.
+template<typename Field>
+void SketchedID
+( const Matrix<Field>& A,
+        Permutation& P,
+        Matrix<Field>& Z,
+  const QRCtrl<Base<Field>>& ctrl,
+  const RangeFinderCtrl& sketchCtrl=RangeFinderCtrl() );
+template<typename Field>
+void SketchedID
+( const AbstractDistMatrix<Field>& A,
+        DistPermutation& P,
+        AbstractDistMatrix<Field>& Z,
+  const QRCtrl<Base<Field>>& ctrl,
+  const RangeFinderCtrl& sketchCtrl=RangeFinderCtrl() );
+
+template<typename Field>
+void SketchedSkeleton
+( const Matrix<Field>& A,
+        Permutation& PR,
+        Permutation& PC,
+        Matrix<Field>& Z,
+  const QRCtrl<Base<Field>>& ctrl,
+  const RangeFinderCtrl& sketchCtrl=RangeFinderCtrl() );
+template<typename Field>
+void SketchedSkeleton
+( const AbstractDistMatrix<Field>& A,
+        DistPermutation& PR,
+        DistPermutation& PC,
+        AbstractDistMatrix<Field>& Z,
+  const QRCtrl<Base<Field>>& ctrl,
+  const RangeFinderCtrl& sketchCtrl=RangeFinderCtrl() );
+
+// Batched factorizations
+// ======================
+// Factorizations and solves of many small, independent matrices which avoid
+// the per-matrix overhead (e.g., of forming Permutation objects) of the above
+// routines. The batch is threaded across its matrices, each of which is
+// factored by an unblocked algorithm.
+//
+// In the uniform-size interfaces, the k'th matrix of a batch begins at
+// A+k*AStride and has leading dimension ALDim, the k'th (LAPACK-style,
+// zero-based) pivot vector begins at pivots+k*n, and the k'th vector of
+// Householder scalars begins at householderScalars+k*Min(m,n). If any of the
+// factorizations fails, the remaining matrices are still factored before the
+// corresponding exception is thrown.
+namespace batched {
+
+// A = P^T L U, where row i was swapped with row pivots[i] during step i
+template<typename Field>
+void LU
+( Int n, Field* A, Int ALDim, Int AStride, Int* pivots, Int batchSize );
+template<typename Field>
+void LU( vector<Matrix<Field>>& A, vector<Matrix<Int>>& pivots );
+
+template<typename Field>
+void LUSolveAfter
+( Int n, Int numRHS,
+  const Field* A, Int ALDim, Int AStride,
+  const Int* pivots,
+        Field* B, Int BLDim, Int BStride,
+  Int batchSize );
+template<typename Field>
+void LUSolveAfter
+( const vector<Matrix<Field>>& A,
+  const vector<Matrix<Int>>& pivots,
+        vector<Matrix<Field>>& B );
+
+template<typename Field>
+void Cholesky
+( UpperOrLower uplo, Int n, Field* A, Int ALDim, Int AStride, Int batchSize );
+template<typename Field>
+void Cholesky( UpperOrLower uplo, vector<Matrix<Field>>& A );
+
+template<typename Field>
+void CholeskySolveAfter
+( UpperOrLower uplo, Int n, Int numRHS,
+  const Field* A, Int ALDim, Int AStride,
+        Field* B, Int BLDim, Int BStride,
+  Int batchSize );
+template<typename Field>
+void CholeskySolveAfter
+( UpperOrLower uplo,
+  const vector<Matrix<Field>>& A,
+        vector<Matrix<Field>>& B );
+
+// R = H_{t-1} ... H_0 A, where t=Min(m,n) and H_j = I - tau_j v_j v_j^H
+// (see lapack::Reflector), with R stored in the upper triangle and the
+// j'th reflector vector (with an implicit unit diagonal) below the diagonal
+template<typename Field>
+void QR
+( Int m, Int n, Field* A, Int ALDim, Int AStride,
+  Field* householderScalars, Int batchSize );
+template<typename Field>
+void QR
+( vector<Matrix<Field>>& A, vector<Matrix<Field>>& householderScalars );
+
+// B := alpha op(inv(A)) B or B := alpha B op(inv(A)), with B m x n
+template<typename Field>
+void Trsm
+( LeftOrRight side, UpperOrLower uplo,
+  Orientation orientation, UnitOrNonUnit diag,
+  Int m, Int n, Field alpha,
+  const Field* A, Int ALDim, Int AStride,
+        Field* B, Int BLDim, Int BStride,
+  Int batchSize );
+template<typename Field>
+void Trsm
+( LeftOrRight side, UpperOrLower uplo,
+  Orientation orientation, UnitOrNonUnit diag,
+  Field alpha,
+  const vector<Matrix<Field>>& A,
+        vector<Matrix<Field>>& B );
+
+} // namespace batched
+
 } // namespace El
 
 #include <El/lapack_like/factor/qr/ProxyHouseholder.hpp>
@@ -19,6 +19,9 @@
 #ifndef EL_FACTOR_LDL_SPARSE_NUMERIC_HPP
 #define EL_FACTOR_LDL_SPARSE_NUMERIC_HPP
 
+#include <list>
+#include <map>
+
 #define EL_SUITESPARSE_NO_SCALAR_FUNCS
 #include <ElSuiteSparse/ldl.hpp>
 
@@ -50,6 +53,13 @@ LDLFrontType InitialFactorType( LDLFrontType type );
 
 namespace ldl {
 
+// The number of OpenMP threads used to factor independent subtrees of the
+// local (sequential) portion of the elimination tree concurrently (the
+// default of one processes the tree sequentially). This has no effect
+// unless Elemental was configured with OpenMP support (EL_HYBRID).
+void SetNumSubtreeThreads( Int numThreads );
+Int NumSubtreeThreads();
+
 template<typename T>
 struct DistMatrixNode;
 template<typename T>
@@ -117,6 +127,11 @@ struct MultiVecCommMeta
 
 struct DistMultiVecNodeMeta
 {
+    // Whether the metadata has been initialized (which cannot be inferred
+    // from the sizes of the vectors, as they are empty on processes which do
+    // not own any rows)
+    bool initialized=false;
+
     vector<Int> sendInds;
     vector<Int> recvInds;
     vector<int> mappedOwners;
@@ -131,6 +146,18 @@ struct DistMultiVecNodeMeta
       const DistNodeInfo& info,
       const DistMap& invMap,
       const DistMultiVec<T>& X );
+
+    void Empty()
+    {
+        initialized = false;
+        SwapClear( sendInds );
+        SwapClear( recvInds );
+        SwapClear( mappedOwners );
+        SwapClear( sendSizes );
+        SwapClear( sendOffs );
+        SwapClear( recvSizes );
+        SwapClear( recvOffs );
+    }
 };
 
 // For handling a set of vectors distributed in a [VC,* ] manner over each node
@@ -258,12 +285,28 @@ struct Front
     LDLFrontType type;
 
     Matrix<Field> LDense;
+
+    // Whether LDense has been written to a FrontStore and emptied, along
+    // with its dimensions at the time (LDense is inaccessible until the
+    // front has been reacquired from the store)
+    bool outOfCore=false;
+    Int outOfCoreHeight=0, outOfCoreWidth=0;
     SparseMatrix<Field> LSparse;
 
     Matrix<Field> diag;
     Matrix<Field> subdiag;
     Permutation p;
 
+    // Whether the bottom-left block of LDense has been replaced by the
+    // low-rank approximation compressedU compressedV, which leaves only the
+    // top-left block in LDense (see ldl::CompressionCtrl)
+    bool compressed=false;
+    Matrix<Field> compressedU, compressedV;
+
+    // The number of pivots of an intra-pivoted front which were statically
+    // perturbed (see ldl::StaticPivotCtrl)
+    Int numStaticPivots=0;
+
     Matrix<Field> workDense;
     SparseMatrix<Field> workSparse;
 
@@ -308,14 +351,104 @@ struct Front
 
     const Front<Field>& operator=( const Front<Field>& front );
 
+    // The dimensions of LDense, whether or not it is resident
+    Int DenseHeight() const;
+    Int DenseWidth() const;
+
     Int Height() const;
     Int NumEntries() const;
     Int NumTopLeftEntries() const;
     Int NumBottomLeftEntries() const;
+    Int NumStaticPivots() const;
     double FactorGFlops() const;
     double SolveGFlops( Int numRHS=1 ) const;
 };
 
+// Out-of-core storage of the dense factors of the local fronts
+struct OutOfCoreCtrl
+{
+    bool enabled=false;
+    // The (preferably node-local) directory holding the front files
+    string directory=".";
+    // The number of bytes of dense factors allowed to remain resident (which
+    // is further limited by the process-wide budget of SetMemoryBudget)
+    double memoryBudget=1.e9;
+};
+
+// Approximate factorization of the local fronts for use as a preconditioner
+// (e.g., within KrylovSolve): the bottom-left block of each sufficiently
+// large non-pivoted front is replaced by an interpolative decomposition, and
+// the Schur complement is formed from the approximation, so that the result
+// is an exact factorization of a nearby matrix.
+struct CompressionCtrl
+{
+    bool enabled=false;
+    // The relative tolerance of the pivoted QR used to form the ID
+    double relTol=1.e-6;
+    // Fronts with fewer rows or columns in their bottom-left block are exact
+    Int minSize=64;
+    // The approximation is only kept if its rank is at most this fraction
+    // of the smaller dimension of the bottom-left block
+    double maxRankRatio=0.5;
+};
+
+// Static pivoting of the intra-front pivoted (LDL_INTRAPIV_*) factorizations
+// of the local fronts. Since the pivots are only chosen from the top-left
+// block of each front, a 1x1 pivot 'fails' when an entry of its column of
+// the bottom-left block of L exceeds 1/threshold or when it is smaller than
+// relPerturbation times the max norm of the front. If at most
+// maxPerturbedRatio of the pivots of a front fail, the failed original
+// diagonal entries are shifted so that the pivots pass and the front is
+// refactored once; the result is an exact factorization of a nearby matrix,
+// which just a few steps of iterative refinement against the original matrix
+// correct.
+struct StaticPivotCtrl
+{
+    bool enabled=false;
+    double threshold=0.01;
+    double relPerturbation=1.e-8;
+    double maxPerturbedRatio=0.05;
+};
+
+// Completed fronts are released to the store, which writes the least
+// recently used fronts to disk (and frees them) whenever the resident
+// factors exceed the memory budget. Fronts must be acquired before LDense
+// is accessed again.
+template<typename Field>
+class FrontStore
+{
+public:
+    FrontStore( const OutOfCoreCtrl& ctrl );
+    ~FrontStore();
+
+    void Release( Front<Field>& front );
+    void Acquire( const Front<Field>& front );
+    void AcquireAll();
+
+    double ResidentBytes() const { return residentBytes_; }
+    double StoredBytes() const { return storedBytes_; }
+
+private:
+    struct Entry
+    {
+        Front<Field>* front;
+        std::streamoff offset=-1;
+        typename std::list<Front<Field>*>::iterator residentIt;
+    };
+
+    OutOfCoreCtrl ctrl_;
+    string filename_;
+    std::fstream file_;
+    std::streamoff fileEnd_=0;
+
+    std::map<const Front<Field>*,Entry> entries_;
+    // The resident released fronts, from least to most recently used
+    std::list<Front<Field>*> resident_;
+    double residentBytes_=0, storedBytes_=0;
+
+    void Evict();
+};
+
 struct FactorCommMeta
 {
     vector<int> numChildSendInds;
@@ -334,6 +467,40 @@ struct FactorCommMeta
 };
 void ComputeFactRecvInds( const DistNodeInfo& info );
 
+// The communication pattern formed when pulling a sparse matrix into a
+// distributed frontal tree. Any matrix with the same sparsity pattern and
+// distribution can then be pulled with a single AllToAll of its values.
+struct DistFrontPullPattern
+{
+    bool formed=false;
+    Int numLocalEntries=0;
+
+    // The indices into the local values of A of the entries to send (ordered
+    // by destination)
+    vector<Int> sValueInds;
+    vector<int> sEntriesSizes, sEntriesOffs;
+
+    // The metadata for unpacking the received entries into the fronts
+    vector<int> rEntriesSizes, rEntriesOffs;
+    vector<int> rRowOffs;
+    vector<Int> rRowLengths;
+    vector<Int> rTargets;
+
+    void Empty()
+    {
+        formed = false;
+        numLocalEntries = 0;
+        SwapClear( sValueInds );
+        SwapClear( sEntriesSizes );
+        SwapClear( sEntriesOffs );
+        SwapClear( rEntriesSizes );
+        SwapClear( rEntriesOffs );
+        SwapClear( rRowOffs );
+        SwapClear( rRowLengths );
+        SwapClear( rTargets );
+    }
+};
+
 template<typename Field>
 struct DistFront
 {
@@ -393,6 +560,15 @@ struct DistFront
             vector<Int>& mappedTargets,
             vector<Int>& colOffs,
       bool hermitian=false );
+    // Form the pull pattern if it has not yet been formed and otherwise only
+    // redistribute the values of A
+    void Pull
+    ( const DistSparseMatrix<Field>& A,
+      const DistMap& reordering,
+      const DistSeparator& rootSep,
+      const DistNodeInfo& info,
+            DistFrontPullPattern& pattern,
+      bool hermitian=false );
 
     void PullUpdate
     ( const DistSparseMatrix<Field>& A,
@@ -469,6 +645,19 @@ public:
     // with a different matrix (e.g., within an Interior Point Method).
     void ChangeNonzeroValues( const SparseMatrix<Field>& ANew );
 
+    // Stream the dense factors of the (local) fronts to disk during
+    // subsequent factorizations (see ldl::OutOfCoreCtrl).
+    void SetOutOfCoreCtrl( const ldl::OutOfCoreCtrl& ctrl );
+
+    // Compress the local fronts during subsequent factorizations so that
+    // the result is only suitable as a preconditioner
+    // (see ldl::CompressionCtrl).
+    void SetCompressionCtrl( const ldl::CompressionCtrl& ctrl );
+
+    // Statically perturb the failed pivots of intra-pivoted local fronts
+    // during subsequent factorizations (see ldl::StaticPivotCtrl).
+    void SetStaticPivotCtrl( const ldl::StaticPivotCtrl& ctrl );
+
     // Factor the initialized multifrontal tree.
     void Factor( LDLFrontType frontType=LDL_2D );
 
@@ -518,6 +707,8 @@ public:
     Int NumEntries() const;
     Int NumTopLeftEntries() const;
     Int NumBottomLeftEntries() const;
+    // The number of statically perturbed pivots of the last factorization
+    Int NumStaticPivots() const;
     double FactorGFlops() const;
     double SolveGFlops( Int numRHS=1 ) const;
 
@@ -540,6 +731,11 @@ private:
     bool initialized_=false;
     bool factored_=false;
     unique_ptr<ldl::Front<Field>> front_;
+    // The store must be destroyed before the fronts it references
+    ldl::OutOfCoreCtrl outOfCoreCtrl_;
+    unique_ptr<ldl::FrontStore<Field>> store_;
+    ldl::CompressionCtrl compressionCtrl_;
+    ldl::StaticPivotCtrl staticPivotCtrl_;
     unique_ptr<ldl::NodeInfo> info_;
     unique_ptr<ldl::Separator> separator_;
 
@@ -580,11 +776,32 @@ public:
     // Re-initialize the multifrontal tree with a new sparse matrix which has
     // the same nonzero pattern. Usually this is called after having factored
     // with a different matrix (e.g., within an Interior Point Method).
+    //
+    // The communication pattern of the redistribution of the matrix into the
+    // fronts is formed during initialization and reused, so that only the
+    // new values are redistributed.
     void ChangeNonzeroValues( const DistSparseMatrix<Field>& ANew );
 
+    // Stream the dense factors of the (local) fronts to disk during
+    // subsequent factorizations (see ldl::OutOfCoreCtrl).
+    void SetOutOfCoreCtrl( const ldl::OutOfCoreCtrl& ctrl );
+
+    // Compress the local fronts during subsequent factorizations so that
+    // the result is only suitable as a preconditioner
+    // (see ldl::CompressionCtrl).
+    void SetCompressionCtrl( const ldl::CompressionCtrl& ctrl );
+
+    // Statically perturb the failed pivots of intra-pivoted local fronts
+    // during subsequent factorizations (see ldl::StaticPivotCtrl).
+    void SetStaticPivotCtrl( const ldl::StaticPivotCtrl& ctrl );
+
     // Factor the initialized multifrontal tree.
     void Factor( LDLFrontType frontType=LDL_2D );
 
+    // Equivalent to ChangeNonzeroValues followed by Factor.
+    void Refactor
+    ( const DistSparseMatrix<Field>& ANew, LDLFrontType frontType=LDL_2D );
+
     // Change the storage format of the multifrontal tree. This can be called
     // either before or after factorization.
     void ChangeFrontType( LDLFrontType frontType );
@@ -594,6 +811,13 @@ public:
     void Solve( ldl::DistMultiVecNode<Field>& B ) const;
     void Solve( ldl::DistMatrixNode<Field>& B ) const;
 
+    // Overwrite 'B' with the solution to 'A X = B' by solving against
+    // 'batchSize' columns at a time. The nodal layout of the right-hand sides
+    // and the metadata for their redistribution are kept between batches
+    // (and calls), so that many right-hand sides arriving in batches only
+    // pay for forming them once per factorization.
+    void SolveBatched( DistMultiVec<Field>& B, Int batchSize=128 ) const;
+
     // Overwrite 'B' with the solution to 'A X = B' using Iterative Refinement.
     void SolveWithIterativeRefinement
     ( const DistSparseMatrix<Field>& A,
@@ -640,6 +864,8 @@ public:
     Int NumLocalEntries() const;
     Int NumTopLeftLocalEntries() const;
     Int NumBottomLeftLocalEntries() const;
+    // The number of statically perturbed pivots of the local subtree
+    Int NumLocalStaticPivots() const;
     double LocalFactorGFlops( bool selInv=false ) const;
     double LocalSolveGFlops( Int numRHS=1 ) const;
 
@@ -664,17 +890,37 @@ private:
     bool initialized_=false;
     bool factored_=false;
     unique_ptr<ldl::DistFront<Field>> front_;
+    // The store must be destroyed before the fronts it references
+    ldl::OutOfCoreCtrl outOfCoreCtrl_;
+    unique_ptr<ldl::FrontStore<Field>> store_;
+    ldl::CompressionCtrl compressionCtrl_;
+    ldl::StaticPivotCtrl staticPivotCtrl_;
     unique_ptr<ldl::DistNodeInfo> info_;
     unique_ptr<ldl::DistSeparator> separator_;
 
     DistMap map_, inverseMap_;
 
     // Metadata for repeated calls to DistFront<Field>::Pull
-    mutable bool formedPullMetadata_=false;
-    mutable vector<Int> mappedSources_, mappedTargets_, columnOffsets_;
+    ldl::DistFrontPullPattern pullPattern_;
 
-    // Metadata for future use.
+    // Metadata for repeated redistributions of right-hand sides into and out
+    // of the nodal layout.
     mutable ldl::DistMultiVecNodeMeta dmvMeta_;
+
+    // The resident nodal layouts of the right-hand sides. Since the nodes
+    // (and the communication metadata of the solves stored within them) are
+    // only rebuilt when the number of right-hand sides changes, repeated
+    // solves avoid the redundant allocations and metadata computations.
+    mutable unique_ptr<ldl::DistMultiVecNode<Field>> multiVecNode_;
+    mutable unique_ptr<ldl::DistMatrixNode<Field>> matrixNode_;
+
+    // Redistribute the right-hand sides into (and out of) the resident nodes
+    ldl::DistMultiVecNode<Field>&
+    PullMultiVecNode( const DistMultiVec<Field>& B ) const;
+    ldl::DistMatrixNode<Field>&
+    PullMatrixNode( const DistMultiVec<Field>& B ) const;
+    void PushMultiVecNode( DistMultiVec<Field>& B ) const;
+    void PushMatrixNode( DistMultiVec<Field>& B ) const;
 };
 
 } // namespace El
@@ -30,6 +30,37 @@ namespace ldl {
 Int Analysis( NodeInfo& rootInfo, Int myOff=0 );
 void Analysis( DistNodeInfo& rootInfo, bool storeFactRecvInds=true );
 
+// Relaxed supernode amalgamation: each node of the local elimination tree
+// absorbs its trailing child (whose indices immediately precede its own) as
+// long as at most 'tol' of the entries of the merged front are explicit
+// zeros. A node is never left without children, as childless fronts are
+// factored as sparse leaves. Only the sequential subtrees are modified, and
+// the symbolic analysis should be rerun afterwards.
+void Amalgamate( Separator& rootSep, NodeInfo& rootInfo, double tol );
+void Amalgamate( DistSeparator& rootSep, DistNodeInfo& rootInfo, double tol );
+
+// Statistics of the fronts of an analyzed elimination tree
+struct FrontStats
+{
+    Int numFronts=0;
+    Int numAmalgamated=0;
+    Int minSize=0, maxSize=0;
+
+    // The number of entries in the lower trapezoids of the factors (including
+    // any explicit zeros introduced by amalgamation)
+    double numEntries=0;
+    double numExplicitZeros=0;
+
+    // The number of fronts with a size in [2^k,2^(k+1)) is stored in entry k
+    // (empty fronts are counted in the first entry)
+    vector<Int> sizeHistogram;
+};
+
+FrontStats ComputeFrontStats( const NodeInfo& rootInfo );
+// Only the fronts shared by this process are counted (each distributed front
+// is counted by every process in its team)
+FrontStats ComputeFrontStats( const DistNodeInfo& rootInfo );
+
 void AMDOrder
 ( const vector<Int>& subOffsets,
   const vector<Int>& subTargets,
@@ -37,6 +68,39 @@ void AMDOrder
         double* control=nullptr,
         double* info=nullptr );
 
+// The supervariables (sets of vertices with identical closed neighborhoods)
+// of a graph: the (ascending) members of supervariable s are
+// members[offsets[s]:offsets[s+1]]. In the distributed case, each process
+// only merges the vertices it owns, stores the members of its own
+// supervariables, and numbers them starting from processOffsets[rank]
+// (the last entry of processOffsets is the total number of supervariables).
+struct Supervariables
+{
+    vector<Int> offsets;
+    vector<Int> members;
+    vector<Int> processOffsets;
+};
+
+// Form the quotient graph of the supervariables and return its size
+Int CompressSupervariables
+( const Graph& graph, Graph& compressed, Supervariables& supers );
+Int CompressSupervariables
+( const DistGraph& graph, DistGraph& compressed, Supervariables& supers );
+
+// Expand a separator tree of the compressed graph into one of the original
+// graph, keeping the members of each supervariable contiguous, and recompute
+// the symbolic factorizations of the leaves
+void ExpandSupervariables
+( const Graph& graph,
+  const Supervariables& supers,
+        Separator& rootSep,
+        NodeInfo& rootInfo );
+void ExpandSupervariables
+( const DistGraph& graph,
+  const Supervariables& supers,
+        DistSeparator& rootSep,
+        DistNodeInfo& rootInfo );
+
 void NestedDissection
 ( const Graph& graph,
         vector<Int>& map,
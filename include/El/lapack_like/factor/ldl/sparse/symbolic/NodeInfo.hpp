@@ -56,6 +56,13 @@ struct NodeInfo
     vector<Int> LOffsets;
     vector<Int> LParents;
 
+    // Known after amalgamation
+    // ------------------------
+    // The number of nodes merged into this one and the number of explicit
+    // zeros thereby introduced into the lower trapezoid of its front
+    Int numAmalgamated=0;
+    Int numExplicitZeros=0;
+
     NodeInfo( NodeInfo* parentNode=nullptr );
     NodeInfo( DistNodeInfo* duplicateNode );
     ~NodeInfo();
@@ -23,6 +23,20 @@ enum SignScaling {
 }
 using namespace SignScalingNS;
 
+namespace SignAlgorithmNS {
+enum SignAlgorithm {
+    // Scaled Newton iteration, which explicitly inverts each iterate
+    SIGN_NEWTON,
+    // Scaled Newton until || I - X^2 ||_1 <= hybridTol, followed by the
+    // inverse-free (Gemm-only) Newton-Schulz iteration
+    SIGN_NEWTON_SCHULZ,
+    // Dynamically weighted Halley (QDWH-style) iteration, which requires one
+    // LU solve per iteration and typically converges in at most six
+    SIGN_QDWH
+};
+}
+using namespace SignAlgorithmNS;
+
 template<typename Real>
 struct SignCtrl
 {
@@ -30,6 +44,8 @@ struct SignCtrl
     Real tol=Real(0);
     Real power=Real(1);
     SignScaling scaling=SIGN_SCALE_FROB;
+    SignAlgorithm algorithm=SIGN_NEWTON;
+    Real hybridTol=Real(1)/Real(2);
     bool progress=false;
 };
 
@@ -62,6 +78,52 @@ void HermitianFunction
 ( UpperOrLower uplo, AbstractDistMatrix<Complex<Real>>& A,
   function<Complex<Real>(const Real&)> func );
 
+// Hermitian function times vectors
+// ================================
+// Overwrite X with f(A) B for a sparse Hermitian matrix A (with both triangles
+// explicitly stored) using an independent Lanczos recurrence for each column
+// of B, where every step applies A to all of the active columns at once.
+//
+// Rather than storing the Krylov bases, a first pass only retains the
+// tridiagonal projections, T_k, and stops once the coefficients
+// ||b|| f(T_k) e_0 have stagnated, and a second pass regenerates the Lanczos
+// vectors from the stored recurrence (without any reductions) in order to
+// accumulate X. The storage is thus a few multi-vectors the size of B.
+
+template<typename Real>
+struct HermitianFunctionTimesVectorsCtrl
+{
+    // The maximum number of Lanczos steps per column, after which the
+    // current approximation is accepted
+    Int maxIts=500;
+
+    // A column has converged once the relative change in its approximation
+    // since the last check is at most tol (zero selects eps^(3/4))
+    Real tol=Real(0);
+
+    // The number of Lanczos steps between convergence checks
+    Int checkInterval=5;
+
+    bool progress=false;
+};
+
+template<typename Field>
+void HermitianFunctionTimesVectors
+( const SparseMatrix<Field>& A,
+  function<Base<Field>(const Base<Field>&)> func,
+  const Matrix<Field>& B,
+        Matrix<Field>& X,
+  const HermitianFunctionTimesVectorsCtrl<Base<Field>>& ctrl=
+        HermitianFunctionTimesVectorsCtrl<Base<Field>>() );
+template<typename Field>
+void HermitianFunctionTimesVectors
+( const DistSparseMatrix<Field>& A,
+  function<Base<Field>(const Base<Field>&)> func,
+  const DistMultiVec<Field>& B,
+        DistMultiVec<Field>& X,
+  const HermitianFunctionTimesVectorsCtrl<Base<Field>>& ctrl=
+        HermitianFunctionTimesVectorsCtrl<Base<Field>>() );
+
 // Inverse
 // =======
 template<typename Field>
@@ -81,6 +143,12 @@ void AfterLUPartialPiv
   const DistPermutation& P );
 } // namespace inverse
 
+// The HPD and triangular inversions overwrite [MC,MR] (and [STAR,STAR])
+// matrices in place with workspace limited to panels of O(n nb / sqrt(p))
+// entries per process, whereas matrices in other distributions are first
+// redistributed into an [MC,MR] copy. The peak
+// workspace can be measured with the 'liveBytes' and 'peakBytes' members of
+// GetMemoryStats().
 template<typename Field>
 void HPDInverse( UpperOrLower uplo, Matrix<Field>& A );
 template<typename Field>
@@ -131,6 +199,40 @@ void Pseudoinverse( Matrix<Field>& A, Base<Field> tolerance=0 );
 template<typename Field>
 void Pseudoinverse( AbstractDistMatrix<Field>& A, Base<Field> tolerance=0 );
 
+namespace PseudoinverseApproachNS {
+enum PseudoinverseApproach
+{
+  // A compact SVD, A = U Sigma V^H, truncated below the tolerance relative
+  // to the largest singular value
+  PSEUDOINVERSE_SVD,
+  // A complete orthogonal decomposition, A Omega^T = Q [L, 0; 0, 0] Z,
+  // formed from a column-pivoted QR factorization (truncated once the
+  // remaining column norms fall below the tolerance relative to the
+  // largest original column norm) and an LQ factorization of the leading
+  // rows of its R factor. It is several times cheaper than the SVD and
+  // reveals the rank in practice, though, unlike the SVD, not for every
+  // (e.g., Kahan-like) matrix.
+  PSEUDOINVERSE_COMPLETE_ORTHOGONAL
+};
+}
+using namespace PseudoinverseApproachNS;
+
+template<typename Real>
+struct PseudoinverseCtrl
+{
+    PseudoinverseApproach approach=PSEUDOINVERSE_COMPLETE_ORTHOGONAL;
+    // The relative tolerance for the numerical rank; zero selects max(m,n) eps
+    Real tol=Real(0);
+};
+
+// Overwrite A with its pseudoinverse and return the numerical rank of A
+template<typename Field>
+Int Pseudoinverse
+( Matrix<Field>& A, const PseudoinverseCtrl<Base<Field>>& ctrl );
+template<typename Field>
+Int Pseudoinverse
+( AbstractDistMatrix<Field>& A, const PseudoinverseCtrl<Base<Field>>& ctrl );
+
 template<typename Field>
 void HermitianPseudoinverse
 ( UpperOrLower uplo, Matrix<Field>& A, Base<Field> tolerance=0 );
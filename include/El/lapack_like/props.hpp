@@ -43,6 +43,70 @@ Base<F> TwoCondition( const Matrix<F>& A );
 template<typename F>
 Base<F> TwoCondition( const AbstractDistMatrix<F>& A );
 
+// Condition number estimates
+// --------------------------
+// Estimates which avoid forming the inverse: ||inv(A)||_1 is estimated with
+// the block 1-norm estimator of Higham and Tisseur (a generalization of
+// Hager's method) and ||inv(A)||_2 with a randomized subspace iteration. The
+// solves make use of an LU factorization of dense matrices and a sparse LDL
+// factorization of sparse matrices, which must therefore be Hermitian or,
+// if 'hermitian' is false, complex-symmetric.
+template<typename Real>
+struct ConditionEstimateCtrl
+{
+    // The number of columns iterated by both estimators
+    Int blockSize=2;
+
+    // The maximum number of iterations of the 1-norm estimator (which
+    // typically converges within two or three)
+    Int oneNormMaxIts=5;
+
+    // The maximum number of subspace iterations and the relative change in
+    // the estimate of ||inv(A)||_2 below which they stop
+    Int twoNormMaxIts=50;
+    Real twoNormTol=Real(1)/Real(100);
+
+    // The Lanczos basis size for the estimate of ||A||_2 of sparse matrices
+    Int basisSize=15;
+
+    bool hermitian=true;
+    BisectCtrl bisectCtrl;
+
+    bool progress=false;
+};
+
+template<typename F>
+Base<F> OneConditionEstimate
+( const Matrix<F>& A,
+  const ConditionEstimateCtrl<Base<F>>& ctrl=
+        ConditionEstimateCtrl<Base<F>>() );
+template<typename F>
+Base<F> OneConditionEstimate
+( const AbstractDistMatrix<F>& A,
+  const ConditionEstimateCtrl<Base<F>>& ctrl=
+        ConditionEstimateCtrl<Base<F>>() );
+template<typename F>
+Base<F> OneConditionEstimate
+( const SparseMatrix<F>& A,
+  const ConditionEstimateCtrl<Base<F>>& ctrl=
+        ConditionEstimateCtrl<Base<F>>() );
+template<typename F>
+Base<F> OneConditionEstimate
+( const DistSparseMatrix<F>& A,
+  const ConditionEstimateCtrl<Base<F>>& ctrl=
+        ConditionEstimateCtrl<Base<F>>() );
+
+template<typename F>
+Base<F> TwoConditionEstimate
+( const SparseMatrix<F>& A,
+  const ConditionEstimateCtrl<Base<F>>& ctrl=
+        ConditionEstimateCtrl<Base<F>>() );
+template<typename F>
+Base<F> TwoConditionEstimate
+( const DistSparseMatrix<F>& A,
+  const ConditionEstimateCtrl<Base<F>>& ctrl=
+        ConditionEstimateCtrl<Base<F>>() );
+
 // Determinant
 // ===========
 template<typename F>
@@ -122,6 +186,15 @@ InertiaType Inertia
 ( UpperOrLower uplo, AbstractDistMatrix<F>& A,
   const LDLPivotCtrl<Base<F>>& ctrl=LDLPivotCtrl<Base<F>>() );
 
+// The inertia of a sparse Hermitian matrix (with both triangles explicitly
+// stored) is computed from an unpivoted sparse LDL^H factorization
+template<typename F>
+InertiaType Inertia
+( const SparseMatrix<F>& A, const BisectCtrl& ctrl=BisectCtrl() );
+template<typename F>
+InertiaType Inertia
+( const DistSparseMatrix<F>& A, const BisectCtrl& ctrl=BisectCtrl() );
+
 // Norm
 // ====
 template<typename F>
@@ -462,6 +535,66 @@ T Trace( const Matrix<T>& A );
 template<typename T>
 T Trace( const AbstractDistMatrix<T>& A );
 
+// Stochastic trace estimation
+// ===========================
+// Hutchinson estimates of tr(f(A)) for Hermitian A, averaging z^H f(A) z over
+// Rademacher probes z, where each quadratic form is approximated by Lanczos
+// (Gauss) quadrature. Unlike SafeHPDDeterminant, only products with A are
+// required.
+template<typename Real>
+struct TraceEstimateCtrl
+{
+    // The probes are drawn (and their Lanczos recurrences advanced) in
+    // blocks of 'blockSize' columns, up to a total of 'maxProbes'
+    Int blockSize=10;
+    Int maxProbes=100;
+
+    // Once the standard error of the sample mean falls below 'relTol' times
+    // its magnitude, no further probes are drawn
+    Real relTol=Real(1)/Real(1000);
+
+    // The recurrence of each probe is stopped after 'maxSteps' steps, or
+    // when its quadrature, which is checked every 'checkInterval' steps,
+    // changes by less than 'quadTol' (which defaults to sqrt(eps)) relative
+    // to its magnitude
+    Int maxSteps=100;
+    Int checkInterval=5;
+    Real quadTol=0;
+
+    bool progress=false;
+};
+
+template<typename F>
+Base<F> HermitianTraceEstimate
+( const SparseMatrix<F>& A,
+  function<Base<F>(const Base<F>&)> func,
+  const TraceEstimateCtrl<Base<F>>& ctrl=TraceEstimateCtrl<Base<F>>() );
+template<typename F>
+Base<F> HermitianTraceEstimate
+( const DistSparseMatrix<F>& A,
+  function<Base<F>(const Base<F>&)> func,
+  const TraceEstimateCtrl<Base<F>>& ctrl=TraceEstimateCtrl<Base<F>>() );
+
+// Estimates of log(det(A)) = tr(log(A)) for HPD A
+template<typename F>
+Base<F> HPDLogDetEstimate
+( const SparseMatrix<F>& A,
+  const TraceEstimateCtrl<Base<F>>& ctrl=TraceEstimateCtrl<Base<F>>() );
+template<typename F>
+Base<F> HPDLogDetEstimate
+( const DistSparseMatrix<F>& A,
+  const TraceEstimateCtrl<Base<F>>& ctrl=TraceEstimateCtrl<Base<F>>() );
+
+// Estimates of tr(inv(A)) for HPD A
+template<typename F>
+Base<F> HPDInverseTraceEstimate
+( const SparseMatrix<F>& A,
+  const TraceEstimateCtrl<Base<F>>& ctrl=TraceEstimateCtrl<Base<F>>() );
+template<typename F>
+Base<F> HPDInverseTraceEstimate
+( const DistSparseMatrix<F>& A,
+  const TraceEstimateCtrl<Base<F>>& ctrl=TraceEstimateCtrl<Base<F>>() );
+
 } // namespace El
 
 #endif // ifndef EL_PROPS_HPP
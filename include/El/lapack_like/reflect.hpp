@@ -31,6 +31,37 @@ void ApplyPackedReflectors
   const AbstractDistMatrix<F>& householderScalars, 
         AbstractDistMatrix<F>& A );
 
+// The Hermitian Gram matrices, H_k' H_k, of each 'blocksize'-wide panel H_k
+// of unit-diagonal, lower, vertical packed reflectors. Along with the
+// Householder scalars on their diagonals, their lower (upper) triangles form
+// the triangular factors of the compact-WY representations of the panels
+// used for forward (backward) applications, from either side and with either
+// conjugation, so that forming them once, e.g., after a QR factorization,
+// avoids their recomputation within each application. An empty CompactWY
+// (with a zero blocksize) requests the usual on-the-fly formation.
+template<typename F>
+struct CompactWY
+{
+    Int offset=0;
+    Int blocksize=0;
+    vector<Matrix<F>> panelGrams;
+};
+
+template<typename F>
+void FormCompactWY( Int offset, const Matrix<F>& H, CompactWY<F>& wy );
+
+// Only lower, vertical packed reflectors may be given a nonempty CompactWY
+template<typename F>
+void ApplyPackedReflectors
+( LeftOrRight side, UpperOrLower uplo,
+  VerticalOrHorizontal dir, ForwardOrBackward order,
+  Conjugation conjugation,
+  Int offset,
+  const Matrix<F>& H,
+  const Matrix<F>& householderScalars,
+  const CompactWY<F>& wy,
+        Matrix<F>& A );
+
 // ExpandPackedReflectors
 // ======================
 template<typename F>
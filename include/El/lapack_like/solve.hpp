@@ -14,6 +14,25 @@
 
 namespace El {
 
+// Control structure for the dense solvers which factor in the lower precision
+// Demote<Field> (e.g., single-precision for double-precision systems) and then
+// iteratively refine the solution with residuals formed in the working
+// precision. This is only appropriate when the condition number is well
+// below the inverse of the lower precision's epsilon.
+template<typename Real>
+struct MixedPrecisionCtrl
+{
+    // The tolerance on the maximum residual relative to the maximum entry of
+    // the right-hand sides
+    Real relTol;
+    Int maxRefineIts=20;
+    bool progress=false;
+
+    MixedPrecisionCtrl()
+    : relTol(Pow(limits::Epsilon<Real>(),Real(0.8)))
+    { }
+};
+
 // Linear
 // ======
 template<typename Field>
@@ -26,6 +45,19 @@ void LinearSolve
         AbstractDistMatrix<Field>& B,
   bool scalapack=false );
 
+// Factor with partial pivoting in the lower precision and return the number
+// of refinement iterations
+template<typename Field>
+Int LinearSolve
+( const Matrix<Field>& A,
+        Matrix<Field>& B,
+  const MixedPrecisionCtrl<Base<Field>>& ctrl );
+template<typename Field>
+Int LinearSolve
+( const AbstractDistMatrix<Field>& A,
+        AbstractDistMatrix<Field>& B,
+  const MixedPrecisionCtrl<Base<Field>>& ctrl );
+
 template<typename Field>
 void LinearSolve
 ( const SparseMatrix<Field>& A,
@@ -37,6 +69,23 @@ void LinearSolve
         DistMultiVec<Field>& B,
   const LeastSquaresCtrl<Base<Field>>& ctrl=LeastSquaresCtrl<Base<Field>>() );
 
+// Band matrices are factored with partial pivoting, while the distributed
+// variant uses the SPIKE algorithm, which pivots only within the diagonal
+// block of each process (which must therefore be nonsingular)
+template<typename Field>
+void LinearSolve( const BandMatrix<Field>& A, Matrix<Field>& B );
+template<typename Field>
+void LinearSolve( const DistBandMatrix<Field>& A, DistMultiVec<Field>& B );
+
+// Solve a tridiagonal system, with the given sub-diagonal, diagonal, and
+// super-diagonal, using Gaussian elimination with partial pivoting
+template<typename Field>
+void TridiagonalSolve
+( const Matrix<Field>& dSub,
+  const Matrix<Field>& d,
+  const Matrix<Field>& dSup,
+        Matrix<Field>& B );
+
 namespace lin_solve {
 
 template<typename Field>
@@ -199,6 +248,23 @@ void HPDSolve
   const AbstractDistMatrix<Field>& A,
         AbstractDistMatrix<Field>& B );
 
+// Factor with Cholesky in the lower precision and return the number of
+// refinement iterations
+template<typename Field>
+Int HPDSolve
+( UpperOrLower uplo,
+  Orientation orientation,
+  const Matrix<Field>& A,
+        Matrix<Field>& B,
+  const MixedPrecisionCtrl<Base<Field>>& ctrl );
+template<typename Field>
+Int HPDSolve
+( UpperOrLower uplo,
+  Orientation orientation,
+  const AbstractDistMatrix<Field>& A,
+        AbstractDistMatrix<Field>& B,
+  const MixedPrecisionCtrl<Base<Field>>& ctrl );
+
 template<typename Field>
 void HPDSolve
 ( const SparseMatrix<Field>& A,
@@ -210,6 +276,18 @@ void HPDSolve
         DistMultiVec<Field>& B,
   const BisectCtrl& ctrl=BisectCtrl() );
 
+// Only the given triangle of a sequential band matrix is accessed, but the
+// distributed variant accesses both triangles of its band in order to couple
+// the (Cholesky-factored) diagonal blocks of the processes
+template<typename Field>
+void HPDSolve
+( UpperOrLower uplo,
+  Orientation orientation,
+  const BandMatrix<Field>& A,
+        Matrix<Field>& B );
+template<typename Field>
+void HPDSolve( const DistBandMatrix<Field>& A, DistMultiVec<Field>& B );
+
 namespace hpd_solve {
 
 template<typename Field>
@@ -246,10 +324,55 @@ void MultiShiftHessSolve
   const AbstractDistMatrix<Field>& shifts,
         AbstractDistMatrix<Field>& X );
 
+// Krylov
+// ======
+// Solve (Hermitian) sparse systems with a Krylov method preconditioned by
+// an existing sparse LDL factorization, which may be of a cheaper
+// approximation of A (e.g., with dropped entries or extra regularization)
+// so that it requires less memory than an exact direct solve.
+enum KrylovAlg
+{
+  KRYLOV_CG,     // Requires A and the preconditioner to be HPD
+  KRYLOV_MINRES, // Requires only the preconditioner to be HPD
+  KRYLOV_FGMRES
+};
+
+template<typename Real>
+struct KrylovCtrl
+{
+    KrylovAlg alg=KRYLOV_CG;
+    Real relTol;
+    Int maxIts=500;
+    // Only used by FGMRES
+    Int restart=30;
+    bool progress=false;
+
+    KrylovCtrl() : relTol(Pow(limits::Epsilon<Real>(),Real(0.5))) { }
+};
+
+// Returns the maximum number of iterations over the right-hand sides
+template<typename Field>
+Int KrylovSolve
+( const SparseMatrix<Field>& A,
+  const SparseLDLFactorization<Field>& precondFact,
+        Matrix<Field>& B,
+  const KrylovCtrl<Base<Field>>& ctrl=KrylovCtrl<Base<Field>>() );
+template<typename Field>
+Int KrylovSolve
+( const DistSparseMatrix<Field>& A,
+  const DistSparseLDLFactorization<Field>& precondFact,
+        DistMultiVec<Field>& B,
+  const KrylovCtrl<Base<Field>>& ctrl=KrylovCtrl<Base<Field>>() );
+
 } // namespace El
 
+#include <El/lapack_like/solve/CG.hpp>
+#include <El/lapack_like/solve/MINRES.hpp>
 #include <El/lapack_like/solve/FGMRES.hpp>
 #include <El/lapack_like/solve/LGMRES.hpp>
 #include <El/lapack_like/solve/Refined.hpp>
+#include <El/lapack_like/solve/Kronecker.hpp>
+#include <El/lapack_like/solve/Structured.hpp>
+#include <El/lapack_like/solve/HODLR.hpp>
 
 #endif // ifndef EL_SOLVE_HPP
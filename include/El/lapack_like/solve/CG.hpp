@@ -0,0 +1,278 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_SOLVE_CG_HPP
+#define EL_SOLVE_CG_HPP
+
+// The distributed variant is the single-reduction reformulation of
+// preconditioned Conjugate Gradients from
+//   A.T. Chronopoulos and C.W. Gear,
+//   "s-step iterative methods for symmetric linear systems",
+//   J. Comput. Appl. Math., Vol. 25, No. 2, pp. 153--168, 1989,
+// where all of the inner products of an iteration are combined into a single
+// allreduce.
+
+namespace El {
+
+namespace cg {
+
+// In what follows, 'applyA' should be a function of the form
+//
+//   void applyA
+//   ( Field alpha, const Matrix<Field>& x, Field beta, Matrix<Field>& y )
+//
+// and overwrite y := alpha A x + beta y, where A is Hermitian positive-
+// definite. However, 'precond' should have the form
+//
+//   void precond( Matrix<Field>& b )
+//
+// and overwrite b with an approximation of inv(A) b, where the
+// approximation must also be Hermitian positive-definite.
+//
+
+template<typename Field,class ApplyAType,class PrecondType>
+Int Single
+( const ApplyAType& applyA,
+  const PrecondType& precond,
+        Matrix<Field>& b,
+        Base<Field> relTol,
+        Int maxIts,
+        bool progress )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( b.Width() != 1 )
+          LogicError("Expected a single right-hand side");
+    )
+    typedef Base<Field> Real;
+    const Int n = b.Height();
+
+    const Real origResidNorm = Nrm2( b );
+    if( progress )
+        Output("origResidNorm: ",origResidNorm);
+    if( origResidNorm == Real(0) )
+        return 0;
+
+    // x := 0, r := b, p := z := inv(M) r
+    // ==================================
+    Matrix<Field> x, r, z, p, w;
+    Zeros( x, n, 1 );
+    Zeros( w, n, 1 );
+    r = b;
+    z = r;
+    precond( z );
+    p = z;
+    Field rz = Dot( r, z );
+
+    Int iter=0;
+    while( true )
+    {
+        // w := A p
+        // ========
+        applyA( Field(1), p, Field(0), w );
+
+        // x := x + alpha p, r := r - alpha w
+        // ==================================
+        const Field pw = Dot( p, w );
+        if( pw == Field(0) )
+            RuntimeError("CG broke down with p' A p = 0");
+        const Field alpha = rz / pw;
+        Axpy( alpha, p, x );
+        Axpy( -alpha, w, r );
+        ++iter;
+
+        const Real residNorm = Nrm2( r );
+        if( !limits::IsFinite(residNorm) )
+            RuntimeError("Residual norm was not finite");
+        const Real relResidNorm = residNorm/origResidNorm;
+        if( progress )
+            Output
+            ("finished iteration ",iter," with relResidNorm=",relResidNorm);
+        if( relResidNorm < relTol )
+            break;
+        if( iter == maxIts )
+            RuntimeError("CG did not converge");
+
+        // p := z + beta p, with z := inv(M) r
+        // ===================================
+        z = r;
+        precond( z );
+        const Field rzNew = Dot( r, z );
+        const Field beta = rzNew / rz;
+        rz = rzNew;
+        p *= beta;
+        p += z;
+    }
+    b = x;
+    return iter;
+}
+
+} // namespace cg
+
+template<typename Field,class ApplyAType,class PrecondType>
+Int CG
+( const ApplyAType& applyA,
+  const PrecondType& precond,
+        Matrix<Field>& B,
+        Base<Field> relTol,
+        Int maxIts,
+        bool progress )
+{
+    EL_DEBUG_CSE
+    Int mostIts = 0;
+    const Int width = B.Width();
+    for( Int j=0; j<width; ++j )
+    {
+        auto b = B( ALL, IR(j) );
+        const Int its =
+          cg::Single( applyA, precond, b, relTol, maxIts, progress );
+        mostIts = Max(mostIts,its);
+    }
+    return mostIts;
+}
+
+namespace cg {
+
+template<typename Field,class ApplyAType,class PrecondType>
+Int Single
+( const ApplyAType& applyA,
+  const PrecondType& precond,
+        DistMultiVec<Field>& b,
+        Base<Field> relTol,
+        Int maxIts,
+        bool progress )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( b.Width() != 1 )
+          LogicError("Expected a single right-hand side");
+    )
+    typedef Base<Field> Real;
+    const Int n = b.Height();
+    const Grid& grid = b.Grid();
+    const int commRank = grid.Rank();
+
+    const Real origResidNorm = Nrm2( b );
+    if( progress && commRank == 0 )
+        Output("origResidNorm: ",origResidNorm);
+    if( origResidNorm == Real(0) )
+        return 0;
+
+    // x := 0, r := b, u := inv(M) r, w := A u
+    // =======================================
+    DistMultiVec<Field> x(grid), r(grid), u(grid), w(grid), p(grid), s(grid);
+    Zeros( x, n, 1 );
+    Zeros( p, n, 1 );
+    Zeros( s, n, 1 );
+    Zeros( w, n, 1 );
+    r = b;
+    u = r;
+    precond( u );
+    applyA( Field(1), u, Field(0), w );
+    auto& xLoc = x.Matrix();
+    auto& rLoc = r.Matrix();
+    auto& pLoc = p.Matrix();
+    auto& sLoc = s.Matrix();
+
+    // [gamma; delta; rho] := [r' u; w' u; r' r] with a single reduction
+    auto reduceDots = [&]( Field* dots )
+    {
+        dots[0] = Dot( r.LockedMatrix(), u.LockedMatrix() );
+        dots[1] = Dot( w.LockedMatrix(), u.LockedMatrix() );
+        dots[2] = Dot( r.LockedMatrix(), r.LockedMatrix() );
+        mpi::AllReduce( dots, 3, grid.Comm() );
+    };
+    Field dots[3];
+    reduceDots( dots );
+
+    Int iter=0;
+    Field gammaOld=1, alphaOld=1;
+    while( true )
+    {
+        const Field gamma = dots[0];
+        const Field delta = dots[1];
+        const Field beta = ( iter == 0 ? Field(0) : gamma/gammaOld );
+        const Field denom =
+          ( iter == 0 ? delta : delta - beta*gamma/alphaOld );
+        if( denom == Field(0) )
+            RuntimeError("CG broke down with p' A p = 0");
+        const Field alpha = gamma / denom;
+
+        // p := u + beta p, s := w + beta s
+        // ================================
+        pLoc *= beta;
+        pLoc += u.LockedMatrix();
+        sLoc *= beta;
+        sLoc += w.LockedMatrix();
+
+        // x := x + alpha p, r := r - alpha s
+        // ==================================
+        Axpy( alpha, pLoc, xLoc );
+        Axpy( -alpha, sLoc, rLoc );
+        ++iter;
+
+        // u := inv(M) r, w := A u
+        // =======================
+        u = r;
+        precond( u );
+        applyA( Field(1), u, Field(0), w );
+        reduceDots( dots );
+
+        const Real residNorm = Sqrt( Abs(dots[2]) );
+        if( !limits::IsFinite(residNorm) )
+            RuntimeError("Residual norm was not finite");
+        const Real relResidNorm = residNorm/origResidNorm;
+        if( progress && commRank == 0 )
+            Output
+            ("finished iteration ",iter," with relResidNorm=",relResidNorm);
+        if( relResidNorm < relTol )
+            break;
+        if( iter == maxIts )
+            RuntimeError("CG did not converge");
+        gammaOld = gamma;
+        alphaOld = alpha;
+    }
+    b = x;
+    return iter;
+}
+
+} // namespace cg
+
+template<typename Field,class ApplyAType,class PrecondType>
+Int CG
+( const ApplyAType& applyA,
+  const PrecondType& precond,
+        DistMultiVec<Field>& B,
+        Base<Field> relTol,
+        Int maxIts,
+        bool progress )
+{
+    EL_DEBUG_CSE
+    const Int height = B.Height();
+    const Int width = B.Width();
+
+    Int mostIts = 0;
+    DistMultiVec<Field> u(B.Grid());
+    Zeros( u, height, 1 );
+    auto& BLoc = B.Matrix();
+    auto& uLoc = u.Matrix();
+    for( Int j=0; j<width; ++j )
+    {
+        auto bLoc = BLoc( ALL, IR(j) );
+        uLoc = bLoc;
+        const Int its =
+          cg::Single( applyA, precond, u, relTol, maxIts, progress );
+        bLoc = uLoc;
+        mostIts = Max(mostIts,its);
+    }
+    return mostIts;
+}
+
+} // namespace El
+
+#endif // ifndef EL_SOLVE_CG_HPP
@@ -0,0 +1,436 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_SOLVE_HODLR_HPP
+#define EL_SOLVE_HODLR_HPP
+
+namespace El {
+
+// A Hierarchically Off-Diagonal Low-Rank (HODLR) approximation of a square
+// matrix, such as the kernel matrices produced by UniformHelmholtzGreens and
+// Cauchy. The index range is recursively bisected until the diagonal blocks
+// are at most leafSize x leafSize, which are stored densely, and each
+// off-diagonal block of a bisection,
+//
+//   A = | A11 A12 |,
+//       | A21 A22 |
+//
+// is replaced by an interpolative decomposition A12 ~= U12 R12, where U12 is
+// a subset of the columns of A12 (see ID and SketchedID). Since the
+// off-diagonal blocks are only low rank when the indices are ordered so that
+// contiguous ranges are geometrically clustered, points should be sorted
+// (e.g., recursively by coordinate or along a space-filling curve) before
+// their kernel matrix is compressed.
+//
+// With off-diagonal ranks of at most k, multiplication requires
+// O(k n log n) work, and the factorization applies the Sherman-Morrison-
+// Woodbury formula to
+//
+//   A = blkdiag(A11,A22) + blkdiag(U12,U21) | 0   R12 |,
+//                                            | R21 0   |
+//
+// recursively, so that it requires O(k^2 n log^2 n) work and each
+// subsequent solve requires O(k n log^2 n) work.
+
+template<typename Real>
+struct HODLRCtrl
+{
+    // The maximum dimension of the dense diagonal blocks
+    Int leafSize=64;
+
+    // The relative tolerance of the interpolative decompositions
+    Real tol=Pow(limits::Epsilon<Real>(),Real(0.5));
+
+    // The maximum rank of each off-diagonal block (unbounded if nonpositive)
+    Int maxRank=0;
+
+    // Choose the skeleton columns from randomized sketches of the blocks
+    // (which requires a positive maxRank)
+    bool sketch=false;
+    RangeFinderCtrl sketchCtrl;
+};
+
+template<typename Field>
+class HODLRMatrix
+{
+public:
+    typedef Base<Field> Real;
+
+    HODLRMatrix() { }
+    HODLRMatrix
+    ( const Matrix<Field>& A,
+      const HODLRCtrl<Real>& ctrl=HODLRCtrl<Real>() )
+    { Compress( A, ctrl ); }
+    HODLRMatrix
+    ( Int n, const function<Field(Int,Int)>& entry,
+      const HODLRCtrl<Real>& ctrl=HODLRCtrl<Real>() )
+    { Compress( n, entry, ctrl ); }
+
+    // Compress an explicit (square) matrix
+    void Compress
+    ( const Matrix<Field>& A,
+      const HODLRCtrl<Real>& ctrl=HODLRCtrl<Real>() );
+    // Compress the n x n matrix whose (i,j) entry is entry(i,j), which is
+    // only evaluated over the diagonal leaves and off-diagonal blocks
+    void Compress
+    ( Int n, const function<Field(Int,Int)>& entry,
+      const HODLRCtrl<Real>& ctrl=HODLRCtrl<Real>() );
+
+    Int Height() const EL_NO_EXCEPT { return n_; }
+    Int Width() const EL_NO_EXCEPT { return n_; }
+    // The maximum rank over the off-diagonal blocks
+    Int MaxRank() const EL_NO_EXCEPT;
+    // The number of entries stored by the compressed representation
+    Int NumEntries() const EL_NO_EXCEPT;
+
+    // Y := alpha op(A) X + beta Y
+    void Multiply
+    ( Orientation orientation,
+      Field alpha, const Matrix<Field>& X,
+      Field beta,        Matrix<Field>& Y ) const;
+    void operator()
+    ( Field alpha, const Matrix<Field>& X,
+      Field beta,        Matrix<Field>& Y ) const
+    { Multiply( NORMAL, alpha, X, beta, Y ); }
+
+    // Form the recursive Sherman-Morrison-Woodbury factorization
+    void Factor();
+    bool Factored() const EL_NO_EXCEPT { return factored_; }
+
+    // X := inv(A) X
+    void SolveAfter( Matrix<Field>& X ) const;
+
+private:
+    // Each internal node is bisected into the consecutive nodes child and
+    // child+1, whose indices are larger than that of their parent
+    struct Node
+    {
+        Int offset, size;
+        Int child=-1;
+
+        // The dense diagonal block of a leaf and its LU factorization
+        Matrix<Field> D, DLU;
+        Permutation P;
+
+        // The off-diagonal blocks A12 ~= U12 R12 and A21 ~= U21 R21
+        Matrix<Field> U12, R12, U21, R21;
+
+        // inv(A11) U12, inv(A22) U21, and the LU factorization of the
+        // capacitance matrix [I, R12 inv(A22) U21; R21 inv(A11) U12, I]
+        Matrix<Field> W12, W21, KLU;
+        Permutation PK;
+    };
+
+    Int n_=0;
+    vector<Node> nodes_;
+    bool factored_=false;
+
+    void CompressBlock
+    ( const Matrix<Field>& B,
+      Matrix<Field>& U, Matrix<Field>& R,
+      const HODLRCtrl<Real>& ctrl ) const;
+
+    // Overwrite the node's rows of X with inv(A_node) X
+    void SolveNode( Int index, Matrix<Field>& X ) const;
+};
+
+template<typename Field>
+void HODLRMatrix<Field>::Compress
+( const Matrix<Field>& A, const HODLRCtrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    if( A.Height() != A.Width() )
+        LogicError("Only square matrices have HODLR approximations");
+    Compress
+    ( A.Height(), [&]( Int i, Int j ) { return A(i,j); }, ctrl );
+}
+
+template<typename Field>
+void HODLRMatrix<Field>::CompressBlock
+( const Matrix<Field>& B,
+  Matrix<Field>& U, Matrix<Field>& R,
+  const HODLRCtrl<Real>& ctrl ) const
+{
+    EL_DEBUG_CSE
+    const Int m = B.Height();
+    const Int n = B.Width();
+    QRCtrl<Real> qrCtrl;
+    qrCtrl.adaptive = true;
+    qrCtrl.tol = ctrl.tol;
+    if( ctrl.maxRank > 0 )
+    {
+        qrCtrl.boundRank = true;
+        qrCtrl.maxRank = Min( ctrl.maxRank, Min(m,n) );
+    }
+    Permutation P;
+    Matrix<Field> Z;
+    if( ctrl.sketch )
+        SketchedID( B, P, Z, qrCtrl, ctrl.sketchCtrl );
+    else
+        ID( B, P, Z, qrCtrl );
+
+    // B P ~= B P(:,0:k) [I, Z], so that B ~= U [I, Z] P^T
+    const Int k = Z.Height();
+    Matrix<Field> BPerm( B );
+    P.PermuteCols( BPerm );
+    U = BPerm( ALL, IR(0,k) );
+    Zeros( R, k, n );
+    auto RL = R( ALL, IR(0,k) );
+    auto RR = R( ALL, IR(k,n) );
+    FillDiagonal( RL, Field(1) );
+    RR = Z;
+    P.InversePermuteCols( R );
+}
+
+template<typename Field>
+void HODLRMatrix<Field>::Compress
+( Int n, const function<Field(Int,Int)>& entry,
+  const HODLRCtrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    if( ctrl.leafSize < 1 )
+        LogicError("The leaf size must be positive");
+    if( ctrl.sketch && ctrl.maxRank <= 0 )
+        LogicError("Sketched compression requires a positive maxRank");
+    n_ = n;
+    factored_ = false;
+    nodes_.clear();
+    nodes_.emplace_back();
+    nodes_[0].offset = 0;
+    nodes_[0].size = n;
+
+    auto block =
+      [&]( Int iOff, Int jOff, Int m, Int nB, Matrix<Field>& B )
+      {
+          B.Resize( m, nB );
+          for( Int j=0; j<nB; ++j )
+              for( Int i=0; i<m; ++i )
+                  B(i,j) = entry( iOff+i, jOff+j );
+      };
+
+    // The children are appended as they are created, so the nodes are
+    // processed in breadth-first order
+    Matrix<Field> B;
+    for( Int index=0; index<Int(nodes_.size()); ++index )
+    {
+        const Int offset = nodes_[index].offset;
+        const Int size = nodes_[index].size;
+        if( size <= ctrl.leafSize )
+        {
+            block( offset, offset, size, size, nodes_[index].D );
+            continue;
+        }
+
+        const Int n1 = size/2;
+        const Int n2 = size - n1;
+        const Int child = nodes_.size();
+        nodes_.emplace_back();
+        nodes_.emplace_back();
+        nodes_[child].offset = offset;
+        nodes_[child].size = n1;
+        nodes_[child+1].offset = offset + n1;
+        nodes_[child+1].size = n2;
+
+        Node& node = nodes_[index];
+        node.child = child;
+        block( offset, offset+n1, n1, n2, B );
+        CompressBlock( B, node.U12, node.R12, ctrl );
+        block( offset+n1, offset, n2, n1, B );
+        CompressBlock( B, node.U21, node.R21, ctrl );
+    }
+}
+
+template<typename Field>
+Int HODLRMatrix<Field>::MaxRank() const EL_NO_EXCEPT
+{
+    Int maxRank = 0;
+    for( const auto& node : nodes_ )
+        maxRank = Max( maxRank, Max(node.U12.Width(),node.U21.Width()) );
+    return maxRank;
+}
+
+template<typename Field>
+Int HODLRMatrix<Field>::NumEntries() const EL_NO_EXCEPT
+{
+    Int numEntries = 0;
+    for( const auto& node : nodes_ )
+        numEntries += node.D.Height()*node.D.Width() +
+          node.U12.Height()*node.U12.Width() +
+          node.R12.Height()*node.R12.Width() +
+          node.U21.Height()*node.U21.Width() +
+          node.R21.Height()*node.R21.Width();
+    return numEntries;
+}
+
+template<typename Field>
+void HODLRMatrix<Field>::Multiply
+( Orientation orientation,
+  Field alpha, const Matrix<Field>& X,
+  Field beta,        Matrix<Field>& Y ) const
+{
+    EL_DEBUG_CSE
+    const Int numRHS = X.Width();
+    if( X.Height() != n_ )
+        LogicError
+        ("X was ",X.Height()," x ",numRHS," but A was ",n_," x ",n_);
+    if( Y.Height() != n_ || Y.Width() != numRHS )
+        LogicError
+        ("Y was ",Y.Height()," x ",Y.Width()," but should have been ",
+         n_," x ",numRHS);
+    if( beta == Field(0) )
+        Zero( Y );
+    else
+        Scale( beta, Y );
+
+    // Every node contributes independently: the leaves through their
+    // diagonal blocks and the internal nodes through their off-diagonal
+    // blocks, where op(A12) ~= op(R12) op(U12) maps the second half of X to
+    // the first half of Y (and vice versa)
+    const bool normal = ( orientation == NORMAL );
+    Matrix<Field> T;
+    for( const auto& node : nodes_ )
+    {
+        if( node.child < 0 )
+        {
+            const IR ind( node.offset, node.offset+node.size );
+            auto YLeaf = Y( ind, ALL );
+            Gemm
+            ( orientation, NORMAL, alpha, node.D, X(ind,ALL),
+              Field(1), YLeaf );
+            continue;
+        }
+        const Int n1 = nodes_[node.child].size;
+        const IR ind1( node.offset, node.offset+n1 );
+        const IR ind2( node.offset+n1, node.offset+node.size );
+        auto X1 = X( ind1, ALL );
+        auto X2 = X( ind2, ALL );
+        auto Y1 = Y( ind1, ALL );
+        auto Y2 = Y( ind2, ALL );
+        if( node.U12.Width() > 0 )
+        {
+            if( normal )
+            {
+                Gemm( NORMAL, NORMAL, Field(1), node.R12, X2, T );
+                Gemm( NORMAL, NORMAL, alpha, node.U12, T, Field(1), Y1 );
+            }
+            else
+            {
+                Gemm( orientation, NORMAL, Field(1), node.U12, X1, T );
+                Gemm( orientation, NORMAL, alpha, node.R12, T, Field(1), Y2 );
+            }
+        }
+        if( node.U21.Width() > 0 )
+        {
+            if( normal )
+            {
+                Gemm( NORMAL, NORMAL, Field(1), node.R21, X1, T );
+                Gemm( NORMAL, NORMAL, alpha, node.U21, T, Field(1), Y2 );
+            }
+            else
+            {
+                Gemm( orientation, NORMAL, Field(1), node.U21, X2, T );
+                Gemm( orientation, NORMAL, alpha, node.R21, T, Field(1), Y1 );
+            }
+        }
+    }
+}
+
+template<typename Field>
+void HODLRMatrix<Field>::SolveNode( Int index, Matrix<Field>& X ) const
+{
+    EL_DEBUG_CSE
+    const Node& node = nodes_[index];
+    if( node.child < 0 )
+    {
+        lu::SolveAfter( NORMAL, node.DLU, node.P, X );
+        return;
+    }
+
+    // X := inv(blkdiag(A11,A22)) X
+    const Int n1 = nodes_[node.child].size;
+    const Int k12 = node.U12.Width();
+    const Int k21 = node.U21.Width();
+    auto X1 = X( IR(0,n1), ALL );
+    auto X2 = X( IR(n1,END), ALL );
+    SolveNode( node.child, X1 );
+    SolveNode( node.child+1, X2 );
+    if( k12+k21 == 0 )
+        return;
+
+    // X := X - blkdiag(W12,W21) inv(K) [R12 X2; R21 X1]
+    Matrix<Field> T;
+    Zeros( T, k12+k21, X.Width() );
+    auto T1 = T( IR(0,k12), ALL );
+    auto T2 = T( IR(k12,END), ALL );
+    if( k12 > 0 )
+        Gemm( NORMAL, NORMAL, Field(1), node.R12, X2, Field(0), T1 );
+    if( k21 > 0 )
+        Gemm( NORMAL, NORMAL, Field(1), node.R21, X1, Field(0), T2 );
+    lu::SolveAfter( NORMAL, node.KLU, node.PK, T );
+    if( k12 > 0 )
+        Gemm( NORMAL, NORMAL, Field(-1), node.W12, T1, Field(1), X1 );
+    if( k21 > 0 )
+        Gemm( NORMAL, NORMAL, Field(-1), node.W21, T2, Field(1), X2 );
+}
+
+template<typename Field>
+void HODLRMatrix<Field>::Factor()
+{
+    EL_DEBUG_CSE
+    // Since the children follow their parents, a reverse traversal ensures
+    // that the subtrees of each node have been factored before it
+    for( Int index=nodes_.size()-1; index>=0; --index )
+    {
+        Node& node = nodes_[index];
+        if( node.child < 0 )
+        {
+            node.DLU = node.D;
+            LU( node.DLU, node.P );
+            continue;
+        }
+
+        const Int k12 = node.U12.Width();
+        const Int k21 = node.U21.Width();
+        node.W12 = node.U12;
+        node.W21 = node.U21;
+        if( k12 > 0 )
+            SolveNode( node.child, node.W12 );
+        if( k21 > 0 )
+            SolveNode( node.child+1, node.W21 );
+
+        Identity( node.KLU, k12+k21, k12+k21 );
+        if( k12 > 0 && k21 > 0 )
+        {
+            auto K12 = node.KLU( IR(0,k12), IR(k12,END) );
+            auto K21 = node.KLU( IR(k12,END), IR(0,k12) );
+            Gemm
+            ( NORMAL, NORMAL, Field(1), node.R12, node.W21, Field(0), K12 );
+            Gemm
+            ( NORMAL, NORMAL, Field(1), node.R21, node.W12, Field(0), K21 );
+        }
+        LU( node.KLU, node.PK );
+    }
+    factored_ = true;
+}
+
+template<typename Field>
+void HODLRMatrix<Field>::SolveAfter( Matrix<Field>& X ) const
+{
+    EL_DEBUG_CSE
+    if( !factored_ )
+        LogicError("Factor must be called before SolveAfter");
+    if( X.Height() != n_ )
+        LogicError
+        ("X had height ",X.Height()," but A was ",n_," x ",n_);
+    if( n_ > 0 )
+        SolveNode( 0, X );
+}
+
+} // namespace El
+
+#endif // ifndef EL_SOLVE_HODLR_HPP
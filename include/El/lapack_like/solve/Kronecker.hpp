@@ -0,0 +1,150 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_SOLVE_KRONECKER_HPP
+#define EL_SOLVE_KRONECKER_HPP
+
+namespace El {
+
+// An implicit representation of K = A (x) B which never forms the
+// (mA mB) x (nA nB) product. Since
+//
+//   (A (x) B) vec(X) = vec(B X A^T)
+//
+// for column-major vectorization, each column of a right-hand side is
+// viewed (without copying) as an nB x nA matrix so that multiplication only
+// requires two Gemm's with the factors, and, since
+// inv(A (x) B) = inv(A) (x) inv(B), solves only require factorizations of
+// the factors. The same holds for op(A (x) B) = op(A) (x) op(B).
+template<typename Field>
+class KroneckerOperator
+{
+public:
+    KroneckerOperator() { }
+    KroneckerOperator( const Matrix<Field>& A, const Matrix<Field>& B )
+    { Set( A, B ); }
+
+    void Set( const Matrix<Field>& A, const Matrix<Field>& B )
+    {
+        EL_DEBUG_CSE
+        A_ = A;
+        B_ = B;
+        factored_ = false;
+    }
+
+    Int Height() const EL_NO_EXCEPT { return A_.Height()*B_.Height(); }
+    Int Width() const EL_NO_EXCEPT { return A_.Width()*B_.Width(); }
+    const Matrix<Field>& LockedA() const EL_NO_EXCEPT { return A_; }
+    const Matrix<Field>& LockedB() const EL_NO_EXCEPT { return B_; }
+
+    // Y := alpha op(A (x) B) X + beta Y
+    void Multiply
+    ( Orientation orientation,
+      Field alpha, const Matrix<Field>& X,
+      Field beta,        Matrix<Field>& Y ) const;
+
+    // Form partially-pivoted LU factorizations of the (square) factors
+    void Factor();
+    bool Factored() const EL_NO_EXCEPT { return factored_; }
+
+    // X := inv(op(A (x) B)) X
+    void SolveAfter( Orientation orientation, Matrix<Field>& X ) const;
+
+private:
+    Matrix<Field> A_, B_;
+
+    bool factored_=false;
+    Matrix<Field> ALU_, BLU_;
+    Permutation PA_, PB_;
+};
+
+template<typename Field>
+void KroneckerOperator<Field>::Multiply
+( Orientation orientation,
+  Field alpha, const Matrix<Field>& X,
+  Field beta,        Matrix<Field>& Y ) const
+{
+    EL_DEBUG_CSE
+    const bool normal = ( orientation == NORMAL );
+    const Int mA = ( normal ? A_.Height() : A_.Width() );
+    const Int nA = ( normal ? A_.Width() : A_.Height() );
+    const Int mB = ( normal ? B_.Height() : B_.Width() );
+    const Int nB = ( normal ? B_.Width() : B_.Height() );
+    const Int numRHS = X.Width();
+    if( X.Height() != nA*nB )
+        LogicError
+        ("X was ",X.Height()," x ",numRHS," but op(A (x) B) was ",
+         mA*mB," x ",nA*nB);
+    if( Y.Height() != mA*mB || Y.Width() != numRHS )
+        LogicError
+        ("Y was ",Y.Height()," x ",Y.Width()," but should have been ",
+         mA*mB," x ",numRHS);
+
+    // Y_j := alpha op(B) X_j op(A)^T + beta Y_j, where op(A)^T = conj(A)
+    // when op(A) = A^H
+    Matrix<Field> AConj;
+    if( orientation == ADJOINT )
+        Conjugate( A_, AConj );
+    const Matrix<Field>& ARight = ( orientation == ADJOINT ? AConj : A_ );
+    const Orientation rightOrient = ( normal ? TRANSPOSE : NORMAL );
+
+    Matrix<Field> Xj, Yj, Z;
+    for( Int j=0; j<numRHS; ++j )
+    {
+        auto xj = X( ALL, IR(j) );
+        auto yj = Y( ALL, IR(j) );
+        LockedReshapedView( nB, nA, xj, Xj );
+        ReshapedView( mB, mA, yj, Yj );
+        Gemm( orientation, NORMAL, Field(1), B_, Xj, Z );
+        Gemm( NORMAL, rightOrient, alpha, Z, ARight, beta, Yj );
+    }
+}
+
+template<typename Field>
+void KroneckerOperator<Field>::Factor()
+{
+    EL_DEBUG_CSE
+    if( A_.Height() != A_.Width() || B_.Height() != B_.Width() )
+        LogicError("Only Kronecker products of square matrices are factored");
+    ALU_ = A_;
+    BLU_ = B_;
+    LU( ALU_, PA_ );
+    LU( BLU_, PB_ );
+    factored_ = true;
+}
+
+template<typename Field>
+void KroneckerOperator<Field>::SolveAfter
+( Orientation orientation, Matrix<Field>& X ) const
+{
+    EL_DEBUG_CSE
+    if( !factored_ )
+        LogicError("Factor must be called before SolveAfter");
+    const Int nA = A_.Height();
+    const Int nB = B_.Height();
+    if( X.Height() != nA*nB )
+        LogicError
+        ("X had height ",X.Height()," but A (x) B was ",nA*nB," x ",nA*nB);
+
+    // X_j := inv(op(B)) X_j inv(op(A))^T = inv(op(B)) (inv(op(A)) X_j^T)^T
+    const Int numRHS = X.Width();
+    Matrix<Field> Xj, XjTrans;
+    for( Int j=0; j<numRHS; ++j )
+    {
+        auto xj = X( ALL, IR(j) );
+        ReshapedView( nB, nA, xj, Xj );
+        lu::SolveAfter( orientation, BLU_, PB_, Xj );
+        Transpose( Xj, XjTrans );
+        lu::SolveAfter( orientation, ALU_, PA_, XjTrans );
+        Transpose( XjTrans, Xj );
+    }
+}
+
+} // namespace El
+
+#endif // ifndef EL_SOLVE_KRONECKER_HPP
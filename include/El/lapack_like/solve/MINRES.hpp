@@ -0,0 +1,245 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_SOLVE_MINRES_HPP
+#define EL_SOLVE_MINRES_HPP
+
+// The preconditioned MINRES iteration follows
+//   C.C. Paige and M.A. Saunders,
+//   "Solution of sparse indefinite systems of linear equations",
+//   SIAM J. Numer. Anal., Vol. 12, No. 4, pp. 617--629, 1975,
+// where the (Hermitian) system may be indefinite but the preconditioner must
+// be Hermitian positive-definite. Convergence is measured through the
+// recurrence for the residual norm in the inv(M) inner product.
+
+namespace El {
+
+namespace minres {
+
+// In what follows, 'applyA' should be a function of the form
+//
+//   void applyA
+//   ( Field alpha, const Matrix<Field>& x, Field beta, Matrix<Field>& y )
+//
+// and overwrite y := alpha A x + beta y, where A is Hermitian. However,
+// 'precond' should have the form
+//
+//   void precond( Matrix<Field>& b )
+//
+// and overwrite b with inv(M) b for a Hermitian positive-definite M.
+//
+// 'dot' should return the (global) inner product of two vectors, which
+// allows the same recurrence to drive both the sequential and distributed
+// variants.
+
+template<typename Field,class VectorType,class ApplyAType,class PrecondType,
+         class DotType>
+Int Recurrence
+( const ApplyAType& applyA,
+  const PrecondType& precond,
+  const DotType& dot,
+        VectorType& b,
+        VectorType& x,
+        Base<Field> relTol,
+        Int maxIts,
+        bool progress,
+        bool printRank )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Int n = b.Height();
+
+    // r1 := b, y := inv(M) r1, beta1 := sqrt(r1' y)
+    // =============================================
+    VectorType r1(b), r2(b), y(b), v(b), w(b), w1(b), w2(b);
+    Zeros( x, n, 1 );
+    Zeros( w, n, 1 );
+    Zeros( w2, n, 1 );
+    precond( y );
+    const Real beta1Sq = RealPart(dot( r1, y ));
+    if( beta1Sq < Real(0) )
+        LogicError("The MINRES preconditioner was not positive-definite");
+    const Real beta1 = Sqrt( beta1Sq );
+    if( progress && printRank )
+        Output("origResidNorm: ",beta1);
+    if( beta1 == Real(0) )
+        return 0;
+
+    Real beta=beta1, oldBeta=0, epsilon=0, deltaBar=0, phiBar=beta1;
+    Real c=-1, s=0;
+    Int iter=0;
+    while( true )
+    {
+        // Run a step of the preconditioned Lanczos process
+        // ================================================
+        v = y;
+        v *= 1/beta;
+        applyA( Field(1), v, Field(0), y );
+        if( iter > 0 )
+            Axpy( -beta/oldBeta, r1, y );
+        const Real alpha = RealPart(dot( v, y ));
+        Axpy( -alpha/beta, r2, y );
+        r1 = r2;
+        r2 = y;
+        precond( y );
+        oldBeta = beta;
+        const Real betaSq = RealPart(dot( r2, y ));
+        if( betaSq < Real(0) )
+            LogicError("The MINRES preconditioner was not positive-definite");
+        beta = Sqrt( betaSq );
+
+        // Apply the previous rotation and generate the next one
+        // =====================================================
+        const Real oldEpsilon = epsilon;
+        const Real delta = c*deltaBar + s*alpha;
+        const Real gammaBar = s*deltaBar - c*alpha;
+        epsilon = s*beta;
+        deltaBar = -c*beta;
+        const Real gamma = SafeNorm( gammaBar, beta );
+        if( gamma == Real(0) )
+            RuntimeError("MINRES broke down");
+        c = gammaBar / gamma;
+        s = beta / gamma;
+        const Real phi = c*phiBar;
+        phiBar = s*phiBar;
+
+        // w := (v - epsilon w1 - delta w2) / gamma, x := x + phi w
+        // ========================================================
+        w1 = w2;
+        w2 = w;
+        w = v;
+        Axpy( -oldEpsilon, w1, w );
+        Axpy( -delta, w2, w );
+        w *= 1/gamma;
+        Axpy( phi, w, x );
+        ++iter;
+
+        if( !limits::IsFinite(phiBar) )
+            RuntimeError("Residual norm was not finite");
+        const Real relResidNorm = phiBar/beta1;
+        if( progress && printRank )
+            Output
+            ("finished iteration ",iter," with relResidNorm=",relResidNorm);
+        if( relResidNorm < relTol || beta == Real(0) )
+            break;
+        if( iter == maxIts )
+            RuntimeError("MINRES did not converge");
+    }
+    return iter;
+}
+
+template<typename Field,class ApplyAType,class PrecondType>
+Int Single
+( const ApplyAType& applyA,
+  const PrecondType& precond,
+        Matrix<Field>& b,
+        Base<Field> relTol,
+        Int maxIts,
+        bool progress )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( b.Width() != 1 )
+          LogicError("Expected a single right-hand side");
+    )
+    auto dot =
+      []( const Matrix<Field>& u, const Matrix<Field>& v )
+      { return Dot( u, v ); };
+    Matrix<Field> x;
+    const Int iter =
+      Recurrence<Field>
+      ( applyA, precond, dot, b, x, relTol, maxIts, progress, true );
+    if( iter > 0 )
+        b = x;
+    return iter;
+}
+
+template<typename Field,class ApplyAType,class PrecondType>
+Int Single
+( const ApplyAType& applyA,
+  const PrecondType& precond,
+        DistMultiVec<Field>& b,
+        Base<Field> relTol,
+        Int maxIts,
+        bool progress )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( b.Width() != 1 )
+          LogicError("Expected a single right-hand side");
+    )
+    auto dot =
+      []( const DistMultiVec<Field>& u, const DistMultiVec<Field>& v )
+      { return Dot( u, v ); };
+    DistMultiVec<Field> x(b.Grid());
+    const Int iter =
+      Recurrence<Field>
+      ( applyA, precond, dot, b, x, relTol, maxIts, progress,
+        b.Grid().Rank() == 0 );
+    if( iter > 0 )
+        b = x;
+    return iter;
+}
+
+} // namespace minres
+
+template<typename Field,class ApplyAType,class PrecondType>
+Int MINRES
+( const ApplyAType& applyA,
+  const PrecondType& precond,
+        Matrix<Field>& B,
+        Base<Field> relTol,
+        Int maxIts,
+        bool progress )
+{
+    EL_DEBUG_CSE
+    Int mostIts = 0;
+    const Int width = B.Width();
+    for( Int j=0; j<width; ++j )
+    {
+        auto b = B( ALL, IR(j) );
+        const Int its =
+          minres::Single( applyA, precond, b, relTol, maxIts, progress );
+        mostIts = Max(mostIts,its);
+    }
+    return mostIts;
+}
+
+template<typename Field,class ApplyAType,class PrecondType>
+Int MINRES
+( const ApplyAType& applyA,
+  const PrecondType& precond,
+        DistMultiVec<Field>& B,
+        Base<Field> relTol,
+        Int maxIts,
+        bool progress )
+{
+    EL_DEBUG_CSE
+    const Int height = B.Height();
+    const Int width = B.Width();
+
+    Int mostIts = 0;
+    DistMultiVec<Field> u(B.Grid());
+    Zeros( u, height, 1 );
+    auto& BLoc = B.Matrix();
+    auto& uLoc = u.Matrix();
+    for( Int j=0; j<width; ++j )
+    {
+        auto bLoc = BLoc( ALL, IR(j) );
+        uLoc = bLoc;
+        const Int its =
+          minres::Single( applyA, precond, u, relTol, maxIts, progress );
+        bLoc = uLoc;
+        mostIts = Max(mostIts,its);
+    }
+    return mostIts;
+}
+
+} // namespace El
+
+#endif // ifndef EL_SOLVE_MINRES_HPP
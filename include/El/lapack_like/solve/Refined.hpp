@@ -371,6 +371,78 @@ Int RefinedSolve
 
 namespace refined_solve {
 
+// Refine all of the columns of B at once until the maximum residual, relative
+// to the maximum entry of the right-hand sides, is at most relTol or no longer
+// decreases. Unlike the above, B may be either a Matrix or a DistMatrix.
+template<class MatrixType,class ApplyAType,class ApplyAInvType,typename Real>
+Int Joint
+( const ApplyAType& applyA,
+  const ApplyAInvType& applyAInv,
+        MatrixType& B,
+        Real relTol,
+        Int maxRefineIts,
+        bool progress )
+{
+    EL_DEBUG_CSE
+    const Real bNorm = MaxNorm( B );
+    if( maxRefineIts <= 0 || bNorm == Real(0) )
+    {
+        applyAInv( B );
+        return 0;
+    }
+
+    // Compute the initial guess
+    // =========================
+    MatrixType BOrig( B ), X( B );
+    applyAInv( X );
+
+    MatrixType dX( B ), XCand( B ), Y( B );
+    applyA( X, Y );
+    B -= Y;
+    Real errorNorm = MaxNorm( B );
+    if( progress )
+        Output("original rel error: ",errorNorm/bNorm);
+
+    Int refineIt = 0;
+    while( true )
+    {
+        if( errorNorm/bNorm <= relTol )
+        {
+            if( progress )
+                Output(errorNorm/bNorm," <= ",relTol);
+            break;
+        }
+
+        // Compute the proposed update to the solution
+        // -------------------------------------------
+        dX = B;
+        applyAInv( dX );
+        XCand = X;
+        XCand += dX;
+
+        // Check the new residual
+        // ----------------------
+        applyA( XCand, Y );
+        B = BOrig;
+        B -= Y;
+        const Real newErrorNorm = MaxNorm( B );
+        if( progress )
+            Output("refined rel error: ",newErrorNorm/bNorm);
+
+        if( newErrorNorm < errorNorm )
+            X = XCand;
+        else
+            break;
+
+        errorNorm = newErrorNorm;
+        ++refineIt;
+        if( refineIt >= maxRefineIts )
+            break;
+    }
+    B = X;
+    return refineIt;
+}
+
 template<typename Field,class ApplyAType,class ApplyAInvType>
 Int PromotedSingle
 ( const ApplyAType& applyA,
@@ -0,0 +1,705 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_SOLVE_STRUCTURED_HPP
+#define EL_SOLVE_STRUCTURED_HPP
+
+namespace El {
+
+// Implicit representations of circulant, Toeplitz, Hankel, Fourier, and
+// Walsh matrices which are applied in O(n log n) work via fast transforms
+// rather than by forming the dense matrices of
+// src/matrices/deterministic/classical and multiplying in O(n^2) work:
+//
+//  * a circulant matrix is diagonalized by the discrete Fourier transform,
+//  * an m x n Toeplitz matrix is the leading block of a circulant matrix of
+//    (power-of-two) size L >= m+n-1,
+//  * a Hankel matrix is a Toeplitz matrix with its columns reversed,
+//  * a Fourier matrix is applied with a single FFT, and
+//  * a Walsh matrix is applied with the fast Walsh-Hadamard transform.
+//
+// As for KroneckerOperator, 'Multiply' overwrites Y := alpha op(A) X + beta Y
+// (where Y is resized if beta = 0), and 'operator()' applies A itself so
+// that an operator can be passed directly as the 'applyA' argument of the
+// Krylov-subspace solvers (e.g., MINRES and FGMRES).
+//
+// Square Toeplitz (and Hankel) operators are factored with the Levinson
+// recursion [1], which requires all of the leading principal submatrices to
+// be nonsingular, in O(n^2) work. The resulting first and last columns of
+// the inverse determine it via the Gohberg-Semencul formula [2],
+//
+//   x_0 inv(T) = L(x) U(J y) - L(Z y) U(Z J x),
+//
+// where x = inv(T) e_0, y = inv(T) e_{n-1}, L(u) (U(u)) is the lower
+// (upper) triangular Toeplitz matrix with first column (row) u, J is the
+// reversal permutation, and Z is the down-shift, so that each subsequent
+// solve only requires FFT-based products.
+//
+// [1] Norman Levinson, "The Wiener RMS error criterion in filter design and
+//     prediction", Journal of Mathematics and Physics, Vol. 25, 1947.
+//
+// [2] Israel Gohberg and Alexander Semencul, "On the inversion of finite
+//     Toeplitz matrices and their continuous analogs", Matem. Issled.,
+//     Vol. 7, No. 2, 1972.
+//
+
+namespace fft {
+
+// Overwrite the n = 2^k entries of x with their (unnormalized) discrete
+// Fourier transform, x_k := sum_j x_j exp(-+2 pi i j k / n), where the sign
+// is positive for the inverse transform
+template<typename Real>
+void Radix2( Complex<Real>* x, Int n, bool inverse )
+{
+    EL_DEBUG_CSE
+    for( Int i=1, j=0; i<n; ++i )
+    {
+        Int bit = n >> 1;
+        for( ; j & bit; bit >>= 1 )
+            j ^= bit;
+        j ^= bit;
+        if( i < j )
+            std::swap( x[i], x[j] );
+    }
+
+    const Real pi = 4*Atan( Real(1) );
+    const Real sign = ( inverse ? Real(1) : Real(-1) );
+    vector<Complex<Real>> twiddles(n/2);
+    for( Int k=0; k<n/2; ++k )
+    {
+        const Real theta = sign*2*pi*Real(k)/Real(n);
+        twiddles[k] = Complex<Real>( Cos(theta), Sin(theta) );
+    }
+    for( Int length=2; length<=n; length<<=1 )
+    {
+        const Int half = length/2;
+        const Int stride = n/length;
+        for( Int i=0; i<n; i+=length )
+        {
+            for( Int k=0; k<half; ++k )
+            {
+                const Complex<Real> u = x[i+k];
+                const Complex<Real> v = x[i+k+half]*twiddles[k*stride];
+                x[i+k] = u + v;
+                x[i+k+half] = u - v;
+            }
+        }
+    }
+}
+
+// Overwrite each column of X with its (unnormalized) discrete Fourier
+// transform, or its inverse, using Bluestein's chirp-z algorithm when the
+// height of X is not a power of two
+template<typename Real>
+void Transform( Matrix<Complex<Real>>& X, bool inverse=false )
+{
+    EL_DEBUG_CSE
+    const Int n = X.Height();
+    const Int numRHS = X.Width();
+    if( n <= 1 )
+        return;
+    if( (n & (n-1)) == 0 )
+    {
+        for( Int j=0; j<numRHS; ++j )
+            Radix2( X.Buffer(0,j), n, inverse );
+        return;
+    }
+
+    // With jk = (j^2 + k^2 - (k-j)^2)/2, the transform is a convolution with
+    // the chirp w_k = exp(-+pi i k^2 / n), which is computed with power-of-two
+    // transforms of length M >= 2n-1
+    Int M = 1;
+    while( M < 2*n-1 )
+        M *= 2;
+    const Real pi = 4*Atan( Real(1) );
+    const Real sign = ( inverse ? Real(1) : Real(-1) );
+    vector<Complex<Real>> chirp(n), chirpConv(M,Complex<Real>(0)), a(M);
+    for( Int k=0; k<n; ++k )
+    {
+        const Real theta = sign*pi*Real((k*k)%(2*n))/Real(n);
+        chirp[k] = Complex<Real>( Cos(theta), Sin(theta) );
+    }
+    chirpConv[0] = Conj(chirp[0]);
+    for( Int k=1; k<n; ++k )
+        chirpConv[k] = chirpConv[M-k] = Conj(chirp[k]);
+    Radix2( chirpConv.data(), M, false );
+    for( Int j=0; j<numRHS; ++j )
+    {
+        Complex<Real>* x = X.Buffer(0,j);
+        for( Int k=0; k<n; ++k )
+            a[k] = x[k]*chirp[k];
+        for( Int k=n; k<M; ++k )
+            a[k] = 0;
+        Radix2( a.data(), M, false );
+        for( Int k=0; k<M; ++k )
+            a[k] *= chirpConv[k];
+        Radix2( a.data(), M, true );
+        for( Int k=0; k<n; ++k )
+            x[k] = chirp[k]*a[k]/Real(M);
+    }
+}
+
+} // namespace fft
+
+namespace structured {
+
+template<typename Real>
+void Extract( const Complex<Real>& alpha, Real& beta )
+{ beta = RealPart(alpha); }
+template<typename T>
+void Extract( const T& alpha, T& beta ) { beta = alpha; }
+
+// Resize Y to be m x numRHS if beta = 0 and otherwise ensure that it is
+template<typename Field>
+void PrepareOutput( Int m, Int numRHS, Field beta, Matrix<Field>& Y )
+{
+    EL_DEBUG_CSE
+    if( beta == Field(0) )
+        Y.Resize( m, numRHS );
+    else if( Y.Height() != m || Y.Width() != numRHS )
+        LogicError
+        ("Y was ",Y.Height()," x ",Y.Width()," but should have been ",
+         m," x ",numRHS);
+}
+
+// Y := alpha Z(0:m,:) + beta Y, where the real part of Z is used if Y is real
+template<typename S,typename Field>
+void Update
+( Field alpha, const Matrix<S>& Z, Field beta, Matrix<Field>& Y )
+{
+    EL_DEBUG_CSE
+    const Int m = Y.Height();
+    const Int numRHS = Y.Width();
+    Field zeta;
+    for( Int j=0; j<numRHS; ++j )
+    {
+        for( Int i=0; i<m; ++i )
+        {
+            Extract( Z(i,j), zeta );
+            if( beta == Field(0) )
+                Y(i,j) = alpha*zeta;
+            else
+                Y(i,j) = alpha*zeta + beta*Y(i,j);
+        }
+    }
+}
+
+// Y := alpha op(C)(0:m,0:nX) X + beta Y (or, if 'invert' is true, with op(C)
+// replaced by inv(op(C))), where C is the L x L circulant matrix with
+// eigenvalues 'lambda' and X has nX rows. X and Y may be the same matrix.
+template<typename Field>
+void ApplyCirculant
+( Orientation orientation, const Matrix<Complex<Base<Field>>>& lambda,
+  bool invert, Int m,
+  Field alpha, const Matrix<Field>& X,
+  Field beta,        Matrix<Field>& Y )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Int L = lambda.Height();
+    const Int nX = X.Height();
+    const Int numRHS = X.Width();
+    Matrix<Complex<Real>> Z;
+    Zeros( Z, L, numRHS );
+    for( Int j=0; j<numRHS; ++j )
+        for( Int i=0; i<nX; ++i )
+            Z(i,j) = X(i,j);
+    fft::Transform( Z );
+    for( Int k=0; k<L; ++k )
+    {
+        Complex<Real> mu;
+        if( orientation == NORMAL )
+            mu = lambda(k);
+        else if( orientation == TRANSPOSE )
+            mu = lambda((L-k)%L);
+        else
+            mu = Conj(lambda(k));
+        if( invert )
+        {
+            if( mu == Complex<Real>(0) )
+                RuntimeError("Circulant matrix was singular");
+            mu = Complex<Real>(1)/mu;
+        }
+        for( Int j=0; j<numRHS; ++j )
+            Z(k,j) *= mu;
+    }
+    fft::Transform( Z, true );
+    PrepareOutput( m, numRHS, beta, Y );
+    Update( alpha/Field(L), Z, beta, Y );
+}
+
+// The eigenvalues of the smallest power-of-two circulant embedding of the
+// m x n Toeplitz matrix A(i,j) = a[i-j+(n-1)]
+template<typename Field>
+void ToeplitzSymbol
+( Int m, Int n, const vector<Field>& a, Matrix<Complex<Base<Field>>>& lambda )
+{
+    EL_DEBUG_CSE
+    if( m < 1 || n < 1 )
+        LogicError("Toeplitz operators must be nonempty");
+    if( a.size() != Unsigned(m+n-1) )
+        LogicError("a was the wrong size");
+    Int L = 1;
+    while( L < m+n-1 )
+        L *= 2;
+    Zeros( lambda, L, 1 );
+    for( Int k=0; k<m; ++k )
+        lambda(k) = a[k+n-1];
+    for( Int k=1; k<n; ++k )
+        lambda(L-k) = a[n-1-k];
+    fft::Transform( lambda );
+}
+
+// Overwrite X with J X
+template<typename Field>
+void ReverseRows( Matrix<Field>& X )
+{
+    EL_DEBUG_CSE
+    const Int m = X.Height();
+    for( Int j=0; j<X.Width(); ++j )
+        for( Int i=0; i<m/2; ++i )
+            std::swap( X(i,j), X(m-1-i,j) );
+}
+
+// Overwrite each column of X with its (unnormalized) Walsh-Hadamard transform
+template<typename Field>
+void WalshHadamard( Matrix<Field>& X )
+{
+    EL_DEBUG_CSE
+    const Int n = X.Height();
+    for( Int j=0; j<X.Width(); ++j )
+    {
+        Field* x = X.Buffer(0,j);
+        for( Int half=1; half<n; half*=2 )
+        {
+            for( Int i=0; i<n; i+=2*half )
+            {
+                for( Int k=i; k<i+half; ++k )
+                {
+                    const Field u = x[k];
+                    const Field v = x[k+half];
+                    x[k] = u + v;
+                    x[k+half] = u - v;
+                }
+            }
+        }
+    }
+}
+
+} // namespace structured
+
+// A(i,j) = a[(i-j) mod n]
+template<typename Field>
+class CirculantOperator
+{
+public:
+    CirculantOperator() { }
+    CirculantOperator( const vector<Field>& a ) { Set( a ); }
+
+    void Set( const vector<Field>& a )
+    {
+        EL_DEBUG_CSE
+        const Int n = a.size();
+        Zeros( lambda_, n, 1 );
+        for( Int k=0; k<n; ++k )
+            lambda_(k) = a[k];
+        fft::Transform( lambda_ );
+    }
+
+    Int Height() const EL_NO_EXCEPT { return lambda_.Height(); }
+    Int Width() const EL_NO_EXCEPT { return lambda_.Height(); }
+    const Matrix<Complex<Base<Field>>>& Eigenvalues() const EL_NO_EXCEPT
+    { return lambda_; }
+
+    // Y := alpha op(A) X + beta Y
+    void Multiply
+    ( Orientation orientation,
+      Field alpha, const Matrix<Field>& X,
+      Field beta,        Matrix<Field>& Y ) const
+    {
+        EL_DEBUG_CSE
+        if( X.Height() != Width() )
+            LogicError("X had height ",X.Height()," but A was ",Width());
+        structured::ApplyCirculant
+        ( orientation, lambda_, false, Height(), alpha, X, beta, Y );
+    }
+    void operator()
+    ( Field alpha, const Matrix<Field>& X,
+      Field beta,        Matrix<Field>& Y ) const
+    { Multiply( NORMAL, alpha, X, beta, Y ); }
+
+    // X := inv(op(A)) X
+    void SolveAfter( Orientation orientation, Matrix<Field>& X ) const
+    {
+        EL_DEBUG_CSE
+        if( X.Height() != Width() )
+            LogicError("X had height ",X.Height()," but A was ",Width());
+        structured::ApplyCirculant
+        ( orientation, lambda_, true, Height(), Field(1), X, Field(0), X );
+    }
+
+private:
+    Matrix<Complex<Base<Field>>> lambda_;
+};
+
+// The m x n matrix A(i,j) = a[i-j+(n-1)] (see Toeplitz)
+template<typename Field>
+class ToeplitzOperator
+{
+public:
+    ToeplitzOperator() { }
+    ToeplitzOperator( Int m, Int n, const vector<Field>& a )
+    { Set( m, n, a ); }
+
+    void Set( Int m, Int n, const vector<Field>& a )
+    {
+        EL_DEBUG_CSE
+        structured::ToeplitzSymbol( m, n, a, lambda_ );
+        m_ = m;
+        n_ = n;
+        a_ = a;
+        factored_ = false;
+    }
+
+    Int Height() const EL_NO_EXCEPT { return m_; }
+    Int Width() const EL_NO_EXCEPT { return n_; }
+
+    // Y := alpha op(A) X + beta Y
+    void Multiply
+    ( Orientation orientation,
+      Field alpha, const Matrix<Field>& X,
+      Field beta,        Matrix<Field>& Y ) const;
+    void operator()
+    ( Field alpha, const Matrix<Field>& X,
+      Field beta,        Matrix<Field>& Y ) const
+    { Multiply( NORMAL, alpha, X, beta, Y ); }
+
+    // Run the Levinson recursion on the (square) matrix and form the
+    // Gohberg-Semencul representation of its inverse
+    void Factor();
+    bool Factored() const EL_NO_EXCEPT { return factored_; }
+
+    // X := inv(op(A)) X
+    void SolveAfter( Orientation orientation, Matrix<Field>& X ) const;
+
+private:
+    Int m_=0, n_=0;
+    vector<Field> a_;
+    Matrix<Complex<Base<Field>>> lambda_;
+
+    // x_0 inv(A) = L(x) U(J y) - L(Z y) U(Z J x)
+    bool factored_=false;
+    Field x0_;
+    Matrix<Complex<Base<Field>>> lowerX_, upperJY_, lowerZY_, upperZJX_;
+};
+
+template<typename Field>
+void ToeplitzOperator<Field>::Multiply
+( Orientation orientation,
+  Field alpha, const Matrix<Field>& X,
+  Field beta,        Matrix<Field>& Y ) const
+{
+    EL_DEBUG_CSE
+    const Int mOp = ( orientation == NORMAL ? m_ : n_ );
+    const Int nOp = ( orientation == NORMAL ? n_ : m_ );
+    if( X.Height() != nOp )
+        LogicError
+        ("X had height ",X.Height()," but op(A) was ",mOp," x ",nOp);
+    structured::ApplyCirculant
+    ( orientation, lambda_, false, mOp, alpha, X, beta, Y );
+}
+
+template<typename Field>
+void ToeplitzOperator<Field>::Factor()
+{
+    EL_DEBUG_CSE
+    if( m_ != n_ )
+        LogicError("Only square Toeplitz matrices can be factored");
+    const Int n = n_;
+    auto t = [&]( Int k ) { return a_[k+n-1]; };
+    if( t(0) == Field(0) )
+        RuntimeError("Levinson recursion broke down at step 0");
+
+    // Maintain f = inv(T_k) e_0 and b = inv(T_k) e_{k-1} for the leading
+    // k x k submatrix T_k
+    vector<Field> f(1,Field(1)/t(0)), b(f), fNew, bNew;
+    for( Int k=1; k<n; ++k )
+    {
+        // T_{k+1} [f; 0] = [e_0; epsF] and T_{k+1} [0; b] = [epsB; e_{k-1}]
+        Field epsF=0, epsB=0;
+        for( Int j=0; j<k; ++j )
+        {
+            epsF += t(k-j)*f[j];
+            epsB += t(-(j+1))*b[j];
+        }
+        const Field denom = Field(1) - epsF*epsB;
+        if( denom == Field(0) )
+            RuntimeError("Levinson recursion broke down at step ",k);
+        fNew.resize( k+1 );
+        bNew.resize( k+1 );
+        for( Int j=0; j<=k; ++j )
+        {
+            const Field fj = ( j < k ? f[j] : Field(0) );
+            const Field bj = ( j > 0 ? b[j-1] : Field(0) );
+            fNew[j] = (fj - epsF*bj) / denom;
+            bNew[j] = (bj - epsB*fj) / denom;
+        }
+        f.swap( fNew );
+        b.swap( bNew );
+    }
+    if( f[0] == Field(0) )
+        RuntimeError("The Gohberg-Semencul formula requires inv(T)(0,0) != 0");
+
+    // L(u) has a = [0; u] and U(w) has a = [J w; 0] (with n-1 zeros)
+    vector<Field> aLowerX(2*n-1,Field(0)), aUpperJY(2*n-1,Field(0)),
+                  aLowerZY(2*n-1,Field(0)), aUpperZJX(2*n-1,Field(0));
+    for( Int i=0; i<n; ++i )
+    {
+        aLowerX[n-1+i] = f[i];
+        aUpperJY[i] = b[i];
+        if( i > 0 )
+            aLowerZY[n-1+i] = b[i-1];
+        if( i < n-1 )
+            aUpperZJX[i] = f[i+1];
+    }
+    structured::ToeplitzSymbol( n, n, aLowerX, lowerX_ );
+    structured::ToeplitzSymbol( n, n, aUpperJY, upperJY_ );
+    structured::ToeplitzSymbol( n, n, aLowerZY, lowerZY_ );
+    structured::ToeplitzSymbol( n, n, aUpperZJX, upperZJX_ );
+    x0_ = f[0];
+    factored_ = true;
+}
+
+template<typename Field>
+void ToeplitzOperator<Field>::SolveAfter
+( Orientation orientation, Matrix<Field>& X ) const
+{
+    EL_DEBUG_CSE
+    if( !factored_ )
+        LogicError("Factor must be called before SolveAfter");
+    if( X.Height() != n_ )
+        LogicError("X had height ",X.Height()," but A was ",n_," x ",n_);
+    const Int n = n_;
+
+    // op(inv(A)) = op(1/x_0) ( op(U(J y)) op(L(x)) - op(U(Z J x)) op(L(Z y)) )
+    const bool normal = ( orientation == NORMAL );
+    const auto& right1 = ( normal ? upperJY_ : lowerX_ );
+    const auto& right2 = ( normal ? upperZJX_ : lowerZY_ );
+    const auto& left1 = ( normal ? lowerX_ : upperJY_ );
+    const auto& left2 = ( normal ? lowerZY_ : upperZJX_ );
+    Field scale = Field(1)/x0_;
+    if( orientation == ADJOINT )
+        scale = Conj(scale);
+    Matrix<Field> W1, W2;
+    structured::ApplyCirculant
+    ( orientation, right1, false, n, Field(1), X, Field(0), W1 );
+    structured::ApplyCirculant
+    ( orientation, right2, false, n, Field(1), X, Field(0), W2 );
+    structured::ApplyCirculant
+    ( orientation, left1, false, n, scale, W1, Field(0), X );
+    structured::ApplyCirculant
+    ( orientation, left2, false, n, -scale, W2, Field(1), X );
+}
+
+// The m x n matrix A(i,j) = a[i+j] (see Hankel), which is applied as the
+// Toeplitz matrix T(i,j) = a[i-j+(n-1)] times the reversal permutation
+template<typename Field>
+class HankelOperator
+{
+public:
+    HankelOperator() { }
+    HankelOperator( Int m, Int n, const vector<Field>& a ) { Set( m, n, a ); }
+
+    void Set( Int m, Int n, const vector<Field>& a ) { T_.Set( m, n, a ); }
+
+    Int Height() const EL_NO_EXCEPT { return T_.Height(); }
+    Int Width() const EL_NO_EXCEPT { return T_.Width(); }
+
+    // Y := alpha op(A) X + beta Y
+    void Multiply
+    ( Orientation orientation,
+      Field alpha, const Matrix<Field>& X,
+      Field beta,        Matrix<Field>& Y ) const
+    {
+        EL_DEBUG_CSE
+        if( orientation == NORMAL )
+        {
+            // A X = T (J X)
+            Matrix<Field> XRev( X );
+            structured::ReverseRows( XRev );
+            T_.Multiply( NORMAL, alpha, XRev, beta, Y );
+        }
+        else
+        {
+            // op(A) X = J (op(T) X)
+            Matrix<Field> Z;
+            T_.Multiply( orientation, Field(1), X, Field(0), Z );
+            structured::ReverseRows( Z );
+            structured::PrepareOutput( Z.Height(), Z.Width(), beta, Y );
+            structured::Update( alpha, Z, beta, Y );
+        }
+    }
+    void operator()
+    ( Field alpha, const Matrix<Field>& X,
+      Field beta,        Matrix<Field>& Y ) const
+    { Multiply( NORMAL, alpha, X, beta, Y ); }
+
+    // Factor the Toeplitz matrix A J
+    void Factor() { T_.Factor(); }
+    bool Factored() const EL_NO_EXCEPT { return T_.Factored(); }
+
+    // X := inv(op(A)) X
+    void SolveAfter( Orientation orientation, Matrix<Field>& X ) const
+    {
+        EL_DEBUG_CSE
+        if( orientation == NORMAL )
+        {
+            // inv(A) = J inv(T)
+            T_.SolveAfter( NORMAL, X );
+            structured::ReverseRows( X );
+        }
+        else
+        {
+            // inv(op(A)) = inv(op(T)) J
+            structured::ReverseRows( X );
+            T_.SolveAfter( orientation, X );
+        }
+    }
+
+private:
+    ToeplitzOperator<Field> T_;
+};
+
+// The n x n unitary matrix A(j,k) = exp(-2 pi i j k / n) / sqrt(n)
+// (see Fourier)
+template<typename Real>
+class FourierOperator
+{
+public:
+    FourierOperator() { }
+    FourierOperator( Int n ) { Set( n ); }
+
+    void Set( Int n ) { n_ = n; }
+
+    Int Height() const EL_NO_EXCEPT { return n_; }
+    Int Width() const EL_NO_EXCEPT { return n_; }
+
+    // Y := alpha op(A) X + beta Y, where A^T = A and A^H = inv(A)
+    void Multiply
+    ( Orientation orientation,
+      Complex<Real> alpha, const Matrix<Complex<Real>>& X,
+      Complex<Real> beta,        Matrix<Complex<Real>>& Y ) const
+    {
+        EL_DEBUG_CSE
+        if( X.Height() != n_ )
+            LogicError("X had height ",X.Height()," but A was ",n_);
+        Matrix<Complex<Real>> Z( X );
+        fft::Transform( Z, orientation == ADJOINT );
+        structured::PrepareOutput( n_, X.Width(), beta, Y );
+        structured::Update( alpha/Sqrt(Real(n_)), Z, beta, Y );
+    }
+    void operator()
+    ( Complex<Real> alpha, const Matrix<Complex<Real>>& X,
+      Complex<Real> beta,        Matrix<Complex<Real>>& Y ) const
+    { Multiply( NORMAL, alpha, X, beta, Y ); }
+
+    // X := inv(op(A)) X
+    void SolveAfter
+    ( Orientation orientation, Matrix<Complex<Real>>& X ) const
+    {
+        EL_DEBUG_CSE
+        if( X.Height() != n_ )
+            LogicError("X had height ",X.Height()," but A was ",n_);
+        fft::Transform( X, orientation != ADJOINT );
+        X *= Complex<Real>(1)/Sqrt(Real(n_));
+    }
+
+private:
+    Int n_=0;
+};
+
+// The 2^k x 2^k Walsh matrix, i.e., A(i,j) = (-1)^popcount(i & j), or, if
+// 'binary' is true, with the -1's replaced by zeros (see Walsh)
+template<typename Field>
+class WalshOperator
+{
+public:
+    WalshOperator() { }
+    WalshOperator( Int k, bool binary=false ) { Set( k, binary ); }
+
+    void Set( Int k, bool binary=false )
+    {
+        if( k < 1 )
+            LogicError("Walsh matrices are only defined for k>=1");
+        n_ = Int(1) << k;
+        binary_ = binary;
+    }
+
+    Int Height() const EL_NO_EXCEPT { return n_; }
+    Int Width() const EL_NO_EXCEPT { return n_; }
+
+    // Y := alpha op(A) X + beta Y, where op(A) = A since A is real and
+    // symmetric. The binary matrix is (H + 1 1^T)/2 for the Walsh matrix H.
+    void Multiply
+    ( Orientation orientation,
+      Field alpha, const Matrix<Field>& X,
+      Field beta,        Matrix<Field>& Y ) const
+    {
+        EL_DEBUG_CSE
+        if( X.Height() != n_ )
+            LogicError("X had height ",X.Height()," but A was ",n_);
+        Matrix<Field> Z( X );
+        structured::WalshHadamard( Z );
+        if( binary_ )
+        {
+            // Since the first row of H is all ones, Z(0,:) = 1^T X
+            for( Int j=0; j<Z.Width(); ++j )
+            {
+                const Field colSum = Z(0,j);
+                for( Int i=0; i<n_; ++i )
+                    Z(i,j) = (Z(i,j) + colSum) / Field(2);
+            }
+        }
+        structured::PrepareOutput( n_, X.Width(), beta, Y );
+        structured::Update( alpha, Z, beta, Y );
+    }
+    void operator()
+    ( Field alpha, const Matrix<Field>& X,
+      Field beta,        Matrix<Field>& Y ) const
+    { Multiply( NORMAL, alpha, X, beta, Y ); }
+
+    // X := inv(op(A)) X, where inv(H) = H/n and, by the Sherman-Morrison
+    // formula (with H 1 = n e_0), inv((H + 1 1^T)/2) = 2 H/n - e_0 e_0^T
+    void SolveAfter( Orientation orientation, Matrix<Field>& X ) const
+    {
+        EL_DEBUG_CSE
+        if( X.Height() != n_ )
+            LogicError("X had height ",X.Height()," but A was ",n_);
+        const Int numRHS = X.Width();
+        vector<Field> firstRow(numRHS);
+        for( Int j=0; j<numRHS; ++j )
+            firstRow[j] = X(0,j);
+        structured::WalshHadamard( X );
+        if( binary_ )
+        {
+            X *= Field(2) / Field(n_);
+            for( Int j=0; j<numRHS; ++j )
+                X(0,j) -= firstRow[j];
+        }
+        else
+            X *= Field(1) / Field(n_);
+    }
+
+private:
+    Int n_=0;
+    bool binary_=false;
+};
+
+} // namespace El
+
+#endif // ifndef EL_SOLVE_STRUCTURED_HPP
@@ -82,7 +82,8 @@ EL_EXPORT ElError ElSecularSVDCtrlDefault_d
 typedef enum {
   EL_HERM_TRIDIAG_EIG_QR=0,
   EL_HERM_TRIDIAG_EIG_DC=1,
-  EL_HERM_TRIDIAG_EIG_MRRR=2
+  EL_HERM_TRIDIAG_EIG_MRRR=2,
+  EL_HERM_TRIDIAG_EIG_BISECTION=3
 } ElHermitianTridiagEigAlg;
 
 /* HermitianEigSubset */
@@ -736,7 +737,9 @@ typedef enum {
   EL_THIN_SVD,
   EL_COMPACT_SVD,
   EL_FULL_SVD,
-  EL_PRODUCT_SVD
+  EL_PRODUCT_SVD,
+  EL_RANDOMIZED_SVD,
+  EL_QDWH_SVD
 } ElSVDApproach;
 
 typedef enum {
@@ -811,6 +814,9 @@ typedef struct {
   double valChanRatio;
   double fullChanRatio;
 
+  /* The number of singular triplets approximated by EL_RANDOMIZED_SVD */
+  ElInt randomizedRank;
+
   ElBidiagSVDCtrl_s bidiagSVDCtrl;
 } ElSVDCtrl_s;
 EL_EXPORT ElError ElSVDCtrlDefault_s( ElSVDCtrl_s* ctrl );
@@ -825,6 +831,9 @@ typedef struct {
   double valChanRatio;
   double fullChanRatio;
 
+  /* The number of singular triplets approximated by EL_RANDOMIZED_SVD */
+  ElInt randomizedRank;
+
   ElBidiagSVDCtrl_d bidiagSVDCtrl;
 } ElSVDCtrl_d;
 EL_EXPORT ElError ElSVDCtrlDefault_d( ElSVDCtrl_d* ctrl );
@@ -261,6 +261,10 @@ struct QRCtrl
 
     bool fullAccuracyTwoByTwo=true;
 
+    // The number of batched rotation sequences which are applied to the
+    // eigenvectors in each cache-blocked pass (see ApplyGivensSequences)
+    Int rotationBatchSize=16;
+
     // As noted in
     //
     //   Beresford N. Parlett and Jian Le,
@@ -301,6 +305,11 @@ struct DCCtrl
     // eigenvectors with the outer singular vectors? This should only be
     // disabled for academic reasons.
     bool exploitStructure = true;
+
+    // Solve the secular equations of merges with at least this many
+    // undeflated roots using OpenMP threads (only for BLAS datatypes, and
+    // only when no progress is being printed)
+    Int parallelSecularCutoff = 128;
 };
 
 // Cf. Section 4 of Gu and Eisenstat's "A Divide-and-Conquer Algorithm for the
@@ -337,7 +346,11 @@ struct HermitianTridiagEigInfo
 enum HermitianTridiagEigAlg {
   HERM_TRIDIAG_EIG_QR = 0,
   HERM_TRIDIAG_EIG_DC = 1,
-  HERM_TRIDIAG_EIG_MRRR = 2
+  HERM_TRIDIAG_EIG_MRRR = 2,
+  // Sturm-sequence bisection (distributed over the index range) followed by
+  // inverse iteration, which is well-suited to small subsets of the spectrum
+  // (only supported for distributed matrices)
+  HERM_TRIDIAG_EIG_BISECTION = 3
 };
 
 template<typename Real,
@@ -397,6 +410,17 @@ HermitianTridiagEig
 
 // Hermitian eigenvalue solvers
 // ============================
+struct QDWHCtrl
+{
+    bool colPiv=false;
+    Int maxIts=20;
+
+    // Once the QDWH weight c drops below this cutoff, the iterate is
+    // well-conditioned enough to replace the QR-based iterations with
+    // (cheaper) Cholesky-based ones
+    double choleskyCutoff=100;
+};
+
 template<typename Real>
 struct HermitianSDCCtrl
 {
@@ -405,6 +429,14 @@ struct HermitianSDCCtrl
     Real tol=Real(0);
     Real spreadFactor=Real(1e-6);
     bool progress=false;
+
+    // For computing the spectral projectors via the QDWH polar decomposition
+    QDWHCtrl qdwhCtrl;
+
+    // For the unpivoted QR factorizations of the randomized (RURV) splits
+    QRCtrl<Real> qrCtrl;
+
+    HermitianSDCCtrl() { qrCtrl.communicationAvoiding = true; }
 };
 
 template<typename Field>
@@ -416,6 +448,13 @@ struct HermitianEigCtrl
     bool useScaLAPACK=false;
     bool useSDC=false;
     bool timeStages=false;
+
+    // If true, the distributed MRRR eigensolver back-transforms each panel of
+    // tridiagonal eigenvectors as soon as it has been redistributed into the
+    // [MC,MR] distribution rather than after the entire redistribution, so
+    // that the all-to-all of each panel is interleaved with the
+    // back-transformation of the previous one
+    bool pipelineBacktransform=false;
 };
 
 struct HermitianEigInfo
@@ -460,6 +499,121 @@ HermitianEig
         AbstractDistMatrix<Field>& Q,
   const HermitianEigCtrl<Field>& ctrl=HermitianEigCtrl<Field>() );
 
+// Repeated spectral queries
+// -------------------------
+// Each call to HermitianEig reduces A to real symmetric tridiagonal form,
+// A = Q_T T Q_T^H, which is the O(n^3) portion of the computation. The
+// following objects instead retain the packed Householder reflectors of Q_T
+// (or the two-stage reflectors) along with T so that any number of
+// eigenvalue (or eigenpair) queries, each with its own subset of the
+// spectrum, only require a tridiagonal eigensolve and, for eigenvectors,
+// the back-transformation of the requested vectors, which requires
+// O(n^2 k) work for k eigenvectors.
+template<typename Field>
+class HermitianEigFactorization
+{
+public:
+    HermitianEigFactorization() { }
+    HermitianEigFactorization
+    ( UpperOrLower uplo,
+      const Matrix<Field>& A,
+      const HermitianTridiagCtrl<Field>& ctrl=HermitianTridiagCtrl<Field>() );
+
+    void Initialize
+    ( UpperOrLower uplo,
+      const Matrix<Field>& A,
+      const HermitianTridiagCtrl<Field>& ctrl=HermitianTridiagCtrl<Field>() );
+
+    bool Initialized() const EL_NO_EXCEPT { return initialized_; }
+    Int Height() const EL_NO_EXCEPT { return A_.Height(); }
+
+    // The main diagonal and (sub/super)diagonal of T
+    const Matrix<Base<Field>>& MainDiagonal() const EL_NO_EXCEPT
+    { return d_; }
+    const Matrix<Field>& OffDiagonal() const EL_NO_EXCEPT { return dSub_; }
+
+    // The eigenvalues in the subset (and in the order) requested by 'ctrl'
+    HermitianTridiagEigInfo Eigenvalues
+    ( Matrix<Base<Field>>& w,
+      const HermitianTridiagEigCtrl<Base<Field>>& ctrl=
+            HermitianTridiagEigCtrl<Base<Field>>() ) const;
+
+    // The eigenpairs in the subset (and in the order) requested by 'ctrl'
+    HermitianTridiagEigInfo Eigenpairs
+    ( Matrix<Base<Field>>& w,
+      Matrix<Field>& Q,
+      const HermitianTridiagEigCtrl<Base<Field>>& ctrl=
+            HermitianTridiagEigCtrl<Base<Field>>() ) const;
+
+    // Z := Q_T Z, e.g., to map eigenvectors of T to those of A
+    void BackTransform( Matrix<Field>& Z ) const;
+
+private:
+    bool initialized_=false;
+    UpperOrLower uplo_=LOWER;
+    bool twoStage_=false;
+
+    // The reflectors are stored in the same format as HermitianTridiag (or
+    // herm_tridiag::TwoStage, if 'twoStage_' is true) leaves them in
+    Matrix<Field> A_, householderScalars_;
+    herm_tridiag::TwoStageReflectors<Field> twoStageReflectors_;
+
+    Matrix<Base<Field>> d_;
+    Matrix<Field> dSub_;
+};
+
+template<typename Field>
+class DistHermitianEigFactorization
+{
+public:
+    DistHermitianEigFactorization() { }
+    DistHermitianEigFactorization
+    ( UpperOrLower uplo,
+      const AbstractDistMatrix<Field>& A,
+      const HermitianTridiagCtrl<Field>& ctrl=HermitianTridiagCtrl<Field>() );
+
+    void Initialize
+    ( UpperOrLower uplo,
+      const AbstractDistMatrix<Field>& A,
+      const HermitianTridiagCtrl<Field>& ctrl=HermitianTridiagCtrl<Field>() );
+
+    bool Initialized() const EL_NO_EXCEPT { return initialized_; }
+    Int Height() const EL_NO_EXCEPT { return A_.Height(); }
+    const El::Grid& Grid() const EL_NO_EXCEPT { return A_.Grid(); }
+
+    // The main diagonal and (sub/super)diagonal of T, which are replicated
+    // so that they need not be gathered for each query
+    const DistMatrix<Base<Field>,STAR,STAR>& MainDiagonal() const
+    EL_NO_EXCEPT { return d_; }
+    const DistMatrix<Field,STAR,STAR>& OffDiagonal() const EL_NO_EXCEPT
+    { return dSub_; }
+
+    HermitianTridiagEigInfo Eigenvalues
+    ( AbstractDistMatrix<Base<Field>>& w,
+      const HermitianTridiagEigCtrl<Base<Field>>& ctrl=
+            HermitianTridiagEigCtrl<Base<Field>>() ) const;
+
+    HermitianTridiagEigInfo Eigenpairs
+    ( AbstractDistMatrix<Base<Field>>& w,
+      AbstractDistMatrix<Field>& Q,
+      const HermitianTridiagEigCtrl<Base<Field>>& ctrl=
+            HermitianTridiagEigCtrl<Base<Field>>() ) const;
+
+    void BackTransform( AbstractDistMatrix<Field>& Z ) const;
+
+private:
+    bool initialized_=false;
+    UpperOrLower uplo_=LOWER;
+    bool twoStage_=false;
+
+    DistMatrix<Field> A_;
+    DistMatrix<Field,VC,STAR> householderScalars_;
+    herm_tridiag::TwoStageReflectors<Field> twoStageReflectors_;
+
+    DistMatrix<Base<Field>,STAR,STAR> d_;
+    DistMatrix<Field,STAR,STAR> dSub_;
+};
+
 namespace herm_eig {
 
 template<typename Real,
@@ -583,12 +737,6 @@ HermitianGenDefEig
 
 // Polar decomposition
 // ===================
-struct QDWHCtrl
-{
-    bool colPiv=false;
-    Int maxIts=20;
-};
-
 struct PolarCtrl
 {
     bool qdwh=false;
@@ -746,6 +894,11 @@ struct HessenbergSchurCtrl
     Int minMultiBulgeSize = 75;
     Int minDistMultiBulgeSize = 400;
 
+    // If greater than one, distributed AED windows of size at least
+    // minDistMultiBulgeSize are solved by the distributed AED algorithm over
+    // a subgrid of this many processes rather than by a single process
+    Int aedSubgridSize = 0;
+
     function<Int(Int,Int)> numShifts =
       function<Int(Int,Int)>(hess_schur::aed::NumShifts);
 
@@ -827,6 +980,16 @@ struct SDCCtrl
     bool progress=false;
 
     SignCtrl<Real> signCtrl;
+
+    // The controls for the QR factorization of each split. The unpivoted
+    // factorizations of the randomized (RURV) splits, including the one which
+    // draws the Haar-distributed unitary matrix, honor 'communicationAvoiding'
+    // (enabled by default), while the column-pivoted factorizations of the
+    // deterministic splits honor 'colPivoting'; QR_COLPIV_TOURNAMENT selects
+    // a panel of pivots at once so that these splits are also BLAS-3.
+    QRCtrl<Real> qrCtrl;
+
+    SDCCtrl() { qrCtrl.communicationAvoiding = true; }
 };
 
 template<typename Real>
@@ -835,6 +998,13 @@ struct SchurCtrl
     bool useSDC=false;
     HessenbergSchurCtrl hessSchurCtrl;
     SDCCtrl<Real> sdcCtrl;
+
+    // Reduce to upper-Hessenberg form with 'hessenbergBandwidth'
+    // subdiagonals (the algorithmic blocksize if zero) with BLAS-3 updates
+    // before chasing the bulges down to Hessenberg form
+    bool twoStageHessenberg=false;
+    Int hessenbergBandwidth=0;
+
     bool time=false;
 };
 
@@ -990,7 +1160,17 @@ enum SVDApproach
   // When thresholded, a cross-product algorithm is used. This is often
   // advantageous since tridiagonal eigensolvers tend to have faster
   // parallel implementations than bidiagonal SVD's.
-  PRODUCT_SVD
+  PRODUCT_SVD,
+
+  // If only the (approximately) largest k singular triplets are desired,
+  // where k is SVDCtrl::randomizedRank, project A onto the output of
+  // RandomizedRangeFinder and compute the SVD of the small projected matrix.
+  RANDOMIZED_SVD,
+
+  // Compute a thin SVD by forming the QDWH polar decomposition A = U_p H and
+  // then the eigendecomposition of H with spectral divide and conquer, so
+  // that only BLAS3 operations are required.
+  QDWH_SVD
 };
 
 enum SingularValueToleranceType
@@ -1027,6 +1207,10 @@ struct QRCtrl
     Int maxIterPerVal=6;
     bool demandConverged=true;
 
+    // The number of batched rotation sequences which are applied to the
+    // singular vectors in each cache-blocked pass (see ApplyGivensSequences)
+    Int rotationBatchSize=16;
+
     // See the note above MinSingularValueEstimateOfBidiag
     bool looseMinSingValEst=true;
 
@@ -1073,6 +1257,11 @@ struct DCCtrl
     // singular vectors with the outer singular vectors? This should only be
     // disabled for academic reasons.
     bool exploitStructure = true;
+
+    // Solve the secular equations of merges with at least this many
+    // undeflated roots using OpenMP threads (only for BLAS datatypes, and
+    // only when no progress is being printed)
+    Int parallelSecularCutoff = 128;
 };
 
 // Cf. Section 4 of Gu and Eisenstat's "A Divide-and-Conquer Algorithm for the
@@ -1237,6 +1426,33 @@ struct SVDCtrl
     // decomposition when computing a full SVD
     double fullChanRatio=1.5;
 
+    // Two-stage bidiagonalization
+    // ---------------------------
+
+    // When only computing singular values, reduce to a band of width
+    // 'bidiagBandwidth' (the algorithmic blocksize if zero) with BLAS-3
+    // updates before chasing the bulges down to bidiagonal form
+    bool twoStageBidiag=false;
+    Int bidiagBandwidth=0;
+
+    // Randomized SVD
+    // --------------
+
+    // The number of singular triplets to approximate when the approach is
+    // RANDOMIZED_SVD
+    Int randomizedRank=0;
+
+    RangeFinderCtrl rangeFinderCtrl;
+
+    // QDWH-based SVD
+    // --------------
+
+    // For the polar decomposition A = U_p H when the approach is QDWH_SVD
+    QDWHCtrl qdwhCtrl;
+
+    // For the spectral divide and conquer eigensolver applied to H
+    HermitianSDCCtrl<Real> sdcCtrl;
+
     BidiagSVDCtrl<Real> bidiagSVDCtrl;
 };
 
@@ -1488,6 +1704,54 @@ Base<Field> LanczosDecomp
         DistMultiVec<Field>& v,
         Int basisSize=15 );
 
+// Block Lanczos
+// =============
+// Compute the 'numEigs' algebraically largest (or smallest) eigenpairs of a
+// sparse Hermitian matrix (with both triangles explicitly stored) using
+// thick-restart block Lanczos with full reorthogonalization. Each expansion
+// applies A to a block of vectors at once, and converged Ritz pairs are
+// locked so that the remaining iterations are orthogonalized against them.
+//
+// The eigenvalues are returned in ascending order on every process.
+
+template<typename Real>
+struct BlockLanczosCtrl
+{
+    // The number of vectors added to the Krylov subspace per iteration (which
+    // bounds the multiplicity of the eigenvalues which can be resolved)
+    Int blockSize=4;
+
+    // The maximum dimension of the (unlocked) Krylov subspace before a
+    // restart (zero selects 2 numEigs + 4 blockSize)
+    Int maxBasisSize=0;
+
+    Int maxRestarts=100;
+
+    // A Ritz pair (theta,z) is accepted once its residual norm is at most
+    // tol times the largest Ritz value magnitude (zero selects eps^(3/4))
+    Real tol=0;
+
+    // Compute the largest eigenvalues rather than the smallest?
+    bool largest=true;
+
+    bool progress=false;
+};
+
+template<typename Field>
+void BlockLanczos
+( const SparseMatrix<Field>& A,
+        Int numEigs,
+        Matrix<Base<Field>>& w,
+        Matrix<Field>& Z,
+  const BlockLanczosCtrl<Base<Field>>& ctrl=BlockLanczosCtrl<Base<Field>>() );
+template<typename Field>
+void BlockLanczos
+( const DistSparseMatrix<Field>& A,
+        Int numEigs,
+        Matrix<Base<Field>>& w,
+        DistMultiVec<Field>& Z,
+  const BlockLanczosCtrl<Base<Field>>& ctrl=BlockLanczosCtrl<Base<Field>>() );
+
 // Product Lanczos
 // ===============
 // Form the product Lanczos decomposition
@@ -1549,6 +1813,66 @@ pair<Base<Field>,Base<Field>>
 HermitianExtremalSingValEst
 ( const DistSparseMatrix<Field>& A, Int basisSize=20 );
 
+// Spectrum slicing
+// ================
+// Compute the eigenpairs of a sparse Hermitian matrix (with both triangles
+// explicitly stored) whose eigenvalues lie in the interval
+// (lowerBound,upperBound]. The interval is split into slices, the number of
+// eigenvalues within each slice is counted from the inertia of sparse LDL^H
+// factorizations of shifted matrices, and the eigenpairs of each slice are
+// computed with shift-and-invert block Lanczos (with full
+// reorthogonalization) about the center of the slice.
+//
+// In the distributed case, the processes are split into contiguous teams
+// which each hold a copy of A and independently process a contiguous subset
+// of the slices. The eigenvalues are returned in ascending order on every
+// process.
+
+template<typename Real>
+struct SpectrumSliceCtrl
+{
+    // The number of slices of equal width
+    Int numSlices=1;
+
+    // The number of process teams (zero selects one team per slice, up to the
+    // number of processes)
+    Int numTeams=0;
+
+    // The number of vectors added to the Krylov subspace per iteration
+    Int blockSize=4;
+
+    // The maximum dimension of the Krylov subspace for a slice containing k
+    // eigenvalues (zero selects 3 k + 10 blockSize)
+    Int maxBasisSize=0;
+
+    // A Ritz pair (theta,z) of inv(A - sigma I) is accepted once its residual
+    // norm is at most tol |theta| (zero selects eps^(3/4))
+    Real tol=0;
+
+    LDLFrontType frontType=LDL_2D;
+    BisectCtrl bisectCtrl;
+    bool progress=false;
+};
+
+template<typename Field>
+void HermitianSpectrumSlice
+( const SparseMatrix<Field>& A,
+        Base<Field> lowerBound,
+        Base<Field> upperBound,
+        Matrix<Base<Field>>& w,
+        Matrix<Field>& Z,
+  const SpectrumSliceCtrl<Base<Field>>& ctrl=
+        SpectrumSliceCtrl<Base<Field>>() );
+template<typename Field>
+void HermitianSpectrumSlice
+( const DistSparseMatrix<Field>& A,
+        Base<Field> lowerBound,
+        Base<Field> upperBound,
+        Matrix<Base<Field>>& w,
+        DistMultiVec<Field>& Z,
+  const SpectrumSliceCtrl<Base<Field>>& ctrl=
+        SpectrumSliceCtrl<Base<Field>>() );
+
 // Pseudospectra
 // =============
 enum PseudospecNorm {
@@ -1569,6 +1893,15 @@ struct SnapshotCtrl
     FileFormat imgFormat=PNG, numFormat=ASCII_MATLAB;
     bool itCounts=true;
 
+    // Write the intermediate snapshots from a background thread (on the root
+    // process, after gathering them) so that the iterations can proceed while
+    // they are written and encoded. Displays remain synchronous.
+    bool async=false;
+
+    // Write the (log-scaled) intermediate image snapshots in BINARY format
+    // rather than encoding them as images
+    bool rawDumps=false;
+
     void ResetCounts()
     {
         imgSaveCount = 0;
@@ -1609,6 +1942,11 @@ struct PseudospecCtrl
     // Whether or not to print progress information at each iteration
     bool progress=false;
 
+    // If greater than one, distributed computations split the processes into
+    // this many teams which each hold a copy of the Schur (or Hessenberg)
+    // factor and process a contiguous subset of the shifts
+    Int numShiftTeams=1;
+
     SnapshotCtrl snapCtrl;
 
     mutable Complex<Real> center = Complex<Real>(0);
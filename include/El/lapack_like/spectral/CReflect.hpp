@@ -685,6 +685,7 @@ inline SVDCtrl<float> CReflect( const ElSVDCtrl_s& ctrlC )
     ctrl.useScaLAPACK = ctrlC.useScaLAPACK;
     ctrl.valChanRatio = ctrlC.valChanRatio;
     ctrl.fullChanRatio = ctrlC.fullChanRatio;
+    ctrl.randomizedRank = ctrlC.randomizedRank;
     ctrl.bidiagSVDCtrl = CReflect(ctrlC.bidiagSVDCtrl);
     return ctrl;
 }
@@ -698,6 +699,7 @@ inline SVDCtrl<double> CReflect( const ElSVDCtrl_d& ctrlC )
     ctrl.useScaLAPACK = ctrlC.useScaLAPACK;
     ctrl.valChanRatio = ctrlC.valChanRatio;
     ctrl.fullChanRatio = ctrlC.fullChanRatio;
+    ctrl.randomizedRank = ctrlC.randomizedRank;
     ctrl.bidiagSVDCtrl = CReflect(ctrlC.bidiagSVDCtrl);
     return ctrl;
 }
@@ -711,6 +713,7 @@ inline ElSVDCtrl_s CReflect( const SVDCtrl<float>& ctrl )
     ctrlC.useScaLAPACK = ctrl.useScaLAPACK;
     ctrlC.valChanRatio = ctrl.valChanRatio;
     ctrlC.fullChanRatio = ctrl.fullChanRatio;
+    ctrlC.randomizedRank = ctrl.randomizedRank;
     ctrlC.bidiagSVDCtrl = CReflect(ctrl.bidiagSVDCtrl);
     return ctrlC;
 }
@@ -724,6 +727,7 @@ inline ElSVDCtrl_d CReflect( const SVDCtrl<double>& ctrl )
     ctrlC.useScaLAPACK = ctrl.useScaLAPACK;
     ctrlC.valChanRatio = ctrl.valChanRatio;
     ctrlC.fullChanRatio = ctrl.fullChanRatio;
+    ctrlC.randomizedRank = ctrl.randomizedRank;
     ctrlC.bidiagSVDCtrl = CReflect(ctrl.bidiagSVDCtrl);
     return ctrlC;
 }
@@ -21,9 +21,30 @@ struct BisectCtrl
     Int cutoff;
     bool storeFactRecvInds;
 
+    // Relaxed supernode amalgamation of the local elimination tree: a child
+    // is merged into its parent when at most 'amalgamationTol' of the entries
+    // of the merged front would be explicit zeros
+    bool amalgamate;
+    double amalgamationTol;
+
+    // Use the built-in multilevel partitioner rather than (Par)METIS (it is
+    // always used when METIS is unavailable and for non-sequential bisections
+    // when ParMETIS is unavailable)
+    bool multilevel;
+
+    // Split each distributed team in proportion to the estimated
+    // factorization cost of the two subtrees rather than in half
+    bool proportionalMapping;
+
+    // Merge the vertices with identical closed neighborhoods (supervariables)
+    // before ordering and expand the separator tree afterwards
+    bool compressSupervariables;
+
     BisectCtrl()
     : sequential(true), numDistSeps(1), numSeqSeps(1), cutoff(1024),
-      storeFactRecvInds(false)
+      storeFactRecvInds(false), amalgamate(false), amalgamationTol(0.1),
+      multilevel(false), proportionalMapping(true),
+      compressSupervariables(false)
     { }
 };
 
@@ -43,6 +64,25 @@ Int Bisect
         bool& onLeft,
   const BisectCtrl& ctrl=BisectCtrl() );
 
+// A built-in multilevel partitioner (heavy-edge matching coarsening, greedy
+// graph growing, and boundary refinement) which operates directly upon the
+// distributed graph rather than gathering it onto a single process
+Int MultilevelBisect
+( const Graph& graph,
+        Graph& leftChild,
+        Graph& rightChild,
+        vector<Int>& perm,
+  const BisectCtrl& ctrl=BisectCtrl() );
+
+// NOTE: for two or more processes
+Int MultilevelBisect
+( const DistGraph& graph,
+        unique_ptr<Grid>& childGrid,
+        DistGraph& child,
+        DistMap& perm,
+        bool& onLeft,
+  const BisectCtrl& ctrl=BisectCtrl() );
+
 Int NaturalBisect
 ( Int nx,
   Int ny,
@@ -82,7 +122,14 @@ void BuildChildrenFromPerm
 void BuildChildFromPerm
 ( const DistGraph& graph, const DistMap& perm,
   Int leftChildSize, Int rightChildSize,
-  bool& onLeft, unique_ptr<Grid>& childGrid, DistGraph& child );
+  bool& onLeft, unique_ptr<Grid>& childGrid, DistGraph& child,
+  bool proportionalMapping=true );
+
+// The number of processes of a team of size 'teamSize' which should be
+// assigned to the left child of a separator
+int LeftTeamSize
+( int teamSize, Int leftChildSize, Int rightChildSize, Int sepSize,
+  bool proportionalMapping=true );
 
 // Median
 // ======
@@ -93,8 +140,25 @@ template<typename Real,
          typename=DisableIf<IsComplex<Real>>>
 ValueInt<Real> Median( const AbstractDistMatrix<Real>& x );
 
+// Select
+// ======
+// Return the k'th smallest entry (counting from zero) of a vector, with ties
+// broken by index. The distributed version is a quickselect which keeps the
+// entries distributed and pivots on the weighted median of the medians of the
+// processes' remaining candidates.
+template<typename Real,
+         typename=DisableIf<IsComplex<Real>>>
+ValueInt<Real> Select( const Matrix<Real>& x, Int k );
+template<typename Real,
+         typename=DisableIf<IsComplex<Real>>>
+ValueInt<Real> Select( const AbstractDistMatrix<Real>& x, Int k );
+
 // Sort
 // ====
+// The distributed versions perform a sample sort over the [VC,STAR] (or, for
+// row vectors, the transposed) distribution rather than sorting redundantly,
+// and, when Elemental is built with EL_HYBRID, the local sorts are
+// multithreaded.
 template<typename Real,
          typename=DisableIf<IsComplex<Real>>>
 void Sort
@@ -146,6 +210,27 @@ void MergeSortingPermutation
 ( Int n0, Int n1, const Matrix<Real>& x, Permutation& sortPerm,
   SortType sort=ASCENDING );
 
+// Blocksize autotuning
+// ====================
+// Times each routine family (Gemm, Trsm, Herk, Cholesky, LU, QR, and
+// HermitianTridiag) with each of the candidate algorithmic blocksizes on
+// 'size' x 'size' matrices over the given grid and records the fastest as the
+// tuned blocksize of the family for the datatype and grid shape (see
+// Blocksize<T>(family,grid)); the result can be persisted with
+// WriteBlocksizeProfile. The local blocksizes are not tuned.
+struct AutotuneCtrl
+{
+    Int size=2000;
+    vector<Int> candidates={32,64,96,128,192,256};
+    // The minimum time over the trials is used
+    Int numTrials=2;
+    bool progress=false;
+};
+
+template<typename Field>
+void AutotuneBlocksizes
+( const Grid& grid, const AutotuneCtrl& ctrl=AutotuneCtrl() );
+
 } // namespace El
 
 #endif // ifndef EL_UTIL_HPP
@@ -653,6 +653,8 @@ template<typename T>
 void Rademacher( Matrix<T>& A, Int m, Int n );
 template<typename T>
 void Rademacher( AbstractDistMatrix<T>& A, Int m, Int n );
+template<typename T>
+void Rademacher( DistMultiVec<T>& A, Int m, Int n );
 
 // Three-valued
 // ------------
@@ -660,6 +662,8 @@ template<typename T>
 void ThreeValued( Matrix<T>& A, Int m, Int n, double p=2./3. );
 template<typename T>
 void ThreeValued( AbstractDistMatrix<T>& A, Int m, Int n, double p=2./3. );
+template<typename T>
+void ThreeValued( DistMultiVec<T>& A, Int m, Int n, double p=2./3. );
 
 // Uniform
 // -------
@@ -54,6 +54,7 @@ private:
 
     void SieveSegment();
     void FormNewSegment();
+    void SieveSegmentsInParallel( T upperBound );
 };
 
 // For retrieving a global-scope sieve for trial division
@@ -100,6 +101,9 @@ Primality MillerRabinSequence( const BigInt& n, Int numReps=30 );
 // Use a combination of trial divisions and Miller-Rabin 
 // (with numReps representatives) to test for primality.
 Primality PrimalityTest( const BigInt& n, Int numReps=30 );
+// A deterministic test via Miller-Rabin with the first twelve primes as
+// bases, which suffices for every n < 2^64
+Primality PrimalityTest( unsigned long long n );
 
 // Return the first prime greater than n (with high likelihood)
 BigInt NextProbablePrime( const BigInt& n, Int numReps=30 );
@@ -115,6 +119,12 @@ struct PollardRhoCtrl
     BigInt x0=BigIntTwo();
     Int gcdDelay=100;
 
+    // If larger than one, run this many independent sequences (with the
+    // shifts a0, a0+1, ..., skipping the problematic 0 and -2) in lockstep,
+    // threaded over the sequences, and test all of them with a single GCD
+    // every 'gcdDelay' steps by combining their products with a product tree
+    Int numSequences=1;
+
     // For trial division
     bool avoidTrialDiv=false;
     unsigned long long trialDivLimit=53ULL;
@@ -137,6 +147,10 @@ BigInt FindDivisor
         Int a=1,
   const PollardRhoCtrl& ctrl=PollardRhoCtrl() );
 
+BigInt FindFactorBatched
+( const BigInt& n,
+  const PollardRhoCtrl& ctrl=PollardRhoCtrl() );
+
 } // namespace pollard_rho
 
 template<typename TSieve=unsigned long long>
@@ -143,6 +143,16 @@ void DynamicSieve<T,TSmall>::Generate( T upperBound )
         MoveSegmentOffset( oddPrimes.back()+2 );
     }
 
+#ifdef EL_HYBRID
+    if( omp_get_max_threads() > 1 &&
+        segmentOffset_+2*T(segmentSize_) < upperBound )
+    {
+        SieveSegmentsInParallel( upperBound );
+        SetStorage( false );
+        return;
+    }
+#endif
+
     for( ; segmentOffset_<upperBound; segmentOffset_+=2*segmentSize_ )
     {
         SieveSegment();
@@ -159,6 +169,54 @@ void DynamicSieve<T,TSmall>::Generate( T upperBound )
     SetStorage( false );
 }
 
+// Sieve each of the segments beginning below 'upperBound' independently
+// (with the starting index of each sieving prime recomputed per segment) and
+// then append their primes in order. The sieving primes must already be
+// available, as ensured by Generate.
+template<typename T,typename TSmall>
+void DynamicSieve<T,TSmall>::SieveSegmentsInParallel( T upperBound )
+{
+    const T segmentSpan = 2*T(segmentSize_);
+    const T numSegments =
+      (upperBound-segmentOffset_+segmentSpan-1) / segmentSpan;
+    vector<vector<T>> segmentPrimes( numSegments );
+    EL_PARALLEL_FOR
+    for( T s=0; s<numSegments; ++s )
+    {
+        const T offset = segmentOffset_ + s*segmentSpan;
+        const T largestCandidate = offset + 2*T(segmentSize_-1);
+        const T factorBound = T(std::sqrt(double(largestCandidate))) + 1;
+        auto boundIter =
+          std::lower_bound( oddPrimes.begin(), oddPrimes.end(), factorBound );
+
+        vector<char> table( segmentSize_, char(1) );
+        for( auto iter=oddPrimes.begin(); iter<boundIter; ++iter )
+        {
+            // The first odd multiple of p at least Max(offset,p^2), as in
+            // ComputeSegmentStart
+            const T p = *iter;
+            T k;
+            if( p*p >= offset )
+            {
+                k = (p*p - offset) / 2;
+            }
+            else
+            {
+                const T complement = (p - (offset % p)) % p;
+                k = ( complement % 2 == 0 ? complement : complement+p ) / 2;
+            }
+            for( ; k<T(segmentSize_); k+=p )
+                table[k] = 0;
+        }
+        for( TSmall k=0; k<segmentSize_; ++k )
+            if( table[k] )
+                segmentPrimes[s].push_back( offset + 2*T(k) );
+    }
+    for( const auto& primes : segmentPrimes )
+        oddPrimes.insert( oddPrimes.end(), primes.begin(), primes.end() );
+    MoveSegmentOffset( segmentOffset_ + numSegments*segmentSpan );
+}
+
 template<typename T,typename TSmall>
 bool DynamicSieve<T,TSmall>::SeekSegmentPrime()
 {
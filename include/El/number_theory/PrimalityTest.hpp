@@ -13,9 +13,66 @@ namespace El {
 
 #ifdef EL_HAVE_MPC
 
+inline Primality PrimalityTest( unsigned long long n )
+{
+    const unsigned long long bases[] =
+      { 2, 3, 5, 7, 11, 13, 17, 19, 23, 29, 31, 37 };
+    if( n < 2 )
+        return COMPOSITE;
+    for( const auto base : bases )
+        if( n % base == 0 )
+            return n == base ? PRIME : COMPOSITE;
+
+    // Decompose n-1 as 2^t*q, where q is odd
+    unsigned long long q = n-1;
+    unsigned t = 0;
+    while( q % 2 == 0 )
+    {
+        q /= 2;
+        ++t;
+    }
+
+#ifdef __SIZEOF_INT128__
+    const montgomery::Modulus64 modulus( n );
+    const unsigned long long one = modulus.One();
+    const unsigned long long nm1 = modulus.Subtract( 0, one );
+    auto square =
+      [&]( unsigned long long b ) { return modulus.Multiply( b, b ); };
+    auto power =
+      [&]( unsigned long long a )
+      { return modulus.Pow( modulus.ToMontgomery(a), q ); };
+#else
+    const unsigned long long one = 1;
+    const unsigned long long nm1 = n-1;
+    auto square = [&]( unsigned long long b ) { return MulMod( b, b, n ); };
+    auto power = [&]( unsigned long long a ) { return PowMod( a, q, n ); };
+#endif
+    for( const auto base : bases )
+    {
+        unsigned long long b = power( base );
+        if( b == one || b == nm1 )
+            continue;
+        bool probablePrime = false;
+        for( unsigned e=1; e<t; ++e )
+        {
+            b = square( b );
+            if( b == nm1 )
+            {
+                probablePrime = true;
+                break;
+            }
+        }
+        if( !probablePrime )
+            return COMPOSITE;
+    }
+    return PRIME;
+}
+
 // TODO: A custom algorithm wrapping our Miller-Rabin
 inline Primality PrimalityTest( const BigInt& n, Int numReps )
 {
+    if( montgomery::FitsNatively(n) )
+        return PrimalityTest( static_cast<unsigned long long>(n) );
     int result = mpz_probab_prime_p( n.LockedPointer(), int(numReps) );
     if( result == 2 )
         return PRIME;
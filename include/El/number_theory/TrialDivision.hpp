@@ -45,6 +45,9 @@ TrialDivision( unsigned long long n, unsigned long long limit )
 inline vector<unsigned long long>
 TrialDivision( const BigInt& n, unsigned long long limit )
 {
+    if( montgomery::FitsNatively(n) )
+        return TrialDivision( static_cast<unsigned long long>(n), limit );
+
     // Implement Min carefully
     if( BigInt(limit) > ISqrt(n) )
         limit = static_cast<unsigned long long>(ISqrt(n));
@@ -106,6 +109,9 @@ HasTinyFactor( unsigned long long n, unsigned long long limit )
 inline bool
 HasTinyFactor( const BigInt& n, unsigned long long limit )
 {
+    if( montgomery::FitsNatively(n) )
+        return HasTinyFactor( static_cast<unsigned long long>(n), limit );
+
     // Implement Min carefully
     if( BigInt(limit) > ISqrt(n) )
         limit = static_cast<unsigned long long>(ISqrt(n));
@@ -17,6 +17,96 @@ namespace factor {
 
 namespace pollard_rho {
 
+#ifdef __SIZEOF_INT128__
+// A native analogue of FindFactor for odd n < 2^64 which keeps the iterates
+// in Montgomery form. Note that the GCD of a Montgomery representative with
+// n is that of the original value since R = 2^64 is coprime to n.
+inline unsigned long long FindFactorNative
+( unsigned long long n,
+  Int a,
+  const PollardRhoCtrl& ctrl )
+{
+    const montgomery::Modulus64 modulus( n );
+    auto gcdNative =
+      []( unsigned long long b, unsigned long long c )
+      {
+        while( c != 0 )
+        {
+            const unsigned long long r = b % c;
+            b = c;
+            c = r;
+        }
+        return b;
+      };
+
+    const unsigned long long aMod =
+      ( a >= 0 ?
+        static_cast<unsigned long long>(a) % n :
+        (n - static_cast<unsigned long long>(-a) % n) % n );
+    const unsigned long long shift = modulus.ToMontgomery( aMod );
+    auto xAdvance =
+      [&]( unsigned long long& x )
+      {
+        if( ctrl.numSteps == 1 )
+            x = modulus.Multiply( x, x );
+        else
+            x = modulus.Pow( x, 2*ctrl.numSteps );
+        x = modulus.Add( x, shift );
+      };
+
+    Int gcdDelay = ctrl.gcdDelay;
+    unsigned long long xi = modulus.ToMontgomery( ctrl.x0 % n );
+    unsigned long long x2i = xi;
+    unsigned long long xiSave=xi, x2iSave=x2i;
+    unsigned long long Qi = modulus.One();
+    Int delayCounter=1, i=1;
+    while( true )
+    {
+        xAdvance( xi );
+        xAdvance( x2i );
+        xAdvance( x2i );
+        Qi = modulus.Multiply( Qi, modulus.Subtract(x2i,xi) );
+
+        if( delayCounter >= gcdDelay )
+        {
+            const unsigned long long gcd = gcdNative( Qi, n );
+            if( gcd > 1 )
+            {
+                if( gcd == n )
+                {
+                    if( gcdDelay == 1 )
+                    {
+                        RuntimeError("(x) converged before (x mod p) at i=",i);
+                    }
+                    else
+                    {
+                        if( ctrl.progress )
+                            Output("Backtracking at i=",i);
+                        i = Max( i-(gcdDelay+1), Int(0) );
+                        gcdDelay = 1;
+                        xi = xiSave;
+                        x2i = x2iSave;
+                    }
+                }
+                else
+                {
+                    if( ctrl.progress )
+                        Output("Found factor ",gcd," at i=",i); 
+                    return gcd;
+                }
+            }
+
+            delayCounter = 0;
+            xiSave = xi;
+            x2iSave = x2i;
+            Qi = modulus.One();
+        }
+        ++delayCounter;
+        ++i;
+    }
+}
+#endif // ifdef __SIZEOF_INT128__
+
 // TODO: Add the ability to set a maximum number of iterations
 inline BigInt FindFactor
 ( const BigInt& n,
@@ -24,6 +114,14 @@ inline BigInt FindFactor
   const PollardRhoCtrl& ctrl )
 {
     const BigInt& one = BigIntOne();
+#ifdef __SIZEOF_INT128__
+    if( montgomery::FitsNatively(n) )
+    {
+        const unsigned long long nNative = static_cast<unsigned long long>(n);
+        if( nNative % 2 == 1 )
+            return BigInt( FindFactorNative( nNative, a, ctrl ) );
+    }
+#endif
 
     if( a == 0 || a == -2 )
         Output("WARNING: Problematic choice of Pollard rho shift");
@@ -112,6 +210,169 @@ inline BigInt FindFactor
     }
 }
 
+// Form the levels of the product tree (modulo n) of the leaves 'Q', where
+// level zero is the leaves and the last level is the (single) root
+inline void ProductTreeMod
+( const vector<BigInt>& Q,
+  const BigInt& n,
+        vector<vector<BigInt>>& tree )
+{
+    tree.resize( 1 );
+    tree[0] = Q;
+    while( tree.back().size() > 1 )
+    {
+        const auto& level = tree.back();
+        const Int levelSize = level.size();
+        vector<BigInt> parents( (levelSize+1)/2 );
+        for( Int k=0; k<levelSize/2; ++k )
+        {
+            parents[k] = level[2*k];
+            parents[k] *= level[2*k+1];
+            parents[k] %= n;
+        }
+        if( levelSize % 2 == 1 )
+            parents.back() = level.back();
+        tree.push_back( std::move(parents) );
+    }
+}
+
+// Descend from the root of the product tree, whose GCD with n was n, towards
+// each of the leaves with a GCD of n. A proper divisor is returned as soon as
+// one is found, and otherwise the indices of the leaves with a GCD of n
+// (i.e., the sequences which converged modulo every factor at once) are
+// stored in 'failedLeaves' and one is returned.
+inline BigInt DescendProductTree
+( const vector<vector<BigInt>>& tree,
+  const BigInt& n,
+        vector<Int>& failedLeaves )
+{
+    const BigInt& one = BigIntOne();
+    failedLeaves.resize( 0 );
+    vector<Int> nodes( 1, 0 );
+    BigInt gcd;
+    for( Int level=Int(tree.size())-2; level>=0; --level )
+    {
+        const Int levelSize = tree[level].size();
+        vector<Int> children;
+        for( const Int node : nodes )
+        {
+            for( Int child=2*node; child<Min(2*node+2,levelSize); ++child )
+            {
+                GCD( tree[level][child], n, gcd );
+                if( gcd == n )
+                    children.push_back( child );
+                else if( gcd > one )
+                    return gcd;
+            }
+        }
+        nodes = std::move( children );
+    }
+    failedLeaves = nodes;
+    return one;
+}
+
+// Run ctrl.numSequences independent rho sequences in lockstep (in parallel
+// over the sequences) and test all of them for a factor at once every
+// ctrl.gcdDelay steps through the GCD of the product of their accumulated
+// products. The individual products are only examined, via the product tree,
+// when the combined GCD is n.
+inline BigInt FindFactorBatched
+( const BigInt& n,
+  const PollardRhoCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    const BigInt& one = BigIntOne();
+    const Int numSequences = Max( ctrl.numSequences, Int(1) );
+    const Int gcdDelay = Max( ctrl.gcdDelay, Int(1) );
+
+    // Avoid the problematic shifts of 0 and -2
+    Int nextShift = ctrl.a0;
+    auto NextShift =
+      [&]()
+      {
+        while( nextShift == 0 || nextShift == -2 )
+            ++nextShift;
+        return nextShift++;
+      };
+    vector<Int> shifts( numSequences );
+    vector<BigInt> xs( numSequences, ctrl.x0 ), x2s( numSequences, ctrl.x0 ),
+      Qs( numSequences );
+    for( Int s=0; s<numSequences; ++s )
+        shifts[s] = NextShift();
+
+    vector<vector<BigInt>> tree;
+    vector<Int> failedLeaves;
+    BigInt gcd;
+    const Int maxRestarts = 10*numSequences;
+    Int numRestarts = 0;
+    for( Int i=gcdDelay; true; i+=gcdDelay )
+    {
+        EL_PARALLEL_FOR
+        for( Int s=0; s<numSequences; ++s )
+        {
+            BigInt& x = xs[s];
+            BigInt& x2 = x2s[s];
+            BigInt& Q = Qs[s];
+            const Int a = shifts[s];
+            auto xAdvance =
+              [&]( BigInt& y )
+              {
+                if( ctrl.numSteps == 1 )
+                    y *= y;
+                else
+                    PowMod( y, 2*ctrl.numSteps, n, y );
+                y += a;
+                y %= n;
+              };
+            BigInt tmp;
+            Q = 1;
+            for( Int step=0; step<gcdDelay; ++step )
+            {
+                xAdvance( x );
+                xAdvance( x2 );
+                xAdvance( x2 );
+                tmp = x2;
+                tmp -= x;
+                Q *= tmp;
+                Q %= n;
+            }
+        }
+
+        ProductTreeMod( Qs, n, tree );
+        GCD( tree.back()[0], n, gcd );
+        if( gcd == one )
+            continue;
+        if( gcd != n )
+        {
+            if( ctrl.progress )
+                Output("Found factor ",gcd," at i=",i);
+            return gcd;
+        }
+        gcd = DescendProductTree( tree, n, failedLeaves );
+        if( gcd != one )
+        {
+            if( ctrl.progress )
+                Output("Found factor ",gcd," at i=",i);
+            return gcd;
+        }
+
+        // Rather than backtracking, restart each of the sequences which
+        // converged modulo n with a fresh shift
+        for( const Int s : failedLeaves )
+        {
+            if( ++numRestarts > maxRestarts )
+                RuntimeError
+                ("Too many Pollard rho sequences converged before a factor "
+                 "was found");
+            shifts[s] = NextShift();
+            xs[s] = ctrl.x0;
+            x2s[s] = ctrl.x0;
+            if( ctrl.progress )
+                Output("Restarting sequence ",s," with a=",shifts[s]);
+        }
+    }
+}
+
 } // namespace pollard_rho
 
 inline vector<BigInt> PollardRho
@@ -178,7 +439,10 @@ inline vector<BigInt> PollardRho
         BigInt factor;
         try
         {
-            factor = pollard_rho::FindFactor( nRem, ctrl.a0, ctrl );
+            if( ctrl.numSequences > 1 )
+                factor = pollard_rho::FindFactorBatched( nRem, ctrl );
+            else
+                factor = pollard_rho::FindFactor( nRem, ctrl.a0, ctrl );
         }
         catch( const exception& e ) // TODO: Introduce factor exception?
         {
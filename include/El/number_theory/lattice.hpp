@@ -103,6 +103,36 @@ Int AlgebraicRelationSearch
   Matrix<F>& U, 
   const LLLCtrl<Base<F>>& ctrl=LLLCtrl<Base<F>>() );
 
+// Batches of relation searches
+// ============================
+// Run an independent search for each column of Z (or each entry of alphas)
+// with the queries distributed cyclically over the processes of 'comm' and
+// dynamically over the threads of each process. The scaled bases of the
+// batch are formed together, and 'callback' (if nonempty) is called with the
+// index of each query, its nullity, and its reduced basis and unimodular
+// transformation as soon as that search completes on its process. The
+// nullities of all of the queries are returned on every process.
+template<typename F>
+using RelationCallback =
+  function<void(Int,Int,const Matrix<F>&,const Matrix<F>&)>;
+
+template<typename F>
+vector<Int> ZDependenceSearches
+( const Matrix<F>& Z,
+        Base<F> NSqrt,
+  const RelationCallback<F>& callback=RelationCallback<F>(),
+  const LLLCtrl<Base<F>>& ctrl=LLLCtrl<Base<F>>(),
+        mpi::Comm comm=mpi::COMM_WORLD );
+
+template<typename F>
+vector<Int> AlgebraicRelationSearches
+( const Matrix<F>& alphas,
+  Int n,
+  Base<F> NSqrt,
+  const RelationCallback<F>& callback=RelationCallback<F>(),
+  const LLLCtrl<Base<F>>& ctrl=LLLCtrl<Base<F>>(),
+        mpi::Comm comm=mpi::COMM_WORLD );
+
 } // namespace El
 
 #include <El/number_theory/lattice/Enumerate.hpp>
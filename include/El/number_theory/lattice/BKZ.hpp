@@ -62,6 +62,20 @@ struct BKZCtrl
     bool variableEnumType=false;
     function<EnumType(Int)> enumTypeFunc;
 
+    // Progressive BKZ: rather than immediately running tours with
+    // 'blocksize', start from 'progressiveStart' and raise the blocksize in
+    // increments of 'progressiveStep', skipping those for which the Gaussian
+    // heuristic does not predict that any block's leading projected norm
+    // exceeds 'progressiveGHFactor' times the expected minimum of the block.
+    // If 'progressivePruning' is true, blocksizes of at least
+    // 'pruningThreshold' use GNR_ENUM with optimized bounding functions.
+    bool progressive=false;
+    Int progressiveStart=10;
+    Int progressiveStep=2;
+    Real progressiveGHFactor=Real(1.05);
+    bool progressivePruning=true;
+    Int pruningThreshold=30;
+
     // Y-sparse enumeration supports simultaneous searches for improving a
     // contiguous window of vectors
     Int multiEnumWindow=15;
@@ -125,6 +139,13 @@ struct BKZCtrl
         variableEnumType = ctrl.variableEnumType;
         enumTypeFunc = ctrl.enumTypeFunc;
 
+        progressive = ctrl.progressive;
+        progressiveStart = ctrl.progressiveStart;
+        progressiveStep = ctrl.progressiveStep;
+        progressiveGHFactor = Real(ctrl.progressiveGHFactor);
+        progressivePruning = ctrl.progressivePruning;
+        pruningThreshold = ctrl.pruningThreshold;
+
         multiEnumWindow = ctrl.multiEnumWindow;
 
         skipInitialLLL = ctrl.skipInitialLLL;
@@ -200,6 +221,21 @@ BKZInfo<Base<F>> BKZWithQ
   Matrix<Base<F>>& d,
   const BKZCtrl<Base<F>>& ctrl=BKZCtrl<Base<F>>() );
 
+// A distributed BKZ (see BKZ/Dist.hpp) whose tour windows are reduced in
+// parallel
+template<typename F>
+BKZInfo<Base<F>> BKZ
+( AbstractDistMatrix<F>& B,
+  AbstractDistMatrix<F>& R,
+  const BKZCtrl<Base<F>>& ctrl=BKZCtrl<Base<F>>() );
+
+template<typename F>
+BKZInfo<Base<F>> BKZ
+( AbstractDistMatrix<F>& B,
+  AbstractDistMatrix<F>& U,
+  AbstractDistMatrix<F>& R,
+  const BKZCtrl<Base<F>>& ctrl=BKZCtrl<Base<F>>() );
+
 namespace bkz {
 
 static Timer enumTimer, bkzTimer;
@@ -415,6 +451,99 @@ bool TryLowerPrecisionBigFloat
 }
 #endif
 
+// Whether, under the Gaussian heuristic, an enumeration over some block of
+// size 'bsize' is expected to find a vector shorter than the block's leading
+// projected norm (which must exceed 'ghFactor' times the heuristic minimum)
+template<typename F>
+bool ExpectImprovement
+( const Matrix<F>& QR, Int rank, Int bsize, Base<F> ghFactor )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    vector<Real> logProjNorms( rank );
+    for( Int i=0; i<rank; ++i )
+        logProjNorms[i] = Log(Abs(RealPart(QR(i,i))));
+    for( Int j=0; j<rank-1; ++j )
+    {
+        const Int k = Min(j+bsize,rank);
+        Real logVol = 0;
+        for( Int i=j; i<k; ++i )
+            logVol += logProjNorms[i];
+        const Real gh = LatticeGaussianHeuristic( k-j, logVol );
+        if( Exp(logProjNorms[j]) > ghFactor*gh )
+            return true;
+    }
+    return false;
+}
+
+// Run BKZ with a sequence of increasing blocksizes, each starting from the
+// basis reduced by the previous one
+template<typename F>
+BKZInfo<Base<F>> ProgressiveBKZ
+( Matrix<F>& B,
+  Matrix<F>& U,
+  Matrix<F>& QR,
+  Matrix<F>& t,
+  Matrix<Base<F>>& d,
+  bool maintainU,
+  const BKZCtrl<Base<F>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    const Int targetBsize = ctrl.blocksize;
+    const Int step = Max(ctrl.progressiveStep,Int(1));
+    Int bsize = Max(Min(ctrl.progressiveStart,targetBsize),Int(2));
+
+    BKZCtrl<Real> ctrlMod( ctrl );
+    ctrlMod.progressive = false;
+    ctrlMod.variableBlocksize = false;
+
+    BKZInfo<Real> info;
+    Int numSwaps=0, numEnums=0, numEnumFailures=0;
+    bool firstStage = true;
+    while( true )
+    {
+        ctrlMod.blocksize = bsize;
+        ctrlMod.enumCtrl = ctrl.enumCtrl;
+        if( ctrl.progressivePruning && bsize >= ctrl.pruningThreshold &&
+            !ctrl.variableEnumType )
+        {
+            ctrlMod.enumCtrl.enumType = GNR_ENUM;
+            ctrlMod.enumCtrl.optimizedBounding = true;
+        }
+        if( !firstStage )
+        {
+            // Accumulate into U and reuse the current QR factorization
+            ctrlMod.jumpstart = true;
+            ctrlMod.startCol = 0;
+        }
+        if( ctrl.progress || ctrl.time )
+            Output("Progressive BKZ with blocksize ",bsize);
+        if( maintainU )
+            info = BKZWithQ( B, U, QR, t, d, ctrlMod );
+        else
+            info = BKZWithQ( B, QR, t, d, ctrlMod );
+        numSwaps += info.numSwaps;
+        numEnums += info.numEnums;
+        numEnumFailures += info.numEnumFailures;
+        firstStage = false;
+        if( bsize >= targetBsize )
+            break;
+
+        // Skip the blocksizes whose tours are not expected to make progress
+        Int nextBsize = Min(bsize+step,targetBsize);
+        while( nextBsize < targetBsize &&
+               !ExpectImprovement
+                ( QR, info.rank, nextBsize, ctrl.progressiveGHFactor ) )
+            nextBsize = Min(nextBsize+step,targetBsize);
+        bsize = nextBsize;
+    }
+    info.numSwaps = numSwaps;
+    info.numEnums = numEnums;
+    info.numEnumFailures = numEnumFailures;
+    return info;
+}
+
 } // namespace bkz
 
 template<typename F>
@@ -465,6 +594,9 @@ BKZInfo<Base<F>> BKZWithQ
     }
     // TODO: Allow for dropping with non-integer vectors?
 
+    if( ctrl.progressive && !ctrl.jumpstart )
+        return bkz::ProgressiveBKZ( B, U, QR, t, d, true, ctrl );
+
     if( ctrl.recursive &&
         Max(ctrl.blocksize,ctrl.lllCtrl.cutoff) < n &&
         !ctrl.jumpstart )
@@ -565,6 +697,8 @@ BKZInfo<Base<F>> BKZWithQ
         Int bsize = ctrl.blocksize;
         if( ctrl.variableBlocksize )
             bsize = ctrl.blocksizeFunc(j);
+        // Use the enumeration kernel specialized to the blocksize (if any)
+        enumCtrl.fixedDimension = bsize;
         const Int k = Min(j+bsize-1,rank-1);
         const Int h = Min(k+1,rank-1); 
         if( ctrl.checkpoint )
@@ -831,6 +965,12 @@ BKZInfo<Base<F>> BKZWithQ
     }
     // TODO: Allow for dropping with non-integer vectors?
 
+    if( ctrl.progressive && !ctrl.jumpstart )
+    {
+        Matrix<F> U;
+        return bkz::ProgressiveBKZ( B, U, QR, t, d, false, ctrl );
+    }
+
     if( ctrl.recursive &&
         Max(ctrl.blocksize,ctrl.lllCtrl.cutoff) < n &&
         !ctrl.jumpstart )
@@ -927,6 +1067,8 @@ BKZInfo<Base<F>> BKZWithQ
         Int bsize = ctrl.blocksize;
         if( ctrl.variableBlocksize )
             bsize = ctrl.blocksizeFunc(j);
+        // Use the enumeration kernel specialized to the blocksize (if any)
+        enumCtrl.fixedDimension = bsize;
         const Int k = Min(j+bsize-1,rank-1);
         const Int h = Min(k+1,rank-1); 
         if( ctrl.checkpoint )
@@ -1505,4 +1647,6 @@ BKZ
 
 } // namespace El
 
+#include <El/number_theory/lattice/BKZ/Dist.hpp>
+
 #endif // ifndef EL_LATTICE_BKZ_HPP
@@ -0,0 +1,210 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_LATTICE_BKZ_DIST_HPP
+#define EL_LATTICE_BKZ_DIST_HPP
+
+namespace El {
+namespace bkz {
+
+// A distributed BKZ in which each tour partitions the (LLL-reduced) basis
+// into disjoint windows of 'blocksize' columns -- shifting the window
+// boundaries by half of a block on alternating tours -- and reduces the
+// projected lattice R(ind,ind) of each window with the sequential BKZ. The
+// windows are dealt round-robin to the processes so that their enumerations
+// proceed in parallel, after which the unimodular transformation of each
+// window is applied to its columns of a [VC,STAR] copy of B with a local
+// Gemm and a distributed LLL restores the reduction across the window
+// boundaries. The tours stop once two consecutive tours (one per window
+// offset) fail to find any improving vector.
+
+// Apply the block-diagonal unimodular transformation given by the windows
+// to the columns of A
+template<typename F>
+void ApplyWindowTransforms
+( DistMatrix<F>& A,
+  const vector<Range<Int>>& windows,
+  const vector<Int>& packOffsets,
+  const vector<F>& packed )
+{
+    EL_DEBUG_CSE
+    DistMatrix<F,VC,STAR> ARows( A );
+    auto& ARowsLoc = ARows.Matrix();
+    const Int numWindows = windows.size();
+    for( Int w=0; w<numWindows; ++w )
+    {
+        const Int winSize = windows[w].end - windows[w].beg;
+        Matrix<F> UWin;
+        UWin.LockedAttach
+        ( winSize, winSize, &packed[packOffsets[w]], winSize );
+        auto AWin = ARowsLoc( ALL, windows[w] );
+        Matrix<F> AWinCopy( AWin );
+        Gemm( NORMAL, NORMAL, F(1), AWinCopy, UWin, F(0), AWin );
+    }
+    Copy( ARows, A );
+}
+
+template<typename F>
+BKZInfo<Base<F>> DistTours
+( DistMatrix<F>& B,
+  DistMatrix<F>& U,
+  DistMatrix<F,STAR,STAR>& R,
+  bool maintainU,
+  const BKZCtrl<Base<F>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    if( ctrl.blocksize < 2 )
+        LogicError("BKZ blocksize must be at least two");
+    const Grid& g = B.Grid();
+    const Int commRank = g.VCRank();
+    const Int commSize = g.VCSize();
+    const Int bsize = ctrl.blocksize;
+
+    Timer timer;
+    if( ctrl.time )
+        timer.Start();
+
+    auto lllInfo = lll::DistAllSwap( B, U, R, maintainU, ctrl.lllCtrl );
+    Int numSwaps = lllInfo.numSwaps;
+    Int numEnums = 0;
+    Int numEnumFailures = 0;
+
+    // The windows are reduced independently, so logging and checkpointing
+    // are disabled for them
+    auto windowCtrl( ctrl );
+    windowCtrl.time = false;
+    windowCtrl.progress = false;
+    windowCtrl.recursive = false;
+    windowCtrl.jumpstart = false;
+    windowCtrl.checkpoint = false;
+    windowCtrl.logFailedEnums = false;
+    windowCtrl.logStreakSizes = false;
+    windowCtrl.logNontrivialCoords = false;
+    windowCtrl.logNorms = false;
+    windowCtrl.logProjNorms = false;
+
+    DistMatrix<F> UNew(g);
+    Int numQuiet = 0;
+    for( Int tour=0; numQuiet<2; ++tour )
+    {
+        const Int rank = lllInfo.rank;
+        const Int offset = ( tour % 2 == 0 ? 0 : bsize/2 );
+        vector<Range<Int>> windows;
+        if( offset >= 2 )
+            windows.push_back( IR(0,Min(offset,rank)) );
+        for( Int s=offset; s<rank-1; s+=bsize )
+            windows.push_back( IR(s,Min(s+bsize,rank)) );
+        const Int numWindows = windows.size();
+
+        vector<Int> packOffsets(numWindows+1,0);
+        for( Int w=0; w<numWindows; ++w )
+        {
+            const Int winSize = windows[w].end - windows[w].beg;
+            packOffsets[w+1] = packOffsets[w] + winSize*winSize;
+        }
+        vector<F> packed( packOffsets[numWindows], F(0) );
+        vector<Int> stats( 3, 0 );
+        for( Int w=commRank; w<numWindows; w+=commSize )
+        {
+            const Int winSize = windows[w].end - windows[w].beg;
+            Matrix<F> RWin( R.LockedMatrix()( windows[w], windows[w] ) );
+            MakeTrapezoidal( UPPER, RWin );
+            Matrix<F> UWin, RWinNew;
+            auto winInfo = BKZ( RWin, UWin, RWinNew, windowCtrl );
+            Matrix<F> UWinPacked;
+            UWinPacked.Attach
+            ( winSize, winSize, &packed[packOffsets[w]], winSize );
+            UWinPacked = UWin;
+            stats[0] += winInfo.numSwaps;
+            stats[1] += winInfo.numEnums;
+            stats[2] += winInfo.numEnumFailures;
+        }
+        mpi::AllReduce( packed.data(), packed.size(), g.VCComm() );
+        mpi::AllReduce( stats.data(), stats.size(), g.VCComm() );
+        numSwaps += stats[0];
+        numEnums += stats[1];
+        numEnumFailures += stats[2];
+        const Int numImprovements = stats[1] - stats[2];
+        if( ctrl.progress )
+            OutputFromRoot
+            (g.Comm(),"Tour ",tour," with ",numWindows," windows: ",
+             numImprovements," improvements");
+        if( numImprovements == 0 )
+        {
+            ++numQuiet;
+            continue;
+        }
+        numQuiet = 0;
+
+        ApplyWindowTransforms( B, windows, packOffsets, packed );
+        if( maintainU )
+            ApplyWindowTransforms( U, windows, packOffsets, packed );
+
+        lllInfo = lll::DistAllSwap( B, UNew, R, maintainU, ctrl.lllCtrl );
+        numSwaps += lllInfo.numSwaps;
+        if( maintainU )
+        {
+            DistMatrix<F> UCopy( U );
+            Gemm( NORMAL, NORMAL, F(1), UCopy, UNew, F(0), U );
+        }
+    }
+    if( ctrl.time )
+        OutputFromRoot(g.Comm(),"Distributed BKZ took ",timer.Stop()," sec");
+
+    BKZInfo<Real> info;
+    info.delta = lllInfo.delta;
+    info.eta = lllInfo.eta;
+    info.rank = lllInfo.rank;
+    info.nullity = lllInfo.nullity;
+    info.numSwaps = numSwaps;
+    info.numEnums = numEnums;
+    info.numEnumFailures = numEnumFailures;
+    info.logVol = lllInfo.logVol;
+    return info;
+}
+
+} // namespace bkz
+
+template<typename F>
+BKZInfo<Base<F>> BKZ
+( AbstractDistMatrix<F>& BPre,
+  AbstractDistMatrix<F>& RPre,
+  const BKZCtrl<Base<F>>& ctrl )
+{
+    EL_DEBUG_CSE
+    DistMatrixReadWriteProxy<F,F,MC,MR> BProx( BPre );
+    auto& B = BProx.Get();
+    DistMatrix<F> U( B.Grid() );
+    DistMatrix<F,STAR,STAR> R( B.Grid() );
+    auto info = bkz::DistTours( B, U, R, false, ctrl );
+    Copy( R, RPre );
+    return info;
+}
+
+template<typename F>
+BKZInfo<Base<F>> BKZ
+( AbstractDistMatrix<F>& BPre,
+  AbstractDistMatrix<F>& UPre,
+  AbstractDistMatrix<F>& RPre,
+  const BKZCtrl<Base<F>>& ctrl )
+{
+    EL_DEBUG_CSE
+    DistMatrixReadWriteProxy<F,F,MC,MR> BProx( BPre );
+    DistMatrixWriteProxy<F,F,MC,MR> UProx( UPre );
+    auto& B = BProx.Get();
+    auto& U = UProx.Get();
+    DistMatrix<F,STAR,STAR> R( B.Grid() );
+    auto info = bkz::DistTours( B, U, R, true, ctrl );
+    Copy( R, RPre );
+    return info;
+}
+
+} // namespace El
+
+#endif // ifndef EL_LATTICE_BKZ_DIST_HPP
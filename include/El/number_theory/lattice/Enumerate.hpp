@@ -34,10 +34,20 @@ struct EnumCtrl
     // Explicitly transpose 'N' to encourage unit-stride access
     bool explicitTranspose=true;
 
+    // If the dimension of a FULL_ENUM or GNR_ENUM enumeration equals this
+    // value and a kernel specialized to it was compiled (see
+    // svp::HaveFixedEnumeration), use that kernel. BKZ sets this to its
+    // current blocksize.
+    Int fixedDimension=0;
+
     // GNR_ENUM
     // --------
-    // TODO: Add ability to further tune the bounding function
+    // If 'optimizedBounding' is true (and 'linearBounding' is false), use the
+    // extreme pruning coefficients numerically optimized for the dimension
+    // (see svp::OptimizedPruningCoefficients) rather than interpolating those
+    // of Aono's n=140 example.
     bool linearBounding=false;
+    bool optimizedBounding=false;
     Int numTrials=1000;
 
     // YSPARSE_ENUM
@@ -62,6 +72,21 @@ struct EnumCtrl
 
     Int progressLevel=0;
 
+    // Parallel FULL_ENUM and GNR_ENUM
+    // -------------------------------
+    // If 'parallel' is true, the enumeration tree is split 'splitDepth' levels
+    // below its root into independent subtrees which are enumerated by OpenMP
+    // tasks (and, if 'distributed' is true, cyclically distributed over the
+    // processes of 'comm', which must then all make the same call). The best
+    // norm found so far is shared between the workers so that the pruning
+    // tightens for all of them, and is exchanged between processes after each
+    // round of 'roundSize' subtrees per process.
+    bool parallel=false;
+    Int splitDepth=8;
+    bool distributed=false;
+    mpi::Comm comm=mpi::COMM_WORLD;
+    Int roundSize=16;
+
     template<typename OtherReal>
     EnumCtrl<Real>& operator=( const EnumCtrl<OtherReal>& ctrl )
     {
@@ -72,10 +97,12 @@ struct EnumCtrl
         progress = ctrl.progress;
         innerProgress = ctrl.innerProgress;
         explicitTranspose = ctrl.explicitTranspose;
+        fixedDimension = ctrl.fixedDimension;
 
         // GNR_ENUM
         // --------
         linearBounding = ctrl.linearBounding;
+        optimizedBounding = ctrl.optimizedBounding;
         numTrials = ctrl.numTrials;
 
         // YSPARSE_ENUM
@@ -97,6 +124,12 @@ struct EnumCtrl
 
         progressLevel = ctrl.progressLevel;
 
+        parallel = ctrl.parallel;
+        splitDepth = ctrl.splitDepth;
+        distributed = ctrl.distributed;
+        comm = ctrl.comm;
+        roundSize = ctrl.roundSize;
+
         return *this;
     }
 
@@ -108,6 +141,14 @@ struct EnumCtrl
 
 namespace svp {
 
+// Return the (squared, relative) bounding coefficients b_0 <= ... <= b_{n-1}=1
+// for an extreme-pruned enumeration of dimension n, where the partial norm of
+// the last j+1 coordinates is bounded by sqrt(b_j) times the radius. The
+// coefficients minimize the expected number of nodes per successful trial
+// (under the Gaussian heuristic for a GSA basis) and are cached by dimension.
+template<typename Real>
+Matrix<Real> OptimizedPruningCoefficients( Int n );
+
 // The "GNR" enumeration algorithm has been extended to support complex
 // arithmetic below by reformulating the original algorithm in terms of 
 // a vector of states, each of which allows for a simple traversal of a 
@@ -386,6 +427,26 @@ Base<F> GNREnumeration
         Matrix<F>& v,
   const EnumCtrl<Base<F>>& ctrl=EnumCtrl<Base<F>>() );
 
+// Whether GNREnumeration has a kernel specialized to the compile-time
+// dimension 'n' (currently for real single- and double-precision, with n in
+// {20,24,...,80}).
+template<typename F>
+bool HaveFixedEnumeration( Int n );
+
+// A parallel analogue of GNREnumeration which splits the enumeration tree
+// 'ctrl.splitDepth' levels below its root (see EnumCtrl). If 'stopAtFirst' is
+// true, the first lattice member found to lie under the bounds is returned;
+// otherwise the bounds are shrunk (uniformly) each time a shorter member is
+// found and the shortest member lying under the bounds is returned.
+template<typename F>
+Base<F> ParallelGNREnumeration
+( const Matrix<Base<F>>& d,
+  const Matrix<F>& N,
+  const Matrix<Base<F>>& u,
+        Matrix<F>& v,
+        bool stopAtFirst=true,
+  const EnumCtrl<Base<F>>& ctrl=EnumCtrl<Base<F>>() );
+
 // Convert to/from the so-called "y-sparse" representation of
 //
 //   Dan Ding, Guizhen Zhu, Yang Yu, and Zhongxiang Zheng,
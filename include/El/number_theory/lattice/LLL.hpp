@@ -68,7 +68,7 @@
 // ITG Workshop on Smart Antennas, pp. 106--113, 2004
 //
 // Future work will involve investigating blocked algorithms and/or
-// distributed-memory and/or GPU implementations.
+// GPU implementations.
 //
 // The seminal work on distributed-memory implementations of LLL is
 //
@@ -110,6 +110,10 @@ struct LLLInfo
     Int firstSwap;
     Real logVol;
 
+    // The seconds spent at each precision (keyed by its type name) when
+    // LLLCtrl::precisionLadder is enabled
+    std::map<string,double> precisionTimes;
+
     template<typename OtherReal>
     LLLInfo<Real>& operator=( const LLLInfo<OtherReal>& info )
     {
@@ -120,6 +124,7 @@ struct LLLInfo
         numSwaps = info.numSwaps;
         firstSwap = info.firstSwap;
         logVol = Real(info.logVol);
+        precisionTimes = info.precisionTimes;
         return *this;
     }
 
@@ -172,6 +177,31 @@ struct LLLCtrl
     // Fudge factor for determining whether to drop precision
     Real precisionFudge=Real(2);
 
+    // For integer bases, rather than running the entire (non-recursive) LLL
+    // in the working precision, process the columns in segments, each in the
+    // lowest precision of the ladder
+    //
+    //   double -> DoubleDouble -> QuadDouble -> BigFloat -> working precision
+    //
+    // which suffices (according to 'precisionFudge') for the already reduced
+    // columns and the new columns of the segment. The precision is thus only
+    // raised for the columns which need it and falls back down once they have
+    // been reduced. Not compatible with 'presort' or 'jumpstart'.
+    bool precisionLadder=false;
+
+    // Rather than size-reducing a single (m-long) column of B at a time, run
+    // a local LLL on the overlapping 2*segmentSize x 2*segmentSize diagonal
+    // blocks of the triangular factor R -- alternating between block offsets
+    // which are even and odd multiples of 'segmentSize' -- and apply each
+    // block's unimodular transformation to B with a single Gemm. A final
+    // (cheap) standard LLL pass enforces the global reduction properties.
+    // If 'parallelSegments' is true, the independent blocks of each phase are
+    // reduced in separate OpenMP tasks. Not compatible with 'presort' or
+    // 'jumpstart'.
+    bool segmented=false;
+    Int segmentSize=32;
+    bool parallelSegments=false;
+
     Int minColThresh = 0;
 
     // Ignore precision limits for QR factorization?
@@ -220,6 +250,10 @@ struct LLLCtrl
         if( eta < etaMin )
             eta = etaMin;
         precisionFudge = Real(ctrl.precisionFudge);
+        precisionLadder = ctrl.precisionLadder;
+        segmented = ctrl.segmented;
+        segmentSize = ctrl.segmentSize;
+        parallelSegments = ctrl.parallelSegments;
         minColThresh = ctrl.minColThresh;
         unsafeSizeReduct = ctrl.unsafeSizeReduct;
         variant = ctrl.variant;
@@ -253,6 +287,10 @@ struct LLLCtrl
         delta = Real(ctrl.delta);
         eta = Max(etaMin,Real(ctrl.eta));
         precisionFudge = Real(ctrl.precisionFudge);
+        precisionLadder = ctrl.precisionLadder;
+        segmented = ctrl.segmented;
+        segmentSize = ctrl.segmentSize;
+        parallelSegments = ctrl.parallelSegments;
         minColThresh = ctrl.minColThresh;
         unsafeSizeReduct = ctrl.unsafeSizeReduct;
         variant = ctrl.variant;
@@ -314,6 +352,21 @@ LLLInfo<Base<F>> LLLWithQ
   Matrix<Base<F>>& d,
   const LLLCtrl<Base<F>>& ctrl=LLLCtrl<Base<F>>() );
 
+// A distributed all-swap LLL (see LLL/Dist.hpp) for bases whose entries are
+// integers stored in the field F
+template<typename F>
+LLLInfo<Base<F>> LLL
+( AbstractDistMatrix<F>& B,
+  AbstractDistMatrix<F>& R,
+  const LLLCtrl<Base<F>>& ctrl=LLLCtrl<Base<F>>() );
+
+template<typename F>
+LLLInfo<Base<F>> LLL
+( AbstractDistMatrix<F>& B,
+  AbstractDistMatrix<F>& U,
+  AbstractDistMatrix<F>& R,
+  const LLLCtrl<Base<F>>& ctrl=LLLCtrl<Base<F>>() );
+
 namespace lll {
 
 static Timer stepTimer, houseStepTimer,
@@ -423,9 +476,34 @@ Base<F> LogVolume( const Matrix<F>& R )
 } // namespace El
 
 #include <El/number_theory/lattice/LLL/Left.hpp>
+#include <El/number_theory/lattice/LLL/Dist.hpp>
 
 namespace El {
 
+namespace lll {
+
+template<typename Z,typename F>
+LLLInfo<Base<F>> LadderLLL
+( Matrix<Z>& B,
+  Matrix<Z>& U,
+  Matrix<F>& QR,
+  Matrix<F>& t,
+  Matrix<Base<F>>& d,
+  bool maintainU,
+  const LLLCtrl<Base<F>>& ctrl );
+
+template<typename Z,typename F>
+LLLInfo<Base<F>> SegmentedLLL
+( Matrix<Z>& B,
+  Matrix<Z>& U,
+  Matrix<F>& QR,
+  Matrix<F>& t,
+  Matrix<Base<F>>& d,
+  bool maintainU,
+  const LLLCtrl<Base<F>>& ctrl );
+
+} // namespace lll
+
 template<typename Z, typename F>
 LLLInfo<Base<F>> LLLWithQ
 ( Matrix<Z>& B,
@@ -448,6 +526,11 @@ LLLInfo<Base<F>> LLLWithQ
         ("eta=",ctrl.eta," should be in (1/2,sqrt(delta)=",
          Sqrt(ctrl.delta),")");
 
+    if( ctrl.precisionLadder && !ctrl.presort && !ctrl.jumpstart )
+        return lll::LadderLLL( B, U, QR, t, d, true, ctrl );
+    if( ctrl.segmented && !ctrl.presort && !ctrl.jumpstart )
+        return lll::SegmentedLLL( B, U, QR, t, d, true, ctrl );
+
     if( ctrl.jumpstart )
     {
         if( U.Height() != n || U.Width() != n )
@@ -532,6 +615,17 @@ LLLWithQ
         ("eta=",ctrl.eta," should be in (1/2,sqrt(delta)=",
          Sqrt(ctrl.delta),")");
 
+    if( ctrl.precisionLadder && !ctrl.presort && !ctrl.jumpstart )
+    {
+        Matrix<Z> U;
+        return lll::LadderLLL( B, U, QR, t, d, false, ctrl );
+    }
+    if( ctrl.segmented && !ctrl.presort && !ctrl.jumpstart )
+    {
+        Matrix<Z> U;
+        return lll::SegmentedLLL( B, U, QR, t, d, false, ctrl );
+    }
+
     Int firstSwap = n;
     if( ctrl.presort )
     {
@@ -813,6 +907,449 @@ bool TryLowerPrecisionBigFloatMerge
 }
 #endif
 
+// Run a non-recursive LLL over the first 'end' columns of B in the precision
+// RealLower and, if 'maintainU' is true, accumulate the transformation into
+// the first 'end' columns of U
+template<typename Z,typename F,typename RealLower>
+LLLInfo<Base<F>>
+LadderSegment
+(       Matrix<Z>& B,
+        Matrix<Z>& U,
+        Matrix<F>& QR,
+        Matrix<F>& t,
+        Matrix<Base<F>>& d,
+        Int end,
+        bool maintainU,
+  const LLLCtrl<Base<F>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef ConvertBase<F,RealLower> FLower;
+    typedef ConvertBase<Z,RealLower> ZLower;
+    const string typeString = TypeName<RealLower>();
+    if( ctrl.progress )
+        Output("  Running LLL on columns [0,",end,") in ",typeString);
+
+    auto BSeg = B( ALL, IR(0,end) );
+    Matrix<ZLower> BLower;
+    Copy( BSeg, BLower );
+
+    LLLCtrl<RealLower> ctrlLower( ctrl );
+    ctrlLower.recursive = false;
+    ctrlLower.precisionLadder = false;
+    RealLower eps = limits::Epsilon<RealLower>();
+    RealLower minEta = RealLower(1)/RealLower(2)+Pow(eps,RealLower(0.9));
+    ctrlLower.eta = Max(minEta,ctrlLower.eta);
+
+    Timer timer;
+    timer.Start();
+    LLLInfo<RealLower> infoLower;
+    Matrix<ZLower> UNewLower;
+    Matrix<FLower> QRLower, tLower;
+    Matrix<RealLower> dLower;
+    if( maintainU )
+        infoLower =
+          LLLWithQ( BLower, UNewLower, QRLower, tLower, dLower, ctrlLower );
+    else
+        infoLower = LLLWithQ( BLower, QRLower, tLower, dLower, ctrlLower );
+    const double segmentTime = timer.Stop();
+    if( ctrl.time )
+        Output("  ",typeString," LLL took ",segmentTime," seconds");
+
+    Copy( BLower, BSeg );
+    Copy( QRLower, QR );
+    Copy( tLower, t );
+    Copy( dLower, d );
+    if( maintainU )
+    {
+        Matrix<Z> UNew;
+        Copy( UNewLower, UNew );
+        auto USeg = U( ALL, IR(0,end) );
+        auto USegCopy( USeg );
+        Gemm( NORMAL, NORMAL, Z(1), USegCopy, UNew, Z(0), USeg );
+    }
+
+    LLLInfo<Base<F>> info;
+    info = infoLower;
+    info.precisionTimes[typeString] += segmentTime;
+    return info;
+}
+
+template<typename Z,typename F,typename RealLower>
+bool TryLadderSegment
+(       Matrix<Z>& B,
+        Matrix<Z>& U,
+        Matrix<F>& QR,
+        Matrix<F>& t,
+        Matrix<Base<F>>& d,
+        Int end,
+        bool maintainU,
+  const LLLCtrl<Base<F>>& ctrl,
+        unsigned neededPrec,
+        LLLInfo<Base<F>>& info )
+{
+    bool succeeded = false;
+    if( MantissaIsLonger<Base<F>,RealLower>::value &&
+        MantissaBits<RealLower>::value >= neededPrec )
+    {
+        // Keep a copy of B (and U) so that a failed attempt can be retried in
+        // a higher precision
+        auto BSeg = B( ALL, IR(0,end) );
+        auto BSegCopy( BSeg );
+        Matrix<Z> USegCopy;
+        if( maintainU )
+            USegCopy = U( ALL, IR(0,end) );
+        try
+        {
+            info = LadderSegment<Z,F,RealLower>
+              ( B, U, QR, t, d, end, maintainU, ctrl );
+            succeeded = true;
+        }
+        catch( std::exception& e )
+        {
+            Output("e.what()=",e.what());
+            BSeg = BSegCopy;
+            if( maintainU )
+            {
+                auto USeg = U( ALL, IR(0,end) );
+                USeg = USegCopy;
+            }
+        }
+    }
+    return succeeded;
+}
+
+#ifdef EL_HAVE_MPC
+template<typename Z,typename F>
+bool TryBigFloatLadderSegment
+(       Matrix<Z>& B,
+        Matrix<Z>& U,
+        Matrix<F>& QR,
+        Matrix<F>& t,
+        Matrix<Base<F>>& d,
+        Int end,
+        bool maintainU,
+  const LLLCtrl<Base<F>>& ctrl,
+        unsigned neededPrec,
+        LLLInfo<Base<F>>& info )
+{
+    bool succeeded = false;
+    if( !IsFixedPrecision<Base<F>>::value )
+    {
+        // As in TryLowerPrecisionBigFloatMerge, only drop to a lower MPFR
+        // precision if the jump is substantial
+        const mpfr_prec_t minPrecDiff = 32;
+        mpfr_prec_t inputPrec = mpfr::Precision();
+        if( neededPrec <= inputPrec-minPrecDiff )
+        {
+            auto BSeg = B( ALL, IR(0,end) );
+            auto BSegCopy( BSeg );
+            Matrix<Z> USegCopy;
+            if( maintainU )
+                USegCopy = U( ALL, IR(0,end) );
+            mpfr::SetPrecision( neededPrec );
+            try
+            {
+                info = LadderSegment<Z,F,BigFloat>
+                  ( B, U, QR, t, d, end, maintainU, ctrl );
+                succeeded = true;
+            }
+            catch( std::exception& e )
+            {
+                Output("e.what()=",e.what());
+            }
+            mpfr::SetPrecision( inputPrec );
+            if( !succeeded )
+            {
+                BSeg = BSegCopy;
+                if( maintainU )
+                {
+                    auto USeg = U( ALL, IR(0,end) );
+                    USeg = USegCopy;
+                }
+            }
+        }
+    }
+    return succeeded;
+}
+#endif
+
+// The number of bits of precision needed (according to 'precisionFudge') to
+// process column j of the integer matrix B
+template<typename Z,typename Real>
+unsigned LadderBits( const Matrix<Z>& B, Int j, Real fudge )
+{
+    const Real colOneNorm = Real(OneNorm( B( ALL, IR(j) ) ));
+    if( colOneNorm <= Real(2) )
+        return 1;
+    return unsigned(Ceil(Log2(colOneNorm)*fudge));
+}
+
+// The number of mantissa bits of the lowest precision of the ladder which
+// provides at least 'neededPrec' bits (with BigFloat taken to provide any
+// precision below that of Real)
+template<typename Real>
+unsigned LadderLevelBits( unsigned neededPrec )
+{
+    const unsigned workingBits = MantissaBits<Real>::value;
+    if( neededPrec <= MantissaBits<double>::value &&
+        MantissaIsLonger<Real,double>::value )
+        return MantissaBits<double>::value;
+#ifdef EL_HAVE_QD
+    if( neededPrec <= MantissaBits<DoubleDouble>::value &&
+        MantissaIsLonger<Real,DoubleDouble>::value )
+        return MantissaBits<DoubleDouble>::value;
+    if( neededPrec <= MantissaBits<QuadDouble>::value &&
+        MantissaIsLonger<Real,QuadDouble>::value )
+        return MantissaBits<QuadDouble>::value;
+#endif
+    return workingBits;
+}
+
+template<typename Z,typename F>
+LLLInfo<Base<F>> LadderLLL
+( Matrix<Z>& B,
+  Matrix<Z>& U,
+  Matrix<F>& QR,
+  Matrix<F>& t,
+  Matrix<Base<F>>& d,
+  bool maintainU,
+  const LLLCtrl<Base<F>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    const Int n = B.Width();
+    auto ctrlMod( ctrl );
+    ctrlMod.precisionLadder = false;
+    if( !IsInteger( B ) )
+    {
+        if( maintainU )
+            return LLLWithQ( B, U, QR, t, d, ctrlMod );
+        else
+            return LLLWithQ( B, QR, t, d, ctrlMod );
+    }
+    if( maintainU )
+        Identity( U, n, n );
+
+    const Real fudge = ctrl.precisionFudge;
+    vector<unsigned> colBits(n);
+    for( Int j=0; j<n; ++j )
+        colBits[j] = LadderBits( B, j, fudge );
+
+    LLLInfo<Real> info;
+    Int numSwaps = 0;
+    Int firstSwap = n;
+    std::map<string,double> precisionTimes;
+    Int processed = 0;
+    unsigned prefixBits = 0;
+    while( processed < n )
+    {
+        // Extend the segment while the new columns do not require a higher
+        // precision than the lowest one sufficient for its first column
+        const unsigned levelBits =
+          LadderLevelBits<Real>( Max(prefixBits,colBits[processed]) );
+        Int end = processed+1;
+        while( end < n && colBits[end] <= levelBits )
+            ++end;
+        unsigned neededPrec = prefixBits;
+        for( Int j=processed; j<end; ++j )
+            neededPrec = Max(neededPrec,colBits[j]);
+
+        bool succeeded = TryLadderSegment<Z,F,double>
+          ( B, U, QR, t, d, end, maintainU, ctrlMod, neededPrec, info );
+#ifdef EL_HAVE_QD
+        if( !succeeded )
+            succeeded = TryLadderSegment<Z,F,DoubleDouble>
+              ( B, U, QR, t, d, end, maintainU, ctrlMod, neededPrec, info );
+        if( !succeeded )
+            succeeded = TryLadderSegment<Z,F,QuadDouble>
+              ( B, U, QR, t, d, end, maintainU, ctrlMod, neededPrec, info );
+#endif
+#ifdef EL_HAVE_MPC
+        if( !succeeded )
+            succeeded = TryBigFloatLadderSegment<Z,F>
+              ( B, U, QR, t, d, end, maintainU, ctrlMod, neededPrec, info );
+#endif
+        if( !succeeded )
+            info = LadderSegment<Z,F,Real>
+              ( B, U, QR, t, d, end, maintainU, ctrlMod );
+
+        numSwaps += info.numSwaps;
+        firstSwap = Min(firstSwap,info.firstSwap);
+        for( const auto& entry : info.precisionTimes )
+            precisionTimes[entry.first] += entry.second;
+
+        // The reduced columns typically need far less precision
+        processed = end;
+        prefixBits = 0;
+        for( Int j=0; j<processed; ++j )
+            prefixBits = Max(prefixBits,LadderBits(B,j,fudge));
+    }
+    info.numSwaps = numSwaps;
+    info.firstSwap = firstSwap;
+    info.precisionTimes = precisionTimes;
+    if( ctrl.time )
+        for( const auto& entry : precisionTimes )
+            Output("  ",entry.first," LLL: ",entry.second," seconds");
+    return info;
+}
+
+// Run LLL on the diagonal block R(ind,ind) of the triangular factor of B
+// (i.e., on the projection of B(:,ind) orthogonal to B(:,0:ind.beg)) and
+// apply the resulting unimodular transformation to B(:,ind) (and U(:,ind))
+// with a single Gemm. Returns the number of swaps.
+template<typename Z,typename F>
+Int ReduceSegment
+(       Matrix<Z>& B,
+        Matrix<Z>& U,
+  const Matrix<F>& R,
+        Range<Int> ind,
+        bool maintainU,
+  const LLLCtrl<Base<F>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    Matrix<F> RSeg( R( ind, ind ) );
+    MakeTrapezoidal( UPPER, RSeg );
+
+    Matrix<F> USeg, QRSeg, tSeg;
+    Matrix<Real> dSeg;
+    const LLLInfo<Real> segInfo =
+      LLLWithQ( RSeg, USeg, QRSeg, tSeg, dSeg, ctrl );
+    if( segInfo.numSwaps == 0 )
+        return 0;
+
+    // The transformation is integral, but was accumulated in F
+    Round( USeg );
+    Matrix<Z> USegZ;
+    Copy( USeg, USegZ );
+    auto BSeg = B( ALL, ind );
+    auto BSegCopy( BSeg );
+    Gemm( NORMAL, NORMAL, Z(1), BSegCopy, USegZ, Z(0), BSeg );
+    if( maintainU )
+    {
+        auto UInd = U( ALL, ind );
+        auto UIndCopy( UInd );
+        Gemm( NORMAL, NORMAL, Z(1), UIndCopy, USegZ, Z(0), UInd );
+    }
+    return segInfo.numSwaps;
+}
+
+// A segment LLL in the spirit of
+//
+//   Henrik Koy and Claus Peter Schnorr,
+//   "Segment LLL-Reduction of Lattice Bases",
+//   Cryptography and Lattices, LNCS 2146, pp. 67--80, 2001.
+//
+// Pairs of adjacent segments are LLL-reduced within the (small) triangular
+// factor so that the m x n basis is only touched by one Gemm per pair.
+template<typename Z,typename F>
+LLLInfo<Base<F>> SegmentedLLL
+( Matrix<Z>& B,
+  Matrix<Z>& U,
+  Matrix<F>& QR,
+  Matrix<F>& t,
+  Matrix<Base<F>>& d,
+  bool maintainU,
+  const LLLCtrl<Base<F>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    const Int m = B.Height();
+    const Int n = B.Width();
+    const Int segSize = Max(ctrl.segmentSize,Int(1));
+    auto ctrlMod( ctrl );
+    ctrlMod.segmented = false;
+    ctrlMod.precisionLadder = false;
+    ctrlMod.recursive = false;
+    if( m < n || n <= 2*segSize || !IsInteger( B ) )
+    {
+        if( maintainU )
+            return LLLWithQ( B, U, QR, t, d, ctrlMod );
+        else
+            return LLLWithQ( B, QR, t, d, ctrlMod );
+    }
+    if( maintainU )
+        Identity( U, n, n );
+
+    Timer timer;
+    if( ctrl.time )
+        timer.Start();
+    Int numSwaps = 0;
+    // The sweeps are only bounded for the sake of robustness, as the final
+    // standard LLL pass is responsible for the reduction guarantees
+    const Int maxSweeps = n;
+    for( Int sweep=0; sweep<maxSweeps; ++sweep )
+    {
+        Int sweepSwaps = 0;
+        for( Int offset=0; offset<2*segSize; offset+=segSize )
+        {
+            Matrix<F> R;
+            Copy( B, R );
+            El::QR( R, t, d );
+
+            vector<Range<Int>> segInds;
+            for( Int s=offset; s<n-1; s+=2*segSize )
+                segInds.push_back( IR(s,Min(s+2*segSize,n)) );
+            const Int numSegs = segInds.size();
+            vector<Int> segSwaps( numSegs, 0 );
+            if( ctrl.parallelSegments )
+            {
+#ifdef EL_HYBRID
+                #pragma omp parallel
+                #pragma omp single
+#endif
+                {
+                    for( Int seg=0; seg<numSegs; ++seg )
+                    {
+#ifdef EL_HYBRID
+                        #pragma omp task firstprivate(seg)
+#endif
+                        segSwaps[seg] = ReduceSegment
+                          ( B, U, R, segInds[seg], maintainU, ctrlMod );
+                    }
+#ifdef EL_HYBRID
+                    #pragma omp taskwait
+#endif
+                }
+            }
+            else
+            {
+                for( Int seg=0; seg<numSegs; ++seg )
+                    segSwaps[seg] = ReduceSegment
+                      ( B, U, R, segInds[seg], maintainU, ctrlMod );
+            }
+            for( Int seg=0; seg<numSegs; ++seg )
+                sweepSwaps += segSwaps[seg];
+        }
+        numSwaps += sweepSwaps;
+        if( ctrl.progress )
+            Output("Segment sweep ",sweep,": ",sweepSwaps," swaps");
+        if( sweepSwaps == 0 )
+            break;
+    }
+    if( ctrl.time )
+        Output("  Segment sweeps took ",timer.Stop()," seconds");
+
+    // Enforce size reduction and the Lovasz condition across the segment
+    // boundaries
+    LLLInfo<Real> info;
+    if( maintainU )
+    {
+        Matrix<Z> UFinal;
+        info = LLLWithQ( B, UFinal, QR, t, d, ctrlMod );
+        auto UCopy( U );
+        Gemm( NORMAL, NORMAL, Z(1), UCopy, UFinal, Z(0), U );
+    }
+    else
+    {
+        info = LLLWithQ( B, QR, t, d, ctrlMod );
+    }
+    if( numSwaps > 0 )
+        info.firstSwap = 0;
+    info.numSwaps += numSwaps;
+    return info;
+}
+
 template<typename Z,typename F>
 LLLInfo<Base<F>>
 RecursiveHelper
@@ -0,0 +1,365 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_LATTICE_LLL_DIST_HPP
+#define EL_LATTICE_LLL_DIST_HPP
+
+namespace El {
+namespace lll {
+
+// A distributed-memory LLL based upon the "all swaps" algorithm of Villard
+// discussed at the top of LLL.hpp. Each sweep
+//
+//   1. refreshes the triangular factor, R, of the active columns of B via a
+//      distributed Householder QR factorization and replicates it,
+//   2. size-reduces every column against the preceding ones at once: the
+//      nearest-plane reduction of column j only reads columns 0:j-1 of the
+//      (unmodified) R, so each process independently reduces its columns
+//      of a [STAR,VR] copy of R while forming the same columns of a unit
+//      upper-triangular unimodular matrix V, and B := B V is then applied
+//      with a single (Gemm-based) distributed Trmm,
+//   3. swaps each pair (b_i,b_{i+1}) with even i which violates the Lovasz
+//      condition; since the pairs are disjoint, each swap is repaired by an
+//      independent Givens rotation of the replicated R, and the column swaps
+//      of B are applied as a single permutation,
+//   4. and repeats the size reduction and swaps for odd i.
+//
+// The iteration stops once two consecutive phases require neither size
+// reductions nor swaps, at which point the basis satisfies the same (delta,
+// eta) conditions as the sequential algorithm. As in MLLL, columns whose
+// projections become (numerically) zero are moved to the end of the basis.
+//
+// The entries of B are assumed to be integers stored in the field F.
+
+// Force the diagonal of R to be non-negative by rescaling its rows
+template<typename F>
+void NormalizeDiagonal( Matrix<F>& R )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    const Int n = R.Width();
+    const Int minDim = Min(R.Height(),n);
+    for( Int i=0; i<minDim; ++i )
+    {
+        const Real rhoAbs = Abs(R(i,i));
+        if( rhoAbs == Real(0) )
+            continue;
+        const F phase = Conj(R(i,i)) / rhoAbs;
+        for( Int j=i+1; j<n; ++j )
+            R(i,j) *= phase;
+        R(i,i) = rhoAbs;
+    }
+}
+
+template<typename F>
+void DistRefreshR( const DistMatrix<F>& B, DistMatrix<F,STAR,STAR>& R )
+{
+    EL_DEBUG_CSE
+    const Grid& g = B.Grid();
+    const Int m = B.Height();
+    const Int n = B.Width();
+    DistMatrix<F> QR( B );
+    DistMatrix<F,MD,STAR> householderScalars(g);
+    DistMatrix<Base<F>,MD,STAR> signature(g);
+    El::QR( QR, householderScalars, signature );
+    Copy( QR( IR(0,Min(m,n)), ALL ), R );
+    MakeTrapezoidal( UPPER, R );
+    NormalizeDiagonal( R.Matrix() );
+}
+
+// Size-reduce all of the columns of the replicated R at once, overwriting
+// RLoc with the reduced columns and V with the unimodular transformation.
+// Returns the total number of reductions.
+template<typename F>
+Int DistSizeReduce
+( const DistMatrix<F,STAR,STAR>& R,
+        DistMatrix<F,STAR,VR>& RLoc,
+        DistMatrix<F,STAR,VR>& V,
+  const LLLCtrl<Base<F>>& ctrl )
+{
+    EL_DEBUG_CSE
+    const Int rHeight = R.Height();
+    const Int n = R.Width();
+    Copy( R, RLoc );
+    Identity( V, n, n );
+
+    const F* RBuf = R.LockedBuffer();
+    const Int RLDim = R.LDim();
+    const Int nLoc = RLoc.LocalWidth();
+    Int numReductions = 0;
+    for( Int jLoc=0; jLoc<nLoc; ++jLoc )
+    {
+        const Int j = RLoc.GlobalCol(jLoc);
+        F* rBuf = RLoc.Buffer(0,jLoc);
+        F* vBuf = V.Buffer(0,jLoc);
+
+        // A weak reduction only involves the superdiagonal
+        const Int iEnd = Min(j,rHeight);
+        const Int iBeg =
+          ( ctrl.variant == LLL_WEAK ? Max(iEnd-1,Int(0)) : Int(0) );
+        for( Int i=iEnd-1; i>=iBeg; --i )
+        {
+            const F rho_ii = RBuf[i+i*RLDim];
+            if( Abs(rho_ii) <= ctrl.zeroTol )
+                continue;
+            const F chi = Round( rBuf[i]/rho_ii );
+            if( chi == F(0) )
+                continue;
+            blas::Axpy( i+1, -chi, &RBuf[i*RLDim], 1, rBuf, 1 );
+            vBuf[i] -= chi;
+            ++numReductions;
+        }
+    }
+    return mpi::AllReduce( numReductions, V.DistComm() );
+}
+
+// Move the columns of the basis with (numerically) zero projections to its
+// end (preserving the order of the remaining columns) and explicitly zero
+// them. Returns the number of such columns.
+template<typename F>
+Int DistDropZeroColumns
+( const DistMatrix<F,STAR,STAR>& R,
+        DistMatrix<F>& B,
+        DistMatrix<F>& U,
+        bool maintainU,
+  const LLLCtrl<Base<F>>& ctrl )
+{
+    EL_DEBUG_CSE
+    const Int rHeight = R.Height();
+    const Int n = R.Width();
+    vector<Int> zeroCols;
+    for( Int j=0; j<n; ++j )
+    {
+        const Int height = Min(j+1,rHeight);
+        if( blas::Nrm2( height, R.LockedBuffer(0,j), 1 ) <= ctrl.zeroTol )
+            zeroCols.push_back( j );
+    }
+    const Int numZero = zeroCols.size();
+    if( numZero == 0 )
+        return 0;
+
+    DistPermutation P( B.Grid() );
+    P.MakeIdentity( n );
+    P.ReserveSwaps( numZero*n );
+    Int end = n;
+    for( Int k=numZero-1; k>=0; --k, --end )
+        for( Int j=zeroCols[k]; j<end-1; ++j )
+            P.Swap( j, j+1 );
+    if( maintainU )
+        P.PermuteCols( vector<AbstractDistMatrix<F>*>{&B,&U} );
+    else
+        P.PermuteCols( B );
+
+    auto BZero = B( ALL, IR(n-numZero,n) );
+    Zero( BZero );
+    return numZero;
+}
+
+// Swap each of the disjoint pairs (b_i,b_{i+1}), with i of the given parity,
+// which violate the Lovasz condition and update the replicated R with an
+// independent Givens rotation per swap. Returns the number of swaps.
+template<typename F>
+Int DistSwapPhase
+( Int parity,
+  DistMatrix<F,STAR,STAR>& R,
+  DistMatrix<F>& B,
+  DistMatrix<F>& U,
+  bool maintainU,
+  Int& firstSwap,
+  const LLLCtrl<Base<F>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    auto& RMat = R.Matrix();
+    const Int rHeight = R.Height();
+    const Int n = R.Width();
+
+    DistPermutation P( B.Grid() );
+    P.MakeIdentity( n );
+    P.ReserveSwaps( n/2+1 );
+    Int numSwaps = 0;
+    for( Int i=parity; i+1<rHeight; i+=2 )
+    {
+        const Real rho_i_i = Abs(RMat(i,i));
+        const Real rho_i_ip1 = Abs(RMat(i,i+1));
+        const Real rho_ip1_ip1 = Abs(RMat(i+1,i+1));
+        if( ctrl.delta*rho_i_i*rho_i_i <=
+            rho_ip1_ip1*rho_ip1_ip1 + rho_i_ip1*rho_i_ip1 )
+            continue;
+
+        ColSwap( RMat, i, i+1 );
+        Real c; F s;
+        Givens( RMat(i,i), RMat(i+1,i), c, s );
+        RotateRows( c, s, RMat, i, i+1 );
+        RMat(i+1,i) = 0;
+
+        P.Swap( i, i+1 );
+        firstSwap = Min(firstSwap,i);
+        ++numSwaps;
+    }
+    if( numSwaps > 0 )
+    {
+        if( maintainU )
+            P.PermuteCols( vector<AbstractDistMatrix<F>*>{&B,&U} );
+        else
+            P.PermuteCols( B );
+    }
+    return numSwaps;
+}
+
+template<typename F>
+LLLInfo<Base<F>> DistAllSwap
+( DistMatrix<F>& B,
+  DistMatrix<F>& U,
+  DistMatrix<F,STAR,STAR>& R,
+  bool maintainU,
+  const LLLCtrl<Base<F>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    if( ctrl.delta < Real(1)/Real(2) )
+        LogicError("delta is assumed to be at least 1/2");
+    if( ctrl.eta <= Real(1)/Real(2) || ctrl.eta >= Sqrt(ctrl.delta) )
+        LogicError
+        ("eta=",ctrl.eta," should be in (1/2,sqrt(delta)=",
+         Sqrt(ctrl.delta),")");
+    if( ctrl.variant == LLL_DEEP || ctrl.variant == LLL_DEEP_REDUCE )
+        LogicError("Deep insertion is not supported by distributed LLL");
+
+    const Grid& g = B.Grid();
+    const Int m = B.Height();
+    const Int n = B.Width();
+    if( maintainU )
+        Identity( U, n, n );
+
+    Timer timer;
+    if( ctrl.time )
+        timer.Start();
+
+    DistMatrix<F,STAR,VR> RLoc(g), V(g);
+    Int nActive = n;
+    Int numSwaps = 0;
+    Int firstSwap = n;
+    Int parity = 0;
+    Int numQuiet = 0;
+    bool refresh = true;
+    for( Int phase=0; numQuiet<2; ++phase )
+    {
+        auto BActive = B( ALL, IR(0,nActive) );
+        DistMatrix<F> UActive(g);
+        if( maintainU )
+            View( UActive, U, ALL, IR(0,nActive) );
+        if( refresh )
+        {
+            DistRefreshR( BActive, R );
+            refresh = false;
+        }
+
+        const Int numReductions = DistSizeReduce( R, RLoc, V, ctrl );
+        if( numReductions > 0 )
+        {
+            Trmm( RIGHT, UPPER, NORMAL, UNIT, F(1), V, BActive );
+            if( maintainU )
+                Trmm( RIGHT, UPPER, NORMAL, UNIT, F(1), V, UActive );
+            Copy( RLoc, R );
+            numQuiet = 0;
+        }
+
+        const Int numZero =
+          DistDropZeroColumns( R, BActive, UActive, maintainU, ctrl );
+        if( numZero > 0 )
+        {
+            nActive -= numZero;
+            refresh = true;
+            numQuiet = 0;
+            continue;
+        }
+
+        const Int phaseSwaps =
+          DistSwapPhase
+          ( parity, R, BActive, UActive, maintainU, firstSwap, ctrl );
+        numSwaps += phaseSwaps;
+        numQuiet = ( phaseSwaps == 0 ? numQuiet+1 : 0 );
+        if( ctrl.progress )
+            OutputFromRoot
+            (g.Comm(),"Phase ",phase,": ",numReductions," reductions and ",
+             phaseSwaps," swaps");
+
+        // Refresh R once per sweep so that the rounding errors from the
+        // Givens rotations and size reductions do not accumulate
+        parity = 1-parity;
+        if( parity == 0 && numQuiet == 0 )
+            refresh = true;
+    }
+    if( ctrl.time )
+        OutputFromRoot(g.Comm(),"  Distributed LLL took ",timer.Stop()," sec");
+
+    // Pad R with the zero columns
+    DistMatrix<F,STAR,STAR> RActive( R );
+    NormalizeDiagonal( RActive.Matrix() );
+    Zeros( R, Min(m,n), n );
+    auto RLeft = R.Matrix()( IR(0,RActive.Height()), IR(0,nActive) );
+    RLeft = RActive.LockedMatrix();
+
+    std::pair<Real,Real> achieved = lll::Achieved(R.LockedMatrix(),ctrl);
+    Real logVol = lll::LogVolume(R.LockedMatrix());
+
+    LLLInfo<Real> info;
+    info.delta = achieved.first;
+    info.eta = achieved.second;
+    info.rank = nActive;
+    info.nullity = n-nActive;
+    info.numSwaps = numSwaps;
+    info.firstSwap = firstSwap;
+    info.logVol = logVol;
+    return info;
+}
+
+} // namespace lll
+
+template<typename F>
+LLLInfo<Base<F>> LLL
+( AbstractDistMatrix<F>& BPre,
+  AbstractDistMatrix<F>& RPre,
+  const LLLCtrl<Base<F>>& ctrl )
+{
+    EL_DEBUG_CSE
+    if( ctrl.jumpstart && ctrl.startCol > 0 )
+        LogicError("Cannot jumpstart distributed LLL");
+    DistMatrixReadWriteProxy<F,F,MC,MR> BProx( BPre );
+    auto& B = BProx.Get();
+    DistMatrix<F> U( B.Grid() );
+    DistMatrix<F,STAR,STAR> R( B.Grid() );
+    auto info = lll::DistAllSwap( B, U, R, false, ctrl );
+    Copy( R, RPre );
+    return info;
+}
+
+template<typename F>
+LLLInfo<Base<F>> LLL
+( AbstractDistMatrix<F>& BPre,
+  AbstractDistMatrix<F>& UPre,
+  AbstractDistMatrix<F>& RPre,
+  const LLLCtrl<Base<F>>& ctrl )
+{
+    EL_DEBUG_CSE
+    if( ctrl.jumpstart && ctrl.startCol > 0 )
+        LogicError("Cannot jumpstart distributed LLL");
+    DistMatrixReadWriteProxy<F,F,MC,MR> BProx( BPre );
+    DistMatrixWriteProxy<F,F,MC,MR> UProx( UPre );
+    auto& B = BProx.Get();
+    auto& U = UProx.Get();
+    DistMatrix<F,STAR,STAR> R( B.Grid() );
+    auto info = lll::DistAllSwap( B, U, R, true, ctrl );
+    Copy( R, RPre );
+    return info;
+}
+
+} // namespace El
+
+#endif // ifndef EL_LATTICE_LLL_DIST_HPP
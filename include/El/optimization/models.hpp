@@ -251,7 +251,8 @@ namespace NNLSApproachNS {
 enum NNLSApproach {
     NNLS_ADMM, // The ADMM implementation is still a prototype
     NNLS_QP,
-    NNLS_SOCP
+    NNLS_SOCP,
+    NNLS_ACTIVE_SET
 };
 } // namespace NNLSApproachNS
 using namespace NNLSApproachNS;
@@ -262,6 +263,11 @@ struct NNLSCtrl {
   ADMMCtrl<Real> admmCtrl;
   qp::direct::Ctrl<Real> qpCtrl;
   socp::affine::Ctrl<Real> socpCtrl;
+
+  // The Lawson-Hanson active-set method (with Cholesky up/downdates of the
+  // cached Gram matrix) stops once no dual value outside of the passive set
+  // exceeds 'activeSetTol' times the max norm of A^T b.
+  Real activeSetTol=Pow(limits::Epsilon<Real>(),Real(0.75));
 };
 
 template<typename Real>
@@ -350,10 +356,24 @@ void RNNLS
 
 // Non-negative matrix factorization
 // =================================
+namespace NMFApproachNS {
+enum NMFApproach
+{
+    // Alternate between full NNLS solves for each factor
+    NMF_ALTERNATING_NNLS,
+    // Hierarchical Alternating Least Squares: a single sweep of exact
+    // coordinate descent over the columns of each factor, where the rows of
+    // a factor are updated independently (and in parallel)
+    NMF_HALS
+};
+}
+using namespace NMFApproachNS;
+
 template<typename Real>
 struct NMFCtrl {
   NNLSCtrl<Real> nnlsCtrl;
   Int maxIter=20;
+  NMFApproach approach=NMF_ALTERNATING_NNLS;
 };
 
 template<typename Real>
@@ -466,6 +486,116 @@ void EN
         DistMultiVec<Real>& x,
   const qp::affine::Ctrl<Real>& ctrl=qp::affine::Ctrl<Real>() );
 
+// Regularization paths for BPDN and the elastic net
+// =================================================
+// Solve
+//
+//   min (1/2) || b - A x ||_2^2 + lambda_k || x ||_1 + lambda_2 || x ||_2^2
+//
+// (BPDN when lambda_2 = 0, and the same scaling as the QP used by EN) for
+// each entry lambda_k of the decreasing column vector 'lambdas' and return
+// the solutions side-by-side, i.e., X(:,k) corresponds to lambda_k.
+//
+// Each problem is solved by cyclic coordinate descent warm-started from the
+// solution for the previous parameter, and the sequential strong rule of
+// Tibshirani et al. discards feature j from the solve for lambda_k if
+//
+//   | a_j^T (b - A x(lambda_{k-1})) | < 2 lambda_k - lambda_{k-1}.
+//
+// The discarded features are then checked against the optimality conditions
+// and added back (followed by a re-solve) if they are violated, so that the
+// screening is safe. Within a solve, sweeps over the nonzero coefficients
+// are repeated until convergence before each sweep over the full set.
+//
+// Since each coordinate update only touches a single column of A, the
+// sparse versions work with the columns of A (i.e., the rows of A^T), and
+// the distributed versions let each process update its own features using a
+// local copy of the residual before averaging the updates (as in CoCoA), so
+// that the iteration reduces to the sequential one on a single process.
+// A single-parameter coordinate-descent solve is simply a path of length one.
+
+template<typename Real>
+struct RegularizationPathCtrl
+{
+    // If 'lambdas' is empty on entry, it is overwritten with 'numLambdas'
+    // geometrically-spaced values from lambda_max = || A^T b ||_oo, for
+    // which the solution is zero, down to 'lambdaMinRatio' times lambda_max
+    Int numLambdas=100;
+    Real lambdaMinRatio=Real(1e-3);
+
+    bool strongRules=true;
+
+    // The sweeps for each parameter stop once the largest change in the
+    // objective (as estimated by || a_j ||_2^2 (x_j - x_j^{old})^2) is at
+    // most 'tol' times || b ||_2^2
+    Real tol=Real(1e-7);
+    Int maxSweeps=10000;
+
+    bool progress=false;
+};
+
+template<typename Real>
+void BPDNPath
+( const Matrix<Real>& A,
+  const Matrix<Real>& b,
+        Matrix<Real>& lambdas,
+        Matrix<Real>& X,
+  const RegularizationPathCtrl<Real>& ctrl=RegularizationPathCtrl<Real>() );
+template<typename Real>
+void BPDNPath
+( const AbstractDistMatrix<Real>& A,
+  const AbstractDistMatrix<Real>& b,
+        Matrix<Real>& lambdas,
+        AbstractDistMatrix<Real>& X,
+  const RegularizationPathCtrl<Real>& ctrl=RegularizationPathCtrl<Real>() );
+template<typename Real>
+void BPDNPath
+( const SparseMatrix<Real>& A,
+  const Matrix<Real>& b,
+        Matrix<Real>& lambdas,
+        Matrix<Real>& X,
+  const RegularizationPathCtrl<Real>& ctrl=RegularizationPathCtrl<Real>() );
+template<typename Real>
+void BPDNPath
+( const DistSparseMatrix<Real>& A,
+  const DistMultiVec<Real>& b,
+        Matrix<Real>& lambdas,
+        DistMultiVec<Real>& X,
+  const RegularizationPathCtrl<Real>& ctrl=RegularizationPathCtrl<Real>() );
+
+template<typename Real>
+void ENPath
+( const Matrix<Real>& A,
+  const Matrix<Real>& b,
+        Matrix<Real>& lambdas,
+        Real lambda2,
+        Matrix<Real>& X,
+  const RegularizationPathCtrl<Real>& ctrl=RegularizationPathCtrl<Real>() );
+template<typename Real>
+void ENPath
+( const AbstractDistMatrix<Real>& A,
+  const AbstractDistMatrix<Real>& b,
+        Matrix<Real>& lambdas,
+        Real lambda2,
+        AbstractDistMatrix<Real>& X,
+  const RegularizationPathCtrl<Real>& ctrl=RegularizationPathCtrl<Real>() );
+template<typename Real>
+void ENPath
+( const SparseMatrix<Real>& A,
+  const Matrix<Real>& b,
+        Matrix<Real>& lambdas,
+        Real lambda2,
+        Matrix<Real>& X,
+  const RegularizationPathCtrl<Real>& ctrl=RegularizationPathCtrl<Real>() );
+template<typename Real>
+void ENPath
+( const DistSparseMatrix<Real>& A,
+  const DistMultiVec<Real>& b,
+        Matrix<Real>& lambdas,
+        Real lambda2,
+        DistMultiVec<Real>& X,
+  const RegularizationPathCtrl<Real>& ctrl=RegularizationPathCtrl<Real>() );
+
 // Robust Principal Component Analysis (RPCA)
 // ==========================================
 
@@ -483,6 +613,13 @@ struct RPCACtrl
     Real beta=Real(1);
     Real rho=Real(6);
     Real tol=Real(1e-5);
+
+    // Threshold randomized partial SVDs (see svt::Randomized) whose rank is
+    // predicted from that of the previous iterate, beginning with
+    // 'initialRank', in the manner of Lin, Chen, and Ma's inexact ALM
+    bool useRandomizedSVT=false;
+    Int initialRank=10;
+    RangeFinderCtrl sketchCtrl;
 };
 
 template<typename Field>
@@ -501,14 +638,52 @@ void RPCA
 
 // Sparse inverse covariance selection
 // ===================================
+// Solve
+//
+//   min Tr(S X) - log det X + lambda || X ||_1
+//
+// where S is the empirical covariance of the data matrix D.
+//
+// Besides ADMM, which requires a Hermitian eigendecomposition per iteration,
+// the (real) problem can be solved with the second-order method QUIC of
+// Hsieh et al., which computes each Newton direction by coordinate descent
+// restricted to the free set (the nonzeros of X and the entries whose
+// gradient exceeds lambda) and then performs an Armijo line search whose
+// positive-definiteness tests and log-determinants come from Cholesky
+// factorizations. QUIC typically converges in a few dozen iterations when
+// the precision matrix is sparse.
+
+namespace SparseInvCovApproachNS {
+enum SparseInvCovApproach {
+  SPARSE_INV_COV_ADMM,
+  SPARSE_INV_COV_QUIC
+};
+}
+using namespace SparseInvCovApproachNS;
+
 template<typename Real>
 struct SparseInvCovCtrl
 {
+    SparseInvCovApproach approach=SPARSE_INV_COV_ADMM;
+
+    // ADMM parameters
     Real rho=Real(1.);
     Real alpha=Real(1.2);
     Int maxIter=500;
     Real absTol=Real(1e-6);
     Real relTol=Real(1e-4);
+
+    // QUIC parameters: the iteration stops once the one-norm of the
+    // minimum-norm subgradient is at most 'quicTol' times || X ||_1, and the
+    // line search shrinks the step by 'lineSearchBeta' until the objective
+    // decreases by at least 'lineSearchSigma' times the predicted decrease.
+    // Iteration k performs 1+k/3 coordinate descent sweeps.
+    Int quicMaxIter=100;
+    Real quicTol=Real(1e-6);
+    Real lineSearchSigma=Real(1e-3);
+    Real lineSearchBeta=Real(0.5);
+    Int maxLineSearchIter=50;
+
     bool progress=true;
 };
 
@@ -538,11 +713,31 @@ Int SparseInvCov
 //
 // The output, x, is set to the concatenation of w and beta, x := [w; beta].
 //
+// For large, sparse problems, a dual coordinate descent method (with the
+// shrinking heuristic of Hsieh et al.) avoids forming and factoring the KKT
+// system. It regularizes beta along with w, and, in the distributed case, the
+// updates from each process's rows are averaged as in CoCoA.
+//
+
+namespace SVMApproachNS {
+enum SVMApproach {
+  SVM_IPM,
+  SVM_DUAL_COORDINATE_DESCENT
+};
+}
+using namespace SVMApproachNS;
 
 template<typename Real>
 struct SVMCtrl
 {
+    SVMApproach approach=SVM_IPM;
     qp::affine::Ctrl<Real> ipmCtrl;
+
+    // Dual coordinate descent parameters
+    Int dcdMaxIter=1000;
+    Real dcdTol=Real(1e-3);
+    bool shrink=true;
+    bool progress=false;
 };
 
 // TODO(poulson): Switch to explicitly returning w, beta, and z, as it is
@@ -610,6 +805,27 @@ void TV
         DistMultiVec<Real>& x,
   const qp::affine::Ctrl<Real>& ctrl=qp::affine::Ctrl<Real>() );
 
+// The same problem can be solved exactly, and without forming any linear
+// systems, via the direct algorithm of Condat, which, while quadratic in the
+// worst case, is observed to require linear time. The following denoise each
+// column of B independently, with the columns divided among the threads
+// (and, for distributed matrices, among the processes).
+template<typename Real>
+void DirectTV
+( const Matrix<Real>& B,
+        Real lambda,
+        Matrix<Real>& X );
+template<typename Real>
+void DirectTV
+( const AbstractDistMatrix<Real>& B,
+        Real lambda,
+        AbstractDistMatrix<Real>& X );
+template<typename Real>
+void DirectTV
+( const DistMultiVec<Real>& B,
+        Real lambda,
+        DistMultiVec<Real>& X );
+
 // Long-only portfolio optimization
 // ================================
 // The long-only version of classical (Markowitz) portfolio optimization
@@ -625,6 +841,48 @@ void TV
 //   Sigma = D + F F^T,
 //
 // where D is diagonal and F has a (hopefully) small number of columns.
+//
+// For the factored form, rather than solving an equivalent SOCP, the default
+// is a (Mehrotra predictor-corrector) interior point method for the QP whose
+// Newton systems,
+//
+//   | 2 gamma (D + F F^T) + inv(X) Z  1 | | dx | = | g |,
+//   |              1^T                0 | | dy |   | h |
+//
+// are solved with the Sherman-Morrison-Woodbury formula, so that each
+// iteration only requires forming and factoring the k x k capacitance matrix
+// I + 2 gamma F^T inv(2 gamma D + inv(X) Z) F, where k is the number of
+// columns of F, for a total cost of O(n k^2).
+
+namespace LongOnlyPortfolioApproachNS {
+enum LongOnlyPortfolioApproach {
+  LONG_ONLY_PORTFOLIO_FACTOR_IPM,
+  LONG_ONLY_PORTFOLIO_SOCP
+};
+}
+using namespace LongOnlyPortfolioApproachNS;
+
+template<typename Real>
+struct LongOnlyPortfolioCtrl
+{
+    LongOnlyPortfolioApproach approach=LONG_ONLY_PORTFOLIO_FACTOR_IPM;
+
+    // The controls for the SOCP formulation
+    socp::affine::Ctrl<Real> socpCtrl;
+
+    // The controls for the factor-model IPM
+    Int maxIts=100;
+    Real targetTol=Pow(limits::Epsilon<Real>(),Real(0.5));
+    Real maxStepRatio=Real(0.99);
+    bool print=false;
+
+    LongOnlyPortfolioCtrl() { }
+
+    // Solve the SOCP formulation with the given controls
+    LongOnlyPortfolioCtrl( const socp::affine::Ctrl<Real>& ctrl )
+    : approach(LONG_ONLY_PORTFOLIO_SOCP), socpCtrl(ctrl)
+    { }
+};
 
 template<typename Real>
 void LongOnlyPortfolio
@@ -648,7 +906,7 @@ void LongOnlyPortfolio
   const Matrix<Real>& c,
         Real gamma,
         Matrix<Real>& x,
-  const socp::affine::Ctrl<Real>& ctrl=socp::affine::Ctrl<Real>() );
+  const LongOnlyPortfolioCtrl<Real>& ctrl=LongOnlyPortfolioCtrl<Real>() );
 template<typename Real>
 void LongOnlyPortfolio
 ( const DistMultiVec<Real>& d,
@@ -656,7 +914,7 @@ void LongOnlyPortfolio
   const DistMultiVec<Real>& c,
         Real gamma,
         DistMultiVec<Real>& x,
-  const socp::affine::Ctrl<Real>& ctrl=socp::affine::Ctrl<Real>() );
+  const LongOnlyPortfolioCtrl<Real>& ctrl=LongOnlyPortfolioCtrl<Real>() );
 
 } // namespace El
 
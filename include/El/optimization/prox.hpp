@@ -158,6 +158,24 @@ Int TSQR
   const Base<Field>& rho,
   bool relative=false );
 
+// Threshold a randomized partial SVD whose rank begins at 'rankGuess' and is
+// doubled until the thresholded rank is captured, which requires O(m n k)
+// rather than O(m n min(m,n)) work for a thresholded rank of k
+template<typename Field>
+Int Randomized
+( Matrix<Field>& A,
+  const Base<Field>& rho,
+  Int rankGuess,
+  const RangeFinderCtrl& ctrl=RangeFinderCtrl(),
+  bool relative=false );
+template<typename Field>
+Int Randomized
+( AbstractDistMatrix<Field>& A,
+  const Base<Field>& rho,
+  Int rankGuess,
+  const RangeFinderCtrl& ctrl=RangeFinderCtrl(),
+  bool relative=false );
+
 } // namespace svt
 
 // Soft-thresholding
@@ -12,5 +12,6 @@
 #include <El/optimization/solvers/LP.hpp>
 #include <El/optimization/solvers/QP.hpp>
 #include <El/optimization/solvers/SOCP.hpp>
+#include <El/optimization/solvers/presolve.hpp>
 
 #endif // ifndef EL_OPTIMIZATION_SOLVERS_HPP
@@ -43,6 +43,12 @@ struct Ctrl
     ADMMCtrl<Real> admmCtrl;
     MehrotraCtrl<Real> mehrotraCtrl;
 
+    // Presolve sparse problems (see 'PresolveDirect') before handing the
+    // reduced problem to the solver and postsolving its solution. Any
+    // initial guess is ignored when presolve is enabled.
+    bool presolve=false;
+    PresolveCtrl<Real> presolveCtrl;
+
     Ctrl( bool isSparse )
     { mehrotraCtrl.system = ( isSparse ? AUGMENTED_KKT : NORMAL_KKT ); }
 };
@@ -71,6 +77,22 @@ struct Ctrl
 
 } // namespace affine
 
+// Control structure for solving batches of independent direct-form LPs
+// --------------------------------------------------------------------
+template<typename Real>
+struct BatchCtrl
+{
+    // The controls for each of the individual solves
+    direct::Ctrl<Real> lpCtrl=direct::Ctrl<Real>(true);
+
+    // Each problem is solved by a team of processes whose (power-of-two) size
+    // is chosen so that each member is responsible for roughly this many
+    // nonzeros (capped at the size of the communicator).
+    Int targetNnzPerProcess=100000;
+
+    bool progress=false;
+};
+
 } // namespace lp
 
 // Direct conic form
@@ -151,6 +173,17 @@ struct DirectLPSolution
     VectorType z;
 };
 
+// The row and column scalings of the outer equilibration of a direct-form
+// LP, i.e., A := inv(diag(rowScale)) A inv(diag(colScale)). They are returned
+// by the Mehrotra IPM and can be reused (see 'MehrotraCtrl::reuseEquil') to
+// avoid recomputing them for subsequent problems with the same 'A'.
+template<typename VectorType>
+struct DirectLPScaling
+{
+    VectorType rowScale;
+    VectorType colScale;
+};
+
 // Quack...
 template<typename Real>
 void ForceSimpleAlignments
@@ -261,6 +294,33 @@ void LP
         DirectLPSolution<DistMultiVec<Real>>& solution,
   const lp::direct::Ctrl<Real>& ctrl=lp::direct::Ctrl<Real>(true) );
 
+// Return (or, if 'ctrl.mehrotraCtrl.reuseEquil' is true, reuse) the scalings
+// of the outer equilibration of the Mehrotra IPM.
+template<typename Real>
+void LP
+( const DirectLPProblem<Matrix<Real>,Matrix<Real>>& problem,
+        DirectLPSolution<Matrix<Real>>& solution,
+        DirectLPScaling<Matrix<Real>>& scaling,
+  const lp::direct::Ctrl<Real>& ctrl=lp::direct::Ctrl<Real>(false) );
+template<typename Real>
+void LP
+( const DirectLPProblem<DistMatrix<Real>,DistMatrix<Real>>& problem,
+        DirectLPSolution<DistMatrix<Real>>& solution,
+        DirectLPScaling<DistMatrix<Real>>& scaling,
+  const lp::direct::Ctrl<Real>& ctrl=lp::direct::Ctrl<Real>(false) );
+template<typename Real>
+void LP
+( const DirectLPProblem<SparseMatrix<Real>,Matrix<Real>>& problem,
+        DirectLPSolution<Matrix<Real>>& solution,
+        DirectLPScaling<Matrix<Real>>& scaling,
+  const lp::direct::Ctrl<Real>& ctrl=lp::direct::Ctrl<Real>(true) );
+template<typename Real>
+void LP
+( const DirectLPProblem<DistSparseMatrix<Real>,DistMultiVec<Real>>& problem,
+        DirectLPSolution<DistMultiVec<Real>>& solution,
+        DirectLPScaling<DistMultiVec<Real>>& scaling,
+  const lp::direct::Ctrl<Real>& ctrl=lp::direct::Ctrl<Real>(true) );
+
 // These interfaces are now deprecated in favor of the above.
 template<typename Real>
 [[deprecated]]
@@ -578,6 +638,20 @@ void LP
         DistMultiVec<Real>& s,
   const lp::affine::Ctrl<Real>& ctrl=lp::affine::Ctrl<Real>() );
 
+// Batches of independent sparse LPs
+// ---------------------------------
+// Every process in 'comm' must pass the same list of (sequential) problems.
+// Small problems are solved independently by individual processes, while
+// larger problems are redistributed over teams of processes, and upon
+// return, each solution is only filled on the members of the team that
+// solved it.
+template<typename Real>
+void BatchLP
+( const vector<DirectLPProblem<SparseMatrix<Real>,Matrix<Real>>>& problems,
+        vector<DirectLPSolution<Matrix<Real>>>& solutions,
+  mpi::Comm comm=mpi::COMM_WORLD,
+  const lp::BatchCtrl<Real>& ctrl=lp::BatchCtrl<Real>() );
+
 // Mathematical Programming System
 // -------------------------------
 
@@ -609,6 +683,16 @@ void CompressMPS
 void DecompressMPS
 ( const string& filename, const string& decompressedFilename );
 
+// Parse an MPS file once and store the resulting affine LP within a binary
+// cache, which 'ReadMPS' accepts in place of the MPS file (given the same
+// 'minimize' and 'keepNonnegativeWithZeroUpperBound' options) and loads
+// without any parsing.
+void CacheMPS
+( const string& filename,
+  const string& cacheFilename,
+  bool minimize=true,
+  bool keepNonnegativeWithZeroUpperBound=true );
+
 } // namespace El
 
 #endif // ifndef EL_OPTIMIZATION_SOLVERS_LP_HPP
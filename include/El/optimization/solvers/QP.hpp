@@ -42,6 +42,12 @@ struct Ctrl
     QPApproach approach=QP_MEHROTRA;
     MehrotraCtrl<Real> mehrotraCtrl;
 
+    // Presolve sparse problems (see 'PresolveDirect') before handing the
+    // reduced problem to the solver and postsolving its solution. Any
+    // initial guess is ignored when presolve is enabled.
+    bool presolve=false;
+    PresolveCtrl<Real> presolveCtrl;
+
     Ctrl() { mehrotraCtrl.system = AUGMENTED_KKT; }
 };
 
@@ -0,0 +1,171 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_OPTIMIZATION_SOLVERS_PRESOLVE_HPP
+#define EL_OPTIMIZATION_SOLVERS_PRESOLVE_HPP
+
+#include <El/optimization/solvers/util.hpp>
+
+namespace El {
+
+// Presolve for sparse "direct" conic-form LPs and QPs, i.e.,
+//
+//   min (1/2) x^T Q x + c^T x,
+//   s.t. A x = b, x >= 0,
+//
+// with dual variables '(y,z)' satisfying 'Q x + A^T y - z + c = 0, z >= 0'
+// (LPs simply omit 'Q'). Each reduction either removes a row of 'A' or
+// fixes the value of a variable (and removes its column), and the
+// reductions are recorded so that a primal-dual solution of the reduced
+// problem can be postsolved into one of the original problem.
+
+namespace PresolveReductionNS {
+enum PresolveReduction {
+  PRESOLVE_EMPTY_ROW,
+  PRESOLVE_SINGLETON_ROW,
+  PRESOLVE_FORCING_ROW,
+  PRESOLVE_DUPLICATE_ROW,
+  PRESOLVE_EMPTY_COLUMN
+};
+} // namespace PresolveReductionNS
+using namespace PresolveReductionNS;
+
+struct PresolveStep
+{
+    PresolveReduction reduction;
+    // The removed row (if any) and the fixed column (if any). A forcing row
+    // is recorded once for each of the columns it fixed, and a duplicate
+    // row records the index of the row it is a multiple of as 'col'.
+    Int row, col;
+};
+
+template<typename Real>
+struct DirectPresolveInfo
+{
+    // The dimensions of the original 'A'
+    Int height=0, width=0;
+
+    // The (increasing) indices of the rows and columns of the original
+    // problem which form the reduced problem
+    vector<Int> keptRows, keptCols;
+
+    // The values of the eliminated variables (and zero for kept columns)
+    vector<Real> fixedValues;
+
+    // The reductions in the order in which they were applied. For
+    // distributed problems, the reductions are computed, and only stored, on
+    // the root of the communicator.
+    vector<PresolveStep> steps;
+};
+
+// Form the reduced problem and the information needed to postsolve it.
+// A RuntimeError is thrown if a reduction exposes primal infeasibility or an
+// unbounded objective.
+//
+// The distributed versions gather the problem onto the root process to
+// determine the (inherently sequential) reductions, but the reduced matrices
+// are formed in parallel from the local entries of the originals.
+template<typename Real>
+void PresolveDirect
+( const SparseMatrix<Real>& A,
+  const Matrix<Real>& b,
+  const Matrix<Real>& c,
+        SparseMatrix<Real>& AReduced,
+        Matrix<Real>& bReduced,
+        Matrix<Real>& cReduced,
+        DirectPresolveInfo<Real>& info,
+  const PresolveCtrl<Real>& ctrl=PresolveCtrl<Real>() );
+template<typename Real>
+void PresolveDirect
+( const DistSparseMatrix<Real>& A,
+  const DistMultiVec<Real>& b,
+  const DistMultiVec<Real>& c,
+        DistSparseMatrix<Real>& AReduced,
+        DistMultiVec<Real>& bReduced,
+        DistMultiVec<Real>& cReduced,
+        DirectPresolveInfo<Real>& info,
+  const PresolveCtrl<Real>& ctrl=PresolveCtrl<Real>() );
+
+template<typename Real>
+void PresolveDirect
+( const SparseMatrix<Real>& Q,
+  const SparseMatrix<Real>& A,
+  const Matrix<Real>& b,
+  const Matrix<Real>& c,
+        SparseMatrix<Real>& QReduced,
+        SparseMatrix<Real>& AReduced,
+        Matrix<Real>& bReduced,
+        Matrix<Real>& cReduced,
+        DirectPresolveInfo<Real>& info,
+  const PresolveCtrl<Real>& ctrl=PresolveCtrl<Real>() );
+template<typename Real>
+void PresolveDirect
+( const DistSparseMatrix<Real>& Q,
+  const DistSparseMatrix<Real>& A,
+  const DistMultiVec<Real>& b,
+  const DistMultiVec<Real>& c,
+        DistSparseMatrix<Real>& QReduced,
+        DistSparseMatrix<Real>& AReduced,
+        DistMultiVec<Real>& bReduced,
+        DistMultiVec<Real>& cReduced,
+        DirectPresolveInfo<Real>& info,
+  const PresolveCtrl<Real>& ctrl=PresolveCtrl<Real>() );
+
+// Map a primal-dual solution of the reduced problem back to one of the
+// original problem passed to PresolveDirect.
+template<typename Real>
+void PostsolveDirect
+( const SparseMatrix<Real>& A,
+  const Matrix<Real>& c,
+  const DirectPresolveInfo<Real>& info,
+  const Matrix<Real>& xReduced,
+  const Matrix<Real>& yReduced,
+  const Matrix<Real>& zReduced,
+        Matrix<Real>& x,
+        Matrix<Real>& y,
+        Matrix<Real>& z );
+template<typename Real>
+void PostsolveDirect
+( const DistSparseMatrix<Real>& A,
+  const DistMultiVec<Real>& c,
+  const DirectPresolveInfo<Real>& info,
+  const DistMultiVec<Real>& xReduced,
+  const DistMultiVec<Real>& yReduced,
+  const DistMultiVec<Real>& zReduced,
+        DistMultiVec<Real>& x,
+        DistMultiVec<Real>& y,
+        DistMultiVec<Real>& z );
+
+template<typename Real>
+void PostsolveDirect
+( const SparseMatrix<Real>& Q,
+  const SparseMatrix<Real>& A,
+  const Matrix<Real>& c,
+  const DirectPresolveInfo<Real>& info,
+  const Matrix<Real>& xReduced,
+  const Matrix<Real>& yReduced,
+  const Matrix<Real>& zReduced,
+        Matrix<Real>& x,
+        Matrix<Real>& y,
+        Matrix<Real>& z );
+template<typename Real>
+void PostsolveDirect
+( const DistSparseMatrix<Real>& Q,
+  const DistSparseMatrix<Real>& A,
+  const DistMultiVec<Real>& c,
+  const DirectPresolveInfo<Real>& info,
+  const DistMultiVec<Real>& xReduced,
+  const DistMultiVec<Real>& yReduced,
+  const DistMultiVec<Real>& zReduced,
+        DistMultiVec<Real>& x,
+        DistMultiVec<Real>& y,
+        DistMultiVec<Real>& z );
+
+} // namespace El
+
+#endif // ifndef EL_OPTIMIZATION_SOLVERS_PRESOLVE_HPP
@@ -72,10 +72,37 @@ struct MehrotraCtrl
     // (larger) augmented formulation.
     KKTSystem system=FULL_KKT;
 
+    // For sparse direct-form LPs with system == NORMAL_KKT, rather than
+    // explicitly forming and factoring A D A^T + delta^2 I, solve the normal
+    // equations to a relative tolerance of 'normalPCGTol' via Preconditioned
+    // Conjugate Gradients. The columns of A with more than 'denseColumnRatio'
+    // times the height of A nonzeros are split off into a low-rank correction
+    // of the diagonal preconditioner so that the memory usage remains
+    // proportional to nnz(A).
+    bool normalPCG=false;
+    Real normalPCGTol=Pow(limits::Epsilon<Real>(),Real(0.5));
+    Int normalPCGMaxIts=1000;
+    Real denseColumnRatio=Real(0.1);
+
     // Use Mehrotra's second-order corrector?
-    // TODO(poulson): Add support for Gondzio's correctors
     bool mehrotra=true;
 
+    // The maximum number of Gondzio multiple centrality correctors to apply
+    // to the predictor-corrector direction of each iteration of the LP and QP
+    // IPMs. Each corrector only requires one more solve with the existing
+    // factorization of the KKT system and targets the step lengths
+    // increased by 'centralityStepIncrease' by pushing the complementarity
+    // products of the corresponding trial point into
+    // [centralityBetaMin*sigma*mu, centralityBetaMax*sigma*mu]. A corrector
+    // is only accepted if it increases the step length by at least
+    // 'centralityAcceptance' times the targeted increase, and the first
+    // rejected corrector ends the sequence.
+    Int maxCentralityCorrectors=0;
+    Real centralityStepIncrease=Real(0.1);
+    Real centralityAcceptance=Real(0.1);
+    Real centralityBetaMin=Real(0.1);
+    Real centralityBetaMax=Real(10);
+
     // For determining the ratio of the amount to balance the affine and 
     // correction updates. The other common option is 'MehrotraCentrality'.
     function<Real(Real,Real,Real,Real)>
@@ -84,6 +111,16 @@ struct MehrotraCtrl
     // Use a simple shift for forcing cone membership during initialization?
     bool standardInitShift=true;
 
+    // If both 'primalInit' and 'dualInit' are set, treat the initial guess as
+    // the (typically optimal) solution of a closely related problem and only
+    // perturb it by a relative amount of 'warmStartShift' into the interior
+    // of the cone before rescaling the complementary pairs whose products are
+    // below 'warmStartCentrality' times their average. Otherwise, the initial
+    // guess must already lie strictly inside the cone.
+    bool warmStart=false;
+    Real warmStartShift=Pow(limits::Epsilon<Real>(),Real(0.25));
+    Real warmStartCentrality=Real(0.1);
+
     // If the maximum ratio between the primary and dual variables exceeds this
     // value, the barrier parameter is kept at its previous value to attempt to
     // increase the centrality.
@@ -105,6 +142,12 @@ struct MehrotraCtrl
     // This should almost always be set to true.
     bool outerEquil=true;
 
+    // Rather than recomputing the (Ruiz) row and column scalings of 'A' for
+    // the outer equilibration, reuse those passed in through a
+    // 'DirectLPScaling' (e.g., as returned by a solve of a previous problem
+    // with the same 'A' but different 'b' and/or 'c').
+    bool reuseEquil=false;
+
     // The size of the Krylov subspace used for loosely estimating two-norms of
     // sparse matrices.
     Int basisSize = 6;
@@ -115,6 +158,15 @@ struct MehrotraCtrl
     // Time the components of the Interior Point Method?
     bool time=false;
 
+    // If positive, checkpoint the iterates of the distributed dense IPMs
+    // every 'checkpointFreq' iterations to "<checkpointBasename>_<var>.ckpt"
+    // (for var in {x,y,z} or {x,y,z,s}). The iterates are those of the
+    // (possibly equilibrated) problem being iterated on and can be reloaded
+    // with Restart and used as an initial guess via 'primalInit' and
+    // 'dualInit'.
+    Int checkpointFreq=0;
+    string checkpointBasename="mehrotra";
+
     // A lower bound on the maximum entry in the Nesterov-Todd scaling point
     // before ad-hoc procedures to enforce the cone constraints should be
     // employed.
@@ -161,18 +213,68 @@ struct MehrotraCtrl
     // replace the default, (muAff/mu)^3
 };
 
+// Presolve for sparse "direct" conic-form LPs and QPs
+// ===================================================
+// The reductions are applied in passes over the rows and columns of 'A'
+// until a pass no longer modifies the problem (or 'maxPasses' is reached).
+// Since the only bounds of direct-form problems are 'x >= 0', bound
+// tightening reduces to detecting rows whose nonzeros share a sign and force
+// each of their variables to zero.
+template<typename Real>
+struct PresolveCtrl
+{
+    // Remove rows whose nonzeros all lie in removed columns.
+    bool emptyRows=true;
+
+    // Fix the variable of each row with a single nonzero and remove the row.
+    bool singletonRows=true;
+
+    // Remove each row with a zero right-hand side whose nonzeros share a
+    // sign after fixing its variables to zero.
+    bool forcingRows=true;
+
+    // Remove rows which are (numerically) multiples of another row.
+    bool duplicateRows=true;
+
+    // Fix the variables of columns which are empty in both 'A' and 'Q' to
+    // zero (as is optimal unless the objective is unbounded).
+    bool dualFixing=true;
+
+    Int maxPasses=20;
+
+    // The relative tolerance for the (in)feasibility and proportionality
+    // tests of the reductions.
+    Real tol=Pow(limits::Epsilon<Real>(),Real(0.75));
+
+    bool progress=false;
+};
+
 // Alternating Direction Method of Multipliers
 // ===========================================
 template<typename Real>
 struct ADMMCtrl
 {
+    // The initial penalty parameter
     Real rho=Real(1);
+
+    // The over-relaxation parameter, which is typically in [1.5,1.8]
     Real alpha=Real(1.2);
+
     Int maxIter=500;
     // TODO(poulson): Base upon machine epsilon?
     Real absTol=Real(1e-6);
     Real relTol=Real(1e-4);
     bool inv=true;
+
+    // Adapt the penalty parameter by residual balancing: if the primal
+    // residual norm exceeds 'rhoBalance' times the dual residual norm, rho is
+    // multiplied by 'rhoScale', and, if the dual residual norm exceeds
+    // 'rhoBalance' times the primal residual norm, rho is divided by
+    // 'rhoScale'.
+    bool adaptRho=false;
+    Real rhoBalance=Real(10);
+    Real rhoScale=Real(2);
+
     bool print=true;
 };
 
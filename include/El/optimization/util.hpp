@@ -24,11 +24,21 @@ Base<F> Coherence( const AbstractDistMatrix<F>& A );
 
 // Covariance
 // ==========
+// The covariance is formed in a single pass over row panels of the data
+// matrix, with the panel means merged into a running mean.
 template<typename F>
 void Covariance( const Matrix<F>& D, Matrix<F>& S );
 template<typename F>
 void Covariance( const AbstractDistMatrix<F>& D, AbstractDistMatrix<F>& S );
 
+// Form the covariance of the numObs x n data matrix stored (in column-major
+// order) within a BINARY_FLAT file by streaming it in row panels of height
+// 'panelHeight' (which defaults to the maximum of n and the blocksize).
+template<typename F>
+void Covariance
+( const string& filename, Int numObs, Int n,
+  AbstractDistMatrix<F>& S, Int panelHeight=0 );
+
 // Log barrier
 // ===========
 template<typename F>
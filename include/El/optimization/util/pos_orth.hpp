@@ -51,6 +51,51 @@ Real MaxStep
   const DistMultiVec<Real>& ds,
   Real upperBound=limits::Max<Real>() );
 
+// Gondzio centrality residual
+// ===========================
+// The complementarity residual of a Gondzio multiple centrality corrector
+// which pushes the products of the trial point (s + alphaPri ds,
+// z + alphaDual dz) back into [betaMin mu, betaMax mu].
+template<typename Real,
+         typename=EnableIf<IsReal<Real>>>
+void CentralityResidual
+( const Matrix<Real>& s,
+  const Matrix<Real>& z,
+  const Matrix<Real>& ds,
+  const Matrix<Real>& dz,
+        Real alphaPri,
+        Real alphaDual,
+        Real mu,
+        Real betaMin,
+        Real betaMax,
+        Matrix<Real>& r );
+template<typename Real,
+         typename=EnableIf<IsReal<Real>>>
+void CentralityResidual
+( const AbstractDistMatrix<Real>& s,
+  const AbstractDistMatrix<Real>& z,
+  const AbstractDistMatrix<Real>& ds,
+  const AbstractDistMatrix<Real>& dz,
+        Real alphaPri,
+        Real alphaDual,
+        Real mu,
+        Real betaMin,
+        Real betaMax,
+        AbstractDistMatrix<Real>& r );
+template<typename Real,
+         typename=EnableIf<IsReal<Real>>>
+void CentralityResidual
+( const DistMultiVec<Real>& s,
+  const DistMultiVec<Real>& z,
+  const DistMultiVec<Real>& ds,
+  const DistMultiVec<Real>& dz,
+        Real alphaPri,
+        Real alphaDual,
+        Real mu,
+        Real betaMin,
+        Real betaMax,
+        DistMultiVec<Real>& r );
+
 // Number of members outside of cone
 // =================================
 template<typename Real,
@@ -116,6 +161,33 @@ void PushPairInto
   const DistMultiVec<Real>& w,
   Real wMaxNormLimit );
 
+// Warm-start a pair from a previous solution
+// ==========================================
+// Lift s and z slightly into the positive orthant and rescale the pairs
+// whose complementarity products are far below the average while preserving
+// the ratios s_i / z_i.
+template<typename Real,
+         typename=EnableIf<IsReal<Real>>>
+void WarmStart
+( Matrix<Real>& s,
+  Matrix<Real>& z,
+  Real shift,
+  Real centrality );
+template<typename Real,
+         typename=EnableIf<IsReal<Real>>>
+void WarmStart
+( AbstractDistMatrix<Real>& s,
+  AbstractDistMatrix<Real>& z,
+  Real shift,
+  Real centrality );
+template<typename Real,
+         typename=EnableIf<IsReal<Real>>>
+void WarmStart
+( DistMultiVec<Real>& s,
+  DistMultiVec<Real>& z,
+  Real shift,
+  Real centrality );
+
 } // namespace pos_orth
 } // namespace El
 
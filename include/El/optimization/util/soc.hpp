@@ -589,6 +589,75 @@ void SquareRoot
   const DistMultiVec<Int>& firstInds,
   Int cutoff=1000 );
 
+// Batches of second-order cones
+// =============================
+// Products with millions of tiny cones spend most of their time walking
+// 'orders' and 'firstInds' cone by cone. A batched representation instead
+// groups the cones by their order, so that the kernels below can be
+// specialized to fixed small orders and threaded over the cones of a batch.
+// The cone members themselves remain in the standard interleaved layout.
+struct Batches
+{
+    // The distinct cone orders, in increasing order
+    vector<Int> orders;
+
+    // The first indices of the cones of order orders[k] are stored in
+    // firstInds[offsets[k]], ..., firstInds[offsets[k+1]-1]
+    vector<Int> offsets;
+    vector<Int> firstInds;
+};
+
+void FormBatches
+( const Matrix<Int>& orders,
+  const Matrix<Int>& firstInds,
+        Batches& batches );
+
+template<typename Real,
+         typename=EnableIf<IsReal<Real>>>
+void Dots
+( const Matrix<Real>& x,
+  const Matrix<Real>& y,
+        Matrix<Real>& z,
+  const Batches& batches );
+
+template<typename Real,
+         typename=EnableIf<IsReal<Real>>>
+Real MaxStep
+( const Matrix<Real>& x,
+  const Matrix<Real>& y,
+  const Batches& batches,
+  Real upperBound=limits::Max<Real>() );
+
+// Simultaneously compute the maximum primal and dual steps, i.e.,
+// (MaxStep(s,ds,upperBound),MaxStep(z,dz,upperBound)), in a single pass
+template<typename Real,
+         typename=EnableIf<IsReal<Real>>>
+pair<Real,Real> MaxSteps
+( const Matrix<Real>& s,
+  const Matrix<Real>& ds,
+  const Matrix<Real>& z,
+  const Matrix<Real>& dz,
+  const Batches& batches,
+  Real upperBound=limits::Max<Real>() );
+
+template<typename Real,
+         typename=EnableIf<IsReal<Real>>>
+void NesterovTodd
+( const Matrix<Real>& s,
+  const Matrix<Real>& z,
+        Matrix<Real>& w,
+  const Batches& batches );
+
+// Fuse PushInto(s,minDist), PushInto(z,minDist), and NesterovTodd(s,z,w)
+template<typename Real,
+         typename=EnableIf<IsReal<Real>>>
+void PushIntoNesterovTodd
+(       Matrix<Real>& s,
+        Matrix<Real>& z,
+        Matrix<Real>& w,
+  const Batches& batches,
+  Real minDist );
+
 } // namespace soc
 } // namespace El
 
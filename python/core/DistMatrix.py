@@ -583,8 +583,14 @@ class DistMatrix(object):
       elif self.tag == cTag: lib.ElDistMatrixMatrix_c(*args)
       elif self.tag == zTag: lib.ElDistMatrixMatrix_z(*args)
       else: DataExcept()
+    A.owner = self
     return A
 
+  # Return a NumPy view (rather than a copy) of the local matrix
+  # ------------------------------------------------------------
+  def LocalToNumPy(self,locked=False):
+    return self.Matrix(locked).ToNumPy()
+
   # Return the amount of locally allocated memory
   # ---------------------------------------------
   lib.ElDistMatrixAllocatedMemory_i.argtypes = \
@@ -1686,6 +1692,38 @@ class DistMatrix(object):
     elif self.tag == zTag: lib.ElDistMatrixQueueUpdate_z(*args)
     else: DataExcept()
 
+  lib.ElDistMatrixQueueUpdates_i.argtypes = \
+    [c_void_p,iType,POINTER(iType),POINTER(iType),POINTER(iType)]
+  lib.ElDistMatrixQueueUpdates_s.argtypes = \
+    [c_void_p,iType,POINTER(iType),POINTER(iType),POINTER(sType)]
+  lib.ElDistMatrixQueueUpdates_d.argtypes = \
+    [c_void_p,iType,POINTER(iType),POINTER(iType),POINTER(dType)]
+  lib.ElDistMatrixQueueUpdates_c.argtypes = \
+    [c_void_p,iType,POINTER(iType),POINTER(iType),POINTER(cType)]
+  lib.ElDistMatrixQueueUpdates_z.argtypes = \
+    [c_void_p,iType,POINTER(iType),POINTER(iType),POINTER(zType)]
+  def QueueUpdates(self,rows,cols,values):
+    rows, rowsBuf = NumPyBuffer(rows,iTag)
+    cols, colsBuf = NumPyBuffer(cols,iTag)
+    values, valuesBuf = NumPyBuffer(values,self.tag)
+    if rows.size != cols.size or rows.size != values.size:
+      raise Exception('rows, cols, and values must be of the same length')
+    args = [self.obj,rows.size,rowsBuf,colsBuf,valuesBuf]
+    if   self.tag == iTag: lib.ElDistMatrixQueueUpdates_i(*args)
+    elif self.tag == sTag: lib.ElDistMatrixQueueUpdates_s(*args)
+    elif self.tag == dTag: lib.ElDistMatrixQueueUpdates_d(*args)
+    elif self.tag == cTag: lib.ElDistMatrixQueueUpdates_c(*args)
+    elif self.tag == zTag: lib.ElDistMatrixQueueUpdates_z(*args)
+    else: DataExcept()
+
+  # Queue the updates A(i:i+m,j:j+n) += block for an m x n (NumPy) block
+  def QueueUpdateBlock(self,i,j,block):
+    block = numpy.atleast_2d(block)
+    m, n = block.shape
+    rows, cols = numpy.meshgrid(
+      numpy.arange(i,i+m),numpy.arange(j,j+n),indexing='ij')
+    self.QueueUpdates(rows,cols,block)
+
   lib.ElDistMatrixProcessQueues_i.argtypes = \
   lib.ElDistMatrixProcessQueues_s.argtypes = \
   lib.ElDistMatrixProcessQueues_d.argtypes = \
@@ -208,6 +208,30 @@ class DistSparseMatrix(object):
     elif self.tag == zTag: lib.ElDistSparseMatrixQueueLocalUpdate_z(*args)
     else: DataExcept()
 
+  lib.ElDistSparseMatrixQueueUpdates_i.argtypes = \
+    [c_void_p,iType,POINTER(iType),POINTER(iType),POINTER(iType),bType]
+  lib.ElDistSparseMatrixQueueUpdates_s.argtypes = \
+    [c_void_p,iType,POINTER(iType),POINTER(iType),POINTER(sType),bType]
+  lib.ElDistSparseMatrixQueueUpdates_d.argtypes = \
+    [c_void_p,iType,POINTER(iType),POINTER(iType),POINTER(dType),bType]
+  lib.ElDistSparseMatrixQueueUpdates_c.argtypes = \
+    [c_void_p,iType,POINTER(iType),POINTER(iType),POINTER(cType),bType]
+  lib.ElDistSparseMatrixQueueUpdates_z.argtypes = \
+    [c_void_p,iType,POINTER(iType),POINTER(iType),POINTER(zType),bType]
+  def QueueUpdates(self,rows,cols,values,passive=False):
+    rows, rowsBuf = NumPyBuffer(rows,iTag)
+    cols, colsBuf = NumPyBuffer(cols,iTag)
+    values, valuesBuf = NumPyBuffer(values,self.tag)
+    if rows.size != cols.size or rows.size != values.size:
+      raise Exception('rows, cols, and values must be of the same length')
+    args = [self.obj,rows.size,rowsBuf,colsBuf,valuesBuf,passive]
+    if   self.tag == iTag: lib.ElDistSparseMatrixQueueUpdates_i(*args)
+    elif self.tag == sTag: lib.ElDistSparseMatrixQueueUpdates_s(*args)
+    elif self.tag == dTag: lib.ElDistSparseMatrixQueueUpdates_d(*args)
+    elif self.tag == cTag: lib.ElDistSparseMatrixQueueUpdates_c(*args)
+    elif self.tag == zTag: lib.ElDistSparseMatrixQueueUpdates_z(*args)
+    else: DataExcept()
+
   lib.ElDistSparseMatrixQueueZero_i.argtypes = \
   lib.ElDistSparseMatrixQueueZero_s.argtypes = \
   lib.ElDistSparseMatrixQueueZero_d.argtypes = \
@@ -268,6 +292,55 @@ class DistSparseMatrix(object):
     elif self.tag == zTag: lib.ElDistSparseMatrixProcessLocalQueues_z(*args)
     else: DataExcept()
 
+  lib.ElDistSparseMatrixAssembleCOO_i.argtypes = \
+    [c_void_p,iType,POINTER(iType),POINTER(iType),POINTER(iType)]
+  lib.ElDistSparseMatrixAssembleCOO_s.argtypes = \
+    [c_void_p,iType,POINTER(iType),POINTER(iType),POINTER(sType)]
+  lib.ElDistSparseMatrixAssembleCOO_d.argtypes = \
+    [c_void_p,iType,POINTER(iType),POINTER(iType),POINTER(dType)]
+  lib.ElDistSparseMatrixAssembleCOO_c.argtypes = \
+    [c_void_p,iType,POINTER(iType),POINTER(iType),POINTER(cType)]
+  lib.ElDistSparseMatrixAssembleCOO_z.argtypes = \
+    [c_void_p,iType,POINTER(iType),POINTER(iType),POINTER(zType)]
+  def AssembleCOO(self,rows,cols,values):
+    rows, rowsBuf = NumPyBuffer(rows,iTag)
+    cols, colsBuf = NumPyBuffer(cols,iTag)
+    values, valuesBuf = NumPyBuffer(values,self.tag)
+    if rows.size != cols.size or rows.size != values.size:
+      raise Exception('rows, cols, and values must be of the same length')
+    args = [self.obj,rows.size,rowsBuf,colsBuf,valuesBuf]
+    if   self.tag == iTag: lib.ElDistSparseMatrixAssembleCOO_i(*args)
+    elif self.tag == sTag: lib.ElDistSparseMatrixAssembleCOO_s(*args)
+    elif self.tag == dTag: lib.ElDistSparseMatrixAssembleCOO_d(*args)
+    elif self.tag == cTag: lib.ElDistSparseMatrixAssembleCOO_c(*args)
+    elif self.tag == zTag: lib.ElDistSparseMatrixAssembleCOO_z(*args)
+    else: DataExcept()
+
+  lib.ElDistSparseMatrixAssembleCSR_i.argtypes = \
+    [c_void_p,iType,iType,POINTER(iType),POINTER(iType),POINTER(iType)]
+  lib.ElDistSparseMatrixAssembleCSR_s.argtypes = \
+    [c_void_p,iType,iType,POINTER(iType),POINTER(iType),POINTER(sType)]
+  lib.ElDistSparseMatrixAssembleCSR_d.argtypes = \
+    [c_void_p,iType,iType,POINTER(iType),POINTER(iType),POINTER(dType)]
+  lib.ElDistSparseMatrixAssembleCSR_c.argtypes = \
+    [c_void_p,iType,iType,POINTER(iType),POINTER(iType),POINTER(cType)]
+  lib.ElDistSparseMatrixAssembleCSR_z.argtypes = \
+    [c_void_p,iType,iType,POINTER(iType),POINTER(iType),POINTER(zType)]
+  def AssembleCSR(self,firstRow,rowOffsets,cols,values):
+    rowOffsets, rowOffsetsBuf = NumPyBuffer(rowOffsets,iTag)
+    cols, colsBuf = NumPyBuffer(cols,iTag)
+    values, valuesBuf = NumPyBuffer(values,self.tag)
+    if rowOffsets.size == 0 or cols.size != values.size:
+      raise Exception('Invalid CSR arrays')
+    numRows = rowOffsets.size-1
+    args = [self.obj,firstRow,numRows,rowOffsetsBuf,colsBuf,valuesBuf]
+    if   self.tag == iTag: lib.ElDistSparseMatrixAssembleCSR_i(*args)
+    elif self.tag == sTag: lib.ElDistSparseMatrixAssembleCSR_s(*args)
+    elif self.tag == dTag: lib.ElDistSparseMatrixAssembleCSR_d(*args)
+    elif self.tag == cTag: lib.ElDistSparseMatrixAssembleCSR_c(*args)
+    elif self.tag == zTag: lib.ElDistSparseMatrixAssembleCSR_z(*args)
+    else: DataExcept()
+
   # Queries
   # =======
   lib.ElDistSparseMatrixHeight_i.argtypes = \
@@ -9,12 +9,6 @@
 from environment import *
 import numpy as np
 
-buffer_from_memory = pythonapi.PyBuffer_FromMemory
-buffer_from_memory.restype = ctypes.py_object
-
-buffer_from_memory_RW = pythonapi.PyBuffer_FromReadWriteMemory
-buffer_from_memory_RW.restype = ctypes.py_object
-
 class Matrix(object):
   # Create an instance
   # ------------------
@@ -28,6 +22,9 @@ class Matrix(object):
     self.obj = c_void_p()
     CheckTag(tag)
     self.tag = tag
+    # The object (if any) whose memory this matrix views; holding a reference
+    # keeps the viewed buffer alive for as long as this matrix
+    self.owner = None
     if create:
       args = [pointer(self.obj)]
       if   tag == iTag: lib.ElMatrixCreate_i(*args)
@@ -429,18 +426,53 @@ class Matrix(object):
     if   self.tag == cTag: lib.ElMatrixConjugate_c(self.obj,i,j)
     elif self.tag == zTag: lib.ElMatrixConjugate_z(self.obj,i,j)
 
-  def ToNumPy(self):
+  # Expose the buffer to NumPy without a copy
+  # -----------------------------------------
+  # NumPy keeps a reference to this object as the base of the resulting
+  # array, which must not be used after the matrix is resized or destroyed
+  @property
+  def __array_interface__(self):
     m = self.Height()
     n = self.Width()
     ldim = self.LDim()
     locked = self.Locked()
     entrySize = TagToSize(self.tag)
-    npType = TagToNumpyType(self.tag)
-    bufSize = entrySize*ldim*n
-    if locked: buf = buffer_from_memory(self.LockedBuffer(),bufSize)
-    else:      buf = buffer_from_memory_RW(self.Buffer(),bufSize)
-    return np.ndarray(shape=(m,n),strides=(entrySize,ldim*entrySize),
-                        buffer=buf,dtype=npType)
+    address = ctypes.cast(self.Buffer(locked),c_void_p).value
+    return {'version':3,
+            'shape':(m,n),
+            'typestr':np.dtype(TagToNumpyType(self.tag)).str,
+            'data':(address if address != None else 0,locked),
+            'strides':(entrySize,ldim*entrySize)}
+
+  def ToNumPy(self):
+    if self.Height()*self.Width() == 0:
+      return np.empty((self.Height(),self.Width()),
+                      dtype=TagToNumpyType(self.tag),order='F')
+    return np.asarray(self)
+
+  # View the memory of a two-dimensional NumPy array without a copy
+  # ---------------------------------------------------------------
+  # The array must have the datatype of this matrix and unit row stride (e.g.,
+  # be produced by numpy.asfortranarray) and is kept alive by this matrix
+  def AttachNumPy(self,array,locked=False):
+    if array.ndim == 1:
+      array = array.reshape((array.shape[0],1),order='F')
+    if array.ndim != 2:
+      raise Exception('Can only attach to one or two-dimensional arrays')
+    if array.dtype != np.dtype(TagToNumpyType(self.tag)):
+      raise Exception('Datatype of array does not match matrix')
+    m, n = array.shape
+    entrySize = array.itemsize
+    if m > 1 and array.strides[0] != entrySize:
+      raise Exception('Array must be column-major; see numpy.asfortranarray')
+    if n > 1 and (array.strides[1] % entrySize != 0 or
+                  array.strides[1] < m*entrySize):
+      raise Exception('Invalid column stride of array')
+    ldim = max(array.strides[1]//entrySize if n > 1 else m,1)
+    locked = locked or not array.flags.writeable
+    buf = array.ctypes.data_as(POINTER(TagToType(self.tag)))
+    self.Attach(m,n,buf,ldim,locked)
+    self.owner = array
 
   lib.ElView_i.argtypes = \
   lib.ElView_s.argtypes = \
@@ -468,6 +500,7 @@ class Matrix(object):
     iRan = IndexRange(iInd)
     jRan = IndexRange(jInd)
     ASub = Matrix(self.tag)
+    ASub.owner = self
     args = [ASub.obj,self.obj,iRan,jRan]
     if self.Locked():
       if   self.tag == iTag: lib.ElLockedView_i(*args)
@@ -484,3 +517,9 @@ class Matrix(object):
       elif self.tag == zTag: lib.ElView_z(*args)
       else: DataExcept()
     return ASub
+
+# Returns a Matrix which views the memory of the given NumPy array
+def FromNumPy(array,locked=False):
+  A = Matrix(NumpyTypeToTag(array.dtype))
+  A.AttachNumPy(array,locked)
+  return A
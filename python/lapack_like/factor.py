@@ -195,7 +195,7 @@ def SolveAfterCholeskyPiv(uplo,orient,A,p,B):
 
 # Emulate an enum for LDL pivot types
 (BUNCH_KAUFMAN_A,BUNCH_KAUFMAN_C,BUNCH_KAUFMAN_D,BUNCH_KAUFMAN_BOUNDED,
- BUNCH_PARLETT,LDL_WITHOUT_PIVOTING)=(0,1,2,3,4,5)
+ BUNCH_PARLETT,LDL_WITHOUT_PIVOTING,AASEN)=(0,1,2,3,4,5,6)
 
 class LDLPivot(ctypes.Structure):
   _fields_ = [("nb",iType),("from",(iType*2))]
@@ -66,7 +66,8 @@ class SecularSVDCtrl_d(ctypes.Structure):
 
 # Hermitian tridiagonal eigensolvers
 # ==================================
-(HERM_TRIDIAG_EIG_QR,HERM_TRIDIAG_EIG_DC,HERM_TRIDIAG_EIG_MRRR)=(0,1,2)
+(HERM_TRIDIAG_EIG_QR,HERM_TRIDIAG_EIG_DC,HERM_TRIDIAG_EIG_MRRR,
+ HERM_TRIDIAG_EIG_BISECTION)=(0,1,2,3)
 
 class HermitianEigSubset_s(ctypes.Structure):
   _fields_ = [("indexSubset",bType),
@@ -836,6 +837,7 @@ class SVDCtrl_s(ctypes.Structure):
               ("useScaLAPACK",bType),
               ("valChanRatio",dType),
               ("fullChanRatio",dType),
+              ("randomizedRank",iType),
               ("bidiagSVDCtrl",BidiagSVDCtrl_s)]
   def __init__(self):
     lib.ElSVDCtrlDefault_s(pointer(self))
@@ -847,6 +849,7 @@ class SVDCtrl_d(ctypes.Structure):
               ("useScaLAPACK",bType),
               ("valChanRatio",dType),
               ("fullChanRatio",dType),
+              ("randomizedRank",iType),
               ("bidiagSVDCtrl",BidiagSVDCtrl_d)]
   def __init__(self):
     lib.ElSVDCtrlDefault_d(pointer(self))
@@ -8,27 +8,83 @@
 */
 #include <El-lite.hpp>
 #include <El/blas_like.hpp>
+#include <cstdlib>
+#include <map>
 #include <stack>
+#include <tuple>
 
 namespace {
 using namespace El;
 
-std::stack<Int> blocksizeStack;
+// Each level of the stack records whether the blocksize was explicitly set
+// (and therefore overrides any tuned blocksizes)
+struct BlocksizeLevel
+{
+    Int blocksize;
+    bool explicitlySet;
+};
+std::stack<BlocksizeLevel> blocksizeStack;
+
+// The tuned blocksizes indexed by family, datatype and grid shape
+typedef std::tuple<int,string,int,int> TunedKey;
+std::map<TunedKey,Int> tunedBlocksizes;
+
+const char* blocksizeFamilyNames[BlocksizeFamily_MAX] =
+  { "Gemm", "Trsm", "Herk", "Cholesky", "LU", "QR", "HermitianTridiag",
+    "LocalSymv", "LocalTrrk", "LocalTrr2k" };
+
+// Returns zero if there is no tuned blocksize
+Int TunedBlocksize
+( BlocksizeFamily family, const string& datatype,
+  int gridHeight, int gridWidth )
+{
+    auto it =
+      tunedBlocksizes.find( TunedKey(family,datatype,gridHeight,gridWidth) );
+    if( it != tunedBlocksizes.end() )
+        return it->second;
+    it = tunedBlocksizes.find( TunedKey(family,datatype,0,0) );
+    if( it != tunedBlocksizes.end() )
+        return it->second;
+    return 0;
+}
 
+template<typename T>
+Int LookupBlocksize
+( BlocksizeFamily family, int gridHeight, int gridWidth )
+{
+    if( blocksizeStack.empty() || blocksizeStack.top().explicitlySet ||
+        tunedBlocksizes.empty() )
+        return Blocksize();
+    const Int tuned =
+      TunedBlocksize( family, TypeName<T>(), gridHeight, gridWidth );
+    return ( tuned > 0 ? tuned : Blocksize() );
+}
+
+// The local blocksizes are zero until explicitly set, and, until then, the
+// tuned blocksize (or 64) is used
 template<typename T>
 struct LocalSymvBlocksizeHelper { static Int value; };
 template<typename T>
-Int LocalSymvBlocksizeHelper<T>::value = 64;
+Int LocalSymvBlocksizeHelper<T>::value = 0;
 
 template<typename T>
 struct LocalTrrkBlocksizeHelper { static Int value; };
 template<typename T>
-Int LocalTrrkBlocksizeHelper<T>::value = 64;
+Int LocalTrrkBlocksizeHelper<T>::value = 0;
 
 template<typename T>
 struct LocalTrr2kBlocksizeHelper { static Int value; };
 template<typename T>
-Int LocalTrr2kBlocksizeHelper<T>::value = 64;
+Int LocalTrr2kBlocksizeHelper<T>::value = 0;
+
+template<typename T>
+Int LocalBlocksize( BlocksizeFamily family, Int value )
+{
+    if( value > 0 )
+        return value;
+    const Int tuned = TunedBlocksize( family, TypeName<T>(), 1, 1 );
+    return ( tuned > 0 ? tuned : 64 );
+}
 
 }
 
@@ -40,7 +96,7 @@ Int Blocksize()
       if( ::blocksizeStack.empty() )
           LogicError("Attempted to extract blocksize from empty stack");
     )
-    return ::blocksizeStack.top();
+    return ::blocksizeStack.top().blocksize;
 }
 
 void SetBlocksize( Int blocksize )
@@ -49,11 +105,12 @@ void SetBlocksize( Int blocksize )
       if( ::blocksizeStack.empty() )
           LogicError("Attempted to set blocksize at top of empty stack");
     )
-    ::blocksizeStack.top() = blocksize;
+    ::blocksizeStack.top().blocksize = blocksize;
+    ::blocksizeStack.top().explicitlySet = true;
 }
 
 void PushBlocksizeStack( Int blocksize )
-{ ::blocksizeStack.push( blocksize ); }
+{ ::blocksizeStack.push( BlocksizeLevel{blocksize,true} ); }
 
 void PopBlocksizeStack()
 {
@@ -70,13 +127,117 @@ void EmptyBlocksizeStack()
         ::blocksizeStack.pop();
 }
 
+// Called from Initialize
+void InitializeBlocksizes()
+{
+    EmptyBlocksizeStack();
+    ::blocksizeStack.push( BlocksizeLevel{128,false} );
+
+    ClearTunedBlocksizes();
+    const char* profile = std::getenv( "EL_BLOCKSIZE_PROFILE" );
+    if( profile != nullptr && profile[0] != '\0' )
+        LoadBlocksizeProfile( profile );
+}
+
+string BlocksizeFamilyName( BlocksizeFamily family )
+{
+    EL_DEBUG_CSE
+    if( family < 0 || family >= BlocksizeFamily_MAX )
+        LogicError("Invalid blocksize family");
+    return ::blocksizeFamilyNames[family];
+}
+
+BlocksizeFamily BlocksizeFamilyFromName( const string& name )
+{
+    EL_DEBUG_CSE
+    for( int family=0; family<BlocksizeFamily_MAX; ++family )
+        if( name == ::blocksizeFamilyNames[family] )
+            return BlocksizeFamily(family);
+    LogicError("Unknown blocksize family ",name);
+    return BLOCKSIZE_GEMM;
+}
+
+template<typename T>
+Int Blocksize( BlocksizeFamily family )
+{ return ::LookupBlocksize<T>( family, 1, 1 ); }
+
+template<typename T>
+Int Blocksize( BlocksizeFamily family, const Grid& grid )
+{ return ::LookupBlocksize<T>( family, grid.Height(), grid.Width() ); }
+
+template<typename T>
+void SetBlocksize
+( BlocksizeFamily family, Int blocksize, int gridHeight, int gridWidth )
+{
+    EL_DEBUG_CSE
+    if( blocksize < 1 )
+        LogicError("Blocksizes must be positive");
+    if( gridHeight < 0 || gridWidth < 0 )
+        LogicError("Invalid grid dimensions");
+    ::tunedBlocksizes[::TunedKey(family,TypeName<T>(),gridHeight,gridWidth)] =
+      blocksize;
+}
+
+void ClearTunedBlocksizes()
+{ ::tunedBlocksizes.clear(); }
+
+void LoadBlocksizeProfile( const string& filename )
+{
+    EL_DEBUG_CSE
+    std::ifstream file( filename.c_str() );
+    if( !file.is_open() )
+        RuntimeError("Could not open blocksize profile ",filename);
+    string line;
+    Int lineNumber = 0;
+    while( std::getline( file, line ) )
+    {
+        ++lineNumber;
+        std::istringstream is( line );
+        string familyName, datatype;
+        int gridHeight, gridWidth;
+        Int blocksize;
+        if( !(is >> familyName) || familyName[0] == '#' )
+            continue;
+        if( !(is >> gridHeight >> gridWidth >> blocksize) ||
+            !std::getline( is >> std::ws, datatype ) || datatype.empty() ||
+            gridHeight < 0 || gridWidth < 0 || blocksize < 1 )
+            RuntimeError
+            ("Invalid entry on line ",lineNumber," of ",filename,": ",line);
+        const BlocksizeFamily family = BlocksizeFamilyFromName( familyName );
+        ::tunedBlocksizes[::TunedKey(family,datatype,gridHeight,gridWidth)] =
+          blocksize;
+    }
+}
+
+void WriteBlocksizeProfile( const string& filename )
+{
+    EL_DEBUG_CSE
+    if( mpi::Rank() != 0 )
+        return;
+    std::ofstream file( filename.c_str() );
+    if( !file.is_open() )
+        RuntimeError("Could not open ",filename);
+    file << "# <family> <grid height> <grid width> <blocksize> <datatype>\n";
+    for( const auto& entry : ::tunedBlocksizes )
+        file << ::blocksizeFamilyNames[std::get<0>(entry.first)] << " "
+             << std::get<2>(entry.first) << " "
+             << std::get<3>(entry.first) << " "
+             << entry.second << " "
+             << std::get<1>(entry.first) << "\n";
+    if( !file )
+        RuntimeError("Could not write ",filename);
+}
+
 template<typename T>
 void SetLocalSymvBlocksize( Int blocksize )
 { LocalSymvBlocksizeHelper<T>::value = blocksize; }
 
 template<typename T>
 Int LocalSymvBlocksize()
-{ return LocalSymvBlocksizeHelper<T>::value; }
+{
+    return ::LocalBlocksize<T>
+      ( BLOCKSIZE_LOCAL_SYMV, LocalSymvBlocksizeHelper<T>::value );
+}
 
 template<typename T>
 void SetLocalTrrkBlocksize( Int blocksize )
@@ -84,7 +245,10 @@ void SetLocalTrrkBlocksize( Int blocksize )
 
 template<typename T>
 Int LocalTrrkBlocksize()
-{ return LocalTrrkBlocksizeHelper<T>::value; }
+{
+    return ::LocalBlocksize<T>
+      ( BLOCKSIZE_LOCAL_TRRK, LocalTrrkBlocksizeHelper<T>::value );
+}
 
 template<typename T>
 void SetLocalTrr2kBlocksize( Int blocksize )
@@ -92,9 +256,16 @@ void SetLocalTrr2kBlocksize( Int blocksize )
 
 template<typename T>
 Int LocalTrr2kBlocksize()
-{ return LocalTrr2kBlocksizeHelper<T>::value; }
+{
+    return ::LocalBlocksize<T>
+      ( BLOCKSIZE_LOCAL_TRR2K, LocalTrr2kBlocksizeHelper<T>::value );
+}
 
 #define PROTO(T) \
+  template Int Blocksize<T>( BlocksizeFamily family ); \
+  template Int Blocksize<T>( BlocksizeFamily family, const Grid& grid ); \
+  template void SetBlocksize<T> \
+  ( BlocksizeFamily family, Int blocksize, int gridHeight, int gridWidth ); \
   template void SetLocalSymvBlocksize<T>( Int blocksize ); \
   template Int LocalSymvBlocksize<T>(); \
   template void SetLocalTrrkBlocksize<T>( Int blocksize ); \
@@ -55,6 +55,12 @@ ElError ElGetSubgraphDist
   ( CREFLECT(T) alpha, \
     ElConstDistMultiVec_ ## SIG X, ElDistMultiVec_ ## SIG Y ) \
   { EL_TRY( Axpy( CReflect(alpha), *CReflect(X), *CReflect(Y) ) ) } \
+  ElError ElAxpyBatched_ ## SIG \
+  ( CREFLECT(T) alpha, const ElConstMatrix_ ## SIG* X, \
+    const ElMatrix_ ## SIG* Y, ElInt batchSize ) \
+  { EL_TRY( \
+      for( Int k=0; k<batchSize; ++k ) \
+        Axpy( CReflect(alpha), *CReflect(X[k]), *CReflect(Y[k]) ) ) } \
   /* tri(Y) := tri(alpha X + Y) */ \
   ElError ElAxpyTrapezoid_ ## SIG \
   ( ElUpperOrLower uplo, CREFLECT(T) alpha, \
@@ -173,6 +179,12 @@ ElError ElGetSubgraphDist
   ( ElConstDistMultiVec_ ## SIG A, ElConstDistMultiVec_ ## SIG B, \
     CREFLECT(T)* prod ) \
   { EL_TRY( *prod = CReflect(Dot(*CReflect(A),*CReflect(B))) ) } \
+  ElError ElDotBatched_ ## SIG \
+  ( const ElConstMatrix_ ## SIG* A, const ElConstMatrix_ ## SIG* B, \
+    CREFLECT(T)* prods, ElInt batchSize ) \
+  { EL_TRY( \
+      for( Int k=0; k<batchSize; ++k ) \
+        prods[k] = CReflect(Dot(*CReflect(A[k]),*CReflect(B[k]))) ) } \
   /* Unconjugated dot product, vec(A)^T vec(B) */ \
   ElError ElDotu_ ## SIG \
   ( ElConstMatrix_ ## SIG A, ElConstMatrix_ ## SIG B, CREFLECT(T)* prod ) \
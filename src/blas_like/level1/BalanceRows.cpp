@@ -0,0 +1,299 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El-lite.hpp>
+#include <El/blas_like/level1.hpp>
+
+#include <queue>
+
+// Since the rows of distributed graphs, sparse matrices, and multivectors are
+// always split into contiguous blocks of (nearly) equal size, the number of
+// local nonzeros is balanced by swapping rows between the processes, which
+// leaves the number of rows owned by each process unchanged.
+//
+// Each process whose number of edges exceeds the average offers its
+// heaviest rows, while each process below the average offers its lightest
+// rows. The root then greedily pairs the offered heavy rows (in order of
+// decreasing weight) with the lightest remaining row of the process furthest
+// below the average, accepting a swap only if it decreases the larger of the
+// two loads. Only the swapped rows move, which keeps the volume of the
+// redistribution proportional to the imbalance.
+
+namespace El {
+
+void BalanceRows( const DistGraph& graph, DistMap& rowMap )
+{
+    EL_DEBUG_CSE
+    const Grid& grid = graph.Grid();
+    mpi::Comm comm = grid.Comm();
+    const int commSize = grid.Size();
+    const int commRank = grid.Rank();
+    const Int firstLocalSource = graph.FirstLocalSource();
+    const Int numLocalSources = graph.NumLocalSources();
+
+    rowMap.SetGrid( grid );
+    rowMap.Resize( graph.NumSources() );
+    for( Int iLoc=0; iLoc<numLocalSources; ++iLoc )
+        rowMap.SetLocal( iLoc, firstLocalSource+iLoc );
+    if( commSize == 1 )
+        return;
+
+    const Int numLocalEdges = graph.NumLocalEdges();
+    vector<Int> loads(commSize);
+    mpi::AllGather( &numLocalEdges, 1, loads.data(), 1, comm );
+    Int numEdges = 0;
+    for( int q=0; q<commSize; ++q )
+        numEdges += loads[q];
+    const double target = double(numEdges) / commSize;
+
+    // Sort our rows by their numbers of connections
+    vector<ValueInt<Int>> weights(numLocalSources);
+    for( Int iLoc=0; iLoc<numLocalSources; ++iLoc )
+        weights[iLoc] =
+          ValueInt<Int>{graph.NumConnections(iLoc),firstLocalSource+iLoc};
+    std::sort( weights.begin(), weights.end(), ValueInt<Int>::Lesser );
+
+    // Offer enough of our heaviest rows to (roughly) cover twice our excess
+    const double excess = loads[commRank] - target;
+    vector<Int> offers;
+    if( excess > 0 )
+    {
+        double offered = 0;
+        for( Int k=numLocalSources-1; k>=0 && offered<2*excess; --k )
+        {
+            offers.push_back( weights[k].index );
+            offers.push_back( weights[k].value );
+            offered += weights[k].value;
+        }
+    }
+    const Int numLocalExports = offers.size() / 2;
+    const Int numExports = mpi::AllReduce( numLocalExports, comm );
+    if( numExports == 0 )
+        return;
+
+    // Offer our lightest rows in proportion to our deficit
+    double totalDeficit = 0;
+    for( int q=0; q<commSize; ++q )
+        totalDeficit += Max( target-loads[q], 0. );
+    if( excess < 0 )
+    {
+        const Int numImports =
+          Min( numLocalSources,
+               2*Int(Ceil(numExports*(-excess)/totalDeficit))+1 );
+        for( Int k=0; k<numImports; ++k )
+        {
+            offers.push_back( weights[k].index );
+            offers.push_back( weights[k].value );
+        }
+    }
+    SwapClear( weights );
+
+    // Gather the offers to the root
+    const int root = 0;
+    const int numLocalOffers = offers.size();
+    vector<int> offerSizes(commSize);
+    mpi::Gather( &numLocalOffers, 1, offerSizes.data(), 1, root, comm );
+    vector<int> offerOffs;
+    const int totalOffers = Scan( offerSizes, offerOffs );
+    vector<Int> allOffers;
+    if( commRank == root )
+        allOffers.resize( totalOffers );
+    mpi::Gather
+    ( offers.data(), numLocalOffers,
+      allOffers.data(), offerSizes.data(), offerOffs.data(), root, comm );
+    SwapClear( offers );
+
+    // Greedily pair the heavy rows with the light rows
+    vector<Int> swaps;
+    if( commRank == root )
+    {
+        vector<double> rootLoads( loads.begin(), loads.end() );
+        struct Export { Int row, weight; int owner; };
+        vector<Export> exports;
+        vector<Int> nextImport(commSize), endImport(commSize);
+        for( int q=0; q<commSize; ++q )
+        {
+            nextImport[q] = endImport[q] = offerOffs[q];
+            if( rootLoads[q] > target )
+            {
+                for( Int s=offerOffs[q]; s<offerOffs[q]+offerSizes[q]; s+=2 )
+                    exports.push_back
+                    ( Export{allOffers[s],allOffers[s+1],q} );
+            }
+            else
+                endImport[q] = offerOffs[q] + offerSizes[q];
+        }
+        std::sort
+        ( exports.begin(), exports.end(),
+          []( const Export& a, const Export& b )
+          { return a.weight > b.weight; } );
+
+        // A max-heap of the deficits of the processes with remaining offers
+        typedef std::pair<double,int> Deficit;
+        std::priority_queue<Deficit> deficits;
+        for( int q=0; q<commSize; ++q )
+            if( nextImport[q] < endImport[q] )
+                deficits.push( Deficit(target-rootLoads[q],q) );
+        for( const auto& exp : exports )
+        {
+            if( deficits.empty() )
+                break;
+            if( rootLoads[exp.owner] <= target )
+                continue;
+            const int q = deficits.top().second;
+            const Int row = allOffers[nextImport[q]];
+            const Int delta = exp.weight - allOffers[nextImport[q]+1];
+            if( delta <= 0 ||
+                rootLoads[q]+delta >= rootLoads[exp.owner] )
+                continue;
+            deficits.pop();
+            swaps.push_back( exp.row );
+            swaps.push_back( row );
+            rootLoads[exp.owner] -= delta;
+            rootLoads[q] += delta;
+            nextImport[q] += 2;
+            if( nextImport[q] < endImport[q] && rootLoads[q] < target )
+                deficits.push( Deficit(target-rootLoads[q],q) );
+        }
+    }
+
+    // Broadcast the swaps and apply those of our rows
+    Int numSwapEntries = swaps.size();
+    mpi::Broadcast( numSwapEntries, root, comm );
+    swaps.resize( numSwapEntries );
+    mpi::Broadcast( swaps.data(), numSwapEntries, root, comm );
+    for( Int s=0; s<numSwapEntries; s+=2 )
+    {
+        const Int i = swaps[s];
+        const Int j = swaps[s+1];
+        if( i >= firstLocalSource && i < firstLocalSource+numLocalSources )
+            rowMap.SetLocal( i-firstLocalSource, j );
+        if( j >= firstLocalSource && j < firstLocalSource+numLocalSources )
+            rowMap.SetLocal( j-firstLocalSource, i );
+    }
+}
+
+template<typename T>
+void BalanceRows( const DistSparseMatrix<T>& A, DistMap& rowMap )
+{
+    EL_DEBUG_CSE
+    BalanceRows( A.LockedDistGraph(), rowMap );
+}
+
+template<typename T>
+void PermuteDistMapRows( const DistMap& rowMap, DistSparseMatrix<T>& A )
+{
+    EL_DEBUG_CSE
+    if( rowMap.NumSources() != A.Height() )
+        LogicError
+        ("Map had ",rowMap.NumSources()," sources but A had height ",
+         A.Height());
+    const Int localHeight = A.LocalHeight();
+    const Int numLocalEntries = A.NumLocalEntries();
+    const Int* colBuf = A.LockedTargetBuffer();
+    const T* valBuf = A.LockedValueBuffer();
+    vector<Int> rows(numLocalEntries);
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+    {
+        const Int offset = A.RowOffset( iLoc );
+        const Int numConn = A.NumConnections( iLoc );
+        const Int i = rowMap.GetLocal( iLoc );
+        for( Int e=offset; e<offset+numConn; ++e )
+            rows[e] = i;
+    }
+    DistSparseMatrix<T> B(A.Grid());
+    B.Resize( A.Height(), A.Width() );
+    B.AssembleCOO( numLocalEntries, rows.data(), colBuf, valBuf );
+    A = std::move(B);
+}
+
+template<typename T>
+void PermuteDistMapCols( const DistMap& colMap, DistSparseMatrix<T>& A )
+{
+    EL_DEBUG_CSE
+    if( colMap.NumSources() != A.Width() )
+        LogicError
+        ("Map had ",colMap.NumSources()," sources but A had width ",
+         A.Width());
+    const Int localHeight = A.LocalHeight();
+    const Int numLocalEntries = A.NumLocalEntries();
+    const Int* colBuf = A.LockedTargetBuffer();
+    const T* valBuf = A.LockedValueBuffer();
+    vector<Int> rows(numLocalEntries), cols(colBuf,colBuf+numLocalEntries);
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+    {
+        const Int offset = A.RowOffset( iLoc );
+        const Int numConn = A.NumConnections( iLoc );
+        const Int i = A.GlobalRow( iLoc );
+        for( Int e=offset; e<offset+numConn; ++e )
+            rows[e] = i;
+    }
+    colMap.Translate( cols );
+    DistSparseMatrix<T> B(A.Grid());
+    B.Resize( A.Height(), A.Width() );
+    B.AssembleCOO( numLocalEntries, rows.data(), cols.data(), valBuf );
+    A = std::move(B);
+}
+
+template<typename T>
+void PermuteDistMapRows( const DistMap& rowMap, DistMultiVec<T>& X )
+{
+    EL_DEBUG_CSE
+    if( rowMap.NumSources() != X.Height() )
+        LogicError
+        ("Map had ",rowMap.NumSources()," sources but X had height ",
+         X.Height());
+    const int commRank = X.Grid().Rank();
+    const Int localHeight = X.LocalHeight();
+    const Int width = X.Width();
+    const Int firstLocalRow = X.FirstLocalRow();
+    const auto& XLoc = X.LockedMatrix();
+
+    DistMultiVec<T> Y(X.Grid());
+    Y.Resize( X.Height(), width );
+    auto& YLoc = Y.Matrix();
+    Zero( YLoc );
+    Int numRemote = 0;
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+        if( Y.RowOwner(rowMap.GetLocal(iLoc)) != commRank )
+            ++numRemote;
+    Y.Reserve( numRemote*width );
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+    {
+        const Int i = rowMap.GetLocal( iLoc );
+        if( Y.RowOwner(i) == commRank )
+        {
+            for( Int j=0; j<width; ++j )
+                YLoc(i-firstLocalRow,j) = XLoc(iLoc,j);
+        }
+        else
+        {
+            for( Int j=0; j<width; ++j )
+                Y.QueueUpdate( i, j, XLoc(iLoc,j) );
+        }
+    }
+    Y.ProcessQueues();
+    X = std::move(Y);
+}
+
+#define PROTO(T) \
+  template void BalanceRows \
+  ( const DistSparseMatrix<T>& A, DistMap& rowMap ); \
+  template void PermuteDistMapRows \
+  ( const DistMap& rowMap, DistSparseMatrix<T>& A ); \
+  template void PermuteDistMapCols \
+  ( const DistMap& colMap, DistSparseMatrix<T>& A ); \
+  template void PermuteDistMapRows \
+  ( const DistMap& rowMap, DistMultiVec<T>& X );
+
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#include <El/macros/Instantiate.h>
+
+} // namespace El
@@ -0,0 +1,384 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El-lite.hpp>
+#include <El/blas_like/level1.hpp>
+
+namespace El {
+
+namespace column_blocks {
+
+// The distribution of the local data of each process of the VC communicator,
+// which is only known to the root
+struct BlockOwners
+{
+    vector<Int> active, colShifts, rowShifts;
+};
+
+BlockOwners GatherOwners
+( bool active, Int colShift, Int rowShift,
+  int root, int commSize, int commRank, mpi::Comm comm )
+{
+    EL_DEBUG_CSE
+    Int myInfo[3] = { Int(active), colShift, rowShift };
+    vector<Int> info;
+    if( commRank == root )
+        info.resize( 3*commSize );
+    mpi::Gather( myInfo, 3, info.data(), 3, root, comm );
+
+    BlockOwners owners;
+    if( commRank == root )
+    {
+        owners.active.resize( commSize );
+        owners.colShifts.resize( commSize );
+        owners.rowShifts.resize( commSize );
+        for( int q=0; q<commSize; ++q )
+        {
+            owners.active[q] = info[3*q+0];
+            owners.colShifts[q] = info[3*q+1];
+            owners.rowShifts[q] = info[3*q+2];
+        }
+    }
+    return owners;
+}
+
+} // namespace column_blocks
+
+namespace {
+
+// The number of local columns of a process with the given row shift within
+// the global columns [jBeg,jEnd)
+inline Int LocalBlockWidth( Int jBeg, Int jEnd, Int rowShift, Int rowStride )
+{ return Length(jEnd,rowShift,rowStride) - Length(jBeg,rowShift,rowStride); }
+
+} // anonymous namespace
+
+template<typename T>
+void GatherColumnBlocks
+( const ElementalMatrix<T>& A,
+  const function<void(Int,const Matrix<T>&)>& writer,
+  Int blockWidth, int root )
+{
+    EL_DEBUG_CSE
+    if( blockWidth <= 0 )
+        LogicError("The block width must be positive");
+    const Grid& grid = A.Grid();
+    if( !grid.InGrid() )
+        return;
+    mpi::Comm comm = grid.VCComm();
+    const int commSize = grid.Size();
+    const int commRank = grid.VCRank();
+    if( root < 0 || root >= commSize )
+        LogicError("Invalid root ",root);
+
+    const Int height = A.Height();
+    const Int width = A.Width();
+    const Int colStride = A.ColStride();
+    const Int rowStride = A.RowStride();
+    const Int numBlocks = ( width > 0 ? (width+blockWidth-1)/blockWidth : 0 );
+
+    // Only one copy of each redundantly-stored entry is sent
+    const bool sending =
+      A.Participating() && A.RedundantRank() == 0 && A.CrossRank() == A.Root();
+    const Int colShift = ( sending ? A.ColShift() : 0 );
+    const Int rowShift = ( sending ? A.RowShift() : 0 );
+    const column_blocks::BlockOwners owners =
+      column_blocks::GatherOwners
+      ( sending, colShift, rowShift, root, commSize, commRank, comm );
+
+    if( commRank != root )
+    {
+        if( !sending )
+            return;
+        // Double-buffer the sends so that packing overlaps the transfer of
+        // the previous block
+        const Int localHeight = A.LocalHeight();
+        vector<T> sendBufs[2];
+        mpi::Request<T> requests[2];
+        bool pending[2] = { false, false };
+        for( Int b=0; b<numBlocks; ++b )
+        {
+            const Int jBeg = b*blockWidth;
+            const Int jEnd = Min(jBeg+blockWidth,width);
+            const Int jLocBeg = Length(jBeg,rowShift,rowStride);
+            const Int localWidth =
+              LocalBlockWidth( jBeg, jEnd, rowShift, rowStride );
+            const Int numEntries = localHeight*localWidth;
+            if( numEntries == 0 )
+                continue;
+            const int k = b % 2;
+            if( pending[k] )
+                mpi::Wait( requests[k] );
+            FastResize( sendBufs[k], numEntries );
+            copy::util::InterleaveMatrix
+            ( localHeight, localWidth,
+              A.LockedBuffer(0,jLocBeg), 1, A.LDim(),
+              sendBufs[k].data(),        1, localHeight );
+            mpi::ISend
+            ( sendBufs[k].data(), numEntries, root, comm, requests[k] );
+            pending[k] = true;
+        }
+        for( int k=0; k<2; ++k )
+            if( pending[k] )
+                mpi::Wait( requests[k] );
+        return;
+    }
+
+    // The root receives the next block while the current one is written
+    vector<T> recvBufs[2];
+    vector<int> recvOffs[2];
+    vector<mpi::Request<T>> requests[2];
+    auto postRecvs =
+      [&]( Int b )
+      {
+        const int k = b % 2;
+        const Int jBeg = b*blockWidth;
+        const Int jEnd = Min(jBeg+blockWidth,width);
+        recvOffs[k].resize( commSize );
+        int totalRecv = 0;
+        for( int q=0; q<commSize; ++q )
+        {
+            recvOffs[k][q] = totalRecv;
+            if( q == root || !owners.active[q] )
+                continue;
+            const Int localHeight =
+              Length( height, owners.colShifts[q], colStride );
+            totalRecv += localHeight*
+              LocalBlockWidth( jBeg, jEnd, owners.rowShifts[q], rowStride );
+        }
+        FastResize( recvBufs[k], totalRecv );
+        requests[k].clear();
+        requests[k].resize( commSize );
+        Int numRequests = 0;
+        for( int q=0; q<commSize; ++q )
+        {
+            const int count =
+              ( q+1<commSize ? recvOffs[k][q+1] : totalRecv ) - recvOffs[k][q];
+            if( q == root || count == 0 )
+                continue;
+            mpi::IRecv
+            ( &recvBufs[k][recvOffs[k][q]], count, q, comm,
+              requests[k][numRequests++] );
+        }
+        requests[k].resize( numRequests );
+      };
+
+    Matrix<T> block;
+    if( numBlocks > 0 )
+        postRecvs( 0 );
+    for( Int b=0; b<numBlocks; ++b )
+    {
+        const int k = b % 2;
+        if( b+1 < numBlocks )
+            postRecvs( b+1 );
+        const Int jBeg = b*blockWidth;
+        const Int jEnd = Min(jBeg+blockWidth,width);
+        block.Resize( height, jEnd-jBeg );
+
+        if( sending )
+        {
+            const Int jLocBeg = Length(jBeg,rowShift,rowStride);
+            const Int jFirst = rowShift + jLocBeg*rowStride;
+            copy::util::InterleaveMatrix
+            ( A.LocalHeight(),
+              LocalBlockWidth( jBeg, jEnd, rowShift, rowStride ),
+              A.LockedBuffer(0,jLocBeg), 1, A.LDim(),
+              block.Buffer(colShift,jFirst-jBeg),
+              colStride, rowStride*block.LDim() );
+        }
+
+        if( requests[k].size() != 0 )
+            mpi::WaitAll( requests[k].size(), requests[k].data() );
+        for( int q=0; q<commSize; ++q )
+        {
+            if( q == root || !owners.active[q] )
+                continue;
+            const Int qColShift = owners.colShifts[q];
+            const Int qRowShift = owners.rowShifts[q];
+            const Int localHeight = Length( height, qColShift, colStride );
+            const Int localWidth =
+              LocalBlockWidth( jBeg, jEnd, qRowShift, rowStride );
+            if( localHeight*localWidth == 0 )
+                continue;
+            const Int jFirst =
+              qRowShift + Length(jBeg,qRowShift,rowStride)*rowStride;
+            copy::util::InterleaveMatrix
+            ( localHeight, localWidth,
+              &recvBufs[k][recvOffs[k][q]], 1, localHeight,
+              block.Buffer(qColShift,jFirst-jBeg),
+              colStride, rowStride*block.LDim() );
+        }
+        writer( jBeg, block );
+    }
+}
+
+template<typename T>
+void ScatterColumnBlocks
+( const function<void(Int,Matrix<T>&)>& reader,
+  ElementalMatrix<T>& B,
+  Int blockWidth, int root )
+{
+    EL_DEBUG_CSE
+    if( blockWidth <= 0 )
+        LogicError("The block width must be positive");
+    const Grid& grid = B.Grid();
+    if( !grid.InGrid() )
+        return;
+    mpi::Comm comm = grid.VCComm();
+    const int commSize = grid.Size();
+    const int commRank = grid.VCRank();
+    if( root < 0 || root >= commSize )
+        LogicError("Invalid root ",root);
+
+    const Int height = B.Height();
+    const Int width = B.Width();
+    const Int colStride = B.ColStride();
+    const Int rowStride = B.RowStride();
+    const Int numBlocks = ( width > 0 ? (width+blockWidth-1)/blockWidth : 0 );
+
+    // Every copy of redundantly-stored entries is sent
+    const bool receiving = B.Participating();
+    const Int colShift = ( receiving ? B.ColShift() : 0 );
+    const Int rowShift = ( receiving ? B.RowShift() : 0 );
+    const column_blocks::BlockOwners owners =
+      column_blocks::GatherOwners
+      ( receiving, colShift, rowShift, root, commSize, commRank, comm );
+
+    if( commRank != root )
+    {
+        if( !receiving )
+            return;
+        // Receive the next block while unpacking the current one
+        const Int localHeight = B.LocalHeight();
+        vector<T> recvBufs[2];
+        mpi::Request<T> requests[2];
+        bool pending[2] = { false, false };
+        auto postRecv =
+          [&]( Int b )
+          {
+            const int k = b % 2;
+            const Int jBeg = b*blockWidth;
+            const Int jEnd = Min(jBeg+blockWidth,width);
+            const Int numEntries =
+              localHeight*LocalBlockWidth( jBeg, jEnd, rowShift, rowStride );
+            pending[k] = ( numEntries != 0 );
+            if( !pending[k] )
+                return;
+            FastResize( recvBufs[k], numEntries );
+            mpi::IRecv
+            ( recvBufs[k].data(), numEntries, root, comm, requests[k] );
+          };
+        if( numBlocks > 0 )
+            postRecv( 0 );
+        for( Int b=0; b<numBlocks; ++b )
+        {
+            const int k = b % 2;
+            // The buffer of the next block was released by the previous one
+            if( b+1 < numBlocks )
+                postRecv( b+1 );
+            if( !pending[k] )
+                continue;
+            mpi::Wait( requests[k] );
+            const Int jBeg = b*blockWidth;
+            const Int jEnd = Min(jBeg+blockWidth,width);
+            const Int jLocBeg = Length(jBeg,rowShift,rowStride);
+            copy::util::InterleaveMatrix
+            ( localHeight, LocalBlockWidth( jBeg, jEnd, rowShift, rowStride ),
+              recvBufs[k].data(),  1, localHeight,
+              B.Buffer(0,jLocBeg), 1, B.LDim() );
+        }
+        return;
+    }
+
+    // The root reads the next block while the current one is in transit
+    vector<T> sendBufs[2];
+    vector<mpi::Request<T>> requests[2];
+    Matrix<T> block;
+    for( Int b=0; b<numBlocks; ++b )
+    {
+        const int k = b % 2;
+        const Int jBeg = b*blockWidth;
+        const Int jEnd = Min(jBeg+blockWidth,width);
+        block.Resize( height, jEnd-jBeg );
+        reader( jBeg, block );
+
+        if( requests[k].size() != 0 )
+            mpi::WaitAll( requests[k].size(), requests[k].data() );
+        vector<int> sendOffs( commSize );
+        int totalSend = 0;
+        for( int q=0; q<commSize; ++q )
+        {
+            sendOffs[q] = totalSend;
+            if( q == root || !owners.active[q] )
+                continue;
+            totalSend += Length( height, owners.colShifts[q], colStride )*
+              LocalBlockWidth( jBeg, jEnd, owners.rowShifts[q], rowStride );
+        }
+        FastResize( sendBufs[k], totalSend );
+        requests[k].clear();
+        requests[k].resize( commSize );
+        Int numRequests = 0;
+        for( int q=0; q<commSize; ++q )
+        {
+            if( q == root || !owners.active[q] )
+                continue;
+            const Int qColShift = owners.colShifts[q];
+            const Int qRowShift = owners.rowShifts[q];
+            const Int localHeight = Length( height, qColShift, colStride );
+            const Int localWidth =
+              LocalBlockWidth( jBeg, jEnd, qRowShift, rowStride );
+            const int count = localHeight*localWidth;
+            if( count == 0 )
+                continue;
+            const Int jFirst =
+              qRowShift + Length(jBeg,qRowShift,rowStride)*rowStride;
+            T* sendBuf = &sendBufs[k][sendOffs[q]];
+            copy::util::InterleaveMatrix
+            ( localHeight, localWidth,
+              block.LockedBuffer(qColShift,jFirst-jBeg),
+              colStride, rowStride*block.LDim(),
+              sendBuf, 1, localHeight );
+            mpi::ISend( sendBuf, count, q, comm, requests[k][numRequests++] );
+        }
+        requests[k].resize( numRequests );
+
+        if( receiving )
+        {
+            const Int jLocBeg = Length(jBeg,rowShift,rowStride);
+            const Int jFirst = rowShift + jLocBeg*rowStride;
+            copy::util::InterleaveMatrix
+            ( B.LocalHeight(),
+              LocalBlockWidth( jBeg, jEnd, rowShift, rowStride ),
+              block.LockedBuffer(colShift,jFirst-jBeg),
+              colStride, rowStride*block.LDim(),
+              B.Buffer(0,jLocBeg), 1, B.LDim() );
+        }
+    }
+    for( int k=0; k<2; ++k )
+        if( requests[k].size() != 0 )
+            mpi::WaitAll( requests[k].size(), requests[k].data() );
+}
+
+#define PROTO(T) \
+  template void GatherColumnBlocks \
+  ( const ElementalMatrix<T>& A, \
+    const function<void(Int,const Matrix<T>&)>& writer, \
+    Int blockWidth, int root ); \
+  template void ScatterColumnBlocks \
+  ( const function<void(Int,Matrix<T>&)>& reader, \
+    ElementalMatrix<T>& B, \
+    Int blockWidth, int root );
+
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGINT
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
@@ -24,6 +24,7 @@ void ColumnTwoNormsHelper
     // TODO(poulson): Ensure that NaN's propagate
     Matrix<Real> localScales( nLocal, 1 ),
                  localScaledSquares( nLocal, 1 );
+    EL_PARALLEL_FOR_IF(ParallelizeLoop(mLocal*nLocal))
     for( Int jLoc=0; jLoc<nLocal; ++jLoc )
     {
         Real localScale = 0;
@@ -51,6 +52,7 @@ void ColumnTwoNormsHelper
 
     // TODO(poulson): Ensure that NaN's propagate
     Matrix<Real> localScales( nLocal, 1 ), localScaledSquares( nLocal, 1 );
+    EL_PARALLEL_FOR_IF(ParallelizeLoop(2*mLocal*nLocal))
     for( Int jLoc=0; jLoc<nLocal; ++jLoc )
     {
         Real localScale = 0;
@@ -81,6 +83,7 @@ void ColumnTwoNorms( const Matrix<Field>& X, Matrix<Base<Field>>& norms )
         Zero( norms );
         return;
     }
+    EL_PARALLEL_FOR_IF(ParallelizeLoop(m*n))
     for( Int j=0; j<n; ++j )
         norms(j) = blas::Nrm2( m, &X(0,j), 1 );
 }
@@ -93,6 +96,7 @@ void ColumnMaxNorms( const Matrix<Field>& X, Matrix<Base<Field>>& norms )
     const Int m = X.Height();
     const Int n = X.Width();
     norms.Resize( n, 1 );
+    EL_PARALLEL_FOR_IF(ParallelizeLoop(m*n))
     for( Int j=0; j<n; ++j )
     {
         // TODO(poulson): Ensure that NaN's propagate
@@ -9,8 +9,73 @@
 #include <El-lite.hpp>
 #include <El/blas_like/level1.hpp>
 
+#include <list>
+#include <map>
+
+namespace {
+
+El::Int redistPlanCacheSize = 0;
+
+// Each pair of (process-local) grid identifiers has its own LRU list, with
+// the most-recently used plan at the front
+std::map<std::pair<El::size_t,El::size_t>,std::list<El::copy::RedistPlan>>
+  redistPlanCache;
+
+} // anonymous namespace
+
 namespace El {
 
+void SetRedistPlanCacheSize( Int numPlans )
+{
+    EL_DEBUG_CSE
+    if( numPlans < 0 )
+        LogicError("Cache size must be non-negative");
+    ::redistPlanCacheSize = numPlans;
+    for( auto& entry : ::redistPlanCache )
+        while( Int(entry.second.size()) > numPlans )
+            entry.second.pop_back();
+}
+
+Int RedistPlanCacheSize() { return ::redistPlanCacheSize; }
+
+void ClearRedistPlanCache() { ::redistPlanCache.clear(); }
+
+namespace copy {
+
+RedistPlan* FindRedistPlan
+( size_t gridIdA, size_t gridIdB,
+  const function<bool(const RedistPlan&)>& matches )
+{
+    EL_DEBUG_CSE
+    auto bucket = ::redistPlanCache.find( std::make_pair(gridIdA,gridIdB) );
+    if( bucket == ::redistPlanCache.end() )
+        return nullptr;
+    auto& plans = bucket->second;
+    for( auto it=plans.begin(); it!=plans.end(); ++it )
+    {
+        if( matches(*it) )
+        {
+            // Move the plan to the front of the LRU list
+            plans.splice( plans.begin(), plans, it );
+            return &plans.front();
+        }
+    }
+    return nullptr;
+}
+
+RedistPlan& AddRedistPlan( RedistPlan&& plan )
+{
+    EL_DEBUG_CSE
+    auto key = std::make_pair( plan.GridIdA(), plan.GridIdB() );
+    auto& plans = ::redistPlanCache[key];
+    plans.push_front( std::move(plan) );
+    while( Int(plans.size()) > Max(::redistPlanCacheSize,Int(1)) )
+        plans.pop_back();
+    return plans.front();
+}
+
+} // namespace copy
+
 void Copy( const Graph& A, Graph& B )
 {
     EL_DEBUG_CSE
@@ -23,6 +88,7 @@ void Copy( const Graph& A, Graph& B )
     B.targets_ = A.targets_;
     B.consistent_ = A.consistent_;
     B.sourceOffsets_ = A.sourceOffsets_;
+    B.compressedSources_ = A.compressedSources_;
     B.ProcessQueues();
 }
 
@@ -39,6 +105,7 @@ void Copy( const Graph& A, DistGraph& B )
     B.targets_ = A.targets_;
     B.locallyConsistent_ = A.consistent_;
     B.localSourceOffsets_ = A.sourceOffsets_;
+    B.compressedSources_ = A.compressedSources_;
     B.ProcessLocalQueues();
 }
 
@@ -56,6 +123,7 @@ void Copy( const DistGraph& A, Graph& B )
     B.targets_ = A.targets_;
     B.consistent_ = A.locallyConsistent_;
     B.sourceOffsets_ = A.localSourceOffsets_;
+    B.compressedSources_ = A.compressedSources_;
     B.ProcessQueues();
 }
 
@@ -73,6 +141,7 @@ void Copy( const DistGraph& A, DistGraph& B )
     B.multMeta = A.multMeta;
     B.locallyConsistent_ = A.locallyConsistent_;
     B.localSourceOffsets_ = A.localSourceOffsets_;
+    B.compressedSources_ = A.compressedSources_;
     B.ProcessLocalQueues();
 }
 
@@ -104,6 +173,86 @@ void CopyFromRoot( const DistGraph& distGraph, Graph& graph )
     graph.ProcessQueues();
 }
 
+#ifdef EL_HAVE_MPC
+namespace copy {
+
+// Return true if each of the entries share the given precision and have
+// limbs stored contiguously, in column-major order, following those of the
+// first entry
+bool ContiguousLimbs
+( const BigFloat* buf, Int height, Int width, Int ldim, mpfr_prec_t prec )
+{
+    EL_DEBUG_CSE
+    if( height == 0 || width == 0 )
+        return true;
+    const size_t numLimbs = buf[0].NumLimbs();
+    const mp_limb_t* base = buf[0].LockedLimbs();
+    for( Int j=0; j<width; ++j )
+    {
+        for( Int i=0; i<height; ++i )
+        {
+            const BigFloat& alpha = buf[i+j*ldim];
+            if( alpha.OwnsLimbs() || alpha.Precision() != prec ||
+                alpha.LockedLimbs() != base+(i+j*ldim)*numLimbs )
+                return false;
+        }
+    }
+    return true;
+}
+
+} // namespace copy
+
+void Copy( const Matrix<BigFloat>& A, Matrix<BigFloat>& B )
+{
+    EL_DEBUG_CSE
+    const Int height = A.Height();
+    const Int width = A.Width();
+    B.Resize( height, width );
+    const Int ldA = A.LDim();
+    const Int ldB = B.LDim();
+    const BigFloat* ABuf = A.LockedBuffer();
+          BigFloat* BBuf = B.Buffer();
+    if( height == 0 || width == 0 )
+        return;
+
+    const mpfr_prec_t prec = ABuf[0].Precision();
+    if( !copy::ContiguousLimbs( ABuf, height, width, ldA, prec ) ||
+        !copy::ContiguousLimbs( BBuf, height, width, ldB, prec ) )
+    {
+        for( Int j=0; j<width; ++j )
+            for( Int i=0; i<height; ++i )
+                BBuf[i+j*ldB] = ABuf[i+j*ldA];
+        return;
+    }
+
+    // Copy the limbs in bulk and then the signs and exponents
+    const size_t numLimbs = ABuf[0].NumLimbs();
+    const mp_limb_t* ALimbs = ABuf[0].LockedLimbs();
+          mp_limb_t* BLimbs = BBuf[0].Limbs();
+    if( ldA == height && ldB == height )
+    {
+        MemCopy( BLimbs, ALimbs, size_t(height*width)*numLimbs );
+    }
+    else
+    {
+        for( Int j=0; j<width; ++j )
+            MemCopy
+            ( &BLimbs[j*ldB*numLimbs], &ALimbs[j*ldA*numLimbs],
+              size_t(height)*numLimbs );
+    }
+    for( Int j=0; j<width; ++j )
+    {
+        for( Int i=0; i<height; ++i )
+        {
+            mpfr_srcptr alpha = ABuf[i+j*ldA].LockedPointer();
+            mpfr_ptr beta = BBuf[i+j*ldB].Pointer();
+            beta->_mpfr_sign = alpha->_mpfr_sign;
+            beta->_mpfr_exp = alpha->_mpfr_exp;
+        }
+    }
+}
+#endif // ifdef EL_HAVE_MPC
+
 void CopyFromNonRoot( const DistGraph& distGraph, int root )
 {
     EL_DEBUG_CSE
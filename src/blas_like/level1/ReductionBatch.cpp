@@ -0,0 +1,310 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El-lite.hpp>
+#include <El/blas_like/level1.hpp>
+
+namespace El {
+
+namespace reduction_batch {
+
+template<typename Real>
+Real CombineNorms( const Real& alpha, const Real& beta )
+{ return SafeNorm( alpha, beta ); }
+
+template<typename Field>
+Base<Field> LocalFrobeniusNorm( const Matrix<Field>& A )
+{
+    typedef Base<Field> Real;
+    Real scale=0, scaledSquare=1;
+    const Int height = A.Height();
+    const Int width = A.Width();
+    const Field* ABuf = A.LockedBuffer();
+    const Int ALDim = A.LDim();
+    for( Int j=0; j<width; ++j )
+        for( Int i=0; i<height; ++i )
+            UpdateScaledSquare( ABuf[i+j*ALDim], scale, scaledSquare );
+    return scale*Sqrt(scaledSquare);
+}
+
+// Only a single copy of each redundantly-stored entry is counted
+template<typename Field>
+bool Contributes( const AbstractDistMatrix<Field>& A )
+{ return A.Participating() && A.RedundantRank() == 0; }
+
+} // namespace reduction_batch
+
+template<typename Field>
+ReductionBatch<Field>::ReductionBatch( mpi::Comm comm )
+: comm_(comm)
+{ }
+
+template<typename Field>
+Int ReductionBatch<Field>::Queue( Kind kind, const Field& localValue )
+{
+    EL_DEBUG_CSE
+    if( started_ )
+        LogicError("Cannot queue reductions after starting the batch");
+    kinds_.push_back( kind );
+    switch( kind )
+    {
+    case SUM_REDUCTION:
+        offsets_.push_back( sums_.size() );
+        sums_.push_back( RealPart(localValue) );
+        if( IsComplex<Field>::value )
+            sums_.push_back( ImagPart(localValue) );
+        break;
+    case MAX_REDUCTION:
+        offsets_.push_back( maxes_.size() );
+        maxes_.push_back( RealPart(localValue) );
+        break;
+    case MIN_REDUCTION:
+        offsets_.push_back( maxes_.size() );
+        maxes_.push_back( -RealPart(localValue) );
+        break;
+    case TWO_NORM_REDUCTION:
+        offsets_.push_back( norms_.size() );
+        norms_.push_back( RealPart(localValue) );
+        break;
+    }
+    finished_ = false;
+    return kinds_.size()-1;
+}
+
+template<typename Field>
+Int ReductionBatch<Field>::AddSum( const Field& localValue )
+{ return Queue( SUM_REDUCTION, localValue ); }
+
+template<typename Field>
+Int ReductionBatch<Field>::AddMax( const Real& localValue )
+{ return Queue( MAX_REDUCTION, Field(localValue) ); }
+
+template<typename Field>
+Int ReductionBatch<Field>::AddMin( const Real& localValue )
+{ return Queue( MIN_REDUCTION, Field(localValue) ); }
+
+template<typename Field>
+Int ReductionBatch<Field>::AddTwoNorm
+( const Real& localScale, const Real& localScaledSquare )
+{
+    return Queue
+      ( TWO_NORM_REDUCTION, Field(localScale*Sqrt(localScaledSquare)) );
+}
+
+template<typename Field>
+Int ReductionBatch<Field>::AddDot
+( const Matrix<Field>& A, const Matrix<Field>& B )
+{
+    EL_DEBUG_CSE
+    return AddSum( HilbertSchmidt( A, B ) );
+}
+
+template<typename Field>
+Int ReductionBatch<Field>::AddDot
+( const AbstractDistMatrix<Field>& A, const AbstractDistMatrix<Field>& B )
+{
+    EL_DEBUG_CSE
+    if( A.Height() != B.Height() || A.Width() != B.Width() )
+        LogicError("Matrices must be the same size");
+    AssertSameGrids( A, B );
+    if( A.DistData().colDist != B.DistData().colDist ||
+        A.DistData().rowDist != B.DistData().rowDist )
+        LogicError("A and B must have the same distribution");
+    if( A.ColAlign() != B.ColAlign() || A.RowAlign() != B.RowAlign() )
+        LogicError("Matrices must be aligned");
+    if( A.BlockHeight() != B.BlockHeight() ||
+        A.BlockWidth() != B.BlockWidth() )
+        LogicError("A and B must have the same block size");
+    Field localInnerProd(0);
+    if( reduction_batch::Contributes( A ) )
+        localInnerProd = HilbertSchmidt( A.LockedMatrix(), B.LockedMatrix() );
+    return AddSum( localInnerProd );
+}
+
+template<typename Field>
+Int ReductionBatch<Field>::AddDot
+( const DistMultiVec<Field>& A, const DistMultiVec<Field>& B )
+{
+    EL_DEBUG_CSE
+    if( A.Height() != B.Height() || A.Width() != B.Width() )
+        LogicError("A and B must have the same dimensions");
+    if( A.LocalHeight() != B.LocalHeight() ||
+        A.FirstLocalRow() != B.FirstLocalRow() )
+        LogicError("A and B must own the same rows");
+    return AddSum( HilbertSchmidt( A.LockedMatrix(), B.LockedMatrix() ) );
+}
+
+template<typename Field>
+Int ReductionBatch<Field>::AddFrobeniusNorm( const Matrix<Field>& A )
+{
+    EL_DEBUG_CSE
+    return Queue
+      ( TWO_NORM_REDUCTION, Field(reduction_batch::LocalFrobeniusNorm(A)) );
+}
+
+template<typename Field>
+Int ReductionBatch<Field>::AddFrobeniusNorm
+( const AbstractDistMatrix<Field>& A )
+{
+    EL_DEBUG_CSE
+    Real localNorm = 0;
+    if( reduction_batch::Contributes( A ) )
+        localNorm = reduction_batch::LocalFrobeniusNorm( A.LockedMatrix() );
+    return Queue( TWO_NORM_REDUCTION, Field(localNorm) );
+}
+
+template<typename Field>
+Int ReductionBatch<Field>::AddFrobeniusNorm( const DistMultiVec<Field>& A )
+{
+    EL_DEBUG_CSE
+    return AddFrobeniusNorm( A.LockedMatrix() );
+}
+
+template<typename Field>
+Int ReductionBatch<Field>::AddMaxAbs( const Matrix<Field>& A )
+{
+    EL_DEBUG_CSE
+    return AddMax( MaxAbs(A) );
+}
+
+template<typename Field>
+Int ReductionBatch<Field>::AddMaxAbs( const AbstractDistMatrix<Field>& A )
+{
+    EL_DEBUG_CSE
+    Real localMaxAbs = 0;
+    if( A.Participating() )
+        localMaxAbs = MaxAbs( A.LockedMatrix() );
+    return AddMax( localMaxAbs );
+}
+
+template<typename Field>
+Int ReductionBatch<Field>::AddMaxAbs( const DistMultiVec<Field>& A )
+{
+    EL_DEBUG_CSE
+    return AddMax( MaxAbs(A.LockedMatrix()) );
+}
+
+template<typename Field>
+void ReductionBatch<Field>::Reduce()
+{
+    EL_DEBUG_CSE
+    Start();
+    Finish();
+}
+
+template<typename Field>
+void ReductionBatch<Field>::Start()
+{
+    EL_DEBUG_CSE
+    if( started_ )
+        LogicError("The batch of reductions was already started");
+    started_ = true;
+    if( mpi::Size(comm_) == 1 )
+    {
+        sumResults_ = sums_;
+        maxResults_ = maxes_;
+        normResults_ = norms_;
+        return;
+    }
+    sumResults_.resize( sums_.size() );
+    maxResults_.resize( maxes_.size() );
+    normResults_.resize( norms_.size() );
+    if( !sums_.empty() )
+        mpi::IAllReduce
+        ( sums_.data(), sumResults_.data(), sums_.size(), mpi::SUM, comm_,
+          sumRequest_ );
+    if( !maxes_.empty() )
+        mpi::IAllReduce
+        ( maxes_.data(), maxResults_.data(), maxes_.size(), mpi::MAX, comm_,
+          maxRequest_ );
+    if( !norms_.empty() )
+    {
+        mpi::SetUserReduceFunc
+        ( function<Real(const Real&,const Real&)>
+          (reduction_batch::CombineNorms<Real>), true );
+        mpi::IAllReduce
+        ( norms_.data(), normResults_.data(), norms_.size(),
+          mpi::UserCommOp<Real>(), comm_, normRequest_ );
+    }
+}
+
+template<typename Field>
+void ReductionBatch<Field>::Finish()
+{
+    EL_DEBUG_CSE
+    if( !started_ )
+        LogicError("The batch of reductions was not started");
+    if( mpi::Size(comm_) > 1 )
+    {
+        if( !sums_.empty() )
+            mpi::Wait( sumRequest_ );
+        if( !maxes_.empty() )
+            mpi::Wait( maxRequest_ );
+        if( !norms_.empty() )
+            mpi::Wait( normRequest_ );
+    }
+    started_ = false;
+    finished_ = true;
+}
+
+template<typename Field>
+Field ReductionBatch<Field>::Get( Int index ) const
+{
+    EL_DEBUG_CSE
+    if( !finished_ )
+        LogicError("The batch of reductions has not been completed");
+    if( index < 0 || index >= Int(kinds_.size()) )
+        LogicError("Invalid reduction index ",index);
+    const Int offset = offsets_[index];
+    Field value;
+    switch( kinds_[index] )
+    {
+    case SUM_REDUCTION:
+        value = sumResults_[offset];
+        if( IsComplex<Field>::value )
+            SetImagPart( value, sumResults_[offset+1] );
+        break;
+    case MAX_REDUCTION: value = maxResults_[offset]; break;
+    case MIN_REDUCTION: value = -maxResults_[offset]; break;
+    default: value = normResults_[offset]; break;
+    }
+    return value;
+}
+
+template<typename Field>
+Int ReductionBatch<Field>::NumReductions() const EL_NO_EXCEPT
+{ return kinds_.size(); }
+
+template<typename Field>
+void ReductionBatch<Field>::Clear()
+{
+    EL_DEBUG_CSE
+    if( started_ )
+        LogicError("Cannot clear a batch of reductions in progress");
+    kinds_.clear();
+    offsets_.clear();
+    sums_.clear();
+    maxes_.clear();
+    norms_.clear();
+    sumResults_.clear();
+    maxResults_.clear();
+    normResults_.clear();
+    finished_ = false;
+}
+
+#define PROTO(Field) \
+  template class ReductionBatch<Field>;
+
+#define EL_NO_INT_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
@@ -0,0 +1,315 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El-lite.hpp>
+#include <El/blas_like/level1.hpp>
+
+// The Reverse Cuthill-McKee ordering [1] of the (symmetrized) sparsity
+// pattern numbers the vertices of each connected component in the reverse
+// of a breadth-first search from a pseudo-peripheral vertex, with the
+// neighbors of each vertex visited in order of increasing degree. The
+// resulting small bandwidth keeps the entries of x touched by consecutive
+// rows of a sparse matrix-vector product close to each other.
+//
+// The pseudo-peripheral vertices are found with the heuristic of George and
+// Liu [2], which repeatedly restarts the search from a vertex of minimum
+// degree in the last level of the previous one until the number of levels
+// stops increasing.
+//
+// [1] Alan George, "Computer implementation of the finite element method",
+//     Ph.D. thesis, Stanford University, 1971.
+//
+// [2] Alan George and Joseph W.H. Liu, "An implementation of a
+//     pseudoperipheral node finder", ACM Transactions on Mathematical
+//     Software, Vol. 5, No. 3, 1979.
+//
+
+namespace El {
+
+namespace {
+
+// Return the ordering (i.e., order[k] is the original index of the k'th
+// vertex) given the symmetric adjacency structure of the vertices
+vector<Int> RCMOrder
+( const vector<Int>& adjOffsets, const vector<Int>& adjacency )
+{
+    EL_DEBUG_CSE
+    const Int n = adjOffsets.size()-1;
+    auto degree = [&]( Int i ) { return adjOffsets[i+1]-adjOffsets[i]; };
+
+    // Visit the (unvisited) neighbors of each vertex of the queue in order of
+    // increasing degree, returning the beginning of the last level
+    vector<Int> queue;
+    vector<Int> level(n,-1);
+    auto bfs =
+      [&]( Int root, Int& numLevels, bool mark )
+      {
+          const Int queueBeg = queue.size();
+          queue.push_back( root );
+          level[root] = 0;
+          Int lastLevelBeg = queueBeg;
+          for( Int k=queueBeg; k<Int(queue.size()); ++k )
+          {
+              const Int i = queue[k];
+              if( level[i] != level[queue[lastLevelBeg]] )
+                  lastLevelBeg = k;
+              const Int neighborBeg = queue.size();
+              for( Int e=adjOffsets[i]; e<adjOffsets[i+1]; ++e )
+              {
+                  const Int j = adjacency[e];
+                  if( level[j] < 0 )
+                  {
+                      level[j] = level[i] + 1;
+                      queue.push_back( j );
+                  }
+              }
+              std::sort
+              ( queue.begin()+neighborBeg, queue.end(),
+                [&]( Int a, Int b ) { return degree(a) < degree(b); } );
+          }
+          numLevels = level[queue.back()] + 1;
+          if( !mark )
+          {
+              // Reset the search so that it can be restarted
+              for( Int k=queueBeg; k<Int(queue.size()); ++k )
+                  level[queue[k]] = -1;
+          }
+          return lastLevelBeg;
+      };
+
+    // Traverse the vertices in order of increasing degree so that each new
+    // component begins from a low-degree vertex
+    vector<Int> byDegree(n);
+    for( Int i=0; i<n; ++i )
+        byDegree[i] = i;
+    std::stable_sort
+    ( byDegree.begin(), byDegree.end(),
+      [&]( Int a, Int b ) { return degree(a) < degree(b); } );
+
+    for( Int s=0; s<n; ++s )
+    {
+        Int root = byDegree[s];
+        if( level[root] >= 0 )
+            continue;
+
+        // Find a pseudo-peripheral vertex of the component
+        Int numLevels;
+        while( true )
+        {
+            const Int queueBeg = queue.size();
+            const Int lastLevelBeg = bfs( root, numLevels, false );
+            Int candidate = queue[lastLevelBeg];
+            for( Int k=lastLevelBeg; k<Int(queue.size()); ++k )
+                if( degree(queue[k]) < degree(candidate) )
+                    candidate = queue[k];
+            queue.resize( queueBeg );
+            Int candidateLevels;
+            bfs( candidate, candidateLevels, false );
+            queue.resize( queueBeg );
+            if( candidateLevels <= numLevels )
+                break;
+            root = candidate;
+        }
+
+        // Perform the (marking) Cuthill-McKee search from it
+        bfs( root, numLevels, true );
+    }
+    return vector<Int>( queue.rbegin(), queue.rend() );
+}
+
+// Form the (sorted) adjacency structure of the symmetrized graph, without
+// self-loops, from the edges (sources[e],targets[e])
+void SymmetricAdjacency
+( Int n, Int numEdges, const Int* sources, const Int* targets,
+  vector<Int>& adjOffsets, vector<Int>& adjacency )
+{
+    EL_DEBUG_CSE
+    vector<Int> counts(n,0);
+    for( Int e=0; e<numEdges; ++e )
+    {
+        if( sources[e] != targets[e] )
+        {
+            ++counts[sources[e]];
+            ++counts[targets[e]];
+        }
+    }
+    adjOffsets.resize( n+1 );
+    adjOffsets[0] = 0;
+    for( Int i=0; i<n; ++i )
+        adjOffsets[i+1] = adjOffsets[i] + counts[i];
+    adjacency.resize( adjOffsets[n] );
+    auto offs = adjOffsets;
+    for( Int e=0; e<numEdges; ++e )
+    {
+        const Int i = sources[e];
+        const Int j = targets[e];
+        if( i != j )
+        {
+            adjacency[offs[i]++] = j;
+            adjacency[offs[j]++] = i;
+        }
+    }
+
+    // Remove the duplicate edges
+    Int numUnique = 0;
+    for( Int i=0; i<n; ++i )
+    {
+        const auto beg = adjacency.begin()+adjOffsets[i];
+        const auto end = adjacency.begin()+adjOffsets[i+1];
+        std::sort( beg, end );
+        const Int newOffset = numUnique;
+        for( auto it=beg; it!=end; ++it )
+            if( it == beg || *it != *(it-1) )
+                adjacency[numUnique++] = *it;
+        adjOffsets[i] = newOffset;
+    }
+    adjOffsets[n] = numUnique;
+    adjacency.resize( numUnique );
+}
+
+} // anonymous namespace
+
+void ReverseCuthillMcKee( const Graph& graph, Permutation& P )
+{
+    EL_DEBUG_CSE
+    const Int n = graph.NumSources();
+    if( graph.NumTargets() != n )
+        LogicError("Reverse Cuthill-McKee requires a square graph");
+    vector<Int> adjOffsets, adjacency;
+    SymmetricAdjacency
+    ( n, graph.NumEdges(), graph.LockedSourceBuffer(),
+      graph.LockedTargetBuffer(), adjOffsets, adjacency );
+    const vector<Int> order = RCMOrder( adjOffsets, adjacency );
+    P.MakeIdentity( n );
+    for( Int k=0; k<n; ++k )
+        P.SetImage( order[k], k );
+}
+
+void ReverseCuthillMcKee( const DistGraph& graph, DistMap& map )
+{
+    EL_DEBUG_CSE
+    const Grid& grid = graph.Grid();
+    const Int n = graph.NumSources();
+    if( graph.NumTargets() != n )
+        LogicError("Reverse Cuthill-McKee requires a square graph");
+
+    // Order the gathered graph on the root
+    const int root = 0;
+    vector<Int> image(n);
+    if( grid.Rank() == root )
+    {
+        Graph seqGraph;
+        CopyFromRoot( graph, seqGraph );
+        vector<Int> adjOffsets, adjacency;
+        SymmetricAdjacency
+        ( n, seqGraph.NumEdges(), seqGraph.LockedSourceBuffer(),
+          seqGraph.LockedTargetBuffer(), adjOffsets, adjacency );
+        const vector<Int> order = RCMOrder( adjOffsets, adjacency );
+        for( Int k=0; k<n; ++k )
+            image[order[k]] = k;
+    }
+    else
+        CopyFromNonRoot( graph, root );
+    mpi::Broadcast( image.data(), n, root, grid.Comm() );
+
+    map.SetGrid( grid );
+    map.Resize( n );
+    const Int firstLocalSource = map.FirstLocalSource();
+    const Int numLocalSources = map.NumLocalSources();
+    for( Int iLoc=0; iLoc<numLocalSources; ++iLoc )
+        map.SetLocal( iLoc, image[firstLocalSource+iLoc] );
+}
+
+template<typename T>
+void ReverseCuthillMcKee( const SparseMatrix<T>& A, Permutation& P )
+{
+    EL_DEBUG_CSE
+    ReverseCuthillMcKee( A.LockedGraph(), P );
+}
+
+template<typename T>
+void ReverseCuthillMcKee( const DistSparseMatrix<T>& A, DistMap& map )
+{
+    EL_DEBUG_CSE
+    ReverseCuthillMcKee( A.LockedDistGraph(), map );
+}
+
+template<typename T>
+void PermuteSymmetrically( const Permutation& P, SparseMatrix<T>& A )
+{
+    EL_DEBUG_CSE
+    const Int n = A.Height();
+    if( A.Width() != n || P.Height() != n )
+        LogicError
+        ("Cannot symmetrically permute a ",A.Height()," x ",A.Width(),
+         " matrix with a permutation of size ",P.Height());
+    vector<Int> image(n);
+    for( Int i=0; i<n; ++i )
+        image[i] = P.Image( i );
+
+    const Int numEntries = A.NumEntries();
+    const Int* colBuf = A.LockedTargetBuffer();
+    const T* valBuf = A.LockedValueBuffer();
+    SparseMatrix<T> B;
+    B.Resize( n, n );
+    B.Reserve( numEntries );
+    for( Int i=0; i<n; ++i )
+    {
+        const Int offset = A.RowOffset( i );
+        const Int numConn = A.NumConnections( i );
+        for( Int e=offset; e<offset+numConn; ++e )
+            B.QueueUpdate( image[i], image[colBuf[e]], valBuf[e] );
+    }
+    B.ProcessQueues();
+    A = B;
+}
+
+template<typename T>
+void PermuteSymmetrically( const DistMap& map, DistSparseMatrix<T>& A )
+{
+    EL_DEBUG_CSE
+    if( A.Width() != A.Height() || map.NumSources() != A.Height() )
+        LogicError
+        ("Cannot symmetrically permute a ",A.Height()," x ",A.Width(),
+         " matrix with a map of size ",map.NumSources());
+    const Int localHeight = A.LocalHeight();
+    const Int numLocalEntries = A.NumLocalEntries();
+    const Int* colBuf = A.LockedTargetBuffer();
+    const T* valBuf = A.LockedValueBuffer();
+    vector<Int> rows(numLocalEntries), cols(colBuf,colBuf+numLocalEntries);
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+    {
+        const Int offset = A.RowOffset( iLoc );
+        const Int numConn = A.NumConnections( iLoc );
+        const Int i = map.GetLocal( iLoc );
+        for( Int e=offset; e<offset+numConn; ++e )
+            rows[e] = i;
+    }
+    map.Translate( cols );
+    DistSparseMatrix<T> B(A.Grid());
+    B.Resize( A.Height(), A.Width() );
+    B.AssembleCOO( numLocalEntries, rows.data(), cols.data(), valBuf );
+    A = std::move(B);
+}
+
+#define PROTO(T) \
+  template void ReverseCuthillMcKee \
+  ( const SparseMatrix<T>& A, Permutation& P ); \
+  template void ReverseCuthillMcKee \
+  ( const DistSparseMatrix<T>& A, DistMap& map ); \
+  template void PermuteSymmetrically \
+  ( const Permutation& P, SparseMatrix<T>& A ); \
+  template void PermuteSymmetrically \
+  ( const DistMap& map, DistSparseMatrix<T>& A );
+
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#include <El/macros/Instantiate.h>
+
+} // namespace El
@@ -62,12 +62,28 @@ void RowMaxNorms( const Matrix<Field>& A, Matrix<Base<Field>>& norms )
     const Int m = A.Height();
     const Int n = A.Width();
     norms.Resize( m, 1 );
-    for( Int i=0; i<m; ++i )
+    Zero( norms );
+    const Field* ABuf = A.LockedBuffer();
+    const Int ALDim = A.LDim();
+    Real* normBuf = norms.Buffer();
+
+    // Sweep over the columns of contiguous blocks of rows so that the inner
+    // loop has unit stride (and can be vectorized) while each thread owns a
+    // disjoint set of row maxima.
+    const Int blockHeight = 256;
+    const Int numBlocks = (m+blockHeight-1) / blockHeight;
+    EL_PARALLEL_FOR_IF(ParallelizeLoop(m*n))
+    for( Int block=0; block<numBlocks; ++block )
     {
-        Real rowMax = 0;
+        const Int iBeg = block*blockHeight;
+        const Int iEnd = Min(iBeg+blockHeight,m);
         for( Int j=0; j<n; ++j )
-            rowMax = Max(rowMax,Abs(A(i,j)));
-        norms(i) = rowMax;
+        {
+            const Field* colBuf = &ABuf[j*ALDim];
+            EL_SIMD
+            for( Int i=iBeg; i<iEnd; ++i )
+                normBuf[i] = Max(normBuf[i],Abs(colBuf[i]));
+        }
     }
 }
 
@@ -149,6 +165,7 @@ void RowMaxNorms( const SparseMatrix<Field>& A, Matrix<Base<Field>>& norms )
     const Int* offsetBuf = A.LockedOffsetBuffer();
 
     norms.Resize( m, 1 );
+    EL_PARALLEL_FOR_IF(ParallelizeLoop(A.NumEntries()))
     for( Int i=0; i<m; ++i )
     {
         Real rowMax = 0;
@@ -198,6 +215,7 @@ void RowMaxNorms
     norms.SetGrid( A.Grid() );
     norms.Resize( A.Height(), 1 );
     auto& normsLoc = norms.Matrix();
+    EL_PARALLEL_FOR_IF(ParallelizeLoop(A.NumLocalEntries()))
     for( Int iLoc=0; iLoc<localHeight; ++iLoc )
     {
         Real rowMax = 0;
@@ -18,24 +18,28 @@ ElError ElSymvCtrlDefault_s( ElSymvCtrl* ctrl )
 {
     ctrl->bsize = LocalSymvBlocksize<float>();
     ctrl->avoidTrmvBasedLocalSymv = true;
+    ctrl->fusedLocalKernel = false;
     return EL_SUCCESS;
 }
 ElError ElSymvCtrlDefault_d( ElSymvCtrl* ctrl )
 {
     ctrl->bsize = LocalSymvBlocksize<double>();
     ctrl->avoidTrmvBasedLocalSymv = true;
+    ctrl->fusedLocalKernel = false;
     return EL_SUCCESS;
 }
 ElError ElSymvCtrlDefault_c( ElSymvCtrl* ctrl )
 {
     ctrl->bsize = LocalSymvBlocksize<Complex<float>>();
     ctrl->avoidTrmvBasedLocalSymv = true;
+    ctrl->fusedLocalKernel = false;
     return EL_SUCCESS;
 }
 ElError ElSymvCtrlDefault_z( ElSymvCtrl* ctrl )
 {
     ctrl->bsize = LocalSymvBlocksize<Complex<double>>();
     ctrl->avoidTrmvBasedLocalSymv = true;
+    ctrl->fusedLocalKernel = false;
     return EL_SUCCESS;
 }
 
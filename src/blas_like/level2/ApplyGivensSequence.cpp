@@ -557,12 +557,94 @@ void ApplyGivensSequence
     }
 }
 
+namespace givens {
+
+// The number of bytes of each row block of the columns touched by a batch of
+// rotation sequences, chosen so that the block remains in a typical L2 cache
+const Int rowBlockBytes = 256*1024;
+
+template<typename F>
+void ApplySequenceToRows
+( const GivensSequence<Base<F>>& seq, Int iBeg, Int iEnd, F* ABuf, Int ALDim )
+{
+    typedef Base<F> Real;
+    const Real one(1), zero(0);
+    const Int numRot = seq.cList.Height();
+    const Real* cBuf = seq.cList.LockedBuffer();
+    const Real* sBuf = seq.sList.LockedBuffer();
+    const bool forward = ( seq.direction == FORWARD );
+    for( Int step=0; step<numRot; ++step )
+    {
+        const Int k = ( forward ? step : numRot-1-step );
+        const Real c = cBuf[k];
+        const Real s = sBuf[k];
+        if( c == one && s == zero )
+            continue;
+        F* a0 = &ABuf[(seq.offset+k)*ALDim];
+        F* a1 = &a0[ALDim];
+        for( Int i=iBeg; i<iEnd; ++i )
+        {
+            const F tmp = a1[i];
+            a1[i] = c*tmp - s*a0[i];
+            a0[i] = s*tmp + c*a0[i];
+        }
+    }
+}
+
+} // namespace givens
+
+template<typename F>
+void ApplyGivensSequences
+( const vector<GivensSequence<Base<F>>>& sequences, Matrix<F>& A )
+{
+    EL_DEBUG_CSE
+    const Int m = A.Height();
+    const Int n = A.Width();
+    Int colBeg = n, colEnd = 0, numRotations = 0;
+    for( const auto& seq : sequences )
+    {
+        const Int numRot = seq.cList.Height();
+        if( numRot == 0 )
+            continue;
+        EL_DEBUG_ONLY(
+          if( seq.sList.Height() != numRot )
+              LogicError("cList and sList were of different lengths");
+          if( seq.offset < 0 || seq.offset+numRot >= n )
+              LogicError
+              ("Rotations of columns [",seq.offset,",",seq.offset+numRot,
+               "] were out of bounds for a matrix of width ",n);
+        )
+        colBeg = Min( colBeg, seq.offset );
+        colEnd = Max( colEnd, seq.offset+numRot+1 );
+        numRotations += numRot;
+    }
+    if( m == 0 || colEnd <= colBeg )
+        return;
+
+    const Int touchedBytes = Int(sizeof(F))*(colEnd-colBeg);
+    const Int blockHeight =
+      Min( m, Max( Int(8), givens::rowBlockBytes/touchedBytes ) );
+    const Int numBlocks = (m+blockHeight-1) / blockHeight;
+    F* ABuf = A.Buffer();
+    const Int ALDim = A.LDim();
+    EL_PARALLEL_FOR_IF(ParallelizeLoop(m*numRotations))
+    for( Int block=0; block<numBlocks; ++block )
+    {
+        const Int iBeg = block*blockHeight;
+        const Int iEnd = Min( iBeg+blockHeight, m );
+        for( const auto& seq : sequences )
+            givens::ApplySequenceToRows( seq, iBeg, iEnd, ABuf, ALDim );
+    }
+}
+
 #define PROTO_REAL(F) \
   template void ApplyGivensSequence \
   ( LeftOrRight side, GivensSequenceType seqType, ForwardOrBackward direction, \
     const Matrix<Base<F>>& cList, \
     const Matrix<Base<F>>& sList, \
-    Matrix<F>& A );
+    Matrix<F>& A ); \
+  template void ApplyGivensSequences \
+  ( const vector<GivensSequence<Base<F>>>& sequences, Matrix<F>& A );
 
 #define PROTO(F) \
   PROTO_REAL(F) \
@@ -11,6 +11,7 @@
 
 #include "./Gemv/Normal.hpp"
 #include "./Gemv/Transpose.hpp"
+#include "./Gemv/Band.hpp"
 
 namespace El {
 
@@ -267,7 +268,17 @@ void Gemv
   ( Orientation orientation, \
     T alpha, const AbstractDistMatrix<T>& A, \
              const AbstractDistMatrix<T>& x, \
-    T beta,        AbstractDistMatrix<T>& y );
+    T beta,        AbstractDistMatrix<T>& y ); \
+  template void Gemv \
+  ( Orientation orientation, \
+    T alpha, const BandMatrix<T>& A, \
+             const Matrix<T>& X, \
+    T beta,        Matrix<T>& Y ); \
+  template void Gemv \
+  ( Orientation orientation, \
+    T alpha, const DistBandMatrix<T>& A, \
+             const DistMultiVec<T>& X, \
+    T beta,        DistMultiVec<T>& Y );
 
 #define EL_ENABLE_DOUBLEDOUBLE
 #define EL_ENABLE_QUADDOUBLE
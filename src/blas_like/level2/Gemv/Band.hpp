@@ -0,0 +1,320 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+
+namespace El {
+namespace gemv {
+
+// Whether the rows coupled to each process by a band matrix with the given
+// bandwidths are all owned by its immediate neighbors
+inline bool NeighborBand( Int height, Int blocksize, Int lower, Int upper )
+{
+    if( height <= blocksize )
+        return true;
+    const Int numActive = (height+blocksize-1) / blocksize;
+    const Int lastHeight = height - (numActive-1)*blocksize;
+    return Min(blocksize,lastHeight) >= Max(lower,upper);
+}
+
+// Form the rows [beg,end) of the multivector X (with the given blocksize),
+// where beg = Max(firstLocalRow-lower,0) and
+// end = Min(firstLocalRow+localHeight+upper,height)
+template<typename T>
+void BandHalo
+( const Grid& grid, Int height, Int blocksize, Int lower, Int upper,
+  const Matrix<T>& XLoc, Matrix<T>& XExt )
+{
+    EL_DEBUG_CSE
+    mpi::Comm comm = grid.Comm();
+    const int commRank = grid.Rank();
+    const int commSize = grid.Size();
+    const Int width = XLoc.Width();
+    const Int localHeight = XLoc.Height();
+    const Int firstLocalRow = blocksize*commRank;
+    const Int beg = Max(firstLocalRow-lower,Int(0));
+    const Int end = Min(firstLocalRow+localHeight+upper,height);
+    XExt.Resize( Max(end-beg,Int(0)), width );
+    Zero( XExt );
+
+    if( !NeighborBand( height, blocksize, lower, upper ) )
+    {
+        // Every process owns fewer rows than the bandwidth, so X is small
+        vector<T> sendBuf(blocksize*width,T(0)),
+          recvBuf(commSize*blocksize*width);
+        for( Int j=0; j<width; ++j )
+            for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+                sendBuf[iLoc+j*blocksize] = XLoc(iLoc,j);
+        mpi::AllGather
+        ( sendBuf.data(), blocksize*width,
+          recvBuf.data(), blocksize*width, comm );
+        for( Int j=0; j<width; ++j )
+            for( Int i=beg; i<end; ++i )
+            {
+                const Int q = i / blocksize;
+                XExt(i-beg,j) =
+                  recvBuf[(q*width+j)*blocksize+(i%blocksize)];
+            }
+        return;
+    }
+
+    if( localHeight == 0 )
+        return;
+    const Int numActive = (height+blocksize-1) / blocksize;
+    const int prev = ( commRank > 0 ? commRank-1 : mpi::PROC_NULL );
+    const int next = ( commRank+1 < numActive ? commRank+1 : mpi::PROC_NULL );
+    const Int numPrev = firstLocalRow - beg;
+    const Int numNext = end - (firstLocalRow+localHeight);
+    auto XExtLoc = XExt( IR(numPrev,numPrev+localHeight), ALL );
+    XExtLoc = XLoc;
+
+    // Send our first 'upper' rows to the previous process while receiving
+    // the first rows of the next process
+    const Int numUp = ( prev == mpi::PROC_NULL ? 0 : Min(upper,localHeight) );
+    vector<T> sendBuf(numUp*width), recvBuf(numNext*width);
+    for( Int j=0; j<width; ++j )
+        for( Int i=0; i<numUp; ++i )
+            sendBuf[i+j*numUp] = XLoc(i,j);
+    mpi::SendRecv
+    ( sendBuf.data(), numUp*width, prev,
+      recvBuf.data(), numNext*width, next, comm );
+    for( Int j=0; j<width; ++j )
+        for( Int i=0; i<numNext; ++i )
+            XExt(numPrev+localHeight+i,j) = recvBuf[i+j*numNext];
+
+    // Send our last 'lower' rows to the next process while receiving the
+    // last rows of the previous process
+    const Int numDown =
+      ( next == mpi::PROC_NULL ? 0 : Min(lower,localHeight) );
+    sendBuf.resize( numDown*width );
+    recvBuf.resize( numPrev*width );
+    for( Int j=0; j<width; ++j )
+        for( Int i=0; i<numDown; ++i )
+            sendBuf[i+j*numDown] = XLoc(localHeight-numDown+i,j);
+    mpi::SendRecv
+    ( sendBuf.data(), numDown*width, next,
+      recvBuf.data(), numPrev*width, prev, comm );
+    for( Int j=0; j<width; ++j )
+        for( Int i=0; i<numPrev; ++i )
+            XExt(i,j) = recvBuf[i+j*numPrev];
+}
+
+// The adjoint of BandHalo: add the contributions ZExt to the rows [beg,end)
+// into the local rows YLoc of their owners
+template<typename T>
+void BandHaloAdjoint
+( const Grid& grid, Int height, Int blocksize, Int lower, Int upper,
+  const Matrix<T>& ZExt, Matrix<T>& YLoc )
+{
+    EL_DEBUG_CSE
+    mpi::Comm comm = grid.Comm();
+    const int commRank = grid.Rank();
+    const Int width = YLoc.Width();
+    const Int localHeight = YLoc.Height();
+    const Int firstLocalRow = blocksize*commRank;
+    const Int beg = Max(firstLocalRow-lower,Int(0));
+    const Int end = Min(firstLocalRow+localHeight+upper,height);
+
+    if( !NeighborBand( height, blocksize, lower, upper ) )
+    {
+        Matrix<T> Z, ZSum;
+        Z.Resize( height, width );
+        Zero( Z );
+        if( end > beg )
+        {
+            auto ZSub = Z( IR(beg,end), ALL );
+            ZSub = ZExt;
+        }
+        ZSum.Resize( height, width );
+        Zero( ZSum );
+        mpi::AllReduce
+        ( Z.LockedBuffer(), ZSum.Buffer(), height*width, comm );
+        Axpy
+        ( T(1), ZSum(IR(firstLocalRow,firstLocalRow+localHeight),ALL), YLoc );
+        return;
+    }
+
+    if( localHeight == 0 )
+        return;
+    const Int numActive = (height+blocksize-1) / blocksize;
+    const int prev = ( commRank > 0 ? commRank-1 : mpi::PROC_NULL );
+    const int next = ( commRank+1 < numActive ? commRank+1 : mpi::PROC_NULL );
+    const Int numPrev = firstLocalRow - beg;
+    const Int numNext = end - (firstLocalRow+localHeight);
+    Axpy( T(1), ZExt(IR(numPrev,numPrev+localHeight),ALL), YLoc );
+
+    // Return the contributions to the first rows of the next process while
+    // receiving those of the previous process to our first 'upper' rows
+    const Int numUp = ( prev == mpi::PROC_NULL ? 0 : Min(upper,localHeight) );
+    vector<T> sendBuf(numNext*width), recvBuf(numUp*width);
+    for( Int j=0; j<width; ++j )
+        for( Int i=0; i<numNext; ++i )
+            sendBuf[i+j*numNext] = ZExt(numPrev+localHeight+i,j);
+    mpi::SendRecv
+    ( sendBuf.data(), numNext*width, next,
+      recvBuf.data(), numUp*width, prev, comm );
+    for( Int j=0; j<width; ++j )
+        for( Int i=0; i<numUp; ++i )
+            YLoc(i,j) += recvBuf[i+j*numUp];
+
+    // Return the contributions to the last rows of the previous process
+    // while receiving those of the next process to our last 'lower' rows
+    const Int numDown =
+      ( next == mpi::PROC_NULL ? 0 : Min(lower,localHeight) );
+    sendBuf.resize( numPrev*width );
+    recvBuf.resize( numDown*width );
+    for( Int j=0; j<width; ++j )
+        for( Int i=0; i<numPrev; ++i )
+            sendBuf[i+j*numPrev] = ZExt(i,j);
+    mpi::SendRecv
+    ( sendBuf.data(), numPrev*width, prev,
+      recvBuf.data(), numDown*width, next, comm );
+    for( Int j=0; j<width; ++j )
+        for( Int i=0; i<numDown; ++i )
+            YLoc(localHeight-numDown+i,j) += recvBuf[i+j*numDown];
+}
+
+} // namespace gemv
+
+template<typename T>
+void Gemv
+( Orientation orientation,
+  T alpha, const BandMatrix<T>& A,
+           const Matrix<T>& X,
+  T beta,        Matrix<T>& Y )
+{
+    EL_DEBUG_CSE
+    const bool normal = ( orientation == NORMAL );
+    const bool conjugate = ( orientation == ADJOINT );
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int lower = A.LowerBandwidth();
+    const Int upper = A.UpperBandwidth();
+    const Int width = X.Width();
+    if( X.Height() != (normal ? n : m) ||
+        Y.Height() != (normal ? m : n) || Y.Width() != width )
+        LogicError
+        ("Nonconformal band Gemv: A is ",m," x ",n,", X is ",X.Height(),
+         " x ",width,", and Y is ",Y.Height()," x ",Y.Width());
+    if( beta == T(0) )
+        Zero( Y );
+    else
+        Scale( beta, Y );
+
+    const T* ABuf = A.LockedMatrix().LockedBuffer();
+    const Int ALDim = A.LockedMatrix().LDim();
+    for( Int k=0; k<width; ++k )
+    {
+        const T* x = X.LockedBuffer(0,k);
+        T* y = Y.Buffer(0,k);
+        for( Int j=0; j<n; ++j )
+        {
+            const Int iBeg = Max(j-upper,Int(0));
+            const Int iEnd = Min(j+lower+1,m);
+            const T* a = &ABuf[upper-j+j*ALDim];
+            if( normal )
+            {
+                const T tau = alpha*x[j];
+                for( Int i=iBeg; i<iEnd; ++i )
+                    y[i] += a[i]*tau;
+            }
+            else
+            {
+                T tau = 0;
+                if( conjugate )
+                    for( Int i=iBeg; i<iEnd; ++i )
+                        tau += Conj(a[i])*x[i];
+                else
+                    for( Int i=iBeg; i<iEnd; ++i )
+                        tau += a[i]*x[i];
+                y[j] += alpha*tau;
+            }
+        }
+    }
+}
+
+template<typename T>
+void Gemv
+( Orientation orientation,
+  T alpha, const DistBandMatrix<T>& A,
+           const DistMultiVec<T>& X,
+  T beta,        DistMultiVec<T>& Y )
+{
+    EL_DEBUG_CSE
+    const Int n = A.Height();
+    const Int lower = A.LowerBandwidth();
+    const Int upper = A.UpperBandwidth();
+    const Int width = X.Width();
+    if( X.Height() != n || Y.Height() != n || Y.Width() != width )
+        LogicError
+        ("Nonconformal band Gemv: A is ",n," x ",n,", X is ",X.Height(),
+         " x ",width,", and Y is ",Y.Height()," x ",Y.Width());
+    if( A.Grid() != X.Grid() || A.Grid() != Y.Grid() )
+        LogicError("A, X, and Y must share a grid");
+    auto& YLoc = Y.Matrix();
+    if( beta == T(0) )
+        Zero( YLoc );
+    else
+        Scale( beta, YLoc );
+
+    const Grid& grid = A.Grid();
+    const Int blocksize = A.Blocksize();
+    const Int localHeight = A.LocalHeight();
+    const Int firstLocalRow = A.FirstLocalRow();
+    const Int beg = Max(firstLocalRow-lower,Int(0));
+    const auto& ALoc = A.LockedMatrix();
+
+    // The entry A(i,j) of local row iLoc lies in column lower+j-i of ALoc
+    // and couples to row j-beg of the extended multivector
+    if( orientation == NORMAL )
+    {
+        Matrix<T> XExt;
+        gemv::BandHalo
+        ( grid, n, blocksize, lower, upper, X.LockedMatrix(), XExt );
+        for( Int k=0; k<width; ++k )
+        {
+            for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+            {
+                const Int i = firstLocalRow + iLoc;
+                const Int jBeg = Max(i-lower,Int(0));
+                const Int jEnd = Min(i+upper+1,n);
+                T tau = 0;
+                for( Int j=jBeg; j<jEnd; ++j )
+                    tau += ALoc(iLoc,lower+j-i)*XExt(j-beg,k);
+                YLoc(iLoc,k) += alpha*tau;
+            }
+        }
+    }
+    else
+    {
+        const bool conjugate = ( orientation == ADJOINT );
+        // Row i of A contributes to the rows [i-lower,i+upper] of Y
+        const Int end = Min(firstLocalRow+localHeight+upper,n);
+        Matrix<T> ZExt;
+        ZExt.Resize( Max(end-beg,Int(0)), width );
+        Zero( ZExt );
+        const auto& XLoc = X.LockedMatrix();
+        for( Int k=0; k<width; ++k )
+        {
+            for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+            {
+                const Int i = firstLocalRow + iLoc;
+                const Int jBeg = Max(i-lower,Int(0));
+                const Int jEnd = Min(i+upper+1,n);
+                const T tau = alpha*XLoc(iLoc,k);
+                for( Int j=jBeg; j<jEnd; ++j )
+                {
+                    const T value = ALoc(iLoc,lower+j-i);
+                    ZExt(j-beg,k) += (conjugate ? Conj(value) : value)*tau;
+                }
+            }
+        }
+        gemv::BandHaloAdjoint( grid, n, blocksize, lower, upper, ZExt, YLoc );
+    }
+}
+
+} // namespace El
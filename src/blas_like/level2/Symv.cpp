@@ -9,6 +9,7 @@
 #include <El-lite.hpp>
 #include <El/blas_like/level2.hpp>
 
+#include "./Symv/Fused.hpp"
 #include "./Symv/L.hpp"
 #include "./Symv/U.hpp"
 
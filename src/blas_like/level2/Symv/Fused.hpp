@@ -0,0 +1,232 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+
+namespace El {
+namespace symv {
+
+namespace fused {
+
+// The number of columns of the local matrix processed together
+const Int COLUMN_BLOCK = 4;
+
+// The local rows [beg,end) of column j holding stored entries of the
+// triangle, with the diagonal entry excluded if 'strict'
+inline Range<Int> StoredRows
+( UpperOrLower uplo, bool strict, Int j,
+  Int localHeight, Int colShift, Int colStride )
+{
+    if( uplo == LOWER )
+    {
+        const Int first = ( strict ? j+1 : j );
+        return Range<Int>( Length_(first,colShift,colStride), localHeight );
+    }
+    else
+    {
+        const Int last = ( strict ? j : j+1 );
+        return Range<Int>( 0, Length_(last,colShift,colStride) );
+    }
+}
+
+// zC(i) += A(i,j) chi and returns sum_i op(A(i,j)) xC(i) over [beg,end)
+template<typename T>
+T Column
+( bool conjugate, Int beg, Int end, const T* EL_RESTRICT a, T chi,
+  const T* EL_RESTRICT xC, Int xCInc, T* EL_RESTRICT zC, Int zCInc )
+{
+    T tau = 0;
+    for( Int i=beg; i<end; ++i )
+    {
+        const T alpha = a[i];
+        zC[i*zCInc] += alpha*chi;
+        tau += (conjugate ? Conj(alpha) : alpha)*xC[i*xCInc];
+    }
+    return tau;
+}
+
+// Applies the stored entries of the local columns [jBeg,jEnd)
+template<typename T>
+void Columns
+( UpperOrLower uplo, bool conjugate, T alpha, Int jBeg, Int jEnd,
+  Int localHeight, Int colShift, Int colStride, Int rowShift, Int rowStride,
+  const T* EL_RESTRICT A, Int ALDim,
+  const T* EL_RESTRICT xC, Int xCInc,
+  const T* EL_RESTRICT xR, Int xRInc,
+        T* EL_RESTRICT zC, Int zCInc,
+        T* EL_RESTRICT zR, Int zRInc )
+{
+    for( Int jLoc=jBeg; jLoc<jEnd; jLoc+=COLUMN_BLOCK )
+    {
+        const Int nb = Min(COLUMN_BLOCK,jEnd-jLoc);
+        Range<Int> rows[COLUMN_BLOCK];
+        T chi[COLUMN_BLOCK], tau[COLUMN_BLOCK];
+        const T* a[COLUMN_BLOCK];
+        for( Int t=0; t<nb; ++t )
+        {
+            const Int j = rowShift + (jLoc+t)*rowStride;
+            rows[t] =
+              StoredRows( uplo, true, j, localHeight, colShift, colStride );
+            chi[t] = alpha*xR[(jLoc+t)*xRInc];
+            tau[t] = 0;
+            a[t] = &A[(jLoc+t)*ALDim];
+
+            // The diagonal entry only contributes to zC
+            const Range<Int> allRows =
+              StoredRows( uplo, false, j, localHeight, colShift, colStride );
+            const Int iDiag = ( uplo == LOWER ? allRows.beg : rows[t].end );
+            if( allRows.end-allRows.beg != rows[t].end-rows[t].beg )
+                zC[iDiag*zCInc] += a[t][iDiag]*chi[t];
+        }
+
+        // The rows shared by every column of the block
+        Range<Int> common = rows[0];
+        for( Int t=1; t<nb; ++t )
+        {
+            common.beg = Max( common.beg, rows[t].beg );
+            common.end = Min( common.end, rows[t].end );
+        }
+        if( nb != COLUMN_BLOCK || common.beg >= common.end )
+        {
+            for( Int t=0; t<nb; ++t )
+                tau[t] = Column
+                  ( conjugate, rows[t].beg, rows[t].end, a[t], chi[t],
+                    xC, xCInc, zC, zCInc );
+        }
+        else
+        {
+            for( Int t=0; t<nb; ++t )
+                tau[t] =
+                  Column
+                  ( conjugate, rows[t].beg, common.beg, a[t], chi[t],
+                    xC, xCInc, zC, zCInc ) +
+                  Column
+                  ( conjugate, common.end, rows[t].end, a[t], chi[t],
+                    xC, xCInc, zC, zCInc );
+
+            // Each entry of A, xC, and zC is loaded once for all four columns
+            const T* EL_RESTRICT a0 = a[0];
+            const T* EL_RESTRICT a1 = a[1];
+            const T* EL_RESTRICT a2 = a[2];
+            const T* EL_RESTRICT a3 = a[3];
+            T tau0=0, tau1=0, tau2=0, tau3=0;
+            for( Int i=common.beg; i<common.end; ++i )
+            {
+                const T alpha0 = a0[i], alpha1 = a1[i],
+                        alpha2 = a2[i], alpha3 = a3[i];
+                const T xi = xC[i*xCInc];
+                zC[i*zCInc] +=
+                  alpha0*chi[0] + alpha1*chi[1] +
+                  alpha2*chi[2] + alpha3*chi[3];
+                if( conjugate )
+                {
+                    tau0 += Conj(alpha0)*xi;
+                    tau1 += Conj(alpha1)*xi;
+                    tau2 += Conj(alpha2)*xi;
+                    tau3 += Conj(alpha3)*xi;
+                }
+                else
+                {
+                    tau0 += alpha0*xi;
+                    tau1 += alpha1*xi;
+                    tau2 += alpha2*xi;
+                    tau3 += alpha3*xi;
+                }
+            }
+            tau[0] += tau0;
+            tau[1] += tau1;
+            tau[2] += tau2;
+            tau[3] += tau3;
+        }
+        for( Int t=0; t<nb; ++t )
+            zR[(jLoc+t)*zRInc] += alpha*tau[t];
+    }
+}
+
+} // namespace fused
+
+// Two-sided local Symv/Hemv
+//
+// Given the local portion of a triangle of a symmetric/Hermitian matrix A
+// (with the given shifts and strides), updates
+//
+//   zC += alpha tri(A) xR,
+//   zR += alpha op(strict-tri(A)) xC,
+//
+// where op is the (conjugate-)transpose, so that, once combined, z is
+// alpha A x. Each stored entry is read once and used for both updates, the
+// columns are register-blocked, and, with OpenMP, each thread processes a
+// contiguous set of columns with an equal share of the stored entries and
+// accumulates its contributions to zC in a private buffer.
+template<typename T>
+void FusedLocal
+( UpperOrLower uplo, bool conjugate, T alpha,
+  Int localHeight, Int localWidth,
+  Int colShift, Int colStride, Int rowShift, Int rowStride,
+  const T* A, Int ALDim,
+  const T* xC, Int xCInc,
+  const T* xR, Int xRInc,
+        T* zC, Int zCInc,
+        T* zR, Int zRInc )
+{
+    EL_DEBUG_CSE
+#ifdef EL_HYBRID
+    const Int numThreads = NumThreads();
+    if( numThreads > 1 && ParallelizeLoop(localHeight*localWidth/2) )
+    {
+        // Partition the columns so that each thread has (roughly) the same
+        // number of stored entries
+        vector<Int> colOffsets( localWidth+1, 0 );
+        for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+        {
+            const Int j = rowShift + jLoc*rowStride;
+            const Range<Int> rows = fused::StoredRows
+              ( uplo, false, j, localHeight, colShift, colStride );
+            colOffsets[jLoc+1] = colOffsets[jLoc] + (rows.end-rows.beg);
+        }
+        const Int numStored = colOffsets[localWidth];
+        vector<Int> threadCols( numThreads+1, localWidth );
+        threadCols[0] = 0;
+        for( Int thread=1; thread<numThreads; ++thread )
+        {
+            const Int target = (numStored*thread)/numThreads;
+            threadCols[thread] =
+              std::lower_bound
+              ( colOffsets.begin(), colOffsets.end(), target ) -
+              colOffsets.begin();
+        }
+
+        vector<T> zCThreads( numThreads*localHeight, T(0) );
+        EL_PARALLEL_FOR
+        for( Int thread=0; thread<numThreads; ++thread )
+        {
+            fused::Columns
+            ( uplo, conjugate, alpha,
+              threadCols[thread], threadCols[thread+1], localHeight,
+              colShift, colStride, rowShift, rowStride, A, ALDim,
+              xC, xCInc, xR, xRInc,
+              &zCThreads[thread*localHeight], 1, zR, zRInc );
+        }
+        EL_PARALLEL_FOR
+        for( Int i=0; i<localHeight; ++i )
+        {
+            T zeta = 0;
+            for( Int thread=0; thread<numThreads; ++thread )
+                zeta += zCThreads[i+thread*localHeight];
+            zC[i*zCInc] += zeta;
+        }
+        return;
+    }
+#endif
+    fused::Columns
+    ( uplo, conjugate, alpha, 0, localWidth, localHeight,
+      colShift, colStride, rowShift, rowStride, A, ALDim,
+      xC, xCInc, xR, xRInc, zC, zCInc, zR, zRInc );
+}
+
+} // namespace symv
+} // namespace El
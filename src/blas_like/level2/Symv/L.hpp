@@ -252,7 +252,15 @@ void LocalColAccumulateL
   bool conjugate, const SymvCtrl<T>& ctrl )
 {
     EL_DEBUG_CSE
-    if( ctrl.avoidTrmvBasedLocalSymv || A.Grid().Height() != A.Grid().Width() )
+    if( ctrl.fusedLocalKernel )
+        FusedLocal
+        ( LOWER, conjugate, alpha, A.LocalHeight(), A.LocalWidth(),
+          A.ColShift(), A.ColStride(), A.RowShift(), A.RowStride(),
+          A.LockedBuffer(), A.LDim(),
+          x_MC_STAR.LockedBuffer(), 1, x_MR_STAR.LockedBuffer(), 1,
+          z_MC_STAR.Buffer(),       1, z_MR_STAR.Buffer(),       1 );
+    else if( ctrl.avoidTrmvBasedLocalSymv ||
+             A.Grid().Height() != A.Grid().Width() )
         LocalColAccumulateLGeneral
         ( alpha, A, x_MC_STAR, x_MR_STAR, z_MC_STAR, z_MR_STAR, conjugate,
           ctrl );
@@ -295,6 +303,18 @@ void LocalRowAccumulateL
           z_STAR_MR.RowAlign() != A.RowAlign()   )
           LogicError("Partial matrix distributions are misaligned");
     )
+    if( ctrl.fusedLocalKernel )
+    {
+        FusedLocal
+        ( LOWER, conjugate, alpha, A.LocalHeight(), A.LocalWidth(),
+          A.ColShift(), A.ColStride(), A.RowShift(), A.RowStride(),
+          A.LockedBuffer(), A.LDim(),
+          x_STAR_MC.LockedBuffer(), x_STAR_MC.LDim(),
+          x_STAR_MR.LockedBuffer(), x_STAR_MR.LDim(),
+          z_STAR_MC.Buffer(),       z_STAR_MC.LDim(),
+          z_STAR_MR.Buffer(),       z_STAR_MR.LDim() );
+        return;
+    }
     const Grid& g = A.Grid();
     const Orientation orientation = ( conjugate ? ADJOINT : TRANSPOSE );
 
@@ -42,6 +42,18 @@ extern "C" {
       Gemm( CReflect(orientationOfA), CReflect(orientationOfB), \
             CReflect(alpha), *CReflect(A), *CReflect(B), \
             CReflect(beta), *CReflect(C), CReflect(alg) ) ) } \
+  ElError ElGemmBatched_ ## SIG \
+  ( ElOrientation orientationOfA, ElOrientation orientationOfB, \
+    CREFLECT(T) alpha, const ElConstMatrix_ ## SIG* A, \
+                       const ElConstMatrix_ ## SIG* B, \
+    CREFLECT(T) beta, const ElMatrix_ ## SIG* C, ElInt batchSize ) \
+  { EL_TRY( \
+      const Orientation orientA = CReflect(orientationOfA); \
+      const Orientation orientB = CReflect(orientationOfB); \
+      for( Int k=0; k<batchSize; ++k ) \
+        Gemm( orientA, orientB, \
+              CReflect(alpha), *CReflect(A[k]), *CReflect(B[k]), \
+              CReflect(beta), *CReflect(C[k]) ) ) } \
   ElError ElMultiply_ ## SIG \
   ( ElOrientation orientation, \
     CREFLECT(T) alpha, ElConstSparseMatrix_ ## SIG A, \
@@ -302,6 +314,17 @@ extern "C" {
         CReflect(side), CReflect(uplo), \
         CReflect(orientation), CReflect(diag), \
         CReflect(alpha), *CReflect(A), *CReflect(B) ) ) } \
+  ElError ElTrsmBatched_ ## SIG \
+  ( ElLeftOrRight side, ElUpperOrLower uplo, \
+    ElOrientation orientation, ElUnitOrNonUnit diag, \
+    CREFLECT(F) alpha, const ElConstMatrix_ ## SIG* A, \
+    const ElMatrix_ ## SIG* B, ElInt batchSize ) \
+  { EL_TRY( \
+      for( Int k=0; k<batchSize; ++k ) \
+        Trsm( \
+          CReflect(side), CReflect(uplo), \
+          CReflect(orientation), CReflect(diag), \
+          CReflect(alpha), *CReflect(A[k]), *CReflect(B[k]) ) ) } \
   /* Trstrm */ \
   ElError ElTrstrm_ ## SIG \
   ( ElLeftOrRight side, ElUpperOrLower uplo, \
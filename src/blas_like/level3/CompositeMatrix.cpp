@@ -0,0 +1,710 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+namespace El {
+
+namespace {
+
+vector<Int> BlockOffsets( const vector<Int>& sizes )
+{
+    vector<Int> offsets( sizes.size()+1, 0 );
+    for( size_t k=0; k<sizes.size(); ++k )
+    {
+        if( sizes[k] < 0 )
+            LogicError("Block sizes must be non-negative");
+        offsets[k+1] = offsets[k] + sizes[k];
+    }
+    return offsets;
+}
+
+// The orientation with which the matrix stored in a block is applied by
+// op(A), where the block holds op_b of the stored matrix. The conjugate of a
+// complex matrix is not available to the kernels, and so transposes and
+// adjoints cannot be mixed.
+template<typename T>
+Orientation ComposeOrientations
+( Orientation orientation, Orientation blockOrient )
+{
+    if( !IsComplex<T>::value )
+    {
+        if( orientation == ADJOINT )
+            orientation = TRANSPOSE;
+        if( blockOrient == ADJOINT )
+            blockOrient = TRANSPOSE;
+    }
+    if( orientation == NORMAL )
+        return blockOrient;
+    if( blockOrient == NORMAL )
+        return orientation;
+    if( orientation != blockOrient )
+        LogicError
+        ("Cannot apply the transpose of an adjoint block (or vice versa)");
+    return NORMAL;
+}
+
+// The scaling of block (i,j) of op(A)
+template<typename T>
+T BlockScale( Orientation orientation, T alpha, T blockAlpha )
+{ return alpha*( orientation == ADJOINT ? Conj(blockAlpha) : blockAlpha ); }
+
+template<class Matrix>
+void CheckBlockSize
+( const Matrix& A, Orientation orientation, Int height, Int width )
+{
+    const bool normal = ( orientation == NORMAL );
+    const Int opHeight = ( normal ? A.Height() : A.Width() );
+    const Int opWidth = ( normal ? A.Width() : A.Height() );
+    if( opHeight != height || opWidth != width )
+        LogicError
+        ("Block was ",opHeight," x ",opWidth," rather than ",height," x ",
+         width);
+}
+
+// Queues the (possibly transposed or conjugated) entries of a sparse block
+// into a sparse matrix at the given offset
+template<typename T>
+void QueueSparseBlock
+( const SparseMatrix<T>& A, Orientation orientation, T alpha,
+  Int rowOff, Int colOff, SparseMatrix<T>& B )
+{
+    const Int numEntries = A.NumEntries();
+    for( Int e=0; e<numEntries; ++e )
+    {
+        const T value = A.Value(e);
+        if( orientation == NORMAL )
+            B.QueueUpdate( rowOff+A.Row(e), colOff+A.Col(e), alpha*value );
+        else if( orientation == TRANSPOSE )
+            B.QueueUpdate( rowOff+A.Col(e), colOff+A.Row(e), alpha*value );
+        else
+            B.QueueUpdate
+            ( rowOff+A.Col(e), colOff+A.Row(e), alpha*Conj(value) );
+    }
+}
+
+} // anonymous namespace
+
+// CompositeMatrix
+// ===============
+
+template<typename T>
+CompositeMatrix<T>::CompositeMatrix
+( const vector<Int>& blockHeights, const vector<Int>& blockWidths )
+: rowOffs_(BlockOffsets(blockHeights)),
+  colOffs_(BlockOffsets(blockWidths)),
+  blocks_(blockHeights.size()*blockWidths.size())
+{ }
+
+template<typename T>
+typename CompositeMatrix<T>::Block&
+CompositeMatrix<T>::BlockRef( Int i, Int j )
+{
+    EL_DEBUG_CSE
+    if( i < 0 || i >= NumBlockRows() || j < 0 || j >= NumBlockCols() )
+        LogicError
+        ("Block (",i,",",j,") is out of bounds of the ",NumBlockRows()," x ",
+         NumBlockCols()," block grid");
+    return blocks_[i*NumBlockCols()+j];
+}
+
+template<typename T>
+const typename CompositeMatrix<T>::Block&
+CompositeMatrix<T>::GetBlock( Int i, Int j ) const
+{
+    EL_DEBUG_CSE
+    return const_cast<CompositeMatrix<T>*>(this)->BlockRef( i, j );
+}
+
+template<typename T>
+void CompositeMatrix<T>::SetBlock
+( Int i, Int j, const Matrix<T>& A, Orientation orientation, T alpha )
+{
+    EL_DEBUG_CSE
+    Block& block = BlockRef( i, j );
+    CheckBlockSize
+    ( A, orientation, rowOffs_[i+1]-rowOffs_[i], colOffs_[j+1]-colOffs_[j] );
+    block = Block();
+    block.type = COMPOSITE_DENSE;
+    block.dense = &A;
+    block.orientation = orientation;
+    block.alpha = alpha;
+}
+
+template<typename T>
+void CompositeMatrix<T>::SetBlock
+( Int i, Int j, const SparseMatrix<T>& A, Orientation orientation, T alpha )
+{
+    EL_DEBUG_CSE
+    Block& block = BlockRef( i, j );
+    CheckBlockSize
+    ( A, orientation, rowOffs_[i+1]-rowOffs_[i], colOffs_[j+1]-colOffs_[j] );
+    block = Block();
+    block.type = COMPOSITE_SPARSE;
+    block.sparse = &A;
+    block.orientation = orientation;
+    block.alpha = alpha;
+}
+
+template<typename T>
+void CompositeMatrix<T>::SetIdentityBlock( Int i, Int j, T alpha )
+{
+    EL_DEBUG_CSE
+    Block& block = BlockRef( i, j );
+    block = Block();
+    block.type = COMPOSITE_IDENTITY;
+    block.alpha = alpha;
+}
+
+template<typename T>
+void CompositeMatrix<T>::ZeroBlock( Int i, Int j )
+{
+    EL_DEBUG_CSE
+    BlockRef( i, j ) = Block();
+}
+
+// DistCompositeMatrix
+// ===================
+
+template<typename T>
+DistCompositeMatrix<T>::DistCompositeMatrix
+( const El::Grid& grid,
+  const vector<Int>& blockHeights, const vector<Int>& blockWidths )
+: grid_(&grid),
+  rowOffs_(BlockOffsets(blockHeights)),
+  colOffs_(BlockOffsets(blockWidths)),
+  blocks_(blockHeights.size()*blockWidths.size())
+{ }
+
+template<typename T>
+typename DistCompositeMatrix<T>::Block&
+DistCompositeMatrix<T>::BlockRef( Int i, Int j )
+{
+    EL_DEBUG_CSE
+    if( i < 0 || i >= NumBlockRows() || j < 0 || j >= NumBlockCols() )
+        LogicError
+        ("Block (",i,",",j,") is out of bounds of the ",NumBlockRows()," x ",
+         NumBlockCols()," block grid");
+    return blocks_[i*NumBlockCols()+j];
+}
+
+template<typename T>
+const typename DistCompositeMatrix<T>::Block&
+DistCompositeMatrix<T>::GetBlock( Int i, Int j ) const
+{
+    EL_DEBUG_CSE
+    return const_cast<DistCompositeMatrix<T>*>(this)->BlockRef( i, j );
+}
+
+template<typename T>
+void DistCompositeMatrix<T>::SetBlock
+( Int i, Int j, const ElementalMatrix<T>& A,
+  Orientation orientation, T alpha )
+{
+    EL_DEBUG_CSE
+    Block& block = BlockRef( i, j );
+    if( A.Grid() != *grid_ )
+        LogicError("Blocks must be distributed over the composite's grid");
+    CheckBlockSize
+    ( A, orientation, rowOffs_[i+1]-rowOffs_[i], colOffs_[j+1]-colOffs_[j] );
+    block = Block();
+    block.type = COMPOSITE_DENSE;
+    block.dense = &A;
+    block.orientation = orientation;
+    block.alpha = alpha;
+}
+
+template<typename T>
+void DistCompositeMatrix<T>::SetBlock
+( Int i, Int j, const DistSparseMatrix<T>& A,
+  Orientation orientation, T alpha )
+{
+    EL_DEBUG_CSE
+    Block& block = BlockRef( i, j );
+    if( A.Grid() != *grid_ )
+        LogicError("Blocks must be distributed over the composite's grid");
+    CheckBlockSize
+    ( A, orientation, rowOffs_[i+1]-rowOffs_[i], colOffs_[j+1]-colOffs_[j] );
+    block = Block();
+    block.type = COMPOSITE_SPARSE;
+    block.sparse = &A;
+    block.orientation = orientation;
+    block.alpha = alpha;
+}
+
+template<typename T>
+void DistCompositeMatrix<T>::SetIdentityBlock( Int i, Int j, T alpha )
+{
+    EL_DEBUG_CSE
+    Block& block = BlockRef( i, j );
+    block = Block();
+    block.type = COMPOSITE_IDENTITY;
+    block.alpha = alpha;
+}
+
+template<typename T>
+void DistCompositeMatrix<T>::ZeroBlock( Int i, Int j )
+{
+    EL_DEBUG_CSE
+    BlockRef( i, j ) = Block();
+}
+
+// Multiply
+// ========
+
+template<typename T>
+void Multiply
+( Orientation orientation,
+  T alpha, const CompositeMatrix<T>& A, const Matrix<T>& X,
+  T beta,                                     Matrix<T>& Y )
+{
+    EL_DEBUG_CSE
+    const bool normal = ( orientation == NORMAL );
+    if( X.Height() != ( normal ? A.Width() : A.Height() ) ||
+        Y.Height() != ( normal ? A.Height() : A.Width() ) ||
+        X.Width() != Y.Width() )
+        LogicError("Nonconformal composite Multiply");
+    Scale( beta, Y );
+
+    // Block (i,j) of A maps block row j of X into block row i of Y, and
+    // vice versa for its (conjugate-)transpose
+    for( Int i=0; i<A.NumBlockRows(); ++i )
+    {
+        const Range<Int> rowInd( A.RowOffset(i), A.RowOffset(i+1) );
+        for( Int j=0; j<A.NumBlockCols(); ++j )
+        {
+            const auto& block = A.GetBlock( i, j );
+            const Range<Int> colInd( A.ColOffset(j), A.ColOffset(j+1) );
+            const Int blockHeight = rowInd.end - rowInd.beg;
+            const Int blockWidth = colInd.end - colInd.beg;
+            if( block.type == COMPOSITE_ZERO ||
+                blockHeight == 0 || blockWidth == 0 )
+                continue;
+            const T blockAlpha = BlockScale( orientation, alpha, block.alpha );
+            const Range<Int> inInd = ( normal ? colInd : rowInd );
+            const Range<Int> outInd = ( normal ? rowInd : colInd );
+            if( block.type == COMPOSITE_IDENTITY )
+            {
+                const Int diagLength = Min(blockHeight,blockWidth);
+                auto XDiag = X( IR(inInd.beg,inInd.beg+diagLength), ALL );
+                auto YDiag = Y( IR(outInd.beg,outInd.beg+diagLength), ALL );
+                Axpy( blockAlpha, XDiag, YDiag );
+                continue;
+            }
+            const Orientation blockOrient =
+              ComposeOrientations<T>( orientation, block.orientation );
+            auto XBlock = X( inInd, ALL );
+            auto YBlock = Y( outInd, ALL );
+            if( block.type == COMPOSITE_DENSE )
+                Gemm
+                ( blockOrient, NORMAL,
+                  blockAlpha, *block.dense, XBlock, T(1), YBlock );
+            else
+                Multiply
+                ( blockOrient, blockAlpha, *block.sparse, XBlock,
+                  T(1), YBlock );
+        }
+    }
+}
+
+template<typename T>
+void Multiply
+( Orientation orientation,
+  T alpha, const DistCompositeMatrix<T>& A, const DistMatrix<T>& X,
+  T beta,                                         DistMatrix<T>& Y )
+{
+    EL_DEBUG_CSE
+    const bool normal = ( orientation == NORMAL );
+    if( X.Height() != ( normal ? A.Width() : A.Height() ) ||
+        Y.Height() != ( normal ? A.Height() : A.Width() ) ||
+        X.Width() != Y.Width() )
+        LogicError("Nonconformal composite Multiply");
+    if( X.Grid() != A.Grid() || Y.Grid() != A.Grid() )
+        LogicError("X and Y must be distributed over the composite's grid");
+    Scale( beta, Y );
+
+    for( Int i=0; i<A.NumBlockRows(); ++i )
+    {
+        const Range<Int> rowInd( A.RowOffset(i), A.RowOffset(i+1) );
+        for( Int j=0; j<A.NumBlockCols(); ++j )
+        {
+            const auto& block = A.GetBlock( i, j );
+            const Range<Int> colInd( A.ColOffset(j), A.ColOffset(j+1) );
+            const Int blockHeight = rowInd.end - rowInd.beg;
+            const Int blockWidth = colInd.end - colInd.beg;
+            if( block.type == COMPOSITE_ZERO ||
+                blockHeight == 0 || blockWidth == 0 )
+                continue;
+            const T blockAlpha = BlockScale( orientation, alpha, block.alpha );
+            const Range<Int> inInd = ( normal ? colInd : rowInd );
+            const Range<Int> outInd = ( normal ? rowInd : colInd );
+            if( block.type == COMPOSITE_IDENTITY )
+            {
+                const Int diagLength = Min(blockHeight,blockWidth);
+                auto XDiag = X( IR(inInd.beg,inInd.beg+diagLength), ALL );
+                auto YDiag = Y( IR(outInd.beg,outInd.beg+diagLength), ALL );
+                Axpy( blockAlpha, XDiag, YDiag );
+                continue;
+            }
+            const Orientation blockOrient =
+              ComposeOrientations<T>( orientation, block.orientation );
+            // The views are generally misaligned with the blocks, which the
+            // dense and sparse kernels accommodate through proxies
+            auto XBlock = X( inInd, ALL );
+            auto YBlock = Y( outInd, ALL );
+            if( block.type == COMPOSITE_DENSE )
+                Gemm
+                ( blockOrient, NORMAL,
+                  blockAlpha, *block.dense, XBlock, T(1), YBlock );
+            else
+                Multiply
+                ( blockOrient, blockAlpha, *block.sparse, XBlock,
+                  T(1), YBlock );
+        }
+    }
+}
+
+template<typename T>
+void Gemv
+( Orientation orientation,
+  T alpha, const CompositeMatrix<T>& A, const Matrix<T>& x,
+  T beta,                                     Matrix<T>& y )
+{
+    EL_DEBUG_CSE
+    if( x.Width() != 1 || y.Width() != 1 )
+        LogicError("Expected x and y to be column vectors");
+    Multiply( orientation, alpha, A, x, beta, y );
+}
+
+template<typename T>
+void Gemv
+( Orientation orientation,
+  T alpha, const DistCompositeMatrix<T>& A, const DistMatrix<T>& x,
+  T beta,                                         DistMatrix<T>& y )
+{
+    EL_DEBUG_CSE
+    if( x.Width() != 1 || y.Width() != 1 )
+        LogicError("Expected x and y to be column vectors");
+    Multiply( orientation, alpha, A, x, beta, y );
+}
+
+// Copy
+// ====
+
+template<typename T>
+void Copy( const CompositeMatrix<T>& A, Matrix<T>& B )
+{
+    EL_DEBUG_CSE
+    Zeros( B, A.Height(), A.Width() );
+    for( Int i=0; i<A.NumBlockRows(); ++i )
+    {
+        const Range<Int> rowInd( A.RowOffset(i), A.RowOffset(i+1) );
+        for( Int j=0; j<A.NumBlockCols(); ++j )
+        {
+            const auto& block = A.GetBlock( i, j );
+            const Range<Int> colInd( A.ColOffset(j), A.ColOffset(j+1) );
+            auto BBlock = B( rowInd, colInd );
+            if( block.type == COMPOSITE_IDENTITY )
+            {
+                FillDiagonal( BBlock, block.alpha );
+            }
+            else if( block.type == COMPOSITE_DENSE )
+            {
+                if( block.orientation == NORMAL )
+                    Axpy( block.alpha, *block.dense, BBlock );
+                else
+                    TransposeAxpy
+                    ( block.alpha, *block.dense, BBlock,
+                      block.orientation == ADJOINT );
+            }
+            else if( block.type == COMPOSITE_SPARSE )
+            {
+                const SparseMatrix<T>& S = *block.sparse;
+                for( Int e=0; e<S.NumEntries(); ++e )
+                {
+                    const T value = block.alpha*
+                      ( block.orientation == ADJOINT ? Conj(S.Value(e))
+                                                     : S.Value(e) );
+                    if( block.orientation == NORMAL )
+                        BBlock.Update( S.Row(e), S.Col(e), value );
+                    else
+                        BBlock.Update( S.Col(e), S.Row(e), value );
+                }
+            }
+        }
+    }
+}
+
+template<typename T>
+void Copy( const CompositeMatrix<T>& A, SparseMatrix<T>& B )
+{
+    EL_DEBUG_CSE
+    Zeros( B, A.Height(), A.Width() );
+    Int numEntries = 0;
+    for( Int i=0; i<A.NumBlockRows(); ++i )
+    {
+        const Int blockHeight = A.RowOffset(i+1) - A.RowOffset(i);
+        for( Int j=0; j<A.NumBlockCols(); ++j )
+        {
+            const auto& block = A.GetBlock( i, j );
+            const Int blockWidth = A.ColOffset(j+1) - A.ColOffset(j);
+            if( block.type == COMPOSITE_IDENTITY )
+                numEntries += Min(blockHeight,blockWidth);
+            else if( block.type == COMPOSITE_DENSE )
+                numEntries += blockHeight*blockWidth;
+            else if( block.type == COMPOSITE_SPARSE )
+                numEntries += block.sparse->NumEntries();
+        }
+    }
+    B.Reserve( numEntries );
+
+    for( Int i=0; i<A.NumBlockRows(); ++i )
+    {
+        const Int rowOff = A.RowOffset(i);
+        const Int blockHeight = A.RowOffset(i+1) - rowOff;
+        for( Int j=0; j<A.NumBlockCols(); ++j )
+        {
+            const auto& block = A.GetBlock( i, j );
+            const Int colOff = A.ColOffset(j);
+            const Int blockWidth = A.ColOffset(j+1) - colOff;
+            if( block.type == COMPOSITE_IDENTITY )
+            {
+                const Int diagLength = Min(blockHeight,blockWidth);
+                for( Int k=0; k<diagLength; ++k )
+                    B.QueueUpdate( rowOff+k, colOff+k, block.alpha );
+            }
+            else if( block.type == COMPOSITE_DENSE )
+            {
+                const Matrix<T>& D = *block.dense;
+                for( Int jLoc=0; jLoc<D.Width(); ++jLoc )
+                {
+                    for( Int iLoc=0; iLoc<D.Height(); ++iLoc )
+                    {
+                        const T value = D(iLoc,jLoc);
+                        if( value == T(0) )
+                            continue;
+                        if( block.orientation == NORMAL )
+                            B.QueueUpdate
+                            ( rowOff+iLoc, colOff+jLoc, block.alpha*value );
+                        else if( block.orientation == TRANSPOSE )
+                            B.QueueUpdate
+                            ( rowOff+jLoc, colOff+iLoc, block.alpha*value );
+                        else
+                            B.QueueUpdate
+                            ( rowOff+jLoc, colOff+iLoc,
+                              block.alpha*Conj(value) );
+                    }
+                }
+            }
+            else if( block.type == COMPOSITE_SPARSE )
+            {
+                QueueSparseBlock
+                ( *block.sparse, block.orientation, block.alpha,
+                  rowOff, colOff, B );
+            }
+        }
+    }
+    B.ProcessQueues();
+}
+
+template<typename T>
+void Copy( const DistCompositeMatrix<T>& A, DistMatrix<T>& B )
+{
+    EL_DEBUG_CSE
+    B.SetGrid( A.Grid() );
+    Zeros( B, A.Height(), A.Width() );
+
+    Int numSparseEntries = 0;
+    for( Int i=0; i<A.NumBlockRows(); ++i )
+        for( Int j=0; j<A.NumBlockCols(); ++j )
+            if( A.GetBlock(i,j).type == COMPOSITE_SPARSE )
+                numSparseEntries += A.GetBlock(i,j).sparse->NumLocalEntries();
+    B.Reserve( numSparseEntries );
+
+    for( Int i=0; i<A.NumBlockRows(); ++i )
+    {
+        const Range<Int> rowInd( A.RowOffset(i), A.RowOffset(i+1) );
+        for( Int j=0; j<A.NumBlockCols(); ++j )
+        {
+            const auto& block = A.GetBlock( i, j );
+            const Range<Int> colInd( A.ColOffset(j), A.ColOffset(j+1) );
+            auto BBlock = B( rowInd, colInd );
+            if( block.type == COMPOSITE_IDENTITY )
+            {
+                FillDiagonal( BBlock, block.alpha );
+            }
+            else if( block.type == COMPOSITE_DENSE )
+            {
+                if( block.orientation == NORMAL )
+                    Axpy( block.alpha, *block.dense, BBlock );
+                else
+                    TransposeAxpy
+                    ( block.alpha, *block.dense, BBlock,
+                      block.orientation == ADJOINT );
+            }
+            else if( block.type == COMPOSITE_SPARSE )
+            {
+                // Every process queues the (generally remote) updates
+                // corresponding to its local entries of the sparse block
+                const auto& S = *block.sparse;
+                const Int numLocalEntries = S.NumLocalEntries();
+                for( Int e=0; e<numLocalEntries; ++e )
+                {
+                    const T value = block.alpha*
+                      ( block.orientation == ADJOINT ? Conj(S.Value(e))
+                                                     : S.Value(e) );
+                    if( block.orientation == NORMAL )
+                        B.QueueUpdate
+                        ( rowInd.beg+S.Row(e), colInd.beg+S.Col(e), value );
+                    else
+                        B.QueueUpdate
+                        ( rowInd.beg+S.Col(e), colInd.beg+S.Row(e), value );
+                }
+            }
+        }
+    }
+    B.ProcessQueues();
+}
+
+template<typename T>
+void Copy( const DistCompositeMatrix<T>& A, DistSparseMatrix<T>& B )
+{
+    EL_DEBUG_CSE
+    B.SetGrid( A.Grid() );
+    Zeros( B, A.Height(), A.Width() );
+
+    // Only one member of each team of processes which redundantly store a
+    // dense block contributes its entries
+    Int numLocalEntries = 0, numRemoteEntries = 0;
+    for( Int i=0; i<A.NumBlockRows(); ++i )
+    {
+        const Int blockHeight = A.RowOffset(i+1) - A.RowOffset(i);
+        for( Int j=0; j<A.NumBlockCols(); ++j )
+        {
+            const auto& block = A.GetBlock( i, j );
+            const Int blockWidth = A.ColOffset(j+1) - A.ColOffset(j);
+            if( block.type == COMPOSITE_IDENTITY )
+                numLocalEntries += Min(blockHeight,blockWidth);
+            else if( block.type == COMPOSITE_DENSE )
+            {
+                const auto& D = *block.dense;
+                if( D.RedundantRank() == 0 )
+                    numRemoteEntries += D.LocalHeight()*D.LocalWidth();
+            }
+            else if( block.type == COMPOSITE_SPARSE )
+                numRemoteEntries += block.sparse->NumLocalEntries();
+        }
+    }
+    B.Reserve( numLocalEntries+numRemoteEntries, numRemoteEntries );
+
+    for( Int i=0; i<A.NumBlockRows(); ++i )
+    {
+        const Int rowOff = A.RowOffset(i);
+        const Int blockHeight = A.RowOffset(i+1) - rowOff;
+        for( Int j=0; j<A.NumBlockCols(); ++j )
+        {
+            const auto& block = A.GetBlock( i, j );
+            const Int colOff = A.ColOffset(j);
+            const Int blockWidth = A.ColOffset(j+1) - colOff;
+            if( block.type == COMPOSITE_IDENTITY )
+            {
+                // Each process contributes the diagonal entries of its rows
+                const Int diagLength = Min(blockHeight,blockWidth);
+                const Int firstLocalRow = B.FirstLocalRow();
+                const Int kBeg = Max( firstLocalRow-rowOff, Int(0) );
+                const Int kEnd =
+                  Min( firstLocalRow+B.LocalHeight()-rowOff, diagLength );
+                for( Int k=kBeg; k<kEnd; ++k )
+                    B.QueueLocalUpdate
+                    ( rowOff+k-firstLocalRow, colOff+k, block.alpha );
+            }
+            else if( block.type == COMPOSITE_DENSE )
+            {
+                const auto& D = *block.dense;
+                if( D.RedundantRank() != 0 )
+                    continue;
+                const Matrix<T>& DLoc = D.LockedMatrix();
+                for( Int jLoc=0; jLoc<D.LocalWidth(); ++jLoc )
+                {
+                    const Int jBlock = D.GlobalCol(jLoc);
+                    for( Int iLoc=0; iLoc<D.LocalHeight(); ++iLoc )
+                    {
+                        const Int iBlock = D.GlobalRow(iLoc);
+                        const T value = DLoc(iLoc,jLoc);
+                        if( value == T(0) )
+                            continue;
+                        if( block.orientation == NORMAL )
+                            B.QueueUpdate
+                            ( rowOff+iBlock, colOff+jBlock,
+                              block.alpha*value );
+                        else if( block.orientation == TRANSPOSE )
+                            B.QueueUpdate
+                            ( rowOff+jBlock, colOff+iBlock,
+                              block.alpha*value );
+                        else
+                            B.QueueUpdate
+                            ( rowOff+jBlock, colOff+iBlock,
+                              block.alpha*Conj(value) );
+                    }
+                }
+            }
+            else if( block.type == COMPOSITE_SPARSE )
+            {
+                const auto& S = *block.sparse;
+                const Int numBlockEntries = S.NumLocalEntries();
+                for( Int e=0; e<numBlockEntries; ++e )
+                {
+                    const T value = block.alpha*
+                      ( block.orientation == ADJOINT ? Conj(S.Value(e))
+                                                     : S.Value(e) );
+                    if( block.orientation == NORMAL )
+                        B.QueueUpdate
+                        ( rowOff+S.Row(e), colOff+S.Col(e), value );
+                    else
+                        B.QueueUpdate
+                        ( rowOff+S.Col(e), colOff+S.Row(e), value );
+                }
+            }
+        }
+    }
+    B.ProcessQueues();
+}
+
+#define PROTO(T) \
+  template class CompositeMatrix<T>; \
+  template class DistCompositeMatrix<T>; \
+  template void Multiply \
+  ( Orientation orientation, \
+    T alpha, const CompositeMatrix<T>& A, const Matrix<T>& X, \
+    T beta,                                     Matrix<T>& Y ); \
+  template void Multiply \
+  ( Orientation orientation, \
+    T alpha, const DistCompositeMatrix<T>& A, const DistMatrix<T>& X, \
+    T beta,                                         DistMatrix<T>& Y ); \
+  template void Gemv \
+  ( Orientation orientation, \
+    T alpha, const CompositeMatrix<T>& A, const Matrix<T>& x, \
+    T beta,                                     Matrix<T>& y ); \
+  template void Gemv \
+  ( Orientation orientation, \
+    T alpha, const DistCompositeMatrix<T>& A, const DistMatrix<T>& x, \
+    T beta,                                         DistMatrix<T>& y ); \
+  template void Copy( const CompositeMatrix<T>& A, Matrix<T>& B ); \
+  template void Copy( const CompositeMatrix<T>& A, SparseMatrix<T>& B ); \
+  template void Copy( const DistCompositeMatrix<T>& A, DistMatrix<T>& B ); \
+  template void Copy \
+  ( const DistCompositeMatrix<T>& A, DistSparseMatrix<T>& B );
+
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGINT
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
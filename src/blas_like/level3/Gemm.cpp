@@ -13,9 +13,370 @@
 #include "./Gemm/NT.hpp"
 #include "./Gemm/TN.hpp"
 #include "./Gemm/TT.hpp"
+#include "./Gemm/25D.hpp"
+
+#include <map>
+
+namespace {
+
+El::Int gemm25DNumLayers = 0;
+double gemm25DMemoryBudget = 1024.*1024.*1024.;
+
+// Map from the (process-local) identifier of a grid and a number of layers
+// to the corresponding 3D grid
+std::map<std::pair<El::size_t,El::Int>,El::unique_ptr<El::Grid3D>> layerGrids;
+
+El::GemmCostModel gemmCostModel;
+
+} // anonymous namespace
 
 namespace El {
 
+void SetGemmCostModel( const GemmCostModel& model )
+{
+    EL_DEBUG_CSE
+    if( model.latency < 0 || model.inverseBandwidth < 0 ||
+        model.flopTime < 0 || model.halfRateBlocksize < 0 )
+        LogicError("Gemm cost model parameters must be non-negative");
+    ::gemmCostModel = model;
+}
+
+GemmCostModel GetGemmCostModel() { return ::gemmCostModel; }
+
+void CalibrateGemmCostModel( const Grid& g )
+{
+    EL_DEBUG_CSE
+    GemmCostModel model = ::gemmCostModel;
+    if( !g.InGrid() )
+        LogicError("Only members of the grid may calibrate the cost model");
+    mpi::Comm comm = g.VCComm();
+    const int commRank = mpi::Rank( comm );
+    const int commSize = mpi::Size( comm );
+    Timer timer;
+
+    // Time a local Gemm which is large enough to run near peak
+    const Int nLocal = 256;
+    Matrix<double> A(nLocal,nLocal), B(nLocal,nLocal), C(nLocal,nLocal);
+    Fill( A, 1. );
+    Fill( B, 1. );
+    Gemm( NORMAL, NORMAL, 1., A, B, 0., C );
+    timer.Start();
+    Gemm( NORMAL, NORMAL, 1., A, B, 0., C );
+    const double flopTime = timer.Stop() / (2.*nLocal*nLocal*nLocal);
+
+    // Time small and large ping-pongs between the first two processes
+    double params[3] = { flopTime, 0, 0 };
+    if( commSize > 1 )
+    {
+        const int numReps = 10;
+        const int largeCount = 1<<20;
+        vector<byte> buffer( largeCount );
+        auto pingPong = [&]( int count )
+        {
+            mpi::Barrier( comm );
+            timer.Start();
+            for( int rep=0; rep<numReps; ++rep )
+            {
+                if( commRank == 0 )
+                {
+                    mpi::Send( buffer.data(), count, 1, comm );
+                    mpi::Recv( buffer.data(), count, 1, comm );
+                }
+                else if( commRank == 1 )
+                {
+                    mpi::Recv( buffer.data(), count, 0, comm );
+                    mpi::Send( buffer.data(), count, 0, comm );
+                }
+            }
+            return timer.Stop() / (2*numReps);
+        };
+        const double smallTime = pingPong( 1 );
+        const double largeTime = pingPong( largeCount );
+        if( commRank <= 1 )
+        {
+            params[1] = smallTime;
+            params[2] = Max(largeTime-smallTime,0.) / largeCount;
+        }
+    }
+    mpi::AllReduce( params, 3, mpi::MAX, comm );
+
+    model.flopTime = params[0];
+    if( commSize > 1 )
+    {
+        model.latency = params[1];
+        model.inverseBandwidth = params[2];
+    }
+    ::gemmCostModel = model;
+}
+
+namespace gemm {
+
+// The alpha-beta cost of a collective over 'numProcs' processes in which
+// each process ends with (or begins with) 'numBytes' bytes, of which a
+// fraction of 1/numProcs are already local
+inline double CollectiveCost
+( const GemmCostModel& model, double numProcs, double numBytes )
+{
+    if( numProcs <= 1 )
+        return 0;
+    return model.latency*std::ceil(std::log2(numProcs)) +
+           model.inverseBandwidth*numBytes*(numProcs-1)/numProcs;
+}
+
+// PredictGemmCost for an r x c grid
+template<typename T>
+double PredictCost
+( Int m, Int n, Int k, double r, double c, GemmAlgorithm alg, Int blocksize )
+{
+    EL_DEBUG_CSE
+    const GemmCostModel& model = ::gemmCostModel;
+    const double nb = ( blocksize > 0 ? blocksize : Blocksize() );
+    const double p = r*c;
+    const double w = sizeof(T);
+    const double flops = ( IsComplex<T>::value ? 8. : 2. )*m*n*k / p;
+    const double localTime = flops*model.flopTime;
+    // The local updates are rank-nb for SUMMA_C and of width nb otherwise
+    const double panelTime =
+      localTime*(1 + model.halfRateBlocksize/Max(nb,1.));
+    const double mD=m, nD=n, kD=k;
+
+    switch( alg )
+    {
+    case GEMM_SUMMA_A:
+    {
+        // Each panel of B is redistributed to [VR,*], gathered within
+        // process columns, and the panel of C is reduce-scattered within
+        // process rows
+        const double numPanels = std::ceil( nD/nb );
+        const double panelWidth = Min(nb,nD);
+        return panelTime + numPanels*
+          ( CollectiveCost( model, p, w*kD*panelWidth/p ) +
+            CollectiveCost( model, r, w*kD*panelWidth/c ) +
+            CollectiveCost( model, c, w*mD*panelWidth/r ) );
+    }
+    case GEMM_SUMMA_B:
+    {
+        const double numPanels = std::ceil( mD/nb );
+        const double panelHeight = Min(nb,mD);
+        return panelTime + numPanels*
+          ( CollectiveCost( model, p, w*kD*panelHeight/p ) +
+            CollectiveCost( model, c, w*kD*panelHeight/r ) +
+            CollectiveCost( model, r, w*nD*panelHeight/c ) );
+    }
+    case GEMM_SUMMA_C:
+    {
+        // Each panel of A is gathered within process rows and each panel of
+        // B within process columns
+        const double numPanels = std::ceil( kD/nb );
+        const double panelWidth = Min(nb,kD);
+        return panelTime + numPanels*
+          ( CollectiveCost( model, c, w*mD*panelWidth/r ) +
+            CollectiveCost( model, r, w*nD*panelWidth/c ) );
+    }
+    case GEMM_SUMMA_DOT:
+    {
+        // A and B are redistributed into 1D distributions before each
+        // (at most) 2000 x 2000 block of C is summed over the entire grid.
+        // The local products are charged the same efficiency penalty as
+        // the other variants so that the comparison is not biased towards
+        // this variant.
+        const double blockSizeDot = 2000;
+        const double numBlocks =
+          std::ceil( mD/blockSizeDot )*std::ceil( nD/blockSizeDot );
+        const double blockHeight = Min(blockSizeDot,mD);
+        const double blockWidth = Min(blockSizeDot,nD);
+        return panelTime +
+          CollectiveCost( model, p, w*mD*kD/p ) +
+          CollectiveCost( model, p, w*kD*nD/p ) +
+          numBlocks*CollectiveCost( model, p, w*blockHeight*blockWidth );
+    }
+    default:
+        LogicError("Cost model only supports the SUMMA variants");
+        return 0;
+    }
+}
+
+// SelectGemmAlgorithm for an r x c grid
+template<typename T>
+GemmChoice SelectAlgorithm( Int m, Int n, Int k, double r, double c )
+{
+    EL_DEBUG_CSE
+    const GemmAlgorithm algs[] =
+      { GEMM_SUMMA_C, GEMM_SUMMA_A, GEMM_SUMMA_B, GEMM_SUMMA_DOT };
+    vector<Int> blocksizes;
+    if( ::gemmCostModel.selectBlocksize )
+        blocksizes = { 32, 64, 96, 128, 192, 256, 384, 512 };
+    else
+        blocksizes = { Blocksize() };
+
+    GemmChoice best;
+    best.alg = GEMM_SUMMA_C;
+    best.blocksize = Blocksize();
+    best.cost = std::numeric_limits<double>::max();
+    for( const GemmAlgorithm alg : algs )
+    {
+        // The dot-product variant does not use the algorithmic blocksize,
+        // so it is only charged for the default one
+        const vector<Int> algBlocksizes =
+          ( alg == GEMM_SUMMA_DOT ? vector<Int>(1,Blocksize()) : blocksizes );
+        for( const Int blocksize : algBlocksizes )
+        {
+            const double cost =
+              PredictCost<T>( m, n, k, r, c, alg, blocksize );
+            if( cost < best.cost )
+            {
+                best.alg = alg;
+                best.blocksize = blocksize;
+                best.cost = cost;
+            }
+        }
+    }
+    return best;
+}
+
+// The predicted cost of a left, lower (or upper), non-transposed Trsm
+// against an m x n right-hand side on an r x c grid: each diagonal block is
+// broadcast to the entire grid, each row panel of B is redistributed to
+// [STAR,VR] for the solve and then gathered within process columns, and the
+// update of the remaining rows is a rank-nb SUMMA_C step (of average height
+// m/2)
+template<typename T>
+double PredictTrsmCost( Int m, Int n, double r, double c )
+{
+    EL_DEBUG_CSE
+    const GemmCostModel& model = ::gemmCostModel;
+    const double nb = Blocksize();
+    const double p = r*c;
+    const double w = sizeof(T);
+    const double mD=m, nD=n;
+    const double flops = ( IsComplex<T>::value ? 4. : 1. )*mD*mD*nD / p;
+    const double numPanels = std::ceil( mD/nb );
+    const double panelHeight = Min(nb,mD);
+    return flops*model.flopTime*(1 + model.halfRateBlocksize/Max(nb,1.)) +
+      numPanels*
+      ( CollectiveCost( model, p, w*panelHeight*panelHeight ) +
+        CollectiveCost( model, r, w*panelHeight*nD/p ) +
+        CollectiveCost( model, r, w*panelHeight*nD/c ) +
+        CollectiveCost( model, c, w*(mD/2)*panelHeight/r ) );
+}
+
+// The predicted cost of a Householder QR factorization of an m x n matrix
+// on an r x c grid: each of the min(m,n) reflectors requires a norm and a
+// panel inner product to be summed within a process column, and each panel
+// of nb reflectors is spread within process rows before its application to
+// the trailing matrix sums an nb x n/2 (on average) product within process
+// columns
+template<typename T>
+double PredictQRCost( Int m, Int n, double r, double c )
+{
+    EL_DEBUG_CSE
+    const GemmCostModel& model = ::gemmCostModel;
+    const double nb = Blocksize();
+    const double p = r*c;
+    const double w = sizeof(T);
+    const double mD=m, nD=n;
+    const double minDim = Min(mD,nD);
+    const double realFlops =
+      2*mD*nD*minDim - (mD+nD)*minDim*minDim + 2*minDim*minDim*minDim/3;
+    const double flops = ( IsComplex<T>::value ? 4. : 1. )*realFlops / p;
+    const double numPanels = std::ceil( minDim/nb );
+    const double panelWidth = Min(nb,minDim);
+    return flops*model.flopTime*(1 + model.halfRateBlocksize/Max(nb,1.)) +
+      minDim*2*CollectiveCost( model, r, w*panelWidth ) +
+      numPanels*
+      ( CollectiveCost( model, c, w*mD*panelWidth/r ) +
+        CollectiveCost( model, r, w*panelWidth*(nD/2)/c ) );
+}
+
+} // namespace gemm
+
+template<typename T>
+double PredictGemmCost
+( Int m, Int n, Int k, const Grid& g, GemmAlgorithm alg, Int blocksize )
+{
+    EL_DEBUG_CSE
+    return gemm::PredictCost<T>
+      ( m, n, k, g.Height(), g.Width(), alg, blocksize );
+}
+
+template<typename T>
+GemmChoice SelectGemmAlgorithm( Int m, Int n, Int k, const Grid& g )
+{
+    EL_DEBUG_CSE
+    return gemm::SelectAlgorithm<T>( m, n, k, g.Height(), g.Width() );
+}
+
+template<typename T>
+int RecommendGridHeight
+( GridShapeOperation op, Int m, Int n, Int k, int numProcs )
+{
+    EL_DEBUG_CSE
+    if( numProcs < 1 )
+        LogicError("The number of processes must be positive");
+    auto cost = [&]( double r )
+      {
+        const double c = numProcs / r;
+        switch( op )
+        {
+        case GRID_SHAPE_GEMM: return gemm::SelectAlgorithm<T>(m,n,k,r,c).cost;
+        case GRID_SHAPE_TRSM: return gemm::PredictTrsmCost<T>(m,n,r,c);
+        case GRID_SHAPE_QR:   return gemm::PredictQRCost<T>(m,n,r,c);
+        default: LogicError("Invalid grid shape operation"); return 0.;
+        }
+      };
+    // Ties are broken in favor of the default (most square) shape
+    int bestHeight = Grid::DefaultHeight( numProcs );
+    double bestCost = cost( bestHeight );
+    for( int height=1; height<=numProcs; ++height )
+    {
+        if( numProcs % height != 0 )
+            continue;
+        const double heightCost = cost( height );
+        if( heightCost < bestCost )
+        {
+            bestHeight = height;
+            bestCost = heightCost;
+        }
+    }
+    return bestHeight;
+}
+
+void SetGemm25DNumLayers( Int numLayers )
+{
+    EL_DEBUG_CSE
+    if( numLayers < 0 )
+        LogicError("The number of layers must be non-negative");
+    ::gemm25DNumLayers = numLayers;
+}
+
+Int Gemm25DNumLayers() { return ::gemm25DNumLayers; }
+
+void SetGemm25DMemoryBudget( double numBytes )
+{
+    EL_DEBUG_CSE
+    if( numBytes < 0 )
+        LogicError("The memory budget must be non-negative");
+    ::gemm25DMemoryBudget = numBytes;
+}
+
+double Gemm25DMemoryBudget() { return ::gemm25DMemoryBudget; }
+
+void ClearGemm25DGrids() { ::layerGrids.clear(); }
+
+namespace gemm {
+
+const Grid3D& LayerGrids( const Grid& g, Int numLayers )
+{
+    EL_DEBUG_CSE
+    auto key = std::make_pair( g.Id(), numLayers );
+    auto& grid3D = ::layerGrids[key];
+    if( !grid3D )
+        grid3D.reset( new Grid3D( g, int(numLayers) ) );
+    return *grid3D;
+}
+
+} // namespace gemm
+
 template<typename T>
 void Gemm
 ( Orientation orientA, Orientation orientB,
@@ -95,8 +456,37 @@ void Gemm
   GemmAlgorithm alg )
 {
     EL_DEBUG_CSE
+    EL_PROFILE_REGION("Gemm");
     C *= beta;
-    if( orientA == NORMAL && orientB == NORMAL )
+    if( alg == GEMM_25D )
+    {
+        // Explicitly (conjugate-)transpose the operands, as the quadratic
+        // cost is dominated by the cubic cost of the product
+        if( orientA == NORMAL && orientB == NORMAL )
+        {
+            gemm::SUMMA25D_NN( alpha, A, B, C );
+        }
+        else if( orientA == NORMAL )
+        {
+            DistMatrix<T> BTrans(B.Grid());
+            Transpose( B, BTrans, orientB==ADJOINT );
+            gemm::SUMMA25D_NN( alpha, A, BTrans, C );
+        }
+        else if( orientB == NORMAL )
+        {
+            DistMatrix<T> ATrans(A.Grid());
+            Transpose( A, ATrans, orientA==ADJOINT );
+            gemm::SUMMA25D_NN( alpha, ATrans, B, C );
+        }
+        else
+        {
+            DistMatrix<T> ATrans(A.Grid()), BTrans(B.Grid());
+            Transpose( A, ATrans, orientA==ADJOINT );
+            Transpose( B, BTrans, orientB==ADJOINT );
+            gemm::SUMMA25D_NN( alpha, ATrans, BTrans, C );
+        }
+    }
+    else if( orientA == NORMAL && orientB == NORMAL )
     {
         if( alg == GEMM_CANNON )
             gemm::Cannon_NN( alpha, A, B, C );
@@ -132,6 +522,138 @@ void Gemm
     Gemm( orientA, orientB, alpha, A, B, T(0), C, alg );
 }
 
+namespace gemm {
+
+template<typename T,typename=EnableIf<IsBlasScalar<T>>>
+void ScaLAPACKHelper
+( Orientation orientA, Orientation orientB,
+  T alpha, const DistMatrix<T,MC,MR,BLOCK>& A,
+           const DistMatrix<T,MC,MR,BLOCK>& B,
+  T beta,        DistMatrix<T,MC,MR,BLOCK>& C )
+{
+    AssertScaLAPACKSupport();
+#ifdef EL_HAVE_SCALAPACK
+    const Int m = C.Height();
+    const Int n = C.Width();
+    const Int k = ( orientA==NORMAL ? A.Width() : A.Height() );
+    const char transA = OrientationToChar( orientA );
+    const char transB = OrientationToChar( orientB );
+
+    auto descA = FillDesc( A );
+    auto descB = FillDesc( B );
+    auto descC = FillDesc( C );
+    pblas::Gemm
+    ( transA, transB, m, n, k,
+      alpha, A.LockedBuffer(), descA.data(),
+             B.LockedBuffer(), descB.data(),
+      beta,  C.Buffer(),       descC.data() );
+#endif
+}
+
+template<typename T,typename=DisableIf<IsBlasScalar<T>>,typename=void>
+void ScaLAPACKHelper
+( Orientation orientA, Orientation orientB,
+  T alpha, const DistMatrix<T,MC,MR,BLOCK>& A,
+           const DistMatrix<T,MC,MR,BLOCK>& B,
+  T beta,        DistMatrix<T,MC,MR,BLOCK>& C )
+{
+    LogicError("ScaLAPACK does not support this datatype");
+}
+
+} // namespace gemm
+
+// Block-cyclic matrices are multiplied in place by PBLAS when possible and
+// otherwise redistributed to and from the elemental algorithms
+template<typename T>
+void Gemm
+( Orientation orientA, Orientation orientB,
+  T alpha, const DistMatrix<T,MC,MR,BLOCK>& A,
+           const DistMatrix<T,MC,MR,BLOCK>& B,
+  T beta,        DistMatrix<T,MC,MR,BLOCK>& C )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(AssertSameGrids( A, B, C ))
+#ifdef EL_HAVE_SCALAPACK
+    const bool uncut =
+      A.ColCut() == 0 && A.RowCut() == 0 &&
+      B.ColCut() == 0 && B.RowCut() == 0 &&
+      C.ColCut() == 0 && C.RowCut() == 0;
+    if( IsBlasScalar<T>::value && uncut )
+    {
+        gemm::ScaLAPACKHelper( orientA, orientB, alpha, A, B, beta, C );
+        return;
+    }
+#endif
+    const AbstractDistMatrix<T>& AAbs = A;
+    const AbstractDistMatrix<T>& BAbs = B;
+    AbstractDistMatrix<T>& CAbs = C;
+    Gemm( orientA, orientB, alpha, AAbs, BAbs, beta, CAbs );
+}
+
+template<typename T>
+void Gemm
+( Orientation orientA, Orientation orientB,
+  T alpha, const DistMatrix<T,MC,MR,BLOCK>& A,
+           const DistMatrix<T,MC,MR,BLOCK>& B,
+                 DistMatrix<T,MC,MR,BLOCK>& C )
+{
+    EL_DEBUG_CSE
+    const Int m = ( orientA==NORMAL ? A.Height() : A.Width() );
+    const Int n = ( orientB==NORMAL ? B.Width() : B.Height() );
+    C.Resize( m, n );
+    Zero( C );
+    Gemm( orientA, orientB, alpha, A, B, T(0), C );
+}
+
+template<typename T>
+void Gemm
+( Orientation orientA, Orientation orientB,
+  T alpha, const DistMultiVec<T>& A, const DistMultiVec<T>& B,
+  T beta,        Matrix<T>& C )
+{
+    EL_DEBUG_CSE
+    if( orientA == NORMAL || orientB != NORMAL )
+        LogicError("Only C := alpha A^{T/H} B + beta C is supported");
+    if( A.Grid() != B.Grid() )
+        LogicError("A and B must be distributed over the same grid");
+    EL_DEBUG_ONLY(
+      if( A.Height() != B.Height() ||
+          A.Width() != C.Height() || B.Width() != C.Width() )
+          LogicError
+          ("Nonconformal Gemm:\n",
+           DimsString(A,"A"),"\n",DimsString(B,"B"),"\n",DimsString(C,"C"));
+    )
+    Matrix<T> CLoc;
+    Gemm
+    ( orientA, NORMAL, alpha, A.LockedMatrix(), B.LockedMatrix(), CLoc );
+    AllReduce( CLoc, A.Grid().Comm() );
+    Scale( beta, C );
+    C += CLoc;
+}
+
+template<typename T>
+void Gemm
+( Orientation orientA, Orientation orientB,
+  T alpha, const DistMultiVec<T>& A, const Matrix<T>& B,
+  T beta,        DistMultiVec<T>& C )
+{
+    EL_DEBUG_CSE
+    if( orientA != NORMAL )
+        LogicError("Only C := alpha A op(B) + beta C is supported");
+    if( A.Grid() != C.Grid() )
+        LogicError("A and C must be distributed over the same grid");
+    EL_DEBUG_ONLY(
+      const Int k = ( orientB==NORMAL ? B.Height() : B.Width() );
+      const Int n = ( orientB==NORMAL ? B.Width() : B.Height() );
+      if( A.Height() != C.Height() || A.Width() != k || C.Width() != n )
+          LogicError
+          ("Nonconformal Gemm:\n",
+           DimsString(A,"A"),"\n",DimsString(B,"B"),"\n",DimsString(C,"C"));
+    )
+    Gemm
+    ( NORMAL, orientB, alpha, A.LockedMatrix(), B, beta, C.Matrix() );
+}
+
 template<typename T>
 void LocalGemm
 ( Orientation orientA, Orientation orientB,
@@ -279,6 +801,24 @@ void LocalGemm
     T alpha, const AbstractDistMatrix<T>& A, \
              const AbstractDistMatrix<T>& B, \
                    AbstractDistMatrix<T>& C, GemmAlgorithm alg ); \
+  template void Gemm \
+  ( Orientation orientA, Orientation orientB, \
+    T alpha, const DistMatrix<T,MC,MR,BLOCK>& A, \
+             const DistMatrix<T,MC,MR,BLOCK>& B, \
+    T beta,        DistMatrix<T,MC,MR,BLOCK>& C ); \
+  template void Gemm \
+  ( Orientation orientA, Orientation orientB, \
+    T alpha, const DistMatrix<T,MC,MR,BLOCK>& A, \
+             const DistMatrix<T,MC,MR,BLOCK>& B, \
+                   DistMatrix<T,MC,MR,BLOCK>& C ); \
+  template void Gemm \
+  ( Orientation orientA, Orientation orientB, \
+    T alpha, const DistMultiVec<T>& A, const DistMultiVec<T>& B, \
+    T beta,        Matrix<T>& C ); \
+  template void Gemm \
+  ( Orientation orientA, Orientation orientB, \
+    T alpha, const DistMultiVec<T>& A, const Matrix<T>& B, \
+    T beta,        DistMultiVec<T>& C ); \
   template void LocalGemm \
   ( Orientation orientA, Orientation orientB, \
     T alpha, const AbstractDistMatrix<T>& A, \
@@ -288,7 +828,13 @@ void LocalGemm
   ( Orientation orientA, Orientation orientB, \
     T alpha, const AbstractDistMatrix<T>& A, \
              const AbstractDistMatrix<T>& B, \
-                   AbstractDistMatrix<T>& C );
+                   AbstractDistMatrix<T>& C ); \
+  template double PredictGemmCost<T> \
+  ( Int m, Int n, Int k, const Grid& g, GemmAlgorithm alg, Int blocksize ); \
+  template GemmChoice SelectGemmAlgorithm<T> \
+  ( Int m, Int n, Int k, const Grid& g ); \
+  template int RecommendGridHeight<T> \
+  ( GridShapeOperation op, Int m, Int n, Int k, int numProcs );
 
 #define EL_ENABLE_DOUBLEDOUBLE
 #define EL_ENABLE_QUADDOUBLE
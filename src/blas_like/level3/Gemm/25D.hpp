@@ -0,0 +1,115 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+
+#include "./Layers.hpp"
+
+namespace El {
+namespace gemm {
+
+// 2.5D (replicated-depth) Gemm
+//
+// The process grid is split into c layers, each of which receives a
+// contiguous 1/c portion of the summation dimension of A and B and forms its
+// contribution to C using SUMMA on a grid of p/c processes. The c partial
+// products are then summed over the depth communicator of the 3D grid and
+// added into C. Relative to SUMMA on the full grid, the
+// panel broadcasts involve sqrt(c) times fewer processes at the expense of
+// c copies of C. If the workspace would exceed the memory budget, SUMMA on
+// the original grid is used instead.
+template<typename T>
+void SUMMA25D_NN
+( T alpha,
+  const AbstractDistMatrix<T>& APre,
+  const AbstractDistMatrix<T>& BPre,
+        AbstractDistMatrix<T>& CPre )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      AssertSameGrids( APre, BPre, CPre );
+      if( APre.Height() != CPre.Height() ||
+          BPre.Width() != CPre.Width() ||
+          APre.Width() != BPre.Height() )
+          LogicError
+          ("Nonconformal matrices:\n",
+           DimsString(APre,"A"),"\n",
+           DimsString(BPre,"B"),"\n",
+           DimsString(CPre,"C"));
+    )
+    const Grid& g = CPre.Grid();
+    const Int m = CPre.Height();
+    const Int n = CPre.Width();
+    const Int sumDim = APre.Width();
+    const Int numLayers =
+      ( g.HaveViewers() ? 1 : NumLayers25D<T>( g, m, n, sumDim ) );
+    if( numLayers == 1 )
+    {
+        SUMMA_NN( alpha, APre, BPre, CPre );
+        return;
+    }
+    const Grid3D& grid3D = LayerGrids( g, numLayers );
+    const Int myLayer = grid3D.Layer();
+
+    DistMatrixReadProxy<T,T,MC,MR> AProx( APre );
+    DistMatrixReadProxy<T,T,MC,MR> BProx( BPre );
+    DistMatrixReadWriteProxy<T,T,MC,MR> CProx( CPre );
+    auto& A = AProx.GetLocked();
+    auto& B = BProx.GetLocked();
+    auto& C = CProx.Get();
+
+    // Replicate each portion of the summation dimension onto its layer
+    // (every process takes part in each redistribution, but only the owners
+    // of the layer store any data)
+    const Grid& myGrid = grid3D.MyLayerGrid();
+    DistMatrix<T> ALayer(myGrid), BLayer(myGrid);
+    for( Int layer=0; layer<numLayers; ++layer )
+    {
+        const Range<Int> ind1
+        ( (layer*sumDim)/numLayers, ((layer+1)*sumDim)/numLayers );
+        auto A1 = A( ALL, ind1 );
+        auto B1 = B( ind1, ALL );
+        if( layer == myLayer )
+        {
+            Copy( A1, ALayer );
+            Copy( B1, BLayer );
+        }
+        else
+        {
+            const Grid& otherGrid = grid3D.LayerGrid( layer );
+            DistMatrix<T> AOther(otherGrid), BOther(otherGrid);
+            Copy( A1, AOther );
+            Copy( B1, BOther );
+        }
+    }
+
+    // Form the contribution from our layer
+    DistMatrix<T> CLayer(myGrid);
+    Gemm( NORMAL, NORMAL, alpha, ALayer, BLayer, CLayer );
+    ALayer.Empty();
+    BLayer.Empty();
+
+    // Sum the layer contributions onto the first layer over the depth
+    // communicator and then add the result into C
+    SumOverDepth( grid3D, CLayer );
+    DistMatrix<T> CSummand(g);
+    CSummand.AlignWith( C );
+    if( myLayer == 0 )
+    {
+        Copy( CLayer, CSummand );
+    }
+    else
+    {
+        DistMatrix<T> CFirst(grid3D.LayerGrid(0));
+        CFirst.Resize( m, n );
+        Copy( CFirst, CSummand );
+    }
+    Axpy( T(1), CSummand, C );
+}
+
+} // namespace gemm
+} // namespace El
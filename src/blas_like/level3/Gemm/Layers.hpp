@@ -0,0 +1,86 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_GEMM_LAYERS_HPP
+#define EL_GEMM_LAYERS_HPP
+
+namespace El {
+namespace gemm {
+
+// Returns (and caches) the 3D grid splitting g into 'numLayers' layers
+const Grid3D& LayerGrids( const Grid& g, Int numLayers );
+
+// Sums the layer contributions, which share their distribution across all of
+// the layers, over the depth communicator so that the copy on the first layer
+// holds the total
+template<typename T>
+void SumOverDepth( const Grid3D& grid3D, DistMatrix<T>& CLayer )
+{
+    EL_DEBUG_CSE
+    Matrix<T>& CLoc = CLayer.Matrix();
+    const Int localSize = CLoc.Height()*CLoc.Width();
+    if( CLoc.LDim() == CLoc.Height() )
+    {
+        mpi::Reduce
+        ( CLoc.Buffer(), localSize, mpi::SUM, 0, grid3D.DepthComm() );
+    }
+    else
+    {
+        Matrix<T> CContig( CLoc );
+        mpi::Reduce
+        ( CContig.Buffer(), localSize, mpi::SUM, 0, grid3D.DepthComm() );
+        CLoc = CContig;
+    }
+}
+
+// The number of bytes per process required by SUMMA25D_NN with 'numLayers'
+// layers: each layer holds 1/numLayers of A and B (so that the storage per
+// process is unchanged) but a full copy of C, and one more copy of C is
+// needed for accumulating the layer contributions on the original grid
+template<typename T>
+double Workspace25D( Int numProcs, Int m, Int n, Int sumDim, Int numLayers )
+{
+    const double entries =
+      double(m)*sumDim + double(sumDim)*n + (numLayers+1)*double(m)*n;
+    return sizeof(T)*entries/numProcs;
+}
+
+template<typename T>
+Int NumLayers25D( const Grid& g, Int m, Int n, Int sumDim )
+{
+    EL_DEBUG_CSE
+    const Int p = g.Size();
+    // The process-wide budget (see SetMemoryBudget) may further restrict the
+    // workspace to what the other live buffers leave available
+    const double budget = Min( Gemm25DMemoryBudget(), AvailableMemory() );
+    const Int requested = Gemm25DNumLayers();
+    if( requested > 0 )
+    {
+        if( p % requested != 0 )
+            LogicError
+            ("The number of Gemm layers, ",requested,
+             ", does not divide the grid size, ",p);
+        if( requested > 1 &&
+            Workspace25D<T>( p, m, n, sumDim, requested ) > budget )
+            return 1;
+        return requested;
+    }
+
+    // Since the workspace increases with the number of layers, choose the
+    // largest divisor c of p with c^3 <= p which fits within the budget
+    Int numLayers = 1;
+    for( Int c=2; c*c*c<=p; ++c )
+        if( p % c == 0 && Workspace25D<T>( p, m, n, sumDim, c ) <= budget )
+            numLayers = c;
+    return numLayers;
+}
+
+} // namespace gemm
+} // namespace El
+
+#endif // ifndef EL_GEMM_LAYERS_HPP
@@ -98,8 +98,8 @@ void SUMMA_NNA
 {
     EL_DEBUG_CSE
     const Int n = CPre.Width();
-    const Int bsize = Blocksize();
     const Grid& g = APre.Grid();
+    const Int bsize = Blocksize<T>( BLOCKSIZE_GEMM, g );
 
     DistMatrixReadProxy<T,T,MC,MR> AProx( APre );
     DistMatrixReadProxy<T,T,MC,MR> BProx( BPre );
@@ -143,8 +143,8 @@ void SUMMA_NNB
 {
     EL_DEBUG_CSE
     const Int m = CPre.Height();
-    const Int bsize = Blocksize();
     const Grid& g = APre.Grid();
+    const Int bsize = Blocksize<T>( BLOCKSIZE_GEMM, g );
 
     DistMatrixReadProxy<T,T,MC,MR> AProx( APre );
     DistMatrixReadProxy<T,T,MC,MR> BProx( BPre );
@@ -185,8 +185,8 @@ void SUMMA_NNC
 {
     EL_DEBUG_CSE
     const Int sumDim = APre.Width();
-    const Int bsize = Blocksize();
     const Grid& g = APre.Grid();
+    const Int bsize = Blocksize<T>( BLOCKSIZE_GEMM, g );
 
     DistMatrixReadProxy<T,T,MC,MR> AProx( APre );
     DistMatrixReadProxy<T,T,MC,MR> BProx( BPre );
@@ -195,25 +195,50 @@ void SUMMA_NNC
     auto& B = BProx.GetLocked();
     auto& C = CProx.Get();
 
-    // Temporary distributions
-    DistMatrix<T,MC,STAR> A1_MC_STAR(g);
-    DistMatrix<T,MR,STAR> B1Trans_MR_STAR(g); 
-
-    A1_MC_STAR.AlignWith( C );
-    B1Trans_MR_STAR.AlignWith( C );
+    // Temporary distributions (double-buffered so that the redistribution
+    // of the next pair of panels overlaps with the current local update)
+    DistMatrix<T,MC,STAR> A1_MC_STAR0(g), A1_MC_STAR1(g);
+    DistMatrix<T,MR,STAR> B1Trans_MR_STAR0(g), B1Trans_MR_STAR1(g);
+    DistMatrix<T,MC,STAR>* A1_MC_STAR[2] = { &A1_MC_STAR0, &A1_MC_STAR1 };
+    DistMatrix<T,MR,STAR>* B1Trans_MR_STAR[2] =
+      { &B1Trans_MR_STAR0, &B1Trans_MR_STAR1 };
+    CopyRequest<T> requestA[2], requestB[2];
+    for( Int slot=0; slot<2; ++slot )
+    {
+        A1_MC_STAR[slot]->AlignWith( C );
+        B1Trans_MR_STAR[slot]->AlignWith( C );
+    }
 
-    for( Int k=0; k<sumDim; k+=bsize )
+    auto startPanels = [&]( Int k, Int slot )
     {
         const Int nb = Min(bsize,sumDim-k);
         auto A1 = A( ALL,        IR(k,k+nb) );
         auto B1 = B( IR(k,k+nb), ALL        );
 
+        CopyAsync( A1, *A1_MC_STAR[slot], requestA[slot] );
+
+        // B1[MC,MR] -> B1^T[MR,MC] is purely local
+        DistMatrix<T,MR,MC> B1Trans(g);
+        B1Trans.AlignWith( B1 );
+        B1Trans.Resize( B1.Width(), B1.Height() );
+        Transpose( B1.LockedMatrix(), B1Trans.Matrix() );
+        CopyAsync( B1Trans, *B1Trans_MR_STAR[slot], requestB[slot] );
+    };
+
+    if( sumDim > 0 )
+        startPanels( 0, 0 );
+    for( Int k=0, slot=0; k<sumDim; k+=bsize, slot=1-slot )
+    {
+        if( k+bsize < sumDim )
+            startPanels( k+bsize, 1-slot );
+        requestA[slot].Wait();
+        requestB[slot].Wait();
+
         // C[MC,MR] += alpha A1[MC,*] (B1^T[MR,*])^T
         //           = alpha A1[MC,*] B1[*,MR]
-        A1_MC_STAR = A1; 
-        Transpose( B1, B1Trans_MR_STAR );
         LocalGemm
-        ( NORMAL, TRANSPOSE, alpha, A1_MC_STAR, B1Trans_MR_STAR, T(1), C );
+        ( NORMAL, TRANSPOSE, alpha,
+          *A1_MC_STAR[slot], *B1Trans_MR_STAR[slot], T(1), C );
     }
 }
 
@@ -293,8 +318,6 @@ void SUMMA_NN
     const Int m = C.Height();
     const Int n = C.Width();
     const Int sumDim = A.Width();
-    const double weightTowardsC = 2.;
-    const double weightAwayFromDot = 10.;
 
     // TODO(poulson): Make this tunable
     const Int blockSizeDot = 2000;
@@ -302,15 +325,13 @@ void SUMMA_NN
     switch( alg )
     {
     case GEMM_DEFAULT:
-        if( weightAwayFromDot*m <= sumDim && weightAwayFromDot*n <= sumDim )
-            SUMMA_NNDot( alpha, A, B, C, blockSizeDot );
-        else if( m <= n && weightTowardsC*m <= sumDim )
-            SUMMA_NNB( alpha, A, B, C );    
-        else if( n <= m && weightTowardsC*n <= sumDim )
-            SUMMA_NNA( alpha, A, B, C );
-        else
-            SUMMA_NNC( alpha, A, B, C );
+    {
+        const GemmChoice choice =
+          SelectGemmAlgorithm<T>( m, n, sumDim, C.Grid() );
+        ScopedBlocksize blocksizeScope( choice.blocksize );
+        SUMMA_NN( alpha, A, B, C, choice.alg );
         break;
+    }
     case GEMM_SUMMA_A:   SUMMA_NNA( alpha, A, B, C ); break;
     case GEMM_SUMMA_B:   SUMMA_NNB( alpha, A, B, C ); break;
     case GEMM_SUMMA_C:   SUMMA_NNC( alpha, A, B, C ); break;
@@ -21,8 +21,8 @@ void SUMMA_NTA
 {
     EL_DEBUG_CSE
     const Int n = CPre.Width();
-    const Int bsize = Blocksize();
     const Grid& g = APre.Grid();
+    const Int bsize = Blocksize<T>( BLOCKSIZE_GEMM, g );
     const bool conjugate = ( orientB == ADJOINT );
 
     DistMatrixReadProxy<T,T,MC,MR> AProx( APre );
@@ -65,8 +65,8 @@ void SUMMA_NTB
 {
     EL_DEBUG_CSE
     const Int m = CPre.Height();
-    const Int bsize = Blocksize();
     const Grid& g = APre.Grid();
+    const Int bsize = Blocksize<T>( BLOCKSIZE_GEMM, g );
 
     DistMatrixReadProxy<T,T,MC,MR> AProx( APre );
     DistMatrixReadProxy<T,T,MC,MR> BProx( BPre );
@@ -111,8 +111,8 @@ void SUMMA_NTC
 {
     EL_DEBUG_CSE
     const Int sumDim = APre.Width();
-    const Int bsize = Blocksize();
     const Grid& g = APre.Grid();
+    const Int bsize = Blocksize<T>( BLOCKSIZE_GEMM, g );
     const bool conjugate = ( orientB == ADJOINT );
 
     DistMatrixReadProxy<T,T,MC,MR> AProx( APre );
@@ -227,24 +227,17 @@ void SUMMA_NT
     const Int m = C.Height();
     const Int n = C.Width();
     const Int sumDim = A.Width();
-    const double weightTowardsC = 2.;
-    const double weightAwayFromDot = 10.;
-
-    // TODO(poulson): Make this tunable
-    const Int blockSizeDot = 2000;
 
     switch( alg )
     {
     case GEMM_DEFAULT:
-        if( weightAwayFromDot*m <= sumDim && weightAwayFromDot*n <= sumDim )
-            SUMMA_NTDot( orientB, alpha, A, B, C, blockSizeDot );
-        else if( m <= n && weightTowardsC*m <= sumDim )
-            SUMMA_NTB( orientB, alpha, A, B, C );
-        else if( n <= m && weightTowardsC*n <= sumDim )
-            SUMMA_NTA( orientB, alpha, A, B, C );
-        else
-            SUMMA_NTC( orientB, alpha, A, B, C );
+    {
+        const GemmChoice choice =
+          SelectGemmAlgorithm<T>( m, n, sumDim, C.Grid() );
+        ScopedBlocksize blocksizeScope( choice.blocksize );
+        SUMMA_NT( orientB, alpha, A, B, C, choice.alg );
         break;
+    }
     case GEMM_SUMMA_A: SUMMA_NTA( orientB, alpha, A, B, C ); break;
     case GEMM_SUMMA_B: SUMMA_NTB( orientB, alpha, A, B, C ); break;
     case GEMM_SUMMA_C: SUMMA_NTC( orientB, alpha, A, B, C ); break;
@@ -21,8 +21,8 @@ void SUMMA_TNA
 {
     EL_DEBUG_CSE
     const Int n = CPre.Width();
-    const Int bsize = Blocksize();
     const Grid& g = APre.Grid();
+    const Int bsize = Blocksize<T>( BLOCKSIZE_GEMM, g );
 
     DistMatrixReadProxy<T,T,MC,MR> AProx( APre );
     DistMatrixReadProxy<T,T,MC,MR> BProx( BPre );
@@ -67,8 +67,8 @@ void SUMMA_TNB
 {
     EL_DEBUG_CSE
     const Int m = CPre.Height();
-    const Int bsize = Blocksize();
     const Grid& g = APre.Grid();
+    const Int bsize = Blocksize<T>( BLOCKSIZE_GEMM, g );
     const bool conjugate = ( orientA == ADJOINT );
 
     DistMatrixReadProxy<T,T,MC,MR> AProx( APre );
@@ -110,8 +110,8 @@ void SUMMA_TNC
 {
     EL_DEBUG_CSE
     const Int sumDim = BPre.Height();
-    const Int bsize = Blocksize();
     const Grid& g = APre.Grid();
+    const Int bsize = Blocksize<T>( BLOCKSIZE_GEMM, g );
 
     DistMatrixReadProxy<T,T,MC,MR> AProx( APre );
     DistMatrixReadProxy<T,T,MC,MR> BProx( BPre );
@@ -222,24 +222,17 @@ void SUMMA_TN
     const Int m = C.Height();
     const Int n = C.Width();
     const Int sumDim = A.Height();
-    const double weightTowardsC = 2.;
-    const double weightAwayFromDot = 10.;
-
-    // TODO(poulson): Make this tunable
-    const Int blockSizeDot = 2000;
 
     switch( alg )
     {
     case GEMM_DEFAULT:
-        if( weightAwayFromDot*m <= sumDim && weightAwayFromDot*n <= sumDim )
-            SUMMA_TNDot( orientA, alpha, A, B, C, blockSizeDot );
-        else if( m <= n && weightTowardsC*m <= sumDim )
-            SUMMA_TNB( orientA, alpha, A, B, C );
-        else if( n <= m && weightTowardsC*n <= sumDim )
-            SUMMA_TNA( orientA, alpha, A, B, C );
-        else
-            SUMMA_TNC( orientA, alpha, A, B, C );
+    {
+        const GemmChoice choice =
+          SelectGemmAlgorithm<T>( m, n, sumDim, C.Grid() );
+        ScopedBlocksize blocksizeScope( choice.blocksize );
+        SUMMA_TN( orientA, alpha, A, B, C, choice.alg );
         break;
+    }
     case GEMM_SUMMA_A: SUMMA_TNA( orientA, alpha, A, B, C ); break;
     case GEMM_SUMMA_B: SUMMA_TNB( orientA, alpha, A, B, C ); break;
     case GEMM_SUMMA_C: SUMMA_TNC( orientA, alpha, A, B, C ); break;
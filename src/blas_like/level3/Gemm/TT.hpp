@@ -22,8 +22,8 @@ void SUMMA_TTA
 {
     EL_DEBUG_CSE
     const Int n = CPre.Width();
-    const Int bsize = Blocksize();
     const Grid& g = APre.Grid();
+    const Int bsize = Blocksize<T>( BLOCKSIZE_GEMM, g );
 
     DistMatrixReadProxy<T,T,MC,MR> AProx( APre );
     DistMatrixReadProxy<T,T,MC,MR> BProx( BPre );
@@ -70,8 +70,8 @@ void SUMMA_TTB
 {
     EL_DEBUG_CSE
     const Int m = CPre.Height();
-    const Int bsize = Blocksize();
     const Grid& g = APre.Grid();
+    const Int bsize = Blocksize<T>( BLOCKSIZE_GEMM, g );
     const bool conjugateA = ( orientA == ADJOINT ); 
 
     DistMatrixReadProxy<T,T,MC,MR> AProx( APre );
@@ -121,8 +121,8 @@ void SUMMA_TTC
 {
     EL_DEBUG_CSE
     const Int sumDim = APre.Height();
-    const Int bsize = Blocksize();
     const Grid& g = APre.Grid();
+    const Int bsize = Blocksize<T>( BLOCKSIZE_GEMM, g );
     const bool conjugateB = ( orientB == ADJOINT );
 
     DistMatrixReadProxy<T,T,MC,MR> AProx( APre );
@@ -239,24 +239,17 @@ void SUMMA_TT
     const Int m = C.Height();
     const Int n = C.Width();
     const Int sumDim = A.Height();
-    const double weightTowardsC = 2.;
-    const double weightAwayFromDot = 10.;
-
-    // TODO(poulson): Make this tunable
-    const Int blockSizeDot = 2000;
 
     switch( alg )
     {
     case GEMM_DEFAULT:
-        if( weightAwayFromDot*m <= sumDim && weightAwayFromDot*n <= sumDim )
-            SUMMA_TTDot( orientA, orientB, alpha, A, B, C, blockSizeDot );
-        else if( m <= n && weightTowardsC*m <= sumDim )
-            SUMMA_TTB( orientA, orientB, alpha, A, B, C );
-        else if( n <= m && weightTowardsC*n <= sumDim )
-            SUMMA_TTA( orientA, orientB, alpha, A, B, C );
-        else
-            SUMMA_TTC( orientA, orientB, alpha, A, B, C );
+    {
+        const GemmChoice choice =
+          SelectGemmAlgorithm<T>( m, n, sumDim, C.Grid() );
+        ScopedBlocksize blocksizeScope( choice.blocksize );
+        SUMMA_TT( orientA, orientB, alpha, A, B, C, choice.alg );
         break;
+    }
     case GEMM_SUMMA_A:
         SUMMA_TTA( orientA, orientB, alpha, A, B, C );
         break;
@@ -36,22 +36,24 @@ template<typename T>
 void Herk
 ( UpperOrLower uplo, Orientation orientation,
   Base<T> alpha, const AbstractDistMatrix<T>& A, 
-  Base<T> beta,        AbstractDistMatrix<T>& C )
+  Base<T> beta,        AbstractDistMatrix<T>& C,
+  SyrkAlgorithm alg )
 {
     EL_DEBUG_CSE
-    Syrk( uplo, orientation, T(alpha), A, T(beta), C, true );
+    Syrk( uplo, orientation, T(alpha), A, T(beta), C, true, alg );
 }
 
 template<typename T>
 void Herk
 ( UpperOrLower uplo, Orientation orientation,
-  Base<T> alpha, const AbstractDistMatrix<T>& A, AbstractDistMatrix<T>& C )
+  Base<T> alpha, const AbstractDistMatrix<T>& A, AbstractDistMatrix<T>& C,
+  SyrkAlgorithm alg )
 {
     EL_DEBUG_CSE
     const Int n = ( orientation==NORMAL ? A.Height() : A.Width() );
     C.Resize( n, n );
     Zero( C );
-    Syrk( uplo, orientation, T(alpha), A, T(0), C, true );
+    Syrk( uplo, orientation, T(alpha), A, T(0), C, true, alg );
 }
 
 template<typename T>
@@ -104,11 +106,12 @@ void Herk
     Base<T> alpha, const Matrix<T>& A, Matrix<T>& C ); \
   template void Herk \
   ( UpperOrLower uplo, Orientation orientation, \
-    Base<T> alpha, const AbstractDistMatrix<T>& A, AbstractDistMatrix<T>& C ); \
+    Base<T> alpha, const AbstractDistMatrix<T>& A, AbstractDistMatrix<T>& C, \
+    SyrkAlgorithm alg ); \
   template void Herk \
   ( UpperOrLower uplo, Orientation orientation, \
     Base<T> alpha, const AbstractDistMatrix<T>& A, \
-    Base<T> beta,        AbstractDistMatrix<T>& C ); \
+    Base<T> beta,        AbstractDistMatrix<T>& C, SyrkAlgorithm alg ); \
   template void Herk \
   ( UpperOrLower uplo, Orientation orientation, \
     Base<T> alpha, const SparseMatrix<T>& A, \
@@ -14,48 +14,243 @@
 namespace El {
 
 namespace {
-/**
- * MultiplyCSR specialization where the CSR matrix happens to have all nonzeros = 1.
- */
+
+// The local CSR kernels partition the rows among the threads so that each
+// thread receives roughly the same number of nonzeros, serve up to four
+// right-hand sides with each pass over a row, and accumulate the
+// (conjugate-)transposed products into per-thread buffers so that the
+// scatter into the output can also be threaded. The entries of X and Y are
+// addressed through row and column strides so that a single kernel handles
+// both the standard and the interleaved (row-major) layouts.
+
+inline int NumCSRThreads( Int numNonzeros, Int numRHS )
+{
+#ifdef EL_HYBRID
+    if( ParallelizeLoop(numNonzeros*numRHS) )
+        return NumThreads();
+#endif
+    return 1;
+}
+
+// Part t consists of rows [rowBounds[t],rowBounds[t+1])
+inline void BalancedRowBounds
+( Int m, const Int* rowOffsets, int numParts, vector<Int>& rowBounds )
+{
+    const Int numNonzeros = rowOffsets[m];
+    rowBounds.resize( numParts+1 );
+    rowBounds[0] = 0;
+    for( int t=1; t<numParts; ++t )
+    {
+        const Int target = (numNonzeros*t) / numParts;
+        rowBounds[t] =
+          std::lower_bound( rowOffsets, rowOffsets+m, target ) - rowOffsets;
+    }
+    rowBounds[numParts] = m;
+}
+
+// A null 'values' pointer (together with Pattern=true) treats every nonzero
+// as one
+template<bool Pattern,bool Conjugate,typename T>
+inline T CSRValue( const T* values, Int e )
+{
+    if( Pattern )
+        return T(1);
+    else
+        return Conjugate ? Conj(values[e]) : values[e];
+}
+
+// sum += alpha beta, with complex products expanded into real arithmetic so
+// that the inner loops avoid the (Annex G) complex multiply
 template<typename T>
-void MultiplyCSR
+inline void CSRMultiplyAdd( T& sum, const T& alpha, const T& beta )
+{ sum += alpha*beta; }
+
+template<typename Real>
+inline void CSRMultiplyAdd
+( Complex<Real>& sum, const Complex<Real>& alpha, const Complex<Real>& beta )
+{
+    const Real alphaReal = RealPart(alpha), alphaImag = ImagPart(alpha);
+    const Real betaReal = RealPart(beta), betaImag = ImagPart(beta);
+    sum = Complex<Real>
+      ( RealPart(sum) + alphaReal*betaReal - alphaImag*betaImag,
+        ImagPart(sum) + alphaReal*betaImag + alphaImag*betaReal );
+}
+
+template<bool Pattern,bool Conjugate,typename T>
+void LocalCSRKernel
 ( Orientation orientation,
-  Int m, Int n,
+  Int m, Int n, Int numRHS,
   T alpha,
   const Int* rowOffsets,
   const Int* colIndices,
-  const T*   x,
+  const T*   values,
+  const T*   X, Int XRowStride, Int XColStride,
   T beta,
-        T*   y )
+        T*   Y, Int YRowStride, Int YColStride )
 {
     EL_DEBUG_CSE
+    const Int numNonzeros = rowOffsets[m];
+    const int numThreads = NumCSRThreads( numNonzeros, numRHS );
+    vector<Int> rowBounds;
+    BalancedRowBounds( m, rowOffsets, numThreads, rowBounds );
+
     if( orientation == NORMAL )
     {
-        for( Int i=0; i<m; ++i )
+        auto rowKernel = [&]( Int iBeg, Int iEnd )
         {
-            T sum = 0;
-            const Int eStart = rowOffsets[i];
-            const Int eStop = rowOffsets[i+1];
-            for( Int e=eStart; e<eStop; ++e )
-                sum += x[colIndices[e]];
-            y[i] = alpha*sum + beta*y[i];
+            for( Int i=iBeg; i<iEnd; ++i )
+            {
+                const Int eStart = rowOffsets[i];
+                const Int eStop = rowOffsets[i+1];
+                T* y = &Y[i*YRowStride];
+                Int k=0;
+                for( ; k+4<=numRHS; k+=4 )
+                {
+                    const T* X0 = &X[k*XColStride];
+                    const T* X1 = X0 + XColStride;
+                    const T* X2 = X1 + XColStride;
+                    const T* X3 = X2 + XColStride;
+                    T sum0=0, sum1=0, sum2=0, sum3=0;
+                    for( Int e=eStart; e<eStop; ++e )
+                    {
+                        const T value = CSRValue<Pattern,false>( values, e );
+                        const Int off = colIndices[e]*XRowStride;
+                        CSRMultiplyAdd( sum0, value, X0[off] );
+                        CSRMultiplyAdd( sum1, value, X1[off] );
+                        CSRMultiplyAdd( sum2, value, X2[off] );
+                        CSRMultiplyAdd( sum3, value, X3[off] );
+                    }
+                    T* y0 = &y[k*YColStride];
+                    T* y1 = y0 + YColStride;
+                    T* y2 = y1 + YColStride;
+                    T* y3 = y2 + YColStride;
+                    *y0 = alpha*sum0 + beta*(*y0);
+                    *y1 = alpha*sum1 + beta*(*y1);
+                    *y2 = alpha*sum2 + beta*(*y2);
+                    *y3 = alpha*sum3 + beta*(*y3);
+                }
+                for( ; k<numRHS; ++k )
+                {
+                    const T* x = &X[k*XColStride];
+                    T sum = 0;
+                    for( Int e=eStart; e<eStop; ++e )
+                        CSRMultiplyAdd
+                        ( sum, CSRValue<Pattern,false>( values, e ),
+                          x[colIndices[e]*XRowStride] );
+                    T& upsilon = y[k*YColStride];
+                    upsilon = alpha*sum + beta*upsilon;
+                }
+            }
+        };
+#ifdef EL_HYBRID
+        if( numThreads > 1 )
+        {
+            #pragma omp parallel for num_threads(numThreads)
+            for( int t=0; t<numThreads; ++t )
+                rowKernel( rowBounds[t], rowBounds[t+1] );
+            return;
         }
+#endif
+        rowKernel( 0, m );
     }
     else
     {
-        for( Int j=0; j<n; ++j ){
-            y[j] *= beta;
-            for( Int i=0; i<m; ++i )
+        for( Int k=0; k<numRHS; ++k )
+            for( Int j=0; j<n; ++j )
+                Y[j*YRowStride+k*YColStride] *= beta;
+
+        // Z(colIndices[e],:) += alpha A(i,colIndices[e]) X(i,:)
+        auto scatterKernel =
+          [&]( Int iBeg, Int iEnd, T* Z, Int ZRowStride, Int ZColStride )
+        {
+            for( Int i=iBeg; i<iEnd; ++i )
             {
                 const Int eStart = rowOffsets[i];
                 const Int eStop = rowOffsets[i+1];
+                const T* x = &X[i*XRowStride];
                 for( Int e=eStart; e<eStop; ++e )
-                    y[colIndices[e]] += alpha*x[i];
+                {
+                    const T prod =
+                      alpha*CSRValue<Pattern,Conjugate>( values, e );
+                    T* z = &Z[colIndices[e]*ZRowStride];
+                    for( Int k=0; k<numRHS; ++k )
+                        CSRMultiplyAdd
+                        ( z[k*ZColStride], prod, x[k*XColStride] );
+                }
             }
-	}
+        };
+#ifdef EL_HYBRID
+        // Only pay for the per-thread accumulators when the reduction is
+        // cheaper than the scatter itself
+        if( numThreads > 1 && n <= numNonzeros )
+        {
+            const Int accumSize = n*numRHS;
+            vector<T> accum( numThreads*accumSize, T(0) );
+            #pragma omp parallel for num_threads(numThreads)
+            for( int t=0; t<numThreads; ++t )
+                scatterKernel
+                ( rowBounds[t], rowBounds[t+1], &accum[t*accumSize], 1, n );
+
+            EL_PARALLEL_FOR_IF(ParallelizeLoop(numThreads*accumSize))
+            for( Int j=0; j<n; ++j )
+            {
+                for( Int k=0; k<numRHS; ++k )
+                {
+                    T sum = 0;
+                    for( int t=0; t<numThreads; ++t )
+                        sum += accum[j+k*n+t*accumSize];
+                    Y[j*YRowStride+k*YColStride] += sum;
+                }
+            }
+            return;
+        }
+#endif
+        scatterKernel( 0, m, Y, YRowStride, YColStride );
     }
 }
 
+template<bool Pattern,typename T>
+void LocalCSR
+( Orientation orientation,
+  Int m, Int n, Int numRHS,
+  T alpha,
+  const Int* rowOffsets,
+  const Int* colIndices,
+  const T*   values,
+  const T*   X, Int XRowStride, Int XColStride,
+  T beta,
+        T*   Y, Int YRowStride, Int YColStride )
+{
+    if( orientation == ADJOINT )
+        LocalCSRKernel<Pattern,true>
+        ( orientation, m, n, numRHS, alpha, rowOffsets, colIndices, values,
+          X, XRowStride, XColStride, beta, Y, YRowStride, YColStride );
+    else
+        LocalCSRKernel<Pattern,false>
+        ( orientation, m, n, numRHS, alpha, rowOffsets, colIndices, values,
+          X, XRowStride, XColStride, beta, Y, YRowStride, YColStride );
+}
+
+/**
+ * MultiplyCSR specialization where the CSR matrix happens to have all nonzeros = 1.
+ */
+template<typename T>
+void MultiplyCSR
+( Orientation orientation,
+  Int m, Int n,
+  T alpha,
+  const Int* rowOffsets,
+  const Int* colIndices,
+  const T*   x,
+  T beta,
+        T*   y )
+{
+    EL_DEBUG_CSE
+    LocalCSR<true>
+    ( orientation, m, n, 1, alpha, rowOffsets, colIndices,
+      static_cast<const T*>(nullptr), x, 1, 1, beta, y, 1, 1 );
+}
+
 template<typename T,typename=DisableIf<IsBlasScalar<T>>>
 void MultiplyCSR
 ( Orientation orientation,
@@ -69,44 +264,9 @@ void MultiplyCSR
         T*   y )
 {
     EL_DEBUG_CSE
-    if( orientation == NORMAL )
-    {
-        for( Int i=0; i<m; ++i )
-        {
-            T sum = 0;
-            const Int eStart = rowOffsets[i];
-            const Int eStop = rowOffsets[i+1];
-            for( Int e=eStart; e<eStop; ++e )
-                sum += values[e]*x[colIndices[e]];
-            y[i] = alpha*sum + beta*y[i];
-        }
-    }
-    else
-    {
-        const bool conj = ( orientation == ADJOINT );
-        for( Int j=0; j<n; ++j )
-            y[j] *= beta;
-        if( conj )
-        {
-            for( Int i=0; i<m; ++i )
-            {
-                const Int eStart = rowOffsets[i];
-                const int eStop = rowOffsets[i+1];
-                for( Int e=eStart; e<eStop; ++e )
-                    y[colIndices[e]] += alpha*Conj(values[e])*x[i];
-            }
-        }
-        else
-        {
-            for( Int i=0; i<m; ++i )
-            {
-                const Int eStart = rowOffsets[i];
-                const Int eStop = rowOffsets[i+1];
-                for( Int e=eStart; e<eStop; ++e )
-                    y[colIndices[e]] += alpha*values[e]*x[i];
-            }
-        }
-    }
+    LocalCSR<false>
+    ( orientation, m, n, 1, alpha, rowOffsets, colIndices, values,
+      x, 1, 1, beta, y, 1, 1 );
 }
 
 template<typename T,typename=EnableIf<IsBlasScalar<T>>,typename=void>
@@ -130,44 +290,9 @@ void MultiplyCSR
     ( orientation, m, n, alpha, matDescrA,
       values, colIndices, rowOffsets, rowOffsets+1, x, beta, y );
 #else
-    if( orientation == NORMAL )
-    {
-        for( Int i=0; i<m; ++i )
-        {
-            T sum = 0;
-            const Int eStart = rowOffsets[i];
-            const Int eStop = rowOffsets[i+1];
-            for( Int e=eStart; e<eStop; ++e )
-                sum += values[e]*x[colIndices[e]];
-            y[i] = alpha*sum + beta*y[i];
-        }
-    }
-    else
-    {
-        const bool conj = ( orientation == ADJOINT );
-        for( Int j=0; j<n; ++j )
-            y[j] *= beta;
-        if( conj )
-        {
-            for( Int i=0; i<m; ++i )
-            {
-                const Int eStart = rowOffsets[i];
-                const int eStop = rowOffsets[i+1];
-                for( Int e=eStart; e<eStop; ++e )
-                    y[colIndices[e]] += alpha*Conj(values[e])*x[i];
-            }
-        }
-        else
-        {
-            for( Int i=0; i<m; ++i )
-            {
-                const Int eStart = rowOffsets[i];
-                const Int eStop = rowOffsets[i+1];
-                for( Int e=eStart; e<eStop; ++e )
-                    y[colIndices[e]] += alpha*values[e]*x[i];
-            }
-        }
-    }
+    LocalCSR<false>
+    ( orientation, m, n, 1, alpha, rowOffsets, colIndices, values,
+      x, 1, 1, beta, y, 1, 1 );
 #endif
 }
 
@@ -191,57 +316,9 @@ void MultiplyCSR
           rowOffsets, colIndices, values, X, beta, Y );
         return;
     }
-
-    if( orientation == NORMAL )
-    {
-        for( Int i=0; i<m; ++i )
-        {
-            for( Int k=0; k<numRHS; ++k )
-            {
-                T sum = 0;
-                const Int eStart = rowOffsets[i];
-                const Int eStop = rowOffsets[i+1];
-                for( Int e=eStart; e<eStop; ++e )
-                    sum += values[e]*X[colIndices[e]+k*ldX];
-                Y[i+k*ldY] = alpha*sum + beta*Y[i+k*ldY];
-            }
-        }
-    }
-    else
-    {
-        const bool conj = ( orientation == ADJOINT );
-        for( Int k=0; k<numRHS; ++k )
-            for( Int j=0; j<n; ++j )
-                Y[j+k*ldY] *= beta;
-        if( conj )
-        {
-            for( Int i=0; i<m; ++i )
-            {
-                const Int eStart = rowOffsets[i];
-                const Int eStop = rowOffsets[i+1];
-                for( Int e=eStart; e<eStop; ++e )
-                {
-                    T prod = alpha*Conj(values[e]);
-                    for( Int k=0; k<numRHS; ++k )
-                        Y[colIndices[e]+k*ldY] += prod*X[i+k*ldX];
-                }
-            }
-        }
-        else
-        {
-            for( Int i=0; i<m; ++i )
-            {
-                const Int eStart = rowOffsets[i];
-                const Int eStop = rowOffsets[i+1];
-                for( Int e=eStart; e<eStop; ++e )
-                {
-                    T prod = alpha*values[e];
-                    for( Int k=0; k<numRHS; ++k )
-                        Y[colIndices[e]+k*ldY] += prod*X[i+k*ldX];
-                }
-            }
-        }
-    }
+    LocalCSR<false>
+    ( orientation, m, n, numRHS, alpha, rowOffsets, colIndices, values,
+      X, 1, ldX, beta, Y, 1, ldY );
 }
 
 template<typename T>
@@ -256,47 +333,9 @@ void MultiplyCSR
         T*   Y, Int ldY )
 {
     EL_DEBUG_CSE
-    if( numRHS == 1 )
-    {
-        MultiplyCSR
-        ( orientation, m, n, alpha,
-          rowOffsets, colIndices, X, beta, Y );
-        return;
-    }
-
-    if( orientation == NORMAL )
-    {
-        for( Int i=0; i<m; ++i )
-        {
-            for( Int k=0; k<numRHS; ++k )
-            {
-                T sum = 0;
-                const Int eStart = rowOffsets[i];
-                const Int eStop = rowOffsets[i+1];
-                for( Int e=eStart; e<eStop; ++e )
-                    sum += X[colIndices[e]+k*ldX];
-                Y[i+k*ldY] = alpha*sum + beta*Y[i+k*ldY];
-            }
-        }
-    }
-    else
-    {
-        for( Int k=0; k<numRHS; ++k )
-	{
-            for( Int j=0; j<n; ++j )
-	    {
-                Y[j+k*ldY] *= beta;
-            	for( Int i=0; i<m; ++i )
-            	{
-            	    const Int eStart = rowOffsets[i];
-            	    const Int eStop = rowOffsets[i+1];
-            	    for( Int e=eStart; e<eStop; ++e )
-            	        for( Int k=0; k<numRHS; ++k )
-            	            Y[colIndices[e]+k*ldY] += alpha*X[i+k*ldX];
-            	}
-            }
-        }
-    }
+    LocalCSR<true>
+    ( orientation, m, n, numRHS, alpha, rowOffsets, colIndices,
+      static_cast<const T*>(nullptr), X, 1, ldX, beta, Y, 1, ldY );
 }
 
 template<typename T>
@@ -319,57 +358,9 @@ void MultiplyCSRInterX
           rowOffsets, colIndices, values, X, beta, Y );
         return;
     }
-
-    if( orientation == NORMAL )
-    {
-        for( Int i=0; i<m; ++i )
-        {
-            for( Int k=0; k<numRHS; ++k )
-            {
-                T sum = 0;
-                const Int eStart = rowOffsets[i];
-                const Int eStop = rowOffsets[i+1];
-                for( Int e=eStart; e<eStop; ++e )
-                    sum += values[e]*X[colIndices[e]*numRHS+k];
-                Y[i+k*ldY] = alpha*sum + beta*Y[i+k*ldY];
-            }
-        }
-    }
-    else
-    {
-        const bool conj = ( orientation == ADJOINT );
-        for( Int k=0; k<numRHS; ++k )
-            for( Int j=0; j<n; ++j )
-                Y[j+k*ldY] *= beta;
-        if( conj )
-        {
-            for( Int i=0; i<m; ++i )
-            {
-                const Int eStart = rowOffsets[i];
-                const Int eStop = rowOffsets[i+1];
-                for( Int e=eStart; e<eStop; ++e )
-                {
-                    T prod = alpha*Conj(values[e]);
-                    for( Int k=0; k<numRHS; ++k )
-                        Y[colIndices[e]+k*ldY] += prod*X[i*numRHS+k];
-                }
-            }
-        }
-        else
-        {
-            for( Int i=0; i<m; ++i )
-            {
-                const Int eStart = rowOffsets[i];
-                const Int eStop = rowOffsets[i+1];
-                for( Int e=eStart; e<eStop; ++e )
-                {
-                    T prod = alpha*values[e];
-                    for( Int k=0; k<numRHS; ++k )
-                        Y[colIndices[e]+k*ldY] += prod*X[i*numRHS+k];
-                }
-            }
-        }
-    }
+    LocalCSR<false>
+    ( orientation, m, n, numRHS, alpha, rowOffsets, colIndices, values,
+      X, numRHS, 1, beta, Y, 1, ldY );
 }
 
 template<typename T>
@@ -392,57 +383,9 @@ void MultiplyCSRInterY
           rowOffsets, colIndices, values, X, beta, Y );
         return;
     }
-
-    if( orientation == NORMAL )
-    {
-        for( Int i=0; i<m; ++i )
-        {
-            for( Int k=0; k<numRHS; ++k )
-            {
-                T sum = 0;
-                const Int eStart = rowOffsets[i];
-                const Int eStop = rowOffsets[i+1];
-                for( Int e=eStart; e<eStop; ++e )
-                    sum += values[e]*X[colIndices[e]+k*ldX];
-                Y[i*numRHS+k] = alpha*sum + beta*Y[i*numRHS+k];
-            }
-        }
-    }
-    else
-    {
-        const bool conj = ( orientation == ADJOINT );
-        for( Int k=0; k<numRHS; ++k )
-            for( Int j=0; j<n; ++j )
-                Y[j*numRHS+k] *= beta;
-        if( conj )
-        {
-            for( Int i=0; i<m; ++i )
-            {
-                const Int eStart = rowOffsets[i];
-                const Int eStop = rowOffsets[i+1];
-                for( Int e=eStart; e<eStop; ++e )
-                {
-                    T prod = alpha*Conj(values[e]);
-                    for( Int k=0; k<numRHS; ++k )
-                        Y[colIndices[e]*numRHS+k] += prod*X[i+k*ldX];
-                }
-            }
-        }
-        else
-        {
-            for( Int i=0; i<m; ++i )
-            {
-                const Int eStart = rowOffsets[i];
-                const Int eStop = rowOffsets[i+1];
-                for( Int e=eStart; e<eStop; ++e )
-                {
-                    T prod = alpha*values[e];
-                    for( Int k=0; k<numRHS; ++k )
-                        Y[colIndices[e]*numRHS+k] += prod*X[i+k*ldX];
-                }
-            }
-        }
-    }
+    LocalCSR<false>
+    ( orientation, m, n, numRHS, alpha, rowOffsets, colIndices, values,
+      X, 1, ldX, beta, Y, numRHS, 1 );
 }
 
 template<typename T>
@@ -465,57 +408,358 @@ void MultiplyCSRInter
           rowOffsets, colIndices, values, X, beta, Y );
         return;
     }
+    LocalCSR<false>
+    ( orientation, m, n, numRHS, alpha, rowOffsets, colIndices, values,
+      X, numRHS, 1, beta, Y, numRHS, 1 );
+}
 
-    if( orientation == NORMAL )
+// Y(i,:) += alpha A(i,:) X for each of the listed rows, where X is
+// interleaved
+template<typename T>
+void MultiplyCSRRowsInterX
+( Int numRows, const Int* rows, Int numRHS,
+  T alpha,
+  const Int* rowOffsets,
+  const Int* colIndices,
+  const T*   values,
+  const T*   X,
+        T*   Y, Int ldY )
+{
+    EL_DEBUG_CSE
+    EL_PARALLEL_FOR_IF(ParallelizeLoop(numRows*numRHS))
+    for( Int t=0; t<numRows; ++t )
     {
-        for( Int i=0; i<m; ++i )
+        const Int i = rows[t];
+        const Int eStart = rowOffsets[i];
+        const Int eStop = rowOffsets[i+1];
+        for( Int k=0; k<numRHS; ++k )
         {
+            T sum = 0;
+            for( Int e=eStart; e<eStop; ++e )
+                sum += values[e]*X[colIndices[e]*numRHS+k];
+            Y[i+k*ldY] += alpha*sum;
+        }
+    }
+}
+
+// Y(j,:) += alpha op(A(i,j)) X(i,:) for each nonzero of the listed rows,
+// where Y is interleaved
+template<typename T>
+void MultiplyCSRRowsInterY
+( Orientation orientation,
+  Int numRows, const Int* rows, Int numRHS,
+  T alpha,
+  const Int* rowOffsets,
+  const Int* colIndices,
+  const T*   values,
+  const T*   X, Int ldX,
+        T*   Y )
+{
+    EL_DEBUG_CSE
+    const bool conj = ( orientation == ADJOINT );
+    for( Int t=0; t<numRows; ++t )
+    {
+        const Int i = rows[t];
+        const Int eStart = rowOffsets[i];
+        const Int eStop = rowOffsets[i+1];
+        for( Int e=eStart; e<eStop; ++e )
+        {
+            const T prod = alpha*( conj ? Conj(values[e]) : values[e] );
+            T* y = &Y[colIndices[e]*numRHS];
             for( Int k=0; k<numRHS; ++k )
+                y[k] += prod*X[i+k*ldX];
+        }
+    }
+}
+
+// Post nonblocking messages to and from every neighbor other than ourself
+template<typename T>
+void PostExchange
+( const vector<T>& sendVals,
+  const vector<int>& sendSizes,
+  const vector<int>& sendOffs,
+        vector<T>& recvVals,
+  const vector<int>& recvSizes,
+  const vector<int>& recvOffs,
+  int commRank,
+  mpi::Comm comm,
+  vector<mpi::Request<T>>& requests )
+{
+    EL_DEBUG_CSE
+    const int commSize = sendSizes.size();
+    int numRequests = 0;
+    for( int q=0; q<commSize; ++q )
+    {
+        if( q == commRank )
+            continue;
+        if( recvSizes[q] > 0 )
+            ++numRequests;
+        if( sendSizes[q] > 0 )
+            ++numRequests;
+    }
+    // The requests must not be reallocated while they are in flight
+    requests.resize( numRequests );
+    int request = 0;
+    for( int q=0; q<commSize; ++q )
+    {
+        if( q == commRank )
+            continue;
+        if( recvSizes[q] > 0 )
+            mpi::IRecv
+            ( recvVals.data()+recvOffs[q], recvSizes[q], q, comm,
+              requests[request++] );
+        if( sendSizes[q] > 0 )
+            mpi::ISend
+            ( sendVals.data()+sendOffs[q], sendSizes[q], q, comm,
+              requests[request++] );
+    }
+}
+
+// Y := Y + alpha A X for an m x n (possibly truncated) block of A stored
+// with leading dimension 'blockSize', where 'y' and 'x' point to the
+// corresponding rows of Y and X. Fixing the block size at compile time
+// allows the loops over the block to be fully unrolled and vectorized.
+template<Int BlockSize,typename T>
+void BSRBlockNormal
+( Int blockSize, Int m, Int n, const T* block,
+  T alpha, Int numRHS, const T* x, Int ldX, T* y, Int ldY )
+{
+    if( BlockSize > 0 && m == BlockSize && n == BlockSize )
+    {
+        for( Int k=0; k<numRHS; ++k )
+            for( Int c=0; c<BlockSize; ++c )
             {
-                T sum = 0;
-                const Int eStart = rowOffsets[i];
-                const Int eStop = rowOffsets[i+1];
-                for( Int e=eStart; e<eStop; ++e )
-                    sum += values[e]*X[colIndices[e]*numRHS+k];
-                Y[i*numRHS+k] = alpha*sum + beta*Y[i*numRHS+k];
+                const T tau = alpha*x[c+k*ldX];
+                for( Int r=0; r<BlockSize; ++r )
+                    y[r+k*ldY] += block[r+c*BlockSize]*tau;
+            }
+    }
+    else
+    {
+        for( Int k=0; k<numRHS; ++k )
+            for( Int c=0; c<n; ++c )
+            {
+                const T tau = alpha*x[c+k*ldX];
+                for( Int r=0; r<m; ++r )
+                    y[r+k*ldY] += block[r+c*blockSize]*tau;
+            }
+    }
+}
+
+// Y := Y + alpha op(A)^T X for an m x n block of A, so that 'y' points to
+// the rows of Y corresponding to the block column
+template<Int BlockSize,bool Conjugate,typename T>
+void BSRBlockTrans
+( Int blockSize, Int m, Int n, const T* block,
+  T alpha, Int numRHS, const T* x, Int ldX, T* y, Int ldY )
+{
+    const Int bs = ( BlockSize > 0 && m == BlockSize && n == BlockSize ?
+                     BlockSize : blockSize );
+    for( Int k=0; k<numRHS; ++k )
+        for( Int c=0; c<n; ++c )
+        {
+            T sum = 0;
+            for( Int r=0; r<m; ++r )
+                sum += CSRValue<false,Conjugate>( block, r+c*bs )*x[r+k*ldX];
+            y[c+k*ldY] += alpha*sum;
+        }
+}
+
+// Y := Y + alpha op(A) X, where Y has already been scaled
+template<Int BlockSize,typename T>
+void LocalBSR
+( Orientation orientation,
+  T alpha, const BlockSparseMatrix<T>& A, const Matrix<T>& X,
+                                                Matrix<T>& Y )
+{
+    EL_DEBUG_CSE
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int blockSize = A.BlockSize();
+    const Int blockArea = blockSize*blockSize;
+    const Int numBlockRows = A.NumBlockRows();
+    const Int numRHS = X.Width();
+    const Int* blockRowOffsets = A.LockedOffsetBuffer();
+    const Int* blockCols = A.LockedTargetBuffer();
+    const T* values = A.LockedValueBuffer();
+    const T* XBuf = X.LockedBuffer();
+    const Int ldX = X.LDim();
+    T* YBuf = Y.Buffer();
+    const Int ldY = Y.LDim();
+
+    if( orientation == NORMAL )
+    {
+        // Each block row updates a distinct set of rows of Y
+        EL_PARALLEL_FOR_IF(ParallelizeLoop(A.NumBlocks()*blockArea*numRHS))
+        for( Int I=0; I<numBlockRows; ++I )
+        {
+            const Int iOff = I*blockSize;
+            const Int height = Min( blockSize, m-iOff );
+            for( Int index=blockRowOffsets[I]; index<blockRowOffsets[I+1];
+                 ++index )
+            {
+                const Int jOff = blockCols[index]*blockSize;
+                BSRBlockNormal<BlockSize>
+                ( blockSize, height, Min(blockSize,n-jOff),
+                  &values[index*blockArea], alpha, numRHS,
+                  &XBuf[jOff], ldX, &YBuf[iOff], ldY );
             }
         }
     }
     else
     {
-        const bool conj = ( orientation == ADJOINT );
-        for( Int j=0; j<n; ++j )
-            for( Int k=0; k<numRHS; ++k )
-                Y[j*numRHS+k] *= beta;
-        if( conj )
+        const bool conjugate = ( orientation == ADJOINT );
+        for( Int I=0; I<numBlockRows; ++I )
         {
-            for( Int i=0; i<m; ++i )
+            const Int iOff = I*blockSize;
+            const Int height = Min( blockSize, m-iOff );
+            for( Int index=blockRowOffsets[I]; index<blockRowOffsets[I+1];
+                 ++index )
             {
-                const Int eStart = rowOffsets[i];
-                const Int eStop = rowOffsets[i+1];
-                for( Int e=eStart; e<eStop; ++e )
-                {
-                    T prod = alpha*Conj(values[e]);
-                    for( Int k=0; k<numRHS; ++k )
-                        Y[colIndices[e]*numRHS+k] += prod*X[i*numRHS+k];
-                }
+                const Int jOff = blockCols[index]*blockSize;
+                const Int width = Min( blockSize, n-jOff );
+                if( conjugate )
+                    BSRBlockTrans<BlockSize,true>
+                    ( blockSize, height, width, &values[index*blockArea],
+                      alpha, numRHS, &XBuf[iOff], ldX, &YBuf[jOff], ldY );
+                else
+                    BSRBlockTrans<BlockSize,false>
+                    ( blockSize, height, width, &values[index*blockArea],
+                      alpha, numRHS, &XBuf[iOff], ldX, &YBuf[jOff], ldY );
             }
         }
-        else
+    }
+}
+
+// Send each local row i of A to every process in the process row which owns
+// row i of Z and store the received rows in CSR form, indexed by the local
+// rows of Z. The column indices remain global.
+template<typename T>
+void RowsToProcessRows
+( const DistSparseMatrix<T>& A,
+  const DistMatrix<T>& Z,
+  vector<Int>& offsets,
+  vector<Int>& cols,
+  vector<T>& vals )
+{
+    EL_DEBUG_CSE
+    const Grid& g = Z.Grid();
+    mpi::Comm comm = g.VCComm();
+    const int gridHeight = g.Height();
+    const int gridWidth = g.Width();
+    const int commSize = g.Size();
+    const Int localHeight = A.LocalHeight();
+    const Int firstLocalRow = A.FirstLocalRow();
+    const Int* colBuf = A.LockedTargetBuffer();
+    const T* valBuf = A.LockedValueBuffer();
+
+    // Process (s,t) of the grid has rank s + t*gridHeight in the VC comm
+    vector<int> sendCounts(commSize,0);
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+    {
+        const int s = Z.RowOwner( firstLocalRow+iLoc );
+        for( int t=0; t<gridWidth; ++t )
+            sendCounts[s+t*gridHeight] += A.NumConnections( iLoc );
+    }
+    vector<int> sendOffs;
+    const int totalSend = Scan( sendCounts, sendOffs );
+    vector<Int> sendRows(totalSend), sendCols(totalSend);
+    vector<T> sendVals(totalSend);
+    auto offs = sendOffs;
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+    {
+        const Int i = firstLocalRow + iLoc;
+        const int s = Z.RowOwner( i );
+        const Int offset = A.RowOffset( iLoc );
+        const Int numConn = A.NumConnections( iLoc );
+        for( int t=0; t<gridWidth; ++t )
         {
-            for( Int i=0; i<m; ++i )
+            int& off = offs[s+t*gridHeight];
+            for( Int e=offset; e<offset+numConn; ++e )
             {
-                const Int eStart = rowOffsets[i];
-                const Int eStop = rowOffsets[i+1];
-                for( Int e=eStart; e<eStop; ++e )
-                {
-                    T prod = alpha*values[e];
-                    for( Int k=0; k<numRHS; ++k )
-                        Y[colIndices[e]*numRHS+k] += prod*X[i*numRHS+k];
-                }
+                sendRows[off] = i;
+                sendCols[off] = colBuf[e];
+                sendVals[off] = valBuf[e];
+                ++off;
             }
         }
     }
+
+    vector<int> recvCounts(commSize);
+    mpi::AllToAll( sendCounts.data(), 1, recvCounts.data(), 1, comm );
+    vector<int> recvOffs;
+    const int totalRecv = Scan( recvCounts, recvOffs );
+    vector<Int> recvRows(totalRecv), recvCols(totalRecv);
+    vector<T> recvVals(totalRecv);
+    mpi::AllToAll
+    ( sendRows.data(), sendCounts.data(), sendOffs.data(),
+      recvRows.data(), recvCounts.data(), recvOffs.data(), comm );
+    SwapClear( sendRows );
+    mpi::AllToAll
+    ( sendCols.data(), sendCounts.data(), sendOffs.data(),
+      recvCols.data(), recvCounts.data(), recvOffs.data(), comm );
+    SwapClear( sendCols );
+    mpi::AllToAll
+    ( sendVals.data(), sendCounts.data(), sendOffs.data(),
+      recvVals.data(), recvCounts.data(), recvOffs.data(), comm );
+    SwapClear( sendVals );
+
+    // Each row arrives contiguously from a single process, so a (stable)
+    // counting sort keeps the entries of each row in order
+    const Int ZLocalHeight = Z.LocalHeight();
+    offsets.assign( ZLocalHeight+1, 0 );
+    for( int k=0; k<totalRecv; ++k )
+        ++offsets[Z.LocalRow(recvRows[k])+1];
+    for( Int iLoc=0; iLoc<ZLocalHeight; ++iLoc )
+        offsets[iLoc+1] += offsets[iLoc];
+    cols.resize( totalRecv );
+    vals.resize( totalRecv );
+    vector<Int> rowOffs( offsets.begin(), offsets.end()-1 );
+    for( int k=0; k<totalRecv; ++k )
+    {
+        const Int off = rowOffs[Z.LocalRow(recvRows[k])]++;
+        cols[off] = recvCols[k];
+        vals[off] = recvVals[k];
+    }
+}
+
+// Find the distinct rows of Z referenced by 'cols', ordered by their owning
+// process row, and overwrite each column index with the position of its row
+// in that ordering
+template<typename T>
+void FormHalo
+( const DistMatrix<T>& Z,
+  vector<Int>& cols,
+  vector<Int>& haloRows,
+  vector<int>& haloSizes,
+  vector<int>& haloOffs )
+{
+    EL_DEBUG_CSE
+    vector<Int> uniqueRows( cols );
+    std::sort( uniqueRows.begin(), uniqueRows.end() );
+    uniqueRows.erase
+    ( std::unique( uniqueRows.begin(), uniqueRows.end() ), uniqueRows.end() );
+    const Int numHalo = uniqueRows.size();
+
+    haloSizes.assign( Z.Grid().Height(), 0 );
+    for( Int k=0; k<numHalo; ++k )
+        ++haloSizes[Z.RowOwner(uniqueRows[k])];
+    Scan( haloSizes, haloOffs );
+    auto offs = haloOffs;
+    vector<Int> positions(numHalo);
+    haloRows.resize( numHalo );
+    for( Int k=0; k<numHalo; ++k )
+    {
+        positions[k] = offs[Z.RowOwner(uniqueRows[k])]++;
+        haloRows[positions[k]] = uniqueRows[k];
+    }
+    for( auto& j : cols )
+    {
+        const Int k =
+          std::lower_bound( uniqueRows.begin(), uniqueRows.end(), j ) -
+          uniqueRows.begin();
+        j = positions[k];
+    }
 }
 
 } // anonymous namespace
@@ -540,6 +784,35 @@ void Multiply
       beta,  Y.Buffer(),       Y.LDim() );
 }
 
+template<typename T>
+void Multiply
+( Orientation orientation,
+  T alpha, const BlockSparseMatrix<T>& A, const Matrix<T>& X,
+  T beta,                                       Matrix<T>& Y )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( X.Width() != Y.Width() )
+          LogicError("X and Y must have the same width");
+      const Int mOp = ( orientation == NORMAL ? A.Height() : A.Width() );
+      const Int nOp = ( orientation == NORMAL ? A.Width() : A.Height() );
+      if( X.Height() != nOp || Y.Height() != mOp )
+          LogicError("Nonconformal block sparse multiply");
+    )
+    Scale( beta, Y );
+    switch( A.BlockSize() )
+    {
+    case 2: LocalBSR<2>( orientation, alpha, A, X, Y ); break;
+    case 3: LocalBSR<3>( orientation, alpha, A, X, Y ); break;
+    case 4: LocalBSR<4>( orientation, alpha, A, X, Y ); break;
+    case 5: LocalBSR<5>( orientation, alpha, A, X, Y ); break;
+    case 6: LocalBSR<6>( orientation, alpha, A, X, Y ); break;
+    case 7: LocalBSR<7>( orientation, alpha, A, X, Y ); break;
+    case 8: LocalBSR<8>( orientation, alpha, A, X, Y ); break;
+    default: LocalBSR<0>( orientation, alpha, A, X, Y ); break;
+    }
+}
+
 template<typename T>
 void Multiply
 ( Orientation orientation,
@@ -608,6 +881,12 @@ void Multiply
         sendOffs[q] *= b;
     }
 
+    // Entries with a fixed-size MPI datatype are exchanged through the
+    // persistent requests cached alongside the multiplication metadata
+    mpi::PersistentExchange* persistent =
+      ( IsPacked<Base<T>>::value ?
+        &meta.template Exchange<T>( orientation, b, grid.Comm() ) : nullptr );
+
     if( orientation == NORMAL )
     {
         if( A.Height() != Y.Height() )
@@ -618,8 +897,16 @@ void Multiply
         // Pack the send values
         const Int numSendInds = meta.sendInds.size();
         const Int firstLocalRow = X.FirstLocalRow();
-        vector<T> sendVals;
-        FastResize( sendVals, numSendInds*b );
+        vector<T> sendVals, recvVals;
+        if( !persistent )
+        {
+            FastResize( sendVals, numSendInds*b );
+            recvVals.resize( meta.numRecvInds*b );
+        }
+        T* sendBuf = ( persistent ? persistent->SendBuffer<T>()
+                                  : sendVals.data() );
+        const T* recvBuf = ( persistent ? persistent->RecvBuffer<T>()
+                                        : recvVals.data() );
         const T* XBuffer = X.LockedMatrix().LockedBuffer();
         const Int ldX = X.LockedMatrix().LDim();
         for( Int s=0; s<numSendInds; ++s )
@@ -627,27 +914,81 @@ void Multiply
             const Int i = meta.sendInds[s];
             const Int iLoc = i - firstLocalRow;
             for( Int t=0; t<b; ++t )
-                sendVals[s*b+t] = XBuffer[iLoc+t*ldX];
+                sendBuf[s*b+t] = XBuffer[iLoc+t*ldX];
         }
 
-        // Now send them
-        vector<T> recvVals( meta.numRecvInds*b );
-        mpi::AllToAll
-        ( sendVals.data(), sendSizes.data(), sendOffs.data(),
-          recvVals.data(), recvSizes.data(), recvOffs.data(), grid.Comm() );
+        if( meta.sparseExchange )
+        {
+            // Multiply the interior rows while the remote entries of X are
+            // in flight, and then the boundary rows
+            vector<mpi::Request<T>> requests;
+            if( persistent )
+            {
+                persistent->Start();
+            }
+            else
+            {
+                PostExchange
+                ( sendVals, sendSizes, sendOffs,
+                  recvVals, recvSizes, recvOffs, commRank, grid.Comm(),
+                  requests );
+                std::copy
+                ( sendVals.begin()+sendOffs[commRank],
+                  sendVals.begin()+sendOffs[commRank]+sendSizes[commRank],
+                  recvVals.begin()+recvOffs[commRank] );
+            }
+            if( time && commRank == 0 )
+                timer.Start();
+            MultiplyCSRRowsInterX
+            ( meta.interiorRows.size(), meta.interiorRows.data(), b,
+              alpha, A.LockedOffsetBuffer(),
+                     meta.colOffs.data(),
+                     A.LockedValueBuffer(),
+                     recvBuf,
+                     Y.Matrix().Buffer(), Y.Matrix().LDim() );
+            if( persistent )
+                persistent->Wait();
+            else
+                mpi::WaitAll( requests.size(), requests.data() );
+            MultiplyCSRRowsInterX
+            ( meta.boundaryRows.size(), meta.boundaryRows.data(), b,
+              alpha, A.LockedOffsetBuffer(),
+                     meta.colOffs.data(),
+                     A.LockedValueBuffer(),
+                     recvBuf,
+                     Y.Matrix().Buffer(), Y.Matrix().LDim() );
+            if( time && commRank == 0 )
+                Output("  Overlapped MultiplyCSRInterX time: ",timer.Stop());
+        }
+        else
+        {
+            // Now send them
+            if( persistent )
+            {
+                persistent->Start();
+                persistent->Wait();
+            }
+            else
+            {
+                mpi::AllToAll
+                ( sendVals.data(), sendSizes.data(), sendOffs.data(),
+                  recvVals.data(), recvSizes.data(), recvOffs.data(),
+                  grid.Comm() );
+            }
 
-        // Perform the local multiply-accumulate, y := alpha A x + y
-        if( time && commRank == 0 )
-            timer.Start();
-        MultiplyCSRInterX
-        ( NORMAL, A.LocalHeight(), meta.numRecvInds, b,
-          alpha, A.LockedOffsetBuffer(),
-                 meta.colOffs.data(),
-                 A.LockedValueBuffer(),
-                 recvVals.data(),
-          T(1),  Y.Matrix().Buffer(), Y.Matrix().LDim() );
-        if( time && commRank == 0 )
-            Output("  MultiplyCSRInterX time: ",timer.Stop());
+            // Perform the local multiply-accumulate, y := alpha A x + y
+            if( time && commRank == 0 )
+                timer.Start();
+            MultiplyCSRInterX
+            ( NORMAL, A.LocalHeight(), meta.numRecvInds, b,
+              alpha, A.LockedOffsetBuffer(),
+                     meta.colOffs.data(),
+                     A.LockedValueBuffer(),
+                     recvBuf,
+              T(1),  Y.Matrix().Buffer(), Y.Matrix().LDim() );
+            if( time && commRank == 0 )
+                Output("  MultiplyCSRInterX time: ",timer.Stop());
+        }
     }
     else
     {
@@ -659,24 +1000,98 @@ void Multiply
         // Form and pack the updates to Y
         if( time && commRank == 0 )
             timer.Start();
-        vector<T> sendVals( meta.numRecvInds*b, 0 );
-        MultiplyCSRInterY
-        ( orientation, A.LocalHeight(), meta.numRecvInds, b,
-          alpha, A.LockedOffsetBuffer(),
-                 meta.colOffs.data(),
-                 A.LockedValueBuffer(),
-                 X.LockedMatrix().LockedBuffer(), X.LockedMatrix().LDim(),
-          T(1),  sendVals.data() );
-        if( time && commRank == 0 )
-            Output("  MultiplyCSRInterY time: ",timer.Stop());
-
-        // Inject the updates to Y into the network
         const Int numRecvInds = meta.sendInds.size();
-        vector<T> recvVals;
-        FastResize( recvVals, numRecvInds*b );
-        mpi::AllToAll
-        ( sendVals.data(), recvSizes.data(), recvOffs.data(),
-          recvVals.data(), sendSizes.data(), sendOffs.data(), grid.Comm() );
+        vector<T> sendVals, recvVals;
+        if( persistent )
+        {
+            std::fill
+            ( persistent->SendBuffer<T>(),
+              persistent->SendBuffer<T>()+meta.numRecvInds*b, T(0) );
+        }
+        else
+        {
+            sendVals.resize( meta.numRecvInds*b, T(0) );
+            FastResize( recvVals, numRecvInds*b );
+        }
+        T* sendBuf = ( persistent ? persistent->SendBuffer<T>()
+                                  : sendVals.data() );
+        const T* recvBuf = ( persistent ? persistent->RecvBuffer<T>()
+                                        : recvVals.data() );
+        const T* XBuffer = X.LockedMatrix().LockedBuffer();
+        const Int ldX = X.LockedMatrix().LDim();
+        if( meta.sparseExchange )
+        {
+            // The boundary rows are the only ones which update remote
+            // entries of Y, so their updates can be sent while the interior
+            // rows form the remaining local updates
+            MultiplyCSRRowsInterY
+            ( orientation, meta.boundaryRows.size(), meta.boundaryRows.data(),
+              b, alpha, A.LockedOffsetBuffer(),
+                        meta.colOffs.data(),
+                        A.LockedValueBuffer(),
+                        XBuffer, ldX,
+                        sendBuf );
+            vector<mpi::Request<T>> requests;
+            if( persistent )
+                persistent->Start();
+            else
+                PostExchange
+                ( sendVals, recvSizes, recvOffs,
+                  recvVals, sendSizes, sendOffs, commRank, grid.Comm(),
+                  requests );
+            MultiplyCSRRowsInterY
+            ( orientation, meta.interiorRows.size(), meta.interiorRows.data(),
+              b, alpha, A.LockedOffsetBuffer(),
+                        meta.colOffs.data(),
+                        A.LockedValueBuffer(),
+                        XBuffer, ldX,
+                        sendBuf );
+            if( persistent )
+            {
+                // The local updates were formed after the exchange started
+                std::copy
+                ( sendBuf+recvOffs[commRank],
+                  sendBuf+recvOffs[commRank]+recvSizes[commRank],
+                  persistent->RecvBuffer<T>()+sendOffs[commRank] );
+                persistent->Wait();
+            }
+            else
+            {
+                std::copy
+                ( sendVals.begin()+recvOffs[commRank],
+                  sendVals.begin()+recvOffs[commRank]+recvSizes[commRank],
+                  recvVals.begin()+sendOffs[commRank] );
+                mpi::WaitAll( requests.size(), requests.data() );
+            }
+            if( time && commRank == 0 )
+                Output("  Overlapped MultiplyCSRInterY time: ",timer.Stop());
+        }
+        else
+        {
+            MultiplyCSRInterY
+            ( orientation, A.LocalHeight(), meta.numRecvInds, b,
+              alpha, A.LockedOffsetBuffer(),
+                     meta.colOffs.data(),
+                     A.LockedValueBuffer(),
+                     XBuffer, ldX,
+              T(1),  sendBuf );
+            if( time && commRank == 0 )
+                Output("  MultiplyCSRInterY time: ",timer.Stop());
+
+            // Inject the updates to Y into the network
+            if( persistent )
+            {
+                persistent->Start();
+                persistent->Wait();
+            }
+            else
+            {
+                mpi::AllToAll
+                ( sendVals.data(), recvSizes.data(), recvOffs.data(),
+                  recvVals.data(), sendSizes.data(), sendOffs.data(),
+                  grid.Comm() );
+            }
+        }
 
         // Accumulate the received indices onto Y
         const Int firstLocalRow = Y.FirstLocalRow();
@@ -687,13 +1102,158 @@ void Multiply
             const Int i = meta.sendInds[s];
             const Int iLoc = i - firstLocalRow;
             for( Int t=0; t<b; ++t )
-                YBuffer[iLoc+t*ldY] += recvVals[s*b+t];
+                YBuffer[iLoc+t*ldY] += recvBuf[s*b+t];
         }
     }
     if( time && commRank == 0 )
         Output("Multiply total time: ",totalTimer.Stop());
 }
 
+// The rows of A are partitioned over the process rows, conformally with the
+// rows of Y (or, for op(A) != A, of X), and replicated within each process
+// row, so that each process column independently multiplies by its own
+// columns of X. Since X and Y are used in their [MC,MR] distributions, only
+// A (once per process column) and the rows of X (or Y) referenced by the
+// local nonzeros of A are communicated, and the latter only within the
+// process columns.
+template<typename T>
+void Multiply
+( Orientation orientation,
+        T alpha,
+  const DistSparseMatrix<T>& A,
+  const AbstractDistMatrix<T>& XPre,
+        T beta,
+        AbstractDistMatrix<T>& YPre )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( XPre.Width() != YPre.Width() )
+          LogicError("X and Y must have the same width");
+    )
+    if( !mpi::Congruent( A.Grid().Comm(), XPre.Grid().Comm() ) ||
+        !mpi::Congruent( XPre.Grid().Comm(), YPre.Grid().Comm() ) )
+        LogicError("Communicators did not match");
+    const Int mOp = ( orientation == NORMAL ? A.Height() : A.Width() );
+    const Int nOp = ( orientation == NORMAL ? A.Width() : A.Height() );
+    if( XPre.Height() != nOp || YPre.Height() != mOp )
+        LogicError
+        ("Nonconformal Multiply of ",A.Height()," x ",A.Width(),
+         " sparse matrix with ",XPre.Height()," x ",XPre.Width(),
+         " into ",YPre.Height()," x ",YPre.Width());
+
+    DistMatrixReadWriteProxy<T,T,MC,MR> YProx( YPre );
+    auto& Y = YProx.Get();
+
+    // Each process must own the same columns of X and Y
+    ElementalProxyCtrl ctrl;
+    ctrl.rowConstrain = true;
+    ctrl.rowAlign = Y.RowAlign();
+    DistMatrixReadProxy<T,T,MC,MR> XProx( XPre, ctrl );
+    auto& X = XProx.GetLocked();
+
+    mpi::Comm colComm = Y.Grid().ColComm();
+    const Int b = X.LocalWidth();
+    Scale( beta, Y );
+
+    vector<Int> offsets, cols, haloRows;
+    vector<T> vals;
+    vector<int> haloSizes, haloOffs;
+    if( orientation == NORMAL )
+    {
+        RowsToProcessRows( A, Y, offsets, cols, vals );
+        FormHalo( X, cols, haloRows, haloSizes, haloOffs );
+        const Int numHalo = haloRows.size();
+
+        // Request the referenced rows of X from their owners
+        vector<int> sendSizes(haloSizes.size()), sendOffs;
+        mpi::AllToAll( haloSizes.data(), 1, sendSizes.data(), 1, colComm );
+        const int numSendRows = Scan( sendSizes, sendOffs );
+        vector<Int> sendRows(numSendRows);
+        mpi::AllToAll
+        ( haloRows.data(), haloSizes.data(), haloOffs.data(),
+          sendRows.data(), sendSizes.data(), sendOffs.data(), colComm );
+
+        // Send our local rows of X (interleaved)
+        const T* XBuf = X.LockedBuffer();
+        const Int ldX = X.LDim();
+        vector<T> sendVals, haloVals;
+        FastResize( sendVals, numSendRows*b );
+        FastResize( haloVals, numHalo*b );
+        for( Int s=0; s<numSendRows; ++s )
+        {
+            const Int iLoc = X.LocalRow( sendRows[s] );
+            for( Int t=0; t<b; ++t )
+                sendVals[s*b+t] = XBuf[iLoc+t*ldX];
+        }
+        for( size_t q=0; q<haloSizes.size(); ++q )
+        {
+            sendSizes[q] *= b;
+            sendOffs[q] *= b;
+            haloSizes[q] *= b;
+            haloOffs[q] *= b;
+        }
+        mpi::AllToAll
+        ( sendVals.data(), sendSizes.data(), sendOffs.data(),
+          haloVals.data(), haloSizes.data(), haloOffs.data(), colComm );
+
+        if( b > 0 )
+            MultiplyCSRInterX
+            ( NORMAL, Y.LocalHeight(), numHalo, b,
+              alpha, offsets.data(),
+                     cols.data(),
+                     vals.data(),
+                     haloVals.data(),
+              T(1),  Y.Buffer(), Y.LDim() );
+    }
+    else
+    {
+        RowsToProcessRows( A, X, offsets, cols, vals );
+        FormHalo( Y, cols, haloRows, haloSizes, haloOffs );
+        const Int numHalo = haloRows.size();
+
+        // Form the (interleaved) updates to the referenced rows of Y
+        vector<T> haloVals( numHalo*b, T(0) );
+        if( b > 0 )
+            MultiplyCSRInterY
+            ( orientation, X.LocalHeight(), numHalo, b,
+              alpha, offsets.data(),
+                     cols.data(),
+                     vals.data(),
+                     X.LockedBuffer(), X.LDim(),
+              T(1),  haloVals.data() );
+
+        // Send the updates to the owners of the rows of Y
+        vector<int> recvSizes(haloSizes.size()), recvOffs;
+        mpi::AllToAll( haloSizes.data(), 1, recvSizes.data(), 1, colComm );
+        const int numRecvRows = Scan( recvSizes, recvOffs );
+        vector<Int> recvRows(numRecvRows);
+        mpi::AllToAll
+        ( haloRows.data(), haloSizes.data(), haloOffs.data(),
+          recvRows.data(), recvSizes.data(), recvOffs.data(), colComm );
+        for( size_t q=0; q<haloSizes.size(); ++q )
+        {
+            recvSizes[q] *= b;
+            recvOffs[q] *= b;
+            haloSizes[q] *= b;
+            haloOffs[q] *= b;
+        }
+        vector<T> recvVals;
+        FastResize( recvVals, numRecvRows*b );
+        mpi::AllToAll
+        ( haloVals.data(), haloSizes.data(), haloOffs.data(),
+          recvVals.data(), recvSizes.data(), recvOffs.data(), colComm );
+
+        T* YBuf = Y.Buffer();
+        const Int ldY = Y.LDim();
+        for( Int s=0; s<numRecvRows; ++s )
+        {
+            const Int iLoc = Y.LocalRow( recvRows[s] );
+            for( Int t=0; t<b; ++t )
+                YBuf[iLoc+t*ldY] += recvVals[s*b+t];
+        }
+    }
+}
+
 #define PROTO(T) \
     template void Multiply \
     ( Orientation orientation, \
@@ -703,6 +1263,13 @@ void Multiply
             T beta, \
             Matrix<T>& Y ); \
     template void Multiply \
+    ( Orientation orientation, \
+            T alpha, \
+      const BlockSparseMatrix<T>& A, \
+      const Matrix<T>& X, \
+            T beta, \
+            Matrix<T>& Y ); \
+    template void Multiply \
     ( Orientation orientation, \
             T alpha, \
       const Graph& A, \
@@ -715,7 +1282,14 @@ void Multiply
       const DistSparseMatrix<T>& A, \
       const DistMultiVec<T>& X, \
             T beta, \
-            DistMultiVec<T>& Y );
+            DistMultiVec<T>& Y ); \
+    template void Multiply \
+    ( Orientation orientation, \
+            T alpha, \
+      const DistSparseMatrix<T>& A, \
+      const AbstractDistMatrix<T>& X, \
+            T beta, \
+            AbstractDistMatrix<T>& Y );
 
 #define EL_ENABLE_DOUBLEDOUBLE
 #define EL_ENABLE_QUADDOUBLE
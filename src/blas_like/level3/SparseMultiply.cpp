@@ -0,0 +1,346 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El-lite.hpp>
+#include <El/blas_like/level1.hpp>
+#include <El/blas_like/level3.hpp>
+
+namespace El {
+
+namespace {
+
+// Apply 'rowFunc(i,marker,accum)' to each of the rows with per-thread dense
+// workspaces of length n, where 'marker' is initialized to -1
+template<typename T,class RowFunction>
+void ForEachRow( Int numRows, Int n, Int work, const RowFunction& rowFunc )
+{
+#ifdef EL_HYBRID
+    #pragma omp parallel if(ParallelizeLoop(work))
+    {
+        vector<Int> marker(n,-1);
+        vector<T> accum(n);
+        #pragma omp for schedule(dynamic,64)
+        for( Int i=0; i<numRows; ++i )
+            rowFunc( i, marker, accum );
+    }
+#else
+    vector<Int> marker(n,-1);
+    vector<T> accum(n);
+    for( Int i=0; i<numRows; ++i )
+        rowFunc( i, marker, accum );
+#endif
+}
+
+// Gustavson's algorithm for C := alpha A B, where the columns of A index the
+// rows of B and C has n columns. A symbolic pass first counts the nonzeros
+// of each row of C so that the numeric pass can write directly into place.
+// If 'onlyLower' is true, then only the entries of row i of C which lie in
+// columns at most firstRow+i are formed.
+template<typename T>
+void LocalSparseMultiply
+( Int numRows, Int n, T alpha,
+  const Int* AOffsets, const Int* ACols, const T* AVals,
+  const Int* BOffsets, const Int* BCols, const T* BVals,
+  bool onlyLower, Int firstRow,
+  vector<Int>& COffsets, vector<Int>& CCols, vector<T>& CVals )
+{
+    EL_DEBUG_CSE
+    Int work = 0;
+    for( Int e=0; e<AOffsets[numRows]; ++e )
+        work += BOffsets[ACols[e]+1] - BOffsets[ACols[e]];
+
+    // Count the nonzeros of each row of C
+    // ===================================
+    COffsets.assign( numRows+1, 0 );
+    auto symbolic = [&]( Int i, vector<Int>& marker, vector<T>& )
+    {
+        const Int jMax = ( onlyLower ? firstRow+i : n-1 );
+        Int numNonzeros = 0;
+        for( Int e=AOffsets[i]; e<AOffsets[i+1]; ++e )
+        {
+            const Int k = ACols[e];
+            for( Int f=BOffsets[k]; f<BOffsets[k+1]; ++f )
+            {
+                const Int j = BCols[f];
+                if( j <= jMax && marker[j] != i )
+                {
+                    marker[j] = i;
+                    ++numNonzeros;
+                }
+            }
+        }
+        COffsets[i+1] = numNonzeros;
+    };
+    ForEachRow<T>( numRows, n, work, symbolic );
+    for( Int i=0; i<numRows; ++i )
+        COffsets[i+1] += COffsets[i];
+
+    // Accumulate each row of C into a dense workspace
+    // ===============================================
+    const Int numNonzeros = COffsets[numRows];
+    CCols.resize( numNonzeros );
+    CVals.resize( numNonzeros );
+    auto numeric = [&]( Int i, vector<Int>& marker, vector<T>& accum )
+    {
+        const Int jMax = ( onlyLower ? firstRow+i : n-1 );
+        Int off = COffsets[i];
+        for( Int e=AOffsets[i]; e<AOffsets[i+1]; ++e )
+        {
+            const Int k = ACols[e];
+            const T alphaA = alpha*AVals[e];
+            for( Int f=BOffsets[k]; f<BOffsets[k+1]; ++f )
+            {
+                const Int j = BCols[f];
+                if( j > jMax )
+                    continue;
+                if( marker[j] != i )
+                {
+                    marker[j] = i;
+                    accum[j] = alphaA*BVals[f];
+                    CCols[off++] = j;
+                }
+                else
+                    accum[j] += alphaA*BVals[f];
+            }
+        }
+        std::sort( CCols.begin()+COffsets[i], CCols.begin()+COffsets[i+1] );
+        for( Int p=COffsets[i]; p<COffsets[i+1]; ++p )
+            CVals[p] = accum[CCols[p]];
+    };
+    ForEachRow<T>( numRows, n, work, numeric );
+}
+
+} // anonymous namespace
+
+template<typename T>
+void SparseMultiply
+( Orientation orientA,
+  T alpha, const SparseMatrix<T>& A, const SparseMatrix<T>& B,
+                 SparseMatrix<T>& C, bool onlyLower )
+{
+    EL_DEBUG_CSE
+    if( orientA != NORMAL )
+    {
+        SparseMatrix<T> AOp;
+        Transpose( A, AOp, orientA == ADJOINT );
+        SparseMultiply( NORMAL, alpha, AOp, B, C, onlyLower );
+        return;
+    }
+    if( A.Width() != B.Height() )
+        LogicError
+        ("Nonconformal SparseMultiply of ",A.Height()," x ",A.Width(),
+         " and ",B.Height()," x ",B.Width()," matrices");
+    const Int m = A.Height();
+    const Int n = B.Width();
+
+    vector<Int> COffsets, CCols;
+    vector<T> CVals;
+    LocalSparseMultiply
+    ( m, n, alpha,
+      A.LockedOffsetBuffer(), A.LockedTargetBuffer(), A.LockedValueBuffer(),
+      B.LockedOffsetBuffer(), B.LockedTargetBuffer(), B.LockedValueBuffer(),
+      onlyLower, Int(0), COffsets, CCols, CVals );
+
+    C.Resize( m, n );
+    Zero( C );
+    const Int numEntries = COffsets[m];
+    C.ForceNumEntries( numEntries );
+    Int* CSourceBuf = C.SourceBuffer();
+    Int* CTargetBuf = C.TargetBuffer();
+    Int* COffsetBuf = C.OffsetBuffer();
+    T* CValBuf = C.ValueBuffer();
+    for( Int i=0; i<m; ++i )
+    {
+        COffsetBuf[i] = COffsets[i];
+        for( Int e=COffsets[i]; e<COffsets[i+1]; ++e )
+            CSourceBuf[e] = i;
+    }
+    COffsetBuf[m] = numEntries;
+    std::copy( CCols.begin(), CCols.end(), CTargetBuf );
+    std::copy( CVals.begin(), CVals.end(), CValBuf );
+    C.ForceConsistency();
+}
+
+template<typename T>
+void SparseMultiply
+( Orientation orientA,
+  T alpha, const DistSparseMatrix<T>& A, const DistSparseMatrix<T>& B,
+                 DistSparseMatrix<T>& C, bool onlyLower )
+{
+    EL_DEBUG_CSE
+    if( orientA != NORMAL )
+    {
+        DistSparseMatrix<T> AOp(A.Grid());
+        Transpose( A, AOp, orientA == ADJOINT );
+        SparseMultiply( NORMAL, alpha, AOp, B, C, onlyLower );
+        return;
+    }
+    if( A.Width() != B.Height() )
+        LogicError
+        ("Nonconformal SparseMultiply of ",A.Height()," x ",A.Width(),
+         " and ",B.Height()," x ",B.Width()," matrices");
+    if( !mpi::Congruent( A.Grid().Comm(), B.Grid().Comm() ) )
+        LogicError("Communicators of A and B must match");
+    mpi::Comm comm = A.Grid().Comm();
+    const int commSize = A.Grid().Size();
+    const Int m = A.Height();
+    const Int n = B.Width();
+
+    // Fetch the rows of B referenced by the local columns of A
+    // ========================================================
+    // The rows of B are distributed like the entries of a DistMultiVec
+    // which A could be applied to, so the multiplication metadata of A
+    // describes exactly which rows must be exchanged.
+    const auto& meta = A.InitializeMultMeta();
+    const Int numSendRows = meta.sendInds.size();
+    const Int numRecvRows = meta.numRecvInds;
+    const Int firstLocalRowB = B.FirstLocalRow();
+    vector<Int> sendRowSizes(numSendRows);
+    vector<int> sendCounts(commSize,0);
+    for( int q=0; q<commSize; ++q )
+        for( Int s=meta.sendOffs[q]; s<meta.sendOffs[q]+meta.sendSizes[q];
+             ++s )
+        {
+            sendRowSizes[s] =
+              B.NumConnections( meta.sendInds[s]-firstLocalRowB );
+            sendCounts[q] += sendRowSizes[s];
+        }
+    vector<Int> recvRowSizes(numRecvRows);
+    mpi::AllToAll
+    ( sendRowSizes.data(), meta.sendSizes.data(), meta.sendOffs.data(),
+      recvRowSizes.data(), meta.recvSizes.data(), meta.recvOffs.data(),
+      comm );
+
+    vector<int> sendOffs;
+    const int totalSend = Scan( sendCounts, sendOffs );
+    vector<Int> sendCols(totalSend);
+    vector<T> sendVals(totalSend);
+    {
+        const Int* BColBuf = B.LockedTargetBuffer();
+        const T* BValBuf = B.LockedValueBuffer();
+        Int off = 0;
+        for( Int s=0; s<numSendRows; ++s )
+        {
+            const Int eBeg = B.RowOffset( meta.sendInds[s]-firstLocalRowB );
+            for( Int e=eBeg; e<eBeg+sendRowSizes[s]; ++e )
+            {
+                sendCols[off] = BColBuf[e];
+                sendVals[off] = BValBuf[e];
+                ++off;
+            }
+        }
+    }
+    vector<int> recvCounts(commSize,0);
+    for( int q=0; q<commSize; ++q )
+        for( Int s=meta.recvOffs[q]; s<meta.recvOffs[q]+meta.recvSizes[q];
+             ++s )
+            recvCounts[q] += recvRowSizes[s];
+    vector<int> recvOffs;
+    const int totalRecv = Scan( recvCounts, recvOffs );
+    vector<Int> haloCols(totalRecv);
+    vector<T> haloVals(totalRecv);
+    mpi::AllToAll
+    ( sendCols.data(), sendCounts.data(), sendOffs.data(),
+      haloCols.data(), recvCounts.data(), recvOffs.data(), comm );
+    mpi::AllToAll
+    ( sendVals.data(), sendCounts.data(), sendOffs.data(),
+      haloVals.data(), recvCounts.data(), recvOffs.data(), comm );
+    SwapClear( sendCols );
+    SwapClear( sendVals );
+
+    // The received rows are ordered consistently with meta.colOffs
+    vector<Int> haloOffsets(numRecvRows+1,0);
+    for( Int s=0; s<numRecvRows; ++s )
+        haloOffsets[s+1] = haloOffsets[s] + recvRowSizes[s];
+
+    // Form the local rows of C
+    // ========================
+    const Int localHeight = A.LocalHeight();
+    const Int firstLocalRow = A.FirstLocalRow();
+    vector<Int> COffsets, CCols;
+    vector<T> CVals;
+    LocalSparseMultiply
+    ( localHeight, n, alpha,
+      A.LockedOffsetBuffer(), meta.colOffs.data(), A.LockedValueBuffer(),
+      haloOffsets.data(), haloCols.data(), haloVals.data(),
+      onlyLower, firstLocalRow, COffsets, CCols, CVals );
+
+    C.SetGrid( A.Grid() );
+    C.Resize( m, n );
+    Zero( C );
+    const Int numLocalEntries = COffsets[localHeight];
+    C.ForceNumLocalEntries( numLocalEntries );
+    Int* CSourceBuf = C.SourceBuffer();
+    Int* CTargetBuf = C.TargetBuffer();
+    Int* COffsetBuf = C.OffsetBuffer();
+    T* CValBuf = C.ValueBuffer();
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+    {
+        COffsetBuf[iLoc] = COffsets[iLoc];
+        for( Int e=COffsets[iLoc]; e<COffsets[iLoc+1]; ++e )
+            CSourceBuf[e] = firstLocalRow + iLoc;
+    }
+    COffsetBuf[localHeight] = numLocalEntries;
+    std::copy( CCols.begin(), CCols.end(), CTargetBuf );
+    std::copy( CVals.begin(), CVals.end(), CValBuf );
+    C.ForceConsistency();
+}
+
+template<typename T>
+void ADAT
+( const SparseMatrix<T>& A, const Matrix<T>& d,
+        SparseMatrix<T>& C, bool conjugate, bool onlyLower )
+{
+    EL_DEBUG_CSE
+    if( d.Height() != A.Width() || d.Width() != 1 )
+        LogicError("d must be a column vector of length A.Width()");
+    // (D op(A)) is formed directly from the rows of op(A)
+    SparseMatrix<T> DAT;
+    Transpose( A, DAT, conjugate );
+    DiagonalScale( LEFT, NORMAL, d, DAT );
+    SparseMultiply( NORMAL, T(1), A, DAT, C, onlyLower );
+}
+
+template<typename T>
+void ADAT
+( const DistSparseMatrix<T>& A, const DistMultiVec<T>& d,
+        DistSparseMatrix<T>& C, bool conjugate, bool onlyLower )
+{
+    EL_DEBUG_CSE
+    if( d.Height() != A.Width() || d.Width() != 1 )
+        LogicError("d must be a column vector of length A.Width()");
+    DistSparseMatrix<T> DAT(A.Grid());
+    Transpose( A, DAT, conjugate );
+    DiagonalScale( LEFT, NORMAL, d, DAT );
+    SparseMultiply( NORMAL, T(1), A, DAT, C, onlyLower );
+}
+
+#define PROTO(T) \
+  template void SparseMultiply \
+  ( Orientation orientA, \
+    T alpha, const SparseMatrix<T>& A, const SparseMatrix<T>& B, \
+                   SparseMatrix<T>& C, bool onlyLower ); \
+  template void SparseMultiply \
+  ( Orientation orientA, \
+    T alpha, const DistSparseMatrix<T>& A, const DistSparseMatrix<T>& B, \
+                   DistSparseMatrix<T>& C, bool onlyLower ); \
+  template void ADAT \
+  ( const SparseMatrix<T>& A, const Matrix<T>& d, \
+          SparseMatrix<T>& C, bool conjugate, bool onlyLower ); \
+  template void ADAT \
+  ( const DistSparseMatrix<T>& A, const DistMultiVec<T>& d, \
+          DistSparseMatrix<T>& C, bool conjugate, bool onlyLower );
+
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGINT
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
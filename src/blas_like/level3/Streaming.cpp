@@ -0,0 +1,104 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+#include "../../io/MPIFile.hpp"
+
+namespace El {
+
+template<typename T>
+void StreamingHerk
+( UpperOrLower uplo,
+  Base<T> alpha, const string& filenameA, Int height, Int width,
+  Base<T> beta,        AbstractDistMatrix<T>& C, Int panelHeight )
+{
+    EL_DEBUG_CSE
+    if( C.Height() != width || C.Width() != width )
+        LogicError
+        ("C was ",C.Height()," x ",C.Width()," but should be ",
+         width," x ",width);
+    if( panelHeight <= 0 )
+        panelHeight = Max( width, Blocksize() );
+
+    mpi_file::PanelStream<T>
+      streamA( filenameA, height, width, panelHeight, C.Grid() );
+    const Int numPanels = streamA.NumPanels();
+    if( numPanels == 0 )
+    {
+        ScaleTrapezoid( T(beta), uplo, C );
+        return;
+    }
+    streamA.Begin( 0 );
+    for( Int k=0; k<numPanels; ++k )
+    {
+        const auto& A1 = streamA.End( k );
+        if( k+1 < numPanels )
+            streamA.Begin( k+1 );
+        Herk( uplo, ADJOINT, alpha, A1, ( k==0 ? beta : Base<T>(1) ), C );
+    }
+}
+
+template<typename T>
+void StreamingGemm
+( Orientation orientA,
+  T alpha, const string& filenameA, const string& filenameB,
+  Int height, Int widthA, Int widthB,
+  T beta,        AbstractDistMatrix<T>& C, Int panelHeight )
+{
+    EL_DEBUG_CSE
+    if( orientA == NORMAL )
+        LogicError("Streaming products must contract over the rows of A");
+    if( C.Height() != widthA || C.Width() != widthB )
+        LogicError
+        ("C was ",C.Height()," x ",C.Width()," but should be ",
+         widthA," x ",widthB);
+    if( panelHeight <= 0 )
+        panelHeight = Max( Max(widthA,widthB), Blocksize() );
+
+    mpi_file::PanelStream<T>
+      streamA( filenameA, height, widthA, panelHeight, C.Grid() ),
+      streamB( filenameB, height, widthB, panelHeight, C.Grid() );
+    const Int numPanels = streamA.NumPanels();
+    if( numPanels == 0 )
+    {
+        C *= beta;
+        return;
+    }
+    streamA.Begin( 0 );
+    streamB.Begin( 0 );
+    for( Int k=0; k<numPanels; ++k )
+    {
+        const auto& A1 = streamA.End( k );
+        const auto& B1 = streamB.End( k );
+        if( k+1 < numPanels )
+        {
+            streamA.Begin( k+1 );
+            streamB.Begin( k+1 );
+        }
+        Gemm( orientA, NORMAL, alpha, A1, B1, ( k==0 ? beta : T(1) ), C );
+    }
+}
+
+#define PROTO(T) \
+  template void StreamingHerk \
+  ( UpperOrLower uplo, \
+    Base<T> alpha, const string& filenameA, Int height, Int width, \
+    Base<T> beta,        AbstractDistMatrix<T>& C, Int panelHeight ); \
+  template void StreamingGemm \
+  ( Orientation orientA, \
+    T alpha, const string& filenameA, const string& filenameB, \
+    Int height, Int widthA, Int widthB, \
+    T beta,        AbstractDistMatrix<T>& C, Int panelHeight );
+
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#include <El/macros/Instantiate.h>
+
+} // namespace El
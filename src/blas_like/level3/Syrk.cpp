@@ -14,6 +14,9 @@
 #include "./Syrk/LT.hpp"
 #include "./Syrk/UN.hpp"
 #include "./Syrk/UT.hpp"
+#include "./Syrk/Triangle.hpp"
+#include "./Gemm/Layers.hpp"
+#include "./Syrk/25D.hpp"
 
 namespace El {
 
@@ -70,10 +73,30 @@ template<typename T>
 void Syrk
 ( UpperOrLower uplo, Orientation orientation,
   T alpha, const AbstractDistMatrix<T>& A,
-  T beta,        AbstractDistMatrix<T>& C, bool conjugate )
+  T beta,        AbstractDistMatrix<T>& C, bool conjugate,
+  SyrkAlgorithm alg )
 {
     EL_DEBUG_CSE
     ScaleTrapezoid( beta, uplo, C );
+    const Grid& g = A.Grid();
+    if( alg == SYRK_TRIANGLE && !g.HaveViewers() )
+    {
+        syrk::Triangle( uplo, orientation, alpha, A, C, conjugate );
+        return;
+    }
+    if( alg == SYRK_25D && !g.HaveViewers() )
+    {
+        const Int n = C.Height();
+        const Int r = ( orientation==NORMAL ? A.Width() : A.Height() );
+        const Int numLayers = gemm::NumLayers25D<T>( g, n, n, r );
+        if( numLayers > 1 )
+        {
+            syrk::Layered
+            ( uplo, orientation, alpha, A, C, conjugate, numLayers );
+            return;
+        }
+    }
+
     if( uplo == LOWER && orientation == NORMAL )
         syrk::LN( alpha, A, C, conjugate );
     else if( uplo == LOWER )
@@ -88,13 +111,14 @@ template<typename T>
 void Syrk
 ( UpperOrLower uplo, Orientation orientation,
   T alpha, const AbstractDistMatrix<T>& A,
-                 AbstractDistMatrix<T>& C, bool conjugate )
+                 AbstractDistMatrix<T>& C, bool conjugate,
+  SyrkAlgorithm alg )
 {
     EL_DEBUG_CSE
     const Int n = ( orientation==NORMAL ? A.Height() : A.Width() );
     C.Resize( n, n );
     Zero( C );
-    Syrk( uplo, orientation, alpha, A, T(0), C, conjugate );
+    Syrk( uplo, orientation, alpha, A, T(0), C, conjugate, alg );
 }
 
 template<typename T>
@@ -278,11 +302,12 @@ void Syrk
   template void Syrk \
   ( UpperOrLower uplo, Orientation orientation, \
     T alpha, const AbstractDistMatrix<T>& A, \
-    T beta, AbstractDistMatrix<T>& C, bool conjugate ); \
+    T beta, AbstractDistMatrix<T>& C, bool conjugate, SyrkAlgorithm alg ); \
   template void Syrk \
   ( UpperOrLower uplo, Orientation orientation, \
     T alpha, const AbstractDistMatrix<T>& A, \
-                   AbstractDistMatrix<T>& C, bool conjugate ); \
+                   AbstractDistMatrix<T>& C, bool conjugate, \
+    SyrkAlgorithm alg ); \
   template void Syrk \
   ( UpperOrLower uplo, Orientation orientation, \
     T alpha, const SparseMatrix<T>& A, \
@@ -0,0 +1,81 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+
+namespace El {
+namespace syrk {
+
+// 2.5D (replicated-depth) Syrk/Herk
+//
+// As with GEMM_25D, the process grid is split into 'numLayers' layers which
+// each receive a contiguous portion of the summation dimension of A and
+// update their own copy of the triangle of C; the layer contributions are
+// then summed into the triangle of C.
+template<typename T>
+void Layered
+( UpperOrLower uplo, Orientation orientation,
+  T alpha, const AbstractDistMatrix<T>& APre, AbstractDistMatrix<T>& CPre,
+  bool conjugate, Int numLayers )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(AssertSameGrids( APre, CPre ))
+    const Grid& g = CPre.Grid();
+    const Int n = CPre.Height();
+    const Int r = ( orientation==NORMAL ? APre.Width() : APre.Height() );
+    const Grid3D& grid3D = gemm::LayerGrids( g, numLayers );
+    const Int myLayer = grid3D.Layer();
+
+    DistMatrixReadProxy<T,T,MC,MR> AProx( APre );
+    DistMatrixReadWriteProxy<T,T,MC,MR> CProx( CPre );
+    auto& A = AProx.GetLocked();
+    auto& C = CProx.Get();
+
+    // Replicate each portion of the summation dimension onto its layer
+    const Grid& myGrid = grid3D.MyLayerGrid();
+    DistMatrix<T> ALayer(myGrid);
+    for( Int layer=0; layer<numLayers; ++layer )
+    {
+        const Range<Int> ind1
+        ( (layer*r)/numLayers, ((layer+1)*r)/numLayers );
+        auto A1 = ( orientation==NORMAL ? A(ALL,ind1) : A(ind1,ALL) );
+        if( layer == myLayer )
+        {
+            Copy( A1, ALayer );
+        }
+        else
+        {
+            DistMatrix<T> AOther(grid3D.LayerGrid(layer));
+            Copy( A1, AOther );
+        }
+    }
+
+    // Form the contribution from our layer
+    DistMatrix<T> CLayer(myGrid);
+    Syrk( uplo, orientation, alpha, ALayer, CLayer, conjugate );
+    ALayer.Empty();
+
+    // Sum the layer contributions onto the first layer over the depth
+    // communicator and then add the result into C
+    gemm::SumOverDepth( grid3D, CLayer );
+    DistMatrix<T> CSummand(g);
+    CSummand.AlignWith( C );
+    if( myLayer == 0 )
+    {
+        Copy( CLayer, CSummand );
+    }
+    else
+    {
+        DistMatrix<T> CFirst(grid3D.LayerGrid(0));
+        CFirst.Resize( n, n );
+        Copy( CFirst, CSummand );
+    }
+    AxpyTrapezoid( uplo, T(1), CSummand, C );
+}
+
+} // namespace syrk
+} // namespace El
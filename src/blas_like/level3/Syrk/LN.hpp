@@ -19,8 +19,8 @@ void LN_C
 {
     EL_DEBUG_CSE
     const Int r = APre.Width();
-    const Int bsize = Blocksize();
     const Grid& g = APre.Grid();
+    const Int bsize = Blocksize<T>( BLOCKSIZE_HERK, g );
 
     DistMatrixReadProxy<T,T,MC,MR> AProx( APre );
     DistMatrixReadWriteProxy<T,T,MC,MR> CProx( CPre );
@@ -56,8 +56,8 @@ void LNDot
 {
     EL_DEBUG_CSE
     const Int r = APre.Width();
-    const Int bsize = Blocksize();
     const Grid& g = APre.Grid();
+    const Int bsize = Blocksize<T>( BLOCKSIZE_HERK, g );
 
     DistMatrixReadProxy<T,T,MC,MR> AProx( APre );
     DistMatrixReadWriteProxy<T,T,MC,MR> CProx( CPre );
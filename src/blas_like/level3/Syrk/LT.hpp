@@ -19,8 +19,8 @@ void LT_C
 {
     EL_DEBUG_CSE
     const Int r = APre.Height();
-    const Int bsize = Blocksize();
     const Grid& g = APre.Grid();
+    const Int bsize = Blocksize<T>( BLOCKSIZE_HERK, g );
     const Orientation orientation = ( conjugate ? ADJOINT : TRANSPOSE );
 
     DistMatrixReadProxy<T,T,MC,MR> AProx( APre );
@@ -0,0 +1,256 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+
+namespace El {
+namespace syrk {
+
+// The rows [i0,i1) of the J'th column block of the lower triangle
+struct TriangleSegment
+{
+    Int J, i0, i1;
+};
+
+// The lower triangle of an n x n matrix is split into column blocks of width
+// 'bsize', the rows of each column block (restricted to the triangle) are
+// concatenated, and the resulting sequence is cut into 'numProcs' contiguous
+// pieces which each contain (to within a row) n(n+1)/(2 numProcs) entries
+inline vector<vector<TriangleSegment>>
+TrianglePartition( Int n, Int bsize, Int numProcs )
+{
+    EL_DEBUG_CSE
+    vector<vector<TriangleSegment>> segments( numProcs );
+    const double totalEntries = double(n)*(n+1)/2;
+    double numEntries = 0;
+    for( Int c0=0, J=0; c0<n; c0+=bsize, ++J )
+    {
+        const Int width = Min(bsize,n-c0);
+        for( Int i=c0; i<n; ++i )
+        {
+            const Int owner =
+              Min( numProcs-1, Int(numEntries*numProcs/totalEntries) );
+            auto& ownerSegments = segments[owner];
+            if( !ownerSegments.empty() &&
+                ownerSegments.back().J == J && ownerSegments.back().i1 == i )
+                ++ownerSegments.back().i1;
+            else
+                ownerSegments.push_back( TriangleSegment{J,i,i+1} );
+            numEntries += Min(i-c0+1,width);
+        }
+    }
+    return segments;
+}
+
+// The sorted, disjoint ranges of rows of the factor needed by the segments
+inline vector<Range<Int>>
+SegmentRows( const vector<TriangleSegment>& segments, Int n, Int bsize )
+{
+    EL_DEBUG_CSE
+    vector<Range<Int>> ranges;
+    for( const auto& segment : segments )
+    {
+        const Int c0 = segment.J*bsize;
+        const Int c1 = Min(c0+bsize,n);
+        ranges.push_back( Range<Int>(segment.i0,segment.i1) );
+        ranges.push_back( Range<Int>(c0,Min(c1,segment.i1)) );
+    }
+    std::sort
+    ( ranges.begin(), ranges.end(),
+      []( const Range<Int>& a, const Range<Int>& b )
+      { return a.beg < b.beg; } );
+    vector<Range<Int>> merged;
+    for( const auto& range : ranges )
+    {
+        if( !merged.empty() && range.beg <= merged.back().end )
+            merged.back().end = Max( merged.back().end, range.end );
+        else
+            merged.push_back( range );
+    }
+    return merged;
+}
+
+// Triangle-aware Syrk/Herk
+//
+// Since only one triangle of C is updated, the [MC,MR] variants perform
+// roughly half of their local flops (and gather half of their panels) in
+// vain, and the useful work is unevenly divided on non-square grids. Here
+// the (lower) triangle is instead cut into p contiguous pieces with equal
+// numbers of entries (see TrianglePartition) whose column blocks have width
+// n/sqrt(2p). Each process gathers the O(n/sqrt(p)) rows of op(A) which its
+// piece depends upon, computes exactly its entries of the triangle, and the
+// results are pushed into C (with UPPER storing the (conjugate-)transpose).
+template<typename T>
+void Triangle
+( UpperOrLower uplo, Orientation orientation,
+  T alpha, const AbstractDistMatrix<T>& A, AbstractDistMatrix<T>& C,
+  bool conjugate=false )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(AssertSameGrids( A, C ))
+    const Grid& g = A.Grid();
+    const Int n = C.Height();
+    const Int r = ( orientation==NORMAL ? A.Width() : A.Height() );
+    if( n == 0 || r == 0 )
+        return;
+    const Orientation orient = ( conjugate ? ADJOINT : TRANSPOSE );
+
+    // Form the n x r matrix B with C := C + alpha B op(B), where the rows of
+    // B are distributed cyclically over the VC communicator
+    DistMatrix<T,VC,STAR> B(g);
+    B.Align( 0, 0 );
+    if( orientation == NORMAL )
+        B = A;
+    else
+        Transpose( A, B, conjugate );
+    const Int p = B.ColStride();
+    const Int myRank = B.ColRank();
+    const Int bsize = Max( Int(1), Int(n/Sqrt(2.*p)) );
+    const auto segments = TrianglePartition( n, bsize, p );
+
+    // Gather the rows of B needed by our piece of the triangle
+    vector<vector<Range<Int>>> neededRows( p );
+    for( Int q=0; q<p; ++q )
+        neededRows[q] = SegmentRows( segments[q], n, bsize );
+    const auto& myRanges = neededRows[myRank];
+    const Int myShift = B.ColShift();
+    vector<int> sendCounts(p,0), recvCounts(p,0);
+    for( Int q=0; q<p; ++q )
+    {
+        const Int qShift = Shift( q, B.ColAlign(), p );
+        for( const auto& range : neededRows[q] )
+            sendCounts[q] +=
+              (Length_(range.end,myShift,p)-Length_(range.beg,myShift,p))*r;
+        for( const auto& range : myRanges )
+            recvCounts[q] +=
+              (Length_(range.end,qShift,p)-Length_(range.beg,qShift,p))*r;
+    }
+    vector<int> sendOffs, recvOffs;
+    const int totalSend = Scan( sendCounts, sendOffs );
+    const int totalRecv = Scan( recvCounts, recvOffs );
+
+    const auto& BLoc = B.LockedMatrix();
+    vector<T> sendBuf, recvBuf;
+    FastResize( sendBuf, totalSend );
+    FastResize( recvBuf, totalRecv );
+    for( Int q=0, offset=0; q<p; ++q )
+    {
+        for( const auto& range : neededRows[q] )
+        {
+            const Int first = range.beg + Mod(myShift-range.beg,p);
+            for( Int i=first; i<range.end; i+=p )
+            {
+                const Int iLoc = (i-myShift)/p;
+                for( Int k=0; k<r; ++k )
+                    sendBuf[offset++] = BLoc(iLoc,k);
+            }
+        }
+    }
+    mpi::AllToAll
+    ( sendBuf.data(), sendCounts.data(), sendOffs.data(),
+      recvBuf.data(), recvCounts.data(), recvOffs.data(), B.ColComm() );
+    SwapClear( sendBuf );
+
+    Int numNeeded = 0;
+    vector<Int> rangeOffsets;
+    for( const auto& range : myRanges )
+    {
+        rangeOffsets.push_back( numNeeded );
+        numNeeded += range.end - range.beg;
+    }
+    Matrix<T> BNeeded( numNeeded, r );
+    for( Int q=0, offset=0; q<p; ++q )
+    {
+        const Int qShift = Shift( q, B.ColAlign(), p );
+        for( Int s=0; s<Int(myRanges.size()); ++s )
+        {
+            const auto& range = myRanges[s];
+            const Int first = range.beg + Mod(qShift-range.beg,p);
+            for( Int i=first; i<range.end; i+=p )
+            {
+                const Int iNeeded = rangeOffsets[s] + (i-range.beg);
+                for( Int k=0; k<r; ++k )
+                    BNeeded(iNeeded,k) = recvBuf[offset++];
+            }
+        }
+    }
+    SwapClear( recvBuf );
+    B.Empty();
+
+    // Returns a view of the rows [beg,end) of B (which lie within one range)
+    auto BRows = [&]( Int beg, Int end ) -> Matrix<T>
+    {
+        Int s = 0;
+        while( myRanges[s].end < end )
+            ++s;
+        const Int off = rangeOffsets[s] + (beg-myRanges[s].beg);
+        return BNeeded( IR(off,off+end-beg), ALL );
+    };
+
+    // Queue the entries of Z, which begins at C(iOff,jOff)
+    Matrix<T> Z;
+    auto queueBlock = [&]( Int iOff, Int jOff, bool lowerOnly )
+    {
+        const Int height = Z.Height();
+        const Int width = Z.Width();
+        for( Int j=0; j<width; ++j )
+        {
+            for( Int i=(lowerOnly ? j : 0); i<height; ++i )
+            {
+                const T value = Z(i,j);
+                if( uplo == LOWER )
+                    C.QueueUpdate( iOff+i, jOff+j, value );
+                else
+                    C.QueueUpdate
+                    ( jOff+j, iOff+i, conjugate ? Conj(value) : value );
+            }
+        }
+    };
+
+    Int numUpdates = 0;
+    for( const auto& segment : segments[myRank] )
+    {
+        const Int c0 = segment.J*bsize;
+        const Int width = Min(bsize,n-c0);
+        for( Int i=segment.i0; i<segment.i1; ++i )
+            numUpdates += Min(i-c0+1,width);
+    }
+    C.Reserve( numUpdates );
+
+    // Row i of a segment of the J'th column block needs columns
+    // [c0,min(c1,i+1)), which we split into a rectangle to the left of the
+    // first row's diagonal, a triangle, and a rectangle below the triangle
+    for( const auto& segment : segments[myRank] )
+    {
+        const Int i0 = segment.i0;
+        const Int i1 = segment.i1;
+        const Int c0 = segment.J*bsize;
+        const Int c1 = Min(c0+bsize,n);
+
+        const Int jEnd = Min(c1,i0);
+        if( jEnd > c0 )
+        {
+            Gemm( NORMAL, orient, alpha, BRows(i0,i1), BRows(c0,jEnd), Z );
+            queueBlock( i0, c0, false );
+        }
+        if( i0 < c1 )
+        {
+            const Int d = Min(i1,c1);
+            Syrk( LOWER, NORMAL, alpha, BRows(i0,d), Z, conjugate );
+            queueBlock( i0, i0, true );
+            if( i1 > d )
+            {
+                Gemm( NORMAL, orient, alpha, BRows(d,i1), BRows(i0,c1), Z );
+                queueBlock( d, i0, false );
+            }
+        }
+    }
+    C.ProcessQueues();
+}
+
+} // namespace syrk
+} // namespace El
@@ -18,6 +18,7 @@
 #include "./Trsm/RLT.hpp"
 #include "./Trsm/RUN.hpp"
 #include "./Trsm/RUT.hpp"
+#include "./Trsm/Replicated.hpp"
 
 namespace El {
 
@@ -76,6 +77,7 @@ void Trsm
   bool checkIfSingular, TrsmAlgorithm alg )
 {
     EL_DEBUG_CSE
+    EL_PROFILE_REGION("Trsm");
     EL_DEBUG_ONLY(
       AssertSameGrids( A, B );
       if( A.Height() != A.Width() )
@@ -109,6 +111,16 @@ void Trsm
     }
     */
 
+    // Replicate the triangle if it is no larger than each process's share of
+    // the right-hand sides
+    if( alg == TRSM_REPLICATED ||
+        (alg == TRSM_DEFAULT && trsm::PreferReplicated( side, A, B )) )
+    {
+        trsm::Replicated
+        ( side, uplo, orientation, diag, A, B, checkIfSingular );
+        return;
+    }
+
     const Int p = B.Grid().Size();
     if( side == LEFT && uplo == LOWER )
     {
@@ -374,6 +386,95 @@ void Trsm
     }
 }
 
+namespace trsm {
+
+template<typename F,typename=EnableIf<IsBlasScalar<F>>>
+void ScaLAPACKHelper
+( LeftOrRight side,
+  UpperOrLower uplo,
+  Orientation orientation,
+  UnitOrNonUnit diag,
+  F alpha,
+  const DistMatrix<F,MC,MR,BLOCK>& A,
+        DistMatrix<F,MC,MR,BLOCK>& B )
+{
+    AssertScaLAPACKSupport();
+#ifdef EL_HAVE_SCALAPACK
+    const Int m = B.Height();
+    const Int n = B.Width();
+    const char sideChar = LeftOrRightToChar( side );
+    const char uploChar = UpperOrLowerToChar( uplo );
+    const char orientChar = OrientationToChar( orientation );
+    const char diagChar = UnitOrNonUnitToChar( diag );
+
+    auto descA = FillDesc( A );
+    auto descB = FillDesc( B );
+    pblas::Trsm
+    ( sideChar, uploChar, orientChar, diagChar, m, n,
+      alpha, A.LockedBuffer(), descA.data(), B.Buffer(), descB.data() );
+#endif
+}
+
+template<typename F,typename=DisableIf<IsBlasScalar<F>>,typename=void>
+void ScaLAPACKHelper
+( LeftOrRight side,
+  UpperOrLower uplo,
+  Orientation orientation,
+  UnitOrNonUnit diag,
+  F alpha,
+  const DistMatrix<F,MC,MR,BLOCK>& A,
+        DistMatrix<F,MC,MR,BLOCK>& B )
+{
+    LogicError("ScaLAPACK does not support this datatype");
+}
+
+} // namespace trsm
+
+// Block-cyclic matrices are solved against in place by PBLAS when possible
+// and otherwise redistributed to and from the elemental algorithms
+template<typename F>
+void Trsm
+( LeftOrRight side,
+  UpperOrLower uplo,
+  Orientation orientation,
+  UnitOrNonUnit diag,
+  F alpha,
+  const DistMatrix<F,MC,MR,BLOCK>& A,
+        DistMatrix<F,MC,MR,BLOCK>& B,
+  bool checkIfSingular )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(AssertSameGrids( A, B ))
+#ifdef EL_HAVE_SCALAPACK
+    const bool uncut =
+      A.ColCut() == 0 && A.RowCut() == 0 &&
+      B.ColCut() == 0 && B.RowCut() == 0;
+    if( IsBlasScalar<F>::value && uncut )
+    {
+        if( checkIfSingular && diag != UNIT )
+        {
+            // Each diagonal entry is owned by a single process
+            int singular = 0;
+            const Int localWidth = A.LocalWidth();
+            for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+            {
+                const Int j = A.GlobalCol(jLoc);
+                if( A.IsLocalRow(j) && A.GetLocal(A.LocalRow(j),jLoc) == F(0) )
+                    singular = 1;
+            }
+            if( mpi::AllReduce( singular, mpi::MAX, A.DistComm() ) )
+                throw SingularMatrixException();
+        }
+        trsm::ScaLAPACKHelper( side, uplo, orientation, diag, alpha, A, B );
+        return;
+    }
+#endif
+    const AbstractDistMatrix<F>& AAbs = A;
+    AbstractDistMatrix<F>& BAbs = B;
+    Trsm
+    ( side, uplo, orientation, diag, alpha, AAbs, BAbs, checkIfSingular );
+}
+
 template<typename F>
 void LocalTrsm
 ( LeftOrRight side,
@@ -417,6 +518,15 @@ void LocalTrsm
           AbstractDistMatrix<F>& B, \
     bool checkIfSingular, \
     TrsmAlgorithm alg ); \
+  template void Trsm \
+  ( LeftOrRight side, \
+    UpperOrLower uplo, \
+    Orientation orientation, \
+    UnitOrNonUnit diag, \
+    F alpha, \
+    const DistMatrix<F,MC,MR,BLOCK>& A, \
+          DistMatrix<F,MC,MR,BLOCK>& B, \
+    bool checkIfSingular ); \
   template void LocalTrsm \
   ( LeftOrRight side, \
     UpperOrLower uplo, \
@@ -24,8 +24,8 @@ void LLNLarge
 {
     EL_DEBUG_CSE
     const Int m = XPre.Height();
-    const Int bsize = Blocksize();
     const Grid& g = LPre.Grid();
+    const Int bsize = Blocksize<F>( BLOCKSIZE_TRSM, g );
 
     DistMatrixReadProxy<F,F,MC,MR> LProx( LPre );
     DistMatrixReadWriteProxy<F,F,MC,MR> XProx( XPre );
@@ -33,11 +33,28 @@ void LLNLarge
     auto& X = XProx.Get();
 
     DistMatrix<F,STAR,STAR> L11_STAR_STAR(g);
-    DistMatrix<F,MC,  STAR> L21_MC_STAR(g);
     DistMatrix<F,STAR,MR  > X1_STAR_MR(g);
     DistMatrix<F,STAR,VR  > X1_STAR_VR(g);
 
-    for( Int k=0; k<m; k+=bsize )
+    // Since the panels of L do not depend upon X, the redistribution of the
+    // next panel of L is double-buffered so that it overlaps with the current
+    // triangular solve and update
+    DistMatrix<F,MC,STAR> L21_MC_STAR0(g), L21_MC_STAR1(g);
+    DistMatrix<F,MC,STAR>* L21_MC_STAR[2] = { &L21_MC_STAR0, &L21_MC_STAR1 };
+    CopyRequest<F> requestL[2];
+
+    auto startPanel = [&]( Int k, Int slot )
+    {
+        const Int nb = Min(bsize,m-k);
+        auto L21 = L( IR(k+nb,m), IR(k,k+nb) );
+        auto X2 = X( IR(k+nb,m), ALL );
+        L21_MC_STAR[slot]->AlignWith( X2 );
+        CopyAsync( L21, *L21_MC_STAR[slot], requestL[slot] );
+    };
+
+    if( m > 0 )
+        startPanel( 0, 0 );
+    for( Int k=0, slot=0; k<m; k+=bsize, slot=1-slot )
     {
         const Int nb = Min(bsize,m-k);
 
@@ -45,11 +62,13 @@ void LLNLarge
                          ind2( k+nb, m    );
 
         auto L11 = L( ind1, ind1 );
-        auto L21 = L( ind2, ind1 );
 
         auto X1 = X( ind1, ALL );
         auto X2 = X( ind2, ALL );
 
+        if( k+bsize < m )
+            startPanel( k+bsize, 1-slot );
+
         L11_STAR_STAR = L11; // L11[* ,* ] <- L11[MC,MR]
         X1_STAR_VR    = X1;  // X1[* ,VR] <- X1[MC,MR]
 
@@ -61,11 +80,11 @@ void LLNLarge
         X1_STAR_MR.AlignWith( X2 );
         X1_STAR_MR  = X1_STAR_VR; // X1[* ,MR]  <- X1[* ,VR]
         X1          = X1_STAR_MR; // X1[MC,MR] <- X1[* ,MR]
-        L21_MC_STAR.AlignWith( X2 );
-        L21_MC_STAR = L21;        // L21[MC,* ] <- L21[MC,MR]
+        requestL[slot].Wait();    // L21[MC,* ] <- L21[MC,MR]
         
         // X2[MC,MR] -= L21[MC,* ] X1[* ,MR]
-        LocalGemm( NORMAL, NORMAL, F(-1), L21_MC_STAR, X1_STAR_MR, F(1), X2 );
+        LocalGemm
+        ( NORMAL, NORMAL, F(-1), *L21_MC_STAR[slot], X1_STAR_MR, F(1), X2 );
     }
 }
 
@@ -79,8 +98,8 @@ void LLNMedium
 {
     EL_DEBUG_CSE
     const Int m = XPre.Height();
-    const Int bsize = Blocksize();
     const Grid& g = LPre.Grid();
+    const Int bsize = Blocksize<F>( BLOCKSIZE_TRSM, g );
 
     DistMatrixReadProxy<F,F,MC,MR> LProx( LPre );
     DistMatrixReadWriteProxy<F,F,MC,MR> XProx( XPre );
@@ -137,8 +156,8 @@ void LLNSmall
           LogicError("L and X are assumed to be aligned");
     )
     const Int m = X.Height();
-    const Int bsize = Blocksize();
     const Grid& g = L.Grid();
+    const Int bsize = Blocksize<F>( BLOCKSIZE_TRSM, g );
 
     DistMatrix<F,STAR,STAR> L11_STAR_STAR(g), X1_STAR_STAR(g);
 
@@ -31,8 +31,8 @@ void LLTLarge
           LogicError("Expected (Conjugate)Transpose option");
     )
     const Int m = XPre.Height();
-    const Int bsize = Blocksize();
     const Grid& g = LPre.Grid();
+    const Int bsize = Blocksize<F>( BLOCKSIZE_TRSM, g );
 
     DistMatrixReadProxy<F,F,MC,MR> LProx( LPre );
     DistMatrixReadWriteProxy<F,F,MC,MR> XProx( XPre );
@@ -94,8 +94,8 @@ void LLTMedium
           LogicError("Expected (Conjugate)Transpose option");
     )
     const Int m = XPre.Height();
-    const Int bsize = Blocksize();
     const Grid& g = LPre.Grid();
+    const Int bsize = Blocksize<F>( BLOCKSIZE_TRSM, g );
 
     DistMatrixReadProxy<F,F,MC,MR> LProx( LPre );
     DistMatrixReadWriteProxy<F,F,MC,MR> XProx( XPre );
@@ -164,8 +164,8 @@ void LLTSmall
           LogicError("L and X must be aligned");
     )
     const Int m = X.Height();
-    const Int bsize = Blocksize();
     const Grid& g = L.Grid();
+    const Int bsize = Blocksize<F>( BLOCKSIZE_TRSM, g );
 
     DistMatrix<F,STAR,STAR> L11_STAR_STAR(g), Z1_STAR_STAR(g);
 
@@ -217,8 +217,8 @@ void LLTSmall
           LogicError("L and X must be aligned");
     )
     const Int m = X.Height();
-    const Int bsize = Blocksize();
     const Grid& g = L.Grid();
+    const Int bsize = Blocksize<F>( BLOCKSIZE_TRSM, g );
 
     DistMatrix<F,STAR,STAR> L11_STAR_STAR(g), X1_STAR_STAR(g);
 
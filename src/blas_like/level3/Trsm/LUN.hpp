@@ -23,33 +23,52 @@ void LUNLarge
 {
     EL_DEBUG_CSE
     const Int m = XPre.Height();
-    const Int bsize = Blocksize();
     const Grid& g = UPre.Grid();
+    const Int bsize = Blocksize<F>( BLOCKSIZE_TRSM, g );
 
     DistMatrixReadProxy<F,F,MC,MR> UProx( UPre );
     DistMatrixReadWriteProxy<F,F,MC,MR> XProx( XPre );
     auto& U = UProx.GetLocked();
     auto& X = XProx.Get();
 
-    DistMatrix<F,MC,  STAR> U01_MC_STAR(g);
     DistMatrix<F,STAR,STAR> U11_STAR_STAR(g);
     DistMatrix<F,STAR,MR  > X1_STAR_MR(g);
     DistMatrix<F,STAR,VR  > X1_STAR_VR(g);
 
+    // Since the panels of U do not depend upon X, the redistribution of the
+    // next panel of U is double-buffered so that it overlaps with the current
+    // triangular solve and update
+    DistMatrix<F,MC,STAR> U01_MC_STAR0(g), U01_MC_STAR1(g);
+    DistMatrix<F,MC,STAR>* U01_MC_STAR[2] = { &U01_MC_STAR0, &U01_MC_STAR1 };
+    CopyRequest<F> requestU[2];
+
+    auto startPanel = [&]( Int k, Int slot )
+    {
+        const Int nb = Min(bsize,m-k);
+        auto U01 = U( IR(0,k), IR(k,k+nb) );
+        auto X0 = X( IR(0,k), ALL );
+        U01_MC_STAR[slot]->AlignWith( X0 );
+        CopyAsync( U01, *U01_MC_STAR[slot], requestU[slot] );
+    };
+
     const Int kLast = LastOffset( m, bsize );
-    for( Int k=kLast; k>=0; k-=bsize )
+    if( m > 0 )
+        startPanel( kLast, 0 );
+    for( Int k=kLast, slot=0; k>=0; k-=bsize, slot=1-slot )
     {
         const Int nb = Min(bsize,m-k);
 
         const Range<Int> ind0( 0, k    ),
                          ind1( k, k+nb );
 
-        auto U01 = U( ind0, ind1 );
         auto U11 = U( ind1, ind1 );
 
         auto X0 = X( ind0, ALL );
         auto X1 = X( ind1, ALL );
 
+        if( k-bsize >= 0 )
+            startPanel( k-bsize, 1-slot );
+
         U11_STAR_STAR = U11; // U11[* ,* ] <- U11[MC,MR]
         X1_STAR_VR    = X1;  // X1[* ,VR] <- X1[MC,MR]
         
@@ -61,11 +80,11 @@ void LUNLarge
         X1_STAR_MR.AlignWith( X0 );
         X1_STAR_MR  = X1_STAR_VR; // X1[* ,MR]  <- X1[* ,VR]
         X1          = X1_STAR_MR; // X1[MC,MR] <- X1[* ,MR]
-        U01_MC_STAR.AlignWith( X0 );
-        U01_MC_STAR = U01;        // U01[MC,* ] <- U01[MC,MR]
+        requestU[slot].Wait();    // U01[MC,* ] <- U01[MC,MR]
 
         // X0[MC,MR] -= U01[MC,* ] X1[* ,MR]
-        LocalGemm( NORMAL, NORMAL, F(-1), U01_MC_STAR, X1_STAR_MR, F(1), X0 );
+        LocalGemm
+        ( NORMAL, NORMAL, F(-1), *U01_MC_STAR[slot], X1_STAR_MR, F(1), X0 );
     }
 }
 
@@ -78,8 +97,8 @@ void LUNMedium
 {
     EL_DEBUG_CSE
     const Int m = XPre.Height();
-    const Int bsize = Blocksize();
     const Grid& g = UPre.Grid();
+    const Int bsize = Blocksize<F>( BLOCKSIZE_TRSM, g );
 
     DistMatrixReadProxy<F,F,MC,MR> UProx( UPre );
     DistMatrixReadWriteProxy<F,F,MC,MR> XProx( XPre );
@@ -141,8 +160,8 @@ void LUNSmall
           LogicError("U and X are assumed to be aligned");
     )
     const Int m = X.Height();
-    const Int bsize = Blocksize();
     const Grid& g = U.Grid();
+    const Int bsize = Blocksize<F>( BLOCKSIZE_TRSM, g );
 
     DistMatrix<F,STAR,STAR> U11_STAR_STAR(g), X1_STAR_STAR(g);
 
@@ -31,8 +31,8 @@ void LUTLarge
           LogicError("Expected (Conjugate)Transpose option");
     )
     const Int m = XPre.Height();
-    const Int bsize = Blocksize();
     const Grid& g = UPre.Grid();
+    const Int bsize = Blocksize<F>( BLOCKSIZE_TRSM, g );
 
     DistMatrixReadProxy<F,F,MC,MR> UProx( UPre );
     DistMatrixReadWriteProxy<F,F,MC,MR> XProx( XPre );
@@ -93,8 +93,8 @@ void LUTMedium
           LogicError("Expected (Conjugate)Transpose option");
     )
     const Int m = XPre.Height();
-    const Int bsize = Blocksize();
     const Grid& g = UPre.Grid();
+    const Int bsize = Blocksize<F>( BLOCKSIZE_TRSM, g );
 
     DistMatrixReadProxy<F,F,MC,MR> UProx( UPre );
     DistMatrixReadWriteProxy<F,F,MC,MR> XProx( XPre );
@@ -162,8 +162,8 @@ void LUTSmall
           LogicError("U and X are assumed to be aligned");
     )
     const Int m = X.Height();
-    const Int bsize = Blocksize();
     const Grid& g = U.Grid();
+    const Int bsize = Blocksize<F>( BLOCKSIZE_TRSM, g );
 
     DistMatrix<F,STAR,STAR> U11_STAR_STAR(g), X1_STAR_STAR(g); 
 
@@ -25,8 +25,8 @@ void RLN
 {
     EL_DEBUG_CSE
     const Int n = XPre.Width();
-    const Int bsize = Blocksize();
     const Grid& g = LPre.Grid();
+    const Int bsize = Blocksize<F>( BLOCKSIZE_TRSM, g );
 
     DistMatrixReadProxy<F,F,MC,MR> LProx( LPre );
     DistMatrixReadWriteProxy<F,F,MC,MR> XProx( XPre );
@@ -29,8 +29,8 @@ void RLT
           LogicError("Expected (Conjugate)Transpose option");
     )
     const Int n = XPre.Width();
-    const Int bsize = Blocksize();
     const Grid& g = LPre.Grid();
+    const Int bsize = Blocksize<F>( BLOCKSIZE_TRSM, g );
 
     DistMatrixReadProxy<F,F,MC,MR> LProx( LPre );
     DistMatrixReadWriteProxy<F,F,MC,MR> XProx( XPre );
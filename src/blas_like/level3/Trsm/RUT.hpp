@@ -29,8 +29,8 @@ void RUT
           LogicError("Expected (Conjugate)Transpose option");
     )
     const Int n = XPre.Width();
-    const Int bsize = Blocksize();
     const Grid& g = UPre.Grid();
+    const Int bsize = Blocksize<F>( BLOCKSIZE_TRSM, g );
 
     DistMatrixReadProxy<F,F,MC,MR> UProx( UPre );
     DistMatrixReadWriteProxy<F,F,MC,MR> XProx( XPre );
@@ -0,0 +1,72 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License, 
+   which can be found in the LICENSE file in the root directory, or at 
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+
+namespace El {
+namespace trsm {
+
+// Replicated-triangle Trsm
+//   X := op(A)^-1 X, or
+//   X := X op(A)^-1
+//
+// The triangle is gathered onto every process a single time and each process
+// then solves against its own subset of the right-hand sides, so that the
+// only communication is the replication of A and a single redistribution of
+// X in each direction (rather than O(m/bsize) panel redistributions). This is
+// clearly preferable when the triangle is no larger than each process's
+// portion of X.
+
+template<typename F>
+bool PreferReplicated
+( LeftOrRight side,
+  const AbstractDistMatrix<F>& A,
+  const AbstractDistMatrix<F>& X )
+{
+    EL_DEBUG_CSE
+    const Int m = A.Height();
+    const Int numRHS = ( side==LEFT ? X.Width() : X.Height() );
+    const Int p = X.Grid().Size();
+    return m > 0 && numRHS >= m*p;
+}
+
+template<typename F>
+void Replicated
+( LeftOrRight side,
+  UpperOrLower uplo,
+  Orientation orientation,
+  UnitOrNonUnit diag,
+  const AbstractDistMatrix<F>& A,
+        AbstractDistMatrix<F>& XPre,
+  bool checkIfSingular )
+{
+    EL_DEBUG_CSE
+    DistMatrix<F,STAR,STAR> A_STAR_STAR( A );
+    if( side == LEFT )
+    {
+        DistMatrixReadWriteProxy<F,F,STAR,VR> XProx( XPre );
+        auto& X = XProx.Get();
+
+        // X[* ,VR] := op(A[* ,* ])^-1 X[* ,VR]
+        LocalTrsm
+        ( LEFT, uplo, orientation, diag, F(1), A_STAR_STAR, X,
+          checkIfSingular );
+    }
+    else
+    {
+        DistMatrixReadWriteProxy<F,F,VC,STAR> XProx( XPre );
+        auto& X = XProx.Get();
+
+        // X[VC,* ] := X[VC,* ] op(A[* ,* ])^-1
+        LocalTrsm
+        ( RIGHT, uplo, orientation, diag, F(1), A_STAR_STAR, X,
+          checkIfSingular );
+    }
+}
+
+} // namespace trsm
+} // namespace El
@@ -100,14 +100,15 @@ void LVar4
     auto& L = LProx.GetLocked();
 
     // Temporary distributions
-    DistMatrix<F,STAR,MR  > A10_STAR_MR(g), 
-                            A21Adj_STAR_MR(g), L21Adj_STAR_MR(g);
-    DistMatrix<F,STAR,MC  > A21Trans_STAR_MC(g);
+    DistMatrix<F,STAR,MR  > A10_STAR_MR(g);
     DistMatrix<F,STAR,VR  > A10_STAR_VR(g);
     DistMatrix<F,STAR,STAR> A11_STAR_STAR(g), L11_STAR_STAR(g);
     DistMatrix<F,VC,  STAR> A21_VC_STAR(g), L21_VC_STAR(g), Y21_VC_STAR(g);
-    DistMatrix<F,VR,  STAR> A21_VR_STAR(g), L21_VR_STAR(g);
     DistMatrix<F,MC,  STAR> L21_MC_STAR(g);
+    DistMatrix<F,VC,  STAR> X21_VC_STAR(g);
+    DistMatrix<F,VR,  STAR> X21_VR_STAR(g);
+    DistMatrix<F,MC,  STAR> X21_MC_STAR(g), XSwap21_MC_STAR(g);
+    DistMatrix<F,MR,  STAR> X21_MR_STAR(g);
 
     for( Int k=0; k<n; k+=bsize )
     {
@@ -167,21 +168,40 @@ void LVar4
         Axpy( F(-1)/F(2), Y21_VC_STAR, A21_VC_STAR );
 
         // A22 := A22 - (L21 A21' + A21 L21')
-        A21Trans_STAR_MC.AlignWith( A22 );
-        Transpose( A21_VC_STAR, A21Trans_STAR_MC );
-        A21_VR_STAR.AlignWith( A22 );
-        A21_VR_STAR = A21_VC_STAR;
-        L21_VR_STAR.AlignWith( A22 );
-        L21_VR_STAR = L21_VC_STAR;
-        A21Adj_STAR_MR.AlignWith( A22 );
-        L21Adj_STAR_MR.AlignWith( A22 );
-        Adjoint( A21_VR_STAR, A21Adj_STAR_MR );
-        Adjoint( L21_VR_STAR, L21Adj_STAR_MR );
-        LocalTrr2k
-        ( LOWER, NORMAL, NORMAL, TRANSPOSE, NORMAL,
-          F(-1), L21_MC_STAR,      A21Adj_STAR_MR, 
-          F(-1), A21Trans_STAR_MC, L21Adj_STAR_MR,
-          F(1),  A22 );
+        //
+        // Rather than separately redistributing L21 and A21 for a Trr2k,
+        // the two are packed into X21 = | L21 A21 | so that a single
+        // redistribution of X21 to each of [MC,* ] and [MR,* ] suffices for
+        // the rank-2nb update
+        //   A22 := A22 - | A21 L21 | X21'
+        X21_VC_STAR.AlignWith( A22 );
+        X21_VC_STAR.Resize( A21.Height(), 2*nb );
+        {
+            auto& XLoc = X21_VC_STAR.Matrix();
+            auto XL = XLoc( ALL, IR(0,nb) );
+            auto XR = XLoc( ALL, IR(nb,2*nb) );
+            XL = L21_VC_STAR.LockedMatrix();
+            XR = A21_VC_STAR.LockedMatrix();
+        }
+        X21_MC_STAR.AlignWith( A22 );
+        X21_MC_STAR = X21_VC_STAR;
+        X21_VR_STAR.AlignWith( A22 );
+        X21_VR_STAR = X21_VC_STAR;
+        X21_MR_STAR.AlignWith( A22 );
+        X21_MR_STAR = X21_VR_STAR;
+        XSwap21_MC_STAR.AlignWith( A22 );
+        XSwap21_MC_STAR.Resize( A21.Height(), 2*nb );
+        {
+            const auto& XLoc = X21_MC_STAR.LockedMatrix();
+            auto& XSwapLoc = XSwap21_MC_STAR.Matrix();
+            auto XSwapL = XSwapLoc( ALL, IR(0,nb) );
+            auto XSwapR = XSwapLoc( ALL, IR(nb,2*nb) );
+            XSwapL = XLoc( ALL, IR(nb,2*nb) );
+            XSwapR = XLoc( ALL, IR(0,nb) );
+        }
+        LocalTrrk
+        ( LOWER, ADJOINT,
+          F(-1), XSwap21_MC_STAR, X21_MR_STAR, F(1), A22 );
 
         // A21 := A21 - 1/2 Y21
         Axpy( F(-1)/F(2), Y21_VC_STAR, A21_VC_STAR );
@@ -101,10 +101,12 @@ void UVar4
 
     // Temporary distributions
     DistMatrix<F,STAR,STAR> A11_STAR_STAR(g), U11_STAR_STAR(g);
-    DistMatrix<F,STAR,MC  > A01Trans_STAR_MC(g), A12_STAR_MC(g), U12_STAR_MC(g);
-    DistMatrix<F,STAR,MR  > A12_STAR_MR(g);
-    DistMatrix<F,STAR,VC  > A12_STAR_VC(g), U12_STAR_VC(g);
+    DistMatrix<F,STAR,MC  > A01Trans_STAR_MC(g);
     DistMatrix<F,STAR,VR  > A12_STAR_VR(g), U12_STAR_VR(g), Y12_STAR_VR(g);
+    DistMatrix<F,STAR,VR  > X12_STAR_VR(g);
+    DistMatrix<F,STAR,VC  > X12_STAR_VC(g);
+    DistMatrix<F,STAR,MC  > X12_STAR_MC(g), XSwap12_STAR_MC(g);
+    DistMatrix<F,STAR,MR  > X12_STAR_MR(g);
     DistMatrix<F,MR,  STAR> U12Trans_MR_STAR(g);
     DistMatrix<F,VC,  STAR> A01_VC_STAR(g);
     DistMatrix<F,VR,  STAR> U12Trans_VR_STAR(g);
@@ -173,21 +175,40 @@ void UVar4
         Axpy( F(-1)/F(2), Y12_STAR_VR, A12_STAR_VR );
 
         // A22 := A22 - (A12' U12 + U12' A12)
-        A12_STAR_MR.AlignWith( A22 );
-        A12_STAR_MR = A12_STAR_VR;
-        A12_STAR_VC.AlignWith( A22 );
-        A12_STAR_VC = A12_STAR_VR;
-        U12_STAR_VC.AlignWith( A22 );
-        U12_STAR_VC = U12_STAR_VR;
-        A12_STAR_MC.AlignWith( A22 );
-        A12_STAR_MC = A12_STAR_VC;
-        U12_STAR_MC.AlignWith( A22 );
-        U12_STAR_MC = U12_STAR_VC;
-        LocalTrr2k
-        ( UPPER, ADJOINT, TRANSPOSE, ADJOINT, NORMAL,
-          F(-1), A12_STAR_MC, U12Trans_MR_STAR,
-          F(-1), U12_STAR_MC, A12_STAR_MR,
-          F(1), A22 );
+        //
+        // Rather than separately redistributing U12 and A12 for a Trr2k,
+        // the two are packed into X12 = | U12; A12 | so that a single
+        // redistribution of X12 to each of [* ,MC] and [* ,MR] suffices for
+        // the rank-2nb update
+        //   A22 := A22 - | A12; U12 |' X12
+        X12_STAR_VR.AlignWith( A22 );
+        X12_STAR_VR.Resize( 2*nb, A12.Width() );
+        {
+            auto& XLoc = X12_STAR_VR.Matrix();
+            auto XT = XLoc( IR(0,nb), ALL );
+            auto XB = XLoc( IR(nb,2*nb), ALL );
+            XT = U12_STAR_VR.LockedMatrix();
+            XB = A12_STAR_VR.LockedMatrix();
+        }
+        X12_STAR_MR.AlignWith( A22 );
+        X12_STAR_MR = X12_STAR_VR;
+        X12_STAR_VC.AlignWith( A22 );
+        X12_STAR_VC = X12_STAR_VR;
+        X12_STAR_MC.AlignWith( A22 );
+        X12_STAR_MC = X12_STAR_VC;
+        XSwap12_STAR_MC.AlignWith( A22 );
+        XSwap12_STAR_MC.Resize( 2*nb, A12.Width() );
+        {
+            const auto& XLoc = X12_STAR_MC.LockedMatrix();
+            auto& XSwapLoc = XSwap12_STAR_MC.Matrix();
+            auto XSwapT = XSwapLoc( IR(0,nb), ALL );
+            auto XSwapB = XSwapLoc( IR(nb,2*nb), ALL );
+            XSwapT = XLoc( IR(nb,2*nb), ALL );
+            XSwapB = XLoc( IR(0,nb), ALL );
+        }
+        LocalTrrk
+        ( UPPER, ADJOINT,
+          F(-1), XSwap12_STAR_MC, X12_STAR_MR, F(1), A22 );
 
         // A12 := A12 - 1/2 Y12
         Axpy( F(-1)/F(2), Y12_STAR_VR, A12_STAR_VR );
@@ -0,0 +1,496 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+namespace El {
+
+namespace sylvester {
+
+// Overwrite C with the solution of T Y + Y U = C, where T is upper-triangular
+// and U is upper-triangular if 'lowerU' is false and lower-triangular
+// otherwise, via substitution. Nearly-singular diagonal denominators are
+// perturbed, as in LAPACK's xTRSYL.
+template<typename Field>
+void TriangularSequential
+( const Matrix<Field>& T,
+  const Matrix<Field>& U,
+  bool lowerU,
+        Matrix<Field>& C )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Int m = T.Height();
+    const Int n = U.Height();
+    const Real smallNum = limits::SafeMin<Real>() /
+      limits::Epsilon<Real>();
+    const Real minDenom =
+      Max( limits::Epsilon<Real>()*Max(MaxNorm(T),MaxNorm(U)), smallNum );
+    for( Int jj=0; jj<n; ++jj )
+    {
+        const Int j = ( lowerU ? n-1-jj : jj );
+        for( Int i=m-1; i>=0; --i )
+        {
+            Field rho = C(i,j);
+            for( Int k=i+1; k<m; ++k )
+                rho -= T(i,k)*C(k,j);
+            if( lowerU )
+            {
+                for( Int l=j+1; l<n; ++l )
+                    rho -= C(i,l)*U(l,j);
+            }
+            else
+            {
+                for( Int l=0; l<j; ++l )
+                    rho -= C(i,l)*U(l,j);
+            }
+            Field denom = T(i,i) + U(j,j);
+            if( Abs(denom) < minDenom )
+                denom = minDenom;
+            C(i,j) = rho / denom;
+        }
+    }
+}
+
+// The recursive blocked approach of Jonsson and Kagstrom splits the larger
+// of the two dimensions in half so that the coupling between the halves is
+// an update with a matrix-matrix multiplication:
+//
+//   T = | T11 T12 |: solve for Y2 with T22, C1 -= T12 Y2, solve for Y1 with T11
+//       |  0  T22 |
+//
+//   U = | U11 U12 |: solve for Y1 with U11, C2 -= Y1 U12, solve for Y2 with U22
+//       |  0  U22 |
+//
+// and, when op(U) = U^H, the latter order is reversed.
+template<typename Field>
+void Triangular
+( const Matrix<Field>& T,
+  const Matrix<Field>& U,
+  Orientation orientU,
+        Matrix<Field>& C,
+  Int blocksize )
+{
+    EL_DEBUG_CSE
+    const Int m = T.Height();
+    const Int n = U.Height();
+    if( C.Height() != m || C.Width() != n )
+        LogicError("C must conform with T and U");
+    const Int bsize = ( blocksize > 0 ? blocksize : Blocksize() );
+    if( m == 0 || n == 0 )
+        return;
+    if( m <= bsize && n <= bsize )
+    {
+        if( orientU == NORMAL )
+        {
+            TriangularSequential( T, U, false, C );
+        }
+        else
+        {
+            Matrix<Field> UAdj;
+            Adjoint( U, UAdj );
+            TriangularSequential( T, UAdj, true, C );
+        }
+        return;
+    }
+
+    if( m >= n )
+    {
+        const Int mSplit = m/2;
+        const Range<Int> ind1(0,mSplit), ind2(mSplit,m);
+        auto T11 = T( ind1, ind1 );
+        auto T12 = T( ind1, ind2 );
+        auto T22 = T( ind2, ind2 );
+        auto C1 = C( ind1, ALL );
+        auto C2 = C( ind2, ALL );
+        Triangular( T22, U, orientU, C2, bsize );
+        Gemm( NORMAL, NORMAL, Field(-1), T12, C2, Field(1), C1 );
+        Triangular( T11, U, orientU, C1, bsize );
+    }
+    else
+    {
+        const Int nSplit = n/2;
+        const Range<Int> ind1(0,nSplit), ind2(nSplit,n);
+        auto U11 = U( ind1, ind1 );
+        auto U12 = U( ind1, ind2 );
+        auto U22 = U( ind2, ind2 );
+        auto C1 = C( ALL, ind1 );
+        auto C2 = C( ALL, ind2 );
+        if( orientU == NORMAL )
+        {
+            Triangular( T, U11, orientU, C1, bsize );
+            Gemm( NORMAL, NORMAL, Field(-1), C1, U12, Field(1), C2 );
+            Triangular( T, U22, orientU, C2, bsize );
+        }
+        else
+        {
+            Triangular( T, U22, orientU, C2, bsize );
+            Gemm( NORMAL, orientU, Field(-1), C2, U12, Field(1), C1 );
+            Triangular( T, U11, orientU, C1, bsize );
+        }
+    }
+}
+
+template<typename Field>
+void TriangularRecursive
+( const DistMatrix<Field>& T,
+  const DistMatrix<Field>& U,
+  Orientation orientU,
+        DistMatrix<Field>& C,
+  Int bsize )
+{
+    EL_DEBUG_CSE
+    const Int m = T.Height();
+    const Int n = U.Height();
+    if( m == 0 || n == 0 )
+        return;
+    if( m <= bsize && n <= bsize )
+    {
+        // Solve the small subproblem redundantly
+        DistMatrix<Field,STAR,STAR> T_STAR_STAR( T ), U_STAR_STAR( U ),
+          C_STAR_STAR( C );
+        if( orientU == NORMAL )
+        {
+            TriangularSequential
+            ( T_STAR_STAR.LockedMatrix(), U_STAR_STAR.LockedMatrix(), false,
+              C_STAR_STAR.Matrix() );
+        }
+        else
+        {
+            Matrix<Field> UAdj;
+            Adjoint( U_STAR_STAR.LockedMatrix(), UAdj );
+            TriangularSequential
+            ( T_STAR_STAR.LockedMatrix(), UAdj, true, C_STAR_STAR.Matrix() );
+        }
+        C = C_STAR_STAR;
+        return;
+    }
+
+    if( m >= n )
+    {
+        const Int mSplit = m/2;
+        const Range<Int> ind1(0,mSplit), ind2(mSplit,m);
+        auto T11 = T( ind1, ind1 );
+        auto T12 = T( ind1, ind2 );
+        auto T22 = T( ind2, ind2 );
+        auto C1 = C( ind1, ALL );
+        auto C2 = C( ind2, ALL );
+        TriangularRecursive( T22, U, orientU, C2, bsize );
+        Gemm( NORMAL, NORMAL, Field(-1), T12, C2, Field(1), C1 );
+        TriangularRecursive( T11, U, orientU, C1, bsize );
+    }
+    else
+    {
+        const Int nSplit = n/2;
+        const Range<Int> ind1(0,nSplit), ind2(nSplit,n);
+        auto U11 = U( ind1, ind1 );
+        auto U12 = U( ind1, ind2 );
+        auto U22 = U( ind2, ind2 );
+        auto C1 = C( ALL, ind1 );
+        auto C2 = C( ALL, ind2 );
+        if( orientU == NORMAL )
+        {
+            TriangularRecursive( T, U11, orientU, C1, bsize );
+            Gemm( NORMAL, NORMAL, Field(-1), C1, U12, Field(1), C2 );
+            TriangularRecursive( T, U22, orientU, C2, bsize );
+        }
+        else
+        {
+            TriangularRecursive( T, U22, orientU, C2, bsize );
+            Gemm( NORMAL, orientU, Field(-1), C2, U12, Field(1), C1 );
+            TriangularRecursive( T, U11, orientU, C1, bsize );
+        }
+    }
+}
+
+template<typename Field>
+void Triangular
+( const AbstractDistMatrix<Field>& TPre,
+  const AbstractDistMatrix<Field>& UPre,
+  Orientation orientU,
+        AbstractDistMatrix<Field>& CPre,
+  Int blocksize )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(AssertSameGrids( TPre, UPre, CPre ))
+    if( CPre.Height() != TPre.Height() || CPre.Width() != UPre.Height() )
+        LogicError("C must conform with T and U");
+    DistMatrixReadProxy<Field,Field,MC,MR> TProx( TPre ), UProx( UPre );
+    DistMatrixReadWriteProxy<Field,Field,MC,MR> CProx( CPre );
+    auto& T = TProx.GetLocked();
+    auto& U = UProx.GetLocked();
+    auto& C = CProx.Get();
+    const Int bsize = ( blocksize > 0 ? blocksize : Blocksize() );
+    TriangularRecursive( T, U, orientU, C, bsize );
+}
+
+template<typename Real>
+void ExtractSolution( const Matrix<Complex<Real>>& XComplex, Matrix<Real>& X )
+{ RealPart( XComplex, X ); }
+template<typename Real>
+void ExtractSolution
+( const Matrix<Complex<Real>>& XComplex, Matrix<Complex<Real>>& X )
+{ X = XComplex; }
+
+template<typename Real>
+void ExtractSolution
+( const DistMatrix<Complex<Real>>& XComplex, ElementalMatrix<Real>& X )
+{ RealPart( XComplex, X ); }
+template<typename Real>
+void ExtractSolution
+( const DistMatrix<Complex<Real>>& XComplex,
+  ElementalMatrix<Complex<Real>>& X )
+{ Copy( XComplex, X ); }
+
+// Bartels-Stewart with complex Schur decompositions A = Q_A T_A Q_A^H and
+// B = Q_B T_B Q_B^H (real matrices are handled in complex arithmetic so that
+// the triangular solves need not treat the 2x2 blocks of real Schur forms)
+template<typename F>
+void Schur
+( const Matrix<F>& A,
+  const Matrix<F>& B,
+  const Matrix<F>& C,
+        Matrix<F>& X,
+  const SylvesterCtrl<Base<F>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Complex<Base<F>> CF;
+    Matrix<CF> TA, TB, QA, QB, wA, wB, W, Y;
+    Copy( A, TA );
+    El::Schur( TA, wA, QA, ctrl.schurCtrl );
+    Copy( B, TB );
+    El::Schur( TB, wB, QB, ctrl.schurCtrl );
+
+    // Y := Q_A^H C Q_B
+    Copy( C, Y );
+    Gemm( ADJOINT, NORMAL, CF(1), QA, Y, W );
+    Gemm( NORMAL, NORMAL, CF(1), W, QB, Y );
+
+    Triangular( TA, TB, NORMAL, Y, ctrl.blocksize );
+
+    // X := Q_A Y Q_B^H
+    Gemm( NORMAL, NORMAL, CF(1), QA, Y, W );
+    Gemm( NORMAL, ADJOINT, CF(1), W, QB, Y );
+    ExtractSolution( Y, X );
+}
+
+template<typename F>
+void Schur
+( const ElementalMatrix<F>& A,
+  const ElementalMatrix<F>& B,
+  const ElementalMatrix<F>& C,
+        ElementalMatrix<F>& X,
+  const SylvesterCtrl<Base<F>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Complex<Base<F>> CF;
+    const Grid& g = A.Grid();
+    DistMatrix<CF> TA(g), TB(g), QA(g), QB(g), W(g), Y(g);
+    DistMatrix<CF,VR,STAR> wA(g), wB(g);
+    Copy( A, TA );
+    El::Schur( TA, wA, QA, ctrl.schurCtrl );
+    Copy( B, TB );
+    El::Schur( TB, wB, QB, ctrl.schurCtrl );
+
+    Copy( C, Y );
+    Gemm( ADJOINT, NORMAL, CF(1), QA, Y, W );
+    Gemm( NORMAL, NORMAL, CF(1), W, QB, Y );
+
+    Triangular( TA, TB, NORMAL, Y, ctrl.blocksize );
+
+    Gemm( NORMAL, NORMAL, CF(1), QA, Y, W );
+    Gemm( NORMAL, ADJOINT, CF(1), W, QB, Y );
+    ExtractSolution( Y, X );
+}
+
+// A single Schur decomposition, A = Q T Q^H, reduces A X + X A^H = C to
+// T Y + Y T^H = Q^H C Q
+template<typename F>
+void LyapunovSchur
+( const Matrix<F>& A,
+  const Matrix<F>& C,
+        Matrix<F>& X,
+  const SylvesterCtrl<Base<F>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Complex<Base<F>> CF;
+    Matrix<CF> T, Q, w, W, Y;
+    Copy( A, T );
+    El::Schur( T, w, Q, ctrl.schurCtrl );
+
+    Copy( C, Y );
+    Gemm( ADJOINT, NORMAL, CF(1), Q, Y, W );
+    Gemm( NORMAL, NORMAL, CF(1), W, Q, Y );
+
+    Triangular( T, T, ADJOINT, Y, ctrl.blocksize );
+
+    Gemm( NORMAL, NORMAL, CF(1), Q, Y, W );
+    Gemm( NORMAL, ADJOINT, CF(1), W, Q, Y );
+    ExtractSolution( Y, X );
+}
+
+template<typename F>
+void LyapunovSchur
+( const ElementalMatrix<F>& A,
+  const ElementalMatrix<F>& C,
+        ElementalMatrix<F>& X,
+  const SylvesterCtrl<Base<F>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Complex<Base<F>> CF;
+    const Grid& g = A.Grid();
+    DistMatrix<CF> T(g), Q(g), W(g), Y(g);
+    DistMatrix<CF,VR,STAR> w(g);
+    Copy( A, T );
+    El::Schur( T, w, Q, ctrl.schurCtrl );
+
+    Copy( C, Y );
+    Gemm( ADJOINT, NORMAL, CF(1), Q, Y, W );
+    Gemm( NORMAL, NORMAL, CF(1), W, Q, Y );
+
+    Triangular( T, T, ADJOINT, Y, ctrl.blocksize );
+
+    Gemm( NORMAL, NORMAL, CF(1), Q, Y, W );
+    Gemm( NORMAL, ADJOINT, CF(1), W, Q, Y );
+    ExtractSolution( Y, X );
+}
+
+} // namespace sylvester
+
+template<typename F>
+void Sylvester
+( const Matrix<F>& A,
+  const Matrix<F>& B,
+  const Matrix<F>& C,
+        Matrix<F>& X,
+  const SylvesterCtrl<Base<F>>& ctrl )
+{
+    EL_DEBUG_CSE
+    if( ctrl.alg == SYLVESTER_SIGN )
+    {
+        Sylvester( A, B, C, X, ctrl.signCtrl );
+        return;
+    }
+    if( A.Height() != A.Width() )
+        LogicError("A must be square");
+    if( B.Height() != B.Width() )
+        LogicError("B must be square");
+    if( C.Height() != A.Height() || C.Width() != B.Height() )
+        LogicError("C must conform with A and B");
+    sylvester::Schur( A, B, C, X, ctrl );
+}
+
+template<typename F>
+void Sylvester
+( const ElementalMatrix<F>& A,
+  const ElementalMatrix<F>& B,
+  const ElementalMatrix<F>& C,
+        ElementalMatrix<F>& X,
+  const SylvesterCtrl<Base<F>>& ctrl )
+{
+    EL_DEBUG_CSE
+    if( ctrl.alg == SYLVESTER_SIGN )
+    {
+        Sylvester( A, B, C, X, ctrl.signCtrl );
+        return;
+    }
+    if( A.Height() != A.Width() )
+        LogicError("A must be square");
+    if( B.Height() != B.Width() )
+        LogicError("B must be square");
+    if( C.Height() != A.Height() || C.Width() != B.Height() )
+        LogicError("C must conform with A and B");
+    AssertSameGrids( A, B, C );
+    sylvester::Schur( A, B, C, X, ctrl );
+}
+
+template<typename F>
+void Lyapunov
+( const Matrix<F>& A,
+  const Matrix<F>& C,
+        Matrix<F>& X,
+  const SylvesterCtrl<Base<F>>& ctrl )
+{
+    EL_DEBUG_CSE
+    if( ctrl.alg == SYLVESTER_SIGN )
+    {
+        Lyapunov( A, C, X, ctrl.signCtrl );
+        return;
+    }
+    if( A.Height() != A.Width() )
+        LogicError("A must be square");
+    if( C.Height() != A.Height() || C.Width() != A.Height() )
+        LogicError("C must conform with A");
+    sylvester::LyapunovSchur( A, C, X, ctrl );
+}
+
+template<typename F>
+void Lyapunov
+( const ElementalMatrix<F>& A,
+  const ElementalMatrix<F>& C,
+        ElementalMatrix<F>& X,
+  const SylvesterCtrl<Base<F>>& ctrl )
+{
+    EL_DEBUG_CSE
+    if( ctrl.alg == SYLVESTER_SIGN )
+    {
+        Lyapunov( A, C, X, ctrl.signCtrl );
+        return;
+    }
+    if( A.Height() != A.Width() )
+        LogicError("A must be square");
+    if( C.Height() != A.Height() || C.Width() != A.Height() )
+        LogicError("C must conform with A");
+    AssertSameGrids( A, C );
+    sylvester::LyapunovSchur( A, C, X, ctrl );
+}
+
+#define PROTO(F) \
+  template void sylvester::Triangular \
+  ( const Matrix<F>& T, \
+    const Matrix<F>& U, \
+    Orientation orientU, \
+          Matrix<F>& C, \
+    Int blocksize ); \
+  template void sylvester::Triangular \
+  ( const AbstractDistMatrix<F>& T, \
+    const AbstractDistMatrix<F>& U, \
+    Orientation orientU, \
+          AbstractDistMatrix<F>& C, \
+    Int blocksize ); \
+  template void Sylvester \
+  ( const Matrix<F>& A, \
+    const Matrix<F>& B, \
+    const Matrix<F>& C, \
+          Matrix<F>& X, \
+    const SylvesterCtrl<Base<F>>& ctrl ); \
+  template void Sylvester \
+  ( const ElementalMatrix<F>& A, \
+    const ElementalMatrix<F>& B, \
+    const ElementalMatrix<F>& C, \
+          ElementalMatrix<F>& X, \
+    const SylvesterCtrl<Base<F>>& ctrl ); \
+  template void Lyapunov \
+  ( const Matrix<F>& A, \
+    const Matrix<F>& C, \
+          Matrix<F>& X, \
+    const SylvesterCtrl<Base<F>>& ctrl ); \
+  template void Lyapunov \
+  ( const ElementalMatrix<F>& A, \
+    const ElementalMatrix<F>& C, \
+          ElementalMatrix<F>& X, \
+    const SylvesterCtrl<Base<F>>& ctrl );
+
+#define EL_NO_INT_PROTO
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
@@ -0,0 +1,213 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+namespace El {
+
+namespace lr_lyap {
+
+template<typename Real>
+vector<Real> Shifts
+( const pair<Real,Real>& extremal, const LowRankLyapunovCtrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    if( !ctrl.shifts.empty() )
+    {
+        for( const Real& shift : ctrl.shifts )
+            if( shift >= Real(0) )
+                LogicError("The ADI shifts must be negative");
+        return ctrl.shifts;
+    }
+    const Real sigmaMin =
+      Max( extremal.first, limits::Epsilon<Real>()*extremal.second );
+    const Real sigmaMax = extremal.second;
+    if( sigmaMax == Real(0) )
+        LogicError("A was zero");
+    const Int numShifts = Max( ctrl.numShifts, Int(1) );
+    vector<Real> shifts( numShifts );
+    for( Int j=0; j<numShifts; ++j )
+    {
+        const Real theta =
+          ( numShifts == 1 ? Real(0) : Real(j)/Real(numShifts-1) );
+        shifts[j] = -sigmaMin*Pow(sigmaMax/sigmaMin,theta);
+    }
+    return shifts;
+}
+
+// The low-rank ADI iteration with real shifts p_k < 0,
+//
+//   V_0     = sqrt(-2 p_0) inv(A + p_0 I) B,
+//   V_{k+1} = sqrt(p_{k+1}/p_k) (V_k - (p_{k+1}+p_k) inv(A + p_{k+1} I) V_k),
+//
+// where 'shiftedSolve(p,V)' overwrites V with inv(A + p I) V and 'frobSquared'
+// returns the squared Frobenius norm of a block. The blocks are handed to
+// 'append' as they are computed.
+template<typename Real,class SolveType,class NormType,class AppendType,
+         class BlockType>
+void ADI
+( const vector<Real>& shifts,
+        BlockType& V,
+        BlockType& W,
+  const SolveType& shiftedSolve,
+  const NormType& frobSquared,
+  const AppendType& append,
+  const LowRankLyapunovCtrl<Real>& ctrl,
+        mpi::Comm comm )
+{
+    EL_DEBUG_CSE
+    const Real tol =
+      ( ctrl.tol > Real(0) ? ctrl.tol : Sqrt(limits::Epsilon<Real>()) );
+    const Int numShifts = shifts.size();
+
+    shiftedSolve( shifts[0], V );
+    V *= Sqrt(-2*shifts[0]);
+    Real ZFrobSquared = frobSquared( V );
+    append( V );
+    for( Int it=1; it<ctrl.maxIts; ++it )
+    {
+        const Real shiftPrev = shifts[(it-1)%numShifts];
+        const Real shift = shifts[it%numShifts];
+        W = V;
+        shiftedSolve( shift, W );
+        Axpy( -(shift+shiftPrev), W, V );
+        V *= Sqrt(shift/shiftPrev);
+
+        const Real VFrobSquared = frobSquared( V );
+        ZFrobSquared += VFrobSquared;
+        append( V );
+        const Real relNorm = Sqrt(VFrobSquared/ZFrobSquared);
+        if( ctrl.progress )
+            OutputFromRoot
+            (comm,"  ADI iteration ",it,": ||V_k||_F / ||Z||_F=",relNorm);
+        if( relNorm <= tol )
+            break;
+    }
+}
+
+} // namespace lr_lyap
+
+template<typename F>
+void LowRankLyapunov
+( const SparseMatrix<F>& A,
+  const Matrix<F>& B,
+        Matrix<F>& Z,
+  const LowRankLyapunovCtrl<Base<F>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    const Int n = A.Height();
+    if( n != A.Width() )
+        LogicError("A must be square");
+    if( B.Height() != n )
+        LogicError("B must conform with A");
+    const Int k = B.Width();
+    const auto shifts =
+      lr_lyap::Shifts
+      ( ctrl.shifts.empty() ? ExtremalSingValEst( A, ctrl.basisSize )
+                            : pair<Real,Real>(), ctrl );
+
+    SparseMatrix<F> AShift;
+    auto shiftedSolve =
+      [&]( const Real& shift, Matrix<F>& V )
+      {
+          AShift = A;
+          ShiftDiagonal( AShift, F(shift) );
+          LinearSolve( AShift, V, ctrl.solveCtrl );
+      };
+    auto frobSquared =
+      [&]( const Matrix<F>& V )
+      { const Real frobNorm = FrobeniusNorm( V ); return frobNorm*frobNorm; };
+    vector<Matrix<F>> blocks;
+    auto append = [&]( const Matrix<F>& V ) { blocks.push_back( V ); };
+
+    Matrix<F> V( B ), W;
+    lr_lyap::ADI
+    ( shifts, V, W, shiftedSolve, frobSquared, append, ctrl,
+      mpi::COMM_SELF );
+
+    Zeros( Z, n, k*blocks.size() );
+    for( size_t j=0; j<blocks.size(); ++j )
+    {
+        auto Zj = Z( ALL, IR(j*k,(j+1)*k) );
+        Zj = blocks[j];
+    }
+}
+
+template<typename F>
+void LowRankLyapunov
+( const DistSparseMatrix<F>& A,
+  const DistMultiVec<F>& B,
+        DistMultiVec<F>& Z,
+  const LowRankLyapunovCtrl<Base<F>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    const Int n = A.Height();
+    if( n != A.Width() )
+        LogicError("A must be square");
+    if( B.Height() != n )
+        LogicError("B must conform with A");
+    const Grid& grid = A.Grid();
+    const Int k = B.Width();
+    const auto shifts =
+      lr_lyap::Shifts
+      ( ctrl.shifts.empty() ? ExtremalSingValEst( A, ctrl.basisSize )
+                            : pair<Real,Real>(), ctrl );
+
+    DistSparseMatrix<F> AShift(grid);
+    auto shiftedSolve =
+      [&]( const Real& shift, DistMultiVec<F>& V )
+      {
+          AShift = A;
+          ShiftDiagonal( AShift, F(shift) );
+          LinearSolve( AShift, V, ctrl.solveCtrl );
+      };
+    auto frobSquared =
+      [&]( const DistMultiVec<F>& V )
+      { const Real frobNorm = FrobeniusNorm( V ); return frobNorm*frobNorm; };
+    // Only the local rows of the blocks need to be retained
+    vector<Matrix<F>> localBlocks;
+    auto append =
+      [&]( const DistMultiVec<F>& V )
+      { localBlocks.push_back( V.LockedMatrix() ); };
+
+    DistMultiVec<F> V( grid ), W( grid );
+    V = B;
+    lr_lyap::ADI
+    ( shifts, V, W, shiftedSolve, frobSquared, append, ctrl, grid.Comm() );
+
+    Z.SetGrid( grid );
+    Zeros( Z, n, k*localBlocks.size() );
+    for( size_t j=0; j<localBlocks.size(); ++j )
+    {
+        auto ZjLoc = Z.Matrix()( ALL, IR(j*k,(j+1)*k) );
+        ZjLoc = localBlocks[j];
+    }
+}
+
+#define PROTO(F) \
+  template void LowRankLyapunov \
+  ( const SparseMatrix<F>& A, \
+    const Matrix<F>& B, \
+          Matrix<F>& Z, \
+    const LowRankLyapunovCtrl<Base<F>>& ctrl ); \
+  template void LowRankLyapunov \
+  ( const DistSparseMatrix<F>& A, \
+    const DistMultiVec<F>& B, \
+          DistMultiVec<F>& Z, \
+    const LowRankLyapunovCtrl<Base<F>>& ctrl );
+
+#define EL_NO_INT_PROTO
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
@@ -68,6 +68,13 @@ DistGraph::DistGraph( const DistGraph& graph )
     )
 }
 
+DistGraph::DistGraph( DistGraph&& graph )
+: numSources_(-1), numTargets_(-1), grid_(graph.grid_)
+{
+    EL_DEBUG_CSE
+    *this = std::move(graph);
+}
+
 DistGraph::~DistGraph() { }
 
 // Assignment and reconfiguration
@@ -89,6 +96,36 @@ const DistGraph& DistGraph::operator=( const DistGraph& graph )
     return *this;
 }
 
+// Move assignment
+// ---------------
+DistGraph& DistGraph::operator=( DistGraph&& graph )
+{
+    EL_DEBUG_CSE
+    if( &graph == this )
+        return *this;
+    numSources_ = graph.numSources_;
+    numTargets_ = graph.numTargets_;
+    grid_ = graph.grid_;
+    blocksize_ = graph.blocksize_;
+    numLocalSources_ = graph.numLocalSources_;
+    frozenSparsity_ = graph.frozenSparsity_;
+    sources_ = std::move(graph.sources_);
+    targets_ = std::move(graph.targets_);
+    markedForRemoval_ = std::move(graph.markedForRemoval_);
+    remoteSources_ = std::move(graph.remoteSources_);
+    remoteTargets_ = std::move(graph.remoteTargets_);
+    remoteRemovals_ = std::move(graph.remoteRemovals_);
+    locallyConsistent_ = graph.locallyConsistent_;
+    localSourceOffsets_ = std::move(graph.localSourceOffsets_);
+    compressedSources_ = graph.compressedSources_;
+    multMeta = std::move(graph.multMeta);
+
+    // Leave the moved-from graph as an empty graph over the same grid
+    graph.multMeta.Clear();
+    graph.Empty();
+    return *this;
+}
+
 // Make a copy of a contiguous subgraph
 // ------------------------------------
 DistGraph DistGraph::operator()( Range<Int> I, Range<Int> J ) const
@@ -136,6 +173,8 @@ void DistGraph::Empty( bool freeMemory )
     blocksize_ = 1;
     locallyConsistent_ = true;
     frozenSparsity_ = false;
+    compressedSources_ = false;
+    multMeta.Invalidate();
     if( freeMemory )
     {
         SwapClear( sources_ );
@@ -196,6 +235,8 @@ void DistGraph::InitializeLocalData()
     sources_.resize( 0 );
     targets_.resize( 0 );
     locallyConsistent_ = true;
+    compressedSources_ = false;
+    multMeta.Invalidate();
 }
 
 // Change the distribution
@@ -206,6 +247,7 @@ void DistGraph::SetGrid( const El::Grid& grid )
     if( &grid == grid_ )
         return;
     grid_ = &grid;
+    multMeta.Clear();
     Resize( 0, 0 );
 }
 
@@ -214,6 +256,7 @@ void DistGraph::SetGrid( const El::Grid& grid )
 void DistGraph::Reserve( Int numLocalEdges, Int numRemoteEdges )
 {
     EL_DEBUG_CSE
+    ExpandSources();
     const Int currSize = sources_.size();
     const Int currRemoteSize = remoteSources_.size();
     sources_.reserve( currSize+numLocalEdges );
@@ -298,6 +341,7 @@ EL_NO_RELEASE_EXCEPT
     if( !FrozenSparsity() )
     {
         const Int firstLocalSource = blocksize_*grid_->Rank();
+        ExpandSources();
         sources_.push_back( firstLocalSource+localSource );
         targets_.push_back( target );
         locallyConsistent_ = false;
@@ -342,6 +386,7 @@ EL_NO_RELEASE_EXCEPT
     if( !FrozenSparsity() )
     {
         const Int firstLocalSource = blocksize_*grid_->Rank();
+        ExpandSources();
         markedForRemoval_.insert
         ( pair<Int,Int>(firstLocalSource+localSource,target) );
         locallyConsistent_ = false;
@@ -353,9 +398,12 @@ void DistGraph::ProcessQueues()
 {
     EL_DEBUG_CSE
     EL_DEBUG_ONLY(
-      if( sources_.size() != targets_.size() )
+      if( !compressedSources_ && sources_.size() != targets_.size() )
           LogicError("Inconsistent graph buffer sizes");
     )
+    // Every process must agree that the multiplication metadata is stale
+    if( !frozenSparsity_ )
+        multMeta.Invalidate();
     const int gridSize = grid_->Size();
 
     // Send the remote edges
@@ -438,6 +486,7 @@ void DistGraph::ProcessLocalQueues()
     EL_DEBUG_CSE
     if( locallyConsistent_ )
         return;
+    ExpandSources();
 
     const Int numLocalEdges = sources_.size();
     Int numRemoved = 0;
@@ -499,10 +548,14 @@ Int DistGraph::NumLocalSources() const EL_NO_EXCEPT
 { return numLocalSources_; }
 
 Int DistGraph::NumLocalEdges() const EL_NO_EXCEPT
-{ return sources_.size(); }
+{ return targets_.size(); }
 
 Int DistGraph::Capacity() const EL_NO_EXCEPT
-{ return Min(sources_.capacity(),targets_.capacity()); }
+{
+    if( compressedSources_ )
+        return targets_.capacity();
+    return Min(sources_.capacity(),targets_.capacity());
+}
 
 bool DistGraph::LocallyConsistent() const EL_NO_EXCEPT
 { return locallyConsistent_; }
@@ -548,9 +601,18 @@ Int DistGraph::Source( Int localEdge ) const EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
     EL_DEBUG_ONLY(
-      if( localEdge < 0 || localEdge >= (Int)sources_.size() )
+      if( localEdge < 0 || localEdge >= (Int)targets_.size() )
           LogicError("Edge number out of bounds");
     )
+    if( compressedSources_ )
+    {
+        // Find the last local source whose offset is at most the edge index
+        auto it =
+          std::upper_bound
+          ( localSourceOffsets_.begin(), localSourceOffsets_.end(),
+            localEdge );
+        return FirstLocalSource() + Int(it-localSourceOffsets_.begin()) - 1;
+    }
     return sources_[localEdge];
 }
 
@@ -609,15 +671,15 @@ EL_NO_RELEASE_EXCEPT
     return (Max(maxLocalEdges,1)*grid_->Size())/Max(numEdges,1);
 }
 
-Int* DistGraph::SourceBuffer() EL_NO_EXCEPT
-{ return sources_.data(); }
+Int* DistGraph::SourceBuffer()
+{ ExpandSources(); multMeta.Invalidate(); return sources_.data(); }
 Int* DistGraph::TargetBuffer() EL_NO_EXCEPT
-{ return targets_.data(); }
+{ multMeta.Invalidate(); return targets_.data(); }
 Int* DistGraph::OffsetBuffer() EL_NO_EXCEPT
-{ return localSourceOffsets_.data(); }
+{ multMeta.Invalidate(); return localSourceOffsets_.data(); }
 
-const Int* DistGraph::LockedSourceBuffer() const EL_NO_EXCEPT
-{ return sources_.data(); }
+const Int* DistGraph::LockedSourceBuffer() const
+{ ExpandSources(); return sources_.data(); }
 const Int* DistGraph::LockedTargetBuffer() const EL_NO_EXCEPT
 { return targets_.data(); }
 const Int* DistGraph::LockedOffsetBuffer() const EL_NO_EXCEPT
@@ -626,9 +688,11 @@ const Int* DistGraph::LockedOffsetBuffer() const EL_NO_EXCEPT
 void DistGraph::ForceNumLocalEdges( Int numLocalEdges )
 {
     EL_DEBUG_CSE
+    ExpandSources();
     sources_.resize( numLocalEdges );
     targets_.resize( numLocalEdges );
     locallyConsistent_ = false;
+    multMeta.Invalidate();
 }
 
 void DistGraph::ForceConsistency( bool consistent ) EL_NO_EXCEPT
@@ -636,6 +700,33 @@ void DistGraph::ForceConsistency( bool consistent ) EL_NO_EXCEPT
 
 // Auxiliary routines
 // ==================
+void DistGraph::CompressSources()
+{
+    EL_DEBUG_CSE
+    AssertLocallyConsistent();
+    SwapClear( sources_ );
+    compressedSources_ = true;
+}
+
+bool DistGraph::CompressedSources() const EL_NO_EXCEPT
+{ return compressedSources_; }
+
+void DistGraph::ExpandSources() const
+{
+    EL_DEBUG_CSE
+    if( !compressedSources_ )
+        return;
+    const Int firstLocalSource = FirstLocalSource();
+    sources_.resize( targets_.size() );
+    for( Int sLoc=0; sLoc<numLocalSources_; ++sLoc )
+    {
+        const Int offEnd = localSourceOffsets_[sLoc+1];
+        for( Int e=localSourceOffsets_[sLoc]; e<offEnd; ++e )
+            sources_[e] = firstLocalSource + sLoc;
+    }
+    compressedSources_ = false;
+}
+
 void DistGraph::AssertConsistent() const
 {
     Int locallyConsistent = ( locallyConsistent_ ? 1 : 0 );
@@ -650,7 +741,38 @@ void DistGraph::AssertLocallyConsistent() const
     if( !locallyConsistent_ )
         LogicError("DistGraph was not consistent");
 }
-DistGraphMultMeta DistGraph::InitializeMultMeta() const
+unsigned long long DistGraph::StructureHash() const EL_NO_EXCEPT
+{
+    unsigned long long hash = HASH_SEED;
+    HashCombine( hash, grid_->Size() );
+    HashCombine( hash, numSources_ );
+    HashCombine( hash, numTargets_ );
+    const Int numLocalEdges = NumLocalEdges();
+    HashCombine( hash, numLocalEdges );
+    if( compressedSources_ )
+    {
+        const Int firstLocalSource = FirstLocalSource();
+        for( Int sLoc=0; sLoc<numLocalSources_; ++sLoc )
+        {
+            const Int source = firstLocalSource + sLoc;
+            const Int offEnd = localSourceOffsets_[sLoc+1];
+            for( Int e=localSourceOffsets_[sLoc]; e<offEnd; ++e )
+            {
+                HashCombine( hash, source );
+                HashCombine( hash, targets_[e] );
+            }
+        }
+        return hash;
+    }
+    for( Int e=0; e<numLocalEdges; ++e )
+    {
+        HashCombine( hash, sources_[e] );
+        HashCombine( hash, targets_[e] );
+    }
+    return hash;
+}
+
+const DistGraphMultMeta& DistGraph::InitializeMultMeta() const
 {
     EL_DEBUG_ONLY(CSE cse("DistSparseMatrix::InitializeMultMeta"))
     if( multMeta.ready )
@@ -659,6 +781,20 @@ DistGraphMultMeta DistGraph::InitializeMultMeta() const
     const int commSize = grid_->Size();
     auto& meta = multMeta;
 
+    // Reuse stale metadata if no process has changed its local structure
+    const unsigned long long structureHash = StructureHash();
+    const int unchanged =
+      ( meta.stale && meta.structureHash == structureHash ? 1 : 0 );
+    if( mpi::AllReduce( unchanged, mpi::MIN, comm ) )
+    {
+        meta.ready = true;
+        meta.stale = false;
+        return meta;
+    }
+    meta.structureHash = structureHash;
+    meta.stale = false;
+    meta.ResetExchanges();
+
     // Compute the set of row indices that we need from X in a normal
     // multiply or update of Y in the adjoint case
     const Int* colBuffer = LockedTargetBuffer();
@@ -734,6 +870,39 @@ DistGraphMultMeta DistGraph::InitializeMultMeta() const
       meta.sendInds.data(), meta.sendSizes.data(), meta.sendOffs.data(),
       comm );
 
+    // Split the local rows into those which only require local entries of X
+    // and those which require remote entries
+    const int commRank = grid_->Rank();
+    const Int localBeg = meta.recvOffs[commRank];
+    const Int localEnd = localBeg + meta.recvSizes[commRank];
+    const Int* offsetBuf = LockedOffsetBuffer();
+    meta.interiorRows.clear();
+    meta.boundaryRows.clear();
+    for( Int iLoc=0; iLoc<numLocalSources_; ++iLoc )
+    {
+        bool interior = true;
+        for( Int e=offsetBuf[iLoc]; e<offsetBuf[iLoc+1]; ++e )
+        {
+            if( meta.colOffs[e] < localBeg || meta.colOffs[e] >= localEnd )
+            {
+                interior = false;
+                break;
+            }
+        }
+        if( interior )
+            meta.interiorRows.push_back( iLoc );
+        else
+            meta.boundaryRows.push_back( iLoc );
+    }
+
+    // All processes must agree on how the exchange is performed
+    int numNeighbors = 0;
+    for( int q=0; q<commSize; ++q )
+        if( q != commRank && (meta.sendSizes[q] > 0 || meta.recvSizes[q] > 0) )
+            ++numNeighbors;
+    const int maxNeighbors = mpi::AllReduce( numNeighbors, mpi::MAX, comm );
+    meta.sparseExchange = ( maxNeighbors <= commSize/2 );
+
     meta.numRecvInds = numRecvInds;
     meta.ready = true;
 
@@ -760,6 +929,7 @@ void DistGraph::ComputeSourceOffsets()
     }
     for( ; sourceOffset<=numLocalSources_; ++sourceOffset )
         localSourceOffsets_[sourceOffset] = numLocalEdges;
+    multMeta.Invalidate();
 }
 
 } // namespace El
@@ -579,6 +579,33 @@ void AbstractDistMatrix<T>::QueueUpdate( Int i, Int j, T value )
 EL_NO_RELEASE_EXCEPT
 { QueueUpdate( Entry<T>{i,j,value} ); }
 
+template<typename T>
+void AbstractDistMatrix<T>::QueueUpdates
+( Int numEntries, const Int* rows, const Int* cols, const T* values )
+{
+    EL_DEBUG_CSE
+    Reserve( numEntries );
+    for( Int e=0; e<numEntries; ++e )
+        QueueUpdate( Entry<T>{rows[e],cols[e],values[e]} );
+}
+
+template<typename T>
+void AbstractDistMatrix<T>::QueueSubmatrixUpdate
+( const vector<Int>& rows,
+  const vector<Int>& cols,
+  const El::Matrix<T>& ASub )
+{
+    EL_DEBUG_CSE
+    const Int m = rows.size();
+    const Int n = cols.size();
+    if( ASub.Height() != m || ASub.Width() != n )
+        LogicError("The submatrix did not match the index sets");
+    Reserve( m*n );
+    for( Int t=0; t<n; ++t )
+        for( Int s=0; s<m; ++s )
+            QueueUpdate( Entry<T>{rows[s],cols[t],ASub(s,t)} );
+}
+
 template<typename T>
 void AbstractDistMatrix<T>::ProcessQueues( bool includeViewers )
 {
@@ -586,7 +613,7 @@ void AbstractDistMatrix<T>::ProcessQueues( bool includeViewers )
     const auto& grid = Grid();
     const Dist colDist = ColDist();
     const Dist rowDist = RowDist();
-    const Int totalSend = remoteUpdates.size();
+    const Int totalQueued = remoteUpdates.size();
 
     // We will first push to redundant rank 0
     const int redundantRoot = 0;
@@ -594,20 +621,17 @@ void AbstractDistMatrix<T>::ProcessQueues( bool includeViewers )
     // Compute the metadata
     // ====================
     mpi::Comm comm;
-    vector<int> sendCounts, owners(totalSend);
+    vector<int> owners(totalQueued);
     if( includeViewers )
     {
         comm = grid.ViewingComm();
-        const int viewingSize = mpi::Size( grid.ViewingComm() );
-        sendCounts.resize(viewingSize,0);
-        for( Int k=0; k<totalSend; ++k )
+        for( Int k=0; k<totalQueued; ++k )
         {
             const Entry<T>& entry = remoteUpdates[k];
             const int distOwner = Owner(entry.i,entry.j);
             const int vcOwner =
               grid.CoordsToVC(colDist,rowDist,distOwner,redundantRoot);
             owners[k] = grid.VCToViewing(vcOwner);
-            ++sendCounts[owners[k]];
         }
     }
     else
@@ -615,39 +639,104 @@ void AbstractDistMatrix<T>::ProcessQueues( bool includeViewers )
         if( !Participating() )
             return;
         comm = grid.VCComm();
-        const int vcSize = mpi::Size( grid.VCComm() );
-        sendCounts.resize(vcSize,0);
-        for( Int k=0; k<totalSend; ++k )
+        for( Int k=0; k<totalQueued; ++k )
         {
             const Entry<T>& entry = remoteUpdates[k];
             const int distOwner = Owner(entry.i,entry.j);
             owners[k] =
               grid.CoordsToVC(colDist,rowDist,distOwner,redundantRoot);
-            ++sendCounts[owners[k]];
         }
     }
-
-    // Pack the data
-    // =============
+    const int commSize = mpi::Size( comm );
+
+    // Sort the updates by owner and then in column-major order so that
+    // duplicate updates of the same entry are adjacent and can be summed
+    // before being sent
+    // ===================================================================
+    vector<Int> sortedInds(totalQueued);
+    for( Int k=0; k<totalQueued; ++k )
+        sortedInds[k] = k;
+    std::sort
+    ( sortedInds.begin(), sortedInds.end(),
+      [&]( const Int& k0, const Int& k1 )
+      {
+          if( owners[k0] != owners[k1] )
+              return owners[k0] < owners[k1];
+          const Entry<T>& entry0 = remoteUpdates[k0];
+          const Entry<T>& entry1 = remoteUpdates[k1];
+          if( entry0.j != entry1.j )
+              return entry0.j < entry1.j;
+          return entry0.i < entry1.i;
+      } );
+
+    // Pack the coordinates and values into separate buffers
+    // =====================================================
+    vector<int> sendCounts(commSize,0);
+    vector<ValueInt<Int>> sendCoords;
+    vector<T> sendValues;
+    sendCoords.reserve( totalQueued );
+    sendValues.reserve( totalQueued );
+    int lastOwner = -1;
+    for( const Int& k : sortedInds )
+    {
+        const Entry<T>& entry = remoteUpdates[k];
+        const int owner = owners[k];
+        if( owner == lastOwner &&
+            sendCoords.back().value == entry.i &&
+            sendCoords.back().index == entry.j )
+        {
+            sendValues.back() += entry.value;
+        }
+        else
+        {
+            sendCoords.push_back( ValueInt<Int>{entry.i,entry.j} );
+            sendValues.push_back( entry.value );
+            ++sendCounts[owner];
+            lastOwner = owner;
+        }
+    }
+    SwapClear( remoteUpdates );
+    SwapClear( sortedInds );
+    SwapClear( owners );
     vector<int> sendOffs;
     Scan( sendCounts, sendOffs );
-    vector<Entry<T>> sendBuf(totalSend);
-    auto offs = sendOffs;
-    for( Int k=0; k<totalSend; ++k )
-        sendBuf[offs[owners[k]]++] = remoteUpdates[k];
-    SwapClear( remoteUpdates );
 
-    // Exchange and unpack the data
-    // ============================
-    auto recvBuf = mpi::AllToAll( sendBuf, sendCounts, sendOffs, comm );
-    Int recvBufSize = recvBuf.size();
-    mpi::Broadcast( recvBufSize, redundantRoot, RedundantComm() );
-    recvBuf.resize( recvBufSize );
+    // Exchange the data
+    // =================
+    vector<int> recvCounts(commSize);
+    mpi::AllToAll( sendCounts.data(), 1, recvCounts.data(), 1, comm );
+    vector<int> recvOffs;
+    Int totalRecv = Scan( recvCounts, recvOffs );
+    vector<ValueInt<Int>> recvCoords(totalRecv);
+    mpi::AllToAll
+    ( sendCoords.data(), sendCounts.data(), sendOffs.data(),
+      recvCoords.data(), recvCounts.data(), recvOffs.data(), comm );
+    SwapClear( sendCoords );
+    vector<T> recvValues;
+    FastResize( recvValues, totalRecv );
+    mpi::AllToAll
+    ( sendValues.data(), sendCounts.data(), sendOffs.data(),
+      recvValues.data(), recvCounts.data(), recvOffs.data(), comm );
+    SwapClear( sendValues );
+
+    mpi::Broadcast( totalRecv, redundantRoot, RedundantComm() );
+    recvCoords.resize( totalRecv );
+    FastResize( recvValues, totalRecv );
     mpi::Broadcast
-    ( recvBuf.data(), recvBufSize, redundantRoot, RedundantComm() );
-    // TODO: Make this loop faster
-    for( const auto& entry : recvBuf )
-        UpdateLocal( LocalRow(entry.i), LocalCol(entry.j), entry.value );
+    ( recvCoords.data(), totalRecv, redundantRoot, RedundantComm() );
+    mpi::Broadcast
+    ( recvValues.data(), totalRecv, redundantRoot, RedundantComm() );
+
+    // Unpack the data
+    // ===============
+    T* buffer = Buffer();
+    const Int ldim = LDim();
+    for( Int k=0; k<totalRecv; ++k )
+    {
+        const Int iLoc = LocalRow( recvCoords[k].value );
+        const Int jLoc = LocalCol( recvCoords[k].index );
+        buffer[iLoc+jLoc*ldim] += recvValues[k];
+    }
 }
 
 template<typename T>
@@ -672,28 +761,23 @@ void AbstractDistMatrix<T>::ProcessPullQueue( T* pullBuf, bool includeViewers )
     const Dist colDist = ColDist();
     const Dist rowDist = RowDist();
     const int root = Root();
-    const Int totalRecv = remotePulls_.size();
+    const Int totalPulls = remotePulls_.size();
 
     // Compute the metadata
     // ====================
     mpi::Comm comm;
-    int commSize;
-    vector<int> recvCounts, owners(totalRecv);
+    vector<int> owners(totalPulls);
     if( includeViewers )
     {
         comm = grid.ViewingComm();
-        commSize = mpi::Size( comm );
-        recvCounts.resize(commSize,0);
-        for( Int k=0; k<totalRecv; ++k )
+        for( Int k=0; k<totalPulls; ++k )
         {
             const auto& valueInt = remotePulls_[k];
             const Int i = valueInt.value;
             const Int j = valueInt.index;
             const int distOwner = Owner(i,j);
             const int vcOwner = grid.CoordsToVC(colDist,rowDist,distOwner,root);
-            const int owner = grid.VCToViewing(vcOwner);
-            owners[k] = owner;
-            ++recvCounts[owner];
+            owners[k] = grid.VCToViewing(vcOwner);
         }
     }
     else
@@ -701,19 +785,58 @@ void AbstractDistMatrix<T>::ProcessPullQueue( T* pullBuf, bool includeViewers )
         if( !Participating() )
             return;
         comm = grid.VCComm();
-        commSize = mpi::Size( comm );
-        recvCounts.resize(commSize,0);
-        for( Int k=0; k<totalRecv; ++k )
+        for( Int k=0; k<totalPulls; ++k )
         {
             const auto& valueInt = remotePulls_[k];
             const Int i = valueInt.value;
             const Int j = valueInt.index;
             const int distOwner = Owner(i,j);
-            const int owner = grid.CoordsToVC(colDist,rowDist,distOwner,root);
-            owners[k] = owner;
+            owners[k] = grid.CoordsToVC(colDist,rowDist,distOwner,root);
+        }
+    }
+    const int commSize = mpi::Size( comm );
+
+    // Sort the pulls by owner and then in column-major order so that each
+    // distinct entry is only requested once
+    // ===================================================================
+    vector<Int> sortedInds(totalPulls);
+    for( Int k=0; k<totalPulls; ++k )
+        sortedInds[k] = k;
+    std::sort
+    ( sortedInds.begin(), sortedInds.end(),
+      [&]( const Int& k0, const Int& k1 )
+      {
+          if( owners[k0] != owners[k1] )
+              return owners[k0] < owners[k1];
+          const auto& pull0 = remotePulls_[k0];
+          const auto& pull1 = remotePulls_[k1];
+          if( pull0.index != pull1.index )
+              return pull0.index < pull1.index;
+          return pull0.value < pull1.value;
+      } );
+    vector<int> recvCounts(commSize,0);
+    vector<ValueInt<Int>> recvCoords;
+    vector<Int> uniqueInds(totalPulls);
+    recvCoords.reserve( totalPulls );
+    int lastOwner = -1;
+    for( const Int& k : sortedInds )
+    {
+        const auto& pull = remotePulls_[k];
+        const int owner = owners[k];
+        if( owner != lastOwner ||
+            recvCoords.back().value != pull.value ||
+            recvCoords.back().index != pull.index )
+        {
+            recvCoords.push_back( pull );
             ++recvCounts[owner];
+            lastOwner = owner;
         }
+        uniqueInds[k] = recvCoords.size()-1;
     }
+    SwapClear( sortedInds );
+    SwapClear( owners );
+    const Int totalRecv = recvCoords.size();
+
     vector<int> recvOffs;
     Scan( recvCounts, recvOffs );
     vector<int> sendCounts(commSize);
@@ -721,24 +844,23 @@ void AbstractDistMatrix<T>::ProcessPullQueue( T* pullBuf, bool includeViewers )
     vector<int> sendOffs;
     const int totalSend = Scan( sendCounts, sendOffs );
 
-    auto offs = recvOffs;
-    vector<ValueInt<Int>> recvCoords(totalRecv);
-    for( Int k=0; k<totalRecv; ++k )
-        recvCoords[offs[owners[k]]++] = remotePulls_[k];
     vector<ValueInt<Int>> sendCoords(totalSend);
     mpi::AllToAll
     ( recvCoords.data(), recvCounts.data(), recvOffs.data(),
       sendCoords.data(), sendCounts.data(), sendOffs.data(), comm );
+    SwapClear( recvCoords );
 
     // Pack the data
     // =============
     vector<T> sendBuf;
     FastResize( sendBuf, totalSend );
+    const T* buffer = LockedBuffer();
+    const Int ldim = LDim();
     for( Int k=0; k<totalSend; ++k )
     {
-        const Int i = sendCoords[k].value;
-        const Int j = sendCoords[k].index;
-        sendBuf[k] = GetLocal( LocalRow(i), LocalCol(j) );
+        const Int iLoc = LocalRow( sendCoords[k].value );
+        const Int jLoc = LocalCol( sendCoords[k].index );
+        sendBuf[k] = buffer[iLoc+jLoc*ldim];
     }
 
     // Exchange and unpack the data
@@ -748,9 +870,8 @@ void AbstractDistMatrix<T>::ProcessPullQueue( T* pullBuf, bool includeViewers )
     mpi::AllToAll
     ( sendBuf.data(), sendCounts.data(), sendOffs.data(),
       recvBuf.data(), recvCounts.data(), recvOffs.data(), comm );
-    offs = recvOffs;
-    for( Int k=0; k<totalRecv; ++k )
-        pullBuf[k] = recvBuf[offs[owners[k]]++];
+    for( Int k=0; k<totalPulls; ++k )
+        pullBuf[k] = recvBuf[uniqueInds[k]];
     SwapClear( remotePulls_ );
 }
 
@@ -53,6 +53,12 @@ extern "C" {
   ( ElDistSparseMatrix_ ## SIG A, \
     ElInt localRow, ElInt col, CREFLECT(T) value ) \
   { EL_TRY( CReflect(A)->QueueLocalUpdate(localRow,col,CReflect(value)) ) } \
+  ElError ElDistSparseMatrixQueueUpdates_ ## SIG \
+  ( ElDistSparseMatrix_ ## SIG A, ElInt numEntries, \
+    const ElInt* rows, const ElInt* cols, const CREFLECT(T)* values, \
+    bool passive ) \
+  { EL_TRY( CReflect(A)->QueueUpdates \
+      (numEntries,CReflect(rows),CReflect(cols),CReflect(values),passive) ) } \
   ElError ElDistSparseMatrixQueueZero_ ## SIG \
   ( ElDistSparseMatrix_ ## SIG A, ElInt row, ElInt col, bool passive ) \
   { EL_TRY( CReflect(A)->QueueZero(row,col,passive) ) } \
@@ -65,6 +71,18 @@ extern "C" {
   ElError ElDistSparseMatrixProcessLocalQueues_ ## SIG \
   ( ElDistSparseMatrix_ ## SIG A ) \
   { EL_TRY( CReflect(A)->ProcessLocalQueues() ) } \
+  ElError ElDistSparseMatrixAssembleCOO_ ## SIG \
+  ( ElDistSparseMatrix_ ## SIG A, ElInt numEntries, \
+    const ElInt* rows, const ElInt* cols, const CREFLECT(T)* values ) \
+  { EL_TRY( CReflect(A)->AssembleCOO \
+      (numEntries,CReflect(rows),CReflect(cols),CReflect(values)) ) } \
+  ElError ElDistSparseMatrixAssembleCSR_ ## SIG \
+  ( ElDistSparseMatrix_ ## SIG A, ElInt firstRow, ElInt numRows, \
+    const ElInt* rowOffsets, const ElInt* cols, \
+    const CREFLECT(T)* values ) \
+  { EL_TRY( CReflect(A)->AssembleCSR \
+      (firstRow,numRows,CReflect(rowOffsets),CReflect(cols), \
+       CReflect(values)) ) } \
   ElError ElDistSparseMatrixHeight_ ## SIG \
   ( ElConstDistSparseMatrix_ ## SIG A, ElInt* height ) \
   { EL_TRY( *height = CReflect(A)->Height() ) } \
@@ -121,6 +121,7 @@ void Graph::Empty( bool clearMemory )
     numTargets_ = 0;
     consistent_ = true;
     frozenSparsity_ = false;
+    compressedSources_ = false;
     if( clearMemory )
     {
         SwapClear( sources_ );
@@ -155,12 +156,14 @@ void Graph::Resize( Int numSources, Int numTargets )
     for( Int e=0; e<=numSources; ++e )
         sourceOffsets_[e] = 0;
     consistent_ = true;
+    compressedSources_ = false;
 }
 
 // Assembly
 // --------
 void Graph::Reserve( Int numEdges )
 {
+    ExpandSources();
     const Int currSize = sources_.size();
     sources_.reserve( currSize+numEdges );
     targets_.reserve( currSize+numEdges );
@@ -203,6 +206,7 @@ void Graph::QueueConnection( Int source, Int target )
     )
     if( !FrozenSparsity() )
     {
+        ExpandSources();
         sources_.push_back( source );
         targets_.push_back( target );
         consistent_ = false;
@@ -216,6 +220,7 @@ void Graph::QueueDisconnection( Int source, Int target )
     if( target == END ) target = numTargets_ - 1;
     if( !FrozenSparsity() )
     {
+        ExpandSources();
         markedForRemoval_.insert( pair<Int,Int>(source,target) );
         consistent_ = false;
     }
@@ -224,12 +229,13 @@ void Graph::QueueDisconnection( Int source, Int target )
 void Graph::ProcessQueues()
 {
     EL_DEBUG_CSE
+    if( consistent_ )
+        return;
+    ExpandSources();
     EL_DEBUG_ONLY(
       if( sources_.size() != targets_.size() )
           LogicError("Inconsistent graph buffer sizes");
     )
-    if( consistent_ )
-        return;
 
     Int numRemoved=0;
     const Int numEdges = sources_.size();
@@ -284,12 +290,14 @@ Int Graph::NumTargets() const EL_NO_EXCEPT { return numTargets_; }
 Int Graph::NumEdges() const EL_NO_EXCEPT
 {
     EL_DEBUG_CSE
-    return sources_.size();
+    return targets_.size();
 }
 
 Int Graph::Capacity() const EL_NO_EXCEPT
 {
     EL_DEBUG_CSE
+    if( compressedSources_ )
+        return targets_.capacity();
     return Min(sources_.capacity(),targets_.capacity());
 }
 
@@ -299,9 +307,17 @@ Int Graph::Source( Int edge ) const EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
     EL_DEBUG_ONLY(
-      if( edge < 0 || edge >= (Int)sources_.size() )
+      if( edge < 0 || edge >= (Int)targets_.size() )
           LogicError("Edge number out of bounds");
     )
+    if( compressedSources_ )
+    {
+        // Find the last source whose offset is at most the edge index
+        auto it =
+          std::upper_bound
+          ( sourceOffsets_.begin(), sourceOffsets_.end(), edge );
+        return Int(it-sourceOffsets_.begin()) - 1;
+    }
     return sources_[edge];
 }
 
@@ -363,13 +379,14 @@ Int Graph::NumConnections( Int source ) const EL_NO_RELEASE_EXCEPT
     return SourceOffset(source+1) - SourceOffset(source);
 }
 
-Int* Graph::SourceBuffer() EL_NO_EXCEPT { return sources_.data(); }
+Int* Graph::SourceBuffer() { ExpandSources(); return sources_.data(); }
 Int* Graph::TargetBuffer() EL_NO_EXCEPT { return targets_.data(); }
 Int* Graph::OffsetBuffer() EL_NO_EXCEPT { return sourceOffsets_.data(); }
 
 void Graph::ForceNumEdges( Int numEdges )
 {
     EL_DEBUG_CSE
+    ExpandSources();
     sources_.resize( numEdges );
     targets_.resize( numEdges );
     consistent_ = false;
@@ -378,8 +395,8 @@ void Graph::ForceNumEdges( Int numEdges )
 void Graph::ForceConsistency( bool consistent ) EL_NO_EXCEPT
 { consistent_ = consistent; }
 
-const Int* Graph::LockedSourceBuffer() const EL_NO_EXCEPT
-{ return sources_.data(); }
+const Int* Graph::LockedSourceBuffer() const
+{ ExpandSources(); return sources_.data(); }
 const Int* Graph::LockedTargetBuffer() const EL_NO_EXCEPT
 { return targets_.data(); }
 const Int* Graph::LockedOffsetBuffer() const EL_NO_EXCEPT
@@ -410,6 +427,29 @@ void Graph::ComputeSourceOffsets()
         sourceOffsets_[sourceOffset] = numEdges;
 }
 
+void Graph::CompressSources()
+{
+    EL_DEBUG_CSE
+    AssertConsistent();
+    SwapClear( sources_ );
+    compressedSources_ = true;
+}
+
+bool Graph::CompressedSources() const EL_NO_EXCEPT
+{ return compressedSources_; }
+
+void Graph::ExpandSources() const
+{
+    EL_DEBUG_CSE
+    if( !compressedSources_ )
+        return;
+    sources_.resize( targets_.size() );
+    for( Int source=0; source<numSources_; ++source )
+        for( Int e=sourceOffsets_[source]; e<sourceOffsets_[source+1]; ++e )
+            sources_[e] = source;
+    compressedSources_ = false;
+}
+
 void Graph::AssertConsistent() const
 {
     if( !consistent_ )
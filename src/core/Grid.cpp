@@ -13,6 +13,7 @@ namespace El {
 
 Grid* Grid::defaultGrid = 0;
 Grid* Grid::trivialGrid = 0;
+size_t Grid::nextId = 0;
 
 void Grid::InitializeDefault()
 {
@@ -73,7 +74,7 @@ int Grid::DefaultHeight( int gridSize ) EL_NO_EXCEPT
 }
 
 Grid::Grid( mpi::Comm comm, GridOrder order )
-: haveViewers_(false), order_(order)
+: haveViewers_(false), order_(order), id_(nextId++), nodeAware_(false)
 {
     EL_DEBUG_CSE
 
@@ -91,7 +92,7 @@ Grid::Grid( mpi::Comm comm, GridOrder order )
 }
 
 Grid::Grid( mpi::Comm comm, int height, GridOrder order )
-: haveViewers_(false), order_(order)
+: haveViewers_(false), order_(order), id_(nextId++), nodeAware_(false)
 {
     EL_DEBUG_CSE
 
@@ -110,6 +111,108 @@ Grid::Grid( mpi::Comm comm, int height, GridOrder order )
     SetUpGrid();
 }
 
+int Grid::NodeAwareHeight
+( int gridSize, int nodeSize, GridOrder order ) EL_NO_EXCEPT
+{
+    if( nodeSize <= 0 || gridSize % nodeSize != 0 )
+        return DefaultHeight( gridSize );
+
+    // Since the VC (VR) ranks of each process column (row) are contiguous,
+    // the columns (rows) lie within nodes if their length divides the node
+    // size, and consist of entire nodes if their length is a multiple of it
+    int bestLength = 1;
+    for( int length=1; length<=gridSize; ++length )
+    {
+        if( gridSize % length != 0 )
+            continue;
+        if( nodeSize % length != 0 && length % nodeSize != 0 )
+            continue;
+        if( Max(length,gridSize/length) <
+            Max(bestLength,gridSize/bestLength) )
+            bestLength = length;
+    }
+    return ( order==COLUMN_MAJOR ? bestLength : gridSize/bestLength );
+}
+
+Grid::Grid( mpi::Comm comm, GridTopology topology, GridOrder order )
+: haveViewers_(false), order_(order), id_(nextId++),
+  nodeAware_(topology==NODE_AWARE_GRID)
+{
+    EL_DEBUG_CSE
+    if( !nodeAware_ )
+    {
+        mpi::Dup( comm, viewingComm_ );
+        mpi::CommGroup( viewingComm_, viewingGroup_ );
+        size_ = mpi::Size( viewingComm_ );
+        owningGroup_ = viewingGroup_;
+        height_ = DefaultHeight( size_ );
+        SetUpGrid();
+        return;
+    }
+
+    // Determine the first rank and size of each node
+    const int commRank = mpi::Rank( comm );
+    const int commSize = mpi::Size( comm );
+    mpi::Comm nodeComm;
+    mpi::SplitShared( comm, commRank, nodeComm );
+    const int nodeRank = mpi::Rank( nodeComm );
+    const int nodeSize = mpi::Size( nodeComm );
+    int leaderRank = commRank;
+    mpi::Broadcast( leaderRank, 0, nodeComm );
+    mpi::Free( nodeComm );
+
+    // Order the processes by their node (and then by their original rank)
+    int myInfo[3] = { leaderRank, nodeRank, nodeSize };
+    vector<int> info(3*commSize);
+    mpi::AllGather( myInfo, 3, info.data(), 3, comm );
+    vector<int> sortedRanks(commSize);
+    for( int q=0; q<commSize; ++q )
+        sortedRanks[q] = q;
+    std::sort
+    ( sortedRanks.begin(), sortedRanks.end(),
+      [&]( int a, int b )
+      { return std::make_pair(info[3*a],info[3*a+1]) <
+               std::make_pair(info[3*b],info[3*b+1]); } );
+    int newRank = 0;
+    bool uniform = true;
+    for( int q=0; q<commSize; ++q )
+    {
+        if( sortedRanks[q] == commRank )
+            newRank = q;
+        if( info[3*q+2] != nodeSize )
+            uniform = false;
+    }
+    mpi::Split( comm, 0, newRank, viewingComm_ );
+    mpi::CommGroup( viewingComm_, viewingGroup_ );
+    size_ = commSize;
+    owningGroup_ = viewingGroup_;
+
+    height_ = NodeAwareHeight( size_, ( uniform ? nodeSize : 0 ), order );
+    SetUpGrid();
+    SetUpNodeHierarchies();
+}
+
+void Grid::SetUpNodeHierarchies()
+{
+    EL_DEBUG_CSE
+    mpi::SplitShared( viewingComm_, viewingRank_, nodeComm_ );
+    if( !InGrid() )
+        return;
+    auto build =
+      []( mpi::Comm comm )
+      {
+          unique_ptr<mpi::NodeHierarchy> hierarchy
+          ( new mpi::NodeHierarchy(comm) );
+          if( !hierarchy->Active() )
+              hierarchy.reset();
+          return hierarchy;
+      };
+    mcHierarchy_ = build( mcComm_ );
+    mrHierarchy_ = build( mrComm_ );
+    vcHierarchy_ = build( vcComm_ );
+    vrHierarchy_ = build( vrComm_ );
+}
+
 void Grid::SetUpGrid()
 {
     EL_DEBUG_CSE
@@ -202,6 +305,13 @@ void Grid::SetUpGrid()
         mpi::Split( cartComm_, mdPerpRank_, mdRank_,     mdComm_     );
         mpi::Split( cartComm_, mdRank_,     mdPerpRank_, mdPerpComm_ );
 
+        mpi::SetName( mcComm_,     "MC"     );
+        mpi::SetName( mrComm_,     "MR"     );
+        mpi::SetName( vcComm_,     "VC"     );
+        mpi::SetName( vrComm_,     "VR"     );
+        mpi::SetName( mdComm_,     "MD"     );
+        mpi::SetName( mdPerpComm_, "MDPerp" );
+
         EL_DEBUG_ONLY(
           mpi::ErrorHandlerSet( mcComm_,     mpi::ERRORS_RETURN );
           mpi::ErrorHandlerSet( mrComm_,     mpi::ERRORS_RETURN );
@@ -253,6 +363,12 @@ Grid::~Grid()
         blacs::FreeHandle( blacsVRHandle_ );
         blacs::FreeHandle( blacsVCHandle_ );
 #endif
+        mcHierarchy_.reset();
+        mrHierarchy_.reset();
+        vcHierarchy_.reset();
+        vrHierarchy_.reset();
+        if( nodeAware_ )
+            mpi::Free( nodeComm_ );
         if( InGrid() )
         {
             mpi::Free( mdComm_ );
@@ -300,6 +416,7 @@ int Grid::Size()   const EL_NO_EXCEPT { return VCSize(); }
 int Grid::Rank()   const EL_NO_RELEASE_EXCEPT { return OwningRank(); }
 
 GridOrder Grid::Order() const EL_NO_EXCEPT { return order_; }
+size_t Grid::Id() const EL_NO_EXCEPT { return id_; }
 
 int Grid::Row() const EL_NO_RELEASE_EXCEPT { return MCRank(); }
 int Grid::Col() const EL_NO_RELEASE_EXCEPT { return MRRank(); }
@@ -313,7 +430,7 @@ mpi::Comm Grid::Comm() const EL_NO_EXCEPT
 
 // Currently forces a columnMajor absolute rank on the grid
 Grid::Grid( mpi::Comm viewers, mpi::Group owners, int height, GridOrder order )
-: haveViewers_(true), order_(order)
+: haveViewers_(true), order_(order), id_(nextId++), nodeAware_(false)
 {
     EL_DEBUG_CSE
 
@@ -413,6 +530,23 @@ int Grid::CoordsToVC
 int Grid::VCToViewing( int vcRank ) const EL_NO_EXCEPT
 { return vcToViewing_[vcRank]; }
 
+bool Grid::NodeAware() const EL_NO_EXCEPT { return nodeAware_; }
+
+mpi::Comm Grid::NodeComm() const EL_NO_EXCEPT
+{ return ( nodeAware_ ? nodeComm_ : mpi::COMM_NULL ); }
+
+mpi::NodeHierarchy* Grid::Hierarchy( Dist dist ) const EL_NO_EXCEPT
+{
+    switch( dist )
+    {
+    case MC: return mcHierarchy_.get();
+    case MR: return mrHierarchy_.get();
+    case VC: return vcHierarchy_.get();
+    case VR: return vrHierarchy_.get();
+    default: return nullptr;
+    }
+}
+
 mpi::Group Grid::OwningGroup() const EL_NO_EXCEPT { return owningGroup_; }
 mpi::Comm Grid::OwningComm()  const EL_NO_EXCEPT { return owningComm_; }
 mpi::Comm Grid::ViewingComm() const EL_NO_EXCEPT { return viewingComm_; }
@@ -465,4 +599,16 @@ bool operator==( const Grid& A, const Grid& B ) EL_NO_EXCEPT
 bool operator!=( const Grid& A, const Grid& B ) EL_NO_EXCEPT
 { return &A != &B; }
 
+unique_ptr<Grid> ReshapedGrid( const Grid& grid, int height )
+{
+    EL_DEBUG_CSE
+    if( height < 1 || grid.Size() % height != 0 )
+        LogicError
+        ("The grid height, ",height,
+         ", must be a positive divisor of the grid size, ",grid.Size());
+    return unique_ptr<Grid>
+      ( new Grid
+        ( grid.ViewingComm(), grid.OwningGroup(), height, grid.Order() ) );
+}
+
 } // namespace El
@@ -0,0 +1,86 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El-lite.hpp>
+
+namespace El {
+
+Grid3D::Grid3D( const El::Grid& grid, int numLayers )
+: grid_(grid), numLayers_(numLayers), depthComm_(mpi::COMM_NULL)
+{
+    EL_DEBUG_CSE
+    const int p = grid.Size();
+    if( numLayers < 1 || p % numLayers != 0 )
+        LogicError
+        ("The number of layers, ",numLayers,
+         ", must be a positive divisor of the grid size, ",p);
+    layerSize_ = p / numLayers;
+
+    mpi::Comm viewingComm = grid.ViewingComm();
+    mpi::Group viewingGroup;
+    mpi::CommGroup( viewingComm, viewingGroup );
+    vector<int> ranks( layerSize_ );
+    for( int layer=0; layer<numLayers; ++layer )
+    {
+        for( int q=0; q<layerSize_; ++q )
+            ranks[q] = grid.VCToViewing( layer*layerSize_+q );
+        mpi::Group owners;
+        mpi::Incl( viewingGroup, layerSize_, ranks.data(), owners );
+        const int height = El::Grid::DefaultHeight( layerSize_ );
+        layers_.emplace_back( new El::Grid( viewingComm, owners, height ) );
+        mpi::Free( owners );
+    }
+    mpi::Free( viewingGroup );
+
+    if( grid.InGrid() )
+    {
+        const int vcRank = grid.VCRank();
+        mpi::Split
+        ( grid.VCComm(), vcRank % layerSize_, vcRank / layerSize_,
+          depthComm_ );
+    }
+}
+
+Grid3D::~Grid3D()
+{
+    if( !mpi::Finalized() && depthComm_ != mpi::COMM_NULL )
+        mpi::Free( depthComm_ );
+}
+
+int Grid3D::Layer() const EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( !grid_.InGrid() )
+          LogicError("Only processes in the base grid belong to a layer");
+    )
+    return grid_.VCRank() / layerSize_;
+}
+
+int Grid3D::MeshRank() const EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( !grid_.InGrid() )
+          LogicError("Only processes in the base grid belong to a layer");
+    )
+    return grid_.VCRank() % layerSize_;
+}
+
+const El::Grid& Grid3D::LayerGrid( int layer ) const EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( layer < 0 || layer >= numLayers_ )
+          LogicError
+          ("Layer ",layer," was not in [0,",numLayers_,")");
+    )
+    return *layers_[layer];
+}
+
+} // namespace El
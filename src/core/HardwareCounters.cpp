@@ -0,0 +1,259 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El-lite.hpp>
+
+#if defined(EL_HAVE_PAPI)
+# include <papi.h>
+#elif defined(EL_HAVE_PERF_EVENT)
+# include <linux/perf_event.h>
+# include <sys/syscall.h>
+# include <unistd.h>
+#endif
+
+namespace {
+
+using El::NUM_HARDWARE_COUNTERS;
+
+bool counting = false;
+bool available[NUM_HARDWARE_COUNTERS] = { false };
+// The counts of the counters which were since closed
+El::HardwareCounts closedCounts;
+
+bool OnMasterThread()
+{
+#ifdef EL_HYBRID
+    return omp_get_thread_num() == 0;
+#else
+    return true;
+#endif
+}
+
+#if defined(EL_HAVE_PAPI)
+
+const int papiEvents[NUM_HARDWARE_COUNTERS] =
+  { PAPI_TOT_CYC, PAPI_TOT_INS, PAPI_L3_TCA, PAPI_L3_TCM, PAPI_FP_OPS };
+
+int eventSet = PAPI_NULL;
+int numEvents = 0;
+// The position of each available counter within the event set
+int eventIndices[NUM_HARDWARE_COUNTERS];
+
+void OpenCounters()
+{
+    if( PAPI_is_initialized() == PAPI_NOT_INITED )
+    {
+        const int version = PAPI_library_init( PAPI_VER_CURRENT );
+        if( version != PAPI_VER_CURRENT )
+            El::RuntimeError("PAPI_library_init returned ",version);
+    }
+    eventSet = PAPI_NULL;
+    int err = PAPI_create_eventset( &eventSet );
+    if( err != PAPI_OK )
+        El::RuntimeError("PAPI_create_eventset returned ",err);
+    numEvents = 0;
+    for( int counter=0; counter<NUM_HARDWARE_COUNTERS; ++counter )
+    {
+        available[counter] =
+          ( PAPI_add_event( eventSet, papiEvents[counter] ) == PAPI_OK );
+        eventIndices[counter] = ( available[counter] ? numEvents++ : -1 );
+    }
+    if( numEvents > 0 )
+    {
+        err = PAPI_start( eventSet );
+        if( err != PAPI_OK )
+            El::RuntimeError("PAPI_start returned ",err);
+    }
+}
+
+void ReadOpenCounters( El::HardwareCounts& counts )
+{
+    if( numEvents == 0 )
+        return;
+    long long values[NUM_HARDWARE_COUNTERS];
+    if( PAPI_read( eventSet, values ) != PAPI_OK )
+        return;
+    for( int counter=0; counter<NUM_HARDWARE_COUNTERS; ++counter )
+        if( eventIndices[counter] >= 0 )
+            counts.values[counter] = values[eventIndices[counter]];
+}
+
+void CloseCounters()
+{
+    if( numEvents > 0 )
+    {
+        long long values[NUM_HARDWARE_COUNTERS];
+        PAPI_stop( eventSet, values );
+    }
+    PAPI_cleanup_eventset( eventSet );
+    PAPI_destroy_eventset( &eventSet );
+    numEvents = 0;
+}
+
+#elif defined(EL_HAVE_PERF_EVENT)
+
+struct PerfEvent
+{
+    bool supported;
+    unsigned long long config;
+};
+
+// There is no generic perf_event for floating-point operations
+const PerfEvent perfEvents[NUM_HARDWARE_COUNTERS] =
+  { {true,PERF_COUNT_HW_CPU_CYCLES},
+    {true,PERF_COUNT_HW_INSTRUCTIONS},
+    {true,PERF_COUNT_HW_CACHE_REFERENCES},
+    {true,PERF_COUNT_HW_CACHE_MISSES},
+    {false,0} };
+
+int descriptors[NUM_HARDWARE_COUNTERS] = { -1, -1, -1, -1, -1 };
+
+void OpenCounters()
+{
+    for( int counter=0; counter<NUM_HARDWARE_COUNTERS; ++counter )
+    {
+        descriptors[counter] = -1;
+        if( perfEvents[counter].supported )
+        {
+            perf_event_attr attr;
+            std::memset( &attr, 0, sizeof(attr) );
+            attr.size = sizeof(attr);
+            attr.type = PERF_TYPE_HARDWARE;
+            attr.config = perfEvents[counter].config;
+            attr.exclude_kernel = 1;
+            attr.exclude_hv = 1;
+            // Count the calling thread on whichever processor it runs
+            descriptors[counter] =
+              syscall( __NR_perf_event_open, &attr, 0, -1, -1, 0 );
+        }
+        available[counter] = ( descriptors[counter] >= 0 );
+    }
+}
+
+void ReadOpenCounters( El::HardwareCounts& counts )
+{
+    for( int counter=0; counter<NUM_HARDWARE_COUNTERS; ++counter )
+    {
+        if( descriptors[counter] < 0 )
+            continue;
+        long long value;
+        if( read( descriptors[counter], &value, sizeof(value) ) ==
+            sizeof(value) )
+            counts.values[counter] = value;
+    }
+}
+
+void CloseCounters()
+{
+    for( int counter=0; counter<NUM_HARDWARE_COUNTERS; ++counter )
+    {
+        if( descriptors[counter] >= 0 )
+            close( descriptors[counter] );
+        descriptors[counter] = -1;
+    }
+}
+
+#else
+
+void OpenCounters()
+{
+    for( int counter=0; counter<NUM_HARDWARE_COUNTERS; ++counter )
+        available[counter] = false;
+}
+
+void ReadOpenCounters( El::HardwareCounts& counts ) { }
+
+void CloseCounters() { }
+
+#endif
+
+} // anonymous namespace
+
+namespace El {
+
+const char* HardwareCounterName( HardwareCounter counter )
+{
+    switch( counter )
+    {
+    case HW_CYCLES:           return "cycles";
+    case HW_INSTRUCTIONS:     return "instructions";
+    case HW_CACHE_REFERENCES: return "cache references";
+    case HW_CACHE_MISSES:     return "cache misses";
+    case HW_FLOPS:            return "flops";
+    default: LogicError("Invalid hardware counter"); return "";
+    }
+}
+
+HardwareCounts& HardwareCounts::operator+=( const HardwareCounts& counts )
+{
+    for( int counter=0; counter<NUM_HARDWARE_COUNTERS; ++counter )
+        values[counter] += counts.values[counter];
+    return *this;
+}
+
+HardwareCounts& HardwareCounts::operator-=( const HardwareCounts& counts )
+{
+    for( int counter=0; counter<NUM_HARDWARE_COUNTERS; ++counter )
+        values[counter] -= counts.values[counter];
+    return *this;
+}
+
+HardwareCounts operator-( HardwareCounts a, const HardwareCounts& b )
+{
+    a -= b;
+    return a;
+}
+
+double HardwareCounts::MemoryBytes() const
+{ return 64.*values[HW_CACHE_MISSES]; }
+
+bool HaveHardwareCounters()
+{
+#if defined(EL_HAVE_PAPI) || defined(EL_HAVE_PERF_EVENT)
+    return true;
+#else
+    return false;
+#endif
+}
+
+void EnableHardwareCounters()
+{
+    EL_DEBUG_CSE
+    if( ::counting )
+        return;
+    OpenCounters();
+    ::counting = true;
+}
+
+void DisableHardwareCounters()
+{
+    EL_DEBUG_CSE
+    if( !::counting )
+        return;
+    HardwareCounts counts;
+    ReadOpenCounters( counts );
+    ::closedCounts += counts;
+    CloseCounters();
+    ::counting = false;
+}
+
+bool HardwareCounting() { return ::counting; }
+
+bool HardwareCounterAvailable( HardwareCounter counter )
+{ return ::available[counter]; }
+
+HardwareCounts ReadHardwareCounters()
+{
+    HardwareCounts counts;
+    if( ::counting && OnMasterThread() )
+        ReadOpenCounters( counts );
+    counts += ::closedCounts;
+    return counts;
+}
+
+} // namespace El
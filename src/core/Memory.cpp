@@ -0,0 +1,439 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El-lite.hpp>
+
+#include <algorithm>
+#include <limits>
+#include <map>
+#include <mutex>
+#ifdef __linux__
+# include <sys/mman.h>
+#endif
+
+namespace {
+
+using El::size_t;
+
+// Every buffer is preceded by a header (padded to the buffer's alignment)
+// which records how to return the buffer either to the pool or to the system
+struct Header
+{
+    void* raw;           // The address returned by std::malloc
+    size_t capacity;     // The number of usable bytes after the header
+    size_t alignment;    // The alignment of the usable bytes
+};
+
+struct OpenRegion
+{
+    const char* name;
+    size_t entryBytes;
+    // The high-water mark of the enclosing region upon entry
+    size_t outerPeakBytes;
+};
+
+struct Pool
+{
+    std::mutex mutex;
+    El::MemoryCtrl ctrl;
+    El::MemoryStats stats;
+    // Map from (alignment,capacity) to the list of freed buffers
+    std::map<std::pair<size_t,size_t>,std::vector<Header*>> freeLists;
+
+    double budget=std::numeric_limits<double>::infinity();
+
+    // The high-water mark of the live bytes within the innermost open region
+    // (the flag is atomic so that it may be queried without the lock)
+    std::atomic<bool> tracking{false};
+    size_t scopedPeakBytes=0;
+    std::vector<OpenRegion> openRegions;
+    std::map<std::string,El::MemoryRegionStats> regions;
+};
+
+// The pool is intentionally never destroyed so that objects with static
+// storage duration may safely release their buffers after main has returned
+Pool& GetPool()
+{
+    static Pool* pool = new Pool;
+    return *pool;
+}
+
+size_t RoundUp( size_t n, size_t alignment )
+{ return ((n+alignment-1)/alignment)*alignment; }
+
+bool IsPowerOfTwo( size_t n )
+{ return n != 0 && (n & (n-1)) == 0; }
+
+// Round the request up to one of four size classes per power of two so that
+// the pool wastes at most 25% of each buffer
+size_t SizeClass( size_t numBytes )
+{
+    if( numBytes <= 256 )
+        return 256;
+    size_t power = 1;
+    while( power < numBytes )
+        power <<= 1;
+    const size_t quantum = power >> 3;
+    return RoundUp( numBytes, quantum );
+}
+
+size_t EffectiveAlignment( const El::MemoryCtrl& ctrl, size_t numBytes )
+{
+    size_t alignment = std::max( ctrl.alignment, alignof(Header) );
+    alignment = std::max( alignment, alignof(std::max_align_t) );
+    if( ctrl.hugePages && numBytes >= ctrl.hugePageBytes )
+        alignment = std::max( alignment, ctrl.hugePageBytes );
+    return alignment;
+}
+
+size_t HeaderBytes( size_t alignment )
+{ return RoundUp( sizeof(Header), alignment ); }
+
+void FirstTouch( El::byte* buffer, size_t numBytes )
+{
+#ifdef EL_HYBRID
+    const long long pageSize = 4096;
+    const long long numPages = (numBytes+pageSize-1) / pageSize;
+    #pragma omp parallel for schedule(static)
+    for( long long page=0; page<numPages; ++page )
+        buffer[page*pageSize] = 0;
+#endif
+}
+
+Header* SystemAllocate( size_t capacity, size_t alignment, bool hugePages )
+{
+    const size_t headerBytes = HeaderBytes( alignment );
+    const size_t totalBytes = headerBytes + capacity + alignment;
+    void* raw = std::malloc( totalBytes );
+    if( raw == nullptr )
+        throw std::bad_alloc();
+
+    const size_t rawAddress = reinterpret_cast<size_t>(raw);
+    const size_t bufferAddress = RoundUp( rawAddress+headerBytes, alignment );
+    El::byte* buffer = reinterpret_cast<El::byte*>(bufferAddress);
+    Header* header = reinterpret_cast<Header*>(buffer-sizeof(Header));
+    header->raw = raw;
+    header->capacity = capacity;
+    header->alignment = alignment;
+
+#ifdef __linux__
+# ifdef MADV_HUGEPAGE
+    if( hugePages )
+        madvise( buffer, capacity, MADV_HUGEPAGE );
+# endif
+#endif
+    return header;
+}
+
+El::byte* UserBuffer( Header* header )
+{ return reinterpret_cast<El::byte*>(header) + sizeof(Header); }
+
+Header* GetHeader( void* ptr )
+{
+    El::byte* buffer = static_cast<El::byte*>(ptr);
+    return reinterpret_cast<Header*>(buffer-sizeof(Header));
+}
+
+void AddLiveBytes( Pool& pool, size_t numBytes )
+{
+    El::MemoryStats& stats = pool.stats;
+    stats.liveBytes += numBytes;
+    stats.peakBytes = std::max( stats.peakBytes, stats.liveBytes );
+    if( pool.tracking )
+        pool.scopedPeakBytes =
+          std::max( pool.scopedPeakBytes, stats.liveBytes );
+}
+
+void ReportFailedAllocation( Pool& pool, size_t numBytes )
+{
+    std::lock_guard<std::mutex> guard( pool.mutex );
+    if( !pool.tracking )
+        return;
+    std::ostringstream os;
+    os << "Process " << El::mpi::Rank(El::mpi::COMM_WORLD)
+       << " failed to allocate " << numBytes << " bytes with "
+       << pool.stats.liveBytes << " bytes live within the regions:\n";
+    for( const OpenRegion& region : pool.openRegions )
+        os << "  " << region.name << " (+"
+           << pool.stats.liveBytes-std::min(pool.stats.liveBytes,
+                                            region.entryBytes)
+           << " bytes)\n";
+    std::cerr << os.str() << std::flush;
+}
+
+void ReleaseAll( Pool& pool )
+{
+    for( auto& entry : pool.freeLists )
+    {
+        for( Header* header : entry.second )
+        {
+            pool.stats.freedBytes += header->capacity;
+            ++pool.stats.numFrees;
+            std::free( header->raw );
+        }
+    }
+    pool.freeLists.clear();
+    pool.stats.pooledBytes = 0;
+}
+
+} // anonymous namespace
+
+namespace El {
+
+void SetMemoryCtrl( const MemoryCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    if( !IsPowerOfTwo(ctrl.alignment) )
+        LogicError("Memory alignment must be a power of two");
+    if( ctrl.hugePages && !IsPowerOfTwo(ctrl.hugePageBytes) )
+        LogicError("Huge page size must be a power of two");
+    Pool& pool = GetPool();
+    std::lock_guard<std::mutex> guard( pool.mutex );
+    if( !ctrl.pool || ctrl.maxPoolBytes < pool.stats.pooledBytes )
+        ReleaseAll( pool );
+    pool.ctrl = ctrl;
+}
+
+MemoryCtrl GetMemoryCtrl()
+{
+    Pool& pool = GetPool();
+    std::lock_guard<std::mutex> guard( pool.mutex );
+    return pool.ctrl;
+}
+
+MemoryStats GetMemoryStats()
+{
+    Pool& pool = GetPool();
+    std::lock_guard<std::mutex> guard( pool.mutex );
+    return pool.stats;
+}
+
+void ResetMemoryStats()
+{
+    Pool& pool = GetPool();
+    std::lock_guard<std::mutex> guard( pool.mutex );
+    const size_t pooledBytes = pool.stats.pooledBytes;
+    const size_t liveBytes = pool.stats.liveBytes;
+    pool.stats = MemoryStats();
+    pool.stats.pooledBytes = pooledBytes;
+    pool.stats.liveBytes = liveBytes;
+    pool.stats.peakBytes = liveBytes;
+}
+
+void PurgeMemoryPool()
+{
+    Pool& pool = GetPool();
+    std::lock_guard<std::mutex> guard( pool.mutex );
+    ReleaseAll( pool );
+}
+
+void EnableMemoryTracking()
+{
+    Pool& pool = GetPool();
+    std::lock_guard<std::mutex> guard( pool.mutex );
+    if( pool.tracking )
+        return;
+    pool.openRegions.clear();
+    pool.scopedPeakBytes = pool.stats.liveBytes;
+    pool.tracking = true;
+}
+
+void DisableMemoryTracking()
+{
+    Pool& pool = GetPool();
+    std::lock_guard<std::mutex> guard( pool.mutex );
+    pool.tracking = false;
+    pool.openRegions.clear();
+}
+
+bool TrackingMemory() { return GetPool().tracking; }
+
+void ResetMemoryRegions()
+{
+    Pool& pool = GetPool();
+    std::lock_guard<std::mutex> guard( pool.mutex );
+    pool.regions.clear();
+}
+
+vector<pair<string,MemoryRegionStats>> GetMemoryRegionStats()
+{
+    Pool& pool = GetPool();
+    std::lock_guard<std::mutex> guard( pool.mutex );
+    auto regions = pool.regions;
+
+    // Fold in the elapsed portions of the open regions (from the innermost
+    // outwards, so that each inherits the high-water marks of its children)
+    const size_t liveBytes = pool.stats.liveBytes;
+    size_t peakBytes = pool.scopedPeakBytes;
+    for( auto it=pool.openRegions.rbegin(); it!=pool.openRegions.rend(); ++it )
+    {
+        MemoryRegionStats& stats = regions[it->name];
+        stats.peakBytes =
+          Max( stats.peakBytes, peakBytes-Min(peakBytes,it->entryBytes) );
+        stats.peakLiveBytes = Max( stats.peakLiveBytes, peakBytes );
+        stats.currentBytes = liveBytes-Min(liveBytes,it->entryBytes);
+        peakBytes = Max( peakBytes, it->outerPeakBytes );
+    }
+    return vector<pair<string,MemoryRegionStats>>
+      ( regions.begin(), regions.end() );
+}
+
+void PrintMemoryRegions( ostream& os )
+{
+    os << "Memory high-water marks of process "
+       << mpi::Rank(mpi::COMM_WORLD) << "\n";
+    for( const auto& region : GetMemoryRegionStats() )
+    {
+        const MemoryRegionStats& stats = region.second;
+        os << region.first << ": " << stats.numEntries << " entries, peak of "
+           << stats.peakBytes << " bytes (" << stats.peakLiveBytes
+           << " live)";
+        if( stats.currentBytes > 0 )
+            os << ", currently " << stats.currentBytes << " bytes";
+        os << "\n";
+    }
+}
+
+void SetMemoryBudget( double numBytes )
+{
+    EL_DEBUG_CSE
+    if( numBytes < 0 )
+        LogicError("The memory budget must be non-negative");
+    Pool& pool = GetPool();
+    std::lock_guard<std::mutex> guard( pool.mutex );
+    pool.budget = numBytes;
+}
+
+double MemoryBudget()
+{
+    Pool& pool = GetPool();
+    std::lock_guard<std::mutex> guard( pool.mutex );
+    return pool.budget;
+}
+
+double AvailableMemory()
+{
+    Pool& pool = GetPool();
+    std::lock_guard<std::mutex> guard( pool.mutex );
+    return Max( pool.budget-double(pool.stats.liveBytes), 0. );
+}
+
+namespace memory {
+
+void* Allocate( size_t numBytes )
+{
+    Pool& pool = GetPool();
+    MemoryCtrl ctrl;
+    size_t capacity, alignment;
+    {
+        std::lock_guard<std::mutex> guard( pool.mutex );
+        ctrl = pool.ctrl;
+        numBytes = Max( numBytes, size_t(1) );
+        capacity = ( ctrl.pool ? SizeClass(numBytes) : numBytes );
+        alignment = EffectiveAlignment( ctrl, capacity );
+        if( ctrl.pool )
+        {
+            auto key = std::make_pair( alignment, capacity );
+            auto it = pool.freeLists.find( key );
+            if( it != pool.freeLists.end() && !it->second.empty() )
+            {
+                Header* header = it->second.back();
+                it->second.pop_back();
+                pool.stats.pooledBytes -= capacity;
+                pool.stats.recycledBytes += capacity;
+                ++pool.stats.numRecycles;
+                AddLiveBytes( pool, capacity );
+                return UserBuffer( header );
+            }
+        }
+    }
+
+    const bool hugePages =
+      ctrl.hugePages && capacity >= ctrl.hugePageBytes;
+    Header* header;
+    try { header = SystemAllocate( capacity, alignment, hugePages ); }
+    catch( std::bad_alloc& )
+    {
+        ReportFailedAllocation( pool, capacity );
+        throw;
+    }
+    byte* buffer = UserBuffer( header );
+    if( ctrl.firstTouch )
+        FirstTouch( buffer, capacity );
+    {
+        std::lock_guard<std::mutex> guard( pool.mutex );
+        pool.stats.allocatedBytes += capacity;
+        ++pool.stats.numAllocations;
+        AddLiveBytes( pool, capacity );
+    }
+    return buffer;
+}
+
+void Deallocate( void* ptr )
+{
+    if( ptr == nullptr )
+        return;
+    Header* header = GetHeader( ptr );
+    Pool& pool = GetPool();
+    {
+        std::lock_guard<std::mutex> guard( pool.mutex );
+        const MemoryCtrl& ctrl = pool.ctrl;
+        const size_t capacity = header->capacity;
+        pool.stats.liveBytes -= capacity;
+        // Only buffers whose capacity and alignment exactly match a size
+        // class of the current configuration are eligible for reuse
+        if( ctrl.pool &&
+            capacity == SizeClass(capacity) &&
+            header->alignment == EffectiveAlignment(ctrl,capacity) &&
+            pool.stats.pooledBytes+capacity <= ctrl.maxPoolBytes )
+        {
+            pool.freeLists[std::make_pair(header->alignment,capacity)]
+              .push_back( header );
+            pool.stats.pooledBytes += capacity;
+            return;
+        }
+        pool.stats.freedBytes += capacity;
+        ++pool.stats.numFrees;
+    }
+    std::free( header->raw );
+}
+
+void PushRegion( const char* name )
+{
+    Pool& pool = GetPool();
+    std::lock_guard<std::mutex> guard( pool.mutex );
+    if( !pool.tracking )
+        return;
+    OpenRegion region;
+    region.name = name;
+    region.entryBytes = pool.stats.liveBytes;
+    region.outerPeakBytes = pool.scopedPeakBytes;
+    pool.openRegions.push_back( region );
+    pool.scopedPeakBytes = pool.stats.liveBytes;
+}
+
+void PopRegion()
+{
+    Pool& pool = GetPool();
+    std::lock_guard<std::mutex> guard( pool.mutex );
+    if( !pool.tracking || pool.openRegions.empty() )
+        return;
+    const OpenRegion region = pool.openRegions.back();
+    pool.openRegions.pop_back();
+    MemoryRegionStats& stats = pool.regions[region.name];
+    ++stats.numEntries;
+    const size_t peakBytes = pool.scopedPeakBytes;
+    stats.peakBytes =
+      Max( stats.peakBytes, peakBytes-Min(peakBytes,region.entryBytes) );
+    stats.peakLiveBytes = Max( stats.peakLiveBytes, peakBytes );
+    pool.scopedPeakBytes = Max( peakBytes, region.outerPeakBytes );
+}
+
+} // namespace memory
+
+} // namespace El
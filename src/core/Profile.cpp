@@ -0,0 +1,563 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El-lite.hpp>
+
+#include <limits>
+#include <map>
+#include <set>
+
+namespace {
+
+struct CommStats
+{
+    long long numCalls=0;
+    double bytes=0, seconds=0;
+};
+
+struct RegionStats
+{
+    double flops=0;
+    long long numProxyCopies=0;
+    double proxyBytes=0;
+    El::HardwareCounts counters;
+    // Map from the (routine,communicator) pair to its statistics
+    std::map<std::pair<std::string,std::string>,CommStats> comms;
+};
+
+bool profiling = false;
+std::string profilePrefix = "ElProfile";
+std::vector<const char*> regionStack;
+std::map<std::string,RegionStats> regions;
+int commDepth = 0;
+// The hardware counts when they were last attributed to a region
+El::HardwareCounts lastCounters;
+
+struct TraceEvent
+{
+    const char* name;
+    double begin, end;
+};
+
+struct ThreadTrace
+{
+    // The regions which have begun but not yet ended
+    std::vector<std::pair<const char*,double>> open;
+    // A ring buffer of the most recently completed regions
+    std::vector<TraceEvent> events;
+    size_t next=0;
+    long long numDropped=0;
+};
+
+bool tracing = false;
+bool traced = false;
+size_t traceCapacity = 0;
+double traceStart = 0;
+std::string tracePrefix = "ElTrace";
+std::vector<ThreadTrace> threadTraces;
+
+int ThreadIndex()
+{
+#ifdef EL_HYBRID
+    return omp_get_thread_num();
+#else
+    return 0;
+#endif
+}
+
+bool OnMasterThread() { return ThreadIndex() == 0; }
+
+ThreadTrace* ActiveTrace()
+{
+    const int thread = ThreadIndex();
+    if( !::tracing || thread >= int(::threadTraces.size()) )
+        return nullptr;
+    return &::threadTraces[thread];
+}
+
+// Region names are identifiers, but guard against quotes and backslashes
+void PrintJSONString( std::ostream& os, const char* str )
+{
+    os << '"';
+    for( const char* c=str; *c!='\0'; ++c )
+    {
+        if( *c == '"' || *c == '\\' )
+            os << '\\';
+        os << *c;
+    }
+    os << '"';
+}
+
+RegionStats& ActiveRegion()
+{
+    const char* name = El::ProfileRegionName();
+    return ::regions[name];
+}
+
+// Attribute the hardware counts since the last change of the innermost
+// region to said region
+void ChargeCounters()
+{
+    if( !::profiling || !OnMasterThread() )
+        return;
+    const El::HardwareCounts counters = El::ReadHardwareCounters();
+    if( counters.values == ::lastCounters.values )
+        return;
+    ActiveRegion().counters += counters - ::lastCounters;
+    ::lastCounters = counters;
+}
+
+// Label communicators by their name (e.g., "MC" for the process columns of a
+// grid) and their size
+std::string CommLabel( El::mpi::Comm comm )
+{
+    if( comm == El::mpi::COMM_NULL )
+        return "COMM_NULL";
+    char name[MPI_MAX_OBJECT_NAME];
+    int nameLength = 0;
+    MPI_Comm_get_name( comm.comm, name, &nameLength );
+    std::ostringstream os;
+    if( nameLength > 0 )
+        os << name;
+    else
+        os << "comm";
+    os << "(" << El::mpi::Size(comm) << ")";
+    return os.str();
+}
+
+// The union of the region names of every process of the communicator
+std::vector<std::string> GlobalRegionNames
+( const std::vector<std::string>& localNames, El::mpi::Comm comm )
+{
+    const int commSize = El::mpi::Size( comm );
+    std::string packedNames;
+    for( const auto& name : localNames )
+        packedNames += name + '\n';
+    const int localSize = packedNames.size();
+    std::vector<int> sizes(commSize), offsets(commSize);
+    El::mpi::AllGather( &localSize, 1, sizes.data(), 1, comm );
+    int totalSize = 0;
+    for( int q=0; q<commSize; ++q )
+    {
+        offsets[q] = totalSize;
+        totalSize += sizes[q];
+    }
+    std::vector<El::byte> allNames( totalSize );
+    El::mpi::AllGather
+    ( reinterpret_cast<const El::byte*>(packedNames.data()), localSize,
+      allNames.data(), sizes.data(), offsets.data(), comm );
+    std::set<std::string> nameSet;
+    std::string name;
+    for( const El::byte& character : allNames )
+    {
+        if( character == '\n' )
+        {
+            nameSet.insert( name );
+            name.clear();
+        }
+        else
+            name += char(character);
+    }
+    return std::vector<std::string>( nameSet.begin(), nameSet.end() );
+}
+
+} // anonymous namespace
+
+namespace El {
+
+void EnableProfiling()
+{
+    ::lastCounters = ReadHardwareCounters();
+    ::profiling = true;
+}
+void DisableProfiling() { ::profiling = false; }
+bool Profiling() { return ::profiling; }
+
+void ResetProfile()
+{
+    ::regions.clear();
+    ::lastCounters = ReadHardwareCounters();
+}
+
+void SetProfilePrefix( const string& prefix ) { ::profilePrefix = prefix; }
+const string& ProfilePrefix() { return ::profilePrefix; }
+
+void EnableProfileTracing( Int capacity )
+{
+    if( capacity <= 0 )
+        LogicError("Invalid trace capacity of ",capacity);
+#ifdef EL_HYBRID
+    const int numThreads = omp_get_max_threads();
+#else
+    const int numThreads = 1;
+#endif
+    ::threadTraces.clear();
+    ::threadTraces.resize( numThreads );
+    ::traceCapacity = capacity;
+    ::traceStart = mpi::Time();
+    ::tracing = true;
+    ::traced = true;
+}
+
+void DisableProfileTracing() { ::tracing = false; }
+bool ProfileTracing() { return ::tracing; }
+
+void SetTracePrefix( const string& prefix ) { ::tracePrefix = prefix; }
+const string& TracePrefix() { return ::tracePrefix; }
+
+void PushProfileRegion( const char* name )
+{
+    ChargeCounters();
+    if( OnMasterThread() )
+    {
+        ::regionStack.push_back( name );
+        if( TrackingMemory() )
+            memory::PushRegion( name );
+    }
+    ThreadTrace* trace = ActiveTrace();
+    if( trace != nullptr )
+        trace->open.emplace_back( name, mpi::Time() );
+}
+
+void PopProfileRegion()
+{
+    ThreadTrace* trace = ActiveTrace();
+    if( trace != nullptr && !trace->open.empty() )
+    {
+        TraceEvent event;
+        event.name = trace->open.back().first;
+        event.begin = trace->open.back().second;
+        event.end = mpi::Time();
+        trace->open.pop_back();
+        if( trace->events.size() < ::traceCapacity )
+        {
+            trace->events.push_back( event );
+        }
+        else
+        {
+            trace->events[trace->next] = event;
+            ++trace->numDropped;
+        }
+        trace->next = (trace->next+1) % ::traceCapacity;
+    }
+
+    if( !OnMasterThread() )
+        return;
+    if( ::regionStack.empty() )
+        LogicError("Attempted to pop an empty profiling region stack");
+    ChargeCounters();
+    if( TrackingMemory() )
+        memory::PopRegion();
+    ::regionStack.pop_back();
+}
+
+const char* ProfileRegionName()
+{ return ( ::regionStack.empty() ? "[top]" : ::regionStack.back() ); }
+
+void PrintProfile( ostream& os )
+{
+    os << "Profile of process " << mpi::Rank(mpi::COMM_WORLD) << " of "
+       << mpi::Size(mpi::COMM_WORLD) << "\n";
+    for( const auto& region : ::regions )
+    {
+        const RegionStats& stats = region.second;
+        os << region.first << ": " << stats.flops << " flops\n";
+        if( stats.numProxyCopies > 0 )
+            os << "  proxy copies: " << stats.numProxyCopies << " copies, "
+               << stats.proxyBytes << " bytes\n";
+        bool counted = false;
+        for( int counter=0; counter<NUM_HARDWARE_COUNTERS; ++counter )
+            counted = counted || stats.counters.values[counter] != 0;
+        if( counted )
+        {
+            os << "  hardware counters:";
+            for( int counter=0; counter<NUM_HARDWARE_COUNTERS; ++counter )
+                if( HardwareCounterAvailable(HardwareCounter(counter)) )
+                    os << " " << stats.counters.values[counter] << " "
+                       << HardwareCounterName(HardwareCounter(counter))
+                       << ",";
+            os << " ~" << stats.counters.MemoryBytes() << " memory bytes\n";
+        }
+        for( const auto& entry : stats.comms )
+        {
+            const CommStats& comm = entry.second;
+            os << "  " << entry.first.first << " over " << entry.first.second
+               << ": " << comm.numCalls << " calls, " << comm.bytes
+               << " bytes, " << comm.seconds << " seconds\n";
+        }
+    }
+    if( TrackingMemory() )
+        PrintMemoryRegions( os );
+}
+
+ProfileTotals GetProfileTotals()
+{
+    ProfileTotals totals;
+    for( const auto& region : ::regions )
+    {
+        const RegionStats& stats = region.second;
+        totals.flops += stats.flops;
+        totals.numProxyCopies += stats.numProxyCopies;
+        totals.proxyBytes += stats.proxyBytes;
+        totals.counters += stats.counters;
+        for( const auto& entry : stats.comms )
+        {
+            totals.numCommCalls += entry.second.numCalls;
+            totals.commBytes += entry.second.bytes;
+            totals.commSeconds += entry.second.seconds;
+        }
+    }
+    return totals;
+}
+
+// The timestamps are in microseconds relative to the call to
+// EnableProfileTracing
+void PrintTrace( ostream& os )
+{
+    const int rank = mpi::Rank(mpi::COMM_WORLD);
+    long long numDropped = 0;
+    os << "{\"traceEvents\":[\n"
+       << "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":" << rank
+       << ",\"args\":{\"name\":\"rank " << rank << "\"}}";
+    os.precision( 15 );
+    for( size_t thread=0; thread<::threadTraces.size(); ++thread )
+    {
+        const ThreadTrace& trace = ::threadTraces[thread];
+        numDropped += trace.numDropped;
+        // Once the ring buffer has wrapped around, the oldest event is next
+        const size_t numEvents = trace.events.size();
+        const size_t first = ( trace.numDropped > 0 ? trace.next : 0 );
+        for( size_t k=0; k<numEvents; ++k )
+        {
+            const TraceEvent& event = trace.events[(first+k)%numEvents];
+            os << ",\n{\"name\":";
+            PrintJSONString( os, event.name );
+            os << ",\"cat\":\"El\",\"ph\":\"X\",\"pid\":" << rank
+               << ",\"tid\":" << thread
+               << ",\"ts\":" << 1e6*(event.begin-::traceStart)
+               << ",\"dur\":" << 1e6*(event.end-event.begin) << "}";
+        }
+    }
+    os << "\n],\"displayTimeUnit\":\"ms\","
+       << "\"otherData\":{\"droppedEvents\":" << numDropped << "}}\n";
+}
+
+namespace profile {
+
+void RecordCommunication
+( const char* routine, mpi::Comm comm, double bytes, double seconds )
+{
+    if( !::profiling || !OnMasterThread() )
+        return;
+    CommStats& stats =
+      ActiveRegion().comms[std::make_pair(string(routine),CommLabel(comm))];
+    ++stats.numCalls;
+    stats.bytes += bytes;
+    stats.seconds += seconds;
+}
+
+void RecordFlops( double flops )
+{
+    if( !::profiling || !OnMasterThread() )
+        return;
+    ActiveRegion().flops += flops;
+}
+
+void RecordProxyCopy( double bytes )
+{
+    if( !::profiling || !OnMasterThread() )
+        return;
+    RegionStats& stats = ActiveRegion();
+    ++stats.numProxyCopies;
+    stats.proxyBytes += bytes;
+}
+
+CommScope::CommScope( const char* routine, mpi::Comm comm, double bytes )
+: counted_(::profiling && OnMasterThread()), recording_(false),
+  routine_(routine), comm_(comm), bytes_(bytes)
+{
+    if( !counted_ )
+        return;
+    recording_ = ( ::commDepth++ == 0 );
+    if( recording_ )
+        startTime_ = mpi::Time();
+}
+
+CommScope::~CommScope()
+{
+    if( !counted_ )
+        return;
+    --::commDepth;
+    if( recording_ )
+        RecordCommunication( routine_, comm_, bytes_, mpi::Time()-startTime_ );
+}
+
+// Write this process's report (called by Finalize)
+void WriteReport()
+{
+    if( !::profiling )
+        return;
+    std::ostringstream filename;
+    filename << ::profilePrefix << "-" << mpi::Rank(mpi::COMM_WORLD)
+             << ".txt";
+    std::ofstream file( filename.str().c_str() );
+    if( !file.is_open() )
+        RuntimeError("Could not open ",filename.str());
+    PrintProfile( file );
+}
+
+// Write this process's timeline (called by Finalize)
+void WriteTrace()
+{
+    if( !::traced )
+        return;
+    std::ostringstream filename;
+    filename << ::tracePrefix << "-" << mpi::Rank(mpi::COMM_WORLD) << ".json";
+    std::ofstream file( filename.str().c_str() );
+    if( !file.is_open() )
+        RuntimeError("Could not open ",filename.str());
+    PrintTrace( file );
+}
+
+// Write the minimum, average, and maximum hardware counts of each region
+// over the processes which entered it (called collectively by Finalize)
+void WriteCounterSummary()
+{
+    if( !::profiling || !HardwareCounting() )
+        return;
+    ChargeCounters();
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const int commRank = mpi::Rank( comm );
+    const int commSize = mpi::Size( comm );
+
+    vector<string> localNames;
+    for( const auto& region : ::regions )
+        localNames.push_back( region.first );
+    const vector<string> names = GlobalRegionNames( localNames, comm );
+
+    // The last entry of each region counts the processes which entered it
+    const int numRegions = names.size();
+    const int numEntries = NUM_HARDWARE_COUNTERS+1;
+    const double inf = std::numeric_limits<double>::infinity();
+    vector<double> mins(numRegions*numEntries,inf),
+                   maxs(numRegions*numEntries,-inf),
+                   sums(numRegions*numEntries,0);
+    for( int r=0; r<numRegions; ++r )
+    {
+        auto it = ::regions.find( names[r] );
+        if( it == ::regions.end() )
+            continue;
+        for( int counter=0; counter<NUM_HARDWARE_COUNTERS; ++counter )
+        {
+            const double value = it->second.counters.values[counter];
+            mins[counter+r*numEntries] = value;
+            maxs[counter+r*numEntries] = value;
+            sums[counter+r*numEntries] = value;
+        }
+        sums[NUM_HARDWARE_COUNTERS+r*numEntries] = 1;
+    }
+    const int count = numRegions*numEntries;
+    vector<double> globalMins(count), globalMaxs(count), globalSums(count);
+    mpi::Reduce( mins.data(), globalMins.data(), count, mpi::MIN, 0, comm );
+    mpi::Reduce( maxs.data(), globalMaxs.data(), count, mpi::MAX, 0, comm );
+    mpi::Reduce( sums.data(), globalSums.data(), count, mpi::SUM, 0, comm );
+    if( commRank != 0 )
+        return;
+
+    std::ostringstream filename;
+    filename << ::profilePrefix << "-counters.txt";
+    std::ofstream file( filename.str().c_str() );
+    if( !file.is_open() )
+        RuntimeError("Could not open ",filename.str());
+    file << "Hardware counters (min / avg / max over the processes which "
+         << "entered each region) of " << commSize << " processes\n";
+    for( int r=0; r<numRegions; ++r )
+    {
+        const double numEntered =
+          globalSums[NUM_HARDWARE_COUNTERS+r*numEntries];
+        file << names[r] << " (" << numEntered << " processes):\n";
+        for( int counter=0; counter<NUM_HARDWARE_COUNTERS; ++counter )
+        {
+            if( !HardwareCounterAvailable(HardwareCounter(counter)) )
+                continue;
+            const int entry = counter + r*numEntries;
+            file << "  " << HardwareCounterName(HardwareCounter(counter))
+                 << ": " << globalMins[entry] << " / "
+                 << globalSums[entry]/numEntered << " / "
+                 << globalMaxs[entry] << "\n";
+        }
+    }
+}
+
+// Write the peak workspace of each region over the processes which entered
+// it (called collectively by Finalize)
+void WriteMemorySummary()
+{
+    if( !TrackingMemory() )
+        return;
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const int commRank = mpi::Rank( comm );
+    const int commSize = mpi::Size( comm );
+    const auto localStats = GetMemoryRegionStats();
+    vector<string> localNames;
+    for( const auto& region : localStats )
+        localNames.push_back( region.first );
+    const vector<string> names = GlobalRegionNames( localNames, comm );
+
+    // Each region gathers the peak bytes, the peak live bytes, and the
+    // number of processes which entered it
+    const int numRegions = names.size();
+    vector<double> peaks(3*numRegions,0), globalPeaks(3*numRegions),
+                   sums(3*numRegions,0), globalSums(3*numRegions);
+    auto localIt = localStats.begin();
+    for( int r=0; r<numRegions; ++r )
+    {
+        // Both lists of names are sorted
+        if( localIt == localStats.end() || localIt->first != names[r] )
+            continue;
+        const MemoryRegionStats& stats = localIt->second;
+        peaks[3*r] = sums[3*r] = stats.peakBytes;
+        peaks[3*r+1] = sums[3*r+1] = stats.peakLiveBytes;
+        sums[3*r+2] = 1;
+        ++localIt;
+    }
+    mpi::AllReduce
+    ( peaks.data(), globalPeaks.data(), 3*numRegions, mpi::MAX, comm );
+    mpi::Reduce
+    ( sums.data(), globalSums.data(), 3*numRegions, mpi::SUM, 0, comm );
+
+    // Find the smallest rank achieving each maximum peak
+    vector<int> owners(numRegions,commSize), globalOwners(numRegions);
+    for( int r=0; r<numRegions; ++r )
+        if( sums[3*r+2] != 0 && peaks[3*r] == globalPeaks[3*r] )
+            owners[r] = commRank;
+    mpi::Reduce
+    ( owners.data(), globalOwners.data(), numRegions, mpi::MIN, 0, comm );
+    if( commRank != 0 )
+        return;
+
+    std::ostringstream filename;
+    filename << ::profilePrefix << "-memory.txt";
+    std::ofstream file( filename.str().c_str() );
+    if( !file.is_open() )
+        RuntimeError("Could not open ",filename.str());
+    file << "Peak workspace (max / avg over the processes which entered each "
+         << "region) of " << commSize << " processes\n";
+    for( int r=0; r<numRegions; ++r )
+    {
+        const double numEntered = globalSums[3*r+2];
+        file << names[r] << " (" << numEntered << " processes): "
+             << globalPeaks[3*r] << " / " << globalSums[3*r]/numEntered
+             << " bytes (max on process " << globalOwners[r]
+             << "), max live " << globalPeaks[3*r+1] << " bytes\n";
+    }
+}
+
+} // namespace profile
+
+} // namespace El
@@ -0,0 +1,239 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+namespace El {
+
+template<typename T>
+RmaInterface<T>::RmaInterface( ElementalMatrix<T>& A )
+{ Attach( A ); }
+
+template<typename T>
+RmaInterface<T>::RmaInterface( const ElementalMatrix<T>& A )
+{ Attach( A ); }
+
+template<typename T>
+RmaInterface<T>::~RmaInterface()
+{
+    // Detaching is collective, so it is skipped while unwinding an exception
+    if( Attached() && !mpi::Finalized() && !uncaught_exception() )
+        Detach();
+}
+
+template<typename T>
+void RmaInterface<T>::AttachBuffer( const ElementalMatrix<T>& A )
+{
+    EL_DEBUG_CSE
+    if( Attached() )
+        Detach();
+    A_ = &A;
+    const Grid& g = A.Grid();
+    if( !g.InGrid() )
+        return;
+    mpi::Comm comm = g.VCComm();
+
+    const bool participating = A.Participating();
+    const int ldim = A.LDim();
+    ldims_.resize( mpi::Size(comm) );
+    mpi::AllGather( &ldim, 1, ldims_.data(), 1, comm );
+
+    const Int localSize =
+      ( participating ? Int(A.LDim())*A.LocalWidth() : Int(0) );
+    mpi::Create
+    ( const_cast<T*>(A.LockedBuffer()), localSize, comm, window_ );
+    mpi::LockAll( window_ );
+}
+
+template<typename T>
+void RmaInterface<T>::Attach( ElementalMatrix<T>& A )
+{
+    EL_DEBUG_CSE
+    if( A.Locked() )
+        LogicError("Cannot attach a locked view for updates");
+    AttachBuffer( A );
+    mutable_ = true;
+}
+
+template<typename T>
+void RmaInterface<T>::Attach( const ElementalMatrix<T>& A )
+{
+    EL_DEBUG_CSE
+    AttachBuffer( A );
+    mutable_ = false;
+}
+
+template<typename T>
+void RmaInterface<T>::Detach()
+{
+    EL_DEBUG_CSE
+    if( !Attached() )
+        return;
+    if( A_->Grid().InGrid() )
+    {
+        mpi::UnlockAll( window_ );
+        mpi::Free( window_ );
+    }
+    SwapClear( pending_ );
+    SwapClear( ldims_ );
+    A_ = nullptr;
+}
+
+template<typename T>
+void RmaInterface<T>::Transfer
+( TransferType type, T alpha, Matrix<T>& X, Int i, Int j )
+{
+    EL_DEBUG_CSE
+    if( !Attached() )
+        LogicError("Must attach a matrix before transferring entries");
+    if( type != RMA_GET && !mutable_ )
+        LogicError("Cannot update an immutable matrix");
+    const ElementalMatrix<T>& A = *A_;
+    const Int m = X.Height();
+    const Int n = X.Width();
+    if( i < 0 || j < 0 || i+m > A.Height() || j+n > A.Width() )
+        LogicError
+        ("Submatrix [",i,",",i+m,") x [",j,",",j+n,") is out of bounds of ",
+         A.Height()," x ",A.Width());
+    if( m == 0 || n == 0 || !A.Grid().InGrid() )
+        return;
+
+    const Grid& g = A.Grid();
+    const int colStride = A.ColStride();
+    const int rowStride = A.RowStride();
+    const int colAlign = A.ColAlign();
+    const int rowAlign = A.RowAlign();
+    const int numCopies = ( type == RMA_GET ? 1 : A.RedundantSize() );
+
+    // The entries of X are received into (or sent from) a contiguous buffer
+    // per owner, which is unpacked once all of the gets have completed
+    struct Block { Int iOff, jOff, mLoc, nLoc; vector<T> buffer; };
+    vector<Block> gets;
+    for( int rowOwner=0; rowOwner<colStride; ++rowOwner )
+    {
+        const Int iLocBeg = A.LocalRowOffset( i, rowOwner );
+        const Int mLoc = A.LocalRowOffset( i+m, rowOwner ) - iLocBeg;
+        if( mLoc == 0 )
+            continue;
+        const Int iOff =
+          Shift_( rowOwner, colAlign, colStride ) + iLocBeg*colStride - i;
+        for( int colOwner=0; colOwner<rowStride; ++colOwner )
+        {
+            const Int jLocBeg = A.LocalColOffset( j, colOwner );
+            const Int nLoc = A.LocalColOffset( j+n, colOwner ) - jLocBeg;
+            if( nLoc == 0 )
+                continue;
+            const Int jOff =
+              Shift_( colOwner, rowAlign, rowStride ) + jLocBeg*rowStride - j;
+
+            vector<T> buffer;
+            FastResize( buffer, mLoc*nLoc );
+            if( type != RMA_GET )
+            {
+                const T scale = ( type == RMA_PUT ? T(1) : alpha );
+                for( Int jLoc=0; jLoc<nLoc; ++jLoc )
+                    for( Int iLoc=0; iLoc<mLoc; ++iLoc )
+                        buffer[iLoc+jLoc*mLoc] =
+                          scale*X(iOff+iLoc*colStride,jOff+jLoc*rowStride);
+            }
+
+            const int distRank = rowOwner + colStride*colOwner;
+            for( int copy=0; copy<numCopies; ++copy )
+            {
+                const int vcRank =
+                  g.CoordsToVC
+                  (A.ColDist(),A.RowDist(),distRank,A.Root(),copy);
+                const int ldim = ldims_[vcRank];
+                const Int offset = iLocBeg + jLocBeg*ldim;
+                if( type == RMA_GET )
+                    mpi::StridedGet
+                    ( buffer.data(), mLoc, nLoc, vcRank, offset, ldim,
+                      window_ );
+                else if( type == RMA_PUT )
+                    mpi::StridedPut
+                    ( buffer.data(), mLoc, nLoc, vcRank, offset, ldim,
+                      window_ );
+                else
+                    mpi::StridedAccumulate
+                    ( buffer.data(), mLoc, nLoc, vcRank, offset, ldim,
+                      window_ );
+            }
+            if( type == RMA_GET )
+                gets.push_back( Block{iOff,jOff,mLoc,nLoc,std::move(buffer)} );
+            else
+                pending_.push_back( std::move(buffer) );
+        }
+    }
+
+    if( type == RMA_GET )
+    {
+        mpi::FlushLocalAll( window_ );
+        for( const auto& block : gets )
+            for( Int jLoc=0; jLoc<block.nLoc; ++jLoc )
+                for( Int iLoc=0; iLoc<block.mLoc; ++iLoc )
+                    X(block.iOff+iLoc*colStride,block.jOff+jLoc*rowStride) =
+                      block.buffer[iLoc+jLoc*block.mLoc];
+    }
+}
+
+template<typename T>
+void RmaInterface<T>::Get( Matrix<T>& X, Int i, Int j )
+{
+    EL_DEBUG_CSE
+    Transfer( RMA_GET, T(1), X, i, j );
+}
+
+template<typename T>
+void RmaInterface<T>::Put( const Matrix<T>& X, Int i, Int j )
+{
+    EL_DEBUG_CSE
+    Transfer( RMA_PUT, T(1), const_cast<Matrix<T>&>(X), i, j );
+}
+
+template<typename T>
+void RmaInterface<T>::Accumulate
+( T alpha, const Matrix<T>& X, Int i, Int j )
+{
+    EL_DEBUG_CSE
+    Transfer( RMA_ACCUMULATE, alpha, const_cast<Matrix<T>&>(X), i, j );
+}
+
+template<typename T>
+void RmaInterface<T>::Flush()
+{
+    EL_DEBUG_CSE
+    if( !Attached() )
+        LogicError("Must attach a matrix before flushing");
+    if( A_->Grid().InGrid() )
+        mpi::FlushAll( window_ );
+    SwapClear( pending_ );
+}
+
+template<typename T>
+void RmaInterface<T>::Synchronize()
+{
+    EL_DEBUG_CSE
+    if( !Attached() )
+        LogicError("Must attach a matrix before synchronizing");
+    if( !A_->Grid().InGrid() )
+        return;
+    Flush();
+    mpi::Barrier( A_->Grid().VCComm() );
+    mpi::Sync( window_ );
+}
+
+#define PROTO(T) template class RmaInterface<T>;
+
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGINT
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
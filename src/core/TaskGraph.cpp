@@ -0,0 +1,285 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+namespace El {
+
+namespace {
+
+void AddUnique( vector<Int>& list, Int value )
+{
+    if( std::find( list.begin(), list.end(), value ) == list.end() )
+        list.push_back( value );
+}
+
+// Assigns the processes of a grid of size p to the tasks of a wave, each of
+// which receives at least 'minProcs' processes, by repeatedly granting a
+// process to the task with the largest remaining cost per process
+vector<int> AssignProcesses
+( int p, int minProcs,
+  const vector<double>& costs, const vector<int>& maxProcs )
+{
+    const Int numTasks = costs.size();
+    vector<int> sizes( numTasks );
+    int numAssigned = 0;
+    for( Int t=0; t<numTasks; ++t )
+    {
+        sizes[t] = ( maxProcs[t] > 0 ? Min(minProcs,maxProcs[t]) : minProcs );
+        numAssigned += sizes[t];
+    }
+    while( numAssigned < p )
+    {
+        Int best = -1;
+        double bestRatio = 0;
+        for( Int t=0; t<numTasks; ++t )
+        {
+            if( maxProcs[t] > 0 && sizes[t] >= maxProcs[t] )
+                continue;
+            const double ratio = costs[t] / sizes[t];
+            if( best < 0 || ratio > bestRatio )
+            {
+                best = t;
+                bestRatio = ratio;
+            }
+        }
+        // The remaining processes idle if every task is at its limit
+        if( best < 0 )
+            break;
+        ++sizes[best];
+        ++numAssigned;
+    }
+    return sizes;
+}
+
+} // anonymous namespace
+
+TaskGraph::TaskGraph( const El::Grid& grid )
+: grid_(grid)
+{ }
+
+TaskGraph::~TaskGraph() { }
+
+TaskGraph::Handle TaskGraph::AddOperand( Operand* operand )
+{
+    EL_DEBUG_CSE
+    operands_.emplace_back( operand );
+    lastWriter_.push_back( -1 );
+    readers_.emplace_back();
+    return operands_.size()-1;
+}
+
+Int TaskGraph::AddTask
+( const string& name,
+  const vector<Handle>& inputs,
+  const vector<Handle>& outputs,
+  Task task,
+  double cost,
+  int maxProcesses )
+{
+    EL_DEBUG_CSE
+    const Handle numOperands = operands_.size();
+    for( const Handle& handle : inputs )
+        if( handle < 0 || handle >= numOperands )
+            LogicError("Invalid input handle ",handle," of task ",name);
+    for( const Handle& handle : outputs )
+        if( handle < 0 || handle >= numOperands )
+            LogicError("Invalid output handle ",handle," of task ",name);
+    if( cost <= 0 )
+        LogicError("The cost of task ",name," must be positive");
+    if( maxProcesses < 0 )
+        LogicError("The process limit of task ",name," must be non-negative");
+
+    const Int index = tasks_.size();
+    TaskNode node;
+    node.name = name;
+    node.inputs = inputs;
+    node.outputs = outputs;
+    node.task = std::move(task);
+    node.cost = cost;
+    node.maxProcesses = maxProcesses;
+
+    // Read-after-write dependencies
+    for( const Handle& handle : inputs )
+        if( lastWriter_[handle] >= 0 )
+            AddUnique( node.dependencies, lastWriter_[handle] );
+    // Write-after-write and write-after-read dependencies
+    for( const Handle& handle : outputs )
+    {
+        if( lastWriter_[handle] >= 0 )
+            AddUnique( node.dependencies, lastWriter_[handle] );
+        for( const Int& reader : readers_[handle] )
+            if( reader != index )
+                AddUnique( node.dependencies, reader );
+    }
+
+    for( const Handle& handle : inputs )
+        AddUnique( readers_[handle], index );
+    for( const Handle& handle : outputs )
+    {
+        lastWriter_[handle] = index;
+        readers_[handle].clear();
+    }
+
+    tasks_.push_back( std::move(node) );
+    return index;
+}
+
+const vector<Int>& TaskGraph::Dependencies( Int task ) const
+{
+    EL_DEBUG_CSE
+    if( task < 0 || task >= Int(tasks_.size()) )
+        LogicError("Invalid task index ",task);
+    return tasks_[task].dependencies;
+}
+
+const El::Grid& TaskGraph::GetSubgrid( int first, int size )
+{
+    EL_DEBUG_CSE
+    // Operands which already reside on the base grid need not move when a
+    // task is given all of its processes
+    if( first == 0 && size == grid_.Size() )
+        return grid_;
+    for( const auto& subgrid : subgrids_ )
+        if( subgrid.first == first && subgrid.size == size )
+            return *subgrid.grid;
+
+    mpi::Comm viewingComm = grid_.ViewingComm();
+    mpi::Group viewingGroup;
+    mpi::CommGroup( viewingComm, viewingGroup );
+    vector<int> ranks( size );
+    for( int q=0; q<size; ++q )
+        ranks[q] = grid_.VCToViewing( first+q );
+    mpi::Group owners;
+    mpi::Incl( viewingGroup, size, ranks.data(), owners );
+    const int height = El::Grid::DefaultHeight( size );
+    subgrids_.push_back
+    ( Subgrid{first,size,
+              unique_ptr<El::Grid>(new El::Grid(viewingComm,owners,height))} );
+    mpi::Free( owners );
+    mpi::Free( viewingGroup );
+    return *subgrids_.back().grid;
+}
+
+void TaskGraph::Execute( const TaskGraphCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    const int p = grid_.Size();
+    const int minProcs = Max( Min(ctrl.minProcesses,p), 1 );
+    const int maxWaveSize = p / minProcs;
+    const bool inGrid = grid_.InGrid();
+    const int vcRank = ( inGrid ? grid_.VCRank() : -1 );
+    const bool print = ctrl.progress && vcRank == 0;
+
+    const Int numTasks = tasks_.size();
+    vector<bool> done( numTasks, false );
+    for( Int t=0; t<numExecuted_; ++t )
+        done[t] = true;
+
+    // Since the schedule only depends upon the graph, every process computes
+    // the same sequence of waves
+    Int numDone = numExecuted_;
+    Int wave = 0;
+    vector<bool> busy( operands_.size() );
+    while( numDone < numTasks )
+    {
+        vector<Int> tasks;
+        std::fill( busy.begin(), busy.end(), false );
+        for( Int t=numExecuted_; t<numTasks; ++t )
+        {
+            if( Int(tasks.size()) == maxWaveSize )
+                break;
+            const TaskNode& node = tasks_[t];
+            if( done[t] )
+                continue;
+            bool ready = true;
+            for( const Int& dep : node.dependencies )
+                ready = ready && done[dep];
+            for( const Handle& handle : node.inputs )
+                ready = ready && !busy[handle];
+            for( const Handle& handle : node.outputs )
+                ready = ready && !busy[handle];
+            if( !ready )
+                continue;
+            for( const Handle& handle : node.inputs )
+                busy[handle] = true;
+            for( const Handle& handle : node.outputs )
+                busy[handle] = true;
+            tasks.push_back( t );
+        }
+        // Dependencies always point to earlier tasks, so the earliest
+        // unfinished task is always ready
+        EL_DEBUG_ONLY(
+          if( tasks.empty() )
+              LogicError("No task of the graph was ready");
+        )
+
+        const Int waveSize = tasks.size();
+        vector<double> costs( waveSize );
+        vector<int> maxProcs( waveSize );
+        for( Int k=0; k<waveSize; ++k )
+        {
+            costs[k] = tasks_[tasks[k]].cost;
+            maxProcs[k] = tasks_[tasks[k]].maxProcesses;
+        }
+        const vector<int> sizes =
+          AssignProcesses( p, minProcs, costs, maxProcs );
+
+        // Move the operands of each task onto its subgrid. Since every
+        // translation only involves the processes of its two grids and all
+        // processes perform them in the same order, the translations between
+        // disjoint sets of processes proceed concurrently.
+        vector<const El::Grid*> grids( waveSize );
+        Int myTask = -1;
+        int first = 0;
+        for( Int k=0; k<waveSize; ++k )
+        {
+            const TaskNode& node = tasks_[tasks[k]];
+            grids[k] = &GetSubgrid( first, sizes[k] );
+            if( vcRank >= first && vcRank < first+sizes[k] )
+                myTask = k;
+            if( print )
+                Output
+                ("Wave ",wave,": task ",node.name," on VC ranks [",
+                 first,",",first+sizes[k],")");
+            for( const Handle& handle : node.inputs )
+                operands_[handle]->MoveTo( *grids[k] );
+            for( const Handle& handle : node.outputs )
+                operands_[handle]->MoveTo( *grids[k] );
+            first += sizes[k];
+        }
+
+        if( myTask >= 0 )
+        {
+            const TaskNode& node = tasks_[tasks[myTask]];
+            running_ = grids[myTask];
+            try
+            {
+                node.task( *running_ );
+            }
+            catch( ... )
+            {
+                running_ = nullptr;
+                throw;
+            }
+            running_ = nullptr;
+        }
+
+        for( const Int& t : tasks )
+            done[t] = true;
+        numDone += waveSize;
+        ++wave;
+    }
+    numExecuted_ = numTasks;
+
+    if( ctrl.returnHome )
+        for( auto& operand : operands_ )
+            operand->ReturnHome();
+}
+
+} // namespace El
@@ -16,6 +16,9 @@ Timer::Timer( const string& name )
 
 void Timer::Start()
 {
+    counting_ = HardwareCounting();
+    if( counting_ )
+        lastCounts_ = ReadHardwareCounters();
     lastTime_ = Clock::now();
     running_ = true;
 }
@@ -29,6 +32,8 @@ double Timer::Stop()
     lastPartialTime_ = Partial();
     running_ = false;
     totalTime_ += lastPartialTime_;
+    if( counting_ )
+        counts_ += ReadHardwareCounters() - lastCounts_;
     return lastPartialTime_;
 }
 
@@ -38,10 +43,14 @@ void Timer::Reset( const string& name )
     running_ = false;
     totalTime_ = 0; 
     lastPartialTime_ = 0;
+    counting_ = false;
+    counts_ = HardwareCounts();
 }
 
 const string& Timer::Name() const { return name_; }
 
+const HardwareCounts& Timer::Counts() const { return counts_; }
+
 double Timer::Partial() const
 { 
     if( running_ )
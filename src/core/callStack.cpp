@@ -2,91 +2,142 @@
    Copyright (c) 2009-2016, Jack Poulson
    All rights reserved.
 
-   This file is part of Elemental and is under the BSD 2-Clause License, 
-   which can be found in the LICENSE file in the root directory, or at 
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
    http://opensource.org/licenses/BSD-2-Clause
 */
 #include <El-lite.hpp>
-#include <stack>
+
+#ifdef EL_HAVE_CALL_STACK
+#include <csignal>
+#include <cstring>
+#if defined(__unix__) || defined(__APPLE__)
+# include <unistd.h>
+#endif
 
 namespace {
 
-// Debugging
-EL_DEBUG_ONLY(
-  std::stack<std::string> callStack;
-  bool tracingEnabled = false;
-)
+// Since the entries are trivial, each thread's stack is constant-initialized
+// and is therefore safe to access before main and within signal handlers
+struct CallStack
+{
+    const char* names[El::kMaxCallStackDepth];
+    int depth;
+};
+thread_local CallStack callStack;
+
+bool tracingEnabled = false;
+
+// Only async-signal-safe routines may be used from within a signal handler
+void WriteToStderr( const char* str )
+{
+#if defined(__unix__) || defined(__APPLE__)
+    auto unused = write( STDERR_FILENO, str, std::strlen(str) );
+    EL_UNUSED( unused );
+#else
+    std::fputs( str, stderr );
+#endif
+}
+
+void WriteIntToStderr( int value )
+{
+    char buffer[16];
+    int pos = sizeof(buffer);
+    buffer[--pos] = '\0';
+    do
+    {
+        buffer[--pos] = char('0' + value % 10);
+        value /= 10;
+    } while( value > 0 && pos > 0 );
+    WriteToStderr( &buffer[pos] );
+}
 
+extern "C" void CallStackSignalHandler( int signal )
+{
+    const CallStack& stack = ::callStack;
+    WriteToStderr( "Elemental call stack upon signal " );
+    WriteIntToStderr( signal );
+    WriteToStderr( ":\n" );
+    for( int level=stack.depth; level>0; --level )
+    {
+        WriteToStderr( "[" );
+        WriteIntToStderr( level );
+        WriteToStderr( "]: " );
+        WriteToStderr
+        ( level <= El::kMaxCallStackDepth ? stack.names[level-1] : "..." );
+        WriteToStderr( "\n" );
+    }
+    std::signal( signal, SIG_DFL );
+    std::raise( signal );
 }
 
+} // anonymous namespace
+
 namespace El {
 
-// If we are not in RELEASE mode, then implement wrappers for a call stack
-EL_DEBUG_ONLY(
-
-  void EnableTracing() { ::tracingEnabled = true; }
-  void DisableTracing() { ::tracingEnabled = false; }
-
-  void PushCallStack( string s )
-  { 
-      // [1]:
-      // It was discovered that a global instantiation of a BigInt
-      // (::bigIntZero) led to pushing to the call stack in global scope
-      // before entering main, and this could possibly have been before the
-      // call stack was constructed, leading to PopCallStack() causing an
-      // exception due to the stack being empty. But this isn't completely
-      // verified.
-      if( !Initialized() )
-          return;
-#ifdef EL_HYBRID
-      if( omp_get_thread_num() != 0 )
-          return;
-#endif
-      const size_t maxStackSize = 300;
-      if( ::callStack.size() > maxStackSize )
-      {
-          DumpCallStack();
-          return;
-      }
-      ::callStack.push(s); 
-      if( ::tracingEnabled )
-      {
-          const int stackSize = ::callStack.size();
-          ostringstream os;
-          for( int j=0; j<stackSize; ++j )
-              os << " "; 
-          os << s << endl;
-          cout <<  os.str();
-      }
-  }
-
-  void PopCallStack()
-  { 
-      // See note [1] above.
-      if( !Initialized() )
-          return;
-#ifdef EL_HYBRID
-      if( omp_get_thread_num() != 0 )
-          return;
+void EnableTracing() { ::tracingEnabled = true; }
+void DisableTracing() { ::tracingEnabled = false; }
+
+int PushCallStack( const char* name ) EL_NO_EXCEPT
+{
+    CallStack& stack = ::callStack;
+    const int depth = stack.depth++;
+    if( depth < kMaxCallStackDepth )
+        stack.names[depth] = name;
+    if( ::tracingEnabled )
+    {
+        try
+        {
+            ostringstream os;
+            for( int j=0; j<=depth; ++j )
+                os << " ";
+            os << name << endl;
+            cout << os.str();
+        }
+        catch( ... ) { }
+    }
+    return depth;
+}
+
+void PopCallStack()
+{
+    CallStack& stack = ::callStack;
+    if( stack.depth == 0 )
+        LogicError("Attempted to pop an empty call stack");
+    --stack.depth;
+}
+
+void PopCallStack( int depth ) EL_NO_EXCEPT
+{ ::callStack.depth = depth; }
+
+void DumpCallStack( ostream& os )
+{
+    CallStack& stack = ::callStack;
+    ostringstream msg;
+    for( int level=stack.depth; level>0; --level )
+    {
+        msg << "[" << level << "]: ";
+        if( level <= kMaxCallStackDepth )
+            msg << stack.names[level-1] << "\n";
+        else
+            msg << "(beyond the maximum recorded depth)\n";
+    }
+    stack.depth = 0;
+    os << msg.str();
+    os.flush();
+}
+
+void DumpCallStackOnSignals()
+{
+    std::signal( SIGSEGV, CallStackSignalHandler );
+    std::signal( SIGFPE, CallStackSignalHandler );
+    std::signal( SIGILL, CallStackSignalHandler );
+    std::signal( SIGABRT, CallStackSignalHandler );
+#ifdef SIGBUS
+    std::signal( SIGBUS, CallStackSignalHandler );
 #endif
-      if( ::callStack.empty() )
-          LogicError("Attempted to pop an empty call stack");
-      ::callStack.pop(); 
-  }
-
-  void DumpCallStack( ostream& os )
-  {
-      ostringstream msg;
-      while( ! ::callStack.empty() )
-      {
-          msg << "[" << ::callStack.size() << "]: " << ::callStack.top() 
-              << "\n";
-          ::callStack.pop();
-      }
-      os << msg.str();
-      os.flush();
-  }
-
-) // EL_DEBUG_ONLY
+}
 
 } // namespace El
+
+#endif // ifdef EL_HAVE_CALL_STACK
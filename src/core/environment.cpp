@@ -10,6 +10,7 @@
 #include <El-lite.hpp>
 
 #include <algorithm>
+#include <cstdlib>
 #include <set>
 
 namespace {
@@ -19,6 +20,17 @@ bool elemInitializedMpi = false;
 
 El::Args* args = 0;
 
+El::Int parallelGrainSize = 8192;
+
+std::vector<std::pair<std::string,double>> startupTimings;
+
+// Whether the environment variable is set to something other than "0"
+bool EnvironmentFlag( const char* name )
+{
+    const char* value = std::getenv( name );
+    return value != nullptr && value[0] != '\0' && std::string(value) != "0";
+}
+
 }
 
 namespace El {
@@ -53,6 +65,13 @@ void PrintConfig( ostream& os )
 #else
       "  Have Qt5:                     NO\n"
 #endif
+#if defined(EL_HAVE_PAPI)
+      "  Hardware counters:            PAPI\n"
+#elif defined(EL_HAVE_PERF_EVENT)
+      "  Hardware counters:            perf_event\n"
+#else
+      "  Hardware counters:            NO\n"
+#endif
 #ifdef EL_AVOID_COMPLEX_MPI
       "  Avoiding complex MPI:         YES\n"
 #else
@@ -129,6 +148,9 @@ void Initialize()
     Initialize( argc, argv );
 }
 
+// Declared alongside the blocksize stack
+void InitializeBlocksizes();
+
 void Initialize( int& argc, char**& argv )
 {
     if( ::numElemInits > 0 )
@@ -137,6 +159,15 @@ void Initialize( int& argc, char**& argv )
         return;
     }
 
+    ::startupTimings.clear();
+    Timer timer;
+    auto finishPhase = [&]( const char* phase )
+      {
+          ::startupTimings.emplace_back( phase, timer.Stop() );
+          timer.Start();
+      };
+    timer.Start();
+
     ::args = new Args( argc, argv );
 
     ::numElemInits = 1;
@@ -173,30 +204,128 @@ void Initialize( int& argc, char**& argv )
         }
 #endif
     }
+    finishPhase( "MPI" );
+
+#ifdef EL_HAVE_CALL_STACK
+    if( EnvironmentFlag( "EL_CRASH_CALL_STACK" ) )
+        DumpCallStackOnSignals();
+#endif
 
 #ifdef EL_HAVE_QT5
     InitializeQt5( argc, argv );
+    finishPhase( "Qt5" );
 #endif
 
-    // Queue a default algorithmic blocksize
-    EmptyBlocksizeStack();
-    PushBlocksizeStack( 128 );
+    // Queue a default algorithmic blocksize and load any blocksize profile
+    InitializeBlocksizes();
+    finishPhase( "Blocksizes" );
 
     // Build the default grid
     Grid::InitializeDefault();
     Grid::InitializeTrivial();
+    finishPhase( "Grids" );
 
 #ifdef EL_HAVE_QD
     InitializeQD();
+    finishPhase( "QD" );
 #endif
 
+    // mpfr::SetPrecision within InitializeRandom creates the BigFloat types
     InitializeRandom();
+    finishPhase( "Random" );
+
+#ifdef EL_HYBRID
+    // Create the OpenMP team up front so that it is parked (rather than
+    // spawned) when the first threaded kernel is encountered
+    #pragma omp parallel
+    { }
+    finishPhase( "OpenMP" );
+#endif
+
+    // The custom MPI types and ops are created upon their first use, though
+    // they may be eagerly created for the sake of predictable timings
+    if( EnvironmentFlag( "EL_EAGER_MPI_TYPES" ) )
+    {
+        mpi::CreateCustom();
+        finishPhase( "MPI types" );
+    }
+
+    // Optionally measure the crossovers between the collective algorithms
+    if( EnvironmentFlag( "EL_TUNE_COLLECTIVES" ) )
+    {
+        mpi::TuneCollectives( mpi::COMM_WORLD );
+        finishPhase( "Collective tuning" );
+    }
+    timer.Stop();
+
+    if( EnvironmentFlag( "EL_STARTUP_TIMINGS" ) )
+        PrintStartupTimings();
+}
+
+const vector<pair<string,double>>& StartupTimings()
+{ return ::startupTimings; }
+
+void PrintStartupTimings( ostream& os )
+{
+    EL_DEBUG_CSE
+    // Report the slowest process for each phase
+    const int numPhases = ::startupTimings.size();
+    vector<double> localTimes(numPhases), maxTimes(numPhases);
+    for( int phase=0; phase<numPhases; ++phase )
+        localTimes[phase] = ::startupTimings[phase].second;
+    mpi::Reduce
+    ( localTimes.data(), maxTimes.data(), numPhases, mpi::MAX, 0,
+      mpi::COMM_WORLD );
+    if( mpi::Rank(mpi::COMM_WORLD) == 0 )
+    {
+        double total = 0;
+        os << "Elemental startup timings (max over processes):\n";
+        for( int phase=0; phase<numPhases; ++phase )
+        {
+            os << "  " << ::startupTimings[phase].first << ": "
+               << maxTimes[phase] << " [s]\n";
+            total += maxTimes[phase];
+        }
+        os << "  Total (upper bound): " << total << " [s]" << endl;
+    }
+}
+
+void SetNumThreads( int numThreads )
+{
+    EL_DEBUG_CSE
+    if( numThreads < 1 )
+        LogicError("The number of threads must be positive");
+#ifdef EL_HYBRID
+    omp_set_num_threads( numThreads );
+#endif
+}
+
+int NumThreads()
+{
+#ifdef EL_HYBRID
+    return omp_get_max_threads();
+#else
+    return 1;
+#endif
+}
 
-    // Create the types and ops.
-    // mpfr::SetPrecision within InitializeRandom created the BigFloat types
-    mpi::CreateCustom();
+void SetParallelGrainSize( Int numEntries )
+{
+    EL_DEBUG_CSE
+    if( numEntries < 0 )
+        LogicError("The parallel grain size must be non-negative");
+    ::parallelGrainSize = numEntries;
 }
 
+Int ParallelGrainSize() { return ::parallelGrainSize; }
+
+bool ParallelizeLoop( Int numEntries )
+{ return numEntries >= ::parallelGrainSize; }
+
+// These caches are declared alongside the routines which populate them
+void ClearRedistPlanCache();
+void ClearGemm25DGrids();
+
 void Finalize()
 {
     EL_DEBUG_CSE
@@ -214,6 +343,20 @@ void Finalize()
         delete ::args;
         ::args = 0;
 
+        if( !mpi::Finalized() )
+        {
+            try
+            {
+                profile::WriteReport();
+                profile::WriteTrace();
+                profile::WriteCounterSummary();
+                profile::WriteMemorySummary();
+            }
+            catch( std::exception& e ) { ReportException(e); }
+        }
+        DisableHardwareCounters();
+
+        ClearGemm25DGrids();
         Grid::FinalizeDefault();
         Grid::FinalizeTrivial();
 
@@ -222,6 +365,9 @@ void Finalize()
 
 #ifdef EL_HAVE_QT5
         FinalizeQt5();
+#endif
+#ifdef EL_HAVE_CUDA
+        FinalizeCUDA();
 #endif
         if( ::elemInitializedMpi )
             mpi::Finalize();
@@ -234,6 +380,9 @@ void Finalize()
 #endif
 
         FinalizeRandom();
+
+        ClearRedistPlanCache();
+        PurgeMemoryPool();
     }
 
     EL_DEBUG_ONLY( CloseLog() )
@@ -288,7 +437,9 @@ void ReportException( const exception& e, ostream& os )
         const ArgException& argExcept = dynamic_cast<const ArgException&>(e);
         if( string(argExcept.what()) != "" )
             os << argExcept.what() << endl;
-        EL_DEBUG_ONLY(DumpCallStack(os))
+#ifdef EL_HAVE_CALL_STACK
+        DumpCallStack( os );
+#endif
     }
     catch( UnrecoverableException& recovExcept )
     {
@@ -298,7 +449,9 @@ void ReportException( const exception& e, ostream& os )
                << " caught an unrecoverable exception with message:\n"
                << e.what() << endl;
         }
-        EL_DEBUG_ONLY(DumpCallStack(os))
+#ifdef EL_HAVE_CALL_STACK
+        DumpCallStack( os );
+#endif
         mpi::Abort( mpi::COMM_WORLD, 1 );
     }
     catch( exception& castExcept )
@@ -308,7 +461,9 @@ void ReportException( const exception& e, ostream& os )
             os << "Process " << mpi::Rank() << " caught error message:\n"
                << e.what() << endl;
         }
-        EL_DEBUG_ONLY(DumpCallStack(os))
+#ifdef EL_HAVE_CALL_STACK
+        DumpCallStack( os );
+#endif
     }
 }
 
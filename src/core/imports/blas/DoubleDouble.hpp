@@ -0,0 +1,379 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifdef EL_HAVE_QD
+
+// Rather than looping over DoubleDouble objects (whose QD arithmetic is
+// opaque to the compiler), the following kernels operate on split arrays of
+// the high and low words with inlined error-free transformations so that the
+// innermost loops vectorize. The accuracy matches the QD library's default
+// ("sloppy") double-double addition and multiplication.
+
+namespace El {
+namespace blas {
+namespace dd_kernel {
+
+// Error-free transformations
+// ==========================
+inline void TwoSum( double a, double b, double& s, double& e )
+{
+    s = a + b;
+    const double bVirtual = s - a;
+    e = (a - (s - bVirtual)) + (b - bVirtual);
+}
+
+inline void QuickTwoSum( double a, double b, double& s, double& e )
+{
+    s = a + b;
+    e = b - (s - a);
+}
+
+inline void TwoProd( double a, double b, double& p, double& e )
+{
+    p = a*b;
+#ifdef FP_FAST_FMA
+    e = std::fma( a, b, -p );
+#else
+    // Dekker's splitting
+    const double splitter = 134217729.; // 2^27+1
+    double t = splitter*a;
+    const double aHi = t - (t - a);
+    const double aLo = a - aHi;
+    t = splitter*b;
+    const double bHi = t - (t - b);
+    const double bLo = b - bHi;
+    e = ((aHi*bHi - p) + aHi*bLo + aLo*bHi) + aLo*bLo;
+#endif
+}
+
+// (cHi,cLo) += (aHi,aLo)*(bHi,bLo)
+inline void MultiplyAdd
+( double aHi, double aLo, double bHi, double bLo, double& cHi, double& cLo )
+{
+    double pHi, pLo;
+    TwoProd( aHi, bHi, pHi, pLo );
+    pLo += aHi*bLo + aLo*bHi;
+    QuickTwoSum( pHi, pLo, pHi, pLo );
+    double s, e;
+    TwoSum( cHi, pHi, s, e );
+    e += cLo + pLo;
+    QuickTwoSum( s, e, cHi, cLo );
+}
+
+inline DoubleDouble FromWords( double hi, double lo )
+{ return DoubleDouble(dd_real(hi,lo)); }
+
+// Matrix-matrix multiplication
+// ============================
+// The register tile of C and the cache-blocking parameters
+const BlasInt MR = 4;
+const BlasInt NR = 4;
+const BlasInt MC = 64;
+const BlasInt KC = 256;
+const BlasInt NC = 1024;
+
+// Pack op(A)(i0:i0+mc,l0:l0+kc) into row panels of height MR (padded with
+// zeros) so that the micro-kernel streams through unit-stride memory
+void PackA
+( char trans, const DoubleDouble* A, BlasInt ALDim,
+  BlasInt i0, BlasInt mc, BlasInt l0, BlasInt kc,
+  double* packedHi, double* packedLo )
+{
+    const bool normal = ( std::toupper(trans) == 'N' );
+    const BlasInt numPanels = (mc+MR-1)/MR;
+    for( BlasInt p=0; p<numPanels; ++p )
+    {
+        for( BlasInt l=0; l<kc; ++l )
+        {
+            for( BlasInt iSub=0; iSub<MR; ++iSub )
+            {
+                const BlasInt i = p*MR + iSub;
+                const BlasInt index = (p*kc+l)*MR + iSub;
+                if( i < mc )
+                {
+                    const DoubleDouble& alpha =
+                      normal ? A[(i0+i)+(l0+l)*ALDim]
+                             : A[(l0+l)+(i0+i)*ALDim];
+                    packedHi[index] = alpha.x[0];
+                    packedLo[index] = alpha.x[1];
+                }
+                else
+                {
+                    packedHi[index] = 0;
+                    packedLo[index] = 0;
+                }
+            }
+        }
+    }
+}
+
+// Pack op(B)(l0:l0+kc,j0:j0+nc) into column panels of width NR
+void PackB
+( char trans, const DoubleDouble* B, BlasInt BLDim,
+  BlasInt l0, BlasInt kc, BlasInt j0, BlasInt nc,
+  double* packedHi, double* packedLo )
+{
+    const bool normal = ( std::toupper(trans) == 'N' );
+    const BlasInt numPanels = (nc+NR-1)/NR;
+    for( BlasInt p=0; p<numPanels; ++p )
+    {
+        for( BlasInt l=0; l<kc; ++l )
+        {
+            for( BlasInt jSub=0; jSub<NR; ++jSub )
+            {
+                const BlasInt j = p*NR + jSub;
+                const BlasInt index = (p*kc+l)*NR + jSub;
+                if( j < nc )
+                {
+                    const DoubleDouble& beta =
+                      normal ? B[(l0+l)+(j0+j)*BLDim]
+                             : B[(j0+j)+(l0+l)*BLDim];
+                    packedHi[index] = beta.x[0];
+                    packedLo[index] = beta.x[1];
+                }
+                else
+                {
+                    packedHi[index] = 0;
+                    packedLo[index] = 0;
+                }
+            }
+        }
+    }
+}
+
+// Accumulate the MR x NR product of a packed row panel of A and a packed
+// column panel of B into the (column-major) tile (cHi,cLo)
+inline void MicroKernel
+( BlasInt kc,
+  const double* aHi, const double* aLo,
+  const double* bHi, const double* bLo,
+        double* cHi,       double* cLo )
+{
+    for( BlasInt l=0; l<kc; ++l )
+    {
+        const double* aHiCol = &aHi[l*MR];
+        const double* aLoCol = &aLo[l*MR];
+        for( BlasInt j=0; j<NR; ++j )
+        {
+            const double betaHi = bHi[l*NR+j];
+            const double betaLo = bLo[l*NR+j];
+            double* cHiCol = &cHi[j*MR];
+            double* cLoCol = &cLo[j*MR];
+            EL_SIMD
+            for( BlasInt i=0; i<MR; ++i )
+                MultiplyAdd
+                ( aHiCol[i], aLoCol[i], betaHi, betaLo, cHiCol[i], cLoCol[i] );
+        }
+    }
+}
+
+// Dot products
+// ============
+// The number of independent partial sums, which should be at least the SIMD
+// width
+const BlasInt numDotLanes = 8;
+
+void DotWords
+( BlasInt n,
+  const DoubleDouble* x, BlasInt incx,
+  const DoubleDouble* y, BlasInt incy,
+  double& hi, double& lo )
+{
+    double sumHi[numDotLanes], sumLo[numDotLanes];
+    for( BlasInt lane=0; lane<numDotLanes; ++lane )
+        sumHi[lane] = sumLo[lane] = 0;
+    const BlasInt nBlocked = n - (n % numDotLanes);
+    for( BlasInt i=0; i<nBlocked; i+=numDotLanes )
+    {
+        EL_SIMD
+        for( BlasInt lane=0; lane<numDotLanes; ++lane )
+        {
+            const DoubleDouble& chi = x[(i+lane)*incx];
+            const DoubleDouble& psi = y[(i+lane)*incy];
+            MultiplyAdd
+            ( chi.x[0], chi.x[1], psi.x[0], psi.x[1],
+              sumHi[lane], sumLo[lane] );
+        }
+    }
+    for( BlasInt i=nBlocked; i<n; ++i )
+    {
+        const DoubleDouble& chi = x[i*incx];
+        const DoubleDouble& psi = y[i*incy];
+        MultiplyAdd
+        ( chi.x[0], chi.x[1], psi.x[0], psi.x[1], sumHi[0], sumLo[0] );
+    }
+
+    // Combine the partial sums
+    hi = sumHi[0];
+    lo = sumLo[0];
+    for( BlasInt lane=1; lane<numDotLanes; ++lane )
+    {
+        double s, e;
+        TwoSum( hi, sumHi[lane], s, e );
+        e += lo + sumLo[lane];
+        QuickTwoSum( s, e, hi, lo );
+    }
+}
+
+// Scale C by beta (without reading C when beta is zero)
+void ScaleMatrix
+( BlasInt m, BlasInt n, const DoubleDouble& beta,
+  DoubleDouble* C, BlasInt CLDim )
+{
+    if( beta == DoubleDouble(0) )
+    {
+        for( BlasInt j=0; j<n; ++j )
+            for( BlasInt i=0; i<m; ++i )
+                C[i+j*CLDim] = 0;
+    }
+    else if( beta != DoubleDouble(1) )
+    {
+        for( BlasInt j=0; j<n; ++j )
+            for( BlasInt i=0; i<m; ++i )
+                C[i+j*CLDim] *= beta;
+    }
+}
+
+} // namespace dd_kernel
+
+DoubleDouble Dot
+( BlasInt n,
+  const DoubleDouble* x, BlasInt incx,
+  const DoubleDouble* y, BlasInt incy )
+{
+    double hi, lo;
+    dd_kernel::DotWords( n, x, incx, y, incy, hi, lo );
+    return dd_kernel::FromWords( hi, lo );
+}
+
+void Gemv
+( char trans, BlasInt m, BlasInt n,
+  const DoubleDouble& alpha,
+  const DoubleDouble* A, BlasInt ALDim,
+  const DoubleDouble* x, BlasInt incx,
+  const DoubleDouble& beta,
+        DoubleDouble* y, BlasInt incy )
+{
+    profile::AddFlops( y, 2.*m*n );
+    const bool normal = ( std::toupper(trans) == 'N' );
+    const BlasInt iterLength = ( normal ? m : n );
+    if( beta == DoubleDouble(0) )
+    {
+        for( BlasInt i=0; i<iterLength; ++i )
+            y[i*incy] = 0;
+    }
+    else if( beta != DoubleDouble(1) )
+    {
+        for( BlasInt i=0; i<iterLength; ++i )
+            y[i*incy] *= beta;
+    }
+    if( alpha == DoubleDouble(0) )
+        return;
+
+    if( normal )
+    {
+        // Accumulate A x one column at a time into split words
+        vector<double> sumHi( m, 0 ), sumLo( m, 0 );
+        double* sumHiBuf = sumHi.data();
+        double* sumLoBuf = sumLo.data();
+        for( BlasInt j=0; j<n; ++j )
+        {
+            const DoubleDouble& chi = x[j*incx];
+            const double chiHi = chi.x[0];
+            const double chiLo = chi.x[1];
+            const DoubleDouble* aCol = &A[j*ALDim];
+            EL_SIMD
+            for( BlasInt i=0; i<m; ++i )
+                dd_kernel::MultiplyAdd
+                ( aCol[i].x[0], aCol[i].x[1], chiHi, chiLo,
+                  sumHiBuf[i], sumLoBuf[i] );
+        }
+        for( BlasInt i=0; i<m; ++i )
+            y[i*incy] += alpha*dd_kernel::FromWords( sumHi[i], sumLo[i] );
+    }
+    else
+    {
+        // The entries of A are real, so A^H = A^T
+        for( BlasInt j=0; j<n; ++j )
+        {
+            double hi, lo;
+            dd_kernel::DotWords( m, &A[j*ALDim], 1, x, incx, hi, lo );
+            y[j*incy] += alpha*dd_kernel::FromWords( hi, lo );
+        }
+    }
+}
+
+void Gemm
+( char transA, char transB,
+  BlasInt m, BlasInt n, BlasInt k,
+  const DoubleDouble& alpha,
+  const DoubleDouble* A, BlasInt ALDim,
+  const DoubleDouble* B, BlasInt BLDim,
+  const DoubleDouble& beta,
+        DoubleDouble* C, BlasInt CLDim )
+{
+    profile::AddFlops( C, 2.*m*n*k );
+    using namespace dd_kernel;
+    ScaleMatrix( m, n, beta, C, CLDim );
+    if( m == 0 || n == 0 || k == 0 || alpha == DoubleDouble(0) )
+        return;
+
+    vector<double> packedAHi(MC*KC), packedALo(MC*KC);
+    vector<double> packedBHi, packedBLo;
+    double cHi[MR*NR], cLo[MR*NR];
+    for( BlasInt j0=0; j0<n; j0+=NC )
+    {
+        const BlasInt nc = Min(NC,n-j0);
+        const BlasInt ncPadded = ((nc+NR-1)/NR)*NR;
+        for( BlasInt l0=0; l0<k; l0+=KC )
+        {
+            const BlasInt kc = Min(KC,k-l0);
+            packedBHi.resize( ncPadded*kc );
+            packedBLo.resize( ncPadded*kc );
+            PackB
+            ( transB, B, BLDim, l0, kc, j0, nc,
+              packedBHi.data(), packedBLo.data() );
+            for( BlasInt i0=0; i0<m; i0+=MC )
+            {
+                const BlasInt mc = Min(MC,m-i0);
+                PackA
+                ( transA, A, ALDim, i0, mc, l0, kc,
+                  packedAHi.data(), packedALo.data() );
+                for( BlasInt jr=0; jr<nc; jr+=NR )
+                {
+                    const BlasInt nr = Min(NR,nc-jr);
+                    const double* bHi = &packedBHi[jr*kc];
+                    const double* bLo = &packedBLo[jr*kc];
+                    for( BlasInt ir=0; ir<mc; ir+=MR )
+                    {
+                        const BlasInt mr = Min(MR,mc-ir);
+                        for( BlasInt e=0; e<MR*NR; ++e )
+                            cHi[e] = cLo[e] = 0;
+                        MicroKernel
+                        ( kc, &packedAHi[ir*kc], &packedALo[ir*kc],
+                          bHi, bLo, cHi, cLo );
+
+                        // C := C + alpha (A B) for this tile and block of k
+                        for( BlasInt j=0; j<nr; ++j )
+                        {
+                            DoubleDouble* cCol = &C[(i0+ir)+(j0+jr+j)*CLDim];
+                            for( BlasInt i=0; i<mr; ++i )
+                                cCol[i] +=
+                                  alpha*FromWords(cHi[i+j*MR],cLo[i+j*MR]);
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
+
+} // namespace blas
+} // namespace El
+
+#endif // ifdef EL_HAVE_QD
@@ -54,6 +54,7 @@ void Gemm
   const T& beta,
         T* C, BlasInt CLDim )
 {
+    profile::AddFlops( C, 2.*m*n*k );
     // NOTE: Temporaries are avoided since constructing a BigInt/BigFloat
     //       involves a memory allocation
     if( m > 0 && n > 0 && k == 0 && beta == T(0) )
@@ -356,6 +357,7 @@ void Gemm
   const float& beta,
         float* C, BlasInt CLDim )
 {
+    profile::AddFlops( C, 2.*m*n*k );
     EL_DEBUG_CSE
     EL_DEBUG_ONLY(
       if( std::toupper(transA) == 'N' )
@@ -383,6 +385,15 @@ void Gemm
       if( CLDim < Max(m,1) )
           LogicError("CLDim was too small: CLDim=",CLDim,",m=",m);
     )
+#ifdef EL_HAVE_CUDA
+    if( cuda::Offload( 2.*m*n*k ) )
+    {
+        cuda::Gemm
+        ( transA, transB, m, n, k,
+          alpha, A, ALDim, B, BLDim, beta, C, CLDim );
+        return;
+    }
+#endif
     const char fixedTransA = ( std::toupper(transA) == 'C' ? 'T' : transA );
     const char fixedTransB = ( std::toupper(transB) == 'C' ? 'T' : transB );
     EL_BLAS(sgemm)
@@ -399,6 +410,7 @@ void Gemm
   const double& beta,
         double* C, BlasInt CLDim )
 {
+    profile::AddFlops( C, 2.*m*n*k );
     EL_DEBUG_CSE
     EL_DEBUG_ONLY(
       if( std::toupper(transA) == 'N' )
@@ -426,6 +438,15 @@ void Gemm
       if( CLDim < Max(m,1) )
           LogicError("CLDim was too small: CLDim=",CLDim,",m=",m);
     )
+#ifdef EL_HAVE_CUDA
+    if( cuda::Offload( 2.*m*n*k ) )
+    {
+        cuda::Gemm
+        ( transA, transB, m, n, k,
+          alpha, A, ALDim, B, BLDim, beta, C, CLDim );
+        return;
+    }
+#endif
     const char fixedTransA = ( std::toupper(transA) == 'C' ? 'T' : transA );
     const char fixedTransB = ( std::toupper(transB) == 'C' ? 'T' : transB );
     EL_BLAS(dgemm)
@@ -441,6 +462,7 @@ void Gemm
   const scomplex& beta,
         scomplex* C, BlasInt CLDim )
 {
+    profile::AddFlops( C, 2.*m*n*k );
     EL_DEBUG_CSE
     EL_DEBUG_ONLY(
       if( std::toupper(transA) == 'N' )
@@ -468,6 +490,15 @@ void Gemm
       if( CLDim < Max(m,1) )
           LogicError("CLDim was too small: CLDim=",CLDim,",m=",m);
     )
+#ifdef EL_HAVE_CUDA
+    if( cuda::Offload( 2.*m*n*k ) )
+    {
+        cuda::Gemm
+        ( transA, transB, m, n, k,
+          alpha, A, ALDim, B, BLDim, beta, C, CLDim );
+        return;
+    }
+#endif
     EL_BLAS(cgemm)
     ( &transA, &transB, &m, &n, &k,
       &alpha, A, &ALDim, B, &BLDim, &beta, C, &CLDim );
@@ -481,6 +512,7 @@ void Gemm
   const dcomplex& beta,
         dcomplex* C, BlasInt CLDim )
 {
+    profile::AddFlops( C, 2.*m*n*k );
     EL_DEBUG_CSE
     EL_DEBUG_ONLY(
       if( std::toupper(transA) == 'N' )
@@ -508,6 +540,15 @@ void Gemm
       if( CLDim < Max(m,1) )
           LogicError("CLDim was too small: CLDim=",CLDim,",m=",m);
     )
+#ifdef EL_HAVE_CUDA
+    if( cuda::Offload( 2.*m*n*k ) )
+    {
+        cuda::Gemm
+        ( transA, transB, m, n, k,
+          alpha, A, ALDim, B, BLDim, beta, C, CLDim );
+        return;
+    }
+#endif
     EL_BLAS(zgemm)
     ( &transA, &transB, &m, &n, &k,
       &alpha, A, &ALDim, B, &BLDim, &beta, C, &CLDim );
@@ -48,6 +48,7 @@ void Gemv
   const T& beta,
         T* y, BlasInt incy )
 {
+    profile::AddFlops( y, 2.*m*n );
     // NOTE: Temporaries are avoided since constructing a BigInt/BigFloat
     //       involves a memory allocation
     // TODO: Special-case alpha=0, alpha=1, and alpha=-1?
@@ -219,6 +220,7 @@ void Gemv
   const float& beta,
         float* y, BlasInt incy )
 {
+    profile::AddFlops( y, 2.*m*n );
     const char fixedTrans = ( std::toupper(trans) == 'C' ? 'T' : trans );
     EL_BLAS(sgemv)
     ( &fixedTrans, &m, &n, &alpha, A, &ALDim, x, &incx, &beta, y, &incy );
@@ -232,6 +234,7 @@ void Gemv
   const double& beta,
         double* y, BlasInt incy )
 {
+    profile::AddFlops( y, 2.*m*n );
     const char fixedTrans = ( std::toupper(trans) == 'C' ? 'T' : trans );
     EL_BLAS(dgemv)
     ( &fixedTrans, &m, &n, &alpha, A, &ALDim, x, &incx, &beta, y, &incy );
@@ -244,8 +247,11 @@ void Gemv
   const scomplex* x, BlasInt incx,
   const scomplex& beta,
         scomplex* y, BlasInt incy )
-{ EL_BLAS(cgemv)
-  ( &trans, &m, &n, &alpha, A, &ALDim, x, &incx, &beta, y, &incy ); }
+{
+    profile::AddFlops( y, 2.*m*n );
+    EL_BLAS(cgemv)
+    ( &trans, &m, &n, &alpha, A, &ALDim, x, &incx, &beta, y, &incy );
+}
 
 void Gemv
 ( char trans, BlasInt m, BlasInt n,
@@ -254,8 +260,11 @@ void Gemv
   const dcomplex* x, BlasInt incx,
   const dcomplex& beta,
         dcomplex* y, BlasInt incy )
-{ EL_BLAS(zgemv)
-  ( &trans, &m, &n, &alpha, A, &ALDim, x, &incx, &beta, y, &incy ); }
+{
+    profile::AddFlops( y, 2.*m*n );
+    EL_BLAS(zgemv)
+    ( &trans, &m, &n, &alpha, A, &ALDim, x, &incx, &beta, y, &incy );
+}
 
 } // namespace blas
 } // namespace El
@@ -58,6 +58,7 @@ void Ger
   const T* y, BlasInt incy,
         T* A, BlasInt ALDim )
 {
+    profile::AddFlops( A, 2.*m*n );
     // NOTE: Temporaries are avoided since constructing a BigInt/BigFloat
     //       involves a memory allocation
     // TODO: Special-case alpha=0?
@@ -148,7 +149,10 @@ void Ger
   const float* x, BlasInt incx, 
   const float* y, BlasInt incy,
         float* A, BlasInt ALDim )
-{ EL_BLAS(sger)( &m, &n, &alpha, x, &incx, y, &incy, A, &ALDim ); }
+{
+    profile::AddFlops( A, 2.*m*n );
+    EL_BLAS(sger)( &m, &n, &alpha, x, &incx, y, &incy, A, &ALDim );
+}
 
 void Ger
 ( BlasInt m, BlasInt n,
@@ -156,7 +160,10 @@ void Ger
   const double* x, BlasInt incx, 
   const double* y, BlasInt incy,
         double* A, BlasInt ALDim  )
-{ EL_BLAS(dger)( &m, &n, &alpha, x, &incx, y, &incy, A, &ALDim ); }
+{
+    profile::AddFlops( A, 2.*m*n );
+    EL_BLAS(dger)( &m, &n, &alpha, x, &incx, y, &incy, A, &ALDim );
+}
 
 void Ger
 ( BlasInt m, BlasInt n,
@@ -164,7 +171,10 @@ void Ger
   const scomplex* x, BlasInt incx, 
   const scomplex* y, BlasInt incy,
         scomplex* A, BlasInt ALDim )
-{ EL_BLAS(cgerc)( &m, &n, &alpha, x, &incx, y, &incy, A, &ALDim ); }
+{
+    profile::AddFlops( A, 2.*m*n );
+    EL_BLAS(cgerc)( &m, &n, &alpha, x, &incx, y, &incy, A, &ALDim );
+}
 
 void Ger
 ( BlasInt m, BlasInt n,
@@ -172,7 +182,10 @@ void Ger
   const dcomplex* x, BlasInt incx, 
   const dcomplex* y, BlasInt incy,
         dcomplex* A, BlasInt ALDim )
-{ EL_BLAS(zgerc)( &m, &n, &alpha, x, &incx, y, &incy, A, &ALDim ); }
+{
+    profile::AddFlops( A, 2.*m*n );
+    EL_BLAS(zgerc)( &m, &n, &alpha, x, &incx, y, &incy, A, &ALDim );
+}
 
 template<typename T>
 void Geru
@@ -182,6 +195,7 @@ void Geru
   const T* y, BlasInt incy,
         T* A, BlasInt ALDim )
 {
+    profile::AddFlops( A, 2.*m*n );
     // NOTE: Temporaries are avoided since constructing a BigInt/BigFloat
     //       involves a memory allocation
     // TODO: Special-case alpha=0?
@@ -272,7 +286,10 @@ void Geru
   const float* x, BlasInt incx, 
   const float* y, BlasInt incy,
         float* A, BlasInt ALDim )
-{ EL_BLAS(sger)( &m, &n, &alpha, x, &incx, y, &incy, A, &ALDim ); }
+{
+    profile::AddFlops( A, 2.*m*n );
+    EL_BLAS(sger)( &m, &n, &alpha, x, &incx, y, &incy, A, &ALDim );
+}
 
 void Geru
 ( BlasInt m, BlasInt n,
@@ -280,7 +297,10 @@ void Geru
   const double* x, BlasInt incx, 
   const double* y, BlasInt incy,
         double* A, BlasInt ALDim )
-{ EL_BLAS(dger)( &m, &n, &alpha, x, &incx, y, &incy, A, &ALDim ); }
+{
+    profile::AddFlops( A, 2.*m*n );
+    EL_BLAS(dger)( &m, &n, &alpha, x, &incx, y, &incy, A, &ALDim );
+}
 
 void Geru
 ( BlasInt m, BlasInt n,
@@ -288,7 +308,10 @@ void Geru
   const scomplex* x, BlasInt incx, 
   const scomplex* y, BlasInt incy,
         scomplex* A, BlasInt ALDim )
-{ EL_BLAS(cgeru)( &m, &n, &alpha, x, &incx, y, &incy, A, &ALDim ); }
+{
+    profile::AddFlops( A, 2.*m*n );
+    EL_BLAS(cgeru)( &m, &n, &alpha, x, &incx, y, &incy, A, &ALDim );
+}
 
 void Geru
 ( BlasInt m, BlasInt n,
@@ -296,7 +319,10 @@ void Geru
   const dcomplex* x, BlasInt incx, 
   const dcomplex* y, BlasInt incy,
         dcomplex* A, BlasInt ALDim )
-{ EL_BLAS(zgeru)( &m, &n, &alpha, x, &incx, y, &incy, A, &ALDim ); }
+{
+    profile::AddFlops( A, 2.*m*n );
+    EL_BLAS(zgeru)( &m, &n, &alpha, x, &incx, y, &incy, A, &ALDim );
+}
 
 } // namespace blas
 } // namespace El
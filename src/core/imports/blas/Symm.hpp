@@ -70,6 +70,7 @@ void Hemm
   const T& beta,
         T* C, BlasInt CLDim )
 {
+    profile::AddFlops( C, ( std::toupper(side)=='L' ? 2.*m*m*n : 2.*m*n*n ) );
     // NOTE: Temporaries are avoided since constructing a BigInt/BigFloat
     //       involves a memory allocation
 
@@ -324,6 +325,7 @@ void Hemm
   const float& beta,
         float* C, BlasInt CLDim )
 {
+    profile::AddFlops( C, ( std::toupper(side)=='L' ? 2.*m*m*n : 2.*m*n*n ) );
     EL_BLAS(ssymm)
     ( &side, &uplo, &m, &n,
       &alpha, A, &ALDim, B, &BLDim, &beta, C, &CLDim );
@@ -337,6 +339,7 @@ void Hemm
   const double& beta,
         double* C, BlasInt CLDim )
 {
+    profile::AddFlops( C, ( std::toupper(side)=='L' ? 2.*m*m*n : 2.*m*n*n ) );
     EL_BLAS(dsymm)
     ( &side, &uplo, &m, &n,
       &alpha, A, &ALDim, B, &BLDim, &beta, C, &CLDim );
@@ -350,6 +353,7 @@ void Hemm
   const scomplex& beta,
         scomplex* C, BlasInt CLDim )
 {
+    profile::AddFlops( C, ( std::toupper(side)=='L' ? 2.*m*m*n : 2.*m*n*n ) );
     EL_BLAS(chemm)
     ( &side, &uplo, &m, &n,
       &alpha, A, &ALDim, B, &BLDim, &beta, C, &CLDim );
@@ -363,6 +367,7 @@ void Hemm
   const dcomplex& beta,
         dcomplex* C, BlasInt CLDim )
 {
+    profile::AddFlops( C, ( std::toupper(side)=='L' ? 2.*m*m*n : 2.*m*n*n ) );
     EL_BLAS(zhemm)
     ( &side, &uplo, &m, &n,
       &alpha, A, &ALDim, B, &BLDim, &beta, C, &CLDim );
@@ -378,6 +383,7 @@ void Symm
   const T& beta,
         T* C, BlasInt CLDim )
 {
+    profile::AddFlops( C, ( std::toupper(side)=='L' ? 2.*m*m*n : 2.*m*n*n ) );
     // NOTE: Temporaries are avoided since constructing a BigInt/BigFloat
     //       involves a memory allocation
 
@@ -632,6 +638,7 @@ void Symm
   const float& beta,
         float* C, BlasInt CLDim )
 {
+    profile::AddFlops( C, ( std::toupper(side)=='L' ? 2.*m*m*n : 2.*m*n*n ) );
     EL_BLAS(ssymm)
     ( &side, &uplo, &m, &n, &alpha, A, &ALDim, B, &BLDim, &beta, C, &CLDim );
 }
@@ -644,6 +651,7 @@ void Symm
   const double& beta,
         double* C, BlasInt CLDim )
 {
+    profile::AddFlops( C, ( std::toupper(side)=='L' ? 2.*m*m*n : 2.*m*n*n ) );
     EL_BLAS(dsymm)
     ( &side, &uplo, &m, &n, &alpha, A, &ALDim, B, &BLDim, &beta, C, &CLDim );
 }
@@ -656,6 +664,7 @@ void Symm
   const scomplex& beta,
         scomplex* C, BlasInt CLDim )
 {
+    profile::AddFlops( C, ( std::toupper(side)=='L' ? 2.*m*m*n : 2.*m*n*n ) );
     EL_BLAS(csymm)
     ( &side, &uplo, &m, &n, &alpha, A, &ALDim, B, &BLDim, &beta, C, &CLDim );
 }
@@ -668,6 +677,7 @@ void Symm
   const dcomplex& beta,
         dcomplex* C, BlasInt CLDim )
 {
+    profile::AddFlops( C, ( std::toupper(side)=='L' ? 2.*m*m*n : 2.*m*n*n ) );
     EL_BLAS(zsymm)
     ( &side, &uplo, &m, &n, &alpha, A, &ALDim, B, &BLDim, &beta, C, &CLDim );
 }
@@ -70,6 +70,7 @@ void Her2k
   const Base<T>& beta,
         T* C, BlasInt CLDim )
 {
+    profile::AddFlops( C, 2.*n*n*k );
     // NOTE: Temporaries are avoided since constructing a BigInt/BigFloat
     //       involves a memory allocation
     if( beta == Base<T>(0) )
@@ -295,6 +296,7 @@ void Her2k
   const float& beta,
         float* C, BlasInt CLDim )
 {
+    profile::AddFlops( C, 2.*n*n*k );
     const char transFixed = ( trans == 'C' ? 'T' : trans );
     EL_BLAS(ssyr2k)
     ( &uplo, &transFixed, &n, &k,
@@ -310,6 +312,7 @@ void Her2k
   const double& beta,
         double* C, BlasInt CLDim )
 {
+    profile::AddFlops( C, 2.*n*n*k );
     const char transFixed = ( trans == 'C' ? 'T' : trans );
     EL_BLAS(dsyr2k)
     ( &uplo, &transFixed, &n, &k,
@@ -325,6 +328,7 @@ void Her2k
   const float& beta,
         scomplex* C, BlasInt CLDim )
 {
+    profile::AddFlops( C, 2.*n*n*k );
     EL_BLAS(cher2k)
     ( &uplo, &trans, &n, &k,
       &alpha, A, &ALDim, B, &BLDim, &beta, C, &CLDim );
@@ -339,6 +343,7 @@ void Her2k
   const double& beta,
         dcomplex* C, BlasInt CLDim )
 {
+    profile::AddFlops( C, 2.*n*n*k );
     EL_BLAS(zher2k)
     ( &uplo, &trans, &n, &k,
       &alpha, A, &ALDim, B, &BLDim, &beta, C, &CLDim );
@@ -354,6 +359,7 @@ void Syr2k
   const T& beta,
         T* C, BlasInt CLDim )
 {
+    profile::AddFlops( C, 2.*n*n*k );
     // NOTE: Temporaries are avoided since constructing a BigInt/BigFloat
     //       involves a memory allocation
     if( beta == T(0) )
@@ -566,6 +572,7 @@ void Syr2k
   const float& beta,
         float* C, BlasInt CLDim )
 {
+    profile::AddFlops( C, 2.*n*n*k );
     EL_BLAS(ssyr2k)
     ( &uplo, &trans, &n, &k, &alpha, A, &ALDim, B, &BLDim, &beta, C, &CLDim );
 }
@@ -579,6 +586,7 @@ void Syr2k
   const double& beta,
         double* C, BlasInt CLDim )
 {
+    profile::AddFlops( C, 2.*n*n*k );
     EL_BLAS(dsyr2k)
     ( &uplo, &trans, &n, &k, &alpha, A, &ALDim, B, &BLDim, &beta, C, &CLDim );
 }
@@ -592,6 +600,7 @@ void Syr2k
   const scomplex& beta,
         scomplex* C, BlasInt CLDim )
 {
+    profile::AddFlops( C, 2.*n*n*k );
     EL_BLAS(csyr2k)
     ( &uplo, &trans, &n, &k, &alpha, A, &ALDim, B, &BLDim, &beta, C, &CLDim );
 }
@@ -605,6 +614,7 @@ void Syr2k
   const dcomplex& beta,
         dcomplex* C, BlasInt CLDim )
 {
+    profile::AddFlops( C, 2.*n*n*k );
     EL_BLAS(zsyr2k)
     ( &uplo, &trans, &n, &k, &alpha, A, &ALDim, B, &BLDim, &beta, C, &CLDim );
 }
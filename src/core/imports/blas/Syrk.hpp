@@ -63,6 +63,7 @@ void Herk
   const Base<T>& beta,
         T* C, BlasInt CLDim )
 {
+    profile::AddFlops( C, double(n)*n*k );
     // NOTE: Temporaries are avoided since constructing a BigInt/BigFloat
     //       involves a memory allocation
     if( beta == Base<T>(0) )
@@ -248,6 +249,15 @@ void Herk
   const float& beta,
         float* C, BlasInt CLDim )
 {
+    profile::AddFlops( C, double(n)*n*k );
+#ifdef EL_HAVE_CUDA
+    if( cuda::Offload( double(n)*n*k ) )
+    {
+        cuda::Herk
+        ( uplo, trans, n, k, alpha, A, ALDim, beta, C, CLDim );
+        return;
+    }
+#endif
     const char transFixed = ( std::toupper(trans) == 'C' ? 'T' : trans );
     EL_BLAS(ssyrk)
     ( &uplo, &transFixed, &n, &k, &alpha, A, &ALDim, &beta, C, &CLDim );
@@ -261,6 +271,15 @@ void Herk
   const double& beta,
         double* C, BlasInt CLDim )
 {
+    profile::AddFlops( C, double(n)*n*k );
+#ifdef EL_HAVE_CUDA
+    if( cuda::Offload( double(n)*n*k ) )
+    {
+        cuda::Herk
+        ( uplo, trans, n, k, alpha, A, ALDim, beta, C, CLDim );
+        return;
+    }
+#endif
     const char transFixed = ( std::toupper(trans) == 'C' ? 'T' : trans );
     EL_BLAS(dsyrk)
     ( &uplo, &transFixed, &n, &k, &alpha, A, &ALDim, &beta, C, &CLDim );
@@ -274,6 +293,15 @@ void Herk
   const float& beta,
         scomplex* C, BlasInt CLDim )
 {
+    profile::AddFlops( C, double(n)*n*k );
+#ifdef EL_HAVE_CUDA
+    if( cuda::Offload( double(n)*n*k ) )
+    {
+        cuda::Herk
+        ( uplo, trans, n, k, alpha, A, ALDim, beta, C, CLDim );
+        return;
+    }
+#endif
     EL_BLAS(cherk)
     ( &uplo, &trans, &n, &k, &alpha, A, &ALDim, &beta, C, &CLDim );
 }
@@ -286,6 +314,15 @@ void Herk
   const double& beta,
         dcomplex* C, BlasInt CLDim )
 {
+    profile::AddFlops( C, double(n)*n*k );
+#ifdef EL_HAVE_CUDA
+    if( cuda::Offload( double(n)*n*k ) )
+    {
+        cuda::Herk
+        ( uplo, trans, n, k, alpha, A, ALDim, beta, C, CLDim );
+        return;
+    }
+#endif
     EL_BLAS(zherk)
     ( &uplo, &trans, &n, &k, &alpha, A, &ALDim, &beta, C, &CLDim );
 }
@@ -299,6 +336,7 @@ void Syrk
   const T& beta,
         T* C, BlasInt CLDim )
 {
+    profile::AddFlops( C, double(n)*n*k );
     // NOTE: Temporaries are avoided since constructing a BigInt/BigFloat
     //       involves a memory allocation
     if( beta == T(0) )
@@ -483,6 +521,15 @@ void Syrk
   const float& beta,
         float* C, BlasInt CLDim )
 {
+    profile::AddFlops( C, double(n)*n*k );
+#ifdef EL_HAVE_CUDA
+    if( cuda::Offload( double(n)*n*k ) )
+    {
+        cuda::Syrk
+        ( uplo, trans, n, k, alpha, A, ALDim, beta, C, CLDim );
+        return;
+    }
+#endif
     EL_BLAS(ssyrk)
     ( &uplo, &trans, &n, &k, &alpha, A, &ALDim, &beta, C, &CLDim );
 }
@@ -494,6 +541,15 @@ void Syrk
   const double& beta,
         double* C, BlasInt CLDim )
 {
+    profile::AddFlops( C, double(n)*n*k );
+#ifdef EL_HAVE_CUDA
+    if( cuda::Offload( double(n)*n*k ) )
+    {
+        cuda::Syrk
+        ( uplo, trans, n, k, alpha, A, ALDim, beta, C, CLDim );
+        return;
+    }
+#endif
     EL_BLAS(dsyrk)
     ( &uplo, &trans, &n, &k, &alpha, A, &ALDim, &beta, C, &CLDim );
 }
@@ -505,6 +561,15 @@ void Syrk
   const scomplex& beta,
         scomplex* C, BlasInt CLDim )
 {
+    profile::AddFlops( C, double(n)*n*k );
+#ifdef EL_HAVE_CUDA
+    if( cuda::Offload( double(n)*n*k ) )
+    {
+        cuda::Syrk
+        ( uplo, trans, n, k, alpha, A, ALDim, beta, C, CLDim );
+        return;
+    }
+#endif
     EL_BLAS(csyrk)
     ( &uplo, &trans, &n, &k, &alpha, A, &ALDim, &beta, C, &CLDim );
 }
@@ -516,6 +581,15 @@ void Syrk
   const dcomplex& beta,
         dcomplex* C, BlasInt CLDim )
 {
+    profile::AddFlops( C, double(n)*n*k );
+#ifdef EL_HAVE_CUDA
+    if( cuda::Offload( double(n)*n*k ) )
+    {
+        cuda::Syrk
+        ( uplo, trans, n, k, alpha, A, ALDim, beta, C, CLDim );
+        return;
+    }
+#endif
     EL_BLAS(zsyrk)
     ( &uplo, &trans, &n, &k, &alpha, A, &ALDim, &beta, C, &CLDim );
 }
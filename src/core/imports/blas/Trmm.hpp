@@ -45,6 +45,8 @@ void Trmm
   const T* A, BlasInt ALDim,
         T* B, BlasInt BLDim )
 {
+    profile::AddFlops
+    ( B, ( std::toupper(side)=='L' ? double(m)*m*n : double(m)*n*n ) );
     const bool onLeft = ( std::toupper(side) == 'L' );
     const bool conjugate = ( std::toupper(trans) == 'C' );
 
@@ -151,6 +153,8 @@ void Trmm
   const float* A, BlasInt ALDim,
         float* B, BlasInt BLDim )
 {
+    profile::AddFlops
+    ( B, ( std::toupper(side)=='L' ? double(m)*m*n : double(m)*n*n ) );
     const char fixedTrans = ( std::toupper(trans) == 'C' ? 'T' : trans );    
     EL_BLAS(strmm)
     ( &side, &uplo, &fixedTrans, &unit, &m, &n, &alpha, A, &ALDim, B, &BLDim );
@@ -162,6 +166,8 @@ void Trmm
   const double* A, BlasInt ALDim,
         double* B, BlasInt BLDim )
 {
+    profile::AddFlops
+    ( B, ( std::toupper(side)=='L' ? double(m)*m*n : double(m)*n*n ) );
     const char fixedTrans = ( std::toupper(trans) == 'C' ? 'T' : trans );    
     EL_BLAS(dtrmm)
     ( &side, &uplo, &fixedTrans, &unit, &m, &n, &alpha, A, &ALDim, B, &BLDim );
@@ -173,6 +179,8 @@ void Trmm
   const scomplex* A, BlasInt ALDim,
         scomplex* B, BlasInt BLDim )
 {
+    profile::AddFlops
+    ( B, ( std::toupper(side)=='L' ? double(m)*m*n : double(m)*n*n ) );
     EL_BLAS(ctrmm)
     ( &side, &uplo, &trans, &unit, &m, &n, &alpha, A, &ALDim, B, &BLDim );
 }
@@ -183,6 +191,8 @@ void Trmm
   const dcomplex* A, BlasInt ALDim,
         dcomplex* B, BlasInt BLDim )
 {
+    profile::AddFlops
+    ( B, ( std::toupper(side)=='L' ? double(m)*m*n : double(m)*n*n ) );
     EL_BLAS(ztrmm)
     ( &side, &uplo, &trans, &unit, &m, &n, &alpha, A, &ALDim, B, &BLDim );
 }
@@ -45,6 +45,8 @@ void Trsm
   const F* A, BlasInt ALDim,
         F* B, BlasInt BLDim )
 {
+    profile::AddFlops
+    ( B, ( std::toupper(side)=='L' ? double(m)*m*n : double(m)*n*n ) );
     // NOTE: Temporaries are avoided since constructing a BigInt/BigFloat
     //       involves a memory allocation
     const bool onLeft = ( std::toupper(side) == 'L' );
@@ -355,6 +357,17 @@ void Trsm
   const float* A, BlasInt ALDim,
         float* B, BlasInt BLDim )
 {
+    profile::AddFlops
+    ( B, ( std::toupper(side)=='L' ? double(m)*m*n : double(m)*n*n ) );
+#ifdef EL_HAVE_CUDA
+    if( cuda::Offload
+        ( std::toupper(side)=='L' ? double(m)*m*n : double(m)*n*n ) )
+    {
+        cuda::Trsm
+        ( side, uplo, trans, unit, m, n, alpha, A, ALDim, B, BLDim );
+        return;
+    }
+#endif
     const char fixedTrans = ( std::toupper(trans) == 'C' ? 'T' : trans );
     EL_BLAS(strsm)
     ( &side, &uplo, &fixedTrans, &unit, &m, &n, &alpha, A, &ALDim, B, &BLDim );
@@ -367,6 +380,17 @@ void Trsm
   const double* A, BlasInt ALDim,
         double* B, BlasInt BLDim )
 {
+    profile::AddFlops
+    ( B, ( std::toupper(side)=='L' ? double(m)*m*n : double(m)*n*n ) );
+#ifdef EL_HAVE_CUDA
+    if( cuda::Offload
+        ( std::toupper(side)=='L' ? double(m)*m*n : double(m)*n*n ) )
+    {
+        cuda::Trsm
+        ( side, uplo, trans, unit, m, n, alpha, A, ALDim, B, BLDim );
+        return;
+    }
+#endif
     const char fixedTrans = ( std::toupper(trans) == 'C' ? 'T' : trans );
     EL_BLAS(dtrsm)
     ( &side, &uplo, &fixedTrans, &unit, &m, &n, &alpha, A, &ALDim, B, &BLDim );
@@ -379,6 +403,17 @@ void Trsm
   const scomplex* A, BlasInt ALDim,
         scomplex* B, BlasInt BLDim )
 {
+    profile::AddFlops
+    ( B, ( std::toupper(side)=='L' ? double(m)*m*n : double(m)*n*n ) );
+#ifdef EL_HAVE_CUDA
+    if( cuda::Offload
+        ( std::toupper(side)=='L' ? double(m)*m*n : double(m)*n*n ) )
+    {
+        cuda::Trsm
+        ( side, uplo, trans, unit, m, n, alpha, A, ALDim, B, BLDim );
+        return;
+    }
+#endif
     EL_BLAS(ctrsm)
     ( &side, &uplo, &trans, &unit, &m, &n, &alpha, A, &ALDim, B, &BLDim );
 } 
@@ -390,6 +425,17 @@ void Trsm
   const dcomplex* A, BlasInt ALDim,
         dcomplex* B, BlasInt BLDim )
 {
+    profile::AddFlops
+    ( B, ( std::toupper(side)=='L' ? double(m)*m*n : double(m)*n*n ) );
+#ifdef EL_HAVE_CUDA
+    if( cuda::Offload
+        ( std::toupper(side)=='L' ? double(m)*m*n : double(m)*n*n ) )
+    {
+        cuda::Trsm
+        ( side, uplo, trans, unit, m, n, alpha, A, ALDim, B, BLDim );
+        return;
+    }
+#endif
     EL_BLAS(ztrsm)
     ( &side, &uplo, &trans, &unit, &m, &n, &alpha, A, &ALDim, B, &BLDim );
 } 
@@ -0,0 +1,702 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El-lite.hpp>
+#ifdef EL_HAVE_CUDA
+#include <mutex>
+#include <cuda_runtime.h>
+#include <cublas_v2.h>
+
+namespace El {
+
+namespace {
+
+// Every device call is serialized through this mutex, which also guards the
+// state below
+std::mutex gpuMutex;
+GPUCtrl gpuCtrl;
+bool initialized=false, haveDevice=false;
+cublasHandle_t handle;
+
+// Each operand of an offloaded call is staged through its own workspace
+cuda::DeviceMemory<byte> workspaces[3];
+
+// The device-resident front factorizations run on their own stream, and two
+// sets of buffers are alternated so that the (pinned) download of one factor
+// overlaps the factorization of the next front
+cudaStream_t frontStream;
+struct FrontSlot
+{
+    cuda::DeviceMemory<byte> L, update, panel, scale;
+    byte* pinned=nullptr;
+    size_t pinnedSize=0;
+    cudaEvent_t downloaded;
+
+    // The destination of the pending download of the factor
+    bool pending=false;
+    byte* dest=nullptr;
+    BlasInt height=0, width=0, ldim=0;
+    void (*unpack)( FrontSlot& )=nullptr;
+};
+FrontSlot frontSlots[2];
+int nextFrontSlot=0;
+
+void CheckCUDA( cudaError_t error )
+{
+    if( error != cudaSuccess )
+        RuntimeError("CUDA error: ",cudaGetErrorString(error));
+}
+
+void CheckCuBLAS( cublasStatus_t status )
+{
+    if( status != CUBLAS_STATUS_SUCCESS )
+        RuntimeError("cuBLAS call failed with status ",int(status));
+}
+
+// NOTE: Must be called while holding gpuMutex
+void InitializeDevice()
+{
+    if( initialized )
+        return;
+    initialized = true;
+    int numDevices = 0;
+    if( cudaGetDeviceCount( &numDevices ) != cudaSuccess || numDevices == 0 )
+        return;
+    const int device =
+      ( gpuCtrl.device >= 0 ? gpuCtrl.device :
+        mpi::Rank(mpi::COMM_WORLD) % numDevices );
+    CheckCUDA( cudaSetDevice( device ) );
+    CheckCuBLAS( cublasCreate( &handle ) );
+    CheckCUDA( cudaStreamCreate( &frontStream ) );
+    for( auto& slot : frontSlots )
+        CheckCUDA
+        ( cudaEventCreateWithFlags
+          ( &slot.downloaded, cudaEventDisableTiming ) );
+    haveDevice = true;
+}
+
+// Copy a (pinned) column-major factor into its destination while zeroing its
+// strictly-upper triangle
+template<typename F>
+void UnpackFront( FrontSlot& slot )
+{
+    const F* pinned = reinterpret_cast<const F*>( slot.pinned );
+    F* dest = reinterpret_cast<F*>( slot.dest );
+    for( BlasInt j=0; j<slot.width; ++j )
+    {
+        F* destCol = &dest[j*slot.ldim];
+        const F* pinnedCol = &pinned[j*slot.height];
+        for( BlasInt i=0; i<Min(j,slot.height); ++i )
+            destCol[i] = F(0);
+        for( BlasInt i=j; i<slot.height; ++i )
+            destCol[i] = pinnedCol[i];
+    }
+}
+
+// NOTE: Must be called while holding gpuMutex
+void FinishFront( FrontSlot& slot )
+{
+    if( !slot.pending )
+        return;
+    CheckCUDA( cudaEventSynchronize( slot.downloaded ) );
+    slot.unpack( slot );
+    slot.pending = false;
+}
+
+// Unblocked LDL^T (or LDL^H) of an n x n matrix which only references its
+// lower triangle
+template<typename F>
+void LocalLDL( bool conjugate, BlasInt n, F* A, BlasInt ALDim, F* diag )
+{
+    for( BlasInt j=0; j<n; ++j )
+    {
+        const F delta = A[j+j*ALDim];
+        if( delta == F(0) )
+            throw ZeroPivotException();
+        diag[j] = delta;
+        // A22 := A22 - a21 a21^{T/H} / delta, with a21 := a21 / delta
+        for( BlasInt l=j+1; l<n; ++l )
+        {
+            const F alpha = ( conjugate ? Conj(A[l+j*ALDim]) : A[l+j*ALDim] );
+            const F gamma = alpha/delta;
+            for( BlasInt i=l; i<n; ++i )
+                A[i+l*ALDim] -= A[i+j*ALDim]*gamma;
+        }
+        for( BlasInt i=j+1; i<n; ++i )
+            A[i+j*ALDim] /= delta;
+    }
+}
+
+// Points the cuBLAS handle at the front stream for the lifetime of the guard
+struct FrontStreamGuard
+{
+    FrontStreamGuard()
+    { CheckCuBLAS( cublasSetStream( handle, frontStream ) ); }
+    ~FrontStreamGuard() { cublasSetStream( handle, 0 ); }
+};
+
+cublasOperation_t CuBLASOp( char trans )
+{
+    switch( std::toupper(trans) )
+    {
+    case 'N': return CUBLAS_OP_N;
+    case 'T': return CUBLAS_OP_T;
+    default:  return CUBLAS_OP_C;
+    }
+}
+
+cublasFillMode_t CuBLASFill( char uplo )
+{ return std::toupper(uplo) == 'L' ? CUBLAS_FILL_MODE_LOWER
+                                   : CUBLAS_FILL_MODE_UPPER; }
+
+// Copy the height x width matrix A into the given workspace (if 'copy')
+template<typename T>
+T* Stage
+( Int which, const T* A, BlasInt height, BlasInt width, BlasInt ALDim,
+  bool copy=true )
+{
+    T* dA = reinterpret_cast<T*>
+      ( workspaces[which].Require( size_t(height)*width*sizeof(T) ) );
+    if( copy && height > 0 && width > 0 )
+        CheckCuBLAS
+        ( cublasSetMatrix
+          ( height, width, sizeof(T), A, ALDim, dA, Max(height,BlasInt(1)) ) );
+    return dA;
+}
+
+template<typename T>
+void Unstage( const T* dA, BlasInt height, BlasInt width, T* A, BlasInt ALDim )
+{
+    if( height > 0 && width > 0 )
+        CheckCuBLAS
+        ( cublasGetMatrix
+          ( height, width, sizeof(T), dA, Max(height,BlasInt(1)), A, ALDim ) );
+}
+
+inline const cuComplex* CuBLASType( const scomplex* A )
+{ return reinterpret_cast<const cuComplex*>(A); }
+inline const cuDoubleComplex* CuBLASType( const dcomplex* A )
+{ return reinterpret_cast<const cuDoubleComplex*>(A); }
+inline cuComplex* CuBLASType( scomplex* A )
+{ return reinterpret_cast<cuComplex*>(A); }
+inline cuDoubleComplex* CuBLASType( dcomplex* A )
+{ return reinterpret_cast<cuDoubleComplex*>(A); }
+inline const float* CuBLASType( const float* A ) { return A; }
+inline const double* CuBLASType( const double* A ) { return A; }
+inline float* CuBLASType( float* A ) { return A; }
+inline double* CuBLASType( double* A ) { return A; }
+
+#define EL_CUBLAS_GEMM(T,NAME) \
+  cublasStatus_t CuBLASGemm \
+  ( cublasOperation_t opA, cublasOperation_t opB, int m, int n, int k, \
+    const T* alpha, const T* A, int ALDim, const T* B, int BLDim, \
+    const T* beta, T* C, int CLDim ) \
+  { return NAME \
+    ( handle, opA, opB, m, n, k, CuBLASType(alpha), \
+      CuBLASType(A), ALDim, CuBLASType(B), BLDim, \
+      CuBLASType(beta), CuBLASType(C), CLDim ); }
+EL_CUBLAS_GEMM(float,cublasSgemm)
+EL_CUBLAS_GEMM(double,cublasDgemm)
+EL_CUBLAS_GEMM(scomplex,cublasCgemm)
+EL_CUBLAS_GEMM(dcomplex,cublasZgemm)
+#undef EL_CUBLAS_GEMM
+
+#define EL_CUBLAS_TRSM(F,NAME) \
+  cublasStatus_t CuBLASTrsm \
+  ( cublasSideMode_t side, cublasFillMode_t uplo, cublasOperation_t op, \
+    cublasDiagType_t diag, int m, int n, \
+    const F* alpha, const F* A, int ALDim, F* B, int BLDim ) \
+  { return NAME \
+    ( handle, side, uplo, op, diag, m, n, CuBLASType(alpha), \
+      CuBLASType(A), ALDim, CuBLASType(B), BLDim ); }
+EL_CUBLAS_TRSM(float,cublasStrsm)
+EL_CUBLAS_TRSM(double,cublasDtrsm)
+EL_CUBLAS_TRSM(scomplex,cublasCtrsm)
+EL_CUBLAS_TRSM(dcomplex,cublasZtrsm)
+#undef EL_CUBLAS_TRSM
+
+#define EL_CUBLAS_RANKK(T,TBASE,FUNC,NAME) \
+  cublasStatus_t FUNC \
+  ( cublasFillMode_t uplo, cublasOperation_t op, int n, int k, \
+    const TBASE* alpha, const T* A, int ALDim, \
+    const TBASE* beta, T* C, int CLDim ) \
+  { return NAME \
+    ( handle, uplo, op, n, k, CuBLASType(alpha), CuBLASType(A), ALDim, \
+      CuBLASType(beta), CuBLASType(C), CLDim ); }
+EL_CUBLAS_RANKK(float,float,CuBLASSyrk,cublasSsyrk)
+EL_CUBLAS_RANKK(double,double,CuBLASSyrk,cublasDsyrk)
+EL_CUBLAS_RANKK(scomplex,scomplex,CuBLASSyrk,cublasCsyrk)
+EL_CUBLAS_RANKK(dcomplex,dcomplex,CuBLASSyrk,cublasZsyrk)
+EL_CUBLAS_RANKK(scomplex,float,CuBLASHerk,cublasCherk)
+EL_CUBLAS_RANKK(dcomplex,double,CuBLASHerk,cublasZherk)
+#undef EL_CUBLAS_RANKK
+
+#define EL_CUBLAS_RANKKX(T,TBASE,FUNC,NAME) \
+  cublasStatus_t FUNC \
+  ( cublasFillMode_t uplo, cublasOperation_t op, int n, int k, \
+    const T* alpha, const T* A, int ALDim, const T* B, int BLDim, \
+    const TBASE* beta, T* C, int CLDim ) \
+  { return NAME \
+    ( handle, uplo, op, n, k, CuBLASType(alpha), CuBLASType(A), ALDim, \
+      CuBLASType(B), BLDim, CuBLASType(beta), CuBLASType(C), CLDim ); }
+EL_CUBLAS_RANKKX(float,float,CuBLASSyrkx,cublasSsyrkx)
+EL_CUBLAS_RANKKX(double,double,CuBLASSyrkx,cublasDsyrkx)
+EL_CUBLAS_RANKKX(scomplex,scomplex,CuBLASSyrkx,cublasCsyrkx)
+EL_CUBLAS_RANKKX(dcomplex,dcomplex,CuBLASSyrkx,cublasZsyrkx)
+EL_CUBLAS_RANKKX(scomplex,float,CuBLASHerkx,cublasCherkx)
+EL_CUBLAS_RANKKX(dcomplex,double,CuBLASHerkx,cublasZherkx)
+#undef EL_CUBLAS_RANKKX
+
+// C := C - A B^{T/H}, where the result is known to be symmetric (Hermitian)
+// and only its lower triangle is updated
+template<typename Real>
+void CuBLASLowerUpdate
+( bool conjugate, int n, int k,
+  const Real* A, int ALDim, const Real* B, int BLDim, Real* C, int CLDim )
+{
+    EL_UNUSED( conjugate );
+    const Real negOne=-1, one=1;
+    CheckCuBLAS
+    ( CuBLASSyrkx
+      ( CUBLAS_FILL_MODE_LOWER, CUBLAS_OP_N, n, k,
+        &negOne, A, ALDim, B, BLDim, &one, C, CLDim ) );
+}
+template<typename Real>
+void CuBLASLowerUpdate
+( bool conjugate, int n, int k,
+  const Complex<Real>* A, int ALDim, const Complex<Real>* B, int BLDim,
+  Complex<Real>* C, int CLDim )
+{
+    const Complex<Real> negOne=-1;
+    if( conjugate )
+    {
+        const Real one=1;
+        CheckCuBLAS
+        ( CuBLASHerkx
+          ( CUBLAS_FILL_MODE_LOWER, CUBLAS_OP_N, n, k,
+            &negOne, A, ALDim, B, BLDim, &one, C, CLDim ) );
+    }
+    else
+    {
+        const Complex<Real> one=1;
+        CheckCuBLAS
+        ( CuBLASSyrkx
+          ( CUBLAS_FILL_MODE_LOWER, CUBLAS_OP_N, n, k,
+            &negOne, A, ALDim, B, BLDim, &one, C, CLDim ) );
+    }
+}
+
+#define EL_CUBLAS_DGMM(T,NAME) \
+  cublasStatus_t CuBLASDgmm \
+  ( cublasSideMode_t side, int m, int n, const T* A, int ALDim, \
+    const T* x, int incx, T* C, int CLDim ) \
+  { return NAME \
+    ( handle, side, m, n, CuBLASType(A), ALDim, CuBLASType(x), incx, \
+      CuBLASType(C), CLDim ); }
+EL_CUBLAS_DGMM(float,cublasSdgmm)
+EL_CUBLAS_DGMM(double,cublasDdgmm)
+EL_CUBLAS_DGMM(scomplex,cublasCdgmm)
+EL_CUBLAS_DGMM(dcomplex,cublasZdgmm)
+#undef EL_CUBLAS_DGMM
+
+// Real Herk is Syrk (with 'C' interpreted as 'T')
+cublasStatus_t CuBLASHerk
+( cublasFillMode_t uplo, cublasOperation_t op, int n, int k,
+  const float* alpha, const float* A, int ALDim,
+  const float* beta, float* C, int CLDim )
+{ return CuBLASSyrk
+  ( uplo, op==CUBLAS_OP_C ? CUBLAS_OP_T : op, n, k,
+    alpha, A, ALDim, beta, C, CLDim ); }
+cublasStatus_t CuBLASHerk
+( cublasFillMode_t uplo, cublasOperation_t op, int n, int k,
+  const double* alpha, const double* A, int ALDim,
+  const double* beta, double* C, int CLDim )
+{ return CuBLASSyrk
+  ( uplo, op==CUBLAS_OP_C ? CUBLAS_OP_T : op, n, k,
+    alpha, A, ALDim, beta, C, CLDim ); }
+
+} // anonymous namespace
+
+void SetGPUCtrl( const GPUCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    std::lock_guard<std::mutex> guard( gpuMutex );
+    if( initialized && ctrl.device != gpuCtrl.device )
+        LogicError("The device cannot be changed after its first use");
+    gpuCtrl = ctrl;
+}
+
+GPUCtrl GetGPUCtrl()
+{
+    std::lock_guard<std::mutex> guard( gpuMutex );
+    return gpuCtrl;
+}
+
+void FinalizeCUDA()
+{
+    EL_DEBUG_CSE
+    std::lock_guard<std::mutex> guard( gpuMutex );
+    for( auto& workspace : workspaces )
+        workspace.Empty();
+    if( haveDevice )
+    {
+        for( auto& slot : frontSlots )
+        {
+            // A pending factor is dropped since its front may no longer exist
+            if( slot.pending )
+                cudaEventSynchronize( slot.downloaded );
+            slot.pending = false;
+            slot.L.Empty();
+            slot.update.Empty();
+            slot.panel.Empty();
+            slot.scale.Empty();
+            if( slot.pinned != nullptr )
+                cudaFreeHost( slot.pinned );
+            slot.pinned = nullptr;
+            slot.pinnedSize = 0;
+            cudaEventDestroy( slot.downloaded );
+        }
+        cudaStreamDestroy( frontStream );
+        cublasDestroy( handle );
+    }
+    initialized = haveDevice = false;
+}
+
+namespace cuda {
+
+void* Allocate( size_t numBytes )
+{
+    void* ptr = nullptr;
+    CheckCUDA( cudaMalloc( &ptr, Max(numBytes,size_t(1)) ) );
+    return ptr;
+}
+
+void Deallocate( void* ptr )
+{
+    if( ptr != nullptr )
+        CheckCUDA( cudaFree( ptr ) );
+}
+
+template<typename G>
+DeviceMemory<G>::DeviceMemory() : size_(0), buffer_(nullptr) { }
+
+// NOTE: Errors are ignored since the CUDA runtime may already have been
+//       unloaded when static workspaces are destroyed
+template<typename G>
+DeviceMemory<G>::~DeviceMemory()
+{
+    if( buffer_ != nullptr )
+        cudaFree( buffer_ );
+}
+
+template<typename G>
+G* DeviceMemory<G>::Buffer() const EL_NO_EXCEPT { return buffer_; }
+
+template<typename G>
+size_t DeviceMemory<G>::Size() const EL_NO_EXCEPT { return size_; }
+
+template<typename G>
+G* DeviceMemory<G>::Require( size_t size )
+{
+    if( size > size_ )
+    {
+        Empty();
+        buffer_ = static_cast<G*>( Allocate( size*sizeof(G) ) );
+        size_ = size;
+    }
+    return buffer_;
+}
+
+template<typename G>
+void DeviceMemory<G>::Empty()
+{
+    Deallocate( buffer_ );
+    buffer_ = nullptr;
+    size_ = 0;
+}
+
+bool Offload( double flops )
+{
+    std::lock_guard<std::mutex> guard( gpuMutex );
+    if( !gpuCtrl.offload || flops < gpuCtrl.minFlops )
+        return false;
+    InitializeDevice();
+    return haveDevice;
+}
+
+template<typename T>
+void Gemm
+( char transA, char transB,
+  BlasInt m, BlasInt n, BlasInt k,
+  const T& alpha,
+  const T* A, BlasInt ALDim,
+  const T* B, BlasInt BLDim,
+  const T& beta,
+        T* C, BlasInt CLDim )
+{
+    EL_DEBUG_CSE
+    std::lock_guard<std::mutex> guard( gpuMutex );
+    const bool normalA = ( std::toupper(transA) == 'N' );
+    const bool normalB = ( std::toupper(transB) == 'N' );
+    const BlasInt AHeight = ( normalA ? m : k );
+    const BlasInt BHeight = ( normalB ? k : n );
+    const T* dA = Stage( 0, A, AHeight, normalA ? k : m, ALDim );
+    const T* dB = Stage( 1, B, BHeight, normalB ? n : k, BLDim );
+    T* dC = Stage( 2, C, m, n, CLDim, beta != T(0) );
+    CheckCuBLAS
+    ( CuBLASGemm
+      ( CuBLASOp(transA), CuBLASOp(transB), m, n, k,
+        &alpha, dA, Max(AHeight,BlasInt(1)), dB, Max(BHeight,BlasInt(1)),
+        &beta, dC, Max(m,BlasInt(1)) ) );
+    Unstage( dC, m, n, C, CLDim );
+}
+
+template<typename F>
+void Trsm
+( char side, char uplo, char trans, char unit,
+  BlasInt m, BlasInt n,
+  const F& alpha,
+  const F* A, BlasInt ALDim,
+        F* B, BlasInt BLDim )
+{
+    EL_DEBUG_CSE
+    std::lock_guard<std::mutex> guard( gpuMutex );
+    const bool onLeft = ( std::toupper(side) == 'L' );
+    const BlasInt order = ( onLeft ? m : n );
+    const F* dA = Stage( 0, A, order, order, ALDim );
+    F* dB = Stage( 1, B, m, n, BLDim );
+    CheckCuBLAS
+    ( CuBLASTrsm
+      ( onLeft ? CUBLAS_SIDE_LEFT : CUBLAS_SIDE_RIGHT, CuBLASFill(uplo),
+        CuBLASOp(trans),
+        std::toupper(unit) == 'U' ? CUBLAS_DIAG_UNIT : CUBLAS_DIAG_NON_UNIT,
+        m, n, &alpha, dA, Max(order,BlasInt(1)), dB, Max(m,BlasInt(1)) ) );
+    Unstage( dB, m, n, B, BLDim );
+}
+
+template<typename T>
+void Herk
+( char uplo, char trans,
+  BlasInt n, BlasInt k,
+  const Base<T>& alpha,
+  const T* A, BlasInt ALDim,
+  const Base<T>& beta,
+        T* C, BlasInt CLDim )
+{
+    EL_DEBUG_CSE
+    std::lock_guard<std::mutex> guard( gpuMutex );
+    const bool normal = ( std::toupper(trans) == 'N' );
+    const BlasInt AHeight = ( normal ? n : k );
+    const T* dA = Stage( 0, A, AHeight, normal ? k : n, ALDim );
+    // The opposite triangle of C must be preserved
+    T* dC = Stage( 1, C, n, n, CLDim );
+    CheckCuBLAS
+    ( CuBLASHerk
+      ( CuBLASFill(uplo), CuBLASOp(trans), n, k,
+        &alpha, dA, Max(AHeight,BlasInt(1)), &beta, dC, Max(n,BlasInt(1)) ) );
+    Unstage( dC, n, n, C, CLDim );
+}
+
+template<typename T>
+void Syrk
+( char uplo, char trans,
+  BlasInt n, BlasInt k,
+  const T& alpha,
+  const T* A, BlasInt ALDim,
+  const T& beta,
+        T* C, BlasInt CLDim )
+{
+    EL_DEBUG_CSE
+    std::lock_guard<std::mutex> guard( gpuMutex );
+    const bool normal = ( std::toupper(trans) == 'N' );
+    const BlasInt AHeight = ( normal ? n : k );
+    const T* dA = Stage( 0, A, AHeight, normal ? k : n, ALDim );
+    T* dC = Stage( 1, C, n, n, CLDim );
+    CheckCuBLAS
+    ( CuBLASSyrk
+      ( CuBLASFill(uplo), normal ? CUBLAS_OP_N : CUBLAS_OP_T, n, k,
+        &alpha, dA, Max(AHeight,BlasInt(1)), &beta, dC, Max(n,BlasInt(1)) ) );
+    Unstage( dC, n, n, C, CLDim );
+}
+
+bool OffloadFront( Int height, Int width )
+{
+    std::lock_guard<std::mutex> guard( gpuMutex );
+    if( !gpuCtrl.offload || !gpuCtrl.offloadFronts || width == 0 ||
+        height < gpuCtrl.minFrontSize )
+        return false;
+    InitializeDevice();
+    return haveDevice;
+}
+
+template<typename F>
+void FrontLDL
+( bool conjugate, BlasInt m, BlasInt n,
+  F* AL, BlasInt ALDim, F* ABR, BlasInt ABRLDim, F* diag )
+{
+    EL_DEBUG_CSE
+    std::lock_guard<std::mutex> guard( gpuMutex );
+    InitializeDevice();
+    if( !haveDevice )
+        LogicError("There is no device to factor the front on");
+    const BlasInt mB = m - n;
+    const BlasInt bsize = Blocksize();
+    const size_t entrySize = sizeof(F);
+    const cublasOperation_t op = ( conjugate ? CUBLAS_OP_C : CUBLAS_OP_T );
+    const F one=1, negOne=-1;
+
+    // The buffers of this slot may still hold the factor of an earlier front
+    FrontSlot& slot = frontSlots[nextFrontSlot];
+    nextFrontSlot = 1 - nextFrontSlot;
+    FinishFront( slot );
+
+    F* dL = reinterpret_cast<F*>( slot.L.Require( size_t(m)*n*entrySize ) );
+    F* dU =
+      reinterpret_cast<F*>( slot.update.Require( size_t(mB)*mB*entrySize ) );
+    F* dS = reinterpret_cast<F*>
+      ( slot.panel.Require( size_t(m)*Min(bsize,n)*entrySize ) );
+    F* dScale = reinterpret_cast<F*>( slot.scale.Require( bsize*entrySize ) );
+
+    FrontStreamGuard streamGuard;
+    CheckCUDA
+    ( cudaMemcpy2DAsync
+      ( dL, m*entrySize, AL, ALDim*entrySize, m*entrySize, n,
+        cudaMemcpyHostToDevice, frontStream ) );
+    if( mB > 0 )
+        CheckCUDA
+        ( cudaMemcpy2DAsync
+          ( dU, mB*entrySize, ABR, ABRLDim*entrySize, mB*entrySize, mB,
+            cudaMemcpyHostToDevice, frontStream ) );
+
+    vector<F> block( bsize*bsize ), scale( bsize );
+    for( BlasInt k=0; k<n; k+=bsize )
+    {
+        const BlasInt nb = Min(bsize,n-k);
+        const BlasInt m2 = m-(k+nb);
+        const BlasInt n2 = n-(k+nb);
+        F* dL11 = &dL[k+k*m];
+        F* dL21 = &dL11[nb];
+
+        // Factor the diagonal block on the host
+        CheckCUDA
+        ( cudaMemcpy2DAsync
+          ( block.data(), nb*entrySize, dL11, m*entrySize, nb*entrySize, nb,
+            cudaMemcpyDeviceToHost, frontStream ) );
+        CheckCUDA( cudaStreamSynchronize( frontStream ) );
+        LocalLDL( conjugate, nb, block.data(), nb, &diag[k] );
+        CheckCUDA
+        ( cudaMemcpy2DAsync
+          ( dL11, m*entrySize, block.data(), nb*entrySize, nb*entrySize, nb,
+            cudaMemcpyHostToDevice, frontStream ) );
+        if( m2 == 0 )
+            continue;
+
+        // L21 := A21 L11^{-T/H} D^{-1}, keeping S21 := A21 L11^{-T/H}
+        CheckCuBLAS
+        ( CuBLASTrsm
+          ( CUBLAS_SIDE_RIGHT, CUBLAS_FILL_MODE_LOWER, op, CUBLAS_DIAG_UNIT,
+            m2, nb, &one, dL11, m, dL21, m ) );
+        CheckCUDA
+        ( cudaMemcpy2DAsync
+          ( dS, m2*entrySize, dL21, m*entrySize, m2*entrySize, nb,
+            cudaMemcpyDeviceToDevice, frontStream ) );
+        for( BlasInt j=0; j<nb; ++j )
+            scale[j] = F(1)/diag[k+j];
+        CheckCUDA
+        ( cudaMemcpyAsync
+          ( dScale, scale.data(), nb*entrySize, cudaMemcpyHostToDevice,
+            frontStream ) );
+        CheckCuBLAS
+        ( CuBLASDgmm
+          ( CUBLAS_SIDE_RIGHT, m2, nb, dL21, m, dScale, 1, dL21, m ) );
+
+        // Update the remainder of the panel and the Schur complement
+        if( n2 > 0 )
+            CheckCuBLAS
+            ( CuBLASGemm
+              ( CUBLAS_OP_N, op, m2, n2, nb,
+                &negOne, dS, m2, dL21, m, &one, &dL21[nb*m], m ) );
+        if( mB > 0 )
+            CuBLASLowerUpdate
+            ( conjugate, mB, nb, &dS[n2], m2, &dL21[n2], m, dU, mB );
+    }
+
+    // The update is needed immediately by the parent's extend-add, whereas
+    // the factor is only needed once the factorization completes
+    if( mB > 0 )
+        CheckCUDA
+        ( cudaMemcpy2DAsync
+          ( ABR, ABRLDim*entrySize, dU, mB*entrySize, mB*entrySize, mB,
+            cudaMemcpyDeviceToHost, frontStream ) );
+    CheckCUDA( cudaStreamSynchronize( frontStream ) );
+
+    const size_t factorSize = size_t(m)*n*entrySize;
+    if( factorSize > slot.pinnedSize )
+    {
+        if( slot.pinned != nullptr )
+            CheckCUDA( cudaFreeHost( slot.pinned ) );
+        slot.pinned = nullptr;
+        slot.pinnedSize = 0;
+        void* pinned;
+        CheckCUDA( cudaMallocHost( &pinned, factorSize ) );
+        slot.pinned = static_cast<byte*>( pinned );
+        slot.pinnedSize = factorSize;
+    }
+    CheckCUDA
+    ( cudaMemcpyAsync
+      ( slot.pinned, dL, factorSize, cudaMemcpyDeviceToHost, frontStream ) );
+    CheckCUDA( cudaEventRecord( slot.downloaded, frontStream ) );
+    slot.pending = true;
+    slot.dest = reinterpret_cast<byte*>( AL );
+    slot.height = m;
+    slot.width = n;
+    slot.ldim = ALDim;
+    slot.unpack = &UnpackFront<F>;
+}
+
+void FinishFronts()
+{
+    EL_DEBUG_CSE
+    std::lock_guard<std::mutex> guard( gpuMutex );
+    for( auto& slot : frontSlots )
+        FinishFront( slot );
+}
+
+template class DeviceMemory<byte>;
+
+#define PROTO(T) \
+  template void Gemm \
+  ( char transA, char transB, BlasInt m, BlasInt n, BlasInt k, \
+    const T& alpha, const T* A, BlasInt ALDim, const T* B, BlasInt BLDim, \
+    const T& beta, T* C, BlasInt CLDim ); \
+  template void Trsm \
+  ( char side, char uplo, char trans, char unit, BlasInt m, BlasInt n, \
+    const T& alpha, const T* A, BlasInt ALDim, T* B, BlasInt BLDim ); \
+  template void Herk \
+  ( char uplo, char trans, BlasInt n, BlasInt k, \
+    const Base<T>& alpha, const T* A, BlasInt ALDim, \
+    const Base<T>& beta, T* C, BlasInt CLDim ); \
+  template void Syrk \
+  ( char uplo, char trans, BlasInt n, BlasInt k, \
+    const T& alpha, const T* A, BlasInt ALDim, \
+    const T& beta, T* C, BlasInt CLDim ); \
+  template void FrontLDL \
+  ( bool conjugate, BlasInt m, BlasInt n, \
+    T* AL, BlasInt ALDim, T* ABR, BlasInt ABRLDim, T* diag );
+
+PROTO(float)
+PROTO(double)
+PROTO(scomplex)
+PROTO(dcomplex)
+
+#undef PROTO
+
+} // namespace cuda
+} // namespace El
+
+#endif // ifdef EL_HAVE_CUDA
@@ -39,13 +39,32 @@ mpfr_prec_t BigFloat::Precision() const
 
 void BigFloat::SetPrecision( mpfr_prec_t prec )
 {
-    mpfr_set_prec( mpfrFloat_, prec ); 
+    if( ownsLimbs_ )
+    {
+        mpfr_set_prec( mpfrFloat_, prec ); 
+    }
+    else
+    {
+        // The external limbs cannot be reallocated, so detach from them
+        // (the value is reset to NaN, as with mpfr_set_prec)
+        mpfr_init2( mpfrFloat_, prec );
+        ownsLimbs_ = true;
+    }
     SetNumLimbs( prec );
 }
 
 size_t BigFloat::NumLimbs() const
 { return numLimbs_; }
 
+bool BigFloat::OwnsLimbs() const
+{ return ownsLimbs_; }
+
+mp_limb_t* BigFloat::Limbs()
+{ return mpfrFloat_->_mpfr_d; }
+
+const mp_limb_t* BigFloat::LockedLimbs() const
+{ return mpfrFloat_->_mpfr_d; }
+
 BigFloat::BigFloat()
 {
     EL_DEBUG_CSE
@@ -223,15 +242,33 @@ BigFloat::BigFloat( const std::string& str, int base, mpfr_prec_t prec )
 BigFloat::BigFloat( BigFloat&& a )
 {
     EL_DEBUG_CSE
-    Pointer()->_mpfr_d = 0;
-    mpfr_swap( Pointer(), a.Pointer() );
-    std::swap( numLimbs_, a.numLimbs_ );
+    if( a.ownsLimbs_ )
+    {
+        Pointer()->_mpfr_d = 0;
+        mpfr_swap( Pointer(), a.Pointer() );
+        std::swap( numLimbs_, a.numLimbs_ );
+    }
+    else
+    {
+        // External limbs cannot change owners
+        Init( a.Precision() );
+        mpfr_set( mpfrFloat_, a.mpfrFloat_, mpfr::RoundingMode() );
+    }
+}
+
+BigFloat::BigFloat( mp_limb_t* limbs, mpfr_prec_t prec )
+{
+    EL_DEBUG_CSE
+    mpfr_custom_init( limbs, prec );
+    mpfr_custom_init_set( mpfrFloat_, MPFR_ZERO_KIND, 0, prec, limbs );
+    SetNumLimbs( prec );
+    ownsLimbs_ = false;
 }
 
 BigFloat::~BigFloat()
 {
     EL_DEBUG_CSE
-    if( Pointer()->_mpfr_d != 0 )
+    if( ownsLimbs_ && Pointer()->_mpfr_d != 0 )
         mpfr_clear( Pointer() );
 }
 
@@ -395,8 +432,15 @@ BigFloat& BigFloat::operator=( const Quad& a )
 BigFloat& BigFloat::operator=( BigFloat&& a )
 {
     EL_DEBUG_CSE
-    mpfr_swap( Pointer(), a.Pointer() );
-    std::swap( numLimbs_, a.numLimbs_ );
+    if( ownsLimbs_ && a.ownsLimbs_ )
+    {
+        mpfr_swap( Pointer(), a.Pointer() );
+        std::swap( numLimbs_, a.numLimbs_ );
+    }
+    else
+    {
+        mpfr_set( Pointer(), a.LockedPointer(), mpfr::RoundingMode() );
+    }
     return *this;
 }
 
@@ -626,11 +626,12 @@ BigInt::operator unsigned long() const
 
 BigInt::operator unsigned long long() const
 {
-    unsigned long long a;
+    // mpz_export does not write anything for zero
+    unsigned long long a=0;
 
     const size_t neededSize = mpz_sizeinbase(LockedPointer(),2);
     EL_DEBUG_ONLY(
-      if( neededSize > sizeof(a) )
+      if( neededSize > 8*sizeof(a) )
           LogicError
           ("Don't have space for ",neededSize," bits in unsigned long long");
     )
@@ -978,7 +979,9 @@ BigInt operator%( const BigInt& a, const BigInt& b )
 
 unsigned long long operator%( const BigInt& a, const unsigned long long& b )
 {
-    // TODO: Branch on the size of b
+    // Avoid the temporary when b fits within a single GMP word
+    if( b <= static_cast<unsigned long long>(ULONG_MAX) )
+        return mpz_fdiv_ui( a.LockedPointer(), static_cast<unsigned long>(b) );
     BigInt c(a);
     c %= b;
     return static_cast<unsigned long long>(c);
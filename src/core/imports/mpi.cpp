@@ -13,6 +13,8 @@
    http://opensource.org/licenses/BSD-2-Clause
 */
 #include <El-lite.hpp>
+#include <map>
+#include <tuple>
 
 typedef unsigned char* UCP;
 
@@ -49,6 +51,17 @@ MPI_Op NativeOp( const El::mpi::Op& op )
     return opC;
 }
 
+// The total of the send (or receive) counts, used for the profiling
+// byte counts of the irregular collectives
+double TotalCount( const int* counts, El::mpi::Comm comm )
+{
+    const int commSize = El::mpi::Size( comm );
+    double total = 0;
+    for( int q=0; q<commSize; ++q )
+        total += counts[q];
+    return total;
+}
+
 } // anonymous namespace
 
 namespace El {
@@ -176,6 +189,19 @@ void Split( Comm comm, int color, int key, Comm& newComm ) EL_NO_RELEASE_EXCEPT
     SafeMpi( MPI_Comm_split( comm.comm, color, key, &newComm.comm ) );
 }
 
+void SplitShared( Comm comm, int key, Comm& nodeComm ) EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+#if MPI_VERSION >= 3
+    SafeMpi
+    ( MPI_Comm_split_type
+      ( comm.comm, MPI_COMM_TYPE_SHARED, key, MPI_INFO_NULL,
+        &nodeComm.comm ) );
+#else
+    SafeMpi( MPI_Comm_split( comm.comm, Rank(comm), key, &nodeComm.comm ) );
+#endif
+}
+
 void Free( Comm& comm ) EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
@@ -201,6 +227,12 @@ EL_NO_RELEASE_EXCEPT
 #endif
 }
 
+void SetName( Comm comm, const char* name ) EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    SafeMpi( MPI_Comm_set_name( comm.comm, const_cast<char*>(name) ) );
+}
+
 // Cartesian communicator routines
 // ===============================
 
@@ -552,6 +584,7 @@ void TaggedSend( const Real* buf, int count, int to, int tag, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_MPI_PROFILE("Send",comm,sizeof(*buf)*count);
     SafeMpi
     ( MPI_Send
       ( const_cast<Real*>(buf), count, TypeMap<Real>(), to, tag, comm.comm ) );
@@ -564,6 +597,7 @@ void TaggedSend
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_MPI_PROFILE("Send",comm,sizeof(*buf)*count);
 #ifdef EL_AVOID_COMPLEX_MPI
     SafeMpi
     ( MPI_Send
@@ -583,6 +617,7 @@ template<typename T,
 void TaggedSend( const T* buf, int count, int to, int tag, Comm comm )
 {
     EL_DEBUG_CSE
+    EL_MPI_PROFILE("Send",comm,sizeof(*buf)*count);
     std::vector<byte> packedBuf;
     Serialize( count, buf, packedBuf );
     SafeMpi
@@ -609,6 +644,7 @@ void TaggedISend
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_MPI_PROFILE("ISend",comm,sizeof(*buf)*count);
     SafeMpi
     ( MPI_Isend
       ( const_cast<Real*>(buf), count, TypeMap<Real>(), to,
@@ -622,6 +658,7 @@ void TaggedISend
   Request<Complex<Real>>& request ) EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_MPI_PROFILE("ISend",comm,sizeof(*buf)*count);
 #ifdef EL_AVOID_COMPLEX_MPI
     SafeMpi
     ( MPI_Isend
@@ -643,6 +680,7 @@ void TaggedISend
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_MPI_PROFILE("ISend",comm,sizeof(*buf)*count);
     Serialize( count, buf, request.buffer );
     SafeMpi
     ( MPI_Isend
@@ -674,6 +712,7 @@ void TaggedIRSend
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_MPI_PROFILE("IRSend",comm,sizeof(*buf)*count);
     SafeMpi
     ( MPI_Irsend
       ( const_cast<Real*>(buf), count, TypeMap<Real>(), to,
@@ -687,6 +726,7 @@ void TaggedIRSend
   Request<Complex<Real>>& request ) EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_MPI_PROFILE("IRSend",comm,sizeof(*buf)*count);
 #ifdef EL_AVOID_COMPLEX_MPI
     SafeMpi
     ( MPI_Irsend
@@ -709,6 +749,7 @@ void TaggedIRSend
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_MPI_PROFILE("IRSend",comm,sizeof(*buf)*count);
     Serialize( count, buf, request.buffer );
     SafeMpi
     ( MPI_Irsend
@@ -739,6 +780,7 @@ void TaggedISSend
   Request<Real>& request ) EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_MPI_PROFILE("ISSend",comm,sizeof(*buf)*count);
     SafeMpi
     ( MPI_Issend
       ( const_cast<Real*>(buf), count, TypeMap<Real>(), to,
@@ -752,6 +794,7 @@ void TaggedISSend
   Request<Complex<Real>>& request ) EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_MPI_PROFILE("ISSend",comm,sizeof(*buf)*count);
 #ifdef EL_AVOID_COMPLEX_MPI
     SafeMpi
     ( MPI_Issend
@@ -773,6 +816,7 @@ void TaggedISSend
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_MPI_PROFILE("ISSend",comm,sizeof(*buf)*count);
     Serialize( count, buf, request.buffer );
     SafeMpi
     ( MPI_Issend
@@ -796,6 +840,7 @@ void TaggedRecv( Real* buf, int count, int from, int tag, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_MPI_PROFILE("Recv",comm,sizeof(*buf)*count);
     Status status;
     SafeMpi
     ( MPI_Recv( buf, count, TypeMap<Real>(), from, tag, comm.comm, &status ) );
@@ -807,6 +852,7 @@ void TaggedRecv( Complex<Real>* buf, int count, int from, int tag, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_MPI_PROFILE("Recv",comm,sizeof(*buf)*count);
     Status status;
 #ifdef EL_AVOID_COMPLEX_MPI
     SafeMpi
@@ -824,6 +870,7 @@ template<typename T,
 void TaggedRecv( T* buf, int count, int from, int tag, Comm comm )
 {
     EL_DEBUG_CSE
+    EL_MPI_PROFILE("Recv",comm,sizeof(*buf)*count);
     std::vector<byte> packedBuf;
     ReserveSerialized( count, buf, packedBuf );
     Status status;
@@ -856,6 +903,7 @@ void TaggedIRecv
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_MPI_PROFILE("IRecv",comm,sizeof(*buf)*count);
     SafeMpi
     ( MPI_Irecv
       ( buf, count, TypeMap<Real>(), from, tag, comm.comm, &request.backend ) );
@@ -869,6 +917,7 @@ void TaggedIRecv
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_MPI_PROFILE("IRecv",comm,sizeof(*buf)*count);
 #ifdef EL_AVOID_COMPLEX_MPI
     SafeMpi
     ( MPI_Irecv
@@ -890,6 +939,7 @@ void TaggedIRecv
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_MPI_PROFILE("IRecv",comm,sizeof(*buf)*count);
     request.receivingPacked = true;
     request.recvCount = count;
     request.unpackedRecvBuf = buf;
@@ -923,6 +973,7 @@ void TaggedSendRecv
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_MPI_PROFILE("SendRecv",comm,sizeof(*sbuf)*(sc+rc));
     Status status;
     SafeMpi
     ( MPI_Sendrecv
@@ -939,6 +990,7 @@ void TaggedSendRecv
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_MPI_PROFILE("SendRecv",comm,sizeof(*sbuf)*(sc+rc));
     Status status;
 #ifdef EL_AVOID_COMPLEX_MPI
     SafeMpi
@@ -964,6 +1016,7 @@ void TaggedSendRecv
         T* rbuf, int rc, int from, int rtag, Comm comm )
 {
     EL_DEBUG_CSE
+    EL_MPI_PROFILE("SendRecv",comm,sizeof(*sbuf)*(sc+rc));
     Status status;
     std::vector<byte> packedSend, packedRecv;
     Serialize( sc, sbuf, packedSend );
@@ -1004,6 +1057,7 @@ void TaggedSendRecv
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_MPI_PROFILE("SendRecv",comm,sizeof(*buf)*count);
     Status status;
     SafeMpi
     ( MPI_Sendrecv_replace
@@ -1019,6 +1073,7 @@ void TaggedSendRecv
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_MPI_PROFILE("SendRecv",comm,sizeof(*buf)*count);
     Status status;
 #ifdef EL_AVOID_COMPLEX_MPI
     SafeMpi
@@ -1041,6 +1096,7 @@ void TaggedSendRecv
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_MPI_PROFILE("SendRecv",comm,sizeof(*buf)*count);
     std::vector<byte> packedBuf;
     ReserveSerialized( count, buf, packedBuf );
     Serialize( count, buf, packedBuf );
@@ -1057,12 +1113,520 @@ void SendRecv( T* buf, int count, int to, int from, Comm comm )
 EL_NO_RELEASE_EXCEPT
 { TaggedSendRecv( buf, count, to, 0, from, ANY_TAG, comm ); }
 
+// Strided SendRecv
+// ----------------
+
+namespace {
+
+StridedPolicy stridedPolicy = STRIDED_ADAPTIVE;
+
+// The number of timed calls of each approach before the adaptive policy
+// settles upon the faster one for a site
+const int numStridedTrials = 3;
+
+// Clear the cache rather than let it grow without bound
+const size_t maxCachedStridedTypes = 256;
+
+std::map<std::tuple<Datatype,int,int,int>,Datatype> stridedTypes;
+
+struct StridedRecord
+{
+    int trials[2]={0,0};
+    double seconds[2]={0,0};
+    double bytes[2]={0,0};
+};
+std::map<string,StridedRecord> stridedRecords;
+
+// Only (complex) packed scalars have a fixed-size MPI datatype
+template<typename T>
+struct IsStridable
+{ static const bool value=IsPacked<T>::value; };
+template<typename Real>
+struct IsStridable<Complex<Real>>
+{ static const bool value=IsPacked<Real>::value; };
+
+// The datatype of each entry and the number of such datatypes per entry
+template<typename T>
+Datatype StridedBase( const T*, int& multiplicity )
+{
+    multiplicity = 1;
+    return TypeMap<T>();
+}
+
+template<typename Real>
+Datatype StridedBase( const Complex<Real>*, int& multiplicity )
+{
+#ifdef EL_AVOID_COMPLEX_MPI
+    multiplicity = 2;
+    return TypeMap<Real>();
+#else
+    multiplicity = 1;
+    return TypeMap<Complex<Real>>();
+#endif
+}
+
+template<typename T>
+Datatype StridedType( int height, int width, int ldim )
+{
+    int multiplicity;
+    const Datatype base = StridedBase( (const T*)nullptr, multiplicity );
+    const auto key = std::make_tuple( base, height, width, ldim );
+    auto it = stridedTypes.find( key );
+    if( it != stridedTypes.end() )
+        return it->second;
+
+    if( stridedTypes.size() >= maxCachedStridedTypes )
+        DestroyStridedTypes();
+    Datatype type;
+    SafeMpi
+    ( MPI_Type_vector
+      ( width, multiplicity*height, multiplicity*ldim, base, &type ) );
+    SafeMpi( MPI_Type_commit( &type ) );
+    stridedTypes[key] = type;
+    return type;
+}
+
+// Returns 1 if the datatype approach should be used and 0 otherwise
+int ChooseStrided( const char* site )
+{
+    if( stridedPolicy != STRIDED_ADAPTIVE )
+        return stridedPolicy == STRIDED_DATATYPE;
+    const auto& record = stridedRecords[site];
+    if( record.trials[0] < numStridedTrials ||
+        record.trials[1] < numStridedTrials )
+        return record.trials[1] <= record.trials[0];
+    // Compare the (conservative) time per byte of the two approaches
+    const double packRate = record.seconds[0] / Max(record.bytes[0],1.);
+    const double typeRate = record.seconds[1] / Max(record.bytes[1],1.);
+    return typeRate <= packRate;
+}
+
+void RecordStrided
+( const char* site, int choice, double seconds, double bytes )
+{
+    if( stridedPolicy != STRIDED_ADAPTIVE )
+        return;
+    auto& record = stridedRecords[site];
+    if( record.trials[choice] >= numStridedTrials )
+        return;
+    ++record.trials[choice];
+    record.seconds[choice] += seconds;
+    record.bytes[choice] += bytes;
+}
+
+bool IsContiguous( int height, int width, int ldim )
+{ return ldim == height || width <= 1 || height == 0; }
+
+template<typename T>
+void PackedSendRecv
+( const T* sbuf, int sHeight, int sWidth, int sLDim, int to,
+        T* rbuf, int rHeight, int rWidth, int rLDim, int from, Comm comm )
+EL_NO_RELEASE_EXCEPT
+{
+    const bool contigSend = IsContiguous( sHeight, sWidth, sLDim );
+    const bool contigRecv = IsContiguous( rHeight, rWidth, rLDim );
+    const int sendSize = sHeight*sWidth;
+    const int recvSize = rHeight*rWidth;
+
+    vector<T> sendBuf, recvBuf;
+    const T* sendData = sbuf;
+    if( !contigSend )
+    {
+        FastResize( sendBuf, sendSize );
+        for( int j=0; j<sWidth; ++j )
+            std::copy
+            ( &sbuf[j*sLDim], &sbuf[j*sLDim]+sHeight, &sendBuf[j*sHeight] );
+        sendData = sendBuf.data();
+    }
+    T* recvData = rbuf;
+    if( !contigRecv )
+    {
+        FastResize( recvBuf, recvSize );
+        recvData = recvBuf.data();
+    }
+    SendRecv( sendData, sendSize, to, recvData, recvSize, from, comm );
+    if( !contigRecv )
+        for( int j=0; j<rWidth; ++j )
+            std::copy
+            ( &recvBuf[j*rHeight], &recvBuf[j*rHeight]+rHeight,
+              &rbuf[j*rLDim] );
+}
+
+template<typename T,typename=EnableIf<IsStridable<T>>>
+void TypedSendRecv
+( const T* sbuf, int sHeight, int sWidth, int sLDim, int to,
+        T* rbuf, int rHeight, int rWidth, int rLDim, int from, Comm comm )
+EL_NO_RELEASE_EXCEPT
+{
+    EL_MPI_PROFILE
+    ("SendRecv",comm,sizeof(*sbuf)*(sHeight*sWidth+rHeight*rWidth));
+    const Datatype sendType = StridedType<T>( sHeight, sWidth, sLDim );
+    const Datatype recvType = StridedType<T>( rHeight, rWidth, rLDim );
+    Status status;
+    SafeMpi
+    ( MPI_Sendrecv
+      ( const_cast<T*>(sbuf), 1, sendType, to,   0,
+        rbuf,                 1, recvType, from, MPI_ANY_TAG,
+        comm.comm, &status ) );
+}
+
+template<typename T,typename=DisableIf<IsStridable<T>>,typename=void>
+void TypedSendRecv
+( const T* sbuf, int sHeight, int sWidth, int sLDim, int to,
+        T* rbuf, int rHeight, int rWidth, int rLDim, int from, Comm comm )
+EL_NO_RELEASE_EXCEPT
+{
+    PackedSendRecv
+    ( sbuf, sHeight, sWidth, sLDim, to,
+      rbuf, rHeight, rWidth, rLDim, from, comm );
+}
+
+} // anonymous namespace
+
+void SetStridedPolicy( StridedPolicy policy ) EL_NO_EXCEPT
+{ stridedPolicy = policy; }
+
+StridedPolicy GetStridedPolicy() EL_NO_EXCEPT
+{ return stridedPolicy; }
+
+void DestroyStridedTypes() EL_NO_RELEASE_EXCEPT
+{
+    for( auto& entry : stridedTypes )
+        SafeMpi( MPI_Type_free( &entry.second ) );
+    stridedTypes.clear();
+}
+
+template<typename T>
+void StridedSendRecv
+( const T* sbuf, int sHeight, int sWidth, int sLDim, int to,
+        T* rbuf, int rHeight, int rWidth, int rLDim, int from,
+  Comm comm, const char* site ) EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    const bool contigSend = IsContiguous( sHeight, sWidth, sLDim );
+    const bool contigRecv = IsContiguous( rHeight, rWidth, rLDim );
+    if( (contigSend && contigRecv) || !IsStridable<T>::value )
+    {
+        PackedSendRecv
+        ( sbuf, sHeight, sWidth, sLDim, to,
+          rbuf, rHeight, rWidth, rLDim, from, comm );
+        return;
+    }
+
+    const int choice = ChooseStrided( site );
+    const double startTime = Time();
+    if( choice == 1 )
+        TypedSendRecv
+        ( sbuf, sHeight, sWidth, sLDim, to,
+          rbuf, rHeight, rWidth, rLDim, from, comm );
+    else
+        PackedSendRecv
+        ( sbuf, sHeight, sWidth, sLDim, to,
+          rbuf, rHeight, rWidth, rLDim, from, comm );
+    const double bytes =
+      double(sizeof(T))*(double(sHeight)*sWidth+double(rHeight)*rWidth);
+    RecordStrided( site, choice, Time()-startTime, bytes );
+}
+
+// Persistent exchanges
+// --------------------
+
+bool HavePersistentCollectives() EL_NO_EXCEPT
+{
+#ifdef EL_HAVE_MPI4_PERSISTENT_COLLECTIVES
+    return true;
+#else
+    return false;
+#endif
+}
+
+PersistentExchange::~PersistentExchange() { Free(); }
+
+void PersistentExchange::Setup
+( const vector<int>& sendCounts, const vector<int>& sendOffs,
+  const vector<int>& recvCounts, const vector<int>& recvOffs,
+  Datatype type, size_t typeSize, Comm comm, bool collective )
+{
+    EL_DEBUG_CSE
+    Free();
+    const int commSize = Size( comm );
+    const int commRank = Rank( comm );
+    EL_DEBUG_ONLY(
+      if( int(sendCounts.size()) != commSize ||
+          int(sendOffs.size()) != commSize ||
+          int(recvCounts.size()) != commSize ||
+          int(recvOffs.size()) != commSize )
+          LogicError("Expected one count and offset per process");
+    )
+    sendCounts_ = sendCounts;
+    sendOffs_ = sendOffs;
+    recvCounts_ = recvCounts;
+    recvOffs_ = recvOffs;
+    comm_ = comm;
+    type_ = type;
+    typeSize_ = typeSize;
+    collective_ = collective && HavePersistentCollectives();
+
+    size_t sendSize=0, recvSize=0;
+    for( int q=0; q<commSize; ++q )
+    {
+        sendSize = Max( sendSize, size_t(sendOffs[q])+sendCounts[q] );
+        recvSize = Max( recvSize, size_t(recvOffs[q])+recvCounts[q] );
+    }
+    sendBuf_.resize( sendSize*typeSize );
+    recvBuf_.resize( recvSize*typeSize );
+
+    if( collective_ )
+    {
+#ifdef EL_HAVE_MPI4_PERSISTENT_COLLECTIVES
+        requests_.resize( 1 );
+        SafeMpi
+        ( MPI_Alltoallv_init
+          ( sendBuf_.data(), sendCounts_.data(), sendOffs_.data(), type,
+            recvBuf_.data(), recvCounts_.data(), recvOffs_.data(), type,
+            comm.comm, MPI_INFO_NULL, &requests_[0] ) );
+#endif
+    }
+    else
+    {
+        // The local portion is copied by Start
+        for( int q=0; q<commSize; ++q )
+        {
+            if( q == commRank )
+                continue;
+            if( recvCounts[q] > 0 )
+            {
+                MPI_Request request;
+                SafeMpi
+                ( MPI_Recv_init
+                  ( &recvBuf_[size_t(recvOffs[q])*typeSize], recvCounts[q],
+                    type, q, 0, comm.comm, &request ) );
+                requests_.push_back( request );
+            }
+            if( sendCounts[q] > 0 )
+            {
+                MPI_Request request;
+                SafeMpi
+                ( MPI_Send_init
+                  ( &sendBuf_[size_t(sendOffs[q])*typeSize], sendCounts[q],
+                    type, q, 0, comm.comm, &request ) );
+                requests_.push_back( request );
+            }
+        }
+    }
+    active_ = true;
+}
+
+void PersistentExchange::Start() EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( !active_ )
+          LogicError("The persistent exchange has not been set up");
+    )
+    EL_MPI_PROFILE
+    ("PersistentExchange",comm_,sendBuf_.size()+recvBuf_.size());
+    if( !collective_ )
+    {
+        const int commRank = Rank( comm_ );
+        const size_t localSize =
+          size_t(Min(sendCounts_[commRank],recvCounts_[commRank]))*typeSize_;
+        if( localSize > 0 )
+            MemCopy
+            ( &recvBuf_[size_t(recvOffs_[commRank])*typeSize_],
+              &sendBuf_[size_t(sendOffs_[commRank])*typeSize_], localSize );
+    }
+    if( !requests_.empty() )
+        SafeMpi( MPI_Startall( int(requests_.size()), requests_.data() ) );
+}
+
+void PersistentExchange::Wait() EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    if( !requests_.empty() )
+        SafeMpi
+        ( MPI_Waitall
+          ( int(requests_.size()), requests_.data(), MPI_STATUSES_IGNORE ) );
+}
+
+void PersistentExchange::Free() EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    // Requests can no longer be freed once MPI has been finalized
+    if( !Finalized() )
+        for( auto& request : requests_ )
+            SafeMpi( MPI_Request_free( &request ) );
+    requests_.clear();
+    active_ = false;
+}
+
+// One-sided communication
+// -----------------------
+
+namespace {
+
+// MPI_Accumulate only supports the predefined reduction operations, which
+// are only meaningful for the native integer and floating-point types
+template<typename T>
+struct HasNativeSum
+{ static const bool value=std::is_arithmetic<T>::value; };
+#ifdef EL_HAVE_QUAD
+template<>
+struct HasNativeSum<Quad>
+{ static const bool value=false; };
+#endif
+template<typename Real>
+struct HasNativeSum<Complex<Real>>
+{ static const bool value=HasNativeSum<Real>::value; };
+
+template<typename T>
+void OneSided
+( const T* buf, int height, int width,
+  int target, Int targetOffset, int targetLDim, Window& window,
+  int direction )
+EL_NO_RELEASE_EXCEPT
+{
+    if( !IsStridable<T>::value )
+        LogicError("One-sided transfers require a fixed-size datatype");
+    if( height == 0 || width == 0 )
+        return;
+    int multiplicity;
+    const Datatype base = StridedBase( buf, multiplicity );
+    const int count = multiplicity*height*width;
+    const Datatype targetType =
+      ( IsContiguous( height, width, targetLDim ) ?
+        base : StridedType<T>( height, width, targetLDim ) );
+    const int targetCount =
+      ( IsContiguous( height, width, targetLDim ) ? count : 1 );
+    T* originBuf = const_cast<T*>(buf);
+    const MPI_Aint disp = targetOffset;
+    if( direction == 0 )
+        SafeMpi
+        ( MPI_Get
+          ( originBuf, count, base, target, disp, targetCount, targetType,
+            window.win ) );
+    else if( direction == 1 )
+        SafeMpi
+        ( MPI_Put
+          ( originBuf, count, base, target, disp, targetCount, targetType,
+            window.win ) );
+    else
+        SafeMpi
+        ( MPI_Accumulate
+          ( originBuf, count, base, target, disp, targetCount, targetType,
+            MPI_SUM, window.win ) );
+}
+
+} // anonymous namespace
+
+template<typename T>
+void Create( T* base, Int count, Comm comm, Window& window )
+EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    SafeMpi
+    ( MPI_Win_create
+      ( base, MPI_Aint(count)*sizeof(T), sizeof(T), MPI_INFO_NULL,
+        comm.comm, &window.win ) );
+}
+
+void Free( Window& window ) EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    if( window.win != MPI_WIN_NULL )
+        SafeMpi( MPI_Win_free( &window.win ) );
+}
+
+void Fence( Window& window ) EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    SafeMpi( MPI_Win_fence( 0, window.win ) );
+}
+
+void LockAll( Window& window ) EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    SafeMpi( MPI_Win_lock_all( 0, window.win ) );
+}
+
+void UnlockAll( Window& window ) EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    SafeMpi( MPI_Win_unlock_all( window.win ) );
+}
+
+void Flush( int rank, Window& window ) EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    SafeMpi( MPI_Win_flush( rank, window.win ) );
+}
+
+void FlushAll( Window& window ) EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    SafeMpi( MPI_Win_flush_all( window.win ) );
+}
+
+void FlushLocal( int rank, Window& window ) EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    SafeMpi( MPI_Win_flush_local( rank, window.win ) );
+}
+
+void FlushLocalAll( Window& window ) EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    SafeMpi( MPI_Win_flush_local_all( window.win ) );
+}
+
+void Sync( Window& window ) EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    SafeMpi( MPI_Win_sync( window.win ) );
+}
+
+template<typename T>
+void StridedGet
+( T* buf, int height, int width,
+  int target, Int targetOffset, int targetLDim, Window& window )
+EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    OneSided
+    ( buf, height, width, target, targetOffset, targetLDim, window, 0 );
+}
+
+template<typename T>
+void StridedPut
+( const T* buf, int height, int width,
+  int target, Int targetOffset, int targetLDim, Window& window )
+EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    OneSided
+    ( buf, height, width, target, targetOffset, targetLDim, window, 1 );
+}
+
+template<typename T>
+void StridedAccumulate
+( const T* buf, int height, int width,
+  int target, Int targetOffset, int targetLDim, Window& window )
+EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    if( !HasNativeSum<T>::value )
+        LogicError("Accumulation requires a native MPI sum");
+    OneSided
+    ( buf, height, width, target, targetOffset, targetLDim, window, 2 );
+}
+
 template<typename Real,
          typename/*=EnableIf<IsPacked<Real>>*/>
 void Broadcast( Real* buf, int count, int root, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_MPI_PROFILE("Broadcast",comm,sizeof(*buf)*count);
     if( Size(comm) == 1 || count == 0 )
         return;
     SafeMpi( MPI_Bcast( buf, count, TypeMap<Real>(), root, comm.comm ) );
@@ -1074,6 +1638,7 @@ void Broadcast( Complex<Real>* buf, int count, int root, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_MPI_PROFILE("Broadcast",comm,sizeof(*buf)*count);
     if( Size(comm) == 1 )
         return;
 #ifdef EL_AVOID_COMPLEX_MPI
@@ -1090,6 +1655,7 @@ void Broadcast( T* buf, int count, int root, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_MPI_PROFILE("Broadcast",comm,sizeof(*buf)*count);
     if( Size(comm) == 1 || count == 0 )
         return;
     std::vector<byte> packedBuf;
@@ -1110,6 +1676,7 @@ void IBroadcast
 ( Real* buf, int count, int root, Comm comm, Request<Real>& request )
 {
     EL_DEBUG_CSE
+    EL_MPI_PROFILE("IBroadcast",comm,sizeof(*buf)*count);
 #ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
     SafeMpi
     ( MPI_Ibcast
@@ -1126,6 +1693,7 @@ void IBroadcast
   Request<Complex<Real>>& request )
 {
     EL_DEBUG_CSE
+    EL_MPI_PROFILE("IBroadcast",comm,sizeof(*buf)*count);
 #ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
 #ifdef EL_AVOID_COMPLEX_MPI
     SafeMpi
@@ -1149,6 +1717,7 @@ void IBroadcast
 ( T* buf, int count, int root, Comm comm, Request<T>& request )
 {
     EL_DEBUG_CSE
+    EL_MPI_PROFILE("IBroadcast",comm,sizeof(*buf)*count);
 #ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
     request.receivingPacked = true;
     request.recvCount = count;
@@ -1175,6 +1744,7 @@ void Gather
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_MPI_PROFILE("Gather",comm,sizeof(*sbuf)*sc);
     SafeMpi
     ( MPI_Gather
       ( const_cast<Real*>(sbuf), sc, TypeMap<Real>(),
@@ -1189,6 +1759,7 @@ void Gather
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_MPI_PROFILE("Gather",comm,sizeof(*sbuf)*sc);
 #ifdef EL_AVOID_COMPLEX_MPI
     SafeMpi
     ( MPI_Gather
@@ -1213,6 +1784,7 @@ void Gather
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_MPI_PROFILE("Gather",comm,sizeof(*sbuf)*sc);
     const int commSize = mpi::Size(comm);
     const int commRank = mpi::Rank(comm);
     const int totalRecv = rc*commSize;
@@ -1239,6 +1811,7 @@ void IGather
   Request<Real>& request )
 {
     EL_DEBUG_CSE
+    EL_MPI_PROFILE("IGather",comm,sizeof(*sbuf)*sc);
 #ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
     SafeMpi
     ( MPI_Igather
@@ -1259,6 +1832,7 @@ void IGather
   Request<Complex<Real>>& request )
 {
     EL_DEBUG_CSE
+    EL_MPI_PROFILE("IGather",comm,sizeof(*sbuf)*sc);
 #ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
 #ifdef EL_AVOID_COMPLEX_MPI
     SafeMpi
@@ -1288,6 +1862,7 @@ void IGather
   Request<T>& request )
 {
     EL_DEBUG_CSE
+    EL_MPI_PROFILE("IGather",comm,sizeof(*sbuf)*sc);
 #ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
     if( mpi::Rank(comm) == root )
     {
@@ -1316,6 +1891,7 @@ void Gather
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_MPI_PROFILE("Gather",comm,sizeof(*sbuf)*TotalCount(rcs,comm));
     SafeMpi
     ( MPI_Gatherv
       ( const_cast<Real*>(sbuf),
@@ -1338,6 +1914,7 @@ void Gather
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_MPI_PROFILE("Gather",comm,sizeof(*sbuf)*TotalCount(rcs,comm));
 #ifdef EL_AVOID_COMPLEX_MPI
     const int commRank = Rank( comm );
     const int commSize = Size( comm );
@@ -1382,6 +1959,7 @@ void Gather
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_MPI_PROFILE("Gather",comm,sizeof(*sbuf)*TotalCount(rcs,comm));
     const int commSize = mpi::Size(comm);
     const int commRank = mpi::Rank(comm);
     int totalRecv=0;
@@ -1416,6 +1994,7 @@ void AllGather
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_MPI_PROFILE("AllGather",comm,sizeof(*sbuf)*sc);
 #ifdef EL_USE_BYTE_ALLGATHERS
     SafeMpi
     ( MPI_Allgather
@@ -1440,6 +2019,7 @@ void AllGather
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_MPI_PROFILE("AllGather",comm,sizeof(*sbuf)*sc);
 #ifdef EL_USE_BYTE_ALLGATHERS
     SafeMpi
     ( MPI_Allgather
@@ -1474,6 +2054,7 @@ void AllGather
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_MPI_PROFILE("AllGather",comm,sizeof(*sbuf)*sc);
     const int commSize = mpi::Size(comm);
     const int totalRecv = rc*commSize;
 
@@ -1488,6 +2069,86 @@ EL_NO_RELEASE_EXCEPT
     Deserialize( totalRecv, packedRecv, rbuf );
 }
 
+template<typename Real,
+         typename/*=EnableIf<IsPacked<Real>>*/>
+void IAllGather
+( const Real* sbuf, int sc,
+        Real* rbuf, int rc, Comm comm, Request<Real>& request )
+EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    EL_MPI_PROFILE("IAllGather",comm,sizeof(*sbuf)*sc);
+#if EL_HAVE_NONBLOCKING
+ #ifdef EL_HAVE_MPI3_NONBLOCKING_COLLECTIVES
+    SafeMpi
+    ( MPI_Iallgather
+      ( const_cast<Real*>(sbuf), sc, TypeMap<Real>(),
+        rbuf,                    rc, TypeMap<Real>(),
+        comm.comm, &request.backend ) );
+ #else
+    SafeMpi
+    ( MPIX_Iallgather
+      ( const_cast<Real*>(sbuf), sc, TypeMap<Real>(),
+        rbuf,                    rc, TypeMap<Real>(),
+        comm.comm, &request.backend ) );
+ #endif
+#else
+    AllGather( sbuf, sc, rbuf, rc, comm );
+    request.backend = MPI_REQUEST_NULL;
+#endif
+}
+
+template<typename Real,
+         typename/*=EnableIf<IsPacked<Real>>*/>
+void IAllGather
+( const Complex<Real>* sbuf, int sc,
+        Complex<Real>* rbuf, int rc, Comm comm,
+  Request<Complex<Real>>& request )
+EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    EL_MPI_PROFILE("IAllGather",comm,sizeof(*sbuf)*sc);
+#if EL_HAVE_NONBLOCKING
+ #ifdef EL_AVOID_COMPLEX_MPI
+    sc *= 2;
+    rc *= 2;
+    MPI_Datatype type = TypeMap<Real>();
+ #else
+    MPI_Datatype type = TypeMap<Complex<Real>>();
+ #endif
+ #ifdef EL_HAVE_MPI3_NONBLOCKING_COLLECTIVES
+    SafeMpi
+    ( MPI_Iallgather
+      ( const_cast<Complex<Real>*>(sbuf), sc, type,
+        rbuf,                             rc, type,
+        comm.comm, &request.backend ) );
+ #else
+    SafeMpi
+    ( MPIX_Iallgather
+      ( const_cast<Complex<Real>*>(sbuf), sc, type,
+        rbuf,                             rc, type,
+        comm.comm, &request.backend ) );
+ #endif
+#else
+    AllGather( sbuf, sc, rbuf, rc, comm );
+    request.backend = MPI_REQUEST_NULL;
+#endif
+}
+
+template<typename T,
+         typename/*=DisableIf<IsPacked<T>>*/,
+         typename/*=void*/>
+void IAllGather
+( const T* sbuf, int sc,
+        T* rbuf, int rc, Comm comm, Request<T>& request )
+EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    EL_MPI_PROFILE("IAllGather",comm,sizeof(*sbuf)*sc);
+    AllGather( sbuf, sc, rbuf, rc, comm );
+    request.backend = MPI_REQUEST_NULL;
+}
+
 template<typename Real,
          typename/*=EnableIf<IsPacked<Real>>*/>
 void AllGather
@@ -1496,6 +2157,7 @@ void AllGather
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_MPI_PROFILE("AllGather",comm,sizeof(*sbuf)*TotalCount(rcs,comm));
 #ifdef EL_USE_BYTE_ALLGATHERS
     const int commSize = Size( comm );
     vector<int> byteRcs( commSize ), byteRds( commSize );
@@ -1533,6 +2195,7 @@ void AllGather
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_MPI_PROFILE("AllGather",comm,sizeof(*sbuf)*TotalCount(rcs,comm));
 #ifdef EL_USE_BYTE_ALLGATHERS
     const int commSize = Size( comm );
     vector<int> byteRcs( commSize ), byteRds( commSize );
@@ -1585,6 +2248,7 @@ void AllGather
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_MPI_PROFILE("AllGather",comm,sizeof(*sbuf)*TotalCount(rcs,comm));
     const int commSize = mpi::Size(comm);
     const int totalRecv = rcs[commSize-1]+rds[commSize-1];
 
@@ -1613,6 +2277,7 @@ void Scatter
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_MPI_PROFILE("Scatter",comm,sizeof(*rbuf)*rc);
     SafeMpi
     ( MPI_Scatter
       ( const_cast<Real*>(sbuf), sc, TypeMap<Real>(),
@@ -1627,6 +2292,7 @@ void Scatter
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_MPI_PROFILE("Scatter",comm,sizeof(*rbuf)*rc);
 #ifdef EL_AVOID_COMPLEX_MPI
     SafeMpi
     ( MPI_Scatter
@@ -1651,6 +2317,7 @@ void Scatter
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_MPI_PROFILE("Scatter",comm,sizeof(*rbuf)*rc);
     const int commSize = mpi::Size(comm);
     const int commRank = mpi::Rank(comm);
     const int totalSend = sc*commSize;
@@ -1673,6 +2340,7 @@ void Scatter( Real* buf, int sc, int rc, int root, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_MPI_PROFILE("Scatter",comm,sizeof(*buf)*rc);
     const int commRank = Rank( comm );
     if( commRank == root )
     {
@@ -1696,6 +2364,7 @@ void Scatter( Complex<Real>* buf, int sc, int rc, int root, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_MPI_PROFILE("Scatter",comm,sizeof(*buf)*rc);
     const int commRank = Rank( comm );
     if( commRank == root )
     {
@@ -1734,6 +2403,7 @@ void Scatter( T* buf, int sc, int rc, int root, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_MPI_PROFILE("Scatter",comm,sizeof(*buf)*rc);
     const int commSize = mpi::Size(comm);
     const int commRank = mpi::Rank(comm);
     const int totalSend = sc*commSize;
@@ -1760,6 +2430,7 @@ void AllToAll
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_MPI_PROFILE("AllToAll",comm,sizeof(*sbuf)*sc*Size(comm));
     SafeMpi
     ( MPI_Alltoall
       ( const_cast<Real*>(sbuf), sc, TypeMap<Real>(),
@@ -1774,6 +2445,7 @@ void AllToAll
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_MPI_PROFILE("AllToAll",comm,sizeof(*sbuf)*sc*Size(comm));
 #ifdef EL_AVOID_COMPLEX_MPI
     SafeMpi
     ( MPI_Alltoall
@@ -1800,6 +2472,7 @@ void AllToAll
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_MPI_PROFILE("AllToAll",comm,sizeof(*sbuf)*sc*Size(comm));
     const int commSize = mpi::Size( comm );
     const int totalSend = sc*commSize;
     const int totalRecv = rc*commSize;
@@ -1822,6 +2495,7 @@ void AllToAll
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_MPI_PROFILE("AllToAll",comm,sizeof(*sbuf)*TotalCount(scs,comm));
     SafeMpi
     ( MPI_Alltoallv
       ( const_cast<Real*>(sbuf),
@@ -1843,6 +2517,7 @@ void AllToAll
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_MPI_PROFILE("AllToAll",comm,sizeof(*sbuf)*TotalCount(scs,comm));
 #ifdef EL_AVOID_COMPLEX_MPI
     int p;
     MPI_Comm_size( comm.comm, &p );
@@ -1884,6 +2559,7 @@ void AllToAll
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_MPI_PROFILE("AllToAll",comm,sizeof(*sbuf)*TotalCount(scs,comm));
     const int commSize = mpi::Size( comm );
     const int totalSend = scs[commSize-1]+sds[commSize-1];
     const int totalRecv = rcs[commSize-1]+rds[commSize-1];
@@ -1928,6 +2604,7 @@ void Reduce
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_MPI_PROFILE("Reduce",comm,sizeof(*sbuf)*count);
     if( count == 0 )
         return;
 
@@ -1946,6 +2623,7 @@ void Reduce
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_MPI_PROFILE("Reduce",comm,sizeof(*sbuf)*count);
     if( count == 0 )
         return;
 
@@ -1984,6 +2662,7 @@ void Reduce
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_MPI_PROFILE("Reduce",comm,sizeof(*sbuf)*count);
     if( count == 0 )
         return;
 
@@ -2032,6 +2711,7 @@ void Reduce( Real* buf, int count, Op op, int root, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_MPI_PROFILE("Reduce",comm,sizeof(*buf)*count);
     if( count == 0 || Size(comm) == 1 )
         return;
 
@@ -2057,6 +2737,7 @@ void Reduce( Complex<Real>* buf, int count, Op op, int root, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_MPI_PROFILE("Reduce",comm,sizeof(*buf)*count);
     if( Size(comm) == 1 )
         return;
     if( count != 0 )
@@ -2119,6 +2800,7 @@ void Reduce( T* buf, int count, Op op, int root, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_MPI_PROFILE("Reduce",comm,sizeof(*buf)*count);
     if( count == 0 )
         return;
 
@@ -2151,6 +2833,7 @@ void AllReduce( const Real* sbuf, Real* rbuf, int count, Op op, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_MPI_PROFILE("AllReduce",comm,sizeof(*sbuf)*count);
     if( count != 0 )
     {
         MPI_Op opC = NativeOp<Real>( op );
@@ -2168,6 +2851,7 @@ void AllReduce
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_MPI_PROFILE("AllReduce",comm,sizeof(*sbuf)*count);
     if( count != 0 )
     {
 #ifdef EL_AVOID_COMPLEX_MPI
@@ -2205,6 +2889,7 @@ void AllReduce
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_MPI_PROFILE("AllReduce",comm,sizeof(*sbuf)*count);
     if( count == 0 )
         return;
 
@@ -2241,6 +2926,7 @@ void AllReduce( Real* buf, int count, Op op, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_MPI_PROFILE("AllReduce",comm,sizeof(*buf)*count);
     if( count == 0 || Size(comm) == 1 )
         return;
 
@@ -2256,6 +2942,7 @@ void AllReduce( Complex<Real>* buf, int count, Op op, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_MPI_PROFILE("AllReduce",comm,sizeof(*buf)*count);
     if( count == 0 || Size(comm) == 1 )
         return;
 
@@ -2291,6 +2978,7 @@ void AllReduce( T* buf, int count, Op op, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_MPI_PROFILE("AllReduce",comm,sizeof(*buf)*count);
     if( count == 0 )
         return;
 
@@ -2311,12 +2999,94 @@ void AllReduce( T* buf, int count, Comm comm )
 EL_NO_RELEASE_EXCEPT
 { AllReduce( buf, count, SUM, comm ); }
 
+template<typename Real,
+         typename/*=EnableIf<IsPacked<Real>>*/>
+void IAllReduce
+( const Real* sbuf, Real* rbuf, int count, Op op, Comm comm,
+  Request<Real>& request )
+EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    EL_MPI_PROFILE("IAllReduce",comm,sizeof(*sbuf)*count);
+#if EL_HAVE_NONBLOCKING
+    MPI_Op opC = NativeOp<Real>( op );
+ #ifdef EL_HAVE_MPI3_NONBLOCKING_COLLECTIVES
+    SafeMpi
+    ( MPI_Iallreduce
+      ( const_cast<Real*>(sbuf), rbuf, count, TypeMap<Real>(), opC,
+        comm.comm, &request.backend ) );
+ #else
+    SafeMpi
+    ( MPIX_Iallreduce
+      ( const_cast<Real*>(sbuf), rbuf, count, TypeMap<Real>(), opC,
+        comm.comm, &request.backend ) );
+ #endif
+#else
+    AllReduce( sbuf, rbuf, count, op, comm );
+    request.backend = MPI_REQUEST_NULL;
+#endif
+}
+
+template<typename Real,
+         typename/*=EnableIf<IsPacked<Real>>*/>
+void IAllReduce
+( const Complex<Real>* sbuf, Complex<Real>* rbuf, int count, Op op, Comm comm,
+  Request<Complex<Real>>& request )
+EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    EL_MPI_PROFILE("IAllReduce",comm,sizeof(*sbuf)*count);
+#if EL_HAVE_NONBLOCKING
+ #ifdef EL_AVOID_COMPLEX_MPI
+    MPI_Datatype type = TypeMap<Complex<Real>>();
+    MPI_Op opC = NativeOp<Complex<Real>>( op );
+    if( op == SUM )
+    {
+        count *= 2;
+        type = TypeMap<Real>();
+        opC = NativeOp<Real>( op );
+    }
+ #else
+    MPI_Datatype type = TypeMap<Complex<Real>>();
+    MPI_Op opC = NativeOp<Complex<Real>>( op );
+ #endif
+ #ifdef EL_HAVE_MPI3_NONBLOCKING_COLLECTIVES
+    SafeMpi
+    ( MPI_Iallreduce
+      ( const_cast<Complex<Real>*>(sbuf), rbuf, count, type, opC,
+        comm.comm, &request.backend ) );
+ #else
+    SafeMpi
+    ( MPIX_Iallreduce
+      ( const_cast<Complex<Real>*>(sbuf), rbuf, count, type, opC,
+        comm.comm, &request.backend ) );
+ #endif
+#else
+    AllReduce( sbuf, rbuf, count, op, comm );
+    request.backend = MPI_REQUEST_NULL;
+#endif
+}
+
+template<typename T,
+         typename/*=DisableIf<IsPacked<T>>*/,
+         typename/*=void*/>
+void IAllReduce
+( const T* sbuf, T* rbuf, int count, Op op, Comm comm, Request<T>& request )
+EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    EL_MPI_PROFILE("IAllReduce",comm,sizeof(*sbuf)*count);
+    AllReduce( sbuf, rbuf, count, op, comm );
+    request.backend = MPI_REQUEST_NULL;
+}
+
 template<typename Real,
          typename/*=EnableIf<IsPacked<Real>>*/>
 void ReduceScatter( Real* sbuf, Real* rbuf, int rc, Op op, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_MPI_PROFILE("ReduceScatter",comm,sizeof(*sbuf)*rc*Size(comm));
     if( rc == 0 )
         return;
 #ifdef EL_REDUCE_SCATTER_BLOCK_VIA_ALLREDUCE
@@ -2343,6 +3113,7 @@ void ReduceScatter
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_MPI_PROFILE("ReduceScatter",comm,sizeof(*sbuf)*rc*Size(comm));
     if( rc == 0 )
         return;
 
@@ -2377,6 +3148,7 @@ void ReduceScatter( T* sbuf, T* rbuf, int rc, Op op, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_MPI_PROFILE("ReduceScatter",comm,sizeof(*sbuf)*rc*Size(comm));
     if( rc == 0 )
         return;
     const int commSize = mpi::Size(comm);
@@ -2424,6 +3196,7 @@ void ReduceScatter( Real* buf, int rc, Op op, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_MPI_PROFILE("ReduceScatter",comm,sizeof(*buf)*rc*Size(comm));
     if( rc == 0 || Size(comm) == 1 )
         return;
 
@@ -2451,6 +3224,7 @@ void ReduceScatter( Complex<Real>* buf, int rc, Op op, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_MPI_PROFILE("ReduceScatter",comm,sizeof(*buf)*rc*Size(comm));
     if( rc == 0 || Size(comm) == 1 )
         return;
 
@@ -2486,6 +3260,7 @@ void ReduceScatter( T* buf, int rc, Op op, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_MPI_PROFILE("ReduceScatter",comm,sizeof(*buf)*rc*Size(comm));
     if( rc == 0 )
         return;
     const int commSize = mpi::Size(comm);
@@ -2524,6 +3299,7 @@ void ReduceScatter
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_MPI_PROFILE("ReduceScatter",comm,sizeof(*sbuf)*TotalCount(rcs,comm));
     MPI_Op opC = NativeOp<Real>( op );
     SafeMpi
     ( MPI_Reduce_scatter
@@ -2539,6 +3315,7 @@ void ReduceScatter
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_MPI_PROFILE("ReduceScatter",comm,sizeof(*sbuf)*TotalCount(rcs,comm));
 #ifdef EL_AVOID_COMPLEX_MPI
     if( op == SUM )
     {
@@ -2580,6 +3357,7 @@ void ReduceScatter
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_MPI_PROFILE("ReduceScatter",comm,sizeof(*sbuf)*TotalCount(rcs,comm));
     const int commRank = mpi::Rank(comm);
     const int commSize = mpi::Size(comm);
     int totalSend=0;
@@ -2603,6 +3381,466 @@ void ReduceScatter( const T* sbuf, T* rbuf, const int* rcs, Comm comm )
 EL_NO_RELEASE_EXCEPT
 { ReduceScatter( sbuf, rbuf, rcs, SUM, comm ); }
 
+// Two-level collectives
+// =====================
+
+NodeHierarchy::NodeHierarchy( Comm comm )
+: comm_(comm), active_(false)
+{
+    EL_DEBUG_CSE
+    commRank_ = Rank( comm );
+    const int commSize = Size( comm );
+    SplitShared( comm, commRank_, nodeComm_ );
+    const int nodeRank = Rank( nodeComm_ );
+    nodeSize_ = Size( nodeComm_ );
+    Split
+    ( comm, ( nodeRank == 0 ? 0 : UNDEFINED ), commRank_, leaderComm_ );
+
+    // The node must consist of the contiguous ranks beginning with its leader
+    int leaderRank = commRank_;
+    Broadcast( leaderRank, 0, nodeComm_ );
+    const int minNodeSize = AllReduce( nodeSize_, MIN, comm );
+    const int maxNodeSize = AllReduce( nodeSize_, MAX, comm );
+    const int contiguous =
+      AllReduce( int(commRank_ == leaderRank+nodeRank), MIN, comm );
+    numNodes_ = commSize / nodeSize_;
+    active_ = contiguous && minNodeSize == maxNodeSize &&
+              nodeSize_ > 1 && numNodes_ > 1;
+}
+
+NodeHierarchy::~NodeHierarchy()
+{
+    if( !Finalized() )
+    {
+#if MPI_VERSION >= 3
+        FreeWindow();
+#endif
+        if( leaderComm_ != COMM_NULL )
+            Free( leaderComm_ );
+        Free( nodeComm_ );
+    }
+}
+
+#if MPI_VERSION >= 3
+void NodeHierarchy::FreeWindow()
+{
+    if( haveWindow_ )
+    {
+        MPI_Win_unlock_all( window_ );
+        MPI_Win_free( &window_ );
+        haveWindow_ = false;
+        windowBytes_ = 0;
+        shared_ = nullptr;
+    }
+}
+
+// Since every process of the node requests the same number of bytes, the
+// (collective) reallocation decisions agree
+byte* NodeHierarchy::SharedBuffer( size_t numBytes )
+{
+    EL_DEBUG_CSE
+    if( haveWindow_ && windowBytes_ >= numBytes )
+        return shared_;
+    FreeWindow();
+    const bool leader = ( leaderComm_ != COMM_NULL );
+    void* base;
+    SafeMpi
+    ( MPI_Win_allocate_shared
+      ( MPI_Aint( leader ? numBytes : 0 ), 1, MPI_INFO_NULL, nodeComm_.comm,
+        &base, &window_ ) );
+    MPI_Aint leaderBytes;
+    int dispUnit;
+    SafeMpi
+    ( MPI_Win_shared_query( window_, 0, &leaderBytes, &dispUnit, &base ) );
+    SafeMpi( MPI_Win_lock_all( MPI_MODE_NOCHECK, window_ ) );
+    haveWindow_ = true;
+    windowBytes_ = numBytes;
+    shared_ = static_cast<byte*>(base);
+    return shared_;
+}
+
+void NodeHierarchy::NodeSync()
+{
+    SafeMpi( MPI_Win_sync( window_ ) );
+    SafeMpi( MPI_Barrier( nodeComm_.comm ) );
+    SafeMpi( MPI_Win_sync( window_ ) );
+}
+#endif
+
+void NodeHierarchy::AllGather( const byte* sbuf, byte* rbuf, int numBytes )
+{
+    EL_DEBUG_CSE
+    const size_t totalBytes = size_t(numBytes)*nodeSize_*numNodes_;
+    const size_t portionBytes = size_t(numBytes)*nodeSize_;
+    if( !active_ ||
+        portionBytes > size_t(std::numeric_limits<int>::max()) )
+    {
+        mpi::AllGather( sbuf, numBytes, rbuf, numBytes, comm_ );
+        return;
+    }
+    const bool leader = ( leaderComm_ != COMM_NULL );
+#if MPI_VERSION >= 3
+    // Write our contribution directly into the leader's window, gather the
+    // node portions between the leaders in place, and then read the result
+    byte* shared = SharedBuffer( totalBytes );
+    MemCopy( &shared[size_t(commRank_)*numBytes], sbuf, size_t(numBytes) );
+    NodeSync();
+    if( leader )
+        SafeMpi
+        ( MPI_Allgather
+          ( MPI_IN_PLACE, 0, MPI_DATATYPE_NULL,
+            shared, int(portionBytes), MPI_UNSIGNED_CHAR,
+            leaderComm_.comm ) );
+    NodeSync();
+    MemCopy( rbuf, shared, totalBytes );
+    // Ensure that the window is not overwritten by a subsequent gather
+    // before every process of the node has read it
+    NodeSync();
+#else
+    vector<byte> portion;
+    if( leader )
+        portion.resize( portionBytes );
+    Gather( sbuf, numBytes, portion.data(), numBytes, 0, nodeComm_ );
+    if( leader )
+        mpi::AllGather
+        ( portion.data(), int(portionBytes), rbuf, int(portionBytes),
+          leaderComm_ );
+    Broadcast( rbuf, int(totalBytes), 0, nodeComm_ );
+#endif
+}
+
+// Collective algorithm selection
+// ==============================
+
+namespace {
+
+CollectiveCtrl collectiveCtrl;
+
+bool IsPowerOfTwo( int n ) { return n > 0 && (n & (n-1)) == 0; }
+
+CollectiveAlgorithm Lookup
+( const vector<CollectiveChoice>& choices, size_t numBytes )
+{
+    for( const auto& choice : choices )
+        if( numBytes <= choice.maxBytes )
+            return choice.alg;
+    return COLLECTIVE_NATIVE;
+}
+
+// The byte-wise algorithms address p*numBytes bytes with an int
+bool FitsInInt( size_t numBytes, int commSize )
+{ return numBytes*commSize <= size_t(std::numeric_limits<int>::max()); }
+
+} // anonymous namespace
+
+void SetCollectiveCtrl( const CollectiveCtrl& ctrl )
+{ collectiveCtrl = ctrl; }
+
+const CollectiveCtrl& GetCollectiveCtrl() EL_NO_EXCEPT
+{ return collectiveCtrl; }
+
+string CollectiveAlgorithmName( CollectiveAlgorithm alg )
+{
+    switch( alg )
+    {
+    case COLLECTIVE_NATIVE:             return "native";
+    case COLLECTIVE_PAIRWISE:           return "pairwise";
+    case COLLECTIVE_BRUCK:              return "Bruck";
+    case COLLECTIVE_RECURSIVE_DOUBLING: return "recursive doubling";
+    case COLLECTIVE_HIERARCHICAL:       return "hierarchical";
+    default: LogicError("Invalid collective algorithm");
+    }
+    return "";
+}
+
+CollectiveAlgorithm SelectAllGather
+( size_t numBytes, Comm comm, const NodeHierarchy* hier )
+{
+    const int commSize = Size( comm );
+    if( !collectiveCtrl.adaptive || commSize == 1 ||
+        !FitsInInt(numBytes,commSize) )
+        return COLLECTIVE_NATIVE;
+    const CollectiveAlgorithm alg =
+      Lookup( collectiveCtrl.allGather, numBytes );
+    if( alg == COLLECTIVE_BRUCK ||
+        (alg == COLLECTIVE_RECURSIVE_DOUBLING && IsPowerOfTwo(commSize)) ||
+        (alg == COLLECTIVE_HIERARCHICAL && hier != nullptr && hier->Active()) )
+        return alg;
+    return COLLECTIVE_NATIVE;
+}
+
+CollectiveAlgorithm SelectAllToAll( size_t numBytes, Comm comm )
+{
+    const int commSize = Size( comm );
+    if( !collectiveCtrl.adaptive || commSize == 1 ||
+        !FitsInInt(numBytes,commSize) )
+        return COLLECTIVE_NATIVE;
+    const CollectiveAlgorithm alg =
+      Lookup( collectiveCtrl.allToAll, numBytes );
+    if( alg == COLLECTIVE_PAIRWISE || alg == COLLECTIVE_BRUCK )
+        return alg;
+    return COLLECTIVE_NATIVE;
+}
+
+CollectiveAlgorithm SelectReduceScatter
+( size_t numBytes, Comm comm, const NodeHierarchy* hier )
+{
+    const int commSize = Size( comm );
+    if( !collectiveCtrl.adaptive || commSize == 1 ||
+        !FitsInInt(numBytes,commSize) )
+        return COLLECTIVE_NATIVE;
+    const CollectiveAlgorithm alg =
+      Lookup( collectiveCtrl.reduceScatter, numBytes );
+    if( (alg == COLLECTIVE_RECURSIVE_DOUBLING && IsPowerOfTwo(commSize)) ||
+        (alg == COLLECTIVE_HIERARCHICAL && hier != nullptr && hier->Active()) )
+        return alg;
+    return COLLECTIVE_NATIVE;
+}
+
+// After step k, the first min(2k,p) blocks of 'work' hold the contributions
+// of processes commRank, commRank+1, ... (modulo p)
+void BruckAllGather( const byte* sbuf, byte* rbuf, int numBytes, Comm comm )
+{
+    EL_DEBUG_CSE
+    const int commRank = Rank( comm );
+    const int commSize = Size( comm );
+    vector<byte> work( size_t(numBytes)*commSize );
+    MemCopy( work.data(), sbuf, size_t(numBytes) );
+    for( int k=1; k<commSize; k*=2 )
+    {
+        const int numBlocks = Min( k, commSize-k );
+        SendRecv
+        ( work.data(), numBlocks*numBytes, Mod(commRank-k,commSize),
+          &work[size_t(k)*numBytes], numBlocks*numBytes,
+          Mod(commRank+k,commSize), comm );
+    }
+    for( int i=0; i<commSize; ++i )
+        MemCopy
+        ( &rbuf[size_t(Mod(commRank+i,commSize))*numBytes],
+          &work[size_t(i)*numBytes], size_t(numBytes) );
+}
+
+void RecursiveDoublingAllGather
+( const byte* sbuf, byte* rbuf, int numBytes, Comm comm )
+{
+    EL_DEBUG_CSE
+    const int commRank = Rank( comm );
+    const int commSize = Size( comm );
+    if( !IsPowerOfTwo(commSize) )
+        LogicError("Recursive doubling requires a power of two");
+    MemCopy( &rbuf[size_t(commRank)*numBytes], sbuf, size_t(numBytes) );
+    for( int mask=1; mask<commSize; mask*=2 )
+    {
+        const int partner = commRank ^ mask;
+        // Exchange the blocks gathered so far by our and our partner's groups
+        const int ourFirst = commRank & ~(mask-1);
+        const int partnerFirst = partner & ~(mask-1);
+        SendRecv
+        ( &rbuf[size_t(ourFirst)*numBytes], mask*numBytes, partner,
+          &rbuf[size_t(partnerFirst)*numBytes], mask*numBytes, partner,
+          comm );
+    }
+}
+
+void PairwiseAllToAll
+( const byte* sbuf, byte* rbuf, int numBytes, Comm comm )
+{
+    EL_DEBUG_CSE
+    const int commRank = Rank( comm );
+    const int commSize = Size( comm );
+    const bool powerOfTwo = IsPowerOfTwo( commSize );
+    MemCopy
+    ( &rbuf[size_t(commRank)*numBytes], &sbuf[size_t(commRank)*numBytes],
+      size_t(numBytes) );
+    for( int k=1; k<commSize; ++k )
+    {
+        const int to = ( powerOfTwo ? commRank^k : Mod(commRank+k,commSize) );
+        const int from =
+          ( powerOfTwo ? commRank^k : Mod(commRank-k,commSize) );
+        SendRecv
+        ( &sbuf[size_t(to)*numBytes], numBytes, to,
+          &rbuf[size_t(from)*numBytes], numBytes, from, comm );
+    }
+}
+
+// After a local rotation, block i is destined for process commRank+i, and
+// step k forwards the blocks whose index has bit k set to process
+// commRank+k. Finally, block i came from process commRank-i.
+void BruckAllToAll
+( const byte* sbuf, byte* rbuf, int numBytes, Comm comm )
+{
+    EL_DEBUG_CSE
+    const int commRank = Rank( comm );
+    const int commSize = Size( comm );
+    vector<byte> work( size_t(numBytes)*commSize ),
+                 sendPack( size_t(numBytes)*((commSize+1)/2) ),
+                 recvPack( size_t(numBytes)*((commSize+1)/2) );
+    for( int i=0; i<commSize; ++i )
+        MemCopy
+        ( &work[size_t(i)*numBytes],
+          &sbuf[size_t(Mod(commRank+i,commSize))*numBytes],
+          size_t(numBytes) );
+    for( int k=1; k<commSize; k*=2 )
+    {
+        int numBlocks = 0;
+        for( int i=k; i<commSize; ++i )
+            if( i & k )
+                MemCopy
+                ( &sendPack[size_t(numBlocks++)*numBytes],
+                  &work[size_t(i)*numBytes], size_t(numBytes) );
+        SendRecv
+        ( sendPack.data(), numBlocks*numBytes, Mod(commRank+k,commSize),
+          recvPack.data(), numBlocks*numBytes, Mod(commRank-k,commSize),
+          comm );
+        numBlocks = 0;
+        for( int i=k; i<commSize; ++i )
+            if( i & k )
+                MemCopy
+                ( &work[size_t(i)*numBytes],
+                  &recvPack[size_t(numBlocks++)*numBytes], size_t(numBytes) );
+    }
+    for( int i=0; i<commSize; ++i )
+        MemCopy
+        ( &rbuf[size_t(Mod(commRank-i,commSize))*numBytes],
+          &work[size_t(i)*numBytes], size_t(numBytes) );
+}
+
+namespace {
+
+// The maximum over the processes of the minimum over a few trials
+double TimeCollective( Comm comm, function<void()> collective )
+{
+    const Int numTrials = 3;
+    collective();
+    double minTime = std::numeric_limits<double>::max();
+    Timer timer;
+    for( Int trial=0; trial<numTrials; ++trial )
+    {
+        Barrier( comm );
+        timer.Start();
+        collective();
+        minTime = Min( minTime, timer.Stop() );
+    }
+    return AllReduce( minTime, MAX, comm );
+}
+
+// Appends the choice for messages of up to 'numBytes' bytes, merging it with
+// the previous choice if they select the same algorithm
+void AppendChoice
+( vector<CollectiveChoice>& choices, size_t numBytes,
+  CollectiveAlgorithm alg )
+{
+    if( !choices.empty() && choices.back().alg == alg )
+        choices.back().maxBytes = numBytes;
+    else
+        choices.push_back( CollectiveChoice{numBytes,alg} );
+}
+
+CollectiveAlgorithm Fastest
+( Comm comm,
+  const vector<pair<CollectiveAlgorithm,function<void()>>>& candidates )
+{
+    CollectiveAlgorithm bestAlg = COLLECTIVE_NATIVE;
+    double bestTime = std::numeric_limits<double>::max();
+    for( const auto& candidate : candidates )
+    {
+        const double time = TimeCollective( comm, candidate.second );
+        if( time < bestTime )
+        {
+            bestTime = time;
+            bestAlg = candidate.first;
+        }
+    }
+    return bestAlg;
+}
+
+} // anonymous namespace
+
+void TuneCollectives( Comm comm )
+{
+    EL_DEBUG_CSE
+    const int commSize = Size( comm );
+    if( commSize == 1 )
+        return;
+    const bool powerOfTwo = IsPowerOfTwo( commSize );
+    NodeHierarchy hier( comm );
+
+    // Avoid allocating more than 64 MB per buffer
+    const size_t maxTotalBytes = size_t(1) << 26;
+    CollectiveCtrl ctrl;
+    ctrl.allGather.clear();
+    ctrl.allToAll.clear();
+    ctrl.reduceScatter.clear();
+    size_t numBytes = 8;
+    for( ; numBytes*commSize <= maxTotalBytes; numBytes*=8 )
+    {
+        const int count = int(numBytes);
+        vector<byte> sendBuf( numBytes*commSize, 1 ),
+                     recvBuf( numBytes*commSize );
+        const byte* sbuf = sendBuf.data();
+        byte* rbuf = recvBuf.data();
+
+        vector<pair<CollectiveAlgorithm,function<void()>>> candidates;
+        candidates.emplace_back
+        ( COLLECTIVE_NATIVE,
+          [&]() { AllGather( sbuf, count, rbuf, count, comm ); } );
+        candidates.emplace_back
+        ( COLLECTIVE_BRUCK,
+          [&]() { BruckAllGather( sbuf, rbuf, count, comm ); } );
+        if( powerOfTwo )
+            candidates.emplace_back
+            ( COLLECTIVE_RECURSIVE_DOUBLING,
+              [&]()
+              { RecursiveDoublingAllGather( sbuf, rbuf, count, comm ); } );
+        if( hier.Active() )
+            candidates.emplace_back
+            ( COLLECTIVE_HIERARCHICAL,
+              [&]() { hier.AllGather( sbuf, rbuf, count ); } );
+        AppendChoice( ctrl.allGather, numBytes, Fastest(comm,candidates) );
+
+        candidates.clear();
+        candidates.emplace_back
+        ( COLLECTIVE_NATIVE,
+          [&]() { AllToAll( sbuf, count, rbuf, count, comm ); } );
+        candidates.emplace_back
+        ( COLLECTIVE_PAIRWISE,
+          [&]() { PairwiseAllToAll( sbuf, rbuf, count, comm ); } );
+        candidates.emplace_back
+        ( COLLECTIVE_BRUCK,
+          [&]() { BruckAllToAll( sbuf, rbuf, count, comm ); } );
+        AppendChoice( ctrl.allToAll, numBytes, Fastest(comm,candidates) );
+
+        const int numEntries = Max( count/int(sizeof(double)), 1 );
+        vector<double> sendReal( size_t(numEntries)*commSize, 1. ),
+                       recvReal( numEntries );
+        candidates.clear();
+        candidates.emplace_back
+        ( COLLECTIVE_NATIVE,
+          [&]()
+          { ReduceScatter
+            ( sendReal.data(), recvReal.data(), numEntries, SUM, comm ); } );
+        if( powerOfTwo )
+            candidates.emplace_back
+            ( COLLECTIVE_RECURSIVE_DOUBLING,
+              [&]()
+              { RecursiveHalvingReduceScatter
+                ( sendReal.data(), recvReal.data(), numEntries, comm ); } );
+        if( hier.Active() )
+            candidates.emplace_back
+            ( COLLECTIVE_HIERARCHICAL,
+              [&]()
+              { ReduceScatter
+                ( sendReal.data(), recvReal.data(), numEntries, hier ); } );
+        AppendChoice
+        ( ctrl.reduceScatter, numBytes, Fastest(comm,candidates) );
+    }
+    // Extend the choices for the largest measured size to all larger sizes
+    ctrl.allGather.back().maxBytes = SIZE_MAX;
+    ctrl.allToAll.back().maxBytes = SIZE_MAX;
+    ctrl.reduceScatter.back().maxBytes = SIZE_MAX;
+    SetCollectiveCtrl( ctrl );
+}
+
 void VerifySendsAndRecvs
 ( const vector<int>& sendCounts,
   const vector<int>& recvCounts, Comm comm )
@@ -2626,6 +3864,7 @@ void Scan( const Real* sbuf, Real* rbuf, int count, Op op, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_MPI_PROFILE("Scan",comm,sizeof(*sbuf)*count);
     if( count != 0 )
     {
         MPI_Op opC = NativeOp<Real>( op );
@@ -2644,6 +3883,7 @@ void Scan
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_MPI_PROFILE("Scan",comm,sizeof(*sbuf)*count);
     if( count != 0 )
     {
 #ifdef EL_AVOID_COMPLEX_MPI
@@ -2680,6 +3920,7 @@ void Scan( const T* sbuf, T* rbuf, int count, Op op, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_MPI_PROFILE("Scan",comm,sizeof(*sbuf)*count);
     if( count == 0 )
         return;
 
@@ -2723,6 +3964,7 @@ void Scan( Real* buf, int count, Op op, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_MPI_PROFILE("Scan",comm,sizeof(*buf)*count);
     if( count != 0 )
     {
         MPI_Op opC = NativeOp<Real>( op );
@@ -2738,6 +3980,7 @@ void Scan( Complex<Real>* buf, int count, Op op, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_MPI_PROFILE("Scan",comm,sizeof(*buf)*count);
     if( count != 0 )
     {
 #ifdef EL_AVOID_COMPLEX_MPI
@@ -2773,6 +4016,7 @@ void Scan( T* buf, int count, Op op, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_MPI_PROFILE("Scan",comm,sizeof(*buf)*count);
     if( count == 0 )
         return;
 
@@ -2916,6 +4160,10 @@ EL_NO_RELEASE_EXCEPT
   template void SendRecv<T> \
   ( T* buf, int count, int to, int from, Comm comm ) \
   EL_NO_RELEASE_EXCEPT; \
+  template void StridedSendRecv<T> \
+  ( const T* sbuf, int sHeight, int sWidth, int sLDim, int to, \
+          T* rbuf, int rHeight, int rWidth, int rLDim, int from, \
+    Comm comm, const char* site ) EL_NO_RELEASE_EXCEPT; \
   template void Broadcast<T>( T& b, int root, Comm comm ) \
   EL_NO_RELEASE_EXCEPT; \
   template void IBroadcast<T> \
@@ -3001,6 +4249,9 @@ EL_NO_RELEASE_EXCEPT
   ( const T* sbuf, int sc, \
           T* rbuf, const int* rcs, const int* rds, Comm comm ) \
   EL_NO_RELEASE_EXCEPT; \
+  template void IAllGather<S> \
+  ( const T* sbuf, int sc, T* rbuf, int rc, Comm comm, Request<T>& request ) \
+  EL_NO_RELEASE_EXCEPT; \
   template void Scatter<S> \
   ( const T* sbuf, int sc, \
           T* rbuf, int rc, int root, Comm comm ) \
@@ -3022,6 +4273,10 @@ EL_NO_RELEASE_EXCEPT
   ( const T* sbuf, T* rbuf, int count, Op op, Comm comm ) \
   EL_NO_RELEASE_EXCEPT; \
   template void AllReduce<S>( T* buf, int count, Op op, Comm comm ) \
+  EL_NO_RELEASE_EXCEPT; \
+  template void IAllReduce<S> \
+  ( const T* sbuf, T* rbuf, int count, Op op, Comm comm, \
+    Request<T>& request ) \
   EL_NO_RELEASE_EXCEPT;
 
 #define MPI_PROTO_REAL(T) \
@@ -3097,7 +4352,21 @@ MPI_PROTO_REAL(Entry<Complex<BigFloat>>)
           vector<T>& recvBuffer, \
     const vector<int>& recvCounts, \
     const vector<int>& recvDispls, \
-          Comm comm ) EL_NO_RELEASE_EXCEPT;
+          Comm comm ) EL_NO_RELEASE_EXCEPT; \
+  template void Create \
+  ( T* base, Int count, Comm comm, Window& window ) EL_NO_RELEASE_EXCEPT; \
+  template void StridedGet \
+  ( T* buf, int height, int width, \
+    int target, Int targetOffset, int targetLDim, Window& window ) \
+  EL_NO_RELEASE_EXCEPT; \
+  template void StridedPut \
+  ( const T* buf, int height, int width, \
+    int target, Int targetOffset, int targetLDim, Window& window ) \
+  EL_NO_RELEASE_EXCEPT; \
+  template void StridedAccumulate \
+  ( const T* buf, int height, int width, \
+    int target, Int targetOffset, int targetLDim, Window& window ) \
+  EL_NO_RELEASE_EXCEPT;
 
 #define EL_ENABLE_DOUBLEDOUBLE
 #define EL_ENABLE_QUADDOUBLE
@@ -7,6 +7,9 @@
    http://opensource.org/licenses/BSD-2-Clause
 */
 #include <El-lite.hpp>
+
+#include <mutex>
+
 using std::function;
 
 namespace El {
@@ -897,10 +900,25 @@ void CreateMinLocPairOp()
     Types<Entry<T>>::createdMinOp = true;
 }
 
-void CreateCustom() EL_NO_RELEASE_EXCEPT
+namespace {
+
+// Every family is registered while holding this lock so that concurrent
+// first requests only create the family once. Since creating a family
+// requests the datatypes of its own members (and of Int), the lock is
+// recursive and such nested requests return early.
+std::recursive_mutex registrationMutex;
+
+template<typename Real>
+struct Registering { static bool value; };
+template<typename Real>
+bool Registering<Real>::value = false;
+
+template<typename Real>
+void CreateFamily();
+
+template<>
+void CreateFamily<Int>()
 {
-    // Int
-    // ===
     CreateValueIntType<Int>();
     CreateEntryType<Int>();
     CreateUserOps<Int>();
@@ -908,9 +926,11 @@ void CreateCustom() EL_NO_RELEASE_EXCEPT
     CreateMinLocOp<Int>();
     CreateMaxLocPairOp<Int>();
     CreateMinLocPairOp<Int>();
+}
 
-    // float
-    // =====
+template<>
+void CreateFamily<float>()
+{
 #ifdef EL_USE_64BIT_INTS
     CreateValueIntType<float>();
 #else
@@ -930,9 +950,11 @@ void CreateCustom() EL_NO_RELEASE_EXCEPT
 #endif
     CreateMaxLocPairOp<float>();
     CreateMinLocPairOp<float>();
+}
 
-    // double
-    // ======
+template<>
+void CreateFamily<double>()
+{
 #ifdef EL_USE_64BIT_INTS
     CreateValueIntType<double>();
 #else
@@ -952,10 +974,12 @@ void CreateCustom() EL_NO_RELEASE_EXCEPT
 #endif
     CreateMaxLocPairOp<double>();
     CreateMinLocPairOp<double>();
+}
 
 #ifdef EL_HAVE_QD
-    // DoubleDouble
-    // ============
+template<>
+void CreateFamily<DoubleDouble>()
+{
     CreateContiguous<DoubleDouble>( 2, MPI_DOUBLE );
     CreateContiguous<Complex<DoubleDouble>>( 2, TypeMap<DoubleDouble>() );
     CreateValueIntType<DoubleDouble>();
@@ -974,9 +998,11 @@ void CreateCustom() EL_NO_RELEASE_EXCEPT
     CreateMinLocOp<DoubleDouble>();
     CreateMaxLocPairOp<DoubleDouble>();
     CreateMinLocPairOp<DoubleDouble>();
+}
 
-    // QuadDouble
-    // ==========
+template<>
+void CreateFamily<QuadDouble>()
+{
     CreateContiguous<QuadDouble>( 4, MPI_DOUBLE );
     CreateContiguous<Complex<QuadDouble>>( 2, TypeMap<QuadDouble>() );
     CreateValueIntType<QuadDouble>();
@@ -995,11 +1021,13 @@ void CreateCustom() EL_NO_RELEASE_EXCEPT
     CreateMinLocOp<QuadDouble>();
     CreateMaxLocPairOp<QuadDouble>();
     CreateMinLocPairOp<QuadDouble>();
+}
 #endif
 
 #ifdef EL_HAVE_QUAD
-    // Quad
-    // ====
+template<>
+void CreateFamily<Quad>()
+{
     CreateContiguous<Quad>( 2, MPI_DOUBLE );
     CreateContiguous<Complex<Quad>>( 2, TypeMap<Quad>() );
     CreateValueIntType<Quad>();
@@ -1018,13 +1046,15 @@ void CreateCustom() EL_NO_RELEASE_EXCEPT
     CreateMinLocOp<Quad>();
     CreateMaxLocPairOp<Quad>();
     CreateMinLocPairOp<Quad>();
+}
 #endif
 
 #ifdef EL_HAVE_MPC
-    // BigFloat
-    // ========
-    // NOTE: The BigFloat types are created by mpfr::SetPrecision previously
-    //       within El::Initialize
+template<>
+void CreateFamily<BigFloat>()
+{
+    // NOTE: The BigFloat types are (re)created by mpfr::SetPrecision, so only
+    //       the operations are created here
     CreateUserOps<BigFloat>();
     CreateUserOps<Complex<BigFloat>>();
     CreateMaxOp<BigFloat>();
@@ -1037,9 +1067,11 @@ void CreateCustom() EL_NO_RELEASE_EXCEPT
     CreateMinLocOp<BigFloat>();
     CreateMaxLocPairOp<BigFloat>();
     CreateMinLocPairOp<BigFloat>();
+}
 
-    // BigInt
-    // ======
+template<>
+void CreateFamily<BigInt>()
+{
     CreateUserOps<BigInt>();
     CreateMaxOp<BigInt>();
     CreateMinOp<BigInt>();
@@ -1049,6 +1081,44 @@ void CreateCustom() EL_NO_RELEASE_EXCEPT
     CreateMinLocOp<BigInt>();
     CreateMaxLocPairOp<BigInt>();
     CreateMinLocPairOp<BigInt>();
+}
+#endif
+
+} // anonymous namespace
+
+template<typename Real>
+std::atomic<bool> FamilyRegistry<Real>::registered(false);
+
+template<typename Real>
+void RegisterFamily() EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    std::lock_guard<std::recursive_mutex> guard( registrationMutex );
+    if( FamilyRegistry<Real>::registered.load(std::memory_order_relaxed) ||
+        Registering<Real>::value )
+        return;
+    Registering<Real>::value = true;
+    CreateFamily<Real>();
+    Registering<Real>::value = false;
+    FamilyRegistry<Real>::registered.store(true,std::memory_order_release);
+}
+
+void CreateCustom() EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    RegisterFamily<Int>();
+    RegisterFamily<float>();
+    RegisterFamily<double>();
+#ifdef EL_HAVE_QD
+    RegisterFamily<DoubleDouble>();
+    RegisterFamily<QuadDouble>();
+#endif
+#ifdef EL_HAVE_QUAD
+    RegisterFamily<Quad>();
+#endif
+#ifdef EL_HAVE_MPC
+    RegisterFamily<BigFloat>();
+    RegisterFamily<BigInt>();
 #endif
 }
 
@@ -1067,23 +1137,57 @@ void DestroyScalarFamily()
     DestroyFamily<T>();
 }
 
+template<typename Real>
+void Unregister()
+{ FamilyRegistry<Real>::registered.store(false,std::memory_order_release); }
+
 void DestroyCustom() EL_NO_RELEASE_EXCEPT
 {
+    // Only the members which were actually created are freed
+    std::lock_guard<std::recursive_mutex> guard( registrationMutex );
+    DestroyStridedTypes();
     DestroyFamily<Int>();
+    Unregister<Int>();
     DestroyScalarFamily<float>();
+    Unregister<float>();
     DestroyScalarFamily<double>();
+    Unregister<double>();
 #ifdef EL_HAVE_QD
     DestroyScalarFamily<DoubleDouble>();
+    Unregister<DoubleDouble>();
     DestroyScalarFamily<QuadDouble>();
+    Unregister<QuadDouble>();
 #endif
 #ifdef EL_HAVE_QUAD
     DestroyScalarFamily<Quad>();
+    Unregister<Quad>();
 #endif
 #ifdef EL_HAVE_MPC
     DestroyScalarFamily<BigFloat>();
+    Unregister<BigFloat>();
     DestroyFamily<BigInt>();
+    Unregister<BigInt>();
 #endif
 }
 
+#define PROTO(Real) \
+  template struct FamilyRegistry<Real>; \
+  template void RegisterFamily<Real>();
+
+PROTO(Int)
+PROTO(float)
+PROTO(double)
+#ifdef EL_HAVE_QD
+PROTO(DoubleDouble)
+PROTO(QuadDouble)
+#endif
+#ifdef EL_HAVE_QUAD
+PROTO(Quad)
+#endif
+#ifdef EL_HAVE_MPC
+PROTO(BigFloat)
+PROTO(BigInt)
+#endif
+
 } // namespace mpi
 } // namespace El
@@ -17,6 +17,21 @@ std::mt19937 generator;
 gmp_randstate_t gmpRandState;
 #endif
 
+// The state of the counter-based fills
+bool counterBased = true;
+std::uint64_t sharedSeed = 0;
+std::uint64_t localSalt = 0;
+std::uint64_t numKeys = 0;
+
+// The SplitMix64 finalizer, which decorrelates consecutive keys
+std::uint64_t MixKey( std::uint64_t x )
+{
+    x += 0x9E3779B97F4A7C15ULL;
+    x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    x = (x ^ (x >> 27)) * 0x94D049BB133111EBULL;
+    return x ^ (x >> 31);
+}
+
 }
 
 namespace El {
@@ -29,6 +44,13 @@ void InitializeRandom( bool deterministic )
 
     ::generator.seed( seed );
 
+    // The counter-based fills must agree between processes
+    long sharedSecs = secs;
+    mpi::Broadcast( sharedSecs, 0, mpi::COMM_WORLD );
+    ::sharedSeed = MixKey( std::uint64_t(sharedSecs) );
+    ::localSalt = MixKey( ::sharedSeed + rank + 1 );
+    ::numKeys = 0;
+
     srand( seed );
 
 #ifdef EL_HAVE_MPC
@@ -49,6 +71,18 @@ void FinalizeRandom()
 std::mt19937& Generator()
 { return ::generator; }
 
+void SetCounterBasedRandom( bool counterBased )
+{ ::counterBased = counterBased; }
+
+bool CounterBasedRandom()
+{ return ::counterBased; }
+
+std::uint64_t NextRandomKey( bool local )
+{
+    const std::uint64_t key = MixKey( ::sharedSeed + ::numKeys++ );
+    return ( local ? MixKey( key ^ ::localSalt ) : key );
+}
+
 #ifdef EL_HAVE_MPC
 namespace mpfr {
 
@@ -0,0 +1,90 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_IO_BINARYSPARSE_HPP
+#define EL_IO_BINARYSPARSE_HPP
+
+// The BINARY_SPARSE format stores a sparse matrix in (global) CSR form as
+//
+//   Int header[8] = { magic, version, height, width, numEntries,
+//                     sizeof(T), IsComplex<T>, numChunks },
+//   Int chunkRows[numChunks+1],
+//   Int rowOffsets[height+1],
+//   Int cols[numEntries],
+//   T   values[numEntries],
+//
+// where the chunks record the (consecutive) row ranges owned by the writers
+// so that each row range can be loaded without parsing the remainder of the
+// file. The sections can be mapped into memory directly.
+
+namespace El {
+namespace binary_sparse {
+
+const Int MAGIC = 0x454c5350; // "ELSP"
+const Int VERSION = 1;
+const Int HEADER_SIZE = 8;
+
+template<typename T>
+struct Layout
+{
+    Int height=0, width=0, numEntries=0, numChunks=0;
+
+    Int ChunkRowsOffset() const
+    { return HEADER_SIZE*sizeof(Int); }
+    Int RowOffsetsOffset() const
+    { return ChunkRowsOffset() + (numChunks+1)*sizeof(Int); }
+    Int ColsOffset() const
+    { return RowOffsetsOffset() + (height+1)*sizeof(Int); }
+    Int ValuesOffset() const
+    { return ColsOffset() + numEntries*sizeof(Int); }
+    Int FileSize() const
+    { return ValuesOffset() + numEntries*sizeof(T); }
+
+    static void AssertPacked()
+    {
+        if( !IsPacked<Base<T>>::value )
+            LogicError("Binary sparse files require fixed-size entries");
+    }
+
+    void PackHeader( Int* header ) const
+    {
+        AssertPacked();
+        header[0] = MAGIC;
+        header[1] = VERSION;
+        header[2] = height;
+        header[3] = width;
+        header[4] = numEntries;
+        header[5] = sizeof(T);
+        header[6] = IsComplex<T>::value;
+        header[7] = numChunks;
+    }
+
+    void UnpackHeader( const Int* header, const string& filename )
+    {
+        AssertPacked();
+        if( header[0] != MAGIC )
+            RuntimeError(filename," is not a binary sparse matrix");
+        if( header[1] != VERSION )
+            RuntimeError("Unsupported binary sparse version ",header[1]);
+        if( header[5] != Int(sizeof(T)) ||
+            header[6] != Int(IsComplex<T>::value) )
+            RuntimeError
+            (filename," stores entries of ",header[5]," bytes (complex=",
+             header[6],") rather than ",sizeof(T)," (complex=",
+             IsComplex<T>::value,")");
+        height = header[2];
+        width = header[3];
+        numEntries = header[4];
+        numChunks = header[7];
+    }
+};
+
+} // namespace binary_sparse
+} // namespace El
+
+#endif // ifndef EL_IO_BINARYSPARSE_HPP
@@ -0,0 +1,342 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+#include "./MPIFile.hpp"
+
+// A checkpoint file contains
+//
+//   Int header[20] = { magic, version, sizeof(T), IsComplex<T>,
+//                      height, width, colDist, rowDist, wrap,
+//                      colAlign, rowAlign, root,
+//                      blockHeight, blockWidth, colCut, rowCut,
+//                      gridHeight, gridWidth, gridOrder, numProcs },
+//   Int table[numProcs][7] = { owner, colShift, rowShift, colStride,
+//                              rowStride, localHeight, localWidth },
+//
+// followed by the column-major local buffers of each of the owning processes
+// (in rank order). Redundant copies of the local data are only stored once.
+
+namespace El {
+
+namespace {
+
+const Int MAGIC = 0x454c434b; // "ELCK"
+const Int VERSION = 1;
+const Int HEADER_SIZE = 20;
+const Int ENTRY_SIZE = 7;
+
+template<typename T>
+void AssertPacked()
+{
+    if( !IsPacked<Base<T>>::value )
+        LogicError("Checkpoints require fixed-size entries");
+}
+
+// The byte offsets of each process's local data (followed by the file size)
+vector<MPI_Offset>
+DataOffsets( const vector<Int>& table, Int numProcs, Int entrySize )
+{
+    vector<MPI_Offset> offsets( numProcs+1 );
+    offsets[0] = (HEADER_SIZE+numProcs*ENTRY_SIZE)*sizeof(Int);
+    for( Int q=0; q<numProcs; ++q )
+    {
+        const Int* entry = &table[q*ENTRY_SIZE];
+        offsets[q+1] =
+          offsets[q] + MPI_Offset(entry[5])*entry[6]*entrySize;
+    }
+    return offsets;
+}
+
+// Read the header and process table on the root and broadcast them
+void ReadMetadata
+( MPI_File& file, vector<Int>& header, vector<Int>& table,
+  mpi::Comm comm, const string& filename )
+{
+    EL_DEBUG_CSE
+    const int commRank = mpi::Rank( comm );
+    header.resize( HEADER_SIZE );
+    if( commRank == 0 )
+        mpi_file::SafeFileOp
+        ( MPI_File_read_at
+          ( file, 0, header.data(), HEADER_SIZE*sizeof(Int), MPI_BYTE,
+            MPI_STATUS_IGNORE ),
+          "MPI_File_read_at", filename );
+    mpi::Broadcast( header.data(), HEADER_SIZE, 0, comm );
+    if( header[0] != MAGIC || header[1] != VERSION )
+    {
+        MPI_File_close( &file );
+        RuntimeError(filename," is not a valid checkpoint");
+    }
+    const Int numProcs = header[19];
+    table.resize( numProcs*ENTRY_SIZE );
+    if( commRank == 0 )
+        mpi_file::SafeFileOp
+        ( MPI_File_read_at
+          ( file, HEADER_SIZE*sizeof(Int), table.data(),
+            numProcs*ENTRY_SIZE*sizeof(Int), MPI_BYTE, MPI_STATUS_IGNORE ),
+          "MPI_File_read_at", filename );
+    mpi::Broadcast( table.data(), numProcs*ENTRY_SIZE, 0, comm );
+}
+
+} // anonymous namespace
+
+template<typename T>
+void Checkpoint( const AbstractDistMatrix<T>& A, string basename )
+{
+    EL_DEBUG_CSE
+    AssertPacked<T>();
+    const string filename = basename + ".ckpt";
+    const Grid& grid = A.Grid();
+    mpi::Comm comm = grid.Comm();
+    const int commSize = mpi::Size( comm );
+    const int commRank = mpi::Rank( comm );
+
+    // Gather the local distribution metadata of every process
+    const bool owner =
+      A.Participating() && A.RedundantRank() == 0 &&
+      A.CrossRank() == A.Root();
+    const Int localHeight = ( owner ? A.LocalHeight() : 0 );
+    const Int localWidth = ( owner ? A.LocalWidth() : 0 );
+    const Int entry[ENTRY_SIZE] =
+      { Int(owner), A.ColShift(), A.RowShift(), A.ColStride(),
+        A.RowStride(), localHeight, localWidth };
+    vector<Int> table( commSize*ENTRY_SIZE );
+    mpi::AllGather( entry, ENTRY_SIZE, table.data(), ENTRY_SIZE, comm );
+    const vector<MPI_Offset> offsets =
+      DataOffsets( table, commSize, sizeof(T) );
+
+    MPI_File file;
+    if( MPI_File_open
+        ( comm.comm, const_cast<char*>(filename.c_str()),
+          MPI_MODE_CREATE | MPI_MODE_WRONLY, MPI_INFO_NULL, &file )
+        != MPI_SUCCESS )
+        RuntimeError("Could not open ",filename);
+    mpi_file::SafeFileOp
+    ( MPI_File_set_size( file, offsets[commSize] ), "MPI_File_set_size",
+      filename );
+
+    if( commRank == 0 )
+    {
+        const Int header[HEADER_SIZE] =
+          { MAGIC, VERSION, Int(sizeof(T)), Int(IsComplex<T>::value),
+            A.Height(), A.Width(),
+            Int(A.ColDist()), Int(A.RowDist()), Int(A.Wrap()),
+            A.ColAlign(), A.RowAlign(), A.Root(),
+            A.BlockHeight(), A.BlockWidth(), A.ColCut(), A.RowCut(),
+            grid.Height(), grid.Width(), Int(grid.Order()), commSize };
+        mpi_file::SafeFileOp
+        ( MPI_File_write_at
+          ( file, 0, const_cast<Int*>(header), HEADER_SIZE*sizeof(Int),
+            MPI_BYTE, MPI_STATUS_IGNORE ),
+          "MPI_File_write_at", filename );
+        mpi_file::SafeFileOp
+        ( MPI_File_write_at
+          ( file, HEADER_SIZE*sizeof(Int), table.data(),
+            commSize*ENTRY_SIZE*sizeof(Int), MPI_BYTE, MPI_STATUS_IGNORE ),
+          "MPI_File_write_at", filename );
+    }
+
+    // Every owner writes its local buffer (as is) with a single collective
+    MPI_Datatype entryType, memType;
+    MPI_Type_contiguous( sizeof(T), MPI_BYTE, &entryType );
+    MPI_Type_commit( &entryType );
+    const int count = ( localHeight > 0 && localWidth > 0 ? 1 : 0 );
+    if( count > 0 )
+        MPI_Type_vector
+        ( localWidth, localHeight, A.LDim(), entryType, &memType );
+    else
+        MPI_Type_dup( entryType, &memType );
+    MPI_Type_commit( &memType );
+    mpi_file::SafeFileOp
+    ( MPI_File_write_at_all
+      ( file, offsets[commRank], const_cast<T*>(A.LockedBuffer()), count,
+        memType, MPI_STATUS_IGNORE ),
+      "MPI_File_write_at_all", filename );
+    MPI_Type_free( &memType );
+    MPI_Type_free( &entryType );
+    MPI_File_close( &file );
+}
+
+template<typename T>
+void Restart( AbstractDistMatrix<T>& A, string basename )
+{
+    EL_DEBUG_CSE
+    AssertPacked<T>();
+    const string filename = basename + ".ckpt";
+    const Grid& grid = A.Grid();
+    mpi::Comm comm = grid.Comm();
+    const int commSize = mpi::Size( comm );
+    const int commRank = mpi::Rank( comm );
+
+    MPI_File file;
+    if( MPI_File_open
+        ( comm.comm, const_cast<char*>(filename.c_str()), MPI_MODE_RDONLY,
+          MPI_INFO_NULL, &file ) != MPI_SUCCESS )
+        RuntimeError("Could not open ",filename);
+    vector<Int> header, table;
+    ReadMetadata( file, header, table, comm, filename );
+    if( header[2] != Int(sizeof(T)) ||
+        header[3] != Int(IsComplex<T>::value) )
+    {
+        MPI_File_close( &file );
+        RuntimeError
+        (filename," stores entries of ",header[2]," bytes (complex=",
+         header[3],") rather than ",sizeof(T)," (complex=",
+         IsComplex<T>::value,")");
+    }
+    const Int height = header[4];
+    const Int width = header[5];
+    const Int numProcs = header[19];
+    const vector<MPI_Offset> offsets =
+      DataOffsets( table, numProcs, sizeof(T) );
+
+    // If the distribution and grid shape match, adopt the stored alignments
+    // so that each process can directly reload a stored local buffer
+    DistData data;
+    data.colDist = Dist(header[6]);
+    data.rowDist = Dist(header[7]);
+    data.colAlign = header[9];
+    data.rowAlign = header[10];
+    data.root = header[11];
+    data.blockHeight = header[12];
+    data.blockWidth = header[13];
+    data.colCut = header[14];
+    data.rowCut = header[15];
+    data.grid = &grid;
+    bool direct =
+      A.ColDist() == data.colDist && A.RowDist() == data.rowDist &&
+      Int(A.Wrap()) == header[8] &&
+      grid.Height() == header[16] && grid.Width() == header[17] &&
+      Int(grid.Order()) == header[18] && commSize == numProcs;
+    if( direct && DistData(A) != data )
+    {
+        if( A.Viewing() || A.ColConstrained() || A.RowConstrained() ||
+            A.RootConstrained() )
+            direct = false;
+        else
+            A.AlignWith( data, false );
+    }
+    A.Resize( height, width );
+
+    MPI_Datatype entryType;
+    MPI_Type_contiguous( sizeof(T), MPI_BYTE, &entryType );
+    MPI_Type_commit( &entryType );
+    const Int localHeight = A.LocalHeight();
+    const Int localWidth = A.LocalWidth();
+    Int source = -1;
+    if( direct && A.Participating() && localHeight > 0 && localWidth > 0 )
+    {
+        for( Int q=0; q<numProcs; ++q )
+        {
+            const Int* entry = &table[q*ENTRY_SIZE];
+            if( entry[0] &&
+                entry[1] == A.ColShift() && entry[2] == A.RowShift() &&
+                entry[3] == A.ColStride() && entry[4] == A.RowStride() &&
+                entry[5] == localHeight && entry[6] == localWidth )
+            {
+                source = q;
+                break;
+            }
+        }
+        if( source < 0 )
+            direct = false;
+    }
+    direct = mpi::AllReduce( int(direct), mpi::MIN, comm );
+
+    if( direct )
+    {
+        MPI_Datatype memType;
+        const int count = ( source >= 0 ? 1 : 0 );
+        if( count > 0 )
+            MPI_Type_vector
+            ( localWidth, localHeight, A.LDim(), entryType, &memType );
+        else
+            MPI_Type_dup( entryType, &memType );
+        MPI_Type_commit( &memType );
+        mpi_file::SafeFileOp
+        ( MPI_File_read_at_all
+          ( file, ( count > 0 ? offsets[source] : 0 ), A.Buffer(), count,
+            memType, MPI_STATUS_IGNORE ),
+          "MPI_File_read_at_all", filename );
+        MPI_Type_free( &memType );
+    }
+    else
+    {
+        // Stream the stored local buffers through the processes in rounds,
+        // redistributing each round into the current distribution of A
+        vector<Int> owners;
+        for( Int q=0; q<numProcs; ++q )
+            if( table[q*ENTRY_SIZE] )
+                owners.push_back( q );
+        const Int numOwners = owners.size();
+        const Int numRounds = (numOwners+commSize-1) / commSize;
+        const bool blocked = ( header[8] == Int(BLOCK) );
+        Zero( A );
+        vector<T> buffer;
+        for( Int round=0; round<numRounds; ++round )
+        {
+            const Int chunk = round*commSize + commRank;
+            const Int* entry = nullptr;
+            Int chunkHeight=0, chunkWidth=0;
+            MPI_Offset offset = 0;
+            if( chunk < numOwners )
+            {
+                entry = &table[owners[chunk]*ENTRY_SIZE];
+                chunkHeight = entry[5];
+                chunkWidth = entry[6];
+                offset = offsets[owners[chunk]];
+            }
+            buffer.resize( chunkHeight*chunkWidth );
+            mpi_file::SafeFileOp
+            ( MPI_File_read_at_all
+              ( file, offset, buffer.data(), chunkHeight*chunkWidth,
+                entryType, MPI_STATUS_IGNORE ),
+              "MPI_File_read_at_all", filename );
+
+            A.Reserve( chunkHeight*chunkWidth );
+            for( Int jLoc=0; jLoc<chunkWidth; ++jLoc )
+            {
+                const Int j =
+                  ( blocked ?
+                    GlobalBlockedIndex
+                    (jLoc,entry[2],data.blockWidth,data.rowCut,entry[4]) :
+                    GlobalIndex(jLoc,entry[2],entry[4]) );
+                for( Int iLoc=0; iLoc<chunkHeight; ++iLoc )
+                {
+                    const Int i =
+                      ( blocked ?
+                        GlobalBlockedIndex
+                        (iLoc,entry[1],data.blockHeight,data.colCut,
+                         entry[3]) :
+                        GlobalIndex(iLoc,entry[1],entry[3]) );
+                    A.QueueUpdate( i, j, buffer[iLoc+jLoc*chunkHeight] );
+                }
+            }
+            A.ProcessQueues();
+        }
+    }
+    MPI_Type_free( &entryType );
+    MPI_File_close( &file );
+}
+
+#define PROTO(T) \
+  template void Checkpoint \
+  ( const AbstractDistMatrix<T>& A, string basename ); \
+  template void Restart \
+  ( AbstractDistMatrix<T>& A, string basename );
+
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGINT
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
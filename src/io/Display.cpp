@@ -24,32 +24,82 @@ void ProcessEvents( int numMsecs )
 #endif
 }
 
-template<typename Real>
-void Display( const Matrix<Real>& A, string title )
+#ifdef EL_HAVE_QT5
+namespace display {
+
+// Qt's MOC does not support templates, so the downsampled tiles are rendered
+// in double-precision
+
+void RealTile( const Matrix<double>& tile, string title )
 {
     EL_DEBUG_CSE
-#ifdef EL_HAVE_QT5
-    if( GuiDisabled() )
-    {
-        Print( A, title );
-        return;
-    }
+    auto ADouble = new Matrix<double>( tile );
 
-    // Convert A to double-precision since Qt's MOC does not support templates
-    const Int m = A.Height();
-    const Int n = A.Width();
-    Matrix<double>* ADouble = new Matrix<double>( m, n );
+    QString qTitle = QString::fromStdString( title );
+    DisplayWindow* displayWindow = new DisplayWindow;
+    displayWindow->Display( ADouble, qTitle );
+    displayWindow->show();
+
+    // Spend at most 200 milliseconds rendering
+    ProcessEvents( 200 );
+}
+
+void ComplexTile
+( const Matrix<double>& realTile,
+  const Matrix<double>& imagTile,
+  string title )
+{
+    EL_DEBUG_CSE
+    const Int m = realTile.Height();
+    const Int n = realTile.Width();
+    auto ADouble = new Matrix<Complex<double>>( m, n );
     for( Int j=0; j<n; ++j )
         for( Int i=0; i<m; ++i )
-            ADouble->Set( i, j, double(A.Get(i,j)) );
+            ADouble->Set
+            ( i, j, Complex<double>(realTile(i,j),imagTile(i,j)) );
 
     QString qTitle = QString::fromStdString( title );
-    DisplayWindow* displayWindow = new DisplayWindow;
+    ComplexDisplayWindow* displayWindow = new ComplexDisplayWindow;
     displayWindow->Display( ADouble, qTitle );
     displayWindow->show();
 
     // Spend at most 200 milliseconds rendering
     ProcessEvents( 200 );
+}
+
+// Each process bins its portion of A so that the root only renders (and
+// receives) O(MaxImageSize()^2) data
+template<typename T,typename MatrixType>
+void Downsampled( const MatrixType& A, bool isRoot, string title )
+{
+    EL_DEBUG_CSE
+    const Int maxSize = MaxImageSize();
+    Matrix<double> realTile, imagTile;
+    Downsample( A, realTile, maxSize, maxSize, DOWNSAMPLE_REAL_PART );
+    if( IsComplex<T>::value )
+    {
+        Downsample( A, imagTile, maxSize, maxSize, DOWNSAMPLE_IMAG_PART );
+        if( isRoot )
+            ComplexTile( realTile, imagTile, title );
+    }
+    else if( isRoot )
+        RealTile( realTile, title );
+}
+
+} // namespace display
+#endif // ifdef EL_HAVE_QT5
+
+template<typename Real>
+void Display( const Matrix<Real>& A, string title )
+{
+    EL_DEBUG_CSE
+#ifdef EL_HAVE_QT5
+    if( GuiDisabled() )
+    {
+        Print( A, title );
+        return;
+    }
+    display::Downsampled<Real>( A, true, title );
 #else
     Print( A, title );
 #endif
@@ -65,29 +115,7 @@ void Display( const Matrix<Complex<Real>>& A, string title )
         Print( A, title );
         return;
     }
-
-    // Convert A to double-precision since Qt's MOC does not support templates
-    const Int m = A.Height();
-    const Int n = A.Width();
-    Matrix<Complex<double>>* ADouble = new Matrix<Complex<double>>( m, n );
-    for( Int j=0; j<n; ++j )
-    {
-        for( Int i=0; i<m; ++i )
-        {
-            const Complex<Real> alpha = A.Get(i,j);
-            const Complex<double> alphaDouble =
-                Complex<double>(alpha.real(),alpha.imag());
-            ADouble->Set( i, j, alphaDouble );
-        }
-    }
-
-    QString qTitle = QString::fromStdString( title );
-    ComplexDisplayWindow* displayWindow = new ComplexDisplayWindow;
-    displayWindow->Display( ADouble, qTitle );
-    displayWindow->show();
-
-    // Spend at most 200 milliseconds rendering
-    ProcessEvents( 200 );
+    display::Downsampled<Complex<Real>>( A, true, title );
 #else
     Print( A, title );
 #endif
@@ -97,6 +125,13 @@ template<typename T>
 void Display( const AbstractDistMatrix<T>& A, string title )
 {
     EL_DEBUG_CSE
+#ifdef EL_HAVE_QT5
+    if( !GuiDisabled() )
+    {
+        display::Downsampled<T>( A, A.Grid().Rank() == 0, title );
+        return;
+    }
+#endif
     if( A.ColStride() == 1 && A.RowStride() == 1 )
     {
         if( A.CrossRank() == A.Root() && A.RedundantRank() == 0 )
@@ -169,65 +204,18 @@ void Display( const DistGraph& graph, string title )
     }
 }
 
-template<typename Real>
-void Display( const SparseMatrix<Real>& A, string title )
-{
-    EL_DEBUG_CSE
-#ifdef HAVE_QT5
-    A.AssertConsistent();
-    auto AFull = new Matrix<double>;
-    const int m = A.Height();
-    const int n = A.Width();
-    Zeros( *AFull, m, n );
-
-    const int numEntries = A.NumEntries();
-    const int* srcBuf = A.LockedSourceBuffer();
-    const int* tgtBuf = A.LockedTargetBuffer();
-    const Real* valBuf = A.LockedValueBuffer();
-    for( int s=0; s<numEntries; ++s )
-        AFull->Set( tgtBuf[s], srcBuf[s], double(valBuf[s]) );
-
-    QString qTitle = QString::fromStdString( title );
-    auto displayWindow = new DisplayWindow;
-    displayWindow->Display( AFull, qTitle );
-    displayWindow->show();
-
-    // Spend at most 200 milliseconds rendering
-    ProcessEvents( 200 );
-#else
-    Print( A, title );
-#endif
-}
-
-template<typename Real>
-void Display( const SparseMatrix<Complex<Real>>& A, string title )
+template<typename T>
+void Display( const SparseMatrix<T>& A, string title )
 {
     EL_DEBUG_CSE
-#ifdef HAVE_QT5
-    A.AssertConsistent();
-    auto AFull = new Matrix<Complex<double>>;
-    const int m = A.Height();
-    const int n = A.Width();
-    Zeros( *AFull, m, n );
-
-    const int numEntries = A.NumEntries();
-    const int* srcBuf = A.LockedSourceBuffer();
-    const int* tgtBuf = A.LockedTargetBuffer();
-    const Complex<Real>* valBuf = A.LockedValueBuffer();
-    for( int s=0; s<numEntries; ++s )
+#ifdef EL_HAVE_QT5
+    if( GuiDisabled() )
     {
-        const Complex<double> alpha =
-            Complex<double>(valBuf[s].real,valBuf[s].imag);
-        AFull->Set( tgtBuf[s], srcBuf[s], alpha );
+        Print( A, title );
+        return;
     }
-
-    QString qTitle = QString::fromStdString( title );
-    auto displayWindow = new ComplexDisplayWindow;
-    displayWindow->Display( AFull, qTitle );
-    displayWindow->show();
-
-    // Spend at most 200 milliseconds rendering
-    ProcessEvents( 200 );
+    A.AssertConsistent();
+    display::Downsampled<T>( A, true, title );
 #else
     Print( A, title );
 #endif
@@ -238,6 +226,13 @@ void Display( const DistSparseMatrix<T>& A, string title )
 {
     EL_DEBUG_CSE
     A.AssertLocallyConsistent();
+#ifdef EL_HAVE_QT5
+    if( !GuiDisabled() )
+    {
+        display::Downsampled<T>( A, A.Grid().Rank() == 0, title );
+        return;
+    }
+#endif
     if( A.Grid().Rank() == 0 )
     {
         SparseMatrix<T> ASeq;
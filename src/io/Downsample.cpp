@@ -0,0 +1,208 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+namespace El {
+
+namespace downsample {
+
+// The pixel containing index i of a dimension of length n split into
+// numPix pixels
+inline Int Bin( Int i, Int n, Int numPix )
+{ return Int((double(i)*numPix)/n); }
+
+// Returns the pixel of each index of a dimension of length n
+inline vector<Int> Bins( Int n, Int numPix )
+{
+    vector<Int> bins( n );
+    for( Int i=0; i<n; ++i )
+        bins[i] = Bin( i, n, numPix );
+    return bins;
+}
+
+template<typename T>
+inline double Sample( const T& alpha, DownsampleMode mode, const Base<T>& tol )
+{
+    switch( mode )
+    {
+    case DOWNSAMPLE_NONZEROS: return ( Abs(alpha) > tol ? 1 : 0 );
+    case DOWNSAMPLE_IMAG_PART: return double(ImagPart(alpha));
+    case DOWNSAMPLE_REAL_PART:
+    default: return double(RealPart(alpha));
+    }
+}
+
+inline void Initialize
+( Int m, Int n, Int maxHeight, Int maxWidth, Matrix<double>& tile )
+{
+    EL_DEBUG_CSE
+    if( maxHeight < 1 || maxWidth < 1 )
+        LogicError("Tiles must have at least one pixel in each dimension");
+    Zeros( tile, Min(m,maxHeight), Min(n,maxWidth) );
+}
+
+// Converts the pixel sums of the entries of an m x n matrix into averages over
+// the (implicitly zero-padded) entries covered by each pixel
+inline void Average( Int m, Int n, DownsampleMode mode, Matrix<double>& tile )
+{
+    EL_DEBUG_CSE
+    if( mode == DOWNSAMPLE_NONZEROS )
+        return;
+    const Int tileHeight = tile.Height();
+    const Int tileWidth = tile.Width();
+    vector<Int> rowCounts( tileHeight, 0 ), colCounts( tileWidth, 0 );
+    for( Int i=0; i<m; ++i )
+        ++rowCounts[Bin(i,m,tileHeight)];
+    for( Int j=0; j<n; ++j )
+        ++colCounts[Bin(j,n,tileWidth)];
+    for( Int jPix=0; jPix<tileWidth; ++jPix )
+        for( Int iPix=0; iPix<tileHeight; ++iPix )
+            tile(iPix,jPix) /= double(rowCounts[iPix])*colCounts[jPix];
+}
+
+inline void SumOntoRoot( Matrix<double>& tile, mpi::Comm comm )
+{
+    EL_DEBUG_CSE
+    mpi::Reduce
+    ( tile.Buffer(), tile.Height()*tile.Width(), mpi::SUM, 0, comm );
+}
+
+} // namespace downsample
+
+template<typename T>
+void Downsample
+( const Matrix<T>& A, Matrix<double>& tile, Int maxHeight, Int maxWidth,
+  DownsampleMode mode, Base<T> tol )
+{
+    EL_DEBUG_CSE
+    const Int m = A.Height();
+    const Int n = A.Width();
+    downsample::Initialize( m, n, maxHeight, maxWidth, tile );
+    const Int tileHeight = tile.Height();
+    const Int tileWidth = tile.Width();
+
+    const T* ABuf = A.LockedBuffer();
+    const Int ALDim = A.LDim();
+    const auto rowBins = downsample::Bins( m, tileHeight );
+    for( Int j=0; j<n; ++j )
+    {
+        double* tileCol = &tile(0,downsample::Bin(j,n,tileWidth));
+        for( Int i=0; i<m; ++i )
+            tileCol[rowBins[i]] +=
+              downsample::Sample( ABuf[i+j*ALDim], mode, tol );
+    }
+    downsample::Average( m, n, mode, tile );
+}
+
+template<typename T>
+void Downsample
+( const AbstractDistMatrix<T>& A, Matrix<double>& tile,
+  Int maxHeight, Int maxWidth, DownsampleMode mode, Base<T> tol )
+{
+    EL_DEBUG_CSE
+    const Int m = A.Height();
+    const Int n = A.Width();
+    downsample::Initialize( m, n, maxHeight, maxWidth, tile );
+    const Int tileHeight = tile.Height();
+    const Int tileWidth = tile.Width();
+
+    // Only one member of each team of redundant owners contributes
+    if( A.Participating() && A.RedundantRank() == 0 )
+    {
+        const Int localHeight = A.LocalHeight();
+        const Int localWidth = A.LocalWidth();
+        const T* ABuf = A.LockedBuffer();
+        const Int ALDim = A.LDim();
+        vector<Int> rowBins( localHeight );
+        for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+            rowBins[iLoc] =
+              downsample::Bin( A.GlobalRow(iLoc), m, tileHeight );
+        for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+        {
+            const Int jPix =
+              downsample::Bin( A.GlobalCol(jLoc), n, tileWidth );
+            double* tileCol = &tile(0,jPix);
+            for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+                tileCol[rowBins[iLoc]] +=
+                  downsample::Sample( ABuf[iLoc+jLoc*ALDim], mode, tol );
+        }
+    }
+    downsample::SumOntoRoot( tile, A.Grid().Comm() );
+    downsample::Average( m, n, mode, tile );
+}
+
+template<typename T>
+void Downsample
+( const SparseMatrix<T>& A, Matrix<double>& tile, Int maxHeight, Int maxWidth,
+  DownsampleMode mode, Base<T> tol )
+{
+    EL_DEBUG_CSE
+    const Int m = A.Height();
+    const Int n = A.Width();
+    downsample::Initialize( m, n, maxHeight, maxWidth, tile );
+    const Int tileHeight = tile.Height();
+    const Int tileWidth = tile.Width();
+
+    const Int numEntries = A.NumEntries();
+    const Int* rowBuf = A.LockedSourceBuffer();
+    const Int* colBuf = A.LockedTargetBuffer();
+    const T* valBuf = A.LockedValueBuffer();
+    for( Int e=0; e<numEntries; ++e )
+        tile( downsample::Bin(rowBuf[e],m,tileHeight),
+              downsample::Bin(colBuf[e],n,tileWidth) ) +=
+          downsample::Sample( valBuf[e], mode, tol );
+    downsample::Average( m, n, mode, tile );
+}
+
+template<typename T>
+void Downsample
+( const DistSparseMatrix<T>& A, Matrix<double>& tile,
+  Int maxHeight, Int maxWidth, DownsampleMode mode, Base<T> tol )
+{
+    EL_DEBUG_CSE
+    const Int m = A.Height();
+    const Int n = A.Width();
+    downsample::Initialize( m, n, maxHeight, maxWidth, tile );
+    const Int tileHeight = tile.Height();
+    const Int tileWidth = tile.Width();
+
+    const Int numLocalEntries = A.NumLocalEntries();
+    const Int* rowBuf = A.LockedSourceBuffer();
+    const Int* colBuf = A.LockedTargetBuffer();
+    const T* valBuf = A.LockedValueBuffer();
+    for( Int e=0; e<numLocalEntries; ++e )
+        tile( downsample::Bin(rowBuf[e],m,tileHeight),
+              downsample::Bin(colBuf[e],n,tileWidth) ) +=
+          downsample::Sample( valBuf[e], mode, tol );
+    downsample::SumOntoRoot( tile, A.Grid().Comm() );
+    downsample::Average( m, n, mode, tile );
+}
+
+#define PROTO(T) \
+  template void Downsample \
+  ( const Matrix<T>& A, Matrix<double>& tile, Int maxHeight, Int maxWidth, \
+    DownsampleMode mode, Base<T> tol ); \
+  template void Downsample \
+  ( const AbstractDistMatrix<T>& A, Matrix<double>& tile, \
+    Int maxHeight, Int maxWidth, DownsampleMode mode, Base<T> tol ); \
+  template void Downsample \
+  ( const SparseMatrix<T>& A, Matrix<double>& tile, \
+    Int maxHeight, Int maxWidth, DownsampleMode mode, Base<T> tol ); \
+  template void Downsample \
+  ( const DistSparseMatrix<T>& A, Matrix<double>& tile, \
+    Int maxHeight, Int maxWidth, DownsampleMode mode, Base<T> tol );
+
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGINT
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
@@ -33,6 +33,7 @@ string FileExtension( FileFormat format )
     case ASCII_MATLAB:     return "m";    break;
     case BINARY:           return "bin";  break;
     case BINARY_FLAT:      return "dat";  break;
+    case BINARY_SPARSE:    return "sbin"; break;
     case BMP:              return "bmp";  break;
     case JPG:              return "jpg";  break;
     case JPEG:             return "jpeg"; break;
@@ -0,0 +1,313 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_IO_MPIFILE_HPP
+#define EL_IO_MPIFILE_HPP
+
+// Collective MPI-IO access to the column-major entries of a distributed
+// matrix stored within a file (after a header of a given number of bytes).
+// Each process builds a file view selecting its local entries from the
+// distribution of the matrix, so that every process reads or writes its own
+// entries directly rather than funneling them through the root. The matrix
+// may also be a row panel, starting at a given row, of a taller stored matrix.
+
+namespace El {
+namespace mpi_file {
+
+inline void SafeFileOp( int err, const char* routine, const string& filename )
+{
+    if( err != MPI_SUCCESS )
+    {
+        char errorString[MPI_MAX_ERROR_STRING];
+        int errorLength;
+        MPI_Error_string( err, errorString, &errorLength );
+        RuntimeError
+        (routine," failed for ",filename,": ",string(errorString,errorLength));
+    }
+}
+
+// Collectively write 'numBytes' bytes to the file starting at byte 'offset'
+// in pieces of at most 2^30 bytes (since MPI counts are ints). Every process
+// of 'comm', which must have opened the file, performs the same number of
+// writes, though some of them may be empty.
+inline void WriteAtAll
+( MPI_File& file, MPI_Offset offset, const void* buffer, Int numBytes,
+  mpi::Comm comm, const string& filename )
+{
+    EL_DEBUG_CSE
+    const Int maxPieceBytes = Int(1) << 30;
+    const Int numLocalPieces = (numBytes+maxPieceBytes-1) / maxPieceBytes;
+    const Int numPieces = mpi::AllReduce( numLocalPieces, mpi::MAX, comm );
+    char* buf = const_cast<char*>(static_cast<const char*>(buffer));
+    for( Int piece=0; piece<numPieces; ++piece )
+    {
+        const Int pieceOff = Min( piece*maxPieceBytes, numBytes );
+        const int pieceBytes = Min( maxPieceBytes, numBytes-pieceOff );
+        SafeFileOp
+        ( MPI_File_write_at_all
+          ( file, offset+pieceOff, buf+pieceOff, pieceBytes, MPI_BYTE,
+            MPI_STATUS_IGNORE ),
+          "MPI_File_write_at_all", filename );
+    }
+}
+
+// The file and memory datatypes (in units of 'entryType') of the local
+// entries of A (stored in rows [rowOffset,rowOffset+A.Height()) of a file
+// with 'height' rows), along with the byte displacement of the file view
+template<typename T>
+struct LocalTypes
+{
+    MPI_Datatype entryType, fileType, memType;
+    MPI_Offset displacement;
+    int count;
+
+    LocalTypes( const AbstractDistMatrix<T>& A, Int headerBytes, bool access )
+    : LocalTypes( A, headerBytes, access, A.Height(), 0 )
+    { }
+
+    LocalTypes
+    ( const AbstractDistMatrix<T>& A, Int headerBytes, bool access,
+      Int height, Int rowOffset )
+    {
+        EL_DEBUG_CSE
+        const Int localHeight = A.LocalHeight();
+        const Int localWidth = A.LocalWidth();
+        const Int entrySize = sizeof(T);
+        displacement = headerBytes + MPI_Offset(rowOffset)*entrySize;
+        count = ( access && localHeight > 0 && localWidth > 0 ? 1 : 0 );
+
+        MPI_Type_contiguous( entrySize, MPI_BYTE, &entryType );
+        MPI_Type_commit( &entryType );
+        if( count == 0 )
+        {
+            MPI_Type_dup( entryType, &fileType );
+            MPI_Type_dup( entryType, &memType );
+            return;
+        }
+
+        // The local buffer is a localHeight x localWidth column-major matrix
+        MPI_Type_vector
+        ( localWidth, localHeight, A.LDim(), entryType, &memType );
+        MPI_Type_commit( &memType );
+
+        if( A.Wrap() == ELEMENT )
+        {
+            // Each local column is a strided subset of a global column and
+            // the local columns are evenly strided through the file
+            MPI_Datatype colType;
+            MPI_Type_vector
+            ( localHeight, 1, A.ColStride(), entryType, &colType );
+            const MPI_Aint colStrideBytes =
+              MPI_Aint(A.RowStride())*height*entrySize;
+            MPI_Type_create_hvector
+            ( localWidth, 1, colStrideBytes, colType, &fileType );
+            MPI_Type_free( &colType );
+            displacement +=
+              (A.ColShift()+MPI_Offset(A.RowShift())*height)*entrySize;
+        }
+        else
+        {
+            // Coalesce the local rows into runs of consecutive global rows
+            vector<Int> runStarts;
+            vector<int> runLengths;
+            for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+            {
+                const Int i = A.GlobalRow(iLoc);
+                if( iLoc > 0 && i == runStarts.back()+runLengths.back() )
+                    ++runLengths.back();
+                else
+                {
+                    runStarts.push_back( i );
+                    runLengths.push_back( 1 );
+                }
+            }
+            const Int numRuns = runStarts.size();
+            vector<int> blockLengths( numRuns*localWidth );
+            vector<MPI_Aint> displs( numRuns*localWidth );
+            for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+            {
+                const Int j = A.GlobalCol(jLoc);
+                for( Int run=0; run<numRuns; ++run )
+                {
+                    blockLengths[run+jLoc*numRuns] = runLengths[run];
+                    displs[run+jLoc*numRuns] =
+                      (runStarts[run]+MPI_Aint(j)*height)*entrySize;
+                }
+            }
+            MPI_Type_create_hindexed
+            ( numRuns*localWidth, blockLengths.data(), displs.data(),
+              entryType, &fileType );
+        }
+        MPI_Type_commit( &fileType );
+    }
+
+    ~LocalTypes()
+    {
+        MPI_Type_free( &fileType );
+        MPI_Type_free( &memType );
+        MPI_Type_free( &entryType );
+    }
+};
+
+template<typename T>
+void ReadAll
+( AbstractDistMatrix<T>& A, MPI_File& file, Int headerBytes,
+  const string& filename )
+{
+    EL_DEBUG_CSE
+    // Processes outside of the root of the cross communicator own no entries
+    const bool access = ( A.CrossRank() == A.Root() );
+    LocalTypes<T> types( A, headerBytes, access );
+    SafeFileOp
+    ( MPI_File_set_view
+      ( file, types.displacement, types.entryType, types.fileType,
+        const_cast<char*>("native"), MPI_INFO_NULL ),
+      "MPI_File_set_view", filename );
+    SafeFileOp
+    ( MPI_File_read_all
+      ( file, A.Buffer(), types.count, types.memType, MPI_STATUS_IGNORE ),
+      "MPI_File_read_all", filename );
+}
+
+// Begin a split collective read of the row panel of A starting at row
+// 'rowOffset' of a file storing 'height' rows so that the read can overlap
+// with computation; it must be completed with ReadAllEnd before another
+// access to the file is begun.
+template<typename T>
+void ReadAllBegin
+( AbstractDistMatrix<T>& A, MPI_File& file, Int headerBytes,
+  Int height, Int rowOffset, const string& filename )
+{
+    EL_DEBUG_CSE
+    const bool access = ( A.CrossRank() == A.Root() );
+    LocalTypes<T> types( A, headerBytes, access, height, rowOffset );
+    SafeFileOp
+    ( MPI_File_set_view
+      ( file, types.displacement, types.entryType, types.fileType,
+        const_cast<char*>("native"), MPI_INFO_NULL ),
+      "MPI_File_set_view", filename );
+    // The datatypes may be freed while the read is still pending
+    SafeFileOp
+    ( MPI_File_read_all_begin( file, A.Buffer(), types.count, types.memType ),
+      "MPI_File_read_all_begin", filename );
+}
+
+template<typename T>
+void ReadAllEnd
+( AbstractDistMatrix<T>& A, MPI_File& file, const string& filename )
+{
+    EL_DEBUG_CSE
+    SafeFileOp
+    ( MPI_File_read_all_end( file, A.Buffer(), MPI_STATUS_IGNORE ),
+      "MPI_File_read_all_end", filename );
+}
+
+template<typename T>
+void WriteAll
+( const AbstractDistMatrix<T>& A, MPI_File& file, Int headerBytes,
+  const string& filename )
+{
+    EL_DEBUG_CSE
+    // Redundant copies of the entries are only written once
+    const bool access =
+      ( A.CrossRank() == A.Root() && A.RedundantRank() == 0 );
+    LocalTypes<T> types( A, headerBytes, access );
+    SafeFileOp
+    ( MPI_File_set_view
+      ( file, types.displacement, types.entryType, types.fileType,
+        const_cast<char*>("native"), MPI_INFO_NULL ),
+      "MPI_File_set_view", filename );
+    SafeFileOp
+    ( MPI_File_write_all
+      ( file, const_cast<T*>(A.LockedBuffer()), types.count, types.memType,
+        MPI_STATUS_IGNORE ),
+      "MPI_File_write_all", filename );
+}
+
+// Double-buffered collective reads of the row panels of a (column-major)
+// matrix stored in a BINARY_FLAT file: panel k is read into buffer k % 2
+// with a split collective so that the read of the next panel can proceed
+// while the previous one is being used.
+template<typename T>
+class PanelStream
+{
+public:
+    PanelStream
+    ( const string& filename, Int height, Int width, Int panelHeight,
+      const Grid& grid )
+    : filename_(filename), height_(height), width_(width),
+      panelHeight_(panelHeight)
+    {
+        EL_DEBUG_CSE
+        mpi::Comm comm = grid.Comm();
+        if( MPI_File_open
+            ( comm.comm, const_cast<char*>(filename.c_str()), MPI_MODE_RDONLY,
+              MPI_INFO_NULL, &file_ ) != MPI_SUCCESS )
+            RuntimeError("Could not open ",filename);
+        MPI_Offset fileSize;
+        SafeFileOp
+        ( MPI_File_get_size( file_, &fileSize ), "MPI_File_get_size",
+          filename );
+        const MPI_Offset fileSizeExp = MPI_Offset(height)*width*sizeof(T);
+        if( fileSize != fileSizeExp )
+        {
+            MPI_File_close( &file_ );
+            RuntimeError
+            ("Expected ",filename," to be ",fileSizeExp," bytes but found ",
+             fileSize);
+        }
+        panels_[0].SetGrid( grid );
+        panels_[1].SetGrid( grid );
+    }
+
+    // MPI does not allow split collectives to be cancelled, so a read which
+    // is still pending (e.g., due to an exception) is completed first
+    ~PanelStream()
+    {
+        if( pending_ >= 0 )
+            MPI_File_read_all_end
+            ( file_, panels_[pending_%2].Buffer(), MPI_STATUS_IGNORE );
+        MPI_File_close( &file_ );
+    }
+
+    Int NumPanels() const
+    { return (height_+panelHeight_-1) / panelHeight_; }
+
+    void Begin( Int k )
+    {
+        EL_DEBUG_CSE
+        const Int rowOffset = k*panelHeight_;
+        auto& panel = panels_[k%2];
+        panel.Resize( Min(panelHeight_,height_-rowOffset), width_ );
+        ReadAllBegin
+        ( panel, file_, 0, height_, rowOffset, filename_ );
+        pending_ = k;
+    }
+
+    const DistMatrix<T>& End( Int k )
+    {
+        EL_DEBUG_CSE
+        auto& panel = panels_[k%2];
+        pending_ = -1;
+        ReadAllEnd( panel, file_, filename_ );
+        return panel;
+    }
+
+private:
+    string filename_;
+    MPI_File file_;
+    Int height_, width_, panelHeight_;
+    // The panel whose split collective read is in progress (if any)
+    Int pending_=-1;
+    DistMatrix<T> panels_[2];
+};
+
+} // namespace mpi_file
+} // namespace El
+
+#endif // ifndef EL_IO_MPIFILE_HPP
@@ -40,66 +40,52 @@ Binary( Matrix<T>& A, const string filename )
             file.read( (char*)A.Buffer(0,j), height*sizeof(T) );
 }
 
+// Every process collectively reads its own entries using MPI-IO
 template<typename T>
 inline void
 Binary( AbstractDistMatrix<T>& A, const string filename )
 {
     EL_DEBUG_CSE
-    std::ifstream file( filename.c_str(), std::ios::binary );
-    if( !file.is_open() )
+    if( !A.Participating() )
+        return;
+    mpi::Comm comm = A.Grid().Comm();
+    MPI_File file;
+    if( MPI_File_open
+        ( comm.comm, const_cast<char*>(filename.c_str()), MPI_MODE_RDONLY,
+          MPI_INFO_NULL, &file ) != MPI_SUCCESS )
         RuntimeError("Could not open ",filename);
 
-    Int height, width;
-    file.read( (char*)&height, sizeof(Int) );
-    file.read( (char*)&width,  sizeof(Int) );
-    const Int numBytes = FileSize( file );
+    // Have the root read the header and broadcast it along with the size
+    Int meta[3] = { 0, 0, 0 };
+    if( mpi::Rank(comm) == 0 )
+    {
+        MPI_Offset fileSize;
+        mpi_file::SafeFileOp
+        ( MPI_File_get_size( file, &fileSize ), "MPI_File_get_size",
+          filename );
+        meta[2] = fileSize;
+        mpi_file::SafeFileOp
+        ( MPI_File_read_at
+          ( file, 0, meta, 2*sizeof(Int), MPI_BYTE, MPI_STATUS_IGNORE ),
+          "MPI_File_read_at", filename );
+    }
+    mpi::Broadcast( meta, 3, 0, comm );
+    const Int height = meta[0];
+    const Int width = meta[1];
+    const Int numBytes = meta[2];
     const Int metaBytes = 2*sizeof(Int);
     const Int dataBytes = height*width*sizeof(T);
     const Int numBytesExp = metaBytes + dataBytes;
     if( numBytes != numBytesExp )
+    {
+        MPI_File_close( &file );
         RuntimeError
         ("Expected file to be ",numBytesExp," bytes but found ",numBytes);
+    }
 
     A.Resize( height, width );
-    if( A.CrossRank() != A.Root() )
-        return;
-    if( A.ColStride() == 1 && A.RowStride() == 1 )
-    {
-        if( A.Height() == A.LDim() )
-            file.read( (char*)A.Buffer(), height*width*sizeof(T) );
-        else
-            for( Int j=0; j<width; ++j )
-                file.read( (char*)A.Buffer(0,j), height*sizeof(T) );
-    }
-    else if( A.ColStride() == 1 )
-    {
-        const Int localWidth = A.LocalWidth();
-        for( Int jLoc=0; jLoc<localWidth; ++jLoc )
-        {
-            const Int j = A.GlobalCol(jLoc);
-            const Int localIndex = j*height;
-            const std::streamoff pos = metaBytes + localIndex*sizeof(T);
-            file.seekg( pos );
-            file.read( (char*)A.Buffer(0,jLoc), height*sizeof(T) );
-        }
-    }
-    else
-    {
-        const Int localHeight = A.LocalHeight();
-        const Int localWidth = A.LocalWidth();
-        for( Int jLoc=0; jLoc<localWidth; ++jLoc )
-        {
-            const Int j = A.GlobalCol(jLoc);
-            for( Int iLoc=0; iLoc<localHeight; ++iLoc )
-            {
-                const Int i = A.GlobalRow(iLoc);
-                const Int localIndex = i+j*height;
-                const std::streamoff pos = metaBytes + localIndex*sizeof(T);
-                file.seekg( pos );
-                file.read( (char*)A.Buffer(iLoc,jLoc), sizeof(T) );
-            }
-        }
-    }
+    mpi_file::ReadAll( A, file, metaBytes, filename );
+    MPI_File_close( &file );
 }
 
 } // namespace read
@@ -35,63 +35,37 @@ BinaryFlat( Matrix<T>& A, Int height, Int width, const string filename )
             file.read( (char*)A.Buffer(0,j), height*sizeof(T) );
 }
 
+// Every process collectively reads its own entries using MPI-IO
 template<typename T>
 inline void
 BinaryFlat
 ( AbstractDistMatrix<T>& A, Int height, Int width, const string filename )
 {
     EL_DEBUG_CSE
-    std::ifstream file( filename.c_str(), std::ios::binary );
-    if( !file.is_open() )
+    if( !A.Participating() )
+        return;
+    mpi::Comm comm = A.Grid().Comm();
+    MPI_File file;
+    if( MPI_File_open
+        ( comm.comm, const_cast<char*>(filename.c_str()), MPI_MODE_RDONLY,
+          MPI_INFO_NULL, &file ) != MPI_SUCCESS )
         RuntimeError("Could not open ",filename);
 
-    const Int numBytes = FileSize( file );
+    MPI_Offset fileSize;
+    mpi_file::SafeFileOp
+    ( MPI_File_get_size( file, &fileSize ), "MPI_File_get_size", filename );
+    const Int numBytes = fileSize;
     const Int numBytesExp = height*width*sizeof(T);
     if( numBytes != numBytesExp )
+    {
+        MPI_File_close( &file );
         RuntimeError
         ("Expected file to be ",numBytesExp," bytes but found ",numBytes);
+    }
 
     A.Resize( height, width );
-    if( A.ColStride() == 1 && A.RowStride() == 1 )
-    {
-        if( A.CrossRank() == A.Root() )
-        {
-            if( A.Height() == A.LDim() )
-                file.read( (char*)A.Buffer(), height*width*sizeof(T) );
-            else
-                for( Int j=0; j<width; ++j )
-                    file.read( (char*)A.Buffer(0,j), height*sizeof(T) );
-        }
-    }
-    else if( A.ColStride() == 1 )
-    {
-        const Int localWidth = A.LocalWidth();
-        for( Int jLoc=0; jLoc<localWidth; ++jLoc )
-        {
-            const Int j = A.GlobalCol(jLoc);
-            const Int localIndex = j*height;
-            const std::streamoff pos = localIndex*sizeof(T);
-            file.seekg( pos );
-            file.read( (char*)A.Buffer(0,jLoc), height*sizeof(T) );
-        }
-    }
-    else
-    {
-        const Int localHeight = A.LocalHeight();
-        const Int localWidth = A.LocalWidth();
-        for( Int jLoc=0; jLoc<localWidth; ++jLoc )
-        {
-            const Int j = A.GlobalCol(jLoc);
-            for( Int iLoc=0; iLoc<localHeight; ++iLoc )
-            {
-                const Int i = A.GlobalRow(iLoc);
-                const Int localIndex = i+j*height;
-                const std::streamoff pos = localIndex*sizeof(T);
-                file.seekg( pos );
-                file.read( (char*)A.Buffer(iLoc,jLoc), sizeof(T) );
-            }
-        }
-    }
+    mpi_file::ReadAll( A, file, 0, filename );
+    MPI_File_close( &file );
 }
 
 } // namespace read
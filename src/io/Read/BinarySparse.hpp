@@ -0,0 +1,171 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_READ_BINARYSPARSE_HPP
+#define EL_READ_BINARYSPARSE_HPP
+
+#if defined(__unix__) || defined(__APPLE__)
+# include <fcntl.h>
+# include <sys/mman.h>
+# include <sys/stat.h>
+# include <unistd.h>
+# define EL_BINARY_SPARSE_MMAP
+#endif
+
+namespace El {
+namespace read {
+
+template<typename T>
+inline void
+BinarySparse( SparseMatrix<T>& A, const string filename )
+{
+    EL_DEBUG_CSE
+    binary_sparse::Layout<T> layout;
+#ifdef EL_BINARY_SPARSE_MMAP
+    // Map the file into memory and copy the sections directly
+    const int fd = open( filename.c_str(), O_RDONLY );
+    if( fd < 0 )
+        RuntimeError("Could not open ",filename);
+    struct stat fileStat;
+    if( fstat( fd, &fileStat ) != 0 )
+    {
+        close( fd );
+        RuntimeError("Could not determine the size of ",filename);
+    }
+    const Int numBytes = fileStat.st_size;
+    if( numBytes < Int(binary_sparse::HEADER_SIZE*sizeof(Int)) )
+    {
+        close( fd );
+        RuntimeError(filename," is too small to be a binary sparse matrix");
+    }
+    void* mapping = mmap( nullptr, numBytes, PROT_READ, MAP_PRIVATE, fd, 0 );
+    close( fd );
+    if( mapping == MAP_FAILED )
+        RuntimeError("Could not map ",filename);
+    const char* data = static_cast<const char*>(mapping);
+    Int header[binary_sparse::HEADER_SIZE];
+    MemCopy
+    ( reinterpret_cast<char*>(header), data,
+      binary_sparse::HEADER_SIZE*sizeof(Int) );
+    try
+    {
+        layout.UnpackHeader( header, filename );
+        if( numBytes != layout.FileSize() )
+            RuntimeError
+            ("Expected file to be ",layout.FileSize()," bytes but found ",
+             numBytes);
+    }
+    catch( ... )
+    {
+        munmap( mapping, numBytes );
+        throw;
+    }
+    auto readSection = [&]( char* dest, Int offset, Int size )
+      { MemCopy( dest, data+offset, size ); };
+#else
+    std::ifstream file( filename.c_str(), std::ios::binary );
+    if( !file.is_open() )
+        RuntimeError("Could not open ",filename);
+    const Int numBytes = FileSize( file );
+    Int header[binary_sparse::HEADER_SIZE];
+    file.read( (char*)header, binary_sparse::HEADER_SIZE*sizeof(Int) );
+    layout.UnpackHeader( header, filename );
+    if( numBytes != layout.FileSize() )
+        RuntimeError
+        ("Expected file to be ",layout.FileSize()," bytes but found ",
+         numBytes);
+    auto readSection = [&]( char* dest, Int offset, Int size )
+      {
+        file.seekg( offset );
+        file.read( dest, size );
+      };
+#endif
+
+    const Int height = layout.height;
+    const Int numEntries = layout.numEntries;
+    Zeros( A, height, layout.width );
+    A.ForceNumEntries( numEntries );
+    Int* offsetBuf = A.OffsetBuffer();
+    readSection
+    ( (char*)offsetBuf, layout.RowOffsetsOffset(), (height+1)*sizeof(Int) );
+    readSection
+    ( (char*)A.TargetBuffer(), layout.ColsOffset(), numEntries*sizeof(Int) );
+    readSection
+    ( (char*)A.ValueBuffer(), layout.ValuesOffset(), numEntries*sizeof(T) );
+#ifdef EL_BINARY_SPARSE_MMAP
+    munmap( mapping, numBytes );
+#endif
+    if( offsetBuf[0] != 0 || offsetBuf[height] != numEntries )
+        RuntimeError("Invalid row offsets in ",filename);
+
+    // Expand the row offsets into the row index of each entry
+    Int* sourceBuf = A.SourceBuffer();
+    for( Int i=0; i<height; ++i )
+    {
+        if( offsetBuf[i+1] < offsetBuf[i] )
+            RuntimeError("Invalid row offsets in ",filename);
+        for( Int e=offsetBuf[i]; e<offsetBuf[i+1]; ++e )
+            sourceBuf[e] = i;
+    }
+    A.ForceConsistency();
+}
+
+// Each process independently reads the row offsets, columns, and values of
+// its own rows and then assembles them locally
+template<typename T>
+inline void
+BinarySparse( DistSparseMatrix<T>& A, const string filename )
+{
+    EL_DEBUG_CSE
+    std::ifstream file( filename.c_str(), std::ios::binary );
+    if( !file.is_open() )
+        RuntimeError("Could not open ",filename);
+    const Int numBytes = FileSize( file );
+    Int header[binary_sparse::HEADER_SIZE];
+    file.read( (char*)header, binary_sparse::HEADER_SIZE*sizeof(Int) );
+    if( !file )
+        RuntimeError("Could not read the header of ",filename);
+    binary_sparse::Layout<T> layout;
+    layout.UnpackHeader( header, filename );
+    if( numBytes != layout.FileSize() )
+        RuntimeError
+        ("Expected file to be ",layout.FileSize()," bytes but found ",
+         numBytes);
+
+    A.Resize( layout.height, layout.width );
+    const Int firstLocalRow = A.FirstLocalRow();
+    const Int localHeight = A.LocalHeight();
+    vector<Int> rowOffsets( localHeight+1 );
+    file.seekg( layout.RowOffsetsOffset() + firstLocalRow*sizeof(Int) );
+    file.read( (char*)rowOffsets.data(), (localHeight+1)*sizeof(Int) );
+    const Int entryOff = rowOffsets[0];
+    const Int numLocalEntries = rowOffsets[localHeight] - entryOff;
+    if( entryOff < 0 || numLocalEntries < 0 ||
+        entryOff+numLocalEntries > layout.numEntries )
+        RuntimeError("Invalid row offsets in ",filename);
+    for( Int iLoc=0; iLoc<=localHeight; ++iLoc )
+        rowOffsets[iLoc] -= entryOff;
+
+    vector<Int> cols( numLocalEntries );
+    vector<T> values( numLocalEntries );
+    file.seekg( layout.ColsOffset() + entryOff*sizeof(Int) );
+    file.read( (char*)cols.data(), numLocalEntries*sizeof(Int) );
+    file.seekg( layout.ValuesOffset() + entryOff*sizeof(T) );
+    file.read( (char*)values.data(), numLocalEntries*sizeof(T) );
+    if( !file )
+        RuntimeError("Could not read the local rows of ",filename);
+
+    A.AssembleCSR
+    ( firstLocalRow, localHeight, rowOffsets.data(), cols.data(),
+      values.data() );
+}
+
+} // namespace read
+} // namespace El
+
+#endif // ifndef EL_READ_BINARYSPARSE_HPP
@@ -403,12 +403,138 @@ void MatrixMarket( SparseMatrix<T>& A, const string filename )
     }
 }
 
+namespace mm {
+
+// Locale-independent parsing of the whitespace-separated tokens of the
+// coordinate lines of a Matrix Market file, where 'pos' is advanced past the
+// parsed token and false is returned if no token could be parsed.
+
+inline bool IsBlank( char c )
+{ return c == ' ' || c == '\t' || c == '\r'; }
+
+inline bool ParseIndex( const char*& pos, const char* end, Int& index )
+{
+    while( pos != end && IsBlank(*pos) )
+        ++pos;
+    if( pos == end || *pos < '0' || *pos > '9' )
+        return false;
+    index = 0;
+    while( pos != end && *pos >= '0' && *pos <= '9' )
+        index = 10*index + (*pos++ - '0');
+    return true;
+}
+
+template<typename Real>
+inline bool ParseRealFallback( const char*& pos, const char* end, Real& value )
+{
+    const char* tokenBeg = pos;
+    while( pos != end && !IsBlank(*pos) )
+        ++pos;
+    std::istringstream tokenStream( string(tokenBeg,pos) );
+    tokenStream.imbue( std::locale::classic() );
+    return bool(tokenStream >> value);
+}
+
+template<typename Real>
+inline bool ParseReal( const char*& pos, const char* end, Real& value )
+{
+    while( pos != end && IsBlank(*pos) )
+        ++pos;
+    if( pos == end || *pos == '\n' )
+        return false;
+    return ParseRealFallback( pos, end, value );
+}
+
+// Decimals with at most 15 significant digits and a power of ten of at most
+// 22 in magnitude are the product (or quotient) of two exactly representable
+// doubles, so a single correctly-rounded operation suffices (Clinger's fast
+// path); all other tokens fall back to a stream in the classic locale.
+inline bool ParseDouble( const char*& pos, const char* end, double& value )
+{
+    while( pos != end && IsBlank(*pos) )
+        ++pos;
+    if( pos == end || *pos == '\n' )
+        return false;
+    const char* tokenBeg = pos;
+    bool negative = false;
+    if( *pos == '-' || *pos == '+' )
+        negative = ( *pos++ == '-' );
+    unsigned long long mantissa = 0;
+    int numDigits = 0, exponent = 0;
+    const char* digitsBeg = pos;
+    for( ; pos != end && *pos >= '0' && *pos <= '9'; ++pos )
+    {
+        if( mantissa != 0 || *pos != '0' )
+            ++numDigits;
+        mantissa = 10*mantissa + (*pos - '0');
+    }
+    bool sawDigit = ( pos != digitsBeg );
+    if( pos != end && *pos == '.' )
+    {
+        for( ++pos; pos != end && *pos >= '0' && *pos <= '9'; ++pos )
+        {
+            if( mantissa != 0 || *pos != '0' )
+                ++numDigits;
+            mantissa = 10*mantissa + (*pos - '0');
+            --exponent;
+            sawDigit = true;
+        }
+    }
+    if( pos != end && (*pos == 'e' || *pos == 'E' ||
+                       *pos == 'd' || *pos == 'D') )
+    {
+        ++pos;
+        bool negativeExp = false;
+        if( pos != end && (*pos == '-' || *pos == '+') )
+            negativeExp = ( *pos++ == '-' );
+        int explicitExp = 0;
+        for( ; pos != end && *pos >= '0' && *pos <= '9'; ++pos )
+            explicitExp = Min(10*explicitExp + (*pos - '0'),100000);
+        exponent += ( negativeExp ? -explicitExp : explicitExp );
+    }
+    const bool tokenEnded = ( pos == end || IsBlank(*pos) || *pos == '\n' );
+    if( !tokenEnded || !sawDigit ||
+        numDigits > 15 || exponent < -22 || exponent > 22 )
+    {
+        pos = tokenBeg;
+        return ParseRealFallback( pos, end, value );
+    }
+    static const double powersOfTen[] =
+      { 1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10,
+        1e11, 1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21,
+        1e22 };
+    value = double(mantissa);
+    if( exponent < 0 )
+        value /= powersOfTen[-exponent];
+    else
+        value *= powersOfTen[exponent];
+    if( negative )
+        value = -value;
+    return true;
+}
+
+template<>
+inline bool ParseReal( const char*& pos, const char* end, double& value )
+{ return ParseDouble( pos, end, value ); }
+
+template<>
+inline bool ParseReal( const char*& pos, const char* end, float& value )
+{
+    double doubleValue;
+    if( !ParseDouble( pos, end, doubleValue ) )
+        return false;
+    value = float(doubleValue);
+    return true;
+}
+
+} // namespace mm
+
 template<typename T>
 void MatrixMarket( DistSparseMatrix<T>& A, const string filename )
 {
     EL_DEBUG_CSE
     typedef Base<T> Real;
-    std::ifstream file( filename.c_str() );
+    std::ifstream file( filename.c_str(), std::ios::binary );
     if( !file.is_open() )
         RuntimeError("Could not open ",filename);
 
@@ -503,31 +629,68 @@ void MatrixMarket( DistSparseMatrix<T>& A, const string filename )
             RuntimeError("Missing nonzeros entry: ",line);
     }
 
-    // Create a matrix of zeros
-    // ========================
-    Zeros( A, m, n );
-
-    // Fill in the local nonzero entries by passively calling QueueUpdate
-    // ==================================================================
-    int i, j;
+    // Parse this process's portion of the coordinate lines
+    // ====================================================
+    // The remainder of the file is split into even byte ranges, and each
+    // process parses the lines which begin within its range (skipping past
+    // the partial line it starts in the middle of).
+    const Int dataBeg = file.tellg();
+    const Int fileSize = FileSize( file );
+    mpi::Comm comm = A.Grid().Comm();
+    const int commSize = mpi::Size( comm );
+    const int commRank = mpi::Rank( comm );
+    const Int dataSize = fileSize - dataBeg;
+    const Int rangeBeg = dataBeg + (dataSize*commRank)/commSize;
+    const Int rangeEnd = dataBeg + (dataSize*(commRank+1))/commSize;
+    const Int readBeg = ( commRank == 0 ? rangeBeg : rangeBeg-1 );
+    vector<char> buffer( rangeEnd-readBeg );
+    file.seekg( readBeg );
+    file.read( buffer.data(), buffer.size() );
+    if( !file )
+        RuntimeError("Could not read bytes [",readBeg,",",rangeEnd,")");
+    // Finish the last line which begins within the range
+    if( rangeEnd < fileSize && (buffer.empty() || buffer.back() != '\n') )
+    {
+        std::getline( file, line );
+        buffer.insert( buffer.end(), line.begin(), line.end() );
+    }
+    buffer.push_back( '\n' );
+
+    vector<Int> rows, cols;
+    vector<T> values;
+    const Int reserveSize = (2*numNonzero)/commSize + 1;
+    rows.reserve( reserveSize );
+    cols.reserve( reserveSize );
+    values.reserve( reserveSize );
+    const char* pos = buffer.data();
+    const char* end = buffer.data() + buffer.size();
+    if( commRank != 0 )
+        pos = std::find( pos, end, '\n' ) + 1;
+    Int i, j;
     Real realPart, imagPart;
     T value;
-    const int commSize = A.Grid().Size();
-    A.Reserve( numNonzero/commSize ); // Assume an even nonzero distribution
-    bool passive = true;
-    for( Int k=0; k<numNonzero; ++k )
+    while( pos < end )
     {
-        if( !std::getline( file, line ) )
-            RuntimeError("Could not get nonzero ",k);
-        std::stringstream lineStream( line );
-        if( !(lineStream >> i) )
-            RuntimeError("Could not extract row coordinate of nonzero ",k);
+        const char* lineEnd = std::find( pos, end, '\n' );
+        const char* lineBeg = pos;
+        while( pos != lineEnd && mm::IsBlank(*pos) )
+            ++pos;
+        if( pos == lineEnd || *pos == '%' )
+        {
+            pos = lineEnd + 1;
+            continue;
+        }
+        if( !mm::ParseIndex( pos, lineEnd, i ) )
+            RuntimeError
+            ("Could not extract row coordinate from: ",
+             string(lineBeg,lineEnd));
         --i; // convert from Fortran to C indexing
         if( isMatrix )
         {
-            if( !(lineStream >> j) )
+            if( !mm::ParseIndex( pos, lineEnd, j ) )
                 RuntimeError
-                ("Could not extract col coordinate of nonzero ",k);
+                ("Could not extract col coordinate from: ",
+                 string(lineBeg,lineEnd));
             --j;
         }
         else
@@ -535,32 +698,42 @@ void MatrixMarket( DistSparseMatrix<T>& A, const string filename )
 
         if( isPattern )
         {
-            A.QueueUpdate( i, j, T(1), passive );
+            value = T(1);
+        }
+        else if( isComplex )
+        {
+            if( !mm::ParseReal( pos, lineEnd, realPart ) )
+                RuntimeError
+                ("Could not extract real part of entry (",i,",",j,")");
+            if( !mm::ParseReal( pos, lineEnd, imagPart ) )
+                RuntimeError
+                ("Could not extract imag part of entry (",i,",",j,")");
+            SetRealPart( value, realPart );
+            SetImagPart( value, imagPart );
         }
         else
         {
-            if( isComplex )
-            {
-                if( !(lineStream >> realPart) )
-                    RuntimeError
-                    ("Could not extract real part of entry (",i,",",j,")");
-                if( !(lineStream >> imagPart) )
-                    RuntimeError
-                    ("Could not extract imag part of entry (",i,",",j,")");
-                SetRealPart( value, realPart );
-                SetImagPart( value, imagPart );
-                A.QueueUpdate( i, j, value, passive );
-            }
-            else
-            {
-                if( !(lineStream >> realPart) )
-                    RuntimeError
-                    ("Could not extract real entry (",i,",",j,")");
-                A.QueueUpdate( i, j, T(realPart), passive );
-            }
+            if( !mm::ParseReal( pos, lineEnd, realPart ) )
+                RuntimeError("Could not extract real entry (",i,",",j,")");
+            value = T(realPart);
         }
+        if( i < 0 || i >= m || j < 0 || j >= n )
+            RuntimeError("Entry (",i,",",j,") was out of bounds");
+        rows.push_back( i );
+        cols.push_back( j );
+        values.push_back( value );
+        pos = lineEnd + 1;
     }
-    A.ProcessLocalQueues();
+    SwapClear( buffer );
+    const Int numParsed = mpi::AllReduce( Int(rows.size()), comm );
+    if( numParsed != numNonzero )
+        RuntimeError
+        ("Expected ",numNonzero," nonzeros but found ",numParsed);
+
+    // Route the entries directly to their owners
+    // ==========================================
+    Zeros( A, m, n );
+    A.AssembleCOO( rows.size(), rows.data(), cols.data(), values.data() );
 
     if( isSymmetric )
     {
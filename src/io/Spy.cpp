@@ -42,6 +42,9 @@ void Spy( const Matrix<T>& A, string title, Base<T> tol )
 #endif // ifdef EL_HAVE_QT5
 }
 
+// The distributed and sparse spy plots are rendered from a downsampled tile
+// whose pixels count the entries above the tolerance which they cover
+
 template<typename T>
 void Spy( const AbstractDistMatrix<T>& A, string title, Base<T> tol )
 {
@@ -49,17 +52,44 @@ void Spy( const AbstractDistMatrix<T>& A, string title, Base<T> tol )
 #ifdef EL_HAVE_QT5
     if( GuiDisabled() )
         LogicError("GUI was disabled");
-    if( A.ColStride() == 1 && A.RowStride() == 1 )
-    {
-        if( A.CrossRank() == A.Root() && A.RedundantRank() == 0 )
-            Spy( A.LockedMatrix(), title, tol );
-    }
-    else
-    {
-        DistMatrix<T,CIRC,CIRC> A_CIRC_CIRC( A );
-        if( A_CIRC_CIRC.CrossRank() == A_CIRC_CIRC.Root() )
-            Spy( A_CIRC_CIRC.Matrix(), title, tol );
-    }
+    Matrix<double> tile;
+    Downsample
+    ( A, tile, MaxImageSize(), MaxImageSize(), DOWNSAMPLE_NONZEROS, tol );
+    if( A.Grid().Rank() == 0 )
+        Spy( tile, title, 0. );
+#else
+    LogicError("Qt5 not available");
+#endif // ifdef EL_HAVE_QT5
+}
+
+template<typename T>
+void Spy( const SparseMatrix<T>& A, string title, Base<T> tol )
+{
+    EL_DEBUG_CSE
+#ifdef EL_HAVE_QT5
+    if( GuiDisabled() )
+        LogicError("GUI was disabled");
+    Matrix<double> tile;
+    Downsample
+    ( A, tile, MaxImageSize(), MaxImageSize(), DOWNSAMPLE_NONZEROS, tol );
+    Spy( tile, title, 0. );
+#else
+    LogicError("Qt5 not available");
+#endif // ifdef EL_HAVE_QT5
+}
+
+template<typename T>
+void Spy( const DistSparseMatrix<T>& A, string title, Base<T> tol )
+{
+    EL_DEBUG_CSE
+#ifdef EL_HAVE_QT5
+    if( GuiDisabled() )
+        LogicError("GUI was disabled");
+    Matrix<double> tile;
+    Downsample
+    ( A, tile, MaxImageSize(), MaxImageSize(), DOWNSAMPLE_NONZEROS, tol );
+    if( A.Grid().Rank() == 0 )
+        Spy( tile, title, 0. );
 #else
     LogicError("Qt5 not available");
 #endif // ifdef EL_HAVE_QT5
@@ -68,7 +98,11 @@ void Spy( const AbstractDistMatrix<T>& A, string title, Base<T> tol )
 #define PROTO(T) \
   template void Spy ( const Matrix<T>& A, string title, Base<T> tol ); \
   template void Spy \
-  ( const AbstractDistMatrix<T>& A, string title, Base<T> tol );
+  ( const AbstractDistMatrix<T>& A, string title, Base<T> tol ); \
+  template void Spy \
+  ( const SparseMatrix<T>& A, string title, Base<T> tol ); \
+  template void Spy \
+  ( const DistSparseMatrix<T>& A, string title, Base<T> tol );
 
 #define EL_ENABLE_DOUBLEDOUBLE
 #define EL_ENABLE_QUADDOUBLE
@@ -8,10 +8,13 @@
 */
 #include <El.hpp>
 
+#include "./MPIFile.hpp"
+#include "./BinarySparse.hpp"
 #include "./Write/Ascii.hpp"
 #include "./Write/AsciiMatlab.hpp"
 #include "./Write/Binary.hpp"
 #include "./Write/BinaryFlat.hpp"
+#include "./Write/BinarySparse.hpp"
 #include "./Write/Image.hpp"
 #include "./Write/MatrixMarket.hpp"
 
@@ -54,6 +57,19 @@ void Write
         if( A.CrossRank() == A.Root() && A.RedundantRank() == 0 )
             Write( A.LockedMatrix(), basename, format, title );
     }
+    else if( format == BINARY )
+    {
+        write::Binary( A, basename );
+    }
+    else if( format == BINARY_FLAT )
+    {
+        write::BinaryFlat( A, basename );
+    }
+    else if( format == BMP || format == JPG || format == JPEG ||
+             format == PNG || format == PPM || format == XBM || format == XPM )
+    {
+        write::Image( A, basename, format );
+    }
     else
     {
         DistMatrix<T,CIRC,CIRC> A_CIRC_CIRC( A );
@@ -62,13 +78,42 @@ void Write
     }
 }
 
+template<typename T>
+void Write( const SparseMatrix<T>& A, string basename, FileFormat format )
+{
+    EL_DEBUG_CSE
+    switch( format )
+    {
+    case BINARY_SPARSE: write::BinarySparse( A, basename ); break;
+    default:
+        LogicError("Format unsupported for writing a SparseMatrix");
+    }
+}
+
+template<typename T>
+void Write
+( const DistSparseMatrix<T>& A, string basename, FileFormat format )
+{
+    EL_DEBUG_CSE
+    switch( format )
+    {
+    case BINARY_SPARSE: write::BinarySparse( A, basename ); break;
+    default:
+        LogicError("Format unsupported for writing a DistSparseMatrix");
+    }
+}
+
 #define PROTO(T) \
   template void Write \
   ( const Matrix<T>& A, \
     string basename, FileFormat format, string title ); \
   template void Write \
   ( const AbstractDistMatrix<T>& A, \
-    string basename, FileFormat format, string title );
+    string basename, FileFormat format, string title ); \
+  template void Write \
+  ( const SparseMatrix<T>& A, string basename, FileFormat format ); \
+  template void Write \
+  ( const DistSparseMatrix<T>& A, string basename, FileFormat format );
 
 #define EL_ENABLE_DOUBLEDOUBLE
 #define EL_ENABLE_QUADDOUBLE
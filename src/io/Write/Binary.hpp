@@ -35,6 +35,40 @@ Binary( const Matrix<T>& A, string basename="matrix" )
             file.write( (char*)A.LockedBuffer(0,j), A.Height()*sizeof(T) );
 }
 
+// Every process collectively writes its own entries using MPI-IO
+template<typename T>
+inline void
+Binary( const AbstractDistMatrix<T>& A, string basename="matrix" )
+{
+    EL_DEBUG_CSE
+    if( !A.Participating() )
+        return;
+    string filename = basename + "." + FileExtension(BINARY);
+    mpi::Comm comm = A.Grid().Comm();
+    MPI_File file;
+    if( MPI_File_open
+        ( comm.comm, const_cast<char*>(filename.c_str()),
+          MPI_MODE_CREATE | MPI_MODE_WRONLY, MPI_INFO_NULL, &file )
+        != MPI_SUCCESS )
+        RuntimeError("Could not open ",filename);
+
+    const Int metaBytes = 2*sizeof(Int);
+    const Int dataBytes = A.Height()*A.Width()*sizeof(T);
+    mpi_file::SafeFileOp
+    ( MPI_File_set_size( file, metaBytes+dataBytes ), "MPI_File_set_size",
+      filename );
+    if( mpi::Rank(comm) == 0 )
+    {
+        Int meta[2] = { A.Height(), A.Width() };
+        mpi_file::SafeFileOp
+        ( MPI_File_write_at
+          ( file, 0, meta, metaBytes, MPI_BYTE, MPI_STATUS_IGNORE ),
+          "MPI_File_write_at", filename );
+    }
+    mpi_file::WriteAll( A, file, metaBytes, filename );
+    MPI_File_close( &file );
+}
+
 } // namespace write
 } // namespace El
 
@@ -30,6 +30,30 @@ BinaryFlat( const Matrix<T>& A, string basename="matrix" )
             file.write( (char*)A.LockedBuffer(0,j), A.Height()*sizeof(T) );
 }
 
+// Every process collectively writes its own entries using MPI-IO
+template<typename T>
+inline void
+BinaryFlat( const AbstractDistMatrix<T>& A, string basename="matrix" )
+{
+    EL_DEBUG_CSE
+    if( !A.Participating() )
+        return;
+    string filename = basename + "." + FileExtension(BINARY_FLAT);
+    mpi::Comm comm = A.Grid().Comm();
+    MPI_File file;
+    if( MPI_File_open
+        ( comm.comm, const_cast<char*>(filename.c_str()),
+          MPI_MODE_CREATE | MPI_MODE_WRONLY, MPI_INFO_NULL, &file )
+        != MPI_SUCCESS )
+        RuntimeError("Could not open ",filename);
+
+    const Int dataBytes = A.Height()*A.Width()*sizeof(T);
+    mpi_file::SafeFileOp
+    ( MPI_File_set_size( file, dataBytes ), "MPI_File_set_size", filename );
+    mpi_file::WriteAll( A, file, 0, filename );
+    MPI_File_close( &file );
+}
+
 } // namespace write
 } // namespace El
 
@@ -0,0 +1,135 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_WRITE_BINARYSPARSE_HPP
+#define EL_WRITE_BINARYSPARSE_HPP
+
+namespace El {
+namespace write {
+
+template<typename T>
+inline void
+BinarySparse( const SparseMatrix<T>& A, string basename="matrix" )
+{
+    EL_DEBUG_CSE
+    A.AssertConsistent();
+    string filename = basename + "." + FileExtension(BINARY_SPARSE);
+    ofstream file( filename.c_str(), std::ios::binary );
+    if( !file.is_open() )
+        RuntimeError("Could not open ",filename);
+
+    binary_sparse::Layout<T> layout;
+    layout.height = A.Height();
+    layout.width = A.Width();
+    layout.numEntries = A.NumEntries();
+    layout.numChunks = 1;
+    Int header[binary_sparse::HEADER_SIZE];
+    layout.PackHeader( header );
+    const Int chunkRows[2] = { 0, layout.height };
+    file.write( (char*)header, binary_sparse::HEADER_SIZE*sizeof(Int) );
+    file.write( (char*)chunkRows, 2*sizeof(Int) );
+    file.write
+    ( (char*)A.LockedOffsetBuffer(), (layout.height+1)*sizeof(Int) );
+    file.write
+    ( (char*)A.LockedTargetBuffer(), layout.numEntries*sizeof(Int) );
+    file.write
+    ( (char*)A.LockedValueBuffer(), layout.numEntries*sizeof(T) );
+    if( !file )
+        RuntimeError("Could not write ",filename);
+}
+
+// Each process collectively writes its rows (as its own chunk) with MPI-IO
+template<typename T>
+inline void
+BinarySparse( const DistSparseMatrix<T>& A, string basename="matrix" )
+{
+    EL_DEBUG_CSE
+    // Every process checks the entry type before the first collective
+    binary_sparse::Layout<T>::AssertPacked();
+    A.AssertConsistent();
+    string filename = basename + "." + FileExtension(BINARY_SPARSE);
+    mpi::Comm comm = A.Grid().Comm();
+    const int commSize = mpi::Size( comm );
+    const int commRank = mpi::Rank( comm );
+
+    // Determine the rows and entries owned by each process
+    const Int localHeight = A.LocalHeight();
+    const Int numLocalEntries = A.NumLocalEntries();
+    const Int localCounts[2] = { localHeight, numLocalEntries };
+    vector<Int> counts( 2*commSize );
+    mpi::AllGather( localCounts, 2, counts.data(), 2, comm );
+    vector<Int> chunkRows( commSize+1, 0 );
+    Int entryOff = 0;
+    for( int q=0; q<commSize; ++q )
+    {
+        chunkRows[q+1] = chunkRows[q] + counts[2*q];
+        if( q < commRank )
+            entryOff += counts[2*q+1];
+    }
+
+    binary_sparse::Layout<T> layout;
+    layout.height = A.Height();
+    layout.width = A.Width();
+    layout.numEntries = A.NumEntries();
+    layout.numChunks = commSize;
+
+    MPI_File file;
+    if( MPI_File_open
+        ( comm.comm, const_cast<char*>(filename.c_str()),
+          MPI_MODE_CREATE | MPI_MODE_WRONLY, MPI_INFO_NULL, &file )
+        != MPI_SUCCESS )
+        RuntimeError("Could not open ",filename);
+    mpi_file::SafeFileOp
+    ( MPI_File_set_size( file, layout.FileSize() ), "MPI_File_set_size",
+      filename );
+
+    // The root writes the header, chunk table, and final row offset
+    if( commRank == 0 )
+    {
+        Int header[binary_sparse::HEADER_SIZE];
+        layout.PackHeader( header );
+        mpi_file::SafeFileOp
+        ( MPI_File_write_at
+          ( file, 0, header, binary_sparse::HEADER_SIZE*sizeof(Int),
+            MPI_BYTE, MPI_STATUS_IGNORE ),
+          "MPI_File_write_at", filename );
+        mpi_file::SafeFileOp
+        ( MPI_File_write_at
+          ( file, layout.ChunkRowsOffset(), chunkRows.data(),
+            (commSize+1)*sizeof(Int), MPI_BYTE, MPI_STATUS_IGNORE ),
+          "MPI_File_write_at", filename );
+        const Int numEntries = layout.numEntries;
+        mpi_file::SafeFileOp
+        ( MPI_File_write_at
+          ( file, layout.RowOffsetsOffset()+layout.height*sizeof(Int),
+            &numEntries, sizeof(Int), MPI_BYTE, MPI_STATUS_IGNORE ),
+          "MPI_File_write_at", filename );
+    }
+
+    // Every process writes its (globally offset) rows, columns, and values
+    vector<Int> rowOffsets( localHeight );
+    const Int* localOffsets = A.LockedOffsetBuffer();
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+        rowOffsets[iLoc] = localOffsets[iLoc] + entryOff;
+    const Int firstLocalRow = A.FirstLocalRow();
+    mpi_file::WriteAtAll
+    ( file, layout.RowOffsetsOffset()+firstLocalRow*sizeof(Int),
+      rowOffsets.data(), localHeight*sizeof(Int), comm, filename );
+    mpi_file::WriteAtAll
+    ( file, layout.ColsOffset()+entryOff*sizeof(Int),
+      A.LockedTargetBuffer(), numLocalEntries*sizeof(Int), comm, filename );
+    mpi_file::WriteAtAll
+    ( file, layout.ValuesOffset()+entryOff*sizeof(T),
+      A.LockedValueBuffer(), numLocalEntries*sizeof(T), comm, filename );
+    MPI_File_close( &file );
+}
+
+} // namespace write
+} // namespace El
+
+#endif // ifndef EL_WRITE_BINARYSPARSE_HPP
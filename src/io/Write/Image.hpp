@@ -82,71 +82,56 @@ void RealPartImage
 #endif // ifdef EL_HAVE_QT5
 }
 
+// The images are rendered from tiles of at most MaxImageSize() pixels in
+// each dimension holding the average real and imaginary parts of A
+
 template<typename T>
-void ImagPartImage
+void Image
 ( const Matrix<T>& A, string basename="matrix", FileFormat format=PNG )
 {
     EL_DEBUG_CSE
-#ifdef EL_HAVE_QT5
-    typedef Base<T> Real;
-    const Int m = A.Height();
-    const Int n = A.Width();
-
-    // Compute the maximum and minimum values
-    double minVal=0, maxVal=0; 
-    if( m != 0 && n != 0 )
+    const Int maxSize = MaxImageSize();
+    Matrix<double> tile;
+    if( IsComplex<T>::value )
     {
-        minVal = maxVal = double(A.GetImagPart( 0, 0 ));
-        for( Int j=0; j<n; ++j )
-        {
-            for( Int i=0; i<m; ++i )
-            {
-                minVal = Min( minVal, double(A.GetImagPart(i,j)) );
-                maxVal = Max( maxVal, double(A.GetImagPart(i,j)) );
-            }
-        }
+        Downsample( A, tile, maxSize, maxSize, DOWNSAMPLE_REAL_PART );
+        RealPartImage( tile, basename+"_real", format );
+        Downsample( A, tile, maxSize, maxSize, DOWNSAMPLE_IMAG_PART );
+        RealPartImage( tile, basename+"_imag", format );
     }
-
-    // TODO: Parameterize these instead
-    const Int mPix = 2*m;
-    const Int nPix = 2*n;
-    const double mRatio = double(m) / double(mPix);
-    const double nRatio = double(n) / double(nPix);
-    QImage image( nPix, mPix, QImage::Format_RGB32 );
-    for( Int jPix=0; jPix<nPix; ++jPix )
+    else
     {
-        const Int j = nRatio*jPix;
-        for( Int iPix=0; iPix<mPix; ++iPix )
-        {
-            const Int i = mRatio*iPix;
-            QRgb color =
-              SampleColorMap( double(A.GetImagPart(i,j)), minVal, maxVal );
-            image.setPixel( jPix, iPix, color );
-        }
+        Downsample( A, tile, maxSize, maxSize, DOWNSAMPLE_REAL_PART );
+        RealPartImage( tile, basename, format );
     }
-
-    SaveQImage( image, basename, format );
-#else
-    LogicError("Qt5 not available");
-#endif // ifdef EL_HAVE_QT5
-}
-
-template<typename Real>
-void Image
-( const Matrix<Real>& A, string basename="matrix", FileFormat format=PNG )
-{
-    EL_DEBUG_CSE
-    RealPartImage( A, basename, format );
 }
 
-template<typename Real>
+// Only the root of the grid receives the (downsampled) tiles and writes the
+// images
+template<typename T>
 void Image
-( const Matrix<Complex<Real>>& A, string basename="matrix", 
+( const AbstractDistMatrix<T>& A, string basename="matrix",
   FileFormat format=PNG )
 {
     EL_DEBUG_CSE
-    RealPartImage( A, basename+"_real", format );
-    ImagPartImage( A, basename+"_imag", format );
+    const Int maxSize = MaxImageSize();
+    const bool isRoot = ( A.Grid().Rank() == 0 );
+    Matrix<double> tile;
+    if( IsComplex<T>::value )
+    {
+        Downsample( A, tile, maxSize, maxSize, DOWNSAMPLE_REAL_PART );
+        if( isRoot )
+            RealPartImage( tile, basename+"_real", format );
+        Downsample( A, tile, maxSize, maxSize, DOWNSAMPLE_IMAG_PART );
+        if( isRoot )
+            RealPartImage( tile, basename+"_imag", format );
+    }
+    else
+    {
+        Downsample( A, tile, maxSize, maxSize, DOWNSAMPLE_REAL_PART );
+        if( isRoot )
+            RealPartImage( tile, basename, format );
+    }
 }
 
 } // namespace write
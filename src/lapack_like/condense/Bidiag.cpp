@@ -11,6 +11,7 @@
 #include "./Bidiag/Apply.hpp"
 #include "./Bidiag/LowerBlocked.hpp"
 #include "./Bidiag/UpperBlocked.hpp"
+#include "./Bidiag/TwoStage.hpp"
 
 namespace El {
 
@@ -186,6 +187,16 @@ void ExplicitCondensed( AbstractDistMatrix<F>& A )
     AbstractDistMatrix<F>& Q ); \
   template void bidiag::ExplicitCondensed( Matrix<F>& A ); \
   template void bidiag::ExplicitCondensed( AbstractDistMatrix<F>& A ); \
+  template void bidiag::TwoStageCondensed \
+  ( Matrix<F>& A, \
+    Matrix<Base<F>>& mainDiag, \
+    Matrix<Base<F>>& superDiag, \
+    Int bandwidth ); \
+  template void bidiag::TwoStageCondensed \
+  ( AbstractDistMatrix<F>& A, \
+    Matrix<Base<F>>& mainDiag, \
+    Matrix<Base<F>>& superDiag, \
+    Int bandwidth ); \
   template void bidiag::ApplyQ \
   ( LeftOrRight side, Orientation orientation, \
     const Matrix<F>& A, \
@@ -0,0 +1,256 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_BIDIAG_TWOSTAGE_HPP
+#define EL_BIDIAG_TWOSTAGE_HPP
+
+// The two-stage reduction first reduces a matrix with at least as many rows
+// as columns to upper banded form by alternating blocked QR decompositions of
+// column panels with blocked LQ decompositions of row panels, so that all of
+// the trailing updates are BLAS-3. The bulges are then chased out of the band
+// one entry at a time with Givens rotations, following Schwarz's algorithm,
+// until only the bidiagonal remains. Since the transformations are
+// discarded, only the singular values are preserved.
+
+namespace El {
+namespace bidiag {
+namespace two_stage {
+
+inline Int Bandwidth( Int n, Int bandwidth )
+{
+    if( bandwidth <= 0 )
+        bandwidth = Blocksize();
+    return Max( Min( bandwidth, n-1 ), Int(1) );
+}
+
+template<typename F>
+void ReduceToBand( Matrix<F>& A, Int bandwidth )
+{
+    EL_DEBUG_CSE
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int b = bandwidth;
+
+    Matrix<F> householderScalars;
+    Matrix<Base<F>> signature;
+    for( Int k=0; k<n; k+=b )
+    {
+        const Int nb = Min(b,n-k);
+        const Range<Int> ind0( k, k+nb ), ind1( k+nb, n );
+
+        // Annihilate the column panel below its diagonal
+        auto AL = A( IR(k,m), ind0 );
+        auto AR = A( IR(k,m), ind1 );
+        QR( AL, householderScalars, signature );
+        qr::ApplyQ( LEFT, ADJOINT, AL, householderScalars, signature, AR );
+        if( k+nb == n )
+            break;
+
+        // Annihilate the row panel to the right of the band
+        auto AT = A( ind0, ind1 );
+        auto ABR = A( IR(k+nb,m), ind1 );
+        LQ( AT, householderScalars, signature );
+        lq::ApplyQ( RIGHT, ADJOINT, AT, householderScalars, signature, ABR );
+    }
+}
+
+template<typename F>
+void ReduceToBand( DistMatrix<F>& A, Int bandwidth )
+{
+    EL_DEBUG_CSE
+    const Grid& g = A.Grid();
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int b = bandwidth;
+
+    DistMatrix<F,MD,STAR> householderScalars(g);
+    DistMatrix<Base<F>,MD,STAR> signature(g);
+    for( Int k=0; k<n; k+=b )
+    {
+        const Int nb = Min(b,n-k);
+        const Range<Int> ind0( k, k+nb ), ind1( k+nb, n );
+
+        auto AL = A( IR(k,m), ind0 );
+        auto AR = A( IR(k,m), ind1 );
+        QR( AL, householderScalars, signature );
+        qr::ApplyQ( LEFT, ADJOINT, AL, householderScalars, signature, AR );
+        if( k+nb == n )
+            break;
+
+        auto AT = A( ind0, ind1 );
+        auto ABR = A( IR(k+nb,m), ind1 );
+        LQ( AT, householderScalars, signature );
+        lq::ApplyQ( RIGHT, ADJOINT, AT, householderScalars, signature, ABR );
+    }
+}
+
+// Store the upper band so that band(j-i+1,j) = A(i,j), leaving room for the
+// single superdiagonal and subdiagonal bulges introduced during the chase
+template<typename F>
+void GetBand( const Matrix<F>& A, Int bandwidth, Matrix<F>& band )
+{
+    EL_DEBUG_CSE
+    const Int n = A.Width();
+    Zeros( band, bandwidth+3, n );
+    for( Int j=0; j<n; ++j )
+        for( Int i=Max(j-bandwidth,Int(0)); i<=j; ++i )
+            band(j-i+1,j) = A(i,j);
+}
+
+template<typename F>
+void GetBand( const DistMatrix<F>& A, Int bandwidth, Matrix<F>& band )
+{
+    EL_DEBUG_CSE
+    const Int n = A.Width();
+    Zeros( band, bandwidth+3, n );
+    DistMatrix<F,STAR,STAR> ABlock( A.Grid() );
+    for( Int k=0; k<n; k+=bandwidth )
+    {
+        const Int nb = Min(bandwidth,n-k);
+        const Int iBeg = Max(k-bandwidth,Int(0));
+        ABlock = A( IR(iBeg,k+nb), IR(k,k+nb) );
+        const Matrix<F>& ABlockLoc = ABlock.LockedMatrix();
+        for( Int t=0; t<nb; ++t )
+        {
+            const Int j = k+t;
+            for( Int i=Max(j-bandwidth,Int(0)); i<=j; ++i )
+                band(j-i+1,j) = ABlockLoc(i-iBeg,t);
+        }
+    }
+}
+
+template<typename F>
+void ChaseBulges
+( Int bandwidth,
+  Matrix<F>& band,
+  Matrix<Base<F>>& mainDiag,
+  Matrix<Base<F>>& superDiag )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    const Int n = band.Width();
+    const Int b = bandwidth;
+    auto entry = [&]( Int i, Int j ) -> F& { return band(j-i+1,j); };
+
+    // [x y] := [x y] G^H for the rows [iBeg,iEnd] of columns j and j+1
+    auto rotateCols = [&]( Int j, Int iBeg, Int iEnd, Real c, F s )
+    {
+        for( Int i=iBeg; i<=iEnd; ++i )
+        {
+            F& chi0 = entry(i,j);
+            F& chi1 = entry(i,j+1);
+            const F tau = c*chi0 + Conj(s)*chi1;
+            chi1 = c*chi1 - s*chi0;
+            chi0 = tau;
+        }
+    };
+    // [x; y] := G [x; y] for the columns [jBeg,jEnd] of rows i and i+1
+    auto rotateRows = [&]( Int i, Int jBeg, Int jEnd, Real c, F s )
+    {
+        for( Int j=jBeg; j<=jEnd; ++j )
+        {
+            F& chi0 = entry(i,j);
+            F& chi1 = entry(i+1,j);
+            const F tau = c*chi0 + s*chi1;
+            chi1 = c*chi1 - Conj(s)*chi0;
+            chi0 = tau;
+        }
+    };
+
+    Real c;
+    F s;
+    for( Int j=0; j<n-2; ++j )
+    {
+        for( Int k=Min(j+b,n-1); k>=j+2; --k )
+        {
+            // Annihilate A(j,k), which introduces a bulge at A(k,k-1) and, in
+            // turn, at A(k-1,k+b), which is chased down the band
+            Int row=j, col=k;
+            while( col < n )
+            {
+                Givens( Conj(entry(row,col-1)), Conj(entry(row,col)), c, s );
+                rotateCols( col-1, row, col, c, s );
+                entry(row,col) = 0;
+
+                Givens( entry(col-1,col-1), entry(col,col-1), c, s );
+                rotateRows( col-1, col-1, Min(col+b,n-1), c, s );
+                entry(col,col-1) = 0;
+
+                row = col-1;
+                col += b;
+            }
+        }
+    }
+
+    // The phases of the bidiagonal can be removed with unitary diagonal
+    // scalings from both sides, which preserve the singular values
+    mainDiag.Resize( n, 1 );
+    superDiag.Resize( Max(n-1,Int(0)), 1 );
+    for( Int j=0; j<n; ++j )
+    {
+        mainDiag(j) = Abs(entry(j,j));
+        if( j < n-1 )
+            superDiag(j) = Abs(entry(j,j+1));
+    }
+}
+
+} // namespace two_stage
+
+template<typename F>
+void TwoStageCondensed
+( Matrix<F>& A,
+  Matrix<Base<F>>& mainDiag,
+  Matrix<Base<F>>& superDiag,
+  Int bandwidth )
+{
+    EL_DEBUG_CSE
+    if( A.Height() < A.Width() )
+    {
+        Matrix<F> AAdj;
+        Adjoint( A, AAdj );
+        TwoStageCondensed( AAdj, mainDiag, superDiag, bandwidth );
+        return;
+    }
+    const Int b = two_stage::Bandwidth( A.Width(), bandwidth );
+    two_stage::ReduceToBand( A, b );
+
+    Matrix<F> band;
+    two_stage::GetBand( A, b, band );
+    two_stage::ChaseBulges( b, band, mainDiag, superDiag );
+}
+
+template<typename F>
+void TwoStageCondensed
+( AbstractDistMatrix<F>& APre,
+  Matrix<Base<F>>& mainDiag,
+  Matrix<Base<F>>& superDiag,
+  Int bandwidth )
+{
+    EL_DEBUG_CSE
+    if( APre.Height() < APre.Width() )
+    {
+        DistMatrix<F> AAdj( APre.Grid() );
+        Adjoint( APre, AAdj );
+        TwoStageCondensed( AAdj, mainDiag, superDiag, bandwidth );
+        return;
+    }
+    DistMatrixReadWriteProxy<F,F,MC,MR> AProx( APre );
+    auto& A = AProx.Get();
+    const Int b = two_stage::Bandwidth( A.Width(), bandwidth );
+    two_stage::ReduceToBand( A, b );
+
+    // Every process redundantly chases the bulges of the gathered band
+    Matrix<F> band;
+    two_stage::GetBand( A, b, band );
+    two_stage::ChaseBulges( b, band, mainDiag, superDiag );
+}
+
+} // namespace bidiag
+} // namespace El
+
+#endif // ifndef EL_BIDIAG_TWOSTAGE_HPP
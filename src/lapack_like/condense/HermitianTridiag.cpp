@@ -47,6 +47,7 @@ void Ger2Sub
 #include "./HermitianTridiag/UpperBlockedSquare.hpp"
 
 #include "./HermitianTridiag/ApplyQ.hpp"
+#include "./HermitianTridiag/TwoStage.hpp"
 
 namespace El {
 
@@ -161,11 +162,22 @@ void HermitianTridiag
 namespace herm_tridiag {
 
 template<typename F>
-void ExplicitCondensed( UpperOrLower uplo, Matrix<F>& A )
+void ExplicitCondensed
+( UpperOrLower uplo,
+  Matrix<F>& A,
+  const HermitianTridiagCtrl<F>& ctrl )
 {
     EL_DEBUG_CSE
-    Matrix<F> householderScalars;
-    HermitianTridiag( uplo, A, householderScalars );
+    if( ctrl.twoStage )
+    {
+        TwoStageReflectors<F> reflectors;
+        two_stage::Reduce( uplo, A, reflectors, ctrl.bandwidth, false );
+    }
+    else
+    {
+        Matrix<F> householderScalars;
+        HermitianTridiag( uplo, A, householderScalars );
+    }
     if( uplo == UPPER )
         MakeTrapezoidal( LOWER, A, 1 );
     else
@@ -179,8 +191,16 @@ void ExplicitCondensed
   const HermitianTridiagCtrl<F>& ctrl )
 {
     EL_DEBUG_CSE
-    DistMatrix<F,STAR,STAR> householderScalars(A.Grid());
-    HermitianTridiag( uplo, A, householderScalars, ctrl );
+    if( ctrl.twoStage )
+    {
+        TwoStageReflectors<F> reflectors;
+        two_stage::Reduce( uplo, A, reflectors, ctrl.bandwidth, false );
+    }
+    else
+    {
+        DistMatrix<F,STAR,STAR> householderScalars(A.Grid());
+        HermitianTridiag( uplo, A, householderScalars, ctrl );
+    }
     if( uplo == UPPER )
         MakeTrapezoidal( LOWER, A, 1 );
     else
@@ -200,7 +220,9 @@ void ExplicitCondensed
     AbstractDistMatrix<F>& householderScalars, \
     const HermitianTridiagCtrl<F>& ctrl ); \
   template void herm_tridiag::ExplicitCondensed \
-  ( UpperOrLower uplo, Matrix<F>& A ); \
+  ( UpperOrLower uplo, \
+    Matrix<F>& A, \
+    const HermitianTridiagCtrl<F>& ctrl ); \
   template void herm_tridiag::ExplicitCondensed \
   ( UpperOrLower uplo, \
     AbstractDistMatrix<F>& A, \
@@ -218,6 +240,24 @@ void ExplicitCondensed
     Orientation orientation, \
     const AbstractDistMatrix<F>& A, \
     const AbstractDistMatrix<F>& householderScalars, \
+          AbstractDistMatrix<F>& B ); \
+  template void herm_tridiag::TwoStage \
+  ( UpperOrLower uplo, \
+    Matrix<F>& A, \
+    herm_tridiag::TwoStageReflectors<F>& reflectors, \
+    Int bandwidth ); \
+  template void herm_tridiag::TwoStage \
+  ( UpperOrLower uplo, \
+    AbstractDistMatrix<F>& A, \
+    herm_tridiag::TwoStageReflectors<F>& reflectors, \
+    Int bandwidth ); \
+  template void herm_tridiag::ApplyTwoStageQ \
+  ( const Matrix<F>& A, \
+    const herm_tridiag::TwoStageReflectors<F>& reflectors, \
+          Matrix<F>& B ); \
+  template void herm_tridiag::ApplyTwoStageQ \
+  ( const AbstractDistMatrix<F>& A, \
+    const herm_tridiag::TwoStageReflectors<F>& reflectors, \
           AbstractDistMatrix<F>& B );
 
 #define EL_NO_INT_PROTO
@@ -0,0 +1,588 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_HERMITIANTRIDIAG_TWOSTAGE_HPP
+#define EL_HERMITIANTRIDIAG_TWOSTAGE_HPP
+
+// The two-stage reduction first reduces the (lower) Hermitian matrix to a
+// band of width b using blocked Householder transformations whose trailing
+// updates are rich in BLAS-3 (Hemm and Her2k), and then chases the bulges
+// out of the band with sequences of small reflectors until only the
+// tridiagonal remains. The reflectors of the first stage are stored below
+// the band of A (with an offset of -b), while those of the second stage are
+// returned separately since they do not fit within A.
+
+namespace El {
+namespace herm_tridiag {
+namespace two_stage {
+
+inline Int Bandwidth( Int n, Int bandwidth )
+{
+    if( bandwidth <= 0 )
+        bandwidth = Blocksize();
+    return Max( Min( bandwidth, n-1 ), Int(1) );
+}
+
+// The sweeps of the bulge chase are split into groups of 'bandwidth'
+// consecutive sweeps, and each process stores the reflectors of a contiguous
+// range of groups
+inline void SweepRange
+( Int n, Int bandwidth, int rank, int numProcs, Int& sweepBeg, Int& sweepEnd )
+{
+    const Int numSweeps = Max( n-1, Int(0) );
+    const Int numGroups = (numSweeps+bandwidth-1) / bandwidth;
+    const Int groupBeg = (rank*numGroups) / numProcs;
+    const Int groupEnd = ((rank+1)*numGroups) / numProcs;
+    sweepBeg = Min( groupBeg*bandwidth, numSweeps );
+    sweepEnd = Min( groupEnd*bandwidth, numSweeps );
+}
+
+// Sweep j generates reflectors of length Min(b,n-r) for r = j+1+s*b < n,
+// and only the entries below the unit diagonal of each are stored
+inline void ChaseSizes
+( Int n, Int bandwidth, Int sweepBeg, Int sweepEnd,
+  Int& numScalars, Int& numEntries )
+{
+    numScalars = 0;
+    numEntries = 0;
+    for( Int j=sweepBeg; j<sweepEnd; ++j )
+    {
+        for( Int r=j+1; r<n; r+=bandwidth )
+        {
+            ++numScalars;
+            numEntries += Min(bandwidth,n-r) - 1;
+        }
+    }
+}
+
+template<typename F>
+void ReduceToBand
+( Matrix<F>& A, Matrix<F>& householderScalars, Int bandwidth )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    const Int n = A.Height();
+    const Int b = bandwidth;
+    Zeros( householderScalars, Max(n-b,Int(0)), 1 );
+
+    Matrix<F> panelScalars, U, SInv, Y, Z, W;
+    Matrix<Real> panelSignature;
+    for( Int k=0; k+b<n; k+=b )
+    {
+        const Int height = n-k-b;
+        const Int nb = Min(height,b);
+        const Range<Int> ind0( k, k+b ), ind1( k+b, n );
+
+        auto A10 = A( ind1, ind0 );
+        auto A11 = A( ind1, ind1 );
+
+        // Annihilate the panel below the band. The signature is absorbed into
+        // the triangular factor so that the transformation is a pure product
+        // of Householder reflectors
+        QR( A10, panelScalars, panelSignature );
+        auto A10T = A10( IR(0,nb), ALL );
+        DiagonalScaleTrapezoid( LEFT, UPPER, NORMAL, panelSignature, A10T );
+        auto scalars1 = householderScalars( IR(k,k+nb), ALL );
+        scalars1 = panelScalars;
+
+        // Form the compact WY representation I - U inv(SInv) U^H of the
+        // adjoint of the panel transformation
+        U = A10( ALL, IR(0,nb) );
+        MakeTrapezoidal( LOWER, U );
+        FillDiagonal( U, F(1) );
+        Herk( UPPER, ADJOINT, Real(1), U, SInv );
+        for( Int t=0; t<nb; ++t )
+            SInv(t,t) = F(1) / Conj(panelScalars(t));
+
+        // A11 := (I - U inv(SInv)^H U^H) A11 (I - U inv(SInv) U^H)
+        //      = A11 - U W^H - W U^H,
+        // where Y = A11 U inv(SInv) and W = Y - U (inv(SInv)^H U^H Y) / 2
+        Zeros( Y, height, nb );
+        Hemm( LEFT, LOWER, F(1), A11, U, F(0), Y );
+        Trsm( RIGHT, UPPER, NORMAL, NON_UNIT, F(1), SInv, Y );
+        Gemm( ADJOINT, NORMAL, F(1), U, Y, Z );
+        Trsm( LEFT, UPPER, ADJOINT, NON_UNIT, F(1), SInv, Z );
+        W = Y;
+        Gemm( NORMAL, NORMAL, F(-1)/F(2), U, Z, F(1), W );
+        Her2k( LOWER, NORMAL, F(-1), U, W, Real(1), A11 );
+    }
+}
+
+template<typename F>
+void ReduceToBand
+( DistMatrix<F>& A, Matrix<F>& householderScalars, Int bandwidth )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    const Grid& g = A.Grid();
+    const Int n = A.Height();
+    const Int b = bandwidth;
+    Zeros( householderScalars, Max(n-b,Int(0)), 1 );
+
+    DistMatrix<F,MD,STAR> panelScalars(g);
+    DistMatrix<Real,MD,STAR> panelSignature(g);
+    DistMatrix<F,STAR,STAR> panelScalars_STAR_STAR(g);
+    DistMatrix<F> U(g), Y(g), Z(g), W(g);
+    DistMatrix<F,STAR,STAR> SInv(g);
+    for( Int k=0; k+b<n; k+=b )
+    {
+        const Int height = n-k-b;
+        const Int nb = Min(height,b);
+        const Range<Int> ind0( k, k+b ), ind1( k+b, n );
+
+        auto A10 = A( ind1, ind0 );
+        auto A11 = A( ind1, ind1 );
+
+        QR( A10, panelScalars, panelSignature );
+        auto A10T = A10( IR(0,nb), ALL );
+        DiagonalScaleTrapezoid( LEFT, UPPER, NORMAL, panelSignature, A10T );
+        panelScalars_STAR_STAR = panelScalars;
+        auto scalars1 = householderScalars( IR(k,k+nb), ALL );
+        scalars1 = panelScalars_STAR_STAR.Matrix();
+
+        U = A10( ALL, IR(0,nb) );
+        MakeTrapezoidal( LOWER, U );
+        FillDiagonal( U, F(1) );
+        Herk( UPPER, ADJOINT, Real(1), U, SInv );
+        for( Int t=0; t<nb; ++t )
+            SInv.SetLocal( t, t, F(1)/Conj(scalars1(t)) );
+
+        Y.AlignWith( A11 );
+        Zeros( Y, height, nb );
+        Hemm( LEFT, LOWER, F(1), A11, U, F(0), Y );
+        Trsm( RIGHT, UPPER, NORMAL, NON_UNIT, F(1), SInv, Y );
+        Gemm( ADJOINT, NORMAL, F(1), U, Y, Z );
+        Trsm( LEFT, UPPER, ADJOINT, NON_UNIT, F(1), SInv, Z );
+        W = Y;
+        Gemm( NORMAL, NORMAL, F(-1)/F(2), U, Z, F(1), W );
+        Her2k( LOWER, NORMAL, F(-1), U, W, Real(1), A11 );
+    }
+}
+
+// Store the lower band so that band(d,j) = A(j+d,j), leaving room below it
+// for the bulges that are introduced during the chase
+template<typename F>
+void GetBand( const Matrix<F>& A, Int bandwidth, Matrix<F>& band )
+{
+    EL_DEBUG_CSE
+    const Int n = A.Height();
+    Zeros( band, 2*bandwidth, n );
+    for( Int j=0; j<n; ++j )
+        for( Int d=0; d<=Min(bandwidth,n-1-j); ++d )
+            band(d,j) = A(j+d,j);
+}
+
+template<typename F>
+void GetBand( const DistMatrix<F>& A, Int bandwidth, Matrix<F>& band )
+{
+    EL_DEBUG_CSE
+    const Int n = A.Height();
+    Zeros( band, 2*bandwidth, n );
+    DistMatrix<F,STAR,STAR> ABlock( A.Grid() );
+    for( Int k=0; k<n; k+=bandwidth )
+    {
+        const Int nb = Min(bandwidth,n-k);
+        const Int iEnd = Min(k+nb+bandwidth,n);
+        ABlock = A( IR(k,iEnd), IR(k,k+nb) );
+        const Matrix<F>& ABlockLoc = ABlock.LockedMatrix();
+        for( Int t=0; t<nb; ++t )
+            for( Int d=0; d<=Min(bandwidth,n-1-(k+t)); ++d )
+                band(d,k+t) = ABlockLoc(t+d,t);
+    }
+}
+
+template<typename F>
+void ChaseBulges
+( Int bandwidth,
+  Matrix<F>& band,
+  Int sweepBeg,
+  Int sweepEnd,
+  vector<F>& chaseScalars,
+  vector<F>& chaseVectors )
+{
+    EL_DEBUG_CSE
+    const Int n = band.Width();
+    const Int b = bandwidth;
+    const Int bandHeight = band.Height();
+    F* bandBuf = band.Buffer();
+    const Int bandLDim = band.LDim();
+
+    Int numScalars, numEntries;
+    ChaseSizes( n, b, sweepBeg, sweepEnd, numScalars, numEntries );
+    chaseScalars.resize( numScalars );
+    chaseVectors.resize( numEntries );
+    Int scalarOff=0, entryOff=0;
+
+    vector<F> v(b);
+    Matrix<F> D(b,b);
+    for( Int j=0; j<n-1; ++j )
+    {
+        const bool store = ( j >= sweepBeg && j < sweepEnd );
+        Int col=j, r=j+1, L=Min(b,n-r);
+        while( L > 0 )
+        {
+            // Annihilate entries r+1:r+L of column 'col'
+            F* colBuf = &bandBuf[col*bandLDim];
+            F chi = colBuf[r-col];
+            v[0] = F(1);
+            for( Int i=1; i<L; ++i )
+                v[i] = colBuf[r+i-col];
+            const F tau = lapack::Reflector( L, chi, v.data()+1, 1 );
+            colBuf[r-col] = chi;
+            for( Int i=1; i<L; ++i )
+                colBuf[r+i-col] = 0;
+
+            // Apply H from the left to the remainder of rows r:r+L, which
+            // creates the bulge in the columns to the left of 'r'
+            for( Int c=Max(Int(0),r+L-bandHeight); c<r; ++c )
+            {
+                if( c == col )
+                    continue;
+                F* cBuf = &bandBuf[c*bandLDim];
+                const Int iEnd = Min(L,bandHeight-(r-c));
+                F gamma = 0;
+                for( Int i=0; i<iEnd; ++i )
+                    gamma += Conj(v[i])*cBuf[r+i-c];
+                gamma *= tau;
+                for( Int i=0; i<iEnd; ++i )
+                    cBuf[r+i-c] -= gamma*v[i];
+            }
+
+            // Form H D H^H for the Hermitian diagonal block
+            for( Int t=0; t<L; ++t )
+            {
+                D(t,t) = bandBuf[(r+t)*bandLDim];
+                for( Int i=t+1; i<L; ++i )
+                {
+                    D(i,t) = bandBuf[(i-t)+(r+t)*bandLDim];
+                    D(t,i) = Conj(D(i,t));
+                }
+            }
+            for( Int t=0; t<L; ++t )
+            {
+                F gamma = 0;
+                for( Int i=0; i<L; ++i )
+                    gamma += Conj(v[i])*D(i,t);
+                gamma *= tau;
+                for( Int i=0; i<L; ++i )
+                    D(i,t) -= gamma*v[i];
+            }
+            for( Int i=0; i<L; ++i )
+            {
+                F gamma = 0;
+                for( Int t=0; t<L; ++t )
+                    gamma += D(i,t)*v[t];
+                gamma *= Conj(tau);
+                for( Int t=0; t<L; ++t )
+                    D(i,t) -= gamma*Conj(v[t]);
+            }
+            for( Int t=0; t<L; ++t )
+                for( Int i=t; i<L; ++i )
+                    bandBuf[(i-t)+(r+t)*bandLDim] = D(i,t);
+
+            // Apply H^H from the right to the rows below the diagonal block,
+            // which creates the bulge that the next reflector annihilates
+            const Int iEnd = Min(n,r+L-1+bandHeight);
+            for( Int i=r+L; i<iEnd; ++i )
+            {
+                const Int tBeg = Max(Int(0),i-r-bandHeight+1);
+                F gamma = 0;
+                for( Int t=tBeg; t<L; ++t )
+                    gamma += bandBuf[(i-r-t)+(r+t)*bandLDim]*v[t];
+                gamma *= Conj(tau);
+                for( Int t=tBeg; t<L; ++t )
+                    bandBuf[(i-r-t)+(r+t)*bandLDim] -= gamma*Conj(v[t]);
+            }
+
+            if( store )
+            {
+                chaseScalars[scalarOff++] = tau;
+                for( Int i=1; i<L; ++i )
+                    chaseVectors[entryOff++] = v[i];
+            }
+
+            col = r;
+            r += L;
+            L = Min(b,n-r);
+        }
+    }
+}
+
+// B := Q2 B, where Q2 is the product of the reflectors generated by the
+// sweeps [sweepBeg,sweepEnd). Groups of reflectors from 'bandwidth'
+// consecutive sweeps which act on overlapping rows are accumulated into
+// compact WY form and applied with BLAS-3 operations.
+template<typename F>
+void ApplyChase
+( Int bandwidth,
+  Int sweepBeg,
+  Int sweepEnd,
+  const F* chaseScalars,
+  const F* chaseVectors,
+        Matrix<F>& B )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    const Int n = B.Height();
+    const Int b = bandwidth;
+    const Int numSweeps = sweepEnd - sweepBeg;
+    if( numSweeps <= 0 )
+        return;
+
+    vector<Int> scalarOffsets(numSweeps), entryOffsets(numSweeps);
+    Int scalarOff=0, entryOff=0;
+    for( Int j=sweepBeg; j<sweepEnd; ++j )
+    {
+        scalarOffsets[j-sweepBeg] = scalarOff;
+        entryOffsets[j-sweepBeg] = entryOff;
+        Int numScalars, numEntries;
+        ChaseSizes( n, b, j, j+1, numScalars, numEntries );
+        scalarOff += numScalars;
+        entryOff += numEntries;
+    }
+
+    Matrix<F> V, SInv, X;
+    const Int lastGroupBeg = sweepBeg + ((numSweeps-1)/b)*b;
+    for( Int j0=lastGroupBeg; j0>=sweepBeg; j0-=b )
+    {
+        const Int j1 = Min(j0+b,sweepEnd);
+        for( Int s=0; j0+1+s*b<n; ++s )
+        {
+            const Int r0 = j0+1+s*b;
+            Int m = 0;
+            while( j0+m < j1 && r0+m < n )
+                ++m;
+            const Int height = Min(n,r0+m-1+b) - r0;
+
+            Zeros( V, height, m );
+            for( Int i=0; i<m; ++i )
+            {
+                const Int j = j0+i;
+                const Int L = Min(b,n-(r0+i));
+                const F* vec = &chaseVectors[entryOffsets[j-sweepBeg]+s*(b-1)];
+                V(i,i) = F(1);
+                for( Int t=1; t<L; ++t )
+                    V(i+t,i) = vec[t-1];
+            }
+            Herk( UPPER, ADJOINT, Real(1), V, SInv );
+            for( Int i=0; i<m; ++i )
+            {
+                const Int j = j0+i;
+                const F tau = chaseScalars[scalarOffsets[j-sweepBeg]+s];
+                SInv(i,i) = F(1) / Conj(tau);
+            }
+
+            // B1 := (I - V inv(SInv) V^H) B1
+            auto B1 = B( IR(r0,r0+height), ALL );
+            Gemm( ADJOINT, NORMAL, F(1), V, B1, X );
+            Trsm( LEFT, UPPER, NORMAL, NON_UNIT, F(1), SInv, X );
+            Gemm( NORMAL, NORMAL, F(-1), V, X, F(1), B1 );
+        }
+    }
+}
+
+template<typename F>
+void Reduce
+( UpperOrLower uplo,
+  Matrix<F>& A,
+  TwoStageReflectors<F>& reflectors,
+  Int bandwidth,
+  bool storeChase )
+{
+    EL_DEBUG_CSE
+    const Int n = A.Height();
+    const Int b = Bandwidth( n, bandwidth );
+    if( uplo == UPPER )
+        MakeHermitian( UPPER, A );
+
+    ReduceToBand( A, reflectors.householderScalars, b );
+
+    Matrix<F> band;
+    GetBand( A, b, band );
+    reflectors.bandwidth = b;
+    reflectors.sweepBeg = 0;
+    reflectors.sweepEnd = ( storeChase ? Max(n-1,Int(0)) : 0 );
+    ChaseBulges
+    ( b, band, reflectors.sweepBeg, reflectors.sweepEnd,
+      reflectors.chaseScalars, reflectors.chaseVectors );
+
+    for( Int j=0; j<n; ++j )
+    {
+        A(j,j) = RealPart(band(0,j));
+        for( Int d=1; d<=Min(b,n-1-j); ++d )
+        {
+            const F value = ( d == 1 ? F(RealPart(band(1,j))) : F(0) );
+            A(j+d,j) = value;
+            if( uplo == UPPER )
+                A(j,j+d) = value;
+        }
+    }
+}
+
+template<typename F>
+void Reduce
+( UpperOrLower uplo,
+  AbstractDistMatrix<F>& APre,
+  TwoStageReflectors<F>& reflectors,
+  Int bandwidth,
+  bool storeChase )
+{
+    EL_DEBUG_CSE
+    DistMatrixReadWriteProxy<F,F,MC,MR> AProx( APre );
+    auto& A = AProx.Get();
+    const Grid& g = A.Grid();
+    const Int n = A.Height();
+    const Int b = Bandwidth( n, bandwidth );
+    if( uplo == UPPER )
+        MakeHermitian( UPPER, A );
+
+    ReduceToBand( A, reflectors.householderScalars, b );
+
+    // Every process redundantly chases the bulges of the gathered band, but
+    // only stores the reflectors from its own range of sweeps
+    Matrix<F> band;
+    GetBand( A, b, band );
+    reflectors.bandwidth = b;
+    if( storeChase )
+        SweepRange
+        ( n, b, g.VCRank(), g.Size(),
+          reflectors.sweepBeg, reflectors.sweepEnd );
+    else
+        reflectors.sweepBeg = reflectors.sweepEnd = 0;
+    ChaseBulges
+    ( b, band, reflectors.sweepBeg, reflectors.sweepEnd,
+      reflectors.chaseScalars, reflectors.chaseVectors );
+
+    const Int localHeight = A.LocalHeight();
+    const Int localWidth = A.LocalWidth();
+    for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+    {
+        const Int j = A.GlobalCol(jLoc);
+        for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+        {
+            const Int i = A.GlobalRow(iLoc);
+            if( i == j )
+                A.SetLocal( iLoc, jLoc, RealPart(band(0,j)) );
+            else if( i == j+1 )
+                A.SetLocal( iLoc, jLoc, RealPart(band(1,j)) );
+            else if( i == j-1 && uplo == UPPER )
+                A.SetLocal( iLoc, jLoc, RealPart(band(1,i)) );
+            else if( i > j && i <= j+b )
+                A.SetLocal( iLoc, jLoc, F(0) );
+            else if( i < j && i >= j-b && uplo == UPPER )
+                A.SetLocal( iLoc, jLoc, F(0) );
+        }
+    }
+}
+
+} // namespace two_stage
+
+template<typename F>
+void TwoStage
+( UpperOrLower uplo,
+  Matrix<F>& A,
+  TwoStageReflectors<F>& reflectors,
+  Int bandwidth )
+{
+    EL_DEBUG_CSE
+    two_stage::Reduce( uplo, A, reflectors, bandwidth, true );
+}
+
+template<typename F>
+void TwoStage
+( UpperOrLower uplo,
+  AbstractDistMatrix<F>& A,
+  TwoStageReflectors<F>& reflectors,
+  Int bandwidth )
+{
+    EL_DEBUG_CSE
+    two_stage::Reduce( uplo, A, reflectors, bandwidth, true );
+}
+
+template<typename F>
+void ApplyTwoStageQ
+( const Matrix<F>& A,
+  const TwoStageReflectors<F>& reflectors,
+        Matrix<F>& B )
+{
+    EL_DEBUG_CSE
+    const Int n = A.Height();
+    const Int b = reflectors.bandwidth;
+    if( B.Height() != n )
+        LogicError("B must be the same height as A");
+    two_stage::ApplyChase
+    ( b, reflectors.sweepBeg, reflectors.sweepEnd,
+      reflectors.chaseScalars.data(), reflectors.chaseVectors.data(), B );
+    if( n > b )
+        ApplyPackedReflectors
+        ( LEFT, LOWER, VERTICAL, BACKWARD, CONJUGATED, -b,
+          A, reflectors.householderScalars, B );
+}
+
+template<typename F>
+void ApplyTwoStageQ
+( const AbstractDistMatrix<F>& A,
+  const TwoStageReflectors<F>& reflectors,
+        AbstractDistMatrix<F>& B )
+{
+    EL_DEBUG_CSE
+    const Int n = A.Height();
+    const Int b = reflectors.bandwidth;
+    if( B.Height() != n )
+        LogicError("B must be the same height as A");
+    const Grid& g = A.Grid();
+    mpi::Comm comm = g.VCComm();
+    const int commRank = mpi::Rank( comm );
+    const int commSize = mpi::Size( comm );
+
+    // Broadcast the chase reflectors of each process in turn, starting from
+    // the last range of sweeps, and apply them to the full columns of B
+    DistMatrix<F,STAR,VR> B_STAR_VR( B );
+    vector<F> chaseScalars, chaseVectors;
+    for( int q=commSize-1; q>=0; --q )
+    {
+        Int sweepBeg, sweepEnd;
+        two_stage::SweepRange( n, b, q, commSize, sweepBeg, sweepEnd );
+        if( sweepBeg == sweepEnd )
+            continue;
+        if( q == commRank )
+        {
+            chaseScalars = reflectors.chaseScalars;
+            chaseVectors = reflectors.chaseVectors;
+        }
+        else
+        {
+            Int numScalars, numEntries;
+            two_stage::ChaseSizes
+            ( n, b, sweepBeg, sweepEnd, numScalars, numEntries );
+            chaseScalars.resize( numScalars );
+            chaseVectors.resize( numEntries );
+        }
+        mpi::Broadcast( chaseScalars.data(), chaseScalars.size(), q, comm );
+        mpi::Broadcast( chaseVectors.data(), chaseVectors.size(), q, comm );
+        two_stage::ApplyChase
+        ( b, sweepBeg, sweepEnd, chaseScalars.data(), chaseVectors.data(),
+          B_STAR_VR.Matrix() );
+    }
+    Copy( B_STAR_VR, B );
+
+    if( n > b )
+    {
+        DistMatrix<F,STAR,STAR> householderScalars( g );
+        householderScalars.Resize( n-b, 1 );
+        householderScalars.Matrix() = reflectors.householderScalars;
+        ApplyPackedReflectors
+        ( LEFT, LOWER, VERTICAL, BACKWARD, CONJUGATED, -b,
+          A, householderScalars, B );
+    }
+}
+
+} // namespace herm_tridiag
+} // namespace El
+
+#endif // ifndef EL_HERMITIANTRIDIAG_TWOSTAGE_HPP
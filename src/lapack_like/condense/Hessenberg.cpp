@@ -12,6 +12,8 @@
 #include "./Hessenberg/UpperBlocked.hpp"
 #include "./Hessenberg/ApplyQ.hpp"
 #include "./Hessenberg/FormQ.hpp"
+#include "./HermitianTridiag/TwoStage.hpp"
+#include "./Hessenberg/TwoStage.hpp"
 
 namespace El {
 
@@ -22,6 +24,7 @@ void Hessenberg
   Matrix<F>& householderScalars )
 {
     EL_DEBUG_CSE
+    EL_PROFILE_REGION("Hessenberg");
     if( uplo == UPPER )
         hessenberg::UpperBlocked( A, householderScalars );
     else
@@ -35,6 +38,7 @@ void Hessenberg
   AbstractDistMatrix<F>& householderScalars )
 {
     EL_DEBUG_CSE
+    EL_PROFILE_REGION("Hessenberg");
     if( uplo == UPPER )
         hessenberg::UpperBlocked( A, householderScalars );
     else
@@ -101,6 +105,30 @@ void ExplicitCondensed( UpperOrLower uplo, AbstractDistMatrix<F>& A )
   ( UpperOrLower uplo, \
     const AbstractDistMatrix<F>& A, \
     const AbstractDistMatrix<F>& householderScalars, \
+          AbstractDistMatrix<F>& Q ); \
+  template void hessenberg::TwoStage \
+  ( Matrix<F>& A, \
+    hessenberg::TwoStageReflectors<F>& reflectors, \
+    Int bandwidth ); \
+  template void hessenberg::TwoStage \
+  ( AbstractDistMatrix<F>& A, \
+    hessenberg::TwoStageReflectors<F>& reflectors, \
+    Int bandwidth ); \
+  template void hessenberg::ApplyTwoStageQ \
+  ( const Matrix<F>& A, \
+    const hessenberg::TwoStageReflectors<F>& reflectors, \
+          Matrix<F>& B ); \
+  template void hessenberg::ApplyTwoStageQ \
+  ( const AbstractDistMatrix<F>& A, \
+    const hessenberg::TwoStageReflectors<F>& reflectors, \
+          AbstractDistMatrix<F>& B ); \
+  template void hessenberg::FormTwoStageQ \
+  ( const Matrix<F>& A, \
+    const hessenberg::TwoStageReflectors<F>& reflectors, \
+          Matrix<F>& Q ); \
+  template void hessenberg::FormTwoStageQ \
+  ( const AbstractDistMatrix<F>& A, \
+    const hessenberg::TwoStageReflectors<F>& reflectors, \
           AbstractDistMatrix<F>& Q );
 
 #define EL_NO_INT_PROTO
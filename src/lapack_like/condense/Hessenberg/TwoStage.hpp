@@ -0,0 +1,420 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_HESSENBERG_TWOSTAGE_HPP
+#define EL_HESSENBERG_TWOSTAGE_HPP
+
+// The two-stage reduction first reduces A to upper-Hessenberg form with b
+// subdiagonals (block Hessenberg) by QR decompositions of the column panels
+// below the band, whose two-sided applications are pure BLAS-3, and then
+// chases the bulges out of the band with sequences of small reflectors until
+// only the first subdiagonal remains. Since the upper triangle is dense, the
+// chase must also update every row above each bulge; the updates of the rows
+// above the current group of b sweeps are deferred to the end of the group
+// and applied in compact WY form.
+//
+// The reflectors are stored exactly as those of herm_tridiag::TwoStage, and
+// so the sweep bookkeeping and the back-transformation are shared with it.
+
+namespace El {
+namespace hessenberg {
+namespace two_stage {
+
+template<typename F>
+void ReduceToBand
+( Matrix<F>& A, Matrix<F>& householderScalars, Int bandwidth )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    const Int n = A.Height();
+    const Int b = bandwidth;
+    Zeros( householderScalars, Max(n-b,Int(0)), 1 );
+
+    Matrix<F> panelScalars, U, SInv, X, Y;
+    Matrix<Real> panelSignature;
+    for( Int k=0; k+b<n; k+=b )
+    {
+        const Int nb = Min(n-k-b,b);
+        const Range<Int> ind0( k, k+b ), ind1( k+b, n );
+
+        auto A10 = A( ind1, ind0 );
+        auto A11 = A( ind1, ind1 );
+        auto A1 = A( ALL, ind1 );
+
+        // Annihilate the panel below the band, absorbing the signature into
+        // the triangular factor
+        QR( A10, panelScalars, panelSignature );
+        auto A10T = A10( IR(0,nb), ALL );
+        DiagonalScaleTrapezoid( LEFT, UPPER, NORMAL, panelSignature, A10T );
+        auto scalars1 = householderScalars( IR(k,k+nb), ALL );
+        scalars1 = panelScalars;
+
+        U = A10( ALL, IR(0,nb) );
+        MakeTrapezoidal( LOWER, U );
+        FillDiagonal( U, F(1) );
+        Herk( UPPER, ADJOINT, Real(1), U, SInv );
+        for( Int t=0; t<nb; ++t )
+            SInv(t,t) = F(1) / Conj(panelScalars(t));
+
+        // A11 := (I - U inv(SInv)^H U^H) A11
+        Gemm( ADJOINT, NORMAL, F(1), U, A11, X );
+        Trsm( LEFT, UPPER, ADJOINT, NON_UNIT, F(1), SInv, X );
+        Gemm( NORMAL, NORMAL, F(-1), U, X, F(1), A11 );
+
+        // A1 := A1 (I - U inv(SInv) U^H)
+        Gemm( NORMAL, NORMAL, F(1), A1, U, Y );
+        Trsm( RIGHT, UPPER, NORMAL, NON_UNIT, F(1), SInv, Y );
+        Gemm( NORMAL, ADJOINT, F(-1), Y, U, F(1), A1 );
+    }
+}
+
+template<typename F>
+void ReduceToBand
+( DistMatrix<F>& A, Matrix<F>& householderScalars, Int bandwidth )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    const Grid& g = A.Grid();
+    const Int n = A.Height();
+    const Int b = bandwidth;
+    Zeros( householderScalars, Max(n-b,Int(0)), 1 );
+
+    DistMatrix<F,MD,STAR> panelScalars(g);
+    DistMatrix<Real,MD,STAR> panelSignature(g);
+    DistMatrix<F,STAR,STAR> panelScalars_STAR_STAR(g);
+    DistMatrix<F> U(g), X(g), Y(g);
+    DistMatrix<F,STAR,STAR> SInv(g);
+    for( Int k=0; k+b<n; k+=b )
+    {
+        const Int nb = Min(n-k-b,b);
+        const Range<Int> ind0( k, k+b ), ind1( k+b, n );
+
+        auto A10 = A( ind1, ind0 );
+        auto A11 = A( ind1, ind1 );
+        auto A1 = A( ALL, ind1 );
+
+        QR( A10, panelScalars, panelSignature );
+        auto A10T = A10( IR(0,nb), ALL );
+        DiagonalScaleTrapezoid( LEFT, UPPER, NORMAL, panelSignature, A10T );
+        panelScalars_STAR_STAR = panelScalars;
+        auto scalars1 = householderScalars( IR(k,k+nb), ALL );
+        scalars1 = panelScalars_STAR_STAR.Matrix();
+
+        U = A10( ALL, IR(0,nb) );
+        MakeTrapezoidal( LOWER, U );
+        FillDiagonal( U, F(1) );
+        Herk( UPPER, ADJOINT, Real(1), U, SInv );
+        for( Int t=0; t<nb; ++t )
+            SInv.SetLocal( t, t, F(1)/Conj(scalars1(t)) );
+
+        X.AlignWith( A11 );
+        Gemm( ADJOINT, NORMAL, F(1), U, A11, X );
+        Trsm( LEFT, UPPER, ADJOINT, NON_UNIT, F(1), SInv, X );
+        Gemm( NORMAL, NORMAL, F(-1), U, X, F(1), A11 );
+
+        Y.AlignWith( A1 );
+        Gemm( NORMAL, NORMAL, F(1), A1, U, Y );
+        Trsm( RIGHT, UPPER, NORMAL, NON_UNIT, F(1), SInv, Y );
+        Gemm( NORMAL, ADJOINT, F(-1), Y, U, F(1), A1 );
+    }
+}
+
+// ATop := ATop Q, where Q is the product of the reflectors generated by the
+// group of sweeps [j0,j1). Since the reflectors of a group with a larger
+// offset within their sweep commute with all earlier reflectors of smaller
+// offset from later sweeps, the product can be accumulated per offset.
+template<typename F>
+void ApplyGroupFromRight
+( Int n,
+  Int bandwidth,
+  Int j0,
+  Int j1,
+  const vector<F>& groupScalars,
+  const vector<F>& groupVectors,
+        Matrix<F>& ATop )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    const Int b = bandwidth;
+
+    vector<Int> scalarOffsets(j1-j0), entryOffsets(j1-j0);
+    Int scalarOff=0, entryOff=0;
+    for( Int j=j0; j<j1; ++j )
+    {
+        scalarOffsets[j-j0] = scalarOff;
+        entryOffsets[j-j0] = entryOff;
+        Int numScalars, numEntries;
+        herm_tridiag::two_stage::ChaseSizes
+        ( n, b, j, j+1, numScalars, numEntries );
+        scalarOff += numScalars;
+        entryOff += numEntries;
+    }
+
+    Matrix<F> V, SInv, Y;
+    for( Int s=(n-j0-2)/b; s>=0; --s )
+    {
+        const Int r0 = j0+1+s*b;
+        Int m = 0;
+        while( j0+m < j1 && r0+m < n )
+            ++m;
+        const Int height = Min(n,r0+m-1+b) - r0;
+
+        Zeros( V, height, m );
+        for( Int i=0; i<m; ++i )
+        {
+            const Int L = Min(b,n-(r0+i));
+            const F* vec = &groupVectors[entryOffsets[i]+s*(b-1)];
+            V(i,i) = F(1);
+            for( Int t=1; t<L; ++t )
+                V(i+t,i) = vec[t-1];
+        }
+        Herk( UPPER, ADJOINT, Real(1), V, SInv );
+        for( Int i=0; i<m; ++i )
+            SInv(i,i) = F(1) / Conj(groupScalars[scalarOffsets[i]+s]);
+
+        // A1 := A1 (I - V inv(SInv) V^H)
+        auto A1 = ATop( ALL, IR(r0,r0+height) );
+        Gemm( NORMAL, NORMAL, F(1), A1, V, Y );
+        Trsm( RIGHT, UPPER, NORMAL, NON_UNIT, F(1), SInv, Y );
+        Gemm( NORMAL, ADJOINT, F(-1), Y, V, F(1), A1 );
+    }
+}
+
+// Chase the bulges out of the upper-Hessenberg matrix H with b subdiagonals,
+// storing the reflectors of the sweeps [sweepBeg,sweepEnd), which must be a
+// union of groups of b consecutive sweeps. The bulges extend up to 2b below
+// the diagonal.
+template<typename F>
+void ChaseBulges
+( Int bandwidth,
+  Matrix<F>& H,
+  Int sweepBeg,
+  Int sweepEnd,
+  vector<F>& chaseScalars,
+  vector<F>& chaseVectors )
+{
+    EL_DEBUG_CSE
+    const Int n = H.Height();
+    const Int b = bandwidth;
+
+    Int numScalars, numEntries;
+    herm_tridiag::two_stage::ChaseSizes
+    ( n, b, sweepBeg, sweepEnd, numScalars, numEntries );
+    chaseScalars.resize( numScalars );
+    chaseVectors.resize( numEntries );
+    Int scalarOff=0, entryOff=0;
+
+    Matrix<F> v(b,1), z, w;
+    vector<F> groupScalars, groupVectors;
+    for( Int j0=0; j0<n-1; j0+=b )
+    {
+        const Int j1 = Min(j0+b,n-1);
+        groupScalars.resize( 0 );
+        groupVectors.resize( 0 );
+        for( Int j=j0; j<j1; ++j )
+        {
+            Int col=j, r=j+1, L=Min(b,n-r);
+            while( L > 0 )
+            {
+                // Annihilate entries r+1:r+L of column 'col'
+                auto vL = v( IR(0,L), ALL );
+                F chi = H(r,col);
+                vL(0) = F(1);
+                for( Int i=1; i<L; ++i )
+                    vL(i) = H(r+i,col);
+                const F tau = lapack::Reflector( L, chi, vL.Buffer()+1, 1 );
+
+                // Apply H from the left to rows r:r+L, where only the
+                // columns within 2b to the left of 'r' can hold bulges
+                auto HLeft = H( IR(r,r+L), IR(Max(Int(0),r-2*b),n) );
+                Gemv( ADJOINT, F(1), HLeft, vL, z );
+                Ger( -tau, vL, z, HLeft );
+                H(r,col) = chi;
+                for( Int i=1; i<L; ++i )
+                    H(r+i,col) = 0;
+
+                // Apply H^H from the right to the columns r:r+L of the rows
+                // which are not deferred to the end of the group
+                const Int iEnd = Min(n,r+L+2*b);
+                auto HRight = H( IR(j0+1,iEnd), IR(r,r+L) );
+                Gemv( NORMAL, F(1), HRight, vL, w );
+                Ger( -Conj(tau), w, vL, HRight );
+
+                groupScalars.push_back( tau );
+                for( Int i=1; i<L; ++i )
+                    groupVectors.push_back( vL(i) );
+
+                col = r;
+                r += L;
+                L = Min(b,n-r);
+            }
+        }
+
+        auto HTop = H( IR(0,j0+1), ALL );
+        ApplyGroupFromRight
+        ( n, b, j0, j1, groupScalars, groupVectors, HTop );
+
+        if( j0 >= sweepBeg && j0 < sweepEnd )
+        {
+            for( const F& tau : groupScalars )
+                chaseScalars[scalarOff++] = tau;
+            for( const F& nu : groupVectors )
+                chaseVectors[entryOff++] = nu;
+        }
+    }
+}
+
+template<typename F>
+void Reduce
+( Matrix<F>& A,
+  TwoStageReflectors<F>& reflectors,
+  Int bandwidth )
+{
+    EL_DEBUG_CSE
+    const Int n = A.Height();
+    const Int b = herm_tridiag::two_stage::Bandwidth( n, bandwidth );
+
+    ReduceToBand( A, reflectors.householderScalars, b );
+
+    // The bulges would overwrite the reflectors stored below the band, so
+    // the chase is performed on a copy of the band Hessenberg matrix
+    Matrix<F> H( A );
+    MakeTrapezoidal( UPPER, H, -b );
+    reflectors.bandwidth = b;
+    reflectors.sweepBeg = 0;
+    reflectors.sweepEnd = Max(n-1,Int(0));
+    ChaseBulges
+    ( b, H, reflectors.sweepBeg, reflectors.sweepEnd,
+      reflectors.chaseScalars, reflectors.chaseVectors );
+
+    for( Int j=0; j<n; ++j )
+    {
+        for( Int i=0; i<=Min(j+1,n-1); ++i )
+            A(i,j) = H(i,j);
+        for( Int i=j+2; i<=Min(j+b,n-1); ++i )
+            A(i,j) = 0;
+    }
+}
+
+template<typename F>
+void Reduce
+( AbstractDistMatrix<F>& APre,
+  TwoStageReflectors<F>& reflectors,
+  Int bandwidth )
+{
+    EL_DEBUG_CSE
+    DistMatrixReadWriteProxy<F,F,MC,MR> AProx( APre );
+    auto& A = AProx.Get();
+    const Grid& g = A.Grid();
+    const Int n = A.Height();
+    const Int b = herm_tridiag::two_stage::Bandwidth( n, bandwidth );
+
+    ReduceToBand( A, reflectors.householderScalars, b );
+
+    // Every process redundantly chases the bulges of a gathered copy of the
+    // band Hessenberg matrix, but only stores the reflectors from its own
+    // range of sweeps
+    DistMatrix<F,STAR,STAR> H( A );
+    auto& HLoc = H.Matrix();
+    MakeTrapezoidal( UPPER, HLoc, -b );
+    reflectors.bandwidth = b;
+    herm_tridiag::two_stage::SweepRange
+    ( n, b, g.VCRank(), g.Size(), reflectors.sweepBeg, reflectors.sweepEnd );
+    ChaseBulges
+    ( b, HLoc, reflectors.sweepBeg, reflectors.sweepEnd,
+      reflectors.chaseScalars, reflectors.chaseVectors );
+
+    const Int localHeight = A.LocalHeight();
+    const Int localWidth = A.LocalWidth();
+    for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+    {
+        const Int j = A.GlobalCol(jLoc);
+        for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+        {
+            const Int i = A.GlobalRow(iLoc);
+            if( i <= j+1 )
+                A.SetLocal( iLoc, jLoc, HLoc(i,j) );
+            else if( i <= j+b )
+                A.SetLocal( iLoc, jLoc, F(0) );
+        }
+    }
+}
+
+} // namespace two_stage
+
+template<typename F>
+void TwoStage
+( Matrix<F>& A,
+  TwoStageReflectors<F>& reflectors,
+  Int bandwidth )
+{
+    EL_DEBUG_CSE
+    if( A.Height() != A.Width() )
+        LogicError("A must be square");
+    two_stage::Reduce( A, reflectors, bandwidth );
+}
+
+template<typename F>
+void TwoStage
+( AbstractDistMatrix<F>& A,
+  TwoStageReflectors<F>& reflectors,
+  Int bandwidth )
+{
+    EL_DEBUG_CSE
+    if( A.Height() != A.Width() )
+        LogicError("A must be square");
+    two_stage::Reduce( A, reflectors, bandwidth );
+}
+
+template<typename F>
+void ApplyTwoStageQ
+( const Matrix<F>& A,
+  const TwoStageReflectors<F>& reflectors,
+        Matrix<F>& B )
+{
+    EL_DEBUG_CSE
+    herm_tridiag::ApplyTwoStageQ( A, reflectors, B );
+}
+
+template<typename F>
+void ApplyTwoStageQ
+( const AbstractDistMatrix<F>& A,
+  const TwoStageReflectors<F>& reflectors,
+        AbstractDistMatrix<F>& B )
+{
+    EL_DEBUG_CSE
+    herm_tridiag::ApplyTwoStageQ( A, reflectors, B );
+}
+
+template<typename F>
+void FormTwoStageQ
+( const Matrix<F>& A,
+  const TwoStageReflectors<F>& reflectors,
+        Matrix<F>& Q )
+{
+    EL_DEBUG_CSE
+    Identity( Q, A.Height(), A.Height() );
+    herm_tridiag::ApplyTwoStageQ( A, reflectors, Q );
+}
+
+template<typename F>
+void FormTwoStageQ
+( const AbstractDistMatrix<F>& A,
+  const TwoStageReflectors<F>& reflectors,
+        AbstractDistMatrix<F>& Q )
+{
+    EL_DEBUG_CSE
+    Q.SetGrid( A.Grid() );
+    Identity( Q, A.Height(), A.Height() );
+    herm_tridiag::ApplyTwoStageQ( A, reflectors, Q );
+}
+
+} // namespace hessenberg
+} // namespace El
+
+#endif // ifndef EL_HESSENBERG_TWOSTAGE_HPP
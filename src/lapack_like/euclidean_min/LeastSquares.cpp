@@ -152,24 +152,70 @@ void LeastSquares
 namespace ls {
 
 template<typename F>
-void Equilibrated
-( const SparseMatrix<F>& A,
-  const Matrix<F>& B,
-        Matrix<F>& X,
+void Equilibrate
+( Orientation orientation,
+  const SparseMatrix<F>& A,
+        SparseMatrix<F>& ABar,
+        Matrix<Base<F>>& dR,
+        Matrix<Base<F>>& dC,
   const LeastSquaresCtrl<Base<F>>& ctrl )
 {
     EL_DEBUG_CSE
-    EL_DEBUG_ONLY(
-      if( A.Height() != B.Height() )
-          LogicError("Heights of A and B must match");
-    )
+    typedef Base<F> Real;
+    if( orientation == NORMAL )
+        ABar = A;
+    else if( orientation == TRANSPOSE )
+        Transpose( A, ABar );
+    else
+        Adjoint( A, ABar );
+    const Int m = ABar.Height();
+    const Int n = ABar.Width();
 
+    if( ctrl.equilibrate )
+    {
+        auto normMap = []( const Real& beta )
+          { return beta < Sqrt(limits::Epsilon<Real>()) ? Real(1) : beta; };
+        if( m >= n )
+        {
+            ColumnTwoNorms( ABar, dC );
+            EntrywiseMap( dC, MakeFunction(normMap) );
+            DiagonalSolve( RIGHT, NORMAL, dC, ABar );
+            Ones( dR, m, 1 );
+        }
+        else
+        {
+            RowTwoNorms( ABar, dR );
+            EntrywiseMap( dR, MakeFunction(normMap) );
+            DiagonalSolve( LEFT, NORMAL, dR, ABar );
+            Ones( dC, n, 1 );
+        }
+    }
+    else
+    {
+        Ones( dR, m, 1 );
+        Ones( dC, n, 1 );
+    }
+    if( ctrl.scaleTwoNorm )
+    {
+        // Scale ABar down to roughly unit two-norm
+        const Real normScale = TwoNormEstimate( ABar, ctrl.basisSize );
+        if( ctrl.progress )
+            Output("Estimated || A ||_2 ~= ",normScale);
+        ABar *= F(1)/normScale;
+        dR *= normScale;
+    }
+}
+
+// J := [alpha*I,A;A^H,0] or [alpha*I,A^H;A,0]
+template<typename F>
+void FormAugmentedSystem
+( const SparseMatrix<F>& A, const Base<F>& alpha, SparseMatrix<F>& J )
+{
+    EL_DEBUG_CSE
     const Int m = A.Height();
     const Int n = A.Width();
-    const Int numRHS = B.Width();
     const Int numEntriesA = A.NumEntries();
 
-    SparseMatrix<F> J;
     Zeros( J, m+n, m+n );
     J.Reserve( 2*numEntriesA + Max(m,n) );
     if( m >= n )
@@ -182,7 +228,7 @@ void Equilibrated
             J.QueueUpdate( A.Col(e)+m, A.Row(e),   Conj(A.Value(e)) );
         }
         for( Int e=0; e<m; ++e )
-            J.QueueUpdate( e, e, ctrl.alpha );
+            J.QueueUpdate( e, e, alpha );
     }
     else
     {
@@ -194,46 +240,66 @@ void Equilibrated
             J.QueueUpdate( A.Row(e)+n, A.Col(e),        A.Value(e)  );
         }
         for( Int e=0; e<n; ++e )
-            J.QueueUpdate( e, e, ctrl.alpha );
+            J.QueueUpdate( e, e, alpha );
     }
     J.ProcessQueues();
+}
 
-    Matrix<F> D;
-    Zeros( D, m+n, numRHS );
+// D := [B; 0] or [0; B]
+template<typename F>
+void FormAugmentedRHS( Int m, Int n, const Matrix<F>& B, Matrix<F>& D )
+{
+    EL_DEBUG_CSE
+    Zeros( D, m+n, B.Width() );
     if( m >= n )
     {
-        // Form D = [B; 0]
-        // ==================
         auto DT = D( IR(0,m), ALL );
         DT = B;
     }
     else
     {
-        // Form D = [0; B]
-        // ===============
         auto DB = D( IR(n,m+n), ALL );
         DB = B;
     }
+}
+
+// Extract X from [R/alpha; X] or [X; alpha*Y]
+template<typename F>
+void ExtractSolution( Int m, Int n, const Matrix<F>& D, Matrix<F>& X )
+{
+    EL_DEBUG_CSE
+    if( m >= n )
+        X = D( IR(m,m+n), ALL );
+    else
+        X = D( IR(0,n), ALL );
+}
+
+template<typename F>
+void Equilibrated
+( const SparseMatrix<F>& A,
+  const Matrix<F>& B,
+        Matrix<F>& X,
+  const LeastSquaresCtrl<Base<F>>& ctrl )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( A.Height() != B.Height() )
+          LogicError("Heights of A and B must match");
+    )
+    const Int m = A.Height();
+    const Int n = A.Width();
+
+    SparseMatrix<F> J;
+    FormAugmentedSystem( A, ctrl.alpha, J );
+
+    Matrix<F> D;
+    FormAugmentedRHS( m, n, B, D );
 
     // Solve the Symmetric Quasi-SemiDefinite system
     // =============================================
     SQSDSolve( Max(m,n), J, D, ctrl.sqsdCtrl );
 
-    Zeros( X, n, numRHS );
-    if( m >= n )
-    {
-        // Extract X from [R/alpha; X]
-        // ===========================
-        auto DB = D( IR(m,m+n), ALL );
-        X = DB;
-    }
-    else
-    {
-        // Extract X from [X; alpha*Y]
-        // ===========================
-        auto DT = D( IR(0,n), ALL );
-        X = DT;
-    }
+    ExtractSolution( m, n, D, X );
 }
 
 } // namespace ls
@@ -249,20 +315,54 @@ void LeastSquares
     EL_DEBUG_CSE
     typedef Base<F> Real;
 
+    // Equilibrate the matrix
+    // ======================
     SparseMatrix<F> ABar;
+    Matrix<Real> dR, dC;
+    ls::Equilibrate( orientation, A, ABar, dR, dC, ctrl );
+
+    // Equilibrate the RHS
+    // ===================
+    auto BBar = B;
+    DiagonalSolve( LEFT, NORMAL, dR, BBar );
+
+    // Solve the equilibrated least squares problem
+    // ============================================
+    ls::Equilibrated( ABar, BBar, X, ctrl );
+
+    // Unequilibrate the solution
+    // ==========================
+    DiagonalSolve( LEFT, NORMAL, dC, X );
+}
+
+namespace ls {
+
+template<typename F>
+void Equilibrate
+( Orientation orientation,
+  const DistSparseMatrix<F>& A,
+        DistSparseMatrix<F>& ABar,
+        DistMultiVec<Base<F>>& dR,
+        DistMultiVec<Base<F>>& dC,
+  const LeastSquaresCtrl<Base<F>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    const Grid& grid = A.Grid();
+    const int commRank = grid.Rank();
+    ABar.SetGrid( grid );
+    dR.SetGrid( grid );
+    dC.SetGrid( grid );
+
     if( orientation == NORMAL )
         ABar = A;
     else if( orientation == TRANSPOSE )
         Transpose( A, ABar );
     else
         Adjoint( A, ABar );
-    auto BBar = B;
     const Int m = ABar.Height();
     const Int n = ABar.Width();
 
-    // Equilibrate the matrix
-    // ======================
-    Matrix<Real> dR, dC;
     if( ctrl.equilibrate )
     {
         auto normMap = []( const Real& beta )
@@ -291,26 +391,106 @@ void LeastSquares
     {
         // Scale ABar down to roughly unit two-norm
         const Real normScale = TwoNormEstimate( ABar, ctrl.basisSize );
-        if( ctrl.progress )
+        if( ctrl.progress && commRank == 0 )
             Output("Estimated || A ||_2 ~= ",normScale);
         ABar *= F(1)/normScale;
         dR *= normScale;
     }
+}
 
-    // Equilibrate the RHS
-    // ===================
-    DiagonalSolve( LEFT, NORMAL, dR, BBar );
+// J := [alpha*I,A;A^H,0] or [alpha*I,A^H;A,0]
+template<typename F>
+void FormAugmentedSystem
+( const DistSparseMatrix<F>& A,
+  const Base<F>& alpha,
+        DistSparseMatrix<F>& J )
+{
+    EL_DEBUG_CSE
+    const Int m = A.Height();
+    const Int n = A.Width();
 
-    // Solve the equilibrated least squares problem
-    // ============================================
-    ls::Equilibrated( ABar, BBar, X, ctrl );
+    J.SetGrid( A.Grid() );
+    Zeros( J, m+n, m+n );
+    const Int JLocalHeight = J.LocalHeight();
+    const Int numLocalEntriesA = A.NumLocalEntries();
+    Int numAlphaUpdates = 0;
+    for( Int iLoc=0; iLoc<JLocalHeight; ++iLoc )
+    {
+        const Int i = J.GlobalRow(iLoc);
+        if( i < Max(m,n) )
+            ++numAlphaUpdates;
+        else
+            break;
+    }
+    const Int numSend = 2*numLocalEntriesA;
+    J.Reserve( numSend+numAlphaUpdates, numSend );
+    for( Int e=0; e<numLocalEntriesA; ++e )
+    {
+        const Int i = A.Row(e);
+        const Int j = A.Col(e);
+        const F value = A.Value(e);
+        if( m >= n )
+        {
+            J.QueueUpdate( i, j+m, value );
+            J.QueueUpdate( j+m, i, Conj(value) );
+        }
+        else
+        {
+            J.QueueUpdate( i+n, j, value );
+            J.QueueUpdate( j, i+n, Conj(value) );
+        }
+    }
+    for( Int iLoc=0; iLoc<JLocalHeight; ++iLoc )
+    {
+        const Int i = J.GlobalRow(iLoc);
+        if( i < Max(m,n) )
+            J.QueueLocalUpdate( iLoc, i, alpha );
+        else
+            break;
+    }
+    J.ProcessQueues();
+}
 
-    // Unequilibrate the solution
-    // ==========================
-    DiagonalSolve( LEFT, NORMAL, dC, X );
+// D := [B; 0] or [0; B]
+template<typename F>
+void FormAugmentedRHS
+( Int m, Int n, const DistMultiVec<F>& B, DistMultiVec<F>& D )
+{
+    EL_DEBUG_CSE
+    const Int numRHS = B.Width();
+    D.SetGrid( B.Grid() );
+    Zeros( D, m+n, numRHS );
+    const Int BLocalHeight = B.LocalHeight();
+    const Int numSend = BLocalHeight*numRHS;
+    D.Reserve( numSend );
+    for( Int iLoc=0; iLoc<BLocalHeight; ++iLoc )
+    {
+        const Int i = B.GlobalRow(iLoc);
+        if( m >= n )
+        {
+            for( Int j=0; j<numRHS; ++j )
+                D.QueueUpdate( i, j, B.GetLocal(iLoc,j) );
+        }
+        else
+        {
+            for( Int j=0; j<numRHS; ++j )
+                D.QueueUpdate( i+n, j, B.GetLocal(iLoc,j) );
+        }
+    }
+    D.ProcessQueues();
 }
 
-namespace ls {
+// Extract X from [R/alpha; X] or [X; alpha*Y]
+template<typename F>
+void ExtractSolution
+( Int m, Int n, const DistMultiVec<F>& D, DistMultiVec<F>& X )
+{
+    EL_DEBUG_CSE
+    if( m >= n )
+        X = D( IR(m,m+n), ALL );
+    else
+        X = D( IR(0,n),   ALL );
+}
 
 template<typename F>
 void Equilibrated
@@ -325,91 +505,20 @@ void Equilibrated
           LogicError("Heights of A and B must match");
     )
     const Grid& grid = A.Grid();
-
     const Int m = A.Height();
     const Int n = A.Width();
-    const Int numRHS = B.Width();
 
-    // J := [alpha*I,A;A^H,0] or [alpha*I,A^H;A,0]
-    // ===========================================
     DistSparseMatrix<F> J(grid);
-    Zeros( J, m+n, m+n );
-    {
-        const Int JLocalHeight = J.LocalHeight();
-        const Int numLocalEntriesA = A.NumLocalEntries();
-        Int numAlphaUpdates = 0;
-        for( Int iLoc=0; iLoc<JLocalHeight; ++iLoc )
-        {
-            const Int i = J.GlobalRow(iLoc);
-            if( i < Max(m,n) )
-                ++numAlphaUpdates;
-            else
-                break;
-        }
-        const Int numSend = 2*numLocalEntriesA;
-        J.Reserve( numSend+numAlphaUpdates, numSend );
-        for( Int e=0; e<numLocalEntriesA; ++e )
-        {
-            const Int i = A.Row(e);
-            const Int j = A.Col(e);
-            const F value = A.Value(e);
-            if( m >= n )
-            {
-                J.QueueUpdate( i, j+m, value );
-                J.QueueUpdate( j+m, i, Conj(value) );
-            }
-            else
-            {
-                J.QueueUpdate( i+n, j, value );
-                J.QueueUpdate( j, i+n, Conj(value) );
-            }
-        }
-        for( Int iLoc=0; iLoc<JLocalHeight; ++iLoc )
-        {
-            const Int i = J.GlobalRow(iLoc);
-            if( i < Max(m,n) )
-                J.QueueLocalUpdate( iLoc, i, ctrl.alpha );
-            else
-                break;
-        }
-        J.ProcessQueues();
-    }
+    FormAugmentedSystem( A, ctrl.alpha, J );
 
-    // Set D to [B; 0] or [0; B]
-    // =========================
     DistMultiVec<F> D(grid);
-    Zeros( D, m+n, numRHS );
-    {
-        const Int BLocalHeight = B.LocalHeight();
-        const Int numSend = BLocalHeight*numRHS;
-        D.Reserve( numSend );
-        for( Int iLoc=0; iLoc<BLocalHeight; ++iLoc )
-        {
-            const Int i = B.GlobalRow(iLoc);
-            if( m >= n )
-            {
-                for( Int j=0; j<numRHS; ++j )
-                    D.QueueUpdate( i, j, B.GetLocal(iLoc,j) );
-            }
-            else
-            {
-                for( Int j=0; j<numRHS; ++j )
-                    D.QueueUpdate( i+n, j, B.GetLocal(iLoc,j) );
-            }
-        }
-        D.ProcessQueues();
-    }
+    FormAugmentedRHS( m, n, B, D );
 
     // Solve the Symmetric Quasi-SemiDefinite system
     // =============================================
     SQSDSolve( Max(m,n), J, D, ctrl.sqsdCtrl );
 
-    // Extract X from [R/alpha; X] or [X; alpha*Y] and then rescale
-    // ============================================================
-    if( m >= n )
-        X = D( IR(m,m+n), ALL );
-    else
-        X = D( IR(0,n),   ALL );
+    ExtractSolution( m, n, D, X );
 }
 
 } // namespace ls
@@ -425,67 +534,314 @@ void LeastSquares
     EL_DEBUG_CSE
     typedef Base<F> Real;
     const Grid& grid = A.Grid();
-    const int commRank = grid.Rank();
-
-    DistSparseMatrix<F> ABar(grid);
-    if( orientation == NORMAL )
-        ABar = A;
-    else if( orientation == TRANSPOSE )
-        Transpose( A, ABar );
-    else
-        Adjoint( A, ABar );
-    auto BBar = B;
-    const Int m = ABar.Height();
-    const Int n = ABar.Width();
 
     // Equilibrate the matrix
     // ======================
+    DistSparseMatrix<F> ABar(grid);
     DistMultiVec<Real> dR(grid), dC(grid);
-    if( ctrl.equilibrate )
+    ls::Equilibrate( orientation, A, ABar, dR, dC, ctrl );
+
+    // Equilibrate the RHS
+    // ===================
+    auto BBar = B;
+    DiagonalSolve( LEFT, NORMAL, dR, BBar );
+
+    // Solve the equilibrated least squares problem
+    // ============================================
+    ls::Equilibrated( ABar, BBar, X, ctrl );
+
+    // Unequilibrate the solution
+    // ==========================
+    DiagonalSolve( LEFT, NORMAL, dC, X );
+}
+
+template<typename F>
+SparseLeastSquaresSolver<F>::SparseLeastSquaresSolver
+( Orientation orientation,
+  const SparseMatrix<F>& A,
+  const LeastSquaresCtrl<Base<F>>& ctrl )
+{
+    EL_DEBUG_CSE
+    Initialize( orientation, A, ctrl );
+}
+
+template<typename F>
+void SparseLeastSquaresSolver<F>::Initialize
+( Orientation orientation,
+  const SparseMatrix<F>& A,
+  const LeastSquaresCtrl<Base<F>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    const SQSDCtrl<Real>& sqsdCtrl = ctrl.sqsdCtrl;
+    ctrl_ = ctrl;
+    initialized_ = false;
+    Timer timer;
+
+    // Form the (equilibrated and scaled) augmented system
+    // ===================================================
+    SparseMatrix<F> ABar;
+    ls::Equilibrate( orientation, A, ABar, dR_, dC_, ctrl );
+    m_ = ABar.Height();
+    n_ = ABar.Width();
+    ls::FormAugmentedSystem( ABar, ctrl.alpha, J_ );
+    sqsdScale_ = 1;
+    if( sqsdCtrl.scaleTwoNorm )
     {
-        auto normMap = []( const Real& beta )
-          { return beta < Sqrt(limits::Epsilon<Real>()) ? Real(1) : beta; };
-        if( m >= n )
+        sqsdScale_ = TwoNormEstimate( J_, sqsdCtrl.basisSize );
+        if( sqsdCtrl.progress )
+            Output("Estimated || J ||_2 ~= ",sqsdScale_);
+        J_ *= F(1)/sqsdScale_;
+    }
+
+    // Regularize as in SQSDSolve
+    // ==========================
+    const Int n0 = Max(m_,n_);
+    const Int nJ = m_ + n_;
+    Matrix<Real> regPerm;
+    regTmp_.Resize( nJ, 1 );
+    regPerm.Resize( nJ, 1 );
+    for( Int i=0; i<nJ; ++i )
+    {
+        if( i < n0 )
         {
-            ColumnTwoNorms( ABar, dC );
-            EntrywiseMap( dC, MakeFunction(normMap) );
-            DiagonalSolve( RIGHT, NORMAL, dC, ABar );
-            Ones( dR, m, 1 );
+            regTmp_(i) = sqsdCtrl.reg0Tmp*sqsdCtrl.reg0Tmp;
+            regPerm(i) = sqsdCtrl.reg0Perm*sqsdCtrl.reg0Perm;
         }
         else
         {
-            RowTwoNorms( ABar, dR );
-            EntrywiseMap( dR, MakeFunction(normMap) );
-            DiagonalSolve( LEFT, NORMAL, dR, ABar );
-            Ones( dC, n, 1 );
+            regTmp_(i) = -sqsdCtrl.reg1Tmp*sqsdCtrl.reg1Tmp;
+            regPerm(i) = -sqsdCtrl.reg1Perm*sqsdCtrl.reg1Perm;
         }
     }
-    else
+    UpdateRealPartOfDiagonal( J_, Real(1), regPerm );
+    auto JMod( J_ );
+    UpdateRealPartOfDiagonal( JMod, Real(1), regTmp_, 0, true );
+
+    // Analyze the sparsity pattern and initialize the frontal tree
+    // ============================================================
+    if( sqsdCtrl.time )
+        timer.Start();
+    const bool hermitian = true;
+    const BisectCtrl bisectCtrl;
+    sparseLDLFact_.Initialize( JMod, hermitian, bisectCtrl );
+    if( sqsdCtrl.time )
+        Output("  Analysis: ",timer.Stop()," secs");
+
+    // Factor the sparse system
+    // ========================
+    if( sqsdCtrl.time )
+        timer.Start();
+    sparseLDLFact_.Factor();
+    if( sqsdCtrl.time )
+        Output("  LDL: ",timer.Stop()," secs");
+
+    initialized_ = true;
+}
+
+template<typename F>
+void SparseLeastSquaresSolver<F>::SetAlpha( const Base<F>& alpha )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    if( !initialized_ )
+        LogicError("Initialize must be called before SetAlpha");
+    Timer timer;
+
+    // Only the leading diagonal of J (which already exists) is modified, and
+    // so the analysis (and the sparsity pattern of the fronts) is reused
+    Matrix<Real> ones;
+    Ones( ones, Max(m_,n_), 1 );
+    UpdateRealPartOfDiagonal
+    ( J_, (alpha-ctrl_.alpha)/sqsdScale_, ones, 0, true );
+    ctrl_.alpha = alpha;
+    auto JMod( J_ );
+    UpdateRealPartOfDiagonal( JMod, Real(1), regTmp_, 0, true );
+
+    if( ctrl_.sqsdCtrl.time )
+        timer.Start();
+    sparseLDLFact_.ChangeNonzeroValues( JMod );
+    sparseLDLFact_.Factor();
+    if( ctrl_.sqsdCtrl.time )
+        Output("  LDL: ",timer.Stop()," secs");
+}
+
+template<typename F>
+void SparseLeastSquaresSolver<F>::Solve
+( const Matrix<F>& B, Matrix<F>& X ) const
+{
+    EL_DEBUG_CSE
+    if( !initialized_ )
+        LogicError("Initialize must be called before Solve");
+    if( B.Height() != m_ )
+        LogicError
+        ("B was ",B.Height()," x ",B.Width()," but op(A) was ",m_," x ",n_);
+    Timer timer;
+
+    auto BBar = B;
+    DiagonalSolve( LEFT, NORMAL, dR_, BBar );
+    Matrix<F> D;
+    ls::FormAugmentedRHS( m_, n_, BBar, D );
+    if( ctrl_.sqsdCtrl.scaleTwoNorm )
+        D *= F(1)/sqsdScale_;
+
+    if( ctrl_.sqsdCtrl.time )
+        timer.Start();
+    reg_ldl::SolveAfter
+    ( J_, regTmp_, sparseLDLFact_, D, ctrl_.sqsdCtrl.solveCtrl );
+    if( ctrl_.sqsdCtrl.time )
+        Output("  Solve: ",timer.Stop()," secs");
+
+    ls::ExtractSolution( m_, n_, D, X );
+    DiagonalSolve( LEFT, NORMAL, dC_, X );
+}
+
+template<typename F>
+DistSparseLeastSquaresSolver<F>::DistSparseLeastSquaresSolver
+( Orientation orientation,
+  const DistSparseMatrix<F>& A,
+  const LeastSquaresCtrl<Base<F>>& ctrl )
+{
+    EL_DEBUG_CSE
+    Initialize( orientation, A, ctrl );
+}
+
+template<typename F>
+void DistSparseLeastSquaresSolver<F>::Initialize
+( Orientation orientation,
+  const DistSparseMatrix<F>& A,
+  const LeastSquaresCtrl<Base<F>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    const SQSDCtrl<Real>& sqsdCtrl = ctrl.sqsdCtrl;
+    const Grid& grid = A.Grid();
+    const int commRank = grid.Rank();
+    ctrl_ = ctrl;
+    initialized_ = false;
+    Timer timer;
+
+    // Form the (equilibrated and scaled) augmented system
+    // ===================================================
+    DistSparseMatrix<F> ABar(grid);
+    ls::Equilibrate( orientation, A, ABar, dR_, dC_, ctrl );
+    m_ = ABar.Height();
+    n_ = ABar.Width();
+    ls::FormAugmentedSystem( ABar, ctrl.alpha, J_ );
+    sqsdScale_ = 1;
+    if( sqsdCtrl.scaleTwoNorm )
     {
-        Ones( dR, m, 1 );
-        Ones( dC, n, 1 );
+        sqsdScale_ = TwoNormEstimate( J_, sqsdCtrl.basisSize );
+        if( sqsdCtrl.progress && commRank == 0 )
+            Output("Estimated || J ||_2 ~= ",sqsdScale_);
+        J_ *= F(1)/sqsdScale_;
     }
-    if( ctrl.scaleTwoNorm )
+
+    // Regularize as in SQSDSolve
+    // ==========================
+    const Int n0 = Max(m_,n_);
+    const Int nJ = m_ + n_;
+    const Real scaledReg0Tmp =  sqsdCtrl.reg0Tmp*sqsdCtrl.reg0Tmp;
+    const Real scaledReg1Tmp = -sqsdCtrl.reg1Tmp*sqsdCtrl.reg1Tmp;
+    const Real scaledReg0Perm =  sqsdCtrl.reg0Perm*sqsdCtrl.reg0Perm;
+    const Real scaledReg1Perm = -sqsdCtrl.reg1Perm*sqsdCtrl.reg1Perm;
+    DistMultiVec<Real> regPerm(grid);
+    regTmp_.SetGrid( grid );
+    regTmp_.Resize( nJ, 1 );
+    regPerm.Resize( nJ, 1 );
+    for( Int iLoc=0; iLoc<regTmp_.LocalHeight(); ++iLoc )
     {
-        // Scale ABar down to roughly unit two-norm
-        const Real normScale = TwoNormEstimate( ABar, ctrl.basisSize );
-        if( ctrl.progress && commRank == 0 )
-            Output("Estimated || A ||_2 ~= ",normScale);
-        ABar *= F(1)/normScale;
-        dR *= normScale;
+        const Int i = regTmp_.GlobalRow(iLoc);
+        regTmp_.Set( i, 0, i < n0 ? scaledReg0Tmp : scaledReg1Tmp );
+        regPerm.Set( i, 0, i < n0 ? scaledReg0Perm : scaledReg1Perm );
     }
+    UpdateRealPartOfDiagonal( J_, Real(1), regPerm );
+    auto JMod( J_ );
+    UpdateRealPartOfDiagonal( JMod, Real(1), regTmp_, 0, true );
 
-    // Equilibrate the RHS
-    // ===================
-    DiagonalSolve( LEFT, NORMAL, dR, BBar );
+    // Analyze the sparsity pattern and initialize the frontal tree
+    // ============================================================
+    if( commRank == 0 && sqsdCtrl.time )
+        timer.Start();
+    const bool hermitian = true;
+    const BisectCtrl bisectCtrl;
+    sparseLDLFact_.Initialize( JMod, hermitian, bisectCtrl );
+    if( commRank == 0 && sqsdCtrl.time )
+        Output("  Analysis: ",timer.Stop()," secs");
+
+    // Factor the sparse system
+    // ========================
+    if( commRank == 0 && sqsdCtrl.time )
+        timer.Start();
+    sparseLDLFact_.Factor( LDL_2D );
+    if( commRank == 0 && sqsdCtrl.time )
+        Output("  LDL: ",timer.Stop()," secs");
+
+    initialized_ = true;
+}
 
-    // Solve the equilibrated least squares problem
-    // ============================================
-    ls::Equilibrated( ABar, BBar, X, ctrl );
+template<typename F>
+void DistSparseLeastSquaresSolver<F>::SetAlpha( const Base<F>& alpha )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    if( !initialized_ )
+        LogicError("Initialize must be called before SetAlpha");
+    const Grid& grid = J_.Grid();
+    const int commRank = grid.Rank();
+    const Int n0 = Max(m_,n_);
+    Timer timer;
+
+    // Only the leading diagonal of J (which already exists) is modified, and
+    // so the analysis (and the sparsity pattern of the fronts) is reused
+    DistMultiVec<Real> leadingOnes(grid);
+    Zeros( leadingOnes, m_+n_, 1 );
+    for( Int iLoc=0; iLoc<leadingOnes.LocalHeight(); ++iLoc )
+        if( leadingOnes.GlobalRow(iLoc) < n0 )
+            leadingOnes.SetLocal( iLoc, 0, Real(1) );
+    UpdateRealPartOfDiagonal
+    ( J_, (alpha-ctrl_.alpha)/sqsdScale_, leadingOnes, 0, true );
+    ctrl_.alpha = alpha;
+    auto JMod( J_ );
+    UpdateRealPartOfDiagonal( JMod, Real(1), regTmp_, 0, true );
+
+    if( commRank == 0 && ctrl_.sqsdCtrl.time )
+        timer.Start();
+    sparseLDLFact_.Refactor( JMod, LDL_2D );
+    if( commRank == 0 && ctrl_.sqsdCtrl.time )
+        Output("  LDL: ",timer.Stop()," secs");
+}
 
-    // Unequilibrate the solution
-    // ==========================
-    DiagonalSolve( LEFT, NORMAL, dC, X );
+template<typename F>
+void DistSparseLeastSquaresSolver<F>::Solve
+( const DistMultiVec<F>& B, DistMultiVec<F>& X ) const
+{
+    EL_DEBUG_CSE
+    if( !initialized_ )
+        LogicError("Initialize must be called before Solve");
+    if( B.Height() != m_ )
+        LogicError
+        ("B was ",B.Height()," x ",B.Width()," but op(A) was ",m_," x ",n_);
+    const Grid& grid = J_.Grid();
+    const int commRank = grid.Rank();
+    Timer timer;
+
+    auto BBar = B;
+    DiagonalSolve( LEFT, NORMAL, dR_, BBar );
+    DistMultiVec<F> D(grid);
+    ls::FormAugmentedRHS( m_, n_, BBar, D );
+    if( ctrl_.sqsdCtrl.scaleTwoNorm )
+        D *= F(1)/sqsdScale_;
+
+    if( commRank == 0 && ctrl_.sqsdCtrl.time )
+        timer.Start();
+    reg_ldl::SolveAfter
+    ( J_, regTmp_, sparseLDLFact_, D, ctrl_.sqsdCtrl.solveCtrl );
+    if( commRank == 0 && ctrl_.sqsdCtrl.time )
+        Output("  Solve: ",timer.Stop()," secs");
+
+    ls::ExtractSolution( m_, n_, D, X );
+    DiagonalSolve( LEFT, NORMAL, dC_, X );
 }
 
 #define PROTO(F) \
@@ -520,7 +876,9 @@ void LeastSquares
     const DistSparseMatrix<F>& A, \
     const DistMultiVec<F>& B, \
           DistMultiVec<F>& X, \
-    const LeastSquaresCtrl<Base<F>>& ctrl );
+    const LeastSquaresCtrl<Base<F>>& ctrl ); \
+  template class SparseLeastSquaresSolver<F>; \
+  template class DistSparseLeastSquaresSolver<F>;
 
 #define EL_NO_INT_PROTO
 #define EL_ENABLE_DOUBLEDOUBLE
@@ -0,0 +1,120 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+#include "../funcs/Pseudoinverse/SVD.hpp"
+#include "../funcs/Pseudoinverse/CompleteOrthogonal.hpp"
+
+namespace El {
+
+template<typename Field>
+Int MinimumNormLeastSquares
+( Orientation orientation,
+  const Matrix<Field>& A,
+  const Matrix<Field>& B,
+        Matrix<Field>& X,
+  const PseudoinverseCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    Matrix<Field> AOp;
+    if( orientation == NORMAL )
+        AOp = A;
+    else
+        Transpose( A, AOp, orientation == ADJOINT );
+    if( AOp.Height() != B.Height() )
+        LogicError
+        ("op(A) was ",AOp.Height()," x ",AOp.Width()," but B was ",
+         B.Height()," x ",B.Width());
+
+    if( ctrl.approach == PSEUDOINVERSE_SVD )
+    {
+        // X := V inv(Sigma) U^H B
+        Matrix<Real> s;
+        Matrix<Field> U, V, C;
+        pinv::TruncatedSVD( AOp, ctrl.tol, U, s, V );
+        Gemm( ADJOINT, NORMAL, Field(1), U, B, C );
+        DiagonalSolve( LEFT, NORMAL, s, C );
+        Gemm( NORMAL, NORMAL, Field(1), V, C, X );
+        return s.Height();
+    }
+    else
+    {
+        pinv::CompleteOrthogonal<Field> cod;
+        pinv::Factor( AOp, ctrl.tol, cod );
+        pinv::Solve( cod, B, X );
+        return cod.rank;
+    }
+}
+
+template<typename Field>
+Int MinimumNormLeastSquares
+( Orientation orientation,
+  const AbstractDistMatrix<Field>& A,
+  const AbstractDistMatrix<Field>& B,
+        AbstractDistMatrix<Field>& XPre,
+  const PseudoinverseCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Grid& g = A.Grid();
+    DistMatrix<Field> AOp(g);
+    if( orientation == NORMAL )
+        Copy( A, AOp );
+    else
+        Transpose( A, AOp, orientation == ADJOINT );
+    if( AOp.Height() != B.Height() )
+        LogicError
+        ("op(A) was ",AOp.Height()," x ",AOp.Width()," but B was ",
+         B.Height()," x ",B.Width());
+
+    DistMatrixWriteProxy<Field,Field,MC,MR> XProx( XPre );
+    auto& X = XProx.Get();
+
+    if( ctrl.approach == PSEUDOINVERSE_SVD )
+    {
+        DistMatrix<Real,VR,STAR> s(g);
+        DistMatrix<Field> U(g), V(g), C(g);
+        pinv::TruncatedSVD( AOp, ctrl.tol, U, s, V );
+        Gemm( ADJOINT, NORMAL, Field(1), U, B, C );
+        DiagonalSolve( LEFT, NORMAL, s, C );
+        Gemm( NORMAL, NORMAL, Field(1), V, C, X );
+        return s.Height();
+    }
+    else
+    {
+        pinv::DistCompleteOrthogonal<Field> cod(g);
+        pinv::Factor( AOp, ctrl.tol, cod );
+        pinv::Solve( cod, B, X );
+        return cod.rank;
+    }
+}
+
+#define PROTO(Field) \
+  template Int MinimumNormLeastSquares \
+  ( Orientation orientation, \
+    const Matrix<Field>& A, \
+    const Matrix<Field>& B, \
+          Matrix<Field>& X, \
+    const PseudoinverseCtrl<Base<Field>>& ctrl ); \
+  template Int MinimumNormLeastSquares \
+  ( Orientation orientation, \
+    const AbstractDistMatrix<Field>& A, \
+    const AbstractDistMatrix<Field>& B, \
+          AbstractDistMatrix<Field>& X, \
+    const PseudoinverseCtrl<Base<Field>>& ctrl );
+
+#define EL_NO_INT_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
@@ -8,6 +8,8 @@
 */
 #include <El.hpp>
 
+#include "./Ridge/Lanczos.hpp"
+
 namespace El {
 
 template<typename Field>
@@ -242,6 +244,233 @@ void Ridge
     Tikhonov( orientation, A, B, G, X, ctrl );
 }
 
+template<typename Field>
+void Ridge
+( Orientation orientation,
+  const Matrix<Field>& A,
+  const Matrix<Field>& B,
+  const Matrix<Base<Field>>& gammas,
+        Matrix<Field>& X )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    if( orientation == TRANSPOSE && IsComplex<Field>::value )
+        LogicError("Transpose version of complex Ridge not yet supported");
+    const Int numRHS = B.Width();
+    const Int numGammas = gammas.Height();
+
+    // op(A) = U diag(s) V^H
+    Matrix<Field> U, V;
+    Matrix<Real> s;
+    if( orientation == NORMAL )
+    {
+        SVDCtrl<Real> ctrl;
+        ctrl.overwrite = false;
+        SVD( A, U, s, V, ctrl );
+    }
+    else
+    {
+        Matrix<Field> AAdj;
+        Adjoint( A, AAdj );
+
+        SVDCtrl<Real> ctrl;
+        ctrl.overwrite = true;
+        SVD( AAdj, U, s, V, ctrl );
+    }
+    const Int r = s.Height();
+
+    // The projection U^H B is shared by every gamma
+    Matrix<Field> UAdjB;
+    Gemm( ADJOINT, NORMAL, Field(1), U, B, UAdjB );
+
+    // Y_k := diag(s / (s^2 + gamma_k^2)) U^H B
+    Matrix<Field> Y;
+    Matrix<Real> d;
+    Y.Resize( r, numRHS*numGammas );
+    d.Resize( r, 1 );
+    for( Int k=0; k<numGammas; ++k )
+    {
+        const Real gammaSquared = gammas(k)*gammas(k);
+        for( Int i=0; i<r; ++i )
+        {
+            const Real denom = s(i)*s(i) + gammaSquared;
+            d(i) = ( denom == Real(0) ? Real(0) : s(i)/denom );
+        }
+        auto Yk = Y( ALL, IR(k*numRHS,(k+1)*numRHS) );
+        Yk = UAdjB;
+        DiagonalScale( LEFT, NORMAL, d, Yk );
+    }
+
+    // X := V [Y_0, ..., Y_{numGammas-1}]
+    Gemm( NORMAL, NORMAL, Field(1), V, Y, X );
+}
+
+template<typename Field>
+void Ridge
+( Orientation orientation,
+  const AbstractDistMatrix<Field>& APre,
+  const AbstractDistMatrix<Field>& BPre,
+  const AbstractDistMatrix<Base<Field>>& gammasPre,
+        AbstractDistMatrix<Field>& XPre )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+
+    DistMatrixReadProxy<Field,Field,MC,MR>
+      AProx( APre ),
+      BProx( BPre );
+    DistMatrixReadProxy<Real,Real,STAR,STAR> gammasProx( gammasPre );
+    DistMatrixWriteProxy<Field,Field,MC,MR>
+      XProx( XPre );
+    auto& A = AProx.GetLocked();
+    auto& B = BProx.GetLocked();
+    auto& gammas = gammasProx.GetLocked();
+    auto& X = XProx.Get();
+    const Grid& grid = A.Grid();
+
+    if( orientation == TRANSPOSE && IsComplex<Field>::value )
+        LogicError("Transpose version of complex Ridge not yet supported");
+    const Int numRHS = B.Width();
+    const Int numGammas = gammas.Height();
+
+    // op(A) = U diag(s) V^H
+    DistMatrix<Field> U(grid), V(grid);
+    DistMatrix<Real,VR,STAR> s(grid);
+    if( orientation == NORMAL )
+    {
+        SVDCtrl<Real> ctrl;
+        ctrl.overwrite = false;
+        SVD( A, U, s, V, ctrl );
+    }
+    else
+    {
+        DistMatrix<Field> AAdj(grid);
+        Adjoint( A, AAdj );
+
+        SVDCtrl<Real> ctrl;
+        ctrl.overwrite = true;
+        SVD( AAdj, U, s, V, ctrl );
+    }
+    const Int r = s.Height();
+
+    // The projection U^H B is shared by every gamma
+    DistMatrix<Field> UAdjB(grid);
+    Gemm( ADJOINT, NORMAL, Field(1), U, B, UAdjB );
+
+    // Y_k := diag(s / (s^2 + gamma_k^2)) U^H B
+    DistMatrix<Field> Y(grid);
+    DistMatrix<Real,VR,STAR> d(grid);
+    Y.Resize( r, numRHS*numGammas );
+    d.AlignWith( s );
+    d.Resize( r, 1 );
+    const auto& sLoc = s.LockedMatrix();
+    auto& dLoc = d.Matrix();
+    for( Int k=0; k<numGammas; ++k )
+    {
+        const Real gammaSquared = gammas.GetLocal(k,0)*gammas.GetLocal(k,0);
+        for( Int iLoc=0; iLoc<d.LocalHeight(); ++iLoc )
+        {
+            const Real sigma = sLoc(iLoc);
+            const Real denom = sigma*sigma + gammaSquared;
+            dLoc(iLoc) = ( denom == Real(0) ? Real(0) : sigma/denom );
+        }
+        auto Yk = Y( ALL, IR(k*numRHS,(k+1)*numRHS) );
+        Yk = UAdjB;
+        DiagonalScale( LEFT, NORMAL, d, Yk );
+    }
+
+    // X := V [Y_0, ..., Y_{numGammas-1}]
+    Gemm( NORMAL, NORMAL, Field(1), V, Y, X );
+}
+
+template<typename Field>
+void Ridge
+( Orientation orientation,
+  const SparseMatrix<Field>& A,
+  const Matrix<Field>& B,
+  const Matrix<Base<Field>>& gammas,
+        Matrix<Field>& X,
+  const RidgeLanczosCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    const Int numRHS = B.Width();
+    const Int numGammas = gammas.Height();
+
+    SparseMatrix<Field> W, WAdj;
+    if( orientation == NORMAL )
+        W = A;
+    else if( orientation == TRANSPOSE )
+        Transpose( A, W );
+    else
+        Adjoint( A, W );
+    Adjoint( W, WAdj );
+    if( W.Height() != B.Height() )
+        LogicError("Heights of op(A) and B must match");
+    const Int n = W.Width();
+
+    Zeros( X, n, numRHS*numGammas );
+    Matrix<Field> Xj;
+    for( Int j=0; j<numRHS; ++j )
+    {
+        const Int numSteps =
+          ridge::LanczosSolve( W, WAdj, B(ALL,IR(j)), gammas, Xj, ctrl );
+        if( ctrl.progress )
+            Output("Right-hand side ",j,": ",numSteps," Lanczos steps");
+        for( Int k=0; k<numGammas; ++k )
+        {
+            auto xjk = X( ALL, IR(k*numRHS+j) );
+            xjk = Xj( ALL, IR(k) );
+        }
+    }
+}
+
+template<typename Field>
+void Ridge
+( Orientation orientation,
+  const DistSparseMatrix<Field>& A,
+  const DistMultiVec<Field>& B,
+  const Matrix<Base<Field>>& gammas,
+        DistMultiVec<Field>& X,
+  const RidgeLanczosCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    const Grid& grid = A.Grid();
+    const int commRank = grid.Rank();
+    const Int numRHS = B.Width();
+    const Int numGammas = gammas.Height();
+
+    DistSparseMatrix<Field> W(grid), WAdj(grid);
+    if( orientation == NORMAL )
+        W = A;
+    else if( orientation == TRANSPOSE )
+        Transpose( A, W );
+    else
+        Adjoint( A, W );
+    Adjoint( W, WAdj );
+    if( W.Height() != B.Height() )
+        LogicError("Heights of op(A) and B must match");
+    const Int n = W.Width();
+
+    X.SetGrid( grid );
+    Zeros( X, n, numRHS*numGammas );
+    auto& XLoc = X.Matrix();
+    DistMultiVec<Field> b(grid), Xj(grid);
+    for( Int j=0; j<numRHS; ++j )
+    {
+        b = B( ALL, IR(j) );
+        const Int numSteps =
+          ridge::LanczosSolve( W, WAdj, b, gammas, Xj, ctrl );
+        if( ctrl.progress && commRank == 0 )
+            Output("Right-hand side ",j,": ",numSteps," Lanczos steps");
+        const auto& XjLoc = Xj.LockedMatrix();
+        for( Int k=0; k<numGammas; ++k )
+        {
+            auto xjkLoc = XLoc( ALL, IR(k*numRHS+j) );
+            xjkLoc = XjLoc( ALL, IR(k) );
+        }
+    }
+}
+
 #define PROTO(Field) \
   template void Ridge \
   ( Orientation orientation, \
@@ -270,7 +499,33 @@ void Ridge
     const DistMultiVec<Field>& B, \
           Base<Field> gamma, \
           DistMultiVec<Field>& X, \
-    const LeastSquaresCtrl<Base<Field>>& ctrl );
+    const LeastSquaresCtrl<Base<Field>>& ctrl ); \
+  template void Ridge \
+  ( Orientation orientation, \
+    const Matrix<Field>& A, \
+    const Matrix<Field>& B, \
+    const Matrix<Base<Field>>& gammas, \
+          Matrix<Field>& X ); \
+  template void Ridge \
+  ( Orientation orientation, \
+    const AbstractDistMatrix<Field>& A, \
+    const AbstractDistMatrix<Field>& B, \
+    const AbstractDistMatrix<Base<Field>>& gammas, \
+          AbstractDistMatrix<Field>& X ); \
+  template void Ridge \
+  ( Orientation orientation, \
+    const SparseMatrix<Field>& A, \
+    const Matrix<Field>& B, \
+    const Matrix<Base<Field>>& gammas, \
+          Matrix<Field>& X, \
+    const RidgeLanczosCtrl<Base<Field>>& ctrl ); \
+  template void Ridge \
+  ( Orientation orientation, \
+    const DistSparseMatrix<Field>& A, \
+    const DistMultiVec<Field>& B, \
+    const Matrix<Base<Field>>& gammas, \
+          DistMultiVec<Field>& X, \
+    const RidgeLanczosCtrl<Base<Field>>& ctrl );
 
 #define EL_NO_INT_PROTO
 #define EL_ENABLE_DOUBLEDOUBLE
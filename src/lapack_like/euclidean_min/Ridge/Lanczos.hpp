@@ -0,0 +1,293 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_RIDGE_LANCZOS_HPP
+#define EL_RIDGE_LANCZOS_HPP
+
+namespace El {
+namespace ridge {
+
+// Given the diagonal, 'alpha', and subdiagonal, 'beta', of the
+// (k+1) x k lower bidiagonal matrix T from a Golub-Kahan-Lanczos
+// bidiagonalization started from b, fill the columns of the k x numGammas
+// matrix Y with the minimizers of
+//
+//   || T y - || b ||_2 e_0 ||_2^2 + gamma^2 || y ||_2^2.
+//
+// With the (thin) SVD T = P Sigma Q^H, y(gamma) is
+// Q (Sigma^2 + gamma^2 I)^{-1} Sigma P^H ( || b ||_2 e_0 ).
+template<typename Field>
+void ProjectedSolutions
+( const vector<Base<Field>>& alpha,
+  const vector<Base<Field>>& beta,
+  const Base<Field>& bNorm,
+  const Matrix<Base<Field>>& gammas,
+        Matrix<Field>& Y )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Int k = alpha.size();
+    const Int numGammas = gammas.Height();
+
+    Matrix<Real> T;
+    Zeros( T, k+1, k );
+    for( Int i=0; i<k; ++i )
+    {
+        T(i,i) = alpha[i];
+        T(i+1,i) = beta[i];
+    }
+    Matrix<Real> P, sigma, Q;
+    SVD( T, P, sigma, Q );
+    const Int r = sigma.Height();
+
+    // c := Sigma P^H ( || b ||_2 e_0 )
+    Matrix<Real> c, d, y;
+    c.Resize( r, 1 );
+    for( Int i=0; i<r; ++i )
+        c(i) = sigma(i)*P(0,i)*bNorm;
+
+    Y.Resize( k, numGammas );
+    d.Resize( r, 1 );
+    for( Int g=0; g<numGammas; ++g )
+    {
+        const Real gammaSquared = gammas(g)*gammas(g);
+        for( Int i=0; i<r; ++i )
+        {
+            const Real denom = sigma(i)*sigma(i) + gammaSquared;
+            d(i) = ( denom == Real(0) ? Real(0) : c(i)/denom );
+        }
+        Gemv( NORMAL, Real(1), Q, d, y );
+        for( Int i=0; i<k; ++i )
+            Y(i,g) = y(i);
+    }
+}
+
+// w := w - V V^H w, repeated once ("twice is enough")
+template<typename Field>
+void Reorthogonalize( const Matrix<Field>& V, Matrix<Field>& w )
+{
+    EL_DEBUG_CSE
+    Matrix<Field> h;
+    for( Int pass=0; pass<2; ++pass )
+    {
+        Gemv( ADJOINT, Field(1), V, w, h );
+        Gemv( NORMAL, Field(-1), V, h, Field(1), w );
+    }
+}
+
+// The distributed analogue, where VLoc and wLoc are the local rows of V and w
+template<typename Field>
+void Reorthogonalize
+( const Matrix<Field>& VLoc, Matrix<Field>& wLoc, const mpi::Comm& comm )
+{
+    EL_DEBUG_CSE
+    const Int k = VLoc.Width();
+    Matrix<Field> h;
+    for( Int pass=0; pass<2; ++pass )
+    {
+        Zeros( h, k, 1 );
+        Gemv( ADJOINT, Field(1), VLoc, wLoc, Field(0), h );
+        mpi::AllReduce( h.Buffer(), k, comm );
+        Gemv( NORMAL, Field(-1), VLoc, h, Field(1), wLoc );
+    }
+}
+
+// Overwrite the n x numGammas matrix X with the projected ridge solutions for
+// op(A) = W over the Krylov subspace built from the single right-hand side b,
+// where WAdj = W^H. The number of bidiagonalization steps is returned.
+template<typename Field>
+Int LanczosSolve
+( const SparseMatrix<Field>& W,
+  const SparseMatrix<Field>& WAdj,
+  const Matrix<Field>& b,
+  const Matrix<Base<Field>>& gammas,
+        Matrix<Field>& X,
+  const RidgeLanczosCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Int m = W.Height();
+    const Int n = W.Width();
+    const Int numGammas = gammas.Height();
+    const Int basisSize = Min(ctrl.basisSize,Min(m,n));
+    Zeros( X, n, numGammas );
+
+    const Real bNorm = FrobeniusNorm( b );
+    if( bNorm == Real(0) || basisSize == 0 )
+        return 0;
+
+    Matrix<Field> U, V, u, v;
+    Zeros( U, m, basisSize+1 );
+    Zeros( V, n, basisSize );
+    vector<Real> alpha, beta;
+    alpha.reserve( basisSize );
+    beta.reserve( basisSize );
+
+    // u_0 := b / || b ||_2 and alpha_0 v_0 := W^H u_0
+    u = b;
+    u *= Field(1)/bNorm;
+    {
+        auto u0 = U( ALL, IR(0) );
+        u0 = u;
+    }
+    Zeros( v, n, 1 );
+    Multiply( NORMAL, Field(1), WAdj, u, Field(0), v );
+    Real alphaCurr = FrobeniusNorm( v );
+    // If W^H b = 0 then the solution is zero for every gamma
+    if( alphaCurr == Real(0) )
+        return 0;
+    Real normEst = alphaCurr;
+    for( Int k=0; k<basisSize; ++k )
+    {
+        v *= Field(1)/alphaCurr;
+        auto vk = V( ALL, IR(k) );
+        vk = v;
+        alpha.push_back( alphaCurr );
+
+        // beta_k u_{k+1} := W v_k - alpha_k u_k
+        Zeros( u, m, 1 );
+        Multiply( NORMAL, Field(1), W, v, Field(0), u );
+        Axpy( -alphaCurr, U(ALL,IR(k)), u );
+        if( ctrl.reorthogonalize )
+            Reorthogonalize( U(ALL,IR(0,k+1)), u );
+        const Real betaCurr = FrobeniusNorm( u );
+        normEst = Max( normEst, betaCurr );
+        if( betaCurr <= ctrl.breakdownTol*normEst )
+        {
+            beta.push_back( Real(0) );
+            break;
+        }
+        beta.push_back( betaCurr );
+        u *= Field(1)/betaCurr;
+        auto ukp1 = U( ALL, IR(k+1) );
+        ukp1 = u;
+        if( k == basisSize-1 )
+            break;
+
+        // alpha_{k+1} v_{k+1} := W^H u_{k+1} - beta_k v_k
+        Zeros( v, n, 1 );
+        Multiply( NORMAL, Field(1), WAdj, u, Field(0), v );
+        Axpy( -betaCurr, V(ALL,IR(k)), v );
+        if( ctrl.reorthogonalize )
+            Reorthogonalize( V(ALL,IR(0,k+1)), v );
+        alphaCurr = FrobeniusNorm( v );
+        normEst = Max( normEst, alphaCurr );
+        if( alphaCurr <= ctrl.breakdownTol*normEst )
+            break;
+    }
+    const Int numSteps = alpha.size();
+
+    Matrix<Field> Y;
+    ProjectedSolutions( alpha, beta, bNorm, gammas, Y );
+    Gemm( NORMAL, NORMAL, Field(1), V(ALL,IR(0,numSteps)), Y, Field(0), X );
+    return numSteps;
+}
+
+template<typename Field>
+Int LanczosSolve
+( const DistSparseMatrix<Field>& W,
+  const DistSparseMatrix<Field>& WAdj,
+  const DistMultiVec<Field>& b,
+  const Matrix<Base<Field>>& gammas,
+        DistMultiVec<Field>& X,
+  const RidgeLanczosCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Int m = W.Height();
+    const Int n = W.Width();
+    const Grid& grid = W.Grid();
+    const Int numGammas = gammas.Height();
+    const Int basisSize = Min(ctrl.basisSize,Min(m,n));
+    X.SetGrid( grid );
+    Zeros( X, n, numGammas );
+
+    const Real bNorm = FrobeniusNorm( b );
+    if( bNorm == Real(0) || basisSize == 0 )
+        return 0;
+
+    DistMultiVec<Field> U(grid), V(grid), u(grid), v(grid);
+    Zeros( U, m, basisSize+1 );
+    Zeros( V, n, basisSize );
+    auto& ULoc = U.Matrix();
+    auto& VLoc = V.Matrix();
+    vector<Real> alpha, beta;
+    alpha.reserve( basisSize );
+    beta.reserve( basisSize );
+
+    // u_0 := b / || b ||_2 and alpha_0 v_0 := W^H u_0
+    u = b;
+    u *= Field(1)/bNorm;
+    {
+        auto u0Loc = ULoc( ALL, IR(0) );
+        u0Loc = u.LockedMatrix();
+    }
+    Zeros( v, n, 1 );
+    Multiply( NORMAL, Field(1), WAdj, u, Field(0), v );
+    Real alphaCurr = FrobeniusNorm( v );
+    // If W^H b = 0 then the solution is zero for every gamma
+    if( alphaCurr == Real(0) )
+        return 0;
+    Real normEst = alphaCurr;
+    for( Int k=0; k<basisSize; ++k )
+    {
+        v *= Field(1)/alphaCurr;
+        {
+            auto vkLoc = VLoc( ALL, IR(k) );
+            vkLoc = v.LockedMatrix();
+        }
+        alpha.push_back( alphaCurr );
+
+        // beta_k u_{k+1} := W v_k - alpha_k u_k
+        Zeros( u, m, 1 );
+        Multiply( NORMAL, Field(1), W, v, Field(0), u );
+        Axpy( -alphaCurr, ULoc(ALL,IR(k)), u.Matrix() );
+        if( ctrl.reorthogonalize )
+            Reorthogonalize( ULoc(ALL,IR(0,k+1)), u.Matrix(), grid.Comm() );
+        const Real betaCurr = FrobeniusNorm( u );
+        normEst = Max( normEst, betaCurr );
+        if( betaCurr <= ctrl.breakdownTol*normEst )
+        {
+            beta.push_back( Real(0) );
+            break;
+        }
+        beta.push_back( betaCurr );
+        u *= Field(1)/betaCurr;
+        {
+            auto ukp1Loc = ULoc( ALL, IR(k+1) );
+            ukp1Loc = u.LockedMatrix();
+        }
+        if( k == basisSize-1 )
+            break;
+
+        // alpha_{k+1} v_{k+1} := W^H u_{k+1} - beta_k v_k
+        Zeros( v, n, 1 );
+        Multiply( NORMAL, Field(1), WAdj, u, Field(0), v );
+        Axpy( -betaCurr, VLoc(ALL,IR(k)), v.Matrix() );
+        if( ctrl.reorthogonalize )
+            Reorthogonalize( VLoc(ALL,IR(0,k+1)), v.Matrix(), grid.Comm() );
+        alphaCurr = FrobeniusNorm( v );
+        normEst = Max( normEst, alphaCurr );
+        if( alphaCurr <= ctrl.breakdownTol*normEst )
+            break;
+    }
+    const Int numSteps = alpha.size();
+
+    // Every process redundantly solves the (identical) projected problems
+    Matrix<Field> Y;
+    ProjectedSolutions( alpha, beta, bNorm, gammas, Y );
+    Gemm
+    ( NORMAL, NORMAL,
+      Field(1), VLoc(ALL,IR(0,numSteps)), Y, Field(0), X.Matrix() );
+    return numSteps;
+}
+
+} // namespace ridge
+} // namespace El
+
+#endif // ifndef EL_RIDGE_LANCZOS_HPP
@@ -0,0 +1,305 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+// Unblocked factorizations of band matrices which follow the LAPACK routines
+// xPBTF2 and xGBTF2 (as well as the corresponding solves, xPBTRS and xGBTRS)
+// so that they only ever touch entries of the band (including the fill-in
+// of the upper band by row interchanges).
+
+namespace El {
+
+template<typename Field>
+void Cholesky( UpperOrLower uplo, BandMatrix<Field>& A )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Int n = A.Height();
+    if( A.Width() != n )
+        LogicError("Cholesky requires a square band matrix");
+    const Int upper = A.UpperBandwidth();
+    const Int bandwidth = ( uplo == LOWER ? A.LowerBandwidth() : upper );
+    Field* ABuf = A.Matrix().Buffer();
+    const Int ALDim = A.Matrix().LDim();
+    auto entry = [&]( Int i, Int j ) -> Field&
+      { return ABuf[upper+i-j+j*ALDim]; };
+
+    for( Int j=0; j<n; ++j )
+    {
+        const Real delta = RealPart(entry(j,j));
+        if( delta <= Real(0) )
+            throw NonHPDMatrixException("A was not numerically HPD");
+        const Real deltaSqrt = Sqrt(delta);
+        entry(j,j) = deltaSqrt;
+        const Int numBelow = Min(bandwidth,n-1-j);
+        if( uplo == LOWER )
+        {
+            // A(j+1:j+numBelow,j) /= delta and then update the trailing
+            // lower triangle of the band with its negated outer product
+            for( Int r=1; r<=numBelow; ++r )
+                entry(j+r,j) /= deltaSqrt;
+            for( Int c=1; c<=numBelow; ++c )
+            {
+                const Field tau = Conj(entry(j+c,j));
+                for( Int r=c; r<=numBelow; ++r )
+                    entry(j+r,j+c) -= entry(j+r,j)*tau;
+            }
+        }
+        else
+        {
+            for( Int c=1; c<=numBelow; ++c )
+                entry(j,j+c) /= deltaSqrt;
+            for( Int c=1; c<=numBelow; ++c )
+            {
+                const Field tau = entry(j,j+c);
+                for( Int r=1; r<=c; ++r )
+                    entry(j+r,j+c) -= Conj(entry(j,j+r))*tau;
+            }
+        }
+    }
+}
+
+template<typename Field>
+void LU( BandMatrix<Field>& A, Matrix<Int>& pivots )
+{
+    EL_DEBUG_CSE
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int lower = A.LowerBandwidth();
+    const Int minDim = Min(m,n);
+
+    // Make room for the fill-in of U from the row interchanges
+    if( lower > 0 )
+    {
+        const Int oldUpper = A.UpperBandwidth();
+        const Int upper = oldUpper + lower;
+        BandMatrix<Field> B( m, n, lower, upper );
+        const auto& AB = A.LockedMatrix();
+        auto& BB = B.Matrix();
+        for( Int j=0; j<n; ++j )
+            for( Int i=Max(j-oldUpper,Int(0)); i<Min(j+lower+1,m); ++i )
+                BB(upper+i-j,j) = AB(oldUpper+i-j,j);
+        A = B;
+    }
+    const Int upper = A.UpperBandwidth();
+    const Int origUpper = upper - lower;
+    Field* ABuf = A.Matrix().Buffer();
+    const Int ALDim = A.Matrix().LDim();
+    auto entry = [&]( Int i, Int j ) -> Field&
+      { return ABuf[upper+i-j+j*ALDim]; };
+
+    pivots.Resize( minDim, 1 );
+    Int lastCol = 0;
+    for( Int j=0; j<minDim; ++j )
+    {
+        // Find the pivot within the (at most) 'lower' subdiagonals
+        const Int numBelow = Min(lower,m-1-j);
+        Int pivot = 0;
+        Base<Field> pivotValue = Abs(entry(j,j));
+        for( Int r=1; r<=numBelow; ++r )
+        {
+            const Base<Field> value = Abs(entry(j+r,j));
+            if( value > pivotValue )
+            {
+                pivot = r;
+                pivotValue = value;
+            }
+        }
+        pivots(j) = j + pivot;
+        if( pivotValue == Base<Field>(0) )
+            throw SingularMatrixException();
+
+        // The interchange extends U up to column j+origUpper+pivot
+        lastCol = Max(lastCol,Min(j+origUpper+pivot,n-1));
+        if( pivot != 0 )
+            for( Int c=j; c<=lastCol; ++c )
+                std::swap( entry(j,c), entry(j+pivot,c) );
+
+        const Field deltaInv = Field(1) / entry(j,j);
+        for( Int r=1; r<=numBelow; ++r )
+            entry(j+r,j) *= deltaInv;
+        for( Int c=j+1; c<=lastCol; ++c )
+        {
+            const Field tau = entry(j,c);
+            if( tau != Field(0) )
+                for( Int r=1; r<=numBelow; ++r )
+                    entry(j+r,c) -= entry(j+r,j)*tau;
+        }
+    }
+}
+
+namespace cholesky {
+
+template<typename Field>
+void SolveAfter
+( UpperOrLower uplo,
+  Orientation orientation,
+  const BandMatrix<Field>& A,
+        Matrix<Field>& B )
+{
+    EL_DEBUG_CSE
+    const Int n = A.Height();
+    if( B.Height() != n )
+        LogicError("A and B must have the same height");
+    const Int upper = A.UpperBandwidth();
+    const Int bandwidth = ( uplo == LOWER ? A.LowerBandwidth() : upper );
+    const Field* ABuf = A.LockedMatrix().LockedBuffer();
+    const Int ALDim = A.LockedMatrix().LDim();
+    auto entry = [&]( Int i, Int j ) { return ABuf[upper+i-j+j*ALDim]; };
+
+    // Since A is Hermitian, A^T X = B is equivalent to A conj(X) = conj(B)
+    if( orientation == TRANSPOSE )
+        Conjugate( B );
+    const Int width = B.Width();
+    for( Int k=0; k<width; ++k )
+    {
+        Field* b = B.Buffer(0,k);
+        if( uplo == LOWER )
+        {
+            // Solve against L and then L^H
+            for( Int j=0; j<n; ++j )
+            {
+                b[j] /= entry(j,j);
+                const Int numBelow = Min(bandwidth,n-1-j);
+                for( Int r=1; r<=numBelow; ++r )
+                    b[j+r] -= entry(j+r,j)*b[j];
+            }
+            for( Int j=n-1; j>=0; --j )
+            {
+                const Int numBelow = Min(bandwidth,n-1-j);
+                Field tau = b[j];
+                for( Int r=1; r<=numBelow; ++r )
+                    tau -= Conj(entry(j+r,j))*b[j+r];
+                b[j] = tau / entry(j,j);
+            }
+        }
+        else
+        {
+            // Solve against U^H and then U
+            for( Int j=0; j<n; ++j )
+            {
+                Field tau = b[j];
+                for( Int i=Max(j-bandwidth,Int(0)); i<j; ++i )
+                    tau -= Conj(entry(i,j))*b[i];
+                b[j] = tau / entry(j,j);
+            }
+            for( Int j=n-1; j>=0; --j )
+            {
+                b[j] /= entry(j,j);
+                for( Int i=Max(j-bandwidth,Int(0)); i<j; ++i )
+                    b[i] -= entry(i,j)*b[j];
+            }
+        }
+    }
+    if( orientation == TRANSPOSE )
+        Conjugate( B );
+}
+
+} // namespace cholesky
+
+namespace lu {
+
+template<typename Field>
+void SolveAfter
+( Orientation orientation,
+  const BandMatrix<Field>& A,
+  const Matrix<Int>& pivots,
+        Matrix<Field>& B )
+{
+    EL_DEBUG_CSE
+    const Int n = A.Height();
+    if( A.Width() != n )
+        LogicError("Only square band LU factorizations can be solved");
+    if( B.Height() != n )
+        LogicError("A and B must have the same height");
+    if( pivots.Height() != n )
+        LogicError("There should be one pivot per row of A");
+    const bool conjugate = ( orientation == ADJOINT );
+    const Int lower = A.LowerBandwidth();
+    const Int upper = A.UpperBandwidth();
+    const Field* ABuf = A.LockedMatrix().LockedBuffer();
+    const Int ALDim = A.LockedMatrix().LDim();
+    auto entry = [&]( Int i, Int j )
+      {
+          const Field value = ABuf[upper+i-j+j*ALDim];
+          return conjugate ? Conj(value) : value;
+      };
+
+    const Int width = B.Width();
+    for( Int k=0; k<width; ++k )
+    {
+        Field* b = B.Buffer(0,k);
+        if( orientation == NORMAL )
+        {
+            // Apply the interchanges and the unit lower Gauss transforms in
+            // the order in which they were formed, then solve against U
+            for( Int j=0; j<n; ++j )
+            {
+                const Int p = pivots(j);
+                if( p != j )
+                    std::swap( b[j], b[p] );
+                const Int numBelow = Min(lower,n-1-j);
+                for( Int r=1; r<=numBelow; ++r )
+                    b[j+r] -= entry(j+r,j)*b[j];
+            }
+            for( Int j=n-1; j>=0; --j )
+            {
+                b[j] /= entry(j,j);
+                for( Int i=Max(j-upper,Int(0)); i<j; ++i )
+                    b[i] -= entry(i,j)*b[j];
+            }
+        }
+        else
+        {
+            // Solve against op(U) and then undo the Gauss transforms and
+            // interchanges in reverse order
+            for( Int j=0; j<n; ++j )
+            {
+                Field tau = b[j];
+                for( Int i=Max(j-upper,Int(0)); i<j; ++i )
+                    tau -= entry(i,j)*b[i];
+                b[j] = tau / entry(j,j);
+            }
+            for( Int j=n-1; j>=0; --j )
+            {
+                const Int numBelow = Min(lower,n-1-j);
+                for( Int r=1; r<=numBelow; ++r )
+                    b[j] -= entry(j+r,j)*b[j+r];
+                const Int p = pivots(j);
+                if( p != j )
+                    std::swap( b[j], b[p] );
+            }
+        }
+    }
+}
+
+} // namespace lu
+
+#define PROTO(Field) \
+  template void Cholesky( UpperOrLower uplo, BandMatrix<Field>& A ); \
+  template void LU( BandMatrix<Field>& A, Matrix<Int>& pivots ); \
+  template void cholesky::SolveAfter \
+  ( UpperOrLower uplo, \
+    Orientation orientation, \
+    const BandMatrix<Field>& A, \
+          Matrix<Field>& B ); \
+  template void lu::SolveAfter \
+  ( Orientation orientation, \
+    const BandMatrix<Field>& A, \
+    const Matrix<Int>& pivots, \
+          Matrix<Field>& B );
+
+#define EL_NO_INT_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
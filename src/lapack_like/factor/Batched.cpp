@@ -0,0 +1,472 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+namespace El {
+namespace batched {
+
+// The unblocked kernels are written as plain loops, rather than in terms of
+// the BLAS wrappers, since the per-call overhead dominates for tiny matrices.
+// They each return false upon a breakdown.
+
+template<typename Field>
+bool LUKernel( Int n, Field* A, Int ALDim, Int* pivots )
+{
+    bool success = true;
+    for( Int k=0; k<n; ++k )
+    {
+        Field* aCol = &A[k*ALDim];
+        Int iPiv = k;
+        Base<Field> maxAbs = Abs(aCol[k]);
+        for( Int i=k+1; i<n; ++i )
+        {
+            const Base<Field> alphaAbs = Abs(aCol[i]);
+            if( alphaAbs > maxAbs )
+            {
+                iPiv = i;
+                maxAbs = alphaAbs;
+            }
+        }
+        pivots[k] = iPiv;
+        if( iPiv != k )
+            for( Int j=0; j<n; ++j )
+                std::swap( A[k+j*ALDim], A[iPiv+j*ALDim] );
+
+        const Field alpha = aCol[k];
+        if( alpha == Field(0) )
+        {
+            // Leave the remainder of the matrix unfactored
+            for( Int i=k+1; i<n; ++i )
+                pivots[i] = i;
+            success = false;
+            break;
+        }
+        const Field alphaInv = Field(1) / alpha;
+        EL_SIMD
+        for( Int i=k+1; i<n; ++i )
+            aCol[i] *= alphaInv;
+        for( Int j=k+1; j<n; ++j )
+        {
+            Field* a2Col = &A[j*ALDim];
+            const Field gamma = a2Col[k];
+            EL_SIMD
+            for( Int i=k+1; i<n; ++i )
+                a2Col[i] -= aCol[i]*gamma;
+        }
+    }
+    return success;
+}
+
+template<typename Field>
+bool CholeskyKernel( UpperOrLower uplo, Int n, Field* A, Int ALDim )
+{
+    typedef Base<Field> Real;
+    for( Int k=0; k<n; ++k )
+    {
+        const Real delta = RealPart(A[k+k*ALDim]);
+        if( delta <= Real(0) )
+            return false;
+        const Real deltaSqrt = Sqrt(delta);
+        A[k+k*ALDim] = deltaSqrt;
+        const Real deltaInv = Real(1) / deltaSqrt;
+        if( uplo == LOWER )
+        {
+            Field* aCol = &A[k*ALDim];
+            EL_SIMD
+            for( Int i=k+1; i<n; ++i )
+                aCol[i] *= deltaInv;
+            for( Int j=k+1; j<n; ++j )
+            {
+                Field* a2Col = &A[j*ALDim];
+                const Field gamma = Conj(aCol[j]);
+                EL_SIMD
+                for( Int i=j; i<n; ++i )
+                    a2Col[i] -= aCol[i]*gamma;
+            }
+        }
+        else
+        {
+            for( Int j=k+1; j<n; ++j )
+                A[k+j*ALDim] *= deltaInv;
+            for( Int j=k+1; j<n; ++j )
+            {
+                Field* a2Col = &A[j*ALDim];
+                const Field gamma = a2Col[k];
+                for( Int i=k+1; i<=j; ++i )
+                    a2Col[i] -= Conj(A[k+i*ALDim])*gamma;
+            }
+        }
+    }
+    return true;
+}
+
+template<typename Field>
+void QRKernel
+( Int m, Int n, Field* A, Int ALDim, Field* householderScalars, Field* work )
+{
+    const Int minDim = Min(m,n);
+    for( Int k=0; k<minDim; ++k )
+    {
+        Field* alpha11 = &A[k+k*ALDim];
+        const Field tau =
+          lapack::Reflector( m-k, *alpha11, &A[(k+1)+k*ALDim], 1 );
+        householderScalars[k] = tau;
+
+        const Field beta = *alpha11;
+        *alpha11 = Field(1);
+        lapack::ApplyReflector
+        ( true, m-k, n-(k+1), alpha11, 1, tau,
+          &A[k+(k+1)*ALDim], ALDim, work );
+        *alpha11 = beta;
+    }
+}
+
+template<typename Field>
+void LUSolveAfterKernel
+( Int n, Int numRHS,
+  const Field* A, Int ALDim,
+  const Int* pivots,
+        Field* B, Int BLDim )
+{
+    for( Int k=0; k<n; ++k )
+        if( pivots[k] != k )
+            for( Int j=0; j<numRHS; ++j )
+                std::swap( B[k+j*BLDim], B[pivots[k]+j*BLDim] );
+    blas::Trsm
+    ( 'L', 'L', 'N', 'U', n, numRHS, Field(1), A, ALDim, B, BLDim );
+    blas::Trsm
+    ( 'L', 'U', 'N', 'N', n, numRHS, Field(1), A, ALDim, B, BLDim );
+}
+
+template<typename Field>
+void CholeskySolveAfterKernel
+( UpperOrLower uplo, Int n, Int numRHS,
+  const Field* A, Int ALDim,
+        Field* B, Int BLDim )
+{
+    if( uplo == LOWER )
+    {
+        blas::Trsm
+        ( 'L', 'L', 'N', 'N', n, numRHS, Field(1), A, ALDim, B, BLDim );
+        blas::Trsm
+        ( 'L', 'L', 'C', 'N', n, numRHS, Field(1), A, ALDim, B, BLDim );
+    }
+    else
+    {
+        blas::Trsm
+        ( 'L', 'U', 'C', 'N', n, numRHS, Field(1), A, ALDim, B, BLDim );
+        blas::Trsm
+        ( 'L', 'U', 'N', 'N', n, numRHS, Field(1), A, ALDim, B, BLDim );
+    }
+}
+
+// The index of the calling thread within the batch loops
+inline Int ThreadIndex()
+{
+#ifdef EL_HYBRID
+    return omp_get_thread_num();
+#else
+    return 0;
+#endif
+}
+
+inline Int MaxThreads()
+{
+#ifdef EL_HYBRID
+    return omp_get_max_threads();
+#else
+    return 1;
+#endif
+}
+
+template<typename Field>
+void LU
+( Int n, Field* A, Int ALDim, Int AStride, Int* pivots, Int batchSize )
+{
+    EL_DEBUG_CSE
+    vector<byte> success( batchSize );
+    EL_PARALLEL_FOR
+    for( Int k=0; k<batchSize; ++k )
+        success[k] = LUKernel( n, &A[k*AStride], ALDim, &pivots[k*n] );
+    for( Int k=0; k<batchSize; ++k )
+        if( !success[k] )
+            throw SingularMatrixException();
+}
+
+template<typename Field>
+void LU( vector<Matrix<Field>>& A, vector<Matrix<Int>>& pivots )
+{
+    EL_DEBUG_CSE
+    const Int batchSize = A.size();
+    pivots.resize( batchSize );
+    for( Int k=0; k<batchSize; ++k )
+    {
+        if( A[k].Height() != A[k].Width() )
+            LogicError("Matrix ",k," of the batch was not square");
+        pivots[k].Resize( A[k].Height(), 1 );
+    }
+    vector<byte> success( batchSize );
+    EL_PARALLEL_FOR
+    for( Int k=0; k<batchSize; ++k )
+        success[k] =
+          LUKernel
+          ( A[k].Height(), A[k].Buffer(), A[k].LDim(), pivots[k].Buffer() );
+    for( Int k=0; k<batchSize; ++k )
+        if( !success[k] )
+            throw SingularMatrixException();
+}
+
+template<typename Field>
+void LUSolveAfter
+( Int n, Int numRHS,
+  const Field* A, Int ALDim, Int AStride,
+  const Int* pivots,
+        Field* B, Int BLDim, Int BStride,
+  Int batchSize )
+{
+    EL_DEBUG_CSE
+    EL_PARALLEL_FOR
+    for( Int k=0; k<batchSize; ++k )
+        LUSolveAfterKernel
+        ( n, numRHS, &A[k*AStride], ALDim, &pivots[k*n],
+          &B[k*BStride], BLDim );
+}
+
+template<typename Field>
+void LUSolveAfter
+( const vector<Matrix<Field>>& A,
+  const vector<Matrix<Int>>& pivots,
+        vector<Matrix<Field>>& B )
+{
+    EL_DEBUG_CSE
+    const Int batchSize = A.size();
+    if( Int(pivots.size()) != batchSize || Int(B.size()) != batchSize )
+        LogicError("The batches were of different sizes");
+    for( Int k=0; k<batchSize; ++k )
+        if( B[k].Height() != A[k].Height() )
+            LogicError("Matrix ",k," of the batch was a nonconformal size");
+    EL_PARALLEL_FOR
+    for( Int k=0; k<batchSize; ++k )
+        LUSolveAfterKernel
+        ( A[k].Height(), B[k].Width(),
+          A[k].LockedBuffer(), A[k].LDim(),
+          pivots[k].LockedBuffer(),
+          B[k].Buffer(), B[k].LDim() );
+}
+
+template<typename Field>
+void Cholesky
+( UpperOrLower uplo, Int n, Field* A, Int ALDim, Int AStride, Int batchSize )
+{
+    EL_DEBUG_CSE
+    vector<byte> success( batchSize );
+    EL_PARALLEL_FOR
+    for( Int k=0; k<batchSize; ++k )
+        success[k] = CholeskyKernel( uplo, n, &A[k*AStride], ALDim );
+    for( Int k=0; k<batchSize; ++k )
+        if( !success[k] )
+            throw NonHPDMatrixException();
+}
+
+template<typename Field>
+void Cholesky( UpperOrLower uplo, vector<Matrix<Field>>& A )
+{
+    EL_DEBUG_CSE
+    const Int batchSize = A.size();
+    for( Int k=0; k<batchSize; ++k )
+        if( A[k].Height() != A[k].Width() )
+            LogicError("Matrix ",k," of the batch was not square");
+    vector<byte> success( batchSize );
+    EL_PARALLEL_FOR
+    for( Int k=0; k<batchSize; ++k )
+        success[k] =
+          CholeskyKernel( uplo, A[k].Height(), A[k].Buffer(), A[k].LDim() );
+    for( Int k=0; k<batchSize; ++k )
+        if( !success[k] )
+            throw NonHPDMatrixException();
+}
+
+template<typename Field>
+void CholeskySolveAfter
+( UpperOrLower uplo, Int n, Int numRHS,
+  const Field* A, Int ALDim, Int AStride,
+        Field* B, Int BLDim, Int BStride,
+  Int batchSize )
+{
+    EL_DEBUG_CSE
+    EL_PARALLEL_FOR
+    for( Int k=0; k<batchSize; ++k )
+        CholeskySolveAfterKernel
+        ( uplo, n, numRHS, &A[k*AStride], ALDim, &B[k*BStride], BLDim );
+}
+
+template<typename Field>
+void CholeskySolveAfter
+( UpperOrLower uplo,
+  const vector<Matrix<Field>>& A,
+        vector<Matrix<Field>>& B )
+{
+    EL_DEBUG_CSE
+    const Int batchSize = A.size();
+    if( Int(B.size()) != batchSize )
+        LogicError("The batches were of different sizes");
+    for( Int k=0; k<batchSize; ++k )
+        if( B[k].Height() != A[k].Height() )
+            LogicError("Matrix ",k," of the batch was a nonconformal size");
+    EL_PARALLEL_FOR
+    for( Int k=0; k<batchSize; ++k )
+        CholeskySolveAfterKernel
+        ( uplo, A[k].Height(), B[k].Width(),
+          A[k].LockedBuffer(), A[k].LDim(),
+          B[k].Buffer(), B[k].LDim() );
+}
+
+template<typename Field>
+void QR
+( Int m, Int n, Field* A, Int ALDim, Int AStride,
+  Field* householderScalars, Int batchSize )
+{
+    EL_DEBUG_CSE
+    const Int minDim = Min(m,n);
+    vector<Field> work( MaxThreads()*n );
+    EL_PARALLEL_FOR
+    for( Int k=0; k<batchSize; ++k )
+        QRKernel
+        ( m, n, &A[k*AStride], ALDim, &householderScalars[k*minDim],
+          &work[ThreadIndex()*n] );
+}
+
+template<typename Field>
+void QR
+( vector<Matrix<Field>>& A, vector<Matrix<Field>>& householderScalars )
+{
+    EL_DEBUG_CSE
+    const Int batchSize = A.size();
+    householderScalars.resize( batchSize );
+    Int maxWidth = 0;
+    for( Int k=0; k<batchSize; ++k )
+    {
+        householderScalars[k].Resize( Min(A[k].Height(),A[k].Width()), 1 );
+        maxWidth = Max( maxWidth, A[k].Width() );
+    }
+    vector<Field> work( MaxThreads()*maxWidth );
+    EL_PARALLEL_FOR
+    for( Int k=0; k<batchSize; ++k )
+        QRKernel
+        ( A[k].Height(), A[k].Width(), A[k].Buffer(), A[k].LDim(),
+          householderScalars[k].Buffer(), &work[ThreadIndex()*maxWidth] );
+}
+
+template<typename Field>
+void Trsm
+( LeftOrRight side, UpperOrLower uplo,
+  Orientation orientation, UnitOrNonUnit diag,
+  Int m, Int n, Field alpha,
+  const Field* A, Int ALDim, Int AStride,
+        Field* B, Int BLDim, Int BStride,
+  Int batchSize )
+{
+    EL_DEBUG_CSE
+    const char sideChar = LeftOrRightToChar( side );
+    const char uploChar = UpperOrLowerToChar( uplo );
+    const char transChar = OrientationToChar( orientation );
+    const char diagChar = UnitOrNonUnitToChar( diag );
+    EL_PARALLEL_FOR
+    for( Int k=0; k<batchSize; ++k )
+        blas::Trsm
+        ( sideChar, uploChar, transChar, diagChar, m, n,
+          alpha, &A[k*AStride], ALDim, &B[k*BStride], BLDim );
+}
+
+template<typename Field>
+void Trsm
+( LeftOrRight side, UpperOrLower uplo,
+  Orientation orientation, UnitOrNonUnit diag,
+  Field alpha,
+  const vector<Matrix<Field>>& A,
+        vector<Matrix<Field>>& B )
+{
+    EL_DEBUG_CSE
+    const Int batchSize = A.size();
+    if( Int(B.size()) != batchSize )
+        LogicError("The batches were of different sizes");
+    for( Int k=0; k<batchSize; ++k )
+    {
+        const Int dim = ( side==LEFT ? B[k].Height() : B[k].Width() );
+        if( A[k].Height() != A[k].Width() || A[k].Height() != dim )
+            LogicError("Matrix ",k," of the batch was a nonconformal size");
+    }
+    const char sideChar = LeftOrRightToChar( side );
+    const char uploChar = UpperOrLowerToChar( uplo );
+    const char transChar = OrientationToChar( orientation );
+    const char diagChar = UnitOrNonUnitToChar( diag );
+    EL_PARALLEL_FOR
+    for( Int k=0; k<batchSize; ++k )
+        blas::Trsm
+        ( sideChar, uploChar, transChar, diagChar,
+          B[k].Height(), B[k].Width(),
+          alpha, A[k].LockedBuffer(), A[k].LDim(),
+          B[k].Buffer(), B[k].LDim() );
+}
+
+#define PROTO(Field) \
+  template void LU \
+  ( Int n, Field* A, Int ALDim, Int AStride, Int* pivots, Int batchSize ); \
+  template void LU( vector<Matrix<Field>>& A, vector<Matrix<Int>>& pivots ); \
+  template void LUSolveAfter \
+  ( Int n, Int numRHS, \
+    const Field* A, Int ALDim, Int AStride, \
+    const Int* pivots, \
+          Field* B, Int BLDim, Int BStride, \
+    Int batchSize ); \
+  template void LUSolveAfter \
+  ( const vector<Matrix<Field>>& A, \
+    const vector<Matrix<Int>>& pivots, \
+          vector<Matrix<Field>>& B ); \
+  template void Cholesky \
+  ( UpperOrLower uplo, Int n, Field* A, Int ALDim, Int AStride, \
+    Int batchSize ); \
+  template void Cholesky( UpperOrLower uplo, vector<Matrix<Field>>& A ); \
+  template void CholeskySolveAfter \
+  ( UpperOrLower uplo, Int n, Int numRHS, \
+    const Field* A, Int ALDim, Int AStride, \
+          Field* B, Int BLDim, Int BStride, \
+    Int batchSize ); \
+  template void CholeskySolveAfter \
+  ( UpperOrLower uplo, \
+    const vector<Matrix<Field>>& A, \
+          vector<Matrix<Field>>& B ); \
+  template void QR \
+  ( Int m, Int n, Field* A, Int ALDim, Int AStride, \
+    Field* householderScalars, Int batchSize ); \
+  template void QR \
+  ( vector<Matrix<Field>>& A, vector<Matrix<Field>>& householderScalars ); \
+  template void Trsm \
+  ( LeftOrRight side, UpperOrLower uplo, \
+    Orientation orientation, UnitOrNonUnit diag, \
+    Int m, Int n, Field alpha, \
+    const Field* A, Int ALDim, Int AStride, \
+          Field* B, Int BLDim, Int BStride, \
+    Int batchSize ); \
+  template void Trsm \
+  ( LeftOrRight side, UpperOrLower uplo, \
+    Orientation orientation, UnitOrNonUnit diag, \
+    Field alpha, \
+    const vector<Matrix<Field>>& A, \
+          vector<Matrix<Field>>& B );
+
+#define EL_NO_INT_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace batched
+} // namespace El
@@ -109,6 +109,26 @@ void Cholesky( UpperOrLower uplo, AbstractDistMatrix<F>& A, bool scalapack )
     }
 }
 
+template<typename F>
+void Cholesky
+( UpperOrLower uplo, AbstractDistMatrix<F>& A, const CholeskyCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    if( ctrl.lookahead < 0 )
+        LogicError("Invalid lookahead depth of ",ctrl.lookahead);
+    if( ctrl.scalapack || ctrl.lookahead == 0 )
+    {
+        Cholesky( uplo, A, ctrl.scalapack );
+    }
+    else
+    {
+        if( uplo == LOWER )
+            cholesky::LowerVariant3Lookahead( A );
+        else
+            cholesky::UpperVariant3Lookahead( A );
+    }
+}
+
 template<typename F> 
 void Cholesky
 ( UpperOrLower uplo, AbstractDistMatrix<F>& A, DistPermutation& p )
@@ -125,6 +145,23 @@ void Cholesky
 ( UpperOrLower uplo, DistMatrix<F,STAR,STAR>& A )
 { Cholesky( uplo, A.Matrix() ); }
 
+// Block-cyclic matrices are factored in place by ScaLAPACK when possible and
+// otherwise redistributed to and from the elemental algorithm
+template<typename F>
+void Cholesky( UpperOrLower uplo, DistMatrix<F,MC,MR,BLOCK>& A )
+{
+    EL_DEBUG_CSE
+#ifdef EL_HAVE_SCALAPACK
+    if( IsBlasScalar<F>::value && A.ColCut() == 0 && A.RowCut() == 0 )
+    {
+        cholesky::ScaLAPACKHelper( uplo, A );
+        return;
+    }
+#endif
+    AbstractDistMatrix<F>& AAbs = A;
+    Cholesky( uplo, AAbs );
+}
+
 template<typename F> 
 void ReverseCholesky( UpperOrLower uplo, AbstractDistMatrix<F>& A )
 {
@@ -207,7 +244,13 @@ void HPSDCholesky( UpperOrLower uplo, AbstractDistMatrix<F>& APre )
   template void Cholesky( UpperOrLower uplo, Matrix<F>& A ); \
   template void Cholesky \
   ( UpperOrLower uplo, AbstractDistMatrix<F>& A, bool scalapack ); \
+  template void Cholesky \
+  ( UpperOrLower uplo, \
+    AbstractDistMatrix<F>& A, \
+    const CholeskyCtrl& ctrl ); \
   template void Cholesky( UpperOrLower uplo, DistMatrix<F,STAR,STAR>& A ); \
+  template void Cholesky \
+  ( UpperOrLower uplo, DistMatrix<F,MC,MR,BLOCK>& A ); \
   template void ReverseCholesky( UpperOrLower uplo, Matrix<F>& A ); \
   template void ReverseCholesky \
   ( UpperOrLower uplo, AbstractDistMatrix<F>& A ); \
@@ -9,14 +9,14 @@
 #ifndef EL_CHOLESKY_LOWER_MOD_HPP
 #define EL_CHOLESKY_LOWER_MOD_HPP
 
-// TODO: Blocked algorithms
 namespace El {
 namespace cholesky {
 
 namespace mod {
 
 template<typename F>
-void LowerUpdate( Matrix<F>& L, Matrix<F>& V )
+void LowerUpdateUnb
+( Matrix<F>& L, Matrix<F>& V, Matrix<F>& householderScalars )
 {
     EL_DEBUG_CSE
     EL_DEBUG_ONLY(
@@ -26,6 +26,7 @@ void LowerUpdate( Matrix<F>& L, Matrix<F>& V )
           LogicError("V is the wrong height");
     )
     const Int m = V.Height();
+    householderScalars.Resize( m, 1 );
 
     Matrix<F> z21;
 
@@ -44,6 +45,7 @@ void LowerUpdate( Matrix<F>& L, Matrix<F>& V )
         //                 \        | u^T |              /
         // where beta >= 0
         const F tau = RightReflector( lambda11, v1 );
+        householderScalars(k) = tau;
 
         // Apply the negative Householder reflector from the right:
         // | l21 V2 | := -| l21 V2 | + tau | l21 V2 | | 1   | | 1 conj(u) |
@@ -60,67 +62,8 @@ void LowerUpdate( Matrix<F>& L, Matrix<F>& V )
 }
 
 template<typename F>
-void LowerUpdate
-( AbstractDistMatrix<F>& LPre,
-  AbstractDistMatrix<F>& VPre )
-{
-    EL_DEBUG_CSE
-    EL_DEBUG_ONLY(
-      if( LPre.Height() != LPre.Width() )
-          LogicError("Cholesky factors must be square");
-      if( VPre.Height() != LPre.Height() )
-          LogicError("V is the wrong height");
-      AssertSameGrids( LPre, VPre );
-    )
-
-    DistMatrixReadWriteProxy<F,F,MC,MR> LProx( LPre ), VProx( VPre );
-    auto& L = LProx.Get();
-    auto& V = VProx.Get();
-
-    const Int m = V.Height();
-    const Grid& grid = L.Grid();
-    DistMatrix<F,MC,STAR> z21_MC_STAR(grid), b21_MC_STAR(grid);
-    DistMatrix<F,STAR,MR> v1_STAR_MR(grid);
-
-    for( Int k=0; k<m; ++k )
-    {
-        const IR ind1( k ), ind2( k+1, END );
-
-        F lambda11 = L.Get( k, k );
-        auto l21 = L( ind2, ind1 );
-
-        auto v1 = V( ind1, ALL );
-        auto V2 = V( ind2, ALL );
-
-        // Find tau and u such that
-        //  | lambda11 u | /I - tau | 1   | | 1 conj(u) |\ = | -beta 0 |
-        //                 \        | u^T |              /
-        // where beta >= 0
-        const F tau = RightReflector( lambda11, v1 );
-
-        // Apply the negative Householder reflector from the right:
-        // | l21 V2 | := -| l21 V2 | + tau | l21 V2 | | 1   | | 1 conj(u) |
-        //                                            | u^T |
-        //             = -| l21 V2 | + tau (l21 + V2 u^T) | 1 conj(u) |
-        L.Set( k, k, -lambda11 );
-        z21_MC_STAR.AlignWith( V2 );
-        b21_MC_STAR.AlignWith( V2 );
-        v1_STAR_MR.AlignWith( V2 );
-        z21_MC_STAR = l21;
-        v1_STAR_MR = v1;
-        Zeros( b21_MC_STAR, V2.Height(), 1 );
-        LocalGemv( NORMAL, F(1), V2, v1_STAR_MR, F(0), b21_MC_STAR );
-        El::AllReduce( b21_MC_STAR, V2.RowComm() );
-        z21_MC_STAR += b21_MC_STAR;
-        l21 *= -1;
-        Axpy( tau, z21_MC_STAR, l21 );
-        V2 *= -1;
-        LocalGer( tau, z21_MC_STAR, v1_STAR_MR, V2 );
-    }
-}
-
-template<typename F>
-void LowerDowndate( Matrix<F>& L, Matrix<F>& V )
+void LowerDowndateUnb
+( Matrix<F>& L, Matrix<F>& V, Matrix<F>& householderScalars )
 {
     EL_DEBUG_CSE
     EL_DEBUG_ONLY(
@@ -130,6 +73,7 @@ void LowerDowndate( Matrix<F>& L, Matrix<F>& V )
           LogicError("V is the wrong height");
     )
     const Int m = V.Height();
+    householderScalars.Resize( m, 1 );
 
     Matrix<F> z21;
 
@@ -148,6 +92,7 @@ void LowerDowndate( Matrix<F>& L, Matrix<F>& V )
         //                 \                | u^T |              /
         // where Sigma = diag(+1,-1,...,-1) and beta >= 0
         const F tau = RightHyperbolicReflector( lambda11, v1 );
+        householderScalars(k) = tau;
 
         // Apply the negative of the hyperbolic Householder reflector from the
         // right:
@@ -166,8 +111,101 @@ void LowerDowndate( Matrix<F>& L, Matrix<F>& V )
     }
 }
 
+// Since each step of the unblocked algorithm negates not only its
+// reflector's column of L but also all of V, the i-th reflector of a panel,
+// when accumulated into a compact WY form, has its trailing components
+// negated i times. Form the correspondingly signed copy of the panel's rows of
+// V and the upper-triangular matrix S such that the panel's transformations
+// (up to the signs) are given by I - W inv(S) W^H, with W = [I; VSgn^T],
+// where, following Puglisi/Joffrain et al., S is the diagonal formed from the
+// inverses of the Householder scalars plus the strictly upper triangle of the
+// (hyperbolic) Gramian of W.
+template<typename F>
+void PanelFactor
+( const Matrix<F>& V1,
+  const Matrix<F>& householderScalars,
+  bool hyperbolic,
+  bool adjoint,
+  Matrix<F>& VSgn,
+  Matrix<F>& VSgnConj,
+  Matrix<F>& S )
+{
+    EL_DEBUG_CSE
+    const Int nb = V1.Height();
+    VSgn = V1;
+    for( Int i=1; i<nb; i+=2 )
+    {
+        auto vSgn = VSgn( IR(i), ALL );
+        vSgn *= -1;
+    }
+    Conjugate( VSgn, VSgnConj );
+    const F gramSign = ( hyperbolic ? F(-1) : F(1) );
+    Gemm( NORMAL, TRANSPOSE, gramSign, VSgnConj, VSgn, S );
+    MakeTrapezoidal( UPPER, S, 1 );
+    for( Int i=0; i<nb; ++i )
+    {
+        const F tau =
+          ( adjoint ? Conj(householderScalars(i)) : householderScalars(i) );
+        S(i,i) = ( hyperbolic ? tau : F(1)/tau );
+    }
+}
+
+// Blocked variants which only apply the unblocked algorithm to the diagonal
+// blocks and then update the trailing rows of L and V with one compact-WY
+// application per panel
+template<typename F>
+void LowerBlocked( Matrix<F>& L, Matrix<F>& V, bool hyperbolic )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( L.Height() != L.Width() )
+          LogicError("Cholesky factors must be square");
+      if( V.Height() != L.Height() )
+          LogicError("V is the wrong height");
+    )
+    const Int m = V.Height();
+    const F sign = ( hyperbolic ? F(-1) : F(1) );
+
+    Matrix<F> householderScalars, VSgn, VSgnConj, S, Z21;
+
+    const Int bsize = Blocksize();
+    for( Int k=0; k<m; k+=bsize )
+    {
+        const Int nb = Min(bsize,m-k);
+        const Range<Int> ind1( k, k+nb ), ind2( k+nb, m );
+
+        auto L11 = L( ind1, ind1 );
+        auto L21 = L( ind2, ind1 );
+        auto V1 = V( ind1, ALL );
+        auto V2 = V( ind2, ALL );
+
+        if( hyperbolic )
+            LowerDowndateUnb( L11, V1, householderScalars );
+        else
+            LowerUpdateUnb( L11, V1, householderScalars );
+        if( k+nb == m )
+            break;
+        PanelFactor
+        ( V1, householderScalars, hyperbolic, false, VSgn, VSgnConj, S );
+
+        // | L21 V2 | := | -(L21 - Z21) (-1)^nb (V2 - Z21 conj(VSgn)) |,
+        // where Z21 := (L21 +- V2 VSgn^T) inv(S)
+        Z21 = L21;
+        Gemm( NORMAL, TRANSPOSE, sign, V2, VSgn, F(1), Z21 );
+        Trsm( RIGHT, UPPER, NORMAL, NON_UNIT, F(1), S, Z21 );
+        L21 -= Z21;
+        L21 *= -1;
+        Gemm( NORMAL, NORMAL, F(-1), Z21, VSgnConj, F(1), V2 );
+        if( nb % 2 == 1 )
+            V2 *= -1;
+    }
+}
+
 template<typename F>
-void LowerDowndate( AbstractDistMatrix<F>& LPre, AbstractDistMatrix<F>& VPre )
+void LowerBlocked
+( AbstractDistMatrix<F>& LPre,
+  AbstractDistMatrix<F>& VPre,
+  bool hyperbolic )
 {
     EL_DEBUG_CSE
     EL_DEBUG_ONLY(
@@ -183,50 +221,100 @@ void LowerDowndate( AbstractDistMatrix<F>& LPre, AbstractDistMatrix<F>& VPre )
     auto& V = VProx.Get();
 
     const Int m = V.Height();
+    const F sign = ( hyperbolic ? F(-1) : F(1) );
     const Grid& grid = L.Grid();
-    DistMatrix<F,MC,STAR> z21_MC_STAR(grid), b21_MC_STAR(grid);
-    DistMatrix<F,STAR,MR> v1_STAR_MR(grid);
-
-    for( Int k=0; k<m; ++k )
+    DistMatrix<F,STAR,STAR> L11_STAR_STAR(grid), V1_STAR_STAR(grid),
+      VSgn_STAR_STAR(grid), VSgnConj_STAR_STAR(grid);
+    DistMatrix<F,MC,STAR> Z21_MC_STAR(grid), B21_MC_STAR(grid);
+    DistMatrix<F,STAR,MR> VSgn_STAR_MR(grid), VSgnConj_STAR_MR(grid);
+    Matrix<F> householderScalars, S;
+
+    const Int bsize = Blocksize();
+    for( Int k=0; k<m; k+=bsize )
     {
-        const IR ind1( k ), ind2( k+1, END );
+        const Int nb = Min(bsize,m-k);
+        const Range<Int> ind1( k, k+nb ), ind2( k+nb, m );
 
-        F lambda11 = L.Get( k, k );
-        auto l21 = L( ind2, ind1 );
-
-        auto v1 = V( ind1, ALL );
+        auto L11 = L( ind1, ind1 );
+        auto L21 = L( ind2, ind1 );
+        auto V1 = V( ind1, ALL );
         auto V2 = V( ind2, ALL );
 
-        // Find tau and u such that
-        //  | lambda11 u | /I - 1/tau Sigma | 1   | | 1 conj(u) |\ = | -beta 0 |
-        //                 \                | u^T |              /
-        // where Sigma = diag(+1,-1,...,-1) and beta >= 0
-        const F tau = RightHyperbolicReflector( lambda11, v1 );
-
-        // Apply the negative of the hyperbolic Householder reflector from the
-        // right:
-        // |l21 V2| := -|l21 V2| + 1/tau |l21 V2| Sigma |1  | |1 conj(u)|
-        //                                              |u^T|
-        //           = -|l21 V2| + 1/tau |l21 -V2| |1  | |1 conj(u)|
-        //                                         |u^T|
-        //           = -|l21 V2| + 1/tau |l21 - V2 u^T| |1 conj(u)|
-        L.Set( k, k, -lambda11 );
-        z21_MC_STAR.AlignWith( V2 );
-        b21_MC_STAR.AlignWith( V2 );
-        v1_STAR_MR.AlignWith( V2 );
-        z21_MC_STAR = l21;
-        v1_STAR_MR = v1;
-        Zeros( b21_MC_STAR, V2.Height(), 1 );
-        LocalGemv( NORMAL, F(-1), V2, v1_STAR_MR, F(0), b21_MC_STAR );
-        El::AllReduce( b21_MC_STAR, V2.RowComm() );
-        z21_MC_STAR += b21_MC_STAR;
-        l21 *= -1;
-        V2 *= -1;
-        Axpy( F(1)/tau, z21_MC_STAR, l21 );
-        LocalGer( F(1)/tau, z21_MC_STAR, v1_STAR_MR, V2 );
+        // Redundantly factor the diagonal block
+        L11_STAR_STAR = L11;
+        V1_STAR_STAR = V1;
+        if( hyperbolic )
+            LowerDowndateUnb
+            ( L11_STAR_STAR.Matrix(), V1_STAR_STAR.Matrix(),
+              householderScalars );
+        else
+            LowerUpdateUnb
+            ( L11_STAR_STAR.Matrix(), V1_STAR_STAR.Matrix(),
+              householderScalars );
+        L11 = L11_STAR_STAR;
+        V1 = V1_STAR_STAR;
+        if( k+nb == m )
+            break;
+        PanelFactor
+        ( V1_STAR_STAR.Matrix(), householderScalars, hyperbolic, false,
+          VSgn_STAR_STAR.Matrix(), VSgnConj_STAR_STAR.Matrix(), S );
+
+        VSgn_STAR_MR.AlignWith( V2 );
+        VSgnConj_STAR_MR.AlignWith( V2 );
+        Z21_MC_STAR.AlignWith( V2 );
+        B21_MC_STAR.AlignWith( V2 );
+        VSgn_STAR_MR = VSgn_STAR_STAR;
+        VSgnConj_STAR_MR = VSgnConj_STAR_STAR;
+
+        // Z21 := (L21 +- V2 VSgn^T) inv(S)
+        Zeros( B21_MC_STAR, V2.Height(), nb );
+        LocalGemm
+        ( NORMAL, TRANSPOSE, sign, V2, VSgn_STAR_MR, F(0), B21_MC_STAR );
+        El::AllReduce( B21_MC_STAR, V2.RowComm() );
+        Z21_MC_STAR = L21;
+        Z21_MC_STAR += B21_MC_STAR;
+        Trsm
+        ( RIGHT, UPPER, NORMAL, NON_UNIT,
+          F(1), S, Z21_MC_STAR.Matrix() );
+
+        // | L21 V2 | := | -(L21 - Z21) (-1)^nb (V2 - Z21 conj(VSgn)) |
+        Axpy( F(-1), Z21_MC_STAR, L21 );
+        L21 *= -1;
+        LocalGemm
+        ( NORMAL, NORMAL, F(-1), Z21_MC_STAR, VSgnConj_STAR_MR, F(1), V2 );
+        if( nb % 2 == 1 )
+            V2 *= -1;
     }
 }
 
+template<typename F>
+void LowerUpdate( Matrix<F>& L, Matrix<F>& V )
+{
+    EL_DEBUG_CSE
+    LowerBlocked( L, V, false );
+}
+
+template<typename F>
+void LowerUpdate( AbstractDistMatrix<F>& L, AbstractDistMatrix<F>& V )
+{
+    EL_DEBUG_CSE
+    LowerBlocked( L, V, false );
+}
+
+template<typename F>
+void LowerDowndate( Matrix<F>& L, Matrix<F>& V )
+{
+    EL_DEBUG_CSE
+    LowerBlocked( L, V, true );
+}
+
+template<typename F>
+void LowerDowndate( AbstractDistMatrix<F>& L, AbstractDistMatrix<F>& V )
+{
+    EL_DEBUG_CSE
+    LowerBlocked( L, V, true );
+}
+
 } // namespace mod
 
 template<typename F>
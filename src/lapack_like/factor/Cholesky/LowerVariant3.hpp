@@ -49,7 +49,7 @@ void LowerVariant3Blocked( Matrix<F>& A )
           LogicError("Can only compute Cholesky factor of square matrices");
     )
     const Int n = A.Height();
-    const Int bsize = Blocksize();
+    const Int bsize = Blocksize<F>( BLOCKSIZE_CHOLESKY );
     for( Int k=0; k<n; k+=bsize )
     {
         const Int nb = Min(bsize,n-k);
@@ -87,7 +87,7 @@ void LowerVariant3Blocked( AbstractDistMatrix<F>& APre )
     DistMatrix<F,STAR,MR  > A21Adj_STAR_MR(grid);
 
     const Int n = A.Height();
-    const Int bsize = Blocksize();
+    const Int bsize = Blocksize<F>( BLOCKSIZE_CHOLESKY, grid );
     for( Int k=0; k<n; k+=bsize )
     {
         const Int nb = Min(bsize,n-k);
@@ -125,6 +125,139 @@ void LowerVariant3Blocked( AbstractDistMatrix<F>& APre )
     }
 }
 
+// The redistributions of a factored panel whose gathers may still be in flight
+template<typename F>
+struct LowerLookaheadPanel
+{
+    DistMatrix<F,STAR,STAR> A11_STAR_STAR;
+    DistMatrix<F,VC,  STAR> A21_VC_STAR;
+    DistMatrix<F,VR,  STAR> A21_VR_STAR;
+    DistMatrix<F,MC,  STAR> A21_MC_STAR;
+    DistMatrix<F,MR,  STAR> A21_MR_STAR;
+    copy::AllGatherRequest<F> MCRequest, MRRequest;
+
+    LowerLookaheadPanel( const Grid& grid )
+    : A11_STAR_STAR(grid), A21_VC_STAR(grid), A21_VR_STAR(grid),
+      A21_MC_STAR(grid), A21_MR_STAR(grid)
+    { }
+};
+
+// Factor the diagonal block and the subdiagonal panel of the k'th block column
+// (whose entries must already be fully updated) and start the gathers of the
+// panel into [MC,* ] and [MR,* ]
+template<typename F>
+void LowerLookaheadFactorPanel
+( DistMatrix<F>& A, Int k, Int nb, LowerLookaheadPanel<F>& panel )
+{
+    EL_DEBUG_CSE
+    const Int n = A.Height();
+    const Range<Int> ind1( k,    k+nb ),
+                     ind2( k+nb, n    );
+
+    auto A11 = A( ind1, ind1 );
+    auto A21 = A( ind2, ind1 );
+    auto A22 = A( ind2, ind2 );
+
+    panel.A11_STAR_STAR = A11;
+    Cholesky( LOWER, panel.A11_STAR_STAR );
+    A11 = panel.A11_STAR_STAR;
+
+    panel.A21_VC_STAR.AlignWith( A22 );
+    panel.A21_VC_STAR = A21;
+    LocalTrsm
+    ( RIGHT, LOWER, ADJOINT, NON_UNIT,
+      F(1), panel.A11_STAR_STAR, panel.A21_VC_STAR );
+
+    panel.A21_VR_STAR.AlignWith( A22 );
+    panel.A21_VR_STAR = panel.A21_VC_STAR;
+    panel.A21_MC_STAR.AlignWith( A22 );
+    panel.A21_MR_STAR.AlignWith( A22 );
+    copy::BeginPartialColAllGather
+    ( panel.A21_VC_STAR, panel.A21_MC_STAR, panel.MCRequest );
+    copy::BeginPartialColAllGather
+    ( panel.A21_VR_STAR, panel.A21_MR_STAR, panel.MRRequest );
+}
+
+// A variant of LowerVariant3Blocked with a lookahead of one panel: the
+// columns of the trailing matrix which form the next panel are updated
+// first so that the next panel can be factored, and its gathers started,
+// before the rest of the trailing update (which they then overlap with)
+template<typename F>
+void LowerVariant3Lookahead( AbstractDistMatrix<F>& APre )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( APre.Height() != APre.Width() )
+          LogicError("Can only compute Cholesky factor of square matrices");
+    )
+    EL_PROFILE_REGION("cholesky::LowerVariant3Lookahead");
+    const Grid& grid = APre.Grid();
+
+    DistMatrixReadWriteProxy<F,F,MC,MR> AProx( APre );
+    auto& A = AProx.Get();
+
+    LowerLookaheadPanel<F> panelA(grid), panelB(grid);
+    LowerLookaheadPanel<F>* panel = &panelA;
+    LowerLookaheadPanel<F>* nextPanel = &panelB;
+    DistMatrix<F,STAR,MC> A21Trans_STAR_MC(grid);
+    DistMatrix<F,STAR,MR> A21Adj_STAR_MR(grid);
+
+    const Int n = A.Height();
+    const Int bsize = Blocksize<F>( BLOCKSIZE_CHOLESKY, grid );
+    if( n == 0 )
+        return;
+    LowerLookaheadFactorPanel( A, 0, Min(bsize,n), *panel );
+    for( Int k=0; k<n; k+=bsize )
+    {
+        const Int nb = Min(bsize,n-k);
+
+        const Range<Int> ind1( k,    k+nb ),
+                         ind2( k+nb, n    );
+
+        auto A21 = A( ind2, ind1 );
+        auto A22 = A( ind2, ind2 );
+
+        copy::FinishPartialColAllGather
+        ( panel->A21_VC_STAR, panel->A21_MC_STAR, panel->MCRequest );
+        copy::FinishPartialColAllGather
+        ( panel->A21_VR_STAR, panel->A21_MR_STAR, panel->MRRequest );
+        A21Trans_STAR_MC.AlignWith( A22 );
+        A21Adj_STAR_MR.AlignWith( A22 );
+        Transpose( panel->A21_MC_STAR, A21Trans_STAR_MC );
+        Adjoint( panel->A21_MR_STAR, A21Adj_STAR_MR );
+
+        if( k+nb < n )
+        {
+            const Int nbNext = Min(bsize,n-(k+nb));
+            const Range<Int> indNext1( 0, nbNext ), indNext2( nbNext, END );
+
+            auto A21Trans_STAR_MC1 = A21Trans_STAR_MC( ALL, indNext1 );
+            auto A21Trans_STAR_MC2 = A21Trans_STAR_MC( ALL, indNext2 );
+            auto A21Adj_STAR_MR1 = A21Adj_STAR_MR( ALL, indNext1 );
+            auto A21Adj_STAR_MR2 = A21Adj_STAR_MR( ALL, indNext2 );
+            auto A22_11 = A22( indNext1, indNext1 );
+            auto A22_21 = A22( indNext2, indNext1 );
+            auto A22_22 = A22( indNext2, indNext2 );
+
+            // Update the next block column and start its redistributions
+            LocalTrrk
+            ( LOWER, TRANSPOSE,
+              F(-1), A21Trans_STAR_MC1, A21Adj_STAR_MR1, F(1), A22_11 );
+            LocalGemm
+            ( TRANSPOSE, NORMAL,
+              F(-1), A21Trans_STAR_MC2, A21Adj_STAR_MR1, F(1), A22_21 );
+            LowerLookaheadFactorPanel( A, k+nb, nbNext, *nextPanel );
+
+            LocalTrrk
+            ( LOWER, TRANSPOSE,
+              F(-1), A21Trans_STAR_MC2, A21Adj_STAR_MR2, F(1), A22_22 );
+        }
+
+        Transpose( A21Trans_STAR_MC, A21 );
+        std::swap( panel, nextPanel );
+    }
+}
+
 } // namespace cholesky
 } // namespace El
 
@@ -9,15 +9,14 @@
 #ifndef EL_CHOLESKY_UPPER_MOD_HPP
 #define EL_CHOLESKY_UPPER_MOD_HPP
 
-// TODO: Blocked algorithms
-
 namespace El {
 namespace cholesky {
 
 namespace mod {
 
 template<typename F>
-void UpperUpdate( Matrix<F>& U, Matrix<F>& V )
+void UpperUpdateUnb
+( Matrix<F>& U, Matrix<F>& V, Matrix<F>& householderScalars )
 {
     EL_DEBUG_CSE
     EL_DEBUG_ONLY(
@@ -27,6 +26,7 @@ void UpperUpdate( Matrix<F>& U, Matrix<F>& V )
           LogicError("V is the wrong height");
     )
     const Int m = V.Height();
+    householderScalars.Resize( m, 1 );
 
     Matrix<F> z12;
 
@@ -46,6 +46,7 @@ void UpperUpdate( Matrix<F>& U, Matrix<F>& V )
         // where beta >= 0
         Conjugate( v1 );
         const F tau = LeftReflector( upsilon11, v1 );
+        householderScalars(k) = tau;
 
         // Apply the negative of the Householder reflector from the left:
         // | u12  | := -| u12  | + tau | 1 | | 1 w^H | | u12  |
@@ -70,79 +71,8 @@ void UpperUpdate( Matrix<F>& U, Matrix<F>& V )
 }
 
 template<typename F>
-void UpperUpdate
-( AbstractDistMatrix<F>& UPre,
-  AbstractDistMatrix<F>& VPre )
-{
-    EL_DEBUG_CSE
-    EL_DEBUG_ONLY(
-      if( UPre.Height() != UPre.Width() )
-          LogicError("Cholesky factors must be square");
-      if( VPre.Height() != UPre.Height() )
-          LogicError("V is the wrong height");
-      AssertSameGrids( UPre, VPre );
-    )
-
-    DistMatrixReadWriteProxy<F,F,MC,MR> UProx( UPre ), VProx( VPre );
-    auto& U = UProx.Get();
-    auto& V = VProx.Get();
-
-    const Int m = V.Height();
-    const Grid& g = U.Grid();
-    DistMatrix<F,STAR,MC> z12_STAR_MC(g), b12_STAR_MC(g);
-    DistMatrix<F,STAR,MR> v1_STAR_MR(g);
-
-    for( Int k=0; k<m; ++k )
-    {
-        const IR ind1( k ), ind2( k+1, END );
-
-        F upsilon11 = U.Get(k,k);
-        auto u12 = U( ind1, ind2 );
-
-        auto v1 = V( ind1, ALL );
-        auto V2 = V( ind2, ALL );
-
-        // Find tau and w such that
-        //  /I - tau | 1 | | 1 w^H | \ | upsilon11 | = | -beta |
-        //  \        | w |           / | v1^H      |   | 0     |
-        // where beta >= 0
-        Conjugate( v1 );
-        // LeftReflector assumes that v1 is a column-vector, so conjugate
-        // the RightReflector result
-        const F tau = RightReflector( upsilon11, v1 );
-        Conjugate( v1 );
-
-        // Apply the negative of the Householder reflector from the left:
-        // | u12  | := -| u12  | + tau | 1 | | 1 w^H | | u12  |
-        // | V2^H |     | V2^H |       | w |           | V2^H |
-        //
-        //           = -| u12  | + tau | 1 | (u12 + w^H V2^H)
-        //              | V2^H |       | w |
-        // Thus,
-        //    u12 := -u12 + tau (u12 + w^H V2^H), and
-        //    V2^H := -V2^H + tau w (u12 + w^H V2^H),
-        //    V2   := -V2 + conj(tau) (u12^H + V2 w) w^H
-        //
-        U.Set( k, k, -upsilon11 );
-        z12_STAR_MC.AlignWith( V2 );
-        b12_STAR_MC.AlignWith( V2 );
-        v1_STAR_MR.AlignWith( V2 );
-        Conjugate( u12, z12_STAR_MC );
-        v1_STAR_MR = v1;
-        Zeros( b12_STAR_MC, 1, V2.Height() );
-        LocalGemv( NORMAL, F(1), V2, v1_STAR_MR, F(0), b12_STAR_MC );
-        El::AllReduce( b12_STAR_MC, V2.RowComm() );
-        z12_STAR_MC += b12_STAR_MC;
-        V2 *= -1;
-        LocalGer( Conj(tau), z12_STAR_MC, v1_STAR_MR, V2 );
-        Conjugate( z12_STAR_MC );
-        u12 *= -1;
-        Axpy( tau, z12_STAR_MC, u12 );
-    }
-}
-
-template<typename F>
-void UpperDowndate( Matrix<F>& U, Matrix<F>& V )
+void UpperDowndateUnb
+( Matrix<F>& U, Matrix<F>& V, Matrix<F>& householderScalars )
 {
     EL_DEBUG_CSE
     EL_DEBUG_ONLY(
@@ -152,6 +82,7 @@ void UpperDowndate( Matrix<F>& U, Matrix<F>& V )
           LogicError("V is the wrong height");
     )
     const Int m = V.Height();
+    householderScalars.Resize( m, 1 );
 
     Matrix<F> z12;
 
@@ -171,6 +102,7 @@ void UpperDowndate( Matrix<F>& U, Matrix<F>& V )
         // where Sigma = diag(+1,-1,...,-1) and beta >= 0
         Conjugate( v1 );
         const F tau = LeftHyperbolicReflector( upsilon11, v1 );
+        householderScalars(k) = tau;
 
         // Apply the negative of the Householder reflector from the left:
         // | u12  | := -| u12  | + 1/tau | 1 | | 1 w^H | Sigma | u12  |
@@ -194,9 +126,61 @@ void UpperDowndate( Matrix<F>& U, Matrix<F>& V )
     }
 }
 
+// Blocked variants which mirror those of LowerMod.hpp, but with the
+// panel's transformations applied from the left to | U12; V2^H |
+template<typename F>
+void UpperBlocked( Matrix<F>& U, Matrix<F>& V, bool hyperbolic )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( U.Height() != U.Width() )
+          LogicError("Cholesky factors must be square");
+      if( V.Height() != U.Height() )
+          LogicError("V is the wrong height");
+    )
+    const Int m = V.Height();
+    const F sign = ( hyperbolic ? F(-1) : F(1) );
+
+    Matrix<F> householderScalars, VSgn, VSgnConj, S, Y12;
+
+    const Int bsize = Blocksize();
+    for( Int k=0; k<m; k+=bsize )
+    {
+        const Int nb = Min(bsize,m-k);
+        const Range<Int> ind1( k, k+nb ), ind2( k+nb, m );
+
+        auto U11 = U( ind1, ind1 );
+        auto U12 = U( ind1, ind2 );
+        auto V1 = V( ind1, ALL );
+        auto V2 = V( ind2, ALL );
+
+        if( hyperbolic )
+            UpperDowndateUnb( U11, V1, householderScalars );
+        else
+            UpperUpdateUnb( U11, V1, householderScalars );
+        if( k+nb == m )
+            break;
+        PanelFactor
+        ( V1, householderScalars, hyperbolic, true, VSgn, VSgnConj, S );
+
+        // | U12; V2^H | := | -(U12 - Y12); (-1)^nb (V2^H - VSgn^T Y12) |,
+        // where Y12 := inv(S)^H (U12 +- conj(VSgn) V2^H)
+        Y12 = U12;
+        Gemm( NORMAL, ADJOINT, sign, VSgnConj, V2, F(1), Y12 );
+        Trsm( LEFT, UPPER, ADJOINT, NON_UNIT, F(1), S, Y12 );
+        U12 -= Y12;
+        U12 *= -1;
+        Gemm( ADJOINT, NORMAL, F(-1), Y12, VSgnConj, F(1), V2 );
+        if( nb % 2 == 1 )
+            V2 *= -1;
+    }
+}
+
 template<typename F>
-void UpperDowndate
-( AbstractDistMatrix<F>& UPre, AbstractDistMatrix<F>& VPre )
+void UpperBlocked
+( AbstractDistMatrix<F>& UPre,
+  AbstractDistMatrix<F>& VPre,
+  bool hyperbolic )
 {
     EL_DEBUG_CSE
     EL_DEBUG_ONLY(
@@ -212,59 +196,98 @@ void UpperDowndate
     auto& V = VProx.Get();
 
     const Int m = V.Height();
+    const F sign = ( hyperbolic ? F(-1) : F(1) );
     const Grid& g = U.Grid();
-    DistMatrix<F,STAR,MC> z12_STAR_MC(g), b12_STAR_MC(g);
-    DistMatrix<F,STAR,MR> v1_STAR_MR(g);
-
-    for( Int k=0; k<m; ++k )
+    DistMatrix<F,STAR,STAR> U11_STAR_STAR(g), V1_STAR_STAR(g),
+      VSgn_STAR_STAR(g), VSgnConj_STAR_STAR(g);
+    DistMatrix<F,STAR,MC> Y12_STAR_MC(g), B12_STAR_MC(g);
+    DistMatrix<F,STAR,MR> VSgnConj_STAR_MR(g);
+    Matrix<F> householderScalars, S;
+
+    const Int bsize = Blocksize();
+    for( Int k=0; k<m; k+=bsize )
     {
-        const IR ind1( k ), ind2( k+1, END );
+        const Int nb = Min(bsize,m-k);
+        const Range<Int> ind1( k, k+nb ), ind2( k+nb, m );
 
-        F upsilon11 = U.Get(k,k);
-        auto u12 = U( ind1, ind2 );
-
-        auto v1 = V( ind1, ALL );
+        auto U11 = U( ind1, ind1 );
+        auto U12 = U( ind1, ind2 );
+        auto V1 = V( ind1, ALL );
         auto V2 = V( ind2, ALL );
 
-        // Find tau and w such that
-        //  /I - 1/tau | 1 | | 1 w^H | Sigma \ | upsilon11 | = | -beta |
-        //  \          | w |                 / | v1^H      |   | 0     |
-        // where Sigma = diag(+1,-1,...,-1) and beta >= 0
-        // Since LeftHyperbolicReflector expects v1 to be a column vector,
-        // use the Right variant and conjugate the result
-        Conjugate( v1 );
-        const F tau = RightHyperbolicReflector( upsilon11, v1 );
-        Conjugate( v1 );
-
-        // Apply the negative of the Householder reflector from the left:
-        // | u12  | := -| u12  | + 1/tau | 1 | | 1 w^H | Sigma | u12  |
-        // | V2^H |     | V2^H |         | w |                 | V2^H |
-        //
-        //           = -| u12  | + 1/tau | 1 | (u12 - w^H V2^H)
-        //              | V2^H |         | w |
-        // Thus,
-        //    u12 := -u12 + 1/tau (u12 - w^H V2^H), and
-        //    V2^H := -V2^H + 1/tau w (u12 - w^H V2^H),
-        //    V2   := -V2 + 1/tau (u12^H - V2 w) w^H
-        //
-        U.Set( k, k, -upsilon11 );
-        z12_STAR_MC.AlignWith( V2 );
-        b12_STAR_MC.AlignWith( V2 );
-        v1_STAR_MR.AlignWith( V2 );
-        Conjugate( u12, z12_STAR_MC );
-        v1_STAR_MR = v1;
-        Zeros( b12_STAR_MC, 1, V2.Height() );
-        LocalGemv( NORMAL, F(-1), V2, v1_STAR_MR, F(0), b12_STAR_MC );
-        El::AllReduce( b12_STAR_MC, V2.RowComm() );
-        z12_STAR_MC += b12_STAR_MC;
-        u12 *= -1;
-        V2 *= -1;
-        LocalGer( F(1)/tau, z12_STAR_MC, v1_STAR_MR, V2 );
-        Conjugate( z12_STAR_MC );
-        Axpy( F(1)/tau, z12_STAR_MC, u12 );
+        // Redundantly factor the diagonal block
+        U11_STAR_STAR = U11;
+        V1_STAR_STAR = V1;
+        if( hyperbolic )
+            UpperDowndateUnb
+            ( U11_STAR_STAR.Matrix(), V1_STAR_STAR.Matrix(),
+              householderScalars );
+        else
+            UpperUpdateUnb
+            ( U11_STAR_STAR.Matrix(), V1_STAR_STAR.Matrix(),
+              householderScalars );
+        U11 = U11_STAR_STAR;
+        V1 = V1_STAR_STAR;
+        if( k+nb == m )
+            break;
+        PanelFactor
+        ( V1_STAR_STAR.Matrix(), householderScalars, hyperbolic, true,
+          VSgn_STAR_STAR.Matrix(), VSgnConj_STAR_STAR.Matrix(), S );
+
+        VSgnConj_STAR_MR.AlignWith( V2 );
+        Y12_STAR_MC.AlignWith( V2 );
+        B12_STAR_MC.AlignWith( V2 );
+        VSgnConj_STAR_MR = VSgnConj_STAR_STAR;
+
+        // Y12 := inv(S)^H (U12 +- conj(VSgn) V2^H)
+        Zeros( B12_STAR_MC, nb, V2.Height() );
+        LocalGemm
+        ( NORMAL, ADJOINT, sign, VSgnConj_STAR_MR, V2, F(0), B12_STAR_MC );
+        El::AllReduce( B12_STAR_MC, V2.RowComm() );
+        Y12_STAR_MC = U12;
+        Y12_STAR_MC += B12_STAR_MC;
+        Trsm
+        ( LEFT, UPPER, ADJOINT, NON_UNIT,
+          F(1), S, Y12_STAR_MC.Matrix() );
+
+        // | U12; V2^H | := | -(U12 - Y12); (-1)^nb (V2^H - VSgn^T Y12) |
+        Axpy( F(-1), Y12_STAR_MC, U12 );
+        U12 *= -1;
+        LocalGemm
+        ( ADJOINT, NORMAL, F(-1), Y12_STAR_MC, VSgnConj_STAR_MR, F(1), V2 );
+        if( nb % 2 == 1 )
+            V2 *= -1;
     }
 }
 
+template<typename F>
+void UpperUpdate( Matrix<F>& U, Matrix<F>& V )
+{
+    EL_DEBUG_CSE
+    UpperBlocked( U, V, false );
+}
+
+template<typename F>
+void UpperUpdate( AbstractDistMatrix<F>& U, AbstractDistMatrix<F>& V )
+{
+    EL_DEBUG_CSE
+    UpperBlocked( U, V, false );
+}
+
+template<typename F>
+void UpperDowndate( Matrix<F>& U, Matrix<F>& V )
+{
+    EL_DEBUG_CSE
+    UpperBlocked( U, V, true );
+}
+
+template<typename F>
+void UpperDowndate( AbstractDistMatrix<F>& U, AbstractDistMatrix<F>& V )
+{
+    EL_DEBUG_CSE
+    UpperBlocked( U, V, true );
+}
+
 } // namespace mod
 
 template<typename F>
@@ -54,7 +54,7 @@ void UpperVariant3Blocked( Matrix<F>& A )
           LogicError("Can only compute Cholesky factor of square matrices");
     )
     const Int n = A.Height();
-    const Int bsize = Blocksize();
+    const Int bsize = Blocksize<F>( BLOCKSIZE_CHOLESKY );
     for( Int k=0; k<n; k+=bsize )
     {
         const Int nb = Min(bsize,n-k);
@@ -91,7 +91,7 @@ void UpperVariant3Blocked( AbstractDistMatrix<F>& APre )
     DistMatrix<F,STAR,MR  > A12_STAR_MR(grid);
 
     const Int n = A.Height();
-    const Int bsize = Blocksize();
+    const Int bsize = Blocksize<F>( BLOCKSIZE_CHOLESKY, grid );
     for( Int k=0; k<n; k+=bsize )
     {
         const Int nb = Min(bsize,n-k);
@@ -122,6 +122,131 @@ void UpperVariant3Blocked( AbstractDistMatrix<F>& APre )
     }
 }
 
+// The redistributions of a factored panel whose gathers may still be in flight
+template<typename F>
+struct UpperLookaheadPanel
+{
+    DistMatrix<F,STAR,STAR> A11_STAR_STAR;
+    DistMatrix<F,STAR,VR  > A12_STAR_VR;
+    DistMatrix<F,STAR,VC  > A12_STAR_VC;
+    DistMatrix<F,STAR,MC  > A12_STAR_MC;
+    DistMatrix<F,STAR,MR  > A12_STAR_MR;
+    copy::AllGatherRequest<F> MCRequest, MRRequest;
+
+    UpperLookaheadPanel( const Grid& grid )
+    : A11_STAR_STAR(grid), A12_STAR_VR(grid), A12_STAR_VC(grid),
+      A12_STAR_MC(grid), A12_STAR_MR(grid)
+    { }
+};
+
+// Factor the diagonal block and the superdiagonal panel of the k'th block
+// row (whose entries must already be fully updated) and start the gathers of
+// the panel into [* ,MC] and [* ,MR]
+template<typename F>
+void UpperLookaheadFactorPanel
+( DistMatrix<F>& A, Int k, Int nb, UpperLookaheadPanel<F>& panel )
+{
+    EL_DEBUG_CSE
+    const Int n = A.Height();
+    const Range<Int> ind1( k,    k+nb ),
+                     ind2( k+nb, n    );
+
+    auto A11 = A( ind1, ind1 );
+    auto A12 = A( ind1, ind2 );
+    auto A22 = A( ind2, ind2 );
+
+    panel.A11_STAR_STAR = A11;
+    Cholesky( UPPER, panel.A11_STAR_STAR );
+    A11 = panel.A11_STAR_STAR;
+
+    panel.A12_STAR_VR.AlignWith( A22 );
+    panel.A12_STAR_VR = A12;
+    LocalTrsm
+    ( LEFT, UPPER, ADJOINT, NON_UNIT,
+      F(1), panel.A11_STAR_STAR, panel.A12_STAR_VR );
+
+    panel.A12_STAR_VC.AlignWith( A22 );
+    panel.A12_STAR_VC = panel.A12_STAR_VR;
+    panel.A12_STAR_MC.AlignWith( A22 );
+    panel.A12_STAR_MR.AlignWith( A22 );
+    copy::BeginPartialRowAllGather
+    ( panel.A12_STAR_VC, panel.A12_STAR_MC, panel.MCRequest );
+    copy::BeginPartialRowAllGather
+    ( panel.A12_STAR_VR, panel.A12_STAR_MR, panel.MRRequest );
+}
+
+// A variant of UpperVariant3Blocked with a lookahead of one panel (see
+// LowerVariant3Lookahead)
+template<typename F>
+void UpperVariant3Lookahead( AbstractDistMatrix<F>& APre )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( APre.Height() != APre.Width() )
+          LogicError("Can only compute Cholesky factor of square matrices");
+    )
+    EL_PROFILE_REGION("cholesky::UpperVariant3Lookahead");
+    const Grid& grid = APre.Grid();
+
+    DistMatrixReadWriteProxy<F,F,MC,MR> AProx( APre );
+    auto& A = AProx.Get();
+
+    UpperLookaheadPanel<F> panelA(grid), panelB(grid);
+    UpperLookaheadPanel<F>* panel = &panelA;
+    UpperLookaheadPanel<F>* nextPanel = &panelB;
+
+    const Int n = A.Height();
+    const Int bsize = Blocksize<F>( BLOCKSIZE_CHOLESKY, grid );
+    if( n == 0 )
+        return;
+    UpperLookaheadFactorPanel( A, 0, Min(bsize,n), *panel );
+    for( Int k=0; k<n; k+=bsize )
+    {
+        const Int nb = Min(bsize,n-k);
+
+        const Range<Int> ind1( k,    k+nb ),
+                         ind2( k+nb, n    );
+
+        auto A12 = A( ind1, ind2 );
+        auto A22 = A( ind2, ind2 );
+
+        copy::FinishPartialRowAllGather
+        ( panel->A12_STAR_VC, panel->A12_STAR_MC, panel->MCRequest );
+        copy::FinishPartialRowAllGather
+        ( panel->A12_STAR_VR, panel->A12_STAR_MR, panel->MRRequest );
+
+        if( k+nb < n )
+        {
+            const Int nbNext = Min(bsize,n-(k+nb));
+            const Range<Int> indNext1( 0, nbNext ), indNext2( nbNext, END );
+
+            auto A12_STAR_MC1 = panel->A12_STAR_MC( ALL, indNext1 );
+            auto A12_STAR_MC2 = panel->A12_STAR_MC( ALL, indNext2 );
+            auto A12_STAR_MR1 = panel->A12_STAR_MR( ALL, indNext1 );
+            auto A12_STAR_MR2 = panel->A12_STAR_MR( ALL, indNext2 );
+            auto A22_11 = A22( indNext1, indNext1 );
+            auto A22_12 = A22( indNext1, indNext2 );
+            auto A22_22 = A22( indNext2, indNext2 );
+
+            // Update the next block row and start its redistributions
+            LocalTrrk
+            ( UPPER, ADJOINT,
+              F(-1), A12_STAR_MC1, A12_STAR_MR1, F(1), A22_11 );
+            LocalGemm
+            ( ADJOINT, NORMAL,
+              F(-1), A12_STAR_MC1, A12_STAR_MR2, F(1), A22_12 );
+            UpperLookaheadFactorPanel( A, k+nb, nbNext, *nextPanel );
+
+            LocalTrrk
+            ( UPPER, ADJOINT,
+              F(-1), A12_STAR_MC2, A12_STAR_MR2, F(1), A22_22 );
+        }
+
+        A12 = panel->A12_STAR_MR;
+        std::swap( panel, nextPanel );
+    }
+}
+
 } // namespace cholesky
 } // namespace El
 
@@ -35,6 +35,32 @@ InertiaType Inertia( const Matrix<Base<F>>& d, const Matrix<F>& dSub )
     InertiaType inertia;
     inertia.numPositive = inertia.numNegative = inertia.numZero = 0;
 
+    if( IsTridiagonal( dSub ) )
+    {
+        // The T from Aasen's method is Hermitian tridiagonal, so its inertia
+        // follows from the signs of the pivots of its unpivoted LDL^H
+        // factorization (Sylvester's law of inertia), with exactly zero
+        // pivots replaced by the smallest normalized value
+        Real delta = 0;
+        for( Int i=0; i<n; ++i )
+        {
+            const Real deltaPrev = delta;
+            delta = d(i);
+            if( i > 0 )
+                delta -= Abs(dSub(i-1))*Abs(dSub(i-1)) / deltaPrev;
+            if( delta > Real(0) )
+                ++inertia.numPositive;
+            else if( delta < Real(0) )
+                ++inertia.numNegative;
+            else
+            {
+                ++inertia.numZero;
+                delta = limits::Min<Real>();
+            }
+        }
+        return inertia;
+    }
+
     Int k=0;
     while( k < n )
     {
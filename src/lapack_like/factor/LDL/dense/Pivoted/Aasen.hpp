@@ -0,0 +1,256 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_LDL_PIVOTED_AASEN_HPP
+#define EL_LDL_PIVOTED_AASEN_HPP
+
+// A blocked, right-looking variant of Aasen's algorithm for computing
+//
+//   P A P^T = L T L^{T/H},
+//
+// where L is unit lower-triangular with first column e_0 and T is
+// symmetric/Hermitian tridiagonal.
+//
+// Unlike Bunch-Kaufman, the pivot search of each column only involves the
+// already-formed column of the panel (partial pivoting), and so the symmetric
+// swaps never need to look ahead into the trailing matrix. If the first k
+// columns have been processed, the Hermitian trailing matrix
+//
+//   A(k:n,k:n) - L(k:n,0:k) T(0:k,0:k) L(k:n,0:k)'
+//
+// minus the rank-two coupling through T(k-1,k) is exactly
+// L(k:n,k:n) T(k:n,k:n) L(k:n,k:n)', which lets each panel be factored
+// (left-looking) from its own columns and then applied to the trailing
+// matrix with a single Trrk with the panel's columns of L extended by the
+// next column of L.
+//
+// On exit, the strictly lower triangle of A contains L, the diagonal of A
+// contains the diagonal of T, and dSub contains the subdiagonal of T.
+
+namespace El {
+namespace ldl {
+namespace pivot {
+
+template<typename F>
+void
+Aasen
+( Matrix<F>& A,
+  Matrix<F>& dSub,
+  Permutation& P,
+  bool conjugate=false )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( A.Height() != A.Width() )
+          LogicError("A must be square");
+    )
+    const Int n = A.Height();
+    const Orientation orientation = ( conjugate ? ADJOINT : TRANSPOSE );
+    auto cj = [&]( const F& alpha ) { return conjugate ? Conj(alpha) : alpha; };
+
+    P.MakeIdentity( n );
+    P.ReserveSwaps( n );
+
+    if( n == 0 )
+    {
+        dSub.Resize( 0, 1 );
+        return;
+    }
+    Zeros( dSub, n-1, 1 );
+
+    // The columns L(k:n,k:k+nb+1) of the current panel
+    Matrix<F> LPan, lNext, h, v, TExt, Z;
+
+    const Int bsize = Blocksize();
+    for( Int k=0; k<n; k+=bsize )
+    {
+        const Int nb = Min(bsize,n-k);
+        const Int kNext = k + nb;
+
+        Zeros( LPan, n-k, nb+1 );
+        if( k == 0 )
+            LPan(0,0) = F(1);
+        else
+        {
+            auto lPan0 = LPan( ALL, IR(0) );
+            lPan0 = lNext;
+        }
+
+        for( Int c=0; c<nb; ++c )
+        {
+            const Int j = k + c;
+
+            // h := T(k:j,k:j+1) L(j,k:j+1)', followed by H(j,j), which
+            // determines T(j,j)
+            Zeros( h, c+1, 1 );
+            for( Int i=0; i<c; ++i )
+            {
+                F eta = A(k+i,k+i)*cj(LPan(c,i)) +
+                        cj(dSub(k+i))*cj(LPan(c,i+1));
+                if( i > 0 )
+                    eta += dSub(k+i-1)*cj(LPan(c,i-1));
+                h(i) = eta;
+            }
+            F hDiag = A(j,j);
+            for( Int i=0; i<c; ++i )
+                hDiag -= LPan(c,i)*h(i);
+            h(c) = hDiag;
+
+            F tau = hDiag;
+            if( c > 0 )
+                tau -= dSub(j-1)*cj(LPan(c,c-1));
+            if( conjugate )
+                tau = RealPart(tau);
+            A(j,j) = tau;
+            if( j == n-1 )
+                break;
+
+            // v := A(j+1:n,j) - L(j+1:n,k:j+1) h
+            v = A( IR(j+1,n), IR(j) );
+            Gemv
+            ( NORMAL,
+              F(-1), LPan( IR(c+1,END), IR(0,c+1) ), h,
+              F(1),  v );
+
+            // Bring the largest entry of v into position j+1
+            const Int from = j+1 + VectorMaxAbsLoc(v).index;
+            if( from != j+1 )
+            {
+                SymmetricSwap( LOWER, A, j+1, from, conjugate );
+                P.Swap( j+1, from );
+                RowSwap( v, 0, from-(j+1) );
+                RowSwap( LPan, c+1, from-k );
+            }
+
+            // T(j+1,j) := v(0) and L(j+2:n,j+1) := v(1:end) / v(0)
+            const F upsilon = v(0);
+            dSub(j) = upsilon;
+            LPan(c+1,c+1) = F(1);
+            if( upsilon != F(0) )
+            {
+                auto l21 = LPan( IR(c+2,END), IR(c+1) );
+                l21 = v( IR(1,END), ALL );
+                l21 *= F(1)/upsilon;
+            }
+        }
+
+        // Store L(k+1:n,k:kNext), where L(:,0) = e_0
+        for( Int c=0; c<nb; ++c )
+        {
+            auto a21 = A( IR(k+c+1,n), IR(k+c) );
+            if( k+c == 0 )
+                Zero( a21 );
+            else
+                a21 = LPan( IR(c+1,END), IR(c) );
+        }
+        if( kNext == n )
+            break;
+
+        // A22 -= W TExt W', where W = L(kNext:n,k:kNext+1) and TExt is
+        // T(k:kNext+1,k:kNext+1) with its last diagonal entry zeroed so that
+        // the coupling through T(kNext-1,kNext) is also removed
+        Zeros( TExt, nb+1, nb+1 );
+        for( Int i=0; i<nb; ++i )
+        {
+            TExt(i,i) = A(k+i,k+i);
+            TExt(i+1,i) = dSub(k+i);
+            TExt(i,i+1) = cj(dSub(k+i));
+        }
+        auto W = LPan( IR(nb,END), ALL );
+        auto A22 = A( IR(kNext,n), IR(kNext,n) );
+        Gemm( NORMAL, NORMAL, F(1), W, TExt, Z );
+        Trrk( LOWER, NORMAL, orientation, F(-1), Z, W, F(1), A22 );
+
+        lNext = LPan( IR(nb,END), IR(nb) );
+    }
+}
+
+} // namespace pivot
+
+// The subdiagonals returned by Bunch-Kaufman-like pivoting never contain two
+// consecutive nonzeros, whereas that of the T from Aasen's method generally
+// does
+template<typename F>
+bool IsTridiagonal( const Matrix<F>& dSub )
+{
+    EL_DEBUG_CSE
+    const Int numSub = dSub.Height();
+    for( Int i=1; i<numSub; ++i )
+        if( dSub(i-1) != F(0) && dSub(i) != F(0) )
+            return true;
+    return false;
+}
+
+// Overwrite B with inv(T) B, where T is the symmetric/Hermitian tridiagonal
+// matrix with diagonal d and subdiagonal dSub, via Gaussian elimination with
+// partial pivoting (as in LAPACK's ?gtsv)
+template<typename F>
+void TridiagonalSolve
+( const Matrix<F>& d, const Matrix<F>& dSub, Matrix<F>& B, bool conjugated )
+{
+    EL_DEBUG_CSE
+    const Int n = d.Height();
+    const Int numRHS = B.Width();
+    if( n == 0 )
+        return;
+
+    // The diagonal, subdiagonal, and first and second superdiagonals of U
+    vector<F> diag(n), sub(n-1), sup(n-1), sup2(Max(n-2,Int(0)),F(0));
+    for( Int i=0; i<n; ++i )
+        diag[i] = d(i);
+    for( Int i=0; i<n-1; ++i )
+    {
+        sub[i] = dSub(i);
+        sup[i] = ( conjugated ? Conj(dSub(i)) : dSub(i) );
+    }
+
+    for( Int i=0; i<n-1; ++i )
+    {
+        if( Abs(diag[i]) >= Abs(sub[i]) )
+        {
+            const F mult = sub[i] / diag[i];
+            diag[i+1] -= mult*sup[i];
+            for( Int j=0; j<numRHS; ++j )
+                B(i+1,j) -= mult*B(i,j);
+        }
+        else
+        {
+            // Interchange rows i and i+1
+            const F mult = diag[i] / sub[i];
+            diag[i] = sub[i];
+            const F temp = diag[i+1];
+            diag[i+1] = sup[i] - mult*temp;
+            if( i < n-2 )
+            {
+                sup2[i] = sup[i+1];
+                sup[i+1] = -mult*sup2[i];
+            }
+            sup[i] = temp;
+            for( Int j=0; j<numRHS; ++j )
+            {
+                const F beta = B(i,j);
+                B(i,j) = B(i+1,j);
+                B(i+1,j) = beta - mult*B(i+1,j);
+            }
+        }
+    }
+
+    for( Int j=0; j<numRHS; ++j )
+    {
+        B(n-1,j) /= diag[n-1];
+        if( n > 1 )
+            B(n-2,j) = (B(n-2,j) - sup[n-2]*B(n-1,j)) / diag[n-2];
+        for( Int i=n-3; i>=0; --i )
+            B(i,j) = (B(i,j) - sup[i]*B(i+1,j) - sup2[i]*B(i+2,j)) / diag[i];
+    }
+}
+
+} // namespace ldl
+} // namespace El
+
+#endif // ifndef EL_LDL_PIVOTED_AASEN_HPP
@@ -78,7 +78,10 @@ void SolveAfter
 
     P.PermuteRows( B );
     Trsm( LEFT, LOWER, NORMAL, UNIT, F(1), A, B );
-    QuasiDiagonalSolve( LEFT, LOWER, d, dSub, B, conjugated );
+    if( IsTridiagonal( dSub ) )
+        TridiagonalSolve( d, dSub, B, conjugated );
+    else
+        QuasiDiagonalSolve( LEFT, LOWER, d, dSub, B, conjugated );
     Trsm( LEFT, LOWER, orientation, UNIT, F(1), A, B );
     P.InversePermuteRows( B );
 }
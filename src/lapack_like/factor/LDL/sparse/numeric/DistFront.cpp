@@ -280,15 +280,19 @@ void DistFront<Field>::Pull
       conjugate );
 }
 
+// If 'pattern' is non-null, it is overwritten with the communication pattern
+// of the redistribution
 template<typename Field>
-void DistFront<Field>::Pull
-( const DistSparseMatrix<Field>& A,
+void PullAndFormPattern
+(       DistFront<Field>& front,
+  const DistSparseMatrix<Field>& A,
   const DistMap& reordering,
   const DistSeparator& rootSep,
   const DistNodeInfo& rootInfo,
         vector<Int>& mappedSources,
         vector<Int>& mappedTargets,
         vector<Int>& colOffs,
+        DistFrontPullPattern* pattern,
   bool conjugate )
 {
     EL_DEBUG_CSE
@@ -424,6 +428,8 @@ void DistFront<Field>::Pull
     const int numSendEntries = Scan( sEntriesSizes, sEntriesOffs );
     vector<Field> sEntries( numSendEntries );
     vector<Int> sTargets( numSendEntries );
+    if( pattern != nullptr )
+        pattern->sValueInds.resize( numSendEntries );
     for( Int q=0; q<commSize; ++q )
     {
         Int index = sEntriesOffs[q];
@@ -444,6 +450,8 @@ void DistFront<Field>::Pull
                     const Field value = A.Value( rowOff+e );
                     sEntries[index] = (conjugate ? Conj(value) : value);
                     sTargets[index] = iReord;
+                    if( pattern != nullptr )
+                        pattern->sValueInds[index] = rowOff+e;
                     ++index;
                 }
             }
@@ -487,14 +495,91 @@ void DistFront<Field>::Pull
     // Unpack the received entries
     if( time && commRank == 0 )
         timer.Start();
+    if( pattern != nullptr )
+    {
+        pattern->numLocalEntries = A.NumLocalEntries();
+        pattern->sEntriesSizes = sEntriesSizes;
+        pattern->sEntriesOffs = sEntriesOffs;
+        pattern->rEntriesSizes = rEntriesSizes;
+        pattern->rEntriesOffs = rEntriesOffs;
+        pattern->rRowOffs = rRowOffs;
+    }
     // TODO(poulson): Modify constructor of [Dist]Front to default to SYMM_2D?
-    type = SYMM_2D;
-    isHermitian = conjugate;
+    front.type = SYMM_2D;
+    front.isHermitian = conjugate;
     UnpackEntries
-    ( rootSep, rootInfo, *this,
+    ( rootSep, rootInfo, front,
       A, rRowLengths, rEntries, rTargets, rRowOffs, rEntriesOffs );
     if( time && commRank == 0 )
         Output("Unpack: ",timer.Stop()," secs");
+    if( pattern != nullptr )
+    {
+        pattern->rRowLengths = std::move( rRowLengths );
+        pattern->rTargets = std::move( rTargets );
+        pattern->formed = true;
+    }
+}
+
+template<typename Field>
+void DistFront<Field>::Pull
+( const DistSparseMatrix<Field>& A,
+  const DistMap& reordering,
+  const DistSeparator& rootSep,
+  const DistNodeInfo& rootInfo,
+        vector<Int>& mappedSources,
+        vector<Int>& mappedTargets,
+        vector<Int>& colOffs,
+  bool conjugate )
+{
+    EL_DEBUG_CSE
+    PullAndFormPattern
+    ( *this, A, reordering, rootSep, rootInfo,
+      mappedSources, mappedTargets, colOffs, nullptr, conjugate );
+}
+
+template<typename Field>
+void DistFront<Field>::Pull
+( const DistSparseMatrix<Field>& A,
+  const DistMap& reordering,
+  const DistSeparator& rootSep,
+  const DistNodeInfo& rootInfo,
+        DistFrontPullPattern& pattern,
+  bool conjugate )
+{
+    EL_DEBUG_CSE
+    if( !pattern.formed )
+    {
+        vector<Int> mappedSources, mappedTargets, colOffs;
+        PullAndFormPattern
+        ( *this, A, reordering, rootSep, rootInfo,
+          mappedSources, mappedTargets, colOffs, &pattern, conjugate );
+        return;
+    }
+    if( A.NumLocalEntries() != pattern.numLocalEntries )
+        LogicError("The sparsity pattern of A has changed");
+
+    const Int numSendEntries = pattern.sValueInds.size();
+    vector<Field> sEntries( numSendEntries );
+    for( Int s=0; s<numSendEntries; ++s )
+    {
+        const Field value = A.Value( pattern.sValueInds[s] );
+        sEntries[s] = (conjugate ? Conj(value) : value);
+    }
+    vector<Field> rEntries( pattern.rTargets.size() );
+    mpi::AllToAll
+    ( sEntries.data(), pattern.sEntriesSizes.data(),
+      pattern.sEntriesOffs.data(),
+      rEntries.data(), pattern.rEntriesSizes.data(),
+      pattern.rEntriesOffs.data(), A.Grid().Comm() );
+
+    type = SYMM_2D;
+    isHermitian = conjugate;
+    auto rRowOffs = pattern.rRowOffs;
+    auto rEntriesOffs = pattern.rEntriesOffs;
+    UnpackEntries
+    ( rootSep, rootInfo, *this,
+      A, pattern.rRowLengths, rEntries, pattern.rTargets,
+      rRowOffs, rEntriesOffs );
 }
 
 template<typename Field>
@@ -60,9 +60,13 @@ DistMatrixNode<T>::operator=( const DistMultiVecNode<T>& X )
 {
     EL_DEBUG_CSE
 
+    // Existing nodes (and their communication metadata) are reused so that
+    // repeated conversions of right-hand sides of the same size are cheap
     if( X.child.get() == nullptr )
     {
-        duplicate.reset( new MatrixNode<T>(this) );
+        child.reset();
+        if( duplicate.get() == nullptr )
+            duplicate.reset( new MatrixNode<T>(this) );
         *duplicate = *X.duplicate;
 
         matrix.Attach( X.matrix.Grid(), duplicate->matrix );
@@ -70,11 +74,18 @@ DistMatrixNode<T>::operator=( const DistMultiVecNode<T>& X )
         return *this;
     }
 
-    commMeta.Empty();
-    matrix.SetGrid( X.matrix.Grid() );
+    duplicate.reset();
+    if( matrix.Grid() != X.matrix.Grid() ||
+        matrix.Height() != X.matrix.Height() ||
+        matrix.Width() != X.matrix.Width() )
+    {
+        commMeta.Empty();
+        matrix.SetGrid( X.matrix.Grid() );
+    }
     matrix = X.matrix;
 
-    child.reset( new DistMatrixNode<T>(this) );
+    if( child.get() == nullptr )
+        child.reset( new DistMatrixNode<T>(this) );
     *child = *X.child;
 
     return *this;
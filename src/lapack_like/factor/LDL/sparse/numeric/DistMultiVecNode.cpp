@@ -58,9 +58,13 @@ DistMultiVecNode<T>::operator=( const DistMatrixNode<T>& X )
 {
     EL_DEBUG_CSE
 
+    // Existing nodes (and their communication metadata) are reused so that
+    // repeated conversions of right-hand sides of the same size are cheap
     if( X.child.get() == nullptr )
     {
-        duplicate.reset( new MatrixNode<T>(this) );
+        child.reset();
+        if( duplicate.get() == nullptr )
+            duplicate.reset( new MatrixNode<T>(this) );
         *duplicate = *X.duplicate;
 
         matrix.Attach( X.matrix.Grid(), duplicate->matrix );
@@ -68,10 +72,18 @@ DistMultiVecNode<T>::operator=( const DistMatrixNode<T>& X )
         return *this;
     }
 
-    matrix.SetGrid( X.matrix.Grid() );
+    duplicate.reset();
+    if( matrix.Grid() != X.matrix.Grid() ||
+        matrix.Height() != X.matrix.Height() ||
+        matrix.Width() != X.matrix.Width() )
+    {
+        commMeta.Empty();
+        matrix.SetGrid( X.matrix.Grid() );
+    }
     matrix = X.matrix;
 
-    child.reset( new DistMultiVecNode<T>(this) );
+    if( child.get() == nullptr )
+        child.reset( new DistMultiVecNode<T>(this) );
     *child = *X.child;
 
     return *this;
@@ -457,16 +469,8 @@ void DistMultiVecNodeMeta::Initialize
   const DistMultiVec<T>& X )
 {
     EL_DEBUG_CSE
-    if( sendInds.size()     != 0 &&
-        recvInds.size()     != 0 &&
-        mappedOwners.size() != 0 &&
-        sendSizes.size()    != 0 &&
-        sendOffs.size()     != 0 &&
-        recvSizes.size()    != 0 &&
-        recvOffs.size()     != 0 )
-    {
+    if( initialized )
         return;
-    }
 
     const Int numSendInds = XNode.LocalHeight();
     const Grid& grid = info.Grid();
@@ -573,6 +577,7 @@ void DistMultiVecNodeMeta::Initialize
     mpi::AllToAll
     ( sendInds.data(), sendSizes.data(), sendOffs.data(),
       recvInds.data(), recvSizes.data(), recvOffs.data(), grid.Comm() );
+    initialized = true;
 }
 
 template<typename T>
@@ -61,8 +61,13 @@ void DistSparseLDLFactorization<Field>::Initialize
     ldl::NestedDissection
     ( A.LockedDistGraph(), map_, *separator_, *info_, bisectCtrl );
     InvertMap( map_, inverseMap_ );
-    front_.reset
-    ( new ldl::DistFront<Field>(A,map_,*separator_,*info_,hermitian) );
+    store_.reset();
+    front_.reset( new ldl::DistFront<Field> );
+    pullPattern_.Empty();
+    dmvMeta_.Empty();
+    multiVecNode_.reset();
+    matrixNode_.reset();
+    front_->Pull( A, map_, *separator_, *info_, pullPattern_, hermitian );
 
     initialized_ = true;
     factored_ = false;
@@ -83,8 +88,13 @@ void DistSparseLDLFactorization<Field>::Initialize2DGridGraph
     ( gridDim0, gridDim1, 1, A.LockedDistGraph(),
       map_, *separator_, *info_, bisectCtrl.cutoff );
     InvertMap( map_, inverseMap_ );
-    front_.reset
-    ( new ldl::DistFront<Field>(A,map_,*separator_,*info_,hermitian) );
+    store_.reset();
+    front_.reset( new ldl::DistFront<Field> );
+    pullPattern_.Empty();
+    dmvMeta_.Empty();
+    multiVecNode_.reset();
+    matrixNode_.reset();
+    front_->Pull( A, map_, *separator_, *info_, pullPattern_, hermitian );
 
     initialized_ = true;
     factored_ = false;
@@ -106,13 +116,42 @@ void DistSparseLDLFactorization<Field>::Initialize3DGridGraph
     ( gridDim0, gridDim1, gridDim2, A.LockedDistGraph(),
       map_, *separator_, *info_, bisectCtrl.cutoff );
     InvertMap( map_, inverseMap_ );
-    front_.reset
-    ( new ldl::DistFront<Field>(A,map_,*separator_,*info_,hermitian) );
+    store_.reset();
+    front_.reset( new ldl::DistFront<Field> );
+    pullPattern_.Empty();
+    dmvMeta_.Empty();
+    multiVecNode_.reset();
+    matrixNode_.reset();
+    front_->Pull( A, map_, *separator_, *info_, pullPattern_, hermitian );
 
     initialized_ = true;
     factored_ = false;
 }
 
+template<typename Field>
+void DistSparseLDLFactorization<Field>::SetOutOfCoreCtrl
+( const ldl::OutOfCoreCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    outOfCoreCtrl_ = ctrl;
+}
+
+template<typename Field>
+void DistSparseLDLFactorization<Field>::SetCompressionCtrl
+( const ldl::CompressionCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    compressionCtrl_ = ctrl;
+}
+
+template<typename Field>
+void DistSparseLDLFactorization<Field>::SetStaticPivotCtrl
+( const ldl::StaticPivotCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    staticPivotCtrl_ = ctrl;
+}
+
 template<typename Field>
 void DistSparseLDLFactorization<Field>::Factor( LDLFrontType frontType )
 {
@@ -128,7 +167,11 @@ void DistSparseLDLFactorization<Field>::Factor( LDLFrontType frontType )
     ChangeFrontType( SYMM_2D );
 
     // Perform the initial factorization
-    ldl::Process( *info_, *front_, InitialFactorType(frontType) );
+    if( outOfCoreCtrl_.enabled )
+        store_.reset( new ldl::FrontStore<Field>(outOfCoreCtrl_) );
+    ldl::Process
+    ( *info_, *front_, InitialFactorType(frontType), store_.get(),
+      compressionCtrl_, staticPivotCtrl_ );
     factored_ = true;
 
     // Convert the fronts from the initial factorization to the requested form
@@ -142,6 +185,10 @@ void DistSparseLDLFactorization<Field>::ChangeFrontType
     EL_DEBUG_CSE
     if( !initialized_ )
         LogicError("Must initialize before calling 'ChangeFrontType()'");
+    // Avoid redundantly traversing (or, for selective inversion,
+    // re-inverting) the fronts
+    if( front_->type == frontType )
+        return;
     ldl::ChangeFrontType( *front_, frontType );
 }
 
@@ -152,18 +199,21 @@ void DistSparseLDLFactorization<Field>::ChangeNonzeroValues
     EL_DEBUG_CSE
     if( !initialized_ )
         LogicError("Must initialize before calling 'ChangeNonzeroValues()'");
-    if( !formedPullMetadata_ )
-    {
-        ANew.MappedSources( map_, mappedSources_ );
-        ANew.MappedTargets( map_, mappedTargets_, columnOffsets_ );
-        formedPullMetadata_ = true;
-    }
+    store_.reset();
     front_->Pull
-    ( ANew, map_, *separator_, *info_,
-      mappedSources_, mappedTargets_, columnOffsets_ );
+    ( ANew, map_, *separator_, *info_, pullPattern_, front_->isHermitian );
     factored_ = false;
 }
 
+template<typename Field>
+void DistSparseLDLFactorization<Field>::Refactor
+( const DistSparseMatrix<Field>& ANew, LDLFrontType frontType )
+{
+    EL_DEBUG_CSE
+    ChangeNonzeroValues( ANew );
+    Factor( frontType );
+}
+
 template<typename Field>
 void DistSparseLDLFactorization<Field>::Solve( DistMultiVec<Field>& B ) const
 {
@@ -172,15 +222,15 @@ void DistSparseLDLFactorization<Field>::Solve( DistMultiVec<Field>& B ) const
         LogicError("Must call Factor() before Solve()");
     if( FrontIs1D(front_->type) )
     {
-        ldl::DistMultiVecNode<Field> BNodal( inverseMap_, *info_, B );
+        auto& BNodal = PullMultiVecNode( B );
         Solve( BNodal );
-        BNodal.Push( inverseMap_, *info_, B );
+        PushMultiVecNode( B );
     }
     else
     {
-        ldl::DistMatrixNode<Field> BNodal( inverseMap_, *info_, B );
+        auto& BNodal = PullMatrixNode( B );
         Solve( BNodal );
-        BNodal.Push( inverseMap_, *info_, B );
+        PushMatrixNode( B );
     }
 }
 
@@ -235,9 +285,11 @@ void DistSparseLDLFactorization<Field>::Solve
     if( FrontIs1D(front_->type) )
     {
         // TODO: Add warning?
-        ldl::DistMultiVecNode<Field> BMV( B );
-        Solve( BMV );
-        B = BMV;
+        if( multiVecNode_.get() == nullptr )
+            multiVecNode_.reset( new ldl::DistMultiVecNode<Field> );
+        *multiVecNode_ = B;
+        Solve( *multiVecNode_ );
+        B = *multiVecNode_;
         return;
     }
 
@@ -260,6 +312,32 @@ void DistSparseLDLFactorization<Field>::Solve
     }
 }
 
+template<typename Field>
+void DistSparseLDLFactorization<Field>::SolveBatched
+( DistMultiVec<Field>& B, Int batchSize ) const
+{
+    EL_DEBUG_CSE
+    if( !factored_ )
+        LogicError("Must call Factor() before SolveBatched()");
+    if( batchSize <= 0 )
+        LogicError("The batch size must be positive");
+
+    const Int height = B.Height();
+    const Int width = B.Width();
+    auto& BLoc = B.Matrix();
+    DistMultiVec<Field> BBatch(B.Grid());
+    for( Int jBeg=0; jBeg<width; jBeg+=batchSize )
+    {
+        const Int nb = Min(batchSize,width-jBeg);
+        // Processes without any local rows have no columns to offset into
+        Field* batchBuf =
+          ( BLoc.Height() > 0 ? BLoc.Buffer(0,jBeg) : nullptr );
+        BBatch.Attach( height, nb, B.Grid(), batchBuf, BLoc.LDim() );
+        Solve( PullMultiVecNode( BBatch ) );
+        PushMultiVecNode( BBatch );
+    }
+}
+
 template<typename Field>
 void DistSparseLDLFactorization<Field>::SolveWithIterativeRefinement
 ( const DistSparseMatrix<Field>& A,
@@ -332,15 +410,15 @@ void DistSparseLDLFactorization<Field>::SolveAgainstL
         LogicError("Must call Factor() before SolveAgainstL()");
     if( FrontIs1D(front_->type) )
     {
-        ldl::DistMultiVecNode<Field> BNodal( inverseMap_, *info_, B );
+        auto& BNodal = PullMultiVecNode( B );
         SolveAgainstL( orientation, BNodal );
-        BNodal.Push( inverseMap_, *info_, B );
+        PushMultiVecNode( B );
     }
     else
     {
-        ldl::DistMatrixNode<Field> BNodal( inverseMap_, *info_, B );
+        auto& BNodal = PullMatrixNode( B );
         SolveAgainstL( orientation, BNodal );
-        BNodal.Push( inverseMap_, *info_, B );
+        PushMatrixNode( B );
     }
 }
 
@@ -352,9 +430,10 @@ void DistSparseLDLFactorization<Field>::SolveAgainstL
     if( !factored_ )
         LogicError("Must call Factor() before SolveAgainstL()");
     if( orientation == NORMAL )
-        ldl::LowerForwardSolve( *info_, *front_, B );
+        ldl::LowerForwardSolve( *info_, *front_, B, store_.get() );
     else
-        ldl::LowerBackwardSolve( *info_, *front_, B, orientation==ADJOINT );
+        ldl::LowerBackwardSolve
+        ( *info_, *front_, B, orientation==ADJOINT, store_.get() );
 }
 
 template<typename Field>
@@ -365,9 +444,10 @@ void DistSparseLDLFactorization<Field>::SolveAgainstL
     if( !factored_ )
         LogicError("Must call Factor() before SolveAgainstL()");
     if( orientation == NORMAL )
-        ldl::LowerForwardSolve( *info_, *front_, B );
+        ldl::LowerForwardSolve( *info_, *front_, B, store_.get() );
     else
-        ldl::LowerBackwardSolve( *info_, *front_, B, orientation==ADJOINT );
+        ldl::LowerBackwardSolve
+        ( *info_, *front_, B, orientation==ADJOINT, store_.get() );
 }
 
 template<typename Field>
@@ -379,15 +459,15 @@ void DistSparseLDLFactorization<Field>::MultiplyWithL
         LogicError("Must call Factor() before MultiplyWithL()");
     if( FrontIs1D(front_->type) )
     {
-        ldl::DistMultiVecNode<Field> BNodal( inverseMap_, *info_, B );
+        auto& BNodal = PullMultiVecNode( B );
         MultiplyWithL( orientation, BNodal );
-        BNodal.Push( inverseMap_, *info_, B );
+        PushMultiVecNode( B );
     }
     else
     {
-        ldl::DistMatrixNode<Field> BNodal( inverseMap_, *info_, B );
+        auto& BNodal = PullMatrixNode( B );
         MultiplyWithL( orientation, BNodal );
-        BNodal.Push( inverseMap_, *info_, B );
+        PushMatrixNode( B );
     }
 }
 
@@ -398,6 +478,8 @@ void DistSparseLDLFactorization<Field>::MultiplyWithL
     EL_DEBUG_CSE
     if( !factored_ )
         LogicError("Must call Factor() before MultiplyWithL()");
+    if( store_ != nullptr )
+        store_->AcquireAll();
     if( orientation == NORMAL )
         ldl::LowerForwardMultiply( *info_, *front_, B );
     else
@@ -411,6 +493,8 @@ void DistSparseLDLFactorization<Field>::MultiplyWithL
     EL_DEBUG_CSE
     if( !factored_ )
         LogicError("Must call Factor() before MultiplyWithL()");
+    if( store_ != nullptr )
+        store_->AcquireAll();
     if( orientation == NORMAL )
         ldl::LowerForwardMultiply( *info_, *front_, B );
     else
@@ -426,15 +510,15 @@ void DistSparseLDLFactorization<Field>::SolveAgainstD
         LogicError("Must call Factor() before SolveAgainstD()");
     if( FrontIs1D(front_->type) )
     {
-        ldl::DistMultiVecNode<Field> BNodal( inverseMap_, *info_, B );
+        auto& BNodal = PullMultiVecNode( B );
         SolveAgainstD( orientation, BNodal );
-        BNodal.Push( inverseMap_, *info_, B );
+        PushMultiVecNode( B );
     }
     else
     {
-        ldl::DistMatrixNode<Field> BNodal( inverseMap_, *info_, B );
+        auto& BNodal = PullMatrixNode( B );
         SolveAgainstD( orientation, BNodal );
-        BNodal.Push( inverseMap_, *info_, B );
+        PushMatrixNode( B );
     }
 }
 
@@ -481,15 +565,15 @@ void DistSparseLDLFactorization<Field>::MultiplyWithD
         LogicError("Must call Factor() before MultiplyWithD()");
     if( FrontIs1D(front_->type) )
     {
-        ldl::DistMultiVecNode<Field> BNodal( inverseMap_, *info_, B );
+        auto& BNodal = PullMultiVecNode( B );
         MultiplyWithD( orientation, BNodal );
-        BNodal.Push( inverseMap_, *info_, B );
+        PushMultiVecNode( B );
     }
     else
     {
-        ldl::DistMatrixNode<Field> BNodal( inverseMap_, *info_, B );
+        auto& BNodal = PullMatrixNode( B );
         MultiplyWithD( orientation, BNodal );
-        BNodal.Push( inverseMap_, *info_, B );
+        PushMatrixNode( B );
     }
 }
 
@@ -559,6 +643,19 @@ Int DistSparseLDLFactorization<Field>::NumBottomLeftLocalEntries() const
     return front_->NumBottomLeftLocalEntries();
 }
 
+template<typename Field>
+Int DistSparseLDLFactorization<Field>::NumLocalStaticPivots() const
+{
+    EL_DEBUG_CSE
+    if( !initialized_ )
+        LogicError("Must initialize before calling 'NumLocalStaticPivots()'");
+    // Only the sequential subtree is statically pivoted
+    const ldl::DistFront<Field>* front = front_.get();
+    while( front->duplicate == nullptr )
+        front = front->child.get();
+    return front->duplicate->NumStaticPivots();
+}
+
 template<typename Field>
 double DistSparseLDLFactorization<Field>::LocalFactorGFlops
 ( bool selectiveInversion ) const
@@ -582,6 +679,9 @@ template<typename Field>
 ldl::DistFront<Field>& DistSparseLDLFactorization<Field>::Front()
 {
     EL_DEBUG_CSE
+    // Make every front resident
+    if( store_ != nullptr )
+        store_->AcquireAll();
     return *front_;
 }
 
@@ -589,6 +689,8 @@ template<typename Field>
 const ldl::DistFront<Field>& DistSparseLDLFactorization<Field>::Front() const
 {
     EL_DEBUG_CSE
+    if( store_ != nullptr )
+        store_->AcquireAll();
     return *front_;
 }
 
@@ -656,6 +758,53 @@ DistSparseLDLFactorization<Field>::DistMultiVecNodeMeta() const
     return dmvMeta_;
 }
 
+template<typename Field>
+ldl::DistMultiVecNode<Field>&
+DistSparseLDLFactorization<Field>::PullMultiVecNode
+( const DistMultiVec<Field>& B ) const
+{
+    EL_DEBUG_CSE
+    // The persistent metadata assumes the distribution of the original matrix
+    if( B.Height() != inverseMap_.NumSources() || B.Grid() != info_->Grid() )
+        LogicError
+        ("B was ",B.Height()," x ",B.Width()," or had the wrong grid, but ",
+         "the factorization was of order ",inverseMap_.NumSources());
+    if( multiVecNode_.get() == nullptr )
+        multiVecNode_.reset( new ldl::DistMultiVecNode<Field> );
+    multiVecNode_->Pull( inverseMap_, *info_, B, dmvMeta_ );
+    return *multiVecNode_;
+}
+
+template<typename Field>
+ldl::DistMatrixNode<Field>&
+DistSparseLDLFactorization<Field>::PullMatrixNode
+( const DistMultiVec<Field>& B ) const
+{
+    EL_DEBUG_CSE
+    const auto& BMultiVec = PullMultiVecNode( B );
+    if( matrixNode_.get() == nullptr )
+        matrixNode_.reset( new ldl::DistMatrixNode<Field> );
+    *matrixNode_ = BMultiVec;
+    return *matrixNode_;
+}
+
+template<typename Field>
+void DistSparseLDLFactorization<Field>::PushMultiVecNode
+( DistMultiVec<Field>& B ) const
+{
+    EL_DEBUG_CSE
+    multiVecNode_->Push( inverseMap_, *info_, B, dmvMeta_ );
+}
+
+template<typename Field>
+void DistSparseLDLFactorization<Field>::PushMatrixNode
+( DistMultiVec<Field>& B ) const
+{
+    EL_DEBUG_CSE
+    *multiVecNode_ = *matrixNode_;
+    PushMultiVecNode( B );
+}
+
 #define PROTO(Field) template class DistSparseLDLFactorization<Field>;
 
 #define EL_NO_INT_PROTO
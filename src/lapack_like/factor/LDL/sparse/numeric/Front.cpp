@@ -169,6 +169,9 @@ void Front<Field>::Pull
         }
         else
         {
+            front.compressed = false;
+            front.compressedU.Empty();
+            front.compressedV.Empty();
             Zeros( front.LDense, node.size+lowerSize, node.size );
             for( Int t=0; t<node.size; ++t )
             {
@@ -306,6 +309,8 @@ void Front<Field>::Push
       {
           for( const auto& child : front.children )
               countLower( *child );
+          if( front.compressed )
+              LogicError("Compressed fronts cannot be expanded");
           const Int nodeSize = front.LDense.Width();
           const Int structSize = front.Height() - nodeSize;
           numLower += (nodeSize*(nodeSize+1))/2 + nodeSize*structSize;
@@ -420,6 +425,8 @@ void Front<Field>::Unpack
       {
           for( const auto& child : front.children )
               countLower( *child );
+          if( front.compressed )
+              LogicError("Compressed fronts cannot be expanded");
           const Int nodeSize = front.LDense.Width();
           const Int structSize = front.Height() - nodeSize;
           numLower += (nodeSize*(nodeSize+1))/2 + nodeSize*structSize;
@@ -527,10 +534,17 @@ const Front<Field>& Front<Field>::operator=( const Front<Field>& front )
     sparseLeaf = front.sparseLeaf;
     type = front.type;
     LDense = front.LDense;
+    outOfCore = front.outOfCore;
+    outOfCoreHeight = front.outOfCoreHeight;
+    outOfCoreWidth = front.outOfCoreWidth;
     LSparse = front.LSparse;
     diag = front.diag;
     subdiag = front.subdiag;
     p = front.p;
+    compressed = front.compressed;
+    compressedU = front.compressedU;
+    compressedV = front.compressedV;
+    numStaticPivots = front.numStaticPivots;
     workDense = front.workDense;
     workSparse = front.workSparse;
     // Do not copy parent...
@@ -548,9 +562,24 @@ const Front<Field>& Front<Field>::operator=( const Front<Field>& front )
     return *this;
 }
 
+template<typename Field>
+Int Front<Field>::DenseHeight() const
+{ return outOfCore ? outOfCoreHeight : LDense.Height(); }
+
+template<typename Field>
+Int Front<Field>::DenseWidth() const
+{ return outOfCore ? outOfCoreWidth : LDense.Width(); }
+
 template<typename Field>
 Int Front<Field>::Height() const
-{ return sparseLeaf ? LDense.Height()+LDense.Width() : LDense.Height(); }
+{
+    if( sparseLeaf )
+        return DenseHeight()+DenseWidth();
+    else if( compressed )
+        return DenseWidth()+compressedU.Height();
+    else
+        return DenseHeight();
+}
 
 template<typename Field>
 Int Front<Field>::NumEntries() const
@@ -579,12 +608,14 @@ Int Front<Field>::NumEntries() const
             }
 
             // Count the connectivity
-            numEntries += front.LDense.Height() * front.LDense.Width();
+            numEntries += front.DenseHeight() * front.DenseWidth();
         }
         else
         {
-            // Add in L
-            numEntries += front.LDense.Height() * front.LDense.Width();
+            // Add in L (and its compressed bottom-left block)
+            numEntries += front.DenseHeight() * front.DenseWidth();
+            numEntries += front.compressedU.Height()*front.compressedU.Width();
+            numEntries += front.compressedV.Height()*front.compressedV.Width();
         }
         // Add in the workspace for the Schur complement
         numEntries += front.workDense.Height()*front.workDense.Width();
@@ -620,7 +651,7 @@ Int Front<Field>::NumTopLeftEntries() const
         }
         else
         {
-            const Int n = front.LDense.Width();
+            const Int n = front.DenseWidth();
             numEntries += n*n;
         }
       };
@@ -638,12 +669,17 @@ Int Front<Field>::NumBottomLeftEntries() const
       {
         for( const auto& child : front.children )
             count( *child );
-        const Int m = front.LDense.Height();
-        const Int n = front.LDense.Width();
+        const Int m = front.DenseHeight();
+        const Int n = front.DenseWidth();
         if( front.sparseLeaf )
         {
             numEntries += m*n;
         }
+        else if( front.compressed )
+        {
+            const Int r = front.compressedV.Height();
+            numEntries += (front.compressedU.Height()+n)*r;
+        }
         else
         {
             numEntries += (m-n)*n;
@@ -653,6 +689,22 @@ Int Front<Field>::NumBottomLeftEntries() const
     return numEntries;
 }
 
+template<typename Field>
+Int Front<Field>::NumStaticPivots() const
+{
+    EL_DEBUG_CSE
+    Int numStaticPivots = 0;
+    function<void(const Front<Field>&)> count =
+      [&]( const Front<Field>& front )
+      {
+        for( const auto& child : front.children )
+            count( *child );
+        numStaticPivots += front.numStaticPivots;
+      };
+    count( *this );
+    return numStaticPivots;
+}
+
 template<typename Field>
 double Front<Field>::FactorGFlops() const
 {
@@ -663,8 +715,8 @@ double Front<Field>::FactorGFlops() const
       {
         for( const auto& child : front.children )
             count( *child );
-        const double m = front.LDense.Height();
-        const double n = front.LDense.Width();
+        const double m = front.DenseHeight();
+        const double n = front.DenseWidth();
         double realFrontFlops=0;
         if( front.sparseLeaf )
         {
@@ -704,8 +756,8 @@ double Front<Field>::SolveGFlops( Int numRHS ) const
       {
         for( const auto& child : front.children )
             count( *child );
-        const double m = front.LDense.Height();
-        const double n = front.LDense.Width();
+        const double m = front.DenseHeight();
+        const double n = front.DenseWidth();
         double realFrontFlops = 0;
         if( front.sparseLeaf )
         {
@@ -715,6 +767,12 @@ double Front<Field>::SolveGFlops( Int numRHS ) const
             const double numEntries = front.LSparse.NumEntries();
             realFrontFlops = (numEntries+m*n)*numRHS;
         }
+        else if( front.compressed )
+        {
+            const double r = front.compressedV.Height();
+            realFrontFlops =
+              (n*n + (front.compressedU.Height()+n)*r)*numRHS;
+        }
         else
         {
             realFrontFlops = m*n*numRHS;
@@ -0,0 +1,174 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+#include <cstdio>
+
+namespace El {
+namespace ldl {
+
+namespace {
+Int numFrontStores = 0;
+}
+
+template<typename Field>
+FrontStore<Field>::FrontStore( const OutOfCoreCtrl& ctrl )
+: ctrl_(ctrl)
+{
+    EL_DEBUG_CSE
+    if( !IsPacked<Field>::value )
+        LogicError("Out-of-core fronts require a fixed-size datatype");
+    if( ctrl.memoryBudget < 0 )
+        LogicError("Invalid out-of-core memory budget of ",ctrl.memoryBudget);
+
+    Int counter;
+#ifdef EL_HYBRID
+    #pragma omp critical
+#endif
+    counter = numFrontStores++;
+    filename_ = BuildString
+      (ctrl.directory,"/ElFronts-",mpi::Rank(),"-",counter,".bin");
+    file_.open
+    ( filename_.c_str(),
+      std::ios::in | std::ios::out | std::ios::trunc | std::ios::binary );
+    if( !file_.is_open() )
+        RuntimeError("Could not open ",filename_);
+}
+
+template<typename Field>
+FrontStore<Field>::~FrontStore()
+{
+    // Fronts whose factors are only on disk are left empty
+    for( auto& pair : entries_ )
+    {
+        Front<Field>& front = *pair.second.front;
+        if( front.outOfCore )
+        {
+            front.outOfCore = false;
+            front.outOfCoreHeight = 0;
+            front.outOfCoreWidth = 0;
+        }
+    }
+    file_.close();
+    std::remove( filename_.c_str() );
+}
+
+template<typename Field>
+void FrontStore<Field>::Release( Front<Field>& front )
+{
+    EL_DEBUG_CSE
+    if( entries_.count(&front) )
+        LogicError("Front was already released");
+    Entry entry;
+    entry.front = &front;
+    entry.residentIt = resident_.insert( resident_.end(), &front );
+    entries_[&front] = entry;
+    residentBytes_ += double(front.LDense.Height())*front.LDense.Width()*
+                      sizeof(Field);
+    Evict();
+}
+
+template<typename Field>
+void FrontStore<Field>::Acquire( const Front<Field>& constFront )
+{
+    EL_DEBUG_CSE
+    auto it = entries_.find( &constFront );
+    if( it == entries_.end() )
+        return;
+    Entry& entry = it->second;
+    Front<Field>& front = *entry.front;
+    if( front.outOfCore )
+    {
+        const Int height = front.outOfCoreHeight;
+        const Int width = front.outOfCoreWidth;
+        front.LDense.Resize( height, width );
+        file_.seekg( entry.offset );
+        Field* LBuf = front.LDense.Buffer();
+        const Int LLDim = front.LDense.LDim();
+        for( Int j=0; j<width; ++j )
+            file_.read
+            ( reinterpret_cast<char*>(&LBuf[j*LLDim]), height*sizeof(Field) );
+        if( !file_ )
+            RuntimeError("Could not read front from ",filename_);
+        front.outOfCore = false;
+        residentBytes_ += double(height)*width*sizeof(Field);
+        entry.residentIt = resident_.insert( resident_.end(), &front );
+    }
+    else
+        resident_.splice( resident_.end(), resident_, entry.residentIt );
+    Evict();
+}
+
+template<typename Field>
+void FrontStore<Field>::AcquireAll()
+{
+    EL_DEBUG_CSE
+    // Disable eviction so that every front remains resident
+    const double memoryBudget = ctrl_.memoryBudget;
+    ctrl_.memoryBudget = std::numeric_limits<double>::max();
+    for( auto& pair : entries_ )
+        Acquire( *pair.second.front );
+    ctrl_.memoryBudget = memoryBudget;
+}
+
+template<typename Field>
+void FrontStore<Field>::Evict()
+{
+    EL_DEBUG_CSE
+    // Unless eviction was disabled, the process-wide budget (see
+    // SetMemoryBudget) may further restrict the resident fronts to what the
+    // other live buffers leave available
+    double budget = ctrl_.memoryBudget;
+    if( budget != std::numeric_limits<double>::max() )
+        budget = Min( budget, residentBytes_+AvailableMemory() );
+
+    // The most recently used front is always kept resident
+    while( residentBytes_ > budget && resident_.size() > 1 )
+    {
+        Front<Field>& front = *resident_.front();
+        resident_.pop_front();
+        Entry& entry = entries_[&front];
+        const Int height = front.LDense.Height();
+        const Int width = front.LDense.Width();
+        const double numBytes = double(height)*width*sizeof(Field);
+        // The factors are unchanged after being released, so each front
+        // only needs to be written once
+        if( entry.offset < 0 )
+        {
+            entry.offset = fileEnd_;
+            file_.seekp( entry.offset );
+            const Field* LBuf = front.LDense.LockedBuffer();
+            const Int LLDim = front.LDense.LDim();
+            for( Int j=0; j<width; ++j )
+                file_.write
+                ( reinterpret_cast<const char*>(&LBuf[j*LLDim]),
+                  height*sizeof(Field) );
+            if( !file_ )
+                RuntimeError("Could not write front to ",filename_);
+            fileEnd_ += height*width*sizeof(Field);
+            storedBytes_ += numBytes;
+        }
+        front.outOfCore = true;
+        front.outOfCoreHeight = height;
+        front.outOfCoreWidth = width;
+        front.LDense.Empty();
+        residentBytes_ -= numBytes;
+    }
+}
+
+#define PROTO(Field) template class FrontStore<Field>;
+#define EL_NO_INT_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace ldl
+} // namespace El
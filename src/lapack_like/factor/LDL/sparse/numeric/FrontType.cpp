@@ -153,4 +153,21 @@ LDLFrontType InitialFactorType( LDLFrontType type )
         return LDL_2D;
 }
 
+namespace ldl {
+
+namespace {
+Int numSubtreeThreads = 1;
+} // anonymous namespace
+
+void SetNumSubtreeThreads( Int numThreads )
+{
+    if( numThreads < 1 )
+        LogicError("Invalid number of subtree threads: ",numThreads);
+    numSubtreeThreads = numThreads;
+}
+
+Int NumSubtreeThreads() { return numSubtreeThreads; }
+
+} // namespace ldl
+
 } // namespace El
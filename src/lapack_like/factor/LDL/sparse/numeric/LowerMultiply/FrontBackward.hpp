@@ -51,6 +51,8 @@ void FrontLowerBackwardMultiply
     auto type = front.type;
     if( Unfactored(type) )
         LogicError("Cannot multiply against an unfactored matrix");
+    if( front.compressed )
+        LogicError("Compressed fronts not supported");
 
     if( front.sparseLeaf )
     {
@@ -29,7 +29,8 @@ template<typename F>
 inline void LowerBackwardSolve
 ( const NodeInfo& info, 
   const Front<F>& front,
-        MatrixNode<F>& X, bool conjugate )
+        MatrixNode<F>& X, bool conjugate,
+  FrontStore<F>* store=nullptr )
 {
     EL_DEBUG_CSE
 
@@ -45,6 +46,8 @@ inline void LowerBackwardSolve
                                      : (haveDupMatParent ? dupMat->work.Matrix()
                                                          : X.matrix)));
 
+    if( store != nullptr )
+        store->Acquire( front );
     FrontLowerBackwardSolve( front, W, conjugate );
 
     const Int numRHS = X.matrix.Width();
@@ -80,19 +83,21 @@ inline void LowerBackwardSolve
 
     for( Int c=0; c<numChildren; ++c )
         LowerBackwardSolve
-        ( *info.children[c], *front.children[c], *X.children[c], conjugate );
+        ( *info.children[c], *front.children[c], *X.children[c], conjugate,
+          store );
 }
 
 template<typename F>
 inline void LowerBackwardSolve
 ( const DistNodeInfo& info,
-  const DistFront<F>& front, DistMultiVecNode<F>& X, bool conjugate )
+  const DistFront<F>& front, DistMultiVecNode<F>& X, bool conjugate,
+  FrontStore<F>* store=nullptr )
 {
     EL_DEBUG_CSE
     if( front.duplicate != nullptr )
     {
         LowerBackwardSolve
-        ( *info.duplicate, *front.duplicate, *X.duplicate, conjugate );
+        ( *info.duplicate, *front.duplicate, *X.duplicate, conjugate, store );
         return;
     }
 
@@ -183,20 +188,22 @@ inline void LowerBackwardSolve
     SwapClear( recvSizes );
     SwapClear( recvOffs );
 
-    LowerBackwardSolve( *info.child, *front.child, *X.child, conjugate );
+    LowerBackwardSolve
+    ( *info.child, *front.child, *X.child, conjugate, store );
 }
 
 template<typename F>
 inline void LowerBackwardSolve
 ( const DistNodeInfo& info,
   const DistFront<F>& front,
-        DistMatrixNode<F>& X, bool conjugate )
+        DistMatrixNode<F>& X, bool conjugate,
+  FrontStore<F>* store=nullptr )
 {
     EL_DEBUG_CSE
     if( front.duplicate != nullptr )
     {
         LowerBackwardSolve
-        ( *info.duplicate, *front.duplicate, *X.duplicate, conjugate );
+        ( *info.duplicate, *front.duplicate, *X.duplicate, conjugate, store );
         return;
     }
 
@@ -291,7 +298,8 @@ inline void LowerBackwardSolve
     SwapClear( recvSizes );
     SwapClear( recvOffs );
 
-    LowerBackwardSolve( *info.child, *front.child, *X.child, conjugate );
+    LowerBackwardSolve
+    ( *info.child, *front.child, *X.child, conjugate, store );
 }
 
 } // namespace ldl
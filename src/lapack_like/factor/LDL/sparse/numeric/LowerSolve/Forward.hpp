@@ -29,14 +29,15 @@ template<typename F>
 void LowerForwardSolve
 ( const NodeInfo& info, 
   const Front<F>& front,
-        MatrixNode<F>& X )
+        MatrixNode<F>& X,
+  FrontStore<F>* store=nullptr )
 {
     EL_DEBUG_CSE
 
     const Int numChildren = info.children.size();
     for( Int c=0; c<numChildren; ++c )
         LowerForwardSolve
-        ( *info.children[c], *front.children[c], *X.children[c] );
+        ( *info.children[c], *front.children[c], *X.children[c], store );
 
     // Set up a workspace
     // TODO: Only set up a workspace if there is not a parent 
@@ -68,6 +69,8 @@ void LowerForwardSolve
     }
 
     // Solve against this front
+    if( store != nullptr )
+        store->Acquire( front );
     FrontLowerForwardSolve( front, W );
 
     // Store this node's portion of the result
@@ -78,7 +81,8 @@ template<typename F>
 void LowerForwardSolve
 ( const DistNodeInfo& info,
   const DistFront<F>& front,
-        DistMultiVecNode<F>& X )
+        DistMultiVecNode<F>& X,
+  FrontStore<F>* store=nullptr )
 {
     EL_DEBUG_CSE
 
@@ -86,7 +90,8 @@ void LowerForwardSolve
     const Grid& grid = ( frontIs1D ? front.L1D.Grid() : front.L2D.Grid() );
     if( front.duplicate != nullptr )
     {
-        LowerForwardSolve( *info.duplicate, *front.duplicate, *X.duplicate );
+        LowerForwardSolve
+        ( *info.duplicate, *front.duplicate, *X.duplicate, store );
         X.work.LockedAttach( grid, X.duplicate->work );
         return;
     }
@@ -98,7 +103,7 @@ void LowerForwardSolve
           LogicError("Incompatible front type mixture");
     )
 
-    LowerForwardSolve( childInfo, childFront, *X.child );
+    LowerForwardSolve( childInfo, childFront, *X.child, store );
 
     // Set up a workspace
     // TODO: Only set up a workspace if there is a parent
@@ -183,7 +188,8 @@ template<typename F>
 void LowerForwardSolve
 ( const DistNodeInfo& info,
   const DistFront<F>& front,
-        DistMatrixNode<F>& X )
+        DistMatrixNode<F>& X,
+  FrontStore<F>* store=nullptr )
 {
     EL_DEBUG_CSE
     EL_DEBUG_ONLY(
@@ -194,7 +200,8 @@ void LowerForwardSolve
     const Grid& grid = front.L2D.Grid();
     if( front.duplicate != nullptr )
     {
-        LowerForwardSolve( *info.duplicate, *front.duplicate, *X.duplicate );
+        LowerForwardSolve
+        ( *info.duplicate, *front.duplicate, *X.duplicate, store );
         X.work.LockedAttach( grid, X.duplicate->work );
         return;
     }
@@ -206,7 +213,7 @@ void LowerForwardSolve
           LogicError("Incompatible front type mixture");
     )
 
-    LowerForwardSolve( childInfo, childFront, *X.child );
+    LowerForwardSolve( childInfo, childFront, *X.child, store );
 
     // Set up a workspace
     // TODO: Only set up a workspace if there is a parent
@@ -684,6 +684,19 @@ void FrontLowerBackwardSolve
         ( onLeft, WT.Height(), WT.Width(), WT.Buffer(), WT.LDim(), 
           LOffsetBuf, LColBuf, LValBuf );
     }
+    else if( front.compressed )
+    {
+        const Int n = front.LDense.Width();
+        auto WT = W( IR(0,n),   ALL );
+        auto WB = W( IR(n,END), ALL );
+
+        // WT := WT - V' (U' WB)
+        const Orientation orientation = ( conjugate ? ADJOINT : TRANSPOSE );
+        Matrix<F> UWB;
+        Gemm( orientation, NORMAL, F(1), front.compressedU, WB, UWB );
+        Gemm( orientation, NORMAL, F(-1), front.compressedV, UWB, F(1), WT );
+        Trsm( LEFT, LOWER, orientation, UNIT, F(1), front.LDense, WT, true );
+    }
     else
     {
         if( BlockFactorization(type) )
@@ -113,6 +113,18 @@ void FrontLowerForwardSolve( const Front<F>& front, Matrix<F>& W )
 
         Gemm( NORMAL, NORMAL, F(-1), front.LDense, WT, F(1), WB );
     }
+    else if( front.compressed )
+    {
+        const Int n = front.LDense.Width();
+        auto WT = W( IR(0,n),   ALL );
+        auto WB = W( IR(n,END), ALL );
+
+        // WB := WB - U (V WT)
+        Matrix<F> VWT;
+        Trsm( LEFT, LOWER, NORMAL, UNIT, F(1), front.LDense, WT );
+        Gemm( NORMAL, NORMAL, F(1), front.compressedV, WT, VWT );
+        Gemm( NORMAL, NORMAL, F(-1), front.compressedU, VWT, F(1), WB );
+    }
     else
     {
         if( BlockFactorization(type) )
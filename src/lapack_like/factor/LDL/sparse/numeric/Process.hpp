@@ -28,11 +28,133 @@
 namespace El {
 namespace ldl {
 
+// Waits for the factors of the fronts which were factored on the device to be
+// copied back into their fronts
+inline void FinishDeviceFronts()
+{
+#ifdef EL_HAVE_CUDA
+    cuda::FinishFronts();
+#endif
+}
+
+// Factor a leaf of the (sequential) elimination tree which is stored sparsely
 template<typename Field>
-void Process
+void ProcessSparseLeaf
 ( const NodeInfo& info, Front<Field>& front, LDLFrontType factorType )
 {
     EL_DEBUG_CSE
+    front.type = factorType;
+    const Int m = front.LDense.Height();
+    const Int n = front.LDense.Width();
+    const Int numEntries = info.LOffsets.back();
+    const Int numSources = info.LOffsets.size()-1;
+
+    // TODO(poulson): Add support for pivoting here
+    if( PivotedFactorization(factorType) )
+        Zeros( front.subdiag, Max(n-1,0), 1 );
+
+    Zeros( front.LSparse, numSources, numSources );
+    front.LSparse.ForceNumEntries( numEntries );
+    Field* LValBuf = front.LSparse.ValueBuffer();
+    Int* LRowBuf = front.LSparse.SourceBuffer();
+    Int* LColBuf = front.LSparse.TargetBuffer();
+    Int* LOffsetBuf = front.LSparse.OffsetBuffer();
+
+    for( Int i=0; i<numSources; ++i )
+    {
+        const Int iStart = info.LOffsets[i];
+        const Int iEnd = info.LOffsets[i+1];
+        LOffsetBuf[i] = iStart;
+        for( Int e=iStart; e<iEnd; ++e )
+            LRowBuf[e] = i;
+    }
+    LOffsetBuf[numSources] = info.LOffsets[numSources];
+    front.diag.Resize( numSources, 1 );
+
+    // Factor the transpose of L
+    // TODO(poulson): Reuse these workspaces
+    vector<Int> LNnz(numSources), pattern(numSources), flag(numSources);
+    vector<Field> y(numSources);
+    suite_sparse::ldl::Numeric
+    ( numSources,
+      front.workSparse.LockedOffsetBuffer(),
+      front.workSparse.LockedTargetBuffer(),
+      front.workSparse.LockedValueBuffer(),
+      LOffsetBuf,
+      info.LParents.data(),
+      LNnz.data(),
+      LColBuf,
+      LValBuf,
+      front.diag.Buffer(),
+      y.data(),
+      pattern.data(),
+      flag.data(),
+      static_cast<const Int*>(nullptr),
+      static_cast<const Int*>(nullptr),
+      front.isHermitian );
+    front.LSparse.ForceConsistency();
+
+    // Solve against L_{TL}^T from the right
+    bool onLeft = false;
+    suite_sparse::ldl::LTSolveMulti
+    ( onLeft, m, n, front.LDense.Buffer(), front.LDense.LDim(),
+      LOffsetBuf, LColBuf, LValBuf, front.isHermitian );
+
+    // Save a copy of ABL
+    auto ABLCopy = front.LDense;
+
+    // Solve against the diagonal
+    suite_sparse::ldl::DSolveMulti
+    ( onLeft, m, n, front.LDense.Buffer(), front.LDense.LDim(),
+      front.diag.Buffer() );
+
+    // Form the Schur complement
+    Orientation orientation = ( front.isHermitian ? ADJOINT : TRANSPOSE );
+    Trrk
+    ( LOWER, NORMAL, orientation,
+      Field(-1), front.LDense, ABLCopy, Field(0), front.workDense );
+}
+
+// Add the columns [jChildBeg,jChildEnd) of the update matrix of the c'th child
+// into the front (distinct columns of the child update map to distinct
+// columns of the front)
+template<typename Field>
+void ExtendAdd
+( const NodeInfo& info, Front<Field>& front, Int c,
+  Int jChildBeg, Int jChildEnd )
+{
+    auto& FL = front.LDense;
+    auto& FBR = front.workDense;
+    const auto& childU = front.children[c]->workDense;
+    const int childUSize = childU.Height();
+    for( int jChild=jChildBeg; jChild<jChildEnd; ++jChild )
+    {
+        const int j = info.childRelInds[c][jChild];
+        for( int iChild=jChild; iChild<childUSize; ++iChild )
+        {
+            const int i = info.childRelInds[c][iChild];
+            const Field value = childU(iChild,jChild);
+            if( j < info.size )
+                FL(i,j) += value;
+            else
+                FBR(i-info.size,j-info.size) += value;
+        }
+    }
+}
+
+// If a store is provided, each child front is released to it once its update
+// has been added into the parent (the root is left resident). Fronts are
+// approximated as specified by 'compressCtrl', and the failed pivots of
+// intra-pivoted fronts are perturbed as specified by 'pivotCtrl'.
+template<typename Field>
+void Process
+( const NodeInfo& info, Front<Field>& front, LDLFrontType factorType,
+  FrontStore<Field>* store=nullptr,
+  const CompressionCtrl& compressCtrl=CompressionCtrl(),
+  const StaticPivotCtrl& pivotCtrl=StaticPivotCtrl() )
+{
+    EL_DEBUG_CSE
+    EL_PROFILE_REGION("ldl::Process");
     const int updateSize = info.lowerStruct.size();
     auto& FBR = front.workDense;
     FBR.Empty();
@@ -40,81 +162,12 @@ void Process
 
     if( front.sparseLeaf )
     {
-        front.type = factorType;
-        const Int m = front.LDense.Height();
-        const Int n = front.LDense.Width();
-        const Int numEntries = info.LOffsets.back();
-        const Int numSources = info.LOffsets.size()-1;
-
-        // TODO(poulson): Add support for pivoting here
-        if( PivotedFactorization(factorType) )
-            Zeros( front.subdiag, Max(n-1,0), 1 );
-
-        Zeros( front.LSparse, numSources, numSources );
-        front.LSparse.ForceNumEntries( numEntries );
-        Field* LValBuf = front.LSparse.ValueBuffer();
-        Int* LRowBuf = front.LSparse.SourceBuffer();
-        Int* LColBuf = front.LSparse.TargetBuffer();
-        Int* LOffsetBuf = front.LSparse.OffsetBuffer();
-
-        for( Int i=0; i<numSources; ++i )
-        {
-            const Int iStart = info.LOffsets[i];
-            const Int iEnd = info.LOffsets[i+1];
-            LOffsetBuf[i] = iStart;
-            for( Int e=iStart; e<iEnd; ++e )
-                LRowBuf[e] = i;
-        }
-        LOffsetBuf[numSources] = info.LOffsets[numSources];
-        front.diag.Resize( numSources, 1 );
-
-        // Factor the transpose of L
-        // TODO(poulson): Reuse these workspaces
-        vector<Int> LNnz(numSources), pattern(numSources), flag(numSources);
-        vector<Field> y(numSources);
-        suite_sparse::ldl::Numeric
-        ( numSources,
-          front.workSparse.LockedOffsetBuffer(),
-          front.workSparse.LockedTargetBuffer(),
-          front.workSparse.LockedValueBuffer(),
-          LOffsetBuf,
-          info.LParents.data(),
-          LNnz.data(),
-          LColBuf,
-          LValBuf,
-          front.diag.Buffer(),
-          y.data(),
-          pattern.data(),
-          flag.data(),
-          static_cast<const Int*>(nullptr),
-          static_cast<const Int*>(nullptr),
-          front.isHermitian );
-        front.LSparse.ForceConsistency();
-
-        // Solve against L_{TL}^T from the right
-        bool onLeft = false;
-        suite_sparse::ldl::LTSolveMulti
-        ( onLeft, m, n, front.LDense.Buffer(), front.LDense.LDim(),
-          LOffsetBuf, LColBuf, LValBuf, front.isHermitian );
-
-        // Save a copy of ABL
-        auto ABLCopy = front.LDense;
-
-        // Solve against the diagonal
-        suite_sparse::ldl::DSolveMulti
-        ( onLeft, m, n, front.LDense.Buffer(), front.LDense.LDim(),
-          front.diag.Buffer() );
-
-        // Form the Schur complement
-        Orientation orientation = ( front.isHermitian ? ADJOINT : TRANSPOSE );
-        Trrk
-        ( LOWER, NORMAL, orientation,
-          Field(-1), front.LDense, ABLCopy, Field(0), front.workDense );
+        ProcessSparseLeaf( info, front, factorType );
     }
     else
     {
-        auto& FL = front.LDense;
         EL_DEBUG_ONLY(
+          auto& FL = front.LDense;
           if( FL.Height() != info.size+updateSize || FL.Width() != info.size )
               LogicError("Front was not the proper size");
         )
@@ -123,34 +176,147 @@ void Process
         const int numChildren = info.children.size();
         for( Int c=0; c<numChildren; ++c )
         {
-            Process( *info.children[c], *front.children[c], factorType );
+            Process
+            ( *info.children[c], *front.children[c], factorType, store,
+              compressCtrl, pivotCtrl );
+            auto& childU = front.children[c]->workDense;
+            ExtendAdd( info, front, c, 0, childU.Height() );
+            childU.Empty();
+            if( store != nullptr )
+            {
+                FinishDeviceFronts();
+                store->Release( *front.children[c] );
+            }
+        }
+        ProcessFront( front, factorType, compressCtrl, pivotCtrl );
+    }
+}
 
+#ifdef EL_HYBRID
+// A task-parallel analogue of Process which factors the subtrees of the
+// children of each front as independent OpenMP tasks (which idle threads
+// steal) and splits the extend-add of each child update across tasks over
+// its columns. It must be called from within a parallel region. The first
+// exception thrown by any task is stored in 'exception'.
+template<typename Field>
+void ProcessTasks
+( const NodeInfo& info, Front<Field>& front, LDLFrontType factorType,
+  FrontStore<Field>* store, const CompressionCtrl& compressCtrl,
+  const StaticPivotCtrl& pivotCtrl, std::exception_ptr& exception )
+{
+    EL_DEBUG_CSE
+    EL_PROFILE_REGION("ldl::ProcessTasks");
+    try
+    {
+        const int updateSize = info.lowerStruct.size();
+        auto& FBR = front.workDense;
+        FBR.Empty();
+        Zeros( FBR, updateSize, updateSize );
+        if( front.sparseLeaf )
+        {
+            ProcessSparseLeaf( info, front, factorType );
+            return;
+        }
+
+        const int numChildren = info.children.size();
+        for( Int c=0; c<numChildren; ++c )
+        {
+            #pragma omp task default(shared) firstprivate(c)
+            ProcessTasks
+            ( *info.children[c], *front.children[c], factorType, store,
+              compressCtrl, pivotCtrl, exception );
+        }
+        #pragma omp taskwait
+        if( exception != nullptr )
+            return;
+
+        // Children are added in order so that the result is deterministic
+        const Int minColsPerTask = 32;
+        for( Int c=0; c<numChildren; ++c )
+        {
             auto& childU = front.children[c]->workDense;
-            const int childUSize = childU.Height();
-            for( int jChild=0; jChild<childUSize; ++jChild )
+            const Int childUSize = childU.Height();
+            for( Int jBeg=0; jBeg<childUSize; jBeg+=minColsPerTask )
+            {
+                const Int jEnd = Min(jBeg+minColsPerTask,childUSize);
+                #pragma omp task default(shared) firstprivate(c,jBeg,jEnd)
+                ExtendAdd( info, front, c, jBeg, jEnd );
+            }
+            #pragma omp taskwait
+            childU.Empty();
+            if( store != nullptr )
             {
-                const int j = info.childRelInds[c][jChild];
-                for( int iChild=jChild; iChild<childUSize; ++iChild )
+                #pragma omp critical(ElFrontStore)
                 {
-                    const int i = info.childRelInds[c][iChild];
-                    const Field value = childU(iChild,jChild);
-                    if( j < info.size )
-                        FL(i,j) += value;
-                    else
-                        FBR(i-info.size,j-info.size) += value;
+                    FinishDeviceFronts();
+                    store->Release( *front.children[c] );
                 }
             }
-            childU.Empty();
         }
-        ProcessFront( front, factorType );
+        ProcessFront( front, factorType, compressCtrl, pivotCtrl );
+    }
+    catch( ... )
+    {
+        #pragma omp critical
+        {
+            if( exception == nullptr )
+                exception = std::current_exception();
+        }
+    }
+}
+#endif // ifdef EL_HYBRID
+
+// Process the local elimination tree with NumSubtreeThreads() threads. Large
+// fronts are factored on the device (if available) while the other threads
+// continue with the smaller fronts on the CPU, and the transfers of their
+// factors back to the host overlap the extend-adds of their updates.
+template<typename Field>
+void ProcessLocal
+( const NodeInfo& info, Front<Field>& front, LDLFrontType factorType,
+  FrontStore<Field>* store=nullptr,
+  const CompressionCtrl& compressCtrl=CompressionCtrl(),
+  const StaticPivotCtrl& pivotCtrl=StaticPivotCtrl() )
+{
+    EL_DEBUG_CSE
+#ifdef EL_HYBRID
+    const Int numThreads = NumSubtreeThreads();
+    if( numThreads > 1 && !omp_in_parallel() )
+    {
+        std::exception_ptr exception;
+        #pragma omp parallel num_threads(numThreads)
+        {
+            #pragma omp single
+            ProcessTasks
+            ( info, front, factorType, store, compressCtrl, pivotCtrl,
+              exception );
+        }
+        FinishDeviceFronts();
+        if( exception != nullptr )
+            std::rethrow_exception( exception );
+        return;
+    }
+#endif
+    try
+    {
+        Process( info, front, factorType, store, compressCtrl, pivotCtrl );
+    }
+    catch( ... )
+    {
+        FinishDeviceFronts();
+        throw;
     }
+    FinishDeviceFronts();
 }
 
 template<typename Field>
 void Process
-( const DistNodeInfo& info, DistFront<Field>& front, LDLFrontType factorType )
+( const DistNodeInfo& info, DistFront<Field>& front, LDLFrontType factorType,
+  FrontStore<Field>* store=nullptr,
+  const CompressionCtrl& compressCtrl=CompressionCtrl(),
+  const StaticPivotCtrl& pivotCtrl=StaticPivotCtrl() )
 {
     EL_DEBUG_CSE
+    EL_PROFILE_REGION("ldl::Process");
 
     // Switch to a sequential algorithm if possible
     if( front.duplicate.get() != nullptr )
@@ -158,7 +324,9 @@ void Process
         const Grid& grid = info.Grid();
         auto& frontDup = *front.duplicate;
 
-        Process( *info.duplicate, frontDup, factorType );
+        ProcessLocal
+        ( *info.duplicate, frontDup, factorType, store, compressCtrl,
+          pivotCtrl );
 
         // Pull the relevant information up from the duplicate
         front.type = frontDup.type;
@@ -179,7 +347,8 @@ void Process
 
     const auto& childInfo = *info.child;
     auto& childFront = *front.child;
-    Process( childInfo, childFront, factorType );
+    Process
+    ( childInfo, childFront, factorType, store, compressCtrl, pivotCtrl );
 
     const Int updateSize = info.lowerStruct.size();
     front.work.Empty();
@@ -72,29 +72,110 @@ void ProcessFrontVanilla( Matrix<F>& AL, Matrix<F>& ABR, bool conjugate )
     }
 }
 
+// Returns the perturbations of the original diagonal of the front (indexed
+// by their original positions) which would make each failed 1x1 pivot pass
+// (see StaticPivotCtrl), given the pivoted factorization of the top-left
+// block and the (scaled) bottom-left block of L
+template<typename F>
+vector<pair<Int,F>> StaticPivotPerturbations
+( const Matrix<F>& ATL,
+  const Matrix<F>& subdiag,
+  const Permutation& P,
+  const Matrix<F>& L21,
+  Base<F> frontNorm,
+  const StaticPivotCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    const Int n = ATL.Width();
+    const Int mB = L21.Height();
+    const Real threshold = ctrl.threshold;
+    const Real minPivot = Real(ctrl.relPerturbation)*frontNorm;
+
+    vector<pair<Int,F>> perturbations;
+    for( Int j=0; j<n; ++j )
+    {
+        const bool inTwoByTwo =
+          ( j < n-1 && subdiag(j) != F(0) ) ||
+          ( j > 0   && subdiag(j-1) != F(0) );
+        if( inTwoByTwo )
+            continue;
+
+        Real growth = 0;
+        for( Int i=0; i<mB; ++i )
+            growth = Max( growth, Abs(L21(i,j)) );
+        const F pivot = ATL(j,j);
+        const Real pivotAbs = Abs(pivot);
+        if( pivotAbs >= minPivot && threshold*growth <= Real(1) )
+            continue;
+
+        // Preserve the phase of the pivot while raising its magnitude so
+        // that the scaled column of L21 is bounded by 1/threshold
+        const Real newPivotAbs = Max( minPivot, threshold*growth*pivotAbs );
+        const F phase = ( pivotAbs == Real(0) ? F(1) : pivot/pivotAbs );
+        perturbations.push_back
+        ( pair<Int,F>(P.Preimage(j),phase*newPivotAbs-pivot) );
+    }
+    return perturbations;
+}
+
 template<typename F>
 void ProcessFrontIntraPiv
 ( Matrix<F>& AL,
   Matrix<F>& subdiag,
   Permutation& P,
   Matrix<F>& ABR,
-  bool conjugate )
+  bool conjugate,
+  const StaticPivotCtrl& pivotCtrl,
+  Int& numStaticPivots )
 {
     EL_DEBUG_CSE
     const Int n = AL.Width();
     const Orientation orientation = ( conjugate ? ADJOINT : TRANSPOSE );
+    numStaticPivots = 0;
 
-    auto ATL = AL( IR(0,n  ), ALL );
-    auto ABL = AL( IR(n,END), ALL );
+    // Keep the original front panel in case its failed pivots are perturbed
+    Matrix<F> ALOrig;
+    if( pivotCtrl.enabled )
+        ALOrig = AL;
 
-    LDL( ATL, subdiag, P, conjugate );
-    auto diag = GetDiagonal(ATL);
+    Matrix<F> SBL;
+    auto factor = [&]()
+    {
+        auto ATL = AL( IR(0,n  ), ALL );
+        auto ABL = AL( IR(n,END), ALL );
 
-    P.PermuteCols( ABL );
-    Trsm( RIGHT, LOWER, orientation, UNIT, F(1), ATL, ABL );
-    Matrix<F> SBL( ABL );
+        LDL( ATL, subdiag, P, conjugate );
+        auto diag = GetDiagonal(ATL);
 
-    QuasiDiagonalSolve( RIGHT, LOWER, diag, subdiag, ABL, conjugate );
+        P.PermuteCols( ABL );
+        Trsm( RIGHT, LOWER, orientation, UNIT, F(1), ATL, ABL );
+        SBL = ABL;
+
+        QuasiDiagonalSolve( RIGHT, LOWER, diag, subdiag, ABL, conjugate );
+    };
+    factor();
+
+    if( pivotCtrl.enabled && n > 0 )
+    {
+        auto perturbations =
+          StaticPivotPerturbations
+          ( AL(IR(0,n),ALL), subdiag, P, AL(IR(n,END),ALL),
+            MaxNorm(ALOrig), pivotCtrl );
+        const Int numFailed = perturbations.size();
+        const Int budget = Max( Int(pivotCtrl.maxPerturbedRatio*n), Int(1) );
+        if( numFailed > 0 && numFailed <= budget )
+        {
+            AL = ALOrig;
+            for( const auto& perturbation : perturbations )
+                AL(perturbation.first,perturbation.first) +=
+                  perturbation.second;
+            factor();
+            numStaticPivots = numFailed;
+        }
+    }
+
+    auto ABL = AL( IR(n,END), ALL );
     Trrk( LOWER, NORMAL, orientation, F(-1), SBL, ABL, F(1), ABR );
 }
 
@@ -153,11 +234,117 @@ void ProcessFrontBlock
     }
 }
 
+// Factor a non-pivoted front while replacing the (scaled) bottom-left block
+// by an interpolative decomposition, L21 ~= U V, where U is a subset of the
+// columns of L21. The Schur complement is formed from the approximation,
+// ABR := ABR - U (V D V') U'. Returns false (with the front exactly
+// factored) if the rank of the approximation was too large.
 template<typename F>
-void ProcessFront( Front<F>& front, LDLFrontType factorType )
+bool ProcessFrontCompressed
+( Front<F>& front, const CompressionCtrl& ctrl )
 {
     EL_DEBUG_CSE
+    typedef Base<F> Real;
+    auto& AL = front.LDense;
+    auto& ABR = front.workDense;
+    const Int n = AL.Width();
+    const Int mB = AL.Height()-n;
+    const Orientation orientation =
+      ( front.isHermitian ? ADJOINT : TRANSPOSE );
+
+    auto ATL = AL( IR(0,n  ), ALL );
+    auto ABL = AL( IR(n,END), ALL );
+
+    LDL( ATL, front.isHermitian );
+    GetDiagonal( ATL, front.diag );
+    Trsm( RIGHT, LOWER, orientation, UNIT, F(1), ATL, ABL );
+    Matrix<F> SBL( ABL );
+    DiagonalSolve( RIGHT, NORMAL, front.diag, ABL );
+
+    const Int maxRank = Int(ctrl.maxRankRatio*Min(mB,n));
+    Permutation P;
+    Matrix<F> Z;
+    if( maxRank > 0 )
+    {
+        QRCtrl<Real> qrCtrl;
+        qrCtrl.colPiv = true;
+        qrCtrl.adaptive = true;
+        qrCtrl.tol = Real(ctrl.relTol);
+        qrCtrl.boundRank = true;
+        qrCtrl.maxRank = maxRank;
+        Matrix<F> L21Copy( ABL );
+        ID( L21Copy, P, Z, qrCtrl, true );
+    }
+    const Int rank = Z.Height();
+    if( maxRank == 0 || rank >= maxRank )
+    {
+        Trrk( LOWER, NORMAL, orientation, F(-1), SBL, ABL, F(1), ABR );
+        return false;
+    }
+    SBL.Empty();
+
+    // U := the skeleton columns of L21, V := [I, Z] P^T
+    P.PermuteCols( ABL );
+    front.compressedU = ABL( ALL, IR(0,rank) );
+    Zeros( front.compressedV, rank, n );
+    for( Int j=0; j<rank; ++j )
+        front.compressedV(j,j) = F(1);
+    auto VR = front.compressedV( ALL, IR(rank,n) );
+    VR = Z;
+    P.InversePermuteCols( front.compressedV );
+
+    // ABR := ABR - U (V D V') U'
+    Matrix<F> VD( front.compressedV ), C, UC;
+    DiagonalScale( RIGHT, NORMAL, front.diag, VD );
+    Gemm( NORMAL, orientation, F(1), VD, front.compressedV, C );
+    Gemm( NORMAL, NORMAL, F(1), front.compressedU, C, UC );
+    Trrk
+    ( LOWER, NORMAL, orientation,
+      F(-1), UC, front.compressedU, F(1), ABR );
+
+    // Only retain the top-left block of the dense factor
+    Matrix<F> LTL( ATL );
+    front.LDense = std::move( LTL );
+    front.compressed = true;
+    return true;
+}
+
+// Factors a non-pivoted front on the device if it is large enough (see
+// GPUCtrl), in which case its factor is only guaranteed to have arrived in
+// front.LDense after cuda::FinishFronts (see FinishDeviceFronts)
+template<typename F,typename=EnableIf<IsBlasScalar<F>>>
+bool ProcessFrontOnDevice( Front<F>& front )
+{
+    EL_DEBUG_CSE
+#ifdef EL_HAVE_CUDA
+    auto& AL = front.LDense;
+    auto& ABR = front.workDense;
+    if( !cuda::OffloadFront( AL.Height(), AL.Width() ) )
+        return false;
+    front.diag.Resize( AL.Width(), 1 );
+    cuda::FrontLDL
+    ( front.isHermitian, AL.Height(), AL.Width(),
+      AL.Buffer(), AL.LDim(), ABR.Buffer(), ABR.LDim(), front.diag.Buffer() );
+    return true;
+#else
+    return false;
+#endif
+}
+
+template<typename F,typename=DisableIf<IsBlasScalar<F>>,typename=void>
+bool ProcessFrontOnDevice( Front<F>& front )
+{ return false; }
+
+template<typename F>
+void ProcessFront
+( Front<F>& front, LDLFrontType factorType,
+  const CompressionCtrl& compressCtrl=CompressionCtrl(),
+  const StaticPivotCtrl& pivotCtrl=StaticPivotCtrl() )
+{
+    EL_DEBUG_CSE
+    EL_PROFILE_REGION("ldl::ProcessFront");
     front.type = factorType;
+    front.numStaticPivots = 0;
     EL_DEBUG_ONLY(
       if( front.sparseLeaf )
           LogicError("This should not be possible");
@@ -178,10 +365,19 @@ void ProcessFront( Front<F>& front, LDLFrontType factorType )
           front.subdiag,
           front.p,
           front.workDense,
-          front.isHermitian );
+          front.isHermitian,
+          pivotCtrl,
+          front.numStaticPivots );
         GetDiagonal( front.LDense, front.diag );
     }
-    else
+    else if( compressCtrl.enabled && front.duplicate == nullptr &&
+             front.LDense.Width() >= compressCtrl.minSize &&
+             front.LDense.Height()-front.LDense.Width() >=
+             compressCtrl.minSize )
+    {
+        ProcessFrontCompressed( front, compressCtrl );
+    }
+    else if( !ProcessFrontOnDevice( front ) )
     {
         ProcessFrontVanilla
         ( front.LDense,
@@ -361,6 +557,7 @@ template<typename F>
 void ProcessFront( DistFront<F>& front, LDLFrontType factorType )
 {
     EL_DEBUG_CSE
+    EL_PROFILE_REGION("ldl::ProcessFront");
     EL_DEBUG_ONLY(
       if( FrontIs1D(front.type) )
           LogicError("Expected front to be in a 2D distribution");
@@ -51,6 +51,7 @@ void SparseLDLFactorization<Field>::Initialize
     ldl::NestedDissection
     ( A.LockedGraph(), map_, *separator_, *info_, bisectCtrl );
     InvertMap( map_, inverseMap_ );
+    store_.reset();
     front_.reset( new ldl::Front<Field>(A,map_,*info_,hermitian) );
 
     initialized_ = true;
@@ -72,6 +73,7 @@ void SparseLDLFactorization<Field>::Initialize2DGridGraph
     ( gridDim0, gridDim1, 1, A.LockedGraph(),
       map_, *separator_, *info_, bisectCtrl.cutoff );
     InvertMap( map_, inverseMap_ );
+    store_.reset();
     front_.reset( new ldl::Front<Field>(A,map_,*info_,hermitian) );
 
     initialized_ = true;
@@ -94,12 +96,37 @@ void SparseLDLFactorization<Field>::Initialize3DGridGraph
     ( gridDim0, gridDim1, gridDim2, A.LockedGraph(),
       map_, *separator_, *info_, bisectCtrl.cutoff );
     InvertMap( map_, inverseMap_ );
+    store_.reset();
     front_.reset( new ldl::Front<Field>(A,map_,*info_,hermitian) );
 
     initialized_ = true;
     factored_ = false;
 }
 
+template<typename Field>
+void SparseLDLFactorization<Field>::SetOutOfCoreCtrl
+( const ldl::OutOfCoreCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    outOfCoreCtrl_ = ctrl;
+}
+
+template<typename Field>
+void SparseLDLFactorization<Field>::SetCompressionCtrl
+( const ldl::CompressionCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    compressionCtrl_ = ctrl;
+}
+
+template<typename Field>
+void SparseLDLFactorization<Field>::SetStaticPivotCtrl
+( const ldl::StaticPivotCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    staticPivotCtrl_ = ctrl;
+}
+
 template<typename Field>
 void SparseLDLFactorization<Field>::Factor( LDLFrontType frontType )
 {
@@ -115,7 +142,11 @@ void SparseLDLFactorization<Field>::Factor( LDLFrontType frontType )
     ChangeFrontType( SYMM_2D );
     
     // Perform the initial factorization
-    ldl::Process( *info_, *front_, InitialFactorType(frontType) );
+    if( outOfCoreCtrl_.enabled )
+        store_.reset( new ldl::FrontStore<Field>(outOfCoreCtrl_) );
+    ldl::ProcessLocal
+    ( *info_, *front_, InitialFactorType(frontType), store_.get(),
+      compressionCtrl_, staticPivotCtrl_ );
     factored_ = true;
     
     // Convert the fronts from the initial factorization to the requested form
@@ -138,6 +169,7 @@ void SparseLDLFactorization<Field>::ChangeNonzeroValues
     EL_DEBUG_CSE
     if( !initialized_ )
         LogicError("Must initialize before calling 'ChangeNonzeroValues()'");
+    store_.reset();
     front_->Pull( ANew, map_, *info_ );
     factored_ = false;
 }
@@ -259,9 +291,10 @@ void SparseLDLFactorization<Field>::SolveAgainstL
     if( !factored_ )
         LogicError("Must call Factor() before SolveAgainstL()");
     if( orientation == NORMAL )
-        ldl::LowerForwardSolve( *info_, *front_, B );
+        ldl::LowerForwardSolve( *info_, *front_, B, store_.get() );
     else
-        ldl::LowerBackwardSolve( *info_, *front_, B, orientation==ADJOINT );
+        ldl::LowerBackwardSolve
+        ( *info_, *front_, B, orientation==ADJOINT, store_.get() );
 }
 
 template<typename Field>
@@ -283,6 +316,8 @@ void SparseLDLFactorization<Field>::MultiplyWithL
     EL_DEBUG_CSE
     if( !factored_ )
         LogicError("Must call Factor() before MultiplyWithL()");
+    if( store_ != nullptr )
+        store_->AcquireAll();
     if( orientation == NORMAL )
         ldl::LowerForwardMultiply( *info_, *front_, B );
     else
@@ -378,6 +413,15 @@ Int SparseLDLFactorization<Field>::NumBottomLeftEntries() const
     return front_->NumBottomLeftEntries();
 }
 
+template<typename Field>
+Int SparseLDLFactorization<Field>::NumStaticPivots() const
+{
+    EL_DEBUG_CSE
+    if( !initialized_ )
+        LogicError("Must initialize before calling 'NumStaticPivots()'");
+    return front_->NumStaticPivots();
+}
+
 template<typename Field>
 double SparseLDLFactorization<Field>::FactorGFlops() const
 {
@@ -400,6 +444,9 @@ template<typename Field>
 ldl::Front<Field>& SparseLDLFactorization<Field>::Front()
 {
     EL_DEBUG_CSE
+    // Make every front resident
+    if( store_ != nullptr )
+        store_->AcquireAll();
     return *front_;
 }
 
@@ -407,6 +454,8 @@ template<typename Field>
 const ldl::Front<Field>& SparseLDLFactorization<Field>::Front() const
 {
     EL_DEBUG_CSE
+    if( store_ != nullptr )
+        store_->AcquireAll();
     return *front_;
 }
 
@@ -0,0 +1,188 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+namespace El {
+namespace ldl {
+
+// Merge the trailing child of a node into the node. The (exact) lower
+// structure of the child is contained within the union of the node indices
+// and the node's lower structure, so the lower structure of the node is
+// unchanged.
+inline void MergeTrailingChild( Separator& sep, NodeInfo& node, Int newZeros )
+{
+    EL_DEBUG_CSE
+    unique_ptr<NodeInfo> child = std::move(node.children.back());
+    unique_ptr<Separator> childSep = std::move(sep.children.back());
+    node.children.pop_back();
+    sep.children.pop_back();
+    EL_DEBUG_ONLY(
+      if( child->off+child->size != node.off )
+          LogicError("Trailing child did not immediately precede its parent");
+    )
+
+    // Drop the connections to the node indices from the original structure
+    // of the child, as they now lie within the diagonal block
+    const Int nodeEnd = node.off + node.size;
+    vector<Int> childOrigLowerStruct;
+    for( const Int i : child->origLowerStruct )
+        if( i >= nodeEnd )
+            childOrigLowerStruct.push_back( i );
+    node.origLowerStruct =
+      Union( childOrigLowerStruct, node.origLowerStruct );
+
+    node.off = child->off;
+    node.size += child->size;
+    node.numAmalgamated += child->numAmalgamated + 1;
+    node.numExplicitZeros += child->numExplicitZeros + newZeros;
+    for( auto& grandchild : child->children )
+    {
+        grandchild->parent = &node;
+        node.children.push_back( std::move(grandchild) );
+    }
+
+    sep.off = childSep->off;
+    sep.inds.insert( sep.inds.begin(), childSep->inds.begin(),
+                     childSep->inds.end() );
+    for( auto& grandchild : childSep->children )
+    {
+        grandchild->parent = &sep;
+        sep.children.push_back( std::move(grandchild) );
+    }
+}
+
+inline void
+AmalgamateRecursion( Separator& sep, NodeInfo& node, double tol )
+{
+    EL_DEBUG_CSE
+    const Int numChildren = node.children.size();
+    for( Int c=0; c<numChildren; ++c )
+        AmalgamateRecursion( *sep.children[c], *node.children[c], tol );
+
+    while( !node.children.empty() )
+    {
+        const NodeInfo& child = *node.children.back();
+        if( node.children.size() == 1 && child.children.empty() )
+            break;
+
+        // Merging the child expands each of its columns to the full height
+        // of the merged front
+        const double childSize = child.size;
+        const double size = node.size;
+        const double childLowerSize = child.lowerStruct.size();
+        const double lowerSize = node.lowerStruct.size();
+        const double mergedSize = childSize + size;
+        const double newZeros = childSize*(size+lowerSize-childLowerSize);
+        const double numZeros =
+          node.numExplicitZeros + child.numExplicitZeros + newZeros;
+        const double numEntries =
+          mergedSize*(mergedSize+1)/2 + mergedSize*lowerSize;
+        if( numZeros > tol*numEntries )
+            break;
+
+        MergeTrailingChild( sep, node, Int(newZeros) );
+    }
+}
+
+void Amalgamate( Separator& sep, NodeInfo& info, double tol )
+{
+    EL_DEBUG_CSE
+    if( tol < 0 )
+        LogicError("Invalid amalgamation tolerance of ",tol);
+    // The merge criterion requires the lower structures
+    Analysis( info );
+    AmalgamateRecursion( sep, info, tol );
+}
+
+void Amalgamate( DistSeparator& sep, DistNodeInfo& info, double tol )
+{
+    EL_DEBUG_CSE
+    if( info.duplicate != nullptr )
+    {
+        Amalgamate( *sep.duplicate, *info.duplicate, tol );
+
+        // Pull information up from the duplicates
+        sep.off = sep.duplicate->off;
+        sep.inds = sep.duplicate->inds;
+        info.size = info.duplicate->size;
+        info.off = info.duplicate->off;
+        info.origLowerStruct = info.duplicate->origLowerStruct;
+    }
+    else
+    {
+        if( info.child == nullptr )
+            LogicError("Node child was nullptr");
+        Amalgamate( *sep.child, *info.child, tol );
+    }
+}
+
+inline void AddFront( FrontStats& stats, Int size, double numEntries )
+{
+    if( stats.numFronts == 0 )
+    {
+        stats.minSize = size;
+        stats.maxSize = size;
+    }
+    else
+    {
+        stats.minSize = Min( stats.minSize, size );
+        stats.maxSize = Max( stats.maxSize, size );
+    }
+    ++stats.numFronts;
+    stats.numEntries += numEntries;
+
+    const Int bin = ( size > 0 ? Int(Log2(double(size))) : 0 );
+    if( Int(stats.sizeHistogram.size()) <= bin )
+        stats.sizeHistogram.resize( bin+1, 0 );
+    ++stats.sizeHistogram[bin];
+}
+
+inline void
+AccumulateFrontStats( FrontStats& stats, const NodeInfo& node )
+{
+    for( const auto& child : node.children )
+        AccumulateFrontStats( stats, *child );
+
+    const double size = node.size;
+    const double lowerSize = node.lowerStruct.size();
+    // Leaves are factored sparsely above their (dense) lower trapezoid
+    const double diagEntries =
+      ( node.children.empty() && !node.LOffsets.empty() ?
+        node.LOffsets.back() + size :
+        size*(size+1)/2 );
+    AddFront( stats, node.size, diagEntries+size*lowerSize );
+    stats.numAmalgamated += node.numAmalgamated;
+    stats.numExplicitZeros += node.numExplicitZeros;
+}
+
+FrontStats ComputeFrontStats( const NodeInfo& info )
+{
+    EL_DEBUG_CSE
+    FrontStats stats;
+    AccumulateFrontStats( stats, info );
+    return stats;
+}
+
+FrontStats ComputeFrontStats( const DistNodeInfo& info )
+{
+    EL_DEBUG_CSE
+    if( info.duplicate != nullptr )
+        return ComputeFrontStats( *info.duplicate );
+    if( info.child == nullptr )
+        LogicError("Node child was nullptr");
+
+    FrontStats stats = ComputeFrontStats( *info.child );
+    const double size = info.size;
+    const double lowerSize = info.lowerStruct.size();
+    AddFront( stats, info.size, size*(size+1)/2+size*lowerSize );
+    return stats;
+}
+
+} // namespace ldl
+} // namespace El
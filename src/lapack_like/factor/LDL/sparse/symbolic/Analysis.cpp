@@ -213,20 +213,11 @@ inline void ComputeStructAndRelInds
     )
 }
 
-Int Analysis( NodeInfo& node, Int myOff )
+// Form the structure of a node from the (already analyzed) structures of its
+// children
+inline void MergeChildStructs( NodeInfo& node )
 {
     EL_DEBUG_CSE
-
-    // Recurse on the children
-    // NOTE: Cleanup of existing info children should be added
-    const Int numChildren = node.children.size();
-    for( Int c=0; c<numChildren; ++c )
-    {
-        if( node.children[c] == nullptr )
-            LogicError("Node child ",c," was nullptr");
-        myOff = Analysis( *node.children[c], myOff );
-    }
-
     EL_DEBUG_ONLY(
       if( !IsStrictlySorted(node.origLowerStruct) )
       {
@@ -237,6 +228,7 @@ Int Analysis( NodeInfo& node, Int myOff )
       }
     )
 
+    const Int numChildren = node.children.size();
     if( numChildren > 0 )
     {
         // Union the structures of the children with the original structure
@@ -290,7 +282,82 @@ Int Analysis( NodeInfo& node, Int myOff )
         for( Int i=0; i<numOrigLowerInds; ++i )
             node.origLowerRelInds[i] = i + node.size;
     }
+}
+
+inline Int SubtreeSize( const NodeInfo& node )
+{
+    Int size = node.size;
+    for( const auto& child : node.children )
+        size += SubtreeSize( *child );
+    return size;
+}
+
+#ifdef EL_HYBRID
+// The structures of disjoint subtrees are independent, so each child is
+// analyzed as a separate task (with its offset computed up front) before
+// its parent merges their structures. It must be called from within a
+// parallel region. The first exception thrown by any task is stored in
+// 'exception'.
+inline void AnalysisTasks
+( NodeInfo& node, std::exception_ptr& exception )
+{
+    EL_DEBUG_CSE
+    try
+    {
+        const Int numChildren = node.children.size();
+        for( Int c=0; c<numChildren; ++c )
+            if( node.children[c] == nullptr )
+                LogicError("Node child ",c," was nullptr");
+        for( Int c=0; c<numChildren; ++c )
+        {
+            #pragma omp task default(shared) firstprivate(c)
+            AnalysisTasks( *node.children[c], exception );
+        }
+        #pragma omp taskwait
+        if( exception != nullptr )
+            return;
+        MergeChildStructs( node );
+    }
+    catch( ... )
+    {
+        #pragma omp critical
+        {
+            if( exception == nullptr )
+                exception = std::current_exception();
+        }
+    }
+}
+#endif // ifdef EL_HYBRID
+
+Int Analysis( NodeInfo& node, Int myOff )
+{
+    EL_DEBUG_CSE
+#ifdef EL_HYBRID
+    const Int numThreads = NumSubtreeThreads();
+    if( numThreads > 1 && !omp_in_parallel() )
+    {
+        std::exception_ptr exception;
+        #pragma omp parallel num_threads(numThreads)
+        {
+            #pragma omp single
+            AnalysisTasks( node, exception );
+        }
+        if( exception != nullptr )
+            std::rethrow_exception( exception );
+        return myOff + SubtreeSize( node );
+    }
+#endif
 
+    // Recurse on the children
+    // NOTE: Cleanup of existing info children should be added
+    const Int numChildren = node.children.size();
+    for( Int c=0; c<numChildren; ++c )
+    {
+        if( node.children[c] == nullptr )
+            LogicError("Node child ",c," was nullptr");
+        myOff = Analysis( *node.children[c], myOff );
+    }
+    MergeChildStructs( node );
     return myOff + node.size;
 }
 
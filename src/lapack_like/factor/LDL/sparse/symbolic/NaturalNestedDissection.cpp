@@ -29,7 +29,6 @@ NaturalNestedDissectionRecursion
     EL_DEBUG_CSE
     const Int numSources = graph.NumSources();
     const Int* offsetBuf = graph.LockedOffsetBuffer();
-    const Int* sourceBuf = graph.LockedSourceBuffer();
     const Int* targetBuf = graph.LockedTargetBuffer();
     if( numSources <= cutoff )
     {
@@ -40,23 +39,15 @@ NaturalNestedDissectionRecursion
             if( targetBuf[e] < numSources )
                 ++numValidEdges;
         vector<Int> subOffsets(numSources+1), subTargets(Max(numValidEdges,1));
-        Int sourceOff = 0;
         Int validCounter = 0;
-        Int prevSource = -1;
-        for( Int e=0; e<numEdges; ++e )
+        for( Int s=0; s<numSources; ++s )
         {
-            const Int source = sourceBuf[e];
-            const Int target = targetBuf[e];
-            while( source != prevSource )
-            {
-                subOffsets[sourceOff++] = validCounter;
-                ++prevSource;
-            }
-            if( target < numSources )
-                subTargets[validCounter++] = target;
+            subOffsets[s] = validCounter;
+            for( Int e=offsetBuf[s]; e<offsetBuf[s+1]; ++e )
+                if( targetBuf[e] < numSources )
+                    subTargets[validCounter++] = targetBuf[e];
         }
-        while( sourceOff <= numSources)
-        { subOffsets[sourceOff++] = validCounter; }
+        subOffsets[numSources] = validCounter;
 
         // Technically, SuiteSparse expects column-major storage, but since
         // the matrix is structurally symmetric, it's okay to pass in the
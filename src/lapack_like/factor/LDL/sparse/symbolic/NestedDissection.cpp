@@ -87,7 +87,6 @@ NestedDissectionRecursion
     EL_DEBUG_CSE
     const Int numSources = graph.NumSources();
     const Int* offsetBuf = graph.LockedOffsetBuffer();
-    const Int* sourceBuf = graph.LockedSourceBuffer();
     const Int* targetBuf = graph.LockedTargetBuffer();
     if( numSources <= ctrl.cutoff )
     {
@@ -98,23 +97,15 @@ NestedDissectionRecursion
             if( targetBuf[e] < numSources )
                 ++numValidEdges;
         vector<Int> subOffsets(numSources+1), subTargets(Max(numValidEdges,1));
-        Int sourceOff = 0;
         Int validCounter = 0;
-        Int prevSource = -1;
-        for( Int e=0; e<numEdges; ++e )
+        for( Int s=0; s<numSources; ++s )
         {
-            const Int source = sourceBuf[e];
-            const Int target = targetBuf[e];
-            while( source != prevSource )
-            {
-                subOffsets[sourceOff++] = validCounter;
-                ++prevSource;
-            }
-            if( target < numSources )
-                subTargets[validCounter++] = target;
+            subOffsets[s] = validCounter;
+            for( Int e=offsetBuf[s]; e<offsetBuf[s+1]; ++e )
+                if( targetBuf[e] < numSources )
+                    subTargets[validCounter++] = targetBuf[e];
         }
-        while( sourceOff <= numSources )
-        { subOffsets[sourceOff++] = validCounter; }
+        subOffsets[numSources] = validCounter;
 
         // Technically, SuiteSparse expects column-major storage, but since
         // the matrix is structurally symmetric, it's okay to pass in the
@@ -397,11 +388,28 @@ void NestedDissection
     EL_DEBUG_CSE
 
     const Int numSources = graph.NumSources();
-    vector<Int> perm(numSources);
-    for( Int s=0; s<numSources; ++s )
+    Graph compressed;
+    Supervariables supers;
+    const Int numSupers =
+      ( ctrl.compressSupervariables ?
+        CompressSupervariables( graph, compressed, supers ) : numSources );
+    const bool compress = ( numSupers < numSources );
+    const Graph& orderGraph = ( compress ? compressed : graph );
+
+    // Order the quotient graph with a proportionally smaller cutoff
+    auto ctrlMod( ctrl );
+    if( compress )
+        ctrlMod.cutoff = Max( (ctrl.cutoff*numSupers)/numSources, Int(1) );
+
+    vector<Int> perm(numSupers);
+    for( Int s=0; s<numSupers; ++s )
         perm[s] = s;
 
-    NestedDissectionRecursion( graph, perm, sep, info, 0, ctrl );
+    NestedDissectionRecursion( orderGraph, perm, sep, info, 0, ctrlMod );
+    if( compress )
+        ExpandSupervariables( graph, supers, sep, info );
+    if( ctrl.amalgamate )
+        Amalgamate( sep, info, ctrl.amalgamationTol );
 
     // Construct the distributed reordering
     sep.BuildMap( map );
@@ -420,14 +428,32 @@ void NestedDissection
 {
     EL_DEBUG_CSE
 
-    DistMap perm( graph.NumSources(), graph.Grid() );
+    const Int numSources = graph.NumSources();
+    DistGraph compressed( graph.Grid() );
+    Supervariables supers;
+    const Int numSupers =
+      ( ctrl.compressSupervariables ?
+        CompressSupervariables( graph, compressed, supers ) : numSources );
+    const bool compress = ( numSupers < numSources );
+    const DistGraph& orderGraph = ( compress ? compressed : graph );
+
+    // Order the quotient graph with a proportionally smaller cutoff
+    auto ctrlMod( ctrl );
+    if( compress )
+        ctrlMod.cutoff = Max( (ctrl.cutoff*numSupers)/numSources, Int(1) );
+
+    DistMap perm( numSupers, graph.Grid() );
     const Int firstLocalSource = perm.FirstLocalSource();
     const Int numLocalSources = perm.NumLocalSources();
     for( Int s=0; s<numLocalSources; ++s )
         perm.SetLocal( s, s+firstLocalSource );
 
     info.SetRootGrid( graph.Grid() );
-    NestedDissectionRecursion( graph, perm, sep, info, 0, ctrl );
+    NestedDissectionRecursion( orderGraph, perm, sep, info, 0, ctrlMod );
+    if( compress )
+        ExpandSupervariables( graph, supers, sep, info );
+    if( ctrl.amalgamate )
+        Amalgamate( sep, info, ctrl.amalgamationTol );
 
     // Construct the distributed reordering
     sep.BuildMap( info, map );
@@ -0,0 +1,690 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+namespace El {
+namespace ldl {
+
+namespace {
+
+inline unsigned long long MixIndex( Int i )
+{
+    // The finalizer of MurmurHash3
+    unsigned long long x = static_cast<unsigned long long>(i);
+    x ^= x >> 33;
+    x *= 0xff51afd7ed558ccdULL;
+    x ^= x >> 33;
+    x *= 0xc4ceb9fe1a85ec53ULL;
+    x ^= x >> 33;
+    return x;
+}
+
+// Form the sorted closed neighborhood, adj(s) U {s}, of a local source
+void ClosedNeighborhood
+( Int sLoc, Int firstLocalSource,
+  const Int* offsetBuf, const Int* targetBuf,
+  vector<Int>& closed )
+{
+    const Int s = sLoc + firstLocalSource;
+    closed.assign( &targetBuf[offsetBuf[sLoc]], &targetBuf[offsetBuf[sLoc+1]] );
+    closed.push_back( s );
+    std::sort( closed.begin(), closed.end() );
+    closed.erase( std::unique( closed.begin(), closed.end() ), closed.end() );
+}
+
+// Merge the local sources with identical closed neighborhoods, numbering
+// the supervariables in the order of their first members
+void DetectSupervariables
+( Int numLocalSources, Int firstLocalSource,
+  const Int* offsetBuf, const Int* targetBuf,
+  vector<Int>& localSupers,
+  Supervariables& supers )
+{
+    EL_DEBUG_CSE
+    // Group the sources by the hashes and sizes of their closed neighborhoods
+    vector<unsigned long long> hashes( numLocalSources );
+    vector<Int> closedSizes( numLocalSources );
+    for( Int sLoc=0; sLoc<numLocalSources; ++sLoc )
+    {
+        const Int s = sLoc + firstLocalSource;
+        unsigned long long hash = 0;
+        Int closedSize = offsetBuf[sLoc+1] - offsetBuf[sLoc];
+        bool hasSelf = false;
+        for( Int e=offsetBuf[sLoc]; e<offsetBuf[sLoc+1]; ++e )
+        {
+            hash += MixIndex( targetBuf[e] );
+            if( targetBuf[e] == s )
+                hasSelf = true;
+        }
+        if( !hasSelf )
+        {
+            hash += MixIndex( s );
+            ++closedSize;
+        }
+        hashes[sLoc] = hash;
+        closedSizes[sLoc] = closedSize;
+    }
+    vector<Int> order( numLocalSources );
+    for( Int sLoc=0; sLoc<numLocalSources; ++sLoc )
+        order[sLoc] = sLoc;
+    std::sort
+    ( order.begin(), order.end(),
+      [&]( const Int& a, const Int& b )
+      {
+          if( hashes[a] != hashes[b] )
+              return hashes[a] < hashes[b];
+          if( closedSizes[a] != closedSizes[b] )
+              return closedSizes[a] < closedSizes[b];
+          return a < b;
+      } );
+
+    // Compare the neighborhoods within each group (which are almost always
+    // tiny), so that each source is represented by the first source with
+    // the same closed neighborhood
+    vector<Int> reps( numLocalSources );
+    for( Int sLoc=0; sLoc<numLocalSources; ++sLoc )
+        reps[sLoc] = sLoc;
+    vector<Int> closed, repClosed;
+    Int groupBeg = 0;
+    while( groupBeg < numLocalSources )
+    {
+        const Int first = order[groupBeg];
+        Int groupEnd = groupBeg+1;
+        while( groupEnd < numLocalSources &&
+               hashes[order[groupEnd]] == hashes[first] &&
+               closedSizes[order[groupEnd]] == closedSizes[first] )
+            ++groupEnd;
+        for( Int k=groupBeg+1; k<groupEnd; ++k )
+        {
+            ClosedNeighborhood
+            ( order[k], firstLocalSource, offsetBuf, targetBuf, closed );
+            for( Int l=groupBeg; l<k; ++l )
+            {
+                const Int rep = order[l];
+                if( reps[rep] != rep )
+                    continue;
+                ClosedNeighborhood
+                ( rep, firstLocalSource, offsetBuf, targetBuf, repClosed );
+                if( closed == repClosed )
+                {
+                    reps[order[k]] = rep;
+                    break;
+                }
+            }
+        }
+        groupBeg = groupEnd;
+    }
+
+    // Number the supervariables and list their members
+    localSupers.resize( numLocalSources );
+    vector<Int> superSizes;
+    for( Int sLoc=0; sLoc<numLocalSources; ++sLoc )
+    {
+        if( reps[sLoc] == sLoc )
+        {
+            localSupers[sLoc] = superSizes.size();
+            superSizes.push_back( 0 );
+        }
+        else
+            localSupers[sLoc] = localSupers[reps[sLoc]];
+        ++superSizes[localSupers[sLoc]];
+    }
+    const Int numLocalSupers = superSizes.size();
+    supers.offsets.resize( numLocalSupers+1 );
+    supers.offsets[0] = 0;
+    for( Int k=0; k<numLocalSupers; ++k )
+        supers.offsets[k+1] = supers.offsets[k] + superSizes[k];
+    supers.members.resize( numLocalSources );
+    auto offs = supers.offsets;
+    for( Int sLoc=0; sLoc<numLocalSources; ++sLoc )
+        supers.members[offs[localSupers[sLoc]]++] = sLoc + firstLocalSource;
+}
+
+// A table of the lists (the members of supervariables or the adjacency lists
+// of vertices) of a set of indices. If 'ids' is empty, the lists are indexed
+// directly, otherwise 'ids' is sorted and the list of ids[k] is
+// values[offsets[k]:offsets[k+1]].
+struct ListTable
+{
+    vector<Int> ids;
+    const Int* offsets=nullptr;
+    const Int* values=nullptr;
+
+    // Only used if the lists were fetched from other processes
+    vector<Int> offsetsStorage, valuesStorage;
+
+    Int Index( Int id ) const
+    {
+        if( ids.empty() )
+            return id;
+        auto it = std::lower_bound( ids.begin(), ids.end(), id );
+        EL_DEBUG_ONLY(
+          if( it == ids.end() || *it != id )
+              LogicError("List of ",id," was not fetched");
+        )
+        return it - ids.begin();
+    }
+    Int Size( Int id ) const
+    { const Int k = Index(id); return offsets[k+1]-offsets[k]; }
+    const Int* List( Int id ) const { return &values[offsets[Index(id)]]; }
+};
+
+// Fetch the lists of the sorted, unique indices 'ids' from their owners,
+// which must be non-decreasing in the index
+void FetchLists
+( const vector<Int>& ids,
+  function<int(Int)> owner,
+  function<pair<const Int*,Int>(Int)> localList,
+  mpi::Comm comm,
+  ListTable& table )
+{
+    EL_DEBUG_CSE
+    const int commSize = mpi::Size( comm );
+    const Int numIds = ids.size();
+
+    // Exchange the requested indices
+    vector<int> sendSizes( commSize, 0 );
+    for( Int k=0; k<numIds; ++k )
+    {
+        EL_DEBUG_ONLY(
+          if( k > 0 && owner(ids[k]) < owner(ids[k-1]) )
+              LogicError("Owners were not non-decreasing");
+        )
+        ++sendSizes[owner(ids[k])];
+    }
+    vector<int> recvSizes( commSize );
+    mpi::AllToAll( sendSizes.data(), 1, recvSizes.data(), 1, comm );
+    vector<int> sendOffs, recvOffs;
+    Scan( sendSizes, sendOffs );
+    const int numRecvs = Scan( recvSizes, recvOffs );
+    vector<Int> recvIds( numRecvs );
+    mpi::AllToAll
+    ( ids.data(), sendSizes.data(), sendOffs.data(),
+      recvIds.data(), recvSizes.data(), recvOffs.data(), comm );
+
+    // Return the lengths of the requested lists
+    vector<Int> replyLengths( numRecvs );
+    vector<int> replySizes( commSize, 0 );
+    for( int q=0; q<commSize; ++q )
+    {
+        for( int k=recvOffs[q]; k<recvOffs[q]+recvSizes[q]; ++k )
+        {
+            replyLengths[k] = localList( recvIds[k] ).second;
+            replySizes[q] += replyLengths[k];
+        }
+    }
+    vector<Int> lengths( numIds );
+    mpi::AllToAll
+    ( replyLengths.data(), recvSizes.data(), recvOffs.data(),
+      lengths.data(), sendSizes.data(), sendOffs.data(), comm );
+
+    // Return the lists themselves
+    vector<int> replyOffs;
+    const int numReplyValues = Scan( replySizes, replyOffs );
+    vector<Int> replyValues;
+    replyValues.reserve( numReplyValues );
+    for( int k=0; k<numRecvs; ++k )
+    {
+        auto list = localList( recvIds[k] );
+        replyValues.insert
+        ( replyValues.end(), list.first, list.first+list.second );
+    }
+    vector<int> valueSizes( commSize, 0 );
+    for( int q=0; q<commSize; ++q )
+        for( int k=sendOffs[q]; k<sendOffs[q]+sendSizes[q]; ++k )
+            valueSizes[q] += lengths[k];
+    vector<int> valueOffs;
+    const int numValues = Scan( valueSizes, valueOffs );
+
+    table.ids = ids;
+    table.offsetsStorage.resize( numIds+1 );
+    table.offsetsStorage[0] = 0;
+    for( Int k=0; k<numIds; ++k )
+        table.offsetsStorage[k+1] = table.offsetsStorage[k] + lengths[k];
+    table.valuesStorage.resize( numValues );
+    mpi::AllToAll
+    ( replyValues.data(), replySizes.data(), replyOffs.data(),
+      table.valuesStorage.data(), valueSizes.data(), valueOffs.data(),
+      comm );
+    table.offsets = table.offsetsStorage.data();
+    table.values = table.valuesStorage.data();
+}
+
+// The expanded offset of a (nonempty) node and the prefix sums of the sizes
+// of its supervariables, keyed by the compressed offset of the node
+struct Segment
+{
+    Int expandedOff=0;
+    vector<Int> prefix;
+};
+typedef std::map<Int,Segment> SegmentMap;
+
+Int ExpandIndices
+( Int compressedOff,
+  vector<Int>& inds,
+  const ListTable& members,
+  SegmentMap& segments )
+{
+    EL_DEBUG_CSE
+    // Empty nodes can share their offset with another node
+    if( inds.empty() )
+        return 0;
+    const Int numInds = inds.size();
+    Segment& segment = segments[compressedOff];
+    segment.prefix.resize( numInds+1 );
+    segment.prefix[0] = 0;
+    vector<Int> expanded;
+    for( Int k=0; k<numInds; ++k )
+    {
+        const Int* list = members.List( inds[k] );
+        expanded.insert( expanded.end(), list, list+members.Size(inds[k]) );
+        segment.prefix[k+1] = expanded.size();
+    }
+    SwapClear( inds );
+    inds.swap( expanded );
+    return inds.size();
+}
+
+Int ExpandSubtreeIndices
+( Separator& sep, const ListTable& members, SegmentMap& segments )
+{
+    EL_DEBUG_CSE
+    Int subtreeSize = 0;
+    for( auto& child : sep.children )
+        subtreeSize += ExpandSubtreeIndices( *child, members, segments );
+    subtreeSize += ExpandIndices( sep.off, sep.inds, members, segments );
+    return subtreeSize;
+}
+
+// Assign the expanded offsets of the (post-ordered) subtree starting from
+// 'off' and return its expanded size
+Int AssignOffsets
+( Separator& sep, NodeInfo& info, Int off, SegmentMap& segments )
+{
+    EL_DEBUG_CSE
+    Int childOff = off;
+    const Int numChildren = sep.children.size();
+    for( Int c=0; c<numChildren; ++c )
+        childOff += AssignOffsets
+          ( *sep.children[c], *info.children[c], childOff, segments );
+    if( !sep.inds.empty() )
+        segments[sep.off].expandedOff = childOff;
+    sep.off = childOff;
+    info.off = childOff;
+    info.size = sep.inds.size();
+    return (childOff+info.size) - off;
+}
+
+// Since the members of a supervariable share their connections, each
+// compressed index of the original lower structure becomes a contiguous
+// range of expanded indices
+void ExpandLowerStruct
+( vector<Int>& origLowerStruct, const SegmentMap& segments )
+{
+    EL_DEBUG_CSE
+    vector<Int> expanded;
+    for( const Int& i : origLowerStruct )
+    {
+        auto it = segments.upper_bound( i );
+        EL_DEBUG_ONLY(
+          if( it == segments.begin() )
+              LogicError("Could not find the node containing ",i);
+        )
+        --it;
+        const Segment& segment = it->second;
+        const Int k = i - it->first;
+        for( Int j=segment.prefix[k]; j<segment.prefix[k+1]; ++j )
+            expanded.push_back( segment.expandedOff+j );
+    }
+    origLowerStruct.swap( expanded );
+}
+
+// Recompute the symbolic factorization of a leaf in the (expanded)
+// elimination order of its indices
+void LeafSymbolic
+( const vector<Int>& inds, const ListTable& adjacency, NodeInfo& info )
+{
+    EL_DEBUG_CSE
+    const Int numInds = inds.size();
+    vector<pair<Int,Int>> positions( numInds );
+    for( Int i=0; i<numInds; ++i )
+        positions[i] = pair<Int,Int>( inds[i], i );
+    std::sort( positions.begin(), positions.end() );
+
+    vector<Int> subOffsets( numInds+1 ), subTargets;
+    for( Int i=0; i<numInds; ++i )
+    {
+        subOffsets[i] = subTargets.size();
+        const Int* list = adjacency.List( inds[i] );
+        const Int numConn = adjacency.Size( inds[i] );
+        for( Int t=0; t<numConn; ++t )
+        {
+            auto it = std::lower_bound
+              ( positions.begin(), positions.end(),
+                pair<Int,Int>(list[t],0) );
+            if( it != positions.end() && it->first == list[t] )
+                subTargets.push_back( it->second );
+        }
+    }
+    subOffsets[numInds] = subTargets.size();
+    if( subTargets.empty() )
+        subTargets.push_back( 0 );
+
+    info.LOffsets.resize( numInds+1 );
+    info.LParents.resize( numInds );
+    vector<Int> LNnz( numInds ), Flag( numInds );
+    suite_sparse::ldl::Symbolic
+    ( numInds, subOffsets.data(), subTargets.data(),
+      info.LOffsets.data(), info.LParents.data(), LNnz.data(),
+      Flag.data(), static_cast<const Int*>(nullptr),
+      static_cast<Int*>(nullptr) );
+}
+
+void FinishSubtree
+( const Separator& sep,
+        NodeInfo& info,
+  const SegmentMap& segments,
+  const ListTable& adjacency )
+{
+    EL_DEBUG_CSE
+    const Int numChildren = sep.children.size();
+    for( Int c=0; c<numChildren; ++c )
+        FinishSubtree
+        ( *sep.children[c], *info.children[c], segments, adjacency );
+    ExpandLowerStruct( info.origLowerStruct, segments );
+    if( numChildren == 0 )
+        LeafSymbolic( sep.inds, adjacency, info );
+}
+
+void CollectIndices( const Separator& sep, vector<Int>& inds )
+{
+    for( const auto& child : sep.children )
+        CollectIndices( *child, inds );
+    inds.insert( inds.end(), sep.inds.begin(), sep.inds.end() );
+}
+
+void CollectLeafIndices( const Separator& sep, vector<Int>& inds )
+{
+    for( const auto& child : sep.children )
+        CollectLeafIndices( *child, inds );
+    if( sep.children.empty() )
+        inds.insert( inds.end(), sep.inds.begin(), sep.inds.end() );
+}
+
+} // anonymous namespace
+
+Int CompressSupervariables
+( const Graph& graph, Graph& compressed, Supervariables& supers )
+{
+    EL_DEBUG_CSE
+    const Int numSources = graph.NumSources();
+    const Int* offsetBuf = graph.LockedOffsetBuffer();
+    const Int* targetBuf = graph.LockedTargetBuffer();
+
+    vector<Int> superOf;
+    DetectSupervariables
+    ( numSources, 0, offsetBuf, targetBuf, superOf, supers );
+    const Int numSupers = supers.offsets.size()-1;
+    supers.processOffsets.assign( {Int(0),numSupers} );
+
+    // The connections of a supervariable are those of any of its members
+    vector<Int> superOffsets( numSupers+1 ), superTargets;
+    for( Int s=0; s<numSupers; ++s )
+    {
+        superOffsets[s] = superTargets.size();
+        const Int rep = supers.members[supers.offsets[s]];
+        for( Int e=offsetBuf[rep]; e<offsetBuf[rep+1]; ++e )
+        {
+            const Int target = targetBuf[e];
+            if( target < numSources &&
+                (superOf[target] != s || target == rep) )
+                superTargets.push_back( superOf[target] );
+        }
+        std::sort( superTargets.begin()+superOffsets[s], superTargets.end() );
+        superTargets.erase
+        ( std::unique( superTargets.begin()+superOffsets[s],
+                       superTargets.end() ), superTargets.end() );
+    }
+    superOffsets[numSupers] = superTargets.size();
+
+    compressed.Resize( numSupers );
+    compressed.Reserve( superTargets.size() );
+    for( Int s=0; s<numSupers; ++s )
+        for( Int e=superOffsets[s]; e<superOffsets[s+1]; ++e )
+            compressed.QueueConnection( s, superTargets[e] );
+    compressed.ProcessQueues();
+    return numSupers;
+}
+
+Int CompressSupervariables
+( const DistGraph& graph, DistGraph& compressed, Supervariables& supers )
+{
+    EL_DEBUG_CSE
+    const Grid& grid = graph.Grid();
+    mpi::Comm comm = grid.Comm();
+    const int commSize = grid.Size();
+    const int commRank = grid.Rank();
+    const Int numSources = graph.NumSources();
+    const Int numLocalSources = graph.NumLocalSources();
+    const Int firstLocalSource = graph.FirstLocalSource();
+    const Int* offsetBuf = graph.LockedOffsetBuffer();
+    const Int* targetBuf = graph.LockedTargetBuffer();
+
+    vector<Int> localSupers;
+    DetectSupervariables
+    ( numLocalSources, firstLocalSource, offsetBuf, targetBuf,
+      localSupers, supers );
+    const Int numLocalSupers = supers.offsets.size()-1;
+
+    vector<Int> numLocalSupersList( commSize );
+    mpi::AllGather( &numLocalSupers, 1, numLocalSupersList.data(), 1, comm );
+    supers.processOffsets.resize( commSize+1 );
+    supers.processOffsets[0] = 0;
+    for( int q=0; q<commSize; ++q )
+        supers.processOffsets[q+1] =
+          supers.processOffsets[q] + numLocalSupersList[q];
+    const Int firstSuper = supers.processOffsets[commRank];
+    const Int numSupers = supers.processOffsets[commSize];
+
+    // Map the connections of the first member of each supervariable to
+    // their supervariables
+    DistMap superMap( numSources, grid );
+    for( Int sLoc=0; sLoc<numLocalSources; ++sLoc )
+        superMap.SetLocal( sLoc, firstSuper+localSupers[sLoc] );
+    vector<Int> repTargets, repTargetOffsets( numLocalSupers+1 );
+    vector<Int> isSelf;
+    for( Int k=0; k<numLocalSupers; ++k )
+    {
+        repTargetOffsets[k] = repTargets.size();
+        const Int rep = supers.members[supers.offsets[k]];
+        const Int repLoc = rep - firstLocalSource;
+        for( Int e=offsetBuf[repLoc]; e<offsetBuf[repLoc+1]; ++e )
+        {
+            if( targetBuf[e] < numSources )
+            {
+                repTargets.push_back( targetBuf[e] );
+                isSelf.push_back( targetBuf[e] == rep );
+            }
+        }
+    }
+    repTargetOffsets[numLocalSupers] = repTargets.size();
+    auto superTargets = repTargets;
+    superMap.Translate( superTargets );
+
+    compressed.SetGrid( grid );
+    compressed.Resize( numSupers );
+    vector<Int> superOffsets( numLocalSupers+1 ), uniqueTargets;
+    Int numLocalEdges=0, numRemoteEdges=0;
+    for( Int k=0; k<numLocalSupers; ++k )
+    {
+        const Int s = firstSuper + k;
+        superOffsets[k] = uniqueTargets.size();
+        for( Int e=repTargetOffsets[k]; e<repTargetOffsets[k+1]; ++e )
+            if( superTargets[e] != s || isSelf[e] )
+                uniqueTargets.push_back( superTargets[e] );
+        std::sort( uniqueTargets.begin()+superOffsets[k], uniqueTargets.end() );
+        uniqueTargets.erase
+        ( std::unique( uniqueTargets.begin()+superOffsets[k],
+                       uniqueTargets.end() ), uniqueTargets.end() );
+        const Int numConn = uniqueTargets.size() - superOffsets[k];
+        if( compressed.SourceOwner(s) == commRank )
+            numLocalEdges += numConn;
+        else
+            numRemoteEdges += numConn;
+    }
+    superOffsets[numLocalSupers] = uniqueTargets.size();
+
+    compressed.Reserve( numLocalEdges, numRemoteEdges );
+    for( Int k=0; k<numLocalSupers; ++k )
+        for( Int e=superOffsets[k]; e<superOffsets[k+1]; ++e )
+            compressed.QueueConnection( firstSuper+k, uniqueTargets[e] );
+    compressed.ProcessQueues();
+    return numSupers;
+}
+
+void ExpandSupervariables
+( const Graph& graph,
+  const Supervariables& supers,
+        Separator& rootSep,
+        NodeInfo& rootInfo )
+{
+    EL_DEBUG_CSE
+    ListTable members;
+    members.offsets = supers.offsets.data();
+    members.values = supers.members.data();
+    ListTable adjacency;
+    adjacency.offsets = graph.LockedOffsetBuffer();
+    adjacency.values = graph.LockedTargetBuffer();
+
+    SegmentMap segments;
+    ExpandSubtreeIndices( rootSep, members, segments );
+    AssignOffsets( rootSep, rootInfo, 0, segments );
+    FinishSubtree( rootSep, rootInfo, segments, adjacency );
+}
+
+void ExpandSupervariables
+( const DistGraph& graph,
+  const Supervariables& supers,
+        DistSeparator& rootSep,
+        DistNodeInfo& rootInfo )
+{
+    EL_DEBUG_CSE
+    mpi::Comm comm = rootInfo.Grid().Comm();
+    const int commRank = mpi::Rank( comm );
+
+    // Gather the path of distributed nodes shared by this process
+    vector<DistSeparator*> seps;
+    vector<DistNodeInfo*> infos;
+    DistSeparator* sep = &rootSep;
+    DistNodeInfo* info = &rootInfo;
+    while( true )
+    {
+        seps.push_back( sep );
+        infos.push_back( info );
+        if( sep->child == nullptr )
+            break;
+        sep = sep->child.get();
+        info = info->child.get();
+    }
+    const Int numDistLevels = seps.size()-1;
+    Separator& sepDup = *seps.back()->duplicate;
+    NodeInfo& infoDup = *infos.back()->duplicate;
+
+    // Fetch the members of the supervariables within our nodes
+    vector<Int> superIds;
+    for( Int level=0; level<numDistLevels; ++level )
+        superIds.insert
+        ( superIds.end(), seps[level]->inds.begin(), seps[level]->inds.end() );
+    CollectIndices( sepDup, superIds );
+    std::sort( superIds.begin(), superIds.end() );
+    superIds.erase
+    ( std::unique( superIds.begin(), superIds.end() ), superIds.end() );
+    const auto& processOffsets = supers.processOffsets;
+    const Int firstSuper = processOffsets[commRank];
+    ListTable members;
+    FetchLists
+    ( superIds,
+      [&]( Int s )
+      { return int(std::upper_bound
+          (processOffsets.begin(),processOffsets.end(),s) -
+          processOffsets.begin())-1; },
+      [&]( Int s )
+      { const Int k = s - firstSuper;
+        return pair<const Int*,Int>
+          ( &supers.members[supers.offsets[k]],
+            supers.offsets[k+1]-supers.offsets[k] ); },
+      comm, members );
+
+    // Expand the indices and compute the sizes of the subtrees (the sizes of
+    // the subtrees of each distributed node are combined over its team)
+    SegmentMap segments;
+    Int subtreeSize = ExpandSubtreeIndices( sepDup, members, segments );
+    vector<Int> leftSizes( numDistLevels ), rightSizes( numDistLevels );
+    for( Int level=numDistLevels-1; level>=0; --level )
+    {
+        DistSeparator& sepLevel = *seps[level];
+        const Int sepSize =
+          ExpandIndices( sepLevel.off, sepLevel.inds, members, segments );
+        const bool onLeft = infos[level+1]->onLeft;
+        Int childSizes[2] = { onLeft ? subtreeSize : 0,
+                              onLeft ? 0 : subtreeSize };
+        mpi::AllReduce( childSizes, 2, mpi::MAX, infos[level]->Grid().Comm() );
+        leftSizes[level] = childSizes[0];
+        rightSizes[level] = childSizes[1];
+        subtreeSize = childSizes[0] + childSizes[1] + sepSize;
+    }
+
+    // Assign the expanded offsets from the top down
+    Int subtreeOff = 0;
+    for( Int level=0; level<numDistLevels; ++level )
+    {
+        const Int sepOff = subtreeOff + leftSizes[level] + rightSizes[level];
+        if( !seps[level]->inds.empty() )
+            segments[seps[level]->off].expandedOff = sepOff;
+        seps[level]->off = sepOff;
+        infos[level]->off = sepOff;
+        infos[level]->size = seps[level]->inds.size();
+        if( !infos[level+1]->onLeft )
+            subtreeOff += leftSizes[level];
+    }
+    AssignOffsets( sepDup, infoDup, subtreeOff, segments );
+
+    // Fetch the connections of the vertices of our leaves
+    vector<Int> leafInds;
+    CollectLeafIndices( sepDup, leafInds );
+    std::sort( leafInds.begin(), leafInds.end() );
+    const Int* offsetBuf = graph.LockedOffsetBuffer();
+    const Int* targetBuf = graph.LockedTargetBuffer();
+    const Int firstLocalSource = graph.FirstLocalSource();
+    ListTable adjacency;
+    FetchLists
+    ( leafInds,
+      [&]( Int s ) { return graph.SourceOwner(s); },
+      [&]( Int s )
+      { const Int sLoc = s - firstLocalSource;
+        return pair<const Int*,Int>
+          ( &targetBuf[offsetBuf[sLoc]], offsetBuf[sLoc+1]-offsetBuf[sLoc] ); },
+      comm, adjacency );
+
+    for( Int level=0; level<numDistLevels; ++level )
+        ExpandLowerStruct( infos[level]->origLowerStruct, segments );
+    FinishSubtree( sepDup, infoDup, segments, adjacency );
+
+    // Pull information up from the duplicates
+    DistSeparator& sepBottom = *seps.back();
+    DistNodeInfo& infoBottom = *infos.back();
+    sepBottom.off = sepDup.off;
+    sepBottom.inds = sepDup.inds;
+    infoBottom.size = infoDup.size;
+    infoBottom.off = infoDup.off;
+    infoBottom.origLowerStruct = infoDup.origLowerStruct;
+}
+
+} // namespace ldl
+} // namespace El
@@ -10,6 +10,7 @@
 
 #include "./LU/Local.hpp"
 #include "./LU/Panel.hpp"
+#include "./LU/Tournament.hpp"
 #include "./LU/Full.hpp"
 #include "./LU/Mod.hpp"
 #include "./LU/SolveAfter.hpp"
@@ -25,7 +26,7 @@ void LU( Matrix<F>& A )
     const Int m = A.Height();
     const Int n = A.Width();
     const Int minDim = Min(m,n);
-    const Int bsize = Blocksize();
+    const Int bsize = Blocksize<F>( BLOCKSIZE_LU );
     for( Int k=0; k<minDim; k+=bsize )
     {
         const Int nb = Min(bsize,minDim-k);
@@ -60,7 +61,7 @@ void LU( AbstractDistMatrix<F>& APre )
     const Int m = A.Height();
     const Int n = A.Width();
     const Int minDim = Min(m,n);
-    const Int bsize = Blocksize();
+    const Int bsize = Blocksize<F>( BLOCKSIZE_LU, g );
     for( Int k=0; k<minDim; k+=bsize )
     {
         const Int nb = Min(bsize,minDim-k);
@@ -109,7 +110,7 @@ void LU( Matrix<F>& A, Permutation& P )
     const Int m = A.Height();
     const Int n = A.Width();
     const Int minDim = Min(m,n);
-    const Int bsize = Blocksize();
+    const Int bsize = Blocksize<F>( BLOCKSIZE_LU );
 
     P.MakeIdentity( m );
     P.ReserveSwaps( minDim );
@@ -141,6 +142,65 @@ void LU( Matrix<F>& A, Permutation& P )
     }
 }
 
+namespace lu {
+
+template<typename F,typename=EnableIf<IsBlasScalar<F>>>
+void ScaLAPACKHelper( DistMatrix<F,MC,MR,BLOCK>& A, DistPermutation& P )
+{
+    AssertScaLAPACKSupport();
+#ifdef EL_HAVE_SCALAPACK
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int minDim = Min(m,n);
+    const Int localHeight = A.LocalHeight();
+
+    // The (one-based) pivots of the local rows are returned redundantly
+    // over each process row
+    auto descA = FillDesc( A );
+    vector<int> ipiv( localHeight+A.BlockHeight() );
+    scalapack::LU( m, n, A.Buffer(), descA.data(), ipiv.data() );
+
+    vector<Int> pivots( minDim, 0 );
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+    {
+        const Int i = A.GlobalRow(iLoc);
+        if( i < minDim )
+            pivots[i] = ipiv[iLoc]-1;
+    }
+    mpi::AllReduce( pivots.data(), minDim, mpi::SUM, A.ColComm() );
+
+    P.MakeIdentity( m );
+    P.ReserveSwaps( minDim );
+    for( Int k=0; k<minDim; ++k )
+        P.Swap( k, pivots[k] );
+#endif
+}
+
+template<typename F,typename=DisableIf<IsBlasScalar<F>>,typename=void>
+void ScaLAPACKHelper( DistMatrix<F,MC,MR,BLOCK>& A, DistPermutation& P )
+{
+    LogicError("ScaLAPACK does not support this datatype");
+}
+
+} // namespace lu
+
+// Block-cyclic matrices are factored in place by ScaLAPACK when possible and
+// otherwise redistributed to and from the elemental algorithm
+template<typename F>
+void LU( DistMatrix<F,MC,MR,BLOCK>& A, DistPermutation& P )
+{
+    EL_DEBUG_CSE
+#ifdef EL_HAVE_SCALAPACK
+    if( IsBlasScalar<F>::value && A.ColCut() == 0 && A.RowCut() == 0 )
+    {
+        lu::ScaLAPACKHelper( A, P );
+        return;
+    }
+#endif
+    AbstractDistMatrix<F>& AAbs = A;
+    LU( AAbs, P );
+}
+
 template<typename F>
 void LU
 ( Matrix<F>& A,
@@ -152,7 +212,15 @@ void LU
 }
 
 template<typename F>
-void LU( AbstractDistMatrix<F>& APre, DistPermutation& P )
+void LU( AbstractDistMatrix<F>& A, DistPermutation& P )
+{
+    EL_DEBUG_CSE
+    LU( A, P, LUCtrl() );
+}
+
+template<typename F>
+void LU
+( AbstractDistMatrix<F>& APre, DistPermutation& P, const LUCtrl& ctrl )
 {
     EL_DEBUG_CSE
 
@@ -176,7 +244,7 @@ void LU( AbstractDistMatrix<F>& APre, DistPermutation& P )
     DistPermutation PB(g);
 
     vector<F> panelBuf, pivotBuf;
-    const Int bsize = Blocksize();
+    const Int bsize = Blocksize<F>( BLOCKSIZE_LU, g );
     for( Int k=0; k<minDim; k+=bsize )
     {
         const Int nb = Min(bsize,minDim-k);
@@ -199,7 +267,10 @@ void LU( AbstractDistMatrix<F>& APre, DistPermutation& P )
         ( A21Height, nb, g, A21.ColAlign(), 0, &panelBuf[nb], panelLDim, 0 );
         A11_STAR_STAR = A11;
         A21_MC_STAR = A21;
-        lu::Panel( A11_STAR_STAR, A21_MC_STAR, P, PB, k, pivotBuf );
+        if( ctrl.panelPivoting == LU_PANEL_TOURNAMENT )
+            lu::PanelTournament( A11_STAR_STAR, A21_MC_STAR, P, PB, k );
+        else
+            lu::Panel( A11_STAR_STAR, A21_MC_STAR, P, PB, k, pivotBuf );
 
         PB.PermuteRows( AB );
 
@@ -241,6 +312,13 @@ void LU
   ( AbstractDistMatrix<F>& A, \
     DistPermutation& P ); \
   template void LU \
+  ( AbstractDistMatrix<F>& A, \
+    DistPermutation& P, \
+    const LUCtrl& ctrl ); \
+  template void LU \
+  ( DistMatrix<F,MC,MR,BLOCK>& A, \
+    DistPermutation& P ); \
+  template void LU \
   ( Matrix<F>& A, \
     Permutation& P, \
     Permutation& Q ); \
@@ -0,0 +1,247 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_LU_TOURNAMENT_HPP
+#define EL_LU_TOURNAMENT_HPP
+
+namespace El {
+namespace lu {
+
+// Overwrite the candidate rows (and their indices) with the (at most n) rows
+// chosen as pivots by Gaussian elimination with partial pivoting. The
+// original, rather than the eliminated, rows are retained.
+template<typename F>
+void TournamentSelect( Matrix<F>& candidates, vector<Int>& indices )
+{
+    EL_DEBUG_CSE
+    const Int h = candidates.Height();
+    const Int n = candidates.Width();
+    const Int numChosen = Min(h,n);
+
+    Matrix<F> W( candidates );
+    F* WBuf = W.Buffer();
+    const Int WLDim = W.LDim();
+    vector<Int> order(h);
+    for( Int i=0; i<h; ++i )
+        order[i] = i;
+    for( Int k=0; k<numChosen; ++k )
+    {
+        const Int iPiv = k + blas::MaxInd( h-k, &WBuf[k+k*WLDim], 1 );
+        if( iPiv != k )
+        {
+            blas::Swap( n, &WBuf[k], WLDim, &WBuf[iPiv], WLDim );
+            std::swap( order[k], order[iPiv] );
+        }
+        // A zero column leaves the choice of the remaining pivots to the
+        // following columns (the final panel factorization will detect any
+        // singularity)
+        const F alpha = WBuf[k+k*WLDim];
+        if( alpha == F(0) )
+            continue;
+        const F alphaInv = F(1) / alpha;
+        blas::Scal( h-(k+1), alphaInv, &WBuf[(k+1)+k*WLDim], 1 );
+        blas::Geru
+        ( h-(k+1), n-(k+1),
+          F(-1), &WBuf[(k+1)+k*WLDim], 1, &WBuf[k+(k+1)*WLDim], WLDim,
+                 &WBuf[(k+1)+(k+1)*WLDim], WLDim );
+    }
+
+    Matrix<F> chosen( numChosen, n );
+    vector<Int> chosenIndices( numChosen );
+    for( Int i=0; i<numChosen; ++i )
+    {
+        chosenIndices[i] = indices[order[i]];
+        for( Int j=0; j<n; ++j )
+            chosen(i,j) = candidates(order[i],j);
+    }
+    candidates = chosen;
+    indices = chosenIndices;
+}
+
+// Communication-avoiding variant of the distributed panel factorization
+// (see Panel.hpp for the conventions on A, B, and the pivot indices)
+//
+// Rather than an AllReduce and a row broadcast per column, the n pivot rows
+// are chosen up front by a tournament: each process of the column
+// communicator selects n candidates from its local rows via partial
+// pivoting, and the candidates are then merged up a binary reduction tree.
+// The winning rows are broadcast once, swapped to the top of the panel, and
+// the panel is eliminated without further pivoting.
+//
+// See Grigori, Demmel, and Xiang, "CALU: A communication optimal LU
+// factorization algorithm", SIAM J. Matrix Anal. Appl., 32(4), 2011.
+template<typename F>
+void PanelTournament
+( DistMatrix<F,  STAR,STAR>& A,
+  DistMatrix<F,  MC,  STAR>& B,
+  DistPermutation& P,
+  DistPermutation& PB,
+  Int offset )
+{
+    EL_DEBUG_CSE
+    EL_PROFILE_REGION("lu::PanelTournament");
+    const Int n = A.Width();
+    const Int BLocHeight = B.LocalHeight();
+    F* ABuf = A.Buffer();
+    F* BBuf = B.Buffer();
+    const Int ALDim = A.LDim();
+    const Int BLDim = B.LDim();
+    mpi::Comm colComm = B.ColComm();
+    const int colRank = mpi::Rank( colComm );
+    const int colSize = mpi::Size( colComm );
+    EL_DEBUG_ONLY(
+      AssertSameGrids( A, B );
+      if( n != B.Width() )
+          LogicError("A and B must be the same width");
+      if( A.Buffer()+n != B.Buffer() )
+          LogicError("Buffers of A and B did not properly align");
+    )
+
+    PB.MakeIdentity( A.Height()+B.Height() );
+    PB.ReserveSwaps( n );
+
+    // Since A is replicated, its rows only compete from the root
+    const Int numALocal = ( colRank == 0 ? n : 0 );
+    Matrix<F> candidates( numALocal+BLocHeight, n );
+    vector<Int> indices( numALocal+BLocHeight );
+    for( Int i=0; i<numALocal; ++i )
+    {
+        indices[i] = i;
+        for( Int j=0; j<n; ++j )
+            candidates(i,j) = ABuf[i+j*ALDim];
+    }
+    for( Int iLoc=0; iLoc<BLocHeight; ++iLoc )
+    {
+        indices[numALocal+iLoc] = B.GlobalRow(iLoc) + n;
+        for( Int j=0; j<n; ++j )
+            candidates(numALocal+iLoc,j) = BBuf[iLoc+j*BLDim];
+    }
+    TournamentSelect( candidates, indices );
+
+    // Merge the candidates up a binary tree rooted at process row 0
+    vector<Int> indexBuf( n+1 );
+    vector<F> rowBuf( n*n );
+    for( int step=1; step<colSize; step*=2 )
+    {
+        if( colRank % (2*step) == step )
+        {
+            const Int numCandidates = candidates.Height();
+            indexBuf[0] = numCandidates;
+            for( Int i=0; i<numCandidates; ++i )
+            {
+                indexBuf[i+1] = indices[i];
+                for( Int j=0; j<n; ++j )
+                    rowBuf[i+j*numCandidates] = candidates(i,j);
+            }
+            mpi::Send( indexBuf.data(), n+1, colRank-step, colComm );
+            mpi::Send( rowBuf.data(), n*n, colRank-step, colComm );
+            break;
+        }
+        else if( colRank+step < colSize )
+        {
+            mpi::Recv( indexBuf.data(), n+1, colRank+step, colComm );
+            mpi::Recv( rowBuf.data(), n*n, colRank+step, colComm );
+            const Int numMine = candidates.Height();
+            const Int numTheirs = indexBuf[0];
+            Matrix<F> merged( numMine+numTheirs, n );
+            vector<Int> mergedIndices( numMine+numTheirs );
+            for( Int i=0; i<numMine; ++i )
+            {
+                mergedIndices[i] = indices[i];
+                for( Int j=0; j<n; ++j )
+                    merged(i,j) = candidates(i,j);
+            }
+            for( Int i=0; i<numTheirs; ++i )
+            {
+                mergedIndices[numMine+i] = indexBuf[i+1];
+                for( Int j=0; j<n; ++j )
+                    merged(numMine+i,j) = rowBuf[i+j*numTheirs];
+            }
+            TournamentSelect( merged, mergedIndices );
+            candidates = merged;
+            indices = mergedIndices;
+        }
+    }
+
+    // Broadcast the winning rows (the panel height is at least n)
+    if( colRank == 0 )
+    {
+        for( Int i=0; i<n; ++i )
+        {
+            indexBuf[i] = indices[i];
+            for( Int j=0; j<n; ++j )
+                rowBuf[i+j*n] = candidates(i,j);
+        }
+    }
+    mpi::Broadcast( indexBuf.data(), n, 0, colComm );
+    mpi::Broadcast( rowBuf.data(), n*n, 0, colComm );
+
+    // Form the swap sequence which moves the winners to the top while
+    // tracking which original row ends up in each touched position of B.
+    // Since the rows which leave B are winners, and the winners end up in A,
+    // every row displaced into B originated in (the replicated) A.
+    std::map<Int,Int> contents, positions;
+    for( Int k=0; k<n; ++k )
+    {
+        const Int winner = indexBuf[k];
+        auto winnerIt = positions.find( winner );
+        const Int iPiv =
+          ( winnerIt==positions.end() ? winner : winnerIt->second );
+        P.Swap( k+offset, iPiv+offset );
+        PB.Swap( k, iPiv );
+        if( iPiv != k )
+        {
+            auto displacedIt = contents.find( k );
+            const Int displaced =
+              ( displacedIt==contents.end() ? k : displacedIt->second );
+            contents[k] = winner;
+            contents[iPiv] = displaced;
+            positions[winner] = k;
+            positions[displaced] = iPiv;
+        }
+    }
+
+    // Apply the swaps to the panel
+    for( const auto& entry : contents )
+    {
+        const Int pos = entry.first;
+        const Int row = entry.second;
+        if( pos >= n && B.IsLocalRow(pos-n) )
+        {
+            const Int iLoc = B.LocalRow(pos-n);
+            for( Int j=0; j<n; ++j )
+                BBuf[iLoc+j*BLDim] = ABuf[row+j*ALDim];
+        }
+    }
+    for( Int j=0; j<n; ++j )
+        for( Int i=0; i<n; ++i )
+            ABuf[i+j*ALDim] = rowBuf[i+j*n];
+
+    // Eliminate without pivoting
+    for( Int k=0; k<n; ++k )
+    {
+        const Int ind2Size = n-k-1;
+        const F* a12Buf = &ABuf[ k    + (k+1)*ALDim];
+              F* a21Buf = &ABuf[(k+1) +  k   *ALDim];
+              F* A22Buf = &ABuf[(k+1) + (k+1)*ALDim];
+
+        const F alpha = ABuf[k+k*ALDim];
+        if( alpha == F(0) )
+            throw SingularMatrixException();
+        const F alpha11Inv = F(1) / alpha;
+        blas::Scal( ind2Size+BLocHeight, alpha11Inv, a21Buf, 1 );
+        blas::Geru
+        ( ind2Size+BLocHeight, ind2Size, F(-1),
+          a21Buf, 1, a12Buf, ALDim, A22Buf, ALDim );
+    }
+}
+
+} // namespace lu
+} // namespace El
+
+#endif // ifndef EL_LU_TOURNAMENT_HPP
@@ -14,10 +14,12 @@
 #include "./QR/Householder.hpp"
 #include "./QR/SolveAfter.hpp"
 #include "./QR/Explicit.hpp"
+#include "./QR/Tournament.hpp"
 
 #include "./QR/ColSwap.hpp"
 
 #include "./QR/TS.hpp"
+#include "./QR/CA.hpp"
 
 namespace El {
 
@@ -75,8 +77,24 @@ void QR
     qr::Householder( A, householderScalars, signature );
 }
 
-// Variants which perform (Businger-Golub) column-pivoting
-// =======================================================
+template<typename F>
+void QR
+( AbstractDistMatrix<F>& A,
+  AbstractDistMatrix<F>& householderScalars,
+  AbstractDistMatrix<Base<F>>& signature,
+  const QRCtrl<Base<F>>& ctrl )
+{
+    EL_DEBUG_CSE
+    if( ctrl.colPiv )
+        LogicError("Column pivoting requires a permutation argument");
+    if( ctrl.communicationAvoiding )
+        qr::CommunicationAvoiding( A, householderScalars, signature );
+    else
+        qr::Householder( A, householderScalars, signature );
+}
+
+// Variants which perform (Businger-Golub or tournament) column-pivoting
+// =====================================================================
 
 template<typename F>
 void QR
@@ -87,7 +105,11 @@ void QR
   const QRCtrl<Base<F>>& ctrl )
 {
     EL_DEBUG_CSE
-    qr::BusingerGolub( A, householderScalars, signature, Omega, ctrl );
+    if( ctrl.colPivoting == QR_COLPIV_TOURNAMENT )
+        qr::TournamentPivoting
+        ( A, householderScalars, signature, Omega, ctrl );
+    else
+        qr::BusingerGolub( A, householderScalars, signature, Omega, ctrl );
 }
 
 template<typename F>
@@ -99,7 +121,11 @@ void QR
   const QRCtrl<Base<F>>& ctrl )
 {
     EL_DEBUG_CSE
-    qr::BusingerGolub( A, householderScalars, signature, Omega, ctrl );
+    if( ctrl.colPivoting == QR_COLPIV_TOURNAMENT )
+        qr::TournamentPivoting
+        ( A, householderScalars, signature, Omega, ctrl );
+    else
+        qr::BusingerGolub( A, householderScalars, signature, Omega, ctrl );
 }
 
 #define PROTO(F) \
@@ -112,6 +138,11 @@ void QR
     AbstractDistMatrix<F>& householderScalars, \
     AbstractDistMatrix<Base<F>>& signature ); \
   template void QR \
+  ( AbstractDistMatrix<F>& A, \
+    AbstractDistMatrix<F>& householderScalars, \
+    AbstractDistMatrix<Base<F>>& signature, \
+    const QRCtrl<Base<F>>& ctrl ); \
+  template void QR \
   ( Matrix<F>& A, \
     Matrix<F>& householderScalars, \
     Matrix<Base<F>>& signature, \
@@ -169,6 +200,14 @@ void QR
     const Matrix<Base<F>>& signature, \
           Matrix<F>& B ); \
   template void qr::ApplyQ \
+  ( LeftOrRight side, \
+    Orientation orientation, \
+    const Matrix<F>& A, \
+    const Matrix<F>& householderScalars, \
+    const Matrix<Base<F>>& signature, \
+    const CompactWY<F>& wy, \
+          Matrix<F>& B ); \
+  template void qr::ApplyQ \
   ( LeftOrRight side, \
     Orientation orientation, \
     const AbstractDistMatrix<F>& A, \
@@ -183,6 +222,14 @@ void QR
     const Matrix<F>& B, \
           Matrix<F>& X ); \
   template void qr::SolveAfter \
+  ( Orientation orientation, \
+    const Matrix<F>& A, \
+    const Matrix<F>& householderScalars, \
+    const Matrix<Base<F>>& signature, \
+    const CompactWY<F>& wy, \
+    const Matrix<F>& B, \
+          Matrix<F>& X ); \
+  template void qr::SolveAfter \
   ( Orientation orientation, \
     const AbstractDistMatrix<F>& A, \
     const AbstractDistMatrix<F>& householderScalars, \
@@ -195,6 +242,14 @@ void QR
   template void qr::Cholesky \
   ( AbstractDistMatrix<F>& A, \
     AbstractDistMatrix<F>& R ); \
+  template void qr::Cholesky \
+  ( Matrix<F>& A, \
+    Matrix<F>& R, \
+    const CholeskyQRCtrl<Base<F>>& ctrl ); \
+  template void qr::Cholesky \
+  ( AbstractDistMatrix<F>& A, \
+    AbstractDistMatrix<F>& R, \
+    const CholeskyQRCtrl<Base<F>>& ctrl ); \
   template qr::TreeData<F> qr::TS( const AbstractDistMatrix<F>& A ); \
   template void qr::ExplicitTS \
   ( AbstractDistMatrix<F>& A, \
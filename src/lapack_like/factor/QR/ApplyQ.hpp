@@ -19,6 +19,7 @@ void ApplyQ
   const Matrix<F>& A,
   const Matrix<F>& householderScalars,
   const Matrix<Base<F>>& signature,
+  const CompactWY<F>& wy,
         Matrix<F>& B )
 {
     EL_DEBUG_CSE
@@ -49,7 +50,7 @@ void ApplyQ
 
     ApplyPackedReflectors
     ( side, LOWER, VERTICAL, direction, conjugation, 0,
-      A, householderScalars, B );
+      A, householderScalars, wy, B );
 
     if( !applyDFirst )
     {
@@ -66,6 +67,21 @@ void ApplyQ
     }
 }
 
+template<typename F>
+void ApplyQ
+( LeftOrRight side,
+  Orientation orientation,
+  const Matrix<F>& A,
+  const Matrix<F>& householderScalars,
+  const Matrix<Base<F>>& signature,
+        Matrix<F>& B )
+{
+    EL_DEBUG_CSE
+    ApplyQ
+    ( side, orientation, A, householderScalars, signature, CompactWY<F>(),
+      B );
+}
+
 template<typename F>
 void ApplyQ
 ( LeftOrRight side,
@@ -0,0 +1,153 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_QR_CA_HPP
+#define EL_QR_CA_HPP
+
+namespace El {
+namespace qr {
+
+// Overwrite the top n x n block, Q1, of an orthonormal matrix Q with the
+// unpivoted factorization Q1 - S = L1 U, where the signs S are chosen as the
+// elimination proceeds so that each pivot has magnitude at least one
+template<typename F>
+void ReconstructionLU( Matrix<F>& Q1, Matrix<Base<F>>& signs )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    const Int n = Q1.Height();
+    F* QBuf = Q1.Buffer();
+    const Int QLDim = Q1.LDim();
+    signs.Resize( n, 1 );
+    for( Int k=0; k<n; ++k )
+    {
+        const Real sign = ( RealPart(QBuf[k+k*QLDim]) >= Real(0) ?
+                            Real(-1) : Real(1) );
+        signs(k) = sign;
+        QBuf[k+k*QLDim] -= sign;
+        const F alphaInv = F(1) / QBuf[k+k*QLDim];
+        blas::Scal( n-(k+1), alphaInv, &QBuf[(k+1)+k*QLDim], 1 );
+        blas::Geru
+        ( n-(k+1), n-(k+1),
+          F(-1), &QBuf[(k+1)+k*QLDim], 1, &QBuf[k+(k+1)*QLDim], QLDim,
+                 &QBuf[(k+1)+(k+1)*QLDim], QLDim );
+    }
+}
+
+// Factor a column panel with TSQR and then reconstruct the Householder
+// representation used by PanelHouseholder from the explicit tree Q.
+//
+// If Q - [S; 0] = L U, with S a diagonal matrix of signs, then
+// (I - Y T Y^H) [S; 0] = Q for Y = L and T = -U S inv(Y1)^H, where Y1 is the
+// top block of Y. The reflectors then have the scalars diag(T) = -diag(U) S,
+// the signature is S, and R is the triangular factor from TSQR.
+//
+// See Ballard et al., "Reconstructing Householder vectors from Tall-Skinny
+// QR", J. Parallel Distrib. Comput., 85, 2015.
+//
+// False is returned if TSQR does not support the panel (a power-of-two
+// number of processes holding at least n rows each is required).
+template<typename F>
+bool PanelTSQR
+( DistMatrix<F>& A,
+  AbstractDistMatrix<F>& householderScalars,
+  AbstractDistMatrix<Base<F>>& signature )
+{
+    EL_DEBUG_CSE
+    EL_PROFILE_REGION("qr::PanelTSQR");
+    typedef Base<F> Real;
+    const Grid& g = A.Grid();
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int p = g.Size();
+    if( n == 0 || !PowerOfTwo(p) || m < p*n )
+        return false;
+
+    DistMatrix<F,VC,STAR> Q( A );
+    auto treeData = TS( Q );
+    const auto R = ts::FormR( Q, treeData );
+    ts::FormQ( Q, treeData );
+
+    auto Q1 = Q( IR(0,n), ALL );
+    auto Q2 = Q( IR(n,END), ALL );
+    DistMatrix<F,STAR,STAR> Q1_STAR_STAR( Q1 );
+    Matrix<Real> signs;
+    ReconstructionLU( Q1_STAR_STAR.Matrix(), signs );
+    LocalTrsm( RIGHT, UPPER, NORMAL, NON_UNIT, F(1), Q1_STAR_STAR, Q2 );
+
+    DistMatrix<F,STAR,STAR> householderScalars_STAR_STAR( n, 1, g );
+    DistMatrix<Real,STAR,STAR> signature_STAR_STAR( n, 1, g );
+    auto& Y1 = Q1_STAR_STAR.Matrix();
+    const auto& RLoc = R.LockedMatrix();
+    for( Int k=0; k<n; ++k )
+    {
+        householderScalars_STAR_STAR.Matrix()(k) = -Y1(k,k)*signs(k);
+        signature_STAR_STAR.Matrix()(k) = signs(k);
+    }
+    // Overwrite the upper triangle of Y1 with R
+    for( Int j=0; j<n; ++j )
+        for( Int i=0; i<=j; ++i )
+            Y1(i,j) = RLoc(i,j);
+    Q1 = Q1_STAR_STAR;
+
+    Copy( Q, A );
+    Copy( householderScalars_STAR_STAR, householderScalars );
+    Copy( signature_STAR_STAR, signature );
+    return true;
+}
+
+// Communication-avoiding QR (CAQR): each panel is factored with TSQR, which
+// requires O(log p) messages rather than O(n log p), and the reconstructed
+// reflectors are applied to the trailing matrix in blocked form
+template<typename F>
+void CommunicationAvoiding
+( AbstractDistMatrix<F>& APre,
+  AbstractDistMatrix<F>& householderScalarsPre,
+  AbstractDistMatrix<Base<F>>& signaturePre )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(AssertSameGrids( APre, householderScalarsPre, signaturePre ))
+    const Int m = APre.Height();
+    const Int n = APre.Width();
+    const Int minDim = Min(m,n);
+
+    DistMatrixReadWriteProxy<F,F,MC,MR> AProx( APre );
+    DistMatrixWriteProxy<F,F,MD,STAR>
+      householderScalarsProx( householderScalarsPre );
+    DistMatrixWriteProxy<Base<F>,Base<F>,MD,STAR> signatureProx( signaturePre );
+    auto& A = AProx.Get();
+    auto& householderScalars = householderScalarsProx.Get();
+    auto& signature = signatureProx.Get();
+
+    householderScalars.Resize( minDim, 1 );
+    signature.Resize( minDim, 1 );
+
+    const Int bsize = Blocksize();
+    for( Int k=0; k<minDim; k+=bsize )
+    {
+        const Int nb = Min(bsize,minDim-k);
+
+        const Range<Int> ind1( k,    k+nb ),
+                         indB( k,    END  ),
+                         ind2( k+nb, END  );
+
+        auto AB1 = A( indB, ind1 );
+        auto AB2 = A( indB, ind2 );
+        auto householderScalars1 = householderScalars( ind1, ALL );
+        auto sig1 = signature( ind1, ALL );
+
+        if( !PanelTSQR( AB1, householderScalars1, sig1 ) )
+            PanelHouseholder( AB1, householderScalars1, sig1 );
+        ApplyQ( LEFT, ADJOINT, AB1, householderScalars1, sig1, AB2 );
+    }
+}
+
+} // namespace qr
+} // namespace El
+
+#endif // ifndef EL_QR_CA_HPP
@@ -51,6 +51,140 @@ void Cholesky( AbstractDistMatrix<F>& APre, AbstractDistMatrix<F>& RPre )
     Trsm( RIGHT, UPPER, NORMAL, NON_UNIT, F(1), R.Matrix(), A.Matrix() );
 }
 
+namespace cholesky_qr {
+
+// The shift of Fukaya et al.'s shifted CholeskyQR3,
+// 11 (m n + n (n+1)) eps ||A||_F^2, where ||A||_F^2 is the trace of the Gram
+// matrix A^H A
+template<typename F>
+Base<F> Shift( Int m, const Matrix<F>& G )
+{
+    typedef Base<F> Real;
+    const Int n = G.Height();
+    Real frobSquared = 0;
+    for( Int j=0; j<n; ++j )
+        frobSquared += RealPart(G(j,j));
+    return Real(11)*Real(m*n+n*(n+1))*limits::Epsilon<Real>()*frobSquared;
+}
+
+// Overwrites R with the upper Cholesky factor of the Gram matrix G and
+// returns whether the factor exists and has an estimated condition number of
+// at most 'maxCondition'
+template<typename F>
+bool TryFactor( const Matrix<F>& G, Matrix<F>& R, Base<F> maxCondition )
+{
+    EL_DEBUG_CSE
+    R = G;
+    try
+    {
+        El::Cholesky( UPPER, R );
+    }
+    catch( NonHPDMatrixException& e )
+    {
+        return false;
+    }
+    MakeTrapezoidal( UPPER, R );
+    Matrix<F> RInv( R );
+    TriangularInverse( UPPER, NON_UNIT, RInv );
+    const Base<F> condition = OneNorm(R)*OneNorm(RInv);
+    // NaN's fail the comparison
+    return condition <= maxCondition;
+}
+
+// Overwrites R with the upper Cholesky factor of the Gram matrix G of the
+// m x n matrix A, shifted if requested (or required by the automatic
+// selection), and returns the number of additional CholeskyQR passes
+template<typename F>
+Int FirstFactor
+( Int m, const Matrix<F>& G, Matrix<F>& R,
+  const CholeskyQRCtrl<Base<F>>& ctrl )
+{
+    EL_DEBUG_CSE
+    bool shift = ( ctrl.variant == CHOLESKY_QR3_SHIFTED );
+    if( ctrl.variant == CHOLESKY_QR_AUTO )
+        shift = !TryFactor( G, R, ctrl.maxCondition );
+    else if( !shift )
+    {
+        R = G;
+        El::Cholesky( UPPER, R );
+    }
+    if( shift )
+    {
+        R = G;
+        ShiftDiagonal( R, Shift(m,G) );
+        El::Cholesky( UPPER, R );
+    }
+    MakeTrapezoidal( UPPER, R );
+    return ( ctrl.variant == CHOLESKY_QR1 ? 0 : ( shift ? 2 : 1 ) );
+}
+
+} // namespace cholesky_qr
+
+// Since each pass runs CholeskyQR on the output of the last, the final
+// triangular factor is the product of those of the passes
+template<typename F>
+void Cholesky
+( Matrix<F>& A, Matrix<F>& R, const CholeskyQRCtrl<Base<F>>& ctrl )
+{
+    EL_DEBUG_CSE
+    const Int m = A.Height();
+    if( m < A.Width() )
+        LogicError("A^H A will be singular");
+
+    Matrix<F> G;
+    Herk( UPPER, ADJOINT, Base<F>(1), A, G );
+    const Int numExtraPasses = cholesky_qr::FirstFactor( m, G, R, ctrl );
+    Trsm( RIGHT, UPPER, NORMAL, NON_UNIT, F(1), R, A );
+
+    Matrix<F> RPass;
+    for( Int pass=0; pass<numExtraPasses; ++pass )
+    {
+        Cholesky( A, RPass );
+        Trmm( LEFT, UPPER, NORMAL, NON_UNIT, F(1), RPass, R );
+    }
+    if( ctrl.progress )
+        Output("CholeskyQR used ",numExtraPasses+1," passes");
+}
+
+template<typename F>
+void Cholesky
+( AbstractDistMatrix<F>& APre, AbstractDistMatrix<F>& RPre,
+  const CholeskyQRCtrl<Base<F>>& ctrl )
+{
+    EL_DEBUG_CSE
+    const Int m = APre.Height();
+    const Int n = APre.Width();
+    if( m < n )
+        LogicError("A^H A will be singular");
+
+    DistMatrixReadWriteProxy<F,F,VC,STAR> AProx( APre );
+    DistMatrixWriteProxy<F,F,STAR,STAR> RProx( RPre );
+    auto& A = AProx.Get();
+    auto& R = RProx.Get();
+
+    // Every process redundantly factors the reduced Gram matrix, and so all
+    // of them make the same selection
+    DistMatrix<F,STAR,STAR> G( A.Grid() );
+    Zeros( G, n, n );
+    Herk( UPPER, ADJOINT, Base<F>(1), A.Matrix(), Base<F>(0), G.Matrix() );
+    El::AllReduce( G, A.ColComm() );
+    R.Resize( n, n );
+    const Int numExtraPasses =
+      cholesky_qr::FirstFactor( m, G.Matrix(), R.Matrix(), ctrl );
+    Trsm( RIGHT, UPPER, NORMAL, NON_UNIT, F(1), R.Matrix(), A.Matrix() );
+
+    DistMatrix<F,STAR,STAR> RPass( A.Grid() );
+    for( Int pass=0; pass<numExtraPasses; ++pass )
+    {
+        Cholesky( A, RPass );
+        Trmm
+        ( LEFT, UPPER, NORMAL, NON_UNIT,
+          F(1), RPass.Matrix(), R.Matrix() );
+    }
+    if( ctrl.progress && A.Grid().Rank() == 0 )
+        Output("CholeskyQR used ",numExtraPasses+1," passes");
+}
+
 } // namespace qr
 } // namespace El
 
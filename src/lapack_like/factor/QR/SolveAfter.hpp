@@ -20,6 +20,7 @@ void SolveAfter
   const Matrix<F>& A,
   const Matrix<F>& householderScalars,
   const Matrix<Base<F>>& signature,
+  const CompactWY<F>& wy,
   const Matrix<F>& B,
         Matrix<F>& X )
 {
@@ -40,7 +41,7 @@ void SolveAfter
         X = B;
 
         // Apply Q' to X
-        qr::ApplyQ( LEFT, ADJOINT, A, householderScalars, signature, X );
+        qr::ApplyQ( LEFT, ADJOINT, A, householderScalars, signature, wy, X );
 
         // Shrink X to its new height
         X.Resize( n, X.Width() );
@@ -67,13 +68,27 @@ void SolveAfter
         Trsm( LEFT, UPPER, ADJOINT, NON_UNIT, F(1), AT, XT, true );
 
         // Apply Q to X
-        qr::ApplyQ( LEFT, NORMAL, A, householderScalars, signature, X );
+        qr::ApplyQ( LEFT, NORMAL, A, householderScalars, signature, wy, X );
 
         if( orientation == TRANSPOSE )
             Conjugate( X );
     }
 }
 
+template<typename F>
+void SolveAfter
+( Orientation orientation,
+  const Matrix<F>& A,
+  const Matrix<F>& householderScalars,
+  const Matrix<Base<F>>& signature,
+  const Matrix<F>& B,
+        Matrix<F>& X )
+{
+    EL_DEBUG_CSE
+    SolveAfter
+    ( orientation, A, householderScalars, signature, CompactWY<F>(), B, X );
+}
+
 template<typename F>
 void SolveAfter
 ( Orientation orientation,
@@ -0,0 +1,409 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_QR_TOURNAMENT_HPP
+#define EL_QR_TOURNAMENT_HPP
+
+#include "./ApplyQ.hpp"
+#include "./BusingerGolub.hpp"
+#include "./PanelHouseholder.hpp"
+
+// Column-pivoted QR with tournament pivoting (QRTP): rather than a global
+// reduction (and a norm downdate) per column, the nb pivots of each panel are
+// chosen up front by a tournament over the trailing columns, swapped to the
+// front, and the panel is then factored and applied without pivoting.
+//
+// Each round of the tournament selects at most nb winners from groups of at
+// most 2 nb candidates via a greedy (diagonally pivoted) Cholesky
+// factorization of the Gram matrix of each group, which, in exact arithmetic,
+// chooses the same columns as a Businger-Golub factorization of the group.
+// The Gram matrices of all of the groups of a round are formed with a single
+// reduction.
+//
+// See Demmel, Grigori, Gu, and Xiang, "Communication avoiding rank revealing
+// QR factorization with column pivoting", SIAM J. Matrix Anal. Appl., 36(1),
+// 2015.
+
+namespace El {
+namespace qr {
+namespace tournament {
+
+// Returns the (at most maxChosen) positions chosen, in order, by a greedy
+// Cholesky factorization of the Hermitian Gram matrix G, which is overwritten
+template<typename F>
+vector<Int> SelectFromGram( Matrix<F>& G, Int maxChosen )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    const Int w = G.Height();
+    const Int numChosen = Min(w,maxChosen);
+    vector<Int> order(w);
+    for( Int t=0; t<w; ++t )
+        order[t] = t;
+    for( Int s=0; s<numChosen; ++s )
+    {
+        Int p = s;
+        Real maxDiag = RealPart(G(s,s));
+        for( Int t=s+1; t<w; ++t )
+        {
+            if( RealPart(G(t,t)) > maxDiag )
+            {
+                p = t;
+                maxDiag = RealPart(G(t,t));
+            }
+        }
+        if( p != s )
+        {
+            RowSwap( G, s, p );
+            ColSwap( G, s, p );
+            std::swap( order[s], order[p] );
+        }
+        // The remaining columns lie in the span of those already chosen, so
+        // their order is immaterial
+        if( maxDiag <= Real(0) )
+            break;
+        for( Int j=s+1; j<w; ++j )
+        {
+            const F gamma = G(s,j) / maxDiag;
+            for( Int i=s+1; i<w; ++i )
+                G(i,j) -= G(i,s)*gamma;
+        }
+    }
+    order.resize( numChosen );
+    return order;
+}
+
+// Plays rounds of the tournament over 'candidates' until a single group
+// remains, where 'formGrams' returns the Gram matrices of a list of groups
+template<typename F,class GramType>
+vector<Int> Play
+( vector<Int> candidates, Int numChosen, const GramType& formGrams )
+{
+    EL_DEBUG_CSE
+    const Int groupSize = 2*numChosen;
+    vector<vector<Int>> groups;
+    vector<Matrix<F>> grams;
+    while( !candidates.empty() )
+    {
+        const Int numCandidates = candidates.size();
+        const Int numGroups = (numCandidates+groupSize-1) / groupSize;
+        groups.resize( numGroups );
+        for( Int g=0; g<numGroups; ++g )
+            groups[g].assign
+            ( candidates.begin()+g*groupSize,
+              candidates.begin()+Min((g+1)*groupSize,numCandidates) );
+        formGrams( groups, grams );
+
+        candidates.resize( 0 );
+        for( Int g=0; g<numGroups; ++g )
+            for( const Int t : SelectFromGram( grams[g], numChosen ) )
+                candidates.push_back( groups[g][t] );
+        if( numGroups == 1 )
+            break;
+    }
+    return candidates;
+}
+
+// Gathers the rows beginning at 'rowOffset' of the listed columns of A into a
+// contiguous block
+template<typename F>
+void GatherColumns
+( const Matrix<F>& A,
+        Int rowOffset,
+  const vector<Int>& cols,
+        Matrix<F>& block )
+{
+    EL_DEBUG_CSE
+    const Int height = A.Height()-rowOffset;
+    block.Resize( height, cols.size() );
+    for( size_t t=0; t<cols.size(); ++t )
+        MemCopy
+        ( block.Buffer(0,t), A.LockedBuffer(rowOffset,cols[t]), height );
+}
+
+// Returns the sequence of swaps which moves the winners (in the original
+// column locations) to positions k, k+1, ...
+inline vector<Int> SwapDestinations( Int k, const vector<Int>& winners )
+{
+    EL_DEBUG_CSE
+    std::map<Int,Int> contents, positions;
+    vector<Int> dests( winners.size() );
+    for( size_t j=0; j<winners.size(); ++j )
+    {
+        const Int target = k + j;
+        const Int winner = winners[j];
+        auto winnerIt = positions.find( winner );
+        const Int iPiv =
+          ( winnerIt==positions.end() ? winner : winnerIt->second );
+        dests[j] = iPiv;
+        if( iPiv != target )
+        {
+            auto displacedIt = contents.find( target );
+            const Int displaced =
+              ( displacedIt==contents.end() ? target : displacedIt->second );
+            contents[target] = winner;
+            contents[iPiv] = displaced;
+            positions[winner] = target;
+            positions[displaced] = iPiv;
+        }
+    }
+    return dests;
+}
+
+template<typename Real>
+void CheckCtrl( const QRCtrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    if( ctrl.smallestFirst )
+        LogicError("Tournament pivoting does not support smallestFirst");
+}
+
+} // namespace tournament
+
+template<typename F>
+void TournamentPivoting
+(       Matrix<F>& A,
+        Matrix<F>& householderScalars,
+        Matrix<Base<F>>& signature,
+        Permutation& Omega,
+  const QRCtrl<Base<F>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    tournament::CheckCtrl( ctrl );
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int minDim = Min(m,n);
+    const Int maxSteps = ( ctrl.boundRank ? Min(ctrl.maxRank,minDim) : minDim );
+    householderScalars.Resize( maxSteps, 1 );
+    signature.Resize( maxSteps, 1 );
+
+    vector<Real> norms;
+    const Real maxOrigNorm = ColNorms( A, norms );
+
+    Omega.MakeIdentity( n );
+    Omega.ReserveSwaps( n );
+
+    const Int bsize = Blocksize<F>( BLOCKSIZE_QR );
+    Matrix<F> block;
+    Int k=0;
+    while( k < maxSteps )
+    {
+        const Int nb = Min(bsize,maxSteps-k);
+        auto formGrams =
+          [&]( const vector<vector<Int>>& groups, vector<Matrix<F>>& grams )
+          {
+              grams.resize( groups.size() );
+              for( size_t g=0; g<groups.size(); ++g )
+              {
+                  tournament::GatherColumns( A, k, groups[g], block );
+                  Gemm( ADJOINT, NORMAL, F(1), block, block, grams[g] );
+              }
+          };
+        vector<Int> candidates( n-k );
+        for( Int j=k; j<n; ++j )
+            candidates[j-k] = j;
+        const auto winners =
+          tournament::Play<F>( candidates, nb, formGrams );
+        const auto dests = tournament::SwapDestinations( k, winners );
+        for( Int j=0; j<nb; ++j )
+        {
+            Omega.Swap( k+j, dests[j] );
+            ColSwap( A, k+j, dests[j] );
+        }
+
+        const Range<Int> ind1( k, k+nb ), indB( k, END ), ind2( k+nb, END );
+        auto AB1 = A( indB, ind1 );
+        auto AB2 = A( indB, ind2 );
+        auto householderScalars1 = householderScalars( ind1, ALL );
+        auto sig1 = signature( ind1, ALL );
+        PanelHouseholder( AB1, householderScalars1, sig1 );
+        ApplyQ( LEFT, ADJOINT, AB1, householderScalars1, sig1, AB2 );
+
+        // Since reflectors k+j, k+j+1, ... do not modify the first k+j rows,
+        // truncating within the panel leaves a consistent factorization
+        if( ctrl.adaptive )
+        {
+            Int j=0;
+            for( ; j<nb; ++j )
+                if( Abs(A(k+j,k+j)) <= ctrl.tol*maxOrigNorm )
+                    break;
+            if( j < nb )
+            {
+                k += j;
+                break;
+            }
+        }
+        k += nb;
+    }
+    householderScalars.Resize( k, 1 );
+    signature.Resize( k, 1 );
+}
+
+template<typename F>
+void TournamentPivoting
+( AbstractDistMatrix<F>& APre,
+  AbstractDistMatrix<F>& householderScalarsPre,
+  AbstractDistMatrix<Base<F>>& signaturePre,
+  DistPermutation& Omega,
+  const QRCtrl<Base<F>>& ctrl )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(AssertSameGrids( APre, householderScalarsPre, signaturePre ))
+    typedef Base<F> Real;
+    tournament::CheckCtrl( ctrl );
+
+    DistMatrixReadWriteProxy<F,F,MC,MR> AProx( APre );
+    DistMatrixWriteProxy<F,F,MD,STAR>
+      householderScalarsProx( householderScalarsPre );
+    DistMatrixWriteProxy<Base<F>,Base<F>,MD,STAR> signatureProx( signaturePre );
+    auto& A = AProx.Get();
+    auto& householderScalars = householderScalarsProx.Get();
+    auto& signature = signatureProx.Get();
+
+    const Grid& g = A.Grid();
+    mpi::Comm colComm = g.ColComm();
+    mpi::Comm rowComm = g.RowComm();
+    const int rowSize = mpi::Size( rowComm );
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int minDim = Min(m,n);
+    const Int maxSteps = ( ctrl.boundRank ? Min(ctrl.maxRank,minDim) : minDim );
+    householderScalars.Resize( maxSteps, 1 );
+    signature.Resize( maxSteps, 1 );
+
+    vector<Real> norms;
+    const Real maxOrigNorm = ColNorms( A, norms );
+
+    Omega.MakeIdentity( n );
+    Omega.ReserveSwaps( n );
+
+    const Int bsize = Blocksize<F>( BLOCKSIZE_QR, g );
+    const Matrix<F>& ALoc = A.LockedMatrix();
+    Matrix<F> block, CLoc, GFinal;
+    vector<F> gramBuf;
+    vector<Int> winnerBuf, allWinners;
+    DistPermutation PPanel(g);
+    DistMatrix<F,STAR,STAR> d_STAR_STAR(g);
+    Int k=0;
+    while( k < maxSteps )
+    {
+        const Int nb = Min(bsize,maxSteps-k);
+        const Int localRowOffset = A.LocalRowOffset(k);
+
+        // The local columns of each process column first compete amongst
+        // themselves, which only requires reductions within the process
+        // column
+        auto formGrams =
+          [&]( const vector<vector<Int>>& groups, vector<Matrix<F>>& grams )
+          {
+              const Int numGroups = groups.size();
+              Int bufSize = 0;
+              for( Int q=0; q<numGroups; ++q )
+                  bufSize += groups[q].size()*groups[q].size();
+              gramBuf.resize( bufSize );
+              grams.resize( numGroups );
+              Int offset = 0;
+              for( Int q=0; q<numGroups; ++q )
+              {
+                  const Int w = groups[q].size();
+                  tournament::GatherColumns
+                  ( ALoc, localRowOffset, groups[q], block );
+                  grams[q].Attach( w, w, &gramBuf[offset], w );
+                  Gemm( ADJOINT, NORMAL, F(1), block, block, F(0), grams[q] );
+                  offset += w*w;
+              }
+              mpi::AllReduce( gramBuf.data(), bufSize, mpi::SUM, colComm );
+          };
+        vector<Int> localCandidates;
+        for( Int jLoc=A.LocalColOffset(k); jLoc<A.LocalWidth(); ++jLoc )
+            localCandidates.push_back( jLoc );
+        const auto localWinners =
+          tournament::Play<F>( localCandidates, nb, formGrams );
+
+        // The final round gathers the local rows of the winners of every
+        // process column so that a single Gram matrix may be formed
+        const Int numLocalWinners = localWinners.size();
+        winnerBuf.assign( nb+1, -1 );
+        winnerBuf[0] = numLocalWinners;
+        for( Int t=0; t<numLocalWinners; ++t )
+            winnerBuf[t+1] = A.GlobalCol(localWinners[t]);
+        allWinners.resize( (nb+1)*rowSize );
+        mpi::AllGather( winnerBuf.data(), nb+1, allWinners.data(), nb+1,
+                        rowComm );
+        vector<Int> finalists;
+        for( int q=0; q<rowSize; ++q )
+            for( Int t=0; t<allWinners[q*(nb+1)]; ++t )
+                finalists.push_back( allWinners[q*(nb+1)+t+1] );
+        const Int numFinalists = finalists.size();
+        const Int localHeightB = A.LocalHeight() - localRowOffset;
+        Zeros( CLoc, localHeightB, numFinalists );
+        for( Int t=0; t<numFinalists; ++t )
+            if( A.IsLocalCol(finalists[t]) )
+                MemCopy
+                ( CLoc.Buffer(0,t),
+                  ALoc.LockedBuffer(localRowOffset,A.LocalCol(finalists[t])),
+                  localHeightB );
+        El::AllReduce( CLoc, rowComm );
+        Zeros( GFinal, numFinalists, numFinalists );
+        Gemm( ADJOINT, NORMAL, F(1), CLoc, CLoc, F(0), GFinal );
+        El::AllReduce( GFinal, colComm );
+        vector<Int> winners( nb );
+        {
+            const auto chosen = tournament::SelectFromGram( GFinal, nb );
+            for( Int j=0; j<nb; ++j )
+                winners[j] = finalists[chosen[j]];
+        }
+        // Guard against the process columns reaching different decisions
+        mpi::Broadcast( winners.data(), nb, 0, rowComm );
+
+        // Move all of the winners at once
+        const auto dests = tournament::SwapDestinations( k, winners );
+        PPanel.MakeIdentity( n-k );
+        PPanel.ReserveSwaps( nb );
+        for( Int j=0; j<nb; ++j )
+        {
+            Omega.Swap( k+j, dests[j] );
+            PPanel.Swap( j, dests[j]-k );
+        }
+        auto AR = A( ALL, IR(k,n) );
+        PPanel.PermuteCols( AR );
+
+        const Range<Int> ind1( k, k+nb ), indB( k, END ), ind2( k+nb, END );
+        auto AB1 = A( indB, ind1 );
+        auto AB2 = A( indB, ind2 );
+        auto householderScalars1 = householderScalars( ind1, ALL );
+        auto sig1 = signature( ind1, ALL );
+        PanelHouseholder( AB1, householderScalars1, sig1 );
+        ApplyQ( LEFT, ADJOINT, AB1, householderScalars1, sig1, AB2 );
+
+        // Since reflectors k+j, k+j+1, ... do not modify the first k+j rows,
+        // truncating within the panel leaves a consistent factorization
+        if( ctrl.adaptive )
+        {
+            GetDiagonal( A(ind1,ind1), d_STAR_STAR );
+            Int j=0;
+            for( ; j<nb; ++j )
+                if( Abs(d_STAR_STAR.GetLocal(j,0)) <= ctrl.tol*maxOrigNorm )
+                    break;
+            if( j < nb )
+            {
+                k += j;
+                break;
+            }
+        }
+        k += nb;
+    }
+    householderScalars.Resize( k, 1 );
+    signature.Resize( k, 1 );
+}
+
+} // namespace qr
+} // namespace El
+
+#endif // ifndef EL_QR_TOURNAMENT_HPP
@@ -0,0 +1,137 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+namespace El {
+
+namespace range_finder {
+
+template<typename Field>
+void Orthonormalize( Matrix<Field>& Y )
+{
+    EL_DEBUG_CSE
+    qr::ExplicitUnitary( Y );
+}
+
+// The sketches are tall and skinny, so a TSQR is preferred whenever its
+// requirements on the number of processes and the height are met
+template<typename Field>
+void Orthonormalize( DistMatrix<Field,VC,STAR>& Y )
+{
+    EL_DEBUG_CSE
+    const Int m = Y.Height();
+    const Int n = Y.Width();
+    const Int p = Y.Grid().Size();
+    if( p > 1 && PowerOfTwo(p) && m >= p*n )
+    {
+        DistMatrix<Field,STAR,STAR> R( Y.Grid() );
+        qr::ExplicitTS( Y, R );
+    }
+    else
+        qr::ExplicitUnitary( Y );
+}
+
+} // namespace range_finder
+
+template<typename Field>
+void RandomizedRangeFinder
+( const Matrix<Field>& A,
+        Int rank,
+        Matrix<Field>& Q,
+  const RangeFinderCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    const Int m = A.Height();
+    const Int n = A.Width();
+    if( rank < 0 || ctrl.oversample < 0 || ctrl.numPowerIts < 0 )
+        LogicError
+        ("Invalid range finder parameters: rank=",rank,", oversample=",
+         ctrl.oversample,", numPowerIts=",ctrl.numPowerIts);
+    const Int sketchSize = Min( rank+ctrl.oversample, Min(m,n) );
+
+    // Y := A Omega, with Omega Gaussian
+    Matrix<Field> Omega;
+    Gaussian( Omega, n, sketchSize );
+    Gemm( NORMAL, NORMAL, Field(1), A, Omega, Q );
+    range_finder::Orthonormalize( Q );
+
+    // Subspace iteration with A A^H, orthonormalizing after each product
+    Matrix<Field> Z;
+    for( Int it=0; it<ctrl.numPowerIts; ++it )
+    {
+        Gemm( ADJOINT, NORMAL, Field(1), A, Q, Z );
+        range_finder::Orthonormalize( Z );
+        Gemm( NORMAL, NORMAL, Field(1), A, Z, Q );
+        range_finder::Orthonormalize( Q );
+    }
+}
+
+template<typename Field>
+void RandomizedRangeFinder
+( const AbstractDistMatrix<Field>& APre,
+        Int rank,
+        AbstractDistMatrix<Field>& Q,
+  const RangeFinderCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    DistMatrixReadProxy<Field,Field,MC,MR> AProx( APre );
+    auto& A = AProx.GetLocked();
+    const Grid& g = A.Grid();
+    const Int m = A.Height();
+    const Int n = A.Width();
+    if( rank < 0 || ctrl.oversample < 0 || ctrl.numPowerIts < 0 )
+        LogicError
+        ("Invalid range finder parameters: rank=",rank,", oversample=",
+         ctrl.oversample,", numPowerIts=",ctrl.numPowerIts);
+    const Int sketchSize = Min( rank+ctrl.oversample, Min(m,n) );
+
+    // Y := A Omega, with Omega Gaussian
+    DistMatrix<Field> Omega(g), Y(g);
+    Gaussian( Omega, n, sketchSize );
+    Gemm( NORMAL, NORMAL, Field(1), A, Omega, Y );
+    DistMatrix<Field,VC,STAR> Y_VC_STAR( Y );
+    range_finder::Orthonormalize( Y_VC_STAR );
+
+    // Subspace iteration with A A^H, orthonormalizing after each product
+    DistMatrix<Field> Z(g);
+    DistMatrix<Field,VC,STAR> Z_VC_STAR(g);
+    for( Int it=0; it<ctrl.numPowerIts; ++it )
+    {
+        Y = Y_VC_STAR;
+        Gemm( ADJOINT, NORMAL, Field(1), A, Y, Z );
+        Z_VC_STAR = Z;
+        range_finder::Orthonormalize( Z_VC_STAR );
+        Z = Z_VC_STAR;
+        Gemm( NORMAL, NORMAL, Field(1), A, Z, Y );
+        Y_VC_STAR = Y;
+        range_finder::Orthonormalize( Y_VC_STAR );
+    }
+    Copy( Y_VC_STAR, Q );
+}
+
+#define PROTO(Field) \
+  template void RandomizedRangeFinder \
+  ( const Matrix<Field>& A, \
+          Int rank, \
+          Matrix<Field>& Q, \
+    const RangeFinderCtrl& ctrl ); \
+  template void RandomizedRangeFinder \
+  ( const AbstractDistMatrix<Field>& A, \
+          Int rank, \
+          AbstractDistMatrix<Field>& Q, \
+    const RangeFinderCtrl& ctrl );
+
+#define EL_NO_INT_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
@@ -837,6 +837,210 @@ Int SolveAfter
     }
 }
 
+// Mixed-precision solves
+// ======================
+namespace {
+
+// The diagonal scaling, 'd', is optional
+template<typename Field>
+Int DemotedRegularizedSolveAfter
+( const SparseMatrix<Field>& A,
+  const Matrix<Base<Field>>& reg,
+  const Matrix<Base<Field>>* d,
+  const SparseLDLFactorization<Demote<Field>>& sparseLDLFact,
+        Matrix<Field>& B,
+        Base<Field> relTolRefine,
+        Int maxRefineIts,
+        bool progress )
+{
+    EL_DEBUG_CSE
+    auto applyA =
+      [&]( const Matrix<Field>& X, Matrix<Field>& Y )
+      {
+        Y = X;
+        DiagonalScale( LEFT, NORMAL, reg, Y );
+        Multiply( NORMAL, Field(1), A, X, Field(1), Y );
+      };
+    Matrix<Demote<Field>> YDemoted;
+    auto applyAInv =
+      [&]( Matrix<Field>& Y )
+      {
+        if( d != nullptr )
+            DiagonalSolve( LEFT, NORMAL, *d, Y );
+        Copy( Y, YDemoted );
+        sparseLDLFact.Solve( YDemoted );
+        Copy( YDemoted, Y );
+        if( d != nullptr )
+            DiagonalSolve( LEFT, NORMAL, *d, Y );
+      };
+    return RefinedSolve
+      ( applyA, applyAInv, B, relTolRefine, maxRefineIts, progress );
+}
+
+template<typename Field>
+Int DemotedRegularizedSolveAfter
+( const DistSparseMatrix<Field>& A,
+  const DistMultiVec<Base<Field>>& reg,
+  const DistMultiVec<Base<Field>>* d,
+  const DistSparseLDLFactorization<Demote<Field>>& sparseLDLFact,
+        DistMultiVec<Field>& B,
+        Base<Field> relTolRefine,
+        Int maxRefineIts,
+        bool progress )
+{
+    EL_DEBUG_CSE
+    auto applyA =
+      [&]( const DistMultiVec<Field>& X, DistMultiVec<Field>& Y )
+      {
+        Y = X;
+        DiagonalScale( LEFT, NORMAL, reg, Y );
+        Multiply( NORMAL, Field(1), A, X, Field(1), Y );
+      };
+    DistMultiVec<Demote<Field>> YDemoted(B.Grid());
+    auto applyAInv =
+      [&]( DistMultiVec<Field>& Y )
+      {
+        if( d != nullptr )
+            DiagonalSolve( LEFT, NORMAL, *d, Y );
+        Copy( Y, YDemoted );
+        sparseLDLFact.Solve( YDemoted );
+        Copy( YDemoted, Y );
+        if( d != nullptr )
+            DiagonalSolve( LEFT, NORMAL, *d, Y );
+      };
+    return RefinedSolve
+      ( applyA, applyAInv, B, relTolRefine, maxRefineIts, progress );
+}
+
+template<typename Field>
+Int DemotedGMRESSolveAfter
+( const SparseMatrix<Field>& A,
+  const Matrix<Base<Field>>& reg,
+  const Matrix<Base<Field>>* d,
+  const SparseLDLFactorization<Demote<Field>>& sparseLDLFact,
+        Matrix<Field>& B,
+  const RegSolveCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    auto applyA =
+      [&]( Field alpha, const Matrix<Field>& X, Field beta, Matrix<Field>& Y )
+      {
+          Multiply( NORMAL, alpha, A, X, beta, Y );
+      };
+    auto precond =
+      [&]( Matrix<Field>& W )
+      {
+        DemotedRegularizedSolveAfter
+        ( A, reg, d, sparseLDLFact, W, ctrl.relTolRefine, ctrl.maxRefineIts,
+          ctrl.progress );
+      };
+    switch( ctrl.alg )
+    {
+    case REG_SOLVE_FGMRES:
+        return FGMRES
+        ( applyA, precond, B, ctrl.relTol, ctrl.restart, ctrl.maxIts,
+          ctrl.progress );
+    case REG_SOLVE_LGMRES:
+        return LGMRES
+        ( applyA, precond, B, ctrl.relTol, ctrl.restart, ctrl.maxIts,
+          ctrl.progress );
+    default:
+        LogicError("Invalid refinement algorithm");
+        return -1;
+    }
+}
+
+template<typename Field>
+Int DemotedGMRESSolveAfter
+( const DistSparseMatrix<Field>& A,
+  const DistMultiVec<Base<Field>>& reg,
+  const DistMultiVec<Base<Field>>* d,
+  const DistSparseLDLFactorization<Demote<Field>>& sparseLDLFact,
+        DistMultiVec<Field>& B,
+  const RegSolveCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    auto applyA =
+      [&]( Field alpha, const DistMultiVec<Field>& X,
+           Field beta, DistMultiVec<Field>& Y )
+      {
+          Multiply( NORMAL, alpha, A, X, beta, Y );
+      };
+    auto precond =
+      [&]( DistMultiVec<Field>& W )
+      {
+        DemotedRegularizedSolveAfter
+        ( A, reg, d, sparseLDLFact, W, ctrl.relTolRefine, ctrl.maxRefineIts,
+          ctrl.progress );
+      };
+    switch( ctrl.alg )
+    {
+    case REG_SOLVE_FGMRES:
+        return FGMRES
+        ( applyA, precond, B, ctrl.relTol, ctrl.restart, ctrl.maxIts,
+          ctrl.progress );
+    case REG_SOLVE_LGMRES:
+        return LGMRES
+        ( applyA, precond, B, ctrl.relTol, ctrl.restart, ctrl.maxIts,
+          ctrl.progress );
+    default:
+        LogicError("Invalid refinement algorithm");
+        return -1;
+    }
+}
+
+} // anonymous namespace
+
+template<typename Field>
+Int DemotedSolveAfter
+( const SparseMatrix<Field>& A,
+  const Matrix<Base<Field>>& reg,
+  const SparseLDLFactorization<Demote<Field>>& sparseLDLFact,
+        Matrix<Field>& B,
+  const RegSolveCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    return DemotedGMRESSolveAfter( A, reg, nullptr, sparseLDLFact, B, ctrl );
+}
+
+template<typename Field>
+Int DemotedSolveAfter
+( const DistSparseMatrix<Field>& A,
+  const DistMultiVec<Base<Field>>& reg,
+  const DistSparseLDLFactorization<Demote<Field>>& sparseLDLFact,
+        DistMultiVec<Field>& B,
+  const RegSolveCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    return DemotedGMRESSolveAfter( A, reg, nullptr, sparseLDLFact, B, ctrl );
+}
+
+template<typename Field>
+Int DemotedSolveAfter
+( const SparseMatrix<Field>& A,
+  const Matrix<Base<Field>>& reg,
+  const Matrix<Base<Field>>& d,
+  const SparseLDLFactorization<Demote<Field>>& sparseLDLFact,
+        Matrix<Field>& B,
+  const RegSolveCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    return DemotedGMRESSolveAfter( A, reg, &d, sparseLDLFact, B, ctrl );
+}
+
+template<typename Field>
+Int DemotedSolveAfter
+( const DistSparseMatrix<Field>& A,
+  const DistMultiVec<Base<Field>>& reg,
+  const DistMultiVec<Base<Field>>& d,
+  const DistSparseLDLFactorization<Demote<Field>>& sparseLDLFact,
+        DistMultiVec<Field>& B,
+  const RegSolveCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    return DemotedGMRESSolveAfter( A, reg, &d, sparseLDLFact, B, ctrl );
+}
+
 #define PROTO(Field) \
   template Int RegularizedSolveAfter \
   ( const SparseMatrix<Field>& A, \
@@ -889,6 +1093,32 @@ Int SolveAfter
     const DistMultiVec<Base<Field>>& d, \
     const DistSparseLDLFactorization<Field>& sparseLDLFact, \
           DistMultiVec<Field>& B, \
+    const RegSolveCtrl<Base<Field>>& ctrl ); \
+  template Int DemotedSolveAfter \
+  ( const SparseMatrix<Field>& A, \
+    const Matrix<Base<Field>>& reg, \
+    const SparseLDLFactorization<Demote<Field>>& sparseLDLFact, \
+          Matrix<Field>& B, \
+    const RegSolveCtrl<Base<Field>>& ctrl ); \
+  template Int DemotedSolveAfter \
+  ( const SparseMatrix<Field>& A, \
+    const Matrix<Base<Field>>& reg, \
+    const Matrix<Base<Field>>& d, \
+    const SparseLDLFactorization<Demote<Field>>& sparseLDLFact, \
+          Matrix<Field>& B, \
+    const RegSolveCtrl<Base<Field>>& ctrl ); \
+  template Int DemotedSolveAfter \
+  ( const DistSparseMatrix<Field>& A, \
+    const DistMultiVec<Base<Field>>& reg, \
+    const DistSparseLDLFactorization<Demote<Field>>& sparseLDLFact, \
+          DistMultiVec<Field>& B, \
+    const RegSolveCtrl<Base<Field>>& ctrl ); \
+  template Int DemotedSolveAfter \
+  ( const DistSparseMatrix<Field>& A, \
+    const DistMultiVec<Base<Field>>& reg, \
+    const DistMultiVec<Base<Field>>& d, \
+    const DistSparseLDLFactorization<Demote<Field>>& sparseLDLFact, \
+          DistMultiVec<Field>& B, \
     const RegSolveCtrl<Base<Field>>& ctrl );
 
 #define EL_NO_INT_PROTO
@@ -0,0 +1,288 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+// See Liberty et al., "Randomized algorithms for the low-rank approximation of
+// matrices", and Voronin and Martinsson, "Efficient algorithms for CUR and
+// interpolative matrix decompositions".
+
+namespace El {
+
+namespace sketched_id {
+
+template<typename Field>
+void CheckCtrl( const QRCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    if( !ctrl.boundRank )
+        LogicError("The sketch size requires a bound on the rank");
+    if( ctrl.maxRank < 0 )
+        LogicError("Invalid maximum rank of ",ctrl.maxRank);
+}
+
+// Overwrites the sketch Y with the R factor of a column-pivoted QR
+// factorization, Y P^T = Q [R_L, R_R], and forms Z := inv(R_L) R_R so that
+// Y P^T ~= Y_L [I, Z]. As in the BusingerGolub ID, the factorization is
+// adaptive so that R_L is safely invertible.
+template<typename Field>
+void InterpolateSketch
+( Matrix<Field>& Y,
+  Permutation& P,
+  Matrix<Field>& Z,
+  const QRCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Int n = Y.Width();
+    const Real eps = limits::Epsilon<Real>();
+    auto ctrlCopy = ctrl;
+    ctrlCopy.adaptive = true;
+    ctrlCopy.tol = Max(ctrl.tol,eps*ctrl.maxRank);
+
+    Matrix<Field> householderScalars;
+    Matrix<Base<Field>> signature;
+    QR( Y, householderScalars, signature, P, ctrlCopy );
+    const Int numSteps = householderScalars.Height();
+
+    auto RL = Y( IR(0,numSteps), IR(0,numSteps) );
+    auto RR = Y( IR(0,numSteps), IR(numSteps,n) );
+    Z = RR;
+    Trsm( LEFT, UPPER, NORMAL, NON_UNIT, Field(1), RL, Z );
+}
+
+// If Y = Q^H A and Y^H = V R, then A V ~= Q Y V = Q R^H, so the rows of A may
+// be pivoted using the columns of the small sketch X := R Q^H.
+template<typename Field>
+void RowSketch
+( const Matrix<Field>& Q, const Matrix<Field>& Y, Matrix<Field>& X )
+{
+    EL_DEBUG_CSE
+    Matrix<Field> R;
+    Adjoint( Y, R );
+    qr::ExplicitTriang( R );
+    Gemm( NORMAL, ADJOINT, Field(1), R, Q, X );
+}
+
+// Rebuilds a redundantly computed sequential permutation on each process
+void Replicate( const Permutation& PLoc, DistPermutation& P )
+{
+    EL_DEBUG_CSE
+    Matrix<Int> p;
+    PLoc.ExplicitVector( p );
+    const Int n = p.Height();
+    P.MakeIdentity( n );
+    for( Int j=0; j<n; ++j )
+        P.SetImage( p(j), j );
+}
+
+// Returns the leading 'numPivots' entries of the permutation vector of P
+vector<Int> LeadingPivots( const Permutation& P, Int numPivots )
+{
+    EL_DEBUG_CSE
+    Matrix<Int> p;
+    P.ExplicitVector( p );
+    vector<Int> pivots( numPivots );
+    for( Int j=0; j<numPivots; ++j )
+        pivots[j] = p(j);
+    return pivots;
+}
+
+} // namespace sketched_id
+
+template<typename Field>
+void SketchedID
+( const Matrix<Field>& A,
+        Permutation& P,
+        Matrix<Field>& Z,
+  const QRCtrl<Base<Field>>& ctrl,
+  const RangeFinderCtrl& sketchCtrl )
+{
+    EL_DEBUG_CSE
+    sketched_id::CheckCtrl<Field>( ctrl );
+    Matrix<Field> Q, Y;
+    RandomizedRangeFinder( A, ctrl.maxRank, Q, sketchCtrl );
+    Gemm( ADJOINT, NORMAL, Field(1), Q, A, Y );
+    sketched_id::InterpolateSketch( Y, P, Z, ctrl );
+}
+
+template<typename Field>
+void SketchedID
+( const AbstractDistMatrix<Field>& APre,
+        DistPermutation& P,
+        AbstractDistMatrix<Field>& Z,
+  const QRCtrl<Base<Field>>& ctrl,
+  const RangeFinderCtrl& sketchCtrl )
+{
+    EL_DEBUG_CSE
+    sketched_id::CheckCtrl<Field>( ctrl );
+    DistMatrixReadProxy<Field,Field,MC,MR> AProx( APre );
+    auto& A = AProx.GetLocked();
+    const Grid& g = A.Grid();
+
+    DistMatrix<Field> Q(g), Y(g);
+    RandomizedRangeFinder( A, ctrl.maxRank, Q, sketchCtrl );
+    Gemm( ADJOINT, NORMAL, Field(1), Q, A, Y );
+
+    // Each process redundantly pivots its own copy of the sketch
+    DistMatrix<Field,STAR,STAR> Y_STAR_STAR( Y );
+    Permutation PLoc;
+    Matrix<Field> ZLoc;
+    sketched_id::InterpolateSketch( Y_STAR_STAR.Matrix(), PLoc, ZLoc, ctrl );
+
+    P.SetGrid( g );
+    sketched_id::Replicate( PLoc, P );
+    DistMatrix<Field,STAR,STAR> Z_STAR_STAR(g);
+    Z_STAR_STAR.Resize( ZLoc.Height(), ZLoc.Width() );
+    Z_STAR_STAR.Matrix() = ZLoc;
+    Copy( Z_STAR_STAR, Z );
+}
+
+template<typename Field>
+void SketchedSkeleton
+( const Matrix<Field>& A,
+        Permutation& PR,
+        Permutation& PC,
+        Matrix<Field>& Z,
+  const QRCtrl<Base<Field>>& ctrl,
+  const RangeFinderCtrl& sketchCtrl )
+{
+    EL_DEBUG_CSE
+    sketched_id::CheckCtrl<Field>( ctrl );
+    const Int m = A.Height();
+    const Int n = A.Width();
+    Matrix<Field> Q, Y, X;
+    RandomizedRangeFinder( A, ctrl.maxRank, Q, sketchCtrl );
+    Gemm( ADJOINT, NORMAL, Field(1), Q, A, Y );
+    sketched_id::RowSketch( Q, Y, X );
+
+    // Find the column permutation
+    Matrix<Field> householderScalars;
+    Matrix<Base<Field>> signature;
+    QR( Y, householderScalars, signature, PC, ctrl );
+    const Int numSteps = householderScalars.Height();
+
+    // Find the row permutation (force the same number of steps)
+    auto secondCtrl = ctrl;
+    secondCtrl.adaptive = false;
+    secondCtrl.maxRank = numSteps;
+    QR( X, householderScalars, signature, PR, secondCtrl );
+
+    Matrix<Field> AC, AR;
+    GetSubmatrix
+    ( A, IR(0,m), sketched_id::LeadingPivots(PC,numSteps), AC );
+    GetSubmatrix
+    ( A, sketched_id::LeadingPivots(PR,numSteps), IR(0,n), AR );
+
+    // Form Z := pinv(AC) A pinv(AR) = inv(RC) QC^H A QR inv(RR)^H, where
+    // AC = QC RC and AR^H = QR RR
+    Matrix<Field> RC, ARAdj, RR, QCAdjA;
+    qr::Explicit( AC, RC );
+    Adjoint( AR, ARAdj );
+    qr::Explicit( ARAdj, RR );
+    Gemm( ADJOINT, NORMAL, Field(1), AC, A, QCAdjA );
+    Gemm( NORMAL, NORMAL, Field(1), QCAdjA, ARAdj, Z );
+    Trsm( LEFT, UPPER, NORMAL, NON_UNIT, Field(1), RC, Z );
+    Trsm( RIGHT, UPPER, ADJOINT, NON_UNIT, Field(1), RR, Z );
+}
+
+template<typename Field>
+void SketchedSkeleton
+( const AbstractDistMatrix<Field>& APre,
+        DistPermutation& PR,
+        DistPermutation& PC,
+        AbstractDistMatrix<Field>& Z,
+  const QRCtrl<Base<Field>>& ctrl,
+  const RangeFinderCtrl& sketchCtrl )
+{
+    EL_DEBUG_CSE
+    sketched_id::CheckCtrl<Field>( ctrl );
+    DistMatrixReadProxy<Field,Field,MC,MR> AProx( APre );
+    auto& A = AProx.GetLocked();
+    const Grid& g = A.Grid();
+    const Int m = A.Height();
+    const Int n = A.Width();
+
+    DistMatrix<Field> Q(g), Y(g);
+    RandomizedRangeFinder( A, ctrl.maxRank, Q, sketchCtrl );
+    Gemm( ADJOINT, NORMAL, Field(1), Q, A, Y );
+
+    // Each process redundantly pivots its own copies of the sketches
+    DistMatrix<Field,STAR,STAR> Q_STAR_STAR( Q ), Y_STAR_STAR( Y );
+    Matrix<Field> X;
+    sketched_id::RowSketch( Q_STAR_STAR.Matrix(), Y_STAR_STAR.Matrix(), X );
+
+    Permutation PRLoc, PCLoc;
+    Matrix<Field> householderScalars;
+    Matrix<Base<Field>> signature;
+    QR( Y_STAR_STAR.Matrix(), householderScalars, signature, PCLoc, ctrl );
+    const Int numSteps = householderScalars.Height();
+    auto secondCtrl = ctrl;
+    secondCtrl.adaptive = false;
+    secondCtrl.maxRank = numSteps;
+    QR( X, householderScalars, signature, PRLoc, secondCtrl );
+    PR.SetGrid( g );
+    PC.SetGrid( g );
+    sketched_id::Replicate( PRLoc, PR );
+    sketched_id::Replicate( PCLoc, PC );
+
+    DistMatrix<Field> AC(g), AR(g);
+    GetSubmatrix
+    ( A, IR(0,m), sketched_id::LeadingPivots(PCLoc,numSteps), AC );
+    GetSubmatrix
+    ( A, sketched_id::LeadingPivots(PRLoc,numSteps), IR(0,n), AR );
+
+    // Form Z := pinv(AC) A pinv(AR) = inv(RC) QC^H A QR inv(RR)^H, where
+    // AC = QC RC and AR^H = QR RR
+    DistMatrix<Field> RC(g), ARAdj(g), RR(g), QCAdjA(g), ZProx(g);
+    qr::Explicit( AC, RC );
+    Adjoint( AR, ARAdj );
+    qr::Explicit( ARAdj, RR );
+    Gemm( ADJOINT, NORMAL, Field(1), AC, A, QCAdjA );
+    Gemm( NORMAL, NORMAL, Field(1), QCAdjA, ARAdj, ZProx );
+    Trsm( LEFT, UPPER, NORMAL, NON_UNIT, Field(1), RC, ZProx );
+    Trsm( RIGHT, UPPER, ADJOINT, NON_UNIT, Field(1), RR, ZProx );
+    Copy( ZProx, Z );
+}
+
+#define PROTO(Field) \
+  template void SketchedID \
+  ( const Matrix<Field>& A, \
+          Permutation& P, \
+          Matrix<Field>& Z, \
+    const QRCtrl<Base<Field>>& ctrl, \
+    const RangeFinderCtrl& sketchCtrl ); \
+  template void SketchedID \
+  ( const AbstractDistMatrix<Field>& A, \
+          DistPermutation& P, \
+          AbstractDistMatrix<Field>& Z, \
+    const QRCtrl<Base<Field>>& ctrl, \
+    const RangeFinderCtrl& sketchCtrl ); \
+  template void SketchedSkeleton \
+  ( const Matrix<Field>& A, \
+          Permutation& PR, \
+          Permutation& PC, \
+          Matrix<Field>& Z, \
+    const QRCtrl<Base<Field>>& ctrl, \
+    const RangeFinderCtrl& sketchCtrl ); \
+  template void SketchedSkeleton \
+  ( const AbstractDistMatrix<Field>& A, \
+          DistPermutation& PR, \
+          DistPermutation& PC, \
+          AbstractDistMatrix<Field>& Z, \
+    const QRCtrl<Base<Field>>& ctrl, \
+    const RangeFinderCtrl& sketchCtrl );
+
+#define EL_NO_INT_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
@@ -0,0 +1,323 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+namespace El {
+
+namespace herm_func_vecs {
+
+// Gathers the local rows of the listed columns of V into a contiguous block
+template<typename Field>
+void GatherColumns
+( const Matrix<Field>& V, const vector<Int>& cols, Matrix<Field>& block )
+{
+    EL_DEBUG_CSE
+    const Int localHeight = V.Height();
+    block.Resize( localHeight, cols.size() );
+    for( size_t a=0; a<cols.size(); ++a )
+        MemCopy( block.Buffer(0,a), V.LockedBuffer(0,cols[a]), localHeight );
+}
+
+// Returns y = beta0 f(T) e_0 for the symmetric tridiagonal T with diagonal
+// 'alpha[0:k]' and sub-diagonal 'beta[1:k]'
+template<typename Real>
+void Coefficients
+( Real beta0,
+  const vector<Real>& alpha,
+  const vector<Real>& beta,
+        Int k,
+  const function<Real(const Real&)>& func,
+        Matrix<Real>& y )
+{
+    EL_DEBUG_CSE
+    Matrix<Real> d( k, 1 ), e( k-1, 1 ), w, Z;
+    for( Int j=0; j<k; ++j )
+        d(j) = alpha[j];
+    for( Int j=0; j<k-1; ++j )
+        e(j) = beta[j+1];
+    HermitianTridiagEig( d, e, w, Z );
+    Zeros( y, k, 1 );
+    for( Int l=0; l<k; ++l )
+    {
+        const Real scale = beta0*func(w(l))*Z(0,l);
+        for( Int j=0; j<k; ++j )
+            y(j) += scale*Z(j,l);
+    }
+}
+
+// Overwrites the local rows, XLoc, of f(A) B given the local rows of B, where
+// 'applyA' overwrites the local rows of a block with the result of applying A
+template<typename Field,class ApplyType>
+void Core
+(       Int n,
+  const ApplyType& applyA,
+        mpi::Comm comm,
+  const function<Base<Field>(const Base<Field>&)>& func,
+  const Matrix<Field>& BLoc,
+        Matrix<Field>& XLoc,
+  const HermitianFunctionTimesVectorsCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Int localHeight = BLoc.Height();
+    const Int numRHS = BLoc.Width();
+    const Real eps = limits::Epsilon<Real>();
+    const Real tol =
+      ( ctrl.tol > Real(0) ? ctrl.tol : Pow(eps,Real(3)/Real(4)) );
+    const Int maxIts = Max( Min(ctrl.maxIts,n), Int(1) );
+    const Int checkInterval = Max( ctrl.checkInterval, Int(1) );
+    Zeros( XLoc, localHeight, numRHS );
+
+    // The starting vectors are the normalized columns of B
+    vector<Real> beta0( numRHS );
+    for( Int c=0; c<numRHS; ++c )
+    {
+        const Real localNorm =
+          blas::Nrm2( localHeight, BLoc.LockedBuffer(0,c), 1 );
+        beta0[c] = localNorm*localNorm;
+    }
+    mpi::AllReduce( beta0.data(), numRHS, mpi::SUM, comm );
+    for( Int c=0; c<numRHS; ++c )
+        beta0[c] = Sqrt(beta0[c]);
+
+    // The first pass runs the recurrences, retaining only the tridiagonal
+    // projections, until the coefficients of each column have stagnated
+    vector<vector<Real>> alpha(numRHS), beta(numRHS);
+    vector<Matrix<Real>> y(numRHS);
+    vector<Int> numSteps(numRHS,0), active;
+    for( Int c=0; c<numRHS; ++c )
+        if( beta0[c] > Real(0) )
+            active.push_back( c );
+
+    Matrix<Field> VPrev, VCur, W;
+    Zeros( VPrev, localHeight, numRHS );
+    VCur = BLoc;
+    for( const Int c : active )
+    {
+        beta[c].push_back( Real(0) );
+        auto vCur = VCur( ALL, IR(c) );
+        Scale( Real(1)/beta0[c], vCur );
+    }
+    Int numIts = 0;
+    vector<Real> dots, norms;
+    Matrix<Real> yNew;
+    while( !active.empty() )
+    {
+        const Int numActive = active.size();
+        GatherColumns( VCur, active, W );
+        applyA( W );
+
+        // alpha_j = v_j^H A v_j
+        dots.resize( numActive );
+        for( Int a=0; a<numActive; ++a )
+            dots[a] =
+              RealPart(blas::Dotc
+              (localHeight,VCur.LockedBuffer(0,active[a]),1,
+               W.LockedBuffer(0,a),1));
+        mpi::AllReduce( dots.data(), numActive, mpi::SUM, comm );
+
+        // w := A v_j - alpha_j v_j - beta_j v_{j-1}
+        norms.resize( numActive );
+        for( Int a=0; a<numActive; ++a )
+        {
+            const Int c = active[a];
+            alpha[c].push_back( dots[a] );
+            Field* w = W.Buffer(0,a);
+            const Field* vCur = VCur.LockedBuffer(0,c);
+            const Field* vPrev = VPrev.LockedBuffer(0,c);
+            const Real alphaj = dots[a], betaj = beta[c].back();
+            for( Int i=0; i<localHeight; ++i )
+                w[i] -= alphaj*vCur[i] + betaj*vPrev[i];
+            const Real localNorm = blas::Nrm2( localHeight, w, 1 );
+            norms[a] = localNorm*localNorm;
+        }
+        mpi::AllReduce( norms.data(), numActive, mpi::SUM, comm );
+        ++numIts;
+
+        vector<Int> stillActive;
+        for( Int a=0; a<numActive; ++a )
+        {
+            const Int c = active[a];
+            const Int k = ++numSteps[c];
+            const Real betaNext = Sqrt(norms[a]);
+
+            // The Krylov subspace is invariant once the recurrence breaks
+            // down, in which case f(T_k) is exact
+            const Real normEst = Abs(alpha[c].back()) + beta[c].back();
+            const bool breakdown = betaNext <= eps*normEst || k == n;
+            if( breakdown || k % checkInterval == 0 || numIts == maxIts )
+            {
+                Coefficients
+                ( beta0[c], alpha[c], beta[c], k, func, yNew );
+                Real diffSquared = 0;
+                for( Int j=0; j<k; ++j )
+                {
+                    const Real yOld = ( j < y[c].Height() ? y[c](j) : 0 );
+                    diffSquared += (yNew(j)-yOld)*(yNew(j)-yOld);
+                }
+                const bool converged =
+                  Sqrt(diffSquared) <= tol*FrobeniusNorm(yNew);
+                y[c] = yNew;
+                if( breakdown || converged || numIts == maxIts )
+                    continue;
+            }
+
+            beta[c].push_back( betaNext );
+            Field* vPrev = VPrev.Buffer(0,c);
+            Field* vCur = VCur.Buffer(0,c);
+            const Field* w = W.LockedBuffer(0,a);
+            for( Int i=0; i<localHeight; ++i )
+            {
+                vPrev[i] = vCur[i];
+                vCur[i] = w[i]/betaNext;
+            }
+            stillActive.push_back( c );
+        }
+        if( ctrl.progress )
+            OutputFromRoot
+            (comm,"  step ",numIts,": ",stillActive.size()," of ",numRHS,
+             " columns active");
+        active.swap( stillActive );
+    }
+
+    // The second pass regenerates the Lanczos vectors from the stored
+    // recurrences, which no longer require any reductions, and accumulates
+    // X(:,c) = V_k y
+    for( Int c=0; c<numRHS; ++c )
+        if( numSteps[c] > 0 )
+            active.push_back( c );
+    Zeros( VPrev, localHeight, numRHS );
+    VCur = BLoc;
+    for( const Int c : active )
+    {
+        auto vCur = VCur( ALL, IR(c) );
+        auto x = XLoc( ALL, IR(c) );
+        Scale( Real(1)/beta0[c], vCur );
+        Axpy( Field(y[c](0)), vCur, x );
+    }
+    for( Int j=0; !active.empty(); ++j )
+    {
+        vector<Int> stillActive;
+        for( const Int c : active )
+            if( numSteps[c] > j+1 )
+                stillActive.push_back( c );
+        active.swap( stillActive );
+        if( active.empty() )
+            break;
+
+        const Int numActive = active.size();
+        GatherColumns( VCur, active, W );
+        applyA( W );
+        for( Int a=0; a<numActive; ++a )
+        {
+            const Int c = active[a];
+            const Real alphaj = alpha[c][j], betaj = beta[c][j],
+                       betaNext = beta[c][j+1];
+            const Field gamma = y[c](j+1);
+            const Field* w = W.LockedBuffer(0,a);
+            Field* vPrev = VPrev.Buffer(0,c);
+            Field* vCur = VCur.Buffer(0,c);
+            Field* x = XLoc.Buffer(0,c);
+            for( Int i=0; i<localHeight; ++i )
+            {
+                const Field vNext =
+                  (w[i] - alphaj*vCur[i] - betaj*vPrev[i])/betaNext;
+                vPrev[i] = vCur[i];
+                vCur[i] = vNext;
+                x[i] += gamma*vNext;
+            }
+        }
+    }
+}
+
+} // namespace herm_func_vecs
+
+template<typename Field>
+void HermitianFunctionTimesVectors
+( const SparseMatrix<Field>& A,
+  function<Base<Field>(const Base<Field>&)> func,
+  const Matrix<Field>& B,
+        Matrix<Field>& X,
+  const HermitianFunctionTimesVectorsCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    const Int n = A.Height();
+    if( n != A.Width() )
+        LogicError("A was not square");
+    if( B.Height() != n )
+        LogicError("B was not conformal with A");
+
+    Matrix<Field> Y;
+    auto applyA =
+      [&]( Matrix<Field>& V )
+      {
+          Zeros( Y, n, V.Width() );
+          Multiply( NORMAL, Field(1), A, V, Field(0), Y );
+          V = Y;
+      };
+    herm_func_vecs::Core( n, applyA, mpi::COMM_SELF, func, B, X, ctrl );
+}
+
+template<typename Field>
+void HermitianFunctionTimesVectors
+( const DistSparseMatrix<Field>& A,
+  function<Base<Field>(const Base<Field>&)> func,
+  const DistMultiVec<Field>& B,
+        DistMultiVec<Field>& X,
+  const HermitianFunctionTimesVectorsCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    const Int n = A.Height();
+    if( n != A.Width() )
+        LogicError("A was not square");
+    if( B.Height() != n )
+        LogicError("B was not conformal with A");
+    const Grid& grid = A.Grid();
+
+    // Each block is applied with a single multi-vector product
+    DistMultiVec<Field> V(grid), Y(grid);
+    auto applyA =
+      [&]( Matrix<Field>& VLoc )
+      {
+          V.Resize( n, VLoc.Width() );
+          V.Matrix() = VLoc;
+          Zeros( Y, n, VLoc.Width() );
+          Multiply( NORMAL, Field(1), A, V, Field(0), Y );
+          VLoc = Y.LockedMatrix();
+      };
+    Matrix<Field> XLoc;
+    herm_func_vecs::Core
+    ( n, applyA, grid.Comm(), func, B.LockedMatrix(), XLoc, ctrl );
+    X.SetGrid( grid );
+    Zeros( X, n, B.Width() );
+    X.Matrix() = XLoc;
+}
+
+#define PROTO(Field) \
+  template void HermitianFunctionTimesVectors \
+  ( const SparseMatrix<Field>& A, \
+    function<Base<Field>(const Base<Field>&)> func, \
+    const Matrix<Field>& B, \
+          Matrix<Field>& X, \
+    const HermitianFunctionTimesVectorsCtrl<Base<Field>>& ctrl ); \
+  template void HermitianFunctionTimesVectors \
+  ( const DistSparseMatrix<Field>& A, \
+    function<Base<Field>(const Base<Field>&)> func, \
+    const DistMultiVec<Field>& B, \
+          DistMultiVec<Field>& X, \
+    const HermitianFunctionTimesVectorsCtrl<Base<Field>>& ctrl );
+
+#define EL_NO_INT_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
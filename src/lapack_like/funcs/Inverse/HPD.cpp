@@ -23,11 +23,16 @@ void HPDInverse( UpperOrLower uplo, Matrix<Field>& A )
         hpd_inv::CholeskyUVar2( A );
 }
 
+// [MC,MR] matrices are inverted in place using only panel-sized workspace,
+// and redundantly-stored [STAR,STAR] matrices are inverted locally rather
+// than being redistributed into an [MC,MR] copy.
 template<typename Field>
 void HPDInverse( UpperOrLower uplo, AbstractDistMatrix<Field>& A )
 {
     EL_DEBUG_CSE
-    if( uplo == LOWER )
+    if( A.ColDist() == STAR && A.RowDist() == STAR && A.Wrap() == ELEMENT )
+        HPDInverse( uplo, A.Matrix() );
+    else if( uplo == LOWER )
         hpd_inv::CholeskyLVar2( A );
     else
         hpd_inv::CholeskyUVar2( A );
@@ -45,12 +45,17 @@ void TriangularInverse
     triang_inv::Var3( uplo, diag, A );
 }
 
+// As in HPDInverse, [MC,MR] matrices are inverted in place with panel-sized
+// workspace and [STAR,STAR] matrices are inverted locally.
 template<typename Field>
 void TriangularInverse
 ( UpperOrLower uplo, UnitOrNonUnit diag, AbstractDistMatrix<Field>& A  )
 {
     EL_DEBUG_CSE
-    triang_inv::Var3( uplo, diag, A );
+    if( A.ColDist() == STAR && A.RowDist() == STAR && A.Wrap() == ELEMENT )
+        triang_inv::Var3( uplo, diag, A.Matrix() );
+    else
+        triang_inv::Var3( uplo, diag, A );
 }
 
 template<typename Field>
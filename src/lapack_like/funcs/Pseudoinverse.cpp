@@ -8,6 +8,9 @@
 */
 #include <El.hpp>
 
+#include "./Pseudoinverse/SVD.hpp"
+#include "./Pseudoinverse/CompleteOrthogonal.hpp"
+
 namespace El {
 
 // Replace A with its pseudoinverse
@@ -17,21 +20,11 @@ void Pseudoinverse( Matrix<Field>& A, Base<Field> tolerance )
 {
     EL_DEBUG_CSE
     typedef Base<Field> Real;
-    const Int m = A.Height();
-    const Int n = A.Width();
-    const Real eps = limits::Epsilon<Real>();
 
     // Get the SVD of A
     Matrix<Real> s;
     Matrix<Field> U, V;
-    SVDCtrl<Real> ctrl;
-    ctrl.overwrite = true;
-    ctrl.bidiagSVDCtrl.approach = COMPACT_SVD;
-    // TODO(poulson): Let the user change these defaults
-    ctrl.bidiagSVDCtrl.tolType = RELATIVE_TO_MAX_SING_VAL_TOL;
-    ctrl.bidiagSVDCtrl.tol =
-      ( tolerance == Real(0) ? Max(m,n)*eps : tolerance );
-    SVD( A, U, s, V, ctrl );
+    pinv::TruncatedSVD( A, tolerance, U, s, V );
 
     // Scale U with the inverted (nonzero) singular values, U := U / Sigma
     DiagonalSolve( RIGHT, NORMAL, s, U );
@@ -40,6 +33,30 @@ void Pseudoinverse( Matrix<Field>& A, Base<Field> tolerance )
     Gemm( NORMAL, ADJOINT, Field(1), V, U, A );
 }
 
+template<typename Field>
+Int Pseudoinverse
+( Matrix<Field>& A, const PseudoinverseCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    if( ctrl.approach == PSEUDOINVERSE_SVD )
+    {
+        typedef Base<Field> Real;
+        Matrix<Real> s;
+        Matrix<Field> U, V;
+        pinv::TruncatedSVD( A, ctrl.tol, U, s, V );
+        DiagonalSolve( RIGHT, NORMAL, s, U );
+        Gemm( NORMAL, ADJOINT, Field(1), V, U, A );
+        return s.Height();
+    }
+    else
+    {
+        pinv::CompleteOrthogonal<Field> cod;
+        pinv::Factor( A, ctrl.tol, cod );
+        pinv::Form( cod, A );
+        return cod.rank;
+    }
+}
+
 template<typename Field>
 void HermitianPseudoinverse
 ( UpperOrLower uplo, Matrix<Field>& A, Base<Field> tolerance )
@@ -80,23 +97,12 @@ void Pseudoinverse( AbstractDistMatrix<Field>& APre, Base<Field> tolerance )
     DistMatrixReadWriteProxy<Field,Field,MC,MR> AProx( APre );
     auto& A = AProx.Get();
 
-    const Int m = A.Height();
-    const Int n = A.Width();
     const Grid& g = A.Grid();
 
-    const Real eps = limits::Epsilon<Real>();
-
     // Get the SVD of A
     DistMatrix<Real,VR,STAR> s(g);
     DistMatrix<Field> U(g), V(g);
-    SVDCtrl<Real> ctrl;
-    ctrl.overwrite = true;
-    ctrl.bidiagSVDCtrl.approach = COMPACT_SVD;
-    // TODO(poulson): Let the user change these defaults
-    ctrl.bidiagSVDCtrl.tolType = RELATIVE_TO_MAX_SING_VAL_TOL;
-    ctrl.bidiagSVDCtrl.tol =
-      ( tolerance == Real(0) ? Max(m,n)*eps : tolerance );
-    SVD( A, U, s, V, ctrl );
+    pinv::TruncatedSVD( A, tolerance, U, s, V );
 
     // Scale U with the inverted (nonzero) singular values, U := U / Sigma
     DiagonalSolve( RIGHT, NORMAL, s, U );
@@ -105,6 +111,34 @@ void Pseudoinverse( AbstractDistMatrix<Field>& APre, Base<Field> tolerance )
     Gemm( NORMAL, ADJOINT, Field(1), V, U, A );
 }
 
+template<typename Field>
+Int Pseudoinverse
+( AbstractDistMatrix<Field>& APre, const PseudoinverseCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    DistMatrixReadWriteProxy<Field,Field,MC,MR> AProx( APre );
+    auto& A = AProx.Get();
+    const Grid& g = A.Grid();
+
+    if( ctrl.approach == PSEUDOINVERSE_SVD )
+    {
+        typedef Base<Field> Real;
+        DistMatrix<Real,VR,STAR> s(g);
+        DistMatrix<Field> U(g), V(g);
+        pinv::TruncatedSVD( A, ctrl.tol, U, s, V );
+        DiagonalSolve( RIGHT, NORMAL, s, U );
+        Gemm( NORMAL, ADJOINT, Field(1), V, U, A );
+        return s.Height();
+    }
+    else
+    {
+        pinv::DistCompleteOrthogonal<Field> cod(g);
+        pinv::Factor( A, ctrl.tol, cod );
+        pinv::Form( cod, A );
+        return cod.rank;
+    }
+}
+
 template<typename Field>
 void HermitianPseudoinverse
 ( UpperOrLower uplo, AbstractDistMatrix<Field>& APre, Base<Field> tolerance )
@@ -144,6 +178,11 @@ void HermitianPseudoinverse
   template void Pseudoinverse( Matrix<Field>& A, Base<Field> tolerance ); \
   template void Pseudoinverse \
   ( AbstractDistMatrix<Field>& A, Base<Field> tolerance ); \
+  template Int Pseudoinverse \
+  ( Matrix<Field>& A, const PseudoinverseCtrl<Base<Field>>& ctrl ); \
+  template Int Pseudoinverse \
+  ( AbstractDistMatrix<Field>& A, \
+    const PseudoinverseCtrl<Base<Field>>& ctrl ); \
   template void HermitianPseudoinverse \
   ( UpperOrLower uplo, Matrix<Field>& A, Base<Field> tolerance ); \
   template void HermitianPseudoinverse \
@@ -0,0 +1,228 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_PSEUDOINVERSE_COMPLETEORTHOGONAL_HPP
+#define EL_PSEUDOINVERSE_COMPLETEORTHOGONAL_HPP
+
+namespace El {
+namespace pinv {
+
+// The complete orthogonal decomposition
+//
+//   A Omega^T = Q | L, 0 | Z,
+//                 | 0, 0 |
+//
+// where L is r x r lower-triangular and r is the numerical rank detected by
+// an adaptive column-pivoted QR factorization, A Omega^T = Q [R; 0], and
+// the LQ factorization R = [L, 0] Z of its leading r rows. The pseudoinverse
+// is then pinv(A) = Omega^T Z^H [inv(L); 0] Q(:,0:r)^H. When r is equal to
+// the width of A, the LQ factorization is skipped and the upper-triangular R
+// is inverted in place of L.
+template<typename Field>
+struct CompleteOrthogonal
+{
+    Int rank=0;
+
+    Matrix<Field> QR, qrScalars;
+    Matrix<Base<Field>> qrSignature;
+    Permutation Omega;
+
+    // Only used if 'rank' is less than the width of A
+    Matrix<Field> LQ, lqScalars;
+    Matrix<Base<Field>> lqSignature;
+};
+
+template<typename Field>
+struct DistCompleteOrthogonal
+{
+    Int rank=0;
+
+    DistMatrix<Field> QR;
+    DistMatrix<Field,MD,STAR> qrScalars;
+    DistMatrix<Base<Field>,MD,STAR> qrSignature;
+    DistPermutation Omega;
+
+    DistMatrix<Field> LQ;
+    DistMatrix<Field,MD,STAR> lqScalars;
+    DistMatrix<Base<Field>,MD,STAR> lqSignature;
+
+    DistCompleteOrthogonal( const Grid& g )
+    : QR(g), qrScalars(g), qrSignature(g), Omega(g),
+      LQ(g), lqScalars(g), lqSignature(g)
+    { }
+};
+
+// Truncate column-pivoted QR once the remaining column norms are at most
+// 'tol' times the largest original column norm
+template<typename Real>
+QRCtrl<Real> RankRevealingCtrl( Int m, Int n, Real tol )
+{
+    QRCtrl<Real> ctrl;
+    ctrl.colPiv = true;
+    ctrl.adaptive = true;
+    ctrl.tol = ( tol == Real(0) ? Max(m,n)*limits::Epsilon<Real>() : tol );
+    return ctrl;
+}
+
+template<typename Field>
+void Factor
+( const Matrix<Field>& A, Base<Field> tol, CompleteOrthogonal<Field>& cod )
+{
+    EL_DEBUG_CSE
+    const Int m = A.Height();
+    const Int n = A.Width();
+    cod.QR = A;
+    QR( cod.QR, cod.qrScalars, cod.qrSignature, cod.Omega,
+        RankRevealingCtrl( m, n, tol ) );
+    cod.rank = cod.qrScalars.Height();
+    if( cod.rank > 0 && cod.rank < n )
+    {
+        cod.LQ = cod.QR( IR(0,cod.rank), ALL );
+        MakeTrapezoidal( UPPER, cod.LQ );
+        LQ( cod.LQ, cod.lqScalars, cod.lqSignature );
+    }
+}
+
+template<typename Field>
+void Factor
+( const AbstractDistMatrix<Field>& A, Base<Field> tol,
+  DistCompleteOrthogonal<Field>& cod )
+{
+    EL_DEBUG_CSE
+    const Int m = A.Height();
+    const Int n = A.Width();
+    Copy( A, cod.QR );
+    QR( cod.QR, cod.qrScalars, cod.qrSignature, cod.Omega,
+        RankRevealingCtrl( m, n, tol ) );
+    cod.rank = cod.qrScalars.Height();
+    if( cod.rank > 0 && cod.rank < n )
+    {
+        Copy( cod.QR( IR(0,cod.rank), ALL ), cod.LQ );
+        MakeTrapezoidal( UPPER, cod.LQ );
+        LQ( cod.LQ, cod.lqScalars, cod.lqSignature );
+    }
+}
+
+// Given the leading r rows, C, of Q^H B, overwrite X with
+// Omega^T Z^H [inv(L) C; 0] (and C with inv(L) C)
+template<typename Field>
+void SolveAfterTruncation
+( const CompleteOrthogonal<Field>& cod, Matrix<Field>& C, Matrix<Field>& X )
+{
+    EL_DEBUG_CSE
+    const Int n = cod.QR.Width();
+    const Int r = cod.rank;
+    if( r == n )
+    {
+        auto R = cod.QR( IR(0,r), IR(0,r) );
+        Trsm( LEFT, UPPER, NORMAL, NON_UNIT, Field(1), R, C );
+        X = C;
+    }
+    else
+    {
+        Zeros( X, n, C.Width() );
+        if( r > 0 )
+        {
+            auto L = cod.LQ( ALL, IR(0,r) );
+            Trsm( LEFT, LOWER, NORMAL, NON_UNIT, Field(1), L, C );
+            auto XT = X( IR(0,r), ALL );
+            XT = C;
+            lq::ApplyQ
+            ( LEFT, ADJOINT, cod.LQ, cod.lqScalars, cod.lqSignature, X );
+        }
+    }
+    cod.Omega.InversePermuteRows( X );
+}
+
+template<typename Field>
+void SolveAfterTruncation
+( const DistCompleteOrthogonal<Field>& cod,
+  DistMatrix<Field>& C, DistMatrix<Field>& X )
+{
+    EL_DEBUG_CSE
+    const Int n = cod.QR.Width();
+    const Int r = cod.rank;
+    if( r == n )
+    {
+        auto R = cod.QR( IR(0,r), IR(0,r) );
+        Trsm( LEFT, UPPER, NORMAL, NON_UNIT, Field(1), R, C );
+        Copy( C, X );
+    }
+    else
+    {
+        Zeros( X, n, C.Width() );
+        if( r > 0 )
+        {
+            auto L = cod.LQ( ALL, IR(0,r) );
+            Trsm( LEFT, LOWER, NORMAL, NON_UNIT, Field(1), L, C );
+            auto XT = X( IR(0,r), ALL );
+            XT = C;
+            lq::ApplyQ
+            ( LEFT, ADJOINT, cod.LQ, cod.lqScalars, cod.lqSignature, X );
+        }
+    }
+    cod.Omega.InversePermuteRows( X );
+}
+
+// X := pinv(A) B
+template<typename Field>
+void Solve
+( const CompleteOrthogonal<Field>& cod,
+  const Matrix<Field>& B, Matrix<Field>& X )
+{
+    EL_DEBUG_CSE
+    Matrix<Field> C( B );
+    qr::ApplyQ( LEFT, ADJOINT, cod.QR, cod.qrScalars, cod.qrSignature, C );
+    auto CT = C( IR(0,cod.rank), ALL );
+    SolveAfterTruncation( cod, CT, X );
+}
+
+template<typename Field>
+void Solve
+( const DistCompleteOrthogonal<Field>& cod,
+  const AbstractDistMatrix<Field>& B, DistMatrix<Field>& X )
+{
+    EL_DEBUG_CSE
+    DistMatrix<Field> C( B );
+    qr::ApplyQ( LEFT, ADJOINT, cod.QR, cod.qrScalars, cod.qrSignature, C );
+    auto CT = C( IR(0,cod.rank), ALL );
+    SolveAfterTruncation( cod, CT, X );
+}
+
+// Form pinv(A) from Q1 = Q(:,0:r), which requires O(m n r) rather than
+// the O(m^2 n) work of applying Q^H to the identity
+template<typename Field>
+void Form( const CompleteOrthogonal<Field>& cod, Matrix<Field>& pinvA )
+{
+    EL_DEBUG_CSE
+    const Int m = cod.QR.Height();
+    Matrix<Field> Q1, C;
+    Identity( Q1, m, cod.rank );
+    qr::ApplyQ( LEFT, NORMAL, cod.QR, cod.qrScalars, cod.qrSignature, Q1 );
+    Adjoint( Q1, C );
+    SolveAfterTruncation( cod, C, pinvA );
+}
+
+template<typename Field>
+void Form
+( const DistCompleteOrthogonal<Field>& cod, DistMatrix<Field>& pinvA )
+{
+    EL_DEBUG_CSE
+    const Int m = cod.QR.Height();
+    const Grid& g = cod.QR.Grid();
+    DistMatrix<Field> Q1(g), C(g);
+    Identity( Q1, m, cod.rank );
+    qr::ApplyQ( LEFT, NORMAL, cod.QR, cod.qrScalars, cod.qrSignature, Q1 );
+    Adjoint( Q1, C );
+    SolveAfterTruncation( cod, C, pinvA );
+}
+
+} // namespace pinv
+} // namespace El
+
+#endif // ifndef EL_PSEUDOINVERSE_COMPLETEORTHOGONAL_HPP
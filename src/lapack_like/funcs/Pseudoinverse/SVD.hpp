@@ -0,0 +1,56 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_PSEUDOINVERSE_SVD_HPP
+#define EL_PSEUDOINVERSE_SVD_HPP
+
+namespace El {
+namespace pinv {
+
+// The compact SVD of A (which is overwritten), dropping the singular values
+// which are at most 'tol' times the largest one
+template<typename Real>
+SVDCtrl<Real> TruncatedSVDCtrl( Int m, Int n, Real tol )
+{
+    SVDCtrl<Real> ctrl;
+    ctrl.overwrite = true;
+    ctrl.bidiagSVDCtrl.approach = COMPACT_SVD;
+    ctrl.bidiagSVDCtrl.tolType = RELATIVE_TO_MAX_SING_VAL_TOL;
+    ctrl.bidiagSVDCtrl.tol =
+      ( tol == Real(0) ? Max(m,n)*limits::Epsilon<Real>() : tol );
+    return ctrl;
+}
+
+template<typename Field>
+void TruncatedSVD
+( Matrix<Field>& A,
+  Base<Field> tol,
+  Matrix<Field>& U,
+  Matrix<Base<Field>>& s,
+  Matrix<Field>& V )
+{
+    EL_DEBUG_CSE
+    SVD( A, U, s, V, TruncatedSVDCtrl( A.Height(), A.Width(), tol ) );
+}
+
+template<typename Field>
+void TruncatedSVD
+( DistMatrix<Field>& A,
+  Base<Field> tol,
+  DistMatrix<Field>& U,
+  DistMatrix<Base<Field>,VR,STAR>& s,
+  DistMatrix<Field>& V )
+{
+    EL_DEBUG_CSE
+    SVD( A, U, s, V, TruncatedSVDCtrl( A.Height(), A.Width(), tol ) );
+}
+
+} // namespace pinv
+} // namespace El
+
+#endif // ifndef EL_PSEUDOINVERSE_SVD_HPP
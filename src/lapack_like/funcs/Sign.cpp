@@ -21,14 +21,15 @@ void
 NewtonStep
 ( const Matrix<Field>& X,
         Matrix<Field>& XNew,
+        Permutation& P,
   SignScaling scaling=SIGN_SCALE_FROB )
 {
     EL_DEBUG_CSE
     typedef Base<Field> Real;
 
-    // Calculate mu while forming XNew := inv(X)
+    // Calculate mu while forming XNew := inv(X), reusing the storage of XNew
+    // and P from the previous iteration
     Real mu=1;
-    Permutation P;
     XNew = X;
     LU( XNew, P );
     if( scaling == SIGN_SCALE_DET )
@@ -52,14 +53,15 @@ void
 NewtonStep
 ( const DistMatrix<Field>& X,
         DistMatrix<Field>& XNew,
+        DistPermutation& P,
   SignScaling scaling=SIGN_SCALE_FROB )
 {
     EL_DEBUG_CSE
     typedef Base<Field> Real;
 
-    // Calculate mu while forming B := inv(X)
+    // Calculate mu while forming XNew := inv(X), reusing the storage of XNew
+    // and P from the previous iteration
     Real mu=1;
-    DistPermutation P( X.Grid() );
     XNew = X;
     LU( XNew, P );
     if( scaling == SIGN_SCALE_DET )
@@ -86,15 +88,14 @@ NewtonSchulzStep
         Matrix<Field>& XNew )
 {
     EL_DEBUG_CSE
-    typedef Base<Field> Real;
     const Int n = X.Height();
 
     // XTmp := 3I - X^2
     Identity( XTmp, n, n );
-    Gemm( NORMAL, NORMAL, Real(-1), X, X, Real(3), XTmp );
+    Gemm( NORMAL, NORMAL, Field(-1), X, X, Field(3), XTmp );
 
     // XNew := 1/2 X XTmp
-    Gemm( NORMAL, NORMAL, Real(1)/Real(2), X, XTmp, XNew );
+    Gemm( NORMAL, NORMAL, Field(1)/Field(2), X, XTmp, XNew );
 }
 
 template<typename Field>
@@ -105,15 +106,14 @@ NewtonSchulzStep
         DistMatrix<Field>& XNew )
 {
     EL_DEBUG_CSE
-    typedef Base<Field> Real;
     const Int n = X.Height();
 
     // XTmp := 3I - X^2
     Identity( XTmp, n, n );
-    Gemm( NORMAL, NORMAL, Real(-1), X, X, Real(3), XTmp );
+    Gemm( NORMAL, NORMAL, Field(-1), X, X, Field(3), XTmp );
 
     // XNew := 1/2 X XTmp
-    Gemm( NORMAL, NORMAL, Real(1)/Real(2), X, XTmp, XNew );
+    Gemm( NORMAL, NORMAL, Field(1)/Field(2), X, XTmp, XNew );
 }
 
 // Please see Chapter 5 of Higham's
@@ -131,11 +131,12 @@ Newton( Matrix<Field>& A, const SignCtrl<Base<Field>>& ctrl )
 
     Int numIts=0;
     Matrix<Field> B;
+    Permutation P;
     Matrix<Field> *X=&A, *XNew=&B;
     while( numIts < ctrl.maxIts )
     {
         // Overwrite XNew with the new iterate
-        NewtonStep( *X, *XNew, ctrl.scaling );
+        NewtonStep( *X, *XNew, P, ctrl.scaling );
 
         // Use the difference in the iterates to test for convergence
         Axpy( Real(-1), *XNew, *X );
@@ -170,11 +171,12 @@ Newton( DistMatrix<Field>& A, const SignCtrl<Base<Field>>& ctrl )
 
     Int numIts=0;
     DistMatrix<Field> B( A.Grid() );
+    DistPermutation P( A.Grid() );
     DistMatrix<Field> *X=&A, *XNew=&B;
     while( numIts < ctrl.maxIts )
     {
         // Overwrite XNew with the new iterate
-        NewtonStep( *X, *XNew, ctrl.scaling );
+        NewtonStep( *X, *XNew, P, ctrl.scaling );
 
         // Use the difference in the iterates to test for convergence
         Axpy( Real(-1), *XNew, *X );
@@ -197,7 +199,274 @@ Newton( DistMatrix<Field>& A, const SignCtrl<Base<Field>>& ctrl )
     return numIts;
 }
 
-// TODO: NewtonSchulzHybrid which estimates when || X^2 - I ||_2 < 1
+// Newton's iteration is used until || I - X^2 ||_1 <= ctrl.hybridTol, at
+// which point the (Gemm-only) Newton-Schulz iteration is guaranteed to
+// converge quadratically and is used instead
+template<typename Field>
+Int
+NewtonSchulzHybrid( Matrix<Field>& A, const SignCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Int n = A.Height();
+    Real tol = ctrl.tol;
+    if( tol == Real(0) )
+        tol = n*limits::Epsilon<Real>();
+
+    Int numIts=0;
+    bool inverseFree=false;
+    Matrix<Field> B, XTmp;
+    Permutation P;
+    Matrix<Field> *X=&A, *XNew=&B;
+    while( numIts < ctrl.maxIts )
+    {
+        // Overwrite XNew with the new iterate
+        if( inverseFree )
+            NewtonSchulzStep( *X, XTmp, *XNew );
+        else
+            NewtonStep( *X, *XNew, P, ctrl.scaling );
+
+        // Use the difference in the iterates to test for convergence
+        Axpy( Real(-1), *XNew, *X );
+        const Real oneDiff = OneNorm( *X );
+        const Real oneNew = OneNorm( *XNew );
+
+        // Ensure that X holds the current iterate and break if possible
+        ++numIts;
+        std::swap( X, XNew );
+        if( ctrl.progress )
+            cout << "after " << numIts
+                 << ( inverseFree ? " Newton-Schulz" : " Newton" )
+                 << " iter's: oneDiff=" << oneDiff << ", oneNew=" << oneNew
+                 << ", oneDiff/oneNew=" << oneDiff/oneNew << ", tol="
+                 << tol << endl;
+        if( oneDiff/oneNew <= Pow(oneNew,ctrl.power)*tol )
+            break;
+
+        if( !inverseFree )
+        {
+            Identity( XTmp, n, n );
+            Gemm( NORMAL, NORMAL, Field(-1), *X, *X, Field(1), XTmp );
+            inverseFree = ( OneNorm(XTmp) <= ctrl.hybridTol );
+        }
+    }
+    if( X != &A )
+        A = *X;
+    return numIts;
+}
+
+template<typename Field>
+Int
+NewtonSchulzHybrid( DistMatrix<Field>& A, const SignCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Int n = A.Height();
+    Real tol = ctrl.tol;
+    if( tol == Real(0) )
+        tol = n*limits::Epsilon<Real>();
+
+    Int numIts=0;
+    bool inverseFree=false;
+    const Grid& g = A.Grid();
+    DistMatrix<Field> B(g), XTmp(g);
+    DistPermutation P(g);
+    DistMatrix<Field> *X=&A, *XNew=&B;
+    while( numIts < ctrl.maxIts )
+    {
+        // Overwrite XNew with the new iterate
+        if( inverseFree )
+            NewtonSchulzStep( *X, XTmp, *XNew );
+        else
+            NewtonStep( *X, *XNew, P, ctrl.scaling );
+
+        // Use the difference in the iterates to test for convergence
+        Axpy( Real(-1), *XNew, *X );
+        const Real oneDiff = OneNorm( *X );
+        const Real oneNew = OneNorm( *XNew );
+
+        // Ensure that X holds the current iterate and break if possible
+        ++numIts;
+        std::swap( X, XNew );
+        if( ctrl.progress && g.Rank() == 0 )
+            cout << "after " << numIts
+                 << ( inverseFree ? " Newton-Schulz" : " Newton" )
+                 << " iter's: oneDiff=" << oneDiff << ", oneNew=" << oneNew
+                 << ", oneDiff/oneNew=" << oneDiff/oneNew << ", tol="
+                 << tol << endl;
+        if( oneDiff/oneNew <= Pow(oneNew,ctrl.power)*tol )
+            break;
+
+        if( !inverseFree )
+        {
+            Identity( XTmp, n, n );
+            Gemm( NORMAL, NORMAL, Field(-1), *X, *X, Field(1), XTmp );
+            inverseFree = ( OneNorm(XTmp) <= ctrl.hybridTol );
+        }
+    }
+    if( X != &A )
+        A = *X;
+    return numIts;
+}
+
+// The dynamically weighted Halley iteration
+//
+//   X := X (a I + b X^2) inv(I + c X^2) = (b/c) X + (a-b/c) inv(I + c X^2) X,
+//
+// with the weights of Nakatsukasa, Bai, and Gygi's QDWH iteration for the
+// polar decomposition (see src/lapack_like/spectral/Polar/QDWH.hpp) driven by
+// a lower bound on the smallest singular value of the scaled iterate. Each
+// iteration requires a single LU factorization, whose storage and pivots are
+// reused across iterations.
+template<typename Real>
+void HalleyWeights( Real& L, Real& alpha, Real& beta, Real& c )
+{
+    typedef Complex<Real> Cpx;
+    const Real oneThird = Real(1)/Real(3);
+    const Real tol = 5*limits::Epsilon<Real>();
+    Real L2;
+    Cpx dd, sqd;
+    if( Abs(1-L) < tol )
+    {
+        L2 = 1;
+        dd = 0;
+        sqd = 1;
+    }
+    else
+    {
+        L2 = L*L;
+        dd = Pow( 4*(1-L2)/(L2*L2), oneThird );
+        sqd = Sqrt( Real(1)+dd );
+    }
+    const Cpx arg = Real(8) - Real(4)*dd + Real(8)*(2-L2)/(L2*sqd);
+    const Real a = (sqd + Sqrt(arg)/Real(2)).real();
+    const Real b = (a-1)*(a-1)/4;
+    c = a+b-1;
+    alpha = a-b/c;
+    beta = b/c;
+    L = L*(a+b*L2)/(1+c*L2);
+}
+
+template<typename Field>
+Int
+QDWH( Matrix<Field>& A, const SignCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Int n = A.Height();
+    Real tol = ctrl.tol;
+    if( tol == Real(0) )
+        tol = n*limits::Epsilon<Real>();
+
+    // Scale A to have a two-norm of roughly one and then bound its smallest
+    // singular value from below using the one-norm of its inverse
+    A *= 1/TwoNormEstimate( A );
+    Matrix<Field> C( A );
+    Permutation P;
+    LU( C, P );
+    inverse::AfterLUPartialPiv( C, P );
+    Real L = Real(1) / (OneNorm(C)*Sqrt(Real(n)));
+
+    Int numIts=0;
+    Matrix<Field> Z, XLast;
+    while( numIts < ctrl.maxIts )
+    {
+        Real alpha, beta, c;
+        HalleyWeights( L, alpha, beta, c );
+
+        // Z := inv(I + c A^2) A
+        Identity( C, n, n );
+        Gemm( NORMAL, NORMAL, Field(c), A, A, Field(1), C );
+        LU( C, P );
+        Z = A;
+        lu::SolveAfter( NORMAL, C, P, Z );
+
+        // A := beta A + alpha Z
+        XLast = A;
+        A *= beta;
+        Axpy( alpha, Z, A );
+
+        ++numIts;
+        XLast -= A;
+        const Real oneDiff = OneNorm( XLast );
+        const Real oneNew = OneNorm( A );
+        if( ctrl.progress )
+            cout << "after " << numIts << " QDWH iter's: "
+                 << "oneDiff=" << oneDiff << ", oneNew=" << oneNew
+                 << ", oneDiff/oneNew=" << oneDiff/oneNew << ", tol="
+                 << tol << endl;
+        if( oneDiff/oneNew <= Pow(oneNew,ctrl.power)*tol )
+            break;
+    }
+    return numIts;
+}
+
+template<typename Field>
+Int
+QDWH( DistMatrix<Field>& A, const SignCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Int n = A.Height();
+    Real tol = ctrl.tol;
+    if( tol == Real(0) )
+        tol = n*limits::Epsilon<Real>();
+
+    // Scale A to have a two-norm of roughly one and then bound its smallest
+    // singular value from below using the one-norm of its inverse
+    const Grid& g = A.Grid();
+    A *= 1/TwoNormEstimate( A );
+    DistMatrix<Field> C( A );
+    DistPermutation P( g );
+    LU( C, P );
+    inverse::AfterLUPartialPiv( C, P );
+    Real L = Real(1) / (OneNorm(C)*Sqrt(Real(n)));
+
+    Int numIts=0;
+    DistMatrix<Field> Z(g), XLast(g);
+    while( numIts < ctrl.maxIts )
+    {
+        Real alpha, beta, c;
+        HalleyWeights( L, alpha, beta, c );
+
+        // Z := inv(I + c A^2) A
+        Identity( C, n, n );
+        Gemm( NORMAL, NORMAL, Field(c), A, A, Field(1), C );
+        LU( C, P );
+        Z = A;
+        lu::SolveAfter( NORMAL, C, P, Z );
+
+        // A := beta A + alpha Z
+        XLast = A;
+        A *= beta;
+        Axpy( alpha, Z, A );
+
+        ++numIts;
+        XLast -= A;
+        const Real oneDiff = OneNorm( XLast );
+        const Real oneNew = OneNorm( A );
+        if( ctrl.progress && g.Rank() == 0 )
+            cout << "after " << numIts << " QDWH iter's: "
+                 << "oneDiff=" << oneDiff << ", oneNew=" << oneNew
+                 << ", oneDiff/oneNew=" << oneDiff/oneNew << ", tol="
+                 << tol << endl;
+        if( oneDiff/oneNew <= Pow(oneNew,ctrl.power)*tol )
+            break;
+    }
+    return numIts;
+}
+
+template<typename MatrixType,typename Real>
+Int Iterate( MatrixType& A, const SignCtrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    switch( ctrl.algorithm )
+    {
+    case SIGN_NEWTON_SCHULZ: return NewtonSchulzHybrid( A, ctrl );
+    case SIGN_QDWH:          return QDWH( A, ctrl );
+    default:                 return Newton( A, ctrl );
+    }
+}
 
 } // namespace sign
 
@@ -205,7 +474,7 @@ template<typename Field>
 void Sign( Matrix<Field>& A, const SignCtrl<Base<Field>> ctrl )
 {
     EL_DEBUG_CSE
-    sign::Newton( A, ctrl );
+    sign::Iterate( A, ctrl );
 }
 
 template<typename Field>
@@ -214,7 +483,7 @@ void Sign
 {
     EL_DEBUG_CSE
     Matrix<Field> ACopy( A );
-    sign::Newton( A, ctrl );
+    sign::Iterate( A, ctrl );
     Gemm( NORMAL, NORMAL, Field(1), A, ACopy, N );
 }
 
@@ -226,7 +495,7 @@ void Sign( AbstractDistMatrix<Field>& APre, const SignCtrl<Base<Field>> ctrl )
     DistMatrixReadWriteProxy<Field,Field,MC,MR> AProx( APre );
     auto& A = AProx.Get();
 
-    sign::Newton( A, ctrl );
+    sign::Iterate( A, ctrl );
 }
 
 template<typename Field>
@@ -243,7 +512,7 @@ void Sign
     auto& N = NProx.Get();
 
     DistMatrix<Field> ACopy( A );
-    sign::Newton( A, ctrl );
+    sign::Iterate( A, ctrl );
     Gemm( NORMAL, NORMAL, Field(1), A, ACopy, N );
 }
 
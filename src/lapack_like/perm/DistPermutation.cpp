@@ -290,6 +290,171 @@ void InvertPermutation
     }
 }
 
+// Applies the given (destination,source) moves of global rows (or columns)
+// to each of the matrices, which must share their column (row) communicator,
+// using a single exchange. The moves between each pair of processes are
+// sorted by their local destinations on both sides so that runs of
+// consecutive local rows (columns) can be packed and unpacked as blocks
+// without exchanging any indices.
+template<typename T>
+void ApplyMoves
+( const vector<AbstractDistMatrix<T>*>& matrices,
+  const vector<pair<Int,Int>>& moves,
+  bool permuteCols )
+{
+    EL_DEBUG_CSE
+    if( matrices.empty() || moves.empty() || !matrices[0]->Participating() )
+        return;
+    const auto& A0 = *matrices[0];
+    mpi::Comm comm = ( permuteCols ? A0.RowComm() : A0.ColComm() );
+    const int commRank = mpi::Rank( comm );
+    const int commSize = mpi::Size( comm );
+
+    struct Run
+    {
+        int from, to;
+        Int sourceLoc, destLoc, length;
+    };
+    const Int numMatrices = matrices.size();
+    vector<vector<Run>> runs(numMatrices);
+    vector<int> sendCounts(commSize,0), recvCounts(commSize,0);
+    for( Int k=0; k<numMatrices; ++k )
+    {
+        const auto& A = *matrices[k];
+        if( A.Grid() != A0.Grid() ||
+            (permuteCols ? A.RowComm() : A.ColComm()) != comm )
+            LogicError("The matrices must share a communicator");
+        if( A.Height() == 0 || A.Width() == 0 )
+            continue;
+
+        // Form the moves involving this process in a canonical order
+        vector<Run> localMoves;
+        for( const auto& move : moves )
+        {
+            const Int dest = move.first;
+            const Int source = move.second;
+            const int to =
+              ( permuteCols ? A.ColOwner(dest) : A.RowOwner(dest) );
+            const int from =
+              ( permuteCols ? A.ColOwner(source) : A.RowOwner(source) );
+            if( to != commRank && from != commRank )
+                continue;
+            const Int destLoc =
+              ( permuteCols ? A.LocalCol(dest,to) : A.LocalRow(dest,to) );
+            const Int sourceLoc =
+              ( permuteCols ? A.LocalCol(source,from)
+                            : A.LocalRow(source,from) );
+            localMoves.push_back( Run{from,to,sourceLoc,destLoc,1} );
+        }
+        std::sort
+        ( localMoves.begin(), localMoves.end(),
+          []( const Run& a, const Run& b )
+          { return std::tie(a.from,a.to,a.destLoc) <
+                   std::tie(b.from,b.to,b.destLoc); } );
+
+        // Merge the moves into contiguous runs
+        const Int length = ( permuteCols ? A.LocalHeight() : A.LocalWidth() );
+        for( const auto& move : localMoves )
+        {
+            if( !runs[k].empty() )
+            {
+                Run& run = runs[k].back();
+                if( run.from == move.from && run.to == move.to &&
+                    run.sourceLoc+run.length == move.sourceLoc &&
+                    run.destLoc+run.length == move.destLoc )
+                {
+                    ++run.length;
+                    continue;
+                }
+            }
+            runs[k].push_back( move );
+        }
+        for( const auto& run : runs[k] )
+        {
+            if( run.from == commRank )
+                sendCounts[run.to] += run.length*length;
+            if( run.to == commRank )
+                recvCounts[run.from] += run.length*length;
+        }
+    }
+    vector<int> sendOffs, recvOffs;
+    const int totalSend = Scan( sendCounts, sendOffs );
+    const int totalRecv = Scan( recvCounts, recvOffs );
+
+    // Pack the runs
+    vector<T> sendBuf;
+    FastResize( sendBuf, mpi::Pad(totalSend) );
+    auto offsets = sendOffs;
+    for( Int k=0; k<numMatrices; ++k )
+    {
+        const auto& A = *matrices[k];
+        const T* ABuf = A.LockedBuffer();
+        const Int ALDim = A.LDim();
+        for( const auto& run : runs[k] )
+        {
+            if( run.from != commRank )
+                continue;
+            T* buf = &sendBuf[offsets[run.to]];
+            if( permuteCols )
+            {
+                const Int localHeight = A.LocalHeight();
+                copy::util::InterleaveMatrix
+                ( localHeight, run.length,
+                  &ABuf[run.sourceLoc*ALDim], 1, ALDim,
+                  buf,                        1, localHeight );
+                offsets[run.to] += localHeight*run.length;
+            }
+            else
+            {
+                const Int localWidth = A.LocalWidth();
+                copy::util::InterleaveMatrix
+                ( run.length, localWidth,
+                  &ABuf[run.sourceLoc], 1, ALDim,
+                  buf,                  1, run.length );
+                offsets[run.to] += run.length*localWidth;
+            }
+        }
+    }
+
+    // Exchange and unpack the runs
+    vector<T> recvBuf;
+    FastResize( recvBuf, mpi::Pad(totalRecv) );
+    mpi::AllToAll
+    ( sendBuf.data(), sendCounts.data(), sendOffs.data(),
+      recvBuf.data(), recvCounts.data(), recvOffs.data(), comm );
+    offsets = recvOffs;
+    for( Int k=0; k<numMatrices; ++k )
+    {
+        auto& A = *matrices[k];
+        T* ABuf = A.Buffer();
+        const Int ALDim = A.LDim();
+        for( const auto& run : runs[k] )
+        {
+            if( run.to != commRank )
+                continue;
+            const T* buf = &recvBuf[offsets[run.from]];
+            if( permuteCols )
+            {
+                const Int localHeight = A.LocalHeight();
+                copy::util::InterleaveMatrix
+                ( localHeight, run.length,
+                  buf,                      1, localHeight,
+                  &ABuf[run.destLoc*ALDim], 1, ALDim );
+                offsets[run.from] += localHeight*run.length;
+            }
+            else
+            {
+                const Int localWidth = A.LocalWidth();
+                copy::util::InterleaveMatrix
+                ( run.length, localWidth,
+                  buf,                1, run.length,
+                  &ABuf[run.destLoc], 1, ALDim );
+                offsets[run.from] += run.length*localWidth;
+            }
+        }
+    }
+}
+
 } // anonymous namespace
 
 DistPermutation::DistPermutation( const Grid& g )
@@ -646,6 +811,40 @@ const DistPermutation& DistPermutation::operator=( const DistPermutation& P )
     return *this;
 }
 
+vector<pair<Int,Int>>
+DistPermutation::SwapMoves( Int offset, bool inverse ) const
+{
+    EL_DEBUG_CSE
+    auto activeInd = IR(0,numSwaps_);
+    DistMatrix<Int,STAR,STAR> dests_STAR_STAR( swapDests_(activeInd,ALL) );
+    DistMatrix<Int,STAR,STAR> origins_STAR_STAR( swapOrigins_.Grid() );
+    if( !implicitSwapOrigins_ )
+        origins_STAR_STAR = swapOrigins_(activeInd,ALL);
+    auto& destsLoc = dests_STAR_STAR.LockedMatrix();
+    auto& originsLoc = origins_STAR_STAR.LockedMatrix();
+
+    // Track the original index of the contents of each position touched by
+    // the swaps
+    std::map<Int,Int> contents;
+    auto contentsOf = [&]( Int i ) -> Int&
+      { return contents.insert( std::make_pair(i,i) ).first->second; };
+    for( Int step=0; step<numSwaps_; ++step )
+    {
+        const Int j = ( inverse ? numSwaps_-1-step : step );
+        const Int origin =
+          ( implicitSwapOrigins_ ? j : originsLoc(j) ) + offset;
+        const Int dest = destsLoc(j) + offset;
+        if( origin != dest )
+            std::swap( contentsOf(origin), contentsOf(dest) );
+    }
+
+    vector<pair<Int,Int>> moves;
+    for( const auto& entry : contents )
+        if( entry.first != entry.second )
+            moves.push_back( entry );
+    return moves;
+}
+
 bool DistPermutation::Parity() const
 {
     EL_DEBUG_CSE
@@ -727,42 +926,8 @@ void DistPermutation::PermuteCols( AbstractDistMatrix<T>& A, Int offset ) const
     // TODO(poulson): Use an (MC,MR) proxy for A?
     if( swapSequence_ )
     {
-        const Int height = A.Height();
-        const Int width = A.Width();
-        if( height == 0 || width == 0 )
-            return;
-
-        auto activeInd = IR(0,numSwaps_);
-
-        // TODO(poulson): Introduce an std::map for caching the pivots this
-        // process needs to care about to avoid redundant [STAR,STAR] formations
-        //
-        // TODO(poulson): Decide on the data structure; an std::vector of pivot
-        // origins and destinations?
-
-        DistMatrix<Int,STAR,STAR> dests_STAR_STAR( swapDests_(activeInd,ALL) );
-        auto& destsLoc = dests_STAR_STAR.Matrix();
-        if( implicitSwapOrigins_ )
-        {
-            for( Int j=0; j<numSwaps_; ++j )
-            {
-                const Int origin = j+offset;
-                const Int dest = destsLoc(j)+offset;
-                ColSwap( A, origin, dest );
-            }
-        }
-        else
-        {
-            DistMatrix<Int,STAR,STAR> origins_STAR_STAR =
-              swapOrigins_(activeInd,ALL);
-            auto& originsLoc = origins_STAR_STAR.Matrix();
-            for( Int j=0; j<numSwaps_; ++j )
-            {
-                const Int origin = originsLoc(j)+offset;
-                const Int dest = destsLoc(j)+offset;
-                ColSwap( A, origin, dest );
-            }
-        }
+        vector<AbstractDistMatrix<T>*> matrices(1,&A);
+        PermuteCols( matrices, offset );
     }
     else
     {
@@ -818,36 +983,8 @@ void DistPermutation::InversePermuteCols
     // TODO(poulson): Use an (MC,MR) proxy for A?
     if( swapSequence_ )
     {
-        const Int height = A.Height();
-        const Int width = A.Width();
-        if( height == 0 || width == 0 )
-            return;
-
-        auto activeInd = IR(0,numSwaps_);
-
-        DistMatrix<Int,STAR,STAR> dests_STAR_STAR( swapDests_(activeInd,ALL) );
-        auto& destsLoc = dests_STAR_STAR.Matrix();
-        if( implicitSwapOrigins_ )
-        {
-            for( Int j=numSwaps_-1; j>=0; --j )
-            {
-                const Int origin = j+offset;
-                const Int dest = destsLoc(j)+offset;
-                ColSwap( A, origin, dest );
-            }
-        }
-        else
-        {
-            DistMatrix<Int,STAR,STAR> origins_STAR_STAR =
-              swapOrigins_(activeInd,ALL);
-            auto& originsLoc = origins_STAR_STAR.Matrix();
-            for( Int j=numSwaps_-1; j>=0; --j )
-            {
-                const Int origin = originsLoc(j)+offset;
-                const Int dest = destsLoc(j)+offset;
-                ColSwap( A, origin, dest );
-            }
-        }
+        vector<AbstractDistMatrix<T>*> matrices(1,&A);
+        InversePermuteCols( matrices, offset );
     }
     else
     {
@@ -902,36 +1039,8 @@ void DistPermutation::PermuteRows( AbstractDistMatrix<T>& A, Int offset ) const
     // TODO(poulson): Use an (MC,MR) proxy for A?
     if( swapSequence_ )
     {
-        const Int height = A.Height();
-        const Int width = A.Width();
-        if( height == 0 || width == 0 )
-            return;
-
-        auto activeInd = IR(0,numSwaps_);
-
-        DistMatrix<Int,STAR,STAR> dests_STAR_STAR = swapDests_(activeInd,ALL);
-        auto& destsLoc = dests_STAR_STAR.Matrix();
-        if( implicitSwapOrigins_ )
-        {
-            for( Int j=0; j<numSwaps_; ++j )
-            {
-                const Int origin = j+offset;
-                const Int dest = destsLoc(j)+offset;
-                El::RowSwap( A, origin, dest );
-            }
-        }
-        else
-        {
-            DistMatrix<Int,STAR,STAR> origins_STAR_STAR =
-              swapOrigins_(activeInd,ALL);
-            auto& originsLoc = origins_STAR_STAR.Matrix();
-            for( Int j=0; j<numSwaps_; ++j )
-            {
-                const Int origin = originsLoc(j)+offset;
-                const Int dest = destsLoc(j)+offset;
-                El::RowSwap( A, origin, dest );
-            }
-        }
+        vector<AbstractDistMatrix<T>*> matrices(1,&A);
+        PermuteRows( matrices, offset );
     }
     else
     {
@@ -987,36 +1096,8 @@ void DistPermutation::InversePermuteRows
     // TODO(poulson): Use an (MC,MR) proxy for A?
     if( swapSequence_ )
     {
-        const Int height = A.Height();
-        const Int width = A.Width();
-        if( height == 0 || width == 0 )
-            return;
-
-        auto activeInd = IR(0,numSwaps_);
-
-        DistMatrix<Int,STAR,STAR> dests_STAR_STAR = swapDests_(activeInd,ALL);
-        auto& destsLoc = dests_STAR_STAR.Matrix();
-        if( implicitSwapOrigins_ )
-        {
-            for( Int j=numSwaps_-1; j>=0; --j )
-            {
-                const Int origin = j+offset;
-                const Int dest = destsLoc(j)+offset;
-                El::RowSwap( A, origin, dest );
-            }
-        }
-        else
-        {
-            DistMatrix<Int,STAR,STAR> origins_STAR_STAR =
-              swapOrigins_(activeInd,ALL);
-            auto& originsLoc = origins_STAR_STAR.Matrix();
-            for( Int j=numSwaps_-1; j>=0; --j )
-            {
-                const Int origin = originsLoc(j)+offset;
-                const Int dest = destsLoc(j)+offset;
-                El::RowSwap( A, origin, dest );
-            }
-        }
+        vector<AbstractDistMatrix<T>*> matrices(1,&A);
+        InversePermuteRows( matrices, offset );
     }
     else
     {
@@ -1064,6 +1145,70 @@ void DistPermutation::InversePermuteRows
     }
 }
 
+template<typename T>
+void DistPermutation::PermuteCols
+( const vector<AbstractDistMatrix<T>*>& matrices, Int offset ) const
+{
+    EL_DEBUG_CSE
+    if( swapSequence_ )
+    {
+        ApplyMoves( matrices, SwapMoves(offset,false), true );
+    }
+    else
+    {
+        for( auto A : matrices )
+            PermuteCols( *A, offset );
+    }
+}
+
+template<typename T>
+void DistPermutation::InversePermuteCols
+( const vector<AbstractDistMatrix<T>*>& matrices, Int offset ) const
+{
+    EL_DEBUG_CSE
+    if( swapSequence_ )
+    {
+        ApplyMoves( matrices, SwapMoves(offset,true), true );
+    }
+    else
+    {
+        for( auto A : matrices )
+            InversePermuteCols( *A, offset );
+    }
+}
+
+template<typename T>
+void DistPermutation::PermuteRows
+( const vector<AbstractDistMatrix<T>*>& matrices, Int offset ) const
+{
+    EL_DEBUG_CSE
+    if( swapSequence_ )
+    {
+        ApplyMoves( matrices, SwapMoves(offset,false), false );
+    }
+    else
+    {
+        for( auto A : matrices )
+            PermuteRows( *A, offset );
+    }
+}
+
+template<typename T>
+void DistPermutation::InversePermuteRows
+( const vector<AbstractDistMatrix<T>*>& matrices, Int offset ) const
+{
+    EL_DEBUG_CSE
+    if( swapSequence_ )
+    {
+        ApplyMoves( matrices, SwapMoves(offset,true), false );
+    }
+    else
+    {
+        for( auto A : matrices )
+            InversePermuteRows( *A, offset );
+    }
+}
+
 template<typename T>
 void DistPermutation::PermuteSymmetrically
 ( UpperOrLower uplo,
@@ -1241,6 +1386,18 @@ void DistPermutation::ExplicitMatrix( AbstractDistMatrix<Int>& P ) const
   template void DistPermutation::InversePermuteRows \
   ( AbstractDistMatrix<T>& A, \
     Int offset ) const; \
+  template void DistPermutation::PermuteCols \
+  ( const vector<AbstractDistMatrix<T>*>& matrices, \
+    Int offset ) const; \
+  template void DistPermutation::InversePermuteCols \
+  ( const vector<AbstractDistMatrix<T>*>& matrices, \
+    Int offset ) const; \
+  template void DistPermutation::PermuteRows \
+  ( const vector<AbstractDistMatrix<T>*>& matrices, \
+    Int offset ) const; \
+  template void DistPermutation::InversePermuteRows \
+  ( const vector<AbstractDistMatrix<T>*>& matrices, \
+    Int offset ) const; \
   template void DistPermutation::PermuteSymmetrically \
   ( UpperOrLower uplo, \
     AbstractDistMatrix<T>& A, \
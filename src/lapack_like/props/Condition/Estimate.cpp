@@ -0,0 +1,506 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+#include "../../spectral/Lanczos/Orthonormalize.hpp"
+
+namespace El {
+
+namespace cond_est {
+
+template<typename Real>
+bool GreaterValue( const ValueInt<Real>& a, const ValueInt<Real>& b )
+{ return a.value > b.value || (a.value == b.value && a.index < b.index); }
+
+// Returns the (up to) 'numCands' global candidates with the largest values,
+// given the local candidates of each process: the first 'numCands' entries of
+// each process's contribution are listed in 'offset=0', the second in '1'
+template<typename Real>
+vector<ValueInt<Real>> TopCandidates
+( const vector<ValueInt<Real>>& allCands, Int numCands, Int offset )
+{
+    EL_DEBUG_CSE
+    vector<ValueInt<Real>> cands;
+    const Int numProcs = allCands.size() / (2*numCands);
+    for( Int q=0; q<numProcs; ++q )
+        for( Int j=0; j<numCands; ++j )
+        {
+            const auto& cand = allCands[(2*q+offset)*numCands+j];
+            if( cand.index >= 0 )
+                cands.push_back( cand );
+        }
+    std::sort( cands.begin(), cands.end(), GreaterValue<Real> );
+    if( Int(cands.size()) > numCands )
+        cands.resize( numCands );
+    return cands;
+}
+
+// The block 1-norm estimator of
+//
+//   N. J. Higham and F. Tisseur, "A block algorithm for matrix 1-norm
+//   estimation, with an application to 1-norm pseudospectra", SIAM J. Matrix
+//   Anal. Appl., 21 (2000), pp. 1185--1201.
+//
+// for an n x n operator whose rows are distributed over 'comm', where
+// 'globalRows' lists the global indices of the local rows and 'applyA' and
+// 'applyAAdj' respectively overwrite the local rows of a block with the
+// result of applying the operator and its adjoint.
+template<typename Field,class ApplyType,class ApplyAdjType>
+Base<Field> OneNormEstimate
+(       Int n,
+  const vector<Int>& globalRows,
+  const ApplyType& applyA,
+  const ApplyAdjType& applyAAdj,
+        mpi::Comm comm,
+        Int blockSize,
+        Int maxIts )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    typedef ValueInt<Real> Candidate;
+    const Int localHeight = globalRows.size();
+    const Int t = Max( Min(blockSize,n), Int(1) );
+    const Int commSize = mpi::Size( comm );
+    if( n == 0 )
+        return Real(0);
+
+    // The first column is the vector of all ones and the remainder are
+    // random sign vectors, all scaled by 1/n
+    Matrix<Field> X, S, SOld, G;
+    X.Resize( localHeight, t );
+    for( Int j=0; j<t; ++j )
+        for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+        {
+            const bool positive = ( j == 0 || SampleUniform<Int>(0,2) == 0 );
+            X(iLoc,j) = ( positive ? Real(1) : Real(-1) ) / Real(n);
+        }
+
+    std::set<Int> visited;
+    vector<Real> colNorms, h(localHeight);
+    vector<Candidate> localCands(2*t), allCands(2*t*commSize),
+      sortedCands(localHeight);
+    vector<Int> indices;
+    Real estimate=0;
+    Int indexBest=-1;
+    for( Int it=0; it<maxIts; ++it )
+    {
+        // Y := A X
+        applyA( X );
+        const Int width = X.Width();
+        colNorms.assign( width, Real(0) );
+        for( Int j=0; j<width; ++j )
+            for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+                colNorms[j] += Abs(X(iLoc,j));
+        mpi::AllReduce( colNorms.data(), width, mpi::SUM, comm );
+        const Int jBest =
+          std::max_element( colNorms.begin(), colNorms.end() ) -
+          colNorms.begin();
+        if( it > 0 && colNorms[jBest] <= estimate )
+            break;
+        estimate = colNorms[jBest];
+        if( it > 0 )
+            indexBest = indices[jBest];
+        if( it == maxIts-1 )
+            break;
+
+        // S := sign(Y)
+        S.Resize( localHeight, width );
+        for( Int j=0; j<width; ++j )
+            for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+            {
+                const Real alpha = Abs(X(iLoc,j));
+                if( IsComplex<Field>::value )
+                    S(iLoc,j) =
+                      ( alpha == Real(0) ? Field(1) : X(iLoc,j)/alpha );
+                else
+                    S(iLoc,j) =
+                      ( RealPart(X(iLoc,j)) >= Real(0) ? 1 : -1 );
+            }
+
+        // In the real case, stop once every column of S is parallel to a
+        // column of the previous S
+        if( !IsComplex<Field>::value && it > 0 )
+        {
+            Zeros( G, width, SOld.Width() );
+            Gemm( ADJOINT, NORMAL, Field(1), S, SOld, Field(0), G );
+            mpi::AllReduce( G.Buffer(), G.Height()*G.Width(), comm );
+            bool allParallel = true;
+            for( Int j=0; j<width; ++j )
+            {
+                bool parallel = false;
+                for( Int jOld=0; jOld<SOld.Width(); ++jOld )
+                    if( Abs(G(j,jOld)) == Real(n) )
+                        parallel = true;
+                allParallel = allParallel && parallel;
+            }
+            if( allParallel )
+                break;
+        }
+        SOld = S;
+
+        // Z := A^H S and h_i := max_j |Z(i,j)|
+        applyAAdj( S );
+        Real hBestLoc = 0;
+        for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+        {
+            h[iLoc] = 0;
+            for( Int j=0; j<width; ++j )
+                h[iLoc] = Max( h[iLoc], Abs(S(iLoc,j)) );
+            sortedCands[iLoc].value = h[iLoc];
+            sortedCands[iLoc].index = globalRows[iLoc];
+            if( globalRows[iLoc] == indexBest )
+                hBestLoc = h[iLoc];
+        }
+        const Real hBest = mpi::AllReduce( hBestLoc, mpi::MAX, comm );
+
+        // Each process contributes its largest t entries of h, followed by
+        // its largest t entries which were not yet visited
+        std::sort
+        ( sortedCands.begin(), sortedCands.end(), GreaterValue<Real> );
+        Candidate padding;
+        padding.value = -1;
+        padding.index = -1;
+        std::fill( localCands.begin(), localCands.end(), padding );
+        for( Int j=0; j<Min(t,localHeight); ++j )
+            localCands[j] = sortedCands[j];
+        Int numUnvisited = 0;
+        for( Int iLoc=0; iLoc<localHeight && numUnvisited<t; ++iLoc )
+            if( !visited.count(sortedCands[iLoc].index) )
+                localCands[t+numUnvisited++] = sortedCands[iLoc];
+        mpi::AllGather
+        ( localCands.data(), 2*t, allCands.data(), 2*t, comm );
+        const auto topCands = TopCandidates( allCands, t, 0 );
+        if( it > 0 && !topCands.empty() && topCands[0].value == hBest )
+            break;
+        bool allVisited = true;
+        for( const auto& cand : topCands )
+            if( !visited.count(cand.index) )
+                allVisited = false;
+        if( allVisited )
+            break;
+
+        // X := [e_{indices[0]}, ..., e_{indices[t-1]}]
+        const auto newCands = TopCandidates( allCands, t, 1 );
+        if( newCands.empty() )
+            break;
+        const Int numNew = newCands.size();
+        indices.resize( numNew );
+        for( Int j=0; j<numNew; ++j )
+        {
+            indices[j] = newCands[j].index;
+            visited.insert( indices[j] );
+        }
+        Zeros( X, localHeight, numNew );
+        for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+            for( Int j=0; j<numNew; ++j )
+                if( globalRows[iLoc] == indices[j] )
+                    X(iLoc,j) = 1;
+    }
+    return estimate;
+}
+
+// Estimates the two-norm of an n x n operator, whose rows are distributed
+// over 'comm', using a randomized subspace iteration on A^H A with the given
+// number of columns. Each half-step orthonormalizes the block, and the
+// estimate ||A Q||_2 = ||R||_2 is a lower bound which increases towards
+// ||A||_2.
+template<typename Field,class ApplyType,class ApplyAdjType>
+Base<Field> TwoNormEstimate
+(       Int n,
+        Int localHeight,
+  const ApplyType& applyA,
+  const ApplyAdjType& applyAAdj,
+        mpi::Comm comm,
+        Int blockSize,
+        Int maxIts,
+        Base<Field> tol,
+        bool progress )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Int s = Max( Min(blockSize,n), Int(1) );
+    if( n == 0 )
+        return Real(0);
+
+    Matrix<Field> X, R;
+    const Matrix<Field> VEmpty( localHeight, 0 );
+    Gaussian( X, localHeight, s );
+    lanczos::Orthonormalize( n, VEmpty, X, R, comm );
+    Real estimate = 0;
+    for( Int it=0; it<maxIts; ++it )
+    {
+        applyA( X );
+        lanczos::Orthonormalize( n, VEmpty, X, R, comm );
+        const Real newEstimate = TwoNorm( R );
+        const bool converged =
+          Abs(newEstimate-estimate) <= tol*newEstimate;
+        estimate = newEstimate;
+        if( progress )
+            OutputFromRoot(comm,"  iteration ",it,": estimate=",estimate);
+        if( converged )
+            break;
+        applyAAdj( X );
+        lanczos::Orthonormalize( n, VEmpty, X, R, comm );
+    }
+    return estimate;
+}
+
+} // namespace cond_est
+
+template<typename Field>
+Base<Field> OneConditionEstimate
+( const Matrix<Field>& A,
+  const ConditionEstimateCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    const Int n = A.Height();
+    if( n != A.Width() )
+        LogicError("A was not square");
+    Matrix<Field> ALU( A );
+    Permutation P;
+    LU( ALU, P );
+
+    vector<Int> globalRows( n );
+    for( Int i=0; i<n; ++i )
+        globalRows[i] = i;
+    auto applyAInv =
+      [&]( Matrix<Field>& X ) { lu::SolveAfter( NORMAL, ALU, P, X ); };
+    auto applyAInvAdj =
+      [&]( Matrix<Field>& X ) { lu::SolveAfter( ADJOINT, ALU, P, X ); };
+    const auto oneNormInv =
+      cond_est::OneNormEstimate<Field>
+      ( n, globalRows, applyAInv, applyAInvAdj, mpi::COMM_SELF,
+        ctrl.blockSize, ctrl.oneNormMaxIts );
+    return OneNorm(A)*oneNormInv;
+}
+
+template<typename Field>
+Base<Field> OneConditionEstimate
+( const AbstractDistMatrix<Field>& A,
+  const ConditionEstimateCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    const Int n = A.Height();
+    if( n != A.Width() )
+        LogicError("A was not square");
+    const Grid& g = A.Grid();
+    DistMatrix<Field> ALU( A );
+    DistPermutation P( g );
+    LU( ALU, P );
+
+    // The blocks are stored as the local rows of [VC,STAR] matrices
+    DistMatrix<Field,VC,STAR> XVC( n, 1, g );
+    DistMatrix<Field> X( g );
+    const Int localHeight = XVC.LocalHeight();
+    vector<Int> globalRows( localHeight );
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+        globalRows[iLoc] = XVC.GlobalRow(iLoc);
+    auto solve =
+      [&]( Orientation orientation, Matrix<Field>& XLoc )
+      {
+          XVC.Resize( n, XLoc.Width() );
+          XVC.Matrix() = XLoc;
+          X = XVC;
+          lu::SolveAfter( orientation, ALU, P, X );
+          XVC = X;
+          XLoc = XVC.LockedMatrix();
+      };
+    auto applyAInv = [&]( Matrix<Field>& XLoc ) { solve( NORMAL, XLoc ); };
+    auto applyAInvAdj =
+      [&]( Matrix<Field>& XLoc ) { solve( ADJOINT, XLoc ); };
+    const auto oneNormInv =
+      cond_est::OneNormEstimate<Field>
+      ( n, globalRows, applyAInv, applyAInvAdj, g.VCComm(),
+        ctrl.blockSize, ctrl.oneNormMaxIts );
+    return OneNorm(A)*oneNormInv;
+}
+
+template<typename Field>
+Base<Field> OneConditionEstimate
+( const SparseMatrix<Field>& A,
+  const ConditionEstimateCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    const Int n = A.Height();
+    if( n != A.Width() )
+        LogicError("A was not square");
+    SparseLDLFactorization<Field> sparseLDLFact;
+    sparseLDLFact.Initialize( A, ctrl.hermitian, ctrl.bisectCtrl );
+    sparseLDLFact.Factor();
+
+    vector<Int> globalRows( n );
+    for( Int i=0; i<n; ++i )
+        globalRows[i] = i;
+    auto applyAInv = [&]( Matrix<Field>& X ) { sparseLDLFact.Solve( X ); };
+    // Since A^H is either A or conj(A), inv(A)^H X = conj(inv(A) conj(X))
+    // in the complex-symmetric case
+    auto applyAInvAdj =
+      [&]( Matrix<Field>& X )
+      {
+          if( !ctrl.hermitian )
+              Conjugate( X );
+          sparseLDLFact.Solve( X );
+          if( !ctrl.hermitian )
+              Conjugate( X );
+      };
+    const auto oneNormInv =
+      cond_est::OneNormEstimate<Field>
+      ( n, globalRows, applyAInv, applyAInvAdj, mpi::COMM_SELF,
+        ctrl.blockSize, ctrl.oneNormMaxIts );
+    return OneNorm(A)*oneNormInv;
+}
+
+template<typename Field>
+Base<Field> OneConditionEstimate
+( const DistSparseMatrix<Field>& A,
+  const ConditionEstimateCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    const Int n = A.Height();
+    if( n != A.Width() )
+        LogicError("A was not square");
+    const Grid& grid = A.Grid();
+    DistSparseLDLFactorization<Field> sparseLDLFact;
+    sparseLDLFact.Initialize( A, ctrl.hermitian, ctrl.bisectCtrl );
+    sparseLDLFact.Factor();
+
+    DistMultiVec<Field> X( n, 1, grid );
+    const Int localHeight = X.LocalHeight();
+    vector<Int> globalRows( localHeight );
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+        globalRows[iLoc] = X.GlobalRow(iLoc);
+    auto applyAInv =
+      [&]( Matrix<Field>& XLoc )
+      {
+          X.Resize( n, XLoc.Width() );
+          X.Matrix() = XLoc;
+          sparseLDLFact.Solve( X );
+          XLoc = X.LockedMatrix();
+      };
+    auto applyAInvAdj =
+      [&]( Matrix<Field>& XLoc )
+      {
+          if( !ctrl.hermitian )
+              Conjugate( XLoc );
+          applyAInv( XLoc );
+          if( !ctrl.hermitian )
+              Conjugate( XLoc );
+      };
+    const auto oneNormInv =
+      cond_est::OneNormEstimate<Field>
+      ( n, globalRows, applyAInv, applyAInvAdj, grid.Comm(),
+        ctrl.blockSize, ctrl.oneNormMaxIts );
+    return OneNorm(A)*oneNormInv;
+}
+
+template<typename Field>
+Base<Field> TwoConditionEstimate
+( const SparseMatrix<Field>& A,
+  const ConditionEstimateCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    const Int n = A.Height();
+    if( n != A.Width() )
+        LogicError("A was not square");
+    SparseLDLFactorization<Field> sparseLDLFact;
+    sparseLDLFact.Initialize( A, ctrl.hermitian, ctrl.bisectCtrl );
+    sparseLDLFact.Factor();
+
+    auto applyAInv = [&]( Matrix<Field>& X ) { sparseLDLFact.Solve( X ); };
+    auto applyAInvAdj =
+      [&]( Matrix<Field>& X )
+      {
+          if( !ctrl.hermitian )
+              Conjugate( X );
+          sparseLDLFact.Solve( X );
+          if( !ctrl.hermitian )
+              Conjugate( X );
+      };
+    const auto twoNormInv =
+      cond_est::TwoNormEstimate<Field>
+      ( n, n, applyAInv, applyAInvAdj, mpi::COMM_SELF, ctrl.blockSize,
+        ctrl.twoNormMaxIts, ctrl.twoNormTol, ctrl.progress );
+    const auto twoNorm =
+      ( ctrl.hermitian ? HermitianTwoNormEstimate( A, ctrl.basisSize )
+                       : TwoNormEstimate( A, ctrl.basisSize ) );
+    return twoNorm*twoNormInv;
+}
+
+template<typename Field>
+Base<Field> TwoConditionEstimate
+( const DistSparseMatrix<Field>& A,
+  const ConditionEstimateCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    const Int n = A.Height();
+    if( n != A.Width() )
+        LogicError("A was not square");
+    const Grid& grid = A.Grid();
+    DistSparseLDLFactorization<Field> sparseLDLFact;
+    sparseLDLFact.Initialize( A, ctrl.hermitian, ctrl.bisectCtrl );
+    sparseLDLFact.Factor();
+
+    DistMultiVec<Field> X( n, 1, grid );
+    const Int localHeight = X.LocalHeight();
+    auto applyAInv =
+      [&]( Matrix<Field>& XLoc )
+      {
+          X.Resize( n, XLoc.Width() );
+          X.Matrix() = XLoc;
+          sparseLDLFact.Solve( X );
+          XLoc = X.LockedMatrix();
+      };
+    auto applyAInvAdj =
+      [&]( Matrix<Field>& XLoc )
+      {
+          if( !ctrl.hermitian )
+              Conjugate( XLoc );
+          applyAInv( XLoc );
+          if( !ctrl.hermitian )
+              Conjugate( XLoc );
+      };
+    const auto twoNormInv =
+      cond_est::TwoNormEstimate<Field>
+      ( n, localHeight, applyAInv, applyAInvAdj, grid.Comm(),
+        ctrl.blockSize, ctrl.twoNormMaxIts, ctrl.twoNormTol,
+        ctrl.progress );
+    const auto twoNorm =
+      ( ctrl.hermitian ? HermitianTwoNormEstimate( A, ctrl.basisSize )
+                       : TwoNormEstimate( A, ctrl.basisSize ) );
+    return twoNorm*twoNormInv;
+}
+
+#define PROTO(Field) \
+  template Base<Field> OneConditionEstimate \
+  ( const Matrix<Field>& A, \
+    const ConditionEstimateCtrl<Base<Field>>& ctrl ); \
+  template Base<Field> OneConditionEstimate \
+  ( const AbstractDistMatrix<Field>& A, \
+    const ConditionEstimateCtrl<Base<Field>>& ctrl ); \
+  template Base<Field> OneConditionEstimate \
+  ( const SparseMatrix<Field>& A, \
+    const ConditionEstimateCtrl<Base<Field>>& ctrl ); \
+  template Base<Field> OneConditionEstimate \
+  ( const DistSparseMatrix<Field>& A, \
+    const ConditionEstimateCtrl<Base<Field>>& ctrl ); \
+  template Base<Field> TwoConditionEstimate \
+  ( const SparseMatrix<Field>& A, \
+    const ConditionEstimateCtrl<Base<Field>>& ctrl ); \
+  template Base<Field> TwoConditionEstimate \
+  ( const DistSparseMatrix<Field>& A, \
+    const ConditionEstimateCtrl<Base<Field>>& ctrl );
+
+#define EL_NO_INT_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
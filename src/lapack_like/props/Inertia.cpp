@@ -44,6 +44,147 @@ InertiaType Inertia
     return ldl::Inertia( GetRealPartOfDiagonal(A), dSub );
 }
 
+namespace ldl {
+
+namespace {
+
+void Accumulate( InertiaType& inertia, const InertiaType& update )
+{
+    inertia.numPositive += update.numPositive;
+    inertia.numNegative += update.numNegative;
+    inertia.numZero += update.numZero;
+}
+
+template<typename Real>
+void CountSigns( const Matrix<Real>& d, InertiaType& inertia )
+{
+    const Int n = d.Height();
+    for( Int i=0; i<n; ++i )
+    {
+        if( d(i) > Real(0) )
+            ++inertia.numPositive;
+        else if( d(i) < Real(0) )
+            ++inertia.numNegative;
+        else
+            ++inertia.numZero;
+    }
+}
+
+void CheckFrontType( LDLFrontType type )
+{
+    if( Unfactored(type) )
+        LogicError("The sparse LDL factorization has not been computed");
+    if( BlockFactorization(type) )
+        LogicError("Block LDL factorizations do not store D");
+}
+
+template<typename Field>
+void FrontInertia( const Front<Field>& front, InertiaType& inertia )
+{
+    EL_DEBUG_CSE
+    for( const auto& child : front.children )
+        FrontInertia( *child, inertia );
+
+    CheckFrontType( front.type );
+    Matrix<Base<Field>> d;
+    RealPart( front.diag, d );
+    if( PivotedFactorization(front.type) )
+        Accumulate( inertia, Inertia( d, front.subdiag ) );
+    else
+        CountSigns( d, inertia );
+}
+
+// Returns the contribution of this process, which must be summed over the
+// communicator of the root front
+template<typename Field>
+void FrontInertia( const DistFront<Field>& front, InertiaType& inertia )
+{
+    EL_DEBUG_CSE
+    if( front.child == nullptr )
+    {
+        // The diagonal of this front is shared with the sequential duplicate
+        FrontInertia( *front.duplicate, inertia );
+        return;
+    }
+    FrontInertia( *front.child, inertia );
+
+    CheckFrontType( front.type );
+    const Grid& grid = front.diag.Grid();
+    if( PivotedFactorization(front.type) )
+    {
+        DistMatrix<Base<Field>,VC,STAR> d(grid);
+        RealPart( front.diag, d );
+        const InertiaType frontInertia = Inertia( d, front.subdiag );
+        if( grid.Rank() == 0 )
+            Accumulate( inertia, frontInertia );
+    }
+    else
+    {
+        // Each entry of a [VC,STAR] matrix is owned by exactly one process
+        Matrix<Base<Field>> dLoc;
+        RealPart( front.diag.LockedMatrix(), dLoc );
+        CountSigns( dLoc, inertia );
+    }
+}
+
+} // anonymous namespace
+
+template<typename Field>
+InertiaType Inertia( const SparseLDLFactorization<Field>& factorization )
+{
+    EL_DEBUG_CSE
+    if( !factorization.Factored() )
+        LogicError("The sparse LDL factorization has not been computed");
+    InertiaType inertia;
+    inertia.numPositive = inertia.numNegative = inertia.numZero = 0;
+    FrontInertia( factorization.Front(), inertia );
+    return inertia;
+}
+
+template<typename Field>
+InertiaType Inertia( const DistSparseLDLFactorization<Field>& factorization )
+{
+    EL_DEBUG_CSE
+    if( !factorization.Factored() )
+        LogicError("The sparse LDL factorization has not been computed");
+    const ldl::DistFront<Field>& front = factorization.Front();
+    InertiaType inertia;
+    inertia.numPositive = inertia.numNegative = inertia.numZero = 0;
+    FrontInertia( front, inertia );
+
+    Int counts[3] = { inertia.numPositive, inertia.numNegative,
+                      inertia.numZero };
+    mpi::AllReduce( counts, 3, front.diag.Grid().Comm() );
+    inertia.numPositive = counts[0];
+    inertia.numNegative = counts[1];
+    inertia.numZero = counts[2];
+    return inertia;
+}
+
+} // namespace ldl
+
+template<typename Field>
+InertiaType Inertia( const SparseMatrix<Field>& A, const BisectCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    const bool hermitian = true;
+    SparseLDLFactorization<Field> factorization;
+    factorization.Initialize( A, hermitian, ctrl );
+    factorization.Factor( LDL_2D );
+    return ldl::Inertia( factorization );
+}
+
+template<typename Field>
+InertiaType Inertia( const DistSparseMatrix<Field>& A, const BisectCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    const bool hermitian = true;
+    DistSparseLDLFactorization<Field> factorization;
+    factorization.Initialize( A, hermitian, ctrl );
+    factorization.Factor( LDL_2D );
+    return ldl::Inertia( factorization );
+}
+
 #define PROTO(Field) \
   template InertiaType Inertia \
   ( UpperOrLower uplo, \
@@ -52,7 +193,15 @@ InertiaType Inertia
   template InertiaType Inertia \
   ( UpperOrLower uplo, \
     AbstractDistMatrix<Field>& A, \
-    const LDLPivotCtrl<Base<Field>>& ctrl );
+    const LDLPivotCtrl<Base<Field>>& ctrl ); \
+  template InertiaType ldl::Inertia \
+  ( const SparseLDLFactorization<Field>& factorization ); \
+  template InertiaType ldl::Inertia \
+  ( const DistSparseLDLFactorization<Field>& factorization ); \
+  template InertiaType Inertia \
+  ( const SparseMatrix<Field>& A, const BisectCtrl& ctrl ); \
+  template InertiaType Inertia \
+  ( const DistSparseMatrix<Field>& A, const BisectCtrl& ctrl );
 
 #define EL_NO_INT_PROTO
 #define EL_ENABLE_DOUBLEDOUBLE
@@ -0,0 +1,341 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+namespace El {
+
+namespace trace_est {
+
+// Returns e_0^T f(T) e_0 for the symmetric tridiagonal T with diagonal
+// 'alpha[0:k]' and sub-diagonal 'beta[1:k]', i.e., the sum of the products of
+// f at the Ritz values with the squares of the leading entries of the Ritz
+// vectors
+template<typename Real>
+Real Quadrature
+( const vector<Real>& alpha,
+  const vector<Real>& beta,
+        Int k,
+  const function<Real(const Real&)>& func )
+{
+    EL_DEBUG_CSE
+    Matrix<Real> d( k, 1 ), e( k-1, 1 ), w, Z;
+    for( Int j=0; j<k; ++j )
+        d(j) = alpha[j];
+    for( Int j=0; j<k-1; ++j )
+        e(j) = beta[j+1];
+    HermitianTridiagEig( d, e, w, Z );
+    Real quad = 0;
+    for( Int l=0; l<k; ++l )
+        quad += Z(0,l)*Z(0,l)*func(w(l));
+    return quad;
+}
+
+// Approximates z^H f(A) z for each column z of the block whose local rows are
+// 'ZLoc' by running an independent Lanczos recurrence from each column. The
+// active recurrences share a single application of A per step, and their
+// inner products and norms are each combined with a single reduction.
+template<typename Field,class ApplyType>
+void ProbeQuadratures
+(       Int n,
+  const ApplyType& applyA,
+        mpi::Comm comm,
+  const function<Base<Field>(const Base<Field>&)>& func,
+  const Matrix<Field>& ZLoc,
+        vector<Base<Field>>& quads,
+  const TraceEstimateCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Int localHeight = ZLoc.Height();
+    const Int numProbes = ZLoc.Width();
+    const Real eps = limits::Epsilon<Real>();
+    const Real quadTol = ( ctrl.quadTol > Real(0) ? ctrl.quadTol : Sqrt(eps) );
+    const Int maxSteps = Max( Min(ctrl.maxSteps,n), Int(1) );
+    const Int checkInterval = Max( ctrl.checkInterval, Int(1) );
+
+    vector<Real> normSquared( numProbes );
+    for( Int c=0; c<numProbes; ++c )
+    {
+        const Real localNorm =
+          blas::Nrm2( localHeight, ZLoc.LockedBuffer(0,c), 1 );
+        normSquared[c] = localNorm*localNorm;
+    }
+    mpi::AllReduce( normSquared.data(), numProbes, mpi::SUM, comm );
+
+    quads.assign( numProbes, Real(0) );
+    vector<vector<Real>> alpha(numProbes), beta(numProbes);
+    vector<Int> numSteps(numProbes,0), active;
+    Matrix<Field> VPrev, VCur, W;
+    Zeros( VPrev, localHeight, numProbes );
+    VCur = ZLoc;
+    for( Int c=0; c<numProbes; ++c )
+    {
+        if( normSquared[c] == Real(0) )
+            continue;
+        beta[c].push_back( Real(0) );
+        auto vCur = VCur( ALL, IR(c) );
+        Scale( Real(1)/Sqrt(normSquared[c]), vCur );
+        active.push_back( c );
+    }
+
+    vector<Real> dots, norms;
+    while( !active.empty() )
+    {
+        const Int numActive = active.size();
+        W.Resize( localHeight, numActive );
+        for( Int a=0; a<numActive; ++a )
+            MemCopy
+            ( W.Buffer(0,a), VCur.LockedBuffer(0,active[a]), localHeight );
+        applyA( W );
+
+        // alpha_j = v_j^H A v_j
+        dots.resize( numActive );
+        for( Int a=0; a<numActive; ++a )
+            dots[a] =
+              RealPart(blas::Dotc
+              (localHeight,VCur.LockedBuffer(0,active[a]),1,
+               W.LockedBuffer(0,a),1));
+        mpi::AllReduce( dots.data(), numActive, mpi::SUM, comm );
+
+        // w := A v_j - alpha_j v_j - beta_j v_{j-1}
+        norms.resize( numActive );
+        for( Int a=0; a<numActive; ++a )
+        {
+            const Int c = active[a];
+            alpha[c].push_back( dots[a] );
+            Field* w = W.Buffer(0,a);
+            const Field* vCur = VCur.LockedBuffer(0,c);
+            const Field* vPrev = VPrev.LockedBuffer(0,c);
+            const Real alphaj = dots[a], betaj = beta[c].back();
+            for( Int i=0; i<localHeight; ++i )
+                w[i] -= alphaj*vCur[i] + betaj*vPrev[i];
+            const Real localNorm = blas::Nrm2( localHeight, w, 1 );
+            norms[a] = localNorm*localNorm;
+        }
+        mpi::AllReduce( norms.data(), numActive, mpi::SUM, comm );
+
+        vector<Int> stillActive;
+        for( Int a=0; a<numActive; ++a )
+        {
+            const Int c = active[a];
+            const Int k = ++numSteps[c];
+            const Real betaNext = Sqrt(norms[a]);
+            const Real normEst = Abs(alpha[c].back()) + beta[c].back();
+            const bool breakdown = betaNext <= eps*normEst || k == maxSteps;
+            if( breakdown || k % checkInterval == 0 )
+            {
+                const Real quad =
+                  normSquared[c]*Quadrature( alpha[c], beta[c], k, func );
+                const bool converged =
+                  Abs(quad-quads[c]) <= quadTol*Abs(quad);
+                quads[c] = quad;
+                if( breakdown || converged )
+                    continue;
+            }
+
+            beta[c].push_back( betaNext );
+            Field* vPrev = VPrev.Buffer(0,c);
+            Field* vCur = VCur.Buffer(0,c);
+            const Field* w = W.LockedBuffer(0,a);
+            for( Int i=0; i<localHeight; ++i )
+            {
+                vPrev[i] = vCur[i];
+                vCur[i] = w[i]/betaNext;
+            }
+            stillActive.push_back( c );
+        }
+        active.swap( stillActive );
+    }
+}
+
+// Averages the probe quadratures, in blocks drawn by 'drawProbes', until the
+// standard error of the mean is sufficiently small
+template<typename Field,class ApplyType,class DrawType>
+Base<Field> Hutchinson
+(       Int n,
+  const ApplyType& applyA,
+  const DrawType& drawProbes,
+        mpi::Comm comm,
+  const function<Base<Field>(const Base<Field>&)>& func,
+  const TraceEstimateCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Int blockSize = Max( ctrl.blockSize, Int(1) );
+    const Int maxProbes = Max( ctrl.maxProbes, Int(1) );
+
+    Matrix<Field> ZLoc;
+    vector<Real> quads;
+    Real sum=0, sumSquares=0;
+    Int numSamples = 0;
+    while( numSamples < maxProbes )
+    {
+        const Int numProbes = Min( blockSize, maxProbes-numSamples );
+        drawProbes( ZLoc, numProbes );
+        ProbeQuadratures( n, applyA, comm, func, ZLoc, quads, ctrl );
+        for( const Real& quad : quads )
+        {
+            sum += quad;
+            sumSquares += quad*quad;
+        }
+        numSamples += numProbes;
+        if( numSamples == 1 )
+            continue;
+
+        const Real mean = sum / numSamples;
+        const Real variance =
+          Max( sumSquares-numSamples*mean*mean, Real(0) ) / (numSamples-1);
+        const Real stdError = Sqrt(variance/numSamples);
+        if( ctrl.progress )
+            OutputFromRoot
+            (comm,"  ",numSamples," probes: estimate=",mean,
+             ", standard error=",stdError);
+        if( stdError <= ctrl.relTol*Abs(mean) )
+            break;
+    }
+    return sum / numSamples;
+}
+
+} // namespace trace_est
+
+template<typename F>
+Base<F> HermitianTraceEstimate
+( const SparseMatrix<F>& A,
+  function<Base<F>(const Base<F>&)> func,
+  const TraceEstimateCtrl<Base<F>>& ctrl )
+{
+    EL_DEBUG_CSE
+    const Int n = A.Height();
+    if( n != A.Width() )
+        LogicError("A was not square");
+    if( n == 0 )
+        return 0;
+
+    Matrix<F> Y;
+    auto applyA =
+      [&]( Matrix<F>& V )
+      {
+          Zeros( Y, n, V.Width() );
+          Multiply( NORMAL, F(1), A, V, F(0), Y );
+          V = Y;
+      };
+    auto drawProbes =
+      [&]( Matrix<F>& ZLoc, Int numProbes )
+      { Rademacher( ZLoc, n, numProbes ); };
+    return trace_est::Hutchinson<F>
+      ( n, applyA, drawProbes, mpi::COMM_SELF, func, ctrl );
+}
+
+template<typename F>
+Base<F> HermitianTraceEstimate
+( const DistSparseMatrix<F>& A,
+  function<Base<F>(const Base<F>&)> func,
+  const TraceEstimateCtrl<Base<F>>& ctrl )
+{
+    EL_DEBUG_CSE
+    const Int n = A.Height();
+    if( n != A.Width() )
+        LogicError("A was not square");
+    if( n == 0 )
+        return 0;
+    const Grid& grid = A.Grid();
+
+    DistMultiVec<F> V(grid), Y(grid);
+    auto applyA =
+      [&]( Matrix<F>& VLoc )
+      {
+          V.Resize( n, VLoc.Width() );
+          V.Matrix() = VLoc;
+          Zeros( Y, n, VLoc.Width() );
+          Multiply( NORMAL, F(1), A, V, F(0), Y );
+          VLoc = Y.LockedMatrix();
+      };
+    // The probes are drawn from the parallel generator so that each process
+    // only samples its own rows
+    DistMultiVec<F> Z(grid);
+    auto drawProbes =
+      [&]( Matrix<F>& ZLoc, Int numProbes )
+      {
+          Rademacher( Z, n, numProbes );
+          ZLoc = Z.LockedMatrix();
+      };
+    return trace_est::Hutchinson<F>
+      ( n, applyA, drawProbes, grid.Comm(), func, ctrl );
+}
+
+template<typename F>
+Base<F> HPDLogDetEstimate
+( const SparseMatrix<F>& A, const TraceEstimateCtrl<Base<F>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    auto logFunc = []( const Real& alpha ) { return Log(alpha); };
+    return HermitianTraceEstimate( A, function<Real(const Real&)>(logFunc),
+                                   ctrl );
+}
+
+template<typename F>
+Base<F> HPDLogDetEstimate
+( const DistSparseMatrix<F>& A, const TraceEstimateCtrl<Base<F>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    auto logFunc = []( const Real& alpha ) { return Log(alpha); };
+    return HermitianTraceEstimate( A, function<Real(const Real&)>(logFunc),
+                                   ctrl );
+}
+
+template<typename F>
+Base<F> HPDInverseTraceEstimate
+( const SparseMatrix<F>& A, const TraceEstimateCtrl<Base<F>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    auto invFunc = []( const Real& alpha ) { return Real(1)/alpha; };
+    return HermitianTraceEstimate( A, function<Real(const Real&)>(invFunc),
+                                   ctrl );
+}
+
+template<typename F>
+Base<F> HPDInverseTraceEstimate
+( const DistSparseMatrix<F>& A, const TraceEstimateCtrl<Base<F>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    auto invFunc = []( const Real& alpha ) { return Real(1)/alpha; };
+    return HermitianTraceEstimate( A, function<Real(const Real&)>(invFunc),
+                                   ctrl );
+}
+
+#define PROTO(F) \
+  template Base<F> HermitianTraceEstimate \
+  ( const SparseMatrix<F>& A, \
+    function<Base<F>(const Base<F>&)> func, \
+    const TraceEstimateCtrl<Base<F>>& ctrl ); \
+  template Base<F> HermitianTraceEstimate \
+  ( const DistSparseMatrix<F>& A, \
+    function<Base<F>(const Base<F>&)> func, \
+    const TraceEstimateCtrl<Base<F>>& ctrl ); \
+  template Base<F> HPDLogDetEstimate \
+  ( const SparseMatrix<F>& A, const TraceEstimateCtrl<Base<F>>& ctrl ); \
+  template Base<F> HPDLogDetEstimate \
+  ( const DistSparseMatrix<F>& A, const TraceEstimateCtrl<Base<F>>& ctrl ); \
+  template Base<F> HPDInverseTraceEstimate \
+  ( const SparseMatrix<F>& A, const TraceEstimateCtrl<Base<F>>& ctrl ); \
+  template Base<F> HPDInverseTraceEstimate \
+  ( const DistSparseMatrix<F>& A, const TraceEstimateCtrl<Base<F>>& ctrl );
+
+#define EL_NO_INT_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
@@ -186,6 +186,93 @@ void ApplyPackedReflectors
     }
 }
 
+template<typename F>
+void FormCompactWY( Int offset, const Matrix<F>& H, CompactWY<F>& wy )
+{
+    EL_DEBUG_CSE
+    const Int m = H.Height();
+    const Int diagLength = H.DiagonalLength(offset);
+    const Int iOff = ( offset>=0 ? 0      : -offset );
+    const Int jOff = ( offset>=0 ? offset : 0       );
+
+    const Int bsize = Blocksize();
+    wy.offset = offset;
+    wy.blocksize = bsize;
+    wy.panelGrams.resize( (diagLength+bsize-1)/bsize );
+    Matrix<F> HPanCopy;
+    for( Int k=0; k<diagLength; k+=bsize )
+    {
+        const Int nb = Min(bsize,diagLength-k);
+        const Int ki = k+iOff;
+        const Int kj = k+jOff;
+
+        // Convert to an explicit matrix of (scaled) Householder vectors
+        auto HPan = H( IR(ki,m), IR(kj,kj+nb) );
+        HPanCopy = HPan;
+        MakeTrapezoidal( LOWER, HPanCopy );
+        FillDiagonal( HPanCopy, F(1) );
+
+        auto& G = wy.panelGrams[k/bsize];
+        Herk( LOWER, ADJOINT, Base<F>(1), HPanCopy, G );
+        MakeHermitian( LOWER, G );
+    }
+}
+
+template<typename F>
+void ApplyPackedReflectors
+( LeftOrRight side, UpperOrLower uplo,
+  VerticalOrHorizontal dir, ForwardOrBackward order,
+  Conjugation conjugation,
+  Int offset,
+  const Matrix<F>& H,
+  const Matrix<F>& householderScalars,
+  const CompactWY<F>& wy,
+        Matrix<F>& A )
+{
+    EL_DEBUG_CSE
+    if( wy.blocksize == 0 )
+    {
+        ApplyPackedReflectors
+        ( side, uplo, dir, order, conjugation, offset,
+          H, householderScalars, A );
+        return;
+    }
+    if( uplo != LOWER || dir != VERTICAL )
+        LogicError
+        ("Precomputed compact-WY factors are only supported for lower, "
+         "vertical reflectors");
+    if( wy.offset != offset )
+        LogicError
+        ("The compact-WY factors were formed for offset ",wy.offset,
+         " rather than ",offset);
+    EL_DEBUG_ONLY(
+      const Int diagLength = H.DiagonalLength(offset);
+      const Int numPanels = (diagLength+wy.blocksize-1) / wy.blocksize;
+      if( Int(wy.panelGrams.size()) != numPanels )
+          LogicError
+          ("Expected ",numPanels," compact-WY panels but there were ",
+           wy.panelGrams.size());
+    )
+    if( side == LEFT )
+    {
+        if( order == FORWARD )
+            apply_packed_reflectors::LLVF
+            ( conjugation, offset, H, householderScalars, A, &wy );
+        else
+            apply_packed_reflectors::LLVB
+            ( conjugation, offset, H, householderScalars, A, &wy );
+    }
+    else
+    {
+        if( order == FORWARD )
+            apply_packed_reflectors::RLVF
+            ( conjugation, offset, H, householderScalars, A, &wy );
+        else
+            apply_packed_reflectors::RLVB
+            ( conjugation, offset, H, householderScalars, A, &wy );
+    }
+}
+
 #define PROTO(F) \
   template void ApplyPackedReflectors \
   ( LeftOrRight side, UpperOrLower uplo, \
@@ -200,7 +287,17 @@ void ApplyPackedReflectors
     Conjugation conjugation, Int offset, \
     const AbstractDistMatrix<F>& H, \
     const AbstractDistMatrix<F>& householderScalars, \
-          AbstractDistMatrix<F>& A );
+          AbstractDistMatrix<F>& A ); \
+  template void FormCompactWY \
+  ( Int offset, const Matrix<F>& H, CompactWY<F>& wy ); \
+  template void ApplyPackedReflectors \
+  ( LeftOrRight side, UpperOrLower uplo, \
+    VerticalOrHorizontal dir, ForwardOrBackward order, \
+    Conjugation conjugation, Int offset, \
+    const Matrix<F>& H, \
+    const Matrix<F>& householderScalars, \
+    const CompactWY<F>& wy, \
+          Matrix<F>& A );
 
 #define EL_NO_INT_PROTO
 #define EL_ENABLE_DOUBLEDOUBLE
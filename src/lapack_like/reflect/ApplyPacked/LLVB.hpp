@@ -83,7 +83,8 @@ void LLVBBlocked
   Int offset, 
   const Matrix<F>& H,
   const Matrix<F>& householderScalars,
-        Matrix<F>& A )
+        Matrix<F>& A,
+  const CompactWY<F>* wy=nullptr )
 {
     EL_DEBUG_CSE
     EL_DEBUG_ONLY(
@@ -102,7 +103,7 @@ void LLVBBlocked
     const Int iOff = ( offset>=0 ? 0      : -offset );
     const Int jOff = ( offset>=0 ? offset : 0       );
 
-    const Int bsize = Blocksize();
+    const Int bsize = ( wy == nullptr ? Blocksize() : wy->blocksize );
     const Int kLast = LastOffset( diagLength, bsize );
     for( Int k=kLast; k>=0; k-=bsize )
     {
@@ -120,8 +121,9 @@ void LLVBBlocked
         FillDiagonal( HPanCopy, F(1) );
 
         // Form the small triangular matrix needed for the UT transform
-        Herk( UPPER, ADJOINT, Base<F>(1), HPanCopy, SInv );
-        FixDiagonal( conjugation, householderScalars1, SInv );
+        FormTriangularFactor
+        ( UPPER, conjugation, HPanCopy, householderScalars1, wy, k/bsize,
+          SInv );
 
         // Z := HPan' ABot
         Gemm( ADJOINT, NORMAL, F(1), HPanCopy, ABot, Z );
@@ -138,18 +140,19 @@ void LLVB
   Int offset, 
   const Matrix<F>& H,
   const Matrix<F>& householderScalars,
-        Matrix<F>& A )
+        Matrix<F>& A,
+  const CompactWY<F>* wy=nullptr )
 {
     EL_DEBUG_CSE
     const Int numRHS = A.Width();
     const Int blocksize = Blocksize();
-    if( numRHS < blocksize )
+    if( wy == nullptr && numRHS < blocksize )
     {
         LLVBUnblocked( conjugation, offset, H, householderScalars, A );
     }
     else
     {
-        LLVBBlocked( conjugation, offset, H, householderScalars, A );
+        LLVBBlocked( conjugation, offset, H, householderScalars, A, wy );
     }
 }
 
@@ -83,7 +83,8 @@ void LLVFBlocked
   Int offset,
   const Matrix<F>& H,
   const Matrix<F>& householderScalars,
-        Matrix<F>& A )
+        Matrix<F>& A,
+  const CompactWY<F>* wy=nullptr )
 {
     EL_DEBUG_CSE
     EL_DEBUG_ONLY(
@@ -102,7 +103,7 @@ void LLVFBlocked
     const Int iOff = ( offset>=0 ? 0      : -offset );
     const Int jOff = ( offset>=0 ? offset : 0       );
 
-    const Int bsize = Blocksize();
+    const Int bsize = ( wy == nullptr ? Blocksize() : wy->blocksize );
     for( Int k=0; k<diagLength; k+=bsize )
     {
         const Int nb = Min(bsize,diagLength-k);
@@ -119,8 +120,9 @@ void LLVFBlocked
         FillDiagonal( HPanCopy, F(1) );
 
         // Form the small triangular matrix needed for the UT transform
-        Herk( LOWER, ADJOINT, Base<F>(1), HPanCopy, SInv );
-        FixDiagonal( conjugation, householderScalars1, SInv );
+        FormTriangularFactor
+        ( LOWER, conjugation, HPanCopy, householderScalars1, wy, k/bsize,
+          SInv );
 
         // Z := HPan' ABot
         Gemm( ADJOINT, NORMAL, F(1), HPanCopy, ABot, Z );
@@ -137,18 +139,21 @@ void LLVF
   Int offset,
   const Matrix<F>& H,
   const Matrix<F>& householderScalars,
-        Matrix<F>& A )
+        Matrix<F>& A,
+  const CompactWY<F>* wy=nullptr )
 {
     EL_DEBUG_CSE
     const Int numRHS = A.Width();
     const Int blocksize = Blocksize(); 
-    if( numRHS < blocksize )
+    // Precomputed triangular factors remove the main overhead of the blocked
+    // algorithm for small numbers of right-hand sides
+    if( wy == nullptr && numRHS < blocksize )
     {
         LLVFUnblocked( conjugation, offset, H, householderScalars, A );
     }
     else
     {
-        LLVFBlocked( conjugation, offset, H, householderScalars, A );
+        LLVFBlocked( conjugation, offset, H, householderScalars, A, wy );
     }
 }
 
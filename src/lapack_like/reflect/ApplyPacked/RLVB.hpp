@@ -85,7 +85,8 @@ RLVBBlocked
   Int offset,
   const Matrix<F>& H,
   const Matrix<F>& householderScalars,
-        Matrix<F>& A )
+        Matrix<F>& A,
+  const CompactWY<F>* wy=nullptr )
 {
     EL_DEBUG_CSE
     EL_DEBUG_ONLY(
@@ -104,7 +105,7 @@ RLVBBlocked
     const Int iOff = ( offset>=0 ? 0      : -offset );
     const Int jOff = ( offset>=0 ? offset : 0       );
 
-    const Int bsize = Blocksize();
+    const Int bsize = ( wy == nullptr ? Blocksize() : wy->blocksize );
     const Int kLast = LastOffset( diagLength, bsize );
     for( Int k=kLast; k>=0; k-=bsize )
     {
@@ -122,8 +123,9 @@ RLVBBlocked
         FillDiagonal( HPanCopy, F(1) );
 
         // Form the small triangular matrix needed for the UT transform
-        Herk( LOWER, ADJOINT, Base<F>(1), HPanCopy, SInv );
-        FixDiagonal( conjugation, householderScalars1, SInv );
+        FormTriangularFactor
+        ( LOWER, conjugation, HPanCopy, householderScalars1, wy, k/bsize,
+          SInv );
 
         // Z := ARight HPan
         Gemm( NORMAL, NORMAL, F(1), ARight, HPanCopy, Z );
@@ -141,18 +143,19 @@ RLVB
   Int offset,
   const Matrix<F>& H,
   const Matrix<F>& householderScalars,
-        Matrix<F>& A )
+        Matrix<F>& A,
+  const CompactWY<F>* wy=nullptr )
 {
     EL_DEBUG_CSE
     const Int numLHS = A.Height();
     const Int blocksize = Blocksize();
-    if( numLHS < blocksize )
+    if( wy == nullptr && numLHS < blocksize )
     {
         RLVBUnblocked( conjugation, offset, H, householderScalars, A );
     }
     else
     {
-        RLVBBlocked( conjugation, offset, H, householderScalars, A );
+        RLVBBlocked( conjugation, offset, H, householderScalars, A, wy );
     }
 }
 
@@ -85,7 +85,8 @@ RLVFBlocked
   Int offset,
   const Matrix<F>& H,
   const Matrix<F>& householderScalars,
-        Matrix<F>& A )
+        Matrix<F>& A,
+  const CompactWY<F>* wy=nullptr )
 {
     EL_DEBUG_CSE
     EL_DEBUG_ONLY(
@@ -104,7 +105,7 @@ RLVFBlocked
     const Int iOff = ( offset>=0 ? 0      : -offset );
     const Int jOff = ( offset>=0 ? offset : 0       );
 
-    const Int bsize = Blocksize();
+    const Int bsize = ( wy == nullptr ? Blocksize() : wy->blocksize );
     for( Int k=0; k<diagLength; k+=bsize )
     {
         const Int nb = Min(bsize,diagLength-k);
@@ -121,8 +122,9 @@ RLVFBlocked
         FillDiagonal( HPanCopy, F(1) );
 
         // Form the small triangular matrix needed for the UT transform
-        Herk( UPPER, ADJOINT, Base<F>(1), HPanCopy, SInv );
-        FixDiagonal( conjugation, householderScalars1, SInv );
+        FormTriangularFactor
+        ( UPPER, conjugation, HPanCopy, householderScalars1, wy, k/bsize,
+          SInv );
 
         // Z := ARight HPan
         Gemm( NORMAL, NORMAL, F(1), ARight, HPanCopy, Z );
@@ -140,18 +142,19 @@ RLVF
   Int offset,
   const Matrix<F>& H,
   const Matrix<F>& householderScalars,
-        Matrix<F>& A )
+        Matrix<F>& A,
+  const CompactWY<F>* wy=nullptr )
 {
     EL_DEBUG_CSE
     const Int numLHS = A.Height();
     const Int blocksize = Blocksize();
-    if( numLHS < blocksize )
+    if( wy == nullptr && numLHS < blocksize )
     {
         RLVFUnblocked( conjugation, offset, H, householderScalars, A );
     }
     else
     {
-        RLVFBlocked( conjugation, offset, H, householderScalars, A );
+        RLVFBlocked( conjugation, offset, H, householderScalars, A, wy );
     }
 }
 
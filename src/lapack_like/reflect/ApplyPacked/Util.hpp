@@ -47,6 +47,27 @@ void FixDiagonal
     }
 }
 
+// Forms the inverse of the triangular factor of the compact-WY representation
+// of panel 'panel' of unit-diagonal lower, vertical reflectors, HPanCopy,
+// reusing the Gram matrix of the panel if it was precomputed
+template<typename F>
+void FormTriangularFactor
+( UpperOrLower uplo,
+  Conjugation conjugation,
+  const Matrix<F>& HPanCopy,
+  const Matrix<F>& householderScalars,
+  const CompactWY<F>* wy,
+  Int panel,
+        Matrix<F>& SInv )
+{
+    EL_DEBUG_CSE
+    if( wy == nullptr )
+        Herk( uplo, ADJOINT, Base<F>(1), HPanCopy, SInv );
+    else
+        SInv = wy->panelGrams[panel];
+    FixDiagonal( conjugation, householderScalars, SInv );
+}
+
 } // namespace El
 
 #endif // ifndef EL_APPLYPACKEDREFLECTORS_UTIL_HPP
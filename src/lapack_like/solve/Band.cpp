@@ -0,0 +1,375 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+// The distributed band solvers use the SPIKE algorithm [1]: each process
+// factors its diagonal block A_p of the band and solves against both its
+// right-hand sides and its couplings to the neighboring processes,
+//
+//   x_p = g_p - V_p t_{p+1} - W_p b_{p-1},
+//
+// where t_{p+1} is the first 'upper' entries of x_{p+1}, b_{p-1} is the last
+// 'lower' entries of x_{p-1}, and V_p and W_p are the "spikes" formed from
+// the columns of A coupling process p to its neighbors. Restricting these
+// equations to the first 'upper' and last 'lower' rows of each process
+// yields a reduced system of only (lower+upper) unknowns per process, which
+// is solved on the root and broadcast so that each process can form
+// x_p from its spikes.
+//
+// [1] Eric Polizzi and Ahmed H. Sameh, "A parallel hybrid banded system
+//     solver: the SPIKE algorithm", Parallel Computing, Vol. 32, No. 2,
+//     pp. 177--194, 2006.
+//
+
+namespace El {
+
+template<typename Field>
+void TridiagonalSolve
+( const Matrix<Field>& dSub,
+  const Matrix<Field>& d,
+  const Matrix<Field>& dSup,
+        Matrix<Field>& B )
+{
+    EL_DEBUG_CSE
+    const Int n = d.Height();
+    if( B.Height() != n )
+        LogicError("The diagonal and B must have the same height");
+    if( n == 0 )
+        return;
+    if( dSub.Height() != n-1 || dSup.Height() != n-1 )
+        LogicError("The off-diagonals must be of length ",n-1);
+    const Int width = B.Width();
+
+    // Gaussian elimination with partial pivoting (as in LAPACK's xGTSV),
+    // where an interchange of rows i and i+1 introduces a second
+    // superdiagonal entry dSup2[i]
+    vector<Field> lower(n-1), diag(n), upper(n-1),
+      upper2(Max(n-2,Int(0)),Field(0));
+    for( Int i=0; i<n; ++i )
+        diag[i] = d(i);
+    for( Int i=0; i<n-1; ++i )
+    {
+        lower[i] = dSub(i);
+        upper[i] = dSup(i);
+    }
+    for( Int i=0; i<n-1; ++i )
+    {
+        if( Abs(diag[i]) >= Abs(lower[i]) )
+        {
+            if( diag[i] == Field(0) )
+                throw SingularMatrixException();
+            const Field gamma = lower[i] / diag[i];
+            diag[i+1] -= gamma*upper[i];
+            for( Int k=0; k<width; ++k )
+                B(i+1,k) -= gamma*B(i,k);
+        }
+        else
+        {
+            const Field gamma = diag[i] / lower[i];
+            diag[i] = lower[i];
+            const Field temp = diag[i+1];
+            diag[i+1] = upper[i] - gamma*temp;
+            if( i < n-2 )
+            {
+                upper2[i] = upper[i+1];
+                upper[i+1] = -gamma*upper2[i];
+            }
+            upper[i] = temp;
+            for( Int k=0; k<width; ++k )
+            {
+                const Field beta = B(i,k);
+                B(i,k) = B(i+1,k);
+                B(i+1,k) = beta - gamma*B(i+1,k);
+            }
+        }
+    }
+    if( diag[n-1] == Field(0) )
+        throw SingularMatrixException();
+
+    for( Int k=0; k<width; ++k )
+    {
+        for( Int i=n-1; i>=0; --i )
+        {
+            Field tau = B(i,k);
+            if( i < n-1 )
+                tau -= upper[i]*B(i+1,k);
+            if( i < n-2 )
+                tau -= upper2[i]*B(i+2,k);
+            B(i,k) = tau / diag[i];
+        }
+    }
+}
+
+template<typename Field>
+void LinearSolve( const BandMatrix<Field>& A, Matrix<Field>& B )
+{
+    EL_DEBUG_CSE
+    BandMatrix<Field> ACopy( A );
+    Matrix<Int> pivots;
+    LU( ACopy, pivots );
+    lu::SolveAfter( NORMAL, ACopy, pivots, B );
+}
+
+template<typename Field>
+void HPDSolve
+( UpperOrLower uplo,
+  Orientation orientation,
+  const BandMatrix<Field>& A,
+        Matrix<Field>& B )
+{
+    EL_DEBUG_CSE
+    BandMatrix<Field> ACopy( A );
+    Cholesky( uplo, ACopy );
+    cholesky::SolveAfter( uplo, orientation, ACopy, B );
+}
+
+namespace {
+
+// Gather the rows [0,height) of a (row-block distributed) matrix with the
+// given blocksize onto every process
+template<typename Field>
+void AllGatherRows
+( const Grid& grid, Int height, Int blocksize,
+  const Matrix<Field>& XLoc, Matrix<Field>& X )
+{
+    EL_DEBUG_CSE
+    const Int localHeight = XLoc.Height();
+    const Int width = XLoc.Width();
+    const Int commSize = grid.Size();
+    vector<Field> sendBuf(blocksize*width,Field(0)),
+      recvBuf(commSize*blocksize*width);
+    for( Int j=0; j<width; ++j )
+        for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+            sendBuf[iLoc+j*blocksize] = XLoc(iLoc,j);
+    mpi::AllGather
+    ( sendBuf.data(), blocksize*width,
+      recvBuf.data(), blocksize*width, grid.Comm() );
+    X.Resize( height, width );
+    for( Int j=0; j<width; ++j )
+        for( Int i=0; i<height; ++i )
+            X(i,j) =
+              recvBuf[((i/blocksize)*width+j)*blocksize+(i%blocksize)];
+}
+
+template<typename Field>
+void Spike
+( const DistBandMatrix<Field>& A,
+        DistMultiVec<Field>& B,
+  const function<void(BandMatrix<Field>&,Matrix<Field>&)>& solve )
+{
+    EL_DEBUG_CSE
+    const Int n = A.Height();
+    const Int lower = A.LowerBandwidth();
+    const Int upper = A.UpperBandwidth();
+    const Int width = B.Width();
+    if( B.Height() != n )
+        LogicError("A and B must have the same height");
+    if( A.Grid() != B.Grid() )
+        LogicError("A and B must share a grid");
+    if( n == 0 )
+        return;
+    const Grid& grid = A.Grid();
+    mpi::Comm comm = grid.Comm();
+    const int commRank = grid.Rank();
+    const int commSize = grid.Size();
+    const Int blocksize = A.Blocksize();
+    const Int localHeight = A.LocalHeight();
+    const Int firstLocalRow = A.FirstLocalRow();
+    const Int numActive = (n+blocksize-1) / blocksize;
+    const Int lastHeight = n - (numActive-1)*blocksize;
+    const auto& ALoc = A.LockedMatrix();
+    auto& BLoc = B.Matrix();
+
+    if( numActive > 1 && Min(blocksize,lastHeight) < Max(lower,upper) )
+    {
+        // The band couples non-neighboring processes, which implies that
+        // the matrix is small enough to be redundantly solved
+        Matrix<Field> bandRows, X;
+        AllGatherRows( grid, n, blocksize, ALoc, bandRows );
+        BandMatrix<Field> AFull( n, n, lower, upper );
+        auto& band = AFull.Matrix();
+        for( Int i=0; i<n; ++i )
+            for( Int j=Max(i-lower,Int(0)); j<Min(i+upper+1,n); ++j )
+                band(upper+i-j,j) = bandRows(i,lower+j-i);
+        AllGatherRows( grid, n, blocksize, BLoc, X );
+        solve( AFull, X );
+        BLoc = X( IR(firstLocalRow,firstLocalRow+localHeight), ALL );
+        return;
+    }
+
+    // Solve against the right-hand sides and the couplings to the
+    // neighboring processes, [g_p,V_p,W_p] := inv(A_p) [B_p,C_next,C_prev]
+    const Int numCoupled = lower + upper;
+    Matrix<Field> G;
+    G.Resize( localHeight, width+numCoupled );
+    Zero( G );
+    if( localHeight > 0 )
+    {
+        auto GB = G( ALL, IR(0,width) );
+        GB = BLoc;
+        BandMatrix<Field> ABlock( localHeight, localHeight, lower, upper );
+        auto& blockBand = ABlock.Matrix();
+        const Int lastLocalRow = firstLocalRow + localHeight;
+        for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+        {
+            const Int i = firstLocalRow + iLoc;
+            for( Int j=Max(i-lower,Int(0)); j<Min(i+upper+1,n); ++j )
+            {
+                const Field value = ALoc(iLoc,lower+j-i);
+                if( j < firstLocalRow )
+                    G(iLoc,width+upper+j-(firstLocalRow-lower)) = value;
+                else if( j >= lastLocalRow )
+                    G(iLoc,width+j-lastLocalRow) = value;
+                else
+                    blockBand(upper+i-j,j-firstLocalRow) = value;
+            }
+        }
+        solve( ABlock, G );
+    }
+    if( numActive == 1 || numCoupled == 0 )
+    {
+        BLoc = G( ALL, IR(0,width) );
+        return;
+    }
+
+    // Gather the first 'upper' and last 'lower' rows of [g_p, V_p, W_p]
+    const Int pieceSize = numCoupled*(width+numCoupled);
+    vector<Field> piece(pieceSize,Field(0));
+    if( localHeight > 0 )
+    {
+        for( Int j=0; j<width+numCoupled; ++j )
+        {
+            for( Int i=0; i<upper; ++i )
+                piece[i+j*numCoupled] = G(i,j);
+            for( Int i=0; i<lower; ++i )
+                piece[upper+i+j*numCoupled] = G(localHeight-lower+i,j);
+        }
+    }
+    const int root = 0;
+    vector<Field> pieces;
+    if( commRank == root )
+        pieces.resize( commSize*pieceSize );
+    mpi::Gather
+    ( piece.data(), pieceSize, pieces.data(), pieceSize, root, comm );
+    SwapClear( piece );
+
+    // Solve the reduced system for the unknowns [t_p; b_p] of each process
+    const Int reducedSize = numActive*numCoupled;
+    Matrix<Field> reducedRHS;
+    reducedRHS.Resize( reducedSize, width );
+    if( commRank == root )
+    {
+        Matrix<Field> S;
+        Identity( S, reducedSize, reducedSize );
+        for( Int q=0; q<numActive; ++q )
+        {
+            const Field* P = &pieces[q*pieceSize];
+            const Int off = q*numCoupled;
+            for( Int i=0; i<numCoupled; ++i )
+            {
+                for( Int j=0; j<width; ++j )
+                    reducedRHS(off+i,j) = P[i+j*numCoupled];
+                if( q+1 < numActive )
+                    for( Int j=0; j<upper; ++j )
+                        S(off+i,off+numCoupled+j) =
+                          P[i+(width+j)*numCoupled];
+                if( q > 0 )
+                    for( Int j=0; j<lower; ++j )
+                        S(off+i,off-lower+j) =
+                          P[i+(width+upper+j)*numCoupled];
+            }
+        }
+        LinearSolve( S, reducedRHS );
+    }
+    SwapClear( pieces );
+    mpi::Broadcast( reducedRHS.Buffer(), reducedSize*width, root, comm );
+
+    // x_p := g_p - V_p t_{p+1} - W_p b_{p-1}
+    if( localHeight > 0 )
+    {
+        auto X = G( ALL, IR(0,width) );
+        if( commRank+1 < numActive && upper > 0 )
+        {
+            const Int off = (commRank+1)*numCoupled;
+            Gemm
+            ( NORMAL, NORMAL,
+              Field(-1), G(ALL,IR(width,width+upper)),
+                         reducedRHS(IR(off,off+upper),ALL),
+              Field(1),  X );
+        }
+        if( commRank > 0 && lower > 0 )
+        {
+            const Int off = (commRank-1)*numCoupled + upper;
+            Gemm
+            ( NORMAL, NORMAL,
+              Field(-1), G(ALL,IR(width+upper,width+numCoupled)),
+                         reducedRHS(IR(off,off+lower),ALL),
+              Field(1),  X );
+        }
+        BLoc = X;
+    }
+}
+
+} // anonymous namespace
+
+template<typename Field>
+void LinearSolve( const DistBandMatrix<Field>& A, DistMultiVec<Field>& B )
+{
+    EL_DEBUG_CSE
+    function<void(BandMatrix<Field>&,Matrix<Field>&)> solve =
+      []( BandMatrix<Field>& ABlock, Matrix<Field>& X )
+      {
+          Matrix<Int> pivots;
+          LU( ABlock, pivots );
+          lu::SolveAfter( NORMAL, ABlock, pivots, X );
+      };
+    Spike( A, B, solve );
+}
+
+template<typename Field>
+void HPDSolve( const DistBandMatrix<Field>& A, DistMultiVec<Field>& B )
+{
+    EL_DEBUG_CSE
+    if( A.LowerBandwidth() != A.UpperBandwidth() )
+        LogicError("HPD band matrices must have equal bandwidths");
+    function<void(BandMatrix<Field>&,Matrix<Field>&)> solve =
+      []( BandMatrix<Field>& ABlock, Matrix<Field>& X )
+      {
+          Cholesky( LOWER, ABlock );
+          cholesky::SolveAfter( LOWER, NORMAL, ABlock, X );
+      };
+    Spike( A, B, solve );
+}
+
+#define PROTO(Field) \
+  template void TridiagonalSolve \
+  ( const Matrix<Field>& dSub, \
+    const Matrix<Field>& d, \
+    const Matrix<Field>& dSup, \
+          Matrix<Field>& B ); \
+  template void LinearSolve \
+  ( const BandMatrix<Field>& A, Matrix<Field>& B ); \
+  template void HPDSolve \
+  ( UpperOrLower uplo, \
+    Orientation orientation, \
+    const BandMatrix<Field>& A, \
+          Matrix<Field>& B ); \
+  template void LinearSolve \
+  ( const DistBandMatrix<Field>& A, DistMultiVec<Field>& B ); \
+  template void HPDSolve \
+  ( const DistBandMatrix<Field>& A, DistMultiVec<Field>& B );
+
+#define EL_NO_INT_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
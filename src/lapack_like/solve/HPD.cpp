@@ -68,6 +68,107 @@ void HPDSolve
     hpd_solve::Overwrite( uplo, orientation, ACopy, B );
 }
 
+namespace hpd_solve {
+
+// Apply op(A), where only the 'uplo' triangle of A is referenced
+template<typename Field,class MatrixType>
+void ApplyHermitian
+( UpperOrLower uplo,
+  Orientation orientation,
+  const MatrixType& A,
+  const MatrixType& X,
+        MatrixType& Y )
+{
+    EL_DEBUG_CSE
+    if( orientation == TRANSPOSE )
+    {
+        // A^T = conj(A) for Hermitian A
+        MatrixType XConj( X );
+        Conjugate( XConj );
+        Hemm( LEFT, uplo, Field(1), A, XConj, Field(0), Y );
+        Conjugate( Y );
+    }
+    else
+    {
+        Hemm( LEFT, uplo, Field(1), A, X, Field(0), Y );
+    }
+}
+
+} // namespace hpd_solve
+
+template<typename Field>
+Int HPDSolve
+( UpperOrLower uplo,
+  Orientation orientation,
+  const Matrix<Field>& A,
+        Matrix<Field>& B,
+  const MixedPrecisionCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Demote<Field> FieldLow;
+    if( A.Height() != A.Width() )
+        LogicError("A must be square");
+
+    Matrix<FieldLow> ALow;
+    Copy( A, ALow );
+    Cholesky( uplo, ALow );
+
+    auto applyA =
+      [&]( const Matrix<Field>& X, Matrix<Field>& Y )
+      { hpd_solve::ApplyHermitian<Field>( uplo, orientation, A, X, Y ); };
+    Matrix<FieldLow> YLow;
+    auto applyAInv =
+      [&]( Matrix<Field>& Y )
+      {
+        Copy( Y, YLow );
+        cholesky::SolveAfter( uplo, orientation, ALow, YLow );
+        Copy( YLow, Y );
+      };
+
+    return refined_solve::Joint
+      ( applyA, applyAInv, B, ctrl.relTol, ctrl.maxRefineIts, ctrl.progress );
+}
+
+template<typename Field>
+Int HPDSolve
+( UpperOrLower uplo,
+  Orientation orientation,
+  const AbstractDistMatrix<Field>& APre,
+        AbstractDistMatrix<Field>& BPre,
+  const MixedPrecisionCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Demote<Field> FieldLow;
+    if( APre.Height() != APre.Width() )
+        LogicError("A must be square");
+    const Grid& grid = APre.Grid();
+
+    DistMatrixReadProxy<Field,Field,MC,MR> AProx( APre );
+    DistMatrixReadWriteProxy<Field,Field,MC,MR> BProx( BPre );
+    auto& A = AProx.GetLocked();
+    auto& B = BProx.Get();
+
+    DistMatrix<FieldLow> ALow(grid);
+    Copy( A, ALow );
+    Cholesky( uplo, ALow );
+
+    auto applyA =
+      [&]( const DistMatrix<Field>& X, DistMatrix<Field>& Y )
+      { hpd_solve::ApplyHermitian<Field>( uplo, orientation, A, X, Y ); };
+    DistMatrix<FieldLow> YLow(grid);
+    auto applyAInv =
+      [&]( DistMatrix<Field>& Y )
+      {
+        Copy( Y, YLow );
+        cholesky::SolveAfter( uplo, orientation, ALow, YLow );
+        Copy( YLow, Y );
+      };
+
+    const bool progress = ctrl.progress && grid.Rank() == 0;
+    return refined_solve::Joint
+      ( applyA, applyAInv, B, ctrl.relTol, ctrl.maxRefineIts, progress );
+}
+
 // TODO(poulson): Add iterative refinement parameter
 template<typename Field>
 void HPDSolve
@@ -119,6 +220,14 @@ void HPDSolve
   template void HPDSolve \
   ( UpperOrLower uplo, Orientation orientation, \
     const AbstractDistMatrix<Field>& A, AbstractDistMatrix<Field>& B ); \
+  template Int HPDSolve \
+  ( UpperOrLower uplo, Orientation orientation, \
+    const Matrix<Field>& A, Matrix<Field>& B, \
+    const MixedPrecisionCtrl<Base<Field>>& ctrl ); \
+  template Int HPDSolve \
+  ( UpperOrLower uplo, Orientation orientation, \
+    const AbstractDistMatrix<Field>& A, AbstractDistMatrix<Field>& B, \
+    const MixedPrecisionCtrl<Base<Field>>& ctrl ); \
   template void HPDSolve \
   ( const SparseMatrix<Field>& A, Matrix<Field>& B, const BisectCtrl& ctrl ); \
   template void HPDSolve \
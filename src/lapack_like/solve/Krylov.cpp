@@ -0,0 +1,113 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+namespace El {
+
+template<typename Field>
+Int KrylovSolve
+( const SparseMatrix<Field>& A,
+  const SparseLDLFactorization<Field>& precondFact,
+        Matrix<Field>& B,
+  const KrylovCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    if( A.Height() != A.Width() )
+        LogicError("Expected a square matrix");
+    if( A.Height() != B.Height() )
+        LogicError("A and B must have the same height");
+    auto applyA =
+      [&]( Field alpha, const Matrix<Field>& X, Field beta, Matrix<Field>& Y )
+      {
+        Multiply( NORMAL, alpha, A, X, beta, Y );
+      };
+    auto precond =
+      [&]( Matrix<Field>& W )
+      {
+        precondFact.Solve( W );
+      };
+    switch( ctrl.alg )
+    {
+    case KRYLOV_CG:
+        return CG
+        ( applyA, precond, B, ctrl.relTol, ctrl.maxIts, ctrl.progress );
+    case KRYLOV_MINRES:
+        return MINRES
+        ( applyA, precond, B, ctrl.relTol, ctrl.maxIts, ctrl.progress );
+    case KRYLOV_FGMRES:
+        return FGMRES
+        ( applyA, precond, B, ctrl.relTol, ctrl.restart, ctrl.maxIts,
+          ctrl.progress );
+    default:
+        LogicError("Invalid Krylov algorithm");
+        return -1;
+    }
+}
+
+template<typename Field>
+Int KrylovSolve
+( const DistSparseMatrix<Field>& A,
+  const DistSparseLDLFactorization<Field>& precondFact,
+        DistMultiVec<Field>& B,
+  const KrylovCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    if( A.Height() != A.Width() )
+        LogicError("Expected a square matrix");
+    if( A.Height() != B.Height() )
+        LogicError("A and B must have the same height");
+    auto applyA =
+      [&]( Field alpha, const DistMultiVec<Field>& X,
+           Field beta,        DistMultiVec<Field>& Y )
+      {
+        Multiply( NORMAL, alpha, A, X, beta, Y );
+      };
+    auto precond =
+      [&]( DistMultiVec<Field>& W )
+      {
+        precondFact.Solve( W );
+      };
+    switch( ctrl.alg )
+    {
+    case KRYLOV_CG:
+        return CG
+        ( applyA, precond, B, ctrl.relTol, ctrl.maxIts, ctrl.progress );
+    case KRYLOV_MINRES:
+        return MINRES
+        ( applyA, precond, B, ctrl.relTol, ctrl.maxIts, ctrl.progress );
+    case KRYLOV_FGMRES:
+        return FGMRES
+        ( applyA, precond, B, ctrl.relTol, ctrl.restart, ctrl.maxIts,
+          ctrl.progress );
+    default:
+        LogicError("Invalid Krylov algorithm");
+        return -1;
+    }
+}
+
+#define PROTO(Field) \
+  template Int KrylovSolve \
+  ( const SparseMatrix<Field>& A, \
+    const SparseLDLFactorization<Field>& precondFact, \
+          Matrix<Field>& B, \
+    const KrylovCtrl<Base<Field>>& ctrl ); \
+  template Int KrylovSolve \
+  ( const DistSparseMatrix<Field>& A, \
+    const DistSparseLDLFactorization<Field>& precondFact, \
+          DistMultiVec<Field>& B, \
+    const KrylovCtrl<Base<Field>>& ctrl );
+
+#define EL_NO_INT_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
@@ -293,6 +293,77 @@ void LinearSolve
     lin_solve::Overwrite( ACopy, B );
 }
 
+template<typename Field>
+Int LinearSolve
+( const Matrix<Field>& A,
+        Matrix<Field>& B,
+  const MixedPrecisionCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Demote<Field> FieldLow;
+    if( A.Height() != A.Width() )
+        LogicError("A must be square");
+
+    Matrix<FieldLow> ALow;
+    Copy( A, ALow );
+    Permutation P;
+    LU( ALow, P );
+
+    auto applyA =
+      [&]( const Matrix<Field>& X, Matrix<Field>& Y )
+      { Gemm( NORMAL, NORMAL, Field(1), A, X, Field(0), Y ); };
+    Matrix<FieldLow> YLow;
+    auto applyAInv =
+      [&]( Matrix<Field>& Y )
+      {
+        Copy( Y, YLow );
+        lu::SolveAfter( NORMAL, ALow, P, YLow );
+        Copy( YLow, Y );
+      };
+
+    return refined_solve::Joint
+      ( applyA, applyAInv, B, ctrl.relTol, ctrl.maxRefineIts, ctrl.progress );
+}
+
+template<typename Field>
+Int LinearSolve
+( const AbstractDistMatrix<Field>& APre,
+        AbstractDistMatrix<Field>& BPre,
+  const MixedPrecisionCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Demote<Field> FieldLow;
+    if( APre.Height() != APre.Width() )
+        LogicError("A must be square");
+    const Grid& grid = APre.Grid();
+
+    DistMatrixReadProxy<Field,Field,MC,MR> AProx( APre );
+    DistMatrixReadWriteProxy<Field,Field,MC,MR> BProx( BPre );
+    auto& A = AProx.GetLocked();
+    auto& B = BProx.Get();
+
+    DistMatrix<FieldLow> ALow(grid);
+    Copy( A, ALow );
+    DistPermutation P(grid);
+    LU( ALow, P );
+
+    auto applyA =
+      [&]( const DistMatrix<Field>& X, DistMatrix<Field>& Y )
+      { Gemm( NORMAL, NORMAL, Field(1), A, X, Field(0), Y ); };
+    DistMatrix<FieldLow> YLow(grid);
+    auto applyAInv =
+      [&]( DistMatrix<Field>& Y )
+      {
+        Copy( Y, YLow );
+        lu::SolveAfter( NORMAL, ALow, P, YLow );
+        Copy( YLow, Y );
+      };
+
+    const bool progress = ctrl.progress && grid.Rank() == 0;
+    return refined_solve::Joint
+      ( applyA, applyAInv, B, ctrl.relTol, ctrl.maxRefineIts, progress );
+}
+
 template<typename Field>
 void LinearSolve
 ( const SparseMatrix<Field>& A,
@@ -326,6 +397,14 @@ void LinearSolve
   ( const AbstractDistMatrix<Field>& A, \
           AbstractDistMatrix<Field>& B, \
     bool scalapack ); \
+  template Int LinearSolve \
+  ( const Matrix<Field>& A, \
+          Matrix<Field>& B, \
+    const MixedPrecisionCtrl<Base<Field>>& ctrl ); \
+  template Int LinearSolve \
+  ( const AbstractDistMatrix<Field>& A, \
+          AbstractDistMatrix<Field>& B, \
+    const MixedPrecisionCtrl<Base<Field>>& ctrl ); \
   template void LinearSolve \
   ( const SparseMatrix<Field>& A, \
           Matrix<Field>& B, \
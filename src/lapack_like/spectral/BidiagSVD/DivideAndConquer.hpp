@@ -16,6 +16,109 @@ using El::schur::SplitGrid;
 namespace El {
 namespace bidiag_svd {
 
+// Solve the secular equation for the undeflated roots with global indices
+// colShift + jLoc*colStride, storing root j in roots(jLoc) and the
+// element-wise product of dUndeflated minus and plus it in column jLoc of
+// 'minusShifts' before multiplying the corresponding factors into the
+// corrected update vector. The roots are independent and so are solved
+// concurrently when threads are available, whereas the factors are
+// accumulated in the original order so that the result does not depend upon
+// the number of threads.
+template<typename Real>
+void SolveSecularEquations
+( const Matrix<Real>& dUndeflated,
+  const Real& rho,
+  const Matrix<Real>& rUndeflated,
+        Int colShift,
+        Int colStride,
+        Matrix<Real>& roots,
+        Matrix<Real>& minusShifts,
+        Matrix<Real>& rCorrected,
+        SecularSVDInfo& secularInfo,
+  const DCCtrl<Real>& dcCtrl,
+        bool progress )
+{
+    EL_DEBUG_CSE
+    const Int numUndeflated = dUndeflated.Height();
+    const Int numLoc = minusShifts.Width();
+    Int numIterations=0, numAlternations=0,
+        numCubicIterations=0, numCubicFailures=0;
+    std::exception_ptr exception;
+#ifdef EL_HYBRID
+    const bool parallel = IsBlasScalar<Real>::value && !progress &&
+      !dcCtrl.secularCtrl.progress &&
+      numUndeflated >= dcCtrl.parallelSecularCutoff;
+    #pragma omp parallel if(parallel) \
+      reduction(+:numIterations,numAlternations,\
+                  numCubicIterations,numCubicFailures)
+#endif
+    {
+        // For temporarily storing dUndeflated + root j
+        Matrix<Real> plusShift( numUndeflated, 1 );
+#ifdef EL_HYBRID
+        #pragma omp for schedule(dynamic)
+#endif
+        for( Int jLoc=0; jLoc<numLoc; ++jLoc )
+        {
+            const Int j = colShift + jLoc*colStride;
+            try
+            {
+                auto minusShift = minusShifts( ALL, IR(jLoc) );
+                auto valueInfo =
+                  SecularSingularValue
+                  ( j, dUndeflated, rho, rUndeflated, roots(jLoc),
+                    minusShift, plusShift, dcCtrl.secularCtrl );
+                if( progress )
+                    Output("Secular singular value ",j," is ",roots(jLoc));
+                numIterations += valueInfo.numIterations;
+                numAlternations += valueInfo.numAlternations;
+                numCubicIterations += valueInfo.numCubicIterations;
+                numCubicFailures += valueInfo.numCubicFailures;
+
+                // minusShift currently holds dUndeflated-d(j) and plusShift
+                // holds dUndeflated+d(j). Overwrite minusShift with their
+                // element-wise product since that is all we require from
+                // here on out.
+                for( Int k=0; k<numUndeflated; ++k )
+                    minusShift(k) *= plusShift(k);
+            }
+            catch( ... )
+            {
+#ifdef EL_HYBRID
+                #pragma omp critical
+#endif
+                {
+                    if( exception == nullptr )
+                        exception = std::current_exception();
+                }
+            }
+        }
+    }
+    if( exception != nullptr )
+        std::rethrow_exception( exception );
+    secularInfo.numIterations += numIterations;
+    secularInfo.numAlternations += numAlternations;
+    secularInfo.numCubicIterations += numCubicIterations;
+    secularInfo.numCubicFailures += numCubicFailures;
+
+#ifdef EL_HYBRID
+    #pragma omp parallel for if(parallel)
+#endif
+    for( Int k=0; k<numUndeflated; ++k )
+    {
+        for( Int jLoc=0; jLoc<numLoc; ++jLoc )
+        {
+            const Int j = colShift + jLoc*colStride;
+            if( k == j )
+                rCorrected(k) *= minusShifts(k,jLoc);
+            else
+                rCorrected(k) *= minusShifts(k,jLoc) /
+                  ((dUndeflated(j)+dUndeflated(k))*
+                   (dUndeflated(j)-dUndeflated(k)));
+        }
+    }
+}
+
 // The following is analogous to LAPACK's {s,d}lasd{1,2,3} [CITATION] but does
 // not accept initial sorting permutations for s0 and s1, nor does it enforce
 // any ordering on the resulting singular values. Several bugs in said LAPACK
@@ -607,45 +710,11 @@ Merge
     else
         VSecular.Resize( numUndeflated, numUndeflated );
 
-    // For temporarily storing dUndeflated + d(j)
-    Matrix<Real> plusShift;
-    if( ctrl.wantU )
-        View( plusShift, USecular, ALL, IR(0) );
-    else
-        plusShift.Resize( numUndeflated, 1 );
-
-    for( Int j=0; j<numUndeflated; ++j )
     {
-        auto minusShift = VSecular( ALL, IR(j) );
-
-        auto valueInfo =
-          SecularSingularValue
-          ( j, dUndeflated, rho, rUndeflated, d(j), minusShift, plusShift,
-            dcCtrl.secularCtrl );
-        if( ctrl.progress )
-            Output("Secular singular value ",j," is ",d(j));
-
-        secularInfo.numIterations += valueInfo.numIterations;
-        secularInfo.numAlternations += valueInfo.numAlternations;
-        secularInfo.numCubicIterations += valueInfo.numCubicIterations;
-        secularInfo.numCubicFailures += valueInfo.numCubicFailures;
-
-        // minusShift currently holds dUndeflated-d(j) and plusShift
-        // holds dUndeflated+d(j). Overwrite minusShift with their
-        // element-wise product since that is all we require from here on
-        // out.
-        for( Int k=0; k<numUndeflated; ++k )
-            minusShift(k) *= plusShift(k);
-
-        rCorrected(j) *= minusShift(j);
-        for( Int k=0; k<numUndeflated; ++k )
-        {
-            if( k == j )
-                continue;
-            rCorrected(k) *= minusShift(k) /
-              ((dUndeflated(j)+dUndeflated(k))*
-               (dUndeflated(j)-dUndeflated(k)));
-        }
+        auto dSecular = d( undeflatedInd, ALL );
+        SolveSecularEquations
+        ( dUndeflated, rho, rUndeflated, 0, 1, dSecular, VSecular,
+          rCorrected, secularInfo, dcCtrl, ctrl.progress );
     }
     for( Int j=0; j<numUndeflated; ++j )
         rCorrected(j) = Sgn(rUndeflated(j),false) * Sqrt(Abs(rCorrected(j)));
@@ -1467,45 +1536,13 @@ Merge
     auto& USecularLoc = USecular.Matrix();
     auto& VSecularLoc = VSecular.Matrix();
 
-    // For temporarily storing dUndeflated + d(j)
-    Matrix<Real> plusShift( numUndeflated, 1 );
-
+    // We will sum the secular info across all of the processors at the
+    // top-level
     const Int numUndeflatedLoc = VSecularLoc.Width();
-    for( Int jLoc=0; jLoc<numUndeflatedLoc; ++jLoc )
-    {
-        const Int j = VSecular.GlobalCol(jLoc);
-        auto minusShift = VSecularLoc( ALL, IR(jLoc) );
-
-        auto valueInfo =
-          SecularSingularValue
-          ( j, dUndeflated, rho, rUndeflated, dSecularLoc(jLoc),
-            minusShift, plusShift, dcCtrl.secularCtrl );
-        if( ctrl.progress && amRoot )
-            Output("Secular singular value ",j," is ",dSecularLoc(jLoc));
-
-        // We will sum these across all of the processors at the top-level
-        secularInfo.numIterations += valueInfo.numIterations;
-        secularInfo.numAlternations += valueInfo.numAlternations;
-        secularInfo.numCubicIterations += valueInfo.numCubicIterations;
-        secularInfo.numCubicFailures += valueInfo.numCubicFailures;
-
-        // minusShift currently holds dUndeflated-d(j) and plusShift
-        // holds dUndeflated+d(j). Overwrite minusShift with their
-        // element-wise product since that is all we require from here on
-        // out.
-        for( Int k=0; k<numUndeflated; ++k )
-            minusShift(k) *= plusShift(k);
-
-        rCorrected(j) *= minusShift(j);
-        for( Int k=0; k<numUndeflated; ++k )
-        {
-            if( k == j )
-                continue;
-            rCorrected(k) *= minusShift(k) /
-              ((dUndeflated(j)+dUndeflated(k))*
-               (dUndeflated(j)-dUndeflated(k)));
-        }
-    }
+    SolveSecularEquations
+    ( dUndeflated, rho, rUndeflated, VSecular.RowShift(), VSecular.RowStride(),
+      dSecularLoc, VSecularLoc, rCorrected, secularInfo, dcCtrl,
+      ctrl.progress && amRoot );
     AllReduce( rCorrected, g.VRComm(), mpi::PROD );
     for( Int j=0; j<numUndeflated; ++j )
         rCorrected(j) = Sgn(rUndeflated(j),false) * Sqrt(Abs(rCorrected(j)));
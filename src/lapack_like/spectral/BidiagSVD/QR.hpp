@@ -126,22 +126,23 @@ Real MaxSingularValueEstimateOfBidiag
 namespace qr {
 
 // Cf. LAPACK's {s,d}bdsqr for these sweep strategies.
-template<typename Field>
+//
+// The rotations which should be applied from the right to U and V are
+// returned in (cUList,sUList) and (cVList,sVList) rather than applied so that
+// the rotations of several sweeps can be applied in a single pass.
+template<typename Real>
 void Sweep
-(       Matrix<Base<Field>>& mainDiag,
-        Matrix<Base<Field>>& superDiag,
-        Matrix<Field>& U,
-        Matrix<Field>& V,
-  const Base<Field>& shift,
+(       Matrix<Real>& mainDiag,
+        Matrix<Real>& superDiag,
+  const Real& shift,
         ForwardOrBackward direction,
-        Matrix<Base<Field>>& cUList,
-        Matrix<Base<Field>>& sUList,
-        Matrix<Base<Field>>& cVList,
-        Matrix<Base<Field>>& sVList,
-  const BidiagSVDCtrl<Base<Field>>& ctrl )
+        Matrix<Real>& cUList,
+        Matrix<Real>& sUList,
+        Matrix<Real>& cVList,
+        Matrix<Real>& sVList,
+  const BidiagSVDCtrl<Real>& ctrl )
 {
     EL_DEBUG_CSE
-    typedef Base<Field> Real;
     const Int n = mainDiag.Height();
     const Real zero(0), one(1);
 
@@ -258,16 +259,6 @@ void Sweep
             }
             superDiag(n-2) = f;
         }
-        if( ctrl.wantU )
-        {
-            ApplyGivensSequence
-            ( RIGHT, VARIABLE_GIVENS_SEQUENCE, FORWARD, cUList, sUList, U );
-        }
-        if( ctrl.wantV )
-        {
-            ApplyGivensSequence
-            ( RIGHT, VARIABLE_GIVENS_SEQUENCE, FORWARD, cVList, sVList, V );
-        }
     }
     else
     {
@@ -364,16 +355,6 @@ void Sweep
             }
             superDiag(0) = f;
         }
-        if( ctrl.wantU )
-        {
-            ApplyGivensSequence
-            ( RIGHT, VARIABLE_GIVENS_SEQUENCE, BACKWARD, cUList, sUList, U );
-        }
-        if( ctrl.wantV )
-        {
-            ApplyGivensSequence
-            ( RIGHT, VARIABLE_GIVENS_SEQUENCE, BACKWARD, cVList, sVList, V );
-        }
     }
 }
 
@@ -400,7 +381,6 @@ Helper
     EL_DEBUG_CSE
     typedef Base<Field> Real;
     const Int n = mainDiag.Height();
-    const Int mU = U.Height();
     const Int mV = V.Height();
     const Real eps = limits::Epsilon<Real>();
     const Real safeMin = limits::SafeMin<Real>();
@@ -463,9 +443,39 @@ Helper
     Int winEnd = n;
     Int oldWinBeg=-1, oldWinEnd=-1;
     ForwardOrBackward direction = FORWARD;
-    Matrix<Real> cUList(n,1), sUList(n,1), cVList(n,1), sVList(n,1);
     Matrix<Real> mainDiagSub, superDiagSub;
-    Matrix<Field> USub, VSub;
+
+    // The rotations of the sweeps are batched so that they can be applied to
+    // the singular vectors in cache-blocked passes
+    const Int batchSize = Max( ctrl.qrCtrl.rotationBatchSize, Int(1) );
+    vector<GivensSequence<Real>> URotations, VRotations;
+    auto queueRotations =
+      [&]( vector<GivensSequence<Real>>& rotations, Matrix<Field>& A,
+           Int offset, ForwardOrBackward seqDirection )
+      -> GivensSequence<Real>&
+    {
+        if( Int(rotations.size()) == batchSize )
+        {
+            ApplyGivensSequences( rotations, A );
+            rotations.clear();
+        }
+        rotations.emplace_back();
+        auto& seq = rotations.back();
+        seq.offset = offset;
+        seq.direction = seqDirection;
+        return seq;
+    };
+    auto queueRotation =
+      [&]( vector<GivensSequence<Real>>& rotations, Matrix<Field>& A,
+           Int offset, const Real& c, const Real& s )
+    {
+        auto& seq = queueRotations( rotations, A, offset, FORWARD );
+        seq.cList.Resize( 1, 1 );
+        seq.sList.Resize( 1, 1 );
+        seq.cList(0) = c;
+        seq.sList(0) = s;
+    };
+    Matrix<Real> cUList(n,1), sUList(n,1), cVList(n,1), sVList(n,1);
     while( winEnd > 0 )
     {
         if( info.numInnerLoops > maxInnerLoops )
@@ -536,17 +546,9 @@ Helper
                 sigmaMax *= sgnMax; // The signs will be fixed at the end
                 sigmaMin *= sgnMin; // The signs will be fixed at the end
                 if( ctrl.wantU )
-                {
-                    blas::Rot
-                    ( mU, U.Buffer(0,winBeg  ), 1,
-                          U.Buffer(0,winBeg+1), 1, cU, sU );
-                }
+                    queueRotation( URotations, U, winBeg, cU, sU );
                 if( ctrl.wantV )
-                {
-                    blas::Rot
-                    ( mV, V.Buffer(0,winBeg  ), 1,
-                          V.Buffer(0,winBeg+1), 1, cV, sV );
-                }
+                    queueRotation( VRotations, V, winBeg, cV, sV );
             }
             else
             {
@@ -731,17 +733,21 @@ Helper
         // views
         View( mainDiagSub, mainDiag, IR(winBeg,winEnd), ALL );
         View( superDiagSub, superDiag, IR(winBeg,winEnd-1), ALL );
+        Sweep
+        ( mainDiagSub, superDiagSub, shift, direction,
+          cUList, sUList, cVList, sVList, ctrl );
         if( ctrl.wantU )
         {
-            View( USub, U, ALL, IR(winBeg,winEnd) );
+            auto& seq = queueRotations( URotations, U, winBeg, direction );
+            seq.cList = cUList;
+            seq.sList = sUList;
         }
         if( ctrl.wantV )
         {
-            View( VSub, V, ALL, IR(winBeg,winEnd) );
+            auto& seq = queueRotations( VRotations, V, winBeg, direction );
+            seq.cList = cVList;
+            seq.sList = sVList;
         }
-        Sweep
-        ( mainDiagSub, superDiagSub, USub, VSub, shift, direction,
-          cUList, sUList, cVList, sVList, ctrl );
 
         // Test for convergence of the last off-diagonal of the sweep
         if( direction == FORWARD )
@@ -756,6 +762,11 @@ Helper
         }
     }
 
+    if( ctrl.wantU )
+        ApplyGivensSequences( URotations, U );
+    if( ctrl.wantV )
+        ApplyGivensSequences( VRotations, V );
+
     // Force the singular values to be positive (absorbing signs into V)
     for( Int j=0; j<info.numUnconverged; ++j )
         mainDiag(j) = Real(-1);
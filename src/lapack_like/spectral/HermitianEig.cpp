@@ -229,8 +229,7 @@ BlackBox
         SafeScaleTrapezoid( maxNormA, normMin, uplo, A );
     }
 
-    // TODO(poulson): Extend interface to support accepting ctrl.tridiagCtrl
-    herm_tridiag::ExplicitCondensed( uplo, A );
+    herm_tridiag::ExplicitCondensed( uplo, A, ctrl.tridiagCtrl );
 
     auto d = GetRealPartOfDiagonal(A);
     auto dSub = GetDiagonal( A, (uplo==LOWER?-1:1) );
@@ -505,6 +504,7 @@ HermitianEig
   const HermitianEigCtrl<F>& ctrl )
 {
     EL_DEBUG_CSE
+    EL_PROFILE_REGION("HermitianEig");
     typedef Base<F> Real;
     if( APre.Height() != APre.Width() )
         LogicError("Hermitian matrices must be square");
@@ -549,16 +549,24 @@ BlackBox
     EL_DEBUG_CSE
     HermitianEigInfo info;
 
-    // TODO(poulson): Extend interface to support ctrl.tridiagCtrl
+    // TODO(poulson): Extend interface to support the rest of ctrl.tridiagCtrl
     Matrix<F> householderScalars;
-    HermitianTridiag( uplo, A, householderScalars );
+    herm_tridiag::TwoStageReflectors<F> twoStageReflectors;
+    if( ctrl.tridiagCtrl.twoStage )
+        herm_tridiag::TwoStage
+        ( uplo, A, twoStageReflectors, ctrl.tridiagCtrl.bandwidth );
+    else
+        HermitianTridiag( uplo, A, householderScalars );
 
     auto d = GetRealPartOfDiagonal(A);
     auto dSub = GetDiagonal( A, (uplo==LOWER?-1:1) );
     info.tridiagEigInfo =
       HermitianTridiagEig( d, dSub, w, Q, ctrl.tridiagEigCtrl );
 
-    herm_tridiag::ApplyQ( LEFT, uplo, NORMAL, A, householderScalars, Q );
+    if( ctrl.tridiagCtrl.twoStage )
+        herm_tridiag::ApplyTwoStageQ( A, twoStageReflectors, Q );
+    else
+        herm_tridiag::ApplyQ( LEFT, uplo, NORMAL, A, householderScalars, Q );
 
     return info;
 }
@@ -579,9 +587,14 @@ BlackBox
     DistMatrixReadProxy<F,F,MC,MR> AProx( APre );
     auto& A = AProx.Get();
 
-    // TODO(poulson): Extend interface to support ctrl.tridiagCtrl
+    // TODO(poulson): Extend interface to support the rest of ctrl.tridiagCtrl
     DistMatrix<F,VC,STAR> householderScalars(g);
-    HermitianTridiag( uplo, A, householderScalars );
+    herm_tridiag::TwoStageReflectors<F> twoStageReflectors;
+    if( ctrl.tridiagCtrl.twoStage )
+        herm_tridiag::TwoStage
+        ( uplo, A, twoStageReflectors, ctrl.tridiagCtrl.bandwidth );
+    else
+        HermitianTridiag( uplo, A, householderScalars );
 
     auto d = GetRealPartOfDiagonal(A);
     auto dSub = GetDiagonal( A, (uplo==LOWER?-1:1) );
@@ -593,7 +606,11 @@ BlackBox
 
         info.tridiagEigInfo =
           HermitianTridiagEig( d, dSub, w, Q, ctrl.tridiagEigCtrl );
-        herm_tridiag::ApplyQ( LEFT, uplo, NORMAL, A, householderScalars, Q );
+        if( ctrl.tridiagCtrl.twoStage )
+            herm_tridiag::ApplyTwoStageQ( A, twoStageReflectors, Q );
+        else
+            herm_tridiag::ApplyQ
+            ( LEFT, uplo, NORMAL, A, householderScalars, Q );
     }
     else
     {
@@ -602,7 +619,11 @@ BlackBox
 
         info.tridiagEigInfo =
           HermitianTridiagEig( d, dSub, w, Q, ctrl.tridiagEigCtrl );
-        herm_tridiag::ApplyQ( LEFT, uplo, NORMAL, A, householderScalars, Q );
+        if( ctrl.tridiagCtrl.twoStage )
+            herm_tridiag::ApplyTwoStageQ( A, twoStageReflectors, Q );
+        else
+            herm_tridiag::ApplyQ
+            ( LEFT, uplo, NORMAL, A, householderScalars, Q );
     }
 
     return info;
@@ -866,7 +887,12 @@ MRRR
             timer.Start();
     }
     DistMatrix<F,STAR,STAR> householderScalars(g);
-    HermitianTridiag( uplo, A, householderScalars, ctrl.tridiagCtrl );
+    herm_tridiag::TwoStageReflectors<F> twoStageReflectors;
+    if( ctrl.tridiagCtrl.twoStage )
+        herm_tridiag::TwoStage
+        ( uplo, A, twoStageReflectors, ctrl.tridiagCtrl.bandwidth );
+    else
+        HermitianTridiag( uplo, A, householderScalars, ctrl.tridiagCtrl );
     if( ctrl.timeStages )
     {
         mpi::Barrier( A.DistComm() );
@@ -889,7 +915,8 @@ MRRR
     {
         // Get an upper-bound on the number of local eigenvalues in the range
         kEst = herm_tridiag_eig::MRRREstimate
-          ( d, e, g.VRComm(), subset.lowerBound, subset.upperBound );
+          ( d_STAR_STAR, e_STAR_STAR, g.VRComm(),
+            subset.lowerBound, subset.upperBound );
     }
     else if( subset.indexSubset )
         kEst = subset.upperIndex-subset.lowerIndex+1;
@@ -946,6 +973,15 @@ MRRR
     }
 
     const Int k = w.Height();
+    auto backtransform =
+      [&]( AbstractDistMatrix<F>& QSub )
+      {
+          if( ctrl.tridiagCtrl.twoStage )
+              herm_tridiag::ApplyTwoStageQ( A, twoStageReflectors, QSub );
+          else
+              herm_tridiag::ApplyQ
+              ( LEFT, uplo, NORMAL, A, householderScalars, QSub );
+      };
     {
         // Redistribute Q piece-by-piece in place. This is to keep the
         // send/recv buffer memory usage low.
@@ -972,6 +1008,11 @@ MRRR
             const Int localWidth = nb/p;
             readBuffer = &readBuffer[localWidth*n];
             alignment = (alignment+nb) % p;
+
+            // The back-transformation only overwrites the [MC,MR] data of
+            // this panel, which precedes the [* ,VR] data still to be read
+            if( ctrl.pipelineBacktransform )
+                backtransform( Q1 );
         }
     }
     Q.Resize( n, k ); // We can simply shrink matrices
@@ -982,16 +1023,22 @@ MRRR
         mpi::Barrier( A.DistComm() );
         if( A.Grid().Rank() == 0 )
         {
-            Output("  Redist:        ",timer.Stop()," secs");
+            if( ctrl.pipelineBacktransform )
+                Output("  Redist+Backtransform: ",timer.Stop()," secs");
+            else
+                Output("  Redist:        ",timer.Stop()," secs");
             timer.Start();
         }
     }
-    herm_tridiag::ApplyQ( LEFT, uplo, NORMAL, A, householderScalars, Q );
-    if( ctrl.timeStages )
+    if( !ctrl.pipelineBacktransform )
     {
-        mpi::Barrier( A.DistComm() );
-        if( A.Grid().Rank() == 0 )
-            Output("  Backtransform: ",timer.Stop()," secs");
+        backtransform( Q );
+        if( ctrl.timeStages )
+        {
+            mpi::Barrier( A.DistComm() );
+            if( A.Grid().Rank() == 0 )
+                Output("  Backtransform: ",timer.Stop()," secs");
+        }
     }
 
     return info;
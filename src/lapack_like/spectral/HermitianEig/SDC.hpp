@@ -140,6 +140,7 @@ RandomizedSignDivide
     auto S( G );
     PolarCtrl polarCtrl;
     polarCtrl.qdwh = true;
+    polarCtrl.qdwhCtrl = ctrl.qdwhCtrl;
     HermitianPolar( uplo, S, polarCtrl );
     ShiftDiagonal( S, F(1) );
     S *= F(1)/F(2);
@@ -210,7 +211,8 @@ RandomizedSignDivide
     auto S( G );
     PolarCtrl polarCtrl;
     polarCtrl.qdwh = true;
-    HermitianPolar( uplo, G, polarCtrl );
+    polarCtrl.qdwhCtrl = ctrl.qdwhCtrl;
+    HermitianPolar( uplo, S, polarCtrl );
     ShiftDiagonal( S, F(1) );
     S *= F(1)/F(2);
 
@@ -224,9 +226,9 @@ RandomizedSignDivide
         G = S;
 
         // Compute the RURV of the spectral projector
-        ImplicitHaar( V, t, d, n );
+        schur::ImplicitHaar( V, t, d, n, ctrl.qrCtrl );
         qr::ApplyQ( RIGHT, NORMAL, V, t, d, G );
-        El::QR( G, t, d );
+        El::QR( G, t, d, ctrl.qrCtrl );
 
         // A := Q^H A Q [and reuse space for V for keeping original A]
         V = A;
@@ -0,0 +1,237 @@
+/*
+   Copyright (c) 2009-2017, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+namespace El {
+
+namespace herm_eig {
+
+// Returns true if the subset is empty (in which case the query is trivial)
+template<typename Real>
+bool EmptySubset( const HermitianEigSubset<Real>& subset )
+{
+    EL_DEBUG_CSE
+    if( subset.indexSubset && subset.rangeSubset )
+        LogicError("Cannot mix index and range subsets");
+    return (subset.rangeSubset && (subset.lowerBound >= subset.upperBound)) ||
+           (subset.indexSubset && (subset.lowerIndex > subset.upperIndex));
+}
+
+} // namespace herm_eig
+
+template<typename F>
+HermitianEigFactorization<F>::HermitianEigFactorization
+( UpperOrLower uplo,
+  const Matrix<F>& A,
+  const HermitianTridiagCtrl<F>& ctrl )
+{
+    EL_DEBUG_CSE
+    Initialize( uplo, A, ctrl );
+}
+
+template<typename F>
+void HermitianEigFactorization<F>::Initialize
+( UpperOrLower uplo,
+  const Matrix<F>& A,
+  const HermitianTridiagCtrl<F>& ctrl )
+{
+    EL_DEBUG_CSE
+    if( A.Height() != A.Width() )
+        LogicError("Hermitian matrices must be square");
+    initialized_ = false;
+    uplo_ = uplo;
+    twoStage_ = ctrl.twoStage;
+
+    A_ = A;
+    if( twoStage_ )
+        herm_tridiag::TwoStage
+        ( uplo, A_, twoStageReflectors_, ctrl.bandwidth );
+    else
+        HermitianTridiag( uplo, A_, householderScalars_ );
+    d_ = GetRealPartOfDiagonal( A_ );
+    dSub_ = GetDiagonal( A_, (uplo==LOWER?-1:1) );
+
+    initialized_ = true;
+}
+
+template<typename F>
+HermitianTridiagEigInfo HermitianEigFactorization<F>::Eigenvalues
+( Matrix<Base<F>>& w,
+  const HermitianTridiagEigCtrl<Base<F>>& ctrl ) const
+{
+    EL_DEBUG_CSE
+    if( !initialized_ )
+        LogicError("Initialize must be called before Eigenvalues");
+    if( herm_eig::EmptySubset( ctrl.subset ) )
+    {
+        w.Resize( 0, 1 );
+        return HermitianTridiagEigInfo();
+    }
+    return HermitianTridiagEig( d_, dSub_, w, ctrl );
+}
+
+template<typename F>
+HermitianTridiagEigInfo HermitianEigFactorization<F>::Eigenpairs
+( Matrix<Base<F>>& w,
+  Matrix<F>& Q,
+  const HermitianTridiagEigCtrl<Base<F>>& ctrl ) const
+{
+    EL_DEBUG_CSE
+    if( !initialized_ )
+        LogicError("Initialize must be called before Eigenpairs");
+    if( herm_eig::EmptySubset( ctrl.subset ) )
+    {
+        w.Resize( 0, 1 );
+        Q.Resize( Height(), 0 );
+        return HermitianTridiagEigInfo();
+    }
+
+    // Only the eigenvectors of T which were requested are back-transformed
+    auto ctrlMod( ctrl );
+    ctrlMod.wantEigVecs = true;
+    ctrlMod.accumulateEigVecs = false;
+    auto info = HermitianTridiagEig( d_, dSub_, w, Q, ctrlMod );
+    BackTransform( Q );
+    return info;
+}
+
+template<typename F>
+void HermitianEigFactorization<F>::BackTransform( Matrix<F>& Z ) const
+{
+    EL_DEBUG_CSE
+    if( !initialized_ )
+        LogicError("Initialize must be called before BackTransform");
+    if( Z.Height() != Height() )
+        LogicError("Z was ",Z.Height()," x ",Z.Width()," but A was ",
+                   Height()," x ",Height());
+    if( twoStage_ )
+        herm_tridiag::ApplyTwoStageQ( A_, twoStageReflectors_, Z );
+    else
+        herm_tridiag::ApplyQ
+        ( LEFT, uplo_, NORMAL, A_, householderScalars_, Z );
+}
+
+template<typename F>
+DistHermitianEigFactorization<F>::DistHermitianEigFactorization
+( UpperOrLower uplo,
+  const AbstractDistMatrix<F>& A,
+  const HermitianTridiagCtrl<F>& ctrl )
+{
+    EL_DEBUG_CSE
+    Initialize( uplo, A, ctrl );
+}
+
+template<typename F>
+void DistHermitianEigFactorization<F>::Initialize
+( UpperOrLower uplo,
+  const AbstractDistMatrix<F>& A,
+  const HermitianTridiagCtrl<F>& ctrl )
+{
+    EL_DEBUG_CSE
+    if( A.Height() != A.Width() )
+        LogicError("Hermitian matrices must be square");
+    const El::Grid& g = A.Grid();
+    initialized_ = false;
+    uplo_ = uplo;
+    twoStage_ = ctrl.twoStage;
+
+    A_.SetGrid( g );
+    householderScalars_.SetGrid( g );
+    d_.SetGrid( g );
+    dSub_.SetGrid( g );
+
+    Copy( A, A_ );
+    if( twoStage_ )
+        herm_tridiag::TwoStage
+        ( uplo, A_, twoStageReflectors_, ctrl.bandwidth );
+    else
+        HermitianTridiag( uplo, A_, householderScalars_, ctrl );
+
+    // Replicate T once rather than within each query
+    Copy( GetRealPartOfDiagonal(A_), d_ );
+    Copy( GetDiagonal(A_,(uplo==LOWER?-1:1)), dSub_ );
+
+    initialized_ = true;
+}
+
+template<typename F>
+HermitianTridiagEigInfo DistHermitianEigFactorization<F>::Eigenvalues
+( AbstractDistMatrix<Base<F>>& w,
+  const HermitianTridiagEigCtrl<Base<F>>& ctrl ) const
+{
+    EL_DEBUG_CSE
+    if( !initialized_ )
+        LogicError("Initialize must be called before Eigenvalues");
+    if( herm_eig::EmptySubset( ctrl.subset ) )
+    {
+        w.SetGrid( Grid() );
+        w.Resize( 0, 1 );
+        return HermitianTridiagEigInfo();
+    }
+    return HermitianTridiagEig( d_, dSub_, w, ctrl );
+}
+
+template<typename F>
+HermitianTridiagEigInfo DistHermitianEigFactorization<F>::Eigenpairs
+( AbstractDistMatrix<Base<F>>& w,
+  AbstractDistMatrix<F>& QPre,
+  const HermitianTridiagEigCtrl<Base<F>>& ctrl ) const
+{
+    EL_DEBUG_CSE
+    if( !initialized_ )
+        LogicError("Initialize must be called before Eigenpairs");
+    if( herm_eig::EmptySubset( ctrl.subset ) )
+    {
+        w.SetGrid( Grid() );
+        w.Resize( 0, 1 );
+        QPre.SetGrid( Grid() );
+        QPre.Resize( Height(), 0 );
+        return HermitianTridiagEigInfo();
+    }
+
+    DistMatrixWriteProxy<F,F,MC,MR> QProx( QPre );
+    auto& Q = QProx.Get();
+
+    auto ctrlMod( ctrl );
+    ctrlMod.wantEigVecs = true;
+    ctrlMod.accumulateEigVecs = false;
+    auto info = HermitianTridiagEig( d_, dSub_, w, Q, ctrlMod );
+    BackTransform( Q );
+    return info;
+}
+
+template<typename F>
+void DistHermitianEigFactorization<F>::BackTransform
+( AbstractDistMatrix<F>& Z ) const
+{
+    EL_DEBUG_CSE
+    if( !initialized_ )
+        LogicError("Initialize must be called before BackTransform");
+    if( Z.Height() != Height() )
+        LogicError("Z was ",Z.Height()," x ",Z.Width()," but A was ",
+                   Height()," x ",Height());
+    if( twoStage_ )
+        herm_tridiag::ApplyTwoStageQ( A_, twoStageReflectors_, Z );
+    else
+        herm_tridiag::ApplyQ
+        ( LEFT, uplo_, NORMAL, A_, householderScalars_, Z );
+}
+
+#define PROTO(F) \
+  template class HermitianEigFactorization<F>; \
+  template class DistHermitianEigFactorization<F>;
+
+#define EL_NO_INT_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
@@ -10,6 +10,7 @@
 
 #include "./HermitianTridiagEig/QR.hpp"
 #include "./HermitianTridiagEig/DivideAndConquer.hpp"
+#include "./HermitianTridiagEig/Bisection.hpp"
 
 // NOTE: dSubReal and QReal could be packed into their complex counterparts
 
@@ -447,6 +448,105 @@ Helper
     return HermitianTridiagEig( d, dSubReal, w, ctrl );
 }
 
+// Distributed bisection (with inverse iteration for the eigenvectors)
+// --------------------------------------------------------------------
+// The O(n) tridiagonal is replicated and each process computes a contiguous
+// piece of the requested index range, so that only the final eigenvalues
+// (and eigenvectors) are communicated.
+
+template<typename Real>
+HermitianTridiagEigInfo
+BisectionHelper
+( const AbstractDistMatrix<Real>& d,
+  const AbstractDistMatrix<Real>& dSub,
+        AbstractDistMatrix<Real>& w,
+  const HermitianTridiagEigCtrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    HermitianTridiagEigInfo info;
+    DistMatrix<Real,STAR,STAR> d_STAR_STAR(d), dSub_STAR_STAR(dSub);
+
+    bisection::Tridiag<Real> T;
+    bisection::Initialize( d_STAR_STAR.Matrix(), dSub_STAR_STAR.Matrix(), T );
+    Int beg, end;
+    bisection::IndexRange( T, ctrl.subset, beg, end );
+    vector<Real> wVector;
+    bisection::DistEigenvalues( T, beg, end, d.Grid(), wVector );
+    bisection::StoreEigenvalues( wVector, ctrl.sort, w );
+    return info;
+}
+
+template<typename Real>
+HermitianTridiagEigInfo
+BisectionHelper
+( const AbstractDistMatrix<Real         >& d,
+  const AbstractDistMatrix<Complex<Real>>& dSub,
+        AbstractDistMatrix<Real         >& w,
+  const HermitianTridiagEigCtrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    const Grid& g = d.Grid();
+    DistMatrix<Complex<Real>,STAR,STAR> dSub_STAR_STAR( dSub );
+    DistMatrix<Real,STAR,STAR> dSubReal(g);
+    RemovePhase( dSub_STAR_STAR, dSubReal );
+    return BisectionHelper( d, dSubReal, w, ctrl );
+}
+
+template<typename Real>
+HermitianTridiagEigInfo
+BisectionHelper
+( const AbstractDistMatrix<Real>& d,
+  const AbstractDistMatrix<Real>& dSub,
+        AbstractDistMatrix<Real>& w,
+        AbstractDistMatrix<Real>& Q,
+  const HermitianTridiagEigCtrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    HermitianTridiagEigInfo info;
+    DistMatrix<Real,STAR,STAR> d_STAR_STAR(d), dSub_STAR_STAR(dSub);
+
+    bisection::Tridiag<Real> T;
+    bisection::Initialize( d_STAR_STAR.Matrix(), dSub_STAR_STAR.Matrix(), T );
+    Int beg, end;
+    bisection::IndexRange( T, ctrl.subset, beg, end );
+    vector<Real> wVector;
+    bisection::DistEigenvalues( T, beg, end, d.Grid(), wVector );
+    bisection::StoreEigenvalues( wVector, ctrl.sort, w );
+    Matrix<Real> phase;
+    bisection::DistEigenvectors( T, wVector, ctrl.sort, phase, Q );
+    return info;
+}
+
+template<typename Real>
+HermitianTridiagEigInfo
+BisectionHelper
+( const AbstractDistMatrix<Real         >& d,
+  const AbstractDistMatrix<Complex<Real>>& dSub,
+        AbstractDistMatrix<Real         >& w,
+        AbstractDistMatrix<Complex<Real>>& Q,
+  const HermitianTridiagEigCtrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    HermitianTridiagEigInfo info;
+    const Grid& g = d.Grid();
+    DistMatrix<Real,STAR,STAR> d_STAR_STAR( d );
+    DistMatrix<Complex<Real>,STAR,STAR> dSub_STAR_STAR( dSub );
+    DistMatrix<Real,STAR,STAR> dSubReal(g);
+    DistMatrix<Complex<Real>,STAR,STAR> phase(g);
+    RemovePhase( dSub_STAR_STAR, dSubReal, phase );
+
+    bisection::Tridiag<Real> T;
+    bisection::Initialize( d_STAR_STAR.Matrix(), dSubReal.Matrix(), T );
+    Int beg, end;
+    bisection::IndexRange( T, ctrl.subset, beg, end );
+    vector<Real> wVector;
+    bisection::DistEigenvalues( T, beg, end, g, wVector );
+    bisection::StoreEigenvalues( wVector, ctrl.sort, w );
+    bisection::DistEigenvectors
+    ( T, wVector, ctrl.sort, phase.LockedMatrix(), Q );
+    return info;
+}
+
 } // namespace herm_tridiag_eig
 
 template<typename F>
@@ -627,7 +727,11 @@ Helper
   const HermitianTridiagEigCtrl<Real>& ctrl )
 {
     EL_DEBUG_CSE
-    if( ctrl.alg == HERM_TRIDIAG_EIG_QR )
+    if( ctrl.alg == HERM_TRIDIAG_EIG_BISECTION )
+    {
+        return BisectionHelper( d, dSub, wPre, ctrl );
+    }
+    else if( ctrl.alg == HERM_TRIDIAG_EIG_QR )
     {
         return QRHelper( d, dSub, wPre, ctrl );
     }
@@ -652,7 +756,11 @@ Helper
   const HermitianTridiagEigCtrl<Real>& ctrl )
 {
     EL_DEBUG_CSE
-    if( ctrl.alg == HERM_TRIDIAG_EIG_QR )
+    if( ctrl.alg == HERM_TRIDIAG_EIG_BISECTION )
+    {
+        return BisectionHelper( d, dSub, w, ctrl );
+    }
+    else if( ctrl.alg == HERM_TRIDIAG_EIG_QR )
     {
         return QRHelper( d, dSub, w, ctrl );
     }
@@ -736,7 +844,11 @@ Helper
   const HermitianTridiagEigCtrl<Real>& ctrl )
 {
     EL_DEBUG_CSE
-    if( ctrl.alg == HERM_TRIDIAG_EIG_QR )
+    if( ctrl.alg == HERM_TRIDIAG_EIG_BISECTION )
+    {
+        return BisectionHelper( d, dSub, wPre, ctrl );
+    }
+    else if( ctrl.alg == HERM_TRIDIAG_EIG_QR )
     {
         return QRHelper( d, dSub, wPre, ctrl );
     }
@@ -761,7 +873,11 @@ Helper
   const HermitianTridiagEigCtrl<Real>& ctrl )
 {
     EL_DEBUG_CSE
-    if( ctrl.alg == HERM_TRIDIAG_EIG_QR )
+    if( ctrl.alg == HERM_TRIDIAG_EIG_BISECTION )
+    {
+        return BisectionHelper( d, dSub, w, ctrl );
+    }
+    else if( ctrl.alg == HERM_TRIDIAG_EIG_QR )
     {
         return QRHelper( d, dSub, w, ctrl );
     }
@@ -1336,7 +1452,11 @@ Helper
   const HermitianTridiagEigCtrl<Real>& ctrl )
 {
     EL_DEBUG_CSE
-    if( ctrl.alg == HERM_TRIDIAG_EIG_QR )
+    if( ctrl.alg == HERM_TRIDIAG_EIG_BISECTION )
+    {
+        return BisectionHelper( d, dSub, w, Q, ctrl );
+    }
+    else if( ctrl.alg == HERM_TRIDIAG_EIG_QR )
     {
         return QRHelper( d, dSub, w, Q, ctrl );
     }
@@ -1362,7 +1482,11 @@ Helper
   const HermitianTridiagEigCtrl<Real>& ctrl )
 {
     EL_DEBUG_CSE
-    if( ctrl.alg == HERM_TRIDIAG_EIG_QR )
+    if( ctrl.alg == HERM_TRIDIAG_EIG_BISECTION )
+    {
+        return BisectionHelper( d, dSub, w, Q, ctrl );
+    }
+    else if( ctrl.alg == HERM_TRIDIAG_EIG_QR )
     {
         return QRHelper( d, dSub, w, Q, ctrl );
     }
@@ -1383,7 +1507,11 @@ Helper
   const HermitianTridiagEigCtrl<Real>& ctrl )
 {
     EL_DEBUG_CSE
-    if( ctrl.alg == HERM_TRIDIAG_EIG_QR )
+    if( ctrl.alg == HERM_TRIDIAG_EIG_BISECTION )
+    {
+        return BisectionHelper( d, dSub, w, Q, ctrl );
+    }
+    else if( ctrl.alg == HERM_TRIDIAG_EIG_QR )
     {
         return QRHelper( d, dSub, w, Q, ctrl );
     }
@@ -1409,7 +1537,11 @@ Helper
   const HermitianTridiagEigCtrl<Real>& ctrl )
 {
     EL_DEBUG_CSE
-    if( ctrl.alg == HERM_TRIDIAG_EIG_QR )
+    if( ctrl.alg == HERM_TRIDIAG_EIG_BISECTION )
+    {
+        return BisectionHelper( d, dSub, w, QPre, ctrl );
+    }
+    else if( ctrl.alg == HERM_TRIDIAG_EIG_QR )
     {
         return QRHelper( d, dSub, w, QPre, ctrl );
     }
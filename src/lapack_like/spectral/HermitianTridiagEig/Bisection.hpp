@@ -0,0 +1,449 @@
+/*
+   Copyright (c) 2009-2017, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_HERM_TRIDIAG_EIG_BISECTION_HPP
+#define EL_HERM_TRIDIAG_EIG_BISECTION_HPP
+
+namespace El {
+namespace herm_tridiag_eig {
+namespace bisection {
+
+// The (replicated) real symmetric tridiagonal matrix with diagonal d and
+// subdiagonal e, along with the quantities needed by Sturm sequences
+template<typename Real>
+struct Tridiag
+{
+    Int n=0;
+    vector<Real> d, e, eSq;
+    // The minimum allowable magnitude of a pivot of the LDL^T factorization
+    Real pivMin;
+    // A (slightly widened) Gershgorin interval containing the spectrum
+    Real lowerBound, upperBound;
+    // max(|lowerBound|,|upperBound|), or one if T is zero
+    Real norm;
+};
+
+template<typename Real>
+void Initialize
+( const Matrix<Real>& d, const Matrix<Real>& e, Tridiag<Real>& T )
+{
+    EL_DEBUG_CSE
+    const Int n = d.Height();
+    const Real eps = limits::Epsilon<Real>();
+    T.n = n;
+    T.d.resize( n );
+    T.e.resize( Max(n-1,Int(0)) );
+    T.eSq.resize( Max(n-1,Int(0)) );
+    Real maxESq = 1;
+    for( Int i=0; i<n; ++i )
+        T.d[i] = d(i);
+    for( Int i=0; i<n-1; ++i )
+    {
+        T.e[i] = e(i);
+        T.eSq[i] = e(i)*e(i);
+        maxESq = Max( maxESq, T.eSq[i] );
+    }
+    T.pivMin = limits::SafeMin<Real>()*maxESq;
+
+    Real lowerBound = ( n > 0 ? T.d[0] : Real(0) );
+    Real upperBound = lowerBound;
+    for( Int i=0; i<n; ++i )
+    {
+        const Real radius =
+          ( i > 0 ? Abs(T.e[i-1]) : Real(0) ) +
+          ( i < n-1 ? Abs(T.e[i]) : Real(0) );
+        lowerBound = Min( lowerBound, T.d[i]-radius );
+        upperBound = Max( upperBound, T.d[i]+radius );
+    }
+    T.norm = Max( Abs(lowerBound), Abs(upperBound) );
+    if( T.norm == Real(0) )
+        T.norm = 1;
+    // Cf. LAPACK's {s,d}stebz
+    const Real fudge = 2*eps*T.norm*n + 2*T.pivMin;
+    T.lowerBound = lowerBound - fudge;
+    T.upperBound = upperBound + fudge;
+}
+
+// Sets counts[s] to the number of eigenvalues less than shifts[s] using the
+// signs of the pivots of the LDL^T factorizations of T - shifts[s] I. Since
+// the inner loop runs over the shifts, a single pass over T serves every
+// shift and the (branch-free) recurrences vectorize.
+template<typename Real>
+void SturmCounts
+( const Tridiag<Real>& T, Int numShifts, const Real* shifts, Int* counts,
+  vector<Real>& pivots )
+{
+    const Int n = T.n;
+    if( n == 0 )
+    {
+        for( Int s=0; s<numShifts; ++s )
+            counts[s] = 0;
+        return;
+    }
+    const Real pivMin = T.pivMin;
+    pivots.resize( numShifts );
+    Real* pivotBuf = pivots.data();
+    for( Int s=0; s<numShifts; ++s )
+    {
+        Real pivot = T.d[0] - shifts[s];
+        pivot = ( Abs(pivot) < pivMin ? -pivMin : pivot );
+        pivotBuf[s] = pivot;
+        counts[s] = ( pivot < Real(0) ? 1 : 0 );
+    }
+    for( Int i=1; i<n; ++i )
+    {
+        const Real delta = T.d[i];
+        const Real epsSq = T.eSq[i-1];
+        for( Int s=0; s<numShifts; ++s )
+        {
+            Real pivot = (delta-shifts[s]) - epsSq/pivotBuf[s];
+            pivot = ( Abs(pivot) < pivMin ? -pivMin : pivot );
+            pivotBuf[s] = pivot;
+            counts[s] += ( pivot < Real(0) ? 1 : 0 );
+        }
+    }
+}
+
+template<typename Real>
+Int SturmCount( const Tridiag<Real>& T, const Real& shift )
+{
+    Int count;
+    vector<Real> pivots;
+    SturmCounts( T, 1, &shift, &count, pivots );
+    return count;
+}
+
+// Converts a subset specification into the (ascending) index range
+// [beg,end) of the requested eigenvalues
+template<typename Real>
+void IndexRange
+( const Tridiag<Real>& T, const HermitianEigSubset<Real>& subset,
+  Int& beg, Int& end )
+{
+    EL_DEBUG_CSE
+    if( subset.indexSubset )
+    {
+        beg = subset.lowerIndex;
+        end = subset.upperIndex+1;
+        if( beg < 0 || end > T.n || beg > end )
+            LogicError
+            ("Invalid index subset [",subset.lowerIndex,",",
+             subset.upperIndex,"] of ",T.n," eigenvalues");
+    }
+    else if( subset.rangeSubset )
+    {
+        // The eigenvalues in (lowerBound,upperBound]
+        beg = SturmCount( T, subset.lowerBound );
+        end = SturmCount( T, subset.upperBound );
+        end = Max( beg, end );
+    }
+    else
+    {
+        beg = 0;
+        end = T.n;
+    }
+}
+
+// Overwrites w[0], ..., w[end-beg-1] with eigenvalues beg, ..., end-1 (in
+// ascending order). All of the intervals are refined concurrently, with
+// one multi-shift Sturm pass per bisection step, until they are (relatively)
+// as narrow as a few ulps or O(eps ||T||).
+template<typename Real>
+void Bisect( const Tridiag<Real>& T, Int beg, Int end, Real* w )
+{
+    EL_DEBUG_CSE
+    const Int numEig = end - beg;
+    if( numEig <= 0 )
+        return;
+    const Real eps = limits::Epsilon<Real>();
+    const Real absTol = eps*T.norm;
+
+    vector<Real> lower( numEig, T.lowerBound ), upper( numEig, T.upperBound );
+    vector<Int> active( numEig );
+    for( Int k=0; k<numEig; ++k )
+        active[k] = k;
+    vector<Real> shifts, pivots;
+    vector<Int> counts;
+    while( !active.empty() )
+    {
+        const Int numActive = active.size();
+        shifts.resize( numActive );
+        counts.resize( numActive );
+        for( Int a=0; a<numActive; ++a )
+        {
+            const Int k = active[a];
+            shifts[a] = (lower[k]+upper[k])/2;
+        }
+        SturmCounts( T, numActive, shifts.data(), counts.data(), pivots );
+
+        Int numStillActive = 0;
+        for( Int a=0; a<numActive; ++a )
+        {
+            const Int k = active[a];
+            const Real& mid = shifts[a];
+            // Maintain count(lower) <= beg+k < count(upper)
+            if( counts[a] > beg+k )
+                upper[k] = mid;
+            else
+                lower[k] = mid;
+            const Real tol =
+              Max( absTol, 2*eps*Max(Abs(lower[k]),Abs(upper[k])) );
+            const Real newMid = (lower[k]+upper[k])/2;
+            const bool converged = upper[k]-lower[k] <= tol ||
+              newMid == lower[k] || newMid == upper[k];
+            if( !converged )
+                active[numStillActive++] = k;
+        }
+        active.resize( numStillActive );
+    }
+    for( Int k=0; k<numEig; ++k )
+        w[k] = (lower[k]+upper[k])/2;
+}
+
+// The clusters of (ascending) eigenvalues within which inverse iteration
+// reorthogonalizes, cf. LAPACK's {s,d}stein
+template<typename Real>
+Real ClusterTolerance( const Tridiag<Real>& T )
+{ return Real(1)/Real(1000)*T.norm; }
+
+// Computes an eigenvector z (of unit two-norm) of T for the eigenvalue
+// estimate 'lambda' via inverse iteration with the LU factorization (with
+// partial pivoting) of T - lambda I, orthogonalizing against the columns of
+// 'cluster' (the previously computed vectors of the same cluster)
+template<typename Real>
+void InverseIteration
+( const Tridiag<Real>& T, const Real& lambda,
+  const Matrix<Real>& cluster, Matrix<Real>& z )
+{
+    EL_DEBUG_CSE
+    const Int n = T.n;
+    const Int maxIts = 5;
+    const Real eps = limits::Epsilon<Real>();
+    const Real tiny = eps*T.norm;
+    // The growth of the solution which signals convergence
+    const Real targetGrowth = Sqrt(Real(1)/(10*n))/tiny;
+
+    // U has two superdiagonals due to the row interchanges
+    vector<Real> u0(n), u1(n,Real(0)), u2(n,Real(0)), mult(n,Real(0));
+    vector<char> swapped(n,0);
+    if( n > 0 )
+    {
+        Real cur0 = T.d[0] - lambda;
+        Real cur1 = ( n > 1 ? T.e[0] : Real(0) );
+        Real cur2 = 0;
+        for( Int k=0; k<n-1; ++k )
+        {
+            const Real next0 = T.e[k];
+            const Real next1 = T.d[k+1] - lambda;
+            const Real next2 = ( k+1 < n-1 ? T.e[k+1] : Real(0) );
+            if( Abs(cur0) >= Abs(next0) )
+            {
+                if( Abs(cur0) < tiny )
+                    cur0 = ( cur0 < Real(0) ? -tiny : tiny );
+                const Real gamma = next0/cur0;
+                u0[k] = cur0; u1[k] = cur1; u2[k] = cur2;
+                mult[k] = gamma;
+                cur0 = next1 - gamma*cur1;
+                cur1 = next2 - gamma*cur2;
+            }
+            else
+            {
+                const Real gamma = cur0/next0;
+                u0[k] = next0; u1[k] = next1; u2[k] = next2;
+                mult[k] = gamma;
+                swapped[k] = 1;
+                cur0 = cur1 - gamma*next1;
+                cur1 = cur2 - gamma*next2;
+            }
+            cur2 = 0;
+        }
+        if( Abs(cur0) < tiny )
+            cur0 = ( cur0 < Real(0) ? -tiny : tiny );
+        u0[n-1] = cur0;
+    }
+
+    z.Resize( n, 1 );
+    for( Int i=0; i<n; ++i )
+        z(i) = SampleUniform( Real(-1), Real(1) );
+    const Int numCluster = cluster.Width();
+    for( Int it=0; it<maxIts; ++it )
+    {
+        // Normalize the right-hand side and solve (T - lambda I) y = z
+        const Real zNorm = FrobeniusNorm( z );
+        if( zNorm == Real(0) )
+            z(Min(Int(it),n-1)) = 1;
+        else
+            z *= Real(1)/zNorm;
+        for( Int k=0; k<n-1; ++k )
+        {
+            if( swapped[k] )
+                std::swap( z(k), z(k+1) );
+            z(k+1) -= mult[k]*z(k);
+        }
+        for( Int k=n-1; k>=0; --k )
+        {
+            Real zeta = z(k);
+            if( k+1 < n )
+                zeta -= u1[k]*z(k+1);
+            if( k+2 < n )
+                zeta -= u2[k]*z(k+2);
+            z(k) = zeta/u0[k];
+        }
+
+        // Classical Gram-Schmidt (twice) against the cluster
+        for( Int pass=0; pass<2 && numCluster>0; ++pass )
+        {
+            Matrix<Real> coeffs;
+            Gemv( TRANSPOSE, Real(1), cluster, z, coeffs );
+            Gemv( NORMAL, Real(-1), cluster, coeffs, Real(1), z );
+        }
+        if( FrobeniusNorm(z) >= targetGrowth )
+            break;
+    }
+    const Real zNorm = FrobeniusNorm( z );
+    if( zNorm > Real(0) )
+        z *= Real(1)/zNorm;
+}
+
+// Partitions [0,k) into numProcs contiguous chunks of nearly equal size
+// whose boundaries do not split clusters of the (ascending) eigenvalues w,
+// returning the first index of each of them (followed by k)
+template<typename Real>
+vector<Int> ClusterPartition
+( const vector<Real>& w, Real clusterTol, int numProcs )
+{
+    const Int k = w.size();
+    vector<Int> offsets( numProcs+1 );
+    offsets[0] = 0;
+    for( int q=1; q<=numProcs; ++q )
+    {
+        Int j = Max( offsets[q-1], (q*k)/numProcs );
+        while( j > 0 && j < k && w[j]-w[j-1] <= clusterTol )
+            ++j;
+        offsets[q] = ( q == numProcs ? k : j );
+    }
+    return offsets;
+}
+
+// Computes the requested eigenvalues with the index range split evenly over
+// the processes of the grid and gathers them (in ascending order) into w,
+// which is returned on every process
+template<typename Real>
+void DistEigenvalues
+( const Tridiag<Real>& T, Int beg, Int end, const Grid& g, vector<Real>& w )
+{
+    EL_DEBUG_CSE
+    const Int k = end - beg;
+    const int numProcs = g.Size();
+    const int rank = g.VCRank();
+    vector<int> counts( numProcs ), offsets( numProcs );
+    for( int q=0; q<numProcs; ++q )
+    {
+        offsets[q] = (q*k)/numProcs;
+        counts[q] = ((q+1)*k)/numProcs - offsets[q];
+    }
+    vector<Real> wLoc( counts[rank] );
+    Bisect( T, beg+offsets[rank], beg+offsets[rank]+counts[rank],
+            wLoc.data() );
+    w.resize( k );
+    mpi::AllGather
+    ( wLoc.data(), counts[rank], w.data(), counts.data(), offsets.data(),
+      g.VCComm() );
+}
+
+// Sets each column of Z to the eigenvector (from inverse iteration) of the
+// corresponding (ascending) eigenvalue in w
+template<typename Real>
+void LocalEigenvectors
+( const Tridiag<Real>& T, const Real* w, Int numEig, Real clusterTol,
+  Matrix<Real>& Z )
+{
+    EL_DEBUG_CSE
+    const Int n = T.n;
+    // Cf. LAPACK's {s,d}stein
+    const Real perturbTol = 10*limits::Epsilon<Real>()*T.norm;
+    Zeros( Z, n, numEig );
+    Int clusterBeg = 0;
+    Real lambdaPrev = 0;
+    Matrix<Real> z;
+    for( Int j=0; j<numEig; ++j )
+    {
+        Real lambda = w[j];
+        if( j > 0 && w[j]-w[j-1] <= clusterTol )
+        {
+            // Separate the shifts of (nearly) equal eigenvalues
+            if( lambda-lambdaPrev < perturbTol )
+                lambda = lambdaPrev + perturbTol;
+        }
+        else
+            clusterBeg = j;
+        auto cluster = Z( ALL, IR(clusterBeg,j) );
+        InverseIteration( T, lambda, cluster, z );
+        auto zj = Z( ALL, IR(j) );
+        zj = z;
+        lambdaPrev = lambda;
+    }
+}
+
+// Stores the (ascending, replicated) eigenvalues in the requested order
+template<typename Real>
+void StoreEigenvalues
+( const vector<Real>& w, SortType sort, AbstractDistMatrix<Real>& wPre )
+{
+    EL_DEBUG_CSE
+    const Int k = w.size();
+    DistMatrix<Real,STAR,STAR> w_STAR_STAR( k, 1, wPre.Grid() );
+    auto& wLoc = w_STAR_STAR.Matrix();
+    for( Int j=0; j<k; ++j )
+        wLoc(j) = ( sort == DESCENDING ? w[k-1-j] : w[j] );
+    Copy( w_STAR_STAR, wPre );
+}
+
+// Each process computes the eigenvectors of a contiguous set of clusters of
+// the (ascending, replicated) eigenvalues w, which are then scaled by the
+// phases of the unitary similarity (if 'phase' is nonempty) and scattered
+// into Q in the requested order
+template<typename Real,typename F>
+void DistEigenvectors
+( const Tridiag<Real>& T, const vector<Real>& w, SortType sort,
+  const Matrix<F>& phase, AbstractDistMatrix<F>& Q )
+{
+    EL_DEBUG_CSE
+    const Int n = T.n;
+    const Int k = w.size();
+    const Grid& g = Q.Grid();
+    const Real clusterTol = ClusterTolerance( T );
+    auto offsets = ClusterPartition( w, clusterTol, g.Size() );
+    const Int jBeg = offsets[g.VCRank()];
+    const Int jEnd = offsets[g.VCRank()+1];
+
+    Matrix<Real> Z;
+    LocalEigenvectors( T, w.data()+jBeg, jEnd-jBeg, clusterTol, Z );
+
+    const bool applyPhase = ( phase.Height() == n );
+    Zeros( Q, n, k );
+    Q.Reserve( n*(jEnd-jBeg) );
+    for( Int j=jBeg; j<jEnd; ++j )
+    {
+        const Int jSorted = ( sort == DESCENDING ? k-1-j : j );
+        for( Int i=0; i<n; ++i )
+        {
+            F value = Z(i,j-jBeg);
+            if( applyPhase )
+                value *= phase(i);
+            Q.QueueUpdate( i, jSorted, value );
+        }
+    }
+    Q.ProcessQueues();
+}
+
+} // namespace bisection
+} // namespace herm_tridiag_eig
+} // namespace El
+
+#endif // ifndef EL_HERM_TRIDIAG_EIG_BISECTION_HPP
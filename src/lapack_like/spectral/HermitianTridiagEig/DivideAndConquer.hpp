@@ -16,6 +16,93 @@ using El::schur::SplitGrid;
 namespace El {
 namespace herm_tridiag_eig {
 
+// Solve the secular equation for the undeflated roots with global indices
+// colShift + jLoc*colStride, storing root j in roots(jLoc) and dUndeflated
+// minus it in column jLoc of 'minusShifts' before multiplying the
+// corresponding factors into the corrected update vector. The roots are
+// independent and so are solved concurrently when threads are available,
+// whereas the factors are accumulated in the original order so that the
+// result does not depend upon the number of threads.
+template<typename Real>
+void SolveSecularEquations
+( const Matrix<Real>& dUndeflated,
+  const Real& rho,
+  const Matrix<Real>& zUndeflated,
+        Int colShift,
+        Int colStride,
+        Matrix<Real>& roots,
+        Matrix<Real>& minusShifts,
+        Matrix<Real>& rCorrected,
+        SecularEVDInfo& secularInfo,
+  const DCCtrl<Real>& dcCtrl,
+        bool progress )
+{
+    EL_DEBUG_CSE
+    const Int numUndeflated = dUndeflated.Height();
+    const Int numLoc = minusShifts.Width();
+    Int numIterations=0, numAlternations=0,
+        numCubicIterations=0, numCubicFailures=0;
+    std::exception_ptr exception;
+#ifdef EL_HYBRID
+    const bool parallel = IsBlasScalar<Real>::value && !progress &&
+      !dcCtrl.secularCtrl.progress &&
+      numUndeflated >= dcCtrl.parallelSecularCutoff;
+    #pragma omp parallel for if(parallel) schedule(dynamic) \
+      reduction(+:numIterations,numAlternations,\
+                  numCubicIterations,numCubicFailures)
+#endif
+    for( Int jLoc=0; jLoc<numLoc; ++jLoc )
+    {
+        const Int j = colShift + jLoc*colStride;
+        try
+        {
+            auto minusShift = minusShifts( ALL, IR(jLoc) );
+            auto valueInfo =
+              SecularEigenvalue
+              ( j, dUndeflated, rho, zUndeflated, roots(jLoc), minusShift,
+                dcCtrl.secularCtrl );
+            if( progress )
+                Output("Secular eigenvalue ",j," is ",roots(jLoc));
+            numIterations += valueInfo.numIterations;
+            numAlternations += valueInfo.numAlternations;
+            numCubicIterations += valueInfo.numCubicIterations;
+            numCubicFailures += valueInfo.numCubicFailures;
+        }
+        catch( ... )
+        {
+#ifdef EL_HYBRID
+            #pragma omp critical
+#endif
+            {
+                if( exception == nullptr )
+                    exception = std::current_exception();
+            }
+        }
+    }
+    if( exception != nullptr )
+        std::rethrow_exception( exception );
+    secularInfo.numIterations += numIterations;
+    secularInfo.numAlternations += numAlternations;
+    secularInfo.numCubicIterations += numCubicIterations;
+    secularInfo.numCubicFailures += numCubicFailures;
+
+#ifdef EL_HYBRID
+    #pragma omp parallel for if(parallel)
+#endif
+    for( Int k=0; k<numUndeflated; ++k )
+    {
+        for( Int jLoc=0; jLoc<numLoc; ++jLoc )
+        {
+            const Int j = colShift + jLoc*colStride;
+            if( k == j )
+                rCorrected(k) *= minusShifts(k,jLoc);
+            else
+                rCorrected(k) *=
+                  minusShifts(k,jLoc) / (dUndeflated(j)-dUndeflated(k));
+        }
+    }
+}
+
 // The following is analogous to LAPACK's {s,d}laed{1,2,3} [CITATION] but does
 // not accept initial sorting permutations for w0 and w1, nor does it enforce
 // any ordering on the resulting eigenvalues.
@@ -431,29 +518,11 @@ Merge
     else
         QSecular.Resize( numUndeflated, numUndeflated );
 
-    for( Int j=0; j<numUndeflated; ++j )
     {
-        auto minusShift = QSecular( ALL, IR(j) );
-
-        auto valueInfo =
-          SecularEigenvalue
-          ( j, dUndeflated, rho, zUndeflated, d(j), minusShift,
-            dcCtrl.secularCtrl );
-        if( ctrl.progress )
-            Output("Secular eigenvalue ",j," is ",d(j));
-
-        secularInfo.numIterations += valueInfo.numIterations;
-        secularInfo.numAlternations += valueInfo.numAlternations;
-        secularInfo.numCubicIterations += valueInfo.numCubicIterations;
-        secularInfo.numCubicFailures += valueInfo.numCubicFailures;
-
-        rCorrected(j) *= minusShift(j);
-        for( Int k=0; k<numUndeflated; ++k )
-        {
-            if( k == j )
-                continue;
-            rCorrected(k) *= minusShift(k) / (dUndeflated(j)-dUndeflated(k));
-        }
+        auto dSecular = d( undeflatedInd, ALL );
+        SolveSecularEquations
+        ( dUndeflated, rho, zUndeflated, 0, 1, dSecular, QSecular,
+          rCorrected, secularInfo, dcCtrl, ctrl.progress );
     }
     for( Int j=0; j<numUndeflated; ++j )
         rCorrected(j) = Sgn(zUndeflated(j),false) * Sqrt(Abs(rCorrected(j)));
@@ -974,32 +1043,12 @@ Merge
     auto& QSecularLoc = QSecular.Matrix();
 
     const Int numUndeflatedLoc = QSecularLoc.Width();
-    for( Int jLoc=0; jLoc<numUndeflatedLoc; ++jLoc )
-    {
-        const Int j = QSecular.GlobalCol(jLoc);
-        auto minusShift = QSecularLoc( ALL, IR(jLoc) );
-
-        auto valueInfo =
-          SecularEigenvalue
-          ( j, dUndeflated, rho, zUndeflated, dSecularLoc(jLoc),
-            minusShift, dcCtrl.secularCtrl );
-        if( ctrl.progress && amRoot )
-            Output("Secular eigenvalue ",j," is ",dSecularLoc(jLoc));
-
-        // We will sum these across all of the processors at the top-level
-        secularInfo.numIterations += valueInfo.numIterations;
-        secularInfo.numAlternations += valueInfo.numAlternations;
-        secularInfo.numCubicIterations += valueInfo.numCubicIterations;
-        secularInfo.numCubicFailures += valueInfo.numCubicFailures;
-
-        rCorrected(j) *= minusShift(j);
-        for( Int k=0; k<numUndeflated; ++k )
-        {
-            if( k == j )
-                continue;
-            rCorrected(k) *= minusShift(k) / (dUndeflated(j)-dUndeflated(k));
-        }
-    }
+    // We will sum the secular info across all of the processors at the
+    // top-level
+    SolveSecularEquations
+    ( dUndeflated, rho, zUndeflated, QSecular.RowShift(), QSecular.RowStride(),
+      dSecularLoc, QSecularLoc, rCorrected, secularInfo, dcCtrl,
+      ctrl.progress && amRoot );
     AllReduce( rCorrected, g.VRComm(), mpi::PROD );
     for( Int j=0; j<numUndeflated; ++j )
         rCorrected(j) = Sgn(zUndeflated(j),false) * Sqrt(Abs(rCorrected(j)));
@@ -88,20 +88,18 @@ Real WilkinsonShift
 // 't' for both the safe computation of 'e_i' and for 't_i'.
 //
 // TODO(poulson): Introduce [winBeg,winEnd) to avoid parent allocation
-template<typename Field>
+template<typename Real>
 void QLSweep
-( Matrix<Base<Field>>& d,
-  Matrix<Base<Field>>& e,
-  Matrix<Base<Field>>& cList,
-  Matrix<Base<Field>>& sList,
-  Matrix<Field>& Q,
-  const Base<Field>& shift,
+( Matrix<Real>& d,
+  Matrix<Real>& e,
+  Matrix<Real>& cList,
+  Matrix<Real>& sList,
+  const Real& shift,
   bool wantEigVecs )
 {
     EL_DEBUG_CSE
-    typedef Base<Field> Real;
     const Int n = d.Height();
-    const Real zero(0), one(1), two(2);
+    const Real zero(0), two(2);
     if( wantEigVecs )
     {
         cList.Resize( n-1, 1 );
@@ -134,27 +132,20 @@ void QLSweep
     }
     d(0) -= u;
     e(0) = g;
-    if( wantEigVecs )
-    {
-        ApplyGivensSequence
-        ( RIGHT, VARIABLE_GIVENS_SEQUENCE, BACKWARD, cList, sList, Q );
-    }
 }
 
-template<typename Field>
+template<typename Real>
 void QRSweep
-( Matrix<Base<Field>>& d,
-  Matrix<Base<Field>>& e,
-  Matrix<Base<Field>>& cList,
-  Matrix<Base<Field>>& sList,
-  Matrix<Field>& Q,
-  const Base<Field>& shift,
+( Matrix<Real>& d,
+  Matrix<Real>& e,
+  Matrix<Real>& cList,
+  Matrix<Real>& sList,
+  const Real& shift,
   bool wantEigVecs )
 {
     EL_DEBUG_CSE
-    typedef Base<Field> Real;
     const Int n = d.Height();
-    const Real zero(0), one(1), two(2);
+    const Real zero(0), two(2);
     cList.Resize( n-1, 1 );
     sList.Resize( n-1, 1 );
 
@@ -184,11 +175,6 @@ void QRSweep
     }
     d(n-1) -= u;
     e(n-2) = g;
-    if( wantEigVecs )
-    {
-        ApplyGivensSequence
-        ( RIGHT, VARIABLE_GIVENS_SEQUENCE, FORWARD, cList, sList, Q );
-    }
 }
 
 // TODO(poulson): Support for what Parlett calls "ultimate shifts" in
@@ -208,7 +194,6 @@ Helper
     EL_DEBUG_CSE
     typedef Base<Field> Real;
     const Int n = d.Height();
-    const Int mQ = Q.Height();
     herm_tridiag_eig::QRInfo info;
 
     if( n <= 1 )
@@ -224,9 +209,26 @@ Helper
     const Real normMin = Sqrt(safeMin) / epsSquared;
     const Real normMax = Sqrt(safeMax) / Real(3);
 
-    Matrix<Real> cList(n-1,1), sList(n-1,1);
     Matrix<Real> dSub, eSub;
-    Matrix<Field> QSub;
+
+    // The rotations of the sweeps are batched so that they can be applied to
+    // the eigenvectors in cache-blocked passes
+    const Int batchSize = Max( ctrl.qrCtrl.rotationBatchSize, Int(1) );
+    vector<GivensSequence<Real>> rotations;
+    auto queueRotations = [&]( Int offset, ForwardOrBackward direction )
+      -> GivensSequence<Real>&
+    {
+        if( Int(rotations.size()) == batchSize )
+        {
+            ApplyGivensSequences( rotations, Q );
+            rotations.clear();
+        }
+        rotations.emplace_back();
+        auto& seq = rotations.back();
+        seq.offset = offset;
+        seq.direction = direction;
+        return seq;
+    };
 
     const Int maxIter = n*ctrl.qrCtrl.maxIterPerEig;
     Int winBeg = 0;
@@ -342,9 +344,12 @@ Helper
                         ( d(subWinBeg), e(subWinBeg), d(subWinBeg+1),
                           lambda0, lambda1, c, s,
                           ctrl.qrCtrl.fullAccuracyTwoByTwo );
-                        // Apply the Givens rotation from the right to Q
-                        blas::Rot
-                        ( mQ, &Q(0,subWinBeg), 1, &Q(0,subWinBeg+1), 1, c, s );
+                        // Queue the Givens rotation from the right to Q
+                        auto& seq = queueRotations( subWinBeg, FORWARD );
+                        seq.cList.Resize( 1, 1 );
+                        seq.sList.Resize( 1, 1 );
+                        seq.cList(0) = c;
+                        seq.sList(0) = s;
                     }
                     else
                     {
@@ -372,14 +377,18 @@ Helper
                 // of these views
                 View( dSub, d, IR(subWinBeg,iterEnd), ALL );
                 View( eSub, e, IR(subWinBeg,Min(iterEnd,n-1)), ALL );
+                Real shift = WilkinsonShift( dSub(0), eSub(0), dSub(1) );
                 if( ctrl.wantEigVecs )
                 {
-                    View( QSub, Q, ALL, IR(subWinBeg,iterEnd) );
+                    auto& seq = queueRotations( subWinBeg, BACKWARD );
+                    QLSweep
+                    ( dSub, eSub, seq.cList, seq.sList, shift, true );
+                }
+                else
+                {
+                    Matrix<Real> cList, sList;
+                    QLSweep( dSub, eSub, cList, sList, shift, false );
                 }
-
-                Real shift = WilkinsonShift( dSub(0), eSub(0), dSub(1) );
-                QLSweep
-                ( dSub, eSub, cList, sList, QSub, shift, ctrl.wantEigVecs );
             }
         }
         else
@@ -436,10 +445,12 @@ Helper
                         ( d(subWinEnd-2), e(subWinEnd-2), d(subWinEnd-1),
                           lambda0, lambda1, c, s,
                           ctrl.qrCtrl.fullAccuracyTwoByTwo );
-                        // Apply the Givens rotation from the right to Q
-                        blas::Rot
-                        ( mQ, &Q(0,subWinEnd-2), 1, &Q(0,subWinEnd-1), 1,
-                          c, s );
+                        // Queue the Givens rotation from the right to Q
+                        auto& seq = queueRotations( subWinEnd-2, FORWARD );
+                        seq.cList.Resize( 1, 1 );
+                        seq.sList.Resize( 1, 1 );
+                        seq.cList(0) = c;
+                        seq.sList(0) = s;
                     }
                     else
                     {
@@ -467,16 +478,20 @@ Helper
                 // of these views
                 View( dSub, d, IR(iterBeg,subWinEnd), ALL );
                 View( eSub, e, IR(iterBeg,Min(subWinEnd,n-1)), ALL );
-                if( ctrl.wantEigVecs )
-                {
-                    View( QSub, Q, ALL, IR(iterBeg,subWinEnd) );
-                }
-
                 Real shift =
                   WilkinsonShift
                   ( d(subWinEnd-1), e(subWinEnd-2), d(subWinEnd-2) );
-                QRSweep
-                ( dSub, eSub, cList, sList, QSub, shift, ctrl.wantEigVecs );
+                if( ctrl.wantEigVecs )
+                {
+                    auto& seq = queueRotations( iterBeg, FORWARD );
+                    QRSweep
+                    ( dSub, eSub, seq.cList, seq.sList, shift, true );
+                }
+                else
+                {
+                    Matrix<Real> cList, sList;
+                    QRSweep( dSub, eSub, cList, sList, shift, false );
+                }
             }
         }
 
@@ -496,9 +511,11 @@ Helper
             if( ctrl.qrCtrl.demandConverged )
                 RuntimeError
                 (info.numUnconverged," eigenvalues did not converge");
-            return info;
+            break;
         }
     }
+    if( ctrl.wantEigVecs )
+        ApplyGivensSequences( rotations, Q );
 
     return info;
 }
@@ -24,6 +24,7 @@ HessenbergSchur
   const HessenbergSchurCtrl& ctrl )
 {
     EL_DEBUG_CSE
+    EL_PROFILE_REGION("HessenbergSchur");
     const Int n = H.Height();
     auto ctrlMod( ctrl );
     ctrlMod.winBeg = ( ctrl.winBeg==END ? n : ctrl.winBeg );
@@ -187,6 +188,7 @@ HessenbergSchur
   const HessenbergSchurCtrl& ctrl )
 {
     EL_DEBUG_CSE
+    EL_PROFILE_REGION("HessenbergSchur");
     typedef Base<F> Real;
 
     DistMatrixReadWriteProxy<F,F,MC,MR,BLOCK> HProx( HPre );
@@ -248,6 +250,7 @@ HessenbergSchur
   const HessenbergSchurCtrl& ctrl )
 {
     EL_DEBUG_CSE
+    EL_PROFILE_REGION("HessenbergSchur");
     const Int n = H.Height();
     auto ctrlMod( ctrl );
     ctrlMod.winBeg = ( ctrl.winBeg==END ? n : ctrl.winBeg );
@@ -277,6 +280,7 @@ HessenbergSchur
   const HessenbergSchurCtrl& ctrl )
 {
     EL_DEBUG_CSE
+    EL_PROFILE_REGION("HessenbergSchur");
     typedef Base<F> Real;
 
     DistMatrixReadWriteProxy<F,F,MC,MR,BLOCK> HProx( HPre );
@@ -64,6 +64,7 @@ AED
   const HessenbergSchurCtrl& ctrl )
 {
     EL_DEBUG_CSE
+    EL_PROFILE_REGION("hess_schur::AED");
     const Int n = H.Height();
     const Int minMultiBulgeSize = Max( ctrl.minMultiBulgeSize, 4 );
     HessenbergSchurInfo info;
@@ -181,6 +182,7 @@ AED
   const HessenbergSchurCtrl& ctrl )
 {
     EL_DEBUG_CSE
+    EL_PROFILE_REGION("hess_schur::AED");
     const Int n = H.Height();
     const Int blockSize = H.BlockHeight();
     const Grid& grid = H.Grid();
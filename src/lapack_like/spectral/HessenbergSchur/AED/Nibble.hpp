@@ -15,61 +15,25 @@ namespace El {
 namespace hess_schur {
 namespace aed {
 
-// The spike value will be overwritten
+// Given the Schur decomposition H = V T V' of an AED window whose leading
+// 'numUnconverged' eigenvalues did not converge, deflate using the spike and
+// overwrite H with the reduced (Hessenberg) window
 template<typename Real>
-AEDInfo NibbleHelper
+AEDInfo DeflateSchurWindow
 ( Matrix<Real>& H,
+  Matrix<Real>& T,
+  Matrix<Real>& V,
   Real& spikeValue,
   Matrix<Complex<Real>>& w,
-  Matrix<Real>& V,
+  Int numUnconverged,
   const HessenbergSchurCtrl& ctrl )
 {
     EL_DEBUG_CSE
     const Int n = H.Height();
-    AEDInfo info;
-
     const Real zero(0);
-    const Real ulp = limits::Precision<Real>();
-    const Real safeMin = limits::SafeMin<Real>();
-    const Real smallNum = safeMin*(Real(n)/ulp);
-
-    Zeros( V, 0, 0 );
-    if( n == 1 )
-    {
-        w(0) = H(0,0);
-        if( Abs(spikeValue) <= Max( smallNum, ulp*Abs(w(0).real()) ) )
-        {
-            // The offdiagonal entry was small enough to deflate
-            info.numDeflated = 1;
-            spikeValue = zero;
-        }
-        else
-        {
-            // The offdiagonal entry was too large to deflate
-            info.numShiftCandidates = 1;
-        }
-        return info;
-    }
-
-    // NOTE(poulson): We could only copy the upper-Hessenberg portion of H
-    auto T( H ); // TODO(poulson): Reuse this matrix?
-    Identity( V, n, n );
-    auto ctrlSub( ctrl );
-    ctrlSub.winBeg = 0;
-    ctrlSub.winEnd = n;
-    ctrlSub.fullTriangle = true;
-    ctrlSub.wantSchurVecs = true;
-    ctrlSub.demandConverged = false;
-    ctrlSub.alg = ( ctrl.recursiveAED ? HESSENBERG_SCHUR_AED
-                                      : HESSENBERG_SCHUR_MULTIBULGE );
-    auto infoSub = HessenbergSchur( T, w, V, ctrlSub );
-    EL_DEBUG_ONLY(
-      if( infoSub.numUnconverged != 0 )
-          Output(infoSub.numUnconverged," eigenvalues did not converge");
-    )
 
     vector<Real> work(2*n);
-    info = SpikeDeflation( T, V, spikeValue, infoSub.numUnconverged, work );
+    auto info = SpikeDeflation( T, V, spikeValue, numUnconverged, work );
     if( ctrl.progress )
     {
         if( info.numUnconverged > 0 )
@@ -186,16 +150,16 @@ AEDInfo NibbleHelper
     return info;
 }
 
+// The spike value will be overwritten
 template<typename Real>
 AEDInfo NibbleHelper
-( Matrix<Complex<Real>>& H,
-  Complex<Real>& spikeValue,
+( Matrix<Real>& H,
+  Real& spikeValue,
   Matrix<Complex<Real>>& w,
-  Matrix<Complex<Real>>& V,
+  Matrix<Real>& V,
   const HessenbergSchurCtrl& ctrl )
 {
     EL_DEBUG_CSE
-    typedef Complex<Real> Field;
     const Int n = H.Height();
     AEDInfo info;
 
@@ -208,7 +172,7 @@ AEDInfo NibbleHelper
     if( n == 1 )
     {
         w(0) = H(0,0);
-        if( OneAbs(spikeValue) <= Max( smallNum, ulp*OneAbs(w(0)) ) )
+        if( Abs(spikeValue) <= Max( smallNum, ulp*Abs(w(0).real()) ) )
         {
             // The offdiagonal entry was small enough to deflate
             info.numDeflated = 1;
@@ -239,8 +203,27 @@ AEDInfo NibbleHelper
           Output(infoSub.numUnconverged," eigenvalues did not converge");
     )
 
+    return DeflateSchurWindow
+    ( H, T, V, spikeValue, w, infoSub.numUnconverged, ctrl );
+}
+
+template<typename Real>
+AEDInfo DeflateSchurWindow
+( Matrix<Complex<Real>>& H,
+  Matrix<Complex<Real>>& T,
+  Matrix<Complex<Real>>& V,
+  Complex<Real>& spikeValue,
+  Matrix<Complex<Real>>& w,
+  Int numUnconverged,
+  const HessenbergSchurCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Complex<Real> Field;
+    const Int n = H.Height();
+    const Real zero(0);
+
     vector<Field> work(2*n);
-    info = SpikeDeflation( T, V, spikeValue, infoSub.numUnconverged, work );
+    auto info = SpikeDeflation( T, V, spikeValue, numUnconverged, work );
     if( ctrl.progress )
     {
         if( info.numUnconverged > 0 )
@@ -337,6 +320,62 @@ AEDInfo NibbleHelper
     return info;
 }
 
+template<typename Real>
+AEDInfo NibbleHelper
+( Matrix<Complex<Real>>& H,
+  Complex<Real>& spikeValue,
+  Matrix<Complex<Real>>& w,
+  Matrix<Complex<Real>>& V,
+  const HessenbergSchurCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    const Int n = H.Height();
+    AEDInfo info;
+
+    const Real zero(0);
+    const Real ulp = limits::Precision<Real>();
+    const Real safeMin = limits::SafeMin<Real>();
+    const Real smallNum = safeMin*(Real(n)/ulp);
+
+    Zeros( V, 0, 0 );
+    if( n == 1 )
+    {
+        w(0) = H(0,0);
+        if( OneAbs(spikeValue) <= Max( smallNum, ulp*OneAbs(w(0)) ) )
+        {
+            // The offdiagonal entry was small enough to deflate
+            info.numDeflated = 1;
+            spikeValue = zero;
+        }
+        else
+        {
+            // The offdiagonal entry was too large to deflate
+            info.numShiftCandidates = 1;
+        }
+        return info;
+    }
+
+    // NOTE(poulson): We could only copy the upper-Hessenberg portion of H
+    auto T( H ); // TODO(poulson): Reuse this matrix?
+    Identity( V, n, n );
+    auto ctrlSub( ctrl );
+    ctrlSub.winBeg = 0;
+    ctrlSub.winEnd = n;
+    ctrlSub.fullTriangle = true;
+    ctrlSub.wantSchurVecs = true;
+    ctrlSub.demandConverged = false;
+    ctrlSub.alg = ( ctrl.recursiveAED ? HESSENBERG_SCHUR_AED
+                                      : HESSENBERG_SCHUR_MULTIBULGE );
+    auto infoSub = HessenbergSchur( T, w, V, ctrlSub );
+    EL_DEBUG_ONLY(
+      if( infoSub.numUnconverged != 0 )
+          Output(infoSub.numUnconverged," eigenvalues did not converge");
+    )
+
+    return DeflateSchurWindow
+    ( H, T, V, spikeValue, w, infoSub.numUnconverged, ctrl );
+}
+
 template<typename Field>
 AEDInfo Nibble
 ( Matrix<Field>& H,
@@ -396,6 +435,69 @@ AEDInfo Nibble
     return info;
 }
 
+// Solve for the Schur decomposition of the AED window using the distributed
+// AED algorithm over a subgrid of ctrl.aedSubgridSize processes (whose first
+// member is the root of H) rather than on the root alone. The spike
+// deflation is then performed on the root, which is the only process with
+// meaningful output.
+template<typename Field>
+AEDInfo SubgridNibble
+( DistMatrix<Field,CIRC,CIRC>& H,
+  Field& spikeValue,
+  Matrix<Complex<Base<Field>>>& w,
+  Matrix<Field>& V,
+  const HessenbergSchurCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    const Int n = H.Height();
+    mpi::Comm comm = H.CrossComm();
+    const int commSize = mpi::Size( comm );
+    const int root = H.Root();
+    const int relRank = Mod( H.CrossRank()-root, commSize );
+    const int subgridSize = Min( ctrl.aedSubgridSize, Int(commSize) );
+    const bool inSubgrid = ( relRank < subgridSize );
+
+    AEDInfo info;
+    mpi::Comm subComm;
+    mpi::Split( comm, inSubgrid ? 0 : 1, relRank, subComm );
+    if( inSubgrid )
+    {
+        const Grid subgrid( subComm );
+        DistMatrix<Field,CIRC,CIRC> T_CIRC_CIRC( n, n, subgrid );
+        DistMatrix<Field,CIRC,CIRC> V_CIRC_CIRC( subgrid );
+        if( relRank == 0 )
+            T_CIRC_CIRC.Matrix() = H.Matrix();
+
+        DistMatrix<Field,MC,MR,BLOCK> T( subgrid ), VDist( subgrid );
+        DistMatrix<Complex<Base<Field>>,STAR,STAR> wSub( subgrid );
+        T = T_CIRC_CIRC;
+        auto ctrlSub( ctrl );
+        ctrlSub.winBeg = 0;
+        ctrlSub.winEnd = n;
+        ctrlSub.fullTriangle = true;
+        ctrlSub.wantSchurVecs = true;
+        ctrlSub.accumulateSchurVecs = false;
+        ctrlSub.demandConverged = false;
+        ctrlSub.progress = false;
+        ctrlSub.alg = ( ctrl.recursiveAED ? HESSENBERG_SCHUR_AED
+                                          : HESSENBERG_SCHUR_MULTIBULGE );
+        auto infoSub = HessenbergSchur( T, wSub, VDist, ctrlSub );
+        T_CIRC_CIRC = T;
+        V_CIRC_CIRC = VDist;
+        if( relRank == 0 )
+        {
+            w = wSub.Matrix();
+            info =
+              DeflateSchurWindow
+              ( H.Matrix(), T_CIRC_CIRC.Matrix(), V_CIRC_CIRC.Matrix(),
+                spikeValue, w, infoSub.numUnconverged, ctrl );
+            V = V_CIRC_CIRC.Matrix();
+        }
+    }
+    mpi::Free( subComm );
+    return info;
+}
+
 template<typename Field>
 AEDInfo Nibble
 ( DistMatrix<Field,MC,MR,BLOCK>& H,
@@ -430,7 +532,16 @@ AEDInfo Nibble
       ( deflateBeg==winBeg ? Field(0) : H.Get(deflateBeg,deflateBeg-1) );
     Int VSize = 0;
     Matrix<Field> V;
-    if( HDefl_CIRC_CIRC.CrossRank() == HDefl_CIRC_CIRC.Root() )
+    const bool useSubgrid = ctrl.aedSubgridSize > 1 && grid.Size() > 1 &&
+      blockSize >= ctrl.minDistMultiBulgeSize;
+    if( useSubgrid )
+    {
+        info =
+          SubgridNibble
+          ( HDefl_CIRC_CIRC, spikeValue, wDefl.Matrix(), V, ctrl );
+        VSize = V.Height();
+    }
+    else if( HDefl_CIRC_CIRC.CrossRank() == HDefl_CIRC_CIRC.Root() )
     {
         info =
           NibbleHelper
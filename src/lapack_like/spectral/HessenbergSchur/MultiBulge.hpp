@@ -28,6 +28,7 @@ MultiBulge
   const HessenbergSchurCtrl& ctrl )
 {
     EL_DEBUG_CSE
+    EL_PROFILE_REGION("hess_schur::MultiBulge");
     const Int n = H.Height();
     Int winBeg = ( ctrl.winBeg==END ? n : ctrl.winBeg );
     Int winEnd = ( ctrl.winEnd==END ? n : ctrl.winEnd );
@@ -141,6 +142,7 @@ MultiBulge
   const HessenbergSchurCtrl& ctrl )
 {
     EL_DEBUG_CSE
+    EL_PROFILE_REGION("hess_schur::MultiBulge");
     const Int n = H.Height();
     const Grid& grid = H.Grid();
 
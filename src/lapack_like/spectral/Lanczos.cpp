@@ -8,6 +8,8 @@
 */
 #include <El.hpp>
 
+#include "./Lanczos/Block.hpp"
+
 namespace El {
 
 template<typename Field>
@@ -94,6 +96,65 @@ Base<Field> LanczosDecomp
     return LanczosDecomp( n, applyA, V, T, v, basisSize );
 }
 
+template<typename Field>
+void BlockLanczos
+( const SparseMatrix<Field>& A,
+        Int numEigs,
+        Matrix<Base<Field>>& w,
+        Matrix<Field>& Z,
+  const BlockLanczosCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    const Int n = A.Height();
+    if( n != A.Width() )
+        LogicError("A was not square");
+
+    Matrix<Field> Y;
+    auto applyA =
+      [&]( Matrix<Field>& X )
+      {
+          Zeros( Y, n, X.Width() );
+          Multiply( NORMAL, Field(1), A, X, Field(0), Y );
+          X = Y;
+      };
+    lanczos::Block( n, n, applyA, mpi::COMM_SELF, numEigs, ctrl, w, Z );
+}
+
+template<typename Field>
+void BlockLanczos
+( const DistSparseMatrix<Field>& A,
+        Int numEigs,
+        Matrix<Base<Field>>& w,
+        DistMultiVec<Field>& Z,
+  const BlockLanczosCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    const Int n = A.Height();
+    if( n != A.Width() )
+        LogicError("A was not square");
+    const Grid& grid = A.Grid();
+
+    // Each block is applied with a single multi-vector product
+    DistMultiVec<Field> X(grid), Y(grid);
+    X.Resize( n, 1 );
+    const Int localHeight = X.LocalHeight();
+    auto applyA =
+      [&]( Matrix<Field>& XLoc )
+      {
+          X.Resize( n, XLoc.Width() );
+          X.Matrix() = XLoc;
+          Zeros( Y, n, XLoc.Width() );
+          Multiply( NORMAL, Field(1), A, X, Field(0), Y );
+          XLoc = Y.LockedMatrix();
+      };
+    Matrix<Field> ZLoc;
+    lanczos::Block
+    ( n, localHeight, applyA, grid.Comm(), numEigs, ctrl, w, ZLoc );
+    Z.SetGrid( grid );
+    Zeros( Z, n, numEigs );
+    Z.Matrix() = ZLoc;
+}
+
 #define PROTO(Field) \
   template void Lanczos \
   ( const SparseMatrix<Field>& A, \
@@ -114,7 +175,19 @@ Base<Field> LanczosDecomp
           DistMultiVec<Field>& V, \
           AbstractDistMatrix<Base<Field>>& T, \
           DistMultiVec<Field>& v, \
-          Int basisSize );
+          Int basisSize ); \
+  template void BlockLanczos \
+  ( const SparseMatrix<Field>& A, \
+          Int numEigs, \
+          Matrix<Base<Field>>& w, \
+          Matrix<Field>& Z, \
+    const BlockLanczosCtrl<Base<Field>>& ctrl ); \
+  template void BlockLanczos \
+  ( const DistSparseMatrix<Field>& A, \
+          Int numEigs, \
+          Matrix<Base<Field>>& w, \
+          DistMultiVec<Field>& Z, \
+    const BlockLanczosCtrl<Base<Field>>& ctrl );
 
 #define EL_NO_INT_PROTO
 #define EL_ENABLE_DOUBLEDOUBLE
@@ -0,0 +1,204 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_LANCZOS_BLOCK_HPP
+#define EL_LANCZOS_BLOCK_HPP
+
+#include "./Orthonormalize.hpp"
+
+namespace El {
+namespace lanczos {
+
+// Compute the 'numEigs' extremal eigenpairs of A using thick-restart block
+// Lanczos with locking, where 'applyA' overwrites the local rows of a block
+// with the result of applying A.
+//
+// The columns of V hold the locked Ritz vectors followed by the current
+// basis, and H holds the projection of A onto the current basis. Since every
+// new block is fully reorthogonalized, A V_basis = V_basis H + P R E^H (up to
+// the residuals of the locked vectors), where P is the next block and E
+// selects the last block of the basis. A thick restart replaces the basis
+// with the Ritz vectors that are kept, H with their Ritz values, and keeps P.
+template<typename Field,class ApplyType>
+void Block
+(       Int n,
+        Int localHeight,
+  const ApplyType& applyA,
+        mpi::Comm comm,
+        Int numEigs,
+  const BlockLanczosCtrl<Base<Field>>& ctrl,
+        Matrix<Base<Field>>& w,
+        Matrix<Field>& ZLoc )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    if( numEigs < 0 || numEigs > n )
+        LogicError("Cannot compute ",numEigs," eigenpairs of an ",n," x ",n,
+                   " matrix");
+    if( numEigs == 0 )
+    {
+        w.Resize( 0, 1 );
+        Zeros( ZLoc, localHeight, 0 );
+        return;
+    }
+    const Real eps = limits::Epsilon<Real>();
+    const Real tol =
+      ( ctrl.tol > Real(0) ? ctrl.tol : Pow(eps,Real(3)/Real(4)) );
+    const Int s = Max( Min(ctrl.blockSize,n), Int(1) );
+    const Int maxBasisSize =
+      Max( ctrl.maxBasisSize > 0 ? ctrl.maxBasisSize : 2*numEigs+4*s, 3*s );
+
+    Matrix<Field> V, H, P, W, R, C, CAdj, HCopy, S, SSel, RS, VRitz;
+    Matrix<Real> theta;
+    Zeros( V, localHeight, Min(numEigs+maxBasisSize,n) );
+    Zeros( H, maxBasisSize, maxBasisSize );
+    {
+        Zeros( P, localHeight, s );
+        MakeUniform( P );
+        Matrix<Field> VEmpty( localHeight, 0 );
+        Orthonormalize( n, VEmpty, P, R, comm );
+    }
+
+    vector<Real> lockedValues;
+    Int numLocked=0, basisSize=0;
+    Real normEst = 0;
+    for( Int restart=0; restart<ctrl.maxRestarts; ++restart )
+    {
+        // Expand the basis a block at a time. The basis is exhausted once,
+        // together with the locked vectors, it spans the entire space.
+        bool exhausted = false;
+        while( basisSize+s <= maxBasisSize )
+        {
+            const Int offset = numLocked + basisSize;
+            const Int width = Min( s, n-offset );
+            const Int newBasisSize = basisSize + width;
+            auto Vj = V( ALL, IR(offset,offset+width) );
+            Vj = P( ALL, IR(0,width) );
+
+            // W := A V_j - V_basis (V_basis^H A V_j)
+            W = Vj;
+            applyA( W );
+            auto VBasis = V( ALL, IR(numLocked,numLocked+newBasisSize) );
+            Zeros( C, newBasisSize, width );
+            Gemm( ADJOINT, NORMAL, Field(1), VBasis, W, Field(0), C );
+            mpi::AllReduce( C.Buffer(), newBasisSize*width, comm );
+            auto CJ = C( IR(basisSize,newBasisSize), ALL );
+            Adjoint( CJ, CAdj );
+            CJ += CAdj;
+            CJ *= Real(1)/Real(2);
+            Adjoint( C, CAdj );
+            auto HCol = H( IR(0,newBasisSize), IR(basisSize,newBasisSize) );
+            auto HRow = H( IR(basisSize,newBasisSize), IR(0,newBasisSize) );
+            HCol = C;
+            HRow = CAdj;
+            Gemm( NORMAL, NORMAL, Field(-1), VBasis, C, Field(1), W );
+            basisSize = newBasisSize;
+            if( numLocked+basisSize == n )
+            {
+                exhausted = true;
+                break;
+            }
+
+            // W := P R, with P orthogonal to the locked vectors and the basis
+            auto VPrev = V( ALL, IR(0,numLocked+basisSize) );
+            Orthonormalize( n, VPrev, W, R, comm );
+            P = W;
+        }
+
+        // Order the Ritz pairs with the most desired first
+        HCopy = H( IR(0,basisSize), IR(0,basisSize) );
+        HermitianEig( LOWER, HCopy, theta, S );
+        vector<Int> order(basisSize);
+        for( Int i=0; i<basisSize; ++i )
+        {
+            order[i] = i;
+            normEst = Max( normEst, Abs(theta(i)) );
+        }
+        std::sort
+        ( order.begin(), order.end(),
+          [&]( const Int& a, const Int& b )
+          {
+              return ctrl.largest ? theta(a) > theta(b) : theta(a) < theta(b);
+          } );
+
+        // Lock the leading converged Ritz pairs, whose residuals are the
+        // columns of R S(lastBlock,:)
+        if( !exhausted )
+        {
+            auto SLast = S( IR(basisSize-s,basisSize), ALL );
+            Zeros( RS, s, basisSize );
+            Gemm( NORMAL, NORMAL, Field(1), R, SLast, Field(0), RS );
+        }
+        const Int numRemaining = numEigs - numLocked;
+        Int numNewLocked = 0;
+        while( numNewLocked < numRemaining )
+        {
+            const Int i = order[numNewLocked];
+            if( !exhausted && FrobeniusNorm(RS(ALL,IR(i))) > tol*normEst )
+                break;
+            ++numNewLocked;
+        }
+        if( ctrl.progress )
+            OutputFromRoot
+            (comm,"  restart ",restart,": ",numLocked+numNewLocked," of ",
+             numEigs," eigenpairs locked");
+
+        // Keep the next most desired Ritz vectors for the restarted basis
+        const Int numKeep =
+          Max( Min( numRemaining-numNewLocked+s,
+                    Min( basisSize-numNewLocked, maxBasisSize-2*s ) ),
+               Int(0) );
+        const Int numRitz = numNewLocked + numKeep;
+        Zeros( SSel, basisSize, numRitz );
+        for( Int k=0; k<numRitz; ++k )
+        {
+            auto sSel = SSel( ALL, IR(k) );
+            sSel = S( ALL, IR(order[k]) );
+        }
+        auto VBasis = V( ALL, IR(numLocked,numLocked+basisSize) );
+        Zeros( VRitz, localHeight, numRitz );
+        Gemm( NORMAL, NORMAL, Field(1), VBasis, SSel, Field(0), VRitz );
+        auto VRitzDest = V( ALL, IR(numLocked,numLocked+numRitz) );
+        VRitzDest = VRitz;
+        for( Int k=0; k<numNewLocked; ++k )
+            lockedValues.push_back( theta(order[k]) );
+        numLocked += numNewLocked;
+        if( numLocked == numEigs )
+            break;
+        if( exhausted )
+            RuntimeError("Block Lanczos exhausted the space without locking");
+
+        Zero( H );
+        for( Int k=0; k<numKeep; ++k )
+            H(k,k) = theta(order[numNewLocked+k]);
+        basisSize = numKeep;
+    }
+    if( numLocked < numEigs )
+        RuntimeError
+        ("Block Lanczos only locked ",numLocked," of ",numEigs,
+         " eigenpairs within ",ctrl.maxRestarts," restarts");
+
+    // Return the locked eigenpairs sorted by eigenvalue
+    vector<pair<Real,Int>> sorted(numEigs);
+    for( Int k=0; k<numEigs; ++k )
+        sorted[k] = pair<Real,Int>(lockedValues[k],k);
+    std::sort( sorted.begin(), sorted.end() );
+    w.Resize( numEigs, 1 );
+    Zeros( ZLoc, localHeight, numEigs );
+    for( Int k=0; k<numEigs; ++k )
+    {
+        w(k) = sorted[k].first;
+        auto z = ZLoc( ALL, IR(k) );
+        z = V( ALL, IR(sorted[k].second) );
+    }
+}
+
+} // namespace lanczos
+} // namespace El
+
+#endif // ifndef EL_LANCZOS_BLOCK_HPP
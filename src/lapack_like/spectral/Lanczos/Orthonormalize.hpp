@@ -0,0 +1,79 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_LANCZOS_ORTHONORMALIZE_HPP
+#define EL_LANCZOS_ORTHONORMALIZE_HPP
+
+namespace El {
+namespace lanczos {
+
+// Orthogonalize the columns of W (whose rows are distributed over 'comm')
+// against those of VPrev and then orthonormalize them using two passes of
+// shifted Cholesky QR, returning the upper-triangular R such that the
+// projected W equals the new W times R
+template<typename Field>
+void Orthonormalize
+(       Int n,
+  const Matrix<Field>& VPrev,
+        Matrix<Field>& W,
+        Matrix<Field>& R,
+        mpi::Comm comm )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Real eps = limits::Epsilon<Real>();
+    const Int s = W.Width();
+    const Int numPrev = VPrev.Width();
+
+    bool randomized = false;
+    Matrix<Field> C, G, RPass;
+    Identity( R, s, s );
+    for( Int pass=0; pass<2; ++pass )
+    {
+        if( numPrev > 0 )
+        {
+            Zeros( C, numPrev, s );
+            Gemm( ADJOINT, NORMAL, Field(1), VPrev, W, Field(0), C );
+            mpi::AllReduce( C.Buffer(), numPrev*s, comm );
+            Gemm( NORMAL, NORMAL, Field(-1), VPrev, C, Field(1), W );
+        }
+
+        Zeros( G, s, s );
+        Herk( UPPER, ADJOINT, Real(1), W, Real(0), G );
+        mpi::AllReduce( G.Buffer(), s*s, comm );
+        Real trace = 0;
+        for( Int i=0; i<s; ++i )
+            trace += RealPart(G(i,i));
+        if( trace == Real(0) )
+        {
+            // The block is exactly deflated, so continue with random
+            // directions which are decoupled from the existing basis
+            MakeUniform( W );
+            randomized = true;
+            --pass;
+            continue;
+        }
+
+        // See Fukaya et al., "Shifted Cholesky QR for computing the QR
+        // factorization of ill-conditioned matrices"
+        const Real shift = 11*Real(n*s+s*(s+1))*eps*trace;
+        ShiftDiagonal( G, shift );
+        Cholesky( UPPER, G );
+        MakeTrapezoidal( UPPER, G );
+        Trsm( RIGHT, UPPER, NORMAL, NON_UNIT, Field(1), G, W );
+        RPass = R;
+        Gemm( NORMAL, NORMAL, Field(1), G, RPass, Field(0), R );
+    }
+    if( randomized )
+        Zero( R );
+}
+
+} // namespace lanczos
+} // namespace El
+
+#endif // ifndef EL_LANCZOS_ORTHONORMALIZE_HPP
@@ -78,7 +78,7 @@ QDWHInfo QDWHInner( Matrix<F>& A, Base<F> sMinUpper, const QDWHCtrl& ctrl )
 
         L = L*(a+b*L2)/(1+c*L2);
 
-        if( c > 100 )
+        if( c > Real(ctrl.choleskyCutoff) )
         {
             //
             // The standard QR-based algorithm
@@ -224,7 +224,7 @@ QDWHInner
 
         L = L*(a+b*L2)/(1+c*L2);
 
-        if( c > 100 )
+        if( c > Real(ctrl.choleskyCutoff) )
         {
             //
             // The standard QR-based algorithm
@@ -387,7 +387,7 @@ QDWHInner
 
         L = L*(a+b*L2)/(1+c*L2);
 
-        if( c > 100 )
+        if( c > Real(ctrl.choleskyCutoff) )
         {
             //
             // The standard QR-based algorithm
@@ -539,7 +539,7 @@ QDWHInner
 
         L = L*(a+b*L2)/(1+c*L2);
 
-        if( c > 100 )
+        if( c > Real(ctrl.choleskyCutoff) )
         {
             //
             // The standard QR-based algorithm
@@ -14,6 +14,7 @@
 #include "./Pseudospectra/IRA.hpp"
 #include "./Pseudospectra/IRL.hpp"
 #include "./Pseudospectra/Analytic.hpp"
+#include "./Pseudospectra/ShiftParallel.hpp"
 
 // For one-norm pseudospectra. An adaptation of the more robust algorithm of
 // Higham and Tisseur will hopefully be implemented soon.
@@ -314,6 +315,22 @@ DistMatrix<Int,VR,STAR> TriangularSpectralCloud
         return itCounts;
     }
 
+    if( psCtrl.numShiftTeams > 1 && g.Size() > 1 )
+    {
+        auto cloud =
+          [&]( const DistMatrix<C>& UTeam,
+               const DistMatrix<C>&,
+               const DistMatrix<C,VR,STAR>& teamShifts,
+                     DistMatrix<Real,VR,STAR>& teamInvNorms,
+               const PseudospecCtrl<Real>& teamCtrl )
+          {
+              return TriangularSpectralCloud
+                     ( UTeam, teamShifts, teamInvNorms, teamCtrl );
+          };
+        return pspec::ShiftParallel<C,Real>
+               ( U, nullptr, shifts, invNorms, psCtrl, cloud );
+    }
+
     psCtrl.schur = true;
     if( psCtrl.norm == PS_TWO_NORM )
     {
@@ -372,6 +389,31 @@ DistMatrix<Int,VR,STAR> TriangularSpectralCloud
         return itCounts;
     }
 
+    if( psCtrl.numShiftTeams > 1 && g.Size() > 1 )
+    {
+        // The one-norm estimators additionally require Q
+        DistMatrixReadProxy<Field,C,MC,MR> QProx( QPre );
+        const DistMatrix<C>* QPtr =
+          ( psCtrl.norm == PS_TWO_NORM ? nullptr : &QProx.GetLocked() );
+        auto cloud =
+          [&]( const DistMatrix<C>& UTeam,
+               const DistMatrix<C>& QTeam,
+               const DistMatrix<C,VR,STAR>& teamShifts,
+                     DistMatrix<Real,VR,STAR>& teamInvNorms,
+               const PseudospecCtrl<Real>& teamCtrl )
+          {
+              if( QPtr == nullptr )
+                  return TriangularSpectralCloud
+                         ( UTeam, teamShifts, teamInvNorms, teamCtrl );
+              else
+                  return TriangularSpectralCloud
+                         ( UTeam, QTeam, teamShifts, teamInvNorms,
+                           teamCtrl );
+          };
+        return pspec::ShiftParallel<C,Real>
+               ( U, QPtr, shifts, invNorms, psCtrl, cloud );
+    }
+
     psCtrl.schur = true;
     if( psCtrl.norm == PS_TWO_NORM )
     {
@@ -434,6 +476,22 @@ DistMatrix<Int,VR,STAR> QuasiTriangularSpectralCloud
         return itCounts;
     }
 
+    if( psCtrl.numShiftTeams > 1 && g.Size() > 1 )
+    {
+        auto cloud =
+          [&]( const DistMatrix<Real>& UTeam,
+               const DistMatrix<Real>&,
+               const DistMatrix<C,VR,STAR>& teamShifts,
+                     DistMatrix<Real,VR,STAR>& teamInvNorms,
+               const PseudospecCtrl<Real>& teamCtrl )
+          {
+              return QuasiTriangularSpectralCloud
+                     ( UTeam, teamShifts, teamInvNorms, teamCtrl );
+          };
+        return pspec::ShiftParallel<Real,Real>
+               ( U, nullptr, shifts, invNorms, psCtrl, cloud );
+    }
+
     psCtrl.schur = true;
     if( psCtrl.norm == PS_ONE_NORM )
         LogicError("This option is not yet written");
@@ -480,6 +538,22 @@ DistMatrix<Int,VR,STAR> QuasiTriangularSpectralCloud
         return itCounts;
     }
 
+    if( psCtrl.numShiftTeams > 1 && g.Size() > 1 )
+    {
+        auto cloud =
+          [&]( const DistMatrix<Real>& UTeam,
+               const DistMatrix<Real>&,
+               const DistMatrix<C,VR,STAR>& teamShifts,
+                     DistMatrix<Real,VR,STAR>& teamInvNorms,
+               const PseudospecCtrl<Real>& teamCtrl )
+          {
+              return QuasiTriangularSpectralCloud
+                     ( UTeam, teamShifts, teamInvNorms, teamCtrl );
+          };
+        return pspec::ShiftParallel<Real,Real>
+               ( U, nullptr, shifts, invNorms, psCtrl, cloud );
+    }
+
     psCtrl.schur = true;
     if( psCtrl.norm == PS_ONE_NORM )
         LogicError("This option is not yet written");
@@ -507,6 +581,22 @@ DistMatrix<Int,VR,STAR> HessenbergSpectralCloud
 
     // TODO: Check if the subdiagonal is sufficiently small, and, if so, revert
     //       to TriangularSpectralCloud
+    if( psCtrl.numShiftTeams > 1 && H.Grid().Size() > 1 )
+    {
+        auto cloud =
+          [&]( const DistMatrix<C>& HTeam,
+               const DistMatrix<C>&,
+               const DistMatrix<C,VR,STAR>& teamShifts,
+                     DistMatrix<Real,VR,STAR>& teamInvNorms,
+               const PseudospecCtrl<Real>& teamCtrl )
+          {
+              return HessenbergSpectralCloud
+                     ( HTeam, teamShifts, teamInvNorms, teamCtrl );
+          };
+        return pspec::ShiftParallel<C,Real>
+               ( H, nullptr, shifts, invNorms, psCtrl, cloud );
+    }
+
     psCtrl.schur = false;
     if( psCtrl.norm == PS_TWO_NORM )
     {
@@ -546,6 +636,31 @@ DistMatrix<Int,VR,STAR> HessenbergSpectralCloud
 
     // TODO: Check if the subdiagonal is sufficiently small, and, if so, revert
     //       to TriangularSpectralCloud
+    if( psCtrl.numShiftTeams > 1 && H.Grid().Size() > 1 )
+    {
+        // The one-norm estimators additionally require Q
+        DistMatrixReadProxy<Field,C,MC,MR> QProx( QPre );
+        const DistMatrix<C>* QPtr =
+          ( psCtrl.norm == PS_TWO_NORM ? nullptr : &QProx.GetLocked() );
+        auto cloud =
+          [&]( const DistMatrix<C>& HTeam,
+               const DistMatrix<C>& QTeam,
+               const DistMatrix<C,VR,STAR>& teamShifts,
+                     DistMatrix<Real,VR,STAR>& teamInvNorms,
+               const PseudospecCtrl<Real>& teamCtrl )
+          {
+              if( QPtr == nullptr )
+                  return HessenbergSpectralCloud
+                         ( HTeam, teamShifts, teamInvNorms, teamCtrl );
+              else
+                  return HessenbergSpectralCloud
+                         ( HTeam, QTeam, teamShifts, teamInvNorms,
+                           teamCtrl );
+          };
+        return pspec::ShiftParallel<C,Real>
+               ( H, QPtr, shifts, invNorms, psCtrl, cloud );
+    }
+
     psCtrl.schur = false;
     if( psCtrl.norm == PS_TWO_NORM )
     {
@@ -0,0 +1,133 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_PSEUDOSPECTRA_SHIFTPARALLEL_HPP
+#define EL_PSEUDOSPECTRA_SHIFTPARALLEL_HPP
+
+namespace El {
+namespace pspec {
+
+// Split the processes into psCtrl.numShiftTeams contiguous teams which each
+// compute the pseudospectra of a contiguous subset of the shifts using their
+// own copies of A (and Q). Only the final estimates and iteration counts are
+// gathered, and snapshots are only taken of the gathered result.
+//
+// 'cloud' should compute the pseudospectra on the team grid given the team
+// copies of A and Q (the latter is empty if 'QPtr' is null).
+template<typename F,typename Real,class CloudType>
+DistMatrix<Int,VR,STAR> ShiftParallel
+( const DistMatrix<F>& A,
+  const DistMatrix<F>* QPtr,
+  const DistMatrix<Complex<Real>,VR,STAR>& shifts,
+        AbstractDistMatrix<Real>& invNorms,
+        PseudospecCtrl<Real> psCtrl,
+  const CloudType& cloud )
+{
+    EL_DEBUG_CSE
+    typedef Complex<Real> C;
+    const Grid& g = A.Grid();
+    mpi::Comm comm = g.VCComm();
+    const int commSize = mpi::Size( comm );
+    const int commRank = mpi::Rank( comm );
+    const Int numTeams = Min( psCtrl.numShiftTeams, Int(commSize) );
+    const Int numShifts = shifts.Height();
+
+    // Split the processes into contiguous teams whose grids are viewed by
+    // the entire grid, so that A (and Q) can be translated onto each of them
+    const int team = (Int(commRank)*numTeams) / commSize;
+    vector<int> teamOffsets(numTeams+1,commSize);
+    for( int q=commSize-1; q>=0; --q )
+        teamOffsets[(Int(q)*numTeams)/commSize] = q;
+    mpi::Group group;
+    mpi::CommGroup( comm, group );
+    vector<unique_ptr<Grid>> teamGrids(numTeams);
+    for( Int t=0; t<numTeams; ++t )
+    {
+        const int teamSize = teamOffsets[t+1] - teamOffsets[t];
+        vector<int> teamRanks(teamSize);
+        for( int q=0; q<teamSize; ++q )
+            teamRanks[q] = teamOffsets[t] + q;
+        mpi::Group teamGroup;
+        mpi::Incl( group, teamSize, teamRanks.data(), teamGroup );
+        teamGrids[t].reset
+        ( new Grid( comm, teamGroup, Grid::DefaultHeight(teamSize) ) );
+        mpi::Free( teamGroup );
+    }
+    mpi::Free( group );
+    const Grid& teamGrid = *teamGrids[team];
+    const bool teamRoot = ( teamGrid.Rank() == 0 );
+
+    // Every process sends its portion of A (and Q) to each of the teams
+    DistMatrix<F> ATeam(teamGrid), QTeam(teamGrid);
+    for( Int t=0; t<numTeams; ++t )
+    {
+        if( t == team )
+        {
+            Copy( A, ATeam );
+            if( QPtr != nullptr )
+                Copy( *QPtr, QTeam );
+        }
+        else
+        {
+            DistMatrix<F> AOther(*teamGrids[t]);
+            Copy( A, AOther );
+            if( QPtr != nullptr )
+                Copy( *QPtr, AOther );
+        }
+    }
+
+    // Extract the contiguous block of shifts of this team
+    const Int shiftBeg = (team*numShifts) / numTeams;
+    const Int shiftEnd = ((team+1)*numShifts) / numTeams;
+    DistMatrix<C,STAR,STAR> shiftsAll( shifts );
+    DistMatrix<C,STAR,STAR> teamShiftsAll(teamGrid);
+    teamShiftsAll.Resize( shiftEnd-shiftBeg, 1 );
+    teamShiftsAll.Matrix() =
+      shiftsAll.LockedMatrix()( IR(shiftBeg,shiftEnd), ALL );
+    DistMatrix<C,VR,STAR> teamShifts( teamShiftsAll );
+
+    auto teamCtrl( psCtrl );
+    teamCtrl.numShiftTeams = 1;
+    teamCtrl.snapCtrl = SnapshotCtrl();
+    DistMatrix<Real,VR,STAR> teamInvNorms(teamGrid);
+    auto teamItCounts =
+      cloud( ATeam, QTeam, teamShifts, teamInvNorms, teamCtrl );
+
+    // Gather the results from the root of each team
+    DistMatrix<Real,STAR,STAR> teamInvNormsAll( teamInvNorms );
+    DistMatrix<Int,STAR,STAR> teamItCountsAll( teamItCounts );
+    const int numContrib = ( teamRoot ? shiftEnd-shiftBeg : 0 );
+    vector<int> recvCounts(commSize), recvOffs;
+    mpi::AllGather( &numContrib, 1, recvCounts.data(), 1, comm );
+    Scan( recvCounts, recvOffs );
+    DistMatrix<Real,STAR,STAR> invNormsAll(g);
+    DistMatrix<Int,STAR,STAR> itCountsAll(g);
+    invNormsAll.Resize( numShifts, 1 );
+    itCountsAll.Resize( numShifts, 1 );
+    mpi::AllGather
+    ( teamInvNormsAll.LockedBuffer(), numContrib,
+      invNormsAll.Buffer(), recvCounts.data(), recvOffs.data(), comm );
+    mpi::AllGather
+    ( teamItCountsAll.LockedBuffer(), numContrib,
+      itCountsAll.Buffer(), recvCounts.data(), recvOffs.data(), comm );
+
+    DistMatrix<Real,VR,STAR> invNormsVR(g);
+    DistMatrix<Int,VR,STAR> itCounts(g);
+    invNormsVR.AlignWith( shifts );
+    itCounts.AlignWith( shifts );
+    Copy( invNormsAll, invNormsVR );
+    Copy( itCountsAll, itCounts );
+    FinalSnapshot( invNormsVR, itCounts, psCtrl.snapCtrl );
+    Copy( invNormsVR, invNorms );
+    return itCounts;
+}
+
+} // namespace pspec
+} // namespace El
+
+#endif // ifndef EL_PSEUDOSPECTRA_SHIFTPARALLEL_HPP
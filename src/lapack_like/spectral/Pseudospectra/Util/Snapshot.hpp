@@ -9,10 +9,107 @@
 #ifndef EL_PSEUDOSPECTRA_UTIL_SNAPSHOT_HPP
 #define EL_PSEUDOSPECTRA_UTIL_SNAPSHOT_HPP
 
+#include <exception>
+#include <thread>
+
 namespace El {
 
 namespace pspec {
 
+// Writes snapshots on a background thread so that the iterations need not
+// wait while the snapshots are written and their images are encoded. At most
+// one write is in flight, as submitting another first waits for the previous
+// one to finish, so that the snapshot being written and the one being
+// gathered form a double buffer.
+class AsyncSnapshotWriter
+{
+public:
+    ~AsyncSnapshotWriter()
+    {
+        if( thread_.joinable() )
+            thread_.join();
+    }
+
+    void Submit( function<void()> job )
+    {
+        EL_DEBUG_CSE
+        Wait();
+        thread_ = std::thread
+          ( [this,job]()
+            {
+                try { job(); }
+                catch( ... ) { error_ = std::current_exception(); }
+            } );
+    }
+
+    // Wait for the pending write (if any) and rethrow its exception
+    void Wait()
+    {
+        EL_DEBUG_CSE
+        if( thread_.joinable() )
+            thread_.join();
+        if( error_ )
+        {
+            std::exception_ptr error = error_;
+            error_ = nullptr;
+            std::rethrow_exception( error );
+        }
+    }
+
+private:
+    std::thread thread_;
+    std::exception_ptr error_;
+};
+
+inline AsyncSnapshotWriter& SnapshotWriter()
+{
+    static AsyncSnapshotWriter writer;
+    return writer;
+}
+
+// Write the numerical and/or image snapshots of the (reshaped) estimates,
+// where the estimates are overwritten with their logarithms if images are
+// to be saved
+template<typename Real,class RealMatrix,class IntMatrix>
+void WriteSnapshot
+(       RealMatrix& estMap,
+  const IntMatrix& itCountMap,
+  const string& numTitle,
+  const string& imgTitle,
+        bool numSave,
+        bool imgSave,
+  const SnapshotCtrl& snapCtrl )
+{
+    EL_DEBUG_CSE
+    auto logMap = []( const Real& alpha ) { return Log(alpha); };
+    if( numSave )
+    {
+        Write( estMap, numTitle, snapCtrl.numFormat );
+        if( snapCtrl.itCounts )
+            Write( itCountMap, numTitle+"_counts", snapCtrl.numFormat );
+    }
+    if( imgSave )
+    {
+        EntrywiseMap( estMap, MakeFunction(logMap) );
+        if( snapCtrl.rawDumps )
+        {
+            Write( estMap, imgTitle, BINARY );
+            if( snapCtrl.itCounts )
+                Write( itCountMap, imgTitle+"_counts", BINARY );
+        }
+        else
+        {
+            Write( estMap, imgTitle, snapCtrl.imgFormat );
+            if( snapCtrl.itCounts )
+                Write( itCountMap, imgTitle+"_counts", snapCtrl.imgFormat );
+            auto colorMap = GetColorMap();
+            SetColorMap( GRAYSCALE_DISCRETE );
+            Write( estMap, imgTitle+"_discrete", snapCtrl.imgFormat );
+            SetColorMap( colorMap );
+        }
+    }
+}
+
 template<typename Real>
 void Snapshot
 ( const Matrix<Int>& preimage,
@@ -54,31 +151,40 @@ void Snapshot
                   itCountMap );
             }
         }
-        if( numSave )
-        {
-            auto title = BuildString( snapCtrl.numBase, "_", numIts );
-            Write( estMap, title, snapCtrl.numFormat );
-            if( snapCtrl.itCounts )
-                Write( itCountMap, title+"_counts", snapCtrl.numFormat );
-            snapCtrl.numSaveCount = 0;
-        }
-        if( imgSave || imgDisp )
-            EntrywiseMap( estMap, MakeFunction(logMap) );
-        if( imgSave )
+        const string numTitle = BuildString( snapCtrl.numBase, "_", numIts );
+        const string imgTitle = BuildString( snapCtrl.imgBase, "_", numIts );
+        if( numSave || imgSave )
         {
-            auto title = BuildString( snapCtrl.imgBase, "_", numIts );
-            Write( estMap, title, snapCtrl.imgFormat );
-            if( snapCtrl.itCounts )
-                Write( itCountMap, title+"_counts", snapCtrl.imgFormat );
-            auto colorMap = GetColorMap();
-            SetColorMap( GRAYSCALE_DISCRETE );
-            Write( estMap, title+"_discrete", snapCtrl.imgFormat );
-            SetColorMap( colorMap );
-            snapCtrl.imgSaveCount = 0;
+            if( snapCtrl.async )
+            {
+                // Hand off copies of the snapshots to the writer
+                const SnapshotCtrl ctrl = snapCtrl;
+                Matrix<Real> estMapCopy( estMap );
+                Matrix<Int> itCountMapCopy( itCountMap );
+                SnapshotWriter().Submit
+                ( [=]() mutable
+                  {
+                      WriteSnapshot<Real>
+                      ( estMapCopy, itCountMapCopy, numTitle, imgTitle,
+                        numSave, imgSave, ctrl );
+                  } );
+            }
+            else
+                WriteSnapshot<Real>
+                ( estMap, itCountMap, numTitle, imgTitle, numSave, imgSave,
+                  snapCtrl );
+            if( numSave )
+                snapCtrl.numSaveCount = 0;
+            if( imgSave )
+                snapCtrl.imgSaveCount = 0;
         }
         if( imgDisp )
         {
-            auto title = BuildString( snapCtrl.imgBase, "_", numIts );
+            // The writer may be modifying the color map
+            SnapshotWriter().Wait();
+            if( snapCtrl.async || !imgSave )
+                EntrywiseMap( estMap, MakeFunction(logMap) );
+            const string& title = imgTitle;
             Display( estMap, title );
             if( snapCtrl.itCounts )
                 Display( itCountMap, title+"_counts" );
@@ -99,6 +205,7 @@ void FinalSnapshot
 {
     EL_DEBUG_CSE
     auto logMap = []( const Real& alpha ) { return Log(alpha); };
+    SnapshotWriter().Wait();
     if( snapCtrl.realSize != 0 && snapCtrl.imagSize != 0 )
     {
         const bool numSave = ( snapCtrl.numSaveFreq >= 0 );
@@ -191,31 +298,46 @@ void Snapshot
                   itCountMap );
             }
         }
-        if( numSave )
+        const string numTitle = BuildString( snapCtrl.numBase, "_", numIts );
+        const string imgTitle = BuildString( snapCtrl.imgBase, "_", numIts );
+        if( numSave || imgSave )
         {
-            auto title = BuildString( snapCtrl.numBase, "_", numIts );
-            Write( estMap, title, snapCtrl.numFormat );
-            if( snapCtrl.itCounts )
-                Write( itCountMap, title+"_counts", snapCtrl.numFormat );
-            snapCtrl.numSaveCount = 0;
-        }
-        if( imgSave || imgDisp )
-            EntrywiseMap( estMap, MakeFunction(logMap) );
-        if( imgSave )
-        {
-            auto title = BuildString( snapCtrl.imgBase, "_", numIts );
-            Write( estMap, title, snapCtrl.imgFormat );
-            if( snapCtrl.itCounts )
-                Write( itCountMap, title+"_counts", snapCtrl.imgFormat );
-            auto colorMap = GetColorMap();
-            SetColorMap( GRAYSCALE_DISCRETE );
-            Write( estMap, title+"_discrete", snapCtrl.imgFormat );
-            SetColorMap( colorMap );
-            snapCtrl.imgSaveCount = 0;
+            if( snapCtrl.async )
+            {
+                // Gather the snapshots to the root, which hands copies of
+                // them off to the writer
+                const SnapshotCtrl ctrl = snapCtrl;
+                DistMatrix<Real,CIRC,CIRC> estMap_CIRC_CIRC( estMap );
+                DistMatrix<Int,CIRC,CIRC> itCountMap_CIRC_CIRC( itCountMap );
+                if( estMap_CIRC_CIRC.CrossRank() == estMap_CIRC_CIRC.Root() )
+                {
+                    Matrix<Real> estMapCopy( estMap_CIRC_CIRC.Matrix() );
+                    Matrix<Int> itCountMapCopy( itCountMap_CIRC_CIRC.Matrix() );
+                    SnapshotWriter().Submit
+                    ( [=]() mutable
+                      {
+                          WriteSnapshot<Real>
+                          ( estMapCopy, itCountMapCopy, numTitle, imgTitle,
+                            numSave, imgSave, ctrl );
+                      } );
+                }
+            }
+            else
+                WriteSnapshot<Real>
+                ( estMap, itCountMap, numTitle, imgTitle, numSave, imgSave,
+                  snapCtrl );
+            if( numSave )
+                snapCtrl.numSaveCount = 0;
+            if( imgSave )
+                snapCtrl.imgSaveCount = 0;
         }
         if( imgDisp )
         {
-            auto title = BuildString( snapCtrl.imgBase, "_", numIts );
+            // The writer may be modifying the color map
+            SnapshotWriter().Wait();
+            if( snapCtrl.async || !imgSave )
+                EntrywiseMap( estMap, MakeFunction(logMap) );
+            const string& title = imgTitle;
             Display( estMap, title );
             if( snapCtrl.itCounts )
                 Display( itCountMap, title+"_counts" );
@@ -236,6 +358,7 @@ void FinalSnapshot
 {
     EL_DEBUG_CSE
     auto logMap = []( const Real& alpha ) { return Log(alpha); };
+    SnapshotWriter().Wait();
     if( snapCtrl.realSize != 0 && snapCtrl.imagSize != 0 )
     {
         const bool numSave = ( snapCtrl.numSaveFreq >= 0 );
@@ -10,6 +10,8 @@
 
 #include "./SVD/Chan.hpp"
 #include "./SVD/Product.hpp"
+#include "./SVD/Randomized.hpp"
+#include "./SVD/QDWH.hpp"
 
 namespace El {
 
@@ -229,7 +231,9 @@ SVDInfo SVD
         (bidiagSVDCtrl.wantV && bidiagSVDCtrl.accumulateV) )
         LogicError("SVD does not support singular vector accumulation");
 
-    if( !ctrl.overwrite && ctrl.bidiagSVDCtrl.approach != PRODUCT_SVD )
+    if( !ctrl.overwrite &&
+        ctrl.bidiagSVDCtrl.approach != PRODUCT_SVD &&
+        ctrl.bidiagSVDCtrl.approach != RANDOMIZED_SVD )
     {
         auto ACopy( A );
         auto ctrlMod( ctrl );
@@ -261,6 +265,14 @@ SVDInfo SVD
         ( A, U, s, V,
           ctrl.bidiagSVDCtrl.tol, relative, avoidU, avoidV );
     }
+    else if( approach == RANDOMIZED_SVD )
+    {
+        info = svd::Randomized( A, U, s, V, ctrl );
+    }
+    else if( approach == QDWH_SVD )
+    {
+        info = svd::QDWH( A, U, s, V, ctrl );
+    }
     else if( approach == THIN_SVD ||
              approach == FULL_SVD ||
              approach == COMPACT_SVD )
@@ -279,6 +291,7 @@ SVDInfo SVD
   const SVDCtrl<Base<Field>>& ctrl )
 {
     EL_DEBUG_CSE
+    EL_PROFILE_REGION("SVD");
     DistMatrix<Field> ACopy( A );
     auto ctrlMod( ctrl );
     ctrlMod.overwrite = true;
@@ -294,6 +307,7 @@ SVDInfo SVD
   const SVDCtrl<Base<Field>>& ctrl )
 {
     EL_DEBUG_CSE
+    EL_PROFILE_REGION("SVD");
     const auto& bidiagSVDCtrl = ctrl.bidiagSVDCtrl;
     if( (bidiagSVDCtrl.wantU && bidiagSVDCtrl.accumulateU) ||
         (bidiagSVDCtrl.wantV && bidiagSVDCtrl.accumulateV) )
@@ -306,7 +320,9 @@ SVDInfo SVD
     auto approach = ctrl.bidiagSVDCtrl.approach;
     const bool avoidU = !ctrl.bidiagSVDCtrl.wantU;
     const bool avoidV = !ctrl.bidiagSVDCtrl.wantV;
-    if( !ctrl.overwrite && approach != PRODUCT_SVD )
+    if( !ctrl.overwrite &&
+        approach != PRODUCT_SVD &&
+        approach != RANDOMIZED_SVD )
     {
         DistMatrix<Field> ACopy( A );
         auto ctrlMod( ctrl );
@@ -339,6 +355,14 @@ SVDInfo SVD
             ( A, U, s, V,
               ctrl.bidiagSVDCtrl.tol, relative, avoidU, avoidV );
     }
+    else if( approach == RANDOMIZED_SVD )
+    {
+        info = svd::Randomized( A, U, s, V, ctrl );
+    }
+    else if( approach == QDWH_SVD )
+    {
+        info = svd::QDWH( A, U, s, V, ctrl );
+    }
     else
     {
         info = svd::Chan( A, U, s, V, ctrl );
@@ -497,6 +521,10 @@ SVDInfo SVD
         const bool relative = (tolType == RELATIVE_TO_MAX_SING_VAL_TOL);
         return svd::Product( A, s, ctrl.bidiagSVDCtrl.tol, relative );
     }
+    else if( ctrl.bidiagSVDCtrl.approach == RANDOMIZED_SVD )
+    {
+        return svd::Randomized( A, s, ctrl );
+    }
     else
     {
         auto ACopy( A );
@@ -532,6 +560,14 @@ SVDInfo SVD
     {
         return svd::Chan( A, s, ctrl );
     }
+    else if( ctrl.bidiagSVDCtrl.approach == RANDOMIZED_SVD )
+    {
+        return svd::Randomized( A, s, ctrl );
+    }
+    else if( ctrl.bidiagSVDCtrl.approach == QDWH_SVD )
+    {
+        return svd::QDWH( AMod, s, ctrl );
+    }
     else
     {
         auto tolType = ctrl.bidiagSVDCtrl.tolType;
@@ -551,6 +587,7 @@ SVDInfo SVD
   const SVDCtrl<Base<Field>>& ctrl )
 {
     EL_DEBUG_CSE
+    EL_PROFILE_REGION("SVD");
     if( IsBlasScalar<Field>::value && ctrl.useScaLAPACK )
     {
         return svd::ScaLAPACKHelper( A, s, ctrl );
@@ -562,6 +599,15 @@ SVDInfo SVD
         DistMatrix<Field> ACopy( A );
         return svd::Chan( ACopy, s, ctrl );
     }
+    else if( ctrl.bidiagSVDCtrl.approach == RANDOMIZED_SVD )
+    {
+        return svd::Randomized( A, s, ctrl );
+    }
+    else if( ctrl.bidiagSVDCtrl.approach == QDWH_SVD )
+    {
+        DistMatrix<Field> ACopy( A );
+        return svd::QDWH( ACopy, s, ctrl );
+    }
     else
     {
         auto tolType = ctrl.bidiagSVDCtrl.tolType;
@@ -580,6 +626,7 @@ SVDInfo SVD
   const SVDCtrl<Base<Field>>& ctrl )
 {
     EL_DEBUG_CSE
+    EL_PROFILE_REGION("SVD");
     if( IsBlasScalar<Field>::value && ctrl.useScaLAPACK )
     {
         return svd::ScaLAPACKHelper( A, s, ctrl );
@@ -592,6 +639,10 @@ SVDInfo SVD
         const bool relative = (tolType == RELATIVE_TO_MAX_SING_VAL_TOL);
         return svd::Product( A, s, ctrl.bidiagSVDCtrl.tol, relative );
     }
+    if( ctrl.bidiagSVDCtrl.approach == RANDOMIZED_SVD )
+    {
+        return svd::Randomized( A, s, ctrl );
+    }
 
     if( !ctrl.overwrite )
     {
@@ -600,6 +651,10 @@ SVDInfo SVD
         DistMatrix<Field> ACopy( A );
         return SVD( ACopy, s, ctrlMod );
     }
+    if( ctrl.bidiagSVDCtrl.approach == QDWH_SVD )
+    {
+        return svd::QDWH( A, s, ctrl );
+    }
     return svd::Chan( A, s, ctrl );
 }
 
@@ -206,12 +206,32 @@ SVDInfo GolubReinsch
   const SVDCtrl<Base<Field>>& ctrl )
 {
     EL_DEBUG_CSE
+    typedef Base<Field> Real;
     const Int m = A.Height();
     const Int n = A.Width();
     SVDInfo info;
 
-    // Bidiagonalize A
     Timer timer;
+    if( ctrl.twoStageBidiag )
+    {
+        Matrix<Real> mainDiag, superDiag;
+        if( ctrl.time )
+            timer.Start();
+        bidiag::TwoStageCondensed
+        ( A, mainDiag, superDiag, ctrl.bidiagBandwidth );
+        if( ctrl.time )
+            Output("Two-stage reduction to bidiagonal: ",timer.Stop(),
+                   " seconds");
+        if( ctrl.time )
+            timer.Start();
+        info.bidiagSVDInfo =
+          BidiagSVD( UPPER, mainDiag, superDiag, s, ctrl.bidiagSVDCtrl );
+        if( ctrl.time )
+            Output("Bidiag SVD: ",timer.Stop()," seconds");
+        return info;
+    }
+
+    // Bidiagonalize A
     Matrix<Field> householderScalarsP, householderScalarsQ;
     if( ctrl.time )
         timer.Start();
@@ -241,13 +261,38 @@ SVDInfo GolubReinsch
   const SVDCtrl<Base<Field>>& ctrl )
 {
     EL_DEBUG_CSE
+    typedef Base<Field> Real;
     const Int m = A.Height();
     const Int n = A.Width();
     const Grid& g = A.Grid();
     SVDInfo info;
 
-    // Bidiagonalize A
     Timer timer;
+    if( ctrl.twoStageBidiag )
+    {
+        Matrix<Real> mainDiagLoc, superDiagLoc;
+        if( ctrl.time && g.Rank() == 0 )
+            timer.Start();
+        bidiag::TwoStageCondensed
+        ( A, mainDiagLoc, superDiagLoc, ctrl.bidiagBandwidth );
+        DistMatrix<Real,STAR,STAR> mainDiag(g), superDiag(g);
+        mainDiag.Resize( mainDiagLoc.Height(), 1 );
+        superDiag.Resize( superDiagLoc.Height(), 1 );
+        mainDiag.Matrix() = mainDiagLoc;
+        superDiag.Matrix() = superDiagLoc;
+        if( ctrl.time && g.Rank() == 0 )
+            Output("Two-stage reduction to bidiagonal: ",timer.Stop(),
+                   " seconds");
+        if( ctrl.time && g.Rank() == 0 )
+            timer.Start();
+        info.bidiagSVDInfo =
+          BidiagSVD( UPPER, mainDiag, superDiag, s, ctrl.bidiagSVDCtrl );
+        if( ctrl.time && g.Rank() == 0 )
+            Output("Bidiag SVD: ",timer.Stop()," seconds");
+        return info;
+    }
+
+    // Bidiagonalize A
     DistMatrix<Field,STAR,STAR> householderScalarsP(g), householderScalarsQ(g);
     if( ctrl.time && g.Rank() == 0 )
         timer.Start();
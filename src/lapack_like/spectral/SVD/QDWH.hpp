@@ -0,0 +1,193 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_SVD_QDWH_HPP
+#define EL_SVD_QDWH_HPP
+
+namespace El {
+namespace svd {
+
+// Compute a thin SVD of a matrix with at least as many rows as columns by
+// forming its QDWH polar decomposition, A = U_p H, and then the spectral
+// divide and conquer eigendecomposition H = V diag(s) V^H, so that
+// A = (U_p V) diag(s) V^H. Wide matrices are handled through their adjoints.
+//
+// See Nakatsukasa and Higham's "Stable and efficient spectral divide and
+// conquer algorithms for the symmetric eigenvalue decomposition and the SVD".
+
+template<typename Field>
+HermitianEigCtrl<Field> QDWHEigCtrl( const SVDCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    HermitianEigCtrl<Field> eigCtrl;
+    eigCtrl.useSDC = true;
+    eigCtrl.sdcCtrl = ctrl.sdcCtrl;
+    eigCtrl.tridiagEigCtrl.sort = DESCENDING;
+    return eigCtrl;
+}
+
+// H is only positive semi-definite up to rounding, so any slightly negative
+// eigenvalues (which are sorted to the end) are set to zero
+template<typename Real>
+void ClipNegative( Matrix<Real>& s )
+{
+    EL_DEBUG_CSE
+    const Int k = s.Height();
+    for( Int i=0; i<k; ++i )
+        s(i) = Max( s(i), Real(0) );
+}
+
+template<typename Field>
+SVDInfo QDWH
+( Matrix<Field>& A,
+  Matrix<Field>& U,
+  Matrix<Base<Field>>& s,
+  Matrix<Field>& V,
+  const SVDCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    const Int m = A.Height();
+    const Int n = A.Width();
+    if( m < n )
+    {
+        // A^H = V diag(s) U^H
+        Matrix<Field> AAdj;
+        Adjoint( A, AAdj );
+        auto ctrlAdj( ctrl );
+        std::swap( ctrlAdj.bidiagSVDCtrl.wantU, ctrlAdj.bidiagSVDCtrl.wantV );
+        return QDWH( AAdj, V, s, U, ctrlAdj );
+    }
+    const bool avoidU = !ctrl.bidiagSVDCtrl.wantU;
+
+    // A := U_p, with H = U_p^H A
+    Matrix<Field> ACopy( A ), H;
+    PolarCtrl polarCtrl;
+    polarCtrl.qdwh = true;
+    polarCtrl.qdwhCtrl = ctrl.qdwhCtrl;
+    Polar( A, polarCtrl );
+    Zeros( H, n, n );
+    Trrk( LOWER, ADJOINT, NORMAL, Field(1), A, ACopy, Field(0), H );
+
+    // H = V diag(s) V^H and U := U_p V
+    HermitianEig( LOWER, H, s, V, QDWHEigCtrl<Field>(ctrl) );
+    ClipNegative( s );
+    if( !avoidU )
+        Gemm( NORMAL, NORMAL, Field(1), A, V, U );
+    return SVDInfo();
+}
+
+template<typename Field>
+SVDInfo QDWH
+( AbstractDistMatrix<Field>& A,
+  AbstractDistMatrix<Field>& U,
+  AbstractDistMatrix<Base<Field>>& s,
+  AbstractDistMatrix<Field>& V,
+  const SVDCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Grid& g = A.Grid();
+    const Int m = A.Height();
+    const Int n = A.Width();
+    if( m < n )
+    {
+        // A^H = V diag(s) U^H
+        DistMatrix<Field> AAdj(g);
+        Adjoint( A, AAdj );
+        auto ctrlAdj( ctrl );
+        std::swap( ctrlAdj.bidiagSVDCtrl.wantU, ctrlAdj.bidiagSVDCtrl.wantV );
+        return QDWH( AAdj, V, s, U, ctrlAdj );
+    }
+    const bool avoidU = !ctrl.bidiagSVDCtrl.wantU;
+
+    // A := U_p, with H = U_p^H A
+    DistMatrix<Field> ACopy( A ), H(g);
+    PolarCtrl polarCtrl;
+    polarCtrl.qdwh = true;
+    polarCtrl.qdwhCtrl = ctrl.qdwhCtrl;
+    Polar( A, polarCtrl );
+    Zeros( H, n, n );
+    Trrk( LOWER, ADJOINT, NORMAL, Field(1), A, ACopy, Field(0), H );
+
+    // H = V diag(s) V^H and U := U_p V
+    DistMatrix<Real,VR,STAR> w(g);
+    HermitianEig( LOWER, H, w, V, QDWHEigCtrl<Field>(ctrl) );
+    ClipNegative( w.Matrix() );
+    Copy( w, s );
+    if( !avoidU )
+        Gemm( NORMAL, NORMAL, Field(1), A, V, U );
+    return SVDInfo();
+}
+
+// Compute only the singular values
+// ================================
+
+template<typename Field>
+SVDInfo QDWH
+( Matrix<Field>& A,
+  Matrix<Base<Field>>& s,
+  const SVDCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    if( A.Height() < A.Width() )
+    {
+        Matrix<Field> AAdj;
+        Adjoint( A, AAdj );
+        return QDWH( AAdj, s, ctrl );
+    }
+    const Int n = A.Width();
+
+    Matrix<Field> ACopy( A ), H;
+    PolarCtrl polarCtrl;
+    polarCtrl.qdwh = true;
+    polarCtrl.qdwhCtrl = ctrl.qdwhCtrl;
+    Polar( A, polarCtrl );
+    Zeros( H, n, n );
+    Trrk( LOWER, ADJOINT, NORMAL, Field(1), A, ACopy, Field(0), H );
+
+    HermitianEig( LOWER, H, s, QDWHEigCtrl<Field>(ctrl) );
+    ClipNegative( s );
+    return SVDInfo();
+}
+
+template<typename Field>
+SVDInfo QDWH
+( AbstractDistMatrix<Field>& A,
+  AbstractDistMatrix<Base<Field>>& s,
+  const SVDCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Grid& g = A.Grid();
+    if( A.Height() < A.Width() )
+    {
+        DistMatrix<Field> AAdj(g);
+        Adjoint( A, AAdj );
+        return QDWH( AAdj, s, ctrl );
+    }
+    const Int n = A.Width();
+
+    DistMatrix<Field> ACopy( A ), H(g);
+    PolarCtrl polarCtrl;
+    polarCtrl.qdwh = true;
+    polarCtrl.qdwhCtrl = ctrl.qdwhCtrl;
+    Polar( A, polarCtrl );
+    Zeros( H, n, n );
+    Trrk( LOWER, ADJOINT, NORMAL, Field(1), A, ACopy, Field(0), H );
+
+    DistMatrix<Real,VR,STAR> w(g);
+    HermitianEig( LOWER, H, w, QDWHEigCtrl<Field>(ctrl) );
+    ClipNegative( w.Matrix() );
+    Copy( w, s );
+    return SVDInfo();
+}
+
+} // namespace svd
+} // namespace El
+
+#endif // ifndef EL_SVD_QDWH_HPP
@@ -0,0 +1,152 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_SVD_RANDOMIZED_HPP
+#define EL_SVD_RANDOMIZED_HPP
+
+namespace El {
+namespace svd {
+
+// Approximate the largest k singular triplets of A via the SVD of Q^H A,
+// where Q is an orthonormal basis for a randomized sketch of range(A).
+
+template<typename Real>
+SVDCtrl<Real> ProjectedSVDCtrl( const SVDCtrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    if( ctrl.randomizedRank <= 0 )
+        LogicError
+        ("Randomized SVD requires a positive rank but was given ",
+         ctrl.randomizedRank);
+    auto projCtrl( ctrl );
+    projCtrl.overwrite = true;
+    projCtrl.bidiagSVDCtrl.approach = THIN_SVD;
+    return projCtrl;
+}
+
+template<typename Field>
+SVDInfo Randomized
+( const Matrix<Field>& A,
+        Matrix<Field>& U,
+        Matrix<Base<Field>>& s,
+        Matrix<Field>& V,
+  const SVDCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    auto projCtrl = ProjectedSVDCtrl( ctrl );
+    const bool avoidU = !ctrl.bidiagSVDCtrl.wantU;
+
+    Matrix<Field> Q;
+    RandomizedRangeFinder
+    ( A, ctrl.randomizedRank, Q, ctrl.rangeFinderCtrl );
+
+    // [UB,s,V] := svd(Q^H A)
+    Matrix<Field> B, UB, VB;
+    Matrix<Real> sB;
+    Gemm( ADJOINT, NORMAL, Field(1), Q, A, B );
+    projCtrl.bidiagSVDCtrl.wantU = !avoidU;
+    auto info = SVD( B, UB, sB, VB, projCtrl );
+
+    const Int k = Min( ctrl.randomizedRank, sB.Height() );
+    s = sB( IR(0,k), ALL );
+    V = VB( ALL, IR(0,k) );
+    if( !avoidU )
+        Gemm( NORMAL, NORMAL, Field(1), Q, UB(ALL,IR(0,k)), U );
+    return info;
+}
+
+template<typename Field>
+SVDInfo Randomized
+( const AbstractDistMatrix<Field>& A,
+        AbstractDistMatrix<Field>& U,
+        AbstractDistMatrix<Base<Field>>& s,
+        AbstractDistMatrix<Field>& V,
+  const SVDCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Grid& g = A.Grid();
+    auto projCtrl = ProjectedSVDCtrl( ctrl );
+    const bool avoidU = !ctrl.bidiagSVDCtrl.wantU;
+
+    DistMatrix<Field> Q(g);
+    RandomizedRangeFinder
+    ( A, ctrl.randomizedRank, Q, ctrl.rangeFinderCtrl );
+
+    // [UB,s,V] := svd(Q^H A)
+    DistMatrix<Field> B(g), UB(g), VB(g);
+    DistMatrix<Real,VR,STAR> sB(g);
+    Gemm( ADJOINT, NORMAL, Field(1), Q, A, B );
+    projCtrl.bidiagSVDCtrl.wantU = !avoidU;
+    auto info = SVD( B, UB, sB, VB, projCtrl );
+
+    const Int k = Min( ctrl.randomizedRank, sB.Height() );
+    Copy( sB( IR(0,k), ALL ), s );
+    Copy( VB( ALL, IR(0,k) ), V );
+    if( !avoidU )
+        Gemm( NORMAL, NORMAL, Field(1), Q, UB(ALL,IR(0,k)), U );
+    return info;
+}
+
+// Compute only the approximate singular values
+// ============================================
+
+template<typename Field>
+SVDInfo Randomized
+( const Matrix<Field>& A,
+        Matrix<Base<Field>>& s,
+  const SVDCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    auto projCtrl = ProjectedSVDCtrl( ctrl );
+
+    Matrix<Field> Q;
+    RandomizedRangeFinder
+    ( A, ctrl.randomizedRank, Q, ctrl.rangeFinderCtrl );
+
+    Matrix<Field> B;
+    Matrix<Real> sB;
+    Gemm( ADJOINT, NORMAL, Field(1), Q, A, B );
+    auto info = SVD( B, sB, projCtrl );
+
+    const Int k = Min( ctrl.randomizedRank, sB.Height() );
+    s = sB( IR(0,k), ALL );
+    return info;
+}
+
+template<typename Field>
+SVDInfo Randomized
+( const AbstractDistMatrix<Field>& A,
+        AbstractDistMatrix<Base<Field>>& s,
+  const SVDCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Grid& g = A.Grid();
+    auto projCtrl = ProjectedSVDCtrl( ctrl );
+
+    DistMatrix<Field> Q(g);
+    RandomizedRangeFinder
+    ( A, ctrl.randomizedRank, Q, ctrl.rangeFinderCtrl );
+
+    DistMatrix<Field> B(g);
+    DistMatrix<Real,VR,STAR> sB(g);
+    Gemm( ADJOINT, NORMAL, Field(1), Q, A, B );
+    auto info = SVD( B, sB, projCtrl );
+
+    const Int k = Min( ctrl.randomizedRank, sB.Height() );
+    Copy( sB( IR(0,k), ALL ), s );
+    return info;
+}
+
+} // namespace svd
+} // namespace El
+
+#endif // ifndef EL_SVD_RANDOMIZED_HPP
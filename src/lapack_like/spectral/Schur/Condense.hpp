@@ -21,10 +21,18 @@ void Condense
     EL_DEBUG_CSE
     Timer timer;
 
-    Matrix<F> householderScalars;
     if( ctrl.time )
         timer.Start();
-    Hessenberg( UPPER, A, householderScalars );
+    if( ctrl.twoStageHessenberg )
+    {
+        hessenberg::TwoStageReflectors<F> reflectors;
+        hessenberg::TwoStage( A, reflectors, ctrl.hessenbergBandwidth );
+    }
+    else
+    {
+        Matrix<F> householderScalars;
+        Hessenberg( UPPER, A, householderScalars );
+    }
     if( ctrl.time )
         Output("  Hessenberg reduction: ",timer.Stop()," seconds");
     MakeTrapezoidal( UPPER, A, -1 );
@@ -54,13 +62,22 @@ void Condense
     EL_DEBUG_CSE
     Timer timer;
 
-    Matrix<F> householderScalars;
     if( ctrl.time )
         timer.Start();
-    Hessenberg( UPPER, A, householderScalars );
+    if( ctrl.twoStageHessenberg )
+    {
+        hessenberg::TwoStageReflectors<F> reflectors;
+        hessenberg::TwoStage( A, reflectors, ctrl.hessenbergBandwidth );
+        hessenberg::FormTwoStageQ( A, reflectors, Q );
+    }
+    else
+    {
+        Matrix<F> householderScalars;
+        Hessenberg( UPPER, A, householderScalars );
+        hessenberg::FormQ( UPPER, A, householderScalars, Q );
+    }
     if( ctrl.time )
         Output("  Hessenberg reduction: ",timer.Stop()," seconds");
-    hessenberg::FormQ( UPPER, A, householderScalars, Q );
     MakeTrapezoidal( UPPER, A, -1 );
 
     auto hessSchurCtrl( ctrl.hessSchurCtrl );
@@ -93,7 +110,14 @@ void Condense
     // Reduce the matrix to upper-Hessenberg form in an elemental form
     if( ctrl.time && grid.Rank() == 0 )
         timer.Start();
-    hessenberg::ExplicitCondensed( UPPER, A );
+    if( ctrl.twoStageHessenberg )
+    {
+        hessenberg::TwoStageReflectors<F> reflectors;
+        hessenberg::TwoStage( A, reflectors, ctrl.hessenbergBandwidth );
+        MakeTrapezoidal( UPPER, A, -1 );
+    }
+    else
+        hessenberg::ExplicitCondensed( UPPER, A );
     if( ctrl.time && grid.Rank() == 0 )
         Output("  Hessenberg reduction: ",timer.Stop()," seconds"); 
 
@@ -127,16 +151,23 @@ void Condense
 
     // Reduce A to upper-Hessenberg form
     DistMatrix<F,STAR,STAR> householderScalars( A.Grid() );
+    hessenberg::TwoStageReflectors<F> reflectors;
     if( ctrl.time && grid.Rank() == 0 )
         timer.Start();
-    Hessenberg( UPPER, A, householderScalars );
+    if( ctrl.twoStageHessenberg )
+        hessenberg::TwoStage( A, reflectors, ctrl.hessenbergBandwidth );
+    else
+        Hessenberg( UPPER, A, householderScalars );
     if( ctrl.time && grid.Rank() == 0 )
         Output("  Hessenberg reduction: ",timer.Stop()," seconds");
 
     // Explicitly accumulate the Householder transformations into Q
     if( ctrl.time && grid.Rank() == 0 )
         timer.Start();
-    hessenberg::FormQ( UPPER, A, householderScalars, Q );
+    if( ctrl.twoStageHessenberg )
+        hessenberg::FormTwoStageQ( A, reflectors, Q );
+    else
+        hessenberg::FormQ( UPPER, A, householderScalars, Q );
     if( ctrl.time && grid.Rank() == 0 )
         Output("  hessenberg::FormQ: ",timer.Stop()," seconds");
     MakeTrapezoidal( UPPER, A, -1 );
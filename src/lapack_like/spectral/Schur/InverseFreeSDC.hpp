@@ -166,7 +166,7 @@ int InverseFreeSign
 }
 
 template<typename F>
-Base<F> InverseFreeSignDivide( Matrix<F>& X )
+ValueInt<Base<F>> InverseFreeSignDivide( Matrix<F>& X )
 {
     EL_DEBUG_CSE
     typedef Base<F> Real;
@@ -253,8 +253,104 @@ ValueInt<Base<F>> InverseFreeSignDivide( AbstractDistMatrix<F>& XPre )
     return part;
 }
 
-// TODO: RandomizedInverseFreeSignDivide which uses high-level algorithm
-//       of http://parlab.eecs.berkeley.edu/sites/all/parlab/files/Communication%20Avoiding%20Nonsymmetric.pdf
+// The randomized analogues of the above, which replace the column-pivoted QR
+// factorization of A with the unpivoted QR factorization of A V^H, where V
+// is Haar-distributed, so that the split is a generalized RURV of
+// inv(A + B) A. See G. Ballard, J. Demmel, and I. Dumitriu's
+// "Minimizing communication for eigenproblems and the singular value
+// decomposition" (LAWN 237).
+
+template<typename F>
+ValueInt<Base<F>> RandomizedInverseFreeSignDivide( Matrix<F>& X )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    const Int n = X.Width();
+    if( X.Height() != 2*n )
+        LogicError("Matrix should be 2n x n");
+
+    // Expose A and B, and then copy A
+    auto B = X( IR(0,n  ), ALL );
+    auto A = X( IR(n,2*n), ALL );
+    Matrix<F> ACopy( A );
+
+    // Run the inverse-free alternative to Sign
+    InverseFreeSign( X );
+
+    // Compute the generalized RURV of inv(A + B) A
+    // 1) B := A + B
+    // 2) [Q,R] := QR(A V^H)
+    // 3) B := Q^H B
+    // 4) [R,Q] := RQ(B)
+    B += A;
+    Matrix<F> V, householderScalars;
+    Matrix<Base<F>> signature;
+    ImplicitHaar( V, householderScalars, signature, n );
+    qr::ApplyQ( RIGHT, ADJOINT, V, householderScalars, signature, A );
+    QR( A, householderScalars, signature );
+    qr::ApplyQ( LEFT, ADJOINT, A, householderScalars, signature, B );
+    RQ( B, householderScalars, signature );
+
+    // A := Q^H A Q
+    A = ACopy;
+    rq::ApplyQ( LEFT, ADJOINT, B, householderScalars, signature, A );
+    rq::ApplyQ( RIGHT, NORMAL, B, householderScalars, signature, A );
+
+    // Return || E21 ||1 / || A ||1
+    ValueInt<Real> part = ComputePartition( A );
+    part.value /= OneNorm(ACopy);
+    return part;
+}
+
+template<typename F>
+ValueInt<Base<F>> RandomizedInverseFreeSignDivide
+( AbstractDistMatrix<F>& XPre,
+  const QRCtrl<Base<F>>& qrCtrl=QRCtrl<Base<F>>() )
+{
+    EL_DEBUG_CSE
+
+    DistMatrixReadWriteProxy<F,F,MC,MR> XProx( XPre );
+    auto& X = XProx.Get();
+
+    typedef Base<F> Real;
+    const Grid& g = X.Grid();
+    const Int n = X.Width();
+    if( X.Height() != 2*n )
+        LogicError("Matrix should be 2n x n");
+
+    // Expose A and B, and then copy A
+    auto B = X( IR(0,n  ), ALL );
+    auto A = X( IR(n,2*n), ALL );
+    DistMatrix<F> ACopy( A );
+
+    // Run the inverse-free alternative to Sign
+    InverseFreeSign( X );
+
+    // Compute the generalized RURV of inv(A + B) A
+    // 1) B := A + B
+    // 2) [Q,R] := QR(A V^H)
+    // 3) B := Q^H B
+    // 4) [R,Q] := RQ(B)
+    B += A;
+    DistMatrix<F> V(g);
+    DistMatrix<F,MD,STAR> householderScalars(g);
+    DistMatrix<Base<F>,MD,STAR> signature(g);
+    ImplicitHaar( V, householderScalars, signature, n, qrCtrl );
+    qr::ApplyQ( RIGHT, ADJOINT, V, householderScalars, signature, A );
+    QR( A, householderScalars, signature, qrCtrl );
+    qr::ApplyQ( LEFT, ADJOINT, A, householderScalars, signature, B );
+    RQ( B, householderScalars, signature );
+
+    // A := Q^H A Q
+    A = ACopy;
+    rq::ApplyQ( LEFT, ADJOINT, B, householderScalars, signature, A );
+    rq::ApplyQ( RIGHT, NORMAL, B, householderScalars, signature, A );
+
+    // Return || E21 ||1 / || A ||1
+    ValueInt<Real> part = ComputePartition( A );
+    part.value /= OneNorm(ACopy);
+    return part;
+}
 
 } // namespace schur
 } // namespace El
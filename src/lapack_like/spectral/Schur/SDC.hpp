@@ -127,6 +127,22 @@ ValueInt<Base<F>> ComputePartition( DistMatrix<F>& A )
     return part;
 }
 
+// Equivalent to ImplicitHaar, but with the controls (e.g., for
+// communication-avoiding panels) of the unpivoted QR factorization of the
+// Gaussian matrix
+template<typename F>
+void ImplicitHaar
+( DistMatrix<F>& V,
+  DistMatrix<F,MD,STAR>& householderScalars,
+  DistMatrix<Base<F>,MD,STAR>& signature,
+  Int n,
+  const QRCtrl<Base<F>>& qrCtrl )
+{
+    EL_DEBUG_CSE
+    Gaussian( V, n, n );
+    El::QR( V, householderScalars, signature, qrCtrl );
+}
+
 // G should be a rational function of A. If returnQ=true, G will be set to
 // the computed unitary matrix upon exit.
 template<typename F>
@@ -148,7 +164,7 @@ ValueInt<Base<F>> SignDivide
     Matrix<F> householderScalars;
     Matrix<Base<F>> signature;
     Permutation Omega;
-    El::QR( G, householderScalars, signature, Omega );
+    El::QR( G, householderScalars, signature, Omega, ctrl.qrCtrl );
 
     // A := Q^H A Q
     const Base<F> oneA = OneNorm( A );
@@ -193,7 +209,7 @@ ValueInt<Base<F>> SignDivide
     DistMatrix<F,MD,STAR> householderScalars(g);
     DistMatrix<Base<F>,MD,STAR> signature(g);
     DistPermutation Omega(g);
-    El::QR( G, householderScalars, signature, Omega );
+    El::QR( G, householderScalars, signature, Omega, ctrl.qrCtrl );
 
     // A := Q^H A Q
     const Base<F> oneA = OneNorm( A );
@@ -315,9 +331,9 @@ ValueInt<Base<F>> RandomizedSignDivide
         G = S;
 
         // Compute the RURV of the spectral projector
-        ImplicitHaar( V, householderScalars, signature, n );
+        ImplicitHaar( V, householderScalars, signature, n, ctrl.qrCtrl );
         qr::ApplyQ( RIGHT, NORMAL, V, householderScalars, signature, G );
-        El::QR( G, householderScalars, signature );
+        El::QR( G, householderScalars, signature, ctrl.qrCtrl );
 
         // A := Q^H A Q [and reuse space for V for keeping original A]
         V = A;
@@ -0,0 +1,510 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+#include "./Lanczos/Orthonormalize.hpp"
+
+namespace El {
+namespace spectrum_slice {
+
+// Compute the 'numEigs' eigenpairs of A with eigenvalues in
+// (lowerBound,upperBound] using block Lanczos on inv(A - sigma I), where
+// 'applyInverse' overwrites the local rows of a block with the result of
+// applying inv(A - sigma I)
+template<typename Field,class ApplyType>
+void ShiftInvertLanczos
+(       Int n,
+        Int localHeight,
+  const ApplyType& applyInverse,
+        mpi::Comm comm,
+        Int numEigs,
+        Base<Field> sigma,
+        Base<Field> lowerBound,
+        Base<Field> upperBound,
+  const SpectrumSliceCtrl<Base<Field>>& ctrl,
+        Matrix<Base<Field>>& w,
+        Matrix<Field>& ZLoc )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Real eps = limits::Epsilon<Real>();
+    const Real tol =
+      ( ctrl.tol > Real(0) ? ctrl.tol : Pow(eps,Real(3)/Real(4)) );
+    const Int s = Max( Min(ctrl.blockSize,n), Int(1) );
+    const Int maxBasisSize =
+      Min( ctrl.maxBasisSize > 0 ? ctrl.maxBasisSize : 3*numEigs+10*s, n );
+    const Int maxBlocks = Max( maxBasisSize/s, Int(1) );
+
+    Matrix<Field> V, H, W, R, AJ, AJAdj, HCopy, S, RS;
+    Matrix<Real> theta;
+    Zeros( V, localHeight, maxBlocks*s );
+    Zeros( H, maxBlocks*s, maxBlocks*s );
+    {
+        auto V0 = V( ALL, IR(0,s) );
+        MakeUniform( V0 );
+        Matrix<Field> VEmpty( localHeight, 0 );
+        lanczos::Orthonormalize( n, VEmpty, V0, R, comm );
+    }
+
+    for( Int j=0; j<maxBlocks; ++j )
+    {
+        const Int m = (j+1)*s;
+        const Range<Int> indJ( j*s, m );
+        auto Vj = V( ALL, indJ );
+
+        // W := inv(A - sigma I) V_j - V_{j-1} B_{j-1}^H - V_j A_j
+        W = Vj;
+        applyInverse( W );
+        if( j > 0 )
+        {
+            const Range<Int> indPrev( (j-1)*s, j*s );
+            auto VPrev = V( ALL, indPrev );
+            auto BPrevAdj = H( indPrev, indJ );
+            Gemm( NORMAL, NORMAL, Field(-1), VPrev, BPrevAdj, Field(1), W );
+        }
+        Zeros( AJ, s, s );
+        Gemm( ADJOINT, NORMAL, Field(1), Vj, W, Field(0), AJ );
+        mpi::AllReduce( AJ.Buffer(), s*s, comm );
+        Adjoint( AJ, AJAdj );
+        AJ += AJAdj;
+        AJ *= Real(1)/Real(2);
+        Gemm( NORMAL, NORMAL, Field(-1), Vj, AJ, Field(1), W );
+        auto HJJ = H( indJ, indJ );
+        HJJ = AJ;
+
+        // W := V_{j+1} B_j
+        if( m < n )
+        {
+            auto VBasis = V( ALL, IR(0,m) );
+            lanczos::Orthonormalize( n, VBasis, W, R, comm );
+        }
+        else
+            Zeros( R, s, s );
+        if( j+1 < maxBlocks )
+        {
+            const Range<Int> indNext( m, m+s );
+            auto VNext = V( ALL, indNext );
+            auto BJ = H( indNext, indJ );
+            auto BJAdj = H( indJ, indNext );
+            VNext = W;
+            BJ = R;
+            Adjoint( R, BJAdj );
+        }
+
+        // Test the Ritz pairs for convergence
+        HCopy = H( IR(0,m), IR(0,m) );
+        HermitianEig( LOWER, HCopy, theta, S );
+        auto SLast = S( indJ, ALL );
+        Zeros( RS, s, m );
+        Gemm( NORMAL, NORMAL, Field(1), R, SLast, Field(0), RS );
+        vector<pair<Real,Int>> converged;
+        for( Int i=0; i<m; ++i )
+        {
+            const Real thetaAbs = Abs(theta(i));
+            if( thetaAbs == Real(0) )
+                continue;
+            const Real lambda = sigma + 1/theta(i);
+            if( lambda <= lowerBound || lambda > upperBound )
+                continue;
+            const Real residual = FrobeniusNorm( RS(ALL,IR(i)) );
+            if( residual <= tol*thetaAbs )
+                converged.push_back( pair<Real,Int>(thetaAbs,i) );
+        }
+        if( ctrl.progress )
+            Output
+            ("  basis size ",m,": ",converged.size()," of ",numEigs,
+             " Ritz pairs converged");
+        if( Int(converged.size()) >= numEigs || m >= n )
+        {
+            if( Int(converged.size()) < numEigs )
+                RuntimeError
+                ("Only found ",converged.size()," of ",numEigs,
+                 " eigenvalues in (",lowerBound,",",upperBound,"]");
+
+            // Keep the dominant Ritz values and sort by eigenvalue
+            std::sort
+            ( converged.begin(), converged.end(),
+              []( const pair<Real,Int>& a, const pair<Real,Int>& b )
+              { return a.first > b.first; } );
+            converged.resize( numEigs );
+            vector<pair<Real,Int>> sorted(numEigs);
+            for( Int k=0; k<numEigs; ++k )
+            {
+                const Int i = converged[k].second;
+                sorted[k] = pair<Real,Int>(sigma+1/theta(i),i);
+            }
+            std::sort( sorted.begin(), sorted.end() );
+
+            Matrix<Field> SSel;
+            Zeros( SSel, m, numEigs );
+            w.Resize( numEigs, 1 );
+            for( Int k=0; k<numEigs; ++k )
+            {
+                w(k) = sorted[k].first;
+                auto sSel = SSel( ALL, IR(k) );
+                sSel = S( ALL, IR(sorted[k].second) );
+            }
+            Zeros( ZLoc, localHeight, numEigs );
+            auto VBasis = V( ALL, IR(0,m) );
+            Gemm( NORMAL, NORMAL, Field(1), VBasis, SSel, Field(0), ZLoc );
+            return;
+        }
+    }
+    RuntimeError
+    ("Shift-and-invert Lanczos did not converge within ",maxBlocks*s,
+     " vectors for the slice (",lowerBound,",",upperBound,"]");
+}
+
+inline void SliceRange
+( Int numSlices, Int numTeams, Int team, Int& sliceBeg, Int& sliceEnd )
+{
+    sliceBeg = (team*numSlices) / numTeams;
+    sliceEnd = ((team+1)*numSlices) / numTeams;
+}
+
+// Overwrite 'factorization' with the factorization of A - sigma I and return
+// its inertia, where 'ABase' is A with an explicitly stored diagonal
+template<typename Field>
+InertiaType FactorShifted
+( const SparseMatrix<Field>& ABase,
+        SparseMatrix<Field>& AShift,
+        Base<Field> sigma,
+        SparseLDLFactorization<Field>& factorization,
+        LDLFrontType frontType )
+{
+    EL_DEBUG_CSE
+    AShift = ABase;
+    ShiftDiagonal( AShift, -sigma, 0, true );
+    factorization.ChangeNonzeroValues( AShift );
+    factorization.Factor( frontType );
+    return ldl::Inertia( factorization );
+}
+
+template<typename Field>
+InertiaType FactorShifted
+( const DistSparseMatrix<Field>& ABase,
+        DistSparseMatrix<Field>& AShift,
+        Base<Field> sigma,
+        DistSparseLDLFactorization<Field>& factorization,
+        LDLFrontType frontType )
+{
+    EL_DEBUG_CSE
+    AShift = ABase;
+    ShiftDiagonal( AShift, -sigma, 0, true );
+    factorization.Refactor( AShift, frontType );
+    return ldl::Inertia( factorization );
+}
+
+// Factor about the center of a slice, perturbing the shift if it happened to
+// be an eigenvalue (since the unpivoted LDL^H factorization is then
+// singular)
+template<class FactorType,typename Real>
+Real FactorCenter
+( const FactorType& factor, Real lowerBound, Real upperBound )
+{
+    Real sigma = (lowerBound+upperBound) / 2;
+    for( Int attempt=0; attempt<10; ++attempt )
+    {
+        const InertiaType inertia = factor( sigma );
+        if( inertia.numZero == 0 )
+            return sigma;
+        sigma += (upperBound-lowerBound) / Real(1000);
+    }
+    RuntimeError("Could not find a nonsingular shift within the slice");
+    return sigma;
+}
+
+// Give every team a copy of A by sending the local entries of each process
+// to one member of each team, which forwards them to their owners
+template<typename Field>
+void CopyToTeam
+( const DistSparseMatrix<Field>& A,
+  const vector<int>& teamOffsets,
+        DistSparseMatrix<Field>& ATeam )
+{
+    EL_DEBUG_CSE
+    mpi::Comm comm = A.Grid().Comm();
+    const int commSize = mpi::Size( comm );
+    const int commRank = mpi::Rank( comm );
+    const Int numTeams = teamOffsets.size()-1;
+    const Int numLocalEntries = A.NumLocalEntries();
+
+    vector<int> sendCounts(commSize,0);
+    for( Int t=0; t<numTeams; ++t )
+    {
+        const int teamSize = teamOffsets[t+1] - teamOffsets[t];
+        sendCounts[teamOffsets[t]+commRank%teamSize] += numLocalEntries;
+    }
+    vector<int> sendOffs;
+    const int totalSend = Scan( sendCounts, sendOffs );
+    auto offs = sendOffs;
+    vector<Entry<Field>> sendBuf(totalSend);
+    for( Int t=0; t<numTeams; ++t )
+    {
+        const int teamSize = teamOffsets[t+1] - teamOffsets[t];
+        const int dest = teamOffsets[t] + commRank%teamSize;
+        for( Int e=0; e<numLocalEntries; ++e )
+            sendBuf[offs[dest]++] =
+              Entry<Field>{ A.Row(e), A.Col(e), A.Value(e) };
+    }
+    auto recvBuf = mpi::AllToAll( sendBuf, sendCounts, sendOffs, comm );
+
+    ATeam.Resize( A.Height(), A.Width() );
+    ATeam.Reserve( recvBuf.size(), recvBuf.size() );
+    for( auto& entry : recvBuf )
+        ATeam.QueueUpdate( entry );
+    ATeam.ProcessQueues();
+}
+
+} // namespace spectrum_slice
+
+template<typename Field>
+void HermitianSpectrumSlice
+( const SparseMatrix<Field>& A,
+        Base<Field> lowerBound,
+        Base<Field> upperBound,
+        Matrix<Base<Field>>& w,
+        Matrix<Field>& Z,
+  const SpectrumSliceCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Int n = A.Height();
+    if( A.Width() != n )
+        LogicError("A must be square");
+    if( lowerBound >= upperBound )
+        LogicError("Invalid interval (",lowerBound,",",upperBound,"]");
+    if( ctrl.numSlices < 1 )
+        LogicError("Invalid number of slices: ",ctrl.numSlices);
+    const Int numSlices = ctrl.numSlices;
+
+    // The symbolic analysis is shared by the factorizations of every shift
+    const bool hermitian = true;
+    SparseMatrix<Field> ABase( A ), AShift;
+    ShiftDiagonal( ABase, Real(0) );
+    SparseLDLFactorization<Field> factorization;
+    factorization.Initialize( ABase, hermitian, ctrl.bisectCtrl );
+    auto factor =
+      [&]( Real sigma )
+      {
+          return spectrum_slice::FactorShifted
+          ( ABase, AShift, sigma, factorization, ctrl.frontType );
+      };
+
+    // Count the eigenvalues at most each of the slice boundaries
+    const Real width = (upperBound-lowerBound) / numSlices;
+    vector<Real> bounds(numSlices+1);
+    vector<Int> counts(numSlices+1);
+    for( Int i=0; i<=numSlices; ++i )
+    {
+        bounds[i] = ( i == numSlices ? upperBound : lowerBound+i*width );
+        const InertiaType inertia = factor( bounds[i] );
+        counts[i] = inertia.numNegative + inertia.numZero;
+    }
+    const Int numEigs = counts[numSlices] - counts[0];
+    Zeros( w, numEigs, 1 );
+    Zeros( Z, n, numEigs );
+
+    Matrix<Real> wSlice;
+    Matrix<Field> ZSlice;
+    auto applyInverse = [&]( Matrix<Field>& X ) { factorization.Solve( X ); };
+    Int offset = 0;
+    for( Int i=0; i<numSlices; ++i )
+    {
+        const Int numSliceEigs = counts[i+1] - counts[i];
+        if( ctrl.progress )
+            Output
+            ("Slice (",bounds[i],",",bounds[i+1],"] has ",numSliceEigs,
+             " eigenvalues");
+        if( numSliceEigs == 0 )
+            continue;
+
+        const Real sigma =
+          spectrum_slice::FactorCenter( factor, bounds[i], bounds[i+1] );
+        spectrum_slice::ShiftInvertLanczos
+        ( n, n, applyInverse, mpi::COMM_SELF, numSliceEigs, sigma,
+          bounds[i], bounds[i+1], ctrl, wSlice, ZSlice );
+
+        auto wSub = w( IR(offset,offset+numSliceEigs), ALL );
+        auto ZSub = Z( ALL, IR(offset,offset+numSliceEigs) );
+        wSub = wSlice;
+        ZSub = ZSlice;
+        offset += numSliceEigs;
+    }
+}
+
+template<typename Field>
+void HermitianSpectrumSlice
+( const DistSparseMatrix<Field>& A,
+        Base<Field> lowerBound,
+        Base<Field> upperBound,
+        Matrix<Base<Field>>& w,
+        DistMultiVec<Field>& Z,
+  const SpectrumSliceCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Int n = A.Height();
+    if( A.Width() != n )
+        LogicError("A must be square");
+    if( lowerBound >= upperBound )
+        LogicError("Invalid interval (",lowerBound,",",upperBound,"]");
+    if( ctrl.numSlices < 1 )
+        LogicError("Invalid number of slices: ",ctrl.numSlices);
+    const Int numSlices = ctrl.numSlices;
+
+    const Grid& grid = A.Grid();
+    mpi::Comm comm = grid.Comm();
+    const int commSize = mpi::Size( comm );
+    const int commRank = mpi::Rank( comm );
+    const Int numTeams =
+      Min( ctrl.numTeams > 0 ? ctrl.numTeams : numSlices, Int(commSize) );
+
+    // Split the processes into contiguous teams
+    const int team = (Int(commRank)*numTeams) / commSize;
+    vector<int> teamOffsets(numTeams+1,commSize);
+    for( int q=commSize-1; q>=0; --q )
+        teamOffsets[(Int(q)*numTeams)/commSize] = q;
+    mpi::Comm teamComm;
+    mpi::Split( comm, team, commRank, teamComm );
+    const Grid teamGrid( teamComm );
+    mpi::Free( teamComm );
+    const bool teamRoot = ( teamGrid.Rank() == 0 );
+
+    const bool hermitian = true;
+    DistSparseMatrix<Field> ABase(teamGrid), AShift(teamGrid);
+    spectrum_slice::CopyToTeam( A, teamOffsets, ABase );
+    ShiftDiagonal( ABase, Real(0) );
+    DistSparseLDLFactorization<Field> factorization;
+    factorization.Initialize( ABase, hermitian, ctrl.bisectCtrl );
+    auto factor =
+      [&]( Real sigma )
+      {
+          return spectrum_slice::FactorShifted
+          ( ABase, AShift, sigma, factorization, ctrl.frontType );
+      };
+
+    Int sliceBeg, sliceEnd;
+    spectrum_slice::SliceRange( numSlices, numTeams, team, sliceBeg, sliceEnd );
+    const Real width = (upperBound-lowerBound) / numSlices;
+    auto bound =
+      [&]( Int i ) { return i == numSlices ? upperBound : lowerBound+i*width; };
+
+    DistMultiVec<Field> X(teamGrid);
+    X.Resize( n, 1 );
+    const Int localHeight = X.LocalHeight();
+    auto applyInverse =
+      [&]( Matrix<Field>& XLoc )
+      {
+          X.Resize( n, XLoc.Width() );
+          X.Matrix() = XLoc;
+          factorization.Solve( X );
+          XLoc = X.LockedMatrix();
+      };
+
+    // Compute the eigenpairs of the slices of this team
+    vector<Real> wTeam;
+    Matrix<Field> ZTeam, ZSlice;
+    Matrix<Real> wSlice;
+    Zeros( ZTeam, localHeight, 0 );
+    Int countBeg = 0;
+    if( sliceBeg < sliceEnd )
+    {
+        const InertiaType inertia = factor( bound(sliceBeg) );
+        countBeg = inertia.numNegative + inertia.numZero;
+    }
+    for( Int i=sliceBeg; i<sliceEnd; ++i )
+    {
+        const InertiaType inertia = factor( bound(i+1) );
+        const Int countEnd = inertia.numNegative + inertia.numZero;
+        const Int numSliceEigs = countEnd - countBeg;
+        countBeg = countEnd;
+        if( ctrl.progress && teamRoot )
+            Output
+            ("Team ",team,": slice (",bound(i),",",bound(i+1),"] has ",
+             numSliceEigs," eigenvalues");
+        if( numSliceEigs == 0 )
+            continue;
+
+        const Real sigma =
+          spectrum_slice::FactorCenter( factor, bound(i), bound(i+1) );
+        spectrum_slice::ShiftInvertLanczos
+        ( n, localHeight, applyInverse, teamGrid.Comm(), numSliceEigs, sigma,
+          bound(i), bound(i+1), ctrl, wSlice, ZSlice );
+
+        const Int teamEigs = wTeam.size();
+        for( Int k=0; k<numSliceEigs; ++k )
+            wTeam.push_back( wSlice(k) );
+        ZTeam.Resize( localHeight, teamEigs+numSliceEigs );
+        auto ZSub = ZTeam( ALL, IR(teamEigs,teamEigs+numSliceEigs) );
+        ZSub = ZSlice;
+    }
+
+    // Gather the eigenvalues from the root of each team (the teams, and
+    // their slices, are ordered by rank)
+    const int numTeamEigs = wTeam.size();
+    const int numContrib = ( teamRoot ? numTeamEigs : 0 );
+    vector<int> recvCounts(commSize), recvOffs;
+    mpi::AllGather( &numContrib, 1, recvCounts.data(), 1, comm );
+    const int numEigs = Scan( recvCounts, recvOffs );
+    w.Resize( numEigs, 1 );
+    mpi::AllGather
+    ( wTeam.data(), numContrib,
+      w.Buffer(), recvCounts.data(), recvOffs.data(), comm );
+    const Int colOffset = recvOffs[teamOffsets[team]];
+
+    // Send the eigenvectors of this team to the owners of their rows in Z
+    Z.SetGrid( grid );
+    Zeros( Z, n, numEigs );
+    const Int firstLocalRow = X.FirstLocalRow();
+    vector<int> sendCounts(commSize,0);
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+        sendCounts[Z.RowOwner(firstLocalRow+iLoc)] += numTeamEigs;
+    vector<int> sendOffs;
+    const int totalSend = Scan( sendCounts, sendOffs );
+    auto offs = sendOffs;
+    vector<Entry<Field>> sendBuf(totalSend);
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+    {
+        const Int i = firstLocalRow + iLoc;
+        const int owner = Z.RowOwner(i);
+        for( Int j=0; j<numTeamEigs; ++j )
+            sendBuf[offs[owner]++] =
+              Entry<Field>{ i, colOffset+j, ZTeam(iLoc,j) };
+    }
+    auto recvBuf = mpi::AllToAll( sendBuf, sendCounts, sendOffs, comm );
+    Matrix<Field>& ZLoc = Z.Matrix();
+    for( auto& entry : recvBuf )
+        ZLoc( entry.i-Z.FirstLocalRow(), entry.j ) = entry.value;
+}
+
+#define PROTO(Field) \
+  template void HermitianSpectrumSlice \
+  ( const SparseMatrix<Field>& A, \
+          Base<Field> lowerBound, \
+          Base<Field> upperBound, \
+          Matrix<Base<Field>>& w, \
+          Matrix<Field>& Z, \
+    const SpectrumSliceCtrl<Base<Field>>& ctrl ); \
+  template void HermitianSpectrumSlice \
+  ( const DistSparseMatrix<Field>& A, \
+          Base<Field> lowerBound, \
+          Base<Field> upperBound, \
+          Matrix<Base<Field>>& w, \
+          DistMultiVec<Field>& Z, \
+    const SpectrumSliceCtrl<Base<Field>>& ctrl );
+
+#define EL_NO_INT_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
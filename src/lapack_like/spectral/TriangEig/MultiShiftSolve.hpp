@@ -23,27 +23,22 @@ namespace triang_eig {
 // See "Robust Triangular Solves for Use in Condition
 // Estimation" by Edward Anderson for notation and bounds.
 // Entries in U are assumed to be less (in magnitude) than bigNum.
+//
+// Overwrites x with scale inv(U - shift I) x, where U is n x n upper
+// triangular and cNorm holds the infinity norms of the strictly upper
+// portions of its columns, and returns the scale. The shifted diagonal is
+// formed on the fly so that U is never modified, which allows the columns of
+// a block to be solved concurrently with each scale tracked separately (as
+// in LAPACK's xTREVC3).
 template<typename Field>
-void MultiShiftDiagonalBlockSolve
-(       Matrix<Field>& U,
-  const Matrix<Field>& shifts,
-        Matrix<Field>& X,
-        Matrix<Field>& scales )
+Base<Field> ShiftedSolveKernel
+( Int n,
+  const Field* U, Int ULDim,
+  const Base<Field>* cNorm,
+  const Field& shift,
+        Field* x )
 {
-    EL_DEBUG_CSE
     typedef Base<Field> Real;
-    EL_DEBUG_ONLY(
-      if( U.Height() != U.Width() )
-          LogicError("Triangular matrix must be square");
-      if( U.Width() != X.Height() )
-          LogicError("Matrix dimensions do not match");
-      if( shifts.Height() != X.Width() )
-          LogicError("Incompatible number of shifts");
-    )
-    auto diag = GetDiagonal(U);
-    const Int n = U.Height();
-    const Int numShifts = shifts.Height();
-
     const Real underflow = limits::SafeMin<Real>();
     const Real overflow = limits::Max<Real>();
     const Real ulp = limits::Precision<Real>();
@@ -53,174 +48,207 @@ void MultiShiftDiagonalBlockSolve
     const Real oneHalf = Real(1)/Real(2);
     const Real oneQuarter = Real(1)/Real(4);
 
-    // Default scale is 1
-    Ones( scales, numShifts, 1 );
-
-    // Compute infinity norms of columns of U (excluding diagonal)
-    Matrix<Real> cNorm( n, 1 );
-    cNorm(0) = 0;
-    for( Int j=1; j<n; ++j )
+    // TODO(poulson): Perhaps preserve phase in complex plane
+    const Real smallDiag = Max( ulp*OneAbs(shift), smallNum );
+    auto shiftedDiag = [&]( Int i )
     {
-        //cNormBuf[j] = MaxNorm( U(IR(0,j),IR(j)) );
-        cNorm(j) = 0;
-        for( Int i=0; i<j; ++i )
-            cNorm(j) = Max( cNorm(j), Abs(U(i,j)) );
+        Field delta = U[i+i*ULDim] - shift;
+        if( OneAbs(delta) < smallDiag )
+            delta = smallDiag;
+        return delta;
+    };
+    auto scaleX = [&]( const Real& s )
+    {
+        for( Int i=0; i<n; ++i )
+            x[i] *= s;
+    };
+    Real scale = Real(1);
+
+    // Determine largest entry of RHS
+    Real xMax = 0;
+    for( Int i=0; i<n; ++i )
+        xMax = Max( xMax, Abs(x[i]) );
+    if( xMax >= bigNum )
+    {
+        const Real s = oneHalf*bigNum/xMax;
+        scaleX( s );
+        xMax *= s;
+        scale *= s;
     }
+    if( xMax <= smallNum )
+        return scale;
 
-    // Iterate through RHS's
-    for( Int j=1; j<numShifts; ++j )
+    // Estimate growth of entries in triangular solve
+    Real invGi = 1/xMax;
+    Real invMi = invGi;
+    for( Int i=n-1; i>=0; --i )
     {
-        const Int xHeight = Min(n,j);
-
-        // Initialize triangular system
-        // TODO(poulson): Only modify the first xHeight entries of the diagonal
-        SetDiagonal( U, diag );
-        const Field shift = shifts(j);
-        const Real smallDiag = Max( ulp*OneAbs(shift), smallNum );
-        for( Int k=0; k<xHeight; ++k )
+        const Real absUii = SafeAbs( shiftedDiag(i) );
+        if( invGi<=smallNum || invMi<=smallNum || absUii<=smallNum )
         {
-            U(k,k) -= shift;
-            // TODO(poulson): Perhaps preserve phase in complex plane
-            if( OneAbs(U(k,k)) < smallDiag )
-                U(k,k) = smallDiag;
+            invGi = 0;
+            break;
         }
-        auto xj = X( IR(0,xHeight), IR(j) );
-        Real scales_j = Real(1);
-
-        // Determine largest entry of RHS
-        Real xjMax = MaxNorm( xj );
-        if( xjMax >= bigNum )
+        invMi = Min( invMi, absUii*invGi );
+        if( i > 0 )
         {
-            const Real s = oneHalf*bigNum/xjMax;
-            xj *= s;
-            xjMax *= s;
-            scales_j *= s;
+            invGi *= absUii/(absUii+cNorm[i]);
         }
-        if( xjMax <= smallNum )
+    }
+    invGi = Min( invGi, invMi );
+
+    if( invGi > smallNum )
+    {
+        // Perform an unprotected backward substitution since the estimated
+        // growth is not too large
+        for( Int i=n-1; i>=0; --i )
         {
-            continue;
+            x[i] /= shiftedDiag(i);
+            if( i > 0 )
+                blas::Axpy( i, -x[i], &U[i*ULDim], 1, x, 1 );
         }
+        return scale;
+    }
 
-        // Estimate growth of entries in triangular solve
-        //   Note: See "Robust Triangular Solves for Use in Condition
-        //   Estimation" by Edward Anderson for explanation of bounds.
-        Real invGi = 1/xjMax;
-        Real invMi = invGi;
-        for( Int i=xHeight-1; i>=0; --i )
+    // Perform backward substitution since estimated growth is large
+    for( Int i=n-1; i>=0; --i )
+    {
+        // Perform division and check for overflow
+        const Field Uii = shiftedDiag(i);
+        const Real absUii = SafeAbs( Uii );
+        Field Xij = x[i];
+        Real absXij = SafeAbs( Xij );
+        if( absUii > smallNum )
         {
-            const Real absUii = SafeAbs( U(i,i) );
-            if( invGi<=smallNum || invMi<=smallNum || absUii<=smallNum )
-            {
-                invGi = 0;
-                break;
-            }
-            invMi = Min( invMi, absUii*invGi );
-            if( i > 0 )
+            if( absUii<=1 && absXij>=absUii*bigNum )
             {
-                invGi *= absUii/(absUii+cNorm(i));
+                // Set overflowing entry to 0.5/U[i,i]
+                const Real s = oneHalf/absXij;
+                Xij *= s;
+                scaleX( s );
+                xMax *= s;
+                scale *= s;
             }
+            Xij /= Uii;
         }
-        invGi = Min( invGi, invMi );
-
-        if( invGi > smallNum )
+        else if( absUii > 0 )
         {
-            // Call TRSV since estimated growth is not too large
-            blas::Trsv( 'U', 'N', 'N', xHeight, &U(0,0), U.LDim(), &xj(0), 1 );
+            if( absXij >= absUii*bigNum )
+            {
+                // Set overflowing entry to bigNum/2
+                const Real s = oneHalf*absUii*bigNum/absXij;
+                Xij *= s;
+                scaleX( s );
+                xMax *= s;
+                scale *= s;
+            }
+            Xij /= Uii;
         }
         else
         {
-            // Perform backward substitution since estimated growth is large
-            for( Int i=xHeight-1; i>=0; --i )
+            // TODO(poulson): maybe this tolerance should be loosened to
+            //   | Xij | >= || A || * eps
+            if( absXij >= smallNum )
             {
-                // Perform division and check for overflow
-                const Field Uii = U(i,i);
-                const Real absUii = SafeAbs( Uii );
-                Field Xij = xj(i);
-                Real absXij = SafeAbs( Xij );
-                if( absUii > smallNum )
-                {
-                    if( absUii<=1 && absXij>=absUii*bigNum )
-                    {
-                        // Set overflowing entry to 0.5/U[i,i]
-                        const Real s = oneHalf/absXij;
-                        Xij *= s;
-                        xj *= s;
-                        xjMax *= s;
-                        scales_j *= s;
-                    }
-                    Xij /= Uii;
-                }
-                else if( absUii > 0 )
-                {
-                    if( absXij >= absUii*bigNum )
-                    {
-                        // Set overflowing entry to bigNum/2
-                        const Real s = oneHalf*absUii*bigNum/absXij;
-                        Xij *= s;
-                        xj *= s;
-                        xjMax *= s;
-                        scales_j *= s;
-                    }
-                    Xij /= Uii;
-                }
-                else
-                {
-                    // TODO(poulson): maybe this tolerance should be loosened to
-                    //   | Xij | >= || A || * eps
-                    if( absXij >= smallNum )
-                    {
-                        Xij = Field(1);
-                        Zero( xj );
-                        xjMax = Real(0);
-                        scales_j = Real(0);
-                    }
-                }
-                xj(i) = Xij;
-
-                if( i > 0 )
-                {
+                Xij = Field(1);
+                scaleX( Real(0) );
+                xMax = Real(0);
+                scale = Real(0);
+            }
+        }
+        x[i] = Xij;
 
-                    // Check for possible overflows in AXPY
-                    // Note: G(i+1) <= G(i) + | Xij | * cNorm(i)
-                    absXij = SafeAbs( Xij );
-                    const Real cNorm_i = cNorm(i);
-                    if( absXij >= Real(1) &&
-                        cNorm_i >= (bigNum-xjMax)/absXij )
-                    {
-                        const Real s = oneQuarter/absXij;
-                        Xij *= s;
-                        xj *= s;
-                        xjMax *= s;
-                        absXij *= s;
-                        scales_j *= s;
-                    }
-                    else if( absXij < Real(1) &&
-                             absXij*cNorm_i >= bigNum-xjMax )
-                    {
-                        const Real s = oneQuarter;
-                        Xij *= s;
-                        xj *= s;
-                        xjMax *= s;
-                        absXij *= s;
-                        scales_j *= s;
-                    }
-                    xjMax += absXij*cNorm_i;
-
-                    // AXPY X(0:i,j) -= Xij*U(0:i,i)
-                    blas::Axpy( i, -Xij, &U(0,i), 1, &xj(0), 1 );
-                }
+        if( i > 0 )
+        {
+            // Check for possible overflows in AXPY
+            // Note: G(i+1) <= G(i) + | Xij | * cNorm(i)
+            absXij = SafeAbs( Xij );
+            const Real cNorm_i = cNorm[i];
+            if( absXij >= Real(1) &&
+                cNorm_i >= (bigNum-xMax)/absXij )
+            {
+                const Real s = oneQuarter/absXij;
+                Xij *= s;
+                scaleX( s );
+                xMax *= s;
+                absXij *= s;
+                scale *= s;
             }
+            else if( absXij < Real(1) &&
+                     absXij*cNorm_i >= bigNum-xMax )
+            {
+                const Real s = oneQuarter;
+                Xij *= s;
+                scaleX( s );
+                xMax *= s;
+                absXij *= s;
+                scale *= s;
+            }
+            xMax += absXij*cNorm_i;
+
+            // AXPY X(0:i,j) -= Xij*U(0:i,i)
+            blas::Axpy( i, -Xij, &U[i*ULDim], 1, x, 1 );
         }
-        scales(j) = scales_j;
     }
+    return scale;
+}
+
+// Compute infinity norms of columns of U (excluding diagonal)
+template<typename Field>
+void StrictColumnMaxNorms( const Matrix<Field>& U, Matrix<Base<Field>>& cNorm )
+{
+    EL_DEBUG_CSE
+    const Int n = U.Height();
+    Zeros( cNorm, n, 1 );
+    for( Int j=1; j<n; ++j )
+        for( Int i=0; i<j; ++i )
+            cNorm(j) = Max( cNorm(j), Abs(U(i,j)) );
+}
+
+template<typename Field>
+void MultiShiftDiagonalBlockSolve
+( const Matrix<Field>& U,
+  const Matrix<Field>& shifts,
+        Matrix<Field>& X,
+        Matrix<Field>& scales )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    EL_DEBUG_ONLY(
+      if( U.Height() != U.Width() )
+          LogicError("Triangular matrix must be square");
+      if( U.Width() != X.Height() )
+          LogicError("Matrix dimensions do not match");
+      if( shifts.Height() != X.Width() )
+          LogicError("Incompatible number of shifts");
+    )
+    const Int n = U.Height();
+    const Int numShifts = shifts.Height();
+
+    // Default scale is 1
+    Ones( scales, numShifts, 1 );
+
+    Matrix<Real> cNorm;
+    StrictColumnMaxNorms( U, cNorm );
 
-    // Reset matrix diagonal
-    SetDiagonal( U, diag );
+    // Iterate through RHS's (skipping the first shift)
+    const Field* UBuf = U.LockedBuffer();
+    const Real* cNormBuf = cNorm.LockedBuffer();
+    const Field* shiftBuf = shifts.LockedBuffer();
+    Field* XBuf = X.Buffer();
+    Field* scaleBuf = scales.Buffer();
+    const Int ULDim = U.LDim();
+    const Int XLDim = X.LDim();
+    EL_PARALLEL_FOR_IF(ParallelizeLoop(n*numShifts))
+    for( Int j=1; j<numShifts; ++j )
+        scaleBuf[j] =
+          ShiftedSolveKernel
+          ( Min(n,j), UBuf, ULDim, cNormBuf, shiftBuf[j], &XBuf[j*XLDim] );
 }
 
 template<typename Field>
 void MultiShiftDiagonalBlockSolve
-(       DistMatrix<Field,STAR,STAR>& U,
+( const DistMatrix<Field,STAR,STAR>& U,
   const DistMatrix<Field,VR,STAR>& shifts,
         DistMatrix<Field,STAR,VR>& X,
         DistMatrix<Field,VR,STAR>& scales )
@@ -236,198 +264,42 @@ void MultiShiftDiagonalBlockSolve
           LogicError("Incompatible number of shifts");
       AssertSameGrids( U, shifts, X, scales );
     )
-
-          Matrix<Field>& ULoc = U.Matrix();
-    const Matrix<Field>& shiftsLoc = shifts.LockedMatrix();
-          Matrix<Field>& XLoc = X.Matrix();
-          Matrix<Field>& scalesLoc = scales.Matrix();
-
-    auto diag = GetDiagonal(ULoc);
     const Int n = U.Height();
 
-    const Real underflow = limits::SafeMin<Real>();
-    const Real overflow = limits::Max<Real>();
-    const Real ulp = limits::Precision<Real>();
-    const Real smallNum = Max( underflow/ulp, Real(1)/(overflow*ulp) );
-    const Real bigNum = Real(1)/smallNum;
-
-    const Real oneHalf = Real(1)/Real(2);
-    const Real oneQuarter = Real(1)/Real(4);
-
     // Default scale is 1
     const Int numShifts = shifts.Height();
     Ones( scales, numShifts, 1 );
 
-    // Compute infinity norms of columns of U (excluding diagonal)
-    Matrix<Real> cNorm( n, 1 );
-    cNorm(0) = 0;
-    for( Int j=1; j<n; ++j )
-    {
-        //cNormBuf[j] = MaxNorm( ULoc(IR(0,j),IR(j)) );
-        cNorm(j) = 0;
-        for( Int i=0; i<j; ++i )
-            cNorm(j) = Max( cNorm(j), Abs(ULoc(i,j)) );
-    }
+    Matrix<Real> cNorm;
+    StrictColumnMaxNorms( U.LockedMatrix(), cNorm );
 
     // Iterate through RHS's (skipping the first shift)
     const Int numLocalShifts = shifts.LocalHeight();
+    const Field* UBuf = U.LockedBuffer();
+    const Real* cNormBuf = cNorm.LockedBuffer();
+    const Field* shiftBuf = shifts.LockedBuffer();
+    Field* XBuf = X.Buffer();
+    Field* scaleBuf = scales.Buffer();
+    const Int ULDim = U.LDim();
+    const Int XLDim = X.LDim();
+    const Int shiftShift = shifts.ColShift();
+    const Int shiftStride = shifts.ColStride();
+    EL_PARALLEL_FOR_IF(ParallelizeLoop(n*numLocalShifts))
     for( Int jLoc=0; jLoc<numLocalShifts; ++jLoc )
     {
-        const Int j = shifts.GlobalRow(jLoc);
+        const Int j = shiftShift + jLoc*shiftStride;
         if( j == 0 )
             continue;
-        const Int xHeight = Min(n,j);
-
-        // Initialize triangular system
-        // TODO(poulson): Only modify the first xHeight entries of the diagonal
-        SetDiagonal( ULoc, diag );
-        const Field shift = shiftsLoc(jLoc);
-        const Real smallDiag = Max( ulp*OneAbs(shift), smallNum );
-        for( Int k=0; k<xHeight; ++k )
-        {
-            ULoc(k,k) -= shift;
-            // TODO(poulson): Perhaps preserve phase in complex plane
-            if( OneAbs(ULoc(k,k)) < smallDiag )
-                ULoc(k,k) = smallDiag;
-        }
-        auto xj = XLoc( IR(0,xHeight), IR(jLoc) );
-        Real scales_j = Real(1);
-
-        // Determine largest entry of RHS
-        Real xjMax = MaxNorm( xj );
-        if( xjMax >= bigNum )
-        {
-            const Real s = oneHalf*bigNum/xjMax;
-            xj *= s;
-            xjMax *= s;
-            scales_j *= s;
-        }
-        if( xjMax <= smallNum )
-        {
-            continue;
-        }
-
-        // Estimate growth of entries in triangular solve
-        //   Note: See "Robust Triangular Solves for Use in Condition
-        //   Estimation" by Edward Anderson for explanation of bounds.
-        Real invGi = 1/xjMax;
-        Real invMi = invGi;
-        for( Int i=xHeight-1; i>=0; --i )
-        {
-            const Real absUii = SafeAbs( ULoc(i,i) );
-            if( invGi<=smallNum || invMi<=smallNum || absUii<=smallNum )
-            {
-                invGi = 0;
-                break;
-            }
-            invMi = Min( invMi, absUii*invGi );
-            if( i > 0 )
-            {
-                invGi *= absUii/(absUii+cNorm(i));
-            }
-        }
-        invGi = Min( invGi, invMi );
-
-        if( invGi > smallNum )
-        {
-            // Call TRSV since estimated growth is not too large
-            blas::Trsv
-            ( 'U', 'N', 'N', xHeight, &ULoc(0,0), U.LDim(), &xj(0), 1 );
-        }
-        else
-        {
-            // Perform backward substitution since estimated growth is large
-            for( Int i=xHeight-1; i>=0; --i )
-            {
-                // Perform division and check for overflow
-                const Field Uii = ULoc(i,i);
-                const Real absUii = SafeAbs( Uii );
-                Field Xij = xj(i);
-                Real absXij = SafeAbs( Xij );
-                if( absUii > smallNum )
-                {
-                    if( absUii<=1 && absXij>=absUii*bigNum )
-                    {
-                        // Set overflowing entry to 0.5/U[i,i]
-                        const Real s = oneHalf/absXij;
-                        Xij *= s;
-                        xj *= s;
-                        xjMax *= s;
-                        scales_j *= s;
-                    }
-                    Xij /= Uii;
-                }
-                else if( absUii > 0 )
-                {
-                    if( absXij >= absUii*bigNum )
-                    {
-                        // Set overflowing entry to bigNum/2
-                        const Real s = oneHalf*absUii*bigNum/absXij;
-                        Xij *= s;
-                        xj *= s;
-                        xjMax *= s;
-                        scales_j *= s;
-                    }
-                    Xij /= Uii;
-                }
-                else
-                {
-                    // TODO(poulson): maybe this tolerance should be loosened to
-                    //   | Xij | >= || A || * eps
-                    if( absXij >= smallNum )
-                    {
-                        Xij = Field(1);
-                        Zero( xj );
-                        xjMax = Real(0);
-                        scales_j = Real(0);
-                    }
-                }
-                xj(i) = Xij;
-
-                if( i > 0 )
-                {
-
-                    // Check for possible overflows in AXPY
-                    // Note: G(i+1) <= G(i) + | Xij | * cNorm(i)
-                    absXij = SafeAbs( Xij );
-                    const Real cNorm_i = cNorm(i);
-                    if( absXij >= Real(1) &&
-                        cNorm_i >= (bigNum-xjMax)/absXij )
-                    {
-                        const Real s = oneQuarter/absXij;
-                        Xij *= s;
-                        xj *= s;
-                        xjMax *= s;
-                        absXij *= s;
-                        scales_j *= s;
-                    }
-                    else if( absXij < Real(1) &&
-                             absXij*cNorm_i >= bigNum-xjMax )
-                    {
-                        const Real s = oneQuarter;
-                        Xij *= s;
-                        xj *= s;
-                        xjMax *= s;
-                        absXij *= s;
-                        scales_j *= s;
-                    }
-                    xjMax += absXij*cNorm_i;
-
-                    // AXPY X(0:i,j) -= Xij*U(0:i,i)
-                    blas::Axpy( i, -Xij, &ULoc(0,i), 1, &xj(0), 1 );
-                }
-            }
-        }
-        scalesLoc(jLoc) = scales_j;
+        scaleBuf[jLoc] =
+          ShiftedSolveKernel
+          ( Min(n,j), UBuf, ULDim, cNormBuf, shiftBuf[jLoc],
+            &XBuf[jLoc*XLDim] );
     }
-
-    // Reset matrix diagonal
-    SetDiagonal( ULoc, diag );
 }
 
 template<typename Field>
 void MultiShiftSolve
-(       Matrix<Field>& U,
+( const Matrix<Field>& U,
   const Matrix<Field>& shifts,
         Matrix<Field>& X,
         Matrix<Field>& scales )
@@ -610,12 +482,47 @@ void MultiShiftSolve
     DistMatrix<Field,VR,  STAR> scalesUpdate_VR_STAR(g);
     DistMatrix<Field,MR,  STAR> scalesUpdate_MR_STAR(g);
 
-    Ones( scales, n, 1 );
-    scalesUpdate_VR_STAR.Resize( n, 1 );
+    const Real oneHalf = Real(1)/Real(2);
+
+    const Real underflow = limits::SafeMin<Real>();
+    const Real overflow = limits::Max<Real>();
+    const Real ulp = limits::Precision<Real>();
+    const Real smallNum = Max( underflow/ulp, Real(1)/(overflow*ulp) );
+    const Real bigNum = Real(1)/smallNum;
+
+    // The scale of, and a bound on the largest entry of, each local column
+    // of X is redundantly tracked by its process column so that the Gemm
+    // updates can be protected without any further communication
+    const Int localHeight = X.LocalHeight();
+    const Int localWidth = X.LocalWidth();
+    DistMatrix<Field,MR,STAR> scales_MR_STAR(g);
+    scales_MR_STAR.AlignWith( X );
+    Ones( scales_MR_STAR, n, 1 );
+    auto& scalesLoc = scales_MR_STAR.Matrix();
 
-    // TODO(poulson): Intitialize XMax with the largest entry of each RHS
-    // TODO(poulson): Rescale X if any of the columns are too large
+    // Determine largest entry of each RHS
+    vector<Real> XMax( localWidth, Real(0) );
+    for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+    {
+        const Int j = X.GlobalCol(jLoc);
+        for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+            if( X.GlobalRow(iLoc) < j )
+                XMax[jLoc] = Max( XMax[jLoc], Abs(X.GetLocal(iLoc,jLoc)) );
+    }
+    mpi::AllReduce( XMax.data(), localWidth, mpi::MAX, g.ColComm() );
+    for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+    {
+        if( XMax[jLoc] >= bigNum )
+        {
+            const Real s = oneHalf*bigNum/XMax[jLoc];
+            blas::Scal( localHeight, s, X.Buffer(0,jLoc), 1 );
+            XMax[jLoc] *= s;
+            scalesLoc(jLoc) *= s;
+        }
+        XMax[jLoc] = Max( XMax[jLoc], 2*smallNum );
+    }
 
+    vector<Real> U01Max;
     for( Int k=kLast; k>=0; k-=bsize )
     {
         const Int nb = Min(bsize,m-k);
@@ -645,13 +552,14 @@ void MultiShiftSolve
 
         X1_STAR_MR.AlignWith( X0 );
         X1_STAR_MR = X1_STAR_VR; // X1[* ,MR]  <- X1[* ,VR]
-        X1 = X1_STAR_MR; // X1[MC,MR] <- X1[* ,MR]
 
         // Apply scalings on RHS
+        // (the local columns of X1 are the trailing local columns of X)
         scalesUpdate_MR_STAR.AlignWith( X1 );
         scalesUpdate_MR_STAR = scalesUpdate_VR_STAR;
-        auto& scalesUpdateLoc = scalesUpdate_MR_STAR.Matrix();
+        const auto& scalesUpdateLoc = scalesUpdate_MR_STAR.LockedMatrix();
         const Int X1LocalWidth = X1.LocalWidth();
+        const Int jLocOff = localWidth - X1LocalWidth;
         for( Int jActiveLoc=0; jActiveLoc<X1LocalWidth; ++jActiveLoc )
         {
             const Real sigma = RealPart(scalesUpdateLoc(jActiveLoc));
@@ -662,33 +570,67 @@ void MultiShiftSolve
                 ( X0.LocalHeight(), sigma, X0.Buffer(0,jActiveLoc), 1 );
                 blas::Scal
                 ( X2.LocalHeight(), sigma, X2.Buffer(0,jActiveLoc), 1 );
-
-                // TODO(poulson): Update XMax
-            }
-            else
-            {
-                // Force the value to one so the diagonal scale does not
-                // have an effect. This is somewhat of a hack.
-                scalesUpdateLoc(jActiveLoc) = Field(1);
+                scalesLoc(jLocOff+jActiveLoc) *= sigma;
+                XMax[jLocOff+jActiveLoc] *= sigma;
             }
         }
-        auto scalesActive = scales(IR(k,END),ALL);
-        DiagonalScale( LEFT,  NORMAL, scalesUpdate_MR_STAR, scalesActive );
 
         if( k > 0 )
         {
-            // TODO(poulson): Compute infinity norms of columns in U01
-            // TODO(poulson): Check for possible overflows in GEMM
+            U01_MC_STAR.AlignWith( X0 );
+            U01_MC_STAR = U01; // U01[MC,* ] <- U01[MC,MR]
+
+            // Compute infinity norms of columns in U01
+            // Note: nb*cNorm is the sum of infinity norms
+            const auto& U01Loc = U01_MC_STAR.LockedMatrix();
+            U01Max.assign( nb, Real(0) );
+            for( Int t=0; t<nb; ++t )
+                for( Int iLoc=0; iLoc<U01Loc.Height(); ++iLoc )
+                    U01Max[t] = Max( U01Max[t], Abs(U01Loc(iLoc,t)) );
+            mpi::AllReduce( U01Max.data(), nb, mpi::MAX, g.ColComm() );
+            Real cNorm = 0;
+            for( Int t=0; t<nb; ++t )
+                cNorm += U01Max[t] / nb;
+
+            // Check for possible overflows in GEMM
+            // Note: G(i+1) <= G(i) + nb*cNorm*|| X1[:,j] ||_infty
+            auto& X1Loc = X1_STAR_MR.Matrix();
+            for( Int jActiveLoc=0; jActiveLoc<X1LocalWidth; ++jActiveLoc )
+            {
+                const Int jLoc = jLocOff + jActiveLoc;
+                auto x1j = X1Loc( ALL, IR(jActiveLoc) );
+                Real xjMax = XMax[jLoc];
+                Real X1Max = MaxNorm( x1j );
+                Real s = Real(1);
+                if( X1Max >= 1 &&
+                    cNorm >= (bigNum-xjMax)/X1Max/nb )
+                    s = oneHalf/(X1Max*nb);
+                else if( X1Max < 1 &&
+                         cNorm*X1Max >= (bigNum-xjMax)/nb )
+                    s = oneHalf/nb;
+                if( s < Real(1) )
+                {
+                    // The stale entries of X1 within X are overwritten below
+                    blas::Scal( localHeight, s, X.Buffer(0,jLoc), 1 );
+                    x1j *= s;
+                    scalesLoc(jLoc) *= s;
+                    xjMax *= s;
+                    X1Max *= s;
+                }
+                XMax[jLoc] = xjMax + nb*cNorm*X1Max;
+            }
+            X1 = X1_STAR_MR; // X1[MC,MR] <- X1[* ,MR]
 
             // Update RHS with GEMM
             // X0[MC,MR] -= U01[MC,* ] X1[* ,MR]
-            U01_MC_STAR.AlignWith( X0 );
-            U01_MC_STAR = U01; // U01[MC,* ] <- U01[MC,MR]
             LocalGemm
             ( NORMAL, NORMAL,
               Field(-1), U01_MC_STAR, X1_STAR_MR, Field(1), X0 );
         }
+        else
+            X1 = X1_STAR_MR; // X1[MC,MR] <- X1[* ,MR]
     }
+    scales = scales_MR_STAR;
 }
 
 } // namespace triang_eig
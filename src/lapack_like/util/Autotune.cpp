@@ -0,0 +1,149 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+namespace El {
+
+namespace {
+
+// Returns the fastest of the candidate blocksizes for the given routine,
+// where 'setup' regenerates the operands before each trial
+Int FastestBlocksize
+( const Grid& grid, const AutotuneCtrl& ctrl, const string& name,
+  function<void()> setup, function<void()> routine )
+{
+    EL_DEBUG_CSE
+    Timer timer;
+    Int bestBlocksize = ctrl.candidates[0];
+    double bestTime = limits::Infinity<double>();
+    for( const Int blocksize : ctrl.candidates )
+    {
+        PushBlocksizeStack( blocksize );
+        double minTime = limits::Infinity<double>();
+        for( Int trial=0; trial<ctrl.numTrials; ++trial )
+        {
+            setup();
+            mpi::Barrier( grid.Comm() );
+            timer.Start();
+            routine();
+            mpi::Barrier( grid.Comm() );
+            minTime = Min( minTime, timer.Stop() );
+        }
+        PopBlocksizeStack();
+        // Ensure that every process makes the same choice
+        minTime = mpi::AllReduce( minTime, mpi::MAX, grid.Comm() );
+        if( ctrl.progress )
+            OutputFromRoot
+            (grid.Comm(),name," with blocksize ",blocksize,": ",minTime,
+             " [s]");
+        if( minTime < bestTime )
+        {
+            bestTime = minTime;
+            bestBlocksize = blocksize;
+        }
+    }
+    return bestBlocksize;
+}
+
+} // anonymous namespace
+
+template<typename Field>
+void AutotuneBlocksizes( const Grid& grid, const AutotuneCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    if( ctrl.candidates.empty() )
+        LogicError("No candidate blocksizes were given");
+    if( ctrl.numTrials < 1 )
+        LogicError("At least one trial is required");
+    for( const Int blocksize : ctrl.candidates )
+        if( blocksize < 1 )
+            LogicError("Candidate blocksizes must be positive");
+
+    const Int n = ctrl.size;
+    const int gridHeight = grid.Height();
+    const int gridWidth = grid.Width();
+    DistMatrix<Field> A(grid), B(grid), C(grid), householderScalars(grid);
+    DistMatrix<Base<Field>> signature(grid);
+    DistPermutation P(grid);
+    auto record = [&]( BlocksizeFamily family, Int blocksize )
+    {
+        SetBlocksize<Field>( family, blocksize, gridHeight, gridWidth );
+        if( ctrl.progress )
+            OutputFromRoot
+            (grid.Comm(),"Tuned ",BlocksizeFamilyName(family)," blocksize: ",
+             blocksize);
+    };
+
+    Uniform( A, n, n );
+    Uniform( B, n, n );
+    record
+    ( BLOCKSIZE_GEMM,
+      FastestBlocksize
+      ( grid, ctrl, "Gemm",
+        [&]() { Zeros( C, n, n ); },
+        [&]()
+        { Gemm
+          ( NORMAL, NORMAL, Field(1), A, B, Field(0), C, GEMM_SUMMA_C ); } ) );
+
+    record
+    ( BLOCKSIZE_TRSM,
+      FastestBlocksize
+      ( grid, ctrl, "Trsm",
+        [&]()
+        {
+            Uniform( A, n, n );
+            ShiftDiagonal( A, Field(n) );
+            Uniform( B, n, n );
+        },
+        [&]() { Trsm( LEFT, LOWER, NORMAL, NON_UNIT, Field(1), A, B ); } ) );
+
+    record
+    ( BLOCKSIZE_HERK,
+      FastestBlocksize
+      ( grid, ctrl, "Herk",
+        [&]() { Uniform( A, n, n ); Zeros( C, n, n ); },
+        [&]() { Herk( LOWER, NORMAL, Base<Field>(1), A, C ); } ) );
+
+    record
+    ( BLOCKSIZE_CHOLESKY,
+      FastestBlocksize
+      ( grid, ctrl, "Cholesky",
+        [&]() { HermitianUniformSpectrum( A, n, 1, 10 ); },
+        [&]() { Cholesky( LOWER, A ); } ) );
+
+    record
+    ( BLOCKSIZE_LU,
+      FastestBlocksize
+      ( grid, ctrl, "LU",
+        [&]() { Uniform( A, n, n ); },
+        [&]() { LU( A, P ); } ) );
+
+    record
+    ( BLOCKSIZE_QR,
+      FastestBlocksize
+      ( grid, ctrl, "QR",
+        [&]() { Uniform( A, n, n ); },
+        [&]() { QR( A, householderScalars, signature ); } ) );
+
+    record
+    ( BLOCKSIZE_HERMITIAN_TRIDIAG,
+      FastestBlocksize
+      ( grid, ctrl, "HermitianTridiag",
+        [&]() { HermitianUniformSpectrum( A, n, -10, 10 ); },
+        [&]() { HermitianTridiag( LOWER, A, householderScalars ); } ) );
+}
+
+#define PROTO(Field) \
+  template void AutotuneBlocksizes<Field> \
+  ( const Grid& grid, const AutotuneCtrl& ctrl );
+
+#define EL_NO_INT_PROTO
+#include <El/macros/Instantiate.h>
+
+} // namespace El
@@ -26,6 +26,8 @@ Int Bisect
   const BisectCtrl& ctrl )
 {
     EL_DEBUG_CSE
+    if( ctrl.multilevel )
+        return MultilevelBisect( graph, leftChild, rightChild, perm, ctrl );
 #ifdef EL_HAVE_METIS
     // METIS assumes that there are no self-connections or connections 
     // outside the sources, so we must manually remove them from our graph
@@ -90,8 +92,7 @@ Int Bisect
     ( graph, perm, sizes[0], leftChild, sizes[1], rightChild );
     return sizes[2];
 #else
-    LogicError("METIS interface was not available");
-    return -1;
+    return MultilevelBisect( graph, leftChild, rightChild, perm, ctrl );
 #endif
 }
 
@@ -104,6 +105,14 @@ Int Bisect
   const BisectCtrl& ctrl )
 {
     EL_DEBUG_CSE
+#ifdef EL_HAVE_PARMETIS
+    const bool haveParMETIS = true;
+#else
+    const bool haveParMETIS = false;
+#endif
+    if( ctrl.multilevel || (!ctrl.sequential && !haveParMETIS) )
+        return MultilevelBisect
+        ( graph, childGrid, child, perm, onLeft, ctrl );
 #ifdef EL_HAVE_METIS
     const Grid& grid = graph.Grid();
     const int commSize = grid.Size();
@@ -320,11 +329,11 @@ Int Bisect
     }
     EL_DEBUG_ONLY(EnsurePermutation( perm ))
     BuildChildFromPerm
-    ( graph, perm, sizes[0], sizes[1], onLeft, childGrid, child );
+    ( graph, perm, sizes[0], sizes[1], onLeft, childGrid, child,
+      ctrl.proportionalMapping );
     return sizes[2];
 #else
-    LogicError("METIS was not available");
-    return -1;
+    return MultilevelBisect( graph, childGrid, child, perm, onLeft, ctrl );
 #endif
 }
 
@@ -438,6 +447,43 @@ void BuildChildrenFromPerm
     rightChild.ProcessQueues();
 }
 
+// Since the separators of a d-dimensional mesh with n vertices have
+// O(n^((d-1)/d)) vertices, and the dense factorization of the root front
+// dominates the O(n^(3(d-1)/d)) work of factoring the subtree, the
+// exponent is estimated from the separator of the parent
+inline double SubtreeCost( Int childSize, Int numSources, Int sepSize )
+{
+    if( childSize <= 1 )
+        return childSize;
+    double exponent = 1;
+    if( sepSize > 1 && numSources > 1 )
+        exponent =
+          Max( 1., Min( 3*Log(double(sepSize))/Log(double(numSources)), 3. ) );
+    return Pow( double(childSize), exponent );
+}
+
+int LeftTeamSize
+( int teamSize, Int leftChildSize, Int rightChildSize, Int sepSize,
+  bool proportionalMapping )
+{
+    EL_DEBUG_CSE
+    if( teamSize < 2 )
+        LogicError("Cannot split a team of ",teamSize," processes");
+    const bool smallOnLeft = ( leftChildSize <= rightChildSize );
+    const int smallTeamSize = teamSize/2;
+    if( !proportionalMapping )
+        return smallOnLeft ? smallTeamSize : teamSize-smallTeamSize;
+
+    const Int numSources = leftChildSize + rightChildSize + sepSize;
+    const double leftCost = SubtreeCost( leftChildSize, numSources, sepSize );
+    const double rightCost = SubtreeCost( rightChildSize, numSources, sepSize );
+    if( leftCost + rightCost == 0. )
+        return smallOnLeft ? smallTeamSize : teamSize-smallTeamSize;
+    const int leftTeamSize =
+      int(Round(teamSize*(leftCost/(leftCost+rightCost))));
+    return Max( 1, Min( leftTeamSize, teamSize-1 ) );
+}
+
 void BuildChildFromPerm
 ( const DistGraph& graph,
   const DistMap& perm,
@@ -445,30 +491,31 @@ void BuildChildFromPerm
         Int rightChildSize,
         bool& onLeft,
         unique_ptr<Grid>& childGrid,
-        DistGraph& child )
+        DistGraph& child,
+        bool proportionalMapping )
 {
     EL_DEBUG_CSE
     const Int numTargets = graph.NumTargets();
     const Int numLocalSources = graph.NumLocalSources();
-    EL_DEBUG_ONLY(
-      const Int numSources = graph.NumSources();
-      const Int sepSize = numSources - leftChildSize - rightChildSize;
-    )
+    const Int numSources = graph.NumSources();
+    const Int sepSize = numSources - leftChildSize - rightChildSize;
 
     const Grid& grid = graph.Grid();
     const int commRank = grid.Rank();
     const int commSize = grid.Size();
 
-    // Build the child graph from the partitioned parent
-    const int smallTeamSize = commSize/2;
-    const int largeTeamSize = commSize - smallTeamSize;
-    const bool inSmallTeam = ( commRank < smallTeamSize );
-    const bool smallOnLeft = ( leftChildSize <= rightChildSize );
-    const int leftTeamSize = ( smallOnLeft ? smallTeamSize : largeTeamSize );
-    const int rightTeamSize = ( smallOnLeft ? largeTeamSize : smallTeamSize );
-    const int leftTeamOff = ( smallOnLeft ? 0 : smallTeamSize );
-    const int rightTeamOff = ( smallOnLeft ? smallTeamSize : 0 );
-    onLeft = ( inSmallTeam == smallOnLeft );
+    // Build the child graph from the partitioned parent, with the team of
+    // the smaller child occupying the first ranks
+    const int leftTeamSize =
+      LeftTeamSize
+      ( commSize, leftChildSize, rightChildSize, sepSize,
+        proportionalMapping );
+    const int rightTeamSize = commSize - leftTeamSize;
+    const bool leftIsFirst = ( leftChildSize <= rightChildSize );
+    const int leftTeamOff = ( leftIsFirst ? 0 : rightTeamSize );
+    const int rightTeamOff = ( leftIsFirst ? leftTeamSize : 0 );
+    onLeft =
+      ( leftIsFirst ? commRank < leftTeamSize : commRank >= rightTeamSize );
 
     // TODO(poulson): Generalize to 2D distributions?
     Int leftTeamBlocksize = leftChildSize / leftTeamSize;
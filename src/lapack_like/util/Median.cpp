@@ -8,50 +8,219 @@
 */
 #include <El.hpp>
 
+#include <algorithm>
+
 namespace El {
 
+namespace {
+
+// Order the entries by value, breaking ties by index, so that every entry is
+// distinct
+template<typename Real>
+bool KeyLesser( const ValueInt<Real>& a, const ValueInt<Real>& b )
+{
+    return a.value < b.value || (a.value == b.value && a.index < b.index);
+}
+
+template<typename Real>
+bool KeyEqual( const ValueInt<Real>& a, const ValueInt<Real>& b )
+{ return a.value == b.value && a.index == b.index; }
+
+// Below this many remaining candidates, they are gathered onto every process
+const Int selectGatherSize = 4096;
+
+} // anonymous namespace
+
 template<typename Real,
          typename/*=DisableIf<IsComplex<Real>>*/>
-ValueInt<Real> Median( const Matrix<Real>& x )
+ValueInt<Real> Select( const Matrix<Real>& x, Int k )
 {
     EL_DEBUG_CSE
     const Int m = x.Height();
     const Int n = x.Width();
     if( m != 1 && n != 1 )
-        LogicError("Median is meant for a single vector");
+        LogicError("Select is meant for a single vector");
 
-    const Int k = ( n==1 ? m : n );
+    const Int length = ( n==1 ? m : n );
+    if( k < 0 || k >= length )
+        LogicError("Invalid selection index, ",k,", for length ",length);
     const Int stride = ( n==1 ? 1 : x.LDim() );
     const Real* xBuffer = x.LockedBuffer();
 
-    vector<ValueInt<Real>> pairs( k );
-    for( Int i=0; i<k; ++i )
+    vector<ValueInt<Real>> pairs( length );
+    for( Int i=0; i<length; ++i )
     {
         pairs[i].value = xBuffer[i*stride];
         pairs[i].index = i;
     }
-    std::sort( pairs.begin(), pairs.end(), ValueInt<Real>::Lesser );
-
-    return pairs[k/2];
+    std::nth_element
+    ( pairs.begin(), pairs.begin()+k, pairs.end(), KeyLesser<Real> );
+    return pairs[k];
 }
 
 template<typename Real,
          typename/*=DisableIf<IsComplex<Real>>*/>
-ValueInt<Real> Median( const AbstractDistMatrix<Real>& x )
+ValueInt<Real> Select( const AbstractDistMatrix<Real>& x, Int k )
 {
     EL_DEBUG_CSE
+    if( x.Width() != 1 && x.Height() != 1 )
+        LogicError("Select is meant for a single vector");
     if( x.ColDist() == STAR && x.RowDist() == STAR )
-    {
-        return Median( x.LockedMatrix() );
-    }
+        return Select( x.LockedMatrix(), k );
+
+    const Int length = ( x.Width()==1 ? x.Height() : x.Width() );
+    if( k < 0 || k >= length )
+        LogicError("Invalid selection index, ",k,", for length ",length);
+
+    DistMatrix<Real,VC,STAR> x_VC_STAR( x.Grid() );
+    if( x.Width() == 1 )
+        x_VC_STAR = x;
     else
+        Transpose( x, x_VC_STAR );
+    ValueInt<Real> result;
+    if( x_VC_STAR.Participating() )
     {
-        DistMatrix<Real,STAR,STAR> x_STAR_STAR( x );
-        return Median( x_STAR_STAR.LockedMatrix() );
+        mpi::Comm comm = x_VC_STAR.ColComm();
+        const int commSize = mpi::Size( comm );
+        const Int localHeight = x_VC_STAR.LocalHeight();
+        vector<ValueInt<Real>> candidates( localHeight );
+        for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+        {
+            candidates[iLoc].value = x_VC_STAR.GetLocal(iLoc,0);
+            candidates[iLoc].index = x_VC_STAR.GlobalRow(iLoc);
+        }
+
+        vector<int> counts(commSize), offsets;
+        vector<ValueInt<Real>> medians(commSize);
+        vector<Int> localCounts(commSize);
+        while( true )
+        {
+            const Int numLocal = candidates.size();
+            const Int numTotal = mpi::AllReduce( numLocal, comm );
+            if( numTotal <= selectGatherSize )
+            {
+                const int numLocalInt = numLocal;
+                mpi::AllGather( &numLocalInt, 1, counts.data(), 1, comm );
+                Scan( counts, offsets );
+                vector<ValueInt<Real>> gathered( numTotal );
+                mpi::AllGather
+                ( candidates.data(), int(numLocal),
+                  gathered.data(), counts.data(), offsets.data(), comm );
+                std::nth_element
+                ( gathered.begin(), gathered.begin()+k, gathered.end(),
+                  KeyLesser<Real> );
+                result = gathered[k];
+                break;
+            }
+
+            // Pivot on the weighted median of the local medians
+            ValueInt<Real> localMedian;
+            localMedian.value = 0;
+            localMedian.index = -1;
+            if( numLocal > 0 )
+            {
+                std::nth_element
+                ( candidates.begin(), candidates.begin()+numLocal/2,
+                  candidates.end(), KeyLesser<Real> );
+                localMedian = candidates[numLocal/2];
+            }
+            mpi::AllGather( &localMedian, 1, medians.data(), 1, comm );
+            mpi::AllGather( &numLocal, 1, localCounts.data(), 1, comm );
+            vector<ValueInt<Real>> weightedMedians;
+            vector<Int> weights;
+            {
+                vector<int> order;
+                for( int q=0; q<commSize; ++q )
+                    if( localCounts[q] > 0 )
+                        order.push_back( q );
+                std::sort
+                ( order.begin(), order.end(),
+                  [&]( int a, int b )
+                  { return KeyLesser( medians[a], medians[b] ); } );
+                for( const int q : order )
+                {
+                    weightedMedians.push_back( medians[q] );
+                    weights.push_back( localCounts[q] );
+                }
+            }
+            ValueInt<Real> pivot = weightedMedians.back();
+            Int weightSum = 0;
+            for( size_t r=0; r<weights.size(); ++r )
+            {
+                weightSum += weights[r];
+                if( 2*weightSum >= numTotal )
+                {
+                    pivot = weightedMedians[r];
+                    break;
+                }
+            }
+
+            // Partition the candidates about the pivot
+            auto lessEnd =
+              std::partition
+              ( candidates.begin(), candidates.end(),
+                [&]( const ValueInt<Real>& a )
+                { return KeyLesser( a, pivot ); } );
+            Int localSplit[2] =
+              { Int(lessEnd-candidates.begin()),
+                Int(std::count_if
+                    ( lessEnd, candidates.end(),
+                      [&]( const ValueInt<Real>& a )
+                      { return KeyEqual( a, pivot ); } )) };
+            mpi::AllReduce( localSplit, 2, comm );
+            const Int numLess = localSplit[0];
+            const Int numEqual = localSplit[1];
+            if( k < numLess )
+            {
+                candidates.resize( lessEnd-candidates.begin() );
+            }
+            else if( k < numLess+numEqual )
+            {
+                result = pivot;
+                break;
+            }
+            else
+            {
+                candidates.erase
+                ( std::remove_if
+                  ( candidates.begin(), candidates.end(),
+                    [&]( const ValueInt<Real>& a )
+                    { return !KeyLesser( pivot, a ); } ),
+                  candidates.end() );
+                k -= numLess + numEqual;
+            }
+        }
     }
+    return result;
+}
+
+template<typename Real,
+         typename/*=DisableIf<IsComplex<Real>>*/>
+ValueInt<Real> Median( const Matrix<Real>& x )
+{
+    EL_DEBUG_CSE
+    const Int m = x.Height();
+    const Int n = x.Width();
+    if( m != 1 && n != 1 )
+        LogicError("Median is meant for a single vector");
+    const Int k = ( n==1 ? m : n );
+    return Select( x, k/2 );
+}
+
+template<typename Real,
+         typename/*=DisableIf<IsComplex<Real>>*/>
+ValueInt<Real> Median( const AbstractDistMatrix<Real>& x )
+{
+    EL_DEBUG_CSE
+    if( x.Height() != 1 && x.Width() != 1 )
+        LogicError("Median is meant for a single vector");
+    const Int k = ( x.Width()==1 ? x.Height() : x.Width() );
+    return Select( x, k/2 );
 }
 
 #define PROTO(Real) \
+  template ValueInt<Real> Select( const Matrix<Real>& x, Int k ); \
+  template ValueInt<Real> Select( const AbstractDistMatrix<Real>& x, Int k ); \
   template ValueInt<Real> Median( const Matrix<Real>& x ); \
   template ValueInt<Real> Median( const AbstractDistMatrix<Real>& x );
 
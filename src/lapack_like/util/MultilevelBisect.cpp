@@ -0,0 +1,880 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+// A built-in multilevel vertex bisection in the spirit of METIS: the graph is
+// coarsened via heavy-edge matchings, the coarsest graph is bisected by greedy
+// graph growing, the edge bisection is projected back up while being refined
+// by boundary vertex moves, and a vertex separator is finally chosen from the
+// endpoints of the cut edges.
+//
+// In the distributed case, each process only matches its own vertices (so
+// that the coarse graphs are distributed over the same processes with no
+// communication beyond a halo exchange), the coarsest graph is bisected on
+// the root, and the refinement alternates the direction of the moves so that
+// simultaneous moves on different processes cannot increase the cut.
+//
+// See Karypis and Kumar, "A fast and high quality multilevel scheme for
+// partitioning irregular graphs", SIAM J. Sci. Comput., 20(1), 1998.
+
+namespace El {
+namespace bisect {
+
+// Graphs are coarsened until they have at most this many vertices (per
+// process in the distributed case) before being bisected directly
+const Int coarseSize = 100;
+// Coarsening stops once the graph shrinks by less than this factor
+const double minCoarsenRatio = 0.95;
+// The maximum ratio of the weight of a part to half of the total weight
+const double imbalance = 1.1;
+const Int maxRefineSweeps = 8;
+
+// A graph with vertex and edge weights whose vertices [first,first+n) are
+// stored locally. The targets are global indices, whereas the slots index into
+// the local vertices followed by the halo of remote targets.
+struct WeightedGraph
+{
+    Int first=0;
+    vector<Int> offsets, targets, slots, edgeWeights, vertexWeights;
+
+    Int NumVertices() const { return vertexWeights.size(); }
+};
+
+// The remote targets of the local edges and the local vertices which other
+// processes need the values of
+struct Halo
+{
+    vector<Int> inds;
+    vector<Int> requests;
+    vector<int> sendSizes, sendOffs, recvSizes, recvOffs;
+};
+
+inline void SetLocalSlots( WeightedGraph& graph )
+{
+    EL_DEBUG_CSE
+    const Int numEdges = graph.targets.size();
+    graph.slots.resize( numEdges );
+    for( Int e=0; e<numEdges; ++e )
+        graph.slots[e] = graph.targets[e] - graph.first;
+}
+
+inline Int TotalWeight( const WeightedGraph& graph )
+{
+    Int totalWeight = 0;
+    for( const Int weight : graph.vertexWeights )
+        totalWeight += weight;
+    return totalWeight;
+}
+
+// Self-connections and connections to the targets beyond the sources are
+// dropped, and all weights are initially one
+inline void
+FromSources
+( const Int* offsetBuf, const Int* targetBuf,
+  Int numLocalSources, Int firstLocalSource, Int numSources,
+  WeightedGraph& graph )
+{
+    EL_DEBUG_CSE
+    graph.first = firstLocalSource;
+    graph.offsets.resize( numLocalSources+1 );
+    graph.vertexWeights.assign( numLocalSources, 1 );
+    graph.targets.clear();
+    for( Int s=0; s<numLocalSources; ++s )
+    {
+        graph.offsets[s] = graph.targets.size();
+        const Int source = s + firstLocalSource;
+        for( Int e=offsetBuf[s]; e<offsetBuf[s+1]; ++e )
+        {
+            const Int target = targetBuf[e];
+            if( target != source && target < numSources )
+                graph.targets.push_back( target );
+        }
+    }
+    graph.offsets[numLocalSources] = graph.targets.size();
+    graph.edgeWeights.assign( graph.targets.size(), 1 );
+}
+
+inline Int HaloOwner( const vector<Int>& vtxDist, Int ind )
+{
+    return Int(std::upper_bound(vtxDist.begin(),vtxDist.end(),ind) -
+               vtxDist.begin()) - 1;
+}
+
+inline void SetupHalo
+( WeightedGraph& graph, const vector<Int>& vtxDist, Halo& halo,
+  mpi::Comm comm )
+{
+    EL_DEBUG_CSE
+    const int commSize = mpi::Size( comm );
+    const Int n = graph.NumVertices();
+    const Int first = graph.first;
+    const Int numEdges = graph.targets.size();
+
+    halo.inds.clear();
+    for( const Int target : graph.targets )
+        if( target < first || target >= first+n )
+            halo.inds.push_back( target );
+    std::sort( halo.inds.begin(), halo.inds.end() );
+    halo.inds.erase
+    ( std::unique(halo.inds.begin(),halo.inds.end()), halo.inds.end() );
+
+    // The halo indices are sorted, so their owners are contiguous
+    halo.sendSizes.assign( commSize, 0 );
+    for( const Int ind : halo.inds )
+        ++halo.sendSizes[HaloOwner(vtxDist,ind)];
+    Scan( halo.sendSizes, halo.sendOffs );
+    halo.recvSizes.resize( commSize );
+    mpi::AllToAll
+    ( halo.sendSizes.data(), 1, halo.recvSizes.data(), 1, comm );
+    const int numRequests = Scan( halo.recvSizes, halo.recvOffs );
+    halo.requests.resize( numRequests );
+    mpi::AllToAll
+    ( halo.inds.data(), halo.sendSizes.data(), halo.sendOffs.data(),
+      halo.requests.data(), halo.recvSizes.data(), halo.recvOffs.data(),
+      comm );
+    for( Int& request : halo.requests )
+        request -= first;
+
+    graph.slots.resize( numEdges );
+    for( Int e=0; e<numEdges; ++e )
+    {
+        const Int target = graph.targets[e];
+        if( target >= first && target < first+n )
+            graph.slots[e] = target - first;
+        else
+            graph.slots[e] = n +
+              Int(std::lower_bound(halo.inds.begin(),halo.inds.end(),target) -
+                  halo.inds.begin());
+    }
+}
+
+// Extend the local values with those of the halo
+inline void
+ExchangeHalo( const Halo& halo, vector<Int>& values, mpi::Comm comm )
+{
+    EL_DEBUG_CSE
+    const Int n = values.size();
+    const Int numRequests = halo.requests.size();
+    vector<Int> sendBuf( numRequests );
+    for( Int k=0; k<numRequests; ++k )
+        sendBuf[k] = values[halo.requests[k]];
+    values.resize( n+halo.inds.size() );
+    mpi::AllToAll
+    ( sendBuf.data(), halo.recvSizes.data(), halo.recvOffs.data(),
+      values.data()+n, halo.sendSizes.data(), halo.sendOffs.data(), comm );
+}
+
+// Match each vertex with the unmatched (local) neighbor connected by the
+// heaviest edge, visiting the vertices in order of increasing degree
+inline void HeavyEdgeMatching
+( const WeightedGraph& graph,
+  Int maxVertexWeight,
+  vector<Int>& coarseMap,
+  Int& numCoarse )
+{
+    EL_DEBUG_CSE
+    const Int n = graph.NumVertices();
+    const Int* offsets = graph.offsets.data();
+    const Int* slots = graph.slots.data();
+    const Int* edgeWeights = graph.edgeWeights.data();
+    const Int* vertexWeights = graph.vertexWeights.data();
+
+    vector<Int> order( n );
+    for( Int u=0; u<n; ++u )
+        order[u] = u;
+    std::stable_sort
+    ( order.begin(), order.end(),
+      [&]( Int u, Int v )
+      { return offsets[u+1]-offsets[u] < offsets[v+1]-offsets[v]; } );
+
+    vector<Int> match( n, -1 );
+    for( const Int u : order )
+    {
+        if( match[u] != -1 )
+            continue;
+        Int best = u, bestWeight = -1;
+        for( Int e=offsets[u]; e<offsets[u+1]; ++e )
+        {
+            const Int v = slots[e];
+            if( v < n && match[v] == -1 && edgeWeights[e] > bestWeight &&
+                vertexWeights[u]+vertexWeights[v] <= maxVertexWeight )
+            {
+                best = v;
+                bestWeight = edgeWeights[e];
+            }
+        }
+        match[u] = best;
+        match[best] = u;
+    }
+
+    coarseMap.assign( n, -1 );
+    numCoarse = 0;
+    for( Int u=0; u<n; ++u )
+    {
+        if( coarseMap[u] == -1 )
+        {
+            coarseMap[u] = numCoarse;
+            coarseMap[match[u]] = numCoarse;
+            ++numCoarse;
+        }
+    }
+}
+
+// Form the coarse graph given the (global) coarse index of each edge's target
+inline WeightedGraph Contract
+( const WeightedGraph& graph,
+  const vector<Int>& coarseMap,
+  Int numCoarse,
+  Int coarseFirst,
+  const vector<Int>& coarseTargets )
+{
+    EL_DEBUG_CSE
+    const Int n = graph.NumVertices();
+    vector<Int> memberOffs( numCoarse+1, 0 ), members( n );
+    for( Int u=0; u<n; ++u )
+        ++memberOffs[coarseMap[u]+1];
+    for( Int c=0; c<numCoarse; ++c )
+        memberOffs[c+1] += memberOffs[c];
+    {
+        auto offs = memberOffs;
+        for( Int u=0; u<n; ++u )
+            members[offs[coarseMap[u]]++] = u;
+    }
+
+    WeightedGraph coarse;
+    coarse.first = coarseFirst;
+    coarse.vertexWeights.resize( numCoarse );
+    vector<vector<pair<Int,Int>>> adjacencies( numCoarse );
+    EL_PARALLEL_FOR
+    for( Int c=0; c<numCoarse; ++c )
+    {
+        auto& adjacency = adjacencies[c];
+        Int weight = 0;
+        for( Int k=memberOffs[c]; k<memberOffs[c+1]; ++k )
+        {
+            const Int u = members[k];
+            weight += graph.vertexWeights[u];
+            for( Int e=graph.offsets[u]; e<graph.offsets[u+1]; ++e )
+                if( coarseTargets[e] != coarseFirst+c )
+                    adjacency.emplace_back
+                    ( coarseTargets[e], graph.edgeWeights[e] );
+        }
+        coarse.vertexWeights[c] = weight;
+
+        // Combine the parallel edges
+        std::sort( adjacency.begin(), adjacency.end() );
+        Int numUnique = 0;
+        for( const auto& entry : adjacency )
+        {
+            if( numUnique > 0 && adjacency[numUnique-1].first == entry.first )
+                adjacency[numUnique-1].second += entry.second;
+            else
+                adjacency[numUnique++] = entry;
+        }
+        adjacency.resize( numUnique );
+    }
+
+    coarse.offsets.resize( numCoarse+1 );
+    coarse.offsets[0] = 0;
+    for( Int c=0; c<numCoarse; ++c )
+        coarse.offsets[c+1] = coarse.offsets[c] + adjacencies[c].size();
+    const Int numCoarseEdges = coarse.offsets[numCoarse];
+    coarse.targets.resize( numCoarseEdges );
+    coarse.edgeWeights.resize( numCoarseEdges );
+    EL_PARALLEL_FOR
+    for( Int c=0; c<numCoarse; ++c )
+    {
+        const Int off = coarse.offsets[c];
+        const Int numConn = adjacencies[c].size();
+        for( Int k=0; k<numConn; ++k )
+        {
+            coarse.targets[off+k] = adjacencies[c][k].first;
+            coarse.edgeWeights[off+k] = adjacencies[c][k].second;
+        }
+    }
+    return coarse;
+}
+
+// The gain of each local vertex is the weight of its edges to the other part
+// minus the weight of its edges within its own part, and a vertex lies on the
+// boundary if it has any edges to the other part. The parts of the halo
+// should follow those of the local vertices.
+inline void ComputeGains
+( const WeightedGraph& graph,
+  const vector<Int>& parts,
+        vector<Int>& gains,
+        vector<byte>& boundary )
+{
+    EL_DEBUG_CSE
+    const Int n = graph.NumVertices();
+    gains.resize( n );
+    boundary.resize( n );
+    EL_PARALLEL_FOR
+    for( Int u=0; u<n; ++u )
+    {
+        Int external = 0, internal = 0;
+        for( Int e=graph.offsets[u]; e<graph.offsets[u+1]; ++e )
+        {
+            if( parts[graph.slots[e]] == parts[u] )
+                internal += graph.edgeWeights[e];
+            else
+                external += graph.edgeWeights[e];
+        }
+        gains[u] = external - internal;
+        boundary[u] = ( external > 0 );
+    }
+}
+
+inline Int Gain( const WeightedGraph& graph, const vector<Int>& parts, Int u )
+{
+    Int gain = 0;
+    for( Int e=graph.offsets[u]; e<graph.offsets[u+1]; ++e )
+        gain += ( parts[graph.slots[e]] == parts[u] ?
+                  -graph.edgeWeights[e] : graph.edgeWeights[e] );
+    return gain;
+}
+
+inline Int MaxPartWeight( Int totalWeight )
+{ return Max( Int(imbalance*totalWeight/2), (totalWeight+1)/2 ); }
+
+// Greedily move boundary vertices (in order of decreasing gain) which either
+// reduce the cut or restore the balance of a sequential bisection
+inline void RefineBisection( const WeightedGraph& graph, vector<Int>& parts )
+{
+    EL_DEBUG_CSE
+    const Int n = graph.NumVertices();
+    const Int maxPartWeight = MaxPartWeight( TotalWeight(graph) );
+    Int partWeights[2] = { 0, 0 };
+    for( Int u=0; u<n; ++u )
+        partWeights[parts[u]] += graph.vertexWeights[u];
+
+    vector<Int> gains, candidates;
+    vector<byte> boundary;
+    for( Int sweep=0; sweep<maxRefineSweeps; ++sweep )
+    {
+        ComputeGains( graph, parts, gains, boundary );
+        candidates.clear();
+        for( Int u=0; u<n; ++u )
+            if( boundary[u] || partWeights[parts[u]] > maxPartWeight )
+                candidates.push_back( u );
+        std::stable_sort
+        ( candidates.begin(), candidates.end(),
+          [&]( Int u, Int v ) { return gains[u] > gains[v]; } );
+
+        Int numMoves = 0;
+        for( const Int u : candidates )
+        {
+            const Int from = parts[u];
+            const Int to = 1-from;
+            const Int weight = graph.vertexWeights[u];
+            if( partWeights[to]+weight > maxPartWeight )
+                continue;
+            const Int gain = Gain( graph, parts, u );
+            const bool rebalance = ( partWeights[from] > maxPartWeight );
+            const bool balances =
+              ( partWeights[from]-partWeights[to] > weight );
+            if( gain > 0 || (gain == 0 && balances) || rebalance )
+            {
+                parts[u] = to;
+                partWeights[from] -= weight;
+                partWeights[to] += weight;
+                ++numMoves;
+            }
+        }
+        if( numMoves == 0 )
+            break;
+    }
+}
+
+inline Int CutWeight( const WeightedGraph& graph, const vector<Int>& parts )
+{
+    const Int n = graph.NumVertices();
+    Int cut = 0;
+    for( Int u=0; u<n; ++u )
+        for( Int e=graph.offsets[u]; e<graph.offsets[u+1]; ++e )
+            if( parts[graph.slots[e]] != parts[u] )
+                cut += graph.edgeWeights[e];
+    return cut/2;
+}
+
+// Grow the first part in breadth-first order from several seeds until it
+// holds half of the weight and keep the best refined bisection
+inline void GrowBisection
+( const WeightedGraph& graph, vector<Int>& parts, Int numTries )
+{
+    EL_DEBUG_CSE
+    const Int n = graph.NumVertices();
+    const Int halfWeight = TotalWeight(graph) / 2;
+    parts.assign( n, 0 );
+    if( n <= 1 )
+        return;
+
+    Int bestCut = -1;
+    vector<Int> trialParts, queue;
+    vector<byte> visited;
+    for( Int trial=0; trial<numTries; ++trial )
+    {
+        trialParts.assign( n, 1 );
+        visited.assign( n, false );
+        queue.clear();
+        Int weight = 0, head = 0, nextSeed = (trial*n) / numTries;
+        while( weight < halfWeight )
+        {
+            if( head == Int(queue.size()) )
+            {
+                // Start a new breadth-first search from an unvisited vertex
+                while( visited[nextSeed] )
+                    nextSeed = (nextSeed+1) % n;
+                visited[nextSeed] = true;
+                queue.push_back( nextSeed );
+            }
+            const Int u = queue[head++];
+            trialParts[u] = 0;
+            weight += graph.vertexWeights[u];
+            for( Int e=graph.offsets[u]; e<graph.offsets[u+1]; ++e )
+            {
+                const Int v = graph.slots[e];
+                if( !visited[v] )
+                {
+                    visited[v] = true;
+                    queue.push_back( v );
+                }
+            }
+        }
+        RefineBisection( graph, trialParts );
+        const Int cut = CutWeight( graph, trialParts );
+        if( bestCut == -1 || cut < bestCut )
+        {
+            bestCut = cut;
+            parts = trialParts;
+        }
+    }
+}
+
+// Multilevel edge bisection of a sequential graph into parts zero and one
+inline void EdgeBisect
+( const WeightedGraph& graph, vector<Int>& parts, Int numTries )
+{
+    EL_DEBUG_CSE
+    const Int maxVertexWeight =
+      Max( 3*TotalWeight(graph)/(2*coarseSize), Int(1) );
+    vector<unique_ptr<WeightedGraph>> levels;
+    vector<vector<Int>> coarseMaps;
+    const WeightedGraph* current = &graph;
+    while( current->NumVertices() > coarseSize )
+    {
+        const Int n = current->NumVertices();
+        vector<Int> coarseMap;
+        Int numCoarse;
+        HeavyEdgeMatching( *current, maxVertexWeight, coarseMap, numCoarse );
+        if( numCoarse > minCoarsenRatio*n )
+            break;
+
+        const Int numEdges = current->targets.size();
+        vector<Int> coarseTargets( numEdges );
+        for( Int e=0; e<numEdges; ++e )
+            coarseTargets[e] = coarseMap[current->slots[e]];
+        levels.emplace_back
+        ( new WeightedGraph
+          (Contract(*current,coarseMap,numCoarse,0,coarseTargets)) );
+        SetLocalSlots( *levels.back() );
+        coarseMaps.emplace_back( std::move(coarseMap) );
+        current = levels.back().get();
+    }
+
+    GrowBisection( *current, parts, numTries );
+    for( Int level=levels.size()-1; level>=0; --level )
+    {
+        const WeightedGraph& fine = ( level == 0 ? graph : *levels[level-1] );
+        const Int n = fine.NumVertices();
+        vector<Int> fineParts( n );
+        for( Int u=0; u<n; ++u )
+            fineParts[u] = parts[coarseMaps[level][u]];
+        parts.swap( fineParts );
+        RefineBisection( fine, parts );
+    }
+}
+
+// Refine a distributed bisection. Each sweep only moves vertices in a single
+// direction: since simultaneously moved neighbors were assumed to remain in
+// place, the cut is then never larger than each process predicted.
+inline void RefineDistBisection
+( const WeightedGraph& graph, const Halo& halo, vector<Int>& parts,
+  mpi::Comm comm )
+{
+    EL_DEBUG_CSE
+    const Int n = graph.NumVertices();
+    const Int maxPartWeight =
+      MaxPartWeight( mpi::AllReduce( TotalWeight(graph), comm ) );
+    Int partWeights[2] = { 0, 0 };
+    for( Int u=0; u<n; ++u )
+        partWeights[parts[u]] += graph.vertexWeights[u];
+    mpi::AllReduce( partWeights, 2, comm );
+
+    vector<Int> gains, candidates;
+    vector<byte> boundary;
+    Int numIdleSweeps = 0;
+    for( Int sweep=0; sweep<2*maxRefineSweeps && numIdleSweeps<2; ++sweep )
+    {
+        const Int from = sweep % 2;
+        const Int to = 1-from;
+        const bool rebalance = ( partWeights[from] > maxPartWeight );
+        const Int capacity = maxPartWeight - partWeights[to];
+
+        parts.resize( n );
+        ExchangeHalo( halo, parts, comm );
+        ComputeGains( graph, parts, gains, boundary );
+        candidates.clear();
+        Int localCandidateWeight = 0;
+        for( Int u=0; u<n; ++u )
+        {
+            if( parts[u] == from && (gains[u] > 0 || rebalance) &&
+                (boundary[u] || rebalance) )
+            {
+                candidates.push_back( u );
+                localCandidateWeight += graph.vertexWeights[u];
+            }
+        }
+        std::stable_sort
+        ( candidates.begin(), candidates.end(),
+          [&]( Int u, Int v ) { return gains[u] > gains[v]; } );
+
+        // Share the remaining capacity of the destination (and, when
+        // rebalancing, the excess of the source) in proportion to the weight
+        // of the candidates of each process
+        const Int candidateWeight =
+          mpi::AllReduce( localCandidateWeight, comm );
+        const double share =
+          ( candidateWeight > 0 ?
+            double(localCandidateWeight)/candidateWeight : 0. );
+        const double budget = share*capacity;
+        const double excess = share*(partWeights[from]-maxPartWeight);
+
+        Int movedWeight = 0;
+        for( const Int u : candidates )
+        {
+            const Int weight = graph.vertexWeights[u];
+            if( movedWeight+weight > budget )
+                continue;
+            const Int gain = Gain( graph, parts, u );
+            if( gain > 0 || (rebalance && movedWeight < excess) )
+            {
+                parts[u] = to;
+                movedWeight += weight;
+            }
+        }
+        movedWeight = mpi::AllReduce( movedWeight, comm );
+        partWeights[from] -= movedWeight;
+        partWeights[to] += movedWeight;
+        numIdleSweeps = ( movedWeight == 0 ? numIdleSweeps+1 : 0 );
+    }
+    parts.resize( n );
+}
+
+// Form a vertex separator from the endpoints of the cut edges. Each cut edge
+// is covered by its endpoint with more cut edges (or that in part zero in the
+// case of a tie), which only requires the neighbors' parts and cut degrees.
+// Separator vertices whose cut neighbors are all local separator vertices are
+// then returned to their parts. The separator is marked as part two.
+inline void VertexSeparator
+( const WeightedGraph& graph, const Halo* halo, vector<Int>& parts,
+  mpi::Comm comm )
+{
+    EL_DEBUG_CSE
+    const Int n = graph.NumVertices();
+    if( halo != nullptr )
+        ExchangeHalo( *halo, parts, comm );
+    vector<Int> cutDegrees( n );
+    EL_PARALLEL_FOR
+    for( Int u=0; u<n; ++u )
+    {
+        Int cutDegree = 0;
+        for( Int e=graph.offsets[u]; e<graph.offsets[u+1]; ++e )
+            if( parts[graph.slots[e]] != parts[u] )
+                ++cutDegree;
+        cutDegrees[u] = cutDegree;
+    }
+    if( halo != nullptr )
+        ExchangeHalo( *halo, cutDegrees, comm );
+
+    vector<byte> separator( n, false );
+    EL_PARALLEL_FOR
+    for( Int u=0; u<n; ++u )
+    {
+        for( Int e=graph.offsets[u]; e<graph.offsets[u+1]; ++e )
+        {
+            const Int v = graph.slots[e];
+            if( parts[v] != parts[u] &&
+                (cutDegrees[u] > cutDegrees[v] ||
+                 (cutDegrees[u] == cutDegrees[v] && parts[u] == 0)) )
+            {
+                separator[u] = true;
+                break;
+            }
+        }
+    }
+    for( Int u=0; u<n; ++u )
+    {
+        if( !separator[u] )
+            continue;
+        bool covered = true;
+        for( Int e=graph.offsets[u]; e<graph.offsets[u+1]; ++e )
+        {
+            const Int v = graph.slots[e];
+            if( parts[v] != parts[u] && (v >= n || !separator[v]) )
+            {
+                covered = false;
+                break;
+            }
+        }
+        if( covered )
+            separator[u] = false;
+    }
+
+    parts.resize( n );
+    for( Int u=0; u<n; ++u )
+        if( separator[u] )
+            parts[u] = 2;
+}
+
+} // namespace bisect
+
+Int MultilevelBisect
+( const Graph& graph,
+        Graph& leftChild,
+        Graph& rightChild,
+        vector<Int>& perm,
+  const BisectCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    EL_PROFILE_REGION("MultilevelBisect");
+    const Int numSources = graph.NumSources();
+    bisect::WeightedGraph weightedGraph;
+    bisect::FromSources
+    ( graph.LockedOffsetBuffer(), graph.LockedTargetBuffer(),
+      numSources, 0, numSources, weightedGraph );
+    bisect::SetLocalSlots( weightedGraph );
+
+    vector<Int> parts;
+    bisect::EdgeBisect( weightedGraph, parts, Max(ctrl.numSeqSeps,Int(1)) );
+    bisect::VertexSeparator( weightedGraph, nullptr, parts, mpi::COMM_SELF );
+
+    Int sizes[3] = { 0, 0, 0 };
+    for( Int s=0; s<numSources; ++s )
+        ++sizes[parts[s]];
+    Int offsets[3];
+    offsets[0] = 0;
+    offsets[1] = sizes[0];
+    offsets[2] = sizes[1] + offsets[1];
+    perm.resize( numSources );
+    for( Int s=0; s<numSources; ++s )
+        perm[s] = offsets[parts[s]]++;
+
+    EL_DEBUG_ONLY(EnsurePermutation( perm ))
+    BuildChildrenFromPerm
+    ( graph, perm, sizes[0], leftChild, sizes[1], rightChild );
+    return sizes[2];
+}
+
+Int MultilevelBisect
+( const DistGraph& graph,
+        unique_ptr<Grid>& childGrid,
+        DistGraph& child,
+        DistMap& perm,
+        bool& onLeft,
+  const BisectCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    EL_PROFILE_REGION("MultilevelBisect");
+    const Grid& grid = graph.Grid();
+    mpi::Comm comm = grid.Comm();
+    const int commSize = grid.Size();
+    const int commRank = grid.Rank();
+    if( commSize == 1 )
+        LogicError
+        ("This routine assumes at least two processes are used, "
+         "otherwise one child will be lost");
+    const Int numSources = graph.NumSources();
+    const Int numLocalSources = graph.NumLocalSources();
+
+    struct Level
+    {
+        bisect::WeightedGraph graph;
+        bisect::Halo halo;
+        vector<Int> vtxDist;
+        // Maps each local vertex to its local index in the next coarser level
+        vector<Int> coarseMap;
+    };
+    auto formVtxDist = [&]( Int numLocal, vector<Int>& vtxDist )
+      {
+          vector<Int> numLocals( commSize );
+          mpi::AllGather( &numLocal, 1, numLocals.data(), 1, comm );
+          vtxDist.resize( commSize+1 );
+          vtxDist[0] = 0;
+          for( int q=0; q<commSize; ++q )
+              vtxDist[q+1] = vtxDist[q] + numLocals[q];
+      };
+
+    vector<unique_ptr<Level>> levels;
+    levels.emplace_back( new Level );
+    bisect::FromSources
+    ( graph.LockedOffsetBuffer(), graph.LockedTargetBuffer(),
+      numLocalSources, graph.FirstLocalSource(), numSources,
+      levels[0]->graph );
+    formVtxDist( numLocalSources, levels[0]->vtxDist );
+    bisect::SetupHalo
+    ( levels[0]->graph, levels[0]->vtxDist, levels[0]->halo, comm );
+
+    // Coarsen by matching the vertices within each process
+    const Int distCoarseSize = bisect::coarseSize*commSize;
+    const Int maxVertexWeight =
+      Max( 3*numSources/(2*distCoarseSize), Int(1) );
+    while( levels.back()->vtxDist[commSize] > distCoarseSize )
+    {
+        Level& fine = *levels.back();
+        const Int numFine = fine.vtxDist[commSize];
+        Int numCoarse;
+        bisect::HeavyEdgeMatching
+        ( fine.graph, maxVertexWeight, fine.coarseMap, numCoarse );
+
+        unique_ptr<Level> coarse( new Level );
+        formVtxDist( numCoarse, coarse->vtxDist );
+        if( coarse->vtxDist[commSize] > bisect::minCoarsenRatio*numFine )
+        {
+            SwapClear( fine.coarseMap );
+            break;
+        }
+
+        const Int coarseFirst = coarse->vtxDist[commRank];
+        vector<Int> coarseInds( fine.graph.NumVertices() );
+        for( Int u=0; u<fine.graph.NumVertices(); ++u )
+            coarseInds[u] = coarseFirst + fine.coarseMap[u];
+        bisect::ExchangeHalo( fine.halo, coarseInds, comm );
+        const Int numEdges = fine.graph.targets.size();
+        vector<Int> coarseTargets( numEdges );
+        for( Int e=0; e<numEdges; ++e )
+            coarseTargets[e] = coarseInds[fine.graph.slots[e]];
+        coarse->graph =
+          bisect::Contract
+          ( fine.graph, fine.coarseMap, numCoarse, coarseFirst,
+            coarseTargets );
+        bisect::SetupHalo
+        ( coarse->graph, coarse->vtxDist, coarse->halo, comm );
+        levels.emplace_back( std::move(coarse) );
+    }
+
+    // Gather the coarsest graph onto the root and bisect it there
+    const Level& coarsest = *levels.back();
+    const Int numCoarsest = coarsest.vtxDist[commSize];
+    const Int numLocalCoarsest = coarsest.graph.NumVertices();
+    const Int numLocalCoarsestEdges = coarsest.graph.targets.size();
+    vector<int> vertexSizes( commSize ), vertexOffs( commSize ),
+                edgeSizes( commSize ), edgeOffs;
+    for( int q=0; q<commSize; ++q )
+    {
+        vertexSizes[q] = coarsest.vtxDist[q+1] - coarsest.vtxDist[q];
+        vertexOffs[q] = coarsest.vtxDist[q];
+    }
+    const int numLocalCoarsestEdgesInt = numLocalCoarsestEdges;
+    mpi::AllGather
+    ( &numLocalCoarsestEdgesInt, 1, edgeSizes.data(), 1, comm );
+    const int numCoarsestEdges = Scan( edgeSizes, edgeOffs );
+
+    vector<Int> degrees( numLocalCoarsest );
+    for( Int u=0; u<numLocalCoarsest; ++u )
+        degrees[u] = coarsest.graph.offsets[u+1] - coarsest.graph.offsets[u];
+    bisect::WeightedGraph gathered;
+    if( commRank == 0 )
+    {
+        gathered.offsets.resize( numCoarsest+1 );
+        gathered.vertexWeights.resize( numCoarsest );
+        gathered.targets.resize( numCoarsestEdges );
+        gathered.edgeWeights.resize( numCoarsestEdges );
+    }
+    mpi::Gather
+    ( degrees.data(), numLocalCoarsest, gathered.offsets.data(),
+      vertexSizes.data(), vertexOffs.data(), 0, comm );
+    mpi::Gather
+    ( coarsest.graph.vertexWeights.data(), numLocalCoarsest,
+      gathered.vertexWeights.data(),
+      vertexSizes.data(), vertexOffs.data(), 0, comm );
+    mpi::Gather
+    ( coarsest.graph.targets.data(), numLocalCoarsestEdges,
+      gathered.targets.data(), edgeSizes.data(), edgeOffs.data(), 0, comm );
+    mpi::Gather
+    ( coarsest.graph.edgeWeights.data(), numLocalCoarsestEdges,
+      gathered.edgeWeights.data(),
+      edgeSizes.data(), edgeOffs.data(), 0, comm );
+
+    vector<Int> coarsestParts( numCoarsest );
+    if( commRank == 0 )
+    {
+        // Convert the degrees into offsets
+        Int off = 0;
+        for( Int u=0; u<numCoarsest; ++u )
+        {
+            const Int degree = gathered.offsets[u];
+            gathered.offsets[u] = off;
+            off += degree;
+        }
+        gathered.offsets[numCoarsest] = off;
+        bisect::SetLocalSlots( gathered );
+        bisect::EdgeBisect
+        ( gathered, coarsestParts, Max(ctrl.numDistSeps,Int(1)) );
+    }
+    mpi::Broadcast( coarsestParts.data(), numCoarsest, 0, comm );
+
+    // Project the bisection back to the original graph
+    vector<Int> parts
+    ( coarsestParts.begin()+coarsest.vtxDist[commRank],
+      coarsestParts.begin()+coarsest.vtxDist[commRank+1] );
+    for( Int level=levels.size()-2; level>=0; --level )
+    {
+        const Level& fine = *levels[level];
+        const Int n = fine.graph.NumVertices();
+        vector<Int> fineParts( n );
+        for( Int u=0; u<n; ++u )
+            fineParts[u] = parts[fine.coarseMap[u]];
+        parts.swap( fineParts );
+        bisect::RefineDistBisection( fine.graph, fine.halo, parts, comm );
+    }
+    bisect::VertexSeparator( levels[0]->graph, &levels[0]->halo, parts, comm );
+
+    // Number the left part, then the right part, and then the separator
+    Int localSizes[3] = { 0, 0, 0 };
+    for( Int s=0; s<numLocalSources; ++s )
+        ++localSizes[parts[s]];
+    vector<Int> allSizes( 3*commSize );
+    mpi::AllGather( localSizes, 3, allSizes.data(), 3, comm );
+    Int sizes[3] = { 0, 0, 0 }, offsets[3] = { 0, 0, 0 };
+    for( int q=0; q<commSize; ++q )
+    {
+        for( Int j=0; j<3; ++j )
+        {
+            if( q < commRank )
+                offsets[j] += allSizes[3*q+j];
+            sizes[j] += allSizes[3*q+j];
+        }
+    }
+    offsets[1] += sizes[0];
+    offsets[2] += sizes[0] + sizes[1];
+
+    perm.SetGrid( grid );
+    perm.Resize( numSources );
+    for( Int s=0; s<numLocalSources; ++s )
+        perm.SetLocal( s, offsets[parts[s]]++ );
+
+    EL_DEBUG_ONLY(EnsurePermutation( perm ))
+    BuildChildFromPerm
+    ( graph, perm, sizes[0], sizes[1], onLeft, childGrid, child,
+      ctrl.proportionalMapping );
+    return sizes[2];
+}
+
+} // namespace El
@@ -12,6 +12,145 @@
 
 namespace El {
 
+namespace {
+
+// Sort by value in the requested direction, breaking ties by index, so that
+// every entry is distinct and the sort is stable
+template<typename Real>
+struct KeyCompare
+{
+    bool ascending;
+
+    bool operator()( const ValueInt<Real>& a, const ValueInt<Real>& b ) const
+    {
+        if( a.value == b.value )
+            return a.index < b.index;
+        return ascending ? a.value < b.value : a.value > b.value;
+    }
+};
+
+// Below this many entries per thread, the local sorts are sequential
+const Int parallelSortChunkSize = 16384;
+
+// Merges the consecutive sorted runs [bounds[r],bounds[r+1]) in place
+template<typename T,typename Compare>
+void MergeRuns( T* begin, vector<Int> bounds, Compare comp )
+{
+    while( bounds.size() > 2 )
+    {
+        const Int numRuns = bounds.size()-1;
+        EL_PARALLEL_FOR
+        for( Int r=0; r<numRuns-1; r+=2 )
+            std::inplace_merge
+            ( begin+bounds[r], begin+bounds[r+1], begin+bounds[r+2], comp );
+        vector<Int> mergedBounds;
+        for( Int r=0; r<numRuns; r+=2 )
+            mergedBounds.push_back( bounds[r] );
+        mergedBounds.push_back( bounds[numRuns] );
+        bounds.swap( mergedBounds );
+    }
+}
+
+// Each thread sorts a contiguous chunk before the chunks are merged pairwise
+template<typename T,typename Compare>
+void ParallelSort( T* begin, T* end, Compare comp, bool stable )
+{
+#ifdef EL_HYBRID
+    const Int n = end - begin;
+    const Int numChunks =
+      Min( Int(omp_get_max_threads()), n/parallelSortChunkSize );
+    if( numChunks > 1 )
+    {
+        vector<Int> bounds(numChunks+1);
+        for( Int c=0; c<=numChunks; ++c )
+            bounds[c] = (c*n) / numChunks;
+        EL_PARALLEL_FOR
+        for( Int c=0; c<numChunks; ++c )
+        {
+            if( stable )
+                std::stable_sort( begin+bounds[c], begin+bounds[c+1], comp );
+            else
+                std::sort( begin+bounds[c], begin+bounds[c+1], comp );
+        }
+        MergeRuns( begin, bounds, comp );
+        return;
+    }
+#endif
+    if( stable )
+        std::stable_sort( begin, end, comp );
+    else
+        std::sort( begin, end, comp );
+}
+
+// Sorts the union of the processes' entries by regular sampling: each process
+// sorts its entries and contributes commSize-1 evenly spaced samples, every
+// process sorts the samples to choose the same commSize-1 splitters, and a
+// single all-to-all sends each bucket to its process, which merges the sorted
+// runs which it receives. On exit, the entries of process q are the sorted
+// entries in positions [start_q,start_q+counts[q]), where the starts are the
+// exclusive prefix sums of the returned counts.
+template<typename Real>
+vector<int> SampleSort
+( vector<ValueInt<Real>>& pairs, const KeyCompare<Real>& comp,
+  mpi::Comm comm )
+{
+    EL_DEBUG_CSE
+    const int commSize = mpi::Size( comm );
+    const Int numLocal = pairs.size();
+    ParallelSort( pairs.data(), pairs.data()+numLocal, comp, false );
+
+    vector<ValueInt<Real>> samples;
+    if( numLocal > 0 )
+        for( int q=1; q<commSize; ++q )
+            samples.push_back( pairs[(q*numLocal)/commSize] );
+    const int numSamples = samples.size();
+    vector<int> sampleCounts(commSize), sampleOffs;
+    mpi::AllGather( &numSamples, 1, sampleCounts.data(), 1, comm );
+    const int totalSamples = Scan( sampleCounts, sampleOffs );
+    vector<ValueInt<Real>> allSamples( totalSamples );
+    mpi::AllGather
+    ( samples.data(), numSamples,
+      allSamples.data(), sampleCounts.data(), sampleOffs.data(), comm );
+    std::sort( allSamples.begin(), allSamples.end(), comp );
+
+    // Split the sorted local entries into one bucket per process
+    vector<int> sendCounts(commSize), sendOffs;
+    Int bucketBeg = 0;
+    for( int q=0; q<commSize; ++q )
+    {
+        Int bucketEnd = numLocal;
+        if( q < commSize-1 && totalSamples > 0 )
+        {
+            const auto& splitter = allSamples[((q+1)*totalSamples)/commSize];
+            bucketEnd =
+              std::upper_bound
+              ( pairs.begin()+bucketBeg, pairs.end(), splitter, comp ) -
+              pairs.begin();
+        }
+        sendCounts[q] = bucketEnd - bucketBeg;
+        bucketBeg = bucketEnd;
+    }
+    Scan( sendCounts, sendOffs );
+
+    vector<int> recvCounts(commSize), recvOffs;
+    mpi::AllToAll( sendCounts.data(), 1, recvCounts.data(), 1, comm );
+    const int totalRecv = Scan( recvCounts, recvOffs );
+    vector<ValueInt<Real>> recvPairs( totalRecv );
+    mpi::AllToAll
+    ( pairs.data(), sendCounts.data(), sendOffs.data(),
+      recvPairs.data(), recvCounts.data(), recvOffs.data(), comm );
+    vector<Int> bounds( recvOffs.begin(), recvOffs.end() );
+    bounds.push_back( totalRecv );
+    MergeRuns( recvPairs.data(), bounds, comp );
+    pairs.swap( recvPairs );
+
+    vector<int> counts(commSize);
+    mpi::AllGather( &totalRecv, 1, counts.data(), 1, comm );
+    return counts;
+}
+
+} // anonymous namespace
+
 // Sort each column of the real matrix X
 
 template<typename Real,
@@ -27,19 +166,9 @@ void Sort( Matrix<Real>& X, SortType sort, bool stable )
     {
         Real* XCol = X.Buffer(0,j);
         if( sort == ASCENDING )
-        {
-            if( stable )
-                std::stable_sort( XCol, XCol+m );
-            else
-                std::sort( XCol, XCol+m );
-        }
+            ParallelSort( XCol, XCol+m, std::less<Real>(), stable );
         else
-        {
-            if( stable )
-                std::stable_sort( XCol, XCol+m, std::greater<Real>() );
-            else
-                std::sort( XCol, XCol+m, std::greater<Real>() );
-        }
+            ParallelSort( XCol, XCol+m, std::greater<Real>(), stable );
     }
 }
 
@@ -59,15 +188,72 @@ void Sort( AbstractDistMatrix<Real>& X, SortType sort, bool stable )
     }
     else
     {
-        // TODO(poulson): Distributed sort
-
-        // Get a copy on a single process, sort, and then redistribute
-        DistMatrix<Real,CIRC,CIRC> X_CIRC_CIRC( X );
-        if( X_CIRC_CIRC.Participating() )
-            Sort( X_CIRC_CIRC.Matrix(), sort, stable );
+        DistMatrixReadWriteProxy<Real,Real,VC,STAR> XProx( X );
+        auto& X_VC_STAR = XProx.Get();
+        if( !X_VC_STAR.Participating() )
+            return;
+        mpi::Comm comm = X_VC_STAR.ColComm();
+        const int commSize = mpi::Size( comm );
+        if( commSize == 1 )
+        {
+            Sort( X_VC_STAR.Matrix(), sort, stable );
+            return;
+        }
 
-        // Refill the distributed X with the sorted values
-        Copy( X_CIRC_CIRC, X );
+        // Since ties are broken by the original row index, the distributed
+        // sort is always stable
+        const KeyCompare<Real> comp{ sort == ASCENDING };
+        const int colShift = X_VC_STAR.ColShift();
+        const Int localHeight = X_VC_STAR.LocalHeight();
+        auto& XLoc = X_VC_STAR.Matrix();
+        vector<ValueInt<Real>> pairs;
+        vector<int> starts, sendCounts(commSize), sendOffs,
+                    recvCounts(commSize), recvOffs;
+        for( Int j=0; j<X.Width(); ++j )
+        {
+            pairs.resize( localHeight );
+            for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+            {
+                pairs[iLoc].value = XLoc(iLoc,j);
+                pairs[iLoc].index = X_VC_STAR.GlobalRow(iLoc);
+            }
+            const vector<int> counts = SampleSort( pairs, comp, comm );
+            Scan( counts, starts );
+
+            // Send the sorted entry in each position to the owner of that
+            // row; the receivers can infer the positions from the counts
+            const Int myStart = starts[mpi::Rank(comm)];
+            const Int numSorted = pairs.size();
+            for( int q=0; q<commSize; ++q )
+            {
+                const Int shift = Shift( q, X_VC_STAR.ColAlign(), commSize );
+                sendCounts[q] =
+                  Length( myStart+numSorted, shift, commSize ) -
+                  Length( myStart, shift, commSize );
+                recvCounts[q] =
+                  Length( starts[q]+counts[q], colShift, commSize ) -
+                  Length( starts[q], colShift, commSize );
+            }
+            const int totalSend = Scan( sendCounts, sendOffs );
+            const int totalRecv = Scan( recvCounts, recvOffs );
+            vector<Real> sendBuf( totalSend ), recvBuf( totalRecv );
+            auto offs = sendOffs;
+            for( Int k=0; k<numSorted; ++k )
+                sendBuf[offs[X_VC_STAR.RowOwner(myStart+k)]++] =
+                  pairs[k].value;
+            mpi::AllToAll
+            ( sendBuf.data(), sendCounts.data(), sendOffs.data(),
+              recvBuf.data(), recvCounts.data(), recvOffs.data(), comm );
+
+            int q = 0;
+            for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+            {
+                const Int i = X_VC_STAR.GlobalRow(iLoc);
+                while( i >= starts[q]+counts[q] )
+                    ++q;
+                XLoc(iLoc,j) = recvBuf[recvOffs[q]++];
+            }
+        }
     }
 }
 
@@ -122,14 +308,43 @@ TaggedSort( const AbstractDistMatrix<Real>& x, SortType sort, bool stable )
 {
     EL_DEBUG_CSE
     if( x.ColDist()==STAR && x.RowDist()==STAR )
-    {
         return TaggedSort( x.LockedMatrix(), sort, stable );
-    }
+    if( x.Height() != 1 && x.Width() != 1 )
+        LogicError("TaggedSort is meant for a single vector");
+
+    DistMatrix<Real,VC,STAR> x_VC_STAR( x.Grid() );
+    if( x.Width() == 1 )
+        x_VC_STAR = x;
     else
+        Transpose( x, x_VC_STAR );
+    if( !x_VC_STAR.Participating() )
+        return vector<ValueInt<Real>>();
+    if( sort == UNSORTED )
     {
-        DistMatrix<Real,STAR,STAR> x_STAR_STAR( x );
+        DistMatrix<Real,STAR,STAR> x_STAR_STAR( x_VC_STAR );
         return TaggedSort( x_STAR_STAR.LockedMatrix(), sort, stable );
     }
+    mpi::Comm comm = x_VC_STAR.ColComm();
+    if( mpi::Size(comm) == 1 )
+        return TaggedSort( x_VC_STAR.LockedMatrix(), sort, stable );
+
+    // Sort the distributed entries and then gather the sorted sequence
+    const Int localHeight = x_VC_STAR.LocalHeight();
+    vector<ValueInt<Real>> pairs( localHeight );
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+    {
+        pairs[iLoc].value = x_VC_STAR.GetLocal(iLoc,0);
+        pairs[iLoc].index = x_VC_STAR.GlobalRow(iLoc);
+    }
+    const vector<int> counts =
+      SampleSort( pairs, KeyCompare<Real>{ sort == ASCENDING }, comm );
+    vector<int> offsets;
+    const int numEntries = Scan( counts, offsets );
+    vector<ValueInt<Real>> sortedPairs( numEntries );
+    mpi::AllGather
+    ( pairs.data(), int(pairs.size()),
+      sortedPairs.data(), counts.data(), offsets.data(), comm );
+    return sortedPairs;
 }
 
 template<typename Real,typename Field>
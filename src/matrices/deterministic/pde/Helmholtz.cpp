@@ -10,6 +10,8 @@
 #include <El/blas_like/level1.hpp>
 #include <El/matrices.hpp>
 
+#include "./Stencil.hpp"
+
 namespace El {
 
 // 1D Helmholtz
@@ -64,22 +66,15 @@ void Helmholtz( SparseMatrix<F>& H, Int n, F shift )
 {
     EL_DEBUG_CSE
     typedef Base<F> Real;
-    Zeros( H, n, n );
-
     const Real hInv = n+1; 
     const Real hInvSquared = hInv*hInv;
     const F mainTerm = 2*hInvSquared - shift;
-
-    H.Reserve( 3*n );
-    for( Int i=0; i<n; ++i )
+    auto terms = [&]( Int x, Int y, Int z, F* coefs )
     {
-        H.QueueUpdate( i, i, mainTerm );
-        if( i != 0 )
-            H.QueueUpdate( i, i-1, -hInvSquared );
-        if( i != n-1 )
-            H.QueueUpdate( i, i+1, -hInvSquared );
-    }
-    H.ProcessQueues();
+        coefs[2] = coefs[4] = -hInvSquared;
+        coefs[3] = mainTerm;
+    };
+    stencil::Fill( H, n, 1, 1, terms );
 }
 
 template<typename F>
@@ -87,24 +82,15 @@ void Helmholtz( DistSparseMatrix<F>& H, Int n, F shift )
 {
     EL_DEBUG_CSE
     typedef Base<F> Real;
-    Zeros( H, n, n );
-
     const Real hInv = n+1; 
     const Real hInvSquared = hInv*hInv;
     const F mainTerm = 2*hInvSquared - shift;
-
-    const Int localHeight = H.LocalHeight(); 
-    H.Reserve( 3*localHeight );
-    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+    auto terms = [&]( Int x, Int y, Int z, F* coefs )
     {
-        const Int i = H.GlobalRow(iLoc);
-        H.QueueUpdate( i, i, mainTerm );
-        if( i != 0 )
-            H.QueueUpdate( i, i-1, -hInvSquared );
-        if( i != n-1 )
-            H.QueueUpdate( i, i+1, -hInvSquared );
-    }
-    H.ProcessQueues();
+        coefs[2] = coefs[4] = -hInvSquared;
+        coefs[3] = mainTerm;
+    };
+    stencil::Fill( H, n, 1, 1, terms );
 }
 
 // 2D Helmholtz
@@ -178,32 +164,18 @@ void Helmholtz( SparseMatrix<F>& H, Int nx, Int ny, F shift )
 {
     EL_DEBUG_CSE
     typedef Base<F> Real;
-    const Int n = nx*ny;
-    Zeros( H, n, n );
-
     const Real hxInv = nx+1;
     const Real hyInv = ny+1;
     const Real hxInvSquared = hxInv*hxInv;
     const Real hyInvSquared = hyInv*hyInv;
     const F mainTerm = 2*(hxInvSquared+hyInvSquared) - shift;
-
-    H.Reserve( 5*n );
-    for( Int i=0; i<n; ++i )
+    auto terms = [&]( Int x, Int y, Int z, F* coefs )
     {
-        const Int x = i % nx;
-        const Int y = i/nx;
-
-        H.QueueUpdate( i, i, mainTerm );
-        if( x != 0 )
-            H.QueueUpdate( i, i-1, -hxInvSquared );
-        if( x != nx-1 )
-            H.QueueUpdate( i, i+1, -hxInvSquared );
-        if( y != 0 )
-            H.QueueUpdate( i, i-nx, -hyInvSquared );
-        if( y != ny-1 )
-            H.QueueUpdate( i, i+nx, -hyInvSquared );
-    }
-    H.ProcessQueues();
+        coefs[1] = coefs[5] = -hyInvSquared;
+        coefs[2] = coefs[4] = -hxInvSquared;
+        coefs[3] = mainTerm;
+    };
+    stencil::Fill( H, nx, ny, 1, terms );
 }
 
 template<typename F>
@@ -211,34 +183,18 @@ void Helmholtz( DistSparseMatrix<F>& H, Int nx, Int ny, F shift )
 {
     EL_DEBUG_CSE
     typedef Base<F> Real;
-    const Int n = nx*ny;
-    Zeros( H, n, n );
-
     const Real hxInv = nx+1;
     const Real hyInv = ny+1;
     const Real hxInvSquared = hxInv*hxInv;
     const Real hyInvSquared = hyInv*hyInv;
     const F mainTerm = 2*(hxInvSquared+hyInvSquared) - shift;
-
-    const Int localHeight = H.LocalHeight();
-    H.Reserve( 5*localHeight );
-    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+    auto terms = [&]( Int x, Int y, Int z, F* coefs )
     {
-        const Int i = H.GlobalRow(iLoc);
-        const Int x = i % nx;
-        const Int y = i/nx;
-
-        H.QueueUpdate( i, i, mainTerm );
-        if( x != 0 )
-            H.QueueUpdate( i, i-1, -hxInvSquared );
-        if( x != nx-1 )
-            H.QueueUpdate( i, i+1, -hxInvSquared );
-        if( y != 0 )
-            H.QueueUpdate( i, i-nx, -hyInvSquared );
-        if( y != ny-1 )
-            H.QueueUpdate( i, i+nx, -hyInvSquared );
-    }
-    H.ProcessQueues();
+        coefs[1] = coefs[5] = -hyInvSquared;
+        coefs[2] = coefs[4] = -hxInvSquared;
+        coefs[3] = mainTerm;
+    };
+    stencil::Fill( H, nx, ny, 1, terms );
 }
 
 // 3D Helmholtz
@@ -326,9 +282,6 @@ void Helmholtz( SparseMatrix<F>& H, Int nx, Int ny, Int nz, F shift )
 {
     EL_DEBUG_CSE
     typedef Base<F> Real;
-    const Int n = nx*ny*nz;
-    Zeros( H, n, n );
-
     const Real hxInv = nx+1; 
     const Real hyInv = ny+1;
     const Real hzInv = nz+1;
@@ -336,29 +289,14 @@ void Helmholtz( SparseMatrix<F>& H, Int nx, Int ny, Int nz, F shift )
     const Real hyInvSquared = hyInv*hyInv;
     const Real hzInvSquared = hzInv*hzInv;
     const F mainTerm = 2*(hxInvSquared+hyInvSquared+hzInvSquared) - shift;
-
-    H.Reserve( 7*n );
-    for( Int i=0; i<n; ++i )
+    auto terms = [&]( Int x, Int y, Int z, F* coefs )
     {
-        const Int x = i % nx;
-        const Int y = (i/nx) % ny;
-        const Int z = i/(nx*ny);
-
-        H.QueueUpdate( i, i, mainTerm );
-        if( x != 0 )
-            H.QueueUpdate( i, i-1, -hxInvSquared );
-        if( x != nx-1 )
-            H.QueueUpdate( i, i+1, -hxInvSquared );
-        if( y != 0 )
-            H.QueueUpdate( i, i-nx, -hyInvSquared );
-        if( y != ny-1 )
-            H.QueueUpdate( i, i+nx, -hyInvSquared );
-        if( z != 0 )
-            H.QueueUpdate( i, i-nx*ny, -hzInvSquared );
-        if( z != nz-1 )
-            H.QueueUpdate( i, i+nx*ny, -hzInvSquared );
-    }
-    H.ProcessQueues();
+        coefs[0] = coefs[6] = -hzInvSquared;
+        coefs[1] = coefs[5] = -hyInvSquared;
+        coefs[2] = coefs[4] = -hxInvSquared;
+        coefs[3] = mainTerm;
+    };
+    stencil::Fill( H, nx, ny, nz, terms );
 }
 
 template<typename F> 
@@ -366,9 +304,6 @@ void Helmholtz( DistSparseMatrix<F>& H, Int nx, Int ny, Int nz, F shift )
 {
     EL_DEBUG_CSE
     typedef Base<F> Real;
-    const Int n = nx*ny*nz;
-    Zeros( H, n, n );
-
     const Real hxInv = nx+1; 
     const Real hyInv = ny+1;
     const Real hzInv = nz+1;
@@ -376,31 +311,14 @@ void Helmholtz( DistSparseMatrix<F>& H, Int nx, Int ny, Int nz, F shift )
     const Real hyInvSquared = hyInv*hyInv;
     const Real hzInvSquared = hzInv*hzInv;
     const F mainTerm = 2*(hxInvSquared+hyInvSquared+hzInvSquared) - shift;
-
-    const Int localHeight = H.LocalHeight();
-    H.Reserve( 7*localHeight );
-    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+    auto terms = [&]( Int x, Int y, Int z, F* coefs )
     {
-        const Int i = H.GlobalRow(iLoc);
-        const Int x = i % nx;
-        const Int y = (i/nx) % ny;
-        const Int z = i/(nx*ny);
-
-        H.QueueUpdate( i, i, mainTerm );
-        if( x != 0 )
-            H.QueueUpdate( i, i-1, -hxInvSquared );
-        if( x != nx-1 )
-            H.QueueUpdate( i, i+1, -hxInvSquared );
-        if( y != 0 )
-            H.QueueUpdate( i, i-nx, -hyInvSquared );
-        if( y != ny-1 )
-            H.QueueUpdate( i, i+nx, -hyInvSquared );
-        if( z != 0 )
-            H.QueueUpdate( i, i-nx*ny, -hzInvSquared );
-        if( z != nz-1 )
-            H.QueueUpdate( i, i+nx*ny, -hzInvSquared );
-    }
-    H.ProcessQueues();
+        coefs[0] = coefs[6] = -hzInvSquared;
+        coefs[1] = coefs[5] = -hyInvSquared;
+        coefs[2] = coefs[4] = -hxInvSquared;
+        coefs[3] = mainTerm;
+    };
+    stencil::Fill( H, nx, ny, nz, terms );
 }
 
 #define PROTO(F) \
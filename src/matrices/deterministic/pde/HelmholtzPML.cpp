@@ -10,6 +10,8 @@
 #include <El/blas_like/level1.hpp>
 #include <El/matrices.hpp>
 
+#include "./Stencil.hpp"
+
 namespace El {
 
 namespace pml {
@@ -136,17 +138,13 @@ void HelmholtzPML
     EL_DEBUG_CSE
     using namespace pml;
     typedef Complex<Real> C;
-    Zeros( H, n, n );
 
     const Real k = RealPart(omega) / (2*M_PI);
     const Real h = Real(1)/(n+1);
     const Real hSquared = h*h;
  
-    H.Reserve( 3*n );
-    for( Int i=0; i<n; ++i )
+    auto terms = [&]( Int x, Int y, Int z, C* coefs )
     {
-        const Int x = i;
-
         const C sInvL = sInv( x-1, n, numPmlPoints, h, pmlExp, sigma, k );
         const C sInvM = sInv( x,   n, numPmlPoints, h, pmlExp, sigma, k );
         const C sInvR = sInv( x+1, n, numPmlPoints, h, pmlExp, sigma, k );
@@ -161,13 +159,11 @@ void HelmholtzPML
 
         const C mainTerm = (xTermL+xTermR) - omega*omega*sInvM;
 
-        H.QueueUpdate( i, i, mainTerm );
-        if( x != 0 )
-            H.QueueUpdate( i, i-1, -xTermL );
-        if( x != n-1 )
-            H.QueueUpdate( i, i+1, -xTermR );
-    }
-    H.ProcessQueues();
+        coefs[2] = -xTermL;
+        coefs[3] = mainTerm;
+        coefs[4] = -xTermR;
+    };
+    stencil::Fill( H, n, 1, 1, terms );
 }
 
 template<typename Real> 
@@ -178,19 +174,13 @@ void HelmholtzPML
     EL_DEBUG_CSE
     using namespace pml;
     typedef Complex<Real> C;
-    Zeros( H, n, n );
 
     const Real k = RealPart(omega) / (2*M_PI);
     const Real h = Real(1)/(n+1);
     const Real hSquared = h*h;
  
-    const Int localHeight = H.LocalHeight();
-    H.Reserve( 3*localHeight );
-    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+    auto terms = [&]( Int x, Int y, Int z, C* coefs )
     {
-        const Int i = H.GlobalRow(iLoc);
-        const Int x = i;
-
         const C sInvL = sInv( x-1, n, numPmlPoints, h, pmlExp, sigma, k );
         const C sInvM = sInv( x,   n, numPmlPoints, h, pmlExp, sigma, k );
         const C sInvR = sInv( x+1, n, numPmlPoints, h, pmlExp, sigma, k );
@@ -205,13 +195,11 @@ void HelmholtzPML
 
         const C mainTerm = (xTermL+xTermR) - omega*omega*sInvM;
 
-        H.QueueUpdate( i, i, mainTerm );
-        if( x != 0 )
-            H.QueueUpdate( i, i-1, -xTermL );
-        if( x != n-1 )
-            H.QueueUpdate( i, i+1, -xTermR );
-    }
-    H.ProcessQueues();
+        coefs[2] = -xTermL;
+        coefs[3] = mainTerm;
+        coefs[4] = -xTermR;
+    };
+    stencil::Fill( H, n, 1, 1, terms );
 }
 
 // 2D Helmholtz with PML
@@ -343,8 +331,6 @@ void HelmholtzPML
     EL_DEBUG_CSE
     using namespace pml;
     typedef Complex<Real> C;
-    const Int n = nx*ny;
-    Zeros( H, n, n );
 
     const Real k = RealPart(omega) / (2*M_PI);
     const Real hx = Real(1)/(nx+1);
@@ -352,12 +338,8 @@ void HelmholtzPML
     const Real hxSquared = hx*hx;
     const Real hySquared = hy*hy;
 
-    H.Reserve( 5*n );
-    for( Int i=0; i<n; ++i )
+    auto terms = [&]( Int x, Int y, Int z, C* coefs )
     {
-        const Int x = i % nx;
-        const Int y = i / nx; 
-
         const C sxInvL = sInv( x-1, nx, numPmlPoints, hx, pmlExp, sigma, k );
         const C sxInvM = sInv( x,   nx, numPmlPoints, hx, pmlExp, sigma, k );
         const C sxInvR = sInv( x+1, nx, numPmlPoints, hx, pmlExp, sigma, k );
@@ -383,17 +365,13 @@ void HelmholtzPML
         const C mainTerm = (xTermL+xTermR+yTermL+yTermR) - 
                            omega*omega*sxInvM*syInvM;
 
-        H.QueueUpdate( i, i, mainTerm );
-        if( x != 0 )
-            H.QueueUpdate( i, i-1, -xTermL );
-        if( x != nx-1 )
-            H.QueueUpdate( i, i+1, -xTermR );
-        if( y != 0 )
-            H.QueueUpdate( i, i-nx, -yTermL );
-        if( y != ny-1 )
-            H.QueueUpdate( i, i+nx, -yTermR );
-    }
-    H.ProcessQueues();
+        coefs[1] = -yTermL;
+        coefs[2] = -xTermL;
+        coefs[3] = mainTerm;
+        coefs[4] = -xTermR;
+        coefs[5] = -yTermR;
+    };
+    stencil::Fill( H, nx, ny, 1, terms );
 }
 
 template<typename Real> 
@@ -404,8 +382,6 @@ void HelmholtzPML
     EL_DEBUG_CSE
     using namespace pml;
     typedef Complex<Real> C;
-    const Int n = nx*ny;
-    Zeros( H, n, n );
 
     const Real k = RealPart(omega) / (2*M_PI);
     const Real hx = Real(1)/(nx+1);
@@ -413,14 +389,8 @@ void HelmholtzPML
     const Real hxSquared = hx*hx;
     const Real hySquared = hy*hy;
 
-    const Int localHeight = H.LocalHeight();
-    H.Reserve( 5*localHeight );
-    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+    auto terms = [&]( Int x, Int y, Int z, C* coefs )
     {
-        const Int i = H.GlobalRow(iLoc);
-        const Int x = i % nx;
-        const Int y = i / nx; 
-
         const C sxInvL = sInv( x-1, nx, numPmlPoints, hx, pmlExp, sigma, k );
         const C sxInvM = sInv( x,   nx, numPmlPoints, hx, pmlExp, sigma, k );
         const C sxInvR = sInv( x+1, nx, numPmlPoints, hx, pmlExp, sigma, k );
@@ -446,17 +416,13 @@ void HelmholtzPML
         const C mainTerm = (xTermL+xTermR+yTermL+yTermR) - 
                            omega*omega*sxInvM*syInvM;
 
-        H.QueueUpdate( i, i, mainTerm );
-        if( x != 0 )
-            H.QueueUpdate( i, i-1, -xTermL );
-        if( x != nx-1 )
-            H.QueueUpdate( i, i+1, -xTermR );
-        if( y != 0 )
-            H.QueueUpdate( i, i-nx, -yTermL );
-        if( y != ny-1 )
-            H.QueueUpdate( i, i+nx, -yTermR );
-    }
-    H.ProcessQueues();
+        coefs[1] = -yTermL;
+        coefs[2] = -xTermL;
+        coefs[3] = mainTerm;
+        coefs[4] = -xTermR;
+        coefs[5] = -yTermR;
+    };
+    stencil::Fill( H, nx, ny, 1, terms );
 }
 
 // 3D Helmholtz with PML
@@ -624,8 +590,6 @@ void HelmholtzPML
     EL_DEBUG_CSE
     using namespace pml;
     typedef Complex<Real> C;
-    const Int n = nx*ny*nz;
-    Zeros( H, n, n );
 
     const Real k = RealPart(omega) / (2*M_PI);
     const Real hx = Real(1)/(nx+1);
@@ -635,13 +599,8 @@ void HelmholtzPML
     const Real hySquared = hy*hy;
     const Real hzSquared = hz*hz;
 
-    H.Reserve( 7*n );
-    for( Int i=0; i<n; ++i )
+    auto terms = [&]( Int x, Int y, Int z, C* coefs )
     {
-        const Int x = i % nx;
-        const Int y = (i/nx) % ny; 
-        const Int z = i/(nx*ny);
-
         const C sxInvL = sInv( x-1, nx, numPmlPoints, hx, pmlExp, sigma, k );
         const C sxInvM = sInv( x,   nx, numPmlPoints, hx, pmlExp, sigma, k );
         const C sxInvR = sInv( x+1, nx, numPmlPoints, hx, pmlExp, sigma, k );
@@ -678,21 +637,15 @@ void HelmholtzPML
         const C mainTerm = (xTermL+xTermR+yTermL+yTermR+zTermL+zTermR) - 
                            omega*omega*sxInvM*syInvM*szInvM;
 
-        H.QueueUpdate( i, i, mainTerm );
-        if( x != 0 )
-            H.QueueUpdate( i, i-1, -xTermL );
-        if( x != nx-1 )
-            H.QueueUpdate( i, i+1, -xTermR );
-        if( y != 0 )
-            H.QueueUpdate( i, i-nx, -yTermL );
-        if( y != ny-1 )
-            H.QueueUpdate( i, i+nx, -yTermR );
-        if( z != 0 )
-            H.QueueUpdate( i, i-nx*ny, -zTermL );
-        if( z != nz-1 )
-            H.QueueUpdate( i, i+nx*ny, -zTermR );
-    }
-    H.ProcessQueues();
+        coefs[0] = -zTermL;
+        coefs[1] = -yTermL;
+        coefs[2] = -xTermL;
+        coefs[3] = mainTerm;
+        coefs[4] = -xTermR;
+        coefs[5] = -yTermR;
+        coefs[6] = -zTermR;
+    };
+    stencil::Fill( H, nx, ny, nz, terms );
 }
 
 template<typename Real> 
@@ -703,8 +656,6 @@ void HelmholtzPML
     EL_DEBUG_CSE
     using namespace pml;
     typedef Complex<Real> C;
-    const Int n = nx*ny*nz;
-    Zeros( H, n, n );
 
     const Real k = RealPart(omega) / (2*M_PI);
     const Real hx = Real(1)/(nx+1);
@@ -714,15 +665,8 @@ void HelmholtzPML
     const Real hySquared = hy*hy;
     const Real hzSquared = hz*hz;
 
-    const Int localHeight = H.LocalHeight();
-    H.Reserve( 7*localHeight );
-    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+    auto terms = [&]( Int x, Int y, Int z, C* coefs )
     {
-        const Int i = H.GlobalRow(iLoc);
-        const Int x = i % nx;
-        const Int y = (i/nx) % ny; 
-        const Int z = i/(nx*ny);
-
         const C sxInvL = sInv( x-1, nx, numPmlPoints, hx, pmlExp, sigma, k );
         const C sxInvM = sInv( x,   nx, numPmlPoints, hx, pmlExp, sigma, k );
         const C sxInvR = sInv( x+1, nx, numPmlPoints, hx, pmlExp, sigma, k );
@@ -759,21 +703,15 @@ void HelmholtzPML
         const C mainTerm = (xTermL+xTermR+yTermL+yTermR+zTermL+zTermR) - 
                            omega*omega*sxInvM*syInvM*szInvM;
 
-        H.QueueUpdate( i, i, mainTerm );
-        if( x != 0 )
-            H.QueueUpdate( i, i-1, -xTermL );
-        if( x != nx-1 )
-            H.QueueUpdate( i, i+1, -xTermR );
-        if( y != 0 )
-            H.QueueUpdate( i, i-nx, -yTermL );
-        if( y != ny-1 )
-            H.QueueUpdate( i, i+nx, -yTermR );
-        if( z != 0 )
-            H.QueueUpdate( i, i-nx*ny, -zTermL );
-        if( z != nz-1 )
-            H.QueueUpdate( i, i+nx*ny, -zTermR );
-    }
-    H.ProcessQueues();
+        coefs[0] = -zTermL;
+        coefs[1] = -yTermL;
+        coefs[2] = -xTermL;
+        coefs[3] = mainTerm;
+        coefs[4] = -xTermR;
+        coefs[5] = -yTermR;
+        coefs[6] = -zTermR;
+    };
+    stencil::Fill( H, nx, ny, nz, terms );
 }
 
 #define PROTO(Real) \
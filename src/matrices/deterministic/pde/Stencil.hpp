@@ -0,0 +1,129 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_MATRICES_PDE_STENCIL_HPP
+#define EL_MATRICES_PDE_STENCIL_HPP
+
+namespace El {
+namespace stencil {
+
+// The (2d+1)-point finite-difference stencils over a lexicographically
+// ordered nx x ny x nz grid have an analytically known sparsity pattern, so
+// the CSR representations of their rows are written directly, in sorted
+// order and in parallel, rather than queued and then sorted. The 1D and 2D
+// stencils correspond to ny=nz=1 and nz=1.
+//
+// The coefficient function is called as terms(x,y,z,coefs) and must set
+// coefs[0], ..., coefs[6] to the coefficients of the columns
+//   i-nx*ny, i-nx, i-1, i, i+1, i+nx, i+nx*ny
+// of row i = x + y*nx + z*nx*ny; the coefficients of the columns which
+// fall outside of the grid are ignored.
+
+inline Int RowSize( Int x, Int y, Int z, Int nx, Int ny, Int nz )
+{
+    return 1 + (x!=0) + (x!=nx-1) + (y!=0) + (y!=ny-1) + (z!=0) + (z!=nz-1);
+}
+
+// Sets offsets[iLoc] to the first nonzero of row firstRow+iLoc for
+// 0 <= iLoc <= numRows
+inline void RowOffsets
+( Int firstRow, Int numRows, Int nx, Int ny, Int nz, Int* offsets )
+{
+    EL_DEBUG_CSE
+    offsets[0] = 0;
+    for( Int iLoc=0; iLoc<numRows; ++iLoc )
+    {
+        const Int i = firstRow + iLoc;
+        const Int x = i % nx;
+        const Int y = (i/nx) % ny;
+        const Int z = i/(nx*ny);
+        offsets[iLoc+1] = offsets[iLoc] + RowSize( x, y, z, nx, ny, nz );
+    }
+}
+
+template<typename F,typename TermFunction>
+void FillRows
+( Int firstRow, Int numRows, Int nx, Int ny, Int nz,
+  const Int* offsets, Int* sources, Int* targets, F* values,
+  const TermFunction& terms )
+{
+    EL_DEBUG_CSE
+    const Int nxy = nx*ny;
+    EL_PARALLEL_FOR_IF(ParallelizeLoop(offsets[numRows]))
+    for( Int iLoc=0; iLoc<numRows; ++iLoc )
+    {
+        const Int i = firstRow + iLoc;
+        const Int x = i % nx;
+        const Int y = (i/nx) % ny;
+        const Int z = i/nxy;
+
+        F coefs[7];
+        terms( x, y, z, coefs );
+
+        Int e = offsets[iLoc];
+        auto push = [&]( Int j, const F& value )
+        {
+            sources[e] = i;
+            targets[e] = j;
+            values[e] = value;
+            ++e;
+        };
+        if( z != 0 )
+            push( i-nxy, coefs[0] );
+        if( y != 0 )
+            push( i-nx, coefs[1] );
+        if( x != 0 )
+            push( i-1, coefs[2] );
+        push( i, coefs[3] );
+        if( x != nx-1 )
+            push( i+1, coefs[4] );
+        if( y != ny-1 )
+            push( i+nx, coefs[5] );
+        if( z != nz-1 )
+            push( i+nxy, coefs[6] );
+    }
+}
+
+template<typename F,typename TermFunction>
+void Fill
+( SparseMatrix<F>& H, Int nx, Int ny, Int nz, const TermFunction& terms )
+{
+    EL_DEBUG_CSE
+    const Int n = nx*ny*nz;
+    Zeros( H, n, n );
+    Int* offsetBuf = H.OffsetBuffer();
+    RowOffsets( 0, n, nx, ny, nz, offsetBuf );
+    H.ForceNumEntries( offsetBuf[n] );
+    FillRows
+    ( 0, n, nx, ny, nz, offsetBuf,
+      H.SourceBuffer(), H.TargetBuffer(), H.ValueBuffer(), terms );
+    H.ForceConsistency();
+}
+
+template<typename F,typename TermFunction>
+void Fill
+( DistSparseMatrix<F>& H, Int nx, Int ny, Int nz, const TermFunction& terms )
+{
+    EL_DEBUG_CSE
+    const Int n = nx*ny*nz;
+    Zeros( H, n, n );
+    const Int firstLocalRow = H.FirstLocalRow();
+    const Int localHeight = H.LocalHeight();
+    Int* offsetBuf = H.OffsetBuffer();
+    RowOffsets( firstLocalRow, localHeight, nx, ny, nz, offsetBuf );
+    H.ForceNumLocalEntries( offsetBuf[localHeight] );
+    FillRows
+    ( firstLocalRow, localHeight, nx, ny, nz, offsetBuf,
+      H.SourceBuffer(), H.TargetBuffer(), H.ValueBuffer(), terms );
+    H.ForceConsistency();
+}
+
+} // namespace stencil
+} // namespace El
+
+#endif // ifndef EL_MATRICES_PDE_STENCIL_HPP
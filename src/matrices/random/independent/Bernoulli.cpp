@@ -9,6 +9,7 @@
 #include <El-lite.hpp>
 #include <El/blas_like/level1.hpp>
 #include <El/matrices.hpp>
+#include "./CounterFill.hpp"
 
 namespace El {
 
@@ -20,6 +21,8 @@ void Bernoulli( Matrix<T>& A, Int m, Int n, double p )
         LogicError
         ("Invalid choice of parameter p for Bernoulli distribution: ",p);
     A.Resize( m, n );
+    if( philox::TryCounterFill( A, philox::BernoulliSampler<T>(p) ) )
+        return;
     const double q = 1-p;
     auto doubleCoin = [=]() -> T
     {
@@ -38,6 +41,8 @@ void Bernoulli( AbstractDistMatrix<T>& A, Int m, Int n, double p )
         LogicError
         ("Invalid choice of parameter p for Bernoulli distribution: ",p);
     A.Resize( m, n );
+    if( philox::TryCounterFill( A, philox::BernoulliSampler<T>(p) ) )
+        return;
     const double q = 1-p;
     auto doubleCoin = [=]() -> T
     {
@@ -0,0 +1,160 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_MATRICES_RANDOM_COUNTERFILL_HPP
+#define EL_MATRICES_RANDOM_COUNTERFILL_HPP
+
+namespace El {
+namespace philox {
+
+// Set A(iLoc,jLoc) := sample(key,rows[iLoc],cols[jLoc])
+template<typename T,class SampleFunc>
+void CounterFill
+( Matrix<T>& A, const vector<Int>& rows, const vector<Int>& cols,
+  std::uint64_t key, SampleFunc sample )
+{
+    EL_DEBUG_CSE
+    const Int m = A.Height();
+    const Int n = A.Width();
+    T* ABuf = A.Buffer();
+    const Int ALDim = A.LDim();
+    EL_PARALLEL_FOR_IF(ParallelizeLoop(m*n))
+    for( Int j=0; j<n; ++j )
+        for( Int i=0; i<m; ++i )
+            ABuf[i+j*ALDim] = sample( key, rows[i], cols[j] );
+}
+
+template<typename T,class SampleFunc>
+void CounterFill( Matrix<T>& A, SampleFunc sample )
+{
+    EL_DEBUG_CSE
+    vector<Int> rows(A.Height()), cols(A.Width());
+    for( Int i=0; i<A.Height(); ++i )
+        rows[i] = i;
+    for( Int j=0; j<A.Width(); ++j )
+        cols[j] = j;
+    CounterFill( A, rows, cols, NextRandomKey(true), sample );
+}
+
+// Every process of the grid uses the key drawn by the first process so that
+// the result does not depend upon which processes own which entries
+template<typename T,class SampleFunc>
+void CounterFill( AbstractDistMatrix<T>& A, SampleFunc sample )
+{
+    EL_DEBUG_CSE
+    const Grid& g = A.Grid();
+    if( !g.InGrid() )
+        return;
+    std::uint64_t key = NextRandomKey();
+    mpi::Broadcast
+    ( reinterpret_cast<byte*>(&key), sizeof(key), 0, g.VCComm() );
+    if( !A.Participating() )
+        return;
+
+    const Int localHeight = A.LocalHeight();
+    const Int localWidth = A.LocalWidth();
+    vector<Int> rows(localHeight), cols(localWidth);
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+        rows[iLoc] = A.GlobalRow(iLoc);
+    for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+        cols[jLoc] = A.GlobalCol(jLoc);
+    CounterFill( A.Matrix(), rows, cols, key, sample );
+}
+
+template<typename T,class SampleFunc>
+void CounterFill( DistMultiVec<T>& X, SampleFunc sample )
+{
+    EL_DEBUG_CSE
+    std::uint64_t key = NextRandomKey();
+    mpi::Broadcast
+    ( reinterpret_cast<byte*>(&key), sizeof(key), 0, X.Grid().Comm() );
+
+    const Int localHeight = X.LocalHeight();
+    const Int width = X.Width();
+    vector<Int> rows(localHeight), cols(width);
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+        rows[iLoc] = X.GlobalRow(iLoc);
+    for( Int j=0; j<width; ++j )
+        cols[j] = j;
+    CounterFill( X.Matrix(), rows, cols, key, sample );
+}
+
+template<typename T>
+struct BallSampler
+{
+    typedef T type;
+    T center;
+    Base<T> radius;
+    BallSampler( const T& centerArg, const Base<T>& radiusArg )
+    : center(centerArg), radius(radiusArg) { }
+    T operator()( std::uint64_t key, Int i, Int j ) const
+    { return Ball( key, i, j, center, radius ); }
+};
+
+template<typename T>
+struct NormalSampler
+{
+    typedef T type;
+    T mean;
+    Base<T> stddev;
+    NormalSampler( const T& meanArg, const Base<T>& stddevArg )
+    : mean(meanArg), stddev(stddevArg) { }
+    T operator()( std::uint64_t key, Int i, Int j ) const
+    { return Normal( key, i, j, mean, stddev ); }
+};
+
+// Returns -1 with probability p/2, +1 with probability p/2, and 0 otherwise
+template<typename T>
+struct ThreeValuedSampler
+{
+    typedef T type;
+    double p;
+    explicit ThreeValuedSampler( double pArg ) : p(pArg) { }
+    T operator()( std::uint64_t key, Int i, Int j ) const
+    {
+        const double alpha = Uniform( key, i, j );
+        if( alpha < p/2 ) return T(-1);
+        else if( alpha < p ) return T(1);
+        else return T(0);
+    }
+};
+
+// Returns 1 with probability p and 0 otherwise
+template<typename T>
+struct BernoulliSampler
+{
+    typedef T type;
+    double p;
+    explicit BernoulliSampler( double pArg ) : p(pArg) { }
+    T operator()( std::uint64_t key, Int i, Int j ) const
+    { return ( Uniform( key, i, j ) < p ? T(1) : T(0) ); }
+};
+
+// Only the types whose samples are formed in double-precision arithmetic are
+// drawn from the counter-based generator; false is returned if the caller
+// should fall back to the Mersenne twister
+template<class MatType,class Sampler,
+         typename=EnableIf<IsBlasScalar<typename Sampler::type>>>
+bool TryCounterFill( MatType& A, const Sampler& sample )
+{
+    if( !CounterBasedRandom() )
+        return false;
+    CounterFill( A, sample );
+    return true;
+}
+
+template<class MatType,class Sampler,
+         typename=DisableIf<IsBlasScalar<typename Sampler::type>>,
+         typename=void>
+bool TryCounterFill( MatType& A, const Sampler& sample )
+{ return false; }
+
+} // namespace philox
+} // namespace El
+
+#endif // ifndef EL_MATRICES_RANDOM_COUNTERFILL_HPP
@@ -9,6 +9,7 @@
 #include <El-lite.hpp>
 #include <El/blas_like/level1.hpp>
 #include <El/matrices.hpp>
+#include "./CounterFill.hpp"
 
 namespace El {
 
@@ -17,6 +18,8 @@ template<typename F>
 void MakeGaussian( Matrix<F>& A, F mean, Base<F> stddev )
 {
     EL_DEBUG_CSE
+    if( philox::TryCounterFill( A, philox::NormalSampler<F>(mean,stddev) ) )
+        return;
     auto sampleNormal = [=]() { return SampleNormal(mean,stddev); };
     EntrywiseFill( A, function<F()>(sampleNormal) );
 }
@@ -25,6 +28,8 @@ template<typename F>
 void MakeGaussian( AbstractDistMatrix<F>& A, F mean, Base<F> stddev )
 {
     EL_DEBUG_CSE
+    if( philox::TryCounterFill( A, philox::NormalSampler<F>(mean,stddev) ) )
+        return;
     if( A.RedundantRank() == 0 )
         MakeGaussian( A.Matrix(), mean, stddev );
     Broadcast( A, A.RedundantComm(), 0 );
@@ -34,6 +39,8 @@ template<typename F>
 void MakeGaussian( DistMultiVec<F>& A, F mean, Base<F> stddev )
 {
     EL_DEBUG_CSE
+    if( philox::TryCounterFill( A, philox::NormalSampler<F>(mean,stddev) ) )
+        return;
     auto sampleNormal = [=]() { return SampleNormal(mean,stddev); };
     EntrywiseFill( A, function<F()>(sampleNormal) );
 }
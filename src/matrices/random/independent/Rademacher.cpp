@@ -25,9 +25,17 @@ void Rademacher( AbstractDistMatrix<T>& A, Int m, Int n )
     ThreeValued( A, m, n, 1. );
 }
 
+template<typename T>
+void Rademacher( DistMultiVec<T>& A, Int m, Int n )
+{
+    EL_DEBUG_CSE
+    ThreeValued( A, m, n, 1. );
+}
+
 #define PROTO(T) \
   template void Rademacher( Matrix<T>& A, Int m, Int n ); \
-  template void Rademacher( AbstractDistMatrix<T>& A, Int m, Int n );
+  template void Rademacher( AbstractDistMatrix<T>& A, Int m, Int n ); \
+  template void Rademacher( DistMultiVec<T>& A, Int m, Int n );
 
 #define EL_ENABLE_DOUBLEDOUBLE
 #define EL_ENABLE_QUADDOUBLE
@@ -9,6 +9,7 @@
 #include <El-lite.hpp>
 #include <El/blas_like/level1.hpp>
 #include <El/matrices.hpp>
+#include "./CounterFill.hpp"
 
 namespace El {
 
@@ -17,6 +18,8 @@ void ThreeValued( Matrix<T>& A, Int m, Int n, double p )
 {
     EL_DEBUG_CSE
     A.Resize( m, n );
+    if( philox::TryCounterFill( A, philox::ThreeValuedSampler<T>(p) ) )
+        return;
     auto tripleCoin = [=]() -> T
     { 
         const double alpha = SampleUniform<double>(0,1);
@@ -32,16 +35,31 @@ void ThreeValued( AbstractDistMatrix<T>& A, Int m, Int n, double p )
 {
     EL_DEBUG_CSE
     A.Resize( m, n );
+    if( philox::TryCounterFill( A, philox::ThreeValuedSampler<T>(p) ) )
+        return;
     if( A.RedundantRank() == 0 )
         ThreeValued( A.Matrix(), A.LocalHeight(), A.LocalWidth(), p );
     Broadcast( A, A.RedundantComm(), 0 );
 }
 
+template<typename T>
+void ThreeValued( DistMultiVec<T>& A, Int m, Int n, double p )
+{
+    EL_DEBUG_CSE
+    A.Resize( m, n );
+    if( philox::TryCounterFill( A, philox::ThreeValuedSampler<T>(p) ) )
+        return;
+    // Each process owns its rows, so they are sampled independently
+    ThreeValued( A.Matrix(), A.LocalHeight(), n, p );
+}
+
 #define PROTO(T) \
   template void ThreeValued \
   ( Matrix<T>& A, Int m, Int n, double p ); \
   template void ThreeValued \
-  ( AbstractDistMatrix<T>& A, Int m, Int n, double p );
+  ( AbstractDistMatrix<T>& A, Int m, Int n, double p ); \
+  template void ThreeValued \
+  ( DistMultiVec<T>& A, Int m, Int n, double p );
 
 #define EL_ENABLE_DOUBLEDOUBLE
 #define EL_ENABLE_QUADDOUBLE
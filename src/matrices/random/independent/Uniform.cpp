@@ -9,15 +9,20 @@
 #include <El-lite.hpp>
 #include <El/blas_like/level1.hpp>
 #include <El/matrices.hpp>
+#include "./CounterFill.hpp"
 
 namespace El {
 
-// Draw each entry from a uniform PDF over a closed ball.
+// Draw each entry from a uniform PDF over a closed ball. Unless
+// SetCounterBasedRandom(false) was called, the entries of float, double, and
+// their complex counterparts are generated from their global indices.
 
 template<typename T>
 void MakeUniform( Matrix<T>& A, T center, Base<T> radius )
 {
     EL_DEBUG_CSE
+    if( philox::TryCounterFill( A, philox::BallSampler<T>(center,radius) ) )
+        return;
     auto sampleBall = [=]() { return SampleBall(center,radius); };
     EntrywiseFill( A, function<T()>(sampleBall) );
 }
@@ -34,6 +39,8 @@ template<typename T>
 void MakeUniform( AbstractDistMatrix<T>& A, T center, Base<T> radius )
 {
     EL_DEBUG_CSE
+    if( philox::TryCounterFill( A, philox::BallSampler<T>(center,radius) ) )
+        return;
     if( A.RedundantRank() == 0 )
         MakeUniform( A.Matrix(), center, radius );
     Broadcast( A, A.RedundantComm(), 0 );
@@ -51,6 +58,8 @@ template<typename T>
 void MakeUniform( DistMultiVec<T>& X, T center, Base<T> radius )
 {
     EL_DEBUG_CSE
+    if( philox::TryCounterFill( X, philox::BallSampler<T>(center,radius) ) )
+        return;
     const int localHeight = X.LocalHeight();
     const int width = X.Width();
     for( int j=0; j<width; ++j )
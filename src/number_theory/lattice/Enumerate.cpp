@@ -195,9 +195,9 @@ Matrix<Real> AonoPruning()
 }
 
 template<typename Real>
-Matrix<Real> PrunedUpperBounds( Int n, Real normUpperBound, bool linear )
+Matrix<Real> PrunedUpperBounds
+( Int n, Real normUpperBound, bool linear, bool optimized=false )
 {
-    // TODO: Support more general pruning
     Matrix<Real> upperBounds( n, 1 );
     if( linear )
     {
@@ -205,6 +205,13 @@ Matrix<Real> PrunedUpperBounds( Int n, Real normUpperBound, bool linear )
             upperBounds(j) = Sqrt(Real(j+1)/Real(n))*normUpperBound;
         return upperBounds;
     }
+    if( optimized )
+    {
+        auto coefficients = OptimizedPruningCoefficients<Real>( n );
+        for( Int j=0; j<n; ++j )
+            upperBounds(j) = Sqrt(coefficients(j))*normUpperBound;
+        return upperBounds;
+    }
 
     auto controlBounds = AonoPruning<Real>();
     const Int numPoints = controlBounds.Height();
@@ -228,6 +235,22 @@ Matrix<Real> PrunedUpperBounds( Int n, Real normUpperBound, bool linear )
     return upperBounds;
 }
 
+// Find the first lattice member lying under the bounds, either sequentially
+// or by splitting the enumeration tree between workers
+template<typename F>
+Base<F> BoundedEnumeration
+( const Matrix<Base<F>>& d,
+  const Matrix<F>& N,
+  const Matrix<Base<F>>& upperBounds,
+        Matrix<F>& v,
+  const EnumCtrl<Base<F>>& ctrl )
+{
+    if( ctrl.parallel )
+        return ParallelGNREnumeration( d, N, upperBounds, v, true, ctrl );
+    else
+        return GNREnumeration( d, N, upperBounds, v, ctrl );
+}
+
 } // namespace svp
 
 // NOTE: This norm upper bound is *non-inclusive*
@@ -297,7 +320,8 @@ Base<Field> ShortVectorEnumeration
     if( ctrl.enumType == GNR_ENUM )
     {
         auto upperBounds =
-          svp::PrunedUpperBounds( n, normUpperBound, ctrl.linearBounding );
+          svp::PrunedUpperBounds
+          ( n, normUpperBound, ctrl.linearBounding, ctrl.optimizedBounding );
 
         // Since we will manually build up a (weakly) pseudorandom
         // unimodular matrix so that the probabalistic enumerations traverse
@@ -357,7 +381,7 @@ Base<Field> ShortVectorEnumeration
             if( ctrl.time )
                 timer.Start();
             Real result =
-              svp::GNREnumeration( dNew, NNew, upperBounds, v, ctrl );
+              svp::BoundedEnumeration( dNew, NNew, upperBounds, v, ctrl );
             if( ctrl.time )
                 Output("  Probabalistic enumeration: ",timer.Stop()," seconds");
             if( result < normUpperBound )
@@ -434,7 +458,7 @@ Base<Field> ShortVectorEnumeration
             Output("Starting FULL_ENUM(",n,")");
         if( ctrl.time )
             timer.Start();
-        Real result = svp::GNREnumeration( d, N, upperBounds, v, ctrl );
+        Real result = svp::BoundedEnumeration( d, N, upperBounds, v, ctrl );
         if( ctrl.time )
             Output("FULL_ENUM(",n,"): ",timer.Stop()," seconds");
         return result;
@@ -513,7 +537,8 @@ MultiShortVectorEnumeration
         const Real normUpperBound = modNormUpperBounds(0);
 
         auto upperBounds =
-          svp::PrunedUpperBounds( n, normUpperBound, ctrl.linearBounding );
+          svp::PrunedUpperBounds
+          ( n, normUpperBound, ctrl.linearBounding, ctrl.optimizedBounding );
 
         // Since we will manually build up a (weakly) pseudorandom
         // unimodular matrix so that the probabalistic enumerations traverse
@@ -573,7 +598,7 @@ MultiShortVectorEnumeration
             if( ctrl.time )
                 timer.Start();
             Real result =
-              svp::GNREnumeration( dNew, NNew, upperBounds, v, ctrl );
+              svp::BoundedEnumeration( dNew, NNew, upperBounds, v, ctrl );
             if( ctrl.time )
                 Output("  Probabalistic enumeration: ",timer.Stop()," seconds");
             if( result < normUpperBound )
@@ -662,7 +687,7 @@ MultiShortVectorEnumeration
             Output("Starting FULL_ENUM(",n,")");
         if( ctrl.time )
             timer.Start();
-        Real result = svp::GNREnumeration( d, N, upperBounds, v, ctrl );
+        Real result = svp::BoundedEnumeration( d, N, upperBounds, v, ctrl );
         if( ctrl.time )
             Output("FULL_ENUM(",n,"): ",timer.Stop()," seconds");
 
@@ -794,6 +819,33 @@ Base<Field> ShortestVectorEnumeration
     bool satisfiedBound = ( b0Norm <= normUpperBound ? true : false );
     Real targetNorm = Min(normUpperBound,b0Norm);
 
+    if( ctrl.parallel && ctrl.enumType == FULL_ENUM )
+    {
+        // Rather than restarting the enumeration after each improvement, let
+        // the workers shrink the radius of a single enumeration
+        const Int minDim = Min(B.Height(),n);
+        auto d = GetRealPartOfDiagonal( R );
+        auto N( R );
+        auto NT = N( IR(0,minDim), ALL );
+        DiagonalSolve( LEFT, NORMAL, d, NT );
+
+        Matrix<Real> upperBounds;
+        Zeros( upperBounds, n, 1 );
+        Fill( upperBounds, targetNorm );
+        Matrix<Field> vCand;
+        const Real result =
+          svp::ParallelGNREnumeration( d, N, upperBounds, vCand, false, ctrl );
+        if( result < targetNorm )
+        {
+            v = vCand;
+            return result;
+        }
+        else if( satisfiedBound )
+            return targetNorm;
+        else
+            return b0Norm;
+    }
+
     while( true )
     {
         Matrix<Field> vCand;
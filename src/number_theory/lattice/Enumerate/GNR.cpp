@@ -230,8 +230,195 @@ Base<F> TransposedHelper
     }
 }
 
+// A version of TransposedHelper specialized to the compile-time dimension 'n'
+// =========================================================================
+// The rows of N and the partial sums are stored in a packed upper-triangular
+// layout of n(n+1)/2 entries, with the entries (k+1):(n-1) of row k of N (and
+// the partial sums (k+1):n of level k, the last of which is always zero)
+// beginning at Offset(k), so that the working set is a small contiguous block.
+// The products needed to resynchronize the partial sums of a level are
+// formed in a vectorizable sweep before being accumulated, and the squared
+// norms (rather than the norms) are maintained.
+
+template<typename Real,Int n>
+struct FixedState
+{
+    static constexpr Int packedSize = (n*(n+1))/2;
+    static constexpr Int Offset( Int k ) { return k*n - (k*(k-1))/2; }
+
+    alignas(64) Real rows[packedSize];
+    alignas(64) Real partialSums[packedSize];
+    alignas(64) Real products[n];
+    alignas(64) Real v[n];
+    Real centers[n];
+    Real dSquared[n];
+    Real boundsSquared[n];
+    Real partialNormsSquared[n+1];
+    Int sumIndices[n+1];
+    SpiralState<Real> spiralStates[n];
+};
+
+template<typename Real,Int n>
+Real FixedHelper
+( const Matrix<Real>& d,
+  const Matrix<Real>& NTrans,
+  const Matrix<Real>& upperBounds,
+        Matrix<Real>& v,
+  const EnumCtrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef FixedState<Real,n> State;
+    State state;
+    for( Int k=0; k<n; ++k )
+    {
+        state.dSquared[k] = d(k)*d(k);
+        // The bound on level k applies to the last n-k entries
+        const Real bound = upperBounds((n-1)-k);
+        state.boundsSquared[k] = bound*bound;
+
+        Real* row = &state.rows[State::Offset(k)] - (k+1);
+        Real* s = &state.partialSums[State::Offset(k)] - (k+1);
+        const Real* nBuf = &NTrans(0,k);
+        for( Int i=k+1; i<n; ++i )
+            row[i] = nBuf[i];
+        for( Int i=k+1; i<=n; ++i )
+            s[i] = 0;
+
+        state.v[k] = 0;
+        state.centers[k] = 0;
+    }
+    for( Int j=0; j<=n; ++j )
+    {
+        state.partialNormsSquared[j] = 0;
+        state.sumIndices[j] = j-1;
+    }
+    state.v[0] = Real(1);
+    Int lastNonzero = 0;
+
+    Int k=0;
+    Real* vBuf = state.v;
+    while( true )
+    {
+        const Real diff = vBuf[k] - state.centers[k];
+        const Real partialNormSquared =
+          state.partialNormsSquared[k+1] + state.dSquared[k]*diff*diff;
+        state.partialNormsSquared[k] = partialNormSquared;
+        if( partialNormSquared < state.boundsSquared[k] )
+        {
+            if( k == 0 )
+            {
+                // Success
+                Zeros( v, n, 1 );
+                for( Int i=0; i<n; ++i )
+                    v(i) = vBuf[i];
+                return Sqrt(partialNormSquared);
+            }
+            else
+            {
+                // Move down the tree
+                --k;
+                state.sumIndices[k] =
+                  Max(state.sumIndices[k],state.sumIndices[k+1]);
+                const Int sumIndex = state.sumIndices[k+1];
+
+                const Real* row = &state.rows[State::Offset(k)] - (k+1);
+                Real* s = &state.partialSums[State::Offset(k)] - (k+1);
+                Real* products = state.products;
+                EL_SIMD
+                for( Int i=k+1; i<=sumIndex; ++i )
+                    products[i] = row[i]*vBuf[i];
+                for( Int i=sumIndex; i>=k+1; --i )
+                    s[i] = s[i+1] + products[i];
+
+                state.centers[k] = -s[k+1];
+                vBuf[k] = Round(state.centers[k]);
+                state.spiralStates[k].Initialize( state.centers[k] );
+            }
+        }
+        else
+        {
+            // Move up the tree
+            ++k;
+            if( k == n )
+            {
+                // Return an arbitrary value > than upperBounds(n-1)
+                return 2*upperBounds(n-1)+1;
+            }
+            state.sumIndices[k] = k; // indicate that (i,j) are not synchronized
+            if( k > lastNonzero )
+            {
+                // Seed a constrained spiral out from zero
+                state.spiralStates[k].Initialize( true );
+                vBuf[k] = state.spiralStates[k].Step();
+                lastNonzero = k;
+                if( ctrl.innerProgress )
+                    Output("lastNonzero: ",lastNonzero);
+            }
+            else
+            {
+                vBuf[k] = state.spiralStates[k].Step();
+            }
+        }
+    }
+}
+
+#define EL_FIXED_ENUM_DIMENSIONS(X) \
+  X(20) X(24) X(28) X(32) X(36) X(40) X(44) X(48) \
+  X(52) X(56) X(60) X(64) X(68) X(72) X(76) X(80)
+
+template<typename F>
+struct HasFixedHelper
+{ static const bool value = IsBlasScalar<F>::value && !IsComplex<F>::value; };
+
+template<typename Real,typename=EnableIf<HasFixedHelper<Real>>>
+bool TryFixedHelper
+( const Matrix<Real>& d,
+  const Matrix<Real>& NTrans,
+  const Matrix<Real>& upperBounds,
+        Matrix<Real>& v,
+  const EnumCtrl<Real>& ctrl,
+        Real& result )
+{
+    EL_DEBUG_CSE
+    switch( NTrans.Height() )
+    {
+#define EL_FIXED_ENUM_CASE(dim) \
+    case dim: \
+        result = FixedHelper<Real,dim>( d, NTrans, upperBounds, v, ctrl ); \
+        return true;
+    EL_FIXED_ENUM_DIMENSIONS(EL_FIXED_ENUM_CASE)
+#undef EL_FIXED_ENUM_CASE
+    default:
+        return false;
+    }
+}
+
+template<typename F,typename=DisableIf<HasFixedHelper<F>>,typename=void>
+bool TryFixedHelper
+( const Matrix<Base<F>>& d,
+  const Matrix<F>& NTrans,
+  const Matrix<Base<F>>& upperBounds,
+        Matrix<F>& v,
+  const EnumCtrl<Base<F>>& ctrl,
+        Base<F>& result )
+{ return false; }
+
 } // namespace gnr_enum
 
+template<typename F>
+bool HaveFixedEnumeration( Int n )
+{
+    if( !gnr_enum::HasFixedHelper<F>::value )
+        return false;
+    switch( n )
+    {
+#define EL_FIXED_ENUM_CASE(dim) case dim: return true;
+    EL_FIXED_ENUM_DIMENSIONS(EL_FIXED_ENUM_CASE)
+#undef EL_FIXED_ENUM_CASE
+    default: return false;
+    }
+}
+
 template<typename F>
 Base<F> GNREnumeration
 ( const Matrix<Base<F>>& d,
@@ -241,6 +428,17 @@ Base<F> GNREnumeration
   const EnumCtrl<Base<F>>& ctrl )
 {
     EL_DEBUG_CSE
+    const Int n = N.Width();
+    if( ctrl.fixedDimension == n && N.Height() == n &&
+        HaveFixedEnumeration<F>(n) )
+    {
+        Matrix<F> NTrans;
+        Transpose( N, NTrans );
+        Base<F> result;
+        if( gnr_enum::TryFixedHelper
+            ( d, NTrans, upperBounds, v, ctrl, result ) )
+            return result;
+    }
     if( ctrl.explicitTranspose )
     {
         Matrix<F> NTrans;
@@ -261,7 +459,8 @@ Base<F> GNREnumeration
     const Matrix<F>& N, \
     const Matrix<Base<F>>& u, \
           Matrix<F>& v, \
-    const EnumCtrl<Base<F>>& ctrl );
+    const EnumCtrl<Base<F>>& ctrl ); \
+  template bool svp::HaveFixedEnumeration<F>( Int n );
 
 #define EL_NO_INT_PROTO
 #define EL_ENABLE_DOUBLEDOUBLE
@@ -0,0 +1,419 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+namespace El {
+
+namespace svp {
+
+// The enumeration tree of GNREnumeration (see GNR.cpp) is split at level
+// kRoot = (n-1) - splitDepth: a sequential walk over the top 'splitDepth'
+// levels collects each admissible (nonzero) prefix v(kRoot+1:n-1), and each
+// prefix, as well as the zero prefix, roots an independent subtree which is
+// then walked by a separate task. The subtrees are ordered by the norm of
+// their prefix so that the most promising ones are searched first.
+
+namespace par_enum {
+
+// The number of nodes visited between polls of the shared state
+const Int pollInterval = 1024;
+
+template<typename F>
+class SubtreeWalker
+{
+public:
+    typedef Base<F> Real;
+
+    SubtreeWalker
+    ( const Matrix<Real>& d,
+      const Matrix<F>& NTrans,
+      const Matrix<Real>& upperBounds )
+    : d_(d), NTrans_(NTrans), upperBounds_(upperBounds)
+    {
+        const Int n = NTrans.Height();
+        Zeros( v_, n, 1 );
+        Zeros( centers_, n, 1 );
+        Zeros( partialNorms_, n+1, 1 );
+        Zeros( partialSums_, n+1, n );
+        Zeros( sumIndices_, n+1, 1 );
+        spiralStates_.resize( n );
+    }
+
+    // Walk the levels kLeaf:kTop below the zero prefix v(kTop+1:n-1) = 0,
+    // where the top nonzero entry is restricted to a coset representative
+    template<class Visitor>
+    void WalkZeroPrefix( Int kLeaf, Int kTop, Visitor& visitor )
+    {
+        const Int n = v_.Height();
+        Zero( v_ );
+        Zero( centers_ );
+        Zero( partialNorms_ );
+        Zero( partialSums_ );
+        for( Int j=0; j<=n; ++j )
+            sumIndices_(j) = j-1;
+        v_(kLeaf) = F(1);
+        Walk( kLeaf, kLeaf, kTop, kLeaf, visitor );
+    }
+
+    // Walk the levels 0:kTop below the nonzero prefix v(kTop+1:n-1)
+    template<class Visitor>
+    void WalkPrefix
+    ( const Matrix<F>& prefix, Real prefixNorm, Int kTop, Visitor& visitor )
+    {
+        const Int n = v_.Height();
+        Zero( v_ );
+        Zero( partialNorms_ );
+        for( Int i=0; i<prefix.Height(); ++i )
+            v_(kTop+1+i) = prefix(i);
+        partialNorms_(kTop+1) = prefixNorm;
+        // None of the partial sums are synchronized
+        for( Int j=0; j<=kTop+1; ++j )
+            sumIndices_(j) = n-1;
+
+        // Move down the tree into level kTop
+              F* s = &partialSums_(0,kTop);
+        const F* nBuf = &NTrans_(0,kTop);
+        for( Int i=n-1; i>=kTop+1; --i )
+            s[i] = s[i+1] + nBuf[i]*v_(i);
+        centers_(kTop) = -partialSums_(kTop+1,kTop);
+        v_(kTop) = Round(centers_(kTop));
+        spiralStates_[kTop].Initialize( centers_(kTop) );
+
+        // The top nonzero entry lies in the prefix
+        Walk( kTop, 0, kTop, n, visitor );
+    }
+
+private:
+    const Matrix<Real>& d_;
+    const Matrix<F>& NTrans_;
+    const Matrix<Real>& upperBounds_;
+
+    Matrix<F> v_, centers_, partialSums_;
+    Matrix<Real> partialNorms_;
+    Matrix<Int> sumIndices_;
+    vector<SpiralState<F>> spiralStates_;
+
+    // The same traversal as gnr_enum::TransposedHelper, but confined to the
+    // levels kLeaf:kTop, with the bounds scaled by 'visitor.scale', and
+    // continuing past each leaf lying under the (scaled) bounds
+    template<class Visitor>
+    void Walk( Int k, Int kLeaf, Int kTop, Int lastNonzero, Visitor& visitor )
+    {
+        const Int n = v_.Height();
+        F* vBuf = v_.Buffer();
+        Int numNodes = 0;
+        while( true )
+        {
+            if( ++numNodes % pollInterval == 0 && visitor.Poll() )
+                return;
+
+            const F entry = d_(k)*(vBuf[k] - centers_(k));
+            const Real partialNorm = SafeNorm( partialNorms_(k+1), entry );
+            partialNorms_(k) = partialNorm;
+            bool moveUp = true;
+            if( partialNorm < visitor.scale*upperBounds_((n-1)-k) )
+            {
+                if( k == kLeaf )
+                {
+                    if( visitor.Leaf( partialNorm, v_ ) )
+                        return;
+                }
+                else
+                {
+                    // Move down the tree
+                    moveUp = false;
+                    --k;
+                    sumIndices_(k) = Max(sumIndices_(k),sumIndices_(k+1));
+
+                          F* s = &partialSums_(0,k);
+                    const F* nBuf = &NTrans_(0,k);
+                    for( Int i=sumIndices_(k+1); i>=k+1; --i )
+                        s[i] = s[i+1] + nBuf[i]*vBuf[i];
+
+                    centers_(k) = -partialSums_(k+1,k);
+                    vBuf[k] = Round(centers_(k));
+                    spiralStates_[k].Initialize( centers_(k) );
+                }
+            }
+            if( moveUp )
+            {
+                // Move up the tree
+                ++k;
+                if( k == kTop+1 )
+                    return;
+                sumIndices_(k) = k; // indicate that (i,j) are not synchronized
+                if( k > lastNonzero )
+                {
+                    // Seed a constrained spiral out from zero
+                    spiralStates_[k].Initialize( true );
+                    vBuf[k] = spiralStates_[k].Step();
+                    lastNonzero = k;
+                }
+                else
+                {
+                    vBuf[k] = spiralStates_[k].Step();
+                }
+            }
+        }
+    }
+};
+
+template<typename F>
+struct Subtree
+{
+    Matrix<F> prefix;
+    Base<F> prefixNorm;
+};
+
+// Records each admissible prefix v(kLeaf:n-1)
+template<typename F>
+struct CollectVisitor
+{
+    Base<F> scale=Base<F>(1);
+    Int kLeaf;
+    vector<Subtree<F>>& subtrees;
+
+    CollectVisitor( Int kLeaf_, vector<Subtree<F>>& subtrees_ )
+    : kLeaf(kLeaf_), subtrees(subtrees_) { }
+
+    bool Leaf( Base<F> partialNorm, const Matrix<F>& v )
+    {
+        Subtree<F> subtree;
+        subtree.prefix = v( IR(kLeaf,END), ALL );
+        subtree.prefixNorm = partialNorm;
+        subtrees.push_back( subtree );
+        return false;
+    }
+
+    bool Poll() { return false; }
+};
+
+// The best lattice member found so far by the workers of this process. The
+// state is guarded by a critical section rather than being atomic since Real
+// may be a multi-word type (e.g., DoubleDouble or BigFloat).
+template<typename F>
+struct SharedBest
+{
+    Base<F> radius;        // over all processes
+    Base<F> localRadius;   // over this process
+    bool found=false;      // by any process
+    bool foundLocal=false; // by this process
+    Matrix<F> v;
+};
+
+template<typename F>
+struct SearchVisitor
+{
+    typedef Base<F> Real;
+    Real scale;
+    Real topBound;
+    bool stopAtFirst;
+    SharedBest<F>& best;
+
+    SearchVisitor
+    ( Real topBound_, bool stopAtFirst_, SharedBest<F>& best_ )
+    : topBound(topBound_), stopAtFirst(stopAtFirst_), best(best_)
+    { Poll(); }
+
+    bool Leaf( Real partialNorm, const Matrix<F>& v )
+    {
+        Real radius;
+#ifdef EL_HYBRID
+        #pragma omp critical(ElParallelEnum)
+#endif
+        {
+            if( partialNorm < best.radius )
+            {
+                best.radius = partialNorm;
+                best.localRadius = partialNorm;
+                best.found = true;
+                best.foundLocal = true;
+                best.v = v;
+            }
+            radius = best.radius;
+        }
+        scale = radius / topBound;
+        return stopAtFirst;
+    }
+
+    bool Poll()
+    {
+        Real radius;
+        bool found;
+#ifdef EL_HYBRID
+        #pragma omp critical(ElParallelEnum)
+#endif
+        {
+            radius = best.radius;
+            found = best.found;
+        }
+        scale = radius / topBound;
+        return stopAtFirst && found;
+    }
+};
+
+template<typename F>
+void SearchSubtree
+( const Matrix<Base<F>>& d,
+  const Matrix<F>& NTrans,
+  const Matrix<Base<F>>& upperBounds,
+  const vector<Subtree<F>>& subtrees,
+        Int t,
+        Int kRoot,
+        bool stopAtFirst,
+        SharedBest<F>& best )
+{
+    const Int n = NTrans.Height();
+    SearchVisitor<F> visitor( upperBounds(n-1), stopAtFirst, best );
+    if( stopAtFirst && best.found )
+        return;
+    SubtreeWalker<F> walker( d, NTrans, upperBounds );
+    if( t == 0 )
+        walker.WalkZeroPrefix( 0, kRoot, visitor );
+    else
+        walker.WalkPrefix
+        ( subtrees[t].prefix, subtrees[t].prefixNorm, kRoot, visitor );
+}
+
+} // namespace par_enum
+
+template<typename F>
+Base<F> ParallelGNREnumeration
+( const Matrix<Base<F>>& d,
+  const Matrix<F>& N,
+  const Matrix<Base<F>>& upperBounds,
+        Matrix<F>& v,
+        bool stopAtFirst,
+  const EnumCtrl<Base<F>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    const Int m = N.Height();
+    const Int n = N.Width();
+    if( n > m )
+        LogicError("Expected height(N) >= width(N)");
+    Zeros( v, n, 1 );
+    if( n == 0 )
+        return Real(0);
+
+    // Unit-stride access is always used
+    Matrix<F> NTrans;
+    Transpose( N, NTrans );
+
+    // Collect the subtrees, with the zero prefix first
+    // ================================================
+    const Int splitDepth = Max( Min( ctrl.splitDepth, n-1 ), Int(0) );
+    const Int kRoot = (n-1) - splitDepth;
+    vector<par_enum::Subtree<F>> subtrees(1);
+    subtrees[0].prefixNorm = Real(0);
+    if( splitDepth > 0 )
+    {
+        par_enum::CollectVisitor<F> collector( kRoot+1, subtrees );
+        par_enum::SubtreeWalker<F> walker( d, NTrans, upperBounds );
+        walker.WalkZeroPrefix( kRoot+1, n-1, collector );
+        std::stable_sort
+        ( subtrees.begin()+1, subtrees.end(),
+          []( const par_enum::Subtree<F>& a, const par_enum::Subtree<F>& b )
+          { return a.prefixNorm < b.prefixNorm; } );
+    }
+    const Int numSubtrees = subtrees.size();
+    if( ctrl.progress )
+        Output
+        ("Split the enumeration tree into ",numSubtrees," subtrees at level ",
+         kRoot);
+
+    // Walk the subtrees in rounds
+    // ===========================
+    const int commRank = ( ctrl.distributed ? mpi::Rank(ctrl.comm) : 0 );
+    const int commSize = ( ctrl.distributed ? mpi::Size(ctrl.comm) : 1 );
+    const Int roundSpan =
+      ( ctrl.distributed ? Max(ctrl.roundSize,Int(1))*commSize : numSubtrees );
+    par_enum::SharedBest<F> best;
+    best.radius = upperBounds(n-1);
+    for( Int roundBeg=0; roundBeg<numSubtrees; roundBeg+=roundSpan )
+    {
+        const Int roundEnd = Min( roundBeg+roundSpan, numSubtrees );
+        vector<Int> localSubtrees;
+        for( Int t=roundBeg; t<roundEnd; ++t )
+            if( t % commSize == commRank )
+                localSubtrees.push_back( t );
+        const Int numLocal = localSubtrees.size();
+#ifdef EL_HYBRID
+        #pragma omp parallel
+        {
+            #pragma omp single
+            {
+                for( Int tLoc=0; tLoc<numLocal; ++tLoc )
+                {
+                    #pragma omp task default(shared) firstprivate(tLoc)
+                    par_enum::SearchSubtree
+                    ( d, NTrans, upperBounds, subtrees, localSubtrees[tLoc],
+                      kRoot, stopAtFirst, best );
+                }
+                #pragma omp taskwait
+            }
+        }
+#else
+        for( Int tLoc=0; tLoc<numLocal; ++tLoc )
+            par_enum::SearchSubtree
+            ( d, NTrans, upperBounds, subtrees, localSubtrees[tLoc],
+              kRoot, stopAtFirst, best );
+#endif
+        if( ctrl.distributed )
+        {
+            best.radius = mpi::AllReduce( best.radius, mpi::MIN, ctrl.comm );
+            best.found =
+              mpi::AllReduce( int(best.found), mpi::MAX, ctrl.comm ) != 0;
+        }
+        if( stopAtFirst && best.found )
+            break;
+    }
+
+    // Gather the best lattice member
+    // ==============================
+    if( !best.found )
+    {
+        // Return an arbitrary value greater than upperBounds(n-1)
+        return 2*upperBounds(n-1)+1;
+    }
+    if( ctrl.distributed )
+    {
+        int owner =
+          ( best.foundLocal && best.localRadius == best.radius ?
+            commRank : commSize );
+        owner = mpi::AllReduce( owner, mpi::MIN, ctrl.comm );
+        if( commRank == owner )
+            v = best.v;
+        mpi::Broadcast( v.Buffer(), n, owner, ctrl.comm );
+        mpi::Broadcast( best.radius, owner, ctrl.comm );
+    }
+    else
+        v = best.v;
+    return best.radius;
+}
+
+} // namespace svp
+
+#define PROTO(F) \
+  template Base<F> svp::ParallelGNREnumeration \
+  ( const Matrix<Base<F>>& d, \
+    const Matrix<F>& N, \
+    const Matrix<Base<F>>& u, \
+          Matrix<F>& v, \
+          bool stopAtFirst, \
+    const EnumCtrl<Base<F>>& ctrl );
+
+#define EL_NO_INT_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
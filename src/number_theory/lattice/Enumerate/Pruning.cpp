@@ -0,0 +1,280 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+#include <random>
+
+// Numerically optimized extreme pruning coefficients in the spirit of
+//
+//   Nicolas Gama, Phong Q. Nguyen, and Oded Regev,
+//   "Lattice Enumeration Using Extreme Pruning",
+//   EUROCRYPT 2010, LNCS 6110, pp. 257--278.
+//
+// The expected cost of a single pruned enumeration is estimated by the
+// (Gaussian heuristic) number of nodes on each level of the tree, whose
+// cylinder-intersection volumes -- and the success probability -- are
+// estimated with a fixed set of uniform samples. The coefficients minimize
+// the expected number of nodes visited per successful trial and are computed
+// once per dimension, for a basis following the Geometric Series Assumption
+// with the root Hermite factor that BKZ of the same blocksize is expected to
+// achieve. They only depend upon the ratio of the bounds to the enumeration
+// radius.
+
+namespace El {
+namespace svp {
+
+namespace {
+
+// The number of uniform samples used to estimate each volume and, since
+// extreme pruning targets small success probabilities, the (larger) number
+// used to estimate the success probability
+const Int numPruningSamples = 512;
+const Int numSuccessSamples = 8192;
+
+class PruningModel
+{
+public:
+    PruningModel( Int n )
+    : n_(n), logNodeScales_(n), levelSamples_(n)
+    {
+        // The root Hermite factor predicted for BKZ with blocksize n, as in
+        // Chen and Nguyen's "BKZ 2.0: Better Lattice Security Estimates"
+        const double pi = Pi<double>();
+        const double nReal = double(n);
+        double logDelta = 0;
+        if( n > 1 )
+            logDelta =
+              (std::log(pi*nReal)/nReal + std::log(nReal/(2*pi)) - 1) /
+              (2*(nReal-1));
+        logDelta = std::max( logDelta, std::log(1.005) );
+
+        // With the normalization vol(L)=1, the GSA profile is
+        // log(d_i) = ((n-1)/2 - i)*(2 log(delta)), and BKZ enumerates within
+        // a radius of (roughly) d_0
+        const double logRadius = (nReal-1)*logDelta;
+        double sumLogProj = 0;
+        for( Int k=1; k<=n; ++k )
+        {
+            const Int i = n-k;
+            sumLogProj += ((nReal-1)/2 - i)*(2*logDelta);
+            const double kReal = double(k);
+            // The log of half of the volume of the k-ball of radius R over
+            // the volume of the projected sublattice
+            logNodeScales_[k-1] =
+              (kReal/2)*std::log(pi) - std::lgamma(kReal/2+1) +
+              kReal*logRadius - sumLogProj - std::log(2.);
+        }
+
+        // For each level, store the cumulative squared fractions of uniform
+        // samples from the unit ball of that dimension; the final level is
+        // instead sampled from the unit sphere for the success probability
+        std::mt19937 generator( 17u*unsigned(n)+1u );
+        std::normal_distribution<double> normal;
+        std::uniform_real_distribution<double> uniform;
+        for( Int k=1; k<=n; ++k )
+        {
+            auto& samples = levelSamples_[k-1];
+            samples.resize( numPruningSamples*k );
+            for( Int s=0; s<numPruningSamples; ++s )
+            {
+                double* sample = &samples[s*k];
+                double sumSquares = 0;
+                for( Int i=0; i<k; ++i )
+                {
+                    const double gauss = normal( generator );
+                    sumSquares += gauss*gauss;
+                    sample[i] = sumSquares;
+                }
+                const double radiusSquared =
+                  std::pow( uniform(generator), 2./double(k) );
+                for( Int i=0; i<k; ++i )
+                    sample[i] *= radiusSquared / sumSquares;
+            }
+        }
+        successSamples_.resize( numSuccessSamples*n );
+        for( Int s=0; s<numSuccessSamples; ++s )
+        {
+            double* sample = &successSamples_[s*n];
+            double sumSquares = 0;
+            for( Int i=0; i<n; ++i )
+            {
+                const double gauss = normal( generator );
+                sumSquares += gauss*gauss;
+                sample[i] = sumSquares;
+            }
+            for( Int i=0; i<n; ++i )
+                sample[i] /= sumSquares;
+        }
+    }
+
+    // The log of the expected number of nodes visited per success for the
+    // nondecreasing (squared, relative) bounds b
+    double LogCost( const vector<double>& b ) const
+    {
+        const Int successes =
+          NumSatisfied
+          ( successSamples_.data(), numSuccessSamples, n_, n_, b, 1 );
+        if( successes == 0 )
+            return std::numeric_limits<double>::infinity();
+        const double logSuccess =
+          std::log(double(successes)/double(numSuccessSamples));
+
+        double numNodes = 0;
+        for( Int k=1; k<=n_; ++k )
+        {
+            // The fraction of the k-ball of radius sqrt(b_{k-1}) which
+            // satisfies the bounds on the previous levels
+            const Int numInside =
+              NumSatisfied
+              ( levelSamples_[k-1].data(), numPruningSamples, k, k-1,
+                b, b[k-1] );
+            if( numInside == 0 )
+                continue;
+            const double logFrac =
+              std::log(double(numInside)/double(numPruningSamples));
+            numNodes +=
+              std::exp
+              ( logNodeScales_[k-1] + (double(k)/2)*std::log(b[k-1]) +
+                logFrac );
+        }
+        return std::log(std::max(numNodes,1.)) - logSuccess;
+    }
+
+private:
+    Int n_;
+    vector<double> logNodeScales_;
+    vector<vector<double>> levelSamples_;
+    vector<double> successSamples_;
+
+    // Count the samples (stored with the given stride) whose cumulative
+    // fractions, scaled by 'scale', lie below the first 'numBounds' bounds
+    Int NumSatisfied
+    ( const double* samples, Int numSamples, Int stride, Int numBounds,
+      const vector<double>& b, double scale ) const
+    {
+        Int count = 0;
+        for( Int s=0; s<numSamples; ++s )
+        {
+            const double* sample = &samples[s*stride];
+            bool satisfied = true;
+            for( Int i=0; i<numBounds; ++i )
+            {
+                if( scale*sample[i] > b[i] )
+                {
+                    satisfied = false;
+                    break;
+                }
+            }
+            if( satisfied )
+                ++count;
+        }
+        return count;
+    }
+};
+
+// Piecewise-linearly interpolate the control points onto n bounds
+void InterpolateBounds
+( const vector<double>& controlPoints, Int n, vector<double>& b )
+{
+    const Int numPoints = controlPoints.size();
+    b.resize( n );
+    for( Int j=0; j<n; ++j )
+    {
+        const double realIndex = (double(j+1)/double(n))*(numPoints-1);
+        const Int floorIndex = Int(std::floor(realIndex));
+        const Int ceilIndex = Min( Int(std::ceil(realIndex)), numPoints-1 );
+        const double frac = realIndex - floorIndex;
+        b[j] = controlPoints[ceilIndex]*frac +
+               controlPoints[floorIndex]*(1-frac);
+    }
+}
+
+vector<double> OptimizePruning( Int n )
+{
+    EL_DEBUG_CSE
+    const Int numPoints = Min(n,Int(16)) + 1;
+    PruningModel model( n );
+
+    // Start from linear pruning
+    vector<double> controlPoints( numPoints );
+    for( Int i=0; i<numPoints; ++i )
+        controlPoints[i] = double(i+1)/double(numPoints);
+
+    vector<double> b;
+    InterpolateBounds( controlPoints, n, b );
+    double logCost = model.LogCost( b );
+    const Int maxSweeps = 100;
+    double step = 0.25;
+    for( Int sweep=0; sweep<maxSweeps && step > 1e-3; ++sweep )
+    {
+        bool improved = false;
+        // The final control point is fixed to one
+        for( Int i=0; i<numPoints-1; ++i )
+        {
+            for( const double factor : { 1-step, 1+step } )
+            {
+                auto candidate( controlPoints );
+                const double lower = ( i == 0 ? 1e-4 : candidate[i-1] );
+                const double upper = candidate[i+1];
+                candidate[i] =
+                  std::min( std::max(candidate[i]*factor,lower), upper );
+                InterpolateBounds( candidate, n, b );
+                const double candidateCost = model.LogCost( b );
+                if( candidateCost < logCost )
+                {
+                    logCost = candidateCost;
+                    controlPoints = candidate;
+                    improved = true;
+                }
+            }
+        }
+        if( !improved )
+            step /= 2;
+    }
+    InterpolateBounds( controlPoints, n, b );
+    return b;
+}
+
+} // anonymous namespace
+
+template<typename Real>
+Matrix<Real> OptimizedPruningCoefficients( Int n )
+{
+    EL_DEBUG_CSE
+    static std::map<Int,vector<double>> cache;
+    vector<double> coefficients;
+#ifdef EL_HYBRID
+    #pragma omp critical(svp_pruning_cache)
+#endif
+    {
+        auto iter = cache.find( n );
+        if( iter == cache.end() )
+            iter = cache.insert( std::make_pair(n,OptimizePruning(n)) ).first;
+        coefficients = iter->second;
+    }
+
+    Matrix<Real> controlBounds( n, 1 );
+    for( Int j=0; j<n; ++j )
+        controlBounds(j) = Real(coefficients[j]);
+    return controlBounds;
+}
+
+} // namespace svp
+
+#define PROTO(Real) \
+  template Matrix<Real> svp::OptimizedPruningCoefficients<Real>( Int n );
+
+#define EL_NO_INT_PROTO
+#define EL_NO_COMPLEX_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
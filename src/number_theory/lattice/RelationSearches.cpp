@@ -0,0 +1,155 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+namespace El {
+
+namespace {
+
+// Reduce each of the bases [I; lastRows(q,:)] owned by this process and
+// return the nullities of all of the queries
+template<typename F>
+vector<Int> RelationSearches
+( const Matrix<F>& lastRows,
+  const RelationCallback<F>& callback,
+  const LLLCtrl<Base<F>>& ctrl,
+        mpi::Comm comm )
+{
+    EL_DEBUG_CSE
+    const Int numQueries = lastRows.Height();
+    const Int n = lastRows.Width();
+    const int commRank = mpi::Rank( comm );
+    const int commSize = mpi::Size( comm );
+    const Int numLocal =
+      ( numQueries > commRank ? (numQueries-commRank-1)/commSize+1 : 0 );
+
+    // The identity portion is shared by every basis of the batch
+    Matrix<F> BTemplate;
+    Identity( BTemplate, n+1, n );
+
+    vector<Int> nullities( numQueries, 0 );
+    std::exception_ptr exception;
+#ifdef EL_HYBRID
+    const bool parallel = IsBlasScalar<Base<F>>::value &&
+      !ctrl.progress && !ctrl.time && numLocal > 1;
+    #pragma omp parallel if(parallel)
+#endif
+    {
+        Matrix<F> B, U, R;
+#ifdef EL_HYBRID
+        #pragma omp for schedule(dynamic)
+#endif
+        for( Int qLoc=0; qLoc<numLocal; ++qLoc )
+        {
+            const Int q = commRank + qLoc*commSize;
+            try
+            {
+                B = BTemplate;
+                auto bLastRow = B( IR(n), ALL );
+                bLastRow = lastRows( IR(q), ALL );
+                auto info = LLL( B, U, R, ctrl );
+                nullities[q] = info.nullity;
+                if( callback )
+                {
+#ifdef EL_HYBRID
+                    #pragma omp critical(relation_search_callback)
+#endif
+                    callback( q, info.nullity, B, U );
+                }
+            }
+            catch( ... )
+            {
+#ifdef EL_HYBRID
+                #pragma omp critical
+#endif
+                {
+                    if( exception == nullptr )
+                        exception = std::current_exception();
+                }
+            }
+        }
+    }
+    if( exception != nullptr )
+        std::rethrow_exception( exception );
+
+    if( commSize > 1 && numQueries > 0 )
+        mpi::AllReduce( nullities.data(), numQueries, comm );
+    return nullities;
+}
+
+} // anonymous namespace
+
+template<typename Field>
+vector<Int> ZDependenceSearches
+( const Matrix<Field>& Z,
+        Base<Field> NSqrt,
+  const RelationCallback<Field>& callback,
+  const LLLCtrl<Base<Field>>& ctrl,
+        mpi::Comm comm )
+{
+    EL_DEBUG_CSE
+    Matrix<Field> lastRows;
+    Transpose( Z, lastRows );
+    Scale( NSqrt, lastRows );
+    return RelationSearches( lastRows, callback, ctrl, comm );
+}
+
+template<typename Field>
+vector<Int> AlgebraicRelationSearches
+( const Matrix<Field>& alphas,
+  Int n,
+  Base<Field> NSqrt,
+  const RelationCallback<Field>& callback,
+  const LLLCtrl<Base<Field>>& ctrl,
+        mpi::Comm comm )
+{
+    EL_DEBUG_CSE
+    if( alphas.Width() != 1 )
+        LogicError("alphas was assumed to be a column vector");
+    const Int numQueries = alphas.Height();
+
+    // Form the scaled powers of each alpha by repeated multiplication
+    // rather than an exponentiation per power
+    Matrix<Field> lastRows( numQueries, n );
+    for( Int q=0; q<numQueries; ++q )
+    {
+        const Field alpha = alphas(q);
+        Field power = NSqrt;
+        for( Int j=0; j<n; ++j )
+        {
+            lastRows(q,j) = power;
+            power *= alpha;
+        }
+    }
+    return RelationSearches( lastRows, callback, ctrl, comm );
+}
+
+#define PROTO(Field) \
+  template vector<Int> ZDependenceSearches \
+  ( const Matrix<Field>& Z, \
+          Base<Field> NSqrt, \
+    const RelationCallback<Field>& callback, \
+    const LLLCtrl<Base<Field>>& ctrl, \
+          mpi::Comm comm ); \
+  template vector<Int> AlgebraicRelationSearches \
+  ( const Matrix<Field>& alphas, \
+    Int n, \
+    Base<Field> NSqrt, \
+    const RelationCallback<Field>& callback, \
+    const LLLCtrl<Base<Field>>& ctrl, \
+          mpi::Comm comm );
+
+#define EL_NO_INT_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
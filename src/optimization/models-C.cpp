@@ -756,7 +756,7 @@ ElError ElSVMCtrlDefault_d( ElSVMCtrl_d* ctrl )
   { EL_TRY( LongOnlyPortfolio( \
       *CReflect(d), *CReflect(F), \
       *CReflect(c), CReflect(gamma), \
-      *CReflect(x), CReflect(ctrl) ) ) } \
+      *CReflect(x), LongOnlyPortfolioCtrl<Real>(CReflect(ctrl)) ) ) } \
   ElError ElLongOnlyPortfolioXDistSparse_ ## SIG \
   ( ElConstDistMultiVec_ ## SIG d, ElConstDistSparseMatrix_ ## SIG F, \
     ElConstDistMultiVec_ ## SIG c, Real gamma, \
@@ -764,7 +764,7 @@ ElError ElSVMCtrlDefault_d( ElSVMCtrl_d* ctrl )
   { EL_TRY( LongOnlyPortfolio( \
       *CReflect(d), *CReflect(F), \
       *CReflect(c), CReflect(gamma), \
-      *CReflect(x), CReflect(ctrl) ) ) }
+      *CReflect(x), LongOnlyPortfolioCtrl<Real>(CReflect(ctrl)) ) ) }
 
 #define C_PROTO_COMPLEX(SIG,SIGBASE,Field) \
   C_PROTO_FIELD(SIG,SIGBASE,Field)
@@ -70,6 +70,54 @@ void BPDN
     bpdn::IPM( A, b, lambda, x, ctrl.ipmCtrl );
 }
 
+template<typename Real>
+void BPDNPath
+( const Matrix<Real>& A,
+  const Matrix<Real>& b,
+        Matrix<Real>& lambdas,
+        Matrix<Real>& X,
+  const RegularizationPathCtrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    ENPath( A, b, lambdas, Real(0), X, ctrl );
+}
+
+template<typename Real>
+void BPDNPath
+( const AbstractDistMatrix<Real>& A,
+  const AbstractDistMatrix<Real>& b,
+        Matrix<Real>& lambdas,
+        AbstractDistMatrix<Real>& X,
+  const RegularizationPathCtrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    ENPath( A, b, lambdas, Real(0), X, ctrl );
+}
+
+template<typename Real>
+void BPDNPath
+( const SparseMatrix<Real>& A,
+  const Matrix<Real>& b,
+        Matrix<Real>& lambdas,
+        Matrix<Real>& X,
+  const RegularizationPathCtrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    ENPath( A, b, lambdas, Real(0), X, ctrl );
+}
+
+template<typename Real>
+void BPDNPath
+( const DistSparseMatrix<Real>& A,
+  const DistMultiVec<Real>& b,
+        Matrix<Real>& lambdas,
+        DistMultiVec<Real>& X,
+  const RegularizationPathCtrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    ENPath( A, b, lambdas, Real(0), X, ctrl );
+}
+
 #define PROTO(Real) \
   template void BPDN \
   ( const Matrix<Real>& A, \
@@ -94,7 +142,31 @@ void BPDN
     const DistMultiVec<Real>& b, \
           Real lambda, \
           DistMultiVec<Real>& x, \
-    const BPDNCtrl<Real>& ctrl );
+    const BPDNCtrl<Real>& ctrl ); \
+  template void BPDNPath \
+  ( const Matrix<Real>& A, \
+      const Matrix<Real>& b, \
+            Matrix<Real>& lambdas, \
+            Matrix<Real>& X, \
+      const RegularizationPathCtrl<Real>& ctrl ); \
+  template void BPDNPath \
+  ( const AbstractDistMatrix<Real>& A, \
+      const AbstractDistMatrix<Real>& b, \
+            Matrix<Real>& lambdas, \
+            AbstractDistMatrix<Real>& X, \
+      const RegularizationPathCtrl<Real>& ctrl ); \
+  template void BPDNPath \
+  ( const SparseMatrix<Real>& A, \
+      const Matrix<Real>& b, \
+            Matrix<Real>& lambdas, \
+            Matrix<Real>& X, \
+      const RegularizationPathCtrl<Real>& ctrl ); \
+  template void BPDNPath \
+  ( const DistSparseMatrix<Real>& A, \
+      const DistMultiVec<Real>& b, \
+            Matrix<Real>& lambdas, \
+            DistMultiVec<Real>& X, \
+      const RegularizationPathCtrl<Real>& ctrl );
 
 #define EL_NO_INT_PROTO
 #define EL_NO_COMPLEX_PROTO
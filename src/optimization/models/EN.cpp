@@ -7,6 +7,7 @@
    http://opensource.org/licenses/BSD-2-Clause
 */
 #include <El.hpp>
+#include "./EN/CoordinateDescent.hpp"
 
 // An elastic net seeks the solution to the optimization problem
 //
@@ -349,6 +350,58 @@ void EN
     x.ProcessQueues();
 }
 
+template<typename Real>
+void ENPath
+( const Matrix<Real>& A,
+  const Matrix<Real>& b,
+        Matrix<Real>& lambdas,
+        Real lambda2,
+        Matrix<Real>& X,
+  const RegularizationPathCtrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    en::CoordinateDescentPath( A, b, lambdas, lambda2, X, ctrl );
+}
+
+template<typename Real>
+void ENPath
+( const AbstractDistMatrix<Real>& A,
+  const AbstractDistMatrix<Real>& b,
+        Matrix<Real>& lambdas,
+        Real lambda2,
+        AbstractDistMatrix<Real>& X,
+  const RegularizationPathCtrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    en::CoordinateDescentPath( A, b, lambdas, lambda2, X, ctrl );
+}
+
+template<typename Real>
+void ENPath
+( const SparseMatrix<Real>& A,
+  const Matrix<Real>& b,
+        Matrix<Real>& lambdas,
+        Real lambda2,
+        Matrix<Real>& X,
+  const RegularizationPathCtrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    en::CoordinateDescentPath( A, b, lambdas, lambda2, X, ctrl );
+}
+
+template<typename Real>
+void ENPath
+( const DistSparseMatrix<Real>& A,
+  const DistMultiVec<Real>& b,
+        Matrix<Real>& lambdas,
+        Real lambda2,
+        DistMultiVec<Real>& X,
+  const RegularizationPathCtrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    en::CoordinateDescentPath( A, b, lambdas, lambda2, X, ctrl );
+}
+
 #define PROTO(Real) \
   template void EN \
   ( const Matrix<Real>& A, \
@@ -377,7 +430,35 @@ void EN
           Real lambda1, \
           Real lambda2, \
           DistMultiVec<Real>& x, \
-    const qp::affine::Ctrl<Real>& ctrl );
+    const qp::affine::Ctrl<Real>& ctrl ); \
+  template void ENPath \
+  ( const Matrix<Real>& A, \
+      const Matrix<Real>& b, \
+            Matrix<Real>& lambdas, \
+            Real lambda2, \
+            Matrix<Real>& X, \
+      const RegularizationPathCtrl<Real>& ctrl ); \
+  template void ENPath \
+  ( const AbstractDistMatrix<Real>& A, \
+      const AbstractDistMatrix<Real>& b, \
+            Matrix<Real>& lambdas, \
+            Real lambda2, \
+            AbstractDistMatrix<Real>& X, \
+      const RegularizationPathCtrl<Real>& ctrl ); \
+  template void ENPath \
+  ( const SparseMatrix<Real>& A, \
+      const Matrix<Real>& b, \
+            Matrix<Real>& lambdas, \
+            Real lambda2, \
+            Matrix<Real>& X, \
+      const RegularizationPathCtrl<Real>& ctrl ); \
+  template void ENPath \
+  ( const DistSparseMatrix<Real>& A, \
+      const DistMultiVec<Real>& b, \
+            Matrix<Real>& lambdas, \
+            Real lambda2, \
+            DistMultiVec<Real>& X, \
+      const RegularizationPathCtrl<Real>& ctrl );
 
 #define EL_NO_INT_PROTO
 #define EL_NO_COMPLEX_PROTO
@@ -0,0 +1,374 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+// Pathwise cyclic coordinate descent [1] for the elastic net
+//
+//   min (1/2) || b - A x ||_2^2 + lambda_1 || x ||_1 + lambda_2 || x ||_2^2,
+//
+// for a decreasing sequence of lambda_1 values. With r = b - A x, the update
+// of coordinate j is
+//
+//   x_j := S(a_j^T r + || a_j ||_2^2 x_j, lambda_1) /
+//          (|| a_j ||_2^2 + 2 lambda_2),
+//
+// where S is the soft-thresholding operator, and the sequential strong
+// rule [2] is used to screen the features for each lambda_1.
+//
+// In the distributed case, each process sweeps over its local features using
+// a local copy of the residual, and the updates are averaged over the
+// processes as in CoCoA (see the dual coordinate descent SVM) so that the
+// iteration reduces to [1] on a single process.
+//
+// [1] Jerome Friedman, Trevor Hastie, and Rob Tibshirani,
+//     "Regularization Paths for Generalized Linear Models via Coordinate
+//     Descent", Journal of Statistical Software, Vol. 33, No. 1, 2010.
+//
+// [2] Robert Tibshirani, Jacob Bien, Jerome Friedman, Trevor Hastie,
+//     Noah Simon, Jonathan Taylor, and Ryan J. Tibshirani,
+//     "Strong rules for discarding predictors in lasso-type problems",
+//     Journal of the Royal Statistical Society: Series B, Vol. 74, No. 2,
+//     2012.
+//
+
+namespace El {
+namespace en {
+
+namespace cd {
+
+// Runs the path over the local features, where 'colDot(jLoc,r)' returns
+// a_j^T r and 'colAxpy(jLoc,alpha,r)' performs r += alpha a_j. The (local)
+// solutions are returned in the columns of XLoc.
+template<typename Real,class DotType,class AxpyType>
+void Path
+( const Matrix<Real>& b,
+        Int localWidth,
+        Matrix<Real>& lambdas,
+        Real lambda2,
+        Matrix<Real>& XLoc,
+  const DotType& colDot,
+  const AxpyType& colAxpy,
+  const RegularizationPathCtrl<Real>& ctrl,
+        mpi::Comm comm )
+{
+    EL_DEBUG_CSE
+    const Int m = b.Height();
+    const Int numProcs = mpi::Size( comm );
+    const Int width = mpi::AllReduce( localWidth, comm );
+    const Real gamma = Real(1) / Real(numProcs);
+    if( lambda2 < Real(0) )
+        LogicError("lambda2 must be non-negative");
+
+    // Compute the squared norms of the columns by scattering each column into
+    // a zero vector and then removing it again
+    Matrix<Real> colNormSq;
+    Zeros( colNormSq, localWidth, 1 );
+    {
+        Matrix<Real> e;
+        Zeros( e, m, 1 );
+        for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+        {
+            colAxpy( jLoc, Real(1), e );
+            colNormSq(jLoc) = colDot( jLoc, e );
+            colAxpy( jLoc, Real(-1), e );
+        }
+    }
+
+    // Start from x = 0, so that r = b and lambda_max = || A^T b ||_oo
+    Matrix<Real> x, r, rLoc, corr;
+    Zeros( x, localWidth, 1 );
+    r = b;
+    Zeros( corr, localWidth, 1 );
+    Real lambdaMax = 0;
+    for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+    {
+        corr(jLoc) = colDot( jLoc, r );
+        lambdaMax = Max( lambdaMax, Abs(corr(jLoc)) );
+    }
+    lambdaMax = mpi::AllReduce( lambdaMax, mpi::MAX, comm );
+    if( lambdas.Height() == 0 )
+    {
+        const Int numLambdas = ctrl.numLambdas;
+        if( numLambdas <= 0 )
+            LogicError("Expected a positive number of lambdas");
+        Zeros( lambdas, numLambdas, 1 );
+        const Real ratio = ( numLambdas == 1 ? Real(1) :
+          Pow( ctrl.lambdaMinRatio, Real(1)/Real(numLambdas-1) ) );
+        Real lambda = lambdaMax;
+        for( Int k=0; k<numLambdas; ++k )
+        {
+            lambdas(k) = lambda;
+            lambda *= ratio;
+        }
+    }
+    const Int numLambdas = lambdas.Height();
+    for( Int k=1; k<numLambdas; ++k )
+        if( lambdas(k) > lambdas(k-1) )
+            LogicError("The lambdas must be in decreasing order");
+    Zeros( XLoc, localWidth, numLambdas );
+
+    const Real bNorm = FrobeniusNorm( b );
+    const Real changeTol = ctrl.tol*bNorm*bNorm;
+    vector<bool> strong( localWidth );
+    Real lambdaPrev = lambdaMax;
+    for( Int k=0; k<numLambdas; ++k )
+    {
+        const Real lambda = lambdas(k);
+        const Real strongTol = 2*lambda - lambdaPrev;
+        for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+            strong[jLoc] = !ctrl.strongRules || x(jLoc) != Real(0) ||
+              Abs(corr(jLoc)) >= strongTol;
+
+        // Sweep over either the screened features or only the nonzero ones
+        // and return the largest estimated change in the objective
+        Int numSweeps = 0;
+        auto sweep = [&]( bool activeOnly )
+          {
+              if( numSweeps == ctrl.maxSweeps )
+                  RuntimeError
+                  ("Coordinate descent did not converge in ",
+                   ctrl.maxSweeps," sweeps for lambda=",lambda);
+              ++numSweeps;
+              rLoc = r;
+              Real maxChange = 0;
+              for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+              {
+                  const Real xOld = x(jLoc);
+                  if( !strong[jLoc] || (activeOnly && xOld == Real(0)) )
+                      continue;
+                  const Real denom = colNormSq(jLoc) + 2*lambda2;
+                  if( denom == Real(0) )
+                      continue;
+                  const Real rho =
+                    colDot( jLoc, rLoc ) + colNormSq(jLoc)*xOld;
+                  const Real xNew = SoftThreshold( rho, lambda ) / denom;
+                  const Real delta = xNew - xOld;
+                  if( delta == Real(0) )
+                      continue;
+                  colAxpy( jLoc, -delta, rLoc );
+                  x(jLoc) = ( numProcs == 1 ? xNew : xOld + gamma*delta );
+                  maxChange = Max( maxChange, colNormSq(jLoc)*delta*delta );
+              }
+              if( numProcs > 1 )
+              {
+                  // Average the updates to the residual
+                  rLoc -= r;
+                  mpi::AllReduce( rLoc.Buffer(), m, comm );
+                  Axpy( gamma, rLoc, r );
+                  maxChange = mpi::AllReduce( maxChange, mpi::MAX, comm );
+              }
+              else
+                  r = rLoc;
+              return maxChange;
+          };
+
+        Int numViolations;
+        do
+        {
+            while( sweep(false) > changeTol )
+            {
+                while( sweep(true) > changeTol ) { }
+            }
+
+            // Check the optimality conditions of the discarded features
+            numViolations = 0;
+            for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+            {
+                corr(jLoc) = colDot( jLoc, r );
+                if( !strong[jLoc] && Abs(corr(jLoc)) > lambda )
+                {
+                    strong[jLoc] = true;
+                    ++numViolations;
+                }
+            }
+            numViolations = mpi::AllReduce( numViolations, comm );
+        } while( numViolations > 0 );
+
+        auto xk = XLoc( ALL, IR(k) );
+        xk = x;
+        if( ctrl.progress )
+        {
+            Int numNonzeros = 0, numStrong = 0;
+            for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+            {
+                if( x(jLoc) != Real(0) )
+                    ++numNonzeros;
+                if( strong[jLoc] )
+                    ++numStrong;
+            }
+            numNonzeros = mpi::AllReduce( numNonzeros, comm );
+            numStrong = mpi::AllReduce( numStrong, comm );
+            OutputFromRoot
+            (comm,"  lambda=",lambda,": ",numSweeps," sweeps, ",numNonzeros,
+             " nonzeros, ",numStrong," of ",width," features screened in");
+        }
+        lambdaPrev = lambda;
+    }
+}
+
+} // namespace cd
+
+template<typename Real>
+void CoordinateDescentPath
+( const Matrix<Real>& A,
+  const Matrix<Real>& b,
+        Matrix<Real>& lambdas,
+        Real lambda2,
+        Matrix<Real>& X,
+  const RegularizationPathCtrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Real* ABuf = A.LockedBuffer();
+    const Int ALDim = A.LDim();
+
+    auto colDot =
+      [&]( Int j, const Matrix<Real>& r )
+      { return blas::Dot( m, &ABuf[j*ALDim], 1, r.LockedBuffer(), 1 ); };
+    auto colAxpy =
+      [&]( Int j, const Real& alpha, Matrix<Real>& r )
+      { blas::Axpy( m, alpha, &ABuf[j*ALDim], 1, r.Buffer(), 1 ); };
+
+    cd::Path
+    ( b, n, lambdas, lambda2, X, colDot, colAxpy, ctrl, mpi::COMM_SELF );
+}
+
+template<typename Real>
+void CoordinateDescentPath
+( const AbstractDistMatrix<Real>& APre,
+  const AbstractDistMatrix<Real>& bPre,
+        Matrix<Real>& lambdas,
+        Real lambda2,
+        AbstractDistMatrix<Real>& X,
+  const RegularizationPathCtrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    // Give each process full columns of A and a full copy of b
+    DistMatrixReadProxy<Real,Real,STAR,VR> AProx( APre );
+    DistMatrixReadProxy<Real,Real,STAR,STAR> bProx( bPre );
+    auto& A = AProx.GetLocked();
+    auto& b = bProx.GetLocked();
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Real* ABuf = A.LockedBuffer();
+    const Int ALDim = A.LDim();
+
+    auto colDot =
+      [&]( Int jLoc, const Matrix<Real>& r )
+      { return blas::Dot( m, &ABuf[jLoc*ALDim], 1, r.LockedBuffer(), 1 ); };
+    auto colAxpy =
+      [&]( Int jLoc, const Real& alpha, Matrix<Real>& r )
+      { blas::Axpy( m, alpha, &ABuf[jLoc*ALDim], 1, r.Buffer(), 1 ); };
+
+    Matrix<Real> XLoc;
+    cd::Path
+    ( b.LockedMatrix(), A.LocalWidth(), lambdas, lambda2, XLoc,
+      colDot, colAxpy, ctrl, A.RowComm() );
+    DistMatrix<Real,VR,STAR> XVR( A.Grid() );
+    XVR.AlignCols( A.RowAlign() );
+    XVR.Resize( n, lambdas.Height() );
+    XVR.Matrix() = XLoc;
+    Copy( XVR, X );
+}
+
+template<typename Real>
+void CoordinateDescentPath
+( const SparseMatrix<Real>& A,
+  const Matrix<Real>& b,
+        Matrix<Real>& lambdas,
+        Real lambda2,
+        Matrix<Real>& X,
+  const RegularizationPathCtrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    // The rows of A^T are the columns of A
+    SparseMatrix<Real> AT;
+    Transpose( A, AT );
+    const Int n = A.Width();
+    const Int* rowBuf = AT.LockedTargetBuffer();
+    const Real* valBuf = AT.LockedValueBuffer();
+
+    auto colDot =
+      [&]( Int j, const Matrix<Real>& r )
+      {
+          const Int offset = AT.RowOffset( j );
+          const Int numConn = AT.NumConnections( j );
+          Real value = 0;
+          for( Int e=offset; e<offset+numConn; ++e )
+              value += valBuf[e]*r(rowBuf[e]);
+          return value;
+      };
+    auto colAxpy =
+      [&]( Int j, const Real& alpha, Matrix<Real>& r )
+      {
+          const Int offset = AT.RowOffset( j );
+          const Int numConn = AT.NumConnections( j );
+          for( Int e=offset; e<offset+numConn; ++e )
+              r(rowBuf[e]) += alpha*valBuf[e];
+      };
+
+    cd::Path
+    ( b, n, lambdas, lambda2, X, colDot, colAxpy, ctrl, mpi::COMM_SELF );
+}
+
+template<typename Real>
+void CoordinateDescentPath
+( const DistSparseMatrix<Real>& A,
+  const DistMultiVec<Real>& b,
+        Matrix<Real>& lambdas,
+        Real lambda2,
+        DistMultiVec<Real>& X,
+  const RegularizationPathCtrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    const Int n = A.Width();
+    const Grid& grid = A.Grid();
+
+    // The rows of A^T are the columns of A and are distributed in the same
+    // manner as the rows of X
+    DistSparseMatrix<Real> AT(grid);
+    Transpose( A, AT );
+    const Int* rowBuf = AT.LockedTargetBuffer();
+    const Real* valBuf = AT.LockedValueBuffer();
+
+    // Give each process a full copy of b
+    DistMatrix<Real,STAR,STAR> b_STAR_STAR(grid);
+    Copy( b, b_STAR_STAR );
+
+    auto colDot =
+      [&]( Int jLoc, const Matrix<Real>& r )
+      {
+          const Int offset = AT.RowOffset( jLoc );
+          const Int numConn = AT.NumConnections( jLoc );
+          Real value = 0;
+          for( Int e=offset; e<offset+numConn; ++e )
+              value += valBuf[e]*r(rowBuf[e]);
+          return value;
+      };
+    auto colAxpy =
+      [&]( Int jLoc, const Real& alpha, Matrix<Real>& r )
+      {
+          const Int offset = AT.RowOffset( jLoc );
+          const Int numConn = AT.NumConnections( jLoc );
+          for( Int e=offset; e<offset+numConn; ++e )
+              r(rowBuf[e]) += alpha*valBuf[e];
+      };
+
+    Matrix<Real> XLoc;
+    cd::Path
+    ( b_STAR_STAR.LockedMatrix(), AT.LocalHeight(), lambdas, lambda2, XLoc,
+      colDot, colAxpy, ctrl, grid.Comm() );
+    X.SetGrid( grid );
+    X.Resize( n, lambdas.Height() );
+    X.Matrix() = XLoc;
+}
+
+} // namespace en
+} // namespace El
@@ -7,6 +7,7 @@
    http://opensource.org/licenses/BSD-2-Clause
 */
 #include <El.hpp>
+#include "./LongOnlyPortfolio/FactorIPM.hpp"
 
 namespace El {
 
@@ -72,10 +73,16 @@ void LongOnlyPortfolio
   const Matrix<Real>& c,
         Real gamma,
         Matrix<Real>& x,
-  const socp::affine::Ctrl<Real>& ctrl )
+  const LongOnlyPortfolioCtrl<Real>& ctrl )
 {
     EL_DEBUG_CSE
     const Int n = c.Height();
+    if( ctrl.approach == LONG_ONLY_PORTFOLIO_FACTOR_IPM )
+    {
+        long_only_portfolio::FactorIPM
+        ( d, F, c, gamma, x, ctrl, mpi::COMM_SELF );
+        return;
+    }
 
     // TODO(poulson): Expose this as a control parameter
     const bool useSOCP = true;
@@ -190,7 +197,9 @@ void LongOnlyPortfolio
         // Solve the Second-Order Cone problem
         // ===================================
         Matrix<Real> xHat, y, z, s;
-        SOCP( A, G, b, cHat, h, orders, firstInds, xHat, y, z, s, ctrl );
+        SOCP
+        ( A, G, b, cHat, h, orders, firstInds, xHat, y, z, s,
+          ctrl.socpCtrl );
 
         // Extract x from [x; t; s; u; v]
         // ==============================
@@ -213,12 +222,21 @@ void LongOnlyPortfolio
   const DistMultiVec<Real>& c,
         Real gamma,
         DistMultiVec<Real>& x,
-  const socp::affine::Ctrl<Real>& ctrl )
+  const LongOnlyPortfolioCtrl<Real>& ctrl )
 {
     EL_DEBUG_CSE
     const Int n = c.Height();
     const Grid& grid = c.Grid();
     const int commRank = grid.Rank(); 
+    if( ctrl.approach == LONG_ONLY_PORTFOLIO_FACTOR_IPM )
+    {
+        x.SetGrid( grid );
+        x.Resize( n, 1 );
+        long_only_portfolio::FactorIPM
+        ( d.LockedMatrix(), F, c.LockedMatrix(), gamma, x.Matrix(), ctrl,
+          grid.Comm() );
+        return;
+    }
 
     // TODO(poulson): Expose this as a control parameter
     const bool useSOCP = true;
@@ -414,7 +432,9 @@ void LongOnlyPortfolio
         // Solve the Second-Order Cone problem
         // ===================================
         DistMultiVec<Real> xHat(grid), y(grid), z(grid), s(grid);
-        SOCP( A, G, b, cHat, h, orders, firstInds, xHat, y, z, s, ctrl );
+        SOCP
+        ( A, G, b, cHat, h, orders, firstInds, xHat, y, z, s,
+          ctrl.socpCtrl );
 
         // Extract x from [x; t; s; u; v]
         // ==============================
@@ -449,14 +469,14 @@ void LongOnlyPortfolio
     const Matrix<Real>& c, \
           Real gamma, \
           Matrix<Real>& x, \
-    const socp::affine::Ctrl<Real>& ctrl ); \
+    const LongOnlyPortfolioCtrl<Real>& ctrl ); \
   template void LongOnlyPortfolio \
   ( const DistMultiVec<Real>& d, \
     const DistSparseMatrix<Real>& F, \
     const DistMultiVec<Real>& c, \
           Real gamma, \
           DistMultiVec<Real>& x, \
-    const socp::affine::Ctrl<Real>& ctrl );
+    const LongOnlyPortfolioCtrl<Real>& ctrl );
 
 #define EL_NO_INT_PROTO
 #define EL_NO_COMPLEX_PROTO
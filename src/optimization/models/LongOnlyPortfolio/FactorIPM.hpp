@@ -0,0 +1,250 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+// A Mehrotra predictor-corrector IPM for the long-only portfolio problem
+//
+//   min (1/2) x^T Q x + q^T x,
+//   s.t. 1^T x = 1, x >= 0,
+//
+// with Q = 2 gamma (D + F F^T) and q = -c, whose dual variables (y,z) satisfy
+// Q x + 1 y - z + q = 0, z >= 0. Eliminating dz from the Newton system yields
+//
+//   | Q + inv(X) Z  1 | | dx | = | g |,
+//   |     1^T       0 | | dy |   | h |
+//
+// and, with Delta = 2 gamma D + inv(X) Z and G = sqrt(2 gamma) F, the
+// Sherman-Morrison-Woodbury formula provides
+//
+//   inv(Delta + G G^T) = inv(Delta) - inv(Delta) G inv(C) G^T inv(Delta),
+//
+// where C = I + G^T inv(Delta) G is only k x k. The single equality constraint
+// is then eliminated via dy = (1^T u - h) / (1^T w), dx = u - w dy, where
+// u = inv(Q + inv(X) Z) g and w = inv(Q + inv(X) Z) 1.
+//
+// The iteration only needs the local rows of D, F, and c (and sums over the
+// processes), so the distributed version forms C from the local rows of F and
+// then redundantly factors it on each process.
+//
+
+namespace El {
+namespace long_only_portfolio {
+
+// 'F' should be either a SparseMatrix or a DistSparseMatrix and have its
+// local rows aligned with those of 'dLoc' and 'cLoc'
+template<typename Real,class SparseMatrixType>
+void FactorIPM
+( const Matrix<Real>& dLoc,
+  const SparseMatrixType& F,
+  const Matrix<Real>& cLoc,
+        Real gamma,
+        Matrix<Real>& xLoc,
+  const LongOnlyPortfolioCtrl<Real>& ctrl,
+        mpi::Comm comm )
+{
+    EL_DEBUG_CSE
+    const Int localHeight = dLoc.Height();
+    const Int n = mpi::AllReduce( localHeight, comm );
+    const Int k = F.Width();
+    const Int* colBuf = F.LockedTargetBuffer();
+    const Real* valBuf = F.LockedValueBuffer();
+    if( gamma <= Real(0) )
+        LogicError("The risk-aversion parameter must be positive");
+
+    auto sum =
+      [&]( const Matrix<Real>& v, const Matrix<Real>& w )
+      { return mpi::AllReduce( Dot(v,w), comm ); };
+    // t := F^T v (summed over the processes)
+    auto adjointMultiply =
+      [&]( const Matrix<Real>& v, Matrix<Real>& t )
+      {
+          Zeros( t, k, 1 );
+          for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+          {
+              const Int offset = F.RowOffset( iLoc );
+              const Int numConn = F.NumConnections( iLoc );
+              for( Int e=offset; e<offset+numConn; ++e )
+                  t(colBuf[e]) += valBuf[e]*v(iLoc);
+          }
+          mpi::AllReduce( t.Buffer(), k, comm );
+      };
+    // v := v + alpha F t
+    auto multiply =
+      [&]( Real alpha, const Matrix<Real>& t, Matrix<Real>& v )
+      {
+          for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+          {
+              const Int offset = F.RowOffset( iLoc );
+              const Int numConn = F.NumConnections( iLoc );
+              Real value = 0;
+              for( Int e=offset; e<offset+numConn; ++e )
+                  value += valBuf[e]*t(colBuf[e]);
+              v(iLoc) += alpha*value;
+          }
+      };
+    // v := Q x + q
+    Matrix<Real> t;
+    auto gradient =
+      [&]( const Matrix<Real>& x, Matrix<Real>& v )
+      {
+          adjointMultiply( x, t );
+          Zeros( v, localHeight, 1 );
+          multiply( 2*gamma, t, v );
+          for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+              v(iLoc) += 2*gamma*dLoc(iLoc)*x(iLoc) - cLoc(iLoc);
+      };
+    // The largest step length in [0,1] keeping v + alpha dv non-negative
+    auto maxStep =
+      [&]( const Matrix<Real>& v, const Matrix<Real>& dv )
+      {
+          Real alpha = 1;
+          for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+              if( dv(iLoc) < Real(0) )
+                  alpha = Min( alpha, -v(iLoc)/dv(iLoc) );
+          return mpi::AllReduce( alpha, mpi::MIN, comm );
+      };
+
+    // Start from the feasible point x = 1/n and choose y so that z = Q x + q
+    // + 1 y is strictly positive
+    Matrix<Real> z, rd;
+    Zeros( xLoc, localHeight, 1 );
+    Fill( xLoc, Real(1)/Real(n) );
+    gradient( xLoc, z );
+    Real zMin = limits::Max<Real>(), zMax = 0;
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+    {
+        zMin = Min( zMin, z(iLoc) );
+        zMax = Max( zMax, Abs(z(iLoc)) );
+    }
+    zMin = mpi::AllReduce( zMin, mpi::MIN, comm );
+    zMax = mpi::AllReduce( zMax, mpi::MAX, comm );
+    Real y = Max(zMax,Real(1)) - zMin;
+    Shift( z, y );
+    const Real cNorm = Sqrt( sum(cLoc,cLoc) );
+
+    Matrix<Real> invDelta, C, w, g, dx, dz, dxAff, dzAff, ones, rmu;
+    Ones( ones, localHeight, 1 );
+    // v := inv(Q + inv(X) Z) v using the factored capacitance matrix
+    auto solve =
+      [&]( Matrix<Real>& v )
+      {
+          for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+              v(iLoc) *= invDelta(iLoc);
+          adjointMultiply( v, t );
+          t *= 2*gamma;
+          cholesky::SolveAfter( LOWER, NORMAL, C, t );
+          Matrix<Real> s;
+          Zeros( s, localHeight, 1 );
+          multiply( Real(-1), t, s );
+          for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+              v(iLoc) += invDelta(iLoc)*s(iLoc);
+      };
+    // Solve for (dx,dy,dz) given the complementarity residual rmu
+    auto newton =
+      [&]( Real rp, Matrix<Real>& dxNew, Real& dy, Matrix<Real>& dzNew )
+      {
+          // g := -rd - inv(X) rmu
+          Zeros( g, localHeight, 1 );
+          for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+              g(iLoc) = -rd(iLoc) - rmu(iLoc)/xLoc(iLoc);
+          solve( g );
+          dy = (sum(ones,g) + rp) / sum(ones,w);
+          dxNew = g;
+          Axpy( -dy, w, dxNew );
+          // dz := inv(X) (-rmu - Z dx)
+          Zeros( dzNew, localHeight, 1 );
+          for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+              dzNew(iLoc) =
+                (-rmu(iLoc) - z(iLoc)*dxNew(iLoc)) / xLoc(iLoc);
+      };
+
+    Int numIts = 0;
+    while( true )
+    {
+        // Compute the residuals and check for convergence
+        gradient( xLoc, rd );
+        const Real primalObj = (sum(xLoc,rd) + sum(cLoc,xLoc))/2 -
+          sum(cLoc,xLoc);
+        Shift( rd, y );
+        rd -= z;
+        const Real rp = sum(ones,xLoc) - Real(1);
+        const Real gap = sum(xLoc,z);
+        const Real mu = gap / Real(n);
+        const Real rdNorm = Sqrt( sum(rd,rd) );
+        const Real relGap = gap / (1+Abs(primalObj));
+        const Real dualRes = rdNorm / (1+cNorm);
+        if( ctrl.print )
+            OutputFromRoot
+            (comm,"iter ",numIts,": primal=",primalObj,", |1^T x - 1|=",
+             Abs(rp),", ||r_d||_2/(1+||c||_2)=",dualRes,
+             ", relative gap=",relGap);
+        if( Abs(rp) <= ctrl.targetTol && dualRes <= ctrl.targetTol &&
+            relGap <= ctrl.targetTol )
+            break;
+        if( numIts == ctrl.maxIts )
+            RuntimeError
+            ("Maximum number of iterations (",ctrl.maxIts,") exceeded");
+
+        // Form inv(Delta) and factor the capacitance matrix
+        // C = I + 2 gamma F^T inv(Delta) F
+        Zeros( invDelta, localHeight, 1 );
+        for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+            invDelta(iLoc) = 1/(2*gamma*dLoc(iLoc) + z(iLoc)/xLoc(iLoc));
+        Zeros( C, k, k );
+        for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+        {
+            const Int offset = F.RowOffset( iLoc );
+            const Int numConn = F.NumConnections( iLoc );
+            const Real scale = 2*gamma*invDelta(iLoc);
+            for( Int e0=offset; e0<offset+numConn; ++e0 )
+                for( Int e1=offset; e1<offset+numConn; ++e1 )
+                    if( colBuf[e0] >= colBuf[e1] )
+                        C(colBuf[e0],colBuf[e1]) +=
+                          scale*valBuf[e0]*valBuf[e1];
+        }
+        mpi::AllReduce( C.Buffer(), k*k, comm );
+        ShiftDiagonal( C, Real(1) );
+        Cholesky( LOWER, C );
+
+        // w := inv(Q + inv(X) Z) 1
+        w = ones;
+        solve( w );
+
+        // Compute the affine (predictor) direction
+        Real dyAff;
+        rmu = xLoc;
+        DiagonalScale( LEFT, NORMAL, z, rmu );
+        newton( rp, dxAff, dyAff, dzAff );
+        const Real alphaAffPri = maxStep( xLoc, dxAff );
+        const Real alphaAffDual = maxStep( z, dzAff );
+        Real muAff = 0;
+        for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+            muAff += (xLoc(iLoc)+alphaAffPri*dxAff(iLoc))*
+                     (z(iLoc)+alphaAffDual*dzAff(iLoc));
+        muAff = mpi::AllReduce( muAff, comm ) / Real(n);
+        const Real sigma = Min( Pow(muAff/mu,Real(3)), Real(1) );
+
+        // Compute the combined (predictor-corrector) direction
+        Real dy;
+        for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+            rmu(iLoc) += dxAff(iLoc)*dzAff(iLoc) - sigma*mu;
+        newton( rp, dx, dy, dz );
+        const Real alphaPri =
+          Min( ctrl.maxStepRatio*maxStep(xLoc,dx), Real(1) );
+        const Real alphaDual =
+          Min( ctrl.maxStepRatio*maxStep(z,dz), Real(1) );
+        Axpy( alphaPri, dx, xLoc );
+        Axpy( alphaDual, dz, z );
+        y += alphaDual*dy;
+        ++numIts;
+    }
+}
+
+} // namespace long_only_portfolio
+} // namespace El
@@ -14,6 +14,113 @@ namespace El {
 // Better convergence criterions. E.g., accept a relative tolerance in addition
 // to the maximum number of iterations.
 
+namespace nmf {
+
+// A single HALS sweep over the columns of the nonnegative factor X for the
+// problem min || X B^H - C ||_F, given P = C B and G = B^H B, i.e.,
+//
+//   X(:,j) := max( X(:,j) + (P(:,j) - X G(:,j)) / G(j,j), 0 )
+//
+// for j=0,1,...,r-1. Since each update of row i of X only involves row i, the
+// rows are swept independently (and in parallel).
+template<typename Real>
+void HALSSweep( Matrix<Real>& X, const Matrix<Real>& P, const Matrix<Real>& G )
+{
+    EL_DEBUG_CSE
+    const Int m = X.Height();
+    const Int r = X.Width();
+    Real* XBuf = X.Buffer();
+    const Real* PBuf = P.LockedBuffer();
+    const Real* GBuf = G.LockedBuffer();
+    const Int XLDim = X.LDim();
+    const Int PLDim = P.LDim();
+    const Int GLDim = G.LDim();
+    EL_PARALLEL_FOR
+    for( Int i=0; i<m; ++i )
+    {
+        for( Int j=0; j<r; ++j )
+        {
+            const Real delta = GBuf[j+j*GLDim];
+            if( delta <= Real(0) )
+                continue;
+            Real gamma = PBuf[i+j*PLDim];
+            for( Int l=0; l<r; ++l )
+                gamma -= XBuf[i+l*XLDim]*GBuf[l+j*GLDim];
+            XBuf[i+j*XLDim] = Max( XBuf[i+j*XLDim]+gamma/delta, Real(0) );
+        }
+    }
+}
+
+template<typename Real>
+void HALS
+( const Matrix<Real>& A,
+        Matrix<Real>& X,
+        Matrix<Real>& Y,
+  const NMFCtrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    Zeros( Y, A.Width(), X.Width() );
+    Matrix<Real> P, G;
+    for( Int iter=0; iter<ctrl.maxIter; ++iter )
+    {
+        // A^H ~= Y X^H
+        Gemm( ADJOINT, NORMAL, Real(1), A, X, P );
+        Gemm( ADJOINT, NORMAL, Real(1), X, X, G );
+        HALSSweep( Y, P, G );
+
+        // A ~= X Y^H
+        Gemm( NORMAL, NORMAL, Real(1), A, Y, P );
+        Gemm( ADJOINT, NORMAL, Real(1), Y, Y, G );
+        HALSSweep( X, P, G );
+    }
+}
+
+// The factors are swept in a [VC,STAR] distribution so that each process
+// owns entire rows and the sweeps require no communication
+template<typename Real>
+void HALS
+( const DistMatrix<Real>& A,
+        DistMatrix<Real>& X,
+        DistMatrix<Real>& Y,
+  const NMFCtrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    const Grid& g = A.Grid();
+    const Int r = X.Width();
+    Zeros( Y, A.Width(), r );
+
+    DistMatrix<Real> P(g);
+    DistMatrix<Real,VC,STAR> X_VC_STAR( X ), Y_VC_STAR( Y ), P_VC_STAR(g);
+    DistMatrix<Real,STAR,STAR> G(g);
+    auto formGram =
+      [&]( const DistMatrix<Real,VC,STAR>& B )
+      {
+          Zeros( G, r, r );
+          LocalGemm( ADJOINT, NORMAL, Real(1), B, B, Real(0), G );
+          El::AllReduce( G, B.ColComm() );
+      };
+    for( Int iter=0; iter<ctrl.maxIter; ++iter )
+    {
+        // A^H ~= Y X^H
+        Gemm( ADJOINT, NORMAL, Real(1), A, X, P );
+        P_VC_STAR = P;
+        formGram( X_VC_STAR );
+        HALSSweep( Y_VC_STAR.Matrix(), P_VC_STAR.LockedMatrix(),
+                   G.LockedMatrix() );
+        Y = Y_VC_STAR;
+
+        // A ~= X Y^H
+        Gemm( NORMAL, NORMAL, Real(1), A, Y, P );
+        P_VC_STAR = P;
+        formGram( Y_VC_STAR );
+        HALSSweep( X_VC_STAR.Matrix(), P_VC_STAR.LockedMatrix(),
+                   G.LockedMatrix() );
+        X = X_VC_STAR;
+    }
+}
+
+} // namespace nmf
+
 template<typename Real>
 void NMF
 ( const Matrix<Real>& A,
@@ -22,6 +129,11 @@ void NMF
   const NMFCtrl<Real>& ctrl )
 {
     EL_DEBUG_CSE
+    if( ctrl.approach == NMF_HALS )
+    {
+        nmf::HALS( A, X, Y, ctrl );
+        return;
+    }
 
     Matrix<Real> AAdj, XAdj, YAdj;
     Adjoint( A, AAdj );
@@ -53,6 +165,11 @@ void NMF
     auto& A = AProx.GetLocked();
     auto& X = XProx.Get();
     auto& Y = YProx.Get();
+    if( ctrl.approach == NMF_HALS )
+    {
+        nmf::HALS( A, X, Y, ctrl );
+        return;
+    }
 
     DistMatrix<Real> AAdj(A.Grid()), XAdj(A.Grid()), YAdj(A.Grid());
     Adjoint( A, AAdj );
@@ -10,6 +10,7 @@
 #include "./NNLS/SOCP.hpp"
 #include "./NNLS/QP.hpp"
 #include "./NNLS/ADMM.hpp"
+#include "./NNLS/ActiveSet.hpp"
 
 namespace El {
 
@@ -42,6 +43,13 @@ namespace El {
 // Note that the matrix A^T A is cached amongst all instances
 // (and this caching is the reason NNLS supports X and B as matrices).
 //
+// Active-set formulation
+// ----------------------
+//
+// Solve the same QP via the method of Lawson and Hanson, which maintains a
+// Cholesky factorization of the principal submatrix of the cached A^T A
+// corresponding to the passive (free) variables through up/downdates.
+//
 
 template<typename Real>
 void NNLS
@@ -55,6 +63,8 @@ void NNLS
         nnls::SOCP( A, B, X, ctrl.socpCtrl );
     else if( ctrl.approach == NNLS_QP )
         nnls::QP( A, B, X, ctrl.qpCtrl );
+    else if( ctrl.approach == NNLS_ACTIVE_SET )
+        nnls::ActiveSet( A, B, X, ctrl );
     else
         nnls::ADMM( A, B, X, ctrl.admmCtrl );
 }
@@ -71,6 +81,8 @@ void NNLS
         nnls::SOCP( A, B, X, ctrl.socpCtrl );
     else if( ctrl.approach == NNLS_QP )
         nnls::QP( A, B, X, ctrl.qpCtrl );
+    else if( ctrl.approach == NNLS_ACTIVE_SET )
+        nnls::ActiveSet( A, B, X, ctrl );
     else
         nnls::ADMM( A, B, X, ctrl.admmCtrl );
 }
@@ -87,6 +99,8 @@ void NNLS
         nnls::SOCP( A, B, X, ctrl.socpCtrl );
     else if( ctrl.approach == NNLS_QP )
         nnls::QP( A, B, X, ctrl.qpCtrl );
+    else if( ctrl.approach == NNLS_ACTIVE_SET )
+        nnls::ActiveSet( A, B, X, ctrl );
     else
         LogicError("ADMM NNLS not yet supported for sparse matrices");
 }
@@ -103,6 +117,8 @@ void NNLS
         nnls::SOCP( A, B, X, ctrl.socpCtrl );
     else if( ctrl.approach == NNLS_QP )
         nnls::QP( A, B, X, ctrl.qpCtrl );
+    else if( ctrl.approach == NNLS_ACTIVE_SET )
+        nnls::ActiveSet( A, B, X, ctrl );
     else
         LogicError("ADMM NNLS not yet supported for sparse matrices");
 }
@@ -0,0 +1,315 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+// Solve each problem
+//
+//   min (1/2) x^T G x - h^T x
+//   s.t. x >= 0,
+//
+// where G = A^T A and h = A^T b, via the active-set method of Lawson and
+// Hanson [1]. Variables are moved into the passive set P one at a time (in
+// order of their most positive dual value, w = h - G x) and the unconstrained
+// least-squares solution over P is computed from a lower Cholesky factor of
+// G(P,P). Rather than refactoring G(P,P) each time P changes, the factor is
+// bordered when an index is added and, when the index in position p is
+// removed, the trailing factor is updated via
+//
+//   L33 L33^T := L33 L33^T + l32 l32^T
+//
+// using CholeskyMod, where l32 was the subdiagonal of column p.
+//
+// The Gram matrix G and the products A^T B are formed once and shared amongst
+// all of the right-hand sides.
+//
+// [1] Charles L. Lawson and Richard J. Hanson, "Solving Least Squares
+//     Problems", SIAM Classics in Applied Mathematics, Chapter 23, 1995.
+//
+
+namespace El {
+namespace nnls {
+
+namespace active_set {
+
+template<typename Real>
+void Solve
+( const Matrix<Real>& G,
+  const Matrix<Real>& h,
+        Matrix<Real>& x,
+  const NNLSCtrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    const Int n = G.Height();
+    const Real eps = limits::Epsilon<Real>();
+    Zeros( x, n, 1 );
+    const Real hMax = MaxNorm( h );
+    if( hMax == Real(0) )
+        return;
+    const Real tol = ctrl.activeSetTol*hMax;
+
+    // The passive set is stored in the order of the rows of its factor
+    vector<Int> passive;
+    vector<bool> inPassive(n,false), blocked(n,false);
+    Matrix<Real> L, l, s, T, v;
+    Zeros( L, n, n );
+
+    // Border the factor of G(P,P) with the index j, returning false if the
+    // resulting matrix would be numerically singular
+    auto addIndex =
+      [&]( Int j )
+      {
+          const Int q = passive.size();
+          Zeros( l, q, 1 );
+          for( Int k=0; k<q; ++k )
+              l(k) = G(passive[k],j);
+          if( q > 0 )
+              Trsv( LOWER, NORMAL, NON_UNIT, L(IR(0,q),IR(0,q)), l );
+          const Real delta = G(j,j) - Dot(l,l);
+          if( delta <= eps*G(j,j) )
+              return false;
+          for( Int k=0; k<q; ++k )
+              L(q,k) = l(k);
+          L(q,q) = Sqrt(delta);
+          passive.push_back( j );
+          inPassive[j] = true;
+          return true;
+      };
+    // Remove the index in position p of the passive set
+    auto removePosition =
+      [&]( Int p )
+      {
+          const Int q = passive.size();
+          const Int numTrail = q-(p+1);
+          if( numTrail > 0 )
+          {
+              T = L( IR(p+1,q), IR(p+1,q) );
+              v = L( IR(p+1,q), IR(p) );
+              CholeskyMod( LOWER, T, Real(1), v );
+              for( Int i=p+1; i<q; ++i )
+                  for( Int k=0; k<p; ++k )
+                      L(i-1,k) = L(i,k);
+              for( Int k=0; k<numTrail; ++k )
+                  for( Int i=k; i<numTrail; ++i )
+                      L(p+i,p+k) = T(i,k);
+          }
+          for( Int k=0; k<q; ++k )
+              L(q-1,k) = 0;
+          inPassive[passive[p]] = false;
+          passive.erase( passive.begin()+p );
+          // The removal can make previously dependent columns independent
+          blocked.assign( n, false );
+      };
+    // s := inv(G(P,P)) h(P)
+    auto solvePassive =
+      [&]()
+      {
+          const Int q = passive.size();
+          Zeros( s, q, 1 );
+          for( Int k=0; k<q; ++k )
+              s(k) = h(passive[k]);
+          cholesky::SolveAfter( LOWER, NORMAL, L(IR(0,q),IR(0,q)), s );
+      };
+
+    Matrix<Real> w( h );
+    const Int maxAdditions = 3*n;
+    Int numAdditions = 0;
+    while( true )
+    {
+        // Find the largest dual value outside of the passive set
+        Int jMax = -1;
+        Real wMax = tol;
+        for( Int j=0; j<n; ++j )
+        {
+            if( !inPassive[j] && !blocked[j] && w(j) > wMax )
+            {
+                jMax = j;
+                wMax = w(j);
+            }
+        }
+        if( jMax < 0 )
+            break;
+        if( numAdditions == maxAdditions )
+            RuntimeError
+            ("Active-set NNLS did not converge within ",maxAdditions,
+             " additions to the passive set");
+        ++numAdditions;
+        if( !addIndex( jMax ) )
+        {
+            blocked[jMax] = true;
+            continue;
+        }
+
+        bool firstSolve = true;
+        while( true )
+        {
+            solvePassive();
+            const Int q = passive.size();
+            if( firstSolve && s(q-1) <= Real(0) )
+            {
+                // The dual value of the new index was spurious
+                removePosition( q-1 );
+                blocked[jMax] = true;
+                break;
+            }
+            firstSolve = false;
+
+            // Step towards s until the first passive variable hits zero
+            Real alpha = 1;
+            Int kMin = -1;
+            for( Int k=0; k<q; ++k )
+            {
+                if( s(k) <= Real(0) )
+                {
+                    const Real xk = x(passive[k]);
+                    const Real ratio = xk / (xk-s(k));
+                    if( kMin < 0 || ratio < alpha )
+                    {
+                        alpha = ratio;
+                        kMin = k;
+                    }
+                }
+            }
+            if( kMin < 0 )
+            {
+                for( Int k=0; k<q; ++k )
+                    x(passive[k]) = s(k);
+                break;
+            }
+            for( Int k=0; k<q; ++k )
+            {
+                Real& xk = x(passive[k]);
+                xk += alpha*(s(k)-xk);
+            }
+            x(passive[kMin]) = 0;
+            for( Int k=q-1; k>=0; --k )
+            {
+                if( x(passive[k]) <= Real(0) )
+                {
+                    x(passive[k]) = 0;
+                    removePosition( k );
+                }
+            }
+            if( passive.empty() )
+                break;
+        }
+
+        // w := h - G x
+        w = h;
+        Gemv( NORMAL, Real(-1), G, x, Real(1), w );
+    }
+}
+
+// Solve the problem for each column of H, given the full Gram matrix G.
+// X must already be of the same size as H.
+template<typename Real>
+void Batch
+( const Matrix<Real>& G,
+  const Matrix<Real>& H,
+        Matrix<Real>& X,
+  const NNLSCtrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    for( Int j=0; j<H.Width(); ++j )
+    {
+        auto x = X( ALL, IR(j) );
+        Solve( G, H(ALL,IR(j)), x, ctrl );
+    }
+}
+
+} // namespace active_set
+
+template<typename Real>
+void ActiveSet
+( const Matrix<Real>& A,
+  const Matrix<Real>& B,
+        Matrix<Real>& X,
+  const NNLSCtrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    Matrix<Real> G, H;
+    Herk( LOWER, ADJOINT, Real(1), A, G );
+    MakeHermitian( LOWER, G );
+    Gemm( ADJOINT, NORMAL, Real(1), A, B, H );
+    X.Resize( A.Width(), B.Width() );
+    active_set::Batch( G, H, X, ctrl );
+}
+
+template<typename Real>
+void ActiveSet
+( const AbstractDistMatrix<Real>& A,
+  const AbstractDistMatrix<Real>& B,
+        AbstractDistMatrix<Real>& X,
+  const NNLSCtrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    // Replicate the Gram matrix so that each process can independently solve
+    // the problems for its local columns of A^T B
+    const Grid& g = A.Grid();
+    DistMatrix<Real> GDist(g), H(g);
+    Herk( LOWER, ADJOINT, Real(1), A, GDist );
+    MakeHermitian( LOWER, GDist );
+    Gemm( ADJOINT, NORMAL, Real(1), A, B, H );
+    DistMatrix<Real,STAR,STAR> G( GDist );
+    DistMatrix<Real,STAR,VR> H_STAR_VR( H ), X_STAR_VR(g);
+    X_STAR_VR.AlignWith( H_STAR_VR );
+    X_STAR_VR.Resize( H.Height(), H.Width() );
+    active_set::Batch
+    ( G.LockedMatrix(), H_STAR_VR.LockedMatrix(), X_STAR_VR.Matrix(), ctrl );
+    Copy( X_STAR_VR, X );
+}
+
+template<typename Real>
+void ActiveSet
+( const SparseMatrix<Real>& A,
+  const Matrix<Real>& B,
+        Matrix<Real>& X,
+  const NNLSCtrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    const Int n = A.Width();
+    SparseMatrix<Real> GSparse;
+    Herk( LOWER, ADJOINT, Real(1), A, GSparse );
+    MakeHermitian( LOWER, GSparse );
+    Matrix<Real> G, H;
+    Copy( GSparse, G );
+    Zeros( H, n, B.Width() );
+    Multiply( ADJOINT, Real(1), A, B, Real(0), H );
+    X.Resize( n, B.Width() );
+    active_set::Batch( G, H, X, ctrl );
+}
+
+template<typename Real>
+void ActiveSet
+( const DistSparseMatrix<Real>& A,
+  const DistMultiVec<Real>& B,
+        DistMultiVec<Real>& X,
+  const NNLSCtrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    const Int n = A.Width();
+    const Grid& grid = A.Grid();
+    DistSparseMatrix<Real> GSparse(grid);
+    Herk( LOWER, ADJOINT, Real(1), A, GSparse );
+    MakeHermitian( LOWER, GSparse );
+    DistMatrix<Real,STAR,STAR> G(grid);
+    Copy( GSparse, G );
+    DistMultiVec<Real> H(grid);
+    Zeros( H, n, B.Width() );
+    Multiply( ADJOINT, Real(1), A, B, Real(0), H );
+    DistMatrix<Real,STAR,VR> H_STAR_VR(grid), X_STAR_VR(grid);
+    Copy( H, H_STAR_VR );
+    X_STAR_VR.AlignWith( H_STAR_VR );
+    X_STAR_VR.Resize( n, B.Width() );
+    active_set::Batch
+    ( G.LockedMatrix(), H_STAR_VR.LockedMatrix(), X_STAR_VR.Matrix(), ctrl );
+    Copy( X_STAR_VR, X );
+}
+
+} // namespace nnls
+} // namespace El
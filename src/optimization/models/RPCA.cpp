@@ -34,6 +34,35 @@ void NormalizeEntries( AbstractDistMatrix<Field>& A )
     EntrywiseMap( A, MakeFunction(unitMap) );
 }
 
+// Overwrites L with SVT_tau(L) and returns its rank. In the randomized case,
+// the rank of the next iterate is predicted from that of this one: a drop in
+// rank suggests that it has been found, while otherwise it is grown by a
+// fixed fraction of min(m,n).
+template<class MatrixType,typename Real>
+Int ThresholdSingularValues
+( MatrixType& L,
+  const Real& tau,
+        Int& predictedRank,
+  const RPCACtrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    if( ctrl.useRandomizedSVT )
+    {
+        const Int minDim = Min( L.Height(), L.Width() );
+        const Int rank =
+          svt::Randomized( L, tau, predictedRank, ctrl.sketchCtrl );
+        if( rank < predictedRank )
+            predictedRank = Min( rank+1, minDim );
+        else
+            predictedRank = Min( rank+Max(minDim/20,Int(1)), minDim );
+        return rank;
+    }
+    else if( ctrl.usePivQR )
+        return SVT( L, tau, ctrl.numPivSteps );
+    else
+        return SVT( L, tau );
+}
+
 // NOTE: If 'tau' is passed in as zero, it is set to 1/sqrt(max(m,n))
 
 template<typename Field>
@@ -74,6 +103,7 @@ void ADMM
     Zeros( S, m, n );
 
     Int numIts = 0;
+    Int predictedRank = ctrl.initialRank;
     while( true )
     {
         ++numIts;
@@ -89,11 +119,8 @@ void ADMM
         L = M;
         L -= S;
         Axpy( Field(1)/beta, Y, L );
-        Int rank;
-        if( ctrl.usePivQR )
-            rank = SVT( L, Real(1)/beta, ctrl.numPivSteps );
-        else
-            rank = SVT( L, Real(1)/beta );
+        const Int rank =
+          ThresholdSingularValues( L, Real(1)/beta, predictedRank, ctrl );
 
         // E := M - (L + S)
         E = M;
@@ -180,6 +207,7 @@ void ADMM
     Zeros( S, m, n );
 
     Int numIts = 0;
+    Int predictedRank = ctrl.initialRank;
     while( true )
     {
         ++numIts;
@@ -195,11 +223,8 @@ void ADMM
         L = M;
         L -= S;
         Axpy( Field(1)/beta, Y, L );
-        Int rank;
-        if( ctrl.usePivQR )
-            rank = SVT( L, Real(1)/beta, ctrl.numPivSteps );
-        else
-            rank = SVT( L, Real(1)/beta );
+        const Int rank =
+          ThresholdSingularValues( L, Real(1)/beta, predictedRank, ctrl );
 
         // E := M - (L + S)
         E = M;
@@ -285,6 +310,7 @@ void ALM
     Zeros( S, m, n );
 
     Int numIts=0, numPrimalIts=0;
+    Int predictedRank = ctrl.initialRank;
     Matrix<Field> LLast, SLast, E;
     while( true )
     {
@@ -309,10 +335,8 @@ void ALM
             L = M;
             L -= S;
             Axpy( Field(1)/beta, Y, L );
-            if( ctrl.usePivQR )
-                rank = SVT( L, Real(1)/beta, ctrl.numPivSteps );
-            else
-                rank = SVT( L, Real(1)/beta );
+            rank =
+              ThresholdSingularValues( L, Real(1)/beta, predictedRank, ctrl );
 
             LLast -= L;
             SLast -= S;
@@ -434,6 +458,7 @@ void ALM
     Zeros( S, m, n );
 
     Int numIts=0, numPrimalIts=0;
+    Int predictedRank = ctrl.initialRank;
     DistMatrix<Field> LLast( M.Grid() ), SLast( M.Grid() ), E( M.Grid() );
     while( true )
     {
@@ -458,10 +483,8 @@ void ALM
             L = M;
             L -= S;
             Axpy( Field(1)/beta, Y, L );
-            if( ctrl.usePivQR )
-                rank = SVT( L, Real(1)/beta, ctrl.numPivSteps );
-            else
-                rank = SVT( L, Real(1)/beta );
+            rank =
+              ThresholdSingularValues( L, Real(1)/beta, predictedRank, ctrl );
 
             LLast -= L;
             SLast -= S;
@@ -8,6 +8,7 @@
 */
 #include <El.hpp>
 #include "./SVM/IPM.hpp"
+#include "./SVM/DCD.hpp"
 
 namespace El {
 
@@ -20,7 +21,10 @@ void SVM
   const SVMCtrl<Real>& ctrl )
 {
     EL_DEBUG_CSE
-    svm::IPM( A, d, lambda, x, ctrl.ipmCtrl );
+    if( ctrl.approach == SVM_DUAL_COORDINATE_DESCENT )
+        svm::DCD( A, d, lambda, x, ctrl );
+    else
+        svm::IPM( A, d, lambda, x, ctrl.ipmCtrl );
 }
 
 template<typename Real>
@@ -32,7 +36,10 @@ void SVM
   const SVMCtrl<Real>& ctrl )
 {
     EL_DEBUG_CSE
-    svm::IPM( A, d, lambda, x, ctrl.ipmCtrl );
+    if( ctrl.approach == SVM_DUAL_COORDINATE_DESCENT )
+        svm::DCD( A, d, lambda, x, ctrl );
+    else
+        svm::IPM( A, d, lambda, x, ctrl.ipmCtrl );
 }
 
 template<typename Real>
@@ -44,7 +51,10 @@ void SVM
   const SVMCtrl<Real>& ctrl )
 {
     EL_DEBUG_CSE
-    svm::IPM( A, d, lambda, x, ctrl.ipmCtrl );
+    if( ctrl.approach == SVM_DUAL_COORDINATE_DESCENT )
+        svm::DCD( A, d, lambda, x, ctrl );
+    else
+        svm::IPM( A, d, lambda, x, ctrl.ipmCtrl );
 }
 
 template<typename Real>
@@ -56,7 +66,10 @@ void SVM
   const SVMCtrl<Real>& ctrl )
 {
     EL_DEBUG_CSE
-    svm::IPM( A, d, lambda, x, ctrl.ipmCtrl );
+    if( ctrl.approach == SVM_DUAL_COORDINATE_DESCENT )
+        svm::DCD( A, d, lambda, x, ctrl );
+    else
+        svm::IPM( A, d, lambda, x, ctrl.ipmCtrl );
 }
 
 #define PROTO(Real) \
@@ -0,0 +1,378 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+// Dual coordinate descent [1] for the soft-margin SVM. The offset is handled
+// by appending a unit feature to each row of A, so that, with
+// ahat_i = [a_i; 1] and what = [w; beta], the dual problem is
+//
+//   min_{alpha} (1/2) alpha^T Qhat alpha - 1^T alpha, 0 <= alpha <= lambda,
+//
+// where Qhat(i,j) = d_i d_j ahat_i^T ahat_j and
+//
+//   what = sum_i alpha_i d_i ahat_i.
+//
+// Each coordinate update only touches a single row of A, and the shrinking
+// heuristic of [1] temporarily removes coordinates which are likely to remain
+// at a bound. Since the unit feature is regularized, beta is penalized by
+// (1/2) beta^2, which the IPM formulation does not do.
+//
+// In the distributed case, each process sweeps over its local rows using a
+// local copy of what, and the updates are averaged over the processes as in
+// CoCoA [2] so that the iteration reduces to [1] on a single process.
+//
+// [1] Cho-Jui Hsieh, Kai-Wei Chang, Chih-Jen Lin, S. Sathiya Keerthi, and
+//     S. Sundararajan, "A Dual Coordinate Descent Method for Large-scale
+//     Linear SVM", Proceedings of ICML, 2008.
+//
+// [2] Martin Jaggi, Virginia Smith, Martin Takac, Jonathan Terhorst,
+//     Sanjay Krishnan, Thomas Hofmann, and Michael I. Jordan,
+//     "Communication-Efficient Distributed Dual Coordinate Ascent",
+//     Advances in Neural Information Processing Systems, 2014.
+//
+
+namespace El {
+namespace svm {
+
+namespace dcd {
+
+// Runs dual coordinate descent over the local rows, where 'rowDot(iLoc,w)'
+// returns a_i^T w(0:n-1) and 'rowAxpy(iLoc,alpha,w)' performs
+// w(0:n-1) += alpha a_i. The vector w is of length n+1 and holds [w; beta].
+template<typename Real,class DotType,class AxpyType>
+void Solve
+( const Matrix<Real>& dLoc,
+        Real lambda,
+        Matrix<Real>& w,
+  const DotType& rowDot,
+  const AxpyType& rowAxpy,
+  const SVMCtrl<Real>& ctrl,
+        mpi::Comm comm )
+{
+    EL_DEBUG_CSE
+    const Int localHeight = dLoc.Height();
+    const Int n = w.Height() - 1;
+    const Int numProcs = mpi::Size( comm );
+    const Int height = mpi::AllReduce( localHeight, comm );
+    const Real gamma = Real(1) / Real(numProcs);
+    const Real maxReal = limits::Max<Real>();
+
+    // Compute the diagonal of Qhat by scattering each row into a zero vector
+    // and then removing it again
+    Matrix<Real> QDiag, alpha;
+    Zeros( QDiag, localHeight, 1 );
+    Zeros( alpha, localHeight, 1 );
+    {
+        Matrix<Real> e;
+        Zeros( e, n+1, 1 );
+        for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+        {
+            rowAxpy( iLoc, Real(1), e );
+            QDiag(iLoc) = rowDot( iLoc, e ) + Real(1);
+            rowAxpy( iLoc, Real(-1), e );
+        }
+    }
+
+    vector<Int> active( localHeight );
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+        active[iLoc] = iLoc;
+    Real maxPGOld = maxReal, minPGOld = -maxReal;
+
+    Matrix<Real> wLoc;
+    Int numIts = 0;
+    while( true )
+    {
+        if( numIts == ctrl.dcdMaxIter )
+        {
+            RuntimeError
+            ("Dual coordinate descent did not converge in ",
+             ctrl.dcdMaxIter," iterations");
+        }
+        wLoc = w;
+        std::shuffle( active.begin(), active.end(), Generator() );
+
+        Real maxPG = -maxReal, minPG = maxReal;
+        Int numKept = 0;
+        for( size_t k=0; k<active.size(); ++k )
+        {
+            const Int iLoc = active[k];
+            const Real d = dLoc(iLoc);
+            const Real alphaOld = alpha(iLoc);
+            const Real gradient = d*(rowDot(iLoc,wLoc)+wLoc(n)) - Real(1);
+
+            // Compute the projected gradient and possibly shrink
+            Real projGrad = 0;
+            if( alphaOld == Real(0) )
+            {
+                if( ctrl.shrink && gradient > maxPGOld )
+                    continue;
+                if( gradient < Real(0) )
+                    projGrad = gradient;
+            }
+            else if( alphaOld == lambda )
+            {
+                if( ctrl.shrink && gradient < minPGOld )
+                    continue;
+                if( gradient > Real(0) )
+                    projGrad = gradient;
+            }
+            else
+                projGrad = gradient;
+            active[numKept++] = iLoc;
+            maxPG = Max( maxPG, projGrad );
+            minPG = Min( minPG, projGrad );
+
+            if( projGrad != Real(0) )
+            {
+                const Real alphaNew =
+                  Min( Max( alphaOld-gradient/QDiag(iLoc), Real(0) ), lambda );
+                const Real delta = (alphaNew-alphaOld)*d;
+                alpha(iLoc) =
+                  ( numProcs == 1 ? alphaNew
+                                  : alphaOld + gamma*(alphaNew-alphaOld) );
+                rowAxpy( iLoc, delta, wLoc );
+                wLoc(n) += delta;
+            }
+        }
+        active.resize( numKept );
+        ++numIts;
+
+        // Average the updates to what
+        wLoc -= w;
+        if( numProcs > 1 )
+            mpi::AllReduce( wLoc.Buffer(), n+1, comm );
+        Axpy( gamma, wLoc, w );
+
+        maxPG = mpi::AllReduce( maxPG, mpi::MAX, comm );
+        minPG = mpi::AllReduce( minPG, mpi::MIN, comm );
+        const Int numActive = mpi::AllReduce( Int(active.size()), comm );
+        if( ctrl.progress )
+            OutputFromRoot
+            (comm,"  DCD iteration ",numIts,": projected gradient gap=",
+             maxPG-minPG,", ",numActive," of ",height," active");
+        if( maxPG-minPG <= ctrl.dcdTol )
+        {
+            if( numActive == height )
+                break;
+            // Undo the shrinking and make sure that the entire problem has
+            // converged
+            active.resize( localHeight );
+            for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+                active[iLoc] = iLoc;
+            maxPGOld = maxReal;
+            minPGOld = -maxReal;
+            continue;
+        }
+        maxPGOld = ( maxPG <= Real(0) ? maxReal : maxPG );
+        minPGOld = ( minPG >= Real(0) ? -maxReal : minPG );
+    }
+}
+
+// The slack of the margin constraint of row i
+template<typename Real>
+Real Slack( Real d, Real rowDot, Real beta )
+{ return Max( Real(1) - d*(rowDot+beta), Real(0) ); }
+
+} // namespace dcd
+
+template<typename Real>
+void DCD
+( const Matrix<Real>& A,
+  const Matrix<Real>& d,
+        Real lambda,
+        Matrix<Real>& x,
+  const SVMCtrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Real* ABuf = A.LockedBuffer();
+    const Int ALDim = A.LDim();
+
+    auto rowDot =
+      [&]( Int i, const Matrix<Real>& w )
+      {
+          Real value = 0;
+          for( Int j=0; j<n; ++j )
+              value += ABuf[i+j*ALDim]*w(j);
+          return value;
+      };
+    auto rowAxpy =
+      [&]( Int i, const Real& alpha, Matrix<Real>& w )
+      {
+          for( Int j=0; j<n; ++j )
+              w(j) += alpha*ABuf[i+j*ALDim];
+      };
+
+    Matrix<Real> w;
+    Zeros( w, n+1, 1 );
+    dcd::Solve( d, lambda, w, rowDot, rowAxpy, ctrl, mpi::COMM_SELF );
+
+    Zeros( x, n+m+1, 1 );
+    auto xwbeta = x( IR(0,n+1), ALL );
+    xwbeta = w;
+    for( Int i=0; i<m; ++i )
+        x(n+1+i) = dcd::Slack( d(i), rowDot(i,w), w(n) );
+}
+
+template<typename Real>
+void DCD
+( const AbstractDistMatrix<Real>& APre,
+  const AbstractDistMatrix<Real>& dPre,
+        Real lambda,
+        AbstractDistMatrix<Real>& xPre,
+  const SVMCtrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    DistMatrixReadProxy<Real,Real,VC,STAR> AProx( APre ), dProx( dPre );
+    DistMatrixWriteProxy<Real,Real,VC,STAR> xProx( xPre );
+    auto& A = AProx.GetLocked();
+    auto& d = dProx.GetLocked();
+    auto& x = xProx.Get();
+    if( A.ColAlign() != d.ColAlign() )
+        LogicError("A and d were not aligned");
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int localHeight = A.LocalHeight();
+    const Real* ABuf = A.LockedBuffer();
+    const Int ALDim = A.LDim();
+
+    auto rowDot =
+      [&]( Int iLoc, const Matrix<Real>& w )
+      {
+          Real value = 0;
+          for( Int j=0; j<n; ++j )
+              value += ABuf[iLoc+j*ALDim]*w(j);
+          return value;
+      };
+    auto rowAxpy =
+      [&]( Int iLoc, const Real& alpha, Matrix<Real>& w )
+      {
+          for( Int j=0; j<n; ++j )
+              w(j) += alpha*ABuf[iLoc+j*ALDim];
+      };
+
+    Matrix<Real> w;
+    Zeros( w, n+1, 1 );
+    auto& dLoc = d.LockedMatrix();
+    dcd::Solve( dLoc, lambda, w, rowDot, rowAxpy, ctrl, A.DistComm() );
+
+    Zeros( x, n+m+1, 1 );
+    const bool root = ( A.DistRank() == 0 );
+    x.Reserve( localHeight + (root ? n+1 : 0) );
+    if( root )
+        for( Int j=0; j<n+1; ++j )
+            x.QueueUpdate( j, 0, w(j) );
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+        x.QueueUpdate
+        ( n+1+A.GlobalRow(iLoc), 0,
+          dcd::Slack( dLoc(iLoc), rowDot(iLoc,w), w(n) ) );
+    x.ProcessQueues();
+}
+
+template<typename Real>
+void DCD
+( const SparseMatrix<Real>& A,
+  const Matrix<Real>& d,
+        Real lambda,
+        Matrix<Real>& x,
+  const SVMCtrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int* colBuf = A.LockedTargetBuffer();
+    const Real* valBuf = A.LockedValueBuffer();
+
+    auto rowDot =
+      [&]( Int i, const Matrix<Real>& w )
+      {
+          const Int offset = A.RowOffset( i );
+          const Int numConn = A.NumConnections( i );
+          Real value = 0;
+          for( Int e=offset; e<offset+numConn; ++e )
+              value += valBuf[e]*w(colBuf[e]);
+          return value;
+      };
+    auto rowAxpy =
+      [&]( Int i, const Real& alpha, Matrix<Real>& w )
+      {
+          const Int offset = A.RowOffset( i );
+          const Int numConn = A.NumConnections( i );
+          for( Int e=offset; e<offset+numConn; ++e )
+              w(colBuf[e]) += alpha*valBuf[e];
+      };
+
+    Matrix<Real> w;
+    Zeros( w, n+1, 1 );
+    dcd::Solve( d, lambda, w, rowDot, rowAxpy, ctrl, mpi::COMM_SELF );
+
+    Zeros( x, n+m+1, 1 );
+    auto xwbeta = x( IR(0,n+1), ALL );
+    xwbeta = w;
+    for( Int i=0; i<m; ++i )
+        x(n+1+i) = dcd::Slack( d(i), rowDot(i,w), w(n) );
+}
+
+template<typename Real>
+void DCD
+( const DistSparseMatrix<Real>& A,
+  const DistMultiVec<Real>& d,
+        Real lambda,
+        DistMultiVec<Real>& x,
+  const SVMCtrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int localHeight = A.LocalHeight();
+    const Grid& grid = A.Grid();
+    const Int* colBuf = A.LockedTargetBuffer();
+    const Real* valBuf = A.LockedValueBuffer();
+    auto& dLoc = d.LockedMatrix();
+
+    auto rowDot =
+      [&]( Int iLoc, const Matrix<Real>& w )
+      {
+          const Int offset = A.RowOffset( iLoc );
+          const Int numConn = A.NumConnections( iLoc );
+          Real value = 0;
+          for( Int e=offset; e<offset+numConn; ++e )
+              value += valBuf[e]*w(colBuf[e]);
+          return value;
+      };
+    auto rowAxpy =
+      [&]( Int iLoc, const Real& alpha, Matrix<Real>& w )
+      {
+          const Int offset = A.RowOffset( iLoc );
+          const Int numConn = A.NumConnections( iLoc );
+          for( Int e=offset; e<offset+numConn; ++e )
+              w(colBuf[e]) += alpha*valBuf[e];
+      };
+
+    Matrix<Real> w;
+    Zeros( w, n+1, 1 );
+    dcd::Solve( dLoc, lambda, w, rowDot, rowAxpy, ctrl, grid.Comm() );
+
+    x.SetGrid( grid );
+    Zeros( x, n+m+1, 1 );
+    const bool root = ( grid.Rank() == 0 );
+    x.Reserve( localHeight + (root ? n+1 : 0) );
+    if( root )
+        for( Int j=0; j<n+1; ++j )
+            x.QueueUpdate( j, 0, w(j) );
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+        x.QueueUpdate
+        ( n+1+A.GlobalRow(iLoc), 0,
+          dcd::Slack( dLoc(iLoc), rowDot(iLoc,w), w(n) ) );
+    x.ProcessQueues();
+}
+
+} // namespace svm
+} // namespace El
@@ -7,6 +7,7 @@
    http://opensource.org/licenses/BSD-2-Clause
 */
 #include <El.hpp>
+#include "./SparseInvCov/QUIC.hpp"
 
 // These implementations are adaptations of the solver described at
 //    http://www.stanford.edu/~boyd/papers/admm/covsel/covsel.html
@@ -33,6 +34,8 @@ Int SparseInvCov
     Matrix<Field> S;
     Covariance( D, S );
     MakeHermitian( LOWER, S );
+    if( ctrl.approach == SPARSE_INV_COV_QUIC )
+        return sparse_inv_cov::QUIC( S, lambda, Z, ctrl );
 
     Int numIter=0;
     Matrix<Field> X, U, ZOld, XHat, T;
@@ -126,6 +129,8 @@ Int SparseInvCov
     DistMatrix<Field> S(g);
     Covariance( D, S );
     MakeHermitian( LOWER, S );
+    if( ctrl.approach == SPARSE_INV_COV_QUIC )
+        return sparse_inv_cov::QUIC( S, lambda, Z, ctrl );
 
     Int numIter=0;
     DistMatrix<Field> X(g), U(g), ZOld(g), XHat(g), T(g);
@@ -0,0 +1,299 @@
+/*
+   Copyright (c) 2009-2017, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+// QUIC [1] solves
+//
+//     minimize f(X) = Tr(S*X) - log det X + lambda ||X||_1
+//
+// by repeatedly minimizing the (l1-regularized) second-order model of the
+// smooth part of f over a direction D, i.e.,
+//
+//     Tr((S-W) D) + (1/2) Tr(W D W D) + lambda ||X+D||_1,
+//
+// where W = inv(X), using coordinate descent over the free set
+//
+//     {(i,j) : X(i,j) != 0 or |S(i,j)-W(i,j)| > lambda}.
+//
+// Maintaining U = W D allows each coordinate update to be performed in O(n)
+// work: for the symmetric update D(i,j) = D(j,i) := D(i,j) + mu, the model
+// is the scalar quadratic (a/2) mu^2 + b mu + lambda |c + mu| with
+//
+//     a = W(i,j)^2 + W(i,i) W(j,j)  (or W(i,i)^2 if i=j),
+//     b = S(i,j) - W(i,j) + U(i,:) W(:,j),
+//     c = X(i,j) + D(i,j),
+//
+// which is minimized by mu = -c + SoftThreshold(c - b/a, lambda/a).
+//
+// [1] Cho-Jui Hsieh, Matyas A. Sustik, Inderjit S. Dhillon, and
+//     Pradeep Ravikumar, "QUIC: Quadratic Approximation for Sparse Inverse
+//     Covariance Estimation", Journal of Machine Learning Research, Vol. 15,
+//     2014.
+//
+
+namespace El {
+namespace sparse_inv_cov {
+
+namespace quic {
+
+// Runs QUIC on the (replicated) covariance matrix S, where 'logDet(T,hpd)'
+// returns log det T and sets 'hpd' to whether T is positive-definite and
+// 'invert(T,W)' sets W := inv(T).
+template<typename Real,class LogDetType,class InvertType>
+Int Solve
+( const Matrix<Real>& S,
+        Real lambda,
+        Matrix<Real>& X,
+  const LogDetType& logDet,
+  const InvertType& invert,
+  const SparseInvCovCtrl<Real>& ctrl,
+        mpi::Comm comm )
+{
+    EL_DEBUG_CSE
+    const Int n = S.Height();
+
+    // The objective (excluding -log det X) and the one-norm of X
+    auto smoothTrace =
+      [&]( const Matrix<Real>& T )
+      {
+          Real trace = 0, oneNorm = 0;
+          for( Int j=0; j<n; ++j )
+          {
+              for( Int i=0; i<n; ++i )
+              {
+                  trace += S(i,j)*T(i,j);
+                  oneNorm += Abs(T(i,j));
+              }
+          }
+          return trace + lambda*oneNorm;
+      };
+
+    // Start from the solution of the problem restricted to diagonal X
+    Zeros( X, n, n );
+    for( Int i=0; i<n; ++i )
+    {
+        if( S(i,i) + lambda <= Real(0) )
+            LogicError("The regularized covariance was not positive-definite");
+        X(i,i) = 1/(S(i,i)+lambda);
+    }
+    bool hpd;
+    Real logDetX = logDet( X, hpd );
+    Real objective = smoothTrace( X ) - logDetX;
+
+    Matrix<Real> W, D, U, XNew;
+    invert( X, W );
+    vector<Int> freeRows, freeCols;
+    Int numIter=0;
+    while( numIter < ctrl.quicMaxIter )
+    {
+        // Compute the minimum-norm subgradient and the free set (of the lower
+        // triangle)
+        Real subgradNorm = 0, XOneNorm = 0;
+        freeRows.resize( 0 );
+        freeCols.resize( 0 );
+        for( Int j=0; j<n; ++j )
+        {
+            for( Int i=j; i<n; ++i )
+            {
+                const Real gradient = S(i,j) - W(i,j);
+                const Real weight = ( i == j ? Real(1) : Real(2) );
+                Real subgrad;
+                if( X(i,j) != Real(0) )
+                    subgrad = gradient + lambda*Sgn(X(i,j),false);
+                else
+                    subgrad = SoftThreshold( gradient, lambda );
+                subgradNorm += weight*Abs(subgrad);
+                XOneNorm += weight*Abs(X(i,j));
+                if( X(i,j) != Real(0) || Abs(gradient) > lambda )
+                {
+                    freeRows.push_back( i );
+                    freeCols.push_back( j );
+                }
+            }
+        }
+        const Int numFree = freeRows.size();
+        if( ctrl.progress )
+            OutputFromRoot
+            (comm,numIter,": objective=",objective,", ||subgrad||_1=",
+             subgradNorm,", ||X||_1=",XOneNorm,", ",numFree,
+             " free entries");
+        if( subgradNorm <= ctrl.quicTol*XOneNorm )
+            break;
+
+        // Compute the Newton direction via coordinate descent
+        Zeros( D, n, n );
+        Zeros( U, n, n );
+        const Real* WBuf = W.LockedBuffer();
+        Real* UBuf = U.Buffer();
+        const Int WLDim = W.LDim();
+        const Int ULDim = U.LDim();
+        const Int numSweeps = 1 + numIter/3;
+        for( Int sweep=0; sweep<numSweeps; ++sweep )
+        {
+            for( Int k=0; k<numFree; ++k )
+            {
+                const Int i = freeRows[k];
+                const Int j = freeCols[k];
+                const Real Wij = W(i,j);
+                const Real a = ( i == j ? Wij*Wij : Wij*Wij + W(i,i)*W(j,j) );
+                const Real b = S(i,j) - Wij +
+                  blas::Dot( n, &UBuf[i], ULDim, &WBuf[j*WLDim], 1 );
+                const Real c = X(i,j) + D(i,j);
+                const Real mu = -c + SoftThreshold( c-b/a, lambda/a );
+                if( mu == Real(0) )
+                    continue;
+                D(i,j) += mu;
+                blas::Axpy( n, mu, &WBuf[i*WLDim], 1, &UBuf[j*ULDim], 1 );
+                if( i != j )
+                {
+                    D(j,i) += mu;
+                    blas::Axpy( n, mu, &WBuf[j*WLDim], 1, &UBuf[i*ULDim], 1 );
+                }
+            }
+        }
+
+        // The predicted decrease, Tr((S-W) D) + lambda (||X+D||_1 - ||X||_1)
+        XNew = X;
+        XNew += D;
+        Real delta = smoothTrace( XNew ) - smoothTrace( X );
+        for( Int j=0; j<n; ++j )
+            for( Int i=0; i<n; ++i )
+                delta -= W(i,j)*D(i,j);
+
+        // Backtrack until X + alpha D is positive-definite and the Armijo
+        // condition holds
+        Real alpha = 1;
+        Int numLineSearchIter = 0;
+        while( true )
+        {
+            if( numLineSearchIter == ctrl.maxLineSearchIter )
+                RuntimeError
+                ("QUIC line search failed after ",numLineSearchIter,
+                 " iterations");
+            XNew = X;
+            Axpy( alpha, D, XNew );
+            const Real logDetXNew = logDet( XNew, hpd );
+            if( hpd )
+            {
+                const Real objectiveNew = smoothTrace( XNew ) - logDetXNew;
+                if( objectiveNew <=
+                    objective + alpha*ctrl.lineSearchSigma*delta )
+                {
+                    objective = objectiveNew;
+                    break;
+                }
+            }
+            alpha *= ctrl.lineSearchBeta;
+            ++numLineSearchIter;
+        }
+        X = XNew;
+        invert( X, W );
+        ++numIter;
+    }
+    if( numIter == ctrl.quicMaxIter )
+        RuntimeError("QUIC failed to converge");
+    return numIter;
+}
+
+} // namespace quic
+
+template<typename Real>
+Int QUIC
+( const Matrix<Real>& S,
+        Real lambda,
+        Matrix<Real>& X,
+  const SparseInvCovCtrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    auto logDet =
+      [&]( const Matrix<Real>& T, bool& hpd )
+      {
+          const SafeProduct<Real> safeDet = SafeHPDDeterminant( LOWER, T );
+          hpd = ( safeDet.rho != Real(0) );
+          return safeDet.kappa*safeDet.n;
+      };
+    auto invert =
+      [&]( const Matrix<Real>& T, Matrix<Real>& W )
+      {
+          W = T;
+          HPDInverse( LOWER, W );
+          MakeHermitian( LOWER, W );
+      };
+    return quic::Solve( S, lambda, X, logDet, invert, ctrl, mpi::COMM_SELF );
+}
+
+template<typename Real>
+Int QUIC
+( const AbstractDistMatrix<Real>& S,
+        Real lambda,
+        AbstractDistMatrix<Real>& X,
+  const SparseInvCovCtrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    // The coordinate descent is performed redundantly on replicated copies,
+    // while the Cholesky factorizations and inversions are distributed
+    const Grid& g = S.Grid();
+    DistMatrix<Real,STAR,STAR> S_STAR_STAR( S ), X_STAR_STAR(g), T_STAR_STAR(g);
+    DistMatrix<Real> T(g);
+    auto logDet =
+      [&]( const Matrix<Real>& TLoc, bool& hpd )
+      {
+          T_STAR_STAR.Resize( TLoc.Height(), TLoc.Width() );
+          T_STAR_STAR.Matrix() = TLoc;
+          T = T_STAR_STAR;
+          const SafeProduct<Real> safeDet = SafeHPDDeterminant( LOWER, T );
+          hpd = ( safeDet.rho != Real(0) );
+          return safeDet.kappa*safeDet.n;
+      };
+    auto invert =
+      [&]( const Matrix<Real>& TLoc, Matrix<Real>& W )
+      {
+          T_STAR_STAR.Resize( TLoc.Height(), TLoc.Width() );
+          T_STAR_STAR.Matrix() = TLoc;
+          T = T_STAR_STAR;
+          HPDInverse( LOWER, T );
+          MakeHermitian( LOWER, T );
+          T_STAR_STAR = T;
+          W = T_STAR_STAR.LockedMatrix();
+      };
+    X_STAR_STAR.Resize( S.Height(), S.Width() );
+    const Int numIter =
+      quic::Solve
+      ( S_STAR_STAR.LockedMatrix(), lambda, X_STAR_STAR.Matrix(), logDet,
+        invert, ctrl, g.Comm() );
+    Copy( X_STAR_STAR, X );
+    return numIter;
+}
+
+template<typename Real>
+Int QUIC
+( const Matrix<Complex<Real>>& S,
+        Real lambda,
+        Matrix<Complex<Real>>& X,
+  const SparseInvCovCtrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    LogicError("QUIC is not yet supported for complex matrices");
+    return 0;
+}
+
+template<typename Real>
+Int QUIC
+( const AbstractDistMatrix<Complex<Real>>& S,
+        Real lambda,
+        AbstractDistMatrix<Complex<Real>>& X,
+  const SparseInvCovCtrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    LogicError("QUIC is not yet supported for complex matrices");
+    return 0;
+}
+
+} // namespace sparse_inv_cov
+} // namespace El
@@ -20,9 +20,150 @@
 //
 // where x is in R^n and t is in R^(n-1).
 //
+// DirectTV instead uses the direct algorithm of [1], which sweeps through
+// the signal while maintaining the range of values the current segment of
+// the solution could take, and only backtracks to the start of the segment
+// once its value has been determined.
+//
+// [1] Laurent Condat, "A Direct Algorithm for 1-D Total Variation
+//     Denoising", IEEE Signal Processing Letters, Vol. 20, No. 11, 2013.
+//
 
 namespace El {
 
+namespace {
+
+// Denoise the signal b of length n into x
+template<typename Real>
+void CondatTV( Int n, const Real* b, Real lambda, Real* x )
+{
+    if( n == 0 )
+        return;
+    Int k=0, k0=0, kPlus=0, kMinus=0;
+    Real uMin=lambda, uMax=-lambda;
+    Real vMin=b[0]-lambda, vMax=b[0]+lambda;
+    while( true )
+    {
+        while( k == n-1 )
+        {
+            if( uMin < Real(0) )
+            {
+                do x[k0++] = vMin; while( k0 <= kMinus );
+                k = kMinus = k0;
+                vMin = b[k];
+                uMin = lambda;
+                uMax = vMin + uMin - vMax;
+            }
+            else if( uMax > Real(0) )
+            {
+                do x[k0++] = vMax; while( k0 <= kPlus );
+                k = kPlus = k0;
+                vMax = b[k];
+                uMax = -lambda;
+                uMin = vMax + uMax - vMin;
+            }
+            else
+            {
+                vMin += uMin/Real(k-k0+1);
+                do x[k0++] = vMin; while( k0 <= k );
+                return;
+            }
+        }
+        uMin += b[k+1] - vMin;
+        if( uMin < -lambda )
+        {
+            // A negative jump: the segment from k0 to kMinus is at vMin
+            do x[k0++] = vMin; while( k0 <= kMinus );
+            k = kMinus = kPlus = k0;
+            vMin = b[k];
+            vMax = vMin + 2*lambda;
+            uMin = lambda;
+            uMax = -lambda;
+            continue;
+        }
+        uMax += b[k+1] - vMax;
+        if( uMax > lambda )
+        {
+            // A positive jump: the segment from k0 to kPlus is at vMax
+            do x[k0++] = vMax; while( k0 <= kPlus );
+            k = kMinus = kPlus = k0;
+            vMax = b[k];
+            vMin = vMax - 2*lambda;
+            uMin = lambda;
+            uMax = -lambda;
+            continue;
+        }
+        ++k;
+        if( uMin >= lambda )
+        {
+            kMinus = k;
+            vMin += (uMin-lambda)/Real(kMinus-k0+1);
+            uMin = lambda;
+        }
+        if( uMax <= -lambda )
+        {
+            kPlus = k;
+            vMax += (uMax+lambda)/Real(kPlus-k0+1);
+            uMax = -lambda;
+        }
+    }
+}
+
+} // anonymous namespace
+
+template<typename Real>
+void DirectTV
+( const Matrix<Real>& B,
+        Real lambda,
+        Matrix<Real>& X )
+{
+    EL_DEBUG_CSE
+    if( lambda < Real(0) )
+        LogicError("lambda must be non-negative");
+    const Int n = B.Height();
+    const Int numSignals = B.Width();
+    X.Resize( n, numSignals );
+    const Real* BBuf = B.LockedBuffer();
+    Real* XBuf = X.Buffer();
+    const Int BLDim = B.LDim();
+    const Int XLDim = X.LDim();
+    EL_PARALLEL_FOR_IF(ParallelizeLoop(n*numSignals))
+    for( Int j=0; j<numSignals; ++j )
+        CondatTV( n, &BBuf[j*BLDim], lambda, &XBuf[j*XLDim] );
+}
+
+template<typename Real>
+void DirectTV
+( const AbstractDistMatrix<Real>& BPre,
+        Real lambda,
+        AbstractDistMatrix<Real>& XPre )
+{
+    EL_DEBUG_CSE
+    // Give each process entire signals
+    DistMatrixReadProxy<Real,Real,STAR,VR> BProx( BPre );
+    auto& B = BProx.GetLocked();
+    DistMatrix<Real,STAR,VR> X( B.Grid() );
+    X.AlignWith( B );
+    X.Resize( B.Height(), B.Width() );
+    DirectTV( B.LockedMatrix(), lambda, X.Matrix() );
+    Copy( X, XPre );
+}
+
+template<typename Real>
+void DirectTV
+( const DistMultiVec<Real>& B,
+        Real lambda,
+        DistMultiVec<Real>& X )
+{
+    EL_DEBUG_CSE
+    const Grid& grid = B.Grid();
+    DistMatrix<Real,STAR,VR> B_STAR_VR(grid), X_STAR_VR(grid);
+    Copy( B, B_STAR_VR );
+    DirectTV( B_STAR_VR, lambda, X_STAR_VR );
+    X.SetGrid( grid );
+    Copy( X_STAR_VR, X );
+}
+
 template<typename Real>
 void TV
 ( const AbstractDistMatrix<Real>& b,
@@ -219,7 +360,19 @@ void TV
   ( const DistMultiVec<Real>& b, \
           Real lambda, \
           DistMultiVec<Real>& x, \
-    const qp::affine::Ctrl<Real>& ctrl );
+    const qp::affine::Ctrl<Real>& ctrl ); \
+  template void DirectTV \
+  ( const Matrix<Real>& B, \
+          Real lambda, \
+          Matrix<Real>& X ); \
+  template void DirectTV \
+  ( const AbstractDistMatrix<Real>& B, \
+          Real lambda, \
+          AbstractDistMatrix<Real>& X ); \
+  template void DirectTV \
+  ( const DistMultiVec<Real>& B, \
+          Real lambda, \
+          DistMultiVec<Real>& X );
 
 #define EL_NO_INT_PROTO
 #define EL_NO_COMPLEX_PROTO
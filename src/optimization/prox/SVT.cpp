@@ -11,6 +11,7 @@
 #include "./SVT/Normal.hpp"
 #include "./SVT/Cross.hpp"
 #include "./SVT/PivotedQR.hpp"
+#include "./SVT/Randomized.hpp"
 #include "./SVT/TSQR.hpp"
 
 namespace El {
@@ -85,6 +86,12 @@ Int SVT( DistMatrix<Field,U,STAR>& A, const Base<Field>& tau, bool relative )
     bool relative ); \
   template Int svt::TSQR \
   ( AbstractDistMatrix<Field>& A, const Base<Field>& tau, bool relative ); \
+  template Int svt::Randomized \
+  ( Matrix<Field>& A, const Base<Field>& tau, Int rankGuess, \
+    const RangeFinderCtrl& ctrl, bool relative ); \
+  template Int svt::Randomized \
+  ( AbstractDistMatrix<Field>& A, const Base<Field>& tau, Int rankGuess, \
+    const RangeFinderCtrl& ctrl, bool relative ); \
   PROTO_DIST(Field,MC  ) \
   PROTO_DIST(Field,MD  ) \
   PROTO_DIST(Field,MR  ) \
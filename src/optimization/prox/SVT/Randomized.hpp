@@ -0,0 +1,111 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_SVT_RANDOMIZED_HPP
+#define EL_SVT_RANDOMIZED_HPP
+
+namespace El {
+namespace svt {
+
+// Threshold a randomized partial SVD, A ~= Q (Q^H A), where Q is returned by
+// RandomizedRangeFinder for the rank guess. If every singular value of the
+// sketch survives the threshold, then the guess is doubled so that the
+// result is not truncated below the thresholded rank.
+
+template<typename Field>
+Int Randomized
+( Matrix<Field>& A,
+  const Base<Field>& tau,
+  Int rankGuess,
+  const RangeFinderCtrl& ctrl,
+  bool relative )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int minDim = Min(m,n);
+    Int sketchRank = Max( Min(rankGuess,minDim), Int(1) );
+
+    Matrix<Field> Q, B, W, V;
+    Matrix<Real> s;
+    Int rank;
+    while( true )
+    {
+        RandomizedRangeFinder( A, sketchRank, Q, ctrl );
+        Gemm( ADJOINT, NORMAL, Field(1), Q, A, B );
+        SVD( B, W, s, V );
+        SoftThreshold( s, tau, relative );
+        rank = ZeroNorm( s );
+        if( rank < s.Height() || sketchRank >= minDim )
+            break;
+        sketchRank = Min( 2*sketchRank, minDim );
+    }
+
+    // A := (Q W_k) diag(s_k) V_k^H
+    auto Wk = W( ALL, IR(0,rank) );
+    auto sk = s( IR(0,rank), ALL );
+    auto Vk = V( ALL, IR(0,rank) );
+    Matrix<Field> U;
+    Gemm( NORMAL, NORMAL, Field(1), Q, Wk, U );
+    DiagonalScale( RIGHT, NORMAL, sk, U );
+    Gemm( NORMAL, ADJOINT, Field(1), U, Vk, Field(0), A );
+
+    return rank;
+}
+
+template<typename Field>
+Int Randomized
+( AbstractDistMatrix<Field>& APre,
+  const Base<Field>& tau,
+  Int rankGuess,
+  const RangeFinderCtrl& ctrl,
+  bool relative )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+
+    DistMatrixReadWriteProxy<Field,Field,MC,MR> AProx( APre );
+    auto& A = AProx.Get();
+    const Grid& g = A.Grid();
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int minDim = Min(m,n);
+    Int sketchRank = Max( Min(rankGuess,minDim), Int(1) );
+
+    DistMatrix<Field> Q(g), B(g), W(g), V(g);
+    DistMatrix<Real,VR,STAR> s(g);
+    Int rank;
+    while( true )
+    {
+        RandomizedRangeFinder( A, sketchRank, Q, ctrl );
+        Gemm( ADJOINT, NORMAL, Field(1), Q, A, B );
+        SVD( B, W, s, V );
+        SoftThreshold( s, tau, relative );
+        rank = ZeroNorm( s );
+        if( rank < s.Height() || sketchRank >= minDim )
+            break;
+        sketchRank = Min( 2*sketchRank, minDim );
+    }
+
+    // A := (Q W_k) diag(s_k) V_k^H
+    auto Wk = W( ALL, IR(0,rank) );
+    auto sk = s( IR(0,rank), ALL );
+    auto Vk = V( ALL, IR(0,rank) );
+    DistMatrix<Field> U(g);
+    Gemm( NORMAL, NORMAL, Field(1), Q, Wk, U );
+    DiagonalScale( RIGHT, NORMAL, sk, U );
+    Gemm( NORMAL, ADJOINT, Field(1), U, Vk, Field(0), A );
+
+    return rank;
+}
+
+} // namespace svt
+} // namespace El
+
+#endif // ifndef EL_SVT_RANDOMIZED_HPP
@@ -29,6 +29,20 @@ void LP
         LogicError("Unsupported solver");
 }
 
+template<typename Real>
+void LP
+( const DirectLPProblem<Matrix<Real>,Matrix<Real>>& problem,
+        DirectLPSolution<Matrix<Real>>& solution,
+        DirectLPScaling<Matrix<Real>>& scaling,
+  const lp::direct::Ctrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    if( ctrl.approach == LP_MEHROTRA )
+        lp::direct::Mehrotra( problem, solution, scaling, ctrl.mehrotraCtrl );
+    else
+        LogicError("Only the Mehrotra IPM returns equilibration scalings");
+}
+
 // This interface is now deprecated.
 template<typename Real>
 void LP
@@ -117,6 +131,20 @@ void LP
         LogicError("Unsupported solver");
 }
 
+template<typename Real>
+void LP
+( const DirectLPProblem<DistMatrix<Real>,DistMatrix<Real>>& problem,
+        DirectLPSolution<DistMatrix<Real>>& solution,
+        DirectLPScaling<DistMatrix<Real>>& scaling,
+  const lp::direct::Ctrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    if( ctrl.approach == LP_MEHROTRA )
+        lp::direct::Mehrotra( problem, solution, scaling, ctrl.mehrotraCtrl );
+    else
+        LogicError("Only the Mehrotra IPM returns equilibration scalings");
+}
+
 // This interface is now deprecated.
 template<typename Real>
 void LP
@@ -200,12 +228,57 @@ void LP
   const lp::direct::Ctrl<Real>& ctrl )
 {
     EL_DEBUG_CSE
+    if( ctrl.presolve )
+    {
+        DirectLPProblem<SparseMatrix<Real>,Matrix<Real>> reducedProblem;
+        DirectLPSolution<Matrix<Real>> reducedSolution;
+        DirectPresolveInfo<Real> info;
+        PresolveDirect
+        ( problem.A, problem.b, problem.c,
+          reducedProblem.A, reducedProblem.b, reducedProblem.c,
+          info, ctrl.presolveCtrl );
+        if( reducedProblem.A.Width() > 0 )
+        {
+            auto reducedCtrl = ctrl;
+            reducedCtrl.presolve = false;
+            reducedCtrl.mehrotraCtrl.primalInit = false;
+            reducedCtrl.mehrotraCtrl.dualInit = false;
+            LP( reducedProblem, reducedSolution, reducedCtrl );
+        }
+        else
+        {
+            Zeros( reducedSolution.x, 0, 1 );
+            Zeros( reducedSolution.y, reducedProblem.A.Height(), 1 );
+            Zeros( reducedSolution.z, 0, 1 );
+        }
+        PostsolveDirect
+        ( problem.A, problem.c, info,
+          reducedSolution.x, reducedSolution.y, reducedSolution.z,
+          solution.x, solution.y, solution.z );
+        return;
+    }
     if( ctrl.approach == LP_MEHROTRA )
         lp::direct::Mehrotra( problem, solution, ctrl.mehrotraCtrl );
     else
         LogicError("Unsupported solver");
 }
 
+template<typename Real>
+void LP
+( const DirectLPProblem<SparseMatrix<Real>,Matrix<Real>>& problem,
+        DirectLPSolution<Matrix<Real>>& solution,
+        DirectLPScaling<Matrix<Real>>& scaling,
+  const lp::direct::Ctrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    if( ctrl.presolve )
+        LogicError("Presolve cannot return equilibration scalings");
+    if( ctrl.approach == LP_MEHROTRA )
+        lp::direct::Mehrotra( problem, solution, scaling, ctrl.mehrotraCtrl );
+    else
+        LogicError("Only the Mehrotra IPM returns equilibration scalings");
+}
+
 // This interface is now deprecated.
 template<typename Real>
 void LP
@@ -285,12 +358,61 @@ void LP
   const lp::direct::Ctrl<Real>& ctrl )
 {
     EL_DEBUG_CSE
+    if( ctrl.presolve )
+    {
+        const Grid& grid = problem.A.Grid();
+        DirectLPProblem<DistSparseMatrix<Real>,DistMultiVec<Real>>
+          reducedProblem;
+        DirectLPSolution<DistMultiVec<Real>> reducedSolution;
+        ForceSimpleAlignments( reducedProblem, grid );
+        ForceSimpleAlignments( reducedSolution, grid );
+        DirectPresolveInfo<Real> info;
+        PresolveDirect
+        ( problem.A, problem.b, problem.c,
+          reducedProblem.A, reducedProblem.b, reducedProblem.c,
+          info, ctrl.presolveCtrl );
+        if( reducedProblem.A.Width() > 0 )
+        {
+            auto reducedCtrl = ctrl;
+            reducedCtrl.presolve = false;
+            reducedCtrl.mehrotraCtrl.primalInit = false;
+            reducedCtrl.mehrotraCtrl.dualInit = false;
+            LP( reducedProblem, reducedSolution, reducedCtrl );
+        }
+        else
+        {
+            Zeros( reducedSolution.x, 0, 1 );
+            Zeros( reducedSolution.y, reducedProblem.A.Height(), 1 );
+            Zeros( reducedSolution.z, 0, 1 );
+        }
+        PostsolveDirect
+        ( problem.A, problem.c, info,
+          reducedSolution.x, reducedSolution.y, reducedSolution.z,
+          solution.x, solution.y, solution.z );
+        return;
+    }
     if( ctrl.approach == LP_MEHROTRA )
         lp::direct::Mehrotra( problem, solution, ctrl.mehrotraCtrl );
     else
         LogicError("Unsupported solver");
 }
 
+template<typename Real>
+void LP
+( const DirectLPProblem<DistSparseMatrix<Real>,DistMultiVec<Real>>& problem,
+        DirectLPSolution<DistMultiVec<Real>>& solution,
+        DirectLPScaling<DistMultiVec<Real>>& scaling,
+  const lp::direct::Ctrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    if( ctrl.presolve )
+        LogicError("Presolve cannot return equilibration scalings");
+    if( ctrl.approach == LP_MEHROTRA )
+        lp::direct::Mehrotra( problem, solution, scaling, ctrl.mehrotraCtrl );
+    else
+        LogicError("Only the Mehrotra IPM returns equilibration scalings");
+}
+
 // This interface is now deprecated.
 template<typename Real>
 void LP
@@ -379,6 +501,11 @@ void LP
           DirectLPSolution<Matrix<Real>>& solution, \
     const lp::direct::Ctrl<Real>& ctrl ); \
   template void LP \
+  ( const DirectLPProblem<Matrix<Real>,Matrix<Real>>& problem, \
+          DirectLPSolution<Matrix<Real>>& solution, \
+          DirectLPScaling<Matrix<Real>>& scaling, \
+    const lp::direct::Ctrl<Real>& ctrl ); \
+  template void LP \
   ( const Matrix<Real>& A, \
     const Matrix<Real>& b, \
     const Matrix<Real>& c, \
@@ -406,6 +533,11 @@ void LP
           DirectLPSolution<DistMatrix<Real>>& solution, \
     const lp::direct::Ctrl<Real>& ctrl ); \
   template void LP \
+  ( const DirectLPProblem<DistMatrix<Real>,DistMatrix<Real>>& problem, \
+          DirectLPSolution<DistMatrix<Real>>& solution, \
+          DirectLPScaling<DistMatrix<Real>>& scaling, \
+    const lp::direct::Ctrl<Real>& ctrl ); \
+  template void LP \
   ( const AbstractDistMatrix<Real>& A, \
     const AbstractDistMatrix<Real>& b, \
     const AbstractDistMatrix<Real>& c, \
@@ -433,6 +565,11 @@ void LP
           DirectLPSolution<Matrix<Real>>& solution, \
     const lp::direct::Ctrl<Real>& ctrl ); \
   template void LP \
+  ( const DirectLPProblem<SparseMatrix<Real>,Matrix<Real>>& problem, \
+          DirectLPSolution<Matrix<Real>>& solution, \
+          DirectLPScaling<Matrix<Real>>& scaling, \
+    const lp::direct::Ctrl<Real>& ctrl ); \
+  template void LP \
   ( const SparseMatrix<Real>& A, \
     const Matrix<Real>& b, \
     const Matrix<Real>& c, \
@@ -460,6 +597,11 @@ void LP
           DirectLPSolution<DistMultiVec<Real>>& solution, \
     const lp::direct::Ctrl<Real>& ctrl ); \
   template void LP \
+  ( const DirectLPProblem<DistSparseMatrix<Real>,DistMultiVec<Real>>& problem, \
+          DirectLPSolution<DistMultiVec<Real>>& solution, \
+          DirectLPScaling<DistMultiVec<Real>>& scaling, \
+    const lp::direct::Ctrl<Real>& ctrl ); \
+  template void LP \
   ( const DistSparseMatrix<Real>& A, \
     const DistMultiVec<Real>& b, \
     const DistMultiVec<Real>& c, \
@@ -0,0 +1,217 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+namespace El {
+
+namespace {
+
+// A rough estimate of the cost of the (sparse-direct) IPM for a problem
+template<typename Real>
+Int BatchWork( const DirectLPProblem<SparseMatrix<Real>,Matrix<Real>>& problem )
+{ return problem.A.NumEntries() + problem.A.Height() + problem.A.Width(); }
+
+template<typename Real>
+int BatchTeamSize
+( const DirectLPProblem<SparseMatrix<Real>,Matrix<Real>>& problem,
+  Int targetNnzPerProcess, int maxTeamSize )
+{
+    const Int work = BatchWork( problem );
+    int teamSize = 1;
+    while( 2*teamSize <= maxTeamSize &&
+           Int(teamSize)*targetNnzPerProcess < work )
+        teamSize *= 2;
+    return teamSize;
+}
+
+template<typename Real>
+void LocalRowsFromReplicated
+( const Matrix<Real>& x, Int height, DistMultiVec<Real>& xDist )
+{
+    xDist.Resize( height, 1 );
+    const Int firstLocalRow = xDist.FirstLocalRow();
+    const Int localHeight = xDist.LocalHeight();
+    auto& xLoc = xDist.Matrix();
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+        xLoc(iLoc) = x(firstLocalRow+iLoc);
+}
+
+template<typename Real>
+void ReplicatedFromLocalRows( const DistMultiVec<Real>& xDist, Matrix<Real>& x )
+{
+    Zeros( x, xDist.Height(), 1 );
+    const Int firstLocalRow = xDist.FirstLocalRow();
+    const Int localHeight = xDist.LocalHeight();
+    const auto& xLoc = xDist.LockedMatrix();
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+        x(firstLocalRow+iLoc) = xLoc(iLoc);
+    mpi::AllReduce( x.Buffer(), x.Height(), xDist.Grid().Comm() );
+}
+
+// Solve a sequential sparse LP on the team owning the given grid by
+// redistributing it into the (reused) distributed containers.
+template<typename Real>
+void TeamLP
+( const DirectLPProblem<SparseMatrix<Real>,Matrix<Real>>& problem,
+        DirectLPSolution<Matrix<Real>>& solution,
+        DirectLPProblem<DistSparseMatrix<Real>,DistMultiVec<Real>>& teamProblem,
+        DirectLPSolution<DistMultiVec<Real>>& teamSolution,
+  const lp::direct::Ctrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    const Int m = problem.A.Height();
+    const Int n = problem.A.Width();
+
+    auto& A = teamProblem.A;
+    A.Resize( m, n );
+    const Int firstLocalRow = A.FirstLocalRow();
+    const Int localHeight = A.LocalHeight();
+    const Int* offsetBuf = problem.A.LockedOffsetBuffer();
+    const Int* colBuf = problem.A.LockedTargetBuffer();
+    const Real* valBuf = problem.A.LockedValueBuffer();
+    A.Reserve
+    ( offsetBuf[firstLocalRow+localHeight] - offsetBuf[firstLocalRow] );
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+    {
+        const Int i = firstLocalRow + iLoc;
+        for( Int e=offsetBuf[i]; e<offsetBuf[i+1]; ++e )
+            A.QueueLocalUpdate( iLoc, colBuf[e], valBuf[e] );
+    }
+    A.ProcessLocalQueues();
+    LocalRowsFromReplicated( problem.b, m, teamProblem.b );
+    LocalRowsFromReplicated( problem.c, n, teamProblem.c );
+
+    const auto& mehrotraCtrl = ctrl.mehrotraCtrl;
+    if( mehrotraCtrl.primalInit )
+        LocalRowsFromReplicated( solution.x, n, teamSolution.x );
+    if( mehrotraCtrl.dualInit )
+    {
+        LocalRowsFromReplicated( solution.y, m, teamSolution.y );
+        LocalRowsFromReplicated( solution.z, n, teamSolution.z );
+    }
+
+    LP( teamProblem, teamSolution, ctrl );
+
+    ReplicatedFromLocalRows( teamSolution.x, solution.x );
+    ReplicatedFromLocalRows( teamSolution.y, solution.y );
+    ReplicatedFromLocalRows( teamSolution.z, solution.z );
+}
+
+} // anonymous namespace
+
+template<typename Real>
+void BatchLP
+( const vector<DirectLPProblem<SparseMatrix<Real>,Matrix<Real>>>& problems,
+        vector<DirectLPSolution<Matrix<Real>>>& solutions,
+  mpi::Comm comm,
+  const lp::BatchCtrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    const Int numProblems = problems.size();
+    if( Int(solutions.size()) != numProblems )
+    {
+        if( ctrl.lpCtrl.mehrotraCtrl.primalInit ||
+            ctrl.lpCtrl.mehrotraCtrl.dualInit )
+            LogicError
+            ("Expected ",numProblems," initial guesses but received ",
+             solutions.size());
+        solutions.resize( numProblems );
+    }
+    const int commSize = mpi::Size( comm );
+    const int commRank = mpi::Rank( comm );
+
+    // Choose a power-of-two team size for each problem so that each team
+    // member is responsible for roughly 'targetNnzPerProcess' nonzeros
+    vector<int> teamSizes( numProblems );
+    for( Int k=0; k<numProblems; ++k )
+        teamSizes[k] = BatchTeamSize
+        ( problems[k], ctrl.targetNnzPerProcess, commSize );
+
+    // Handle each team size in turn, splitting the communicator into
+    // 'commSize / teamSize' teams (the last of which absorbs any remaining
+    // processes). Within a phase, the problems are scheduled across the teams
+    // in decreasing order of work, each going to the currently least-loaded
+    // team. Since every process computes the same schedule, no communication
+    // is required to dispatch the problems.
+    const Int indent = PushIndent();
+    for( int teamSize=1; teamSize<=commSize; teamSize*=2 )
+    {
+        vector<Int> phaseProblems;
+        for( Int k=0; k<numProblems; ++k )
+            if( teamSizes[k] == teamSize )
+                phaseProblems.push_back( k );
+        if( phaseProblems.empty() )
+            continue;
+        std::stable_sort
+        ( phaseProblems.begin(), phaseProblems.end(),
+          [&]( const Int& k0, const Int& k1 )
+          { return BatchWork(problems[k0]) > BatchWork(problems[k1]); } );
+
+        const int numTeams = commSize / teamSize;
+        const int team = Min( commRank/teamSize, numTeams-1 );
+        vector<Int> teamLoads( numTeams, 0 );
+        vector<Int> myProblems;
+        for( const Int& k : phaseProblems )
+        {
+            const int owner =
+              std::min_element( teamLoads.begin(), teamLoads.end() ) -
+              teamLoads.begin();
+            teamLoads[owner] += BatchWork( problems[k] );
+            if( owner == team )
+                myProblems.push_back( k );
+        }
+        if( ctrl.progress && commRank == 0 )
+            Output
+            (phaseProblems.size()," problems on ",numTeams," teams of ",
+             teamSize," processes");
+
+        if( teamSize == 1 )
+        {
+            for( const Int& k : myProblems )
+                LP( problems[k], solutions[k], ctrl.lpCtrl );
+            continue;
+        }
+
+        // The team's grid and distributed containers are reused for each of
+        // its problems
+        mpi::Comm teamComm;
+        mpi::Split( comm, team, commRank, teamComm );
+        {
+            Grid teamGrid( teamComm );
+            DirectLPProblem<DistSparseMatrix<Real>,DistMultiVec<Real>>
+              teamProblem;
+            DirectLPSolution<DistMultiVec<Real>> teamSolution;
+            ForceSimpleAlignments( teamProblem, teamGrid );
+            ForceSimpleAlignments( teamSolution, teamGrid );
+            for( const Int& k : myProblems )
+                TeamLP
+                ( problems[k], solutions[k], teamProblem, teamSolution,
+                  ctrl.lpCtrl );
+        }
+        mpi::Free( teamComm );
+    }
+    SetIndent( indent );
+}
+
+#define PROTO(Real) \
+  template void BatchLP \
+  ( const vector<DirectLPProblem<SparseMatrix<Real>,Matrix<Real>>>& problems, \
+          vector<DirectLPSolution<Matrix<Real>>>& solutions, \
+    mpi::Comm comm, \
+    const lp::BatchCtrl<Real>& ctrl );
+
+#define EL_NO_INT_PROTO
+#define EL_NO_COMPLEX_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
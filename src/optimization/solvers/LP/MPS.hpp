@@ -8,6 +8,17 @@
 */
 #include <El.hpp>
 
+#include <cstdlib>
+#include <cstring>
+
+#if defined(__unix__) || defined(__APPLE__)
+# include <fcntl.h>
+# include <sys/mman.h>
+# include <sys/stat.h>
+# include <unistd.h>
+# define EL_MPS_MMAP
+#endif
+
 namespace El {
 
 // Please see http://lpsolve.sourceforge.net/5.5/mps-format.htm for a very
@@ -16,6 +27,13 @@ namespace El {
 // An important, but seemingly not widely discussed, issue is that some of the
 // lp_data LP examples (e.g., tuff.mps) are not well-formed. I found out the
 // hard way that the fourth equality constraint of tuff.mps is empty.
+//
+// The file is tokenized in place (after memory-mapping it when possible):
+// row and variable names are looked up through hash tables which refer back
+// into the file contents, so that no strings are allocated per entry. A
+// single pass extracts the metadata and the right-hand sides and bounds, and
+// the entries of the (typically dominant) COLUMNS section are then produced
+// by rescanning the in-memory section, optionally only for a range of rows.
 
 // TODO(poulson): Allow the default lower and upper bounds to be configurable.
 
@@ -41,7 +59,7 @@ enum MPSRowType {
 struct MPSRowData
 {
   MPSRowType type;
-  Int typeIndex;
+  Int typeIndex=-1; // Left negative for deleted (empty) constraint rows.
   Int numNonzeros=0; // We will delete rows with no nonzeros (e.g., for tuff).
 };
 
@@ -96,10 +114,8 @@ struct MPSMeta
   Int numGreaterRows=0;
   Int numEqualityRows=0;
   Int numNonconstrainingRows=0;
-  std::map<string,MPSRowData> rowDict;
 
   // From the COLUMNS section
-  std::map<string,MPSVariableData> variableDict;
   Int numEqualityEntries=0;
   Int numInequalityEntries=0;
 
@@ -142,6 +158,23 @@ struct MPSMeta
       nonpositiveOffset=-1,
       nonnegativeOffset=-1;
 
+  // Set the row offsets and the dimensions 'm' and 'k' from the row and
+  // bound counts (the number of variables, 'n', should already be set).
+  void SetOffsets()
+  {
+      equalityOffset = 0;
+      fixedOffset = numEqualityRows;
+      m = fixedOffset + numFixedBounds;
+
+      lesserOffset = 0;
+      greaterOffset = numLesserRows;
+      upperBoundOffset = greaterOffset + numGreaterRows;
+      lowerBoundOffset = upperBoundOffset + numUpperBounds;
+      nonpositiveOffset = lowerBoundOffset + numLowerBounds;
+      nonnegativeOffset = nonpositiveOffset + numNonpositiveBounds;
+      k = nonnegativeOffset + numNonnegativeBounds;
+  }
+
   void PrintSummary() const
   {
       Output("MPSMeta summary:");
@@ -182,6 +215,269 @@ struct AffineLPEntry
   Real value;
 };
 
+// A read-only view of the contents of a file, which is memory-mapped when
+// possible so that it can be tokenized in place.
+class MPSBuffer
+{
+public:
+    explicit MPSBuffer( const string& filename );
+    ~MPSBuffer();
+    MPSBuffer( const MPSBuffer& ) = delete;
+    MPSBuffer& operator=( const MPSBuffer& ) = delete;
+
+    const char* Begin() const { return begin_; }
+    const char* End() const { return end_; }
+
+private:
+    const char* begin_=nullptr;
+    const char* end_=nullptr;
+#ifdef EL_MPS_MMAP
+    void* mapping_=nullptr;
+    size_t mappingSize_=0;
+#endif
+    vector<char> contents_;
+};
+
+MPSBuffer::MPSBuffer( const string& filename )
+{
+    EL_DEBUG_CSE
+#ifdef EL_MPS_MMAP
+    const int fd = open( filename.c_str(), O_RDONLY );
+    if( fd < 0 )
+        RuntimeError("Could not open ",filename);
+    struct stat fileStat;
+    if( fstat( fd, &fileStat ) != 0 )
+    {
+        close( fd );
+        RuntimeError("Could not determine the size of ",filename);
+    }
+    mappingSize_ = fileStat.st_size;
+    if( mappingSize_ > 0 )
+    {
+        mapping_ = mmap( nullptr, mappingSize_, PROT_READ, MAP_PRIVATE, fd, 0 );
+        if( mapping_ == MAP_FAILED )
+        {
+            close( fd );
+            RuntimeError("Could not map ",filename);
+        }
+        begin_ = static_cast<const char*>(mapping_);
+        end_ = begin_ + mappingSize_;
+    }
+    close( fd );
+#else
+    std::ifstream file( filename.c_str(), std::ios::binary );
+    if( !file.is_open() )
+        RuntimeError("Could not open ",filename);
+    contents_.resize( FileSize( file ) );
+    file.read( contents_.data(), contents_.size() );
+    if( !file )
+        RuntimeError("Could not read ",filename);
+    begin_ = contents_.data();
+    end_ = begin_ + contents_.size();
+#endif
+}
+
+MPSBuffer::~MPSBuffer()
+{
+#ifdef EL_MPS_MMAP
+    if( mapping_ != nullptr )
+        munmap( mapping_, mappingSize_ );
+#endif
+}
+
+// A token within the file buffer
+struct MPSToken
+{
+  const char* data=nullptr;
+  Int size=0;
+
+  bool Equals( const char* str ) const
+  { return Int(std::strlen(str)) == size && std::memcmp(data,str,size) == 0; }
+  bool Equals( const string& str ) const
+  { return Int(str.size()) == size && std::memcmp(data,str.data(),size) == 0; }
+  string ToString() const { return string(data,size); }
+};
+
+inline bool operator==( const MPSToken& a, const MPSToken& b )
+{ return a.size == b.size && std::memcmp(a.data,b.data,a.size) == 0; }
+
+// The same (lexicographic) ordering as std::string
+inline bool operator<( const MPSToken& a, const MPSToken& b )
+{
+    const int cmp = std::memcmp( a.data, b.data, Min(a.size,b.size) );
+    return cmp < 0 || (cmp == 0 && a.size < b.size);
+}
+
+inline bool IsMPSWhitespace( char c )
+{ return c == ' ' || c == '\t' || c == '\r' || c == '\f' || c == '\v'; }
+
+// Split [beg,end) into whitespace-separated tokens, storing at most
+// 'maxTokens' of them and returning the total number of tokens.
+inline Int Tokenize
+( const char* beg, const char* end, MPSToken* tokens, Int maxTokens )
+{
+    Int numTokens = 0;
+    const char* pos = beg;
+    while( true )
+    {
+        while( pos != end && IsMPSWhitespace(*pos) )
+            ++pos;
+        if( pos == end )
+            break;
+        const char* tokenBeg = pos;
+        while( pos != end && !IsMPSWhitespace(*pos) )
+            ++pos;
+        if( numTokens < maxTokens )
+        {
+            tokens[numTokens].data = tokenBeg;
+            tokens[numTokens].size = pos - tokenBeg;
+        }
+        ++numTokens;
+    }
+    return numTokens;
+}
+
+// Advance 'pos' past the next line and return the line (without the newline)
+inline void NextLine
+( const char*& pos, const char* end,
+  const char*& lineBeg, const char*& lineEnd )
+{
+    lineBeg = pos;
+    lineEnd =
+      static_cast<const char*>(std::memchr( pos, '\n', end-pos ));
+    if( lineEnd == nullptr )
+    {
+        lineEnd = end;
+        pos = end;
+    }
+    else
+        pos = lineEnd + 1;
+}
+
+inline double ParseMPSValue( const MPSToken& token, const char* section )
+{
+    // Copy into a (stack) buffer so that the value is null-terminated
+    char buffer[64];
+    if( token.size >= Int(sizeof(buffer)) )
+        LogicError("Invalid '",section,"' value ",token.ToString());
+    MemCopy( buffer, token.data, token.size );
+    buffer[token.size] = '\0';
+    char* valueEnd;
+    const double value = std::strtod( buffer, &valueEnd );
+    if( valueEnd != buffer+token.size )
+        LogicError("Invalid '",section,"' value ",token.ToString());
+    return value;
+}
+
+// An open-addressing hash table from the names within the buffer to the
+// (consecutive) indices they were inserted with.
+class MPSNameTable
+{
+public:
+    // Return the index of the name, or -1 if it was not found.
+    Int Find( const MPSToken& name ) const;
+
+    // Return the index of the name after inserting it if it was not found.
+    Int Insert( const MPSToken& name, bool& inserted );
+
+    Int Size() const { return names_.size(); }
+    const MPSToken& Name( Int index ) const { return names_[index]; }
+
+private:
+    vector<MPSToken> names_;
+    vector<Int> slots_;
+
+    static size_t Hash( const MPSToken& name );
+    void Grow();
+};
+
+size_t MPSNameTable::Hash( const MPSToken& name )
+{
+    // 64-bit FNV-1a
+    unsigned long long hash = 14695981039346656037ULL;
+    for( Int i=0; i<name.size; ++i )
+    {
+        hash ^= static_cast<unsigned char>(name.data[i]);
+        hash *= 1099511628211ULL;
+    }
+    return size_t(hash);
+}
+
+Int MPSNameTable::Find( const MPSToken& name ) const
+{
+    if( slots_.empty() )
+        return -1;
+    const size_t mask = slots_.size()-1;
+    for( size_t slot=Hash(name)&mask; ; slot=(slot+1)&mask )
+    {
+        const Int index = slots_[slot];
+        if( index < 0 )
+            return -1;
+        if( names_[index] == name )
+            return index;
+    }
+}
+
+void MPSNameTable::Grow()
+{
+    const size_t numSlots = Max( size_t(1024), 2*slots_.size() );
+    slots_.assign( numSlots, -1 );
+    const size_t mask = numSlots-1;
+    for( Int index=0; index<Int(names_.size()); ++index )
+    {
+        size_t slot = Hash(names_[index]) & mask;
+        while( slots_[slot] >= 0 )
+            slot = (slot+1) & mask;
+        slots_[slot] = index;
+    }
+}
+
+Int MPSNameTable::Insert( const MPSToken& name, bool& inserted )
+{
+    // Keep the load factor at most one half
+    if( 2*(names_.size()+1) > slots_.size() )
+        Grow();
+    const size_t mask = slots_.size()-1;
+    size_t slot = Hash(name) & mask;
+    for( ; slots_[slot] >= 0; slot=(slot+1)&mask )
+    {
+        const Int index = slots_[slot];
+        if( names_[index] == name )
+        {
+            inserted = false;
+            return index;
+        }
+    }
+    const Int index = names_.size();
+    names_.push_back( name );
+    slots_[slot] = index;
+    inserted = true;
+    return index;
+}
+
+// The binary cache of a parsed MPS file (see 'CacheMPS') consists of
+//
+//   long long header[CACHE_HEADER_SIZE],
+//   char names[...] (the name, cost, bound, and RHS names, padded to a
+//                    multiple of eight bytes),
+//
+// followed by, for each of the five AffineLPMatrixType's (in order),
+//
+//   long long rows[numEntries], long long columns[numEntries],
+//   double values[numEntries],
+//
+// where the entries are sorted by row, then column.
+namespace mps_cache {
+
+const long long MAGIC = 0x454c4d50; // "ELMP"
+const long long VERSION = 1;
+const Int HEADER_SIZE = 28;
+const Int NUM_SECTIONS = 5;
+
+inline Int PaddedSize( Int numBytes ) { return 8*((numBytes+7)/8); }
+
+} // namespace mps_cache
+
 // We form the primal problem
 //
 //   arginf_{x,s} { c^T x | A x = b, G x + s = h, s >= 0 },
@@ -213,6 +509,9 @@ struct AffineLPEntry
 // set of nonpositive bounds, and 'G5 x <= h5' is the set of nonnegative
 // bounds.
 //
+// The reader also accepts binary caches produced by 'CacheMPS' in place of
+// MPS files.
+//
 class MPSReader
 {
 public:
@@ -224,6 +523,15 @@ public:
     // The PILOT netlib lp_data model appears to require
     // 'keepNonnegativeWithZeroUpperBound=true'.
 
+    // Only enqueue the entries of 'A' (and 'G') which lie within the rows
+    // [firstA,firstA+numA) (and [firstG,firstG+numG)).
+    void RestrictRows( Int firstA, Int numA, Int firstG, Int numG );
+
+    // The number of entries of 'A' and 'G' (within the restricted rows) which
+    // will be enqueued.
+    Int NumEqualityEntries() const;
+    Int NumInequalityEntries() const;
+
     // Attempt to enqueue another entry and return true if successful.
     bool QueuedEntry();
 
@@ -233,37 +541,67 @@ public:
     const MPSMeta& Meta() const;
 
 private:
+    enum MPSPhase {
+      MPS_PHASE_COLUMNS,
+      MPS_PHASE_RHS,
+      MPS_PHASE_BOUNDS,
+      MPS_PHASE_DONE
+    };
+
+    static const Int MAX_TOKENS = 6;
+
     string filename_;
-    std::ifstream file_;
+    MPSBuffer buffer_;
+    bool cached_=false;
 
     bool minimize_;
     bool keepNonnegativeWithZeroUpperBound_;
     MPSMeta meta_;
 
-    vector<AffineLPEntry<double>> queuedEntries_;
+    vector<MPSRowData> rows_;
+    MPSNameTable rowTable_;
+    vector<MPSVariableData> variables_;
+    MPSNameTable variableTable_;
 
-    MPSSection section_=MPS_NONE;
+    // The (original) row indices and values of the RHS section
+    vector<Int> rhsRows_;
+    vector<double> rhsValues_;
 
-    // The RHS section typically has a name followed by either one or two pairs
-    // per row, but some models (e.g., dfl001.mps) do not involve a name.
-    bool initializedRHSSection_=false;
-    bool rhsHasName_;
+    // The lines of the COLUMNS section
+    const char* columnsBeg_=nullptr;
+    const char* columnsEnd_=nullptr;
 
-    // The BOUNDS section typically has a bound type marker, followed by a
-    // bound set name, followed by a variable name, and, if applicable,
-    // a numeric value). But some models (e.g., dfl001.mps) do not involve a
-    // bound set name.
-    bool initializedBoundsSection_=false;
-    bool boundsHasName_;
+    // The restricted ranges of rows of 'A' and 'G'
+    Int firstA_=0, lastA_=-1, firstG_=0, lastG_=-1;
 
-    // Temporaries for the metadata extraction process.
-    string line_;
-    string token_, rowType_, rowName_, variableName_, boundMark_;
-    double value_;
+    // The state of the 'QueuedEntry'/'GetEntry' cycle
+    MPSPhase phase_=MPS_PHASE_COLUMNS;
+    const char* cursor_=nullptr;
+    Int rhsIndex_=0, variableIndex_=0;
+    MPSToken lastVariableName_;
+    Int lastVariable_=-1;
+    vector<AffineLPEntry<double>> queuedEntries_;
 
-    // For the final loop over the variable dictionary to extract the
-    // nonpositive and nonnegative bounds.
-    typename std::map<string,MPSVariableData>::const_iterator variableIter_;
+    // The sections of a binary cache, the current section, and the current
+    // and final entries of the current section
+    const long long* cacheRows_[mps_cache::NUM_SECTIONS];
+    const long long* cacheColumns_[mps_cache::NUM_SECTIONS];
+    const double* cacheValues_[mps_cache::NUM_SECTIONS];
+    Int cacheSizes_[mps_cache::NUM_SECTIONS];
+    Int cacheSection_=0, cacheIndex_=0, cacheEnd_=0;
+
+    void ParseFile();
+    void FinalizeRows();
+    void FinalizeBounds();
+    void LoadCache();
+
+    bool InRestrictedRows( AffineLPMatrixType type, Int row ) const;
+    void QueueEntry
+    ( AffineLPMatrixType type, Int row, Int column, double value );
+    void QueueColumnsLine( const char* lineBeg, const char* lineEnd );
+    void QueueRHS( Int rhsIndex );
+    void QueueBounds( const MPSVariableData& data );
+    void StartCacheSection();
 };
 
 MPSReader::MPSReader
@@ -272,45 +610,79 @@ MPSReader::MPSReader
   bool minimize,
   bool keepNonnegativeWithZeroUpperBound )
 : filename_(filename),
-  file_(filename.c_str()),
+  buffer_(filename),
   minimize_(minimize),
   keepNonnegativeWithZeroUpperBound_(keepNonnegativeWithZeroUpperBound)
 {
     EL_DEBUG_CSE
     if( compressed )
         LogicError("Compressed reads are not yet supported");
-    if( !file_.is_open() )
-        RuntimeError("Could not open ",filename);
 
-    // Rather than assuming that std::map<string,Int>::size() is constant-time,
-    // we can maintain counters for the sizes of the variable dictionary.
-    Int variableCounter=0;
+    const Int numBytes = buffer_.End() - buffer_.Begin();
+    if( numBytes >= Int(sizeof(long long)) )
+    {
+        long long magic;
+        MemCopy
+        ( reinterpret_cast<char*>(&magic), buffer_.Begin(), sizeof(magic) );
+        cached_ = ( magic == mps_cache::MAGIC );
+    }
+    if( cached_ )
+    {
+        LoadCache();
+        return;
+    }
+
+    ParseFile();
+    FinalizeRows();
+    FinalizeBounds();
+
+    // Extract the number of variables
+    // (the matrix 'A' is 'm x n' and 'G' is 'k x n').
+    meta_.n = variables_.size();
+    meta_.SetOffsets();
+
+    // Now that the initial pass over the file is done, we can set up for the
+    // 'QueuedEntry'/'GetEntry' cycle over the COLUMNS section.
+    cursor_ = columnsBeg_;
+}
+
+void MPSReader::ParseFile()
+{
+    EL_DEBUG_CSE
+    // The RHS section typically has a name followed by either one or two pairs
+    // per row, but some models (e.g., dfl001.mps) do not involve a name.
+    bool initializedRHSSection=false;
+    bool rhsHasName=false;
+
+    // The BOUNDS section typically has a bound type marker, followed by a
+    // bound set name, followed by a variable name, and, if applicable,
+    // a numeric value). But some models (e.g., dfl001.mps) do not involve a
+    // bound set name.
+    bool initializedBoundsSection=false;
+    bool boundsHasName=false;
 
-    // Temporaries for the metadata extraction process.
-    string token, rowType, rowName, variableName, boundMark;
-    string rhsNameCandidate, boundNameCandidate;
-    double value;
+    bool haveRows=false, haveColumns=false, haveBounds=false;
+    MPSToken tokens[MAX_TOKENS];
 
     // TODO(poulson): Convert each token to upper-case letters before each
     // comparison. While capital letters are used by convention, they are
     // not required.
     MPSSection section = MPS_NONE;
-    string line;
-    while( std::getline( file_, line ) )
+    const char* pos = buffer_.Begin();
+    const char* end = buffer_.End();
+    const char *lineBeg, *lineEnd;
+    while( pos != end )
     {
-        // We first determine which section we are in
-        // ------------------------------------------
-        std::stringstream sectionStream( line );
-        const char firstChar = sectionStream.peek();
-        const bool isDataLine =
-          firstChar == ' ' ||
-          firstChar == '\t' ||
-          firstChar == '*' ||
-          firstChar == '#';
-
-        // The first token on each line should be a string. We will check it for
-        // equivalence with each section string.
-        if( !(sectionStream >> token) )
+        NextLine( pos, end, lineBeg, lineEnd );
+        if( lineBeg == lineEnd || *lineBeg == '*' || *lineBeg == '#' )
+        {
+            // This line is either empty or a comment.
+            continue;
+        }
+        const bool isDataLine = ( *lineBeg == ' ' || *lineBeg == '\t' );
+        const Int numTokens =
+          Tokenize( lineBeg, lineEnd, tokens, MAX_TOKENS );
+        if( numTokens == 0 )
         {
             // This line only consists of whitespace.
             continue;
@@ -318,70 +690,71 @@ MPSReader::MPSReader
 
         if( !isDataLine )
         {
-            if( token == "NAME" )
+            // The first token should be a section string.
+            const MPSToken& token = tokens[0];
+            if( section == MPS_COLUMNS )
+                columnsEnd_ = lineBeg;
+            if( token.Equals("NAME") )
             {
                 if( meta_.name != "" )
                     LogicError("Multiple 'NAME' sections");
-                if( !(sectionStream >> meta_.name) )
+                if( numTokens < 2 )
                     LogicError("Missing 'NAME' string");
+                meta_.name = tokens[1].ToString();
                 section = MPS_NAME;
             }
-            else if( token == "OBJSENSE" )
+            else if( token.Equals("OBJSENSE") )
             {
                 LogicError("OBJSENSE is not yet handled");
             }
-            else if( token == "ROWS" )
+            else if( token.Equals("ROWS") )
             {
-                if( meta_.numLesserRows > 0 ||
-                    meta_.numGreaterRows > 0 ||
-                    meta_.numEqualityRows > 0 ||
-                    meta_.numNonconstrainingRows > 0 )
+                if( haveRows )
                     LogicError("Multiple ROWS sections");
+                haveRows = true;
                 section = MPS_ROWS;
             }
-            else if( token == "COLUMNS" )
+            else if( token.Equals("COLUMNS") )
             {
-                if( meta_.numEqualityEntries > 0 ||
-                    meta_.numInequalityEntries > 0 )
+                if( haveColumns )
                     LogicError("Multiple 'COLUMNS' sections");
+                haveColumns = true;
+                columnsBeg_ = columnsEnd_ = pos;
                 section = MPS_COLUMNS;
             }
-            else if( token == "RHS" )
+            else if( token.Equals("RHS") )
             {
                 section = MPS_RHS;
             }
-            else if( token == "BOUNDS" )
+            else if( token.Equals("BOUNDS") )
             {
-                if( meta_.numUpperBounds > 0 ||
-                    meta_.numLowerBounds > 0 ||
-                    meta_.numFixedBounds > 0 ||
-                    meta_.numFreeBounds > 0 ||
-                    meta_.numNonpositiveBounds > 0 ||
-                    meta_.numNonnegativeBounds > 0 )
+                if( haveBounds )
                     Output("WARNING: Multiple 'BOUNDS' sections");
+                haveBounds = true;
                 section = MPS_BOUNDS;
             }
-            else if( token == "RANGES" )
+            else if( token.Equals("RANGES") )
             {
                 section = MPS_RANGES;
                 LogicError("MPS 'RANGES' section is not yet supported");
             }
-            else if( token == "ENDATA" )
+            else if( token.Equals("ENDATA") )
             {
                 section = MPS_END;
                 break;
             }
-            else if( token == "MARKER" )
+            else if( token.Equals("MARKER") )
             {
                 LogicError("MPS 'MARKER' section is not yet supported");
             }
-            else if( token == "SOS" )
+            else if( token.Equals("SOS") )
             {
                 LogicError("MPS 'SOS' section is not yet supported");
             }
             else
             {
-                LogicError("Section token ",token," is not recognized");
+                LogicError
+                ("Section token ",token.ToString()," is not recognized");
             }
             continue;
         }
@@ -389,261 +762,188 @@ MPSReader::MPSReader
         // No section marker was found, so handle this data line.
         if( section == MPS_ROWS )
         {
-            std::stringstream rowStream( line );
-            if( !(rowStream >> rowType) )
-                LogicError("Invalid 'ROWS' section");
-            if( !(rowStream >> rowName) )
+            if( numTokens != 2 || tokens[0].size != 1 )
                 LogicError("Invalid 'ROWS' section");
             MPSRowData rowData;
-            // We set the 'typeIndex' fields later since it is not uncommon
-            // (e.g., see tuff.mps) for rows to be empty.
-            if( rowType == "L" )
-            {
+            // We set the 'typeIndex' fields of the constraint rows later
+            // since it is not uncommon (e.g., see tuff.mps) for rows to be
+            // empty.
+            const char rowType = tokens[0].data[0];
+            if( rowType == 'L' )
                 rowData.type = MPS_LESSER_ROW;
-                meta_.rowDict[rowName] = rowData;
-            }
-            else if( rowType == "G" )
-            {
+            else if( rowType == 'G' )
                 rowData.type = MPS_GREATER_ROW;
-                meta_.rowDict[rowName] = rowData;
-            }
-            else if( rowType == "E" )
-            {
+            else if( rowType == 'E' )
                 rowData.type = MPS_EQUALITY_ROW;
-                meta_.rowDict[rowName] = rowData;
-            }
-            else if( rowType == "N" )
+            else if( rowType == 'N' )
             {
+                // The first nonconstraining row is the objective
                 rowData.type = MPS_NONCONSTRAINING_ROW;
-                meta_.rowDict[rowName] = rowData;
-                if( meta_.numNonconstrainingRows == 1 )
-                    meta_.costName = rowName;
+                rowData.typeIndex = meta_.numNonconstrainingRows++;
+                if( rowData.typeIndex == 0 )
+                    meta_.costName = tokens[1].ToString();
             }
             else
                 LogicError("Invalid 'ROWS' section");
+            bool inserted;
+            rowTable_.Insert( tokens[1], inserted );
+            if( !inserted )
+                LogicError("Duplicate row ",tokens[1].ToString());
+            rows_.push_back( rowData );
         }
         else if( section == MPS_COLUMNS )
         {
-            std::stringstream columnStream( line );
-            if( !(columnStream >> variableName) )
+            // There should be either one or two (row,value) pairs
+            if( numTokens != 3 && numTokens != 5 )
                 LogicError("Invalid 'COLUMNS' section");
-            auto variableIter = meta_.variableDict.find( variableName );
-            if( variableIter == meta_.variableDict.end() )
+            bool inserted;
+            const Int variable = variableTable_.Insert( tokens[0], inserted );
+            if( inserted )
             {
                 MPSVariableData variableData;
-                variableData.index = variableCounter++;
-                meta_.variableDict[variableName] = variableData;
-                variableIter = meta_.variableDict.find( variableName );
+                variableData.index = variable;
+                variables_.push_back( variableData );
             }
-            MPSVariableData& variableData = variableIter->second;
-
-            // There should be either one or two pairs of entries left to read
-            // from this line.
-            for( Int pair=0; pair<2; ++pair )
+            MPSVariableData& variableData = variables_[variable];
+            for( Int pair=0; 2*pair+1<numTokens; ++pair )
             {
-                if( !(columnStream >> rowName) )
-                {
-                    if( pair == 0 )
-                        LogicError("Invalid 'COLUMNS' section");
-                    else
-                        break;
-                }
-                if( !(columnStream >> value) )
-                    LogicError("Invalid 'COLUMNS' section");
+                const MPSToken& rowName = tokens[2*pair+1];
+                const Int row = rowTable_.Find( rowName );
+                if( row < 0 )
+                    LogicError("Could not find row ",rowName.ToString());
+                MPSRowData& rowData = rows_[row];
                 ++variableData.numNonzeros;
-
-                auto rowIter = meta_.rowDict.find( rowName );
-                if( rowIter == meta_.rowDict.end() )
-                    LogicError("Could not find row ",rowName);
-                auto& rowData = rowIter->second;
+                ++rowData.numNonzeros;
                 if( rowData.type == MPS_EQUALITY_ROW )
-                {
-                    // A(row,column) = value
                     ++meta_.numEqualityEntries;
-                    ++rowData.numNonzeros;
-                }
-                else if( rowData.type == MPS_LESSER_ROW )
-                {
-                    // G(row,column) = value
-                    ++meta_.numInequalityEntries;
-                    ++rowData.numNonzeros;
-                }
-                else if( rowData.type == MPS_GREATER_ROW )
-                {
-                    // G(row,column) = -value
+                else if( rowData.type == MPS_LESSER_ROW ||
+                         rowData.type == MPS_GREATER_ROW )
                     ++meta_.numInequalityEntries;
-                    ++rowData.numNonzeros;
-                }
-                else if( rowData.type == MPS_NONCONSTRAINING_ROW )
-                {
-                    // c(column) = value (assuming typeIndex==0)
-                    ++rowData.numNonzeros;
-                }
-                else
-                    LogicError("Unknown row data type");
             }
         }
         else if( section == MPS_RHS )
         {
-            if( !initializedRHSSection_ )
+            if( !initializedRHSSection )
             {
-                std::stringstream rhsTestStream( line );
-                Int numTokens=0;
-                string rhsToken;
-                while( rhsTestStream >> rhsToken )
-                    ++numTokens;
                 if( numTokens == 2 || numTokens == 4 )
                 {
                     // There were either one or two pairs with no name.
-                    rhsHasName_ = false;
+                    rhsHasName = false;
                     meta_.numRHS = 1;
                 }
                 else if( numTokens == 3 || numTokens == 5 )
                 {
                     // There were either one or two pairs with a name.
-                    rhsHasName_ = true;
+                    rhsHasName = true;
                 }
                 else
                 {
                     LogicError("Invalid 'RHS' section (1)");
                 }
-                
-                initializedRHSSection_ = true;
+                initializedRHSSection = true;
             }
-
-            std::stringstream rhsStream( line );
-            if( rhsHasName_ )
+            const Int offset = ( rhsHasName ? 1 : 0 );
+            if( numTokens != offset+2 && numTokens != offset+4 )
+                LogicError("Invalid 'RHS' section (2)");
+            if( rhsHasName )
             {
-                if( !(rhsStream >> rhsNameCandidate) )
-                    LogicError("Invalid 'RHS' section (2)");
                 if( meta_.numRHS == 0 )
                 {
                     // We should currently have that rhsName == "".
-                    meta_.rhsName = rhsNameCandidate;
+                    meta_.rhsName = tokens[0].ToString();
                     meta_.numRHS = 1;
                 }
-                else if( rhsNameCandidate != meta_.rhsName )
+                else if( !tokens[0].Equals(meta_.rhsName) )
                     LogicError
                     ("Only single problem instances are currently supported "
                      "(multiple right-hand side names were encountered)");
             }
 
-            // There should be either one or two pairs of entries left to read
-            // from this line.
-            for( Int pair=0; pair<2; ++pair )
+            // There should be either one or two pairs of entries left.
+            for( Int pair=0; offset+2*pair<numTokens; ++pair )
             {
-                if( !(rhsStream >> rowName) )
-                {
-                    if( pair == 0 )
-                        LogicError("Invalid 'RHS' section (3)");
-                    else
-                        break;
-                }
-                if( !(rhsStream >> value) )
-                    LogicError("Invalid 'RHS' section (4)");
+                const MPSToken& rowName = tokens[offset+2*pair];
+                const Int row = rowTable_.Find( rowName );
+                if( row < 0 )
+                    LogicError("Could not find row ",rowName.ToString());
+                rhsRows_.push_back( row );
+                rhsValues_.push_back
+                ( ParseMPSValue( tokens[offset+2*pair+1], "RHS" ) );
             }
         }
         else if( section == MPS_BOUNDS )
         {
-            if( !initializedBoundsSection_ )
-            {
-                std::stringstream boundsTestStream( line );
-                if( !(boundsTestStream >> boundMark) )
-                    LogicError("Invalid 'BOUNDS' section");
-                if( !(boundsTestStream >> token) )
-                    LogicError("Invalid 'BOUNDS' section");
-
-                Int numTokens=2;
-                string rhsToken;
-                while( boundsTestStream >> rhsToken )
-                    ++numTokens;
-                if( boundMark == "LO" ||
-                    boundMark == "UP" ||
-                    boundMark == "FX" )
-                {
-                    if( numTokens == 4 )
-                        boundsHasName_ = true;
-                    else if( numTokens == 3 )
-                        boundsHasName_ = false;
-                    else
-                        LogicError("Invalid ",boundMark," 'BOUNDS' line");
-                }
-                else if( boundMark == "FR" ||
-                         boundMark == "MI" ||
-                         boundMark == "PL" )
-                {
-                    if( numTokens == 3 )
-                        boundsHasName_ = true;
-                    else if( numTokens == 2 )
-                        boundsHasName_ = false;
-                    else
-                        LogicError("Invalid ",boundMark," 'BOUNDS' line");
-                }
-                else
-                    LogicError("Unknown bound mark ",boundMark);
-
-                // If there is a name, it occurred in the second position.
-                if( boundsHasName_ )
-                    meta_.boundName = token;
-
-                initializedBoundsSection_ = true;
-            }
-
-            std::stringstream boundStream( line );
-            // We already have the first token of a bounding row, which should
-            // be of the same general form as
+            // A bounding row should be of the same general form as
             //
             //   FX BOUNDROW VARIABLENAME 1734.
             //
             // in the case of 'VARIABLENAME' being fixed ('FX') at the value
             // 1734 (with this problem's bound name being 'BOUNDROW').
-            if( !(boundStream >> boundMark) )
-                LogicError("Invalid 'BOUNDS' section");
-            if( boundsHasName_ )
+            const MPSToken& boundMark = tokens[0];
+            const bool hasValue =
+              boundMark.Equals("LO") ||
+              boundMark.Equals("UP") ||
+              boundMark.Equals("FX");
+            const bool noValue =
+              boundMark.Equals("FR") ||
+              boundMark.Equals("MI") ||
+              boundMark.Equals("PL");
+            if( !hasValue && !noValue )
+                LogicError("Unknown bound mark ",boundMark.ToString());
+            if( !initializedBoundsSection )
             {
-                if( !(boundStream >> boundNameCandidate) )
-                    LogicError("Invalid 'BOUNDS' section");
-                if( meta_.boundName != boundNameCandidate )
+                const Int numUnnamed = ( hasValue ? 3 : 2 );
+                if( numTokens == numUnnamed+1 )
+                    boundsHasName = true;
+                else if( numTokens == numUnnamed )
+                    boundsHasName = false;
+                else
                     LogicError
-                    ("Only single problem instances are currently supported "
-                     "(multiple bound names were encountered)");
+                    ("Invalid ",boundMark.ToString()," 'BOUNDS' line");
+
+                // If there is a name, it occurred in the second position.
+                if( boundsHasName )
+                    meta_.boundName = tokens[1].ToString();
+
+                initializedBoundsSection = true;
             }
-            if( !(boundStream >> variableName) )
+            const Int offset = ( boundsHasName ? 2 : 1 );
+            if( numTokens != offset+(hasValue ? 2 : 1) )
                 LogicError("Invalid 'BOUNDS' section");
-            auto variableIter = meta_.variableDict.find( variableName );
-            if( variableIter == meta_.variableDict.end() )
+            if( boundsHasName && !tokens[1].Equals(meta_.boundName) )
                 LogicError
-                ("Invalid 'BOUNDS' section (name ",variableName," not found)");
-            MPSVariableData& data = variableIter->second;
-            if( boundMark == "UP" )
+                ("Only single problem instances are currently supported "
+                 "(multiple bound names were encountered)");
+            const MPSToken& variableName = tokens[offset];
+            const Int variable = variableTable_.Find( variableName );
+            if( variable < 0 )
+                LogicError
+                ("Invalid 'BOUNDS' section (name ",variableName.ToString(),
+                 " not found)");
+            MPSVariableData& data = variables_[variable];
+            const double value =
+              ( hasValue ? ParseMPSValue( tokens[offset+1], "BOUNDS" ) : 0. );
+            if( boundMark.Equals("UP") )
             {
-                if( !(boundStream >> value) )
-                    LogicError("Invalid 'BOUNDS' section");
                 data.upperBounded = true;
                 data.upperBound = value;
             }
-            else if( boundMark == "LO" )
+            else if( boundMark.Equals("LO") )
             {
-                if( !(boundStream >> value) )
-                    LogicError("Invalid 'BOUNDS' section");
                 data.lowerBounded = true;
                 data.lowerBound = value;
             }
-            else if( boundMark == "FX" )
+            else if( boundMark.Equals("FX") )
             {
-                if( !(boundStream >> value) )
-                    LogicError("Invalid 'BOUNDS' section");
                 data.fixed = true;
                 data.fixedValue = value;
             }
-            else if( boundMark == "FR" )
+            else if( boundMark.Equals("FR") )
                 data.free = true;
-            else if( boundMark == "MI" )
+            else if( boundMark.Equals("MI") )
                 data.nonpositive = true;
-            else if( boundMark == "PL" )
+            else /* boundMark == "PL" */
                 data.nonnegative = true;
-            else
-                LogicError("Invalid 'BOUNDS' section (unknown bound mark)");
         }
         else if( section == MPS_RANGES )
         {
@@ -654,6 +954,8 @@ MPSReader::MPSReader
             LogicError("Invalid MPS file");
         }
     }
+    if( section == MPS_COLUMNS )
+        columnsEnd_ = end;
     if( meta_.name == "" )
         LogicError("No nontrivial 'NAME' was found");
     if( meta_.numRHS == 0 )
@@ -661,62 +963,67 @@ MPSReader::MPSReader
         // Any unmentioned values are assumed to be zero.
         meta_.numRHS = 1;
     }
+}
 
-    // Iterate through the row map to delete any empty rows.
-    for( auto iter=meta_.rowDict.begin(); iter!=meta_.rowDict.end(); )
+void MPSReader::FinalizeRows()
+{
+    EL_DEBUG_CSE
+    // Delete any empty constraint rows and number the remaining ones in the
+    // (lexicographic) order of their names.
+    const Int numRows = rows_.size();
+    vector<Int> order( numRows );
+    for( Int row=0; row<numRows; ++row )
+        order[row] = row;
+    std::sort
+    ( order.begin(), order.end(),
+      [&]( Int a, Int b ) { return rowTable_.Name(a) < rowTable_.Name(b); } );
+    for( const Int row : order )
     {
-        if( iter->second.numNonzeros == 0 )
+        MPSRowData& rowData = rows_[row];
+        if( rowData.type == MPS_NONCONSTRAINING_ROW )
         {
-            if( iter->second.type == MPS_NONCONSTRAINING_ROW )
-            {
+            if( rowData.numNonzeros == 0 && rowData.typeIndex == 0 )
                 Output("WARNING: Objective was entirely zero.");
-                iter->second.typeIndex = 0;
-                ++iter;
-            }
-            else
-            {
-                if( iter->second.type == MPS_EQUALITY_ROW )
-                    Output("WARNING: Deleting empty equality row ",iter->first);
-                else if( iter->second.type == MPS_GREATER_ROW )
-                    Output("WARNING: Deleting empty greater row ",iter->first);
-                else if( iter->second.type == MPS_LESSER_ROW )
-                    Output("WARNING: Deleting empty lesser row ",iter->first);
-                else
-                    LogicError("Unknown empty row type");
-                // Delete this entry.
-                iter = meta_.rowDict.erase(iter);
-            }
         }
-        else
+        else if( rowData.numNonzeros == 0 )
         {
-            if( iter->second.type == MPS_EQUALITY_ROW )
-            {
-                iter->second.typeIndex = meta_.numEqualityRows++;
-            }
-            else if( iter->second.type == MPS_GREATER_ROW )
-            {
-                iter->second.typeIndex = meta_.numGreaterRows++;
-            }
-            else if( iter->second.type == MPS_LESSER_ROW )
-            {
-                iter->second.typeIndex = meta_.numLesserRows++;
-            }
-            else if( iter->second.type == MPS_NONCONSTRAINING_ROW )
-            {
-                iter->second.typeIndex = 0;
-            }
+            const string name = rowTable_.Name(row).ToString();
+            if( rowData.type == MPS_EQUALITY_ROW )
+                Output("WARNING: Deleting empty equality row ",name);
+            else if( rowData.type == MPS_GREATER_ROW )
+                Output("WARNING: Deleting empty greater row ",name);
             else
-                LogicError("Unknown row type");
-            ++iter;
+                Output("WARNING: Deleting empty lesser row ",name);
+            rowData.typeIndex = -1;
         }
+        else if( rowData.type == MPS_EQUALITY_ROW )
+            rowData.typeIndex = meta_.numEqualityRows++;
+        else if( rowData.type == MPS_GREATER_ROW )
+            rowData.typeIndex = meta_.numGreaterRows++;
+        else
+            rowData.typeIndex = meta_.numLesserRows++;
     }
+}
 
-    // Now iterate through the variable map and make use of the requested
-    // conventions for counting the number of bounds of each type.
+void MPSReader::FinalizeBounds()
+{
+    EL_DEBUG_CSE
+    // Iterate through the variables (in the lexicographic order of their
+    // names) and make use of the requested conventions for counting the
+    // number of bounds of each type.
     // Also warn if there are possibly conflicting bound types.
-    for( auto& entry : meta_.variableDict )
+    const Int numVariables = variables_.size();
+    vector<Int> order( numVariables );
+    for( Int variable=0; variable<numVariables; ++variable )
+        order[variable] = variable;
+    std::sort
+    ( order.begin(), order.end(),
+      [&]( Int a, Int b )
+      { return variableTable_.Name(a) < variableTable_.Name(b); } );
+    for( const Int variable : order )
     {
-        auto& data = entry.second;
+        auto& data = variables_[variable];
+        auto name = [&]() { return variableTable_.Name(variable).ToString(); };
 
         // Handle explicit upper and lower bounds.
         if( data.upperBounded )
@@ -736,7 +1043,7 @@ MPSReader::MPSReader
                     data.fixed = true;
                     data.fixedValue = data.upperBound;
                     Output
-                    ("WARNING: Fixing ",entry.first," since the lower and "
+                    ("WARNING: Fixing ",name()," since the lower and "
                      "upper bounds were both ",data.fixedValue);
                 }
                 else
@@ -744,7 +1051,7 @@ MPSReader::MPSReader
                     LogicError
                     ("Cannot enforce a lower bound of ",data.lowerBound,
                      " and an upper bound of ",data.upperBound," for ",
-                     entry.first);
+                     name());
                 }
             }
             else
@@ -771,7 +1078,7 @@ MPSReader::MPSReader
                         data.fixed = true;
                         data.fixedValue = 0.;
                         Output
-                        ("WARNING: Fixing ",entry.first,
+                        ("WARNING: Fixing ",name(),
                          " at zero due to zero upper bound. If this is not "
                          "desired, please set "
                          "'keepNonnegativeWithZeroUpperBound=false'");
@@ -783,7 +1090,7 @@ MPSReader::MPSReader
                         data.nonnegative = false;
                         Output
                         ("WARNING: Removing default non-negativity of ",
-                         entry.first," due to zero upper bound. If this is "
+                         name()," due to zero upper bound. If this is "
                          "not desired, please set "
                          "'keepNonnegativeWithZeroUpperBound=true'");
                     }
@@ -852,367 +1159,410 @@ MPSReader::MPSReader
             data.nonnegativeIndex = meta_.numNonnegativeBounds++;
         }
     }
+}
 
-    // Now that the initial pass over the file is done, we can set up for the
-    // 'QueuedEntry'/'GetEntry' cycle.
+void MPSReader::LoadCache()
+{
+    EL_DEBUG_CSE
+    const char* pos = buffer_.Begin();
+    const char* end = buffer_.End();
+    auto checkSize = [&]( Int numBytes )
+      {
+        if( end-pos < numBytes )
+            RuntimeError(filename_," is not a valid MPS cache");
+      };
+
+    long long header[mps_cache::HEADER_SIZE];
+    checkSize( sizeof(header) );
+    MemCopy( reinterpret_cast<char*>(header), pos, sizeof(header) );
+    pos += sizeof(header);
+    if( header[1] != mps_cache::VERSION )
+        RuntimeError("Unsupported MPS cache version ",header[1]);
+    if( bool(header[2]) != minimize_ ||
+        bool(header[3]) != keepNonnegativeWithZeroUpperBound_ )
+        LogicError
+        (filename_," was cached with minimize=",bool(header[2]),
+         " and keepNonnegativeWithZeroUpperBound=",bool(header[3]));
+    meta_.m = header[4];
+    meta_.n = header[5];
+    meta_.k = header[6];
+    meta_.numLesserRows = header[12];
+    meta_.numGreaterRows = header[13];
+    meta_.numEqualityRows = header[14];
+    meta_.numNonconstrainingRows = header[15];
+    meta_.numEqualityEntries = header[16];
+    meta_.numInequalityEntries = header[17];
+    meta_.numUpperBounds = header[18];
+    meta_.numLowerBounds = header[19];
+    meta_.numFixedBounds = header[20];
+    meta_.numFreeBounds = header[21];
+    meta_.numNonpositiveBounds = header[22];
+    meta_.numNonnegativeBounds = header[23];
+    meta_.numRHS = 1;
+    meta_.SetOffsets();
+    if( meta_.m != header[4] || meta_.k != header[6] )
+        RuntimeError(filename_," is not a valid MPS cache");
+
+    string* names[4] =
+      { &meta_.name, &meta_.costName, &meta_.boundName, &meta_.rhsName };
+    Int namesSize = 0;
+    for( Int i=0; i<4; ++i )
+        namesSize += header[24+i];
+    checkSize( mps_cache::PaddedSize(namesSize) );
+    const char* namePos = pos;
+    for( Int i=0; i<4; ++i )
+    {
+        names[i]->assign( namePos, header[24+i] );
+        namePos += header[24+i];
+    }
+    pos += mps_cache::PaddedSize(namesSize);
 
-    // Reset the file.
-    file_.clear();
-    file_.seekg( 0, std::ios::beg );
+    // The sections are 8-byte aligned since the mapping is page-aligned
+    for( Int section=0; section<mps_cache::NUM_SECTIONS; ++section )
+    {
+        const Int numEntries = header[7+section];
+        checkSize( numEntries*(2*sizeof(long long)+sizeof(double)) );
+        cacheSizes_[section] = numEntries;
+        cacheRows_[section] = reinterpret_cast<const long long*>(pos);
+        pos += numEntries*sizeof(long long);
+        cacheColumns_[section] = reinterpret_cast<const long long*>(pos);
+        pos += numEntries*sizeof(long long);
+        cacheValues_[section] = reinterpret_cast<const double*>(pos);
+        pos += numEntries*sizeof(double);
+    }
+    if( pos != end )
+        RuntimeError(filename_," is not a valid MPS cache");
+    cacheSection_ = 0;
+    StartCacheSection();
+}
 
-    // Extract the number of variables
-    // (the matrix 'A' is 'm x n' and 'G' is 'k x n').
-    meta_.n = meta_.variableDict.size();
-    variableIter_ = meta_.variableDict.cbegin();
-
-    //
-    //   | A0 | x = | b0 |
-    //   | A1 |     | b1 |
-    //
-    meta_.equalityOffset = 0;
-    meta_.fixedOffset = meta_.numEqualityRows;
-    meta_.m = meta_.fixedOffset + meta_.numFixedBounds;
-
-    //
-    //   | G0 | x <= | h0 |
-    //   | G1 |      | h1 |
-    //   | G2 |      | h2 |
-    //   | G3 |      | h3 |
-    //   | G4 |      | h4 |
-    //   | G5 |      | h5 |
-    //
-    meta_.lesserOffset = 0;
-    meta_.greaterOffset = meta_.numLesserRows;
-    meta_.upperBoundOffset = meta_.greaterOffset + meta_.numGreaterRows;
-    meta_.lowerBoundOffset = meta_.upperBoundOffset + meta_.numUpperBounds;
-    meta_.nonpositiveOffset = meta_.lowerBoundOffset + meta_.numLowerBounds;
-    meta_.nonnegativeOffset =
-      meta_.nonpositiveOffset + meta_.numNonpositiveBounds;
-    meta_.k = meta_.nonnegativeOffset + meta_.numNonnegativeBounds;
+void MPSReader::StartCacheSection()
+{
+    cacheIndex_ = 0;
+    cacheEnd_ = cacheSizes_[cacheSection_];
+    const auto type = AffineLPMatrixType(cacheSection_);
+    if( type != AFFINE_LP_EQUALITY_MATRIX &&
+        type != AFFINE_LP_INEQUALITY_MATRIX )
+        return;
+    const bool isA = ( type == AFFINE_LP_EQUALITY_MATRIX );
+    const Int first = ( isA ? firstA_ : firstG_ );
+    const Int last = ( isA ? lastA_ : lastG_ );
+    if( last < 0 )
+        return;
+    // Since the entries are sorted by row, only the restricted rows need to
+    // be touched
+    const long long* rows = cacheRows_[cacheSection_];
+    cacheIndex_ = std::lower_bound( rows, rows+cacheEnd_, first ) - rows;
+    cacheEnd_ = std::lower_bound( rows, rows+cacheEnd_, last ) - rows;
 }
 
-bool MPSReader::QueuedEntry()
+void MPSReader::RestrictRows( Int firstA, Int numA, Int firstG, Int numG )
 {
     EL_DEBUG_CSE
+    firstA_ = firstA;
+    lastA_ = firstA + numA;
+    firstG_ = firstG;
+    lastG_ = firstG + numG;
+    if( cached_ )
+    {
+        cacheSection_ = 0;
+        StartCacheSection();
+    }
+}
+
+bool MPSReader::InRestrictedRows( AffineLPMatrixType type, Int row ) const
+{
+    if( type == AFFINE_LP_EQUALITY_MATRIX )
+        return lastA_ < 0 || (row >= firstA_ && row < lastA_);
+    else if( type == AFFINE_LP_INEQUALITY_MATRIX )
+        return lastG_ < 0 || (row >= firstG_ && row < lastG_);
+    else
+        return true;
+}
 
-    while( queuedEntries_.size() == 0 &&
-           section_ != MPS_END &&
-           std::getline( file_, line_ ) )
+Int MPSReader::NumEqualityEntries() const
+{
+    EL_DEBUG_CSE
+    if( cached_ )
     {
-        std::stringstream sectionStream( line_ );
-        const char firstChar = sectionStream.peek();
-        const bool isDataLine =
-          firstChar == ' ' ||
-          firstChar == '\t' ||
-          firstChar == '*' ||
-          firstChar == '#';
-
-        // The first token on each line should be a string. We will check it for
-        // equivalence with each section string.
-        if( !(sectionStream >> token_) )
-        {
-            // This line only consists of whitespace.
-            continue;
-        }
+        const Int section = AFFINE_LP_EQUALITY_MATRIX;
+        const long long* rows = cacheRows_[section];
+        const Int numEntries = cacheSizes_[section];
+        if( lastA_ < 0 )
+            return numEntries;
+        return std::lower_bound( rows, rows+numEntries, lastA_ ) -
+               std::lower_bound( rows, rows+numEntries, firstA_ );
+    }
+    Int numEntries = 0;
+    for( const auto& rowData : rows_ )
+        if( rowData.type == MPS_EQUALITY_ROW && rowData.typeIndex >= 0 &&
+            InRestrictedRows
+            ( AFFINE_LP_EQUALITY_MATRIX,
+              meta_.equalityOffset+rowData.typeIndex ) )
+            numEntries += rowData.numNonzeros;
+    for( const auto& data : variables_ )
+        if( data.fixed &&
+            InRestrictedRows
+            ( AFFINE_LP_EQUALITY_MATRIX, meta_.fixedOffset+data.fixedIndex ) )
+            ++numEntries;
+    return numEntries;
+}
 
-        if( !isDataLine )
-        {
-            if( token_ == "NAME" )
-            {
-                section_ = MPS_NAME;
-            }
-            else if( token_ == "OBJSENSE" )
-            {
-                LogicError("OBJSENSE is not yet handled");
-            }
-            else if( token_ == "ROWS" )
-            {
-                section_ = MPS_ROWS;
-            }
-            else if( token_ == "COLUMNS" )
-            {
-                section_ = MPS_COLUMNS;
-            }
-            else if( token_ == "RHS" )
-            {
-                section_ = MPS_RHS;
-            }
-            else if( token_ == "BOUNDS" )
-            {
-                section_ = MPS_BOUNDS;
-            }
-            else if( token_ == "RANGES" )
-            {
-                section_ = MPS_RANGES;
-            }
-            else if( token_ == "ENDATA" )
-            {
-                section_ = MPS_END;
-                break;
-            }
-            else
-            {
-                LogicError("Section token ",token_," is not recognized");
-            }
+Int MPSReader::NumInequalityEntries() const
+{
+    EL_DEBUG_CSE
+    if( cached_ )
+    {
+        const Int section = AFFINE_LP_INEQUALITY_MATRIX;
+        const long long* rows = cacheRows_[section];
+        const Int numEntries = cacheSizes_[section];
+        if( lastG_ < 0 )
+            return numEntries;
+        return std::lower_bound( rows, rows+numEntries, lastG_ ) -
+               std::lower_bound( rows, rows+numEntries, firstG_ );
+    }
+    const auto type = AFFINE_LP_INEQUALITY_MATRIX;
+    Int numEntries = 0;
+    for( const auto& rowData : rows_ )
+    {
+        if( rowData.typeIndex < 0 )
             continue;
-        }
+        if( (rowData.type == MPS_LESSER_ROW &&
+             InRestrictedRows
+             ( type, meta_.lesserOffset+rowData.typeIndex )) ||
+            (rowData.type == MPS_GREATER_ROW &&
+             InRestrictedRows
+             ( type, meta_.greaterOffset+rowData.typeIndex )) )
+            numEntries += rowData.numNonzeros;
+    }
+    for( const auto& data : variables_ )
+    {
+        if( data.upperBounded &&
+            InRestrictedRows
+            ( type, meta_.upperBoundOffset+data.upperBoundIndex ) )
+            ++numEntries;
+        if( data.lowerBounded &&
+            InRestrictedRows
+            ( type, meta_.lowerBoundOffset+data.lowerBoundIndex ) )
+            ++numEntries;
+        if( data.nonpositive &&
+            InRestrictedRows
+            ( type, meta_.nonpositiveOffset+data.nonpositiveIndex ) )
+            ++numEntries;
+        if( data.nonnegative &&
+            InRestrictedRows
+            ( type, meta_.nonnegativeOffset+data.nonnegativeIndex ) )
+            ++numEntries;
+    }
+    return numEntries;
+}
 
-        // No section marker was found, so handle this data line.
-        if( section_ == MPS_ROWS )
-        {
-            // We already have the row names.
-        }
-        else if( section_ == MPS_COLUMNS )
-        {
-           double columnValue;
-           std::stringstream columnStream( line_ );
+void MPSReader::QueueEntry
+( AffineLPMatrixType type, Int row, Int column, double value )
+{
+    if( !InRestrictedRows( type, row ) )
+        return;
+    AffineLPEntry<double> entry;
+    entry.type = type;
+    entry.row = row;
+    entry.column = column;
+    entry.value = value;
+    queuedEntries_.push_back( entry );
+}
 
-           if( !(columnStream >> variableName_) )
-                LogicError("Invalid 'COLUMNS' section");
-            auto variableIter = meta_.variableDict.find( variableName_ );
-            if( variableIter == meta_.variableDict.end() )
-                LogicError("Could not find variable ",variableName_);
-            const MPSVariableData& variableData = variableIter->second;
-            const Int column = variableData.index;
-
-            // There should be either one or two pairs of entries left to read
-            // from this line.
-            for( Int pair=0; pair<2; ++pair )
-            {
-                if( !(columnStream >> rowName_) )
-                {
-                    if( pair == 0 )
-                        LogicError("Invalid 'COLUMNS' section");
-                    else
-                        break;
-                }
-                if( !(columnStream >> columnValue) )
-                    LogicError("Invalid 'COLUMNS' section");
-                auto rowIter = meta_.rowDict.find( rowName_ );
-                if( rowIter == meta_.rowDict.end() )
-                    LogicError("Could not find row ",rowName_);
-                const auto& rowData = rowIter->second;
-                AffineLPEntry<double> entry;
-                if( rowData.type == MPS_EQUALITY_ROW )
-                {
-                    // A(row,column) = columnValue
-                    const Int row = meta_.equalityOffset + rowData.typeIndex;
-                    entry.type = AFFINE_LP_EQUALITY_MATRIX;
-                    entry.row = row;
-                    entry.column = column;
-                    entry.value = columnValue;
-                    queuedEntries_.push_back( entry );
-                }
-                else if( rowData.type == MPS_LESSER_ROW )
-                {
-                    // G(row,column) = columnValue
-                    const Int row = meta_.lesserOffset + rowData.typeIndex;
-                    entry.type = AFFINE_LP_INEQUALITY_MATRIX;
-                    entry.row = row;
-                    entry.column = column;
-                    entry.value = columnValue;
-                    queuedEntries_.push_back( entry );
-                }
-                else if( rowData.type == MPS_GREATER_ROW )
-                {
-                    // G(row,column) = -columnValue
-                    const Int row = meta_.greaterOffset + rowData.typeIndex;
-                    entry.type = AFFINE_LP_INEQUALITY_MATRIX;
-                    entry.row = row;
-                    entry.column = column;
-                    entry.value = -columnValue;
-                    queuedEntries_.push_back( entry );
-                }
-                else if( rowData.type == MPS_NONCONSTRAINING_ROW )
-                {
-                    if( rowData.typeIndex == 0 )
-                    {
-                        // c(column) = columnValue
-                        entry.type = AFFINE_LP_COST_VECTOR;
-                        entry.row = column;
-                        entry.column = 0;
-                        entry.value = minimize_ ? columnValue : -columnValue;
-                        queuedEntries_.push_back( entry );
-                    }
-                    // else?
-                }
-            }
-        }
-        else if( section_ == MPS_RHS )
-        {
-            double rhsValue;
-            std::stringstream rhsStream( line_ );
+void MPSReader::QueueColumnsLine( const char* lineBeg, const char* lineEnd )
+{
+    MPSToken tokens[MAX_TOKENS];
+    const Int numTokens = Tokenize( lineBeg, lineEnd, tokens, MAX_TOKENS );
 
-            if( rhsHasName_ )
-            {
-                if( !(rhsStream >> token_) )
-                    LogicError("Invalid 'RHS' section");
-            }
+    // The lines of each variable are typically contiguous, so avoid
+    // rehashing repeated variable names
+    if( lastVariable_ < 0 || !(tokens[0] == lastVariableName_) )
+    {
+        lastVariable_ = variableTable_.Find( tokens[0] );
+        lastVariableName_ = tokens[0];
+    }
+    const Int column = variables_[lastVariable_].index;
 
-            // There should be either one or two pairs of entries left to read
-            // from this line.
-            for( Int pair=0; pair<2; ++pair )
-            {
-                if( !(rhsStream >> rowName_) )
-                {
-                    if( pair == 0 )
-                        LogicError("Invalid 'RHS' section");
-                    else
-                        break;
-                }
-                if( !(rhsStream >> rhsValue) )
-                    LogicError("Invalid 'RHS' section");
-                auto rowIter = meta_.rowDict.find( rowName_ );
-                if( rowIter == meta_.rowDict.end() )
-                    LogicError("Could not find row ",rowName_);
-                const auto& rowData = rowIter->second;
-                AffineLPEntry<double> entry;
-                if( rowData.type == MPS_EQUALITY_ROW )
-                {
-                    // b(row) = rhsValue
-                    const Int row = meta_.equalityOffset + rowData.typeIndex;
-                    entry.type = AFFINE_LP_EQUALITY_VECTOR;
-                    entry.row = row;
-                    entry.column = 0;
-                    entry.value = rhsValue;
-                    queuedEntries_.push_back( entry );
-                }
-                else if( rowData.type == MPS_LESSER_ROW )
-                {
-                    // h(row) = rhsValue
-                    const Int row = meta_.lesserOffset + rowData.typeIndex;
-                    entry.type = AFFINE_LP_INEQUALITY_VECTOR;
-                    entry.row = row;
-                    entry.column = 0;
-                    entry.value = rhsValue;
-                    queuedEntries_.push_back( entry );
-                }
-                else if( rowData.type == MPS_GREATER_ROW )
-                {
-                    // h(row) = -rhsValue
-                    const Int row = meta_.greaterOffset + rowData.typeIndex;
-                    entry.type = AFFINE_LP_INEQUALITY_VECTOR;
-                    entry.row = row;
-                    entry.column = 0;
-                    entry.value = -rhsValue;
-                    queuedEntries_.push_back( entry );
-                }
-                else if( rowData.type == MPS_NONCONSTRAINING_ROW )
-                {
-                    Output("WARNING: Nonsensical RHS for nonconstrained row");
-                }
-            }
+    // There should be either one or two pairs of entries left to read
+    // from this line.
+    for( Int pair=0; 2*pair+1<numTokens; ++pair )
+    {
+        const MPSRowData& rowData = rows_[rowTable_.Find( tokens[2*pair+1] )];
+        if( rowData.type == MPS_EQUALITY_ROW )
+        {
+            // A(row,column) = value
+            const Int row = meta_.equalityOffset + rowData.typeIndex;
+            if( InRestrictedRows( AFFINE_LP_EQUALITY_MATRIX, row ) )
+                QueueEntry
+                ( AFFINE_LP_EQUALITY_MATRIX, row, column,
+                  ParseMPSValue( tokens[2*pair+2], "COLUMNS" ) );
         }
-        else if( section_ == MPS_BOUNDS )
+        else if( rowData.type == MPS_LESSER_ROW )
         {
-            // All bounds are handled at the bottom of this routine.
+            // G(row,column) = value
+            const Int row = meta_.lesserOffset + rowData.typeIndex;
+            if( InRestrictedRows( AFFINE_LP_INEQUALITY_MATRIX, row ) )
+                QueueEntry
+                ( AFFINE_LP_INEQUALITY_MATRIX, row, column,
+                  ParseMPSValue( tokens[2*pair+2], "COLUMNS" ) );
         }
-        else if( section_ == MPS_RANGES )
+        else if( rowData.type == MPS_GREATER_ROW )
         {
-            LogicError("The 'RANGES' section is not yet supported");
+            // G(row,column) = -value
+            const Int row = meta_.greaterOffset + rowData.typeIndex;
+            if( InRestrictedRows( AFFINE_LP_INEQUALITY_MATRIX, row ) )
+                QueueEntry
+                ( AFFINE_LP_INEQUALITY_MATRIX, row, column,
+                  -ParseMPSValue( tokens[2*pair+2], "COLUMNS" ) );
         }
-        else
+        else if( rowData.typeIndex == 0 )
         {
-            LogicError("Invalid MPS file");
+            // c(column) = value
+            const double value = ParseMPSValue( tokens[2*pair+2], "COLUMNS" );
+            QueueEntry
+            ( AFFINE_LP_COST_VECTOR, column, 0, minimize_ ? value : -value );
         }
+        // Any additional nonconstraining rows are ignored.
     }
-    if( queuedEntries_.size() > 0 )
-        return true;
+}
 
-    // Now iterate through the variable map to handle the bounds.
-    AffineLPEntry<double> entry;
-    while( queuedEntries_.size() == 0 &&
-           variableIter_ != meta_.variableDict.end() )
+void MPSReader::QueueRHS( Int rhsIndex )
+{
+    const MPSRowData& rowData = rows_[rhsRows_[rhsIndex]];
+    const double value = rhsValues_[rhsIndex];
+    if( rowData.type == MPS_NONCONSTRAINING_ROW )
     {
-        const auto& data = variableIter_->second;
-        const Int column = data.index;
-
-        if( data.upperBounded )
-        {
-            const Int row = meta_.upperBoundOffset + data.upperBoundIndex;
-
-            // G(row,column) = 1
-            entry.type = AFFINE_LP_INEQUALITY_MATRIX;
-            entry.row = row;
-            entry.column = column;
-            entry.value = 1;
-            queuedEntries_.push_back( entry );
+        Output("WARNING: Nonsensical RHS for nonconstrained row");
+        return;
+    }
+    if( rowData.typeIndex < 0 )
+    {
+        Output
+        ("WARNING: Ignoring RHS of deleted row ",
+         rowTable_.Name(rhsRows_[rhsIndex]).ToString());
+        return;
+    }
+    if( rowData.type == MPS_EQUALITY_ROW )
+    {
+        // b(row) = value
+        QueueEntry
+        ( AFFINE_LP_EQUALITY_VECTOR,
+          meta_.equalityOffset+rowData.typeIndex, 0, value );
+    }
+    else if( rowData.type == MPS_LESSER_ROW )
+    {
+        // h(row) = value
+        QueueEntry
+        ( AFFINE_LP_INEQUALITY_VECTOR,
+          meta_.lesserOffset+rowData.typeIndex, 0, value );
+    }
+    else
+    {
+        // h(row) = -value
+        QueueEntry
+        ( AFFINE_LP_INEQUALITY_VECTOR,
+          meta_.greaterOffset+rowData.typeIndex, 0, -value );
+    }
+}
 
-            // h(row) = value
-            entry.type = AFFINE_LP_INEQUALITY_VECTOR;
-            entry.row = row;
-            entry.column = 0;
-            entry.value = data.upperBound;
-            queuedEntries_.push_back( entry );
-        }
+void MPSReader::QueueBounds( const MPSVariableData& data )
+{
+    const Int column = data.index;
+    if( data.upperBounded )
+    {
+        // G(row,column) = 1 and h(row) = value
+        const Int row = meta_.upperBoundOffset + data.upperBoundIndex;
+        QueueEntry( AFFINE_LP_INEQUALITY_MATRIX, row, column, 1 );
+        QueueEntry( AFFINE_LP_INEQUALITY_VECTOR, row, 0, data.upperBound );
+    }
+    if( data.lowerBounded )
+    {
+        // G(row,column) = -1 and h(row) = -value
+        const Int row = meta_.lowerBoundOffset + data.lowerBoundIndex;
+        QueueEntry( AFFINE_LP_INEQUALITY_MATRIX, row, column, -1 );
+        QueueEntry( AFFINE_LP_INEQUALITY_VECTOR, row, 0, -data.lowerBound );
+    }
+    if( data.fixed )
+    {
+        // A(row,column) = 1 and b(row) = value
+        const Int row = meta_.fixedOffset + data.fixedIndex;
+        QueueEntry( AFFINE_LP_EQUALITY_MATRIX, row, column, 1 );
+        QueueEntry( AFFINE_LP_EQUALITY_VECTOR, row, 0, data.fixedValue );
+    }
+    // There is no need to explicitly set h(row) to zero for the
+    // non-positive and non-negative bounds.
+    if( data.nonpositive )
+    {
+        // G(row,column) = 1
+        const Int row = meta_.nonpositiveOffset + data.nonpositiveIndex;
+        QueueEntry( AFFINE_LP_INEQUALITY_MATRIX, row, column, 1 );
+    }
+    if( data.nonnegative )
+    {
+        // G(row,column) = -1
+        const Int row = meta_.nonnegativeOffset + data.nonnegativeIndex;
+        QueueEntry( AFFINE_LP_INEQUALITY_MATRIX, row, column, -1 );
+    }
+}
 
-        if( data.lowerBounded )
+bool MPSReader::QueuedEntry()
+{
+    EL_DEBUG_CSE
+    if( cached_ )
+    {
+        while( queuedEntries_.size() == 0 &&
+               cacheSection_ < mps_cache::NUM_SECTIONS )
         {
-            const Int row = meta_.lowerBoundOffset + data.lowerBoundIndex;
-
-            // G(row,column) = -1
-            entry.type = AFFINE_LP_INEQUALITY_MATRIX;
-            entry.row = row;
-            entry.column = column;
-            entry.value = -1;
-            queuedEntries_.push_back( entry );
-
-            // h(row) = -value
-            entry.type = AFFINE_LP_INEQUALITY_VECTOR;
-            entry.row = row;
-            entry.column = 0;
-            entry.value = -data.lowerBound;
+            if( cacheIndex_ == cacheEnd_ )
+            {
+                if( ++cacheSection_ < mps_cache::NUM_SECTIONS )
+                    StartCacheSection();
+                continue;
+            }
+            AffineLPEntry<double> entry;
+            entry.type = AffineLPMatrixType(cacheSection_);
+            entry.row = cacheRows_[cacheSection_][cacheIndex_];
+            entry.column = cacheColumns_[cacheSection_][cacheIndex_];
+            entry.value = cacheValues_[cacheSection_][cacheIndex_];
             queuedEntries_.push_back( entry );
+            ++cacheIndex_;
         }
+        return queuedEntries_.size() > 0;
+    }
 
-        if( data.fixed )
+    while( queuedEntries_.size() == 0 && phase_ != MPS_PHASE_DONE )
+    {
+        if( phase_ == MPS_PHASE_COLUMNS )
         {
-            const Int row = meta_.fixedOffset + data.fixedIndex;
-
-            // A(row,column) = 1
-            entry.type = AFFINE_LP_EQUALITY_MATRIX;
-            entry.row = row;
-            entry.column = column;
-            entry.value = 1;
-            queuedEntries_.push_back( entry );
-
-            // h(row) = value
-            entry.type = AFFINE_LP_EQUALITY_VECTOR;
-            entry.row = row;
-            entry.column = 0;
-            entry.value = data.fixedValue;
-            queuedEntries_.push_back( entry );
+            if( cursor_ == columnsEnd_ )
+            {
+                phase_ = MPS_PHASE_RHS;
+                continue;
+            }
+            const char *lineBeg, *lineEnd;
+            NextLine( cursor_, columnsEnd_, lineBeg, lineEnd );
+            if( lineBeg == lineEnd || *lineBeg == '*' || *lineBeg == '#' )
+                continue;
+            MPSToken token;
+            if( Tokenize( lineBeg, lineEnd, &token, 1 ) == 0 )
+                continue;
+            QueueColumnsLine( lineBeg, lineEnd );
         }
-
-        // Handle non-positive values.
-        if( data.nonpositive )
+        else if( phase_ == MPS_PHASE_RHS )
         {
-            // G(row,column) = 1
-            const Int row = meta_.nonpositiveOffset + data.nonpositiveIndex;
-            entry.type = AFFINE_LP_INEQUALITY_MATRIX;
-            entry.row = row;
-            entry.column = column;
-            entry.value = 1;
-            queuedEntries_.push_back( entry );
-
-            // There is no need to explicitly set h(row) to zero.
+            if( rhsIndex_ == Int(rhsRows_.size()) )
+                phase_ = MPS_PHASE_BOUNDS;
+            else
+                QueueRHS( rhsIndex_++ );
         }
-
-        // Handle non-negative values.
-        if( data.nonnegative )
+        else /* phase_ == MPS_PHASE_BOUNDS */
         {
-            // G(row,column) = -1
-            const Int row = meta_.nonnegativeOffset + data.nonnegativeIndex;
-            entry.type = AFFINE_LP_INEQUALITY_MATRIX;
-            entry.row = row;
-            entry.column = column;
-            entry.value = -1;
-            queuedEntries_.push_back( entry );
-
-            // There is no need to explicitly set h(row) to zero.
+            if( variableIndex_ == Int(variables_.size()) )
+                phase_ = MPS_PHASE_DONE;
+            else
+                QueueBounds( variables_[variableIndex_++] );
         }
-
-        ++variableIter_;
     }
     return queuedEntries_.size() > 0;
 }
@@ -1372,8 +1722,8 @@ void Helper
     Zeros( problem.G, meta.k, meta.n );
     Zeros( problem.h, meta.k, 1 );
 
-    problem.A.Reserve( meta.numEqualityEntries );
-    problem.G.Reserve( meta.numInequalityEntries );
+    problem.A.Reserve( reader.NumEqualityEntries() );
+    problem.G.Reserve( reader.NumInequalityEntries() );
     while( reader.QueuedEntry() )
     {
         const AffineLPEntry<double> entry = reader.GetEntry();
@@ -1417,9 +1767,13 @@ void Helper
     Zeros( problem.G, meta.k, meta.n );
     Zeros( problem.h, meta.k, 1 );
 
+    // Only the locally-owned rows of A and G are materialized
+    reader.RestrictRows
+    ( problem.A.FirstLocalRow(), problem.A.LocalHeight(),
+      problem.G.FirstLocalRow(), problem.G.LocalHeight() );
     bool passive=true;
-    problem.A.Reserve( meta.numEqualityEntries );
-    problem.G.Reserve( meta.numInequalityEntries );
+    problem.A.Reserve( reader.NumEqualityEntries() );
+    problem.G.Reserve( reader.NumInequalityEntries() );
     while( reader.QueuedEntry() )
     {
         const AffineLPEntry<double> entry = reader.GetEntry();
@@ -1575,4 +1929,91 @@ void DecompressMPS
     LogicError("This routine is not yet written");
 }
 
+void CacheMPS
+( const string& filename,
+  const string& cacheFilename,
+  bool minimize,
+  bool keepNonnegativeWithZeroUpperBound )
+{
+    EL_DEBUG_CSE
+    MPSReader reader
+      ( filename, false, minimize, keepNonnegativeWithZeroUpperBound );
+    const MPSMeta& meta = reader.Meta();
+
+    // Group the entries by type and sort them by row, then column
+    vector<AffineLPEntry<double>> sections[mps_cache::NUM_SECTIONS];
+    sections[AFFINE_LP_EQUALITY_MATRIX].reserve( reader.NumEqualityEntries() );
+    sections[AFFINE_LP_INEQUALITY_MATRIX].reserve
+    ( reader.NumInequalityEntries() );
+    while( reader.QueuedEntry() )
+    {
+        const AffineLPEntry<double> entry = reader.GetEntry();
+        sections[entry.type].push_back( entry );
+    }
+    for( auto& section : sections )
+        std::sort
+        ( section.begin(), section.end(),
+          []( const AffineLPEntry<double>& a, const AffineLPEntry<double>& b )
+          { return a.row < b.row ||
+                   (a.row == b.row && a.column < b.column); } );
+
+    const string* names[4] =
+      { &meta.name, &meta.costName, &meta.boundName, &meta.rhsName };
+    long long header[mps_cache::HEADER_SIZE] =
+      { mps_cache::MAGIC, mps_cache::VERSION,
+        minimize, keepNonnegativeWithZeroUpperBound,
+        meta.m, meta.n, meta.k,
+        0, 0, 0, 0, 0,
+        meta.numLesserRows, meta.numGreaterRows, meta.numEqualityRows,
+        meta.numNonconstrainingRows,
+        meta.numEqualityEntries, meta.numInequalityEntries,
+        meta.numUpperBounds, meta.numLowerBounds, meta.numFixedBounds,
+        meta.numFreeBounds, meta.numNonpositiveBounds,
+        meta.numNonnegativeBounds,
+        0, 0, 0, 0 };
+    Int namesSize = 0;
+    for( Int i=0; i<mps_cache::NUM_SECTIONS; ++i )
+        header[7+i] = sections[i].size();
+    for( Int i=0; i<4; ++i )
+    {
+        header[24+i] = names[i]->size();
+        namesSize += names[i]->size();
+    }
+
+    std::ofstream file( cacheFilename.c_str(), std::ios::binary );
+    if( !file.is_open() )
+        RuntimeError("Could not open ",cacheFilename);
+    file.write( reinterpret_cast<const char*>(header), sizeof(header) );
+    for( Int i=0; i<4; ++i )
+        file.write( names[i]->data(), names[i]->size() );
+    const char padding[8] = { 0 };
+    file.write( padding, mps_cache::PaddedSize(namesSize)-namesSize );
+    vector<long long> indices;
+    vector<double> values;
+    for( const auto& section : sections )
+    {
+        const Int numEntries = section.size();
+        indices.resize( numEntries );
+        values.resize( numEntries );
+        for( Int e=0; e<numEntries; ++e )
+            indices[e] = section[e].row;
+        file.write
+        ( reinterpret_cast<const char*>(indices.data()),
+          numEntries*sizeof(long long) );
+        for( Int e=0; e<numEntries; ++e )
+        {
+            indices[e] = section[e].column;
+            values[e] = section[e].value;
+        }
+        file.write
+        ( reinterpret_cast<const char*>(indices.data()),
+          numEntries*sizeof(long long) );
+        file.write
+        ( reinterpret_cast<const char*>(values.data()),
+          numEntries*sizeof(double) );
+    }
+    if( !file )
+        RuntimeError("Could not write ",cacheFilename);
+}
+
 } // namespace El
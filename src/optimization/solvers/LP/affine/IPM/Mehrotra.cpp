@@ -450,6 +450,10 @@ void EquilibratedMehrotra
     Initialize
     ( problem, solution,
       ctrl.primalInit, ctrl.dualInit, ctrl.standardInitShift );
+    if( ctrl.warmStart && ctrl.primalInit && ctrl.dualInit )
+        pos_orth::WarmStart
+        ( solution.s, solution.z,
+          ctrl.warmStartShift, ctrl.warmStartCentrality );
 
     Real relError = 1;
     Matrix<Real> J, d;
@@ -702,6 +706,68 @@ void EquilibratedMehrotra
         alphaDual = Min(ctrl.maxStepRatio*alphaDual,Real(1));
         if( ctrl.forceSameStep )
             alphaPri = alphaDual = Min(alphaPri,alphaDual);
+
+        // Apply Gondzio's multiple centrality correctors
+        // ==============================================
+        // NOTE: affineCorrection is used as a temporary
+        for( Int corrector=0; corrector<ctrl.maxCentralityCorrectors &&
+             Min(alphaPri,alphaDual) < Real(1); ++corrector )
+        {
+            const Real alphaPriTarget =
+              Min(alphaPri+ctrl.centralityStepIncrease,Real(1));
+            const Real alphaDualTarget =
+              Min(alphaDual+ctrl.centralityStepIncrease,Real(1));
+            Zero( residual.primalEquality );
+            Zero( residual.dualEquality );
+            Zero( residual.primalConic );
+            pos_orth::CentralityResidual
+            ( solution.s, solution.z, correction.s, correction.z,
+              alphaPriTarget, alphaDualTarget, sigma*mu,
+              ctrl.centralityBetaMin, ctrl.centralityBetaMax,
+              residual.dualConic );
+            // Construct the new KKT RHS
+            // -------------------------
+            KKTRHS
+            ( residual.dualEquality,
+              residual.primalEquality,
+              residual.primalConic,
+              residual.dualConic,
+              solution.z, d );
+            // Solve for the direction
+            // -----------------------
+            if( !attemptToSolve(d) )
+                break;
+            ExpandSolution
+            ( m, n, d, residual.dualConic, solution.s, solution.z,
+              affineCorrection.x, affineCorrection.y,
+              affineCorrection.z, affineCorrection.s );
+            affineCorrection.x += correction.x;
+            affineCorrection.y += correction.y;
+            affineCorrection.z += correction.z;
+            affineCorrection.s += correction.s;
+
+            Real alphaPriCorr =
+              pos_orth::MaxStep
+              ( solution.s, affineCorrection.s, 1/ctrl.maxStepRatio );
+            Real alphaDualCorr =
+              pos_orth::MaxStep
+              ( solution.z, affineCorrection.z, 1/ctrl.maxStepRatio );
+            alphaPriCorr = Min(ctrl.maxStepRatio*alphaPriCorr,Real(1));
+            alphaDualCorr = Min(ctrl.maxStepRatio*alphaDualCorr,Real(1));
+            if( ctrl.forceSameStep )
+                alphaPriCorr = alphaDualCorr = Min(alphaPriCorr,alphaDualCorr);
+            if( Min(alphaPriCorr,alphaDualCorr) <
+                Min(alphaPri,alphaDual) +
+                ctrl.centralityAcceptance*ctrl.centralityStepIncrease )
+                break;
+            if( ctrl.print )
+                Output
+                ("Accepted centrality corrector ",corrector,": alphaPri = ",
+                 alphaPriCorr,", alphaDual = ",alphaDualCorr);
+            correction = affineCorrection;
+            alphaPri = alphaPriCorr;
+            alphaDual = alphaDualCorr;
+        }
         if( ctrl.print )
             Output("alphaPri = ",alphaPri,", alphaDual = ",alphaDual);
         Axpy( alphaPri,  correction.x, solution.x );
@@ -792,6 +858,10 @@ void EquilibratedMehrotra
     Initialize
     ( problem, solution,
       ctrl.primalInit, ctrl.dualInit, ctrl.standardInitShift );
+    if( ctrl.warmStart && ctrl.primalInit && ctrl.dualInit )
+        pos_orth::WarmStart
+        ( solution.s, solution.z,
+          ctrl.warmStartShift, ctrl.warmStartCentrality );
 
     Real relError = 1;
     DistMatrix<Real> J(grid), d(grid);
@@ -840,6 +910,13 @@ void EquilibratedMehrotra
             LogicError
             (sNumNonPos," entries of s were nonpositive and ",
              zNumNonPos," entries of z were nonpositive");
+        if( ctrl.checkpointFreq > 0 && numIts % ctrl.checkpointFreq == 0 )
+        {
+            Checkpoint( solution.x, ctrl.checkpointBasename+"_x" );
+            Checkpoint( solution.y, ctrl.checkpointBasename+"_y" );
+            Checkpoint( solution.z, ctrl.checkpointBasename+"_z" );
+            Checkpoint( solution.s, ctrl.checkpointBasename+"_s" );
+        }
 
         // Compute the duality measure
         // ===========================
@@ -1047,6 +1124,68 @@ void EquilibratedMehrotra
         alphaDual = Min(ctrl.maxStepRatio*alphaDual,Real(1));
         if( ctrl.forceSameStep )
             alphaPri = alphaDual = Min(alphaPri,alphaDual);
+
+        // Apply Gondzio's multiple centrality correctors
+        // ==============================================
+        // NOTE: affineCorrection is used as a temporary
+        for( Int corrector=0; corrector<ctrl.maxCentralityCorrectors &&
+             Min(alphaPri,alphaDual) < Real(1); ++corrector )
+        {
+            const Real alphaPriTarget =
+              Min(alphaPri+ctrl.centralityStepIncrease,Real(1));
+            const Real alphaDualTarget =
+              Min(alphaDual+ctrl.centralityStepIncrease,Real(1));
+            Zero( residual.primalEquality );
+            Zero( residual.dualEquality );
+            Zero( residual.primalConic );
+            pos_orth::CentralityResidual
+            ( solution.s, solution.z, correction.s, correction.z,
+              alphaPriTarget, alphaDualTarget, sigma*mu,
+              ctrl.centralityBetaMin, ctrl.centralityBetaMax,
+              residual.dualConic );
+            // Construct the new KKT RHS
+            // -------------------------
+            KKTRHS
+            ( residual.dualEquality,
+              residual.primalEquality,
+              residual.primalConic,
+              residual.dualConic,
+              solution.z, d );
+            // Solve for the direction
+            // -----------------------
+            if( !attemptToSolve(d) )
+                break;
+            ExpandSolution
+            ( m, n, d, residual.dualConic, solution.s, solution.z,
+              affineCorrection.x, affineCorrection.y,
+              affineCorrection.z, affineCorrection.s );
+            affineCorrection.x += correction.x;
+            affineCorrection.y += correction.y;
+            affineCorrection.z += correction.z;
+            affineCorrection.s += correction.s;
+
+            Real alphaPriCorr =
+              pos_orth::MaxStep
+              ( solution.s, affineCorrection.s, 1/ctrl.maxStepRatio );
+            Real alphaDualCorr =
+              pos_orth::MaxStep
+              ( solution.z, affineCorrection.z, 1/ctrl.maxStepRatio );
+            alphaPriCorr = Min(ctrl.maxStepRatio*alphaPriCorr,Real(1));
+            alphaDualCorr = Min(ctrl.maxStepRatio*alphaDualCorr,Real(1));
+            if( ctrl.forceSameStep )
+                alphaPriCorr = alphaDualCorr = Min(alphaPriCorr,alphaDualCorr);
+            if( Min(alphaPriCorr,alphaDualCorr) <
+                Min(alphaPri,alphaDual) +
+                ctrl.centralityAcceptance*ctrl.centralityStepIncrease )
+                break;
+            if( ctrl.print && commRank == 0 )
+                Output
+                ("Accepted centrality corrector ",corrector,": alphaPri = ",
+                 alphaPriCorr,", alphaDual = ",alphaDualCorr);
+            correction = affineCorrection;
+            alphaPri = alphaPriCorr;
+            alphaDual = alphaDualCorr;
+        }
         if( ctrl.print && commRank == 0 )
             Output("alphaPri = ",alphaPri,", alphaDual = ",alphaDual);
         Axpy( alphaPri,  correction.x, solution.x );
@@ -1181,6 +1320,10 @@ void EquilibratedMehrotra
     ( problem, solution, JStatic, regTmp,
       sparseLDLFact,
       ctrl.primalInit, ctrl.dualInit, ctrl.standardInitShift, ctrl.solveCtrl );
+    if( ctrl.warmStart && ctrl.primalInit && ctrl.dualInit )
+        pos_orth::WarmStart
+        ( solution.s, solution.z,
+          ctrl.warmStartShift, ctrl.warmStartCentrality );
 
     Int numIts = 0;
     Real relError = 1;
@@ -1481,6 +1624,68 @@ void EquilibratedMehrotra
         alphaDual = Min(ctrl.maxStepRatio*alphaDual,Real(1));
         if( ctrl.forceSameStep )
             alphaPri = alphaDual = Min(alphaPri,alphaDual);
+
+        // Apply Gondzio's multiple centrality correctors
+        // ==============================================
+        // NOTE: affineCorrection is used as a temporary
+        for( Int corrector=0; corrector<ctrl.maxCentralityCorrectors &&
+             Min(alphaPri,alphaDual) < Real(1); ++corrector )
+        {
+            const Real alphaPriTarget =
+              Min(alphaPri+ctrl.centralityStepIncrease,Real(1));
+            const Real alphaDualTarget =
+              Min(alphaDual+ctrl.centralityStepIncrease,Real(1));
+            Zero( residual.primalEquality );
+            Zero( residual.dualEquality );
+            Zero( residual.primalConic );
+            pos_orth::CentralityResidual
+            ( solution.s, solution.z, correction.s, correction.z,
+              alphaPriTarget, alphaDualTarget, sigma*mu,
+              ctrl.centralityBetaMin, ctrl.centralityBetaMax,
+              residual.dualConic );
+            // Construct the new KKT RHS
+            // -------------------------
+            KKTRHS
+            ( residual.dualEquality,
+              residual.primalEquality,
+              residual.primalConic,
+              residual.dualConic,
+              solution.z, d );
+            // Solve for the proposed step
+            // ---------------------------
+            if( !attemptToSolve(d) )
+                break;
+            ExpandSolution
+            ( m, n, d, residual.dualConic, solution.s, solution.z,
+              affineCorrection.x, affineCorrection.y,
+              affineCorrection.z, affineCorrection.s );
+            affineCorrection.x += correction.x;
+            affineCorrection.y += correction.y;
+            affineCorrection.z += correction.z;
+            affineCorrection.s += correction.s;
+
+            Real alphaPriCorr =
+              pos_orth::MaxStep
+              ( solution.s, affineCorrection.s, 1/ctrl.maxStepRatio );
+            Real alphaDualCorr =
+              pos_orth::MaxStep
+              ( solution.z, affineCorrection.z, 1/ctrl.maxStepRatio );
+            alphaPriCorr = Min(ctrl.maxStepRatio*alphaPriCorr,Real(1));
+            alphaDualCorr = Min(ctrl.maxStepRatio*alphaDualCorr,Real(1));
+            if( ctrl.forceSameStep )
+                alphaPriCorr = alphaDualCorr = Min(alphaPriCorr,alphaDualCorr);
+            if( Min(alphaPriCorr,alphaDualCorr) <
+                Min(alphaPri,alphaDual) +
+                ctrl.centralityAcceptance*ctrl.centralityStepIncrease )
+                break;
+            if( ctrl.print )
+                Output
+                ("Accepted centrality corrector ",corrector,": alphaPri = ",
+                 alphaPriCorr,", alphaDual = ",alphaDualCorr);
+            correction = affineCorrection;
+            alphaPri = alphaPriCorr;
+            alphaDual = alphaDualCorr;
+        }
         if( ctrl.print )
             Output("alphaPri = ",alphaPri,", alphaDual = ",alphaDual);
         Axpy( alphaPri,  correction.x, solution.x );
@@ -1597,6 +1802,10 @@ void EquilibratedMehrotra
     ( problem, solution, JStatic, regTmp,
       sparseLDLFact,
       ctrl.primalInit, ctrl.dualInit, ctrl.standardInitShift, ctrl.solveCtrl );
+    if( ctrl.warmStart && ctrl.primalInit && ctrl.dualInit )
+        pos_orth::WarmStart
+        ( solution.s, solution.z,
+          ctrl.warmStartShift, ctrl.warmStartCentrality );
     if( commRank == 0 && ctrl.time )
         Output("Init: ",timer.Stop()," secs");
 
@@ -1790,7 +1999,6 @@ void EquilibratedMehrotra
         // ------------------------
         JOrig = JStatic;
         JOrig.FreezeSparsity();
-        JOrig.LockedDistGraph().multMeta = JStatic.LockedDistGraph().multMeta;
         FinishKKT( m, n, solution.s, solution.z, JOrig );
         KKTRHS
         ( residual.dualEquality,
@@ -1800,7 +2008,6 @@ void EquilibratedMehrotra
           solution.z, d );
         J = JOrig;
         J.FreezeSparsity();
-        J.LockedDistGraph().multMeta = JStatic.LockedDistGraph().multMeta;
         UpdateDiagonal( J, Real(1), regTmp );
 
         // Solve for the direction
@@ -1920,6 +2127,68 @@ void EquilibratedMehrotra
         alphaDual = Min(ctrl.maxStepRatio*alphaDual,Real(1));
         if( ctrl.forceSameStep )
             alphaPri = alphaDual = Min(alphaPri,alphaDual);
+
+        // Apply Gondzio's multiple centrality correctors
+        // ==============================================
+        // NOTE: affineCorrection is used as a temporary
+        for( Int corrector=0; corrector<ctrl.maxCentralityCorrectors &&
+             Min(alphaPri,alphaDual) < Real(1); ++corrector )
+        {
+            const Real alphaPriTarget =
+              Min(alphaPri+ctrl.centralityStepIncrease,Real(1));
+            const Real alphaDualTarget =
+              Min(alphaDual+ctrl.centralityStepIncrease,Real(1));
+            Zero( residual.primalEquality );
+            Zero( residual.dualEquality );
+            Zero( residual.primalConic );
+            pos_orth::CentralityResidual
+            ( solution.s, solution.z, correction.s, correction.z,
+              alphaPriTarget, alphaDualTarget, sigma*mu,
+              ctrl.centralityBetaMin, ctrl.centralityBetaMax,
+              residual.dualConic );
+            // Construct the new KKT RHS
+            // -------------------------
+            KKTRHS
+            ( residual.dualEquality,
+              residual.primalEquality,
+              residual.primalConic,
+              residual.dualConic,
+              solution.z, d );
+            // Solve for the direction
+            // -----------------------
+            if( !attemptToSolve(d) )
+                break;
+            ExpandSolution
+            ( m, n, d, residual.dualConic, solution.s, solution.z,
+              affineCorrection.x, affineCorrection.y,
+              affineCorrection.z, affineCorrection.s );
+            affineCorrection.x += correction.x;
+            affineCorrection.y += correction.y;
+            affineCorrection.z += correction.z;
+            affineCorrection.s += correction.s;
+
+            Real alphaPriCorr =
+              pos_orth::MaxStep
+              ( solution.s, affineCorrection.s, 1/ctrl.maxStepRatio );
+            Real alphaDualCorr =
+              pos_orth::MaxStep
+              ( solution.z, affineCorrection.z, 1/ctrl.maxStepRatio );
+            alphaPriCorr = Min(ctrl.maxStepRatio*alphaPriCorr,Real(1));
+            alphaDualCorr = Min(ctrl.maxStepRatio*alphaDualCorr,Real(1));
+            if( ctrl.forceSameStep )
+                alphaPriCorr = alphaDualCorr = Min(alphaPriCorr,alphaDualCorr);
+            if( Min(alphaPriCorr,alphaDualCorr) <
+                Min(alphaPri,alphaDual) +
+                ctrl.centralityAcceptance*ctrl.centralityStepIncrease )
+                break;
+            if( ctrl.print && commRank == 0 )
+                Output
+                ("Accepted centrality corrector ",corrector,": alphaPri = ",
+                 alphaPriCorr,", alphaDual = ",alphaDualCorr);
+            correction = affineCorrection;
+            alphaPri = alphaPriCorr;
+            alphaDual = alphaDualCorr;
+        }
         if( ctrl.print && commRank == 0 )
             Output("alphaPri = ",alphaPri,", alphaDual = ",alphaDual);
         Axpy( alphaPri,  correction.x, solution.x );
@@ -21,6 +21,55 @@ namespace direct {
 //     subject to  A x = b, x >= 0
 //
 
+namespace {
+
+// Perform the (fused) updates
+//
+//   xHat := alpha x + (1-alpha) zOld,
+//   z    := pos(xHat + u),
+//   u    := u + (xHat - z),
+//
+// where zOld is the value of z on entry.
+template<typename Real>
+void UpdateIterates
+( const Real& alpha, const Matrix<Real>& x, Matrix<Real>& z, Matrix<Real>& u )
+{
+    const Int n = x.Height()*x.Width();
+    const Real* xBuf = x.LockedBuffer();
+    Real* zBuf = z.Buffer();
+    Real* uBuf = u.Buffer();
+    EL_PARALLEL_FOR_IF(ParallelizeLoop(n))
+    for( Int i=0; i<n; ++i )
+    {
+        const Real xHat = alpha*xBuf[i] + (1-alpha)*zBuf[i];
+        const Real zNew = Max( xHat+uBuf[i], Real(0) );
+        uBuf[i] += xHat - zNew;
+        zBuf[i] = zNew;
+    }
+}
+
+// Residual balancing of the penalty parameter, where u = y/rho is the scaled
+// dual variable and must be rescaled alongside rho
+template<typename Real,typename VectorType>
+void AdaptPenalty
+( const Real& rNorm, const Real& sNorm, Real& rho, VectorType& u,
+  const ADMMCtrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    if( rNorm > ctrl.rhoBalance*sNorm )
+    {
+        rho *= ctrl.rhoScale;
+        u *= 1/ctrl.rhoScale;
+    }
+    else if( sNorm > ctrl.rhoBalance*rNorm )
+    {
+        rho /= ctrl.rhoScale;
+        u *= ctrl.rhoScale;
+    }
+}
+
+} // anonymous namespace
+
 template<typename Real>
 Int ADMM
 ( const Matrix<Real>& A,
@@ -31,58 +80,46 @@ Int ADMM
 {
     EL_DEBUG_CSE
 
-    // Cache a custom partially-pivoted LU factorization of
-    //    |  rho*I   A^H | = | B11  B12 |
-    //    |  A       0   |   | B21  B22 |
-    // by (justifiably) avoiding pivoting in the first n steps of
-    // the factorization, so that
-    //    [I,rho*I] = lu(rho*I).
-    // The factorization would then proceed with
-    //    B21 := B21 U11^{-1} = A (rho*I)^{-1} = A/rho
-    //    B12 := L11^{-1} B12 = I A^H = A^H.
-    // The Schur complement would then be
-    //    B22 := B22 - B21 B12 = 0 - (A*A^H)/rho.
-    // We then factor said matrix with LU with partial pivoting and
-    // swap the necessary rows of B21 in order to implicitly commute
-    // the row pivots with the Gauss transforms in the manner standard
-    // for GEPP. Unless A A' is singular, pivoting should not be needed,
-    // as Cholesky factorization of the negative matrix should be valid.
-    //
-    // The result is the factorization
-    //   | I 0   | | rho*I A^H | = | I   0   | | rho*I U12 |,
-    //   | 0 P22 | | A     0   |   | L21 L22 | | 0     U22 |
-    // where [L22,U22] are stored within B22.
-    Matrix<Real> U12, L21, B22, bPiv;
-    Adjoint( A, U12 );
-    L21 = A;
-    L21 *= 1/ctrl.rho;
-    Herk( LOWER, NORMAL, -1/ctrl.rho, A, B22 );
-    MakeHermitian( LOWER, B22 );
+    // Rather than factoring the quasi-definite matrix
+    //    |  rho*I   A^H |
+    //    |  A       0   |,
+    // whose Schur complement, -(A A^H)/rho, depends upon the penalty
+    // parameter, we cache a partially-pivoted LU factorization of
+    // S = A A^H and eliminate x from the system
+    //    | rho*I A^H | | x | = | r |
+    //    | A     0   | | y |   | b |,
+    // which yields
+    //    y = inv(S) (A r - rho b),
+    //    x = (r - A^H y)/rho.
+    // The factorization can therefore be reused for any value of rho.
+    // Unless A A^H is singular, pivoting should not be needed, as Cholesky
+    // factorization of S should be valid.
+    Matrix<Real> S;
+    Herk( LOWER, NORMAL, Real(1), A, S );
+    MakeHermitian( LOWER, S );
     // TODO: Replace with sparse-direct Cholesky version?
-    Permutation P2;
-    LU( B22, P2 );
-    P2.PermuteRows( L21 );
-    bPiv = b;
-    P2.PermuteRows( bPiv );
+    Permutation P;
+    LU( S, P );
 
-    // Possibly form the inverse of L22 U22
-    Matrix<Real> X22;
+    // Possibly form the inverse of L U
+    Matrix<Real> X;
     if( ctrl.inv )
     {
-        X22 = B22;
-        MakeTrapezoidal( LOWER, X22 );
-        FillDiagonal( X22, Real(1) );
-        TriangularInverse( LOWER, UNIT, X22 );
-        Trsm( LEFT, UPPER, NORMAL, NON_UNIT, Real(1), B22, X22 );
+        X = S;
+        MakeTrapezoidal( LOWER, X );
+        FillDiagonal( X, Real(1) );
+        TriangularInverse( LOWER, UNIT, X );
+        Trsm( LEFT, UPPER, NORMAL, NON_UNIT, Real(1), S, X );
     }
 
     Int numIter=0;
+    Real rho = ctrl.rho;
     const Int m = A.Height();
     const Int n = A.Width();
-    Matrix<Real> g, xTmp, y, t;
-    Zeros( g, m+n, 1 );
-    PartitionDown( g, xTmp, y, n );
-    Matrix<Real> x, u, zOld, xHat;
+    Matrix<Real> xTmp, y, t;
+    Zeros( xTmp, n, 1 );
+    Zeros( y, m, 1 );
+    Matrix<Real> x, u, zOld;
     Zeros( z, n, 1 );
     Zeros( u, n, 1 );
     Zeros( t, n, 1 );
@@ -93,46 +130,30 @@ Int ADMM
         // Find x from
         //  | rho*I  A^H | | x | = | rho*(z-u)-c |
         //  | A      0   | | y |   | b           |
-        // via our cached custom factorization:
-        //
-        // |x| = inv(U) inv(L) P' |rho*(z-u)-c|
-        // |y|                    |b          |
-        //     = |rho*I U12|^{-1} |I   0  | |I 0   | |rho*(z-u)-c|
-        //     = |0     U22|      |L21 L22| |0 P22'| |b          |
-        //     = "                        " |rho*(z-u)-c|
-        //                                  | P22' b    |
+        // via our cached factorization of A A^H
         xTmp = z;
         xTmp -= u;
-        xTmp *= ctrl.rho;
+        xTmp *= rho;
         xTmp -= c;
-        y = bPiv;
-        Gemv( NORMAL, Real(-1), L21, xTmp, Real(1), y );
+        y = b;
+        Gemv( NORMAL, Real(1), A, xTmp, -rho, y );
+        P.PermuteRows( y );
         if( ctrl.inv )
         {
-            Gemv( NORMAL, Real(1), X22, y, t );
+            Gemv( NORMAL, Real(1), X, y, t );
             y = t;
         }
         else
         {
-            Trsv( LOWER, NORMAL, UNIT, B22, y );
-            Trsv( UPPER, NORMAL, NON_UNIT, B22, y );
+            Trsv( LOWER, NORMAL, UNIT, S, y );
+            Trsv( UPPER, NORMAL, NON_UNIT, S, y );
         }
-        Gemv( NORMAL, Real(-1), U12, y, Real(1), xTmp );
-        xTmp *= 1/ctrl.rho;
-
-        // xHat := alpha*x + (1-alpha)*zOld
-        xHat = xTmp;
-        xHat *= ctrl.alpha;
-        Axpy( 1-ctrl.alpha, zOld, xHat );
-
-        // z := pos(xHat+u)
-        z = xHat;
-        z += u;
-        LowerClip( z, Real(0) );
+        Gemv( ADJOINT, Real(-1), A, y, Real(1), xTmp );
+        xTmp *= 1/rho;
 
-        // u := u + (xHat-z)
-        u += xHat;
-        u -= z;
+        // Form xHat := alpha*x + (1-alpha)*zOld, z := pos(xHat+u), and
+        // u := u + (xHat-z) in a single pass
+        UpdateIterates( ctrl.alpha, xTmp, z, u );
 
         const Real objective = Dot( c, xTmp );
 
@@ -143,12 +164,12 @@ Int ADMM
         // sNorm := |rho| || z - zOld ||_2
         t = z;
         t -= zOld;
-        const Real sNorm = Abs(ctrl.rho)*FrobeniusNorm( t );
+        const Real sNorm = Abs(rho)*FrobeniusNorm( t );
 
         const Real epsPri = Sqrt(Real(n))*ctrl.absTol +
             ctrl.relTol*Max(FrobeniusNorm(xTmp),FrobeniusNorm(z));
         const Real epsDual = Sqrt(Real(n))*ctrl.absTol +
-            ctrl.relTol*Abs(ctrl.rho)*FrobeniusNorm(u);
+            ctrl.relTol*Abs(rho)*FrobeniusNorm(u);
 
         if( ctrl.print )
         {
@@ -162,10 +183,13 @@ Int ADMM
               << "|rho| ||z-zOld||_2=" << sNorm << ", "
               << "epsDual=" << epsDual << ", "
               << "||x-Pos(x)||_2=" << clipDist << ", "
+              << "rho=" << rho << ", "
               << "c'x=" << objective << endl;
         }
         if( rNorm < epsPri && sNorm < epsDual )
             break;
+        if( ctrl.adaptRho )
+            AdaptPenalty( rNorm, sNorm, rho, u, ctrl );
         ++numIter;
     }
     if( ctrl.maxIter == numIter )
@@ -195,62 +219,50 @@ Int ADMM
     auto& c = cProx.GetLocked();
     auto& z = zProx.Get();
 
-    // Cache a custom partially-pivoted LU factorization of
-    //    |  rho*I   A^H | = | B11  B12 |
-    //    |  A       0   |   | B21  B22 |
-    // by (justifiably) avoiding pivoting in the first n steps of
-    // the factorization, so that
-    //    [I,rho*I] = lu(rho*I).
-    // The factorization would then proceed with
-    //    B21 := B21 U11^{-1} = A (rho*I)^{-1} = A/rho
-    //    B12 := L11^{-1} B12 = I A^H = A^H.
-    // The Schur complement would then be
-    //    B22 := B22 - B21 B12 = 0 - (A*A^H)/rho.
-    // We then factor said matrix with LU with partial pivoting and
-    // swap the necessary rows of B21 in order to implicitly commute
-    // the row pivots with the Gauss transforms in the manner standard
-    // for GEPP. Unless A A' is singular, pivoting should not be needed,
-    // as Cholesky factorization of the negative matrix should be valid.
-    //
-    // The result is the factorization
-    //   | I 0   | | rho*I A^H | = | I   0   | | rho*I U12 |,
-    //   | 0 P22 | | A     0   |   | L21 L22 | | 0     U22 |
-    // where [L22,U22] are stored within B22.
+    // Rather than factoring the quasi-definite matrix
+    //    |  rho*I   A^H |
+    //    |  A       0   |,
+    // whose Schur complement, -(A A^H)/rho, depends upon the penalty
+    // parameter, we cache a partially-pivoted LU factorization of
+    // S = A A^H and eliminate x from the system
+    //    | rho*I A^H | | x | = | r |
+    //    | A     0   | | y |   | b |,
+    // which yields
+    //    y = inv(S) (A r - rho b),
+    //    x = (r - A^H y)/rho.
+    // The factorization can therefore be reused for any value of rho.
+    // Unless A A^H is singular, pivoting should not be needed, as Cholesky
+    // factorization of S should be valid.
     const Int m = A.Height();
     const Int n = A.Width();
     const Grid& grid = A.Grid();
-    DistMatrix<Real> U12(grid), L21(grid), B22(grid), bPiv(grid);
-    U12.Align( 0,                 n%U12.RowStride() );
-    L21.Align( n%L21.ColStride(), 0                 );
-    B22.Align( n%B22.ColStride(), n%B22.RowStride() );
-    Adjoint( A, U12 );
-    L21 = A;
-    L21 *= 1/ctrl.rho;
-    Herk( LOWER, NORMAL, -1/ctrl.rho, A, B22 );
-    MakeHermitian( LOWER, B22 );
-    DistPermutation P2(grid);
-    LU( B22, P2 );
-    P2.PermuteRows( L21 );
-    bPiv = b;
-    P2.PermuteRows( bPiv );
+    DistMatrix<Real> S(grid);
+    Herk( LOWER, NORMAL, Real(1), A, S );
+    MakeHermitian( LOWER, S );
+    DistPermutation P(grid);
+    LU( S, P );
 
-    // Possibly form the inverse of L22 U22
-    DistMatrix<Real> X22(grid);
+    // Possibly form the inverse of L U
+    DistMatrix<Real> X(grid);
     if( ctrl.inv )
     {
-        X22 = B22;
-        MakeTrapezoidal( LOWER, X22 );
-        FillDiagonal( X22, Real(1) );
-        TriangularInverse( LOWER, UNIT, X22 );
-        Trsm( LEFT, UPPER, NORMAL, NON_UNIT, Real(1), B22, X22 );
+        X = S;
+        MakeTrapezoidal( LOWER, X );
+        FillDiagonal( X, Real(1) );
+        TriangularInverse( LOWER, UNIT, X );
+        Trsm( LEFT, UPPER, NORMAL, NON_UNIT, Real(1), S, X );
     }
 
     Int numIter=0;
-    DistMatrix<Real> g(grid), xTmp(grid), y(grid), t(grid);
-    Zeros( g, m+n, 1 );
-    PartitionDown( g, xTmp, y, n );
-    DistMatrix<Real> x(grid), u(grid), zOld(grid), xHat(grid);
+    Real rho = ctrl.rho;
+    DistMatrix<Real> xTmp(grid), y(grid), t(grid);
+    Zeros( y, m, 1 );
     Zeros( z, n, 1 );
+    // The fused update of (z,u) operates on the local data of x, z, and u
+    DistMatrix<Real> x(grid), u(grid), zOld(grid);
+    xTmp.AlignWith( z );
+    u.AlignWith( z );
+    Zeros( xTmp, n, 1 );
     Zeros( u, n, 1 );
     Zeros( t, n, 1 );
     while( numIter < ctrl.maxIter )
@@ -260,46 +272,31 @@ Int ADMM
         // Find x from
         //  | rho*I  A^H | | x | = | rho*(z-u)-c |
         //  | A      0   | | y |   | b           |
-        // via our cached custom factorization:
-        //
-        // |x| = inv(U) inv(L) P' |rho*(z-u)-c|
-        // |y|                    |b          |
-        //     = |rho*I U12|^{-1} |I   0  | |I 0   | |rho*(z-u)-c|
-        //     = |0     U22|      |L21 L22| |0 P22'| |b          |
-        //     = "                        " |rho*(z-u)-c|
-        //                                  | P22' b    |
+        // via our cached factorization of A A^H
         xTmp = z;
         xTmp -= u;
-        xTmp *= ctrl.rho;
+        xTmp *= rho;
         xTmp -= c;
-        y = bPiv;
-        Gemv( NORMAL, Real(-1), L21, xTmp, Real(1), y );
+        y = b;
+        Gemv( NORMAL, Real(1), A, xTmp, -rho, y );
+        P.PermuteRows( y );
         if( ctrl.inv )
         {
-            Gemv( NORMAL, Real(1), X22, y, t );
+            Gemv( NORMAL, Real(1), X, y, t );
             y = t;
         }
         else
         {
-            Trsv( LOWER, NORMAL, UNIT, B22, y );
-            Trsv( UPPER, NORMAL, NON_UNIT, B22, y );
+            Trsv( LOWER, NORMAL, UNIT, S, y );
+            Trsv( UPPER, NORMAL, NON_UNIT, S, y );
         }
-        Gemv( NORMAL, Real(-1), U12, y, Real(1), xTmp );
-        xTmp *= 1/ctrl.rho;
-
-        // xHat := alpha*x + (1-alpha)*zOld
-        xHat = xTmp;
-        xHat *= ctrl.alpha;
-        Axpy( 1-ctrl.alpha, zOld, xHat );
-
-        // z := pos(xHat+u)
-        z = xHat;
-        z += u;
-        LowerClip( z, Real(0) );
+        Gemv( ADJOINT, Real(-1), A, y, Real(1), xTmp );
+        xTmp *= 1/rho;
 
-        // u := u + (xHat-z)
-        u += xHat;
-        u -= z;
+        // Form xHat := alpha*x + (1-alpha)*zOld, z := pos(xHat+u), and
+        // u := u + (xHat-z) in a single pass
+        UpdateIterates
+        ( ctrl.alpha, xTmp.LockedMatrix(), z.Matrix(), u.Matrix() );
 
         const Real objective = Dot( c, xTmp );
 
@@ -310,12 +307,12 @@ Int ADMM
         // sNorm := |rho| || z - zOld ||_2
         t = z;
         t -= zOld;
-        const Real sNorm = Abs(ctrl.rho)*FrobeniusNorm( t );
+        const Real sNorm = Abs(rho)*FrobeniusNorm( t );
 
         const Real epsPri = Sqrt(Real(n))*ctrl.absTol +
             ctrl.relTol*Max(FrobeniusNorm(xTmp),FrobeniusNorm(z));
         const Real epsDual = Sqrt(Real(n))*ctrl.absTol +
-            ctrl.relTol*Abs(ctrl.rho)*FrobeniusNorm(u);
+            ctrl.relTol*Abs(rho)*FrobeniusNorm(u);
 
         if( ctrl.print )
         {
@@ -330,10 +327,13 @@ Int ADMM
                   << "|rho| ||z-zOld||_2=" << sNorm << ", "
                   << "epsDual=" << epsDual << ", "
                   << "||x-Pos(x)||_2=" << clipDist << ", "
+                  << "rho=" << rho << ", "
                   << "c'x=" << objective << endl;
         }
         if( rNorm < epsPri && sNorm < epsDual )
             break;
+        if( ctrl.adaptRho )
+            AdaptPenalty( rNorm, sNorm, rho, u, ctrl );
         ++numIter;
     }
     if( ctrl.maxIter == numIter && grid.Rank() == 0 )
@@ -107,6 +107,33 @@ struct DistSparseDirectLPEquilibration
     DistMultiVec<Real> colScale;
 };
 
+// Either compute a Ruiz equilibration of A or apply the (previously computed)
+// scalings that were passed in.
+template<typename Real,typename MatrixType,
+         typename RowScaleType,typename ColScaleType>
+void RuizEquilOrReuse
+( MatrixType& A,
+  RowScaleType& rowScale,
+  ColScaleType& colScale,
+  const MehrotraCtrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    if( ctrl.reuseEquil )
+    {
+        if( rowScale.Height() != A.Height() || rowScale.Width() != 1 ||
+            colScale.Height() != A.Width() || colScale.Width() != 1 )
+            LogicError
+            ("Expected reused scalings of sizes ",A.Height()," x 1 and ",
+             A.Width()," x 1 but they were ",rowScale.Height()," x ",
+             rowScale.Width()," and ",colScale.Height()," x ",
+             colScale.Width());
+        DiagonalSolve( LEFT, NORMAL, rowScale, A );
+        DiagonalSolve( RIGHT, NORMAL, colScale, A );
+    }
+    else
+        RuizEquil( A, rowScale, colScale, ctrl.print );
+}
+
 template<typename Real>
 void Equilibrate
 ( const DirectLPProblem<Matrix<Real>,Matrix<Real>>& problem,
@@ -120,9 +147,9 @@ void Equilibrate
     equilibratedProblem = problem;
     equilibratedSolution = solution;
 
-    RuizEquil
+    RuizEquilOrReuse
     ( equilibratedProblem.A, equilibration.rowScale, equilibration.colScale,
-      ctrl.print );
+      ctrl );
 
     DiagonalSolve
     ( LEFT, NORMAL, equilibration.rowScale, equilibratedProblem.b );
@@ -172,9 +199,9 @@ void Equilibrate
     ForceSimpleAlignments( equilibratedSolution, grid );
     equilibratedProblem = problem;
     equilibratedSolution = solution;
-    RuizEquil
+    RuizEquilOrReuse
     ( equilibratedProblem.A,
-      equilibration.rowScale, equilibration.colScale, ctrl.print );
+      equilibration.rowScale, equilibration.colScale, ctrl );
 
     DiagonalSolve
     ( LEFT, NORMAL, equilibration.rowScale, equilibratedProblem.b );
@@ -222,9 +249,9 @@ void Equilibrate
     equilibratedProblem = problem;
     equilibratedSolution = solution;
 
-    RuizEquil
+    RuizEquilOrReuse
     ( equilibratedProblem.A,
-      equilibration.rowScale, equilibration.colScale, ctrl.print );
+      equilibration.rowScale, equilibration.colScale, ctrl );
 
     DiagonalSolve
     ( LEFT, NORMAL, equilibration.rowScale, equilibratedProblem.b );
@@ -276,11 +303,14 @@ void Equilibrate
 
     equilibratedProblem = problem;
     equilibratedSolution = solution;
-    equilibration.rowScale.SetGrid( grid );
-    equilibration.colScale.SetGrid( grid );
-    RuizEquil
+    if( !ctrl.reuseEquil )
+    {
+        equilibration.rowScale.SetGrid( grid );
+        equilibration.colScale.SetGrid( grid );
+    }
+    RuizEquilOrReuse
     ( equilibratedProblem.A,
-      equilibration.rowScale, equilibration.colScale, ctrl.print );
+      equilibration.rowScale, equilibration.colScale, ctrl );
 
     DiagonalSolve
     ( LEFT, NORMAL, equilibration.rowScale, equilibratedProblem.b );
@@ -697,6 +727,10 @@ void EquilibratedMehrotra
     Initialize
     ( problem, solution,
       ctrl.primalInit, ctrl.dualInit, ctrl.standardInitShift );
+    if( ctrl.warmStart && ctrl.primalInit && ctrl.dualInit )
+        pos_orth::WarmStart
+        ( solution.x, solution.z,
+          ctrl.warmStartShift, ctrl.warmStartCentrality );
     DirectKKTSolver<Real,Matrix<Real>,Matrix<Real>> solver;
     DirectLPSolution<Matrix<Real>> affineCorrection, correction;
     for( state.numIts=0; state.numIts<ctrl.maxIts; ++state.numIts )
@@ -790,6 +824,53 @@ void EquilibratedMehrotra
         alphaDual = Min(ctrl.maxStepRatio*alphaDual,Real(1));
         if( ctrl.forceSameStep )
             alphaPri = alphaDual = Min(alphaPri,alphaDual);
+
+        // Apply Gondzio's multiple centrality correctors
+        // ==============================================
+        // NOTE: affineCorrection is used as a temporary
+        for( Int corrector=0; corrector<ctrl.maxCentralityCorrectors &&
+             Min(alphaPri,alphaDual) < Real(1); ++corrector )
+        {
+            const Real alphaPriTarget =
+              Min(alphaPri+ctrl.centralityStepIncrease,Real(1));
+            const Real alphaDualTarget =
+              Min(alphaDual+ctrl.centralityStepIncrease,Real(1));
+            Zero( state.residual.primalEquality );
+            Zero( state.residual.dualEquality );
+            pos_orth::CentralityResidual
+            ( solution.x, solution.z, correction.x, correction.z,
+              alphaPriTarget, alphaDualTarget, state.sigma*state.barrier,
+              ctrl.centralityBetaMin, ctrl.centralityBetaMax,
+              state.residual.dualConic );
+            solver.SolveSystem
+            ( problem, permReg, state.residual, solution, affineCorrection,
+              ctrl.system );
+            affineCorrection.x += correction.x;
+            affineCorrection.y += correction.y;
+            affineCorrection.z += correction.z;
+
+            Real alphaPriCorr =
+              pos_orth::MaxStep
+              ( solution.x, affineCorrection.x, 1/ctrl.maxStepRatio );
+            Real alphaDualCorr =
+              pos_orth::MaxStep
+              ( solution.z, affineCorrection.z, 1/ctrl.maxStepRatio );
+            alphaPriCorr = Min(ctrl.maxStepRatio*alphaPriCorr,Real(1));
+            alphaDualCorr = Min(ctrl.maxStepRatio*alphaDualCorr,Real(1));
+            if( ctrl.forceSameStep )
+                alphaPriCorr = alphaDualCorr = Min(alphaPriCorr,alphaDualCorr);
+            if( Min(alphaPriCorr,alphaDualCorr) <
+                Min(alphaPri,alphaDual) +
+                ctrl.centralityAcceptance*ctrl.centralityStepIncrease )
+                break;
+            if( ctrl.print && outputRoot )
+                Output
+                ("Accepted centrality corrector ",corrector,": alphaPri = ",
+                 alphaPriCorr,", alphaDual = ",alphaDualCorr);
+            correction = affineCorrection;
+            alphaPri = alphaPriCorr;
+            alphaDual = alphaDualCorr;
+        }
         if( ctrl.print && outputRoot )
             Output("alphaPri = ",alphaPri,", alphaDual = ",alphaDual);
         Axpy( alphaPri,  correction.x, solution.x );
@@ -810,18 +891,27 @@ template<typename Real>
 void Mehrotra
 ( const DirectLPProblem<Matrix<Real>,Matrix<Real>>& problem,
         DirectLPSolution<Matrix<Real>>& solution,
+        DirectLPScaling<Matrix<Real>>& scaling,
   const MehrotraCtrl<Real>& ctrl )
 {
     EL_DEBUG_CSE
+    EL_PROFILE_REGION("lp::direct::Mehrotra");
     const bool outputRoot = true;
     if( ctrl.outerEquil )
     {
         DirectLPProblem<Matrix<Real>,Matrix<Real>> equilibratedProblem;
         DirectLPSolution<Matrix<Real>> equilibratedSolution;
         DenseDirectLPEquilibration<Real> equilibration;
+        if( ctrl.reuseEquil )
+        {
+            equilibration.rowScale = scaling.rowScale;
+            equilibration.colScale = scaling.colScale;
+        }
         Equilibrate
         ( problem, solution,
           equilibratedProblem, equilibratedSolution, equilibration, ctrl );
+        scaling.rowScale = equilibration.rowScale;
+        scaling.colScale = equilibration.colScale;
         EquilibratedMehrotra
         ( equilibratedProblem, equilibratedSolution, ctrl, outputRoot );
         UndoEquilibration( equilibratedSolution, equilibration, solution );
@@ -849,6 +939,17 @@ void Mehrotra
     }
 }
 
+template<typename Real>
+void Mehrotra
+( const DirectLPProblem<Matrix<Real>,Matrix<Real>>& problem,
+        DirectLPSolution<Matrix<Real>>& solution,
+  const MehrotraCtrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    DirectLPScaling<Matrix<Real>> scaling;
+    Mehrotra( problem, solution, scaling, ctrl );
+}
+
 // This interface is now deprecated.
 template<typename Real>
 void Mehrotra
@@ -861,6 +962,7 @@ void Mehrotra
   const MehrotraCtrl<Real>& ctrl )
 {
     EL_DEBUG_CSE
+    EL_PROFILE_REGION("lp::direct::Mehrotra");
     DirectLPProblem<Matrix<Real>,Matrix<Real>> problem;
     DirectLPSolution<Matrix<Real>> solution;
     LockedView( problem.c, c );
@@ -908,6 +1010,10 @@ void EquilibratedMehrotra
     Initialize
     ( problem, solution,
       ctrl.primalInit, ctrl.dualInit, ctrl.standardInitShift );
+    if( ctrl.warmStart && ctrl.primalInit && ctrl.dualInit )
+        pos_orth::WarmStart
+        ( solution.x, solution.z,
+          ctrl.warmStartShift, ctrl.warmStartCentrality );
 
     Real muOld = 0.1;
     Real relError = 1;
@@ -959,6 +1065,12 @@ void EquilibratedMehrotra
             LogicError
             (xNumNonPos," entries of x were nonpositive and ",
              zNumNonPos," entries of z were nonpositive");
+        if( ctrl.checkpointFreq > 0 && numIts % ctrl.checkpointFreq == 0 )
+        {
+            Checkpoint( solution.x, ctrl.checkpointBasename+"_x" );
+            Checkpoint( solution.y, ctrl.checkpointBasename+"_y" );
+            Checkpoint( solution.z, ctrl.checkpointBasename+"_z" );
+        }
 
         // Compute the barrier parameter
         // =============================
@@ -1229,6 +1341,100 @@ void EquilibratedMehrotra
         alphaDual = Min(ctrl.maxStepRatio*alphaDual,Real(1));
         if( ctrl.forceSameStep )
             alphaPri = alphaDual = Min(alphaPri,alphaDual);
+
+        // Apply Gondzio's multiple centrality correctors
+        // ==============================================
+        // NOTE: affineCorrection is used as a temporary
+        for( Int corrector=0; corrector<ctrl.maxCentralityCorrectors &&
+             Min(alphaPri,alphaDual) < Real(1); ++corrector )
+        {
+            const Real alphaPriTarget =
+              Min(alphaPri+ctrl.centralityStepIncrease,Real(1));
+            const Real alphaDualTarget =
+              Min(alphaDual+ctrl.centralityStepIncrease,Real(1));
+            Zero( residual.primalEquality );
+            Zero( residual.dualEquality );
+            pos_orth::CentralityResidual
+            ( solution.x, solution.z, correction.x, correction.z,
+              alphaPriTarget, alphaDualTarget, sigma*mu,
+              ctrl.centralityBetaMin, ctrl.centralityBetaMax,
+              residual.dualConic );
+            if( ctrl.system == FULL_KKT )
+            {
+                // Construct the new KKT RHS
+                // -------------------------
+                KKTRHS
+                ( residual.dualEquality, residual.primalEquality,
+                  residual.dualConic, solution.z, d );
+
+                // Solve for the direction
+                // -----------------------
+                if( !attemptToSolve(d) )
+                    break;
+                ExpandSolution
+                ( m, n, d,
+                  affineCorrection.x, affineCorrection.y, affineCorrection.z );
+            }
+            else if( ctrl.system == AUGMENTED_KKT )
+            {
+                // Construct the new KKT RHS
+                // -------------------------
+                AugmentedKKTRHS
+                ( solution.x, residual.dualEquality, residual.primalEquality,
+                  residual.dualConic, d );
+
+                // Solve for the direction
+                // -----------------------
+                if( !attemptToSolve(d) )
+                    break;
+                ExpandAugmentedSolution
+                ( solution.x, solution.z, residual.dualConic, d,
+                  affineCorrection.x, affineCorrection.y, affineCorrection.z );
+            }
+            else if( ctrl.system == NORMAL_KKT )
+            {
+                // Construct the new KKT RHS
+                // -------------------------
+                NormalKKTRHS
+                ( problem.A, gammaPerm, solution.x, solution.z,
+                  residual.dualEquality, residual.primalEquality,
+                  residual.dualConic, affineCorrection.y );
+
+                // Solve for the direction
+                // -----------------------
+                if( !attemptToSolve(affineCorrection.y) )
+                    break;
+                ExpandNormalSolution
+                ( problem.A, gammaPerm, solution.x, solution.z,
+                  residual.dualEquality, residual.dualConic,
+                  affineCorrection.x, affineCorrection.y, affineCorrection.z );
+            }
+            affineCorrection.x += correction.x;
+            affineCorrection.y += correction.y;
+            affineCorrection.z += correction.z;
+
+            Real alphaPriCorr =
+              pos_orth::MaxStep
+              ( solution.x, affineCorrection.x, 1/ctrl.maxStepRatio );
+            Real alphaDualCorr =
+              pos_orth::MaxStep
+              ( solution.z, affineCorrection.z, 1/ctrl.maxStepRatio );
+            alphaPriCorr = Min(ctrl.maxStepRatio*alphaPriCorr,Real(1));
+            alphaDualCorr = Min(ctrl.maxStepRatio*alphaDualCorr,Real(1));
+            if( ctrl.forceSameStep )
+                alphaPriCorr = alphaDualCorr = Min(alphaPriCorr,alphaDualCorr);
+            if( Min(alphaPriCorr,alphaDualCorr) <
+                Min(alphaPri,alphaDual) +
+                ctrl.centralityAcceptance*ctrl.centralityStepIncrease )
+                break;
+            if( ctrl.print && commRank == 0 )
+                Output
+                ("Accepted centrality corrector ",corrector,": alphaPri = ",
+                 alphaPriCorr,", alphaDual = ",alphaDualCorr);
+            correction = affineCorrection;
+            alphaPri = alphaPriCorr;
+            alphaDual = alphaDualCorr;
+        }
         if( ctrl.print && commRank == 0 )
             Output("alphaPri = ",alphaPri,", alphaDual = ",alphaDual);
         Axpy( alphaPri,  correction.x, solution.x );
@@ -1250,9 +1456,11 @@ template<typename Real>
 void Mehrotra
 ( const DirectLPProblem<DistMatrix<Real>,DistMatrix<Real>>& problem,
         DirectLPSolution<DistMatrix<Real>>& solution,
+        DirectLPScaling<DistMatrix<Real>>& scaling,
   const MehrotraCtrl<Real>& ctrl )
 {
     EL_DEBUG_CSE
+    EL_PROFILE_REGION("lp::direct::Mehrotra");
     const Grid& grid = problem.A.Grid();
     if( ctrl.outerEquil )
     {
@@ -1261,10 +1469,21 @@ void Mehrotra
         DistDenseDirectLPEquilibration<Real> equilibration;
         ForceSimpleAlignments( equilibratedProblem, grid );
         ForceSimpleAlignments( equilibratedSolution, grid );
+        if( ctrl.reuseEquil )
+        {
+            equilibration.rowScale.SetGrid( grid );
+            equilibration.colScale.SetGrid( grid );
+            equilibration.rowScale = scaling.rowScale;
+            equilibration.colScale = scaling.colScale;
+        }
         Equilibrate
         ( problem, solution,
           equilibratedProblem, equilibratedSolution,
           equilibration, ctrl );
+        scaling.rowScale.SetGrid( grid );
+        scaling.colScale.SetGrid( grid );
+        scaling.rowScale = equilibration.rowScale;
+        scaling.colScale = equilibration.colScale;
         EquilibratedMehrotra( equilibratedProblem, equilibratedSolution, ctrl );
         UndoEquilibration( equilibratedSolution, equilibration, solution );
     }
@@ -1326,6 +1545,19 @@ void Mehrotra
     }
 }
 
+template<typename Real>
+void Mehrotra
+( const DirectLPProblem<DistMatrix<Real>,DistMatrix<Real>>& problem,
+        DirectLPSolution<DistMatrix<Real>>& solution,
+  const MehrotraCtrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    DirectLPScaling<DistMatrix<Real>> scaling;
+    scaling.rowScale.SetGrid( problem.A.Grid() );
+    scaling.colScale.SetGrid( problem.A.Grid() );
+    Mehrotra( problem, solution, scaling, ctrl );
+}
+
 // This interface is now deprecated.
 template<typename Real>
 void Mehrotra
@@ -1338,6 +1570,7 @@ void Mehrotra
   const MehrotraCtrl<Real>& ctrl )
 {
     EL_DEBUG_CSE
+    EL_PROFILE_REGION("lp::direct::Mehrotra");
     const Grid& grid = A.Grid();
     DirectLPProblem<DistMatrix<Real>,DistMatrix<Real>> problem;
     DirectLPSolution<DistMatrix<Real>> solution;
@@ -1413,6 +1646,10 @@ void EquilibratedMehrotra
           ctrl.primalInit, ctrl.dualInit, ctrl.standardInitShift,
           ctrl.solveCtrl );
     }
+    if( ctrl.warmStart && ctrl.primalInit && ctrl.dualInit )
+        pos_orth::WarmStart
+        ( solution.x, solution.z,
+          ctrl.warmStartShift, ctrl.warmStartCentrality );
 
     Matrix<Real> regTmp;
     if( ctrl.system == FULL_KKT )
@@ -1441,6 +1678,17 @@ void EquilibratedMehrotra
     }
     regTmp *= origTwoNormEst;
 
+    NormalPCG<Real,SparseMatrix<Real>,Matrix<Real>> normalPCG;
+    const bool useNormalPCG = ctrl.system == NORMAL_KKT && ctrl.normalPCG;
+    if( useNormalPCG )
+    {
+        normalPCG.Initialize( problem.A, ctrl.denseColumnRatio );
+        if( ctrl.print )
+            Output
+            ("Split ",normalPCG.NumDenseColumns(),
+             " dense columns off of the normal equations");
+    }
+
     Real muOld = 0.1;
     Real relError = 1;
     SparseMatrix<Real> J, JOrig;
@@ -1627,6 +1875,23 @@ void EquilibratedMehrotra
                 ( solution.x, solution.z, residual.dualConic, d,
                   affineCorrection.x, affineCorrection.y, affineCorrection.z );
         }
+        else if( useNormalPCG )
+        {
+            normalPCG.Update( solution.x, solution.z, gammaPerm, deltaPerm );
+            NormalKKTRHS
+            ( problem.A, gammaPerm, solution.x, solution.z,
+              residual.dualEquality, residual.primalEquality,
+              residual.dualConic, affineCorrection.y );
+            const Int numPCGIts =
+              normalPCG.Solve
+              ( affineCorrection.y, ctrl.normalPCGTol, ctrl.normalPCGMaxIts );
+            if( ctrl.print )
+                Output("Affine PCG iterations: ",numPCGIts);
+            ExpandNormalSolution
+            ( problem.A, gammaPerm, solution.x, solution.z,
+              residual.dualEquality, residual.dualConic,
+              affineCorrection.x, affineCorrection.y, affineCorrection.z );
+        }
         else // ctrl.system == NORMAL_KKT
         {
             // Construct the KKT system
@@ -1746,7 +2011,6 @@ void EquilibratedMehrotra
         residual.primalEquality *= 1-sigma;
         residual.dualEquality *= 1-sigma;
         Shift( residual.dualConic, -sigma*mu );
-        // TODO(poulson): Gondzio's corrections
         if( ctrl.mehrotra )
         {
             // r_mu += dxAff o dzAff
@@ -1813,6 +2077,22 @@ void EquilibratedMehrotra
             ( solution.x, solution.z, residual.dualConic, d,
               correction.x, correction.y, correction.z );
         }
+        else if( useNormalPCG )
+        {
+            NormalKKTRHS
+            ( problem.A, gammaPerm, solution.x, solution.z,
+              residual.dualEquality, residual.primalEquality,
+              residual.dualConic, correction.y );
+            const Int numPCGIts =
+              normalPCG.Solve
+              ( correction.y, ctrl.normalPCGTol, ctrl.normalPCGMaxIts );
+            if( ctrl.print )
+                Output("Corrector PCG iterations: ",numPCGIts);
+            ExpandNormalSolution
+            ( problem.A, gammaPerm, solution.x, solution.z,
+              residual.dualEquality, residual.dualConic,
+              correction.x, correction.y, correction.z );
+        }
         else
         {
             NormalKKTRHS
@@ -1854,6 +2134,139 @@ void EquilibratedMehrotra
         alphaDual = Min(ctrl.maxStepRatio*alphaDual,Real(1));
         if( ctrl.forceSameStep )
             alphaPri = alphaDual = Min(alphaPri,alphaDual);
+
+        // Apply Gondzio's multiple centrality correctors
+        // ==============================================
+        // NOTE: affineCorrection is used as a temporary
+        for( Int corrector=0; corrector<ctrl.maxCentralityCorrectors &&
+             Min(alphaPri,alphaDual) < Real(1); ++corrector )
+        {
+            const Real alphaPriTarget =
+              Min(alphaPri+ctrl.centralityStepIncrease,Real(1));
+            const Real alphaDualTarget =
+              Min(alphaDual+ctrl.centralityStepIncrease,Real(1));
+            Zero( residual.primalEquality );
+            Zero( residual.dualEquality );
+            pos_orth::CentralityResidual
+            ( solution.x, solution.z, correction.x, correction.z,
+              alphaPriTarget, alphaDualTarget, sigma*mu,
+              ctrl.centralityBetaMin, ctrl.centralityBetaMax,
+              residual.dualConic );
+            if( ctrl.system == FULL_KKT )
+            {
+                KKTRHS
+                ( residual.dualEquality, residual.primalEquality,
+                  residual.dualConic, solution.z, d );
+                try
+                {
+                    if( ctrl.resolveReg )
+                        reg_ldl::SolveAfter
+                        ( JOrig, regTmp, dInner, sparseLDLFact, d,
+                          ctrl.solveCtrl );
+                    else
+                        reg_ldl::RegularizedSolveAfter
+                        ( JOrig, regTmp, dInner, sparseLDLFact, d,
+                          ctrl.solveCtrl.relTol,
+                          ctrl.solveCtrl.maxRefineIts,
+                          ctrl.solveCtrl.progress );
+                }
+                catch( SingularMatrixException& e ) { break; }
+                catch( NonHPDMatrixException& e ) { break; }
+                ExpandSolution
+                ( m, n, d,
+                  affineCorrection.x, affineCorrection.y, affineCorrection.z );
+            }
+            else if( ctrl.system == AUGMENTED_KKT )
+            {
+                AugmentedKKTRHS
+                ( solution.x, residual.dualEquality, residual.primalEquality,
+                  residual.dualConic, d );
+                try
+                {
+                    if( ctrl.resolveReg )
+                        reg_ldl::SolveAfter
+                        ( JOrig, regTmp, dInner, sparseLDLFact, d,
+                          ctrl.solveCtrl );
+                    else
+                        reg_ldl::RegularizedSolveAfter
+                        ( JOrig, regTmp, dInner, sparseLDLFact, d,
+                          ctrl.solveCtrl.relTol,
+                          ctrl.solveCtrl.maxRefineIts,
+                          ctrl.solveCtrl.progress );
+                }
+                catch( SingularMatrixException& e ) { break; }
+                catch( NonHPDMatrixException& e ) { break; }
+                ExpandAugmentedSolution
+                ( solution.x, solution.z, residual.dualConic, d,
+                  affineCorrection.x, affineCorrection.y, affineCorrection.z );
+            }
+            else if( useNormalPCG )
+            {
+                NormalKKTRHS
+                ( problem.A, gammaPerm, solution.x, solution.z,
+                  residual.dualEquality, residual.primalEquality,
+                  residual.dualConic, affineCorrection.y );
+                const Int numPCGIts =
+                  normalPCG.Solve
+                  ( affineCorrection.y,
+                    ctrl.normalPCGTol, ctrl.normalPCGMaxIts );
+                if( ctrl.print )
+                    Output("Centrality corrector PCG iterations: ",numPCGIts);
+                ExpandNormalSolution
+                ( problem.A, gammaPerm, solution.x, solution.z,
+                  residual.dualEquality, residual.dualConic,
+                  affineCorrection.x, affineCorrection.y, affineCorrection.z );
+            }
+            else
+            {
+                NormalKKTRHS
+                ( problem.A, gammaPerm, solution.x, solution.z,
+                  residual.dualEquality, residual.primalEquality,
+                  residual.dualConic, affineCorrection.y );
+                try
+                {
+                    // NOTE: regTmp should be all zeros; replace with
+                    //       unregularized
+                    reg_ldl::RegularizedSolveAfter
+                    ( J, regTmp, sparseLDLFact, affineCorrection.y,
+                      ctrl.solveCtrl.relTol,
+                      ctrl.solveCtrl.maxRefineIts,
+                      ctrl.solveCtrl.progress,
+                      ctrl.solveCtrl.time );
+                }
+                catch( SingularMatrixException& e ) { break; }
+                catch( NonHPDMatrixException& e ) { break; }
+                ExpandNormalSolution
+                ( problem.A, gammaPerm, solution.x, solution.z,
+                  residual.dualEquality, residual.dualConic,
+                  affineCorrection.x, affineCorrection.y, affineCorrection.z );
+            }
+            affineCorrection.x += correction.x;
+            affineCorrection.y += correction.y;
+            affineCorrection.z += correction.z;
+
+            Real alphaPriCorr =
+              pos_orth::MaxStep
+              ( solution.x, affineCorrection.x, 1/ctrl.maxStepRatio );
+            Real alphaDualCorr =
+              pos_orth::MaxStep
+              ( solution.z, affineCorrection.z, 1/ctrl.maxStepRatio );
+            alphaPriCorr = Min(ctrl.maxStepRatio*alphaPriCorr,Real(1));
+            alphaDualCorr = Min(ctrl.maxStepRatio*alphaDualCorr,Real(1));
+            if( ctrl.forceSameStep )
+                alphaPriCorr = alphaDualCorr = Min(alphaPriCorr,alphaDualCorr);
+            if( Min(alphaPriCorr,alphaDualCorr) <
+                Min(alphaPri,alphaDual) +
+                ctrl.centralityAcceptance*ctrl.centralityStepIncrease )
+                break;
+            if( ctrl.print )
+                Output
+                ("Accepted centrality corrector ",corrector,": alphaPri = ",
+                 alphaPriCorr,", alphaDual = ",alphaDualCorr);
+            correction = affineCorrection;
+            alphaPri = alphaPriCorr;
+            alphaDual = alphaDualCorr;
+        }
         if( ctrl.print )
             Output("alphaPri = ",alphaPri,", alphaDual = ",alphaDual);
         Axpy( alphaPri,  correction.x, solution.x );
@@ -1875,17 +2288,26 @@ template<typename Real>
 void Mehrotra
 ( const DirectLPProblem<SparseMatrix<Real>,Matrix<Real>>& problem,
         DirectLPSolution<Matrix<Real>>& solution,
+        DirectLPScaling<Matrix<Real>>& scaling,
   const MehrotraCtrl<Real>& ctrl )
 {
     EL_DEBUG_CSE
+    EL_PROFILE_REGION("lp::direct::Mehrotra");
     if( ctrl.outerEquil )
     {
         DirectLPProblem<SparseMatrix<Real>,Matrix<Real>> equilibratedProblem;
         DirectLPSolution<Matrix<Real>> equilibratedSolution;
         SparseDirectLPEquilibration<Real> equilibration;
+        if( ctrl.reuseEquil )
+        {
+            equilibration.rowScale = scaling.rowScale;
+            equilibration.colScale = scaling.colScale;
+        }
         Equilibrate
         ( problem, solution,
           equilibratedProblem, equilibratedSolution, equilibration, ctrl );
+        scaling.rowScale = equilibration.rowScale;
+        scaling.colScale = equilibration.colScale;
         EquilibratedMehrotra( equilibratedProblem, equilibratedSolution, ctrl );
         UndoEquilibration( equilibratedSolution, equilibration, solution );
     }
@@ -1912,6 +2334,17 @@ void Mehrotra
     }
 }
 
+template<typename Real>
+void Mehrotra
+( const DirectLPProblem<SparseMatrix<Real>,Matrix<Real>>& problem,
+        DirectLPSolution<Matrix<Real>>& solution,
+  const MehrotraCtrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    DirectLPScaling<Matrix<Real>> scaling;
+    Mehrotra( problem, solution, scaling, ctrl );
+}
+
 // This interface is now deprecated.
 template<typename Real>
 void Mehrotra
@@ -1924,6 +2357,7 @@ void Mehrotra
   const MehrotraCtrl<Real>& ctrl )
 {
     EL_DEBUG_CSE
+    EL_PROFILE_REGION("lp::direct::Mehrotra");
     DirectLPProblem<SparseMatrix<Real>,Matrix<Real>> problem;
     DirectLPSolution<Matrix<Real>> solution;
     LockedView( problem.c, c );
@@ -2006,6 +2440,10 @@ void EquilibratedMehrotra
           ctrl.primalInit, ctrl.dualInit, ctrl.standardInitShift,
           ctrl.solveCtrl );
     }
+    if( ctrl.warmStart && ctrl.primalInit && ctrl.dualInit )
+        pos_orth::WarmStart
+        ( solution.x, solution.z,
+          ctrl.warmStartShift, ctrl.warmStartCentrality );
     if( commRank == 0 && ctrl.time )
         Output("Init: ",timer.Stop()," secs");
 
@@ -2038,10 +2476,20 @@ void EquilibratedMehrotra
     }
     regTmp *= origTwoNormEst;
 
+    NormalPCG<Real,DistSparseMatrix<Real>,DistMultiVec<Real>> normalPCG;
+    const bool useNormalPCG = ctrl.system == NORMAL_KKT && ctrl.normalPCG;
+    if( useNormalPCG )
+    {
+        normalPCG.Initialize( problem.A, ctrl.denseColumnRatio );
+        if( ctrl.print && commRank == 0 )
+            Output
+            ("Split ",normalPCG.NumDenseColumns(),
+             " dense columns off of the normal equations");
+    }
+
     Real muOld = 0.1;
     Real relError = 1;
 
-    DistGraphMultMeta metaOrig, meta;
     DistSparseMatrix<Real> J(grid), JOrig(grid);
     DistMultiVec<Real> d(grid), w(grid);
     DistMultiVec<Real> dInner(grid);
@@ -2165,21 +2613,11 @@ void EquilibratedMehrotra
             }
             J = JOrig;
             UpdateDiagonal( J, Real(1), regTmp );
-            if( numIts == 0 )
-            {
-                metaOrig = JOrig.InitializeMultMeta();
-                meta = J.InitializeMultMeta();
-                if( ctrl.print )
-                {
-                    const double imbalanceJ = J.Imbalance();
-                    if( commRank == 0 )
-                        Output("Imbalance factor of J: ",imbalanceJ);
-                }
-            }
-            else
+            if( numIts == 0 && ctrl.print )
             {
-                JOrig.LockedDistGraph().multMeta = metaOrig;
-                J.LockedDistGraph().multMeta = meta;
+                const double imbalanceJ = J.Imbalance();
+                if( commRank == 0 )
+                    Output("Imbalance factor of J: ",imbalanceJ);
             }
 
             // Solve for the direction
@@ -2259,6 +2697,27 @@ void EquilibratedMehrotra
                 ( solution.x, solution.z, residual.dualConic, d,
                   affineCorrection.x, affineCorrection.y, affineCorrection.z );
         }
+        else if( useNormalPCG )
+        {
+            normalPCG.Update( solution.x, solution.z, gammaPerm, deltaPerm );
+            NormalKKTRHS
+            ( problem.A, gammaPerm, solution.x, solution.z,
+              residual.dualEquality, residual.primalEquality,
+              residual.dualConic, affineCorrection.y );
+            if( commRank == 0 && ctrl.time )
+                timer.Start();
+            const Int numPCGIts =
+              normalPCG.Solve
+              ( affineCorrection.y, ctrl.normalPCGTol, ctrl.normalPCGMaxIts );
+            if( commRank == 0 && ctrl.time )
+                Output("Affine PCG: ",timer.Stop()," secs");
+            if( commRank == 0 && ctrl.print )
+                Output("Affine PCG iterations: ",numPCGIts);
+            ExpandNormalSolution
+            ( problem.A, gammaPerm, solution.x, solution.z,
+              residual.dualEquality, residual.dualConic,
+              affineCorrection.x, affineCorrection.y, affineCorrection.z );
+        }
         else // ctrl.system == NORMAL_KKT
         {
             // Assemble the KKT system
@@ -2271,19 +2730,11 @@ void EquilibratedMehrotra
             ( problem.A, gammaPerm, solution.x, solution.z,
               residual.dualEquality, residual.primalEquality,
               residual.dualConic, affineCorrection.y );
-            if( numIts == 0 )
-            {
-                if( ctrl.print )
-                {
-                    const double imbalanceJ = J.Imbalance();
-                    if( commRank == 0 )
-                        Output("Imbalance factor of J: ",imbalanceJ);
-                }
-                meta = J.InitializeMultMeta();
-            }
-            else
+            if( numIts == 0 && ctrl.print )
             {
-                J.LockedDistGraph().multMeta = meta;
+                const double imbalanceJ = J.Imbalance();
+                if( commRank == 0 )
+                    Output("Imbalance factor of J: ",imbalanceJ);
             }
 
             // Solve for the direction
@@ -2477,6 +2928,26 @@ void EquilibratedMehrotra
             ( solution.x, solution.z, residual.dualConic, d,
               correction.x, correction.y, correction.z );
         }
+        else if( useNormalPCG )
+        {
+            NormalKKTRHS
+            ( problem.A, gammaPerm, solution.x, solution.z,
+              residual.dualEquality, residual.primalEquality,
+              residual.dualConic, correction.y );
+            if( commRank == 0 && ctrl.time )
+                timer.Start();
+            const Int numPCGIts =
+              normalPCG.Solve
+              ( correction.y, ctrl.normalPCGTol, ctrl.normalPCGMaxIts );
+            if( commRank == 0 && ctrl.time )
+                Output("Corrector PCG: ",timer.Stop()," secs");
+            if( commRank == 0 && ctrl.print )
+                Output("Corrector PCG iterations: ",numPCGIts);
+            ExpandNormalSolution
+            ( problem.A, gammaPerm, solution.x, solution.z,
+              residual.dualEquality, residual.dualConic,
+              correction.x, correction.y, correction.z );
+        }
         else
         {
             NormalKKTRHS
@@ -2521,6 +2992,153 @@ void EquilibratedMehrotra
         alphaDual = Min(ctrl.maxStepRatio*alphaDual,Real(1));
         if( ctrl.forceSameStep )
             alphaPri = alphaDual = Min(alphaPri,alphaDual);
+
+        // Apply Gondzio's multiple centrality correctors
+        // ==============================================
+        // NOTE: affineCorrection is used as a temporary
+        for( Int corrector=0; corrector<ctrl.maxCentralityCorrectors &&
+             Min(alphaPri,alphaDual) < Real(1); ++corrector )
+        {
+            const Real alphaPriTarget =
+              Min(alphaPri+ctrl.centralityStepIncrease,Real(1));
+            const Real alphaDualTarget =
+              Min(alphaDual+ctrl.centralityStepIncrease,Real(1));
+            Zero( residual.primalEquality );
+            Zero( residual.dualEquality );
+            pos_orth::CentralityResidual
+            ( solution.x, solution.z, correction.x, correction.z,
+              alphaPriTarget, alphaDualTarget, sigma*mu,
+              ctrl.centralityBetaMin, ctrl.centralityBetaMax,
+              residual.dualConic );
+            if( ctrl.system == FULL_KKT )
+            {
+                KKTRHS
+                ( residual.dualEquality, residual.primalEquality,
+                  residual.dualConic, solution.z, d );
+                try
+                {
+                    if( commRank == 0 && ctrl.time )
+                        timer.Start();
+                    if( ctrl.resolveReg )
+                        reg_ldl::SolveAfter
+                        ( JOrig, regTmp, dInner, sparseLDLFact, d,
+                          ctrl.solveCtrl );
+                    else
+                        reg_ldl::RegularizedSolveAfter
+                        ( JOrig, regTmp, dInner, sparseLDLFact, d,
+                          ctrl.solveCtrl.relTol,
+                          ctrl.solveCtrl.maxRefineIts,
+                          ctrl.solveCtrl.progress );
+                    if( commRank == 0 && ctrl.time )
+                        Output("Centrality solve: ",timer.Stop()," secs");
+                }
+                catch( SingularMatrixException& e ) { break; }
+                catch( NonHPDMatrixException& e ) { break; }
+                ExpandSolution
+                ( m, n, d,
+                  affineCorrection.x, affineCorrection.y, affineCorrection.z );
+            }
+            else if( ctrl.system == AUGMENTED_KKT )
+            {
+                AugmentedKKTRHS
+                ( solution.x, residual.dualEquality, residual.primalEquality,
+                  residual.dualConic, d );
+                try
+                {
+                    if( commRank == 0 && ctrl.time )
+                        timer.Start();
+                    if( ctrl.resolveReg )
+                        reg_ldl::SolveAfter
+                        ( JOrig, regTmp, dInner, sparseLDLFact, d,
+                          ctrl.solveCtrl );
+                    else
+                        reg_ldl::RegularizedSolveAfter
+                        ( JOrig, regTmp, dInner, sparseLDLFact, d,
+                          ctrl.solveCtrl.relTol,
+                          ctrl.solveCtrl.maxRefineIts,
+                          ctrl.solveCtrl.progress );
+                    if( commRank == 0 && ctrl.time )
+                        Output("Centrality solve: ",timer.Stop()," secs");
+                }
+                catch( SingularMatrixException& e ) { break; }
+                catch( NonHPDMatrixException& e ) { break; }
+                ExpandAugmentedSolution
+                ( solution.x, solution.z, residual.dualConic, d,
+                  affineCorrection.x, affineCorrection.y, affineCorrection.z );
+            }
+            else if( useNormalPCG )
+            {
+                NormalKKTRHS
+                ( problem.A, gammaPerm, solution.x, solution.z,
+                  residual.dualEquality, residual.primalEquality,
+                  residual.dualConic, affineCorrection.y );
+                if( commRank == 0 && ctrl.time )
+                    timer.Start();
+                const Int numPCGIts =
+                  normalPCG.Solve
+                  ( affineCorrection.y,
+                    ctrl.normalPCGTol, ctrl.normalPCGMaxIts );
+                if( commRank == 0 && ctrl.time )
+                    Output("Centrality corrector PCG: ",timer.Stop()," secs");
+                if( commRank == 0 && ctrl.print )
+                    Output("Centrality corrector PCG iterations: ",numPCGIts);
+                ExpandNormalSolution
+                ( problem.A, gammaPerm, solution.x, solution.z,
+                  residual.dualEquality, residual.dualConic,
+                  affineCorrection.x, affineCorrection.y, affineCorrection.z );
+            }
+            else
+            {
+                NormalKKTRHS
+                ( problem.A, gammaPerm, solution.x, solution.z,
+                  residual.dualEquality, residual.primalEquality,
+                  residual.dualConic, affineCorrection.y );
+                try
+                {
+                    if( commRank == 0 && ctrl.time )
+                        timer.Start();
+                    reg_ldl::RegularizedSolveAfter
+                    ( J, regTmp, sparseLDLFact, affineCorrection.y,
+                      ctrl.solveCtrl.relTol,
+                      ctrl.solveCtrl.maxRefineIts,
+                      ctrl.solveCtrl.progress,
+                      ctrl.solveCtrl.time );
+                    if( commRank == 0 && ctrl.time )
+                        Output("Centrality solve: ",timer.Stop()," secs");
+                }
+                catch( SingularMatrixException& e ) { break; }
+                catch( NonHPDMatrixException& e ) { break; }
+                ExpandNormalSolution
+                ( problem.A, gammaPerm, solution.x, solution.z,
+                  residual.dualEquality, residual.dualConic,
+                  affineCorrection.x, affineCorrection.y, affineCorrection.z );
+            }
+            affineCorrection.x += correction.x;
+            affineCorrection.y += correction.y;
+            affineCorrection.z += correction.z;
+
+            Real alphaPriCorr =
+              pos_orth::MaxStep
+              ( solution.x, affineCorrection.x, 1/ctrl.maxStepRatio );
+            Real alphaDualCorr =
+              pos_orth::MaxStep
+              ( solution.z, affineCorrection.z, 1/ctrl.maxStepRatio );
+            alphaPriCorr = Min(ctrl.maxStepRatio*alphaPriCorr,Real(1));
+            alphaDualCorr = Min(ctrl.maxStepRatio*alphaDualCorr,Real(1));
+            if( ctrl.forceSameStep )
+                alphaPriCorr = alphaDualCorr = Min(alphaPriCorr,alphaDualCorr);
+            if( Min(alphaPriCorr,alphaDualCorr) <
+                Min(alphaPri,alphaDual) +
+                ctrl.centralityAcceptance*ctrl.centralityStepIncrease )
+                break;
+            if( ctrl.print && commRank == 0 )
+                Output
+                ("Accepted centrality corrector ",corrector,": alphaPri = ",
+                 alphaPriCorr,", alphaDual = ",alphaDualCorr);
+            correction = affineCorrection;
+            alphaPri = alphaPriCorr;
+            alphaDual = alphaDualCorr;
+        }
         if( ctrl.print && commRank == 0 )
             Output("alphaPri = ",alphaPri,", alphaDual = ",alphaDual);
         Axpy( alphaPri,  correction.x, solution.x );
@@ -2542,18 +3160,31 @@ template<typename Real>
 void Mehrotra
 ( const DirectLPProblem<DistSparseMatrix<Real>,DistMultiVec<Real>>& problem,
         DirectLPSolution<DistMultiVec<Real>>& solution,
+        DirectLPScaling<DistMultiVec<Real>>& scaling,
   const MehrotraCtrl<Real>& ctrl )
 {
     EL_DEBUG_CSE
+    EL_PROFILE_REGION("lp::direct::Mehrotra");
     if( ctrl.outerEquil )
     {
         DirectLPProblem<DistSparseMatrix<Real>,DistMultiVec<Real>>
           equilibratedProblem;
         DirectLPSolution<DistMultiVec<Real>> equilibratedSolution;
         DistSparseDirectLPEquilibration<Real> equilibration;
+        if( ctrl.reuseEquil )
+        {
+            equilibration.rowScale.SetGrid( problem.A.Grid() );
+            equilibration.colScale.SetGrid( problem.A.Grid() );
+            equilibration.rowScale = scaling.rowScale;
+            equilibration.colScale = scaling.colScale;
+        }
         Equilibrate
         ( problem, solution,
           equilibratedProblem, equilibratedSolution, equilibration, ctrl );
+        scaling.rowScale.SetGrid( problem.A.Grid() );
+        scaling.colScale.SetGrid( problem.A.Grid() );
+        scaling.rowScale = equilibration.rowScale;
+        scaling.colScale = equilibration.colScale;
         EquilibratedMehrotra( equilibratedProblem, equilibratedSolution, ctrl );
         UndoEquilibration( equilibratedSolution, equilibration, solution );
     }
@@ -2581,6 +3212,19 @@ void Mehrotra
     }
 }
 
+template<typename Real>
+void Mehrotra
+( const DirectLPProblem<DistSparseMatrix<Real>,DistMultiVec<Real>>& problem,
+        DirectLPSolution<DistMultiVec<Real>>& solution,
+  const MehrotraCtrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    DirectLPScaling<DistMultiVec<Real>> scaling;
+    scaling.rowScale.SetGrid( problem.A.Grid() );
+    scaling.colScale.SetGrid( problem.A.Grid() );
+    Mehrotra( problem, solution, scaling, ctrl );
+}
+
 // This interface is now deprecated.
 template<typename Real>
 void Mehrotra
@@ -2593,6 +3237,7 @@ void Mehrotra
   const MehrotraCtrl<Real>& ctrl )
 {
     EL_DEBUG_CSE
+    EL_PROFILE_REGION("lp::direct::Mehrotra");
     const Grid& grid = A.Grid();
 
     DirectLPProblem<DistSparseMatrix<Real>,DistMultiVec<Real>> problem;
@@ -2618,6 +3263,11 @@ void Mehrotra
           DirectLPSolution<Matrix<Real>>& solution, \
     const MehrotraCtrl<Real>& ctrl ); \
   template void Mehrotra \
+  ( const DirectLPProblem<Matrix<Real>,Matrix<Real>>& problem, \
+          DirectLPSolution<Matrix<Real>>& solution, \
+          DirectLPScaling<Matrix<Real>>& scaling, \
+    const MehrotraCtrl<Real>& ctrl ); \
+  template void Mehrotra \
   ( const Matrix<Real>& A, \
     const Matrix<Real>& b, \
     const Matrix<Real>& c, \
@@ -2630,6 +3280,11 @@ void Mehrotra
           DirectLPSolution<DistMatrix<Real>>& solution, \
     const MehrotraCtrl<Real>& ctrl ); \
   template void Mehrotra \
+  ( const DirectLPProblem<DistMatrix<Real>,DistMatrix<Real>>& problem, \
+          DirectLPSolution<DistMatrix<Real>>& solution, \
+          DirectLPScaling<DistMatrix<Real>>& scaling, \
+    const MehrotraCtrl<Real>& ctrl ); \
+  template void Mehrotra \
   ( const AbstractDistMatrix<Real>& A, \
     const AbstractDistMatrix<Real>& b, \
     const AbstractDistMatrix<Real>& c, \
@@ -2642,6 +3297,11 @@ void Mehrotra
           DirectLPSolution<Matrix<Real>>& solution, \
     const MehrotraCtrl<Real>& ctrl ); \
   template void Mehrotra \
+  ( const DirectLPProblem<SparseMatrix<Real>,Matrix<Real>>& problem, \
+          DirectLPSolution<Matrix<Real>>& solution, \
+          DirectLPScaling<Matrix<Real>>& scaling, \
+    const MehrotraCtrl<Real>& ctrl ); \
+  template void Mehrotra \
   ( const SparseMatrix<Real>& A, \
     const Matrix<Real>& b, \
     const Matrix<Real>& c, \
@@ -2654,6 +3314,11 @@ void Mehrotra
           DirectLPSolution<DistMultiVec<Real>>& solution, \
     const MehrotraCtrl<Real>& ctrl ); \
   template void Mehrotra \
+  ( const DirectLPProblem<DistSparseMatrix<Real>,DistMultiVec<Real>>& problem, \
+          DirectLPSolution<DistMultiVec<Real>>& solution, \
+          DirectLPScaling<DistMultiVec<Real>>& scaling, \
+    const MehrotraCtrl<Real>& ctrl ); \
+  template void Mehrotra \
   ( const DistSparseMatrix<Real>& A, \
     const DistMultiVec<Real>& b, \
     const DistMultiVec<Real>& c, \
@@ -239,6 +239,49 @@ void ExpandNormalSolution
   const DistMultiVec<Real>& dy,
         DistMultiVec<Real>& dz );
 
+// Matrix-free normal equations
+// =============================
+// Solves (A D A^T + delta^2 I) dy = r, with D = inv(inv(X) Z + gamma^2 I),
+// via Preconditioned Conjugate Gradients without ever forming A D A^T.
+// The columns of A with more than 'denseColumnRatio' times the height of A
+// nonzeros are split off as A_d so that, with A_s holding the remaining
+// columns, the preconditioner is the low-rank-corrected diagonal
+//
+//   M = diag(A_s D_s A_s^T) + delta^2 I + A_d D_d A_d^T,
+//
+// which is applied via the Sherman-Morrison-Woodbury formula with a (small)
+// dense Cholesky factorization of the capacitance matrix
+//
+//   C = inv(D_d) + A_d^T inv(diag(A_s D_s A_s^T) + delta^2 I) A_d.
+//
+// The storage is thus proportional to nnz(A) plus (height of A) x (number of
+// dense columns).
+template<typename Real,typename MatrixType,typename VectorType>
+class NormalPCG
+{
+public:
+    void Initialize( const MatrixType& A, Real denseColumnRatio );
+    void Update
+    ( const VectorType& x, const VectorType& z, Real gamma, Real delta );
+
+    // Overwrite 'r' with an approximate solution and return the number of
+    // iterations that were performed
+    Int Solve( VectorType& r, Real relTol, Int maxIts );
+
+    Int NumDenseColumns() const { return denseCols_.size(); }
+
+private:
+    const MatrixType* A_=nullptr;
+    MatrixType ASquared_;
+    vector<Int> denseCols_, denseIndex_;
+    Matrix<Real> ADense_, ADenseScaled_, capacitance_;
+    VectorType d_, invDiag_, tmp_;
+    Real deltaSquared_=0;
+
+    void Apply( const VectorType& v, VectorType& w );
+    void ApplyPreconditioner( const VectorType& r, VectorType& s ) const;
+};
+
 } // namespace direct
 } // namespace lp
 } // namespace El
@@ -151,22 +151,17 @@ void NormalKKT
     // TODO(poulson): Expose this value as a parameter
     const Real inflateRatio = Pow(limits::Epsilon<Real>(),Real(0.83));
 
-    // dInv := sqrt( (z ./ x) .+ gamma^2 )
-    // ===================================
-    Matrix<Real> dInv;
-    dInv.Resize( n, 1 );
+    // d := 1 ./ ( (z ./ x) .+ gamma^2 )
+    // =================================
+    Matrix<Real> d;
+    d.Resize( n, 1 );
     for( Int i=0; i<n; ++i )
-        dInv(i) = Sqrt(z(i)/x(i) + gamma*gamma);
+        d(i) = 1 / (z(i)/x(i) + gamma*gamma);
 
     // Form A D^2 A^T + delta^2 I
     // ==========================
-    SparseMatrix<Real> G;
-    // TODO(poulson): Avoid forming this within an inner loop...
-    Transpose( A, G );
-    DiagonalSolve( LEFT, NORMAL, dInv, G );
-    Zeros( J, m, m );
+    ADAT( A, d, J, false, onlyLower );
     ShiftDiagonal( J, delta*delta );
-    Syrk( LOWER, TRANSPOSE, Real(1), G, Real(1), J );
 
     // Inflate the diagonal in a small relative sense
     // ==============================================
@@ -178,9 +173,6 @@ void NormalKKT
         const Real diagAbs = Abs(valBuf[e]);
         valBuf[e] = (1+inflateRatio)*diagAbs;
     }
-
-    if( !onlyLower )
-        MakeSymmetric( LOWER, J );
 }
 
 template<typename Real>
@@ -194,7 +186,6 @@ void NormalKKT
   bool onlyLower )
 {
     EL_DEBUG_CSE
-    const Int m = A.Height();
     const Int n = A.Width();
     const Grid& grid = A.Grid();
     if( !mpi::Congruent( grid.Comm(), x.Grid().Comm() ) )
@@ -208,24 +199,19 @@ void NormalKKT
     auto& xLoc = x.LockedMatrix();
     auto& zLoc = z.LockedMatrix();
 
-    // dInv := sqrt( (z ./ x) .+ gamma^2 )
-    // ===================================
-    DistMultiVec<Real> dInv(grid);
-    dInv.Resize( n, 1 );
-    auto& dInvLoc = dInv.Matrix();
-    const Int dInvLocalHeight = dInv.LocalHeight();
-    for( Int iLoc=0; iLoc<dInvLocalHeight; ++iLoc )
-        dInvLoc(iLoc) = Sqrt(zLoc(iLoc)/xLoc(iLoc) + gamma*gamma);
+    // d := 1 ./ ( (z ./ x) .+ gamma^2 )
+    // =================================
+    DistMultiVec<Real> d(grid);
+    d.Resize( n, 1 );
+    auto& dLoc = d.Matrix();
+    const Int dLocalHeight = d.LocalHeight();
+    for( Int iLoc=0; iLoc<dLocalHeight; ++iLoc )
+        dLoc(iLoc) = 1 / (zLoc(iLoc)/xLoc(iLoc) + gamma*gamma);
 
     // Form A D^2 A^T + delta^2 I
     // ==========================
-    DistSparseMatrix<Real> G(grid);
-    // TODO: Avoid forming this within an inner loop...
-    Transpose( A, G );
-    DiagonalSolve( LEFT, NORMAL, dInv, G );
-    Zeros( J, m, m );
+    ADAT( A, d, J, false, onlyLower );
     ShiftDiagonal( J, delta*delta );
-    Syrk( LOWER, TRANSPOSE, Real(1), G, Real(1), J );
 
     // Inflate the diagonal in a small relative sense
     // ==============================================
@@ -239,9 +225,6 @@ void NormalKKT
         const Real diagAbs = Abs(valBuf[e]);
         valBuf[e] = (1+inflateRatio)*diagAbs;
     }
-
-    if( !onlyLower )
-        MakeSymmetric( LOWER, J );
 }
 
 template<typename Real>
@@ -0,0 +1,289 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+#include "../util.hpp"
+
+namespace El {
+namespace lp {
+namespace direct {
+
+namespace {
+
+// Uniform access to the (local portions of the) sequential and distributed
+// operands so that NormalPCG need only be written once
+
+template<typename Real>
+Int FirstLocalRow( const SparseMatrix<Real>& A ) { return 0; }
+template<typename Real>
+Int FirstLocalRow( const DistSparseMatrix<Real>& A )
+{ return A.FirstLocalRow(); }
+
+template<typename Real>
+Int LocalHeight( const SparseMatrix<Real>& A ) { return A.Height(); }
+template<typename Real>
+Int LocalHeight( const DistSparseMatrix<Real>& A ) { return A.LocalHeight(); }
+
+template<typename Real>
+Int NumLocalEntries( const SparseMatrix<Real>& A ) { return A.NumEntries(); }
+template<typename Real>
+Int NumLocalEntries( const DistSparseMatrix<Real>& A )
+{ return A.NumLocalEntries(); }
+
+template<typename Real>
+void SetGrid( const SparseMatrix<Real>& A, Matrix<Real>& v ) { }
+template<typename Real>
+void SetGrid( const DistSparseMatrix<Real>& A, DistMultiVec<Real>& v )
+{ v.SetGrid( A.Grid() ); }
+
+template<typename Real,typename T>
+void SumOver( const SparseMatrix<Real>& A, T* buf, Int count ) { }
+template<typename Real,typename T>
+void SumOver( const DistSparseMatrix<Real>& A, T* buf, Int count )
+{
+    if( count > 0 )
+        mpi::AllReduce( buf, count, A.Grid().Comm() );
+}
+
+template<typename Real>
+Matrix<Real>& LocalMatrix( Matrix<Real>& v ) { return v; }
+template<typename Real>
+Matrix<Real>& LocalMatrix( DistMultiVec<Real>& v ) { return v.Matrix(); }
+template<typename Real>
+const Matrix<Real>& LocalMatrix( const Matrix<Real>& v ) { return v; }
+template<typename Real>
+const Matrix<Real>& LocalMatrix( const DistMultiVec<Real>& v )
+{ return v.LockedMatrix(); }
+
+// Return the i'th entry of v if it is locally stored and zero otherwise
+template<typename Real>
+Real LocalEntryOrZero( const Matrix<Real>& v, Int i ) { return v(i); }
+template<typename Real>
+Real LocalEntryOrZero( const DistMultiVec<Real>& v, Int i )
+{ return v.IsLocalRow(i) ? v.GetLocal(v.LocalRow(i),0) : Real(0); }
+
+} // anonymous namespace
+
+template<typename Real,typename MatrixType,typename VectorType>
+void NormalPCG<Real,MatrixType,VectorType>::Initialize
+( const MatrixType& A, Real denseColumnRatio )
+{
+    EL_DEBUG_CSE
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int firstLocalRow = FirstLocalRow( A );
+    const Int localHeight = LocalHeight( A );
+    const Int numLocalEntries = NumLocalEntries( A );
+    A_ = &A;
+
+    // Count the nonzeros in each column of A
+    // ======================================
+    vector<Int> colCounts( n, 0 );
+    for( Int e=0; e<numLocalEntries; ++e )
+        ++colCounts[A.Col(e)];
+    SumOver( A, colCounts.data(), n );
+
+    // Flag the dense columns
+    // ======================
+    // NOTE: A lower bound on the threshold avoids treating every column of a
+    //       short matrix as dense.
+    const Real denseThreshold = Max( denseColumnRatio*m, Real(10) );
+    denseCols_.resize( 0 );
+    denseIndex_.resize( n );
+    for( Int j=0; j<n; ++j )
+    {
+        if( colCounts[j] > denseThreshold )
+        {
+            denseIndex_[j] = denseCols_.size();
+            denseCols_.push_back( j );
+        }
+        else
+            denseIndex_[j] = -1;
+    }
+    const Int numDense = denseCols_.size();
+
+    // Split A into the entrywise square of its sparse columns and (the local
+    // rows of) its dense columns
+    // ======================================================================
+    ASquared_ = A;
+    Zeros( ADense_, localHeight, numDense );
+    Real* squareBuf = ASquared_.ValueBuffer();
+    const Real* valBuf = A.LockedValueBuffer();
+    for( Int e=0; e<numLocalEntries; ++e )
+    {
+        const Int jDense = denseIndex_[A.Col(e)];
+        if( jDense >= 0 )
+        {
+            ADense_( A.Row(e)-firstLocalRow, jDense ) = valBuf[e];
+            squareBuf[e] = 0;
+        }
+        else
+            squareBuf[e] = valBuf[e]*valBuf[e];
+    }
+
+    SetGrid( A, d_ );
+    SetGrid( A, invDiag_ );
+    SetGrid( A, tmp_ );
+}
+
+template<typename Real,typename MatrixType,typename VectorType>
+void NormalPCG<Real,MatrixType,VectorType>::Update
+( const VectorType& x, const VectorType& z, Real gamma, Real delta )
+{
+    EL_DEBUG_CSE
+    if( A_ == nullptr )
+        LogicError("NormalPCG must be initialized before being updated");
+    const Int m = A_->Height();
+    const Int numDense = denseCols_.size();
+    const Int localHeight = LocalHeight( *A_ );
+    deltaSquared_ = delta*delta;
+
+    // d := 1 ./ ( (z ./ x) .+ gamma^2 )
+    // =================================
+    d_ = x;
+    auto& dLoc = LocalMatrix( d_ );
+    const auto& xLoc = LocalMatrix( x );
+    const auto& zLoc = LocalMatrix( z );
+    const Int dLocalHeight = dLoc.Height();
+    for( Int iLoc=0; iLoc<dLocalHeight; ++iLoc )
+        dLoc(iLoc) = 1 / (zLoc(iLoc)/xLoc(iLoc) + gamma*gamma);
+
+    // invDiag := 1 ./ ( diag(A_s D_s A_s^T) + delta^2 )
+    // =================================================
+    Zeros( invDiag_, m, 1 );
+    Multiply( NORMAL, Real(1), ASquared_, d_, Real(0), invDiag_ );
+    const Real diagFloor =
+      limits::Epsilon<Real>()*Max(MaxNorm(invDiag_)+deltaSquared_,Real(1));
+    auto& invDiagLoc = LocalMatrix( invDiag_ );
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+        invDiagLoc(iLoc) = 1 / Max(invDiagLoc(iLoc)+deltaSquared_,diagFloor);
+    if( numDense == 0 )
+        return;
+
+    // C := inv(D_d) + A_d^T inv(diag(A_s D_s A_s^T) + delta^2 I) A_d
+    // ===============================================================
+    ADenseScaled_ = ADense_;
+    DiagonalScale( LEFT, NORMAL, invDiagLoc, ADenseScaled_ );
+    Zeros( capacitance_, numDense, numDense );
+    if( localHeight > 0 )
+        Gemm
+        ( TRANSPOSE, NORMAL,
+          Real(1), ADenseScaled_, ADense_, Real(0), capacitance_ );
+    SumOver( *A_, capacitance_.Buffer(), numDense*numDense );
+    vector<Real> dDense( numDense );
+    for( Int jDense=0; jDense<numDense; ++jDense )
+        dDense[jDense] = LocalEntryOrZero( d_, denseCols_[jDense] );
+    SumOver( *A_, dDense.data(), numDense );
+    for( Int jDense=0; jDense<numDense; ++jDense )
+        capacitance_(jDense,jDense) += 1/dDense[jDense];
+    Cholesky( LOWER, capacitance_ );
+}
+
+template<typename Real,typename MatrixType,typename VectorType>
+void NormalPCG<Real,MatrixType,VectorType>::Apply
+( const VectorType& v, VectorType& w )
+{
+    EL_DEBUG_CSE
+    // w := A D A^T v + delta^2 v
+    // ==========================
+    Zeros( tmp_, A_->Width(), 1 );
+    Multiply( TRANSPOSE, Real(1), *A_, v, Real(0), tmp_ );
+    auto& tmpLoc = LocalMatrix( tmp_ );
+    const auto& dLoc = LocalMatrix( d_ );
+    const Int tmpLocalHeight = tmpLoc.Height();
+    for( Int iLoc=0; iLoc<tmpLocalHeight; ++iLoc )
+        tmpLoc(iLoc) *= dLoc(iLoc);
+    w = v;
+    Multiply( NORMAL, Real(1), *A_, tmp_, deltaSquared_, w );
+}
+
+template<typename Real,typename MatrixType,typename VectorType>
+void NormalPCG<Real,MatrixType,VectorType>::ApplyPreconditioner
+( const VectorType& r, VectorType& s ) const
+{
+    EL_DEBUG_CSE
+    const Int numDense = denseCols_.size();
+
+    // s := inv(M_s) r
+    // ===============
+    s = r;
+    auto& sLoc = LocalMatrix( s );
+    const auto& invDiagLoc = LocalMatrix( invDiag_ );
+    const Int localHeight = sLoc.Height();
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+        sLoc(iLoc) *= invDiagLoc(iLoc);
+    if( numDense == 0 )
+        return;
+
+    // s := s - inv(M_s) A_d inv(C) A_d^T s
+    // ====================================
+    Matrix<Real> t;
+    Zeros( t, numDense, 1 );
+    if( localHeight > 0 )
+        Gemv( TRANSPOSE, Real(1), ADense_, sLoc, Real(0), t );
+    SumOver( *A_, t.Buffer(), numDense );
+    cholesky::SolveAfter( LOWER, NORMAL, capacitance_, t );
+    if( localHeight > 0 )
+        Gemv( NORMAL, Real(-1), ADenseScaled_, t, Real(1), sLoc );
+}
+
+template<typename Real,typename MatrixType,typename VectorType>
+Int NormalPCG<Real,MatrixType,VectorType>::Solve
+( VectorType& r, Real relTol, Int maxIts )
+{
+    EL_DEBUG_CSE
+    const Real bNrm2 = FrobeniusNorm( r );
+    if( bNrm2 == Real(0) )
+        return 0;
+
+    VectorType y, s, p, q;
+    SetGrid( *A_, y );
+    SetGrid( *A_, s );
+    SetGrid( *A_, p );
+    SetGrid( *A_, q );
+    Zeros( y, r.Height(), 1 );
+    ApplyPreconditioner( r, s );
+    p = s;
+    Real rho = Dot( r, s );
+    Int numIts = 0;
+    while( numIts < maxIts )
+    {
+        Apply( p, q );
+        const Real alpha = rho / Dot( p, q );
+        Axpy( alpha, p, y );
+        Axpy( -alpha, q, r );
+        ++numIts;
+        if( FrobeniusNorm(r) <= relTol*bNrm2 )
+            break;
+
+        ApplyPreconditioner( r, s );
+        const Real rhoNew = Dot( r, s );
+        const Real beta = rhoNew / rho;
+        rho = rhoNew;
+        p *= beta;
+        p += s;
+    }
+    r = y;
+    return numIts;
+}
+
+#define PROTO(Real) \
+  template class NormalPCG<Real,SparseMatrix<Real>,Matrix<Real>>; \
+  template class NormalPCG<Real,DistSparseMatrix<Real>,DistMultiVec<Real>>;
+
+#define EL_NO_INT_PROTO
+#define EL_NO_COMPLEX_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace direct
+} // namespace lp
+} // namespace El
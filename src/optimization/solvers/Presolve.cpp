@@ -0,0 +1,883 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+namespace El {
+
+namespace {
+
+// Determine the reductions of the (sequential) problem, returning the
+// right-hand side and objective (c + Q xFixed) of the remaining problem in
+// the full-length vectors 'bRes' and 'cRes'. 'Q' may be null.
+template<typename Real>
+void FindReductions
+( const SparseMatrix<Real>* Q,
+  const SparseMatrix<Real>& A,
+  const Matrix<Real>& b,
+  const Matrix<Real>& c,
+        vector<Real>& bRes,
+        vector<Real>& cRes,
+        DirectPresolveInfo<Real>& info,
+  const PresolveCtrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    const Int m = A.Height();
+    const Int n = A.Width();
+    info.height = m;
+    info.width = n;
+    info.steps.clear();
+    info.fixedValues.assign( n, Real(0) );
+
+    // Column access to A
+    SparseMatrix<Real> AT;
+    Transpose( A, AT );
+
+    // The number of nonzeros of each row and column of A (and of each row of
+    // Q) which lie within the remaining problem
+    vector<bool> rowActive(m,true), colActive(n,true);
+    vector<Int> rowCount(m,0), colCount(n,0), QCount(n,0);
+    for( Int e=0; e<A.NumEntries(); ++e )
+    {
+        if( A.Value(e) != Real(0) )
+        {
+            ++rowCount[A.Row(e)];
+            ++colCount[A.Col(e)];
+        }
+    }
+    if( Q != nullptr )
+        for( Int e=0; e<Q->NumEntries(); ++e )
+            if( Q->Value(e) != Real(0) )
+                ++QCount[Q->Row(e)];
+
+    bRes.resize( m );
+    for( Int i=0; i<m; ++i )
+        bRes[i] = b(i);
+    cRes.resize( n );
+    for( Int j=0; j<n; ++j )
+        cRes[j] = c(j);
+
+    auto removeRow = [&]( Int i )
+      {
+        rowActive[i] = false;
+        for( Int e=A.RowOffset(i); e<A.RowOffset(i+1); ++e )
+            if( A.Value(e) != Real(0) && colActive[A.Col(e)] )
+                --colCount[A.Col(e)];
+      };
+    auto fixColumn = [&]( Int j, const Real& value )
+      {
+        colActive[j] = false;
+        info.fixedValues[j] = value;
+        for( Int e=AT.RowOffset(j); e<AT.RowOffset(j+1); ++e )
+        {
+            const Int i = AT.Col(e);
+            if( AT.Value(e) != Real(0) && rowActive[i] )
+            {
+                bRes[i] -= AT.Value(e)*value;
+                --rowCount[i];
+            }
+        }
+        if( Q != nullptr )
+        {
+            for( Int e=Q->RowOffset(j); e<Q->RowOffset(j+1); ++e )
+            {
+                const Int k = Q->Col(e);
+                if( Q->Value(e) != Real(0) && colActive[k] )
+                {
+                    cRes[k] += Q->Value(e)*value;
+                    --QCount[k];
+                }
+            }
+        }
+      };
+
+    vector<Int> pattern;
+    vector<vector<Int>> patterns(m);
+    vector<Int> candidates;
+    Int numPasses = 0;
+    for( ; numPasses<ctrl.maxPasses; ++numPasses )
+    {
+        const Int numStepsOld = info.steps.size();
+
+        // Row reductions
+        // ==============
+        for( Int i=0; i<m; ++i )
+        {
+            if( !rowActive[i] )
+                continue;
+            const Real tol = ctrl.tol*(1+Abs(b(i)));
+            if( rowCount[i] == 0 )
+            {
+                if( !ctrl.emptyRows )
+                    continue;
+                if( Abs(bRes[i]) > tol )
+                    RuntimeError
+                    ("Row ",i," of A is empty but its right-hand side is ",
+                     bRes[i]);
+                removeRow( i );
+                info.steps.push_back( PresolveStep{PRESOLVE_EMPTY_ROW,i,-1} );
+            }
+            else if( rowCount[i] == 1 && ctrl.singletonRows )
+            {
+                Int j = -1;
+                Real alpha = 0;
+                for( Int e=A.RowOffset(i); e<A.RowOffset(i+1); ++e )
+                {
+                    if( A.Value(e) != Real(0) && colActive[A.Col(e)] )
+                    {
+                        j = A.Col(e);
+                        alpha = A.Value(e);
+                    }
+                }
+                Real value = bRes[i] / alpha;
+                if( value < -tol/Abs(alpha) )
+                    RuntimeError
+                    ("Singleton row ",i," of A implies x(",j,") = ",value);
+                value = Max( value, Real(0) );
+                removeRow( i );
+                fixColumn( j, value );
+                info.steps.push_back
+                ( PresolveStep{PRESOLVE_SINGLETON_ROW,i,j} );
+            }
+            else if( ctrl.forcingRows )
+            {
+                bool nonNegative=true, nonPositive=true;
+                for( Int e=A.RowOffset(i); e<A.RowOffset(i+1); ++e )
+                {
+                    if( !colActive[A.Col(e)] )
+                        continue;
+                    if( A.Value(e) < Real(0) )
+                        nonNegative = false;
+                    else if( A.Value(e) > Real(0) )
+                        nonPositive = false;
+                }
+                if( !nonNegative && !nonPositive )
+                    continue;
+                // Since x >= 0, the row is either infeasible or forcing
+                // unless its right-hand side has the sign of its nonzeros
+                const Real sign = ( nonNegative ? Real(1) : Real(-1) );
+                if( sign*bRes[i] < -tol )
+                    RuntimeError
+                    ("Row ",i," of A cannot be satisfied with x >= 0");
+                if( sign*bRes[i] > tol )
+                    continue;
+                pattern.clear();
+                for( Int e=A.RowOffset(i); e<A.RowOffset(i+1); ++e )
+                    if( A.Value(e) != Real(0) && colActive[A.Col(e)] )
+                        pattern.push_back( A.Col(e) );
+                removeRow( i );
+                for( const Int j : pattern )
+                {
+                    fixColumn( j, Real(0) );
+                    info.steps.push_back
+                    ( PresolveStep{PRESOLVE_FORCING_ROW,i,j} );
+                }
+            }
+        }
+
+        // Duplicate rows
+        // ==============
+        if( ctrl.duplicateRows )
+        {
+            // Sort the remaining rows by their sparsity patterns so that rows
+            // with identical patterns are contiguous
+            candidates.clear();
+            for( Int i=0; i<m; ++i )
+            {
+                if( !rowActive[i] || rowCount[i] < 2 )
+                    continue;
+                patterns[i].clear();
+                for( Int e=A.RowOffset(i); e<A.RowOffset(i+1); ++e )
+                    if( A.Value(e) != Real(0) && colActive[A.Col(e)] )
+                        patterns[i].push_back( A.Col(e) );
+                candidates.push_back( i );
+            }
+            std::sort
+            ( candidates.begin(), candidates.end(),
+              [&]( const Int& i0, const Int& i1 )
+              { return patterns[i0] < patterns[i1] ||
+                       (patterns[i0] == patterns[i1] && i0 < i1); } );
+
+            // Within each group, compare each row against the rows kept so
+            // far (which are almost always just the first)
+            vector<Int> representatives;
+            vector<Real> values, repValues;
+            auto activeValues = [&]( Int i, vector<Real>& rowValues )
+              {
+                rowValues.clear();
+                for( Int e=A.RowOffset(i); e<A.RowOffset(i+1); ++e )
+                    if( A.Value(e) != Real(0) && colActive[A.Col(e)] )
+                        rowValues.push_back( A.Value(e) );
+              };
+            Int groupBeg = 0;
+            const Int numCandidates = candidates.size();
+            while( groupBeg < numCandidates )
+            {
+                Int groupEnd = groupBeg+1;
+                while( groupEnd < numCandidates &&
+                       patterns[candidates[groupEnd]] ==
+                       patterns[candidates[groupBeg]] )
+                    ++groupEnd;
+                representatives.clear();
+                for( Int t=groupBeg; t<groupEnd; ++t )
+                {
+                    const Int i = candidates[t];
+                    activeValues( i, values );
+                    bool removed = false;
+                    for( const Int iRep : representatives )
+                    {
+                        activeValues( iRep, repValues );
+                        const Real ratio = values[0] / repValues[0];
+                        bool parallel = true;
+                        for( size_t k=1; k<values.size(); ++k )
+                        {
+                            if( Abs(values[k]-ratio*repValues[k]) >
+                                ctrl.tol*Abs(values[k]) )
+                            {
+                                parallel = false;
+                                break;
+                            }
+                        }
+                        if( !parallel )
+                            continue;
+                        if( Abs(bRes[i]-ratio*bRes[iRep]) >
+                            ctrl.tol*(1+Abs(b(i))) )
+                            RuntimeError
+                            ("Row ",i," of A is a multiple of row ",iRep,
+                             " but its right-hand side is inconsistent");
+                        removeRow( i );
+                        info.steps.push_back
+                        ( PresolveStep{PRESOLVE_DUPLICATE_ROW,i,iRep} );
+                        removed = true;
+                        break;
+                    }
+                    if( !removed )
+                        representatives.push_back( i );
+                }
+                groupBeg = groupEnd;
+            }
+        }
+
+        // Dual fixing of empty columns
+        // ============================
+        if( ctrl.dualFixing )
+        {
+            for( Int j=0; j<n; ++j )
+            {
+                if( !colActive[j] || colCount[j] != 0 || QCount[j] != 0 )
+                    continue;
+                if( cRes[j] < -ctrl.tol*(1+Abs(c(j))) )
+                    RuntimeError
+                    ("Column ",j," is empty and has a negative objective "
+                     "coefficient, so the objective is unbounded");
+                fixColumn( j, Real(0) );
+                info.steps.push_back
+                ( PresolveStep{PRESOLVE_EMPTY_COLUMN,-1,j} );
+            }
+        }
+
+        if( Int(info.steps.size()) == numStepsOld )
+            break;
+    }
+
+    info.keptRows.clear();
+    for( Int i=0; i<m; ++i )
+        if( rowActive[i] )
+            info.keptRows.push_back( i );
+    info.keptCols.clear();
+    for( Int j=0; j<n; ++j )
+        if( colActive[j] )
+            info.keptCols.push_back( j );
+    if( ctrl.progress )
+        Output
+        ("Presolve removed ",m-Int(info.keptRows.size())," of ",m," rows and ",
+         n-Int(info.keptCols.size())," of ",n," columns in ",
+         Min(numPasses+1,ctrl.maxPasses)," passes");
+}
+
+// Return the maps from the original row and column indices to those of the
+// reduced problem (or -1 if they were removed)
+template<typename Real>
+void ReducedMaps
+( const DirectPresolveInfo<Real>& info,
+        vector<Int>& rowMap,
+        vector<Int>& colMap )
+{
+    EL_DEBUG_CSE
+    rowMap.assign( info.height, -1 );
+    colMap.assign( info.width, -1 );
+    const Int numKeptRows = info.keptRows.size();
+    for( Int iRed=0; iRed<numKeptRows; ++iRed )
+        rowMap[info.keptRows[iRed]] = iRed;
+    const Int numKeptCols = info.keptCols.size();
+    for( Int jRed=0; jRed<numKeptCols; ++jRed )
+        colMap[info.keptCols[jRed]] = jRed;
+}
+
+template<typename Real>
+void ReduceMatrix
+( const SparseMatrix<Real>& A,
+  const vector<Int>& rowMap,
+  const vector<Int>& colMap,
+  Int mReduced, Int nReduced,
+        SparseMatrix<Real>& AReduced )
+{
+    EL_DEBUG_CSE
+    Zeros( AReduced, mReduced, nReduced );
+    const Int numEntries = A.NumEntries();
+    Int numKeptEntries = 0;
+    for( Int e=0; e<numEntries; ++e )
+        if( rowMap[A.Row(e)] >= 0 && colMap[A.Col(e)] >= 0 )
+            ++numKeptEntries;
+    AReduced.Reserve( numKeptEntries );
+    for( Int e=0; e<numEntries; ++e )
+    {
+        const Int iRed = rowMap[A.Row(e)];
+        const Int jRed = colMap[A.Col(e)];
+        if( iRed >= 0 && jRed >= 0 )
+            AReduced.QueueUpdate( iRed, jRed, A.Value(e) );
+    }
+    AReduced.ProcessQueues();
+}
+
+template<typename Real>
+void ReduceMatrix
+( const DistSparseMatrix<Real>& A,
+  const vector<Int>& rowMap,
+  const vector<Int>& colMap,
+  Int mReduced, Int nReduced,
+        DistSparseMatrix<Real>& AReduced )
+{
+    EL_DEBUG_CSE
+    AReduced.SetGrid( A.Grid() );
+    Zeros( AReduced, mReduced, nReduced );
+    const Int numLocalEntries = A.NumLocalEntries();
+    Int numKeptEntries = 0;
+    for( Int e=0; e<numLocalEntries; ++e )
+        if( rowMap[A.Row(e)] >= 0 && colMap[A.Col(e)] >= 0 )
+            ++numKeptEntries;
+    // Removing rows shifts the row distribution, so the kept entries are
+    // generally owned by other processes
+    AReduced.Reserve( numKeptEntries, numKeptEntries );
+    for( Int e=0; e<numLocalEntries; ++e )
+    {
+        const Int iRed = rowMap[A.Row(e)];
+        const Int jRed = colMap[A.Col(e)];
+        if( iRed >= 0 && jRed >= 0 )
+            AReduced.QueueUpdate( iRed, jRed, A.Value(e) );
+    }
+    AReduced.ProcessQueues();
+}
+
+template<typename Real>
+void PresolveSequential
+( const SparseMatrix<Real>* Q,
+  const SparseMatrix<Real>& A,
+  const Matrix<Real>& b,
+  const Matrix<Real>& c,
+        SparseMatrix<Real>* QReduced,
+        SparseMatrix<Real>& AReduced,
+        Matrix<Real>& bReduced,
+        Matrix<Real>& cReduced,
+        DirectPresolveInfo<Real>& info,
+  const PresolveCtrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    vector<Real> bRes, cRes;
+    FindReductions( Q, A, b, c, bRes, cRes, info, ctrl );
+
+    vector<Int> rowMap, colMap;
+    ReducedMaps( info, rowMap, colMap );
+    const Int mReduced = info.keptRows.size();
+    const Int nReduced = info.keptCols.size();
+    ReduceMatrix( A, rowMap, colMap, mReduced, nReduced, AReduced );
+    if( Q != nullptr )
+        ReduceMatrix( *Q, colMap, colMap, nReduced, nReduced, *QReduced );
+    bReduced.Resize( mReduced, 1 );
+    for( Int iRed=0; iRed<mReduced; ++iRed )
+        bReduced(iRed) = bRes[info.keptRows[iRed]];
+    cReduced.Resize( nReduced, 1 );
+    for( Int jRed=0; jRed<nReduced; ++jRed )
+        cReduced(jRed) = cRes[info.keptCols[jRed]];
+}
+
+template<typename Real>
+void PresolveDistributed
+( const DistSparseMatrix<Real>* Q,
+  const DistSparseMatrix<Real>& A,
+  const DistMultiVec<Real>& b,
+  const DistMultiVec<Real>& c,
+        DistSparseMatrix<Real>* QReduced,
+        DistSparseMatrix<Real>& AReduced,
+        DistMultiVec<Real>& bReduced,
+        DistMultiVec<Real>& cReduced,
+        DirectPresolveInfo<Real>& info,
+  const PresolveCtrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    const Grid& grid = A.Grid();
+    const int commRank = grid.Rank();
+    const int root = 0;
+
+    // Determine the reductions on the root
+    // ====================================
+    vector<Real> bRes, cRes;
+    if( commRank == root )
+    {
+        SparseMatrix<Real> ASeq, QSeq;
+        Matrix<Real> bSeq, cSeq;
+        CopyFromRoot( A, ASeq );
+        if( Q != nullptr )
+            CopyFromRoot( *Q, QSeq );
+        CopyFromRoot( b, bSeq );
+        CopyFromRoot( c, cSeq );
+        FindReductions
+        ( Q != nullptr ? &QSeq : nullptr, ASeq, bSeq, cSeq, bRes, cRes,
+          info, ctrl );
+    }
+    else
+    {
+        CopyFromNonRoot( A, root );
+        if( Q != nullptr )
+            CopyFromNonRoot( *Q, root );
+        CopyFromNonRoot( b, root );
+        CopyFromNonRoot( c, root );
+    }
+    info.height = A.Height();
+    info.width = A.Width();
+    Int numKept[2] = { Int(info.keptRows.size()), Int(info.keptCols.size()) };
+    mpi::Broadcast( numKept, 2, root, grid.Comm() );
+    info.keptRows.resize( numKept[0] );
+    info.keptCols.resize( numKept[1] );
+    info.fixedValues.resize( info.width );
+    mpi::Broadcast( info.keptRows.data(), numKept[0], root, grid.Comm() );
+    mpi::Broadcast( info.keptCols.data(), numKept[1], root, grid.Comm() );
+    mpi::Broadcast( info.fixedValues.data(), info.width, root, grid.Comm() );
+
+    // Form the reduced problem in parallel
+    // ====================================
+    vector<Int> rowMap, colMap;
+    ReducedMaps( info, rowMap, colMap );
+    const Int mReduced = numKept[0];
+    const Int nReduced = numKept[1];
+    ReduceMatrix( A, rowMap, colMap, mReduced, nReduced, AReduced );
+    if( Q != nullptr )
+        ReduceMatrix( *Q, colMap, colMap, nReduced, nReduced, *QReduced );
+
+    // The modified right-hand side and objective are only known on the root
+    bReduced.SetGrid( grid );
+    cReduced.SetGrid( grid );
+    Zeros( bReduced, mReduced, 1 );
+    Zeros( cReduced, nReduced, 1 );
+    if( commRank == root )
+    {
+        bReduced.Reserve( mReduced );
+        for( Int iRed=0; iRed<mReduced; ++iRed )
+            bReduced.QueueUpdate( iRed, 0, bRes[info.keptRows[iRed]] );
+        cReduced.Reserve( nReduced );
+        for( Int jRed=0; jRed<nReduced; ++jRed )
+            cReduced.QueueUpdate( jRed, 0, cRes[info.keptCols[jRed]] );
+    }
+    bReduced.ProcessQueues();
+    cReduced.ProcessQueues();
+}
+
+template<typename Real>
+void PostsolveSequential
+( const SparseMatrix<Real>* Q,
+  const SparseMatrix<Real>& A,
+  const Matrix<Real>& c,
+  const DirectPresolveInfo<Real>& info,
+  const Matrix<Real>& xReduced,
+  const Matrix<Real>& yReduced,
+  const Matrix<Real>& zReduced,
+        Matrix<Real>& x,
+        Matrix<Real>& y,
+        Matrix<Real>& z )
+{
+    EL_DEBUG_CSE
+    const Int m = info.height;
+    const Int n = info.width;
+    const Int mReduced = info.keptRows.size();
+    const Int nReduced = info.keptCols.size();
+    if( xReduced.Height() != nReduced || zReduced.Height() != nReduced ||
+        yReduced.Height() != mReduced )
+        LogicError("The reduced solution does not match the presolve");
+
+    x.Resize( n, 1 );
+    for( Int j=0; j<n; ++j )
+        x(j) = info.fixedValues[j];
+    for( Int jRed=0; jRed<nReduced; ++jRed )
+        x(info.keptCols[jRed]) = xReduced(jRed);
+    Zeros( y, m, 1 );
+    for( Int iRed=0; iRed<mReduced; ++iRed )
+        y(info.keptRows[iRed]) = yReduced(iRed);
+
+    // w := c + Q x + A^T y, which is updated as the duals of the removed rows
+    // are determined (they are initially zero)
+    Matrix<Real> w( c );
+    if( Q != nullptr )
+        Multiply( NORMAL, Real(1), *Q, x, Real(1), w );
+    Multiply( TRANSPOSE, Real(1), A, y, Real(1), w );
+    auto setRowDual = [&]( Int i, const Real& psi )
+      {
+        y(i) = psi;
+        for( Int e=A.RowOffset(i); e<A.RowOffset(i+1); ++e )
+            w(A.Col(e)) += A.Value(e)*psi;
+      };
+
+    // Undo the reductions in reverse order so that the dual slack of each
+    // eliminated column only depends upon the duals of rows which have already
+    // been restored. Empty and duplicate rows keep zero duals.
+    const Int numSteps = info.steps.size();
+    for( Int s=numSteps-1; s>=0; --s )
+    {
+        const PresolveStep& step = info.steps[s];
+        if( step.reduction == PRESOLVE_SINGLETON_ROW )
+        {
+            // Choose y(i) so that z(j) = 0
+            const Int i = step.row;
+            const Real alpha = A.Value(A.Offset(i,step.col));
+            setRowDual( i, -w(step.col)/alpha );
+        }
+        else if( step.reduction == PRESOLVE_FORCING_ROW )
+        {
+            // Choose the y(i) of minimal magnitude such that all of the
+            // columns fixed by row i have nonnegative dual slacks
+            const Int i = step.row;
+            Real psi = 0;
+            for( ; s>=0 && info.steps[s].reduction == PRESOLVE_FORCING_ROW &&
+                   info.steps[s].row == i; --s )
+            {
+                const Int j = info.steps[s].col;
+                const Real alpha = A.Value(A.Offset(i,j));
+                if( alpha > Real(0) )
+                    psi = Max( psi, -w(j)/alpha );
+                else
+                    psi = Min( psi, -w(j)/alpha );
+            }
+            ++s;
+            setRowDual( i, psi );
+        }
+    }
+
+    z.Resize( n, 1 );
+    for( Int j=0; j<n; ++j )
+        z(j) = w(j);
+    for( const auto& step : info.steps )
+        if( step.reduction == PRESOLVE_SINGLETON_ROW )
+            z(step.col) = Real(0);
+    for( Int jRed=0; jRed<nReduced; ++jRed )
+        z(info.keptCols[jRed]) = zReduced(jRed);
+}
+
+template<typename Real>
+void PostsolveDistributed
+( const DistSparseMatrix<Real>* Q,
+  const DistSparseMatrix<Real>& A,
+  const DistMultiVec<Real>& c,
+  const DirectPresolveInfo<Real>& info,
+  const DistMultiVec<Real>& xReduced,
+  const DistMultiVec<Real>& yReduced,
+  const DistMultiVec<Real>& zReduced,
+        DistMultiVec<Real>& x,
+        DistMultiVec<Real>& y,
+        DistMultiVec<Real>& z )
+{
+    EL_DEBUG_CSE
+    const Grid& grid = A.Grid();
+    const int commRank = grid.Rank();
+    const int root = 0;
+    const Int m = info.height;
+    const Int n = info.width;
+
+    x.SetGrid( grid );
+    y.SetGrid( grid );
+    z.SetGrid( grid );
+    Zeros( x, n, 1 );
+    Zeros( y, m, 1 );
+    Zeros( z, n, 1 );
+    if( commRank == root )
+    {
+        SparseMatrix<Real> ASeq, QSeq;
+        Matrix<Real> cSeq, xRedSeq, yRedSeq, zRedSeq, xSeq, ySeq, zSeq;
+        CopyFromRoot( A, ASeq );
+        if( Q != nullptr )
+            CopyFromRoot( *Q, QSeq );
+        CopyFromRoot( c, cSeq );
+        CopyFromRoot( xReduced, xRedSeq );
+        CopyFromRoot( yReduced, yRedSeq );
+        CopyFromRoot( zReduced, zRedSeq );
+        PostsolveSequential
+        ( Q != nullptr ? &QSeq : nullptr, ASeq, cSeq, info,
+          xRedSeq, yRedSeq, zRedSeq, xSeq, ySeq, zSeq );
+
+        x.Reserve( n );
+        z.Reserve( n );
+        for( Int j=0; j<n; ++j )
+        {
+            x.QueueUpdate( j, 0, xSeq(j) );
+            z.QueueUpdate( j, 0, zSeq(j) );
+        }
+        y.Reserve( m );
+        for( Int i=0; i<m; ++i )
+            y.QueueUpdate( i, 0, ySeq(i) );
+    }
+    else
+    {
+        CopyFromNonRoot( A, root );
+        if( Q != nullptr )
+            CopyFromNonRoot( *Q, root );
+        CopyFromNonRoot( c, root );
+        CopyFromNonRoot( xReduced, root );
+        CopyFromNonRoot( yReduced, root );
+        CopyFromNonRoot( zReduced, root );
+    }
+    x.ProcessQueues();
+    y.ProcessQueues();
+    z.ProcessQueues();
+}
+
+} // anonymous namespace
+
+template<typename Real>
+void PresolveDirect
+( const SparseMatrix<Real>& A,
+  const Matrix<Real>& b,
+  const Matrix<Real>& c,
+        SparseMatrix<Real>& AReduced,
+        Matrix<Real>& bReduced,
+        Matrix<Real>& cReduced,
+        DirectPresolveInfo<Real>& info,
+  const PresolveCtrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    PresolveSequential
+    ( (const SparseMatrix<Real>*)nullptr, A, b, c,
+      (SparseMatrix<Real>*)nullptr, AReduced, bReduced, cReduced, info, ctrl );
+}
+
+template<typename Real>
+void PresolveDirect
+( const DistSparseMatrix<Real>& A,
+  const DistMultiVec<Real>& b,
+  const DistMultiVec<Real>& c,
+        DistSparseMatrix<Real>& AReduced,
+        DistMultiVec<Real>& bReduced,
+        DistMultiVec<Real>& cReduced,
+        DirectPresolveInfo<Real>& info,
+  const PresolveCtrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    PresolveDistributed
+    ( (const DistSparseMatrix<Real>*)nullptr, A, b, c,
+      (DistSparseMatrix<Real>*)nullptr, AReduced, bReduced, cReduced,
+      info, ctrl );
+}
+
+template<typename Real>
+void PresolveDirect
+( const SparseMatrix<Real>& Q,
+  const SparseMatrix<Real>& A,
+  const Matrix<Real>& b,
+  const Matrix<Real>& c,
+        SparseMatrix<Real>& QReduced,
+        SparseMatrix<Real>& AReduced,
+        Matrix<Real>& bReduced,
+        Matrix<Real>& cReduced,
+        DirectPresolveInfo<Real>& info,
+  const PresolveCtrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    PresolveSequential
+    ( &Q, A, b, c, &QReduced, AReduced, bReduced, cReduced, info, ctrl );
+}
+
+template<typename Real>
+void PresolveDirect
+( const DistSparseMatrix<Real>& Q,
+  const DistSparseMatrix<Real>& A,
+  const DistMultiVec<Real>& b,
+  const DistMultiVec<Real>& c,
+        DistSparseMatrix<Real>& QReduced,
+        DistSparseMatrix<Real>& AReduced,
+        DistMultiVec<Real>& bReduced,
+        DistMultiVec<Real>& cReduced,
+        DirectPresolveInfo<Real>& info,
+  const PresolveCtrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    PresolveDistributed
+    ( &Q, A, b, c, &QReduced, AReduced, bReduced, cReduced, info, ctrl );
+}
+
+template<typename Real>
+void PostsolveDirect
+( const SparseMatrix<Real>& A,
+  const Matrix<Real>& c,
+  const DirectPresolveInfo<Real>& info,
+  const Matrix<Real>& xReduced,
+  const Matrix<Real>& yReduced,
+  const Matrix<Real>& zReduced,
+        Matrix<Real>& x,
+        Matrix<Real>& y,
+        Matrix<Real>& z )
+{
+    EL_DEBUG_CSE
+    PostsolveSequential
+    ( (const SparseMatrix<Real>*)nullptr, A, c, info,
+      xReduced, yReduced, zReduced, x, y, z );
+}
+
+template<typename Real>
+void PostsolveDirect
+( const DistSparseMatrix<Real>& A,
+  const DistMultiVec<Real>& c,
+  const DirectPresolveInfo<Real>& info,
+  const DistMultiVec<Real>& xReduced,
+  const DistMultiVec<Real>& yReduced,
+  const DistMultiVec<Real>& zReduced,
+        DistMultiVec<Real>& x,
+        DistMultiVec<Real>& y,
+        DistMultiVec<Real>& z )
+{
+    EL_DEBUG_CSE
+    PostsolveDistributed
+    ( (const DistSparseMatrix<Real>*)nullptr, A, c, info,
+      xReduced, yReduced, zReduced, x, y, z );
+}
+
+template<typename Real>
+void PostsolveDirect
+( const SparseMatrix<Real>& Q,
+  const SparseMatrix<Real>& A,
+  const Matrix<Real>& c,
+  const DirectPresolveInfo<Real>& info,
+  const Matrix<Real>& xReduced,
+  const Matrix<Real>& yReduced,
+  const Matrix<Real>& zReduced,
+        Matrix<Real>& x,
+        Matrix<Real>& y,
+        Matrix<Real>& z )
+{
+    EL_DEBUG_CSE
+    PostsolveSequential
+    ( &Q, A, c, info, xReduced, yReduced, zReduced, x, y, z );
+}
+
+template<typename Real>
+void PostsolveDirect
+( const DistSparseMatrix<Real>& Q,
+  const DistSparseMatrix<Real>& A,
+  const DistMultiVec<Real>& c,
+  const DirectPresolveInfo<Real>& info,
+  const DistMultiVec<Real>& xReduced,
+  const DistMultiVec<Real>& yReduced,
+  const DistMultiVec<Real>& zReduced,
+        DistMultiVec<Real>& x,
+        DistMultiVec<Real>& y,
+        DistMultiVec<Real>& z )
+{
+    EL_DEBUG_CSE
+    PostsolveDistributed
+    ( &Q, A, c, info, xReduced, yReduced, zReduced, x, y, z );
+}
+
+#define PROTO(Real) \
+  template void PresolveDirect \
+  ( const SparseMatrix<Real>& A, \
+    const Matrix<Real>& b, \
+    const Matrix<Real>& c, \
+          SparseMatrix<Real>& AReduced, \
+          Matrix<Real>& bReduced, \
+          Matrix<Real>& cReduced, \
+          DirectPresolveInfo<Real>& info, \
+    const PresolveCtrl<Real>& ctrl ); \
+  template void PresolveDirect \
+  ( const DistSparseMatrix<Real>& A, \
+    const DistMultiVec<Real>& b, \
+    const DistMultiVec<Real>& c, \
+          DistSparseMatrix<Real>& AReduced, \
+          DistMultiVec<Real>& bReduced, \
+          DistMultiVec<Real>& cReduced, \
+          DirectPresolveInfo<Real>& info, \
+    const PresolveCtrl<Real>& ctrl ); \
+  template void PresolveDirect \
+  ( const SparseMatrix<Real>& Q, \
+    const SparseMatrix<Real>& A, \
+    const Matrix<Real>& b, \
+    const Matrix<Real>& c, \
+          SparseMatrix<Real>& QReduced, \
+          SparseMatrix<Real>& AReduced, \
+          Matrix<Real>& bReduced, \
+          Matrix<Real>& cReduced, \
+          DirectPresolveInfo<Real>& info, \
+    const PresolveCtrl<Real>& ctrl ); \
+  template void PresolveDirect \
+  ( const DistSparseMatrix<Real>& Q, \
+    const DistSparseMatrix<Real>& A, \
+    const DistMultiVec<Real>& b, \
+    const DistMultiVec<Real>& c, \
+          DistSparseMatrix<Real>& QReduced, \
+          DistSparseMatrix<Real>& AReduced, \
+          DistMultiVec<Real>& bReduced, \
+          DistMultiVec<Real>& cReduced, \
+          DirectPresolveInfo<Real>& info, \
+    const PresolveCtrl<Real>& ctrl ); \
+  template void PostsolveDirect \
+  ( const SparseMatrix<Real>& A, \
+    const Matrix<Real>& c, \
+    const DirectPresolveInfo<Real>& info, \
+    const Matrix<Real>& xReduced, \
+    const Matrix<Real>& yReduced, \
+    const Matrix<Real>& zReduced, \
+          Matrix<Real>& x, \
+          Matrix<Real>& y, \
+          Matrix<Real>& z ); \
+  template void PostsolveDirect \
+  ( const DistSparseMatrix<Real>& A, \
+    const DistMultiVec<Real>& c, \
+    const DirectPresolveInfo<Real>& info, \
+    const DistMultiVec<Real>& xReduced, \
+    const DistMultiVec<Real>& yReduced, \
+    const DistMultiVec<Real>& zReduced, \
+          DistMultiVec<Real>& x, \
+          DistMultiVec<Real>& y, \
+          DistMultiVec<Real>& z ); \
+  template void PostsolveDirect \
+  ( const SparseMatrix<Real>& Q, \
+    const SparseMatrix<Real>& A, \
+    const Matrix<Real>& c, \
+    const DirectPresolveInfo<Real>& info, \
+    const Matrix<Real>& xReduced, \
+    const Matrix<Real>& yReduced, \
+    const Matrix<Real>& zReduced, \
+          Matrix<Real>& x, \
+          Matrix<Real>& y, \
+          Matrix<Real>& z ); \
+  template void PostsolveDirect \
+  ( const DistSparseMatrix<Real>& Q, \
+    const DistSparseMatrix<Real>& A, \
+    const DistMultiVec<Real>& c, \
+    const DirectPresolveInfo<Real>& info, \
+    const DistMultiVec<Real>& xReduced, \
+    const DistMultiVec<Real>& yReduced, \
+    const DistMultiVec<Real>& zReduced, \
+          DistMultiVec<Real>& x, \
+          DistMultiVec<Real>& y, \
+          DistMultiVec<Real>& z );
+
+#define EL_NO_INT_PROTO
+#define EL_NO_COMPLEX_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
@@ -62,6 +62,34 @@ void QP
   const qp::direct::Ctrl<Real>& ctrl )
 {
     EL_DEBUG_CSE
+    if( ctrl.presolve )
+    {
+        SparseMatrix<Real> QReduced, AReduced;
+        Matrix<Real> bReduced, cReduced, xReduced, yReduced, zReduced;
+        DirectPresolveInfo<Real> info;
+        PresolveDirect
+        ( Q, A, b, c, QReduced, AReduced, bReduced, cReduced,
+          info, ctrl.presolveCtrl );
+        if( AReduced.Width() > 0 )
+        {
+            auto reducedCtrl = ctrl;
+            reducedCtrl.presolve = false;
+            reducedCtrl.mehrotraCtrl.primalInit = false;
+            reducedCtrl.mehrotraCtrl.dualInit = false;
+            QP
+            ( QReduced, AReduced, bReduced, cReduced,
+              xReduced, yReduced, zReduced, reducedCtrl );
+        }
+        else
+        {
+            Zeros( xReduced, 0, 1 );
+            Zeros( yReduced, AReduced.Height(), 1 );
+            Zeros( zReduced, 0, 1 );
+        }
+        PostsolveDirect
+        ( Q, A, c, info, xReduced, yReduced, zReduced, x, y, z );
+        return;
+    }
     if( ctrl.approach == QP_MEHROTRA )
         qp::direct::Mehrotra( Q, A, b, c, x, y, z, ctrl.mehrotraCtrl );
     else
@@ -80,6 +108,36 @@ void QP
   const qp::direct::Ctrl<Real>& ctrl )
 {
     EL_DEBUG_CSE
+    if( ctrl.presolve )
+    {
+        const Grid& grid = A.Grid();
+        DistSparseMatrix<Real> QReduced(grid), AReduced(grid);
+        DistMultiVec<Real> bReduced(grid), cReduced(grid),
+          xReduced(grid), yReduced(grid), zReduced(grid);
+        DirectPresolveInfo<Real> info;
+        PresolveDirect
+        ( Q, A, b, c, QReduced, AReduced, bReduced, cReduced,
+          info, ctrl.presolveCtrl );
+        if( AReduced.Width() > 0 )
+        {
+            auto reducedCtrl = ctrl;
+            reducedCtrl.presolve = false;
+            reducedCtrl.mehrotraCtrl.primalInit = false;
+            reducedCtrl.mehrotraCtrl.dualInit = false;
+            QP
+            ( QReduced, AReduced, bReduced, cReduced,
+              xReduced, yReduced, zReduced, reducedCtrl );
+        }
+        else
+        {
+            Zeros( xReduced, 0, 1 );
+            Zeros( yReduced, AReduced.Height(), 1 );
+            Zeros( zReduced, 0, 1 );
+        }
+        PostsolveDirect
+        ( Q, A, c, info, xReduced, yReduced, zReduced, x, y, z );
+        return;
+    }
     if( ctrl.approach == QP_MEHROTRA )
         qp::direct::Mehrotra( Q, A, b, c, x, y, z, ctrl.mehrotraCtrl );
     else
@@ -109,6 +109,9 @@ void Mehrotra
     Initialize
     ( Q, A, G, b, c, h, x, y, z, s,
       ctrl.primalInit, ctrl.dualInit, ctrl.standardInitShift );
+    if( ctrl.warmStart && ctrl.primalInit && ctrl.dualInit )
+        pos_orth::WarmStart
+        ( s, z, ctrl.warmStartShift, ctrl.warmStartCentrality );
 
     Real relError = 1;
     Matrix<Real> J, d,
@@ -308,6 +311,57 @@ void Mehrotra
         alphaDual = Min(ctrl.maxStepRatio*alphaDual,Real(1));
         if( ctrl.forceSameStep )
             alphaPri = alphaDual = Min(alphaPri,alphaDual);
+
+        // Apply Gondzio's multiple centrality correctors
+        // ==============================================
+        // NOTE: dxAff, dyAff, dzAff, and dsAff are used as temporaries
+        for( Int corrector=0; corrector<ctrl.maxCentralityCorrectors &&
+             Min(alphaPri,alphaDual) < Real(1); ++corrector )
+        {
+            const Real alphaPriTarget =
+              Min(alphaPri+ctrl.centralityStepIncrease,Real(1));
+            const Real alphaDualTarget =
+              Min(alphaDual+ctrl.centralityStepIncrease,Real(1));
+            Zero( rc );
+            Zero( rb );
+            Zero( rh );
+            pos_orth::CentralityResidual
+            ( s, z, ds, dz,
+              alphaPriTarget, alphaDualTarget, sigma*mu,
+              ctrl.centralityBetaMin, ctrl.centralityBetaMax, rmu );
+            // Compute the proposed step from the KKT system
+            // ---------------------------------------------
+            KKTRHS( rc, rb, rh, rmu, z, d );
+            ldl::SolveAfter( J, dSub, p, d, false );
+            ExpandSolution( m, n, d, rmu, s, z, dxAff, dyAff, dzAff, dsAff );
+            dxAff += dx;
+            dyAff += dy;
+            dzAff += dz;
+            dsAff += ds;
+
+            Real alphaPriCorr =
+              pos_orth::MaxStep( s, dsAff, 1/ctrl.maxStepRatio );
+            Real alphaDualCorr =
+              pos_orth::MaxStep( z, dzAff, 1/ctrl.maxStepRatio );
+            alphaPriCorr = Min(ctrl.maxStepRatio*alphaPriCorr,Real(1));
+            alphaDualCorr = Min(ctrl.maxStepRatio*alphaDualCorr,Real(1));
+            if( ctrl.forceSameStep )
+                alphaPriCorr = alphaDualCorr = Min(alphaPriCorr,alphaDualCorr);
+            if( Min(alphaPriCorr,alphaDualCorr) <
+                Min(alphaPri,alphaDual) +
+                ctrl.centralityAcceptance*ctrl.centralityStepIncrease )
+                break;
+            if( ctrl.print )
+                Output
+                ("Accepted centrality corrector ",corrector,": alphaPri = ",
+                 alphaPriCorr,", alphaDual = ",alphaDualCorr);
+            dx = dxAff;
+            dy = dyAff;
+            dz = dzAff;
+            ds = dsAff;
+            alphaPri = alphaPriCorr;
+            alphaDual = alphaDualCorr;
+        }
         if( ctrl.print )
             Output("alphaPri = ",alphaPri,", alphaDual = ",alphaDual);
         Axpy( alphaPri,  dx, x );
@@ -450,6 +504,9 @@ void Mehrotra
     Initialize
     ( Q, A, G, b, c, h, x, y, z, s,
       ctrl.primalInit, ctrl.dualInit, ctrl.standardInitShift );
+    if( ctrl.warmStart && ctrl.primalInit && ctrl.dualInit )
+        pos_orth::WarmStart
+        ( s, z, ctrl.warmStartShift, ctrl.warmStartCentrality );
     if( ctrl.time && commRank == 0 )
         Output("Init time: ",timer.Stop()," secs");
 
@@ -685,6 +742,68 @@ void Mehrotra
         alphaDual = Min(ctrl.maxStepRatio*alphaDual,Real(1));
         if( ctrl.forceSameStep )
             alphaPri = alphaDual = Min(alphaPri,alphaDual);
+
+        // Apply Gondzio's multiple centrality correctors
+        // ==============================================
+        // NOTE: dxAff, dyAff, dzAff, and dsAff are used as temporaries
+        for( Int corrector=0; corrector<ctrl.maxCentralityCorrectors &&
+             Min(alphaPri,alphaDual) < Real(1); ++corrector )
+        {
+            const Real alphaPriTarget =
+              Min(alphaPri+ctrl.centralityStepIncrease,Real(1));
+            const Real alphaDualTarget =
+              Min(alphaDual+ctrl.centralityStepIncrease,Real(1));
+            Zero( rc );
+            Zero( rb );
+            Zero( rh );
+            pos_orth::CentralityResidual
+            ( s, z, ds, dz,
+              alphaPriTarget, alphaDualTarget, sigma*mu,
+              ctrl.centralityBetaMin, ctrl.centralityBetaMax, rmu );
+            // Form the new KKT RHS
+            // --------------------
+            KKTRHS( rc, rb, rh, rmu, z, d );
+            // Solve for the new direction
+            // ---------------------------
+            try
+            {
+                if( ctrl.time && commRank == 0 )
+                    timer.Start();
+                ldl::SolveAfter( J, dSub, p, d, false );
+                if( ctrl.time && commRank == 0 )
+                    Output("Centrality solve: ",timer.Stop()," secs");
+            }
+            catch( SingularMatrixException& e ) { break; }
+            catch( NonHPDMatrixException& e ) { break; }
+            ExpandSolution( m, n, d, rmu, s, z, dxAff, dyAff, dzAff, dsAff );
+            dxAff += dx;
+            dyAff += dy;
+            dzAff += dz;
+            dsAff += ds;
+
+            Real alphaPriCorr =
+              pos_orth::MaxStep( s, dsAff, 1/ctrl.maxStepRatio );
+            Real alphaDualCorr =
+              pos_orth::MaxStep( z, dzAff, 1/ctrl.maxStepRatio );
+            alphaPriCorr = Min(ctrl.maxStepRatio*alphaPriCorr,Real(1));
+            alphaDualCorr = Min(ctrl.maxStepRatio*alphaDualCorr,Real(1));
+            if( ctrl.forceSameStep )
+                alphaPriCorr = alphaDualCorr = Min(alphaPriCorr,alphaDualCorr);
+            if( Min(alphaPriCorr,alphaDualCorr) <
+                Min(alphaPri,alphaDual) +
+                ctrl.centralityAcceptance*ctrl.centralityStepIncrease )
+                break;
+            if( ctrl.print && commRank == 0 )
+                Output
+                ("Accepted centrality corrector ",corrector,": alphaPri = ",
+                 alphaPriCorr,", alphaDual = ",alphaDualCorr);
+            dx = dxAff;
+            dy = dyAff;
+            dz = dzAff;
+            ds = dsAff;
+            alphaPri = alphaPriCorr;
+            alphaDual = alphaDualCorr;
+        }
         if( ctrl.print && commRank == 0 )
             Output("alphaPri = ",alphaPri,", alphaDual = ",alphaDual);
         Axpy( alphaPri,  dx, x );
@@ -808,6 +927,9 @@ void Mehrotra
     ( JStatic, regTmp, b, c, h, x, y, z, s,
       sparseLDLFact,
       ctrl.primalInit, ctrl.dualInit, ctrl.standardInitShift, ctrl.solveCtrl );
+    if( ctrl.warmStart && ctrl.primalInit && ctrl.dualInit )
+        pos_orth::WarmStart
+        ( s, z, ctrl.warmStartShift, ctrl.warmStartCentrality );
 
     SparseMatrix<Real> J, JOrig;
     Matrix<Real> d,
@@ -1070,6 +1192,72 @@ void Mehrotra
         alphaDual = Min(ctrl.maxStepRatio*alphaDual,Real(1));
         if( ctrl.forceSameStep )
             alphaPri = alphaDual = Min(alphaPri,alphaDual);
+
+        // Apply Gondzio's multiple centrality correctors
+        // ==============================================
+        // NOTE: dxAff, dyAff, dzAff, and dsAff are used as temporaries
+        for( Int corrector=0; corrector<ctrl.maxCentralityCorrectors &&
+             Min(alphaPri,alphaDual) < Real(1); ++corrector )
+        {
+            const Real alphaPriTarget =
+              Min(alphaPri+ctrl.centralityStepIncrease,Real(1));
+            const Real alphaDualTarget =
+              Min(alphaDual+ctrl.centralityStepIncrease,Real(1));
+            Zero( rc );
+            Zero( rb );
+            Zero( rh );
+            pos_orth::CentralityResidual
+            ( s, z, ds, dz,
+              alphaPriTarget, alphaDualTarget, sigma*mu,
+              ctrl.centralityBetaMin, ctrl.centralityBetaMax, rmu );
+            // Set up the new KKT RHS
+            // ----------------------
+            KKTRHS( rc, rb, rh, rmu, z, d );
+            // Solve for the new direction
+            // ---------------------------
+            try
+            {
+                if( ctrl.resolveReg )
+                    reg_ldl::SolveAfter
+                    ( JOrig, regTmp, dInner, sparseLDLFact, d, ctrl.solveCtrl );
+                else
+                    reg_ldl::RegularizedSolveAfter
+                    ( JOrig, regTmp, dInner, sparseLDLFact, d,
+                      ctrl.solveCtrl.relTol,
+                      ctrl.solveCtrl.maxRefineIts,
+                      ctrl.solveCtrl.progress );
+            }
+            catch( SingularMatrixException& e ) { break; }
+            catch( NonHPDMatrixException& e ) { break; }
+            ExpandSolution( m, n, d, rmu, s, z, dxAff, dyAff, dzAff, dsAff );
+            dxAff += dx;
+            dyAff += dy;
+            dzAff += dz;
+            dsAff += ds;
+
+            Real alphaPriCorr =
+              pos_orth::MaxStep( s, dsAff, 1/ctrl.maxStepRatio );
+            Real alphaDualCorr =
+              pos_orth::MaxStep( z, dzAff, 1/ctrl.maxStepRatio );
+            alphaPriCorr = Min(ctrl.maxStepRatio*alphaPriCorr,Real(1));
+            alphaDualCorr = Min(ctrl.maxStepRatio*alphaDualCorr,Real(1));
+            if( ctrl.forceSameStep )
+                alphaPriCorr = alphaDualCorr = Min(alphaPriCorr,alphaDualCorr);
+            if( Min(alphaPriCorr,alphaDualCorr) <
+                Min(alphaPri,alphaDual) +
+                ctrl.centralityAcceptance*ctrl.centralityStepIncrease )
+                break;
+            if( ctrl.print )
+                Output
+                ("Accepted centrality corrector ",corrector,": alphaPri = ",
+                 alphaPriCorr,", alphaDual = ",alphaDualCorr);
+            dx = dxAff;
+            dy = dyAff;
+            dz = dzAff;
+            ds = dsAff;
+            alphaPri = alphaPriCorr;
+            alphaDual = alphaDualCorr;
+        }
         if( ctrl.print )
             Output("alphaPri = ",alphaPri,", alphaDual = ",alphaDual);
         Axpy( alphaPri,  dx, x );
@@ -1225,6 +1413,9 @@ void Mehrotra
     ( JStatic, regTmp, b, c, h, x, y, z, s,
       sparseLDLFact,
       ctrl.primalInit, ctrl.dualInit, ctrl.standardInitShift, ctrl.solveCtrl );
+    if( ctrl.warmStart && ctrl.primalInit && ctrl.dualInit )
+        pos_orth::WarmStart
+        ( s, z, ctrl.warmStartShift, ctrl.warmStartCentrality );
     if( commRank == 0 && ctrl.time )
         Output("Init: ",timer.Stop()," secs");
 
@@ -1339,7 +1530,6 @@ void Mehrotra
         // ------------------------
         JOrig = JStatic;
         JOrig.FreezeSparsity();
-        JOrig.LockedDistGraph().multMeta = JStatic.LockedDistGraph().multMeta;
         FinishKKT( m, n, s, z, JOrig );
         KKTRHS( rc, rb, rh, rmu, z, d );
 
@@ -1349,7 +1539,6 @@ void Mehrotra
         {
             J = JOrig;
             J.FreezeSparsity();
-            J.LockedDistGraph().multMeta = JStatic.LockedDistGraph().multMeta;
             UpdateDiagonal( J, Real(1), regTmp );
 
             if( commRank == 0 && ctrl.time )
@@ -1515,6 +1704,76 @@ void Mehrotra
         alphaDual = Min(ctrl.maxStepRatio*alphaDual,Real(1));
         if( ctrl.forceSameStep )
             alphaPri = alphaDual = Min(alphaPri,alphaDual);
+
+        // Apply Gondzio's multiple centrality correctors
+        // ==============================================
+        // NOTE: dxAff, dyAff, dzAff, and dsAff are used as temporaries
+        for( Int corrector=0; corrector<ctrl.maxCentralityCorrectors &&
+             Min(alphaPri,alphaDual) < Real(1); ++corrector )
+        {
+            const Real alphaPriTarget =
+              Min(alphaPri+ctrl.centralityStepIncrease,Real(1));
+            const Real alphaDualTarget =
+              Min(alphaDual+ctrl.centralityStepIncrease,Real(1));
+            Zero( rc );
+            Zero( rb );
+            Zero( rh );
+            pos_orth::CentralityResidual
+            ( s, z, ds, dz,
+              alphaPriTarget, alphaDualTarget, sigma*mu,
+              ctrl.centralityBetaMin, ctrl.centralityBetaMax, rmu );
+            // Set up the new RHS
+            // ------------------
+            KKTRHS( rc, rb, rh, rmu, z, d );
+            // Compute the new direction
+            // -------------------------
+            try
+            {
+                if( commRank == 0 && ctrl.time )
+                    timer.Start();
+                if( ctrl.resolveReg )
+                    reg_ldl::SolveAfter
+                    ( JOrig, regTmp, dInner, sparseLDLFact, d, ctrl.solveCtrl );
+                else
+                    reg_ldl::RegularizedSolveAfter
+                    ( JOrig, regTmp, dInner, sparseLDLFact, d,
+                      ctrl.solveCtrl.relTol,
+                      ctrl.solveCtrl.maxRefineIts,
+                      ctrl.solveCtrl.progress );
+                if( commRank == 0 && ctrl.time )
+                    Output("Centrality solve: ",timer.Stop()," secs");
+            }
+            catch( SingularMatrixException& e ) { break; }
+            catch( NonHPDMatrixException& e ) { break; }
+            ExpandSolution( m, n, d, rmu, s, z, dxAff, dyAff, dzAff, dsAff );
+            dxAff += dx;
+            dyAff += dy;
+            dzAff += dz;
+            dsAff += ds;
+
+            Real alphaPriCorr =
+              pos_orth::MaxStep( s, dsAff, 1/ctrl.maxStepRatio );
+            Real alphaDualCorr =
+              pos_orth::MaxStep( z, dzAff, 1/ctrl.maxStepRatio );
+            alphaPriCorr = Min(ctrl.maxStepRatio*alphaPriCorr,Real(1));
+            alphaDualCorr = Min(ctrl.maxStepRatio*alphaDualCorr,Real(1));
+            if( ctrl.forceSameStep )
+                alphaPriCorr = alphaDualCorr = Min(alphaPriCorr,alphaDualCorr);
+            if( Min(alphaPriCorr,alphaDualCorr) <
+                Min(alphaPri,alphaDual) +
+                ctrl.centralityAcceptance*ctrl.centralityStepIncrease )
+                break;
+            if( ctrl.print && commRank == 0 )
+                Output
+                ("Accepted centrality corrector ",corrector,": alphaPri = ",
+                 alphaPriCorr,", alphaDual = ",alphaDualCorr);
+            dx = dxAff;
+            dy = dyAff;
+            dz = dzAff;
+            ds = dsAff;
+            alphaPri = alphaPriCorr;
+            alphaDual = alphaDualCorr;
+        }
         if( ctrl.print && commRank == 0 )
             Output("alphaPri = ",alphaPri,", alphaDual = ",alphaDual);
         Axpy( alphaPri,  dx, x );
@@ -500,13 +500,11 @@ void Initialize
     DistSparseMatrix<Real> JOrig(grid);
     JOrig = JStatic;
     JOrig.FreezeSparsity();
-    JOrig.LockedDistGraph().multMeta = JStatic.LockedDistGraph().multMeta;
     DistMultiVec<Real> ones(grid);
     Ones( ones, k, 1 );
     FinishKKT( m, n, ones, ones, JOrig );
     auto J = JOrig;
     J.FreezeSparsity();
-    J.LockedDistGraph().multMeta = JStatic.LockedDistGraph().multMeta;
     UpdateRealPartOfDiagonal( J, Real(1), regTmp );
 
     // Analyze the nonzero pattern
@@ -94,6 +94,9 @@ void Mehrotra
     Initialize
     ( Q, A, b, c, x, y, z,
       ctrl.primalInit, ctrl.dualInit, ctrl.standardInitShift );
+    if( ctrl.warmStart && ctrl.primalInit && ctrl.dualInit )
+        pos_orth::WarmStart
+        ( x, z, ctrl.warmStartShift, ctrl.warmStartCentrality );
 
     Real relError = 1;
     Matrix<Real> J, d,
@@ -349,6 +352,77 @@ void Mehrotra
         alphaDual = Min(ctrl.maxStepRatio*alphaDual,Real(1));
         if( ctrl.forceSameStep )
             alphaPri = alphaDual = Min(alphaPri,alphaDual);
+
+        // Apply Gondzio's multiple centrality correctors
+        // ==============================================
+        // NOTE: dxAff, dyAff, and dzAff are used as temporaries
+        for( Int corrector=0; corrector<ctrl.maxCentralityCorrectors &&
+             Min(alphaPri,alphaDual) < Real(1); ++corrector )
+        {
+            const Real alphaPriTarget =
+              Min(alphaPri+ctrl.centralityStepIncrease,Real(1));
+            const Real alphaDualTarget =
+              Min(alphaDual+ctrl.centralityStepIncrease,Real(1));
+            Zero( rc );
+            Zero( rb );
+            pos_orth::CentralityResidual
+            ( x, z, dx, dz,
+              alphaPriTarget, alphaDualTarget, sigma*mu,
+              ctrl.centralityBetaMin, ctrl.centralityBetaMax, rmu );
+            if( ctrl.system == FULL_KKT )
+            {
+                // Construct the new KKT RHS
+                // -------------------------
+                KKTRHS( rc, rb, rmu, z, d );
+
+                // Solve for the direction
+                // -----------------------
+                try { ldl::SolveAfter( J, dSub, p, d, false ); }
+                catch( SingularMatrixException& e ) { break; }
+                catch( NonHPDMatrixException& e ) { break; }
+                ExpandSolution( m, n, d, dxAff, dyAff, dzAff );
+            }
+            else if( ctrl.system == AUGMENTED_KKT )
+            {
+                // Construct the new KKT RHS
+                // -------------------------
+                AugmentedKKTRHS( x, rc, rb, rmu, d );
+
+                // Solve for the direction
+                // -----------------------
+                try { ldl::SolveAfter( J, dSub, p, d, false ); }
+                catch( SingularMatrixException& e ) { break; }
+                catch( NonHPDMatrixException& e ) { break; }
+                ExpandAugmentedSolution( x, z, rmu, d, dxAff, dyAff, dzAff );
+            }
+            else
+                LogicError("Invalid KKT system choice");
+            dxAff += dx;
+            dyAff += dy;
+            dzAff += dz;
+
+            Real alphaPriCorr =
+              pos_orth::MaxStep( x, dxAff, 1/ctrl.maxStepRatio );
+            Real alphaDualCorr =
+              pos_orth::MaxStep( z, dzAff, 1/ctrl.maxStepRatio );
+            alphaPriCorr = Min(ctrl.maxStepRatio*alphaPriCorr,Real(1));
+            alphaDualCorr = Min(ctrl.maxStepRatio*alphaDualCorr,Real(1));
+            if( ctrl.forceSameStep )
+                alphaPriCorr = alphaDualCorr = Min(alphaPriCorr,alphaDualCorr);
+            if( Min(alphaPriCorr,alphaDualCorr) <
+                Min(alphaPri,alphaDual) +
+                ctrl.centralityAcceptance*ctrl.centralityStepIncrease )
+                break;
+            if( ctrl.print )
+                Output
+                ("Accepted centrality corrector ",corrector,": alphaPri = ",
+                 alphaPriCorr,", alphaDual = ",alphaDualCorr);
+            dx = dxAff;
+            dy = dyAff;
+            dz = dzAff;
+            alphaPri = alphaPriCorr;
+            alphaDual = alphaDualCorr;
+        }
         if( ctrl.print )
             Output("alphaPri = ",alphaPri,", alphaDual = ",alphaDual);
         Axpy( alphaPri,  dx, x );
@@ -464,6 +538,9 @@ void Mehrotra
     Initialize
     ( Q, A, b, c, x, y, z,
       ctrl.primalInit, ctrl.dualInit, ctrl.standardInitShift );
+    if( ctrl.warmStart && ctrl.primalInit && ctrl.dualInit )
+        pos_orth::WarmStart
+        ( x, z, ctrl.warmStartShift, ctrl.warmStartCentrality );
 
     Real relError = 1;
     DistMatrix<Real>
@@ -728,6 +805,77 @@ void Mehrotra
         alphaDual = Min(ctrl.maxStepRatio*alphaDual,Real(1));
         if( ctrl.forceSameStep )
             alphaPri = alphaDual = Min(alphaPri,alphaDual);
+
+        // Apply Gondzio's multiple centrality correctors
+        // ==============================================
+        // NOTE: dxAff, dyAff, and dzAff are used as temporaries
+        for( Int corrector=0; corrector<ctrl.maxCentralityCorrectors &&
+             Min(alphaPri,alphaDual) < Real(1); ++corrector )
+        {
+            const Real alphaPriTarget =
+              Min(alphaPri+ctrl.centralityStepIncrease,Real(1));
+            const Real alphaDualTarget =
+              Min(alphaDual+ctrl.centralityStepIncrease,Real(1));
+            Zero( rc );
+            Zero( rb );
+            pos_orth::CentralityResidual
+            ( x, z, dx, dz,
+              alphaPriTarget, alphaDualTarget, sigma*mu,
+              ctrl.centralityBetaMin, ctrl.centralityBetaMax, rmu );
+            if( ctrl.system == FULL_KKT )
+            {
+                // Construct the new KKT RHS
+                // -------------------------
+                KKTRHS( rc, rb, rmu, z, d );
+
+                // Solve for the direction
+                // -----------------------
+                try { ldl::SolveAfter( J, dSub, p, d, false ); }
+                catch( SingularMatrixException& e ) { break; }
+                catch( NonHPDMatrixException& e ) { break; }
+                ExpandSolution( m, n, d, dxAff, dyAff, dzAff );
+            }
+            else if( ctrl.system == AUGMENTED_KKT )
+            {
+                // Construct the new KKT RHS
+                // -------------------------
+                AugmentedKKTRHS( x, rc, rb, rmu, d );
+
+                // Solve for the direction
+                // -----------------------
+                try { ldl::SolveAfter( J, dSub, p, d, false ); }
+                catch( SingularMatrixException& e ) { break; }
+                catch( NonHPDMatrixException& e ) { break; }
+                ExpandAugmentedSolution( x, z, rmu, d, dxAff, dyAff, dzAff );
+            }
+            else
+                LogicError("Invalid KKT system choice");
+            dxAff += dx;
+            dyAff += dy;
+            dzAff += dz;
+
+            Real alphaPriCorr =
+              pos_orth::MaxStep( x, dxAff, 1/ctrl.maxStepRatio );
+            Real alphaDualCorr =
+              pos_orth::MaxStep( z, dzAff, 1/ctrl.maxStepRatio );
+            alphaPriCorr = Min(ctrl.maxStepRatio*alphaPriCorr,Real(1));
+            alphaDualCorr = Min(ctrl.maxStepRatio*alphaDualCorr,Real(1));
+            if( ctrl.forceSameStep )
+                alphaPriCorr = alphaDualCorr = Min(alphaPriCorr,alphaDualCorr);
+            if( Min(alphaPriCorr,alphaDualCorr) <
+                Min(alphaPri,alphaDual) +
+                ctrl.centralityAcceptance*ctrl.centralityStepIncrease )
+                break;
+            if( ctrl.print && commRank == 0 )
+                Output
+                ("Accepted centrality corrector ",corrector,": alphaPri = ",
+                 alphaPriCorr,", alphaDual = ",alphaDualCorr);
+            dx = dxAff;
+            dy = dyAff;
+            dz = dzAff;
+            alphaPri = alphaPriCorr;
+            alphaDual = alphaDualCorr;
+        }
         if( ctrl.print && commRank == 0 )
             Output("alphaPri = ",alphaPri,", alphaDual = ",alphaDual);
         Axpy( alphaPri,  dx, x );
@@ -834,6 +982,9 @@ void Mehrotra
           ctrl.primalInit, ctrl.dualInit, ctrl.standardInitShift,
           ctrl.solveCtrl );
     }
+    if( ctrl.warmStart && ctrl.primalInit && ctrl.dualInit )
+        pos_orth::WarmStart
+        ( x, z, ctrl.warmStartShift, ctrl.warmStartCentrality );
 
     Matrix<Real> regTmp;
     if( ctrl.system == FULL_KKT )
@@ -1160,6 +1311,99 @@ void Mehrotra
         alphaDual = Min(ctrl.maxStepRatio*alphaDual,Real(1));
         if( ctrl.forceSameStep )
             alphaPri = alphaDual = Min(alphaPri,alphaDual);
+
+        // Apply Gondzio's multiple centrality correctors
+        // ==============================================
+        // NOTE: dxAff, dyAff, and dzAff are used as temporaries
+        for( Int corrector=0; corrector<ctrl.maxCentralityCorrectors &&
+             Min(alphaPri,alphaDual) < Real(1); ++corrector )
+        {
+            const Real alphaPriTarget =
+              Min(alphaPri+ctrl.centralityStepIncrease,Real(1));
+            const Real alphaDualTarget =
+              Min(alphaDual+ctrl.centralityStepIncrease,Real(1));
+            Zero( rc );
+            Zero( rb );
+            pos_orth::CentralityResidual
+            ( x, z, dx, dz,
+              alphaPriTarget, alphaDualTarget, sigma*mu,
+              ctrl.centralityBetaMin, ctrl.centralityBetaMax, rmu );
+            if( ctrl.system == FULL_KKT )
+            {
+                // Form the new KKT RHS
+                // --------------------
+                KKTRHS( rc, rb, rmu, z, d );
+                // Solve for the direction
+                // -----------------------
+                try
+                {
+                    if( ctrl.resolveReg )
+                        reg_ldl::SolveAfter
+                        ( JOrig, regTmp, dInner, sparseLDLFact, d,
+                          ctrl.solveCtrl );
+                    else
+                        reg_ldl::RegularizedSolveAfter
+                        ( JOrig, regTmp, dInner, sparseLDLFact, d,
+                          ctrl.solveCtrl.relTol,
+                          ctrl.solveCtrl.maxRefineIts,
+                          ctrl.solveCtrl.progress );
+                }
+                catch( SingularMatrixException& e ) { break; }
+                catch( NonHPDMatrixException& e ) { break; }
+                ExpandSolution( m, n, d, dxAff, dyAff, dzAff );
+            }
+            else if( ctrl.system == AUGMENTED_KKT )
+            {
+                // Form the new KKT RHS
+                // --------------------
+                AugmentedKKTRHS( x, rc, rb, rmu, d );
+                // Solve for the direction
+                // -----------------------
+                try
+                {
+                    if( ctrl.resolveReg )
+                        reg_ldl::SolveAfter
+                        ( JOrig, regTmp, dInner, sparseLDLFact, d,
+                          ctrl.solveCtrl );
+                    else
+                        reg_ldl::RegularizedSolveAfter
+                        ( JOrig, regTmp, dInner, sparseLDLFact, d,
+                          ctrl.solveCtrl.relTol,
+                          ctrl.solveCtrl.maxRefineIts,
+                          ctrl.solveCtrl.progress );
+                }
+                catch( SingularMatrixException& e ) { break; }
+                catch( NonHPDMatrixException& e ) { break; }
+                ExpandAugmentedSolution( x, z, rmu, d, dxAff, dyAff, dzAff );
+            }
+            else
+                LogicError("Invalid KKT system choice");
+            dxAff += dx;
+            dyAff += dy;
+            dzAff += dz;
+
+            Real alphaPriCorr =
+              pos_orth::MaxStep( x, dxAff, 1/ctrl.maxStepRatio );
+            Real alphaDualCorr =
+              pos_orth::MaxStep( z, dzAff, 1/ctrl.maxStepRatio );
+            alphaPriCorr = Min(ctrl.maxStepRatio*alphaPriCorr,Real(1));
+            alphaDualCorr = Min(ctrl.maxStepRatio*alphaDualCorr,Real(1));
+            if( ctrl.forceSameStep )
+                alphaPriCorr = alphaDualCorr = Min(alphaPriCorr,alphaDualCorr);
+            if( Min(alphaPriCorr,alphaDualCorr) <
+                Min(alphaPri,alphaDual) +
+                ctrl.centralityAcceptance*ctrl.centralityStepIncrease )
+                break;
+            if( ctrl.print )
+                Output
+                ("Accepted centrality corrector ",corrector,": alphaPri = ",
+                 alphaPriCorr,", alphaDual = ",alphaDualCorr);
+            dx = dxAff;
+            dy = dyAff;
+            dz = dzAff;
+            alphaPri = alphaPriCorr;
+            alphaDual = alphaDualCorr;
+        }
         if( ctrl.print )
             Output("alphaPri = ",alphaPri,", alphaDual = ",alphaDual);
         Axpy( alphaPri,  dx, x );
@@ -1282,6 +1526,9 @@ void Mehrotra
           ctrl.primalInit, ctrl.dualInit, ctrl.standardInitShift,
           ctrl.solveCtrl );
     }
+    if( ctrl.warmStart && ctrl.primalInit && ctrl.dualInit )
+        pos_orth::WarmStart
+        ( x, z, ctrl.warmStartShift, ctrl.warmStartCentrality );
     if( commRank == 0 && ctrl.time )
         Output("Init: ",timer.Stop()," secs");
 
@@ -1312,7 +1559,6 @@ void Mehrotra
     }
     regTmp *= origTwoNormEst;
 
-    DistGraphMultMeta metaOrig, meta;
     DistSparseMatrix<Real> J(grid), JOrig(grid);
     DistMultiVec<Real> d(grid), w(grid),
                        rc(grid),    rb(grid),    rmu(grid),
@@ -1422,21 +1668,11 @@ void Mehrotra
             }
             J = JOrig;
             UpdateDiagonal( J, Real(1), regTmp );
-            if( numIts == 0 )
-            {
-                if( ctrl.print )
-                {
-                    const double imbalanceJ = J.Imbalance();
-                    if( commRank == 0 )
-                        Output("Imbalance factor of J: ",imbalanceJ);
-                }
-                metaOrig = JOrig.InitializeMultMeta();
-                meta = J.InitializeMultMeta();
-            }
-            else
+            if( numIts == 0 && ctrl.print )
             {
-                JOrig.LockedDistGraph().multMeta = metaOrig;
-                J.LockedDistGraph().multMeta = meta;
+                const double imbalanceJ = J.Imbalance();
+                if( commRank == 0 )
+                    Output("Imbalance factor of J: ",imbalanceJ);
             }
 
             // Solve for the direction
@@ -1653,6 +1889,107 @@ void Mehrotra
         alphaDual = Min(ctrl.maxStepRatio*alphaDual,Real(1));
         if( ctrl.forceSameStep )
             alphaPri = alphaDual = Min(alphaPri,alphaDual);
+
+        // Apply Gondzio's multiple centrality correctors
+        // ==============================================
+        // NOTE: dxAff, dyAff, and dzAff are used as temporaries
+        for( Int corrector=0; corrector<ctrl.maxCentralityCorrectors &&
+             Min(alphaPri,alphaDual) < Real(1); ++corrector )
+        {
+            const Real alphaPriTarget =
+              Min(alphaPri+ctrl.centralityStepIncrease,Real(1));
+            const Real alphaDualTarget =
+              Min(alphaDual+ctrl.centralityStepIncrease,Real(1));
+            Zero( rc );
+            Zero( rb );
+            pos_orth::CentralityResidual
+            ( x, z, dx, dz,
+              alphaPriTarget, alphaDualTarget, sigma*mu,
+              ctrl.centralityBetaMin, ctrl.centralityBetaMax, rmu );
+            if( ctrl.system == FULL_KKT )
+            {
+                // Form the KKT system
+                // -------------------
+                KKTRHS( rc, rb, rmu, z, d );
+                // Solve for the direction
+                // -----------------------
+                try
+                {
+                    if( commRank == 0 && ctrl.time )
+                        timer.Start();
+                    if( ctrl.resolveReg )
+                        reg_ldl::SolveAfter
+                        ( JOrig, regTmp, dInner, sparseLDLFact, d,
+                          ctrl.solveCtrl );
+                    else
+                        reg_ldl::RegularizedSolveAfter
+                        ( JOrig, regTmp, dInner, sparseLDLFact, d,
+                          ctrl.solveCtrl.relTol,
+                          ctrl.solveCtrl.maxRefineIts,
+                          ctrl.solveCtrl.progress );
+                    if( commRank == 0 && ctrl.time )
+                        Output("Centrality solve: ",timer.Stop()," secs");
+                }
+                catch( SingularMatrixException& e ) { break; }
+                catch( NonHPDMatrixException& e ) { break; }
+                ExpandSolution( m, n, d, dxAff, dyAff, dzAff );
+            }
+            else if( ctrl.system == AUGMENTED_KKT )
+            {
+                // Form the KKT system
+                // -------------------
+                AugmentedKKTRHS( x, rc, rb, rmu, d );
+                // Solve for the direction
+                // -----------------------
+                try
+                {
+                    if( commRank == 0 && ctrl.time )
+                        timer.Start();
+                    if( ctrl.resolveReg )
+                        reg_ldl::SolveAfter
+                        ( JOrig, regTmp, dInner, sparseLDLFact, d,
+                          ctrl.solveCtrl );
+                    else
+                        reg_ldl::RegularizedSolveAfter
+                        ( JOrig, regTmp, dInner, sparseLDLFact, d,
+                          ctrl.solveCtrl.relTol,
+                          ctrl.solveCtrl.maxRefineIts,
+                          ctrl.solveCtrl.progress );
+                    if( commRank == 0 && ctrl.time )
+                        Output("Centrality solve: ",timer.Stop()," secs");
+                }
+                catch( SingularMatrixException& e ) { break; }
+                catch( NonHPDMatrixException& e ) { break; }
+                ExpandAugmentedSolution( x, z, rmu, d, dxAff, dyAff, dzAff );
+            }
+            else
+                LogicError("Invalid KKT system choice");
+            dxAff += dx;
+            dyAff += dy;
+            dzAff += dz;
+
+            Real alphaPriCorr =
+              pos_orth::MaxStep( x, dxAff, 1/ctrl.maxStepRatio );
+            Real alphaDualCorr =
+              pos_orth::MaxStep( z, dzAff, 1/ctrl.maxStepRatio );
+            alphaPriCorr = Min(ctrl.maxStepRatio*alphaPriCorr,Real(1));
+            alphaDualCorr = Min(ctrl.maxStepRatio*alphaDualCorr,Real(1));
+            if( ctrl.forceSameStep )
+                alphaPriCorr = alphaDualCorr = Min(alphaPriCorr,alphaDualCorr);
+            if( Min(alphaPriCorr,alphaDualCorr) <
+                Min(alphaPri,alphaDual) +
+                ctrl.centralityAcceptance*ctrl.centralityStepIncrease )
+                break;
+            if( ctrl.print && commRank == 0 )
+                Output
+                ("Accepted centrality corrector ",corrector,": alphaPri = ",
+                 alphaPriCorr,", alphaDual = ",alphaDualCorr);
+            dx = dxAff;
+            dy = dyAff;
+            dz = dzAff;
+            alphaPri = alphaPriCorr;
+            alphaDual = alphaDualCorr;
+        }
         if( ctrl.print && commRank == 0 )
             Output("alphaPri = ",alphaPri,", alphaDual = ",alphaDual);
         Axpy( alphaPri,  dx, x );
@@ -60,6 +60,8 @@ void Mehrotra
     const Int k = G.Height();
     const Int n = A.Width();
     const Int degree = soc::Degree( firstInds );
+    soc::Batches batches;
+    soc::FormBatches( orders, firstInds, batches );
     Matrix<Real> dRowA, dRowG, dCol;
     if( ctrl.outerEquil )
     {
@@ -121,9 +123,7 @@ void Mehrotra
         // Ensure that s and z are in the cone
         // ===================================
         const Real minDist = eps;
-        soc::PushInto( s, orders, firstInds, minDist );
-        soc::PushInto( z, orders, firstInds, minDist );
-        soc::NesterovTodd( s, z, w, orders, firstInds );
+        soc::PushIntoNesterovTodd( s, z, w, batches, minDist );
 
         // Check for convergence
         // =====================
@@ -200,7 +200,7 @@ void Mehrotra
         if( wMaxNorm > wMaxNormLimit )
         {
             soc::PushPairInto( s, z, w, orders, firstInds, wMaxNormLimit );
-            soc::NesterovTodd( s, z, w, orders, firstInds );
+            soc::NesterovTodd( s, z, w, batches );
             wMaxNorm = MaxNorm(w);
         }
         soc::SquareRoot( w, wRoot, orders, firstInds );
@@ -275,8 +275,9 @@ void Mehrotra
 
         // Compute a centrality parameter
         // ==============================
-        Real alphaAffPri = soc::MaxStep(s,dsAff,orders,firstInds,Real(1));
-        Real alphaAffDual = soc::MaxStep(z,dzAff,orders,firstInds,Real(1));
+        auto affSteps = soc::MaxSteps( s, dsAff, z, dzAff, batches, Real(1) );
+        Real alphaAffPri = affSteps.first;
+        Real alphaAffDual = affSteps.second;
         if( ctrl.forceSameStep )
             alphaAffPri = alphaAffDual = Min(alphaAffPri,alphaAffDual);
         if( ctrl.print )
@@ -336,10 +337,10 @@ void Mehrotra
 
         // Update the current estimates
         // ============================
-        Real alphaPri =
-          soc::MaxStep( s, ds, orders, firstInds, 1/ctrl.maxStepRatio );
-        Real alphaDual =
-          soc::MaxStep( z, dz, orders, firstInds, 1/ctrl.maxStepRatio );
+        auto steps =
+          soc::MaxSteps( s, ds, z, dz, batches, 1/ctrl.maxStepRatio );
+        Real alphaPri = steps.first;
+        Real alphaDual = steps.second;
         alphaPri = Min(ctrl.maxStepRatio*alphaPri,Real(1));
         alphaDual = Min(ctrl.maxStepRatio*alphaDual,Real(1));
         if( ctrl.forceSameStep )
@@ -778,6 +779,8 @@ void Mehrotra
     const Int k = G.Height();
     const Int n = A.Width();
     const Int degree = soc::Degree( firstInds );
+    soc::Batches batches;
+    soc::FormBatches( orders, firstInds, batches );
     Matrix<Real> dRowA, dRowG, dCol;
     if( ctrl.outerEquil )
     {
@@ -901,9 +904,7 @@ void Mehrotra
         // Ensure that s and z are in the cone
         // ===================================
         const Real minDist = eps;
-        soc::PushInto( s, orders, firstInds, minDist );
-        soc::PushInto( z, orders, firstInds, minDist );
-        soc::NesterovTodd( s, z, w, orders, firstInds );
+        soc::PushIntoNesterovTodd( s, z, w, batches, minDist );
 
         // Check for convergence
         // =====================
@@ -978,7 +979,7 @@ void Mehrotra
         if( wMaxNorm > wMaxNormLimit )
         {
             soc::PushPairInto( s, z, w, orders, firstInds, wMaxNormLimit );
-            soc::NesterovTodd( s, z, w, orders, firstInds );
+            soc::NesterovTodd( s, z, w, batches );
             wMaxNorm = MaxNorm(w);
         }
         soc::SquareRoot( w, wRoot, orders, firstInds );
@@ -1086,10 +1087,9 @@ void Mehrotra
 
         // Compute a centrality parameter
         // ==============================
-        Real alphaAffPri =
-          soc::MaxStep( s, dsAff, orders, firstInds, Real(1) );
-        Real alphaAffDual =
-          soc::MaxStep( z, dzAff, orders, firstInds, Real(1) );
+        auto affSteps = soc::MaxSteps( s, dsAff, z, dzAff, batches, Real(1) );
+        Real alphaAffPri = affSteps.first;
+        Real alphaAffDual = affSteps.second;
         if( ctrl.forceSameStep )
             alphaAffPri = alphaAffDual = Min(alphaAffPri,alphaAffDual);
         if( ctrl.print )
@@ -1165,10 +1165,10 @@ void Mehrotra
 
         // Update the current estimates
         // ============================
-        Real alphaPri =
-          soc::MaxStep( s, ds, orders, firstInds, 1/ctrl.maxStepRatio );
-        Real alphaDual =
-          soc::MaxStep( z, dz, orders, firstInds, 1/ctrl.maxStepRatio );
+        auto steps =
+          soc::MaxSteps( s, ds, z, dz, batches, 1/ctrl.maxStepRatio );
+        Real alphaPri = steps.first;
+        Real alphaDual = steps.second;
         alphaPri = Min(ctrl.maxStepRatio*alphaPri,Real(1));
         alphaDual = Min(ctrl.maxStepRatio*alphaDual,Real(1));
         if( ctrl.forceSameStep )
@@ -1375,7 +1375,7 @@ void Mehrotra
             Output("Imbalance factor of J: ",imbalanceJ);
     }
 
-    auto meta = JStatic.InitializeMultMeta();
+    JStatic.InitializeMultMeta();
     if( commRank == 0 && ctrl.time )
         timer.Start();
     const bool hermitian = true;
@@ -1522,12 +1522,9 @@ void Mehrotra
           d, cutoffPar );
         if( ctrl.time && commRank == 0 )
             Output("KKTRHS construction: ",timer.Stop()," secs");
-        // Cache the metadata for the finalized JOrig
-        JOrig.LockedDistGraph().multMeta = meta;
         J = JOrig;
         J.FreezeSparsity();
         UpdateDiagonal( J, Real(1), regTmp );
-        J.LockedDistGraph().multMeta = meta;
 
         // Solve for the direction
         // -----------------------
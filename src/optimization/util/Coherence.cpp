@@ -10,36 +10,69 @@
 
 namespace El {
 
+// The coherence of A is the maximum of |<a_i,a_j>| / (||a_i||_2 ||a_j||_2)
+// over all pairs of distinct columns. Rather than forming the full Gram
+// matrix of the normalized columns, each block row of its upper triangle is
+// formed, scanned, and discarded in turn.
+
 template<typename Field>
 Base<Field> Coherence( const Matrix<Field>& A )
 {
     EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Int n = A.Width();
     Matrix<Field> B( A );
-    Matrix<Base<Field>> norms;
+    Matrix<Real> norms;
     ColumnTwoNorms( B, norms );
-
     DiagonalSolve( RIGHT, NORMAL, norms, B, true );
-    Matrix<Field> C;
-    Identity( C, A.Width(), A.Width() );
-    Herk( UPPER, ADJOINT, Base<Field>(-1), B, Base<Field>(1), C );
 
-    return HermitianMaxNorm( UPPER, C );
+    const Int bsize = Blocksize();
+    Matrix<Field> C;
+    Real coherence = 0;
+    for( Int k=0; k<n; k+=bsize )
+    {
+        const Int nb = Min(bsize,n-k);
+        auto B1 = B( ALL, IR(k,k+nb) );
+        auto B2 = B( ALL, IR(k,n) );
+        Gemm( ADJOINT, NORMAL, Field(1), B1, B2, C );
+        for( Int j=0; j<n-k; ++j )
+            for( Int i=0; i<Min(j,nb); ++i )
+                coherence = Max( coherence, Abs(C(i,j)) );
+    }
+    return coherence;
 }
 
 template<typename Field>
 Base<Field> Coherence( const AbstractDistMatrix<Field>& A )
 {
     EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Int n = A.Width();
     DistMatrix<Field> B( A );
-    DistMatrix<Base<Field>,MR,STAR> norms(B.Grid());
+    DistMatrix<Real,MR,STAR> norms(B.Grid());
     ColumnTwoNorms( B, norms );
-
     DiagonalSolve( RIGHT, NORMAL, norms, B, true );
-    DistMatrix<Field> C(B.Grid());
-    Identity( C, A.Width(), A.Width() );
-    Herk( UPPER, ADJOINT, Base<Field>(-1), B, Base<Field>(1), C );
 
-    return HermitianMaxNorm( UPPER, C );
+    const Int bsize = Blocksize();
+    DistMatrix<Field> C(B.Grid());
+    Real coherence = 0;
+    for( Int k=0; k<n; k+=bsize )
+    {
+        const Int nb = Min(bsize,n-k);
+        auto B1 = B( ALL, IR(k,k+nb) );
+        auto B2 = B( ALL, IR(k,n) );
+        Gemm( ADJOINT, NORMAL, Field(1), B1, B2, C );
+        const Int localHeight = C.LocalHeight();
+        const Int localWidth = C.LocalWidth();
+        for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+        {
+            const Int j = C.GlobalCol(jLoc);
+            for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+                if( C.GlobalRow(iLoc) < j )
+                    coherence = Max( coherence, Abs(C.GetLocal(iLoc,jLoc)) );
+        }
+    }
+    return mpi::AllReduce( coherence, mpi::MAX, B.Grid().Comm() );
 }
 
 #define PROTO(Field) \
@@ -8,30 +8,140 @@
 */
 #include <El.hpp>
 
+#include "../../io/MPIFile.hpp"
+
+// The covariance is accumulated in a single pass over row panels of the data
+// matrix. Each panel is centered about its own mean before contributing to
+// M := sum_k (d_k - xMean)^H (d_k - xMean) via Herk, and the contribution of
+// the difference between the panel mean and the running mean is incorporated
+// with the rank-one update of Chan, Golub, and LeVeque [1], i.e.,
+//
+//   M := M + M1 + (numObs numObs1 / (numObs+numObs1)) delta^H delta,
+//
+// where delta = xMean1 - xMean. Only a single panel ever needs to be
+// centered, so the data can also be streamed from disk.
+//
+// [1] Tony F. Chan, Gene H. Golub, and Randall J. LeVeque, "Algorithms for
+//     computing the sample variance: Analysis and recommendations",
+//     The American Statistician, Vol. 37, No. 3, 1983.
+//
+
 namespace El {
 
+namespace {
+
 template<typename Field>
-void Covariance( const Matrix<Field>& D, Matrix<Field>& S )
+void AccumulatePanel
+( const Matrix<Field>& D1, Int& numObs, Matrix<Field>& xMean,
+  Matrix<Field>& M )
 {
     EL_DEBUG_CSE
-    const Int numObs = D.Height();
-    const Int n = D.Width();
+    const Int numObs1 = D1.Height();
+    const Int n = D1.Width();
+    if( numObs1 == 0 )
+        return;
 
-    // Compute the average column
-    Matrix<Field> ones, xMean;
-    Ones( ones, numObs, 1 );
-    Gemv( TRANSPOSE, Field(1)/Field(numObs), D, ones, xMean );
+    // Compute the average column of the panel
+    Matrix<Field> ones, xMean1;
+    Ones( ones, numObs1, 1 );
+    Gemv( TRANSPOSE, Field(1)/Field(numObs1), D1, ones, xMean1 );
 
-    // Subtract the mean from each column of D
-    Matrix<Field> DDev( D );
-    for( Int i=0; i<numObs; ++i )
+    // Subtract the panel mean from each row of the panel
+    Matrix<Field> D1Dev( D1 );
+    for( Int i=0; i<numObs1; ++i )
         blas::Axpy
         ( n, Field(-1),
-          xMean.LockedBuffer(), 1,
-          DDev.Buffer(i,0), DDev.LDim() );
+          xMean1.LockedBuffer(), 1,
+          D1Dev.Buffer(i,0), D1Dev.LDim() );
+    Herk( LOWER, ADJOINT, Base<Field>(1), D1Dev, Base<Field>(1), M );
+
+    // Merge the panel mean into the running mean
+    if( numObs == 0 )
+    {
+        xMean = xMean1;
+    }
+    else
+    {
+        const Int numObsNew = numObs + numObs1;
+        Matrix<Field> delta( xMean1 );
+        delta -= xMean;
+        Axpy( Field(numObs1)/Field(numObsNew), delta, xMean );
+        Conjugate( delta );
+        Her
+        ( LOWER, Base<Field>(numObs)*Base<Field>(numObs1)/
+                 Base<Field>(numObsNew), delta, M );
+    }
+    numObs += numObs1;
+}
+
+template<typename Field>
+void AccumulatePanel
+( const DistMatrix<Field>& D1, Int& numObs, DistMatrix<Field>& xMean,
+  DistMatrix<Field>& M )
+{
+    EL_DEBUG_CSE
+    const Grid& g = D1.Grid();
+    const Int numObs1 = D1.Height();
+    if( numObs1 == 0 )
+        return;
+
+    // Compute the average column of the panel
+    DistMatrix<Field> ones(g), xMean1(g);
+    Ones( ones, numObs1, 1 );
+    Gemv( TRANSPOSE, Field(1)/Field(numObs1), D1, ones, xMean1 );
+
+    // Subtract the panel mean from each row of the panel
+    DistMatrix<Field> D1Dev( D1 );
+    DistMatrix<Field,MR,STAR> xMean1_MR(g);
+    xMean1_MR.AlignWith( D1Dev );
+    xMean1_MR = xMean1;
+    for( Int iLoc=0; iLoc<D1Dev.LocalHeight(); ++iLoc )
+        blas::Axpy
+        ( D1Dev.LocalWidth(), Field(-1),
+          xMean1_MR.LockedBuffer(), 1,
+          D1Dev.Buffer(iLoc,0),     D1Dev.LDim() );
+    Herk( LOWER, ADJOINT, Base<Field>(1), D1Dev, Base<Field>(1), M );
+
+    // Merge the panel mean into the running mean
+    if( numObs == 0 )
+    {
+        xMean = xMean1;
+    }
+    else
+    {
+        const Int numObsNew = numObs + numObs1;
+        DistMatrix<Field> delta( xMean1 );
+        Axpy( Field(-1), xMean, delta );
+        Axpy( Field(numObs1)/Field(numObsNew), delta, xMean );
+        Conjugate( delta );
+        Her
+        ( LOWER, Base<Field>(numObs)*Base<Field>(numObs1)/
+                 Base<Field>(numObsNew), delta, M );
+    }
+    numObs += numObs1;
+}
+
+} // anonymous namespace
+
+template<typename Field>
+void Covariance( const Matrix<Field>& D, Matrix<Field>& S )
+{
+    EL_DEBUG_CSE
+    const Int numObs = D.Height();
+    const Int n = D.Width();
+    const Int panelHeight = Max( n, Blocksize() );
+
+    Matrix<Field> xMean;
+    Zeros( S, n, n );
+    Int numObsSeen = 0;
+    for( Int i=0; i<numObs; i+=panelHeight )
+    {
+        const Int nb = Min( panelHeight, numObs-i );
+        AccumulatePanel( D(IR(i,i+nb),ALL), numObsSeen, xMean, S );
+    }
 
-    // Form S := 1/(numObs-1) DDev DDev'
-    Herk( LOWER, ADJOINT, Base<Field>(1)/Base<Field>(numObs-1), DDev, S );
+    // Form S := 1/(numObs-1) M
+    S *= Field(1)/Field(numObs-1);
     Conjugate( S );
     MakeHermitian( LOWER, S );
 }
@@ -51,34 +161,76 @@ void Covariance
 
     const Grid& g = D.Grid();
     const Int numObs = D.Height();
+    const Int n = D.Width();
+    const Int panelHeight = Max( n, Blocksize() );
 
-    // Compute the average column
-    DistMatrix<Field> ones(g), xMean(g);
-    Ones( ones, numObs, 1 );
-    Gemv( TRANSPOSE, Field(1)/Field(numObs), D, ones, xMean );
-    DistMatrix<Field,MR,STAR> xMean_MR(g);
-    xMean_MR.AlignWith( D );
-    xMean_MR = xMean;
-
-    // Subtract the mean from each column of D
-    DistMatrix<Field> DDev( D );
-    for( Int iLoc=0; iLoc<DDev.LocalHeight(); ++iLoc )
-        blas::Axpy
-        ( DDev.LocalWidth(), Field(-1),
-          xMean_MR.LockedBuffer(), 1,
-          DDev.Buffer(iLoc,0),     DDev.LDim() );
+    DistMatrix<Field> xMean(g);
+    Zeros( S, n, n );
+    Int numObsSeen = 0;
+    for( Int i=0; i<numObs; i+=panelHeight )
+    {
+        const Int nb = Min( panelHeight, numObs-i );
+        AccumulatePanel( D(IR(i,i+nb),ALL), numObsSeen, xMean, S );
+    }
 
-    // Form S := 1/(numObs-1) DDev DDev'
-    Herk( LOWER, ADJOINT, Base<Field>(1)/Base<Field>(numObs-1), DDev, S );
+    // Form S := 1/(numObs-1) M
+    S *= Field(1)/Field(numObs-1);
     Conjugate( S );
     MakeHermitian( LOWER, S );
 }
 
-#define PROTO(Field) \
+template<typename Field>
+void Covariance
+( const string& filename, Int numObs, Int n,
+  AbstractDistMatrix<Field>& SPre, Int panelHeight )
+{
+    EL_DEBUG_CSE
+
+    DistMatrixWriteProxy<Field,Field,MC,MR>
+      SProx( SPre );
+    auto& S = SProx.Get();
+
+    const Grid& g = S.Grid();
+    if( panelHeight <= 0 )
+        panelHeight = Max( n, Blocksize() );
+
+    // Read the next panel while the current one is accumulated
+    mpi_file::PanelStream<Field> stream( filename, numObs, n, panelHeight, g );
+    const Int numPanels = stream.NumPanels();
+    DistMatrix<Field> xMean(g);
+    Zeros( S, n, n );
+    Int numObsSeen = 0;
+    if( numPanels > 0 )
+        stream.Begin( 0 );
+    for( Int k=0; k<numPanels; ++k )
+    {
+        const auto& D1 = stream.End( k );
+        if( k+1 < numPanels )
+            stream.Begin( k+1 );
+        AccumulatePanel( D1, numObsSeen, xMean, S );
+    }
+
+    // Form S := 1/(numObs-1) M
+    S *= Field(1)/Field(numObs-1);
+    Conjugate( S );
+    MakeHermitian( LOWER, S );
+}
+
+#define PROTO_BASE(Field) \
   template void Covariance( const Matrix<Field>& D, Matrix<Field>& S ); \
   template void Covariance \
   ( const AbstractDistMatrix<Field>& D, AbstractDistMatrix<Field>& S );
 
+#define PROTO(Field) \
+  PROTO_BASE(Field) \
+  template void Covariance \
+  ( const string& filename, Int numObs, Int n, \
+    AbstractDistMatrix<Field>& S, Int panelHeight );
+
+// The streaming variant relies upon the fixed-size MPI-IO representation
+#define PROTO_BIGFLOAT PROTO_BASE(BigFloat)
+#define PROTO_COMPLEX_BIGFLOAT PROTO_BASE(Complex<BigFloat>)
+
 #define EL_NO_INT_PROTO
 #define EL_ENABLE_DOUBLEDOUBLE
 #define EL_ENABLE_QUADDOUBLE
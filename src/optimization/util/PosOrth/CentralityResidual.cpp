@@ -0,0 +1,190 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+namespace El {
+namespace pos_orth {
+
+// The complementarity residual of one of Gondzio's multiple centrality
+// correctors, i.e., of the trial point (s + alphaPri ds, z + alphaDual dz),
+// whose complementarity products v_i are pushed back into the interval
+// [betaMin mu, betaMax mu]:
+//
+//   r_i = v_i - betaMin mu,                   if v_i < betaMin mu,
+//   r_i = Min(v_i - betaMax mu, betaMax mu),  if v_i > betaMax mu,
+//   r_i = 0,                                  otherwise,
+//
+// where the cap on the decrease of the large products prevents them from
+// dominating the corrector. See
+//
+//     J. Gondzio, "Multiple centrality corrections in a primal-dual method
+//     for linear programming", Computational Optimization and Applications,
+//     6(2), pp. 137--156, 1996.
+//
+
+namespace {
+
+template<typename Real>
+void LocalCentralityResidual
+( Int localHeight,
+  const Real* sBuf, const Real* zBuf,
+  const Real* dsBuf, const Real* dzBuf,
+  Real alphaPri, Real alphaDual,
+  Real lowerTarget, Real upperTarget,
+  Real* rBuf )
+{
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+    {
+        const Real v =
+          (sBuf[iLoc]+alphaPri*dsBuf[iLoc])*(zBuf[iLoc]+alphaDual*dzBuf[iLoc]);
+        if( v < lowerTarget )
+            rBuf[iLoc] = v - lowerTarget;
+        else if( v > upperTarget )
+            rBuf[iLoc] = Min( v - upperTarget, upperTarget );
+        else
+            rBuf[iLoc] = 0;
+    }
+}
+
+} // anonymous namespace
+
+template<typename Real,
+         typename/*=EnableIf<IsReal<Real>>*/>
+void CentralityResidual
+( const Matrix<Real>& s,
+  const Matrix<Real>& z,
+  const Matrix<Real>& ds,
+  const Matrix<Real>& dz,
+        Real alphaPri,
+        Real alphaDual,
+        Real mu,
+        Real betaMin,
+        Real betaMax,
+        Matrix<Real>& r )
+{
+    EL_DEBUG_CSE
+    const Int k = s.Height();
+    r.Resize( k, 1 );
+    LocalCentralityResidual
+    ( k, s.LockedBuffer(), z.LockedBuffer(),
+      ds.LockedBuffer(), dz.LockedBuffer(),
+      alphaPri, alphaDual, betaMin*mu, betaMax*mu, r.Buffer() );
+}
+
+template<typename Real,
+         typename/*=EnableIf<IsReal<Real>>*/>
+void CentralityResidual
+( const AbstractDistMatrix<Real>& sPre,
+  const AbstractDistMatrix<Real>& zPre,
+  const AbstractDistMatrix<Real>& dsPre,
+  const AbstractDistMatrix<Real>& dzPre,
+        Real alphaPri,
+        Real alphaDual,
+        Real mu,
+        Real betaMin,
+        Real betaMax,
+        AbstractDistMatrix<Real>& rPre )
+{
+    EL_DEBUG_CSE
+    DistMatrixReadProxy<Real,Real,MC,MR> sProx( sPre );
+    auto& s = sProx.GetLocked();
+
+    ElementalProxyCtrl control;
+    control.colConstrain = true;
+    control.rowConstrain = true;
+    control.colAlign = s.ColAlign();
+    control.rowAlign = s.RowAlign();
+
+    DistMatrixReadProxy<Real,Real,MC,MR>
+      zProx( zPre, control ),
+      dsProx( dsPre, control ),
+      dzProx( dzPre, control );
+    DistMatrixWriteProxy<Real,Real,MC,MR> rProx( rPre, control );
+    auto& z = zProx.GetLocked();
+    auto& ds = dsProx.GetLocked();
+    auto& dz = dzProx.GetLocked();
+    auto& r = rProx.Get();
+
+    r.Resize( s.Height(), 1 );
+    if( s.IsLocalCol(0) )
+        LocalCentralityResidual
+        ( s.LocalHeight(), s.LockedBuffer(), z.LockedBuffer(),
+          ds.LockedBuffer(), dz.LockedBuffer(),
+          alphaPri, alphaDual, betaMin*mu, betaMax*mu, r.Buffer() );
+}
+
+template<typename Real,
+         typename/*=EnableIf<IsReal<Real>>*/>
+void CentralityResidual
+( const DistMultiVec<Real>& s,
+  const DistMultiVec<Real>& z,
+  const DistMultiVec<Real>& ds,
+  const DistMultiVec<Real>& dz,
+        Real alphaPri,
+        Real alphaDual,
+        Real mu,
+        Real betaMin,
+        Real betaMax,
+        DistMultiVec<Real>& r )
+{
+    EL_DEBUG_CSE
+    r.SetGrid( s.Grid() );
+    r.Resize( s.Height(), 1 );
+    LocalCentralityResidual
+    ( s.LocalHeight(),
+      s.LockedMatrix().LockedBuffer(), z.LockedMatrix().LockedBuffer(),
+      ds.LockedMatrix().LockedBuffer(), dz.LockedMatrix().LockedBuffer(),
+      alphaPri, alphaDual, betaMin*mu, betaMax*mu, r.Matrix().Buffer() );
+}
+
+#define PROTO(Real) \
+  template void CentralityResidual \
+  ( const Matrix<Real>& s, \
+    const Matrix<Real>& z, \
+    const Matrix<Real>& ds, \
+    const Matrix<Real>& dz, \
+          Real alphaPri, \
+          Real alphaDual, \
+          Real mu, \
+          Real betaMin, \
+          Real betaMax, \
+          Matrix<Real>& r ); \
+  template void CentralityResidual \
+  ( const AbstractDistMatrix<Real>& s, \
+    const AbstractDistMatrix<Real>& z, \
+    const AbstractDistMatrix<Real>& ds, \
+    const AbstractDistMatrix<Real>& dz, \
+          Real alphaPri, \
+          Real alphaDual, \
+          Real mu, \
+          Real betaMin, \
+          Real betaMax, \
+          AbstractDistMatrix<Real>& r ); \
+  template void CentralityResidual \
+  ( const DistMultiVec<Real>& s, \
+    const DistMultiVec<Real>& z, \
+    const DistMultiVec<Real>& ds, \
+    const DistMultiVec<Real>& dz, \
+          Real alphaPri, \
+          Real alphaDual, \
+          Real mu, \
+          Real betaMin, \
+          Real betaMax, \
+          DistMultiVec<Real>& r );
+
+#define EL_NO_INT_PROTO
+#define EL_NO_COMPLEX_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace pos_orth
+} // namespace El
@@ -0,0 +1,171 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+namespace El {
+namespace pos_orth {
+
+// Move a (typically optimal) complementary pair (s,z) from a previous solve
+// just far enough into the interior of the positive orthant for it to serve
+// as the starting point of an interior point method:
+//
+//  1) Lift each entry of s (z) to at least shift*max(1,|| s ||_max)
+//     (shift*max(1,|| z ||_max)), and then
+//
+//  2) with mu = s^T z / k, rescale each pair with s_i z_i < centrality*mu
+//     via (s_i,z_i) := sqrt(centrality*mu/(s_i z_i)) (s_i,z_i), so that
+//     every product is at least centrality*mu while the ratio s_i/z_i,
+//     which encodes the previous active set, is preserved.
+//
+// Unlike the standard initialization shift, which adds a multiple of the
+// identity large enough to destroy the structure of the previous solution,
+// this perturbation is on the order of 'shift'. It is in the spirit of the
+// slack rescaling warm starts of
+//
+//     E. A. Yildirim and S. J. Wright,
+//     "Warm-start strategies in interior-point methods for linear
+//      programming", SIAM J. Optim., 12(3), pp. 782--810, 2002.
+//
+
+namespace {
+
+template<typename Real>
+Real LiftEntries
+( Int localHeight, Real* sBuf, Real* zBuf, Real sFloor, Real zFloor )
+{
+    Real localDot = 0;
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+    {
+        sBuf[iLoc] = Max( sBuf[iLoc], sFloor );
+        zBuf[iLoc] = Max( zBuf[iLoc], zFloor );
+        localDot += sBuf[iLoc]*zBuf[iLoc];
+    }
+    return localDot;
+}
+
+template<typename Real>
+void RecenterEntries
+( Int localHeight, Real* sBuf, Real* zBuf, Real minProd )
+{
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+    {
+        const Real prod = sBuf[iLoc]*zBuf[iLoc];
+        if( prod < minProd )
+        {
+            const Real scale = Sqrt( minProd/prod );
+            sBuf[iLoc] *= scale;
+            zBuf[iLoc] *= scale;
+        }
+    }
+}
+
+} // anonymous namespace
+
+template<typename Real,
+         typename/*=EnableIf<IsReal<Real>>*/>
+void WarmStart
+( Matrix<Real>& s,
+  Matrix<Real>& z,
+  Real shift,
+  Real centrality )
+{
+    EL_DEBUG_CSE
+    const Int k = s.Height();
+    if( k == 0 )
+        return;
+    const Real sFloor = shift*Max(MaxNorm(s),Real(1));
+    const Real zFloor = shift*Max(MaxNorm(z),Real(1));
+    const Real dot = LiftEntries( k, s.Buffer(), z.Buffer(), sFloor, zFloor );
+    const Real mu = dot / k;
+    RecenterEntries( k, s.Buffer(), z.Buffer(), centrality*mu );
+}
+
+template<typename Real,
+         typename/*=EnableIf<IsReal<Real>>*/>
+void WarmStart
+( AbstractDistMatrix<Real>& sPre,
+  AbstractDistMatrix<Real>& zPre,
+  Real shift,
+  Real centrality )
+{
+    EL_DEBUG_CSE
+    AssertSameGrids( sPre, zPre );
+
+    ElementalProxyCtrl ctrl;
+    ctrl.colConstrain = true;
+    ctrl.colAlign = 0;
+
+    DistMatrixReadWriteProxy<Real,Real,VC,STAR>
+      sProx( sPre, ctrl ),
+      zProx( zPre, ctrl );
+    auto& s = sProx.Get();
+    auto& z = zProx.Get();
+
+    const Int k = s.Height();
+    if( k == 0 )
+        return;
+    const Int localHeight = s.LocalHeight();
+    const Real sFloor = shift*Max(MaxNorm(s),Real(1));
+    const Real zFloor = shift*Max(MaxNorm(z),Real(1));
+    const Real localDot =
+      LiftEntries( localHeight, s.Buffer(), z.Buffer(), sFloor, zFloor );
+    const Real mu = mpi::AllReduce( localDot, s.DistComm() ) / k;
+    RecenterEntries( localHeight, s.Buffer(), z.Buffer(), centrality*mu );
+}
+
+template<typename Real,
+         typename/*=EnableIf<IsReal<Real>>*/>
+void WarmStart
+( DistMultiVec<Real>& s,
+  DistMultiVec<Real>& z,
+  Real shift,
+  Real centrality )
+{
+    EL_DEBUG_CSE
+    const Int k = s.Height();
+    if( k == 0 )
+        return;
+    const Int localHeight = s.LocalHeight();
+    Real* sBuf = s.Matrix().Buffer();
+    Real* zBuf = z.Matrix().Buffer();
+    const Real sFloor = shift*Max(MaxNorm(s),Real(1));
+    const Real zFloor = shift*Max(MaxNorm(z),Real(1));
+    const Real localDot =
+      LiftEntries( localHeight, sBuf, zBuf, sFloor, zFloor );
+    const Real mu = mpi::AllReduce( localDot, s.Grid().Comm() ) / k;
+    RecenterEntries( localHeight, sBuf, zBuf, centrality*mu );
+}
+
+#define PROTO(Real) \
+  template void WarmStart \
+  ( Matrix<Real>& s, \
+    Matrix<Real>& z, \
+    Real shift, \
+    Real centrality ); \
+  template void WarmStart \
+  ( AbstractDistMatrix<Real>& s, \
+    AbstractDistMatrix<Real>& z, \
+    Real shift, \
+    Real centrality ); \
+  template void WarmStart \
+  ( DistMultiVec<Real>& s, \
+    DistMultiVec<Real>& z, \
+    Real shift, \
+    Real centrality );
+
+#define EL_NO_INT_PROTO
+#define EL_NO_COMPLEX_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace pos_orth
+} // namespace El
@@ -0,0 +1,445 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+#include "./StepLength.hpp"
+
+namespace El {
+namespace soc {
+
+void FormBatches
+( const Matrix<Int>& orders,
+  const Matrix<Int>& firstInds,
+        Batches& batches )
+{
+    EL_DEBUG_CSE
+    const Int height = orders.Height();
+    if( firstInds.Height() != height )
+        LogicError("orders and firstInds should be the same height");
+
+    // Count the number of cones of each order
+    std::map<Int,Int> numCones;
+    for( Int i=0; i<height; )
+    {
+        const Int order = orders(i);
+        if( order < 1 || firstInds(i) != i )
+            LogicError("Inconsistency in orders and firstInds");
+        ++numCones[order];
+        i += order;
+    }
+
+    batches.orders.resize( 0 );
+    batches.offsets.resize( 1 );
+    batches.offsets[0] = 0;
+    for( const auto& entry : numCones )
+    {
+        batches.orders.push_back( entry.first );
+        batches.offsets.push_back( batches.offsets.back()+entry.second );
+    }
+
+    // Pack the first indices of each batch
+    const Int numBatches = batches.orders.size();
+    vector<Int> offsets( batches.offsets.begin(), batches.offsets.end()-1 );
+    batches.firstInds.resize( batches.offsets[numBatches] );
+    for( Int i=0; i<height; )
+    {
+        const Int order = orders(i);
+        const Int batch =
+          std::lower_bound
+          ( batches.orders.begin(), batches.orders.end(), order ) -
+          batches.orders.begin();
+        batches.firstInds[offsets[batch]++] = i;
+        i += order;
+    }
+}
+
+namespace {
+
+// The step-length kernels reduce over chunks of this many cones so that the
+// cones can be processed in parallel
+const Int chunkSize = 1024;
+
+// The kernels below are specialized for the fixed orders 1 through 4 so that
+// the inner loops may be unrolled; an 'Order' of zero uses the runtime order.
+template<Int Order>
+inline Int ConeOrder( Int order ) EL_NO_EXCEPT
+{ return Order > 0 ? Order : order; }
+
+template<template<Int> class Kernel,typename... Args>
+void Dispatch( Int order, Args... args )
+{
+    switch( order )
+    {
+    case 1: Kernel<1>::Apply( order, args... ); break;
+    case 2: Kernel<2>::Apply( order, args... ); break;
+    case 3: Kernel<3>::Apply( order, args... ); break;
+    case 4: Kernel<4>::Apply( order, args... ); break;
+    default: Kernel<0>::Apply( order, args... ); break;
+    }
+}
+
+template<Int Order,typename Real>
+Promote<Real> ConeStep
+( Int order,
+  const Real* x,
+  const Real* y,
+  const Promote<Real>& upperBound )
+{
+    typedef Promote<Real> PReal;
+    const Int n = ConeOrder<Order>( order );
+    const PReal x0 = x[0];
+    const PReal y0 = y[0];
+    PReal xDet = x0*x0, yDet = y0*y0, xTRy = x0*y0;
+    for( Int k=1; k<n; ++k )
+    {
+        const PReal xk = x[k];
+        const PReal yk = y[k];
+        xDet -= xk*xk;
+        yDet -= yk*yk;
+        xTRy -= xk*yk;
+    }
+    return ChooseStepLength( x0, y0, xDet, yDet, xTRy, upperBound );
+}
+
+template<Int Order,typename Real>
+void ConePushInto( Int order, Real* x, const Real& minDist )
+{
+    const Int n = ConeOrder<Order>( order );
+    Real lowerNorm;
+    if( Order > 0 )
+    {
+        Real lowerNormSquared = 0;
+        for( Int k=1; k<n; ++k )
+            lowerNormSquared += x[k]*x[k];
+        lowerNorm = Sqrt(lowerNormSquared);
+    }
+    else
+        lowerNorm = blas::Nrm2( n-1, &x[1], 1 );
+    if( x[0]-lowerNorm < minDist )
+        x[0] = minDist + lowerNorm;
+}
+
+// The Nesterov-Todd point of a single cone using the approach of Section 4.2
+// of Vandenberghe's "The CVXOPT linear and quadratic cone program solvers",
+//
+//   w = (det(s)/det(z))^(1/4) (sHat + R zHat) / (2 gamma),
+//
+// where sHat = s / sqrt(det(s)), zHat = z / sqrt(det(z)), and
+// gamma = sqrt((1 + zHat^T sHat)/2).
+template<Int Order,typename Real>
+void ConeNesterovTodd( Int order, const Real* s, const Real* z, Real* w )
+{
+    typedef Promote<Real> PReal;
+    const Int n = ConeOrder<Order>( order );
+    const PReal s0 = s[0];
+    const PReal z0 = z[0];
+    PReal sDet = s0*s0, zDet = z0*z0, sTz = s0*z0;
+    for( Int k=1; k<n; ++k )
+    {
+        const PReal sk = s[k];
+        const PReal zk = z[k];
+        sDet -= sk*sk;
+        zDet -= zk*zk;
+        sTz += sk*zk;
+    }
+    const PReal sDetRoot = Sqrt(sDet);
+    const PReal zDetRoot = Sqrt(zDet);
+    const PReal gamma = Sqrt((PReal(1)+sTz/(sDetRoot*zDetRoot))/PReal(2));
+    const PReal scale = Sqrt(sDetRoot/zDetRoot);
+    const PReal sCoeff = scale/(2*gamma*sDetRoot);
+    const PReal zCoeff = scale/(2*gamma*zDetRoot);
+    w[0] = Real(sCoeff*s0 + zCoeff*z0);
+    for( Int k=1; k<n; ++k )
+        w[k] = Real(sCoeff*PReal(s[k]) - zCoeff*PReal(z[k]));
+}
+
+template<Int Order>
+struct DotsKernel
+{
+    template<typename Real>
+    static void Apply
+    ( Int order, const Int* heads, Int numCones,
+      const Real* xBuf, const Real* yBuf, Real* zBuf )
+    {
+        const Int n = ConeOrder<Order>( order );
+        EL_PARALLEL_FOR
+        for( Int c=0; c<numCones; ++c )
+        {
+            const Int i = heads[c];
+            Real dot = 0;
+            for( Int k=0; k<n; ++k )
+                dot += xBuf[i+k]*yBuf[i+k];
+            zBuf[i] = dot;
+        }
+    }
+};
+
+template<Int Order>
+struct MaxStepsKernel
+{
+    // If either sBuf or zBuf is null then the corresponding step is skipped
+    template<typename Real>
+    static void Apply
+    ( Int order, const Int* heads, Int numCones,
+      const Real* sBuf, const Real* dsBuf, Promote<Real>* alphaPri,
+      const Real* zBuf, const Real* dzBuf, Promote<Real>* alphaDual )
+    {
+        typedef Promote<Real> PReal;
+        const Int numChunks = (numCones+chunkSize-1) / chunkSize;
+        vector<PReal> priSteps( numChunks, *alphaPri ),
+                      dualSteps( numChunks, *alphaDual );
+        EL_PARALLEL_FOR
+        for( Int chunk=0; chunk<numChunks; ++chunk )
+        {
+            PReal priStep = priSteps[chunk], dualStep = dualSteps[chunk];
+            const Int cEnd = Min( (chunk+1)*chunkSize, numCones );
+            for( Int c=chunk*chunkSize; c<cEnd; ++c )
+            {
+                const Int i = heads[c];
+                if( sBuf != nullptr )
+                    priStep =
+                      ConeStep<Order>( order, &sBuf[i], &dsBuf[i], priStep );
+                if( zBuf != nullptr )
+                    dualStep =
+                      ConeStep<Order>( order, &zBuf[i], &dzBuf[i], dualStep );
+            }
+            priSteps[chunk] = priStep;
+            dualSteps[chunk] = dualStep;
+        }
+        for( Int chunk=0; chunk<numChunks; ++chunk )
+        {
+            *alphaPri = Min( *alphaPri, priSteps[chunk] );
+            *alphaDual = Min( *alphaDual, dualSteps[chunk] );
+        }
+    }
+};
+
+template<Int Order>
+struct NesterovToddKernel
+{
+    template<typename Real>
+    static void Apply
+    ( Int order, const Int* heads, Int numCones,
+      const Real* sBuf, const Real* zBuf, Real* wBuf )
+    {
+        EL_PARALLEL_FOR
+        for( Int c=0; c<numCones; ++c )
+        {
+            const Int i = heads[c];
+            ConeNesterovTodd<Order>( order, &sBuf[i], &zBuf[i], &wBuf[i] );
+        }
+    }
+};
+
+template<Int Order>
+struct PushIntoNesterovToddKernel
+{
+    template<typename Real>
+    static void Apply
+    ( Int order, const Int* heads, Int numCones,
+      Real* sBuf, Real* zBuf, Real* wBuf, Real minDist )
+    {
+        EL_PARALLEL_FOR
+        for( Int c=0; c<numCones; ++c )
+        {
+            const Int i = heads[c];
+            ConePushInto<Order>( order, &sBuf[i], minDist );
+            ConePushInto<Order>( order, &zBuf[i], minDist );
+            ConeNesterovTodd<Order>( order, &sBuf[i], &zBuf[i], &wBuf[i] );
+        }
+    }
+};
+
+inline Int BatchSize( const Batches& batches, Int batch )
+{ return batches.offsets[batch+1] - batches.offsets[batch]; }
+
+inline const Int* BatchFirstInds( const Batches& batches, Int batch )
+{ return &batches.firstInds[batches.offsets[batch]]; }
+
+template<typename Real>
+void CheckBatches( const Matrix<Real>& x, const Batches& batches )
+{
+    EL_DEBUG_CSE
+    const Int numBatches = batches.orders.size();
+    if( Int(batches.offsets.size()) != numBatches+1 )
+        LogicError("Invalid batch offsets");
+    if( x.Width() != 1 )
+        LogicError("Expected a column vector");
+    Int height = 0;
+    for( Int batch=0; batch<numBatches; ++batch )
+        height += batches.orders[batch]*BatchSize( batches, batch );
+    if( height != x.Height() )
+        LogicError("The batches did not match the height of the vector");
+}
+
+} // anonymous namespace
+
+template<typename Real,
+         typename/*=EnableIf<IsReal<Real>>*/>
+void Dots
+( const Matrix<Real>& x,
+  const Matrix<Real>& y,
+        Matrix<Real>& z,
+  const Batches& batches )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      CheckBatches( x, batches );
+      if( y.Height() != x.Height() || y.Width() != x.Width() )
+          LogicError("x and y must be the same size");
+    )
+    Zeros( z, x.Height(), x.Width() );
+    const Int numBatches = batches.orders.size();
+    for( Int batch=0; batch<numBatches; ++batch )
+        Dispatch<DotsKernel>
+        ( batches.orders[batch],
+          BatchFirstInds(batches,batch), BatchSize(batches,batch),
+          x.LockedBuffer(), y.LockedBuffer(), z.Buffer() );
+}
+
+template<typename Real,
+         typename/*=EnableIf<IsReal<Real>>*/>
+Real MaxStep
+( const Matrix<Real>& x,
+  const Matrix<Real>& y,
+  const Batches& batches,
+  Real upperBound )
+{
+    EL_DEBUG_CSE
+    typedef Promote<Real> PReal;
+    EL_DEBUG_ONLY(
+      CheckBatches( x, batches );
+      if( y.Height() != x.Height() || y.Width() != x.Width() )
+          LogicError("x and y must be the same size");
+    )
+    PReal alpha = upperBound, unused = upperBound;
+    const Real* nullBuf = nullptr;
+    const Int numBatches = batches.orders.size();
+    for( Int batch=0; batch<numBatches; ++batch )
+        Dispatch<MaxStepsKernel>
+        ( batches.orders[batch],
+          BatchFirstInds(batches,batch), BatchSize(batches,batch),
+          x.LockedBuffer(), y.LockedBuffer(), &alpha,
+          nullBuf, nullBuf, &unused );
+    return Real(alpha);
+}
+
+template<typename Real,
+         typename/*=EnableIf<IsReal<Real>>*/>
+pair<Real,Real> MaxSteps
+( const Matrix<Real>& s,
+  const Matrix<Real>& ds,
+  const Matrix<Real>& z,
+  const Matrix<Real>& dz,
+  const Batches& batches,
+  Real upperBound )
+{
+    EL_DEBUG_CSE
+    typedef Promote<Real> PReal;
+    EL_DEBUG_ONLY(
+      CheckBatches( s, batches );
+      CheckBatches( ds, batches );
+      CheckBatches( z, batches );
+      CheckBatches( dz, batches );
+    )
+    PReal alphaPri = upperBound, alphaDual = upperBound;
+    const Int numBatches = batches.orders.size();
+    for( Int batch=0; batch<numBatches; ++batch )
+        Dispatch<MaxStepsKernel>
+        ( batches.orders[batch],
+          BatchFirstInds(batches,batch), BatchSize(batches,batch),
+          s.LockedBuffer(), ds.LockedBuffer(), &alphaPri,
+          z.LockedBuffer(), dz.LockedBuffer(), &alphaDual );
+    return pair<Real,Real>( Real(alphaPri), Real(alphaDual) );
+}
+
+template<typename Real,
+         typename/*=EnableIf<IsReal<Real>>*/>
+void NesterovTodd
+( const Matrix<Real>& s,
+  const Matrix<Real>& z,
+        Matrix<Real>& w,
+  const Batches& batches )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      CheckBatches( s, batches );
+      CheckBatches( z, batches );
+    )
+    w.Resize( s.Height(), 1 );
+    const Int numBatches = batches.orders.size();
+    for( Int batch=0; batch<numBatches; ++batch )
+        Dispatch<NesterovToddKernel>
+        ( batches.orders[batch],
+          BatchFirstInds(batches,batch), BatchSize(batches,batch),
+          s.LockedBuffer(), z.LockedBuffer(), w.Buffer() );
+}
+
+template<typename Real,
+         typename/*=EnableIf<IsReal<Real>>*/>
+void PushIntoNesterovTodd
+(       Matrix<Real>& s,
+        Matrix<Real>& z,
+        Matrix<Real>& w,
+  const Batches& batches,
+  Real minDist )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      CheckBatches( s, batches );
+      CheckBatches( z, batches );
+    )
+    w.Resize( s.Height(), 1 );
+    const Int numBatches = batches.orders.size();
+    for( Int batch=0; batch<numBatches; ++batch )
+        Dispatch<PushIntoNesterovToddKernel>
+        ( batches.orders[batch],
+          BatchFirstInds(batches,batch), BatchSize(batches,batch),
+          s.Buffer(), z.Buffer(), w.Buffer(), minDist );
+}
+
+#define PROTO(Real) \
+  template void Dots \
+  ( const Matrix<Real>& x, \
+    const Matrix<Real>& y, \
+          Matrix<Real>& z, \
+    const Batches& batches ); \
+  template Real MaxStep \
+  ( const Matrix<Real>& x, \
+    const Matrix<Real>& y, \
+    const Batches& batches, \
+    Real upperBound ); \
+  template pair<Real,Real> MaxSteps \
+  ( const Matrix<Real>& s, \
+    const Matrix<Real>& ds, \
+    const Matrix<Real>& z, \
+    const Matrix<Real>& dz, \
+    const Batches& batches, \
+    Real upperBound ); \
+  template void NesterovTodd \
+  ( const Matrix<Real>& s, \
+    const Matrix<Real>& z, \
+          Matrix<Real>& w, \
+    const Batches& batches ); \
+  template void PushIntoNesterovTodd \
+  (       Matrix<Real>& s, \
+          Matrix<Real>& z, \
+          Matrix<Real>& w, \
+    const Batches& batches, \
+    Real minDist );
+
+#define EL_NO_INT_PROTO
+#define EL_NO_COMPLEX_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace soc
+} // namespace El
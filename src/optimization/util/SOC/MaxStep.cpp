@@ -7,6 +7,7 @@
    http://opensource.org/licenses/BSD-2-Clause
 */
 #include <El.hpp>
+#include "./StepLength.hpp"
 
 namespace El {
 namespace soc {
@@ -108,56 +109,6 @@ namespace soc {
 //     https://github.com/cvxopt/cvxopt/blob/f3ca94fb997979a54b913f95b816132f7fd44820/src/python/misc.py#L1018
 //
 
-namespace {
-
-template<typename Real,
-         typename=EnableIf<IsReal<Real>>>
-Real ChooseStepLength
-( const Real& x0,
-  const Real& y0,
-  const Real& xDet,
-  const Real& yDet,
-  const Real& xTRy,
-  const Real& upperBound,
-  const Real& delta=limits::Epsilon<Real>() )
-{
-    EL_DEBUG_CSE
-    Real step;
-    if( y0 >= Real(0) && yDet >= Real(0) )
-    {
-        step = upperBound;
-    }
-    else if( Abs(yDet) <= delta )
-    {
-        // Fall back to a backstepping line search rather than using the
-        // alpha^2 = 0 approximation alpha = - 2 det(x) / (x^T R y),
-        // which has been observed to, in some cases, return 0 instead of the
-        // upper bound.
-        Real stepRatio = 0.99;
-        step = upperBound;
-        while( step*step*yDet + 2*step*xTRy + xDet <= 0 || x0+step*y0 <= 0 )
-            step *= stepRatio;
-    }
-    else
-    {
-        Real discrim = Max(xTRy*xTRy-xDet*yDet,Real(0));
-        Real sqrtDiscrim = Sqrt(discrim);
-        Real plusRoot = (-xTRy+sqrtDiscrim)/yDet;
-        Real minusRoot = (-xTRy-sqrtDiscrim)/yDet;
-        Real minRoot = Min(plusRoot,minusRoot);
-        Real maxRoot = Max(plusRoot,minusRoot);
-        if( minRoot >= Real(0) )
-            step = minRoot;
-        else
-            step = maxRoot;
-    }
-    step = Max(step,Real(0));
-    step = Min(step,upperBound);
-    return step;
-}
-
-} // anonymous namespace
-
 template<typename Real,
          typename/*=EnableIf<IsReal<Real>>*/>
 Real MaxStep
@@ -0,0 +1,66 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_SOC_STEPLENGTH_HPP
+#define EL_SOC_STEPLENGTH_HPP
+
+namespace El {
+namespace soc {
+
+// Returns the maximum step length of a single subcone given x_0, y_0, det(x),
+// det(y), and x^T R y (see MaxStep.cpp for a derivation)
+template<typename Real,
+         typename=EnableIf<IsReal<Real>>>
+Real ChooseStepLength
+( const Real& x0,
+  const Real& y0,
+  const Real& xDet,
+  const Real& yDet,
+  const Real& xTRy,
+  const Real& upperBound,
+  const Real& delta=limits::Epsilon<Real>() )
+{
+    EL_DEBUG_CSE
+    Real step;
+    if( y0 >= Real(0) && yDet >= Real(0) )
+    {
+        step = upperBound;
+    }
+    else if( Abs(yDet) <= delta )
+    {
+        // Fall back to a backstepping line search rather than using the
+        // alpha^2 = 0 approximation alpha = - 2 det(x) / (x^T R y),
+        // which has been observed to, in some cases, return 0 instead of the
+        // upper bound.
+        Real stepRatio = 0.99;
+        step = upperBound;
+        while( step*step*yDet + 2*step*xTRy + xDet <= 0 || x0+step*y0 <= 0 )
+            step *= stepRatio;
+    }
+    else
+    {
+        Real discrim = Max(xTRy*xTRy-xDet*yDet,Real(0));
+        Real sqrtDiscrim = Sqrt(discrim);
+        Real plusRoot = (-xTRy+sqrtDiscrim)/yDet;
+        Real minusRoot = (-xTRy-sqrtDiscrim)/yDet;
+        Real minRoot = Min(plusRoot,minusRoot);
+        Real maxRoot = Max(plusRoot,minusRoot);
+        if( minRoot >= Real(0) )
+            step = minRoot;
+        else
+            step = maxRoot;
+    }
+    step = Max(step,Real(0));
+    step = Min(step,upperBound);
+    return step;
+}
+
+} // namespace soc
+} // namespace El
+
+#endif // ifndef EL_SOC_STEPLENGTH_HPP
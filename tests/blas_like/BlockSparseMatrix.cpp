@@ -0,0 +1,114 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// Check the block compressed sparse row (BSR) Multiply against the CSR
+// Multiply for block sizes which do and do not divide the dimensions,
+// covering both the specialized kernels (block sizes of 2 through 8) and the
+// runtime-sized fallback, and check that converting to BSR and back to CSR
+// reproduces the original matrix.
+
+template<typename T>
+void SparseUniform( SparseMatrix<T>& A, Int m, Int n )
+{
+    Zeros( A, m, n );
+    A.Reserve( 3*m );
+    for( Int i=0; i<m; ++i )
+    {
+        A.QueueUpdate( i, i % n, SampleUniform<T>() );
+        A.QueueUpdate( i, (3*i+1) % n, SampleUniform<T>() );
+        A.QueueUpdate( i, (7*i+5) % n, SampleUniform<T>() );
+    }
+    A.ProcessQueues();
+}
+
+template<typename T>
+void TestBlockSparse
+( Int m, Int n, Int numRHS, const vector<Int>& blockSizes )
+{
+    typedef Base<T> Real;
+    Output("Testing with ",TypeName<T>());
+    const Real tol = 10*(m+n)*limits::Epsilon<Real>();
+    const T alpha = T(2), beta = T(-1);
+
+    SparseMatrix<T> A;
+    SparseUniform( A, m, n );
+    Matrix<T> ADense;
+    Copy( A, ADense );
+    for( const Int blockSize : blockSizes )
+    {
+        BlockSparseMatrix<T> ABlock;
+        Copy( A, ABlock, blockSize );
+
+        // Round trip through BSR storage
+        SparseMatrix<T> ACopy;
+        Copy( ABlock, ACopy );
+        Matrix<T> ACopyDense;
+        Copy( ACopy, ACopyDense );
+        ACopyDense -= ADense;
+        const Real copyDiff = MaxNorm( ACopyDense );
+        Real getDiff = 0;
+        for( Int i=0; i<m; ++i )
+            for( Int j=0; j<n; ++j )
+                getDiff = Max( getDiff, Abs(ABlock.Get(i,j)-ADense(i,j)) );
+        Output
+        ("  block size ",blockSize,": ",ABlock.NumBlocks()," blocks, "
+         "round-trip difference = ",copyDiff,", Get difference = ",getDiff);
+        if( copyDiff != Real(0) || getDiff != Real(0) )
+            LogicError("BSR conversion did not reproduce the CSR matrix");
+
+        for( auto orientation : {NORMAL,TRANSPOSE,ADJOINT} )
+        {
+            const Int heightX = ( orientation == NORMAL ? n : m );
+            const Int heightY = ( orientation == NORMAL ? m : n );
+            Matrix<T> X, Y, YRef;
+            Uniform( X, heightX, numRHS );
+            Uniform( Y, heightY, numRHS );
+            YRef = Y;
+            Multiply( orientation, alpha, ABlock, X, beta, Y );
+            Multiply( orientation, alpha, A, X, beta, YRef );
+            const Real YRefFrob = FrobeniusNorm( YRef );
+            Y -= YRef;
+            const Real multiplyErr = FrobeniusNorm( Y ) / YRefFrob;
+            Output
+            ("    ",OrientationToChar(orientation),
+             ": || BSR - CSR ||_F / || CSR ||_F = ",multiplyErr);
+            if( multiplyErr > tol )
+                LogicError
+                ("BSR Multiply with block size ",blockSize,
+                 " disagreed with the CSR Multiply");
+        }
+    }
+    Output("");
+}
+
+int main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+
+    try
+    {
+        const Int m = Input("--m","height of A",100);
+        const Int n = Input("--n","width of A",70);
+        const Int numRHS = Input("--numRHS","number of columns of X",4);
+        ProcessInput();
+
+        const vector<Int> blockSizes({1,2,3,4,5,8,9});
+        if( mpi::Rank() == 0 )
+        {
+            TestBlockSparse<float>( m, n, numRHS, blockSizes );
+            TestBlockSparse<double>( m, n, numRHS, blockSizes );
+            TestBlockSparse<Complex<double>>( m, n, numRHS, blockSizes );
+        }
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -0,0 +1,174 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// Check the block-by-block Multiply of composite matrices against a Gemm with
+// the matrix materialized by Copy. The composite matrix is
+//
+//   | 2 I (m x n),  3 D^T,      0 |
+//   |           S,    E^H,      F |
+//
+// where D is m x m and F is n x k dense and S is n x n and E is m x n sparse.
+
+template<typename T>
+void SparseUniform( SparseMatrix<T>& A, Int m, Int n )
+{
+    Zeros( A, m, n );
+    A.Reserve( 2*m );
+    for( Int i=0; i<m; ++i )
+    {
+        A.QueueUpdate( i, i % n, SampleUniform<T>() );
+        A.QueueUpdate( i, (3*i+1) % n, SampleUniform<T>() );
+    }
+    A.ProcessQueues();
+}
+
+template<typename T>
+void SparseUniform( DistSparseMatrix<T>& A, Int m, Int n )
+{
+    Zeros( A, m, n );
+    const Int localHeight = A.LocalHeight();
+    A.Reserve( 2*localHeight );
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+    {
+        const Int i = A.GlobalRow(iLoc);
+        A.QueueLocalUpdate( iLoc, i % n, SampleUniform<T>() );
+        A.QueueLocalUpdate( iLoc, (3*i+1) % n, SampleUniform<T>() );
+    }
+    A.ProcessLocalQueues();
+}
+
+template<typename T>
+void TestSequential( Int m, Int n, Int k, Int numRHS )
+{
+    typedef Base<T> Real;
+    const Real tol = 10*(m+n+k)*limits::Epsilon<Real>();
+
+    Matrix<T> D, F;
+    Uniform( D, m, m );
+    Uniform( F, n, k );
+    SparseMatrix<T> S, E;
+    SparseUniform( S, n, n );
+    SparseUniform( E, m, n );
+
+    CompositeMatrix<T> A( {m,n}, {n,m,k} );
+    A.SetIdentityBlock( 0, 0, T(2) );
+    A.SetBlock( 0, 1, D, TRANSPOSE, T(3) );
+    A.SetBlock( 1, 0, S );
+    A.SetBlock( 1, 1, E, ADJOINT );
+    A.SetBlock( 1, 2, F );
+
+    Matrix<T> AExplicit;
+    Copy( A, AExplicit );
+    SparseMatrix<T> ASparse;
+    Copy( A, ASparse );
+
+    for( auto orientation : {NORMAL,TRANSPOSE,ADJOINT} )
+    {
+        const Int heightX = ( orientation == NORMAL ? A.Width() : A.Height() );
+        const Int heightY = ( orientation == NORMAL ? A.Height() : A.Width() );
+        Matrix<T> X, Y, YDense, YSparse;
+        Uniform( X, heightX, numRHS );
+        Uniform( Y, heightY, numRHS );
+        YDense = Y;
+        YSparse = Y;
+        Multiply( orientation, T(2), A, X, T(-1), Y );
+        Gemm( orientation, NORMAL, T(2), AExplicit, X, T(-1), YDense );
+        Multiply( orientation, T(2), ASparse, X, T(-1), YSparse );
+
+        const Real YFrob = FrobeniusNorm( YDense );
+        YSparse -= YDense;
+        Y -= YDense;
+        const Real multiplyErr = FrobeniusNorm( Y ) / YFrob;
+        const Real sparseErr = FrobeniusNorm( YSparse ) / YFrob;
+        Output
+        ("  sequential ",OrientationToChar(orientation),
+         ": || Multiply - Gemm ||_F / || Gemm ||_F = ",multiplyErr,
+         ", || Sparse - Gemm ||_F / || Gemm ||_F = ",sparseErr);
+        if( multiplyErr > tol || sparseErr > tol )
+            LogicError("Composite Multiply disagreed with Gemm");
+    }
+}
+
+template<typename T>
+void TestDistributed( Int m, Int n, Int k, Int numRHS, const Grid& grid )
+{
+    typedef Base<T> Real;
+    const Real tol = 10*(m+n+k)*limits::Epsilon<Real>();
+
+    DistMatrix<T> D(grid), F(grid);
+    Uniform( D, m, m );
+    Uniform( F, n, k );
+    DistSparseMatrix<T> S(grid), E(grid);
+    SparseUniform( S, n, n );
+    SparseUniform( E, m, n );
+
+    DistCompositeMatrix<T> A( grid, {m,n}, {n,m,k} );
+    A.SetIdentityBlock( 0, 0, T(2) );
+    A.SetBlock( 0, 1, D, TRANSPOSE, T(3) );
+    A.SetBlock( 1, 0, S );
+    A.SetBlock( 1, 1, E, ADJOINT );
+    A.SetBlock( 1, 2, F );
+
+    DistMatrix<T> AExplicit(grid);
+    Copy( A, AExplicit );
+
+    for( auto orientation : {NORMAL,TRANSPOSE,ADJOINT} )
+    {
+        const Int heightX = ( orientation == NORMAL ? A.Width() : A.Height() );
+        const Int heightY = ( orientation == NORMAL ? A.Height() : A.Width() );
+        DistMatrix<T> X(grid), Y(grid), YDense(grid);
+        Uniform( X, heightX, numRHS );
+        Uniform( Y, heightY, numRHS );
+        YDense = Y;
+        Multiply( orientation, T(2), A, X, T(-1), Y );
+        Gemm( orientation, NORMAL, T(2), AExplicit, X, T(-1), YDense );
+
+        const Real YFrob = FrobeniusNorm( YDense );
+        Y -= YDense;
+        const Real multiplyErr = FrobeniusNorm( Y ) / YFrob;
+        OutputFromRoot
+        (grid.Comm(),"  distributed ",OrientationToChar(orientation),
+         ": || Multiply - Gemm ||_F / || Gemm ||_F = ",multiplyErr);
+        if( multiplyErr > tol )
+            LogicError("Distributed composite Multiply disagreed with Gemm");
+    }
+}
+
+template<typename T>
+void TestComposite( Int m, Int n, Int k, Int numRHS, const Grid& grid )
+{
+    OutputFromRoot(grid.Comm(),"Testing with ",TypeName<T>());
+    if( grid.Rank() == 0 )
+        TestSequential<T>( m, n, k, numRHS );
+    TestDistributed<T>( m, n, k, numRHS, grid );
+}
+
+int main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+
+    try
+    {
+        const Int m = Input("--m","height of the first block row",30);
+        const Int n = Input("--n","height of the second block row",20);
+        const Int k = Input("--k","width of the last block column",10);
+        const Int numRHS = Input("--numRHS","number of columns of X",3);
+        ProcessInput();
+
+        const Grid grid( mpi::COMM_WORLD );
+        TestComposite<float>( m, n, k, numRHS, grid );
+        TestComposite<double>( m, n, k, numRHS, grid );
+        TestComposite<Complex<double>>( m, n, k, numRHS, grid );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -165,6 +165,26 @@ void TestGemm
             ( orientA, orientB, alpha, A, B, beta, COrig, C, print );
         PopIndent();
     }
+
+    // Test the replicated-depth variant of Gemm
+    C = COrig;
+    OutputFromRoot(g.Comm(),"2.5D Algorithm:");
+    PushIndent();
+    mpi::Barrier( g.Comm() );
+    timer.Start();
+    Gemm( orientA, orientB, alpha, A, B, beta, C, GEMM_25D );
+    mpi::Barrier( g.Comm() );
+    runTime = timer.Stop();
+    realGFlops = 2.*double(m)*double(n)*double(k)/(1.e9*runTime);
+    gFlops = ( IsComplex<T>::value ? 4*realGFlops : realGFlops );
+    OutputFromRoot
+    (g.Comm(),"Finished in ",runTime," seconds (",gFlops," GFlop/s)");
+    if( print )
+        Print( C, BuildString("C := ",alpha," A B + ",beta," C") );
+    if( correctness )
+        TestAssociativity
+        ( orientA, orientB, alpha, A, B, beta, COrig, C, print );
+    PopIndent();
     PopIndent();
 }
 
@@ -192,6 +212,8 @@ main( int argc, char* argv[] )
         const Int rowAlignA = Input("--rowAlignA","row align of A",0);
         const Int rowAlignB = Input("--rowAlignB","row align of B",0);
         const Int rowAlignC = Input("--rowAlignC","row align of C",0);
+        const Int numLayers = Input("--numLayers","number of 2.5D layers",0);
+        const bool profile = Input("--profile","write profiling reports?",false);
         ProcessInput();
         PrintInputReport();
 
@@ -202,6 +224,12 @@ main( int argc, char* argv[] )
         const Orientation orientA = CharToOrientation( transA );
         const Orientation orientB = CharToOrientation( transB );
         SetBlocksize( nb );
+        SetGemm25DNumLayers( numLayers );
+        if( profile )
+        {
+            SetProfilePrefix( "GemmProfile" );
+            EnableProfiling();
+        }
 
         ComplainIfDebug();
         OutputFromRoot(comm,"Will test Gemm",transA,transB);
@@ -0,0 +1,234 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// Check the sparse-sparse products C := alpha op(A) B and C := A D op(A) by
+// applying them to a random multivector X and comparing against successive
+// sparse-dense Multiply calls, e.g., alpha op(A) (B X). The 'onlyLower'
+// variant of the A D op(A) product must match the lower triangle of the
+// full product.
+
+template<typename T>
+void SparseUniform( SparseMatrix<T>& A, Int m, Int n )
+{
+    Zeros( A, m, n );
+    A.Reserve( 3*m );
+    for( Int i=0; i<m; ++i )
+    {
+        A.QueueUpdate( i, i % n, SampleUniform<T>() );
+        A.QueueUpdate( i, (3*i+1) % n, SampleUniform<T>() );
+        A.QueueUpdate( i, (7*i+5) % n, SampleUniform<T>() );
+    }
+    A.ProcessQueues();
+}
+
+template<typename T>
+void SparseUniform( DistSparseMatrix<T>& A, Int m, Int n )
+{
+    Zeros( A, m, n );
+    const Int localHeight = A.LocalHeight();
+    A.Reserve( 3*localHeight );
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+    {
+        const Int i = A.GlobalRow(iLoc);
+        A.QueueLocalUpdate( iLoc, i % n, SampleUniform<T>() );
+        A.QueueLocalUpdate( iLoc, (3*i+1) % n, SampleUniform<T>() );
+        A.QueueLocalUpdate( iLoc, (7*i+5) % n, SampleUniform<T>() );
+    }
+    A.ProcessLocalQueues();
+}
+
+template<typename T,class MultiVecType>
+Base<T> RelativeDifference( const MultiVecType& Y, const MultiVecType& YRef )
+{
+    MultiVecType E( YRef );
+    Axpy( T(-1), Y, E );
+    return FrobeniusNorm( E ) / Max( FrobeniusNorm(YRef), Base<T>(1) );
+}
+
+template<typename T>
+void TestSequential( Int m, Int k, Int n, Int numRHS, bool conjugate )
+{
+    typedef Base<T> Real;
+    const Real tol = 10*(m+k+n)*limits::Epsilon<Real>();
+    const T alpha = T(3);
+
+    SparseMatrix<T> B;
+    SparseUniform( B, k, n );
+    Matrix<T> X;
+    Uniform( X, n, numRHS );
+    Matrix<T> BX;
+    Zeros( BX, k, numRHS );
+    Multiply( NORMAL, T(1), B, X, T(0), BX );
+    for( auto orientation : {NORMAL,TRANSPOSE,ADJOINT} )
+    {
+        SparseMatrix<T> A, C;
+        if( orientation == NORMAL )
+            SparseUniform( A, m, k );
+        else
+            SparseUniform( A, k, m );
+        SparseMultiply( orientation, alpha, A, B, C );
+
+        Matrix<T> Y, YRef;
+        Zeros( Y, m, numRHS );
+        Zeros( YRef, m, numRHS );
+        Multiply( NORMAL, T(1), C, X, T(0), Y );
+        Multiply( orientation, alpha, A, BX, T(0), YRef );
+        const Real diff = RelativeDifference<T>( Y, YRef );
+        Output
+        ("  sequential ",OrientationToChar(orientation),
+         ": || C X - alpha op(A) (B X) ||_F / || alpha op(A) (B X) ||_F = ",
+         diff);
+        if( diff > tol )
+            LogicError("SparseMultiply disagreed with Multiply");
+    }
+
+    // C := A diag(d) op(A)
+    // ====================
+    SparseMatrix<T> A, C, CLower;
+    SparseUniform( A, m, k );
+    Matrix<T> d;
+    Uniform( d, k, 1 );
+    ADAT( A, d, C, conjugate );
+    ADAT( A, d, CLower, conjugate, true );
+    const Orientation orientation = ( conjugate ? ADJOINT : TRANSPOSE );
+
+    Matrix<T> Z, dZ, Y, YRef;
+    Uniform( Z, m, numRHS );
+    Zeros( dZ, k, numRHS );
+    Zeros( Y, m, numRHS );
+    Zeros( YRef, m, numRHS );
+    Multiply( orientation, T(1), A, Z, T(0), dZ );
+    DiagonalScale( LEFT, NORMAL, d, dZ );
+    Multiply( NORMAL, T(1), A, dZ, T(0), YRef );
+    Multiply( NORMAL, T(1), C, Z, T(0), Y );
+    const Real diff = RelativeDifference<T>( Y, YRef );
+
+    Matrix<T> CDense, CLowerDense;
+    Copy( C, CDense );
+    Copy( CLower, CLowerDense );
+    MakeTrapezoidal( LOWER, CDense );
+    const Real lowerDiff = RelativeDifference<T>( CLowerDense, CDense );
+    Output
+    ("  sequential A D ",OrientationToChar(orientation),
+     "(A): relative difference = ",diff,
+     ", lower triangle difference = ",lowerDiff);
+    if( diff > tol )
+        LogicError("ADAT disagreed with Multiply");
+    if( lowerDiff > tol )
+        LogicError("ADAT with onlyLower disagreed with the full product");
+}
+
+template<typename T>
+void TestDistributed
+( Int m, Int k, Int n, Int numRHS, bool conjugate, const Grid& grid )
+{
+    typedef Base<T> Real;
+    const Real tol = 10*(m+k+n)*limits::Epsilon<Real>();
+    const T alpha = T(3);
+
+    DistSparseMatrix<T> B(grid);
+    SparseUniform( B, k, n );
+    DistMultiVec<T> X(grid), BX(grid);
+    Uniform( X, n, numRHS );
+    Zeros( BX, k, numRHS );
+    Multiply( NORMAL, T(1), B, X, T(0), BX );
+    for( auto orientation : {NORMAL,TRANSPOSE,ADJOINT} )
+    {
+        DistSparseMatrix<T> A(grid), C(grid);
+        if( orientation == NORMAL )
+            SparseUniform( A, m, k );
+        else
+            SparseUniform( A, k, m );
+        SparseMultiply( orientation, alpha, A, B, C );
+
+        DistMultiVec<T> Y(grid), YRef(grid);
+        Zeros( Y, m, numRHS );
+        Zeros( YRef, m, numRHS );
+        Multiply( NORMAL, T(1), C, X, T(0), Y );
+        Multiply( orientation, alpha, A, BX, T(0), YRef );
+        const Real diff = RelativeDifference<T>( Y, YRef );
+        OutputFromRoot
+        (grid.Comm(),"  distributed ",OrientationToChar(orientation),
+         ": || C X - alpha op(A) (B X) ||_F / || alpha op(A) (B X) ||_F = ",
+         diff);
+        if( diff > tol )
+            LogicError("Distributed SparseMultiply disagreed with Multiply");
+    }
+
+    // C := A diag(d) op(A)
+    // ====================
+    DistSparseMatrix<T> A(grid), C(grid), CLower(grid);
+    SparseUniform( A, m, k );
+    DistMultiVec<T> d(grid);
+    Uniform( d, k, 1 );
+    ADAT( A, d, C, conjugate );
+    ADAT( A, d, CLower, conjugate, true );
+    const Orientation orientation = ( conjugate ? ADJOINT : TRANSPOSE );
+
+    DistMultiVec<T> Z(grid), dZ(grid), Y(grid), YRef(grid);
+    Uniform( Z, m, numRHS );
+    Zeros( dZ, k, numRHS );
+    Zeros( Y, m, numRHS );
+    Zeros( YRef, m, numRHS );
+    Multiply( orientation, T(1), A, Z, T(0), dZ );
+    DiagonalScale( LEFT, NORMAL, d, dZ );
+    Multiply( NORMAL, T(1), A, dZ, T(0), YRef );
+    Multiply( NORMAL, T(1), C, Z, T(0), Y );
+    const Real diff = RelativeDifference<T>( Y, YRef );
+
+    DistMatrix<T> CDense(grid), CLowerDense(grid);
+    Copy( C, CDense );
+    Copy( CLower, CLowerDense );
+    MakeTrapezoidal( LOWER, CDense );
+    const Real lowerDiff = RelativeDifference<T>( CLowerDense, CDense );
+    OutputFromRoot
+    (grid.Comm(),"  distributed A D ",OrientationToChar(orientation),
+     "(A): relative difference = ",diff,
+     ", lower triangle difference = ",lowerDiff);
+    if( diff > tol )
+        LogicError("Distributed ADAT disagreed with Multiply");
+    if( lowerDiff > tol )
+        LogicError
+        ("Distributed ADAT with onlyLower disagreed with the full product");
+}
+
+template<typename T>
+void TestSparseMultiply
+( Int m, Int k, Int n, Int numRHS, bool conjugate, const Grid& grid )
+{
+    OutputFromRoot(grid.Comm(),"Testing with ",TypeName<T>());
+    if( grid.Rank() == 0 )
+        TestSequential<T>( m, k, n, numRHS, conjugate );
+    TestDistributed<T>( m, k, n, numRHS, conjugate, grid );
+}
+
+int main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+
+    try
+    {
+        const Int m = Input("--m","height of op(A)",60);
+        const Int k = Input("--k","width of op(A)",40);
+        const Int n = Input("--n","width of B",50);
+        const Int numRHS = Input("--numRHS","number of columns of X",3);
+        ProcessInput();
+
+        const Grid grid( mpi::COMM_WORLD );
+        TestSparseMultiply<float>( m, k, n, numRHS, false, grid );
+        TestSparseMultiply<double>( m, k, n, numRHS, false, grid );
+        TestSparseMultiply<Complex<double>>( m, k, n, numRHS, false, grid );
+        TestSparseMultiply<Complex<double>>( m, k, n, numRHS, true, grid );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
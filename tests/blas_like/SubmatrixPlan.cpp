@@ -0,0 +1,128 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// Check the extractions and updates of SubmatrixPlan against GetSubmatrix
+// and UpdateSubmatrix for non-contiguous (and partially repeated) indices.
+
+// Every third index in reverse order, followed by a repeat of the first
+vector<Int> Indices( Int n, Int offset, bool repeat )
+{
+    vector<Int> I;
+    for( Int i=n-1-offset; i>=0; i-=3 )
+        I.push_back( i );
+    if( repeat )
+        I.push_back( I[0] );
+    return I;
+}
+
+template<typename T>
+Base<T> MaxDifference
+( const AbstractDistMatrix<T>& A, const AbstractDistMatrix<T>& B )
+{
+    DistMatrix<T> E( A );
+    E -= B;
+    return MaxNorm( E );
+}
+
+template<typename T>
+void TestSubmatrixPlan( Int m, Int n, const Grid& grid )
+{
+    typedef Base<T> Real;
+    OutputFromRoot(grid.Comm(),"Testing with ",TypeName<T>());
+    const Real eps = limits::Epsilon<Real>();
+
+    DistMatrix<T> A(grid);
+    Uniform( A, m, n );
+    const vector<Int> I = Indices( m, 0, true ), J = Indices( n, 1, true );
+
+    // A single [MC,MR] submatrix
+    // ==========================
+    {
+        DistMatrix<T> ASub(grid), ASubPlan(grid);
+        GetSubmatrix( A, I, J, ASub );
+        SubmatrixPlan plan( A, I, J, ASubPlan );
+        plan.Get( A, ASubPlan );
+        const Real getDiff = MaxDifference( ASub, ASubPlan );
+
+        // Since the indices repeat, the updates accumulate in an
+        // unspecified order
+        const T alpha = T(-2);
+        DistMatrix<T> B(A), BPlan(A);
+        UpdateSubmatrix( B, I, J, alpha, ASub );
+        plan.Update( BPlan, alpha, ASubPlan );
+        const Real updateDiff = MaxDifference( B, BPlan );
+        OutputFromRoot
+        (grid.Comm(),"  [MC,MR]: Get difference = ",getDiff,
+         ", Update difference = ",updateDiff);
+        if( getDiff != Real(0) )
+            LogicError("SubmatrixPlan::Get disagreed with GetSubmatrix");
+        if( updateDiff > 10*eps*MaxNorm(A) )
+            LogicError
+            ("SubmatrixPlan::Update disagreed with UpdateSubmatrix");
+    }
+
+    // Two [VC,STAR] submatrices exchanged at once
+    // ===========================================
+    {
+        const vector<Int> I1 = Indices( m, 2, false ),
+                          J1 = Indices( n, 0, false );
+        DistMatrix<T,VC,STAR> ASub0(grid), ASub1(grid),
+          ASubPlan0(grid), ASubPlan1(grid);
+        GetSubmatrix( A, I, J, ASub0 );
+        GetSubmatrix( A, I1, J1, ASub1 );
+        SubmatrixPlan plan
+        ( A, {I,I1}, {J,J1},
+          vector<const AbstractDistMatrix<T>*>({&ASubPlan0,&ASubPlan1}) );
+        plan.Get
+        ( A, vector<AbstractDistMatrix<T>*>({&ASubPlan0,&ASubPlan1}) );
+        const Real getDiff =
+          Max( MaxDifference(ASub0,ASubPlan0),
+               MaxDifference(ASub1,ASubPlan1) );
+
+        // The rows of the two submatrices are disjoint, so setting A(I,J)
+        // to its own (consistently repeated) entries and A(I1,J1) to three
+        // times its entries is equivalent to adding twice A(I1,J1)
+        ASubPlan1 *= T(3);
+        DistMatrix<T> B(A), BPlan(A);
+        UpdateSubmatrix( B, I1, J1, T(2), ASub1 );
+        plan.Set
+        ( BPlan,
+          vector<const AbstractDistMatrix<T>*>({&ASubPlan0,&ASubPlan1}) );
+        const Real setDiff = MaxDifference( B, BPlan );
+        OutputFromRoot
+        (grid.Comm(),"  [VC,STAR]: Get difference = ",getDiff,
+         ", Set difference = ",setDiff);
+        if( getDiff != Real(0) )
+            LogicError("SubmatrixPlan::Get disagreed with GetSubmatrix");
+        if( setDiff > 10*eps*MaxNorm(A) )
+            LogicError("SubmatrixPlan::Set disagreed with UpdateSubmatrix");
+    }
+}
+
+int main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+
+    try
+    {
+        const Int m = Input("--m","height of A",50);
+        const Int n = Input("--n","width of A",40);
+        ProcessInput();
+
+        const Grid grid( mpi::COMM_WORLD );
+        TestSubmatrixPlan<float>( m, n, grid );
+        TestSubmatrixPlan<double>( m, n, grid );
+        TestSubmatrixPlan<Complex<double>>( m, n, grid );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -35,6 +35,7 @@ void TestSymv
         Print( x, "x" );
         Print( y, "y" );
     }
+    auto yOrig = y;
 
     // Test Symv
     OutputFromRoot(g.Comm(),"Starting Symv");
@@ -51,6 +52,27 @@ void TestSymv
     if( print )
         Print( y, BuildString("y := ",alpha," Symm(A) x + ",beta," y") );
 
+    // Test the fused local kernel against the default one
+    OutputFromRoot(g.Comm(),"Starting Symv with the fused local kernel");
+    SymvCtrl<T> ctrl;
+    ctrl.fusedLocalKernel = true;
+    auto yFused = yOrig;
+    mpi::Barrier( g.Comm() );
+    timer.Start();
+    Symv( uplo, alpha, A, x, beta, yFused, false, ctrl );
+    mpi::Barrier( g.Comm() );
+    const double fusedTime = timer.Stop();
+    const double fusedRealGFlops = 2.*double(m)*double(m)/(1.e9*fusedTime);
+    const double fusedGFlops =
+      ( IsComplex<T>::value ? 4*fusedRealGFlops : fusedRealGFlops );
+    OutputFromRoot
+    (g.Comm(),"Finished in ",fusedTime," seconds (",fusedGFlops," GFlop/s");
+    yFused -= y;
+    const Base<T> yFrobNorm = FrobeniusNorm( y );
+    const Base<T> diffFrobNorm = FrobeniusNorm( yFused );
+    OutputFromRoot
+    (g.Comm(),"|| yFused - y ||_F / || y ||_F = ",diffFrobNorm/yFrobNorm);
+
     PopIndent();
 }
 
@@ -131,33 +131,41 @@ void TestSyrk
         Print( C, "C" );
     }
 
-    if( g.Rank() == 0 )
-        Output("  Starting Syrk");
-    mpi::Barrier( g.Comm() );
-    Timer timer;
-    timer.Start();
-    Syrk( uplo, orientation, alpha, A, beta, C, conjugate );
-    mpi::Barrier( g.Comm() );
-    const double runTime = timer.Stop();
-    const double realGFlops = double(m)*double(m)*double(k)/(1.e9*runTime);
-    const double gFlops = ( IsComplex<T>::value ? 4*realGFlops : realGFlops );
-    OutputFromRoot
-    (g.Comm(),"Finished in ",runTime," seconds (",gFlops," GFlop/s)");
-    if( print )
+    const SyrkAlgorithm algs[] = { SYRK_DEFAULT, SYRK_TRIANGLE, SYRK_25D };
+    const char* algNames[] = { "Default", "Triangle", "2.5D" };
+    for( Int alg=0; alg<3; ++alg )
     {
-        if( orientation == NORMAL )
-            Print( C, BuildString("C := ",alpha," A A' + ",beta," C") );
-        else
-            Print( C, BuildString("C := ",alpha," A' A + ",beta," C") );
-    }
+        OutputFromRoot(g.Comm(),algNames[alg]," algorithm:");
+        PushIndent();
+        C = COrig;
+        mpi::Barrier( g.Comm() );
+        Timer timer;
+        timer.Start();
+        Syrk( uplo, orientation, alpha, A, beta, C, conjugate, algs[alg] );
+        mpi::Barrier( g.Comm() );
+        const double runTime = timer.Stop();
+        const double realGFlops =
+          double(m)*double(m)*double(k)/(1.e9*runTime);
+        const double gFlops =
+          ( IsComplex<T>::value ? 4*realGFlops : realGFlops );
+        OutputFromRoot
+        (g.Comm(),"Finished in ",runTime," seconds (",gFlops," GFlop/s)");
+        if( print )
+        {
+            if( orientation == NORMAL )
+                Print( C, BuildString("C := ",alpha," A A' + ",beta," C") );
+            else
+                Print( C, BuildString("C := ",alpha," A' A + ",beta," C") );
+        }
 
-    if( correctness )
-    {
-        MakeSymmetric( uplo, C, conjugate );
-        TestAssociativity
-        ( conjugate, uplo, orientation, alpha, A, beta, COrig, C, print );
+        if( correctness )
+        {
+            MakeSymmetric( uplo, C, conjugate );
+            TestAssociativity
+            ( conjugate, uplo, orientation, alpha, A, beta, COrig, C, print );
+        }
+        PopIndent();
     }
-
     PopIndent();
 }
 
@@ -48,6 +48,18 @@ main( int argc, char* argv[] )
         A = AElem;
         if( print )
             Print( A, "A" );
+
+        // Realigning a block matrix should only shift its local data
+        DistMatrix<Complex<double>,MC,MR,BLOCK> AShift(g);
+        AShift.AlignCols( mb, Mod(A.ColAlign()+1,g.Height()), A.ColCut() );
+        AShift.AlignRows( nb, Mod(A.RowAlign()+1,g.Width()), A.RowCut() );
+        AShift = A;
+        DistMatrix<Complex<double>> AShiftElem( AShift );
+        AShiftElem -= AElem;
+        const double shiftError = FrobeniusNorm( AShiftElem );
+        OutputFromRoot(comm,"|| realign(A) - A ||_F = ",shiftError);
+        if( shiftError != 0. )
+            LogicError("Realigning the block matrix was not exact");
 #ifdef EL_HAVE_SCALAPACK
         // NOTE: There appears to be a bug in the parallel eigenvalue
         //       reordering in ScaLAPACK's P{S,D}HSEQR (within P{S,D}TRORD).
@@ -0,0 +1,165 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// Check that the Bruck, pairwise, recursive-doubling, and recursive-halving
+// collectives exactly reproduce the results of the native MPI collectives
+// over the communicators formed by the first q processes, for every q, so
+// that both powers of two and other sizes are covered.
+
+bool IsPowerOfTwo( int n ) { return n > 0 && (n & (n-1)) == 0; }
+
+// Entry i of the buffer of process 'rank'
+Int TestEntry( int rank, Int i ) { return 1000*Int(rank) + i + 1; }
+
+void CheckEqual
+( const vector<Int>& result, const vector<Int>& native,
+  const string& label, int commSize, int count )
+{
+    if( result != native )
+        RuntimeError
+        (label," disagreed with the native collective over ",commSize,
+         " processes with ",count," entries per process");
+}
+
+void TestCollectives( mpi::Comm comm, const vector<int>& counts )
+{
+    const int commRank = mpi::Rank( comm );
+    const int commSize = mpi::Size( comm );
+    const bool powerOfTwo = IsPowerOfTwo( commSize );
+    for( const int count : counts )
+    {
+        const int numBytes = count*sizeof(Int);
+
+        // AllGather
+        // =========
+        {
+            vector<Int> sendBuf(count), native(commSize*count),
+              result(commSize*count);
+            for( Int i=0; i<count; ++i )
+                sendBuf[i] = TestEntry( commRank, i );
+            mpi::AllGather
+            ( sendBuf.data(), count, native.data(), count, comm );
+
+            mpi::BruckAllGather
+            ( reinterpret_cast<const byte*>(sendBuf.data()),
+              reinterpret_cast<byte*>(result.data()), numBytes, comm );
+            CheckEqual( result, native, "BruckAllGather", commSize, count );
+
+            if( powerOfTwo )
+            {
+                std::fill( result.begin(), result.end(), Int(0) );
+                mpi::RecursiveDoublingAllGather
+                ( reinterpret_cast<const byte*>(sendBuf.data()),
+                  reinterpret_cast<byte*>(result.data()), numBytes, comm );
+                CheckEqual
+                ( result, native, "RecursiveDoublingAllGather",
+                  commSize, count );
+            }
+
+            std::fill( result.begin(), result.end(), Int(0) );
+            mpi::SelectedAllGather
+            ( sendBuf.data(), result.data(), count, comm );
+            CheckEqual( result, native, "SelectedAllGather", commSize, count );
+        }
+
+        // AllToAll
+        // ========
+        {
+            vector<Int> sendBuf(commSize*count), native(commSize*count),
+              result(commSize*count);
+            for( Int i=0; i<commSize*count; ++i )
+                sendBuf[i] = TestEntry( commRank, i );
+            mpi::AllToAll
+            ( sendBuf.data(), count, native.data(), count, comm );
+
+            mpi::PairwiseAllToAll
+            ( reinterpret_cast<const byte*>(sendBuf.data()),
+              reinterpret_cast<byte*>(result.data()), numBytes, comm );
+            CheckEqual( result, native, "PairwiseAllToAll", commSize, count );
+
+            std::fill( result.begin(), result.end(), Int(0) );
+            mpi::BruckAllToAll
+            ( reinterpret_cast<const byte*>(sendBuf.data()),
+              reinterpret_cast<byte*>(result.data()), numBytes, comm );
+            CheckEqual( result, native, "BruckAllToAll", commSize, count );
+
+            std::fill( result.begin(), result.end(), Int(0) );
+            mpi::SelectedAllToAll
+            ( sendBuf.data(), result.data(), count, comm );
+            CheckEqual( result, native, "SelectedAllToAll", commSize, count );
+        }
+
+        // ReduceScatter
+        // =============
+        // (the integer sums are exact for any order of summation)
+        {
+            vector<Int> sendBuf(commSize*count), native(count), result(count);
+            for( Int i=0; i<commSize*count; ++i )
+                sendBuf[i] = TestEntry( commRank, i );
+            vector<Int> sendCopy( sendBuf );
+            mpi::ReduceScatter
+            ( sendCopy.data(), native.data(), count, comm );
+
+            if( powerOfTwo )
+            {
+                mpi::RecursiveHalvingReduceScatter
+                ( sendBuf.data(), result.data(), count, comm );
+                CheckEqual
+                ( result, native, "RecursiveHalvingReduceScatter",
+                  commSize, count );
+            }
+
+            std::fill( result.begin(), result.end(), Int(0) );
+            sendCopy = sendBuf;
+            mpi::SelectedReduceScatter
+            ( sendCopy.data(), result.data(), count, comm );
+            CheckEqual
+            ( result, native, "SelectedReduceScatter", commSize, count );
+        }
+    }
+}
+
+int main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const int commRank = mpi::Rank( comm );
+    const int commSize = mpi::Size( comm );
+
+    try
+    {
+        const int maxCount =
+          Input("--maxCount","maximum number of entries per process",4096);
+        ProcessInput();
+
+        // Cover single entries, odd counts, and the (default) crossovers
+        // between the algorithms
+        vector<int> counts;
+        for( int count=1; count<=maxCount; count*=8 )
+        {
+            counts.push_back( count );
+            counts.push_back( count+3 );
+        }
+
+        for( int q=1; q<=commSize; ++q )
+        {
+            mpi::Comm subComm;
+            mpi::Split( comm, ( commRank < q ? 0 : 1 ), commRank, subComm );
+            if( commRank < q )
+                TestCollectives( subComm, counts );
+            mpi::Free( subComm );
+            OutputFromRoot(comm,"Passed with ",q," processes");
+        }
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -192,13 +192,18 @@ main( int argc, char* argv[] )
         const Int m = Input("--height","height of matrix",50);
         const Int n = Input("--width","width of matrix",50);
         const bool print = Input("--print","print wrong matrices?",false);
+        const bool nodeAware =
+          Input("--nodeAware","group the processes by node?",false);
         ProcessInput();
         PrintInputReport();
 
         if( gridHeight == 0 )
             gridHeight = Grid::DefaultHeight( mpi::Size(comm) );
         const GridOrder order = colMajor ? COLUMN_MAJOR : ROW_MAJOR;
-        const Grid grid( comm, gridHeight, order );
+        unique_ptr<Grid> gridPtr
+        ( nodeAware ? new Grid( comm, NODE_AWARE_GRID, order )
+                    : new Grid( comm, gridHeight, order ) );
+        const Grid& grid = *gridPtr;
 
         DistMatrixTest<Int>( m, n, grid, print );
 
@@ -0,0 +1,85 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+using namespace El;
+
+template<typename T>
+void TestAlignment( Int m, Int n, size_t alignment )
+{
+    Output("Testing alignment of ",TypeName<T>());
+    Matrix<T> A;
+    Uniform( A, m, n );
+    const size_t address = reinterpret_cast<size_t>(A.LockedBuffer());
+    if( address % alignment != 0 )
+        LogicError("Buffer was not aligned to ",alignment," bytes");
+}
+
+template<typename T>
+void TestRecycling( Int m, Int n, Int numRepeats )
+{
+    Output("Testing recycling of ",TypeName<T>());
+    PushIndent();
+    ResetMemoryStats();
+    const size_t liveBytes = GetMemoryStats().liveBytes;
+    for( Int repeat=0; repeat<numRepeats; ++repeat )
+    {
+        Matrix<T> A;
+        Uniform( A, m, n );
+        Matrix<T> B( A );
+    }
+    const MemoryStats stats = GetMemoryStats();
+    Output("allocated: ",stats.allocatedBytes," bytes in ",
+           stats.numAllocations," buffers");
+    Output("recycled:  ",stats.recycledBytes," bytes in ",
+           stats.numRecycles," buffers");
+    Output("pooled:    ",stats.pooledBytes," bytes");
+    Output("peak:      ",stats.peakBytes-liveBytes," bytes");
+    if( stats.liveBytes != liveBytes )
+        LogicError("Live bytes were not restored");
+    if( stats.peakBytes < liveBytes + 2*m*n*sizeof(T) )
+        LogicError("Peak bytes did not include both matrices");
+    if( numRepeats > 1 && stats.numRecycles == 0 )
+        LogicError("No buffers were recycled");
+    PopIndent();
+}
+
+int main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+
+    try
+    {
+        const Int m = Input("--m","height of matrices",100);
+        const Int n = Input("--n","width of matrices",100);
+        const Int numRepeats = Input("--numRepeats","number of repeats",5);
+        const Int alignment = Input("--alignment","byte alignment",64);
+        ProcessInput();
+        PrintInputReport();
+
+        MemoryCtrl ctrl;
+        ctrl.alignment = alignment;
+        ctrl.pool = true;
+        SetMemoryCtrl( ctrl );
+
+        TestAlignment<float>( m, n, alignment );
+        TestAlignment<Complex<double>>( m, n, alignment );
+        TestRecycling<double>( m, n, numRepeats );
+        TestRecycling<Complex<float>>( m, n, numRepeats );
+#ifdef EL_HAVE_MPC
+        TestRecycling<BigFloat>( m, n, numRepeats );
+#endif
+
+        PurgeMemoryPool();
+        if( GetMemoryStats().pooledBytes != 0 )
+            LogicError("Pool was not empty after being purged");
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
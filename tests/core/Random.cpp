@@ -0,0 +1,75 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+using namespace El;
+
+// Ensure that the counter-based fills are independent of the distribution
+// and the process grid
+template<typename F>
+void TestReproducibility( Int m, Int n, bool gaussian )
+{
+    Output("Testing ",(gaussian?"Gaussian":"Uniform")," of ",TypeName<F>());
+    const Int commSize = mpi::Size( mpi::COMM_WORLD );
+    const Grid gridA( mpi::COMM_WORLD );
+    const Grid gridB( mpi::COMM_WORLD, commSize );
+
+    InitializeRandom();
+    DistMatrix<F> A(gridA);
+    if( gaussian )
+        Gaussian( A, m, n );
+    else
+        Uniform( A, m, n );
+
+    InitializeRandom();
+    DistMatrix<F,VC,STAR> B(gridB);
+    if( gaussian )
+        Gaussian( B, m, n );
+    else
+        Uniform( B, m, n );
+
+    InitializeRandom();
+    DistMatrix<F,STAR,STAR> D(gridA);
+    if( gaussian )
+        Gaussian( D, m, n );
+    else
+        Uniform( D, m, n );
+
+    DistMatrix<F,STAR,STAR> A_STAR_STAR( A ), B_STAR_STAR( B );
+    for( Int j=0; j<n; ++j )
+    {
+        for( Int i=0; i<m; ++i )
+        {
+            const F alpha = A_STAR_STAR.GetLocal(i,j);
+            if( alpha != B_STAR_STAR.GetLocal(i,j) ||
+                alpha != D.GetLocal(i,j) )
+                LogicError("Entry (",i,",",j,") depends upon the grid");
+        }
+    }
+}
+
+int main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+
+    try
+    {
+        const Int m = Input("--m","height of matrices",100);
+        const Int n = Input("--n","width of matrices",50);
+        ProcessInput();
+        PrintInputReport();
+
+        TestReproducibility<float>( m, n, false );
+        TestReproducibility<Complex<double>>( m, n, false );
+        TestReproducibility<double>( m, n, true );
+        TestReproducibility<Complex<float>>( m, n, true );
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -0,0 +1,206 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// Compare the band Cholesky and LU factorizations, and the distributed SPIKE
+// solves, against dense solves of the same (diagonally dominant) systems.
+// The entries are formulaic so that every process forms the same matrices.
+
+template<typename Field>
+Field OffDiagonal( Int i, Int j )
+{
+    typedef Base<Field> Real;
+    Field value = Real(1) / Real(i+2*j+1);
+    if( IsComplex<Field>::value )
+        UpdateImagPart( value, Real(1) / Real(2*i+j+1) );
+    return value;
+}
+
+template<typename Field>
+void BandTestMatrix
+( Int n, Int lower, Int upper, bool hermitian, Matrix<Field>& A )
+{
+    typedef Base<Field> Real;
+    Zeros( A, n, n );
+    for( Int j=0; j<n; ++j )
+    {
+        for( Int i=Max(j-upper,Int(0)); i<Min(j+lower+1,n); ++i )
+        {
+            if( i == j )
+                A(i,j) = Real(2*(lower+upper+1));
+            else if( !hermitian )
+                A(i,j) = OffDiagonal<Field>( i, j );
+            else if( i > j )
+                A(i,j) = OffDiagonal<Field>( i, j );
+            else
+                A(i,j) = Conj( OffDiagonal<Field>( j, i ) );
+        }
+    }
+}
+
+template<typename Field>
+void RightHandSides( Int n, Int width, Matrix<Field>& B )
+{
+    typedef Base<Field> Real;
+    B.Resize( n, width );
+    for( Int j=0; j<width; ++j )
+        for( Int i=0; i<n; ++i )
+            B(i,j) = Real(i+j+1) / Real(n);
+}
+
+template<typename Field>
+Base<Field> RelativeDifference
+( const Matrix<Field>& X, const Matrix<Field>& XDense )
+{
+    Matrix<Field> E( X );
+    E -= XDense;
+    return FrobeniusNorm( E ) / FrobeniusNorm( XDense );
+}
+
+template<typename Field>
+void TestSequential( Int n, Int lower, Int upper, Int width )
+{
+    typedef Base<Field> Real;
+    const Real tol = 100*n*limits::Epsilon<Real>();
+    Matrix<Field> ADense, B;
+    RightHandSides( n, width, B );
+
+    // Banded LU with partial pivoting
+    BandTestMatrix( n, lower, upper, false, ADense );
+    BandMatrix<Field> A( n, n, lower, upper );
+    for( Int j=0; j<n; ++j )
+        for( Int i=Max(j-upper,Int(0)); i<Min(j+lower+1,n); ++i )
+            A.Set( i, j, ADense(i,j) );
+    Matrix<Field> XDense( B );
+    LinearSolve( ADense, XDense );
+
+    Matrix<Field> X( B );
+    Matrix<Int> pivots;
+    LU( A, pivots );
+    lu::SolveAfter( NORMAL, A, pivots, X );
+    const Real luDiff = RelativeDifference( X, XDense );
+    Output("  band LU:       || X - XDense ||_F / || XDense ||_F = ",luDiff);
+    if( luDiff > tol )
+        LogicError("Band LU solve disagreed with the dense solve");
+
+    // Banded Cholesky (of the lower triangle)
+    BandTestMatrix( n, lower, lower, true, ADense );
+    A.Resize( n, n, lower, 0 );
+    for( Int j=0; j<n; ++j )
+        for( Int i=j; i<Min(j+lower+1,n); ++i )
+            A.Set( i, j, ADense(i,j) );
+    XDense = B;
+    HPDSolve( LOWER, NORMAL, ADense, XDense );
+
+    X = B;
+    Cholesky( LOWER, A );
+    cholesky::SolveAfter( LOWER, NORMAL, A, X );
+    const Real cholDiff = RelativeDifference( X, XDense );
+    Output("  band Cholesky: || X - XDense ||_F / || XDense ||_F = ",cholDiff);
+    if( cholDiff > tol )
+        LogicError("Band Cholesky solve disagreed with the dense solve");
+}
+
+template<typename Field>
+void TestDistributed
+( Int n, Int lower, Int upper, Int width, const Grid& grid )
+{
+    typedef Base<Field> Real;
+    const Real tol = 100*n*limits::Epsilon<Real>();
+    Matrix<Field> ADense, B;
+    RightHandSides( n, width, B );
+
+    DistBandMatrix<Field> A( n, lower, upper, grid );
+    DistMultiVec<Field> X( n, width, grid );
+    auto fill = [&]( const Matrix<Field>& AFull )
+      {
+          A.Resize( n, lower, upper );
+          for( Int iLoc=0; iLoc<A.LocalHeight(); ++iLoc )
+          {
+              const Int i = A.GlobalRow( iLoc );
+              for( Int j=Max(i-lower,Int(0)); j<Min(i+upper+1,n); ++j )
+                  A.SetLocal( iLoc, j, AFull(i,j) );
+              for( Int j=0; j<width; ++j )
+                  X.SetLocal( iLoc, j, B(i,j) );
+          }
+      };
+    auto compare = [&]( const Matrix<Field>& XDense, const string& label )
+      {
+          DistMatrix<Field,STAR,STAR> X_STAR_STAR(grid);
+          Copy( X, X_STAR_STAR );
+          const Real diff =
+            RelativeDifference( X_STAR_STAR.LockedMatrix(), XDense );
+          OutputFromRoot
+          (grid.Comm(),"  ",label,": || X - XDense ||_F / || XDense ||_F = ",
+           diff);
+          if( diff > tol )
+              LogicError(label," disagreed with the dense solve");
+      };
+
+    BandTestMatrix( n, lower, upper, false, ADense );
+    Matrix<Field> XDense( B );
+    LinearSolve( ADense, XDense );
+    fill( ADense );
+    LinearSolve( A, X );
+    compare( XDense, "SPIKE LU" );
+
+    // The distributed HPD solve requires both triangles of the band
+    upper = lower;
+    BandTestMatrix( n, lower, upper, true, ADense );
+    XDense = B;
+    HPDSolve( LOWER, NORMAL, ADense, XDense );
+    fill( ADense );
+    HPDSolve( A, X );
+    compare( XDense, "SPIKE Cholesky" );
+}
+
+template<typename Field>
+void TestBand
+( Int n, Int lower, Int upper, Int width, const Grid& grid )
+{
+    OutputFromRoot(grid.Comm(),"Testing with ",TypeName<Field>());
+    if( grid.Rank() == 0 )
+        TestSequential<Field>( n, lower, upper, width );
+
+    OutputFromRoot(grid.Comm(),"  distributed with height ",n);
+    TestDistributed<Field>( n, lower, upper, width, grid );
+
+    // Leave the last process with fewer rows than the bandwidth so that the
+    // SPIKE solves fall back to gathering the system
+    const Int nSmall = Max(Max(lower,upper)*grid.Size()-1,Int(1));
+    OutputFromRoot(grid.Comm(),"  distributed with height ",nSmall);
+    TestDistributed<Field>( nSmall, lower, upper, width, grid );
+    OutputFromRoot(grid.Comm(),"");
+}
+
+int main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int n = Input("--n","height of the band matrices",200);
+        const Int lower = Input("--lower","lower bandwidth",3);
+        const Int upper = Input("--upper","upper bandwidth",2);
+        const Int width = Input("--width","number of right-hand sides",3);
+        ProcessInput();
+
+        const Grid grid( comm );
+
+        TestBand<float>( n, lower, upper, width, grid );
+        TestBand<Complex<float>>( n, lower, upper, width, grid );
+        TestBand<double>( n, lower, upper, width, grid );
+        TestBand<Complex<double>>( n, lower, upper, width, grid );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
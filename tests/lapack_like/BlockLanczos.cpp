@@ -0,0 +1,102 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+template<typename Field>
+void TestBlockLanczos
+( Int n1,
+  Int n2,
+  Int n3,
+  Int numEigs,
+  const BlockLanczosCtrl<Base<Field>>& ctrl,
+  bool print,
+  const El::Grid& grid )
+{
+    OutputFromRoot(grid.Comm(),"Testing with ",TypeName<Field>());
+    typedef Base<Field> Real;
+    const Real eps = limits::Epsilon<Real>();
+    const Int N = n1*n2*n3;
+
+    DistSparseMatrix<Field> A(grid);
+    Laplacian( A, n1, n2, n3 );
+    const Real ANorm = FrobeniusNorm( A );
+
+    Matrix<Real> w;
+    DistMultiVec<Field> Z(grid);
+    Timer timer;
+    mpi::Barrier( grid.Comm() );
+    timer.Start();
+    BlockLanczos( A, numEigs, w, Z, ctrl );
+    mpi::Barrier( grid.Comm() );
+    timer.Stop();
+    OutputFromRoot
+    (grid.Comm(),"Found ",w.Height()," eigenpairs in ",timer.Partial(),
+     " seconds");
+    if( print )
+        Print( w, "w" );
+    if( w.Height() != numEigs )
+        LogicError("Expected ",numEigs," eigenvalues but found ",w.Height());
+
+    // || A Z - Z W ||_F / (|| A ||_F eps N)
+    DistMultiVec<Field> R(grid);
+    R = Z;
+    auto& RLoc = R.Matrix();
+    for( Int j=0; j<numEigs; ++j )
+        for( Int iLoc=0; iLoc<R.LocalHeight(); ++iLoc )
+            RLoc(iLoc,j) *= w(j);
+    Multiply( NORMAL, Field(1), A, Z, Field(-1), R );
+    const Real residual = FrobeniusNorm( R ) / (ANorm*eps*N);
+    OutputFromRoot(grid.Comm(),"|| A Z - Z W ||_F / (|| A ||_F eps N) = ",
+      residual);
+
+    // || I - Z^H Z ||_F / (eps N)
+    Matrix<Field> G;
+    Identity( G, numEigs, numEigs );
+    Gemm
+    ( ADJOINT, NORMAL, Field(-1), Z.LockedMatrix(), Z.LockedMatrix(),
+      Field(1)/Field(mpi::Size(grid.Comm())), G );
+    mpi::AllReduce( G.Buffer(), numEigs*numEigs, grid.Comm() );
+    const Real orthogError = FrobeniusNorm( G ) / (eps*N);
+    OutputFromRoot(grid.Comm(),"|| I - Z^H Z ||_F / (eps N) = ",orthogError);
+}
+
+int main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int n1 = Input("--n1","first grid dimension",10);
+        const Int n2 = Input("--n2","second grid dimension",11);
+        const Int n3 = Input("--n3","third grid dimension",12);
+        const Int numEigs = Input("--numEigs","number of eigenpairs",10);
+        const Int blockSize = Input("--blockSize","Lanczos block size",4);
+        const Int maxBasisSize =
+          Input("--maxBasisSize","maximum basis size (0 for default)",0);
+        const bool largest =
+          Input("--largest","compute the largest eigenvalues?",true);
+        const bool progress = Input("--progress","print progress?",false);
+        const bool print = Input("--print","print eigenvalues?",false);
+        ProcessInput();
+
+        BlockLanczosCtrl<double> ctrl;
+        ctrl.blockSize = blockSize;
+        ctrl.maxBasisSize = maxBasisSize;
+        ctrl.largest = largest;
+        ctrl.progress = progress;
+
+        const El::Grid grid( comm );
+        TestBlockLanczos<double>( n1, n2, n3, numEigs, ctrl, print, grid );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -216,10 +216,13 @@ void TestSuite
     HermitianEigCtrl<F> ctrl;
     ctrl.timeStages = ctrlDbl.timeStages;
     ctrl.useScaLAPACK = ctrlDbl.useScaLAPACK;
+    ctrl.pipelineBacktransform = ctrlDbl.pipelineBacktransform;
     ctrl.tridiagCtrl.symvCtrl.bsize =
       ctrlDbl.tridiagCtrl.symvCtrl.bsize;
     ctrl.tridiagCtrl.symvCtrl.avoidTrmvBasedLocalSymv =
       ctrlDbl.tridiagCtrl.symvCtrl.avoidTrmvBasedLocalSymv;
+    ctrl.tridiagCtrl.twoStage = ctrlDbl.tridiagCtrl.twoStage;
+    ctrl.tridiagCtrl.bandwidth = ctrlDbl.tridiagCtrl.bandwidth;
     ctrl.tridiagEigCtrl.sort = ctrlDbl.tridiagEigCtrl.sort;
     ctrl.tridiagEigCtrl.alg = ctrlDbl.tridiagEigCtrl.alg;
     ctrl.tridiagEigCtrl.subset = subset;
@@ -289,7 +292,13 @@ main( int argc, char* argv[] )
           Input("--avoidTrmv","avoid Trmv based Symv",true);
         const bool useScaLAPACK =
           Input("--useScaLAPACK","test ScaLAPACK?",false);
+        const bool twoStage =
+          Input("--twoStage","two-stage tridiagonalization?",false);
+        const Int bandwidth =
+          Input("--bandwidth","two-stage bandwidth (0 for nb)",0);
         const Int algInt = Input("--algInt","0: QR, 1: D&C, 2: MRRR",1);
+        const bool pipeline =
+          Input("--pipeline","pipeline the MRRR back-transformation?",false);
         const bool sequential =
           Input("--sequential","test sequential?",true);
         const bool distributed =
@@ -338,8 +347,11 @@ main( int argc, char* argv[] )
         HermitianEigCtrl<double> ctrl;
         ctrl.timeStages = timeStages;
         ctrl.useScaLAPACK = useScaLAPACK;
+        ctrl.pipelineBacktransform = pipeline;
         ctrl.tridiagCtrl.symvCtrl.bsize = nbLocal;
         ctrl.tridiagCtrl.symvCtrl.avoidTrmvBasedLocalSymv = avoidTrmv;
+        ctrl.tridiagCtrl.twoStage = twoStage;
+        ctrl.tridiagCtrl.bandwidth = bandwidth;
         ctrl.tridiagEigCtrl.sort = sort;
         ctrl.tridiagEigCtrl.alg = alg;
         ctrl.tridiagEigCtrl.subset = subset;
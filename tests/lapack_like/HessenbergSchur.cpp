@@ -305,6 +305,12 @@ int main( int argc, char* argv[] )
           Input
           ("--minMultiBulgeSize",
            "minimum size for using a multi-bulge algorithm",75);
+        const Int minDistMultiBulgeSize =
+          Input
+          ("--minDistMultiBulgeSize",
+           "minimum size for using a distributed multi-bulge algorithm",400);
+        const Int aedSubgridSize =
+          Input("--aedSubgridSize","processes for each dist. AED window",0);
         const bool accumulate =
           Input("--accumulate","accumulate reflections?",true);
         const bool sortShifts =
@@ -322,6 +328,8 @@ int main( int argc, char* argv[] )
         HessenbergSchurCtrl ctrl;
         ctrl.alg = static_cast<HessenbergSchurAlg>(algInt);
         ctrl.minMultiBulgeSize = minMultiBulgeSize;
+        ctrl.minDistMultiBulgeSize = minDistMultiBulgeSize;
+        ctrl.aedSubgridSize = aedSubgridSize;
         ctrl.accumulateReflections = accumulate;
         ctrl.sortShifts = sortShifts;
         ctrl.progress = progress;
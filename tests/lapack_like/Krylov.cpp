@@ -0,0 +1,131 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// Compare the distributed single-reduction (Chronopoulos-Gear) CG and the
+// distributed CGS2 FGMRES against the sequential CG on a 2D Laplacian.
+
+template<typename Field>
+void CheckAgainstSequential
+( const DistSparseMatrix<Field>& A,
+  const DistMultiVec<Field>& B,
+  const DistMultiVec<Field>& X,
+  const Matrix<Field>& XSeq,
+  Base<Field> tol,
+  const string& label )
+{
+    typedef Base<Field> Real;
+    const Grid& grid = A.Grid();
+
+    DistMultiVec<Field> R( B );
+    Multiply( NORMAL, Field(-1), A, X, Field(1), R );
+    const Real relResid = FrobeniusNorm( R ) / FrobeniusNorm( B );
+
+    DistMatrix<Field,STAR,STAR> X_STAR_STAR(grid);
+    Copy( X, X_STAR_STAR );
+    Matrix<Field> E( X_STAR_STAR.LockedMatrix() );
+    E -= XSeq;
+    const Real relDiff = FrobeniusNorm( E ) / FrobeniusNorm( XSeq );
+    OutputFromRoot
+    (grid.Comm(),label,": || B - A X ||_F / || B ||_F = ",relResid,
+     ", || X - XSeq ||_F / || XSeq ||_F = ",relDiff);
+    if( relResid > tol || relDiff > tol )
+        LogicError(label," disagreed with the sequential CG");
+}
+
+template<typename Field>
+void TestKrylov
+( Int n1,
+  Int n2,
+  Int numRHS,
+  Int restart,
+  Int maxIts,
+  bool progress,
+  const Grid& grid )
+{
+    typedef Base<Field> Real;
+    OutputFromRoot(grid.Comm(),"Testing with ",TypeName<Field>());
+    const Int n = n1*n2;
+    const Real relTol = Pow(limits::Epsilon<Real>(),Real(0.5));
+    // The solution error is bounded by the condition number (which is
+    // O(n1^2 + n2^2) for the Laplacian) times the relative residual
+    const Real tol = (n1*n1+n2*n2)*relTol;
+
+    DistSparseMatrix<Field> A(grid);
+    Laplacian( A, n1, n2 );
+    A *= -1;
+    SparseMatrix<Field> ASeq;
+    Laplacian( ASeq, n1, n2 );
+    ASeq *= -1;
+
+    DistMultiVec<Field> B( n, numRHS, grid );
+    MakeUniform( B );
+    DistMatrix<Field,STAR,STAR> B_STAR_STAR(grid);
+    Copy( B, B_STAR_STAR );
+
+    auto applySeq =
+      [&]( Field alpha, const Matrix<Field>& X, Field beta, Matrix<Field>& Y )
+      {
+        Multiply( NORMAL, alpha, ASeq, X, beta, Y );
+      };
+    auto precondSeq = []( Matrix<Field>& W ) { };
+    Matrix<Field> XSeq( B_STAR_STAR.LockedMatrix() );
+    const Int seqIts =
+      CG( applySeq, precondSeq, XSeq, relTol, maxIts, progress );
+    OutputFromRoot(grid.Comm(),"Sequential CG took ",seqIts," iterations");
+
+    auto applyDist =
+      [&]( Field alpha, const DistMultiVec<Field>& X,
+           Field beta,        DistMultiVec<Field>& Y )
+      {
+        Multiply( NORMAL, alpha, A, X, beta, Y );
+      };
+    auto precondDist = []( DistMultiVec<Field>& W ) { };
+
+    DistMultiVec<Field> X( B );
+    const Int cgIts =
+      CG( applyDist, precondDist, X, relTol, maxIts, progress );
+    OutputFromRoot(grid.Comm(),"Distributed CG took ",cgIts," iterations");
+    CheckAgainstSequential( A, B, X, XSeq, tol, "Chronopoulos-Gear CG" );
+
+    X = B;
+    const Int gmresIts =
+      FGMRES( applyDist, precondDist, X, relTol, restart, maxIts, progress );
+    OutputFromRoot
+    (grid.Comm(),"Distributed FGMRES took ",gmresIts," iterations");
+    CheckAgainstSequential( A, B, X, XSeq, tol, "CGS2 FGMRES" );
+    OutputFromRoot(grid.Comm(),"");
+}
+
+int main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int n1 = Input("--n1","first grid dimension",20);
+        const Int n2 = Input("--n2","second grid dimension",15);
+        const Int numRHS = Input("--numRHS","number of right-hand sides",2);
+        const Int restart = Input("--restart","FGMRES restart size",30);
+        const Int maxIts =
+          Input("--maxIts","maximum number of iterations",1000);
+        const bool progress = Input("--progress","print progress?",false);
+        ProcessInput();
+
+        const Grid grid( comm );
+
+        TestKrylov<float>( n1, n2, numRHS, restart, maxIts, progress, grid );
+        TestKrylov<double>( n1, n2, numRHS, restart, maxIts, progress, grid );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
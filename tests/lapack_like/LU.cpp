@@ -179,6 +179,7 @@ void TestLU
 ( const Grid& grid,
   Int m,
   Int pivoting,
+  const LUCtrl& ctrl,
   bool correctness,
   bool forceGrowth,
   bool print )
@@ -205,7 +206,7 @@ void TestLU
     if( pivoting == 0 )
         LU( A );
     else if( pivoting == 1 )
-        LU( A, P );
+        LU( A, P, ctrl );
     else if( pivoting == 2 )
         LU( A, P, Q );
     mpi::Barrier( grid.Comm() );
@@ -261,6 +262,8 @@ main( int argc, char* argv[] )
         const Int m = Input("--height","height of matrix",100);
         const Int nb = Input("--nb","algorithmic blocksize",96);
         const Int pivot = Input("--pivot","0: none, 1: partial, 2: full",1);
+        const bool tournament =
+          Input("--tournament","tournament pivoting of panels (CALU)?",false);
         const bool forceGrowth = Input
             ("--forceGrowth","force element growth?",false);
         const bool sequential = Input("--sequential","test sequential?",true);
@@ -284,6 +287,9 @@ main( int argc, char* argv[] )
         const GridOrder order = ( colMajor ? COLUMN_MAJOR : ROW_MAJOR );
         const Grid grid( comm, gridHeight, order );
         SetBlocksize( nb );
+        LUCtrl ctrl;
+        if( tournament )
+            ctrl.panelPivoting = LU_PANEL_TOURNAMENT;
         ComplainIfDebug();
         if( pivot == 0 )
             OutputFromRoot(grid.Comm(),"Testing LU with no pivoting");
@@ -332,39 +338,39 @@ main( int argc, char* argv[] )
         }
 
         TestLU<float>
-        ( grid, m, pivot, correctness, forceGrowth, print );
+        ( grid, m, pivot, ctrl, correctness, forceGrowth, print );
         TestLU<Complex<float>>
-        ( grid, m, pivot, correctness, forceGrowth, print );
+        ( grid, m, pivot, ctrl, correctness, forceGrowth, print );
 
         TestLU<double>
-        ( grid, m, pivot, correctness, forceGrowth, print );
+        ( grid, m, pivot, ctrl, correctness, forceGrowth, print );
         TestLU<Complex<double>>
-        ( grid, m, pivot, correctness, forceGrowth, print );
+        ( grid, m, pivot, ctrl, correctness, forceGrowth, print );
 
 #ifdef EL_HAVE_QD
         TestLU<DoubleDouble>
-        ( grid, m, pivot, correctness, forceGrowth, print );
+        ( grid, m, pivot, ctrl, correctness, forceGrowth, print );
         TestLU<QuadDouble>
-        ( grid, m, pivot, correctness, forceGrowth, print );
+        ( grid, m, pivot, ctrl, correctness, forceGrowth, print );
 
         TestLU<Complex<DoubleDouble>>
-        ( grid, m, pivot, correctness, forceGrowth, print );
+        ( grid, m, pivot, ctrl, correctness, forceGrowth, print );
         TestLU<Complex<QuadDouble>>
-        ( grid, m, pivot, correctness, forceGrowth, print );
+        ( grid, m, pivot, ctrl, correctness, forceGrowth, print );
 #endif
 
 #ifdef EL_HAVE_QUAD
         TestLU<Quad>
-        ( grid, m, pivot, correctness, forceGrowth, print );
+        ( grid, m, pivot, ctrl, correctness, forceGrowth, print );
         TestLU<Complex<Quad>>
-        ( grid, m, pivot, correctness, forceGrowth, print );
+        ( grid, m, pivot, ctrl, correctness, forceGrowth, print );
 #endif
 
 #ifdef EL_HAVE_MPC
         TestLU<BigFloat>
-        ( grid, m, pivot, correctness, forceGrowth, print );
+        ( grid, m, pivot, ctrl, correctness, forceGrowth, print );
         TestLU<Complex<BigFloat>>
-        ( grid, m, pivot, correctness, forceGrowth, print );
+        ( grid, m, pivot, ctrl, correctness, forceGrowth, print );
 #endif
     }
     catch( exception& e ) { ReportException(e); }
@@ -169,6 +169,7 @@ void TestQR
 ( const Grid& grid,
   Int m,
   Int n,
+  bool communicationAvoiding,
   bool correctness,
   bool print )
 {
@@ -189,7 +190,9 @@ void TestQR
     OutputFromRoot(grid.Comm(),"Starting QR factorization...");
     mpi::Barrier( grid.Comm() );
     const double startTime = mpi::Time();
-    QR( A, householderScalars, signature );
+    QRCtrl<Base<Field>> ctrl;
+    ctrl.communicationAvoiding = communicationAvoiding;
+    QR( A, householderScalars, signature, ctrl );
     mpi::Barrier( grid.Comm() );
     const double runTime = mpi::Time() - startTime;
     const double realGFlops = (2.*mD*nD*nD - 2./3.*nD*nD*nD)/(1.e9*runTime);
@@ -227,6 +230,8 @@ main( int argc, char* argv[] )
         const mpfr_prec_t prec = Input("--prec","MPFR precision",256);
 #endif
         const bool print = Input("--print","print matrices?",false);
+        const bool communicationAvoiding =
+          Input("--caqr","factor panels with TSQR?",false);
         ProcessInput();
         PrintInputReport();
 
@@ -281,39 +286,39 @@ main( int argc, char* argv[] )
         }
 
         TestQR<float>
-        ( grid, m, n, correctness, print );
+        ( grid, m, n, communicationAvoiding, correctness, print );
         TestQR<Complex<float>>
-        ( grid, m, n, correctness, print );
+        ( grid, m, n, communicationAvoiding, correctness, print );
 
         TestQR<double>
-        ( grid, m, n, correctness, print );
+        ( grid, m, n, communicationAvoiding, correctness, print );
         TestQR<Complex<double>>
-        ( grid, m, n, correctness, print );
+        ( grid, m, n, communicationAvoiding, correctness, print );
 
 #ifdef EL_HAVE_QD
         TestQR<DoubleDouble>
-        ( grid, m, n, correctness, print );
+        ( grid, m, n, communicationAvoiding, correctness, print );
         TestQR<QuadDouble>
-        ( grid, m, n, correctness, print );
+        ( grid, m, n, communicationAvoiding, correctness, print );
 
         TestQR<Complex<DoubleDouble>>
-        ( grid, m, n, correctness, print );
+        ( grid, m, n, communicationAvoiding, correctness, print );
         TestQR<Complex<QuadDouble>>
-        ( grid, m, n, correctness, print );
+        ( grid, m, n, communicationAvoiding, correctness, print );
 #endif
 
 #ifdef EL_HAVE_QUAD
         TestQR<Quad>
-        ( grid, m, n, correctness, print );
+        ( grid, m, n, communicationAvoiding, correctness, print );
         TestQR<Complex<Quad>>
-        ( grid, m, n, correctness, print );
+        ( grid, m, n, communicationAvoiding, correctness, print );
 #endif
 
 #ifdef EL_HAVE_MPC
         TestQR<BigFloat>
-        ( grid, m, n, correctness, print );
+        ( grid, m, n, communicationAvoiding, correctness, print );
         TestQR<Complex<BigFloat>>
-        ( grid, m, n, correctness, print );
+        ( grid, m, n, communicationAvoiding, correctness, print );
 #endif
     }
     catch( exception& e ) { ReportException(e); }
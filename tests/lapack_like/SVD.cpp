@@ -22,6 +22,8 @@ void TestSequentialSVD
   bool useQR,
   bool penalizeDerivative,
   Int divideCutoff,
+  bool twoStage,
+  Int bandwidth,
   bool print )
 {
     Output("Sequential test with ",TypeName<F>());
@@ -50,6 +52,10 @@ void TestSequentialSVD
     ctrl.bidiagSVDCtrl.dcCtrl.secularCtrl.penalizeDerivative =
       penalizeDerivative;
     ctrl.bidiagSVDCtrl.dcCtrl.secularCtrl.progress = progress;
+    ctrl.randomizedRank = rank;
+    ctrl.sdcCtrl.progress = progress;
+    ctrl.twoStageBidiag = twoStage;
+    ctrl.bidiagBandwidth = bandwidth;
     ctrl.time = time;
 
     Matrix<Real> s;
@@ -151,6 +157,22 @@ void TestSequentialSVD
         if( scaledResidual > Real(50) )
             LogicError("SVD residual was unacceptably large");
     }
+
+    // Compare the randomized singular values against a deterministic SVD
+    if( approach == RANDOMIZED_SVD )
+    {
+        Matrix<Real> sExact;
+        SVD( A, sExact );
+        Real maxDiff = 0;
+        for( Int i=0; i<numSingVals; ++i )
+            maxDiff = Max( maxDiff, Abs(s(i)-sExact(i)) );
+        const Real eps = limits::Epsilon<Real>();
+        const Real scaledDiff = maxDiff / (Max(m,n)*eps*twoNormA);
+        Output("|| s - sExact ||_max = ",maxDiff);
+        Output("|| s - sExact ||_max / (max(m,n) eps ||A||_2) = ",scaledDiff);
+        if( scaledDiff > Real(50) )
+            LogicError("Randomized singular values were inaccurate");
+    }
     Output("");
 }
 
@@ -168,6 +190,8 @@ void TestDistributedSVD
   bool useQR,
   bool penalizeDerivative,
   Int divideCutoff,
+  bool twoStage,
+  Int bandwidth,
   bool print )
 {
     typedef Base<F> Real;
@@ -199,6 +223,10 @@ void TestDistributedSVD
     ctrl.bidiagSVDCtrl.dcCtrl.secularCtrl.penalizeDerivative =
       penalizeDerivative;
     ctrl.bidiagSVDCtrl.dcCtrl.secularCtrl.progress = progress;
+    ctrl.randomizedRank = rank;
+    ctrl.sdcCtrl.progress = progress;
+    ctrl.twoStageBidiag = twoStage;
+    ctrl.bidiagBandwidth = bandwidth;
     ctrl.time = time;
 
     ctrl.time = time;
@@ -326,6 +354,28 @@ void TestDistributedSVD
         if( scaledResidual > Real(50) )
             LogicError("SVD residual was unacceptably large");
     }
+
+    // Compare the randomized singular values against a deterministic SVD
+    if( approach == RANDOMIZED_SVD )
+    {
+        DistMatrix<Real,STAR,STAR> sExact(grid);
+        SVD( A, sExact );
+        const auto& sLoc = s.LockedMatrix();
+        const auto& sExactLoc = sExact.LockedMatrix();
+        Real maxDiff = 0;
+        for( Int i=0; i<numSingVals; ++i )
+            maxDiff = Max( maxDiff, Abs(sLoc(i)-sExactLoc(i)) );
+        const Real eps = limits::Epsilon<Real>();
+        const Real scaledDiff = maxDiff / (Max(m,n)*eps*twoNormA);
+        if( commRank == 0 )
+        {
+            Output("|| s - sExact ||_max = ",maxDiff);
+            Output
+            ("|| s - sExact ||_max / (max(m,n) eps ||A||_2) = ",scaledDiff);
+        }
+        if( scaledDiff > Real(50) )
+            LogicError("Randomized singular values were inaccurate");
+    }
     if( commRank == 0 )
         Output("");
 }
@@ -346,6 +396,8 @@ void TestSVD
   bool useQR,
   bool penalizeDerivative,
   Int divideCutoff,
+  bool twoStage,
+  Int bandwidth,
   bool print )
 {
     const int commRank = mpi::Rank();
@@ -353,13 +405,15 @@ void TestSVD
     {
         TestSequentialSVD<F>
         ( m, n, rank, approach, tolType, tol, time, progress, wantU, wantV,
-          useQR, penalizeDerivative, divideCutoff, print );
+          useQR, penalizeDerivative, divideCutoff, twoStage, bandwidth,
+          print );
     }
     if( testDist )
     {
         TestDistributedSVD<F> 
         ( m, n, rank, approach, tolType, tol, time, progress, scalapack,
-          wantU, wantV, useQR, penalizeDerivative, divideCutoff, print );
+          wantU, wantV, useQR, penalizeDerivative, divideCutoff, twoStage,
+          bandwidth, print );
     }
 }
 
@@ -398,6 +452,10 @@ main( int argc, char* argv[] )
           Input
           ("--penalizeDerivative","penalize secular derivative in D&C?",false);
         const Int divideCutoff = Input("--divideCutoff","D&C cutoff?",60);
+        const bool twoStage =
+          Input("--twoStage","two-stage bidiagonalization?",false);
+        const Int bandwidth =
+          Input("--bandwidth","two-stage bandwidth (0 for blocksize)",0);
         const bool print = Input("--print","print matrices?",false);
         ProcessInput();
         PrintInputReport();
@@ -422,61 +480,61 @@ main( int argc, char* argv[] )
         TestSVD<float>
         ( m, n, rank, approach, tolType, tol, time, progress, scalapack,
           testSeq, testDist, wantU, wantV, useQR, penalizeDerivative,
-          divideCutoff, print );
+          divideCutoff, twoStage, bandwidth, print );
         TestSVD<Complex<float>>
         ( m, n, rank, approach, tolType, tol, time, progress, scalapack,
           testSeq, testDist, wantU, wantV, useQR, penalizeDerivative,
-          divideCutoff, print );
+          divideCutoff, twoStage, bandwidth, print );
 
         TestSVD<double>
         ( m, n, rank, approach, tolType, tol, time, progress, scalapack,
           testSeq, testDist, wantU, wantV, useQR, penalizeDerivative,
-          divideCutoff, print );
+          divideCutoff, twoStage, bandwidth, print );
         TestSVD<Complex<double>>
         ( m, n, rank, approach, tolType, tol, time, progress, scalapack,
           testSeq, testDist, wantU, wantV, useQR, penalizeDerivative,
-          divideCutoff, print );
+          divideCutoff, twoStage, bandwidth, print );
 
 #ifdef EL_HAVE_QD
         TestSVD<DoubleDouble>
         ( m, n, rank, approach, tolType, tol, time, progress, scalapack,
           testSeq, testDist, wantU, wantV, useQR, penalizeDerivative,
-          divideCutoff, print );
+          divideCutoff, twoStage, bandwidth, print );
         TestSVD<Complex<DoubleDouble>>
         ( m, n, rank, approach, tolType, tol, time, progress, scalapack,
           testSeq, testDist, wantU, wantV, useQR, penalizeDerivative,
-          divideCutoff, print );
+          divideCutoff, twoStage, bandwidth, print );
 
         TestSVD<QuadDouble>
         ( m, n, rank, approach, tolType, tol, time, progress, scalapack,
           testSeq, testDist, wantU, wantV, useQR, penalizeDerivative,
-          divideCutoff, print );
+          divideCutoff, twoStage, bandwidth, print );
         TestSVD<Complex<QuadDouble>>
         ( m, n, rank, approach, tolType, tol, time, progress, scalapack,
           testSeq, testDist, wantU, wantV, useQR, penalizeDerivative,
-          divideCutoff, print );
+          divideCutoff, twoStage, bandwidth, print );
 #endif
 
 #ifdef EL_HAVE_QUAD
         TestSVD<Quad>
         ( m, n, rank, approach, tolType, tol, time, progress, scalapack,
           testSeq, testDist, wantU, wantV, useQR, penalizeDerivative,
-          divideCutoff, print );
+          divideCutoff, twoStage, bandwidth, print );
         TestSVD<Complex<Quad>>
         ( m, n, rank, approach, tolType, tol, time, progress, scalapack,
           testSeq, testDist, wantU, wantV, useQR, penalizeDerivative,
-          divideCutoff, print );
+          divideCutoff, twoStage, bandwidth, print );
 #endif
 
 #ifdef EL_HAVE_MPC
         TestSVD<BigFloat>
         ( m, n, rank, approach, tolType, tol, time, progress, scalapack,
           testSeq, testDist, wantU, wantV, useQR, penalizeDerivative,
-          divideCutoff, print );
+          divideCutoff, twoStage, bandwidth, print );
         TestSVD<Complex<BigFloat>>
         ( m, n, rank, approach, tolType, tol, time, progress, scalapack,
           testSeq, testDist, wantU, wantV, useQR, penalizeDerivative,
-          divideCutoff, print );
+          divideCutoff, twoStage, bandwidth, print );
 #endif
     }
     catch( exception& e ) { ReportException(e); }
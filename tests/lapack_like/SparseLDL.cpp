@@ -41,6 +41,7 @@ void TestSparseDirect
   bool print,
   bool display,
   const BisectCtrl& ctrl,
+  const ldl::OutOfCoreCtrl& outOfCoreCtrl,
   const El::Grid& grid )
 {
     typedef Base<Field> Real;
@@ -100,6 +101,18 @@ void TestSparseDirect
 
     const Int rootSepSize = sparseLDLFact.NodeInfo().size;
     OutputFromRoot(grid.Comm(),rootSepSize," vertices in root separator\n");
+    const auto frontStats = ldl::ComputeFrontStats( sparseLDLFact.NodeInfo() );
+    OutputFromRoot
+    (grid.Comm(),frontStats.numFronts," fronts of sizes in [",
+     frontStats.minSize,",",frontStats.maxSize,"] with ",
+     frontStats.numEntries," factor entries\n",
+     frontStats.numAmalgamated," fronts were amalgamated, introducing ",
+     frontStats.numExplicitZeros," explicit zeros");
+    if( print )
+        for( size_t k=0; k<frontStats.sizeHistogram.size(); ++k )
+            OutputFromRoot
+            (grid.Comm(),"  ",frontStats.sizeHistogram[k],
+             " fronts of size in [",Int(1)<<k,",",Int(2)<<k,")");
     // TODO(poulson): Update the following for the new data structures
     /*
     if( display )
@@ -159,6 +172,7 @@ void TestSparseDirect
         else
             type = selInv ? LDL_SELINV_1D : LDL_1D;
     }
+    sparseLDLFact.SetOutOfCoreCtrl( outOfCoreCtrl );
     sparseLDLFact.Factor( type );
     mpi::Barrier( grid.Comm() );
     const double factTime = timer.Stop();
@@ -236,6 +250,20 @@ int main( int argc, char* argv[] )
         const Int nbFact = Input("--nbFact","factorization blocksize",96);
         const Int nbSolve = Input("--nbSolve","solve blocksize",96);
         const Int cutoff = Input("--cutoff","cutoff for nested dissection",128);
+        const bool multilevel =
+          Input("--multilevel","built-in multilevel partitioner?",false);
+        const bool amalgamate =
+          Input("--amalgamate","relaxed supernode amalgamation?",false);
+        const double amalgamationTol = Input
+          ("--amalgamationTol","max fraction of explicit zeros per front",0.1);
+        const bool compressSupervars =
+          Input("--compressSupervars","compress supervariables?",false);
+        const bool outOfCore =
+          Input("--outOfCore","store local fronts out-of-core?",false);
+        const string outOfCoreDir =
+          Input("--outOfCoreDir","out-of-core directory",string("."));
+        const double memoryBudget = Input
+          ("--memoryBudget","bytes of local fronts to keep in memory",1.e8);
         const bool unpack = Input("--unpack","unpack frontal matrix?",true);
         const bool print = Input("--print","print matrix?",false);
         const bool display = Input("--display","display matrix?",false);
@@ -249,34 +277,42 @@ int main( int argc, char* argv[] )
         ctrl.numSeqSeps = numSeqSeps;
         ctrl.numDistSeps = numDistSeps;
         ctrl.cutoff = cutoff;
+        ctrl.multilevel = multilevel;
+        ctrl.amalgamate = amalgamate;
+        ctrl.amalgamationTol = amalgamationTol;
+        ctrl.compressSupervariables = compressSupervars;
+        ldl::OutOfCoreCtrl outOfCoreCtrl;
+        outOfCoreCtrl.enabled = outOfCore;
+        outOfCoreCtrl.directory = outOfCoreDir;
+        outOfCoreCtrl.memoryBudget = memoryBudget;
         const El::Grid grid(comm);
 
         // TODO(poulson): Call complex variants as well
 
         TestSparseDirect<float>
         ( n1, n2, n3, numRHS, solve2d, selInv, intraPiv, nbFact, nbSolve,
-          natural, unpack, print, display, ctrl, grid );
+          natural, unpack, print, display, ctrl, outOfCoreCtrl, grid );
         TestSparseDirect<double>
         ( n1, n2, n3, numRHS, solve2d, selInv, intraPiv, nbFact, nbSolve,
-          natural, unpack, print, display, ctrl, grid );
+          natural, unpack, print, display, ctrl, outOfCoreCtrl, grid );
 #ifdef EL_HAVE_QD
         TestSparseDirect<DoubleDouble>
         ( n1, n2, n3, numRHS, solve2d, selInv, intraPiv, nbFact, nbSolve,
-          natural, unpack, print, display, ctrl, grid );
+          natural, unpack, print, display, ctrl, outOfCoreCtrl, grid );
         TestSparseDirect<QuadDouble>
         ( n1, n2, n3, numRHS, solve2d, selInv, intraPiv, nbFact, nbSolve,
-          natural, unpack, print, display, ctrl, grid );
+          natural, unpack, print, display, ctrl, outOfCoreCtrl, grid );
 #endif
 #ifdef EL_HAVE_QUAD
         TestSparseDirect<Quad>
         ( n1, n2, n3, numRHS, solve2d, selInv, intraPiv, nbFact, nbSolve,
-          natural, unpack, print, display, ctrl, grid );
+          natural, unpack, print, display, ctrl, outOfCoreCtrl, grid );
 #endif
 #ifdef EL_HAVE_MPC
         mpfr::SetPrecision( prec );
         TestSparseDirect<BigFloat>
         ( n1, n2, n3, numRHS, solve2d, selInv, intraPiv, nbFact, nbSolve,
-          natural, unpack, print, display, ctrl, grid );
+          natural, unpack, print, display, ctrl, ldl::OutOfCoreCtrl(), grid );
 #endif
     }
     catch( exception& e ) { ReportException(e); }
@@ -39,6 +39,7 @@ void TestSparseDirect
   Int n3,
   Int numRepeats,
   bool intraPiv,
+  bool pull,
   bool print,
   bool display,
   const BisectCtrl& ctrl,
@@ -77,7 +78,7 @@ void TestSparseDirect
 
     for( Int repeat=0; repeat<numRepeats; ++repeat )
     {
-        if( repeat != 0 )
+        if( repeat != 0 && !pull )
         {
             sparseLDLFact.ChangeFrontType( SYMM_2D );
             MakeFrontsUniform( sparseLDLFact.Front() );
@@ -86,10 +87,11 @@ void TestSparseDirect
         OutputFromRoot(grid.Comm(),"Running LDL^T and redistribution...");
         mpi::Barrier( grid.Comm() );
         timer.Start();
-        if( intraPiv )
-            sparseLDLFact.Factor( LDL_INTRAPIV_1D );
+        const LDLFrontType frontType = ( intraPiv ? LDL_INTRAPIV_1D : LDL_1D );
+        if( repeat != 0 && pull )
+            sparseLDLFact.Refactor( A, frontType );
         else
-            sparseLDLFact.Factor( LDL_1D );
+            sparseLDLFact.Factor( frontType );
         mpi::Barrier( grid.Comm() );
         timer.Stop();
         OutputFromRoot(grid.Comm(),timer.Partial()," seconds");
@@ -120,6 +122,8 @@ int main( int argc, char* argv[] )
         const Int numRepeats = Input
             ("--numRepeats","number of repeated factorizations",5);
         const bool intraPiv = Input("--intraPiv","frontal pivoting?",false);
+        const bool pull = Input
+            ("--pull","re-pull the values before refactoring?",false);
         const bool sequential = Input
             ("--sequential","sequential partitions?",true);
         const int numDistSeps = Input
@@ -128,10 +132,13 @@ int main( int argc, char* argv[] )
         const int numSeqSeps = Input
             ("--numSeqSeps",
              "number of partitions to try per sequential partition",1);
+        const Int subtreeThreads = Input
+            ("--subtreeThreads","threads for independent local subtrees",1);
         const Int cutoff = Input("--cutoff","cutoff for nested dissection",128);
         const bool print = Input("--print","print matrix?",false);
         const bool display = Input("--display","display matrix?",false);
         ProcessInput();
+        ldl::SetNumSubtreeThreads( subtreeThreads );
 
         BisectCtrl ctrl;
         ctrl.sequential = sequential;
@@ -142,9 +149,9 @@ int main( int argc, char* argv[] )
         const El::Grid grid( comm );
 
         TestSparseDirect<float>
-        ( n1, n2, n3, numRepeats, intraPiv, print, display, ctrl, grid );
+        ( n1, n2, n3, numRepeats, intraPiv, pull, print, display, ctrl, grid );
         TestSparseDirect<double>
-        ( n1, n2, n3, numRepeats, intraPiv, print, display, ctrl, grid );
+        ( n1, n2, n3, numRepeats, intraPiv, pull, print, display, ctrl, grid );
 
         // TODO(poulson): Test more datatypes? It makes the runtime much longer
     }
@@ -0,0 +1,124 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+template<typename Field>
+Int CountAtMost
+( const DistSparseMatrix<Field>& A, Base<Field> sigma, const BisectCtrl& ctrl )
+{
+    DistSparseMatrix<Field> AShift( A );
+    ShiftDiagonal( AShift, Field(-sigma) );
+    const InertiaType inertia = Inertia( AShift, ctrl );
+    return inertia.numNegative + inertia.numZero;
+}
+
+template<typename Field>
+void TestSpectrumSlice
+( Int n1,
+  Int n2,
+  Int n3,
+  Base<Field> lowerBound,
+  Base<Field> upperBound,
+  const SpectrumSliceCtrl<Base<Field>>& ctrl,
+  bool print,
+  const El::Grid& grid )
+{
+    OutputFromRoot(grid.Comm(),"Testing with ",TypeName<Field>());
+    typedef Base<Field> Real;
+    const Real eps = limits::Epsilon<Real>();
+    const Int N = n1*n2*n3;
+
+    DistSparseMatrix<Field> A(grid);
+    Laplacian( A, n1, n2, n3 );
+    const Real ANorm = FrobeniusNorm( A );
+
+    Matrix<Real> w;
+    DistMultiVec<Field> Z(grid);
+    Timer timer;
+    mpi::Barrier( grid.Comm() );
+    timer.Start();
+    HermitianSpectrumSlice( A, lowerBound, upperBound, w, Z, ctrl );
+    mpi::Barrier( grid.Comm() );
+    timer.Stop();
+    const Int numEigs = w.Height();
+    OutputFromRoot
+    (grid.Comm(),"Found ",numEigs," eigenvalues in (",lowerBound,",",
+     upperBound,"] in ",timer.Partial()," seconds");
+    if( print )
+        Print( w, "w" );
+
+    const Int expected =
+      CountAtMost( A, upperBound, ctrl.bisectCtrl ) -
+      CountAtMost( A, lowerBound, ctrl.bisectCtrl );
+    if( numEigs != expected )
+        LogicError("Expected ",expected," eigenvalues but found ",numEigs);
+    if( numEigs == 0 )
+        return;
+
+    // || A Z - Z W ||_F / (|| A ||_F eps N)
+    DistMultiVec<Field> R(grid);
+    R = Z;
+    auto& RLoc = R.Matrix();
+    for( Int j=0; j<numEigs; ++j )
+        for( Int iLoc=0; iLoc<R.LocalHeight(); ++iLoc )
+            RLoc(iLoc,j) *= w(j);
+    Multiply( NORMAL, Field(1), A, Z, Field(-1), R );
+    const Real residual = FrobeniusNorm( R ) / (ANorm*eps*N);
+    OutputFromRoot(grid.Comm(),"|| A Z - Z W ||_F / (|| A ||_F eps N) = ",
+      residual);
+
+    // || I - Z^H Z ||_F / (eps N)
+    Matrix<Field> G;
+    Identity( G, numEigs, numEigs );
+    Gemm
+    ( ADJOINT, NORMAL, Field(-1), Z.LockedMatrix(), Z.LockedMatrix(),
+      Field(1)/Field(mpi::Size(grid.Comm())), G );
+    mpi::AllReduce( G.Buffer(), numEigs*numEigs, grid.Comm() );
+    const Real orthogError = FrobeniusNorm( G ) / (eps*N);
+    OutputFromRoot(grid.Comm(),"|| I - Z^H Z ||_F / (eps N) = ",orthogError);
+}
+
+int main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int n1 = Input("--n1","first grid dimension",10);
+        const Int n2 = Input("--n2","second grid dimension",10);
+        const Int n3 = Input("--n3","third grid dimension",10);
+        const double lowerBound = Input("--lower","lower bound",-100.);
+        const double upperBound = Input("--upper","upper bound",-30.);
+        const Int numSlices = Input("--numSlices","number of slices",4);
+        const Int numTeams =
+          Input("--numTeams","number of process teams (0 for default)",0);
+        const Int blockSize = Input("--blockSize","Lanczos block size",4);
+        const bool sequential = Input
+            ("--sequential","sequential partitions?",true);
+        const bool progress = Input("--progress","print progress?",false);
+        const bool print = Input("--print","print eigenvalues?",false);
+        ProcessInput();
+
+        SpectrumSliceCtrl<double> ctrl;
+        ctrl.numSlices = numSlices;
+        ctrl.numTeams = numTeams;
+        ctrl.blockSize = blockSize;
+        ctrl.bisectCtrl.sequential = sequential;
+        ctrl.progress = progress;
+
+        const El::Grid grid( comm );
+        TestSpectrumSlice<double>
+        ( n1, n2, n3, lowerBound, upperBound, ctrl, print, grid );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -128,6 +128,8 @@ void TestTriangularInverse
 
     OutputFromRoot(g.Comm(),"Starting triangular inversion...");
     mpi::Barrier( g.Comm() );
+    ResetMemoryStats();
+    const size_t liveBytes = GetMemoryStats().liveBytes;
     Timer timer;
     timer.Start();
     TriangularInverse( uplo, diag, A );
@@ -136,6 +138,14 @@ void TestTriangularInverse
     const double realGFlops = 1./3.*Pow(double(m),3.)/(1.e9*runTime);
     const double gFlops = IsComplex<Field>::value ? 4*realGFlops : realGFlops;
     OutputFromRoot(g.Comm(),"Time = ",runTime," seconds (",gFlops," GFlop/s)");
+    const double workspace =
+      mpi::AllReduce
+      ( double(GetMemoryStats().peakBytes-liveBytes), mpi::MAX, g.Comm() );
+    const double localBytes =
+      double(A.LocalHeight())*A.LocalWidth()*sizeof(Field);
+    OutputFromRoot
+    (g.Comm(),"Peak workspace = ",workspace," bytes (",localBytes,
+     " bytes per local matrix)");
     if( print )
         Print( A, "A after inversion" );
     if( correctness )
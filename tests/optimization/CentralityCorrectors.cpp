@@ -0,0 +1,160 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// Check that the Mehrotra IPMs reach the same optimum with and without the
+// Gondzio multiple centrality correctors for random feasible and bounded
+// direct-form LPs and QPs (through both the dense and sparse solvers).
+
+template<typename Real>
+void DenseToSparse( const Matrix<Real>& A, SparseMatrix<Real>& ASparse )
+{
+    const Int m = A.Height();
+    const Int n = A.Width();
+    Zeros( ASparse, m, n );
+    ASparse.Reserve( m*n );
+    for( Int j=0; j<n; ++j )
+        for( Int i=0; i<m; ++i )
+            ASparse.QueueUpdate( i, j, A(i,j) );
+    ASparse.ProcessQueues();
+}
+
+// Generate A x = b, x >= 0 with a strictly feasible point and c such that
+// A^T y - z + c = 0 has a strictly feasible dual point
+template<typename Real>
+void RandomDirectProblem
+( Int m, Int n, Matrix<Real>& A, Matrix<Real>& b, Matrix<Real>& c )
+{
+    Matrix<Real> xFeas, yFeas, zFeas;
+    Uniform( xFeas, n, 1, Real(1), Real(1) );
+    Uniform( zFeas, n, 1, Real(1), Real(1) );
+    Uniform( yFeas, m, 1 );
+    Uniform( A, m, n );
+    Gemv( NORMAL, Real(1), A, xFeas, b );
+    c = zFeas;
+    Gemv( TRANSPOSE, Real(-1), A, yFeas, Real(1), c );
+}
+
+template<typename Real>
+void CompareObjectives
+( Real objective, Real objectiveCorr, Real tol, const string& label )
+{
+    const Real relDiff =
+      Abs(objective-objectiveCorr) / Max(Abs(objective),Real(1));
+    Output
+    ("  ",label,": ",objective," without correctors, ",objectiveCorr,
+     " with correctors (relative difference ",relDiff,")");
+    if( relDiff > tol )
+        LogicError(label," reached a different optimum with correctors");
+}
+
+template<typename Real>
+void TestCorrectors( Int m, Int n, Int numCorrectors, bool progress )
+{
+    Output("Testing with ",TypeName<Real>());
+    const Real tol = Pow(limits::Epsilon<Real>(),Real(0.3));
+
+    Matrix<Real> A, b, c;
+    RandomDirectProblem( m, n, A, b, c );
+    SparseMatrix<Real> ASparse;
+    DenseToSparse( A, ASparse );
+
+    // Linear Programs
+    // ===============
+    {
+        DirectLPProblem<Matrix<Real>,Matrix<Real>> problem;
+        problem.A = A;
+        problem.b = b;
+        problem.c = c;
+        DirectLPSolution<Matrix<Real>> solution, solutionCorr;
+        lp::direct::Ctrl<Real> ctrl(false);
+        ctrl.mehrotraCtrl.print = progress;
+        LP( problem, solution, ctrl );
+        ctrl.mehrotraCtrl.maxCentralityCorrectors = numCorrectors;
+        LP( problem, solutionCorr, ctrl );
+        CompareObjectives
+        ( Dot(c,solution.x), Dot(c,solutionCorr.x), tol, "dense LP" );
+    }
+    {
+        DirectLPProblem<SparseMatrix<Real>,Matrix<Real>> problem;
+        problem.A = ASparse;
+        problem.b = b;
+        problem.c = c;
+        DirectLPSolution<Matrix<Real>> solution, solutionCorr;
+        lp::direct::Ctrl<Real> ctrl(true);
+        ctrl.mehrotraCtrl.print = progress;
+        LP( problem, solution, ctrl );
+        ctrl.mehrotraCtrl.maxCentralityCorrectors = numCorrectors;
+        LP( problem, solutionCorr, ctrl );
+        CompareObjectives
+        ( Dot(c,solution.x), Dot(c,solutionCorr.x), tol, "sparse LP" );
+    }
+
+    // Quadratic Programs with Q := I + X^T X
+    // ======================================
+    Matrix<Real> Q, X;
+    Uniform( X, n, n );
+    Identity( Q, n, n );
+    Syrk( LOWER, TRANSPOSE, Real(1), X, Real(1), Q );
+    MakeSymmetric( LOWER, Q );
+    SparseMatrix<Real> QSparse;
+    DenseToSparse( Q, QSparse );
+    auto objective = [&]( const Matrix<Real>& x )
+      {
+          Matrix<Real> Qx;
+          Gemv( NORMAL, Real(1), Q, x, Qx );
+          return Dot(x,Qx)/Real(2) + Dot(c,x);
+      };
+    {
+        Matrix<Real> x, y, z, xCorr, yCorr, zCorr;
+        qp::direct::Ctrl<Real> ctrl;
+        ctrl.mehrotraCtrl.print = progress;
+        QP( Q, A, b, c, x, y, z, ctrl );
+        ctrl.mehrotraCtrl.maxCentralityCorrectors = numCorrectors;
+        QP( Q, A, b, c, xCorr, yCorr, zCorr, ctrl );
+        CompareObjectives
+        ( objective(x), objective(xCorr), tol, "dense QP" );
+    }
+    {
+        Matrix<Real> x, y, z, xCorr, yCorr, zCorr;
+        qp::direct::Ctrl<Real> ctrl;
+        ctrl.mehrotraCtrl.print = progress;
+        QP( QSparse, ASparse, b, c, x, y, z, ctrl );
+        ctrl.mehrotraCtrl.maxCentralityCorrectors = numCorrectors;
+        QP( QSparse, ASparse, b, c, xCorr, yCorr, zCorr, ctrl );
+        CompareObjectives
+        ( objective(x), objective(xCorr), tol, "sparse QP" );
+    }
+    Output("");
+}
+
+int main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+
+    try
+    {
+        const Int m = Input("--m","height of A",40);
+        const Int n = Input("--n","width of A",60);
+        const Int numCorrectors =
+          Input("--numCorrectors","maximum number of correctors",3);
+        const bool progress = Input("--progress","print progress?",false);
+        ProcessInput();
+
+        if( mpi::Rank() == 0 )
+        {
+            TestCorrectors<float>( m, n, numCorrectors, progress );
+            TestCorrectors<double>( m, n, numCorrectors, progress );
+        }
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
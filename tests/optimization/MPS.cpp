@@ -0,0 +1,206 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// Write out a small MPS file, read it back (both directly and through the
+// binary cache produced by CacheMPS, into sequential and distributed
+// problems), check that every path yields the same affine LP, and check that
+// its solution matches the one known analytically.
+//
+// The LP is
+//
+//   min x1 + 2 x2 - x3
+//   s.t. x1 + x2 + x3 <= 4, x1 - x2 >= -1, x2 + x3 = 3,
+//        x1 >= 1/2, 0 <= x2, 0 <= x3 <= 5/2,
+//
+// whose unique solution is x = (1/2,1/2,5/2) with an objective of -1. The
+// file also contains comment lines and a second N row, which must not be
+// treated as the objective.
+
+void WriteTestFile( const string& filename )
+{
+    std::ofstream file( filename.c_str() );
+    if( !file.is_open() )
+        RuntimeError("Could not open ",filename);
+    file << "* A small LP for testing the MPS reader\n"
+         << "NAME          TESTLP\n"
+         << "ROWS\n"
+         << " N  COST\n"
+         << " L  R1\n"
+         << " G  R2\n"
+         << " E  R3\n"
+         << " N  FREEROW\n"
+         << "COLUMNS\n"
+         << "    X1        COST         1.0   R1           1.0\n"
+         << "    X1        R2           1.0\n"
+         << "    X2        COST         2.0   R1           1.0\n"
+         << "    X2        R2          -1.0   R3           1.0\n"
+         << "# The free row must be ignored\n"
+         << "    X3        COST        -1.0   R1           1.0\n"
+         << "    X3        R3           1.0   FREEROW      5.0\n"
+         << "RHS\n"
+         << "    RHS       R1           4.0   R2          -1.0\n"
+         << "    RHS       R3           3.0\n"
+         << "BOUNDS\n"
+         << " LO BND       X1           0.5\n"
+         << " UP BND       X3           2.5\n"
+         << "ENDATA\n";
+}
+
+template<typename Real>
+Real MaxDifference( const Matrix<Real>& A, const Matrix<Real>& B )
+{
+    if( A.Height() != B.Height() || A.Width() != B.Width() )
+        return limits::Infinity<Real>();
+    Matrix<Real> E( A );
+    E -= B;
+    return MaxNorm( E );
+}
+
+template<typename Real>
+Real MaxDifference( const SparseMatrix<Real>& A, const SparseMatrix<Real>& B )
+{
+    Matrix<Real> ADense, BDense;
+    Copy( A, ADense );
+    Copy( B, BDense );
+    return MaxDifference( ADense, BDense );
+}
+
+template<typename Real>
+Real MaxDifference
+( const AffineLPProblem<SparseMatrix<Real>,Matrix<Real>>& problem,
+  const AffineLPProblem<SparseMatrix<Real>,Matrix<Real>>& problemRef )
+{
+    return Max( Max( MaxDifference( problem.A, problemRef.A ),
+                     MaxDifference( problem.G, problemRef.G ) ),
+                Max( Max( MaxDifference( problem.b, problemRef.b ),
+                          MaxDifference( problem.c, problemRef.c ) ),
+                     MaxDifference( problem.h, problemRef.h ) ) );
+}
+
+template<typename Real>
+Real MaxDifference
+( const DistSparseMatrix<Real>& A, const SparseMatrix<Real>& BSeq )
+{
+    DistMatrix<Real> ADense(A.Grid());
+    Copy( A, ADense );
+    DistMatrix<Real,STAR,STAR> ADense_STAR_STAR( ADense );
+    Matrix<Real> BDense;
+    Copy( BSeq, BDense );
+    return MaxDifference( ADense_STAR_STAR.Matrix(), BDense );
+}
+
+template<typename Real>
+Real MaxDifference( const DistMultiVec<Real>& x, const Matrix<Real>& xSeq )
+{
+    if( x.Height() != xSeq.Height() || x.Width() != xSeq.Width() )
+        return limits::Infinity<Real>();
+    Real diff = 0;
+    for( Int iLoc=0; iLoc<x.LocalHeight(); ++iLoc )
+        for( Int j=0; j<x.Width(); ++j )
+            diff =
+              Max( diff, Abs(x.GetLocal(iLoc,j)-xSeq(x.GlobalRow(iLoc),j)) );
+    return mpi::AllReduce( diff, mpi::MAX, x.Grid().Comm() );
+}
+
+template<typename Real>
+Real MaxDifference
+( const AffineLPProblem<DistSparseMatrix<Real>,DistMultiVec<Real>>& problem,
+  const AffineLPProblem<SparseMatrix<Real>,Matrix<Real>>& problemRef )
+{
+    return Max( Max( MaxDifference( problem.A, problemRef.A ),
+                     MaxDifference( problem.G, problemRef.G ) ),
+                Max( Max( MaxDifference( problem.b, problemRef.b ),
+                          MaxDifference( problem.c, problemRef.c ) ),
+                     MaxDifference( problem.h, problemRef.h ) ) );
+}
+
+template<typename Real>
+void TestMPS
+( const string& filename, const string& cacheFilename, const Grid& grid,
+  bool progress )
+{
+    OutputFromRoot(grid.Comm(),"Testing with ",TypeName<Real>());
+    const Real tol = Pow(limits::Epsilon<Real>(),Real(0.5));
+
+    AffineLPProblem<SparseMatrix<Real>,Matrix<Real>> problem, problemCache;
+    ReadMPS( problem, filename );
+    ReadMPS( problemCache, cacheFilename );
+    if( problem.A.Height() != 1 || problem.A.Width() != 3 )
+        LogicError
+        ("Expected a 1 x 3 equality matrix but read a ",problem.A.Height(),
+         " x ",problem.A.Width()," matrix");
+    const Real cacheDiff = MaxDifference( problemCache, problem );
+
+    AffineLPProblem<DistSparseMatrix<Real>,DistMultiVec<Real>>
+      problemDist, problemDistCache;
+    ForceSimpleAlignments( problemDist, grid );
+    ForceSimpleAlignments( problemDistCache, grid );
+    ReadMPS( problemDist, filename );
+    ReadMPS( problemDistCache, cacheFilename );
+    const Real distDiff = MaxDifference( problemDist, problem );
+    const Real distCacheDiff = MaxDifference( problemDistCache, problem );
+    OutputFromRoot
+    (grid.Comm(),"  cache difference = ",cacheDiff,
+     ", distributed difference = ",distDiff,
+     ", distributed cache difference = ",distCacheDiff);
+    if( cacheDiff != Real(0) )
+        LogicError("The cached MPS file disagreed with the MPS file");
+    if( distDiff != Real(0) || distCacheDiff != Real(0) )
+        LogicError("The distributed MPS reads disagreed with the sequential");
+
+    Matrix<Real> xTrue(3,1);
+    xTrue(0) = Real(1)/Real(2);
+    xTrue(1) = Real(1)/Real(2);
+    xTrue(2) = Real(5)/Real(2);
+    if( grid.Rank() == 0 )
+    {
+        AffineLPSolution<Matrix<Real>> solution;
+        lp::affine::Ctrl<Real> ctrl;
+        ctrl.mehrotraCtrl.print = progress;
+        LP( problem, solution, ctrl );
+        const Real objective = Dot( problem.c, solution.x );
+        const Real xDiff = MaxDifference( solution.x, xTrue );
+        Output
+        ("  objective = ",objective,", || x - xTrue ||_max = ",xDiff);
+        if( Abs(objective+Real(1)) > tol || xDiff > tol )
+            LogicError("The LP read from the MPS file had the wrong solution");
+    }
+    OutputFromRoot(grid.Comm(),"");
+}
+
+int main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const string filename =
+          Input("--filename","MPS file to write","TestMPS.mps");
+        const bool progress = Input("--progress","print progress?",false);
+        ProcessInput();
+
+        const string cacheFilename = filename + ".cache";
+        if( mpi::Rank(comm) == 0 )
+        {
+            WriteTestFile( filename );
+            CacheMPS( filename, cacheFilename );
+        }
+        mpi::Barrier( comm );
+
+        const Grid grid( comm );
+        TestMPS<float>( filename, cacheFilename, grid, progress );
+        TestMPS<double>( filename, cacheFilename, grid, progress );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -0,0 +1,210 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// Append a singleton row, a forcing row, a duplicate row, an empty row, and
+// an empty column to a random feasible and bounded direct-form problem, and
+// check that solving with presolve (and PostsolveDirect) yields the same
+// primal-dual solution as solving the original problem.
+//
+// Column n0 is fixed by the singleton row, columns n0+1 and n0+2 are forced
+// to zero by the forcing row, and column n0+3 is empty.
+template<typename Real>
+void ReducibleProblem
+( Int m0, Int n0,
+  SparseMatrix<Real>& A, Matrix<Real>& b, Matrix<Real>& c )
+{
+    const Int m = m0 + 4;
+    const Int n = n0 + 4;
+    const Int singletonCol = n0;
+    const Int forcedCol0 = n0+1, forcedCol1 = n0+2;
+    const Int emptyCol = n0+3;
+    const Int singletonRow = m0, forcingRow = m0+1, duplicateRow = m0+2;
+
+    Matrix<Real> A0, xFeas, yFeas, zFeas;
+    Uniform( A0, m0, emptyCol );
+    Uniform( xFeas, n, 1, Real(1), Real(1) );
+    Uniform( yFeas, m0, 1 );
+    Uniform( zFeas, n, 1, Real(1), Real(1) );
+    xFeas(singletonCol) = Real(1)/Real(2);
+    xFeas(forcedCol0) = xFeas(forcedCol1) = xFeas(emptyCol) = 0;
+
+    Zeros( A, m, n );
+    A.Reserve( m0*emptyCol + 1 + 2 + emptyCol );
+    for( Int i=0; i<m0; ++i )
+        for( Int j=0; j<emptyCol; ++j )
+            A.QueueUpdate( i, j, A0(i,j) );
+    A.QueueUpdate( singletonRow, singletonCol, Real(2) );
+    A.QueueUpdate( forcingRow, forcedCol0, Real(1) );
+    A.QueueUpdate( forcingRow, forcedCol1, Real(3) );
+    for( Int j=0; j<emptyCol; ++j )
+        A.QueueUpdate( duplicateRow, j, -2*A0(0,j) );
+    A.ProcessQueues();
+
+    // The empty row m0+3 has a zero right-hand side
+    Zeros( b, m, 1 );
+    Multiply( NORMAL, Real(1), A, xFeas, Real(0), b );
+
+    c = zFeas;
+    auto cTop = c( IR(0,emptyCol), ALL );
+    Gemv( TRANSPOSE, Real(-1), A0, yFeas, Real(1), cTop );
+}
+
+template<typename Real>
+void CheckReductions( const DirectPresolveInfo<Real>& info )
+{
+    vector<Int> counts(5,0);
+    for( const auto& step : info.steps )
+        ++counts[step.reduction];
+    Output
+    ("  presolve kept ",info.keptRows.size()," of ",info.height," rows and ",
+     info.keptCols.size()," of ",info.width," columns");
+    if( counts[PRESOLVE_EMPTY_ROW] == 0 )
+        LogicError("The empty row was not removed");
+    if( counts[PRESOLVE_SINGLETON_ROW] == 0 )
+        LogicError("The singleton row was not removed");
+    if( counts[PRESOLVE_FORCING_ROW] != 2 )
+        LogicError("The forcing row did not fix its two columns");
+    if( counts[PRESOLVE_DUPLICATE_ROW] == 0 )
+        LogicError("The duplicate row was not removed");
+    if( counts[PRESOLVE_EMPTY_COLUMN] == 0 )
+        LogicError("The empty column was not fixed");
+}
+
+template<typename Real>
+void CompareSolutions
+( const SparseMatrix<Real>* Q,
+  const SparseMatrix<Real>& A,
+  const Matrix<Real>& b,
+  const Matrix<Real>& c,
+  const Matrix<Real>& x,
+  const Matrix<Real>& y,
+  const Matrix<Real>& z,
+  const Matrix<Real>& xPre,
+  const Matrix<Real>& yPre,
+  const Matrix<Real>& zPre,
+  Real tol,
+  const string& label )
+{
+    // The dual variable y is not unique (the duplicate and empty rows
+    // leave A rank-deficient), so compare x, z, and the dual objective and
+    // check that the postsolved (y,z) satisfies Q x + A^T y - z + c = 0
+    auto relDiff = [&]( const Matrix<Real>& u, const Matrix<Real>& v )
+      {
+          Matrix<Real> e( u );
+          e -= v;
+          return FrobeniusNorm( e ) / Max( FrobeniusNorm(u), Real(1) );
+      };
+    const Real xDiff = relDiff( x, xPre );
+    const Real zDiff = relDiff( z, zPre );
+    const Real dualObj = -Dot(b,y), dualObjPre = -Dot(b,yPre);
+    const Real dualObjDiff =
+      Abs(dualObj-dualObjPre) / Max(Abs(dualObj),Real(1));
+
+    Matrix<Real> rDual( c );
+    rDual -= zPre;
+    Multiply( TRANSPOSE, Real(1), A, yPre, Real(1), rDual );
+    if( Q != nullptr )
+        Multiply( NORMAL, Real(1), *Q, xPre, Real(1), rDual );
+    const Real dualResid =
+      FrobeniusNorm( rDual ) / Max( FrobeniusNorm(c), Real(1) );
+
+    Output
+    ("  ",label,":\n",Indent(),
+     "  || x - xPre ||_2 / max( || x ||_2, 1 ) = ",xDiff,"\n",Indent(),
+     "  || z - zPre ||_2 / max( || z ||_2, 1 ) = ",zDiff,"\n",Indent(),
+     "  relative dual objective difference = ",dualObjDiff,"\n",Indent(),
+     "  postsolved relative dual residual = ",dualResid);
+    if( xDiff > tol || zDiff > tol || dualObjDiff > tol || dualResid > tol )
+        LogicError(label," with presolve disagreed with the original solve");
+}
+
+template<typename Real>
+void TestPresolve( Int m0, Int n0, bool progress )
+{
+    Output("Testing with ",TypeName<Real>());
+    const Real tol = Pow(limits::Epsilon<Real>(),Real(0.25));
+
+    SparseMatrix<Real> A;
+    Matrix<Real> b, c;
+    ReducibleProblem( m0, n0, A, b, c );
+    {
+        SparseMatrix<Real> AReduced;
+        Matrix<Real> bReduced, cReduced;
+        DirectPresolveInfo<Real> info;
+        PresolveDirect( A, b, c, AReduced, bReduced, cReduced, info );
+        CheckReductions( info );
+    }
+
+    // Linear Program
+    // ==============
+    {
+        DirectLPProblem<SparseMatrix<Real>,Matrix<Real>> problem;
+        problem.A = A;
+        problem.b = b;
+        problem.c = c;
+        DirectLPSolution<Matrix<Real>> solution, solutionPre;
+        lp::direct::Ctrl<Real> ctrl(true);
+        ctrl.mehrotraCtrl.print = progress;
+        LP( problem, solution, ctrl );
+        ctrl.presolve = true;
+        ctrl.presolveCtrl.progress = progress;
+        LP( problem, solutionPre, ctrl );
+        CompareSolutions<Real>
+        ( nullptr, A, b, c,
+          solution.x, solution.y, solution.z,
+          solutionPre.x, solutionPre.y, solutionPre.z, tol, "LP" );
+    }
+
+    // Quadratic Program with Q := I on the leading n0 columns
+    // =======================================================
+    {
+        const Int n = A.Width();
+        SparseMatrix<Real> Q;
+        Zeros( Q, n, n );
+        Q.Reserve( n0 );
+        for( Int j=0; j<n0; ++j )
+            Q.QueueUpdate( j, j, Real(1) );
+        Q.ProcessQueues();
+
+        Matrix<Real> x, y, z, xPre, yPre, zPre;
+        qp::direct::Ctrl<Real> ctrl;
+        ctrl.mehrotraCtrl.print = progress;
+        QP( Q, A, b, c, x, y, z, ctrl );
+        ctrl.presolve = true;
+        ctrl.presolveCtrl.progress = progress;
+        QP( Q, A, b, c, xPre, yPre, zPre, ctrl );
+        CompareSolutions
+        ( &Q, A, b, c, x, y, z, xPre, yPre, zPre, tol, "QP" );
+    }
+    Output("");
+}
+
+int main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+
+    try
+    {
+        const Int m0 = Input("--m0","height of the random block",30);
+        const Int n0 = Input("--n0","width of the random block",50);
+        const bool progress = Input("--progress","print progress?",false);
+        ProcessInput();
+
+        if( mpi::Rank() == 0 )
+        {
+            TestPresolve<float>( m0, n0, progress );
+            TestPresolve<double>( m0, n0, progress );
+        }
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}